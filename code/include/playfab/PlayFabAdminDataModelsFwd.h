@@ -0,0 +1,355 @@
+#pragma once
+
+#if defined(ENABLE_PLAYFABADMIN_API)
+
+namespace PlayFab
+{
+    namespace AdminModels
+    {
+        // Forward declarations of the Admin models, for headers which only pass them by reference
+        enum class AuthTokenType;
+        enum class Conditionals;
+        enum class ContinentCode;
+        enum class CountryCode;
+        enum class Currency;
+        enum class EffectType;
+        enum class EmailVerificationStatus;
+        enum class GameBuildStatus;
+        enum class GenericErrorCodes;
+        enum class LoginIdentityProvider;
+        enum class PushNotificationPlatform;
+        enum class PushSetupPlatform;
+        enum class Region;
+        enum class ResolutionOutcome;
+        enum class ResultTableNodeType;
+        enum class ScheduledTaskType;
+        enum class SegmentCountryCode;
+        enum class SegmentCurrency;
+        enum class SegmentFilterComparison;
+        enum class SegmentLoginIdentityProvider;
+        enum class SegmentPushNotificationDevicePlatform;
+        enum class SourceType;
+        enum class StatisticAggregationMethod;
+        enum class StatisticResetIntervalOption;
+        enum class StatisticVersionArchivalStatus;
+        enum class StatisticVersionStatus;
+        enum class SubscriptionProviderStatus;
+        enum class TaskInstanceStatus;
+        enum class TitleActivationStatus;
+        enum class UserDataPermission;
+        enum class UserOrigination;
+
+        struct AbortTaskInstanceRequest;
+        struct ActionsOnPlayersInSegmentTaskParameter;
+        struct NameIdentifier;
+        struct ActionsOnPlayersInSegmentTaskSummary;
+        struct AdCampaignAttribution;
+        struct AdCampaignAttributionModel;
+        struct AdCampaignSegmentFilter;
+        struct AddLocalizedNewsRequest;
+        struct AddLocalizedNewsResult;
+        struct AddNewsRequest;
+        struct AddNewsResult;
+        struct AddPlayerTagRequest;
+        struct AddPlayerTagResult;
+        struct AddServerBuildRequest;
+        struct AddServerBuildResult;
+        struct AddUserVirtualCurrencyRequest;
+        struct VirtualCurrencyData;
+        struct AddVirtualCurrencyTypesRequest;
+        struct AllPlayersSegmentFilter;
+        struct ApiCondition;
+        struct BanInfo;
+        struct BanPlayerSegmentAction;
+        struct BanRequest;
+        struct BanUsersRequest;
+        struct BanUsersResult;
+        struct BlankResult;
+        struct CatalogItemBundleInfo;
+        struct CatalogItemConsumableInfo;
+        struct CatalogItemContainerInfo;
+        struct CatalogItem;
+        struct CheckLimitedEditionItemAvailabilityRequest;
+        struct CheckLimitedEditionItemAvailabilityResult;
+        struct CloudScriptFile;
+        struct CloudScriptTaskParameter;
+        struct ScriptExecutionError;
+        struct LogStatement;
+        struct ExecuteCloudScriptResult;
+        struct CloudScriptTaskSummary;
+        struct CloudScriptVersionStatus;
+        struct ContactEmailInfo;
+        struct ContactEmailInfoModel;
+        struct ContentInfo;
+        struct CreateActionsOnPlayerSegmentTaskRequest;
+        struct CreateCloudScriptTaskRequest;
+        struct InsightsScalingTaskParameter;
+        struct CreateInsightsScheduledScalingTaskRequest;
+        struct OpenIdIssuerInformation;
+        struct CreateOpenIdConnectionRequest;
+        struct CreatePlayerSharedSecretRequest;
+        struct CreatePlayerSharedSecretResult;
+        struct CreatePlayerStatisticDefinitionRequest;
+        struct PlayerStatisticDefinition;
+        struct CreatePlayerStatisticDefinitionResult;
+        struct DeletePlayerSegmentAction;
+        struct DeletePlayerStatisticSegmentAction;
+        struct EmailNotificationSegmentAction;
+        struct ExecuteAzureFunctionSegmentAction;
+        struct ExecuteCloudScriptSegmentAction;
+        struct GrantItemSegmentAction;
+        struct GrantVirtualCurrencySegmentAction;
+        struct IncrementPlayerStatisticSegmentAction;
+        struct PushNotificationSegmentAction;
+        struct SegmentTrigger;
+        struct FirstLoginDateSegmentFilter;
+        struct FirstLoginTimespanSegmentFilter;
+        struct LastLoginDateSegmentFilter;
+        struct LastLoginTimespanSegmentFilter;
+        struct LinkedUserAccountSegmentFilter;
+        struct LinkedUserAccountHasEmailSegmentFilter;
+        struct LocationSegmentFilter;
+        struct PushNotificationSegmentFilter;
+        struct StatisticSegmentFilter;
+        struct TagSegmentFilter;
+        struct TotalValueToDateInUSDSegmentFilter;
+        struct UserOriginationSegmentFilter;
+        struct ValueToDateSegmentFilter;
+        struct VirtualCurrencyBalanceSegmentFilter;
+        struct SegmentAndDefinition;
+        struct SegmentOrDefinition;
+        struct SegmentModel;
+        struct CreateSegmentRequest;
+        struct CreateSegmentResponse;
+        struct CreateTaskResult;
+        struct DeleteContentRequest;
+        struct DeleteMasterPlayerAccountRequest;
+        struct DeleteMasterPlayerAccountResult;
+        struct DeleteOpenIdConnectionRequest;
+        struct DeletePlayerRequest;
+        struct DeletePlayerResult;
+        struct DeletePlayerSharedSecretRequest;
+        struct DeletePlayerSharedSecretResult;
+        struct DeleteSegmentRequest;
+        struct DeleteSegmentsResponse;
+        struct DeleteStoreRequest;
+        struct DeleteStoreResult;
+        struct DeleteTaskRequest;
+        struct DeleteTitleDataOverrideRequest;
+        struct DeleteTitleDataOverrideResult;
+        struct DeleteTitleRequest;
+        struct DeleteTitleResult;
+        struct EmptyResponse;
+        struct EntityKey;
+        struct ExportMasterPlayerDataRequest;
+        struct ExportMasterPlayerDataResult;
+        struct GameModeInfo;
+        struct GetActionsOnPlayersInSegmentTaskInstanceResult;
+        struct GetAllSegmentsRequest;
+        struct GetSegmentResult;
+        struct GetAllSegmentsResult;
+        struct GetCatalogItemsRequest;
+        struct GetCatalogItemsResult;
+        struct GetCloudScriptRevisionRequest;
+        struct GetCloudScriptRevisionResult;
+        struct GetCloudScriptTaskInstanceResult;
+        struct GetCloudScriptVersionsRequest;
+        struct GetCloudScriptVersionsResult;
+        struct GetContentListRequest;
+        struct GetContentListResult;
+        struct GetContentUploadUrlRequest;
+        struct GetContentUploadUrlResult;
+        struct GetDataReportRequest;
+        struct GetDataReportResult;
+        struct GetMatchmakerGameInfoRequest;
+        struct GetMatchmakerGameInfoResult;
+        struct GetMatchmakerGameModesRequest;
+        struct GetMatchmakerGameModesResult;
+        struct GetPlayedTitleListRequest;
+        struct GetPlayedTitleListResult;
+        struct GetPlayerIdFromAuthTokenRequest;
+        struct GetPlayerIdFromAuthTokenResult;
+        struct PlayerProfileViewConstraints;
+        struct GetPlayerProfileRequest;
+        struct LinkedPlatformAccountModel;
+        struct LocationModel;
+        struct SubscriptionModel;
+        struct MembershipModel;
+        struct PushNotificationRegistrationModel;
+        struct StatisticModel;
+        struct TagModel;
+        struct ValueToDateModel;
+        struct PlayerProfileModel;
+        struct GetPlayerProfileResult;
+        struct GetPlayerSegmentsResult;
+        struct GetPlayerSharedSecretsRequest;
+        struct SharedSecret;
+        struct GetPlayerSharedSecretsResult;
+        struct GetPlayersInSegmentRequest;
+        struct PlayerLinkedAccount;
+        struct PlayerLocation;
+        struct PlayerStatistic;
+        struct PushNotificationRegistration;
+        struct PlayerProfile;
+        struct GetPlayersInSegmentResult;
+        struct GetPlayersSegmentsRequest;
+        struct GetPlayerStatisticDefinitionsRequest;
+        struct GetPlayerStatisticDefinitionsResult;
+        struct GetPlayerStatisticVersionsRequest;
+        struct PlayerStatisticVersion;
+        struct GetPlayerStatisticVersionsResult;
+        struct GetPlayerTagsRequest;
+        struct GetPlayerTagsResult;
+        struct GetPolicyRequest;
+        struct PermissionStatement;
+        struct GetPolicyResponse;
+        struct GetPublisherDataRequest;
+        struct GetPublisherDataResult;
+        struct GetRandomResultTablesRequest;
+        struct ResultTableNode;
+        struct RandomResultTableListing;
+        struct GetRandomResultTablesResult;
+        struct GetSegmentsRequest;
+        struct GetSegmentsResponse;
+        struct GetServerBuildInfoRequest;
+        struct GetServerBuildInfoResult;
+        struct GetServerBuildUploadURLRequest;
+        struct GetServerBuildUploadURLResult;
+        struct GetStoreItemsRequest;
+        struct StoreMarketingModel;
+        struct StoreItem;
+        struct GetStoreItemsResult;
+        struct GetTaskInstanceRequest;
+        struct GetTaskInstancesRequest;
+        struct TaskInstanceBasicSummary;
+        struct GetTaskInstancesResult;
+        struct GetTasksRequest;
+        struct ScheduledTask;
+        struct GetTasksResult;
+        struct GetTitleDataRequest;
+        struct GetTitleDataResult;
+        struct GetUserBansRequest;
+        struct GetUserBansResult;
+        struct GetUserDataRequest;
+        struct UserDataRecord;
+        struct GetUserDataResult;
+        struct GetUserInventoryRequest;
+        struct ItemInstance;
+        struct VirtualCurrencyRechargeTime;
+        struct GetUserInventoryResult;
+        struct GrantedItemInstance;
+        struct ItemGrant;
+        struct GrantItemsToUsersRequest;
+        struct GrantItemsToUsersResult;
+        struct IncrementLimitedEditionItemAvailabilityRequest;
+        struct IncrementLimitedEditionItemAvailabilityResult;
+        struct IncrementPlayerStatisticVersionRequest;
+        struct IncrementPlayerStatisticVersionResult;
+        struct ListBuildsRequest;
+        struct ListBuildsResult;
+        struct ListOpenIdConnectionRequest;
+        struct OpenIdConnection;
+        struct ListOpenIdConnectionResponse;
+        struct ListVirtualCurrencyTypesRequest;
+        struct ListVirtualCurrencyTypesResult;
+        struct LookupUserAccountInfoRequest;
+        struct UserAndroidDeviceInfo;
+        struct UserAppleIdInfo;
+        struct UserCustomIdInfo;
+        struct UserFacebookInfo;
+        struct UserFacebookInstantGamesIdInfo;
+        struct UserGameCenterInfo;
+        struct UserGoogleInfo;
+        struct UserIosDeviceInfo;
+        struct UserKongregateInfo;
+        struct UserNintendoSwitchAccountIdInfo;
+        struct UserNintendoSwitchDeviceIdInfo;
+        struct UserOpenIdInfo;
+        struct UserPrivateAccountInfo;
+        struct UserPsnInfo;
+        struct UserSteamInfo;
+        struct UserTitleInfo;
+        struct UserTwitchInfo;
+        struct UserWindowsHelloInfo;
+        struct UserXboxInfo;
+        struct UserAccountInfo;
+        struct LookupUserAccountInfoResult;
+        struct ModifyMatchmakerGameModesRequest;
+        struct ModifyMatchmakerGameModesResult;
+        struct ModifyServerBuildRequest;
+        struct ModifyServerBuildResult;
+        struct ModifyUserVirtualCurrencyResult;
+        struct RandomResultTable;
+        struct RefundPurchaseRequest;
+        struct RefundPurchaseResponse;
+        struct RemovePlayerTagRequest;
+        struct RemovePlayerTagResult;
+        struct RemoveServerBuildRequest;
+        struct RemoveServerBuildResult;
+        struct RemoveVirtualCurrencyTypesRequest;
+        struct ResetCharacterStatisticsRequest;
+        struct ResetCharacterStatisticsResult;
+        struct ResetPasswordRequest;
+        struct ResetPasswordResult;
+        struct ResetUserStatisticsRequest;
+        struct ResetUserStatisticsResult;
+        struct ResolvePurchaseDisputeRequest;
+        struct ResolvePurchaseDisputeResponse;
+        struct RevokeAllBansForUserRequest;
+        struct RevokeAllBansForUserResult;
+        struct RevokeBansRequest;
+        struct RevokeBansResult;
+        struct RevokeInventoryItem;
+        struct RevokeInventoryItemRequest;
+        struct RevokeInventoryItemsRequest;
+        struct RevokeItemError;
+        struct RevokeInventoryItemsResult;
+        struct RevokeInventoryResult;
+        struct RunTaskRequest;
+        struct RunTaskResult;
+        struct SendAccountRecoveryEmailRequest;
+        struct SendAccountRecoveryEmailResult;
+        struct SetPlayerSecretRequest;
+        struct SetPlayerSecretResult;
+        struct SetPublishedRevisionRequest;
+        struct SetPublishedRevisionResult;
+        struct SetPublisherDataRequest;
+        struct SetPublisherDataResult;
+        struct TitleDataKeyValue;
+        struct SetTitleDataAndOverridesRequest;
+        struct SetTitleDataAndOverridesResult;
+        struct SetTitleDataRequest;
+        struct SetTitleDataResult;
+        struct SetupPushNotificationRequest;
+        struct SetupPushNotificationResult;
+        struct SubtractUserVirtualCurrencyRequest;
+        struct UpdateBanRequest;
+        struct UpdateBansRequest;
+        struct UpdateBansResult;
+        struct UpdateCatalogItemsRequest;
+        struct UpdateCatalogItemsResult;
+        struct UpdateCloudScriptRequest;
+        struct UpdateCloudScriptResult;
+        struct UpdateOpenIdConnectionRequest;
+        struct UpdatePlayerSharedSecretRequest;
+        struct UpdatePlayerSharedSecretResult;
+        struct UpdatePlayerStatisticDefinitionRequest;
+        struct UpdatePlayerStatisticDefinitionResult;
+        struct UpdatePolicyRequest;
+        struct UpdatePolicyResponse;
+        struct UpdateRandomResultTablesRequest;
+        struct UpdateRandomResultTablesResult;
+        struct UpdateSegmentRequest;
+        struct UpdateSegmentResponse;
+        struct UpdateStoreItemsRequest;
+        struct UpdateStoreItemsResult;
+        struct UpdateTaskRequest;
+        struct UpdateUserDataRequest;
+        struct UpdateUserDataResult;
+        struct UpdateUserInternalDataRequest;
+        struct UpdateUserTitleDisplayNameRequest;
+        struct UpdateUserTitleDisplayNameResult;
+    }
+}
+
+#endif
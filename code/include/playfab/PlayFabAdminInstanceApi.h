@@ -2,8 +2,14 @@
 
 #if defined(ENABLE_PLAYFABADMIN_API)
 
+// Opt-in: only forward-declare the models, for files which include the API header but never construct a model
+#if defined(PLAYFAB_API_HEADERS_FWD_MODELS_ONLY)
+#include <playfab/PlayFabAdminDataModelsFwd.h>
+#else
 #include <playfab/PlayFabAdminDataModels.h>
+#endif
 #include <playfab/PlayFabError.h>
+#include <playfab/PlayFabLazyResult.h>
 
 namespace PlayFab
 {
@@ -165,6 +171,10 @@ namespace PlayFab
         void UpdateUserReadOnlyData(AdminModels::UpdateUserDataRequest& request, const ProcessApiCallback<AdminModels::UpdateUserDataResult> callback, const ErrorCallback errorCallback = nullptr, void* customData = nullptr);
         void UpdateUserTitleDisplayName(AdminModels::UpdateUserTitleDisplayNameRequest& request, const ProcessApiCallback<AdminModels::UpdateUserTitleDisplayNameResult> callback, const ErrorCallback errorCallback = nullptr, void* customData = nullptr);
 
+        // ------------ Lazily decoded variants of API calls with very large results (see PlayFabLazyResult)
+        void GetTitleDataLazy(AdminModels::GetTitleDataRequest& request, const ProcessApiCallback<PlayFabLazyResult<AdminModels::GetTitleDataResult>> callback, const ErrorCallback errorCallback = nullptr, void* customData = nullptr);
+        void GetPlayersInSegmentLazy(AdminModels::GetPlayersInSegmentRequest& request, const ProcessApiCallback<PlayFabLazyResult<AdminModels::GetPlayersInSegmentResult>> callback, const ErrorCallback errorCallback = nullptr, void* customData = nullptr);
+
         // ------------ Generated result handlers
         void OnAbortTaskInstanceResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer);
         void OnAddLocalizedNewsResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer);
@@ -283,6 +293,8 @@ namespace PlayFab
         void OnUpdateUserPublisherReadOnlyDataResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer);
         void OnUpdateUserReadOnlyDataResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer);
         void OnUpdateUserTitleDisplayNameResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer);
+        void OnGetTitleDataLazyResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer);
+        void OnGetPlayersInSegmentLazyResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer);
         bool ValidateResult(PlayFabResultCommon& resultCommon, const CallRequestContainer& container);
     };
 }
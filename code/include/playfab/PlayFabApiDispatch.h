@@ -0,0 +1,115 @@
+#pragma once
+
+#include <playfab/PlayFabCallRequestContainer.h>
+
+#include <memory>
+#include <string>
+
+namespace PlayFab
+{
+    class PlayFabApiSettings;
+
+    /// <summary>
+    /// Shared call/complete path for the generated API methods.
+    /// Every generated method forwards to MakeApiCall, parameterized on its result type and url, and (unless the method
+    /// needs its own post-processing) completes through OnApiResult. Only the typed parts are templates; building the
+    /// request container and handing it to the transport is compiled once, in PlayFabApiDispatch.cpp.
+    /// The templates take their arguments by rvalue reference, so an instantiation doesn't emit its own moves/destructors.
+    /// </summary>
+    class PlayFabApiDispatch
+    {
+    public:
+        // Makes an API call which is completed by OnApiResult<ResType>
+        template<typename ResType> static void MakeApiCall(
+            const char* urlPath,
+            const PlayFabBaseModel& request,
+            PlayFabRequestHeaders&& headers,
+            ProcessApiCallback<ResType>&& callback,
+            ErrorCallback&& errorCallback,
+            std::shared_ptr<PlayFabApiSettings>&& settings,
+            std::shared_ptr<PlayFabAuthenticationContext>&& context,
+            void* customData)
+        {
+            MakeApiCall<ResType>(urlPath, request, std::move(headers), CallRequestContainerCallback(OnApiResult<ResType>), std::move(callback), std::move(errorCallback), std::move(settings), std::move(context), customData);
+        }
+
+        // Makes an API call which is completed by a custom result handler (for example to process a login result)
+        template<typename ResType> static void MakeApiCall(
+            const char* urlPath,
+            const PlayFabBaseModel& request,
+            PlayFabRequestHeaders&& headers,
+            CallRequestContainerCallback&& resultHandler,
+            ProcessApiCallback<ResType>&& callback,
+            ErrorCallback&& errorCallback,
+            std::shared_ptr<PlayFabApiSettings>&& settings,
+            std::shared_ptr<PlayFabAuthenticationContext>&& context,
+            void* customData)
+        {
+            std::unique_ptr<CallRequestContainer> reqContainer = CreateRequestContainer(urlPath, request, std::move(headers), std::move(resultHandler), std::move(errorCallback), std::move(settings), std::move(context), customData);
+            reqContainer->successCallback.Set<ResType>(std::move(callback));
+            SendRequest(std::move(reqContainer));
+        }
+
+        // Makes an API call whose request body is already serialized (for example spliced together from pre-serialized parts), which is completed by OnApiResult<ResType>
+        template<typename ResType> static void MakeApiCall(
+            const char* urlPath,
+            std::string&& requestBody,
+            PlayFabRequestHeaders&& headers,
+            ProcessApiCallback<ResType>&& callback,
+            ErrorCallback&& errorCallback,
+            std::shared_ptr<PlayFabApiSettings>&& settings,
+            std::shared_ptr<PlayFabAuthenticationContext>&& context,
+            void* customData)
+        {
+            std::unique_ptr<CallRequestContainer> reqContainer = CreateRequestContainer(urlPath, std::move(requestBody), std::move(headers), CallRequestContainerCallback(OnApiResult<ResType>), std::move(errorCallback), std::move(settings), std::move(context), customData);
+            reqContainer->successCallback.Set<ResType>(std::move(callback));
+            SendRequest(std::move(reqContainer));
+        }
+
+        // The result handler used by every API call without post-processing of its result
+        template<typename ResType> static void OnApiResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+        {
+            CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
+
+            ResType outResult;
+            if (ValidateResult(outResult, container))
+            {
+                const ProcessApiCallback<ResType>* callback = container.successCallback.Get<ResType>();
+                if (callback != nullptr)
+                {
+                    (*callback)(outResult, container.GetCustomData());
+                }
+            }
+        }
+
+        // Decodes a successful result, or reports the error to the global and per-call error handlers and returns false.
+        // A successful result takes over the request json of the container.
+        static bool ValidateResult(PlayFabResultCommon& resultCommon, CallRequestContainer& container);
+        // As above, for a container which can't be changed (as in the ValidateResult of the generated API classes). The result gets a copy of the request json.
+        static bool ValidateResult(PlayFabResultCommon& resultCommon, const CallRequestContainer& container);
+
+    private:
+        PlayFabApiDispatch() = delete; // static class should never have an instance
+
+        static std::unique_ptr<CallRequestContainer> CreateRequestContainer(
+            const char* urlPath,
+            const PlayFabBaseModel& request,
+            PlayFabRequestHeaders&& headers,
+            CallRequestContainerCallback&& resultHandler,
+            ErrorCallback&& errorCallback,
+            std::shared_ptr<PlayFabApiSettings>&& settings,
+            std::shared_ptr<PlayFabAuthenticationContext>&& context,
+            void* customData);
+        static std::unique_ptr<CallRequestContainer> CreateRequestContainer(
+            const char* urlPath,
+            std::string&& requestBody,
+            PlayFabRequestHeaders&& headers,
+            CallRequestContainerCallback&& resultHandler,
+            ErrorCallback&& errorCallback,
+            std::shared_ptr<PlayFabApiSettings>&& settings,
+            std::shared_ptr<PlayFabAuthenticationContext>&& context,
+            void* customData);
+        static void SendRequest(std::unique_ptr<CallRequestContainer> reqContainer);
+        static void ReportError(const CallRequestContainer& container);
+    };
+}
@@ -2,6 +2,8 @@
 
 #include <string>
 #include <map>
+#include <memory>
+#include <mutex>
 
 namespace PlayFab
 {
@@ -18,11 +20,6 @@ namespace PlayFab
         std::string developerSecretKey; // Developer secret key. These keys can be used in development environments.
 
     public:
-        std::map<std::string, std::string> requestGetParams;
-
-        std::string baseServiceHost; // The base for a PlayFab service host
-        std::string titleId; // You must set this value for PlayFabSdk to work properly (found in the Game Manager for your title, at the PlayFab Website)
-
         PlayFabApiSettings();
         PlayFabApiSettings(const PlayFabApiSettings& other) = delete;
         PlayFabApiSettings(PlayFabApiSettings&& other) = delete;
@@ -30,6 +27,35 @@ namespace PlayFab
         PlayFabApiSettings& operator=(PlayFabApiSettings&& other) = delete;
         ~PlayFabApiSettings() = default;
 
+        // The fields GetUrl is built from. Each setter builds the url parts for the new value and publishes them at once,
+        // so the getters and GetUrl are safe to call from several threads at once, also while a setter runs.
+        std::string GetTitleId() const;
+        void SetTitleId(const std::string& titleId); // You must set this value for PlayFabSdk to work properly (found in the Game Manager for your title, at the PlayFab Website)
+        std::string GetBaseServiceHost() const;
+        void SetBaseServiceHost(const std::string& baseServiceHost); // The base for a PlayFab service host
+        std::map<std::string, std::string> GetRequestGetParams() const;
+        void SetRequestGetParams(const std::map<std::string, std::string>& requestGetParams);
+        void SetRequestGetParam(const std::string& key, const std::string& value);
+        void RemoveRequestGetParam(const std::string& key);
+
         std::string GetUrl(const std::string& urlPath) const;
+
+    private:
+        // The parts GetUrl is built from: "https://" + titleId + baseServiceHost, and "?key=value&..." for requestGetParams
+        struct UrlParts
+        {
+            std::string titleId;
+            std::string baseServiceHost;
+            std::map<std::string, std::string> requestGetParams;
+            std::string prefix;
+            std::string suffix;
+        };
+
+        // Builds the prefix and suffix of the parts, and makes them the current ones
+        void PublishUrlParts(std::shared_ptr<UrlParts> parts);
+
+        std::shared_ptr<const UrlParts> urlParts; // Immutable once published. Only read and written with std::atomic_load and std::atomic_store.
+                                                  // Parts replaced by a setter are freed once the last GetUrl reading them is done.
+        std::mutex settersMutex; // Serializes the setters, which each copy the current parts and change one field
     };
 }
@@ -2,7 +2,12 @@
 
 #if !defined(DISABLE_PLAYFABENTITY_API)
 
+// Opt-in: only forward-declare the models, for files which include the API header but never construct a model
+#if defined(PLAYFAB_API_HEADERS_FWD_MODELS_ONLY)
+#include <playfab/PlayFabAuthenticationDataModelsFwd.h>
+#else
 #include <playfab/PlayFabAuthenticationDataModels.h>
+#endif
 #include <playfab/PlayFabError.h>
 
 namespace PlayFab
@@ -27,7 +32,6 @@ namespace PlayFab
         static size_t Update();
         static void ForgetAllCredentials();
 
-
         // ------------ Generated API calls
         static void GetEntityToken(AuthenticationModels::GetEntityTokenRequest& request, const ProcessApiCallback<AuthenticationModels::GetEntityTokenResponse> callback, const ErrorCallback errorCallback = nullptr, void* customData = nullptr);
         static void ValidateEntityToken(AuthenticationModels::ValidateEntityTokenRequest& request, const ProcessApiCallback<AuthenticationModels::ValidateEntityTokenResponse> callback, const ErrorCallback errorCallback = nullptr, void* customData = nullptr);
@@ -38,9 +42,6 @@ namespace PlayFab
 
         // ------------ Generated result handlers
         static void OnGetEntityTokenResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer);
-        static void OnValidateEntityTokenResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer);
-
-        static bool ValidateResult(PlayFabResultCommon& resultCommon, const CallRequestContainer& container);
     };
 }
 
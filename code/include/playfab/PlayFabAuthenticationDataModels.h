@@ -2,6 +2,7 @@
 
 #if !defined(DISABLE_PLAYFABENTITY_API)
 
+#include <playfab/PlayFabAuthenticationDataModelsFwd.h>
 #include <playfab/PlayFabBaseModel.h>
 #include <playfab/PlayFabJsonHeaders.h>
 
@@ -17,47 +18,8 @@ namespace PlayFab
             IdentifiedDeviceTypeScarlett
         };
 
-        inline void ToJsonEnum(const IdentifiedDeviceType input, Json::Value& output)
-        {
-            if (input == IdentifiedDeviceType::IdentifiedDeviceTypeUnknown)
-            {
-                output = Json::Value("Unknown");
-                return;
-            }
-            if (input == IdentifiedDeviceType::IdentifiedDeviceTypeXboxOne)
-            {
-                output = Json::Value("XboxOne");
-                return;
-            }
-            if (input == IdentifiedDeviceType::IdentifiedDeviceTypeScarlett)
-            {
-                output = Json::Value("Scarlett");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, IdentifiedDeviceType& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "Unknown")
-            {
-                output = IdentifiedDeviceType::IdentifiedDeviceTypeUnknown;
-                return;
-            }
-            if (inputStr == "XboxOne")
-            {
-                output = IdentifiedDeviceType::IdentifiedDeviceTypeXboxOne;
-                return;
-            }
-            if (inputStr == "Scarlett")
-            {
-                output = IdentifiedDeviceType::IdentifiedDeviceTypeScarlett;
-                return;
-            }
-        }
+        void ToJsonEnum(const IdentifiedDeviceType input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, IdentifiedDeviceType& output);
 
         enum class LoginIdentityProvider
         {
@@ -84,227 +46,8 @@ namespace PlayFab
             LoginIdentityProviderNintendoSwitchAccount
         };
 
-        inline void ToJsonEnum(const LoginIdentityProvider input, Json::Value& output)
-        {
-            if (input == LoginIdentityProvider::LoginIdentityProviderUnknown)
-            {
-                output = Json::Value("Unknown");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderPlayFab)
-            {
-                output = Json::Value("PlayFab");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderCustom)
-            {
-                output = Json::Value("Custom");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderGameCenter)
-            {
-                output = Json::Value("GameCenter");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderGooglePlay)
-            {
-                output = Json::Value("GooglePlay");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderSteam)
-            {
-                output = Json::Value("Steam");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderXBoxLive)
-            {
-                output = Json::Value("XBoxLive");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderPSN)
-            {
-                output = Json::Value("PSN");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderKongregate)
-            {
-                output = Json::Value("Kongregate");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderFacebook)
-            {
-                output = Json::Value("Facebook");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderIOSDevice)
-            {
-                output = Json::Value("IOSDevice");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderAndroidDevice)
-            {
-                output = Json::Value("AndroidDevice");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderTwitch)
-            {
-                output = Json::Value("Twitch");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderWindowsHello)
-            {
-                output = Json::Value("WindowsHello");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderGameServer)
-            {
-                output = Json::Value("GameServer");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderCustomServer)
-            {
-                output = Json::Value("CustomServer");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderNintendoSwitch)
-            {
-                output = Json::Value("NintendoSwitch");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderFacebookInstantGames)
-            {
-                output = Json::Value("FacebookInstantGames");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderOpenIdConnect)
-            {
-                output = Json::Value("OpenIdConnect");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderApple)
-            {
-                output = Json::Value("Apple");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderNintendoSwitchAccount)
-            {
-                output = Json::Value("NintendoSwitchAccount");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, LoginIdentityProvider& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "Unknown")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderUnknown;
-                return;
-            }
-            if (inputStr == "PlayFab")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderPlayFab;
-                return;
-            }
-            if (inputStr == "Custom")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderCustom;
-                return;
-            }
-            if (inputStr == "GameCenter")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderGameCenter;
-                return;
-            }
-            if (inputStr == "GooglePlay")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderGooglePlay;
-                return;
-            }
-            if (inputStr == "Steam")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderSteam;
-                return;
-            }
-            if (inputStr == "XBoxLive")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderXBoxLive;
-                return;
-            }
-            if (inputStr == "PSN")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderPSN;
-                return;
-            }
-            if (inputStr == "Kongregate")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderKongregate;
-                return;
-            }
-            if (inputStr == "Facebook")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderFacebook;
-                return;
-            }
-            if (inputStr == "IOSDevice")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderIOSDevice;
-                return;
-            }
-            if (inputStr == "AndroidDevice")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderAndroidDevice;
-                return;
-            }
-            if (inputStr == "Twitch")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderTwitch;
-                return;
-            }
-            if (inputStr == "WindowsHello")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderWindowsHello;
-                return;
-            }
-            if (inputStr == "GameServer")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderGameServer;
-                return;
-            }
-            if (inputStr == "CustomServer")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderCustomServer;
-                return;
-            }
-            if (inputStr == "NintendoSwitch")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderNintendoSwitch;
-                return;
-            }
-            if (inputStr == "FacebookInstantGames")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderFacebookInstantGames;
-                return;
-            }
-            if (inputStr == "OpenIdConnect")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderOpenIdConnect;
-                return;
-            }
-            if (inputStr == "Apple")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderApple;
-                return;
-            }
-            if (inputStr == "NintendoSwitchAccount")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderNintendoSwitchAccount;
-                return;
-            }
-        }
+        void ToJsonEnum(const LoginIdentityProvider input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, LoginIdentityProvider& output);
 
         // Authentication Classes
         struct EntityKey : public PlayFabBaseModel
@@ -326,19 +69,9 @@ namespace PlayFab
 
             ~EntityKey() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Id"], Id);
-                FromJsonUtilS(input["Type"], Type);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Id; ToJsonUtilS(Id, each_Id); output["Id"] = each_Id;
-                Json::Value each_Type; ToJsonUtilS(Type, each_Type); output["Type"] = each_Type;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct EntityLineage : public PlayFabBaseModel
@@ -372,27 +105,9 @@ namespace PlayFab
 
             ~EntityLineage() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CharacterId"], CharacterId);
-                FromJsonUtilS(input["GroupId"], GroupId);
-                FromJsonUtilS(input["MasterPlayerAccountId"], MasterPlayerAccountId);
-                FromJsonUtilS(input["NamespaceId"], NamespaceId);
-                FromJsonUtilS(input["TitleId"], TitleId);
-                FromJsonUtilS(input["TitlePlayerAccountId"], TitlePlayerAccountId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); output["CharacterId"] = each_CharacterId;
-                Json::Value each_GroupId; ToJsonUtilS(GroupId, each_GroupId); output["GroupId"] = each_GroupId;
-                Json::Value each_MasterPlayerAccountId; ToJsonUtilS(MasterPlayerAccountId, each_MasterPlayerAccountId); output["MasterPlayerAccountId"] = each_MasterPlayerAccountId;
-                Json::Value each_NamespaceId; ToJsonUtilS(NamespaceId, each_NamespaceId); output["NamespaceId"] = each_NamespaceId;
-                Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); output["TitleId"] = each_TitleId;
-                Json::Value each_TitlePlayerAccountId; ToJsonUtilS(TitlePlayerAccountId, each_TitlePlayerAccountId); output["TitlePlayerAccountId"] = each_TitlePlayerAccountId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetEntityTokenRequest : public PlayFabRequestCommon
@@ -414,19 +129,9 @@ namespace PlayFab
 
             ~GetEntityTokenRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Entity"], Entity);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetEntityTokenResponse : public PlayFabResultCommon
@@ -451,21 +156,9 @@ namespace PlayFab
 
             ~GetEntityTokenResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilS(input["EntityToken"], EntityToken);
-                FromJsonUtilT(input["TokenExpiration"], TokenExpiration);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_EntityToken; ToJsonUtilS(EntityToken, each_EntityToken); output["EntityToken"] = each_EntityToken;
-                Json::Value each_TokenExpiration; ToJsonUtilT(TokenExpiration, each_TokenExpiration); output["TokenExpiration"] = each_TokenExpiration;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct ValidateEntityTokenRequest : public PlayFabRequestCommon
@@ -487,19 +180,9 @@ namespace PlayFab
 
             ~ValidateEntityTokenRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["EntityToken"], EntityToken);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_EntityToken; ToJsonUtilS(EntityToken, each_EntityToken); output["EntityToken"] = each_EntityToken;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct ValidateEntityTokenResponse : public PlayFabResultCommon
@@ -527,23 +210,9 @@ namespace PlayFab
 
             ~ValidateEntityTokenResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilE(input["IdentifiedDeviceType"], pfIdentifiedDeviceType);
-                FromJsonUtilE(input["IdentityProvider"], IdentityProvider);
-                FromJsonUtilO(input["Lineage"], Lineage);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_pfIdentifiedDeviceType; ToJsonUtilE(pfIdentifiedDeviceType, each_pfIdentifiedDeviceType); output["IdentifiedDeviceType"] = each_pfIdentifiedDeviceType;
-                Json::Value each_IdentityProvider; ToJsonUtilE(IdentityProvider, each_IdentityProvider); output["IdentityProvider"] = each_IdentityProvider;
-                Json::Value each_Lineage; ToJsonUtilO(Lineage, each_Lineage); output["Lineage"] = each_Lineage;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
     }
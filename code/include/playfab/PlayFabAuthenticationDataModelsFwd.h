@@ -0,0 +1,22 @@
+#pragma once
+
+#if !defined(DISABLE_PLAYFABENTITY_API)
+
+namespace PlayFab
+{
+    namespace AuthenticationModels
+    {
+        // Forward declarations of the Authentication models, for headers which only pass them by reference
+        enum class IdentifiedDeviceType;
+        enum class LoginIdentityProvider;
+
+        struct EntityKey;
+        struct EntityLineage;
+        struct GetEntityTokenRequest;
+        struct GetEntityTokenResponse;
+        struct ValidateEntityTokenRequest;
+        struct ValidateEntityTokenResponse;
+    }
+}
+
+#endif
@@ -7,34 +7,110 @@
 #include <playfab/PlayFabPlatformUtils.h>
 
 #include <assert.h>
+#include <ctime>
 #include <functional>
+#include <limits>
 #include <list>
 #include <memory>
+#include <type_traits>
 
 namespace PlayFab
 {
     class PlayFabAuthenticationContext;
 
-    template <typename BoxedType>
-    class Boxed
+    /// <summary>
+    /// A value which a Boxed type never holds as a real field value, so a Boxed of that type can store its null state as
+    /// that value instead of in a separate flag (which pads a Boxed<time_t> or Boxed<double> to twice the size of the value).
+    /// Setting such a Boxed to that value makes it null. By default no type has one and every Boxed keeps the flag.
+    /// Specialize this (with available = true, Get and IsNull) to opt a type in, or define PLAYFAB_BOXED_NULL_VALUES
+    /// for the whole build to opt in the types below. The choice must be the same in every translation unit.
+    /// </summary>
+    template <typename BoxedType, typename = void>
+    struct BoxedNullValue
     {
-    public:
-        Boxed() : boxedValue(), isSet(false) {}
-        Boxed(BoxedType value) : boxedValue(value), isSet(true) {}
+        static const bool available = false;
+    };
 
-        inline Boxed& operator=(BoxedType value) { boxedValue = value; isSet = true; return *this; }
-        inline operator const BoxedType& () const { assert(notNull()); return *operator->(); }
-        inline BoxedType* operator->() { return isSet ? &boxedValue : nullptr; }
-        inline const BoxedType* operator->() const { return isSet ? &boxedValue : nullptr; }
+#if defined(PLAYFAB_BOXED_NULL_VALUES)
+    // The time_t fields hold dates, which are never the minimum time_t. Where time_t is the same type as Int64,
+    // whose fields may hold any value, time_t keeps the flag.
+    template <typename TimeType>
+    struct BoxedNullValue<TimeType, typename std::enable_if<std::is_same<TimeType, time_t>::value && !std::is_same<TimeType, Int64>::value>::type>
+    {
+        static const bool available = true;
+        static time_t Get() { return (std::numeric_limits<time_t>::min)(); }
+        static bool IsNull(time_t value) { return value == Get(); }
+    };
+
+    // Json has no NaN, so a double field read from json is never NaN
+    template <>
+    struct BoxedNullValue<double>
+    {
+        static const bool available = true;
+        static double Get() { return std::numeric_limits<double>::quiet_NaN(); }
+        static bool IsNull(double value) { return value != value; }
+    };
+
+    // The model enums number their values from 0, so they never reach the maximum of their underlying type
+    template <typename EnumType>
+    struct BoxedNullValue<EnumType, typename std::enable_if<std::is_enum<EnumType>::value>::type>
+    {
+        static const bool available = true;
+        static EnumType Get() { return static_cast<EnumType>((std::numeric_limits<typename std::underlying_type<EnumType>::type>::max)()); }
+        static bool IsNull(EnumType value) { return value == Get(); }
+    };
+#endif // defined(PLAYFAB_BOXED_NULL_VALUES)
+
+    template <typename BoxedType, bool = BoxedNullValue<BoxedType>::available>
+    class BoxedStorage
+    {
+    protected:
+        BoxedStorage() : boxedValue(), isSet(false) {}
+        BoxedStorage(BoxedType value) : boxedValue(value), isSet(true) {}
 
+        inline void set(BoxedType value) { boxedValue = value; isSet = true; }
         inline void setNull() { isSet = false; }
         inline bool notNull() const { return isSet; }
-        inline bool isNull() const { return !isSet; }
-    private:
+
         BoxedType boxedValue;
+    private:
         bool isSet;
     };
 
+    template <typename BoxedType>
+    class BoxedStorage<BoxedType, true>
+    {
+    protected:
+        BoxedStorage() : boxedValue(BoxedNullValue<BoxedType>::Get()) {}
+        BoxedStorage(BoxedType value) : boxedValue(value) {}
+
+        inline void set(BoxedType value) { boxedValue = value; }
+        inline void setNull() { boxedValue = BoxedNullValue<BoxedType>::Get(); }
+        inline bool notNull() const { return !BoxedNullValue<BoxedType>::IsNull(boxedValue); }
+
+        BoxedType boxedValue;
+    };
+
+    /// <summary>
+    /// An optional model field. Setting it to the BoxedNullValue of its type (if that has one) is the same as setNull().
+    /// </summary>
+    template <typename BoxedType>
+    class Boxed : private BoxedStorage<BoxedType>
+    {
+    public:
+        Boxed() : BoxedStorage<BoxedType>() {}
+        Boxed(BoxedType value) : BoxedStorage<BoxedType>(value) {}
+
+        inline Boxed& operator=(BoxedType value) { this->set(value); return *this; }
+        inline operator const BoxedType& () const { assert(notNull()); return *operator->(); }
+        inline BoxedType* operator->() { return notNull() ? &this->boxedValue : nullptr; }
+        inline const BoxedType* operator->() const { return notNull() ? &this->boxedValue : nullptr; }
+
+        inline void setNull() { BoxedStorage<BoxedType>::setNull(); }
+        inline bool notNull() const { return BoxedStorage<BoxedType>::notNull(); }
+        inline bool isNull() const { return !notNull(); }
+    };
+
     template<typename ResType> using ProcessApiCallback = std::function<void(const ResType& result, void* customData)>;
 
     /// <summary>
@@ -76,6 +152,32 @@ namespace PlayFab
         std::shared_ptr<PlayFabAuthenticationContext> authenticationContext;
     };
 
+    /// <summary>
+    /// A json field name of a model, as used by the FromJson/ToJson definitions.
+    /// Its length is known at compile time, so reading a field doesn't strlen the name, and it is inserted as a
+    /// Json::StaticString, so jsoncpp doesn't copy the name into every object it writes.
+    /// </summary>
+    struct PlayFabJsonKey
+    {
+        template <size_t Size> constexpr PlayFabJsonKey(const char (&name)[Size]) : name(name), length(Size - 1) {}
+
+        const char* name;
+        size_t length;
+    };
+
+    // The field of a model's json, or null if it has none
+    inline const Json::Value& FromJsonField(const Json::Value& input, const PlayFabJsonKey& key)
+    {
+        const Json::Value* field = input.isObject() ? input.find(key.name, key.name + key.length) : nullptr;
+        return (field != nullptr) ? *field : Json::Value::null;
+    }
+
+    // The field of a model's json to write to
+    inline Json::Value& ToJsonField(Json::Value& output, const PlayFabJsonKey& key)
+    {
+        return output[Json::StaticString(key.name)];
+    }
+
     // Utilities for [de]serializing time_t to/from json
     inline void ToJsonUtilT(const time_t input, Json::Value& output)
     {
@@ -3,19 +3,82 @@
 #include <playfab/PlayFabError.h>
 #include <playfab/PlayFabCallRequestContainerBase.h>
 
+#include <new>
+#include <type_traits>
+
 namespace PlayFab
 {
     class PlayFabApiSettings;
 
+    /// <summary>
+    /// Inline storage for the typed success callback of an API call.
+    /// Every ProcessApiCallback<ResType> is a std::function with the same layout, so the callback is constructed in place
+    /// inside the request container, rather than being heap allocated and kept alive by a std::shared_ptr<void>.
+    /// </summary>
+    class ApiSuccessCallbackStorage
+    {
+    public:
+        ApiSuccessCallbackStorage() = default;
+        ~ApiSuccessCallbackStorage() { Reset(); }
+
+        ApiSuccessCallbackStorage(const ApiSuccessCallbackStorage&) = delete;
+        ApiSuccessCallbackStorage& operator=(const ApiSuccessCallbackStorage&) = delete;
+
+        template<typename ResType> void Set(ProcessApiCallback<ResType> callback)
+        {
+            using CallbackType = ProcessApiCallback<ResType>;
+            static_assert(sizeof(CallbackType) <= sizeof(StorageType), "ProcessApiCallback does not fit in ApiSuccessCallbackStorage");
+            static_assert(alignof(CallbackType) <= alignof(StorageType), "ProcessApiCallback is over-aligned for ApiSuccessCallbackStorage");
+
+            Reset();
+            if (callback != nullptr)
+            {
+                new (&storage) CallbackType(std::move(callback));
+                destroy = [](void* target) { static_cast<CallbackType*>(target)->~CallbackType(); };
+                typeTag = GetTypeTag<ResType>();
+            }
+        }
+
+        // Returns nullptr when no callback was set, or when it was Set with another ResType
+        template<typename ResType> const ProcessApiCallback<ResType>* Get() const
+        {
+            return (typeTag != GetTypeTag<ResType>()) ? nullptr : reinterpret_cast<const ProcessApiCallback<ResType>*>(&storage);
+        }
+
+        void Reset()
+        {
+            if (destroy != nullptr)
+            {
+                destroy(&storage);
+                destroy = nullptr;
+                typeTag = nullptr;
+            }
+        }
+
+    private:
+        using StorageType = std::aligned_storage<sizeof(ProcessApiCallback<PlayFabResultCommon>), alignof(ProcessApiCallback<PlayFabResultCommon>)>::type;
+
+        // A distinct address per ResType. The tag is writable, so the linker never folds the tags of two types together.
+        template<typename ResType> static const void* GetTypeTag()
+        {
+            static char tag;
+            return &tag;
+        }
+
+        StorageType storage;
+        void (*destroy)(void*) = nullptr;
+        const void* typeTag = nullptr; // The tag of the ResType the callback was Set with
+    };
+
     /// <summary>
     /// Internal PlayFabHttp container for each API call
     /// </summary>
     class CallRequestContainer : public CallRequestContainerBase
     {
     public:
-        CallRequestContainer(const std::string& url,
-            const std::unordered_map<std::string, std::string>& headers,
-            const std::string& requestBody,
+        CallRequestContainer(std::string url,
+            PlayFabRequestHeaders headers,
+            std::string requestBody,
             CallRequestContainerCallback callback,
             std::shared_ptr<PlayFabApiSettings> apiSettings,
             std::shared_ptr<PlayFabAuthenticationContext> context,
@@ -29,6 +92,18 @@ namespace PlayFab
         void SetRequestId(const std::string& newRequestId);
         void ThrowIfSettingsInvalid();
 
+        // Reads the status of the parsed responseJson, and releases responseString which isn't needed once it is parsed.
+        // A successful result is decoded straight from GetResultData(), so the rest of errorWrapper (status, error strings
+        // and a copy of the data) is only populated when the call failed.
+        void ProcessResponseJson();
+        // The "data" node of the parsed responseJson, or null if the response has none
+        const Json::Value& GetResultData() const;
+        // Parses the request body into errorWrapper.Request, for the result or the error to hand back to the caller, and
+        // releases the body. Only the body is held while the call is in flight, since its parsed json is several times larger.
+        void ReleaseRequestBody();
+        // Approximate number of bytes held by this container, its buffers and its json documents
+        size_t GetMemoryUsage() const;
+
         // TODO: clean up these public variables with setters/getters when you have the chance.
 
         bool finished;
@@ -36,7 +111,7 @@ namespace PlayFab
         Json::Value responseJson = Json::Value::null;
         std::string requestId;
         PlayFabError errorWrapper;
-        std::shared_ptr<void> successCallback;
+        ApiSuccessCallbackStorage successCallback;
         ErrorCallback errorCallback;
         std::shared_ptr<PlayFabApiSettings> m_settings;
         std::shared_ptr<PlayFabAuthenticationContext> m_context;
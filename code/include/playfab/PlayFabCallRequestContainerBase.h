@@ -1,12 +1,15 @@
 #pragma once
 
-#include <unordered_map>
+#include <playfab/PlayFabRequestHeaders.h>
+
+#include <functional>
 #include <memory>
 
 namespace PlayFab
 {
     class CallRequestContainerBase;
-    typedef std::function<void(int, std::string, std::shared_ptr<CallRequestContainerBase>)> CallRequestContainerCallback;
+    // Called with the http code, the raw response (which CallRequestContainer only keeps when it could not be parsed) and the container
+    typedef std::function<void(int, const std::string&, const std::shared_ptr<CallRequestContainerBase>&)> CallRequestContainerCallback;
 
     /// <summary>
     /// A base container meant for holding everything necessary to make a full HTTP request and return a response.
@@ -21,18 +24,20 @@ namespace PlayFab
         /// - requestBody is the actual request Json object as a string
         /// - callback is a general callback that will handle any further logic, it is always called whether a call was successful or not
         /// - customData can be any object a user expects to be associated with this particular transaction (id/hash/tag etc.). It is simply relayed to callback.
+        /// url, headers and requestBody are taken by value, so callers that pass temporaries (or std::move) hand over their buffers without a copy.
         CallRequestContainerBase(
-            const std::string& url,
-            const std::unordered_map<std::string, std::string>& headers,
-            const std::string& requestBody,
+            std::string url,
+            PlayFabRequestHeaders headers,
+            std::string requestBody,
             CallRequestContainerCallback callback,
             void* customData = nullptr);
 
         virtual ~CallRequestContainerBase() = default;
 
-        std::string GetUrl() const;
-        std::unordered_map<std::string, std::string> GetRequestHeaders() const;
-        std::string GetRequestBody() const;
+        // The accessors below return references to the container's own storage, which stays valid for the lifetime of the container
+        const std::string& GetUrl() const;
+        const PlayFabRequestHeaders& GetRequestHeaders() const;
+        const std::string& GetRequestBody() const;
 
         /// <summary>
         /// This function is meant to handle logic of calling the error callback or success
@@ -43,7 +48,7 @@ namespace PlayFab
 
     protected:
         std::string url;
-        std::unordered_map<std::string, std::string> requestHeaders;
+        PlayFabRequestHeaders requestHeaders;
         std::string requestBody;
         CallRequestContainerCallback callback;
 
@@ -2,6 +2,7 @@
 
 #if !defined(DISABLE_PLAYFABCLIENT_API)
 
+#include <playfab/PlayFabClientDataModelsFwd.h>
 #include <playfab/PlayFabBaseModel.h>
 #include <playfab/PlayFabJsonHeaders.h>
 
@@ -18,57 +19,8 @@ namespace PlayFab
             AdActivityEnd
         };
 
-        inline void ToJsonEnum(const AdActivity input, Json::Value& output)
-        {
-            if (input == AdActivity::AdActivityOpened)
-            {
-                output = Json::Value("Opened");
-                return;
-            }
-            if (input == AdActivity::AdActivityClosed)
-            {
-                output = Json::Value("Closed");
-                return;
-            }
-            if (input == AdActivity::AdActivityStart)
-            {
-                output = Json::Value("Start");
-                return;
-            }
-            if (input == AdActivity::AdActivityEnd)
-            {
-                output = Json::Value("End");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, AdActivity& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "Opened")
-            {
-                output = AdActivity::AdActivityOpened;
-                return;
-            }
-            if (inputStr == "Closed")
-            {
-                output = AdActivity::AdActivityClosed;
-                return;
-            }
-            if (inputStr == "Start")
-            {
-                output = AdActivity::AdActivityStart;
-                return;
-            }
-            if (inputStr == "End")
-            {
-                output = AdActivity::AdActivityEnd;
-                return;
-            }
-        }
+        void ToJsonEnum(const AdActivity input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, AdActivity& output);
 
         enum class CloudScriptRevisionOption
         {
@@ -77,47 +29,8 @@ namespace PlayFab
             CloudScriptRevisionOptionSpecific
         };
 
-        inline void ToJsonEnum(const CloudScriptRevisionOption input, Json::Value& output)
-        {
-            if (input == CloudScriptRevisionOption::CloudScriptRevisionOptionLive)
-            {
-                output = Json::Value("Live");
-                return;
-            }
-            if (input == CloudScriptRevisionOption::CloudScriptRevisionOptionLatest)
-            {
-                output = Json::Value("Latest");
-                return;
-            }
-            if (input == CloudScriptRevisionOption::CloudScriptRevisionOptionSpecific)
-            {
-                output = Json::Value("Specific");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, CloudScriptRevisionOption& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "Live")
-            {
-                output = CloudScriptRevisionOption::CloudScriptRevisionOptionLive;
-                return;
-            }
-            if (inputStr == "Latest")
-            {
-                output = CloudScriptRevisionOption::CloudScriptRevisionOptionLatest;
-                return;
-            }
-            if (inputStr == "Specific")
-            {
-                output = CloudScriptRevisionOption::CloudScriptRevisionOptionSpecific;
-                return;
-            }
-        }
+        void ToJsonEnum(const CloudScriptRevisionOption input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, CloudScriptRevisionOption& output);
 
         enum class ContinentCode
         {
@@ -130,87 +43,8 @@ namespace PlayFab
             ContinentCodeSA
         };
 
-        inline void ToJsonEnum(const ContinentCode input, Json::Value& output)
-        {
-            if (input == ContinentCode::ContinentCodeAF)
-            {
-                output = Json::Value("AF");
-                return;
-            }
-            if (input == ContinentCode::ContinentCodeAN)
-            {
-                output = Json::Value("AN");
-                return;
-            }
-            if (input == ContinentCode::ContinentCodeAS)
-            {
-                output = Json::Value("AS");
-                return;
-            }
-            if (input == ContinentCode::ContinentCodeEU)
-            {
-                output = Json::Value("EU");
-                return;
-            }
-            if (input == ContinentCode::ContinentCodeNA)
-            {
-                output = Json::Value("NA");
-                return;
-            }
-            if (input == ContinentCode::ContinentCodeOC)
-            {
-                output = Json::Value("OC");
-                return;
-            }
-            if (input == ContinentCode::ContinentCodeSA)
-            {
-                output = Json::Value("SA");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, ContinentCode& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "AF")
-            {
-                output = ContinentCode::ContinentCodeAF;
-                return;
-            }
-            if (inputStr == "AN")
-            {
-                output = ContinentCode::ContinentCodeAN;
-                return;
-            }
-            if (inputStr == "AS")
-            {
-                output = ContinentCode::ContinentCodeAS;
-                return;
-            }
-            if (inputStr == "EU")
-            {
-                output = ContinentCode::ContinentCodeEU;
-                return;
-            }
-            if (inputStr == "NA")
-            {
-                output = ContinentCode::ContinentCodeNA;
-                return;
-            }
-            if (inputStr == "OC")
-            {
-                output = ContinentCode::ContinentCodeOC;
-                return;
-            }
-            if (inputStr == "SA")
-            {
-                output = ContinentCode::ContinentCodeSA;
-                return;
-            }
-        }
+        void ToJsonEnum(const ContinentCode input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, ContinentCode& output);
 
         enum class CountryCode
         {
@@ -465,2507 +299,8 @@ namespace PlayFab
             CountryCodeZW
         };
 
-        inline void ToJsonEnum(const CountryCode input, Json::Value& output)
-        {
-            if (input == CountryCode::CountryCodeAF)
-            {
-                output = Json::Value("AF");
-                return;
-            }
-            if (input == CountryCode::CountryCodeAX)
-            {
-                output = Json::Value("AX");
-                return;
-            }
-            if (input == CountryCode::CountryCodeAL)
-            {
-                output = Json::Value("AL");
-                return;
-            }
-            if (input == CountryCode::CountryCodeDZ)
-            {
-                output = Json::Value("DZ");
-                return;
-            }
-            if (input == CountryCode::CountryCodeAS)
-            {
-                output = Json::Value("AS");
-                return;
-            }
-            if (input == CountryCode::CountryCodeAD)
-            {
-                output = Json::Value("AD");
-                return;
-            }
-            if (input == CountryCode::CountryCodeAO)
-            {
-                output = Json::Value("AO");
-                return;
-            }
-            if (input == CountryCode::CountryCodeAI)
-            {
-                output = Json::Value("AI");
-                return;
-            }
-            if (input == CountryCode::CountryCodeAQ)
-            {
-                output = Json::Value("AQ");
-                return;
-            }
-            if (input == CountryCode::CountryCodeAG)
-            {
-                output = Json::Value("AG");
-                return;
-            }
-            if (input == CountryCode::CountryCodeAR)
-            {
-                output = Json::Value("AR");
-                return;
-            }
-            if (input == CountryCode::CountryCodeAM)
-            {
-                output = Json::Value("AM");
-                return;
-            }
-            if (input == CountryCode::CountryCodeAW)
-            {
-                output = Json::Value("AW");
-                return;
-            }
-            if (input == CountryCode::CountryCodeAU)
-            {
-                output = Json::Value("AU");
-                return;
-            }
-            if (input == CountryCode::CountryCodeAT)
-            {
-                output = Json::Value("AT");
-                return;
-            }
-            if (input == CountryCode::CountryCodeAZ)
-            {
-                output = Json::Value("AZ");
-                return;
-            }
-            if (input == CountryCode::CountryCodeBS)
-            {
-                output = Json::Value("BS");
-                return;
-            }
-            if (input == CountryCode::CountryCodeBH)
-            {
-                output = Json::Value("BH");
-                return;
-            }
-            if (input == CountryCode::CountryCodeBD)
-            {
-                output = Json::Value("BD");
-                return;
-            }
-            if (input == CountryCode::CountryCodeBB)
-            {
-                output = Json::Value("BB");
-                return;
-            }
-            if (input == CountryCode::CountryCodeBY)
-            {
-                output = Json::Value("BY");
-                return;
-            }
-            if (input == CountryCode::CountryCodeBE)
-            {
-                output = Json::Value("BE");
-                return;
-            }
-            if (input == CountryCode::CountryCodeBZ)
-            {
-                output = Json::Value("BZ");
-                return;
-            }
-            if (input == CountryCode::CountryCodeBJ)
-            {
-                output = Json::Value("BJ");
-                return;
-            }
-            if (input == CountryCode::CountryCodeBM)
-            {
-                output = Json::Value("BM");
-                return;
-            }
-            if (input == CountryCode::CountryCodeBT)
-            {
-                output = Json::Value("BT");
-                return;
-            }
-            if (input == CountryCode::CountryCodeBO)
-            {
-                output = Json::Value("BO");
-                return;
-            }
-            if (input == CountryCode::CountryCodeBQ)
-            {
-                output = Json::Value("BQ");
-                return;
-            }
-            if (input == CountryCode::CountryCodeBA)
-            {
-                output = Json::Value("BA");
-                return;
-            }
-            if (input == CountryCode::CountryCodeBW)
-            {
-                output = Json::Value("BW");
-                return;
-            }
-            if (input == CountryCode::CountryCodeBV)
-            {
-                output = Json::Value("BV");
-                return;
-            }
-            if (input == CountryCode::CountryCodeBR)
-            {
-                output = Json::Value("BR");
-                return;
-            }
-            if (input == CountryCode::CountryCodeIO)
-            {
-                output = Json::Value("IO");
-                return;
-            }
-            if (input == CountryCode::CountryCodeBN)
-            {
-                output = Json::Value("BN");
-                return;
-            }
-            if (input == CountryCode::CountryCodeBG)
-            {
-                output = Json::Value("BG");
-                return;
-            }
-            if (input == CountryCode::CountryCodeBF)
-            {
-                output = Json::Value("BF");
-                return;
-            }
-            if (input == CountryCode::CountryCodeBI)
-            {
-                output = Json::Value("BI");
-                return;
-            }
-            if (input == CountryCode::CountryCodeKH)
-            {
-                output = Json::Value("KH");
-                return;
-            }
-            if (input == CountryCode::CountryCodeCM)
-            {
-                output = Json::Value("CM");
-                return;
-            }
-            if (input == CountryCode::CountryCodeCA)
-            {
-                output = Json::Value("CA");
-                return;
-            }
-            if (input == CountryCode::CountryCodeCV)
-            {
-                output = Json::Value("CV");
-                return;
-            }
-            if (input == CountryCode::CountryCodeKY)
-            {
-                output = Json::Value("KY");
-                return;
-            }
-            if (input == CountryCode::CountryCodeCF)
-            {
-                output = Json::Value("CF");
-                return;
-            }
-            if (input == CountryCode::CountryCodeTD)
-            {
-                output = Json::Value("TD");
-                return;
-            }
-            if (input == CountryCode::CountryCodeCL)
-            {
-                output = Json::Value("CL");
-                return;
-            }
-            if (input == CountryCode::CountryCodeCN)
-            {
-                output = Json::Value("CN");
-                return;
-            }
-            if (input == CountryCode::CountryCodeCX)
-            {
-                output = Json::Value("CX");
-                return;
-            }
-            if (input == CountryCode::CountryCodeCC)
-            {
-                output = Json::Value("CC");
-                return;
-            }
-            if (input == CountryCode::CountryCodeCO)
-            {
-                output = Json::Value("CO");
-                return;
-            }
-            if (input == CountryCode::CountryCodeKM)
-            {
-                output = Json::Value("KM");
-                return;
-            }
-            if (input == CountryCode::CountryCodeCG)
-            {
-                output = Json::Value("CG");
-                return;
-            }
-            if (input == CountryCode::CountryCodeCD)
-            {
-                output = Json::Value("CD");
-                return;
-            }
-            if (input == CountryCode::CountryCodeCK)
-            {
-                output = Json::Value("CK");
-                return;
-            }
-            if (input == CountryCode::CountryCodeCR)
-            {
-                output = Json::Value("CR");
-                return;
-            }
-            if (input == CountryCode::CountryCodeCI)
-            {
-                output = Json::Value("CI");
-                return;
-            }
-            if (input == CountryCode::CountryCodeHR)
-            {
-                output = Json::Value("HR");
-                return;
-            }
-            if (input == CountryCode::CountryCodeCU)
-            {
-                output = Json::Value("CU");
-                return;
-            }
-            if (input == CountryCode::CountryCodeCW)
-            {
-                output = Json::Value("CW");
-                return;
-            }
-            if (input == CountryCode::CountryCodeCY)
-            {
-                output = Json::Value("CY");
-                return;
-            }
-            if (input == CountryCode::CountryCodeCZ)
-            {
-                output = Json::Value("CZ");
-                return;
-            }
-            if (input == CountryCode::CountryCodeDK)
-            {
-                output = Json::Value("DK");
-                return;
-            }
-            if (input == CountryCode::CountryCodeDJ)
-            {
-                output = Json::Value("DJ");
-                return;
-            }
-            if (input == CountryCode::CountryCodeDM)
-            {
-                output = Json::Value("DM");
-                return;
-            }
-            if (input == CountryCode::CountryCodeDO)
-            {
-                output = Json::Value("DO");
-                return;
-            }
-            if (input == CountryCode::CountryCodeEC)
-            {
-                output = Json::Value("EC");
-                return;
-            }
-            if (input == CountryCode::CountryCodeEG)
-            {
-                output = Json::Value("EG");
-                return;
-            }
-            if (input == CountryCode::CountryCodeSV)
-            {
-                output = Json::Value("SV");
-                return;
-            }
-            if (input == CountryCode::CountryCodeGQ)
-            {
-                output = Json::Value("GQ");
-                return;
-            }
-            if (input == CountryCode::CountryCodeER)
-            {
-                output = Json::Value("ER");
-                return;
-            }
-            if (input == CountryCode::CountryCodeEE)
-            {
-                output = Json::Value("EE");
-                return;
-            }
-            if (input == CountryCode::CountryCodeET)
-            {
-                output = Json::Value("ET");
-                return;
-            }
-            if (input == CountryCode::CountryCodeFK)
-            {
-                output = Json::Value("FK");
-                return;
-            }
-            if (input == CountryCode::CountryCodeFO)
-            {
-                output = Json::Value("FO");
-                return;
-            }
-            if (input == CountryCode::CountryCodeFJ)
-            {
-                output = Json::Value("FJ");
-                return;
-            }
-            if (input == CountryCode::CountryCodeFI)
-            {
-                output = Json::Value("FI");
-                return;
-            }
-            if (input == CountryCode::CountryCodeFR)
-            {
-                output = Json::Value("FR");
-                return;
-            }
-            if (input == CountryCode::CountryCodeGF)
-            {
-                output = Json::Value("GF");
-                return;
-            }
-            if (input == CountryCode::CountryCodePF)
-            {
-                output = Json::Value("PF");
-                return;
-            }
-            if (input == CountryCode::CountryCodeTF)
-            {
-                output = Json::Value("TF");
-                return;
-            }
-            if (input == CountryCode::CountryCodeGA)
-            {
-                output = Json::Value("GA");
-                return;
-            }
-            if (input == CountryCode::CountryCodeGM)
-            {
-                output = Json::Value("GM");
-                return;
-            }
-            if (input == CountryCode::CountryCodeGE)
-            {
-                output = Json::Value("GE");
-                return;
-            }
-            if (input == CountryCode::CountryCodeDE)
-            {
-                output = Json::Value("DE");
-                return;
-            }
-            if (input == CountryCode::CountryCodeGH)
-            {
-                output = Json::Value("GH");
-                return;
-            }
-            if (input == CountryCode::CountryCodeGI)
-            {
-                output = Json::Value("GI");
-                return;
-            }
-            if (input == CountryCode::CountryCodeGR)
-            {
-                output = Json::Value("GR");
-                return;
-            }
-            if (input == CountryCode::CountryCodeGL)
-            {
-                output = Json::Value("GL");
-                return;
-            }
-            if (input == CountryCode::CountryCodeGD)
-            {
-                output = Json::Value("GD");
-                return;
-            }
-            if (input == CountryCode::CountryCodeGP)
-            {
-                output = Json::Value("GP");
-                return;
-            }
-            if (input == CountryCode::CountryCodeGU)
-            {
-                output = Json::Value("GU");
-                return;
-            }
-            if (input == CountryCode::CountryCodeGT)
-            {
-                output = Json::Value("GT");
-                return;
-            }
-            if (input == CountryCode::CountryCodeGG)
-            {
-                output = Json::Value("GG");
-                return;
-            }
-            if (input == CountryCode::CountryCodeGN)
-            {
-                output = Json::Value("GN");
-                return;
-            }
-            if (input == CountryCode::CountryCodeGW)
-            {
-                output = Json::Value("GW");
-                return;
-            }
-            if (input == CountryCode::CountryCodeGY)
-            {
-                output = Json::Value("GY");
-                return;
-            }
-            if (input == CountryCode::CountryCodeHT)
-            {
-                output = Json::Value("HT");
-                return;
-            }
-            if (input == CountryCode::CountryCodeHM)
-            {
-                output = Json::Value("HM");
-                return;
-            }
-            if (input == CountryCode::CountryCodeVA)
-            {
-                output = Json::Value("VA");
-                return;
-            }
-            if (input == CountryCode::CountryCodeHN)
-            {
-                output = Json::Value("HN");
-                return;
-            }
-            if (input == CountryCode::CountryCodeHK)
-            {
-                output = Json::Value("HK");
-                return;
-            }
-            if (input == CountryCode::CountryCodeHU)
-            {
-                output = Json::Value("HU");
-                return;
-            }
-            if (input == CountryCode::CountryCodeIS)
-            {
-                output = Json::Value("IS");
-                return;
-            }
-            if (input == CountryCode::CountryCodeIN)
-            {
-                output = Json::Value("IN");
-                return;
-            }
-            if (input == CountryCode::CountryCodeID)
-            {
-                output = Json::Value("ID");
-                return;
-            }
-            if (input == CountryCode::CountryCodeIR)
-            {
-                output = Json::Value("IR");
-                return;
-            }
-            if (input == CountryCode::CountryCodeIQ)
-            {
-                output = Json::Value("IQ");
-                return;
-            }
-            if (input == CountryCode::CountryCodeIE)
-            {
-                output = Json::Value("IE");
-                return;
-            }
-            if (input == CountryCode::CountryCodeIM)
-            {
-                output = Json::Value("IM");
-                return;
-            }
-            if (input == CountryCode::CountryCodeIL)
-            {
-                output = Json::Value("IL");
-                return;
-            }
-            if (input == CountryCode::CountryCodeIT)
-            {
-                output = Json::Value("IT");
-                return;
-            }
-            if (input == CountryCode::CountryCodeJM)
-            {
-                output = Json::Value("JM");
-                return;
-            }
-            if (input == CountryCode::CountryCodeJP)
-            {
-                output = Json::Value("JP");
-                return;
-            }
-            if (input == CountryCode::CountryCodeJE)
-            {
-                output = Json::Value("JE");
-                return;
-            }
-            if (input == CountryCode::CountryCodeJO)
-            {
-                output = Json::Value("JO");
-                return;
-            }
-            if (input == CountryCode::CountryCodeKZ)
-            {
-                output = Json::Value("KZ");
-                return;
-            }
-            if (input == CountryCode::CountryCodeKE)
-            {
-                output = Json::Value("KE");
-                return;
-            }
-            if (input == CountryCode::CountryCodeKI)
-            {
-                output = Json::Value("KI");
-                return;
-            }
-            if (input == CountryCode::CountryCodeKP)
-            {
-                output = Json::Value("KP");
-                return;
-            }
-            if (input == CountryCode::CountryCodeKR)
-            {
-                output = Json::Value("KR");
-                return;
-            }
-            if (input == CountryCode::CountryCodeKW)
-            {
-                output = Json::Value("KW");
-                return;
-            }
-            if (input == CountryCode::CountryCodeKG)
-            {
-                output = Json::Value("KG");
-                return;
-            }
-            if (input == CountryCode::CountryCodeLA)
-            {
-                output = Json::Value("LA");
-                return;
-            }
-            if (input == CountryCode::CountryCodeLV)
-            {
-                output = Json::Value("LV");
-                return;
-            }
-            if (input == CountryCode::CountryCodeLB)
-            {
-                output = Json::Value("LB");
-                return;
-            }
-            if (input == CountryCode::CountryCodeLS)
-            {
-                output = Json::Value("LS");
-                return;
-            }
-            if (input == CountryCode::CountryCodeLR)
-            {
-                output = Json::Value("LR");
-                return;
-            }
-            if (input == CountryCode::CountryCodeLY)
-            {
-                output = Json::Value("LY");
-                return;
-            }
-            if (input == CountryCode::CountryCodeLI)
-            {
-                output = Json::Value("LI");
-                return;
-            }
-            if (input == CountryCode::CountryCodeLT)
-            {
-                output = Json::Value("LT");
-                return;
-            }
-            if (input == CountryCode::CountryCodeLU)
-            {
-                output = Json::Value("LU");
-                return;
-            }
-            if (input == CountryCode::CountryCodeMO)
-            {
-                output = Json::Value("MO");
-                return;
-            }
-            if (input == CountryCode::CountryCodeMK)
-            {
-                output = Json::Value("MK");
-                return;
-            }
-            if (input == CountryCode::CountryCodeMG)
-            {
-                output = Json::Value("MG");
-                return;
-            }
-            if (input == CountryCode::CountryCodeMW)
-            {
-                output = Json::Value("MW");
-                return;
-            }
-            if (input == CountryCode::CountryCodeMY)
-            {
-                output = Json::Value("MY");
-                return;
-            }
-            if (input == CountryCode::CountryCodeMV)
-            {
-                output = Json::Value("MV");
-                return;
-            }
-            if (input == CountryCode::CountryCodeML)
-            {
-                output = Json::Value("ML");
-                return;
-            }
-            if (input == CountryCode::CountryCodeMT)
-            {
-                output = Json::Value("MT");
-                return;
-            }
-            if (input == CountryCode::CountryCodeMH)
-            {
-                output = Json::Value("MH");
-                return;
-            }
-            if (input == CountryCode::CountryCodeMQ)
-            {
-                output = Json::Value("MQ");
-                return;
-            }
-            if (input == CountryCode::CountryCodeMR)
-            {
-                output = Json::Value("MR");
-                return;
-            }
-            if (input == CountryCode::CountryCodeMU)
-            {
-                output = Json::Value("MU");
-                return;
-            }
-            if (input == CountryCode::CountryCodeYT)
-            {
-                output = Json::Value("YT");
-                return;
-            }
-            if (input == CountryCode::CountryCodeMX)
-            {
-                output = Json::Value("MX");
-                return;
-            }
-            if (input == CountryCode::CountryCodeFM)
-            {
-                output = Json::Value("FM");
-                return;
-            }
-            if (input == CountryCode::CountryCodeMD)
-            {
-                output = Json::Value("MD");
-                return;
-            }
-            if (input == CountryCode::CountryCodeMC)
-            {
-                output = Json::Value("MC");
-                return;
-            }
-            if (input == CountryCode::CountryCodeMN)
-            {
-                output = Json::Value("MN");
-                return;
-            }
-            if (input == CountryCode::CountryCodeME)
-            {
-                output = Json::Value("ME");
-                return;
-            }
-            if (input == CountryCode::CountryCodeMS)
-            {
-                output = Json::Value("MS");
-                return;
-            }
-            if (input == CountryCode::CountryCodeMA)
-            {
-                output = Json::Value("MA");
-                return;
-            }
-            if (input == CountryCode::CountryCodeMZ)
-            {
-                output = Json::Value("MZ");
-                return;
-            }
-            if (input == CountryCode::CountryCodeMM)
-            {
-                output = Json::Value("MM");
-                return;
-            }
-            if (input == CountryCode::CountryCodeNA)
-            {
-                output = Json::Value("NA");
-                return;
-            }
-            if (input == CountryCode::CountryCodeNR)
-            {
-                output = Json::Value("NR");
-                return;
-            }
-            if (input == CountryCode::CountryCodeNP)
-            {
-                output = Json::Value("NP");
-                return;
-            }
-            if (input == CountryCode::CountryCodeNL)
-            {
-                output = Json::Value("NL");
-                return;
-            }
-            if (input == CountryCode::CountryCodeNC)
-            {
-                output = Json::Value("NC");
-                return;
-            }
-            if (input == CountryCode::CountryCodeNZ)
-            {
-                output = Json::Value("NZ");
-                return;
-            }
-            if (input == CountryCode::CountryCodeNI)
-            {
-                output = Json::Value("NI");
-                return;
-            }
-            if (input == CountryCode::CountryCodeNE)
-            {
-                output = Json::Value("NE");
-                return;
-            }
-            if (input == CountryCode::CountryCodeNG)
-            {
-                output = Json::Value("NG");
-                return;
-            }
-            if (input == CountryCode::CountryCodeNU)
-            {
-                output = Json::Value("NU");
-                return;
-            }
-            if (input == CountryCode::CountryCodeNF)
-            {
-                output = Json::Value("NF");
-                return;
-            }
-            if (input == CountryCode::CountryCodeMP)
-            {
-                output = Json::Value("MP");
-                return;
-            }
-            if (input == CountryCode::CountryCodeNO)
-            {
-                output = Json::Value("NO");
-                return;
-            }
-            if (input == CountryCode::CountryCodeOM)
-            {
-                output = Json::Value("OM");
-                return;
-            }
-            if (input == CountryCode::CountryCodePK)
-            {
-                output = Json::Value("PK");
-                return;
-            }
-            if (input == CountryCode::CountryCodePW)
-            {
-                output = Json::Value("PW");
-                return;
-            }
-            if (input == CountryCode::CountryCodePS)
-            {
-                output = Json::Value("PS");
-                return;
-            }
-            if (input == CountryCode::CountryCodePA)
-            {
-                output = Json::Value("PA");
-                return;
-            }
-            if (input == CountryCode::CountryCodePG)
-            {
-                output = Json::Value("PG");
-                return;
-            }
-            if (input == CountryCode::CountryCodePY)
-            {
-                output = Json::Value("PY");
-                return;
-            }
-            if (input == CountryCode::CountryCodePE)
-            {
-                output = Json::Value("PE");
-                return;
-            }
-            if (input == CountryCode::CountryCodePH)
-            {
-                output = Json::Value("PH");
-                return;
-            }
-            if (input == CountryCode::CountryCodePN)
-            {
-                output = Json::Value("PN");
-                return;
-            }
-            if (input == CountryCode::CountryCodePL)
-            {
-                output = Json::Value("PL");
-                return;
-            }
-            if (input == CountryCode::CountryCodePT)
-            {
-                output = Json::Value("PT");
-                return;
-            }
-            if (input == CountryCode::CountryCodePR)
-            {
-                output = Json::Value("PR");
-                return;
-            }
-            if (input == CountryCode::CountryCodeQA)
-            {
-                output = Json::Value("QA");
-                return;
-            }
-            if (input == CountryCode::CountryCodeRE)
-            {
-                output = Json::Value("RE");
-                return;
-            }
-            if (input == CountryCode::CountryCodeRO)
-            {
-                output = Json::Value("RO");
-                return;
-            }
-            if (input == CountryCode::CountryCodeRU)
-            {
-                output = Json::Value("RU");
-                return;
-            }
-            if (input == CountryCode::CountryCodeRW)
-            {
-                output = Json::Value("RW");
-                return;
-            }
-            if (input == CountryCode::CountryCodeBL)
-            {
-                output = Json::Value("BL");
-                return;
-            }
-            if (input == CountryCode::CountryCodeSH)
-            {
-                output = Json::Value("SH");
-                return;
-            }
-            if (input == CountryCode::CountryCodeKN)
-            {
-                output = Json::Value("KN");
-                return;
-            }
-            if (input == CountryCode::CountryCodeLC)
-            {
-                output = Json::Value("LC");
-                return;
-            }
-            if (input == CountryCode::CountryCodeMF)
-            {
-                output = Json::Value("MF");
-                return;
-            }
-            if (input == CountryCode::CountryCodePM)
-            {
-                output = Json::Value("PM");
-                return;
-            }
-            if (input == CountryCode::CountryCodeVC)
-            {
-                output = Json::Value("VC");
-                return;
-            }
-            if (input == CountryCode::CountryCodeWS)
-            {
-                output = Json::Value("WS");
-                return;
-            }
-            if (input == CountryCode::CountryCodeSM)
-            {
-                output = Json::Value("SM");
-                return;
-            }
-            if (input == CountryCode::CountryCodeST)
-            {
-                output = Json::Value("ST");
-                return;
-            }
-            if (input == CountryCode::CountryCodeSA)
-            {
-                output = Json::Value("SA");
-                return;
-            }
-            if (input == CountryCode::CountryCodeSN)
-            {
-                output = Json::Value("SN");
-                return;
-            }
-            if (input == CountryCode::CountryCodeRS)
-            {
-                output = Json::Value("RS");
-                return;
-            }
-            if (input == CountryCode::CountryCodeSC)
-            {
-                output = Json::Value("SC");
-                return;
-            }
-            if (input == CountryCode::CountryCodeSL)
-            {
-                output = Json::Value("SL");
-                return;
-            }
-            if (input == CountryCode::CountryCodeSG)
-            {
-                output = Json::Value("SG");
-                return;
-            }
-            if (input == CountryCode::CountryCodeSX)
-            {
-                output = Json::Value("SX");
-                return;
-            }
-            if (input == CountryCode::CountryCodeSK)
-            {
-                output = Json::Value("SK");
-                return;
-            }
-            if (input == CountryCode::CountryCodeSI)
-            {
-                output = Json::Value("SI");
-                return;
-            }
-            if (input == CountryCode::CountryCodeSB)
-            {
-                output = Json::Value("SB");
-                return;
-            }
-            if (input == CountryCode::CountryCodeSO)
-            {
-                output = Json::Value("SO");
-                return;
-            }
-            if (input == CountryCode::CountryCodeZA)
-            {
-                output = Json::Value("ZA");
-                return;
-            }
-            if (input == CountryCode::CountryCodeGS)
-            {
-                output = Json::Value("GS");
-                return;
-            }
-            if (input == CountryCode::CountryCodeSS)
-            {
-                output = Json::Value("SS");
-                return;
-            }
-            if (input == CountryCode::CountryCodeES)
-            {
-                output = Json::Value("ES");
-                return;
-            }
-            if (input == CountryCode::CountryCodeLK)
-            {
-                output = Json::Value("LK");
-                return;
-            }
-            if (input == CountryCode::CountryCodeSD)
-            {
-                output = Json::Value("SD");
-                return;
-            }
-            if (input == CountryCode::CountryCodeSR)
-            {
-                output = Json::Value("SR");
-                return;
-            }
-            if (input == CountryCode::CountryCodeSJ)
-            {
-                output = Json::Value("SJ");
-                return;
-            }
-            if (input == CountryCode::CountryCodeSZ)
-            {
-                output = Json::Value("SZ");
-                return;
-            }
-            if (input == CountryCode::CountryCodeSE)
-            {
-                output = Json::Value("SE");
-                return;
-            }
-            if (input == CountryCode::CountryCodeCH)
-            {
-                output = Json::Value("CH");
-                return;
-            }
-            if (input == CountryCode::CountryCodeSY)
-            {
-                output = Json::Value("SY");
-                return;
-            }
-            if (input == CountryCode::CountryCodeTW)
-            {
-                output = Json::Value("TW");
-                return;
-            }
-            if (input == CountryCode::CountryCodeTJ)
-            {
-                output = Json::Value("TJ");
-                return;
-            }
-            if (input == CountryCode::CountryCodeTZ)
-            {
-                output = Json::Value("TZ");
-                return;
-            }
-            if (input == CountryCode::CountryCodeTH)
-            {
-                output = Json::Value("TH");
-                return;
-            }
-            if (input == CountryCode::CountryCodeTL)
-            {
-                output = Json::Value("TL");
-                return;
-            }
-            if (input == CountryCode::CountryCodeTG)
-            {
-                output = Json::Value("TG");
-                return;
-            }
-            if (input == CountryCode::CountryCodeTK)
-            {
-                output = Json::Value("TK");
-                return;
-            }
-            if (input == CountryCode::CountryCodeTO)
-            {
-                output = Json::Value("TO");
-                return;
-            }
-            if (input == CountryCode::CountryCodeTT)
-            {
-                output = Json::Value("TT");
-                return;
-            }
-            if (input == CountryCode::CountryCodeTN)
-            {
-                output = Json::Value("TN");
-                return;
-            }
-            if (input == CountryCode::CountryCodeTR)
-            {
-                output = Json::Value("TR");
-                return;
-            }
-            if (input == CountryCode::CountryCodeTM)
-            {
-                output = Json::Value("TM");
-                return;
-            }
-            if (input == CountryCode::CountryCodeTC)
-            {
-                output = Json::Value("TC");
-                return;
-            }
-            if (input == CountryCode::CountryCodeTV)
-            {
-                output = Json::Value("TV");
-                return;
-            }
-            if (input == CountryCode::CountryCodeUG)
-            {
-                output = Json::Value("UG");
-                return;
-            }
-            if (input == CountryCode::CountryCodeUA)
-            {
-                output = Json::Value("UA");
-                return;
-            }
-            if (input == CountryCode::CountryCodeAE)
-            {
-                output = Json::Value("AE");
-                return;
-            }
-            if (input == CountryCode::CountryCodeGB)
-            {
-                output = Json::Value("GB");
-                return;
-            }
-            if (input == CountryCode::CountryCodeUS)
-            {
-                output = Json::Value("US");
-                return;
-            }
-            if (input == CountryCode::CountryCodeUM)
-            {
-                output = Json::Value("UM");
-                return;
-            }
-            if (input == CountryCode::CountryCodeUY)
-            {
-                output = Json::Value("UY");
-                return;
-            }
-            if (input == CountryCode::CountryCodeUZ)
-            {
-                output = Json::Value("UZ");
-                return;
-            }
-            if (input == CountryCode::CountryCodeVU)
-            {
-                output = Json::Value("VU");
-                return;
-            }
-            if (input == CountryCode::CountryCodeVE)
-            {
-                output = Json::Value("VE");
-                return;
-            }
-            if (input == CountryCode::CountryCodeVN)
-            {
-                output = Json::Value("VN");
-                return;
-            }
-            if (input == CountryCode::CountryCodeVG)
-            {
-                output = Json::Value("VG");
-                return;
-            }
-            if (input == CountryCode::CountryCodeVI)
-            {
-                output = Json::Value("VI");
-                return;
-            }
-            if (input == CountryCode::CountryCodeWF)
-            {
-                output = Json::Value("WF");
-                return;
-            }
-            if (input == CountryCode::CountryCodeEH)
-            {
-                output = Json::Value("EH");
-                return;
-            }
-            if (input == CountryCode::CountryCodeYE)
-            {
-                output = Json::Value("YE");
-                return;
-            }
-            if (input == CountryCode::CountryCodeZM)
-            {
-                output = Json::Value("ZM");
-                return;
-            }
-            if (input == CountryCode::CountryCodeZW)
-            {
-                output = Json::Value("ZW");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, CountryCode& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "AF")
-            {
-                output = CountryCode::CountryCodeAF;
-                return;
-            }
-            if (inputStr == "AX")
-            {
-                output = CountryCode::CountryCodeAX;
-                return;
-            }
-            if (inputStr == "AL")
-            {
-                output = CountryCode::CountryCodeAL;
-                return;
-            }
-            if (inputStr == "DZ")
-            {
-                output = CountryCode::CountryCodeDZ;
-                return;
-            }
-            if (inputStr == "AS")
-            {
-                output = CountryCode::CountryCodeAS;
-                return;
-            }
-            if (inputStr == "AD")
-            {
-                output = CountryCode::CountryCodeAD;
-                return;
-            }
-            if (inputStr == "AO")
-            {
-                output = CountryCode::CountryCodeAO;
-                return;
-            }
-            if (inputStr == "AI")
-            {
-                output = CountryCode::CountryCodeAI;
-                return;
-            }
-            if (inputStr == "AQ")
-            {
-                output = CountryCode::CountryCodeAQ;
-                return;
-            }
-            if (inputStr == "AG")
-            {
-                output = CountryCode::CountryCodeAG;
-                return;
-            }
-            if (inputStr == "AR")
-            {
-                output = CountryCode::CountryCodeAR;
-                return;
-            }
-            if (inputStr == "AM")
-            {
-                output = CountryCode::CountryCodeAM;
-                return;
-            }
-            if (inputStr == "AW")
-            {
-                output = CountryCode::CountryCodeAW;
-                return;
-            }
-            if (inputStr == "AU")
-            {
-                output = CountryCode::CountryCodeAU;
-                return;
-            }
-            if (inputStr == "AT")
-            {
-                output = CountryCode::CountryCodeAT;
-                return;
-            }
-            if (inputStr == "AZ")
-            {
-                output = CountryCode::CountryCodeAZ;
-                return;
-            }
-            if (inputStr == "BS")
-            {
-                output = CountryCode::CountryCodeBS;
-                return;
-            }
-            if (inputStr == "BH")
-            {
-                output = CountryCode::CountryCodeBH;
-                return;
-            }
-            if (inputStr == "BD")
-            {
-                output = CountryCode::CountryCodeBD;
-                return;
-            }
-            if (inputStr == "BB")
-            {
-                output = CountryCode::CountryCodeBB;
-                return;
-            }
-            if (inputStr == "BY")
-            {
-                output = CountryCode::CountryCodeBY;
-                return;
-            }
-            if (inputStr == "BE")
-            {
-                output = CountryCode::CountryCodeBE;
-                return;
-            }
-            if (inputStr == "BZ")
-            {
-                output = CountryCode::CountryCodeBZ;
-                return;
-            }
-            if (inputStr == "BJ")
-            {
-                output = CountryCode::CountryCodeBJ;
-                return;
-            }
-            if (inputStr == "BM")
-            {
-                output = CountryCode::CountryCodeBM;
-                return;
-            }
-            if (inputStr == "BT")
-            {
-                output = CountryCode::CountryCodeBT;
-                return;
-            }
-            if (inputStr == "BO")
-            {
-                output = CountryCode::CountryCodeBO;
-                return;
-            }
-            if (inputStr == "BQ")
-            {
-                output = CountryCode::CountryCodeBQ;
-                return;
-            }
-            if (inputStr == "BA")
-            {
-                output = CountryCode::CountryCodeBA;
-                return;
-            }
-            if (inputStr == "BW")
-            {
-                output = CountryCode::CountryCodeBW;
-                return;
-            }
-            if (inputStr == "BV")
-            {
-                output = CountryCode::CountryCodeBV;
-                return;
-            }
-            if (inputStr == "BR")
-            {
-                output = CountryCode::CountryCodeBR;
-                return;
-            }
-            if (inputStr == "IO")
-            {
-                output = CountryCode::CountryCodeIO;
-                return;
-            }
-            if (inputStr == "BN")
-            {
-                output = CountryCode::CountryCodeBN;
-                return;
-            }
-            if (inputStr == "BG")
-            {
-                output = CountryCode::CountryCodeBG;
-                return;
-            }
-            if (inputStr == "BF")
-            {
-                output = CountryCode::CountryCodeBF;
-                return;
-            }
-            if (inputStr == "BI")
-            {
-                output = CountryCode::CountryCodeBI;
-                return;
-            }
-            if (inputStr == "KH")
-            {
-                output = CountryCode::CountryCodeKH;
-                return;
-            }
-            if (inputStr == "CM")
-            {
-                output = CountryCode::CountryCodeCM;
-                return;
-            }
-            if (inputStr == "CA")
-            {
-                output = CountryCode::CountryCodeCA;
-                return;
-            }
-            if (inputStr == "CV")
-            {
-                output = CountryCode::CountryCodeCV;
-                return;
-            }
-            if (inputStr == "KY")
-            {
-                output = CountryCode::CountryCodeKY;
-                return;
-            }
-            if (inputStr == "CF")
-            {
-                output = CountryCode::CountryCodeCF;
-                return;
-            }
-            if (inputStr == "TD")
-            {
-                output = CountryCode::CountryCodeTD;
-                return;
-            }
-            if (inputStr == "CL")
-            {
-                output = CountryCode::CountryCodeCL;
-                return;
-            }
-            if (inputStr == "CN")
-            {
-                output = CountryCode::CountryCodeCN;
-                return;
-            }
-            if (inputStr == "CX")
-            {
-                output = CountryCode::CountryCodeCX;
-                return;
-            }
-            if (inputStr == "CC")
-            {
-                output = CountryCode::CountryCodeCC;
-                return;
-            }
-            if (inputStr == "CO")
-            {
-                output = CountryCode::CountryCodeCO;
-                return;
-            }
-            if (inputStr == "KM")
-            {
-                output = CountryCode::CountryCodeKM;
-                return;
-            }
-            if (inputStr == "CG")
-            {
-                output = CountryCode::CountryCodeCG;
-                return;
-            }
-            if (inputStr == "CD")
-            {
-                output = CountryCode::CountryCodeCD;
-                return;
-            }
-            if (inputStr == "CK")
-            {
-                output = CountryCode::CountryCodeCK;
-                return;
-            }
-            if (inputStr == "CR")
-            {
-                output = CountryCode::CountryCodeCR;
-                return;
-            }
-            if (inputStr == "CI")
-            {
-                output = CountryCode::CountryCodeCI;
-                return;
-            }
-            if (inputStr == "HR")
-            {
-                output = CountryCode::CountryCodeHR;
-                return;
-            }
-            if (inputStr == "CU")
-            {
-                output = CountryCode::CountryCodeCU;
-                return;
-            }
-            if (inputStr == "CW")
-            {
-                output = CountryCode::CountryCodeCW;
-                return;
-            }
-            if (inputStr == "CY")
-            {
-                output = CountryCode::CountryCodeCY;
-                return;
-            }
-            if (inputStr == "CZ")
-            {
-                output = CountryCode::CountryCodeCZ;
-                return;
-            }
-            if (inputStr == "DK")
-            {
-                output = CountryCode::CountryCodeDK;
-                return;
-            }
-            if (inputStr == "DJ")
-            {
-                output = CountryCode::CountryCodeDJ;
-                return;
-            }
-            if (inputStr == "DM")
-            {
-                output = CountryCode::CountryCodeDM;
-                return;
-            }
-            if (inputStr == "DO")
-            {
-                output = CountryCode::CountryCodeDO;
-                return;
-            }
-            if (inputStr == "EC")
-            {
-                output = CountryCode::CountryCodeEC;
-                return;
-            }
-            if (inputStr == "EG")
-            {
-                output = CountryCode::CountryCodeEG;
-                return;
-            }
-            if (inputStr == "SV")
-            {
-                output = CountryCode::CountryCodeSV;
-                return;
-            }
-            if (inputStr == "GQ")
-            {
-                output = CountryCode::CountryCodeGQ;
-                return;
-            }
-            if (inputStr == "ER")
-            {
-                output = CountryCode::CountryCodeER;
-                return;
-            }
-            if (inputStr == "EE")
-            {
-                output = CountryCode::CountryCodeEE;
-                return;
-            }
-            if (inputStr == "ET")
-            {
-                output = CountryCode::CountryCodeET;
-                return;
-            }
-            if (inputStr == "FK")
-            {
-                output = CountryCode::CountryCodeFK;
-                return;
-            }
-            if (inputStr == "FO")
-            {
-                output = CountryCode::CountryCodeFO;
-                return;
-            }
-            if (inputStr == "FJ")
-            {
-                output = CountryCode::CountryCodeFJ;
-                return;
-            }
-            if (inputStr == "FI")
-            {
-                output = CountryCode::CountryCodeFI;
-                return;
-            }
-            if (inputStr == "FR")
-            {
-                output = CountryCode::CountryCodeFR;
-                return;
-            }
-            if (inputStr == "GF")
-            {
-                output = CountryCode::CountryCodeGF;
-                return;
-            }
-            if (inputStr == "PF")
-            {
-                output = CountryCode::CountryCodePF;
-                return;
-            }
-            if (inputStr == "TF")
-            {
-                output = CountryCode::CountryCodeTF;
-                return;
-            }
-            if (inputStr == "GA")
-            {
-                output = CountryCode::CountryCodeGA;
-                return;
-            }
-            if (inputStr == "GM")
-            {
-                output = CountryCode::CountryCodeGM;
-                return;
-            }
-            if (inputStr == "GE")
-            {
-                output = CountryCode::CountryCodeGE;
-                return;
-            }
-            if (inputStr == "DE")
-            {
-                output = CountryCode::CountryCodeDE;
-                return;
-            }
-            if (inputStr == "GH")
-            {
-                output = CountryCode::CountryCodeGH;
-                return;
-            }
-            if (inputStr == "GI")
-            {
-                output = CountryCode::CountryCodeGI;
-                return;
-            }
-            if (inputStr == "GR")
-            {
-                output = CountryCode::CountryCodeGR;
-                return;
-            }
-            if (inputStr == "GL")
-            {
-                output = CountryCode::CountryCodeGL;
-                return;
-            }
-            if (inputStr == "GD")
-            {
-                output = CountryCode::CountryCodeGD;
-                return;
-            }
-            if (inputStr == "GP")
-            {
-                output = CountryCode::CountryCodeGP;
-                return;
-            }
-            if (inputStr == "GU")
-            {
-                output = CountryCode::CountryCodeGU;
-                return;
-            }
-            if (inputStr == "GT")
-            {
-                output = CountryCode::CountryCodeGT;
-                return;
-            }
-            if (inputStr == "GG")
-            {
-                output = CountryCode::CountryCodeGG;
-                return;
-            }
-            if (inputStr == "GN")
-            {
-                output = CountryCode::CountryCodeGN;
-                return;
-            }
-            if (inputStr == "GW")
-            {
-                output = CountryCode::CountryCodeGW;
-                return;
-            }
-            if (inputStr == "GY")
-            {
-                output = CountryCode::CountryCodeGY;
-                return;
-            }
-            if (inputStr == "HT")
-            {
-                output = CountryCode::CountryCodeHT;
-                return;
-            }
-            if (inputStr == "HM")
-            {
-                output = CountryCode::CountryCodeHM;
-                return;
-            }
-            if (inputStr == "VA")
-            {
-                output = CountryCode::CountryCodeVA;
-                return;
-            }
-            if (inputStr == "HN")
-            {
-                output = CountryCode::CountryCodeHN;
-                return;
-            }
-            if (inputStr == "HK")
-            {
-                output = CountryCode::CountryCodeHK;
-                return;
-            }
-            if (inputStr == "HU")
-            {
-                output = CountryCode::CountryCodeHU;
-                return;
-            }
-            if (inputStr == "IS")
-            {
-                output = CountryCode::CountryCodeIS;
-                return;
-            }
-            if (inputStr == "IN")
-            {
-                output = CountryCode::CountryCodeIN;
-                return;
-            }
-            if (inputStr == "ID")
-            {
-                output = CountryCode::CountryCodeID;
-                return;
-            }
-            if (inputStr == "IR")
-            {
-                output = CountryCode::CountryCodeIR;
-                return;
-            }
-            if (inputStr == "IQ")
-            {
-                output = CountryCode::CountryCodeIQ;
-                return;
-            }
-            if (inputStr == "IE")
-            {
-                output = CountryCode::CountryCodeIE;
-                return;
-            }
-            if (inputStr == "IM")
-            {
-                output = CountryCode::CountryCodeIM;
-                return;
-            }
-            if (inputStr == "IL")
-            {
-                output = CountryCode::CountryCodeIL;
-                return;
-            }
-            if (inputStr == "IT")
-            {
-                output = CountryCode::CountryCodeIT;
-                return;
-            }
-            if (inputStr == "JM")
-            {
-                output = CountryCode::CountryCodeJM;
-                return;
-            }
-            if (inputStr == "JP")
-            {
-                output = CountryCode::CountryCodeJP;
-                return;
-            }
-            if (inputStr == "JE")
-            {
-                output = CountryCode::CountryCodeJE;
-                return;
-            }
-            if (inputStr == "JO")
-            {
-                output = CountryCode::CountryCodeJO;
-                return;
-            }
-            if (inputStr == "KZ")
-            {
-                output = CountryCode::CountryCodeKZ;
-                return;
-            }
-            if (inputStr == "KE")
-            {
-                output = CountryCode::CountryCodeKE;
-                return;
-            }
-            if (inputStr == "KI")
-            {
-                output = CountryCode::CountryCodeKI;
-                return;
-            }
-            if (inputStr == "KP")
-            {
-                output = CountryCode::CountryCodeKP;
-                return;
-            }
-            if (inputStr == "KR")
-            {
-                output = CountryCode::CountryCodeKR;
-                return;
-            }
-            if (inputStr == "KW")
-            {
-                output = CountryCode::CountryCodeKW;
-                return;
-            }
-            if (inputStr == "KG")
-            {
-                output = CountryCode::CountryCodeKG;
-                return;
-            }
-            if (inputStr == "LA")
-            {
-                output = CountryCode::CountryCodeLA;
-                return;
-            }
-            if (inputStr == "LV")
-            {
-                output = CountryCode::CountryCodeLV;
-                return;
-            }
-            if (inputStr == "LB")
-            {
-                output = CountryCode::CountryCodeLB;
-                return;
-            }
-            if (inputStr == "LS")
-            {
-                output = CountryCode::CountryCodeLS;
-                return;
-            }
-            if (inputStr == "LR")
-            {
-                output = CountryCode::CountryCodeLR;
-                return;
-            }
-            if (inputStr == "LY")
-            {
-                output = CountryCode::CountryCodeLY;
-                return;
-            }
-            if (inputStr == "LI")
-            {
-                output = CountryCode::CountryCodeLI;
-                return;
-            }
-            if (inputStr == "LT")
-            {
-                output = CountryCode::CountryCodeLT;
-                return;
-            }
-            if (inputStr == "LU")
-            {
-                output = CountryCode::CountryCodeLU;
-                return;
-            }
-            if (inputStr == "MO")
-            {
-                output = CountryCode::CountryCodeMO;
-                return;
-            }
-            if (inputStr == "MK")
-            {
-                output = CountryCode::CountryCodeMK;
-                return;
-            }
-            if (inputStr == "MG")
-            {
-                output = CountryCode::CountryCodeMG;
-                return;
-            }
-            if (inputStr == "MW")
-            {
-                output = CountryCode::CountryCodeMW;
-                return;
-            }
-            if (inputStr == "MY")
-            {
-                output = CountryCode::CountryCodeMY;
-                return;
-            }
-            if (inputStr == "MV")
-            {
-                output = CountryCode::CountryCodeMV;
-                return;
-            }
-            if (inputStr == "ML")
-            {
-                output = CountryCode::CountryCodeML;
-                return;
-            }
-            if (inputStr == "MT")
-            {
-                output = CountryCode::CountryCodeMT;
-                return;
-            }
-            if (inputStr == "MH")
-            {
-                output = CountryCode::CountryCodeMH;
-                return;
-            }
-            if (inputStr == "MQ")
-            {
-                output = CountryCode::CountryCodeMQ;
-                return;
-            }
-            if (inputStr == "MR")
-            {
-                output = CountryCode::CountryCodeMR;
-                return;
-            }
-            if (inputStr == "MU")
-            {
-                output = CountryCode::CountryCodeMU;
-                return;
-            }
-            if (inputStr == "YT")
-            {
-                output = CountryCode::CountryCodeYT;
-                return;
-            }
-            if (inputStr == "MX")
-            {
-                output = CountryCode::CountryCodeMX;
-                return;
-            }
-            if (inputStr == "FM")
-            {
-                output = CountryCode::CountryCodeFM;
-                return;
-            }
-            if (inputStr == "MD")
-            {
-                output = CountryCode::CountryCodeMD;
-                return;
-            }
-            if (inputStr == "MC")
-            {
-                output = CountryCode::CountryCodeMC;
-                return;
-            }
-            if (inputStr == "MN")
-            {
-                output = CountryCode::CountryCodeMN;
-                return;
-            }
-            if (inputStr == "ME")
-            {
-                output = CountryCode::CountryCodeME;
-                return;
-            }
-            if (inputStr == "MS")
-            {
-                output = CountryCode::CountryCodeMS;
-                return;
-            }
-            if (inputStr == "MA")
-            {
-                output = CountryCode::CountryCodeMA;
-                return;
-            }
-            if (inputStr == "MZ")
-            {
-                output = CountryCode::CountryCodeMZ;
-                return;
-            }
-            if (inputStr == "MM")
-            {
-                output = CountryCode::CountryCodeMM;
-                return;
-            }
-            if (inputStr == "NA")
-            {
-                output = CountryCode::CountryCodeNA;
-                return;
-            }
-            if (inputStr == "NR")
-            {
-                output = CountryCode::CountryCodeNR;
-                return;
-            }
-            if (inputStr == "NP")
-            {
-                output = CountryCode::CountryCodeNP;
-                return;
-            }
-            if (inputStr == "NL")
-            {
-                output = CountryCode::CountryCodeNL;
-                return;
-            }
-            if (inputStr == "NC")
-            {
-                output = CountryCode::CountryCodeNC;
-                return;
-            }
-            if (inputStr == "NZ")
-            {
-                output = CountryCode::CountryCodeNZ;
-                return;
-            }
-            if (inputStr == "NI")
-            {
-                output = CountryCode::CountryCodeNI;
-                return;
-            }
-            if (inputStr == "NE")
-            {
-                output = CountryCode::CountryCodeNE;
-                return;
-            }
-            if (inputStr == "NG")
-            {
-                output = CountryCode::CountryCodeNG;
-                return;
-            }
-            if (inputStr == "NU")
-            {
-                output = CountryCode::CountryCodeNU;
-                return;
-            }
-            if (inputStr == "NF")
-            {
-                output = CountryCode::CountryCodeNF;
-                return;
-            }
-            if (inputStr == "MP")
-            {
-                output = CountryCode::CountryCodeMP;
-                return;
-            }
-            if (inputStr == "NO")
-            {
-                output = CountryCode::CountryCodeNO;
-                return;
-            }
-            if (inputStr == "OM")
-            {
-                output = CountryCode::CountryCodeOM;
-                return;
-            }
-            if (inputStr == "PK")
-            {
-                output = CountryCode::CountryCodePK;
-                return;
-            }
-            if (inputStr == "PW")
-            {
-                output = CountryCode::CountryCodePW;
-                return;
-            }
-            if (inputStr == "PS")
-            {
-                output = CountryCode::CountryCodePS;
-                return;
-            }
-            if (inputStr == "PA")
-            {
-                output = CountryCode::CountryCodePA;
-                return;
-            }
-            if (inputStr == "PG")
-            {
-                output = CountryCode::CountryCodePG;
-                return;
-            }
-            if (inputStr == "PY")
-            {
-                output = CountryCode::CountryCodePY;
-                return;
-            }
-            if (inputStr == "PE")
-            {
-                output = CountryCode::CountryCodePE;
-                return;
-            }
-            if (inputStr == "PH")
-            {
-                output = CountryCode::CountryCodePH;
-                return;
-            }
-            if (inputStr == "PN")
-            {
-                output = CountryCode::CountryCodePN;
-                return;
-            }
-            if (inputStr == "PL")
-            {
-                output = CountryCode::CountryCodePL;
-                return;
-            }
-            if (inputStr == "PT")
-            {
-                output = CountryCode::CountryCodePT;
-                return;
-            }
-            if (inputStr == "PR")
-            {
-                output = CountryCode::CountryCodePR;
-                return;
-            }
-            if (inputStr == "QA")
-            {
-                output = CountryCode::CountryCodeQA;
-                return;
-            }
-            if (inputStr == "RE")
-            {
-                output = CountryCode::CountryCodeRE;
-                return;
-            }
-            if (inputStr == "RO")
-            {
-                output = CountryCode::CountryCodeRO;
-                return;
-            }
-            if (inputStr == "RU")
-            {
-                output = CountryCode::CountryCodeRU;
-                return;
-            }
-            if (inputStr == "RW")
-            {
-                output = CountryCode::CountryCodeRW;
-                return;
-            }
-            if (inputStr == "BL")
-            {
-                output = CountryCode::CountryCodeBL;
-                return;
-            }
-            if (inputStr == "SH")
-            {
-                output = CountryCode::CountryCodeSH;
-                return;
-            }
-            if (inputStr == "KN")
-            {
-                output = CountryCode::CountryCodeKN;
-                return;
-            }
-            if (inputStr == "LC")
-            {
-                output = CountryCode::CountryCodeLC;
-                return;
-            }
-            if (inputStr == "MF")
-            {
-                output = CountryCode::CountryCodeMF;
-                return;
-            }
-            if (inputStr == "PM")
-            {
-                output = CountryCode::CountryCodePM;
-                return;
-            }
-            if (inputStr == "VC")
-            {
-                output = CountryCode::CountryCodeVC;
-                return;
-            }
-            if (inputStr == "WS")
-            {
-                output = CountryCode::CountryCodeWS;
-                return;
-            }
-            if (inputStr == "SM")
-            {
-                output = CountryCode::CountryCodeSM;
-                return;
-            }
-            if (inputStr == "ST")
-            {
-                output = CountryCode::CountryCodeST;
-                return;
-            }
-            if (inputStr == "SA")
-            {
-                output = CountryCode::CountryCodeSA;
-                return;
-            }
-            if (inputStr == "SN")
-            {
-                output = CountryCode::CountryCodeSN;
-                return;
-            }
-            if (inputStr == "RS")
-            {
-                output = CountryCode::CountryCodeRS;
-                return;
-            }
-            if (inputStr == "SC")
-            {
-                output = CountryCode::CountryCodeSC;
-                return;
-            }
-            if (inputStr == "SL")
-            {
-                output = CountryCode::CountryCodeSL;
-                return;
-            }
-            if (inputStr == "SG")
-            {
-                output = CountryCode::CountryCodeSG;
-                return;
-            }
-            if (inputStr == "SX")
-            {
-                output = CountryCode::CountryCodeSX;
-                return;
-            }
-            if (inputStr == "SK")
-            {
-                output = CountryCode::CountryCodeSK;
-                return;
-            }
-            if (inputStr == "SI")
-            {
-                output = CountryCode::CountryCodeSI;
-                return;
-            }
-            if (inputStr == "SB")
-            {
-                output = CountryCode::CountryCodeSB;
-                return;
-            }
-            if (inputStr == "SO")
-            {
-                output = CountryCode::CountryCodeSO;
-                return;
-            }
-            if (inputStr == "ZA")
-            {
-                output = CountryCode::CountryCodeZA;
-                return;
-            }
-            if (inputStr == "GS")
-            {
-                output = CountryCode::CountryCodeGS;
-                return;
-            }
-            if (inputStr == "SS")
-            {
-                output = CountryCode::CountryCodeSS;
-                return;
-            }
-            if (inputStr == "ES")
-            {
-                output = CountryCode::CountryCodeES;
-                return;
-            }
-            if (inputStr == "LK")
-            {
-                output = CountryCode::CountryCodeLK;
-                return;
-            }
-            if (inputStr == "SD")
-            {
-                output = CountryCode::CountryCodeSD;
-                return;
-            }
-            if (inputStr == "SR")
-            {
-                output = CountryCode::CountryCodeSR;
-                return;
-            }
-            if (inputStr == "SJ")
-            {
-                output = CountryCode::CountryCodeSJ;
-                return;
-            }
-            if (inputStr == "SZ")
-            {
-                output = CountryCode::CountryCodeSZ;
-                return;
-            }
-            if (inputStr == "SE")
-            {
-                output = CountryCode::CountryCodeSE;
-                return;
-            }
-            if (inputStr == "CH")
-            {
-                output = CountryCode::CountryCodeCH;
-                return;
-            }
-            if (inputStr == "SY")
-            {
-                output = CountryCode::CountryCodeSY;
-                return;
-            }
-            if (inputStr == "TW")
-            {
-                output = CountryCode::CountryCodeTW;
-                return;
-            }
-            if (inputStr == "TJ")
-            {
-                output = CountryCode::CountryCodeTJ;
-                return;
-            }
-            if (inputStr == "TZ")
-            {
-                output = CountryCode::CountryCodeTZ;
-                return;
-            }
-            if (inputStr == "TH")
-            {
-                output = CountryCode::CountryCodeTH;
-                return;
-            }
-            if (inputStr == "TL")
-            {
-                output = CountryCode::CountryCodeTL;
-                return;
-            }
-            if (inputStr == "TG")
-            {
-                output = CountryCode::CountryCodeTG;
-                return;
-            }
-            if (inputStr == "TK")
-            {
-                output = CountryCode::CountryCodeTK;
-                return;
-            }
-            if (inputStr == "TO")
-            {
-                output = CountryCode::CountryCodeTO;
-                return;
-            }
-            if (inputStr == "TT")
-            {
-                output = CountryCode::CountryCodeTT;
-                return;
-            }
-            if (inputStr == "TN")
-            {
-                output = CountryCode::CountryCodeTN;
-                return;
-            }
-            if (inputStr == "TR")
-            {
-                output = CountryCode::CountryCodeTR;
-                return;
-            }
-            if (inputStr == "TM")
-            {
-                output = CountryCode::CountryCodeTM;
-                return;
-            }
-            if (inputStr == "TC")
-            {
-                output = CountryCode::CountryCodeTC;
-                return;
-            }
-            if (inputStr == "TV")
-            {
-                output = CountryCode::CountryCodeTV;
-                return;
-            }
-            if (inputStr == "UG")
-            {
-                output = CountryCode::CountryCodeUG;
-                return;
-            }
-            if (inputStr == "UA")
-            {
-                output = CountryCode::CountryCodeUA;
-                return;
-            }
-            if (inputStr == "AE")
-            {
-                output = CountryCode::CountryCodeAE;
-                return;
-            }
-            if (inputStr == "GB")
-            {
-                output = CountryCode::CountryCodeGB;
-                return;
-            }
-            if (inputStr == "US")
-            {
-                output = CountryCode::CountryCodeUS;
-                return;
-            }
-            if (inputStr == "UM")
-            {
-                output = CountryCode::CountryCodeUM;
-                return;
-            }
-            if (inputStr == "UY")
-            {
-                output = CountryCode::CountryCodeUY;
-                return;
-            }
-            if (inputStr == "UZ")
-            {
-                output = CountryCode::CountryCodeUZ;
-                return;
-            }
-            if (inputStr == "VU")
-            {
-                output = CountryCode::CountryCodeVU;
-                return;
-            }
-            if (inputStr == "VE")
-            {
-                output = CountryCode::CountryCodeVE;
-                return;
-            }
-            if (inputStr == "VN")
-            {
-                output = CountryCode::CountryCodeVN;
-                return;
-            }
-            if (inputStr == "VG")
-            {
-                output = CountryCode::CountryCodeVG;
-                return;
-            }
-            if (inputStr == "VI")
-            {
-                output = CountryCode::CountryCodeVI;
-                return;
-            }
-            if (inputStr == "WF")
-            {
-                output = CountryCode::CountryCodeWF;
-                return;
-            }
-            if (inputStr == "EH")
-            {
-                output = CountryCode::CountryCodeEH;
-                return;
-            }
-            if (inputStr == "YE")
-            {
-                output = CountryCode::CountryCodeYE;
-                return;
-            }
-            if (inputStr == "ZM")
-            {
-                output = CountryCode::CountryCodeZM;
-                return;
-            }
-            if (inputStr == "ZW")
-            {
-                output = CountryCode::CountryCodeZW;
-                return;
-            }
-        }
+        void ToJsonEnum(const CountryCode input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, CountryCode& output);
 
         enum class Currency
         {
@@ -3133,1637 +468,8 @@ namespace PlayFab
             CurrencyZWD
         };
 
-        inline void ToJsonEnum(const Currency input, Json::Value& output)
-        {
-            if (input == Currency::CurrencyAED)
-            {
-                output = Json::Value("AED");
-                return;
-            }
-            if (input == Currency::CurrencyAFN)
-            {
-                output = Json::Value("AFN");
-                return;
-            }
-            if (input == Currency::CurrencyALL)
-            {
-                output = Json::Value("ALL");
-                return;
-            }
-            if (input == Currency::CurrencyAMD)
-            {
-                output = Json::Value("AMD");
-                return;
-            }
-            if (input == Currency::CurrencyANG)
-            {
-                output = Json::Value("ANG");
-                return;
-            }
-            if (input == Currency::CurrencyAOA)
-            {
-                output = Json::Value("AOA");
-                return;
-            }
-            if (input == Currency::CurrencyARS)
-            {
-                output = Json::Value("ARS");
-                return;
-            }
-            if (input == Currency::CurrencyAUD)
-            {
-                output = Json::Value("AUD");
-                return;
-            }
-            if (input == Currency::CurrencyAWG)
-            {
-                output = Json::Value("AWG");
-                return;
-            }
-            if (input == Currency::CurrencyAZN)
-            {
-                output = Json::Value("AZN");
-                return;
-            }
-            if (input == Currency::CurrencyBAM)
-            {
-                output = Json::Value("BAM");
-                return;
-            }
-            if (input == Currency::CurrencyBBD)
-            {
-                output = Json::Value("BBD");
-                return;
-            }
-            if (input == Currency::CurrencyBDT)
-            {
-                output = Json::Value("BDT");
-                return;
-            }
-            if (input == Currency::CurrencyBGN)
-            {
-                output = Json::Value("BGN");
-                return;
-            }
-            if (input == Currency::CurrencyBHD)
-            {
-                output = Json::Value("BHD");
-                return;
-            }
-            if (input == Currency::CurrencyBIF)
-            {
-                output = Json::Value("BIF");
-                return;
-            }
-            if (input == Currency::CurrencyBMD)
-            {
-                output = Json::Value("BMD");
-                return;
-            }
-            if (input == Currency::CurrencyBND)
-            {
-                output = Json::Value("BND");
-                return;
-            }
-            if (input == Currency::CurrencyBOB)
-            {
-                output = Json::Value("BOB");
-                return;
-            }
-            if (input == Currency::CurrencyBRL)
-            {
-                output = Json::Value("BRL");
-                return;
-            }
-            if (input == Currency::CurrencyBSD)
-            {
-                output = Json::Value("BSD");
-                return;
-            }
-            if (input == Currency::CurrencyBTN)
-            {
-                output = Json::Value("BTN");
-                return;
-            }
-            if (input == Currency::CurrencyBWP)
-            {
-                output = Json::Value("BWP");
-                return;
-            }
-            if (input == Currency::CurrencyBYR)
-            {
-                output = Json::Value("BYR");
-                return;
-            }
-            if (input == Currency::CurrencyBZD)
-            {
-                output = Json::Value("BZD");
-                return;
-            }
-            if (input == Currency::CurrencyCAD)
-            {
-                output = Json::Value("CAD");
-                return;
-            }
-            if (input == Currency::CurrencyCDF)
-            {
-                output = Json::Value("CDF");
-                return;
-            }
-            if (input == Currency::CurrencyCHF)
-            {
-                output = Json::Value("CHF");
-                return;
-            }
-            if (input == Currency::CurrencyCLP)
-            {
-                output = Json::Value("CLP");
-                return;
-            }
-            if (input == Currency::CurrencyCNY)
-            {
-                output = Json::Value("CNY");
-                return;
-            }
-            if (input == Currency::CurrencyCOP)
-            {
-                output = Json::Value("COP");
-                return;
-            }
-            if (input == Currency::CurrencyCRC)
-            {
-                output = Json::Value("CRC");
-                return;
-            }
-            if (input == Currency::CurrencyCUC)
-            {
-                output = Json::Value("CUC");
-                return;
-            }
-            if (input == Currency::CurrencyCUP)
-            {
-                output = Json::Value("CUP");
-                return;
-            }
-            if (input == Currency::CurrencyCVE)
-            {
-                output = Json::Value("CVE");
-                return;
-            }
-            if (input == Currency::CurrencyCZK)
-            {
-                output = Json::Value("CZK");
-                return;
-            }
-            if (input == Currency::CurrencyDJF)
-            {
-                output = Json::Value("DJF");
-                return;
-            }
-            if (input == Currency::CurrencyDKK)
-            {
-                output = Json::Value("DKK");
-                return;
-            }
-            if (input == Currency::CurrencyDOP)
-            {
-                output = Json::Value("DOP");
-                return;
-            }
-            if (input == Currency::CurrencyDZD)
-            {
-                output = Json::Value("DZD");
-                return;
-            }
-            if (input == Currency::CurrencyEGP)
-            {
-                output = Json::Value("EGP");
-                return;
-            }
-            if (input == Currency::CurrencyERN)
-            {
-                output = Json::Value("ERN");
-                return;
-            }
-            if (input == Currency::CurrencyETB)
-            {
-                output = Json::Value("ETB");
-                return;
-            }
-            if (input == Currency::CurrencyEUR)
-            {
-                output = Json::Value("EUR");
-                return;
-            }
-            if (input == Currency::CurrencyFJD)
-            {
-                output = Json::Value("FJD");
-                return;
-            }
-            if (input == Currency::CurrencyFKP)
-            {
-                output = Json::Value("FKP");
-                return;
-            }
-            if (input == Currency::CurrencyGBP)
-            {
-                output = Json::Value("GBP");
-                return;
-            }
-            if (input == Currency::CurrencyGEL)
-            {
-                output = Json::Value("GEL");
-                return;
-            }
-            if (input == Currency::CurrencyGGP)
-            {
-                output = Json::Value("GGP");
-                return;
-            }
-            if (input == Currency::CurrencyGHS)
-            {
-                output = Json::Value("GHS");
-                return;
-            }
-            if (input == Currency::CurrencyGIP)
-            {
-                output = Json::Value("GIP");
-                return;
-            }
-            if (input == Currency::CurrencyGMD)
-            {
-                output = Json::Value("GMD");
-                return;
-            }
-            if (input == Currency::CurrencyGNF)
-            {
-                output = Json::Value("GNF");
-                return;
-            }
-            if (input == Currency::CurrencyGTQ)
-            {
-                output = Json::Value("GTQ");
-                return;
-            }
-            if (input == Currency::CurrencyGYD)
-            {
-                output = Json::Value("GYD");
-                return;
-            }
-            if (input == Currency::CurrencyHKD)
-            {
-                output = Json::Value("HKD");
-                return;
-            }
-            if (input == Currency::CurrencyHNL)
-            {
-                output = Json::Value("HNL");
-                return;
-            }
-            if (input == Currency::CurrencyHRK)
-            {
-                output = Json::Value("HRK");
-                return;
-            }
-            if (input == Currency::CurrencyHTG)
-            {
-                output = Json::Value("HTG");
-                return;
-            }
-            if (input == Currency::CurrencyHUF)
-            {
-                output = Json::Value("HUF");
-                return;
-            }
-            if (input == Currency::CurrencyIDR)
-            {
-                output = Json::Value("IDR");
-                return;
-            }
-            if (input == Currency::CurrencyILS)
-            {
-                output = Json::Value("ILS");
-                return;
-            }
-            if (input == Currency::CurrencyIMP)
-            {
-                output = Json::Value("IMP");
-                return;
-            }
-            if (input == Currency::CurrencyINR)
-            {
-                output = Json::Value("INR");
-                return;
-            }
-            if (input == Currency::CurrencyIQD)
-            {
-                output = Json::Value("IQD");
-                return;
-            }
-            if (input == Currency::CurrencyIRR)
-            {
-                output = Json::Value("IRR");
-                return;
-            }
-            if (input == Currency::CurrencyISK)
-            {
-                output = Json::Value("ISK");
-                return;
-            }
-            if (input == Currency::CurrencyJEP)
-            {
-                output = Json::Value("JEP");
-                return;
-            }
-            if (input == Currency::CurrencyJMD)
-            {
-                output = Json::Value("JMD");
-                return;
-            }
-            if (input == Currency::CurrencyJOD)
-            {
-                output = Json::Value("JOD");
-                return;
-            }
-            if (input == Currency::CurrencyJPY)
-            {
-                output = Json::Value("JPY");
-                return;
-            }
-            if (input == Currency::CurrencyKES)
-            {
-                output = Json::Value("KES");
-                return;
-            }
-            if (input == Currency::CurrencyKGS)
-            {
-                output = Json::Value("KGS");
-                return;
-            }
-            if (input == Currency::CurrencyKHR)
-            {
-                output = Json::Value("KHR");
-                return;
-            }
-            if (input == Currency::CurrencyKMF)
-            {
-                output = Json::Value("KMF");
-                return;
-            }
-            if (input == Currency::CurrencyKPW)
-            {
-                output = Json::Value("KPW");
-                return;
-            }
-            if (input == Currency::CurrencyKRW)
-            {
-                output = Json::Value("KRW");
-                return;
-            }
-            if (input == Currency::CurrencyKWD)
-            {
-                output = Json::Value("KWD");
-                return;
-            }
-            if (input == Currency::CurrencyKYD)
-            {
-                output = Json::Value("KYD");
-                return;
-            }
-            if (input == Currency::CurrencyKZT)
-            {
-                output = Json::Value("KZT");
-                return;
-            }
-            if (input == Currency::CurrencyLAK)
-            {
-                output = Json::Value("LAK");
-                return;
-            }
-            if (input == Currency::CurrencyLBP)
-            {
-                output = Json::Value("LBP");
-                return;
-            }
-            if (input == Currency::CurrencyLKR)
-            {
-                output = Json::Value("LKR");
-                return;
-            }
-            if (input == Currency::CurrencyLRD)
-            {
-                output = Json::Value("LRD");
-                return;
-            }
-            if (input == Currency::CurrencyLSL)
-            {
-                output = Json::Value("LSL");
-                return;
-            }
-            if (input == Currency::CurrencyLYD)
-            {
-                output = Json::Value("LYD");
-                return;
-            }
-            if (input == Currency::CurrencyMAD)
-            {
-                output = Json::Value("MAD");
-                return;
-            }
-            if (input == Currency::CurrencyMDL)
-            {
-                output = Json::Value("MDL");
-                return;
-            }
-            if (input == Currency::CurrencyMGA)
-            {
-                output = Json::Value("MGA");
-                return;
-            }
-            if (input == Currency::CurrencyMKD)
-            {
-                output = Json::Value("MKD");
-                return;
-            }
-            if (input == Currency::CurrencyMMK)
-            {
-                output = Json::Value("MMK");
-                return;
-            }
-            if (input == Currency::CurrencyMNT)
-            {
-                output = Json::Value("MNT");
-                return;
-            }
-            if (input == Currency::CurrencyMOP)
-            {
-                output = Json::Value("MOP");
-                return;
-            }
-            if (input == Currency::CurrencyMRO)
-            {
-                output = Json::Value("MRO");
-                return;
-            }
-            if (input == Currency::CurrencyMUR)
-            {
-                output = Json::Value("MUR");
-                return;
-            }
-            if (input == Currency::CurrencyMVR)
-            {
-                output = Json::Value("MVR");
-                return;
-            }
-            if (input == Currency::CurrencyMWK)
-            {
-                output = Json::Value("MWK");
-                return;
-            }
-            if (input == Currency::CurrencyMXN)
-            {
-                output = Json::Value("MXN");
-                return;
-            }
-            if (input == Currency::CurrencyMYR)
-            {
-                output = Json::Value("MYR");
-                return;
-            }
-            if (input == Currency::CurrencyMZN)
-            {
-                output = Json::Value("MZN");
-                return;
-            }
-            if (input == Currency::CurrencyNAD)
-            {
-                output = Json::Value("NAD");
-                return;
-            }
-            if (input == Currency::CurrencyNGN)
-            {
-                output = Json::Value("NGN");
-                return;
-            }
-            if (input == Currency::CurrencyNIO)
-            {
-                output = Json::Value("NIO");
-                return;
-            }
-            if (input == Currency::CurrencyNOK)
-            {
-                output = Json::Value("NOK");
-                return;
-            }
-            if (input == Currency::CurrencyNPR)
-            {
-                output = Json::Value("NPR");
-                return;
-            }
-            if (input == Currency::CurrencyNZD)
-            {
-                output = Json::Value("NZD");
-                return;
-            }
-            if (input == Currency::CurrencyOMR)
-            {
-                output = Json::Value("OMR");
-                return;
-            }
-            if (input == Currency::CurrencyPAB)
-            {
-                output = Json::Value("PAB");
-                return;
-            }
-            if (input == Currency::CurrencyPEN)
-            {
-                output = Json::Value("PEN");
-                return;
-            }
-            if (input == Currency::CurrencyPGK)
-            {
-                output = Json::Value("PGK");
-                return;
-            }
-            if (input == Currency::CurrencyPHP)
-            {
-                output = Json::Value("PHP");
-                return;
-            }
-            if (input == Currency::CurrencyPKR)
-            {
-                output = Json::Value("PKR");
-                return;
-            }
-            if (input == Currency::CurrencyPLN)
-            {
-                output = Json::Value("PLN");
-                return;
-            }
-            if (input == Currency::CurrencyPYG)
-            {
-                output = Json::Value("PYG");
-                return;
-            }
-            if (input == Currency::CurrencyQAR)
-            {
-                output = Json::Value("QAR");
-                return;
-            }
-            if (input == Currency::CurrencyRON)
-            {
-                output = Json::Value("RON");
-                return;
-            }
-            if (input == Currency::CurrencyRSD)
-            {
-                output = Json::Value("RSD");
-                return;
-            }
-            if (input == Currency::CurrencyRUB)
-            {
-                output = Json::Value("RUB");
-                return;
-            }
-            if (input == Currency::CurrencyRWF)
-            {
-                output = Json::Value("RWF");
-                return;
-            }
-            if (input == Currency::CurrencySAR)
-            {
-                output = Json::Value("SAR");
-                return;
-            }
-            if (input == Currency::CurrencySBD)
-            {
-                output = Json::Value("SBD");
-                return;
-            }
-            if (input == Currency::CurrencySCR)
-            {
-                output = Json::Value("SCR");
-                return;
-            }
-            if (input == Currency::CurrencySDG)
-            {
-                output = Json::Value("SDG");
-                return;
-            }
-            if (input == Currency::CurrencySEK)
-            {
-                output = Json::Value("SEK");
-                return;
-            }
-            if (input == Currency::CurrencySGD)
-            {
-                output = Json::Value("SGD");
-                return;
-            }
-            if (input == Currency::CurrencySHP)
-            {
-                output = Json::Value("SHP");
-                return;
-            }
-            if (input == Currency::CurrencySLL)
-            {
-                output = Json::Value("SLL");
-                return;
-            }
-            if (input == Currency::CurrencySOS)
-            {
-                output = Json::Value("SOS");
-                return;
-            }
-            if (input == Currency::CurrencySPL)
-            {
-                output = Json::Value("SPL");
-                return;
-            }
-            if (input == Currency::CurrencySRD)
-            {
-                output = Json::Value("SRD");
-                return;
-            }
-            if (input == Currency::CurrencySTD)
-            {
-                output = Json::Value("STD");
-                return;
-            }
-            if (input == Currency::CurrencySVC)
-            {
-                output = Json::Value("SVC");
-                return;
-            }
-            if (input == Currency::CurrencySYP)
-            {
-                output = Json::Value("SYP");
-                return;
-            }
-            if (input == Currency::CurrencySZL)
-            {
-                output = Json::Value("SZL");
-                return;
-            }
-            if (input == Currency::CurrencyTHB)
-            {
-                output = Json::Value("THB");
-                return;
-            }
-            if (input == Currency::CurrencyTJS)
-            {
-                output = Json::Value("TJS");
-                return;
-            }
-            if (input == Currency::CurrencyTMT)
-            {
-                output = Json::Value("TMT");
-                return;
-            }
-            if (input == Currency::CurrencyTND)
-            {
-                output = Json::Value("TND");
-                return;
-            }
-            if (input == Currency::CurrencyTOP)
-            {
-                output = Json::Value("TOP");
-                return;
-            }
-            if (input == Currency::CurrencyTRY)
-            {
-                output = Json::Value("TRY");
-                return;
-            }
-            if (input == Currency::CurrencyTTD)
-            {
-                output = Json::Value("TTD");
-                return;
-            }
-            if (input == Currency::CurrencyTVD)
-            {
-                output = Json::Value("TVD");
-                return;
-            }
-            if (input == Currency::CurrencyTWD)
-            {
-                output = Json::Value("TWD");
-                return;
-            }
-            if (input == Currency::CurrencyTZS)
-            {
-                output = Json::Value("TZS");
-                return;
-            }
-            if (input == Currency::CurrencyUAH)
-            {
-                output = Json::Value("UAH");
-                return;
-            }
-            if (input == Currency::CurrencyUGX)
-            {
-                output = Json::Value("UGX");
-                return;
-            }
-            if (input == Currency::CurrencyUSD)
-            {
-                output = Json::Value("USD");
-                return;
-            }
-            if (input == Currency::CurrencyUYU)
-            {
-                output = Json::Value("UYU");
-                return;
-            }
-            if (input == Currency::CurrencyUZS)
-            {
-                output = Json::Value("UZS");
-                return;
-            }
-            if (input == Currency::CurrencyVEF)
-            {
-                output = Json::Value("VEF");
-                return;
-            }
-            if (input == Currency::CurrencyVND)
-            {
-                output = Json::Value("VND");
-                return;
-            }
-            if (input == Currency::CurrencyVUV)
-            {
-                output = Json::Value("VUV");
-                return;
-            }
-            if (input == Currency::CurrencyWST)
-            {
-                output = Json::Value("WST");
-                return;
-            }
-            if (input == Currency::CurrencyXAF)
-            {
-                output = Json::Value("XAF");
-                return;
-            }
-            if (input == Currency::CurrencyXCD)
-            {
-                output = Json::Value("XCD");
-                return;
-            }
-            if (input == Currency::CurrencyXDR)
-            {
-                output = Json::Value("XDR");
-                return;
-            }
-            if (input == Currency::CurrencyXOF)
-            {
-                output = Json::Value("XOF");
-                return;
-            }
-            if (input == Currency::CurrencyXPF)
-            {
-                output = Json::Value("XPF");
-                return;
-            }
-            if (input == Currency::CurrencyYER)
-            {
-                output = Json::Value("YER");
-                return;
-            }
-            if (input == Currency::CurrencyZAR)
-            {
-                output = Json::Value("ZAR");
-                return;
-            }
-            if (input == Currency::CurrencyZMW)
-            {
-                output = Json::Value("ZMW");
-                return;
-            }
-            if (input == Currency::CurrencyZWD)
-            {
-                output = Json::Value("ZWD");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, Currency& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "AED")
-            {
-                output = Currency::CurrencyAED;
-                return;
-            }
-            if (inputStr == "AFN")
-            {
-                output = Currency::CurrencyAFN;
-                return;
-            }
-            if (inputStr == "ALL")
-            {
-                output = Currency::CurrencyALL;
-                return;
-            }
-            if (inputStr == "AMD")
-            {
-                output = Currency::CurrencyAMD;
-                return;
-            }
-            if (inputStr == "ANG")
-            {
-                output = Currency::CurrencyANG;
-                return;
-            }
-            if (inputStr == "AOA")
-            {
-                output = Currency::CurrencyAOA;
-                return;
-            }
-            if (inputStr == "ARS")
-            {
-                output = Currency::CurrencyARS;
-                return;
-            }
-            if (inputStr == "AUD")
-            {
-                output = Currency::CurrencyAUD;
-                return;
-            }
-            if (inputStr == "AWG")
-            {
-                output = Currency::CurrencyAWG;
-                return;
-            }
-            if (inputStr == "AZN")
-            {
-                output = Currency::CurrencyAZN;
-                return;
-            }
-            if (inputStr == "BAM")
-            {
-                output = Currency::CurrencyBAM;
-                return;
-            }
-            if (inputStr == "BBD")
-            {
-                output = Currency::CurrencyBBD;
-                return;
-            }
-            if (inputStr == "BDT")
-            {
-                output = Currency::CurrencyBDT;
-                return;
-            }
-            if (inputStr == "BGN")
-            {
-                output = Currency::CurrencyBGN;
-                return;
-            }
-            if (inputStr == "BHD")
-            {
-                output = Currency::CurrencyBHD;
-                return;
-            }
-            if (inputStr == "BIF")
-            {
-                output = Currency::CurrencyBIF;
-                return;
-            }
-            if (inputStr == "BMD")
-            {
-                output = Currency::CurrencyBMD;
-                return;
-            }
-            if (inputStr == "BND")
-            {
-                output = Currency::CurrencyBND;
-                return;
-            }
-            if (inputStr == "BOB")
-            {
-                output = Currency::CurrencyBOB;
-                return;
-            }
-            if (inputStr == "BRL")
-            {
-                output = Currency::CurrencyBRL;
-                return;
-            }
-            if (inputStr == "BSD")
-            {
-                output = Currency::CurrencyBSD;
-                return;
-            }
-            if (inputStr == "BTN")
-            {
-                output = Currency::CurrencyBTN;
-                return;
-            }
-            if (inputStr == "BWP")
-            {
-                output = Currency::CurrencyBWP;
-                return;
-            }
-            if (inputStr == "BYR")
-            {
-                output = Currency::CurrencyBYR;
-                return;
-            }
-            if (inputStr == "BZD")
-            {
-                output = Currency::CurrencyBZD;
-                return;
-            }
-            if (inputStr == "CAD")
-            {
-                output = Currency::CurrencyCAD;
-                return;
-            }
-            if (inputStr == "CDF")
-            {
-                output = Currency::CurrencyCDF;
-                return;
-            }
-            if (inputStr == "CHF")
-            {
-                output = Currency::CurrencyCHF;
-                return;
-            }
-            if (inputStr == "CLP")
-            {
-                output = Currency::CurrencyCLP;
-                return;
-            }
-            if (inputStr == "CNY")
-            {
-                output = Currency::CurrencyCNY;
-                return;
-            }
-            if (inputStr == "COP")
-            {
-                output = Currency::CurrencyCOP;
-                return;
-            }
-            if (inputStr == "CRC")
-            {
-                output = Currency::CurrencyCRC;
-                return;
-            }
-            if (inputStr == "CUC")
-            {
-                output = Currency::CurrencyCUC;
-                return;
-            }
-            if (inputStr == "CUP")
-            {
-                output = Currency::CurrencyCUP;
-                return;
-            }
-            if (inputStr == "CVE")
-            {
-                output = Currency::CurrencyCVE;
-                return;
-            }
-            if (inputStr == "CZK")
-            {
-                output = Currency::CurrencyCZK;
-                return;
-            }
-            if (inputStr == "DJF")
-            {
-                output = Currency::CurrencyDJF;
-                return;
-            }
-            if (inputStr == "DKK")
-            {
-                output = Currency::CurrencyDKK;
-                return;
-            }
-            if (inputStr == "DOP")
-            {
-                output = Currency::CurrencyDOP;
-                return;
-            }
-            if (inputStr == "DZD")
-            {
-                output = Currency::CurrencyDZD;
-                return;
-            }
-            if (inputStr == "EGP")
-            {
-                output = Currency::CurrencyEGP;
-                return;
-            }
-            if (inputStr == "ERN")
-            {
-                output = Currency::CurrencyERN;
-                return;
-            }
-            if (inputStr == "ETB")
-            {
-                output = Currency::CurrencyETB;
-                return;
-            }
-            if (inputStr == "EUR")
-            {
-                output = Currency::CurrencyEUR;
-                return;
-            }
-            if (inputStr == "FJD")
-            {
-                output = Currency::CurrencyFJD;
-                return;
-            }
-            if (inputStr == "FKP")
-            {
-                output = Currency::CurrencyFKP;
-                return;
-            }
-            if (inputStr == "GBP")
-            {
-                output = Currency::CurrencyGBP;
-                return;
-            }
-            if (inputStr == "GEL")
-            {
-                output = Currency::CurrencyGEL;
-                return;
-            }
-            if (inputStr == "GGP")
-            {
-                output = Currency::CurrencyGGP;
-                return;
-            }
-            if (inputStr == "GHS")
-            {
-                output = Currency::CurrencyGHS;
-                return;
-            }
-            if (inputStr == "GIP")
-            {
-                output = Currency::CurrencyGIP;
-                return;
-            }
-            if (inputStr == "GMD")
-            {
-                output = Currency::CurrencyGMD;
-                return;
-            }
-            if (inputStr == "GNF")
-            {
-                output = Currency::CurrencyGNF;
-                return;
-            }
-            if (inputStr == "GTQ")
-            {
-                output = Currency::CurrencyGTQ;
-                return;
-            }
-            if (inputStr == "GYD")
-            {
-                output = Currency::CurrencyGYD;
-                return;
-            }
-            if (inputStr == "HKD")
-            {
-                output = Currency::CurrencyHKD;
-                return;
-            }
-            if (inputStr == "HNL")
-            {
-                output = Currency::CurrencyHNL;
-                return;
-            }
-            if (inputStr == "HRK")
-            {
-                output = Currency::CurrencyHRK;
-                return;
-            }
-            if (inputStr == "HTG")
-            {
-                output = Currency::CurrencyHTG;
-                return;
-            }
-            if (inputStr == "HUF")
-            {
-                output = Currency::CurrencyHUF;
-                return;
-            }
-            if (inputStr == "IDR")
-            {
-                output = Currency::CurrencyIDR;
-                return;
-            }
-            if (inputStr == "ILS")
-            {
-                output = Currency::CurrencyILS;
-                return;
-            }
-            if (inputStr == "IMP")
-            {
-                output = Currency::CurrencyIMP;
-                return;
-            }
-            if (inputStr == "INR")
-            {
-                output = Currency::CurrencyINR;
-                return;
-            }
-            if (inputStr == "IQD")
-            {
-                output = Currency::CurrencyIQD;
-                return;
-            }
-            if (inputStr == "IRR")
-            {
-                output = Currency::CurrencyIRR;
-                return;
-            }
-            if (inputStr == "ISK")
-            {
-                output = Currency::CurrencyISK;
-                return;
-            }
-            if (inputStr == "JEP")
-            {
-                output = Currency::CurrencyJEP;
-                return;
-            }
-            if (inputStr == "JMD")
-            {
-                output = Currency::CurrencyJMD;
-                return;
-            }
-            if (inputStr == "JOD")
-            {
-                output = Currency::CurrencyJOD;
-                return;
-            }
-            if (inputStr == "JPY")
-            {
-                output = Currency::CurrencyJPY;
-                return;
-            }
-            if (inputStr == "KES")
-            {
-                output = Currency::CurrencyKES;
-                return;
-            }
-            if (inputStr == "KGS")
-            {
-                output = Currency::CurrencyKGS;
-                return;
-            }
-            if (inputStr == "KHR")
-            {
-                output = Currency::CurrencyKHR;
-                return;
-            }
-            if (inputStr == "KMF")
-            {
-                output = Currency::CurrencyKMF;
-                return;
-            }
-            if (inputStr == "KPW")
-            {
-                output = Currency::CurrencyKPW;
-                return;
-            }
-            if (inputStr == "KRW")
-            {
-                output = Currency::CurrencyKRW;
-                return;
-            }
-            if (inputStr == "KWD")
-            {
-                output = Currency::CurrencyKWD;
-                return;
-            }
-            if (inputStr == "KYD")
-            {
-                output = Currency::CurrencyKYD;
-                return;
-            }
-            if (inputStr == "KZT")
-            {
-                output = Currency::CurrencyKZT;
-                return;
-            }
-            if (inputStr == "LAK")
-            {
-                output = Currency::CurrencyLAK;
-                return;
-            }
-            if (inputStr == "LBP")
-            {
-                output = Currency::CurrencyLBP;
-                return;
-            }
-            if (inputStr == "LKR")
-            {
-                output = Currency::CurrencyLKR;
-                return;
-            }
-            if (inputStr == "LRD")
-            {
-                output = Currency::CurrencyLRD;
-                return;
-            }
-            if (inputStr == "LSL")
-            {
-                output = Currency::CurrencyLSL;
-                return;
-            }
-            if (inputStr == "LYD")
-            {
-                output = Currency::CurrencyLYD;
-                return;
-            }
-            if (inputStr == "MAD")
-            {
-                output = Currency::CurrencyMAD;
-                return;
-            }
-            if (inputStr == "MDL")
-            {
-                output = Currency::CurrencyMDL;
-                return;
-            }
-            if (inputStr == "MGA")
-            {
-                output = Currency::CurrencyMGA;
-                return;
-            }
-            if (inputStr == "MKD")
-            {
-                output = Currency::CurrencyMKD;
-                return;
-            }
-            if (inputStr == "MMK")
-            {
-                output = Currency::CurrencyMMK;
-                return;
-            }
-            if (inputStr == "MNT")
-            {
-                output = Currency::CurrencyMNT;
-                return;
-            }
-            if (inputStr == "MOP")
-            {
-                output = Currency::CurrencyMOP;
-                return;
-            }
-            if (inputStr == "MRO")
-            {
-                output = Currency::CurrencyMRO;
-                return;
-            }
-            if (inputStr == "MUR")
-            {
-                output = Currency::CurrencyMUR;
-                return;
-            }
-            if (inputStr == "MVR")
-            {
-                output = Currency::CurrencyMVR;
-                return;
-            }
-            if (inputStr == "MWK")
-            {
-                output = Currency::CurrencyMWK;
-                return;
-            }
-            if (inputStr == "MXN")
-            {
-                output = Currency::CurrencyMXN;
-                return;
-            }
-            if (inputStr == "MYR")
-            {
-                output = Currency::CurrencyMYR;
-                return;
-            }
-            if (inputStr == "MZN")
-            {
-                output = Currency::CurrencyMZN;
-                return;
-            }
-            if (inputStr == "NAD")
-            {
-                output = Currency::CurrencyNAD;
-                return;
-            }
-            if (inputStr == "NGN")
-            {
-                output = Currency::CurrencyNGN;
-                return;
-            }
-            if (inputStr == "NIO")
-            {
-                output = Currency::CurrencyNIO;
-                return;
-            }
-            if (inputStr == "NOK")
-            {
-                output = Currency::CurrencyNOK;
-                return;
-            }
-            if (inputStr == "NPR")
-            {
-                output = Currency::CurrencyNPR;
-                return;
-            }
-            if (inputStr == "NZD")
-            {
-                output = Currency::CurrencyNZD;
-                return;
-            }
-            if (inputStr == "OMR")
-            {
-                output = Currency::CurrencyOMR;
-                return;
-            }
-            if (inputStr == "PAB")
-            {
-                output = Currency::CurrencyPAB;
-                return;
-            }
-            if (inputStr == "PEN")
-            {
-                output = Currency::CurrencyPEN;
-                return;
-            }
-            if (inputStr == "PGK")
-            {
-                output = Currency::CurrencyPGK;
-                return;
-            }
-            if (inputStr == "PHP")
-            {
-                output = Currency::CurrencyPHP;
-                return;
-            }
-            if (inputStr == "PKR")
-            {
-                output = Currency::CurrencyPKR;
-                return;
-            }
-            if (inputStr == "PLN")
-            {
-                output = Currency::CurrencyPLN;
-                return;
-            }
-            if (inputStr == "PYG")
-            {
-                output = Currency::CurrencyPYG;
-                return;
-            }
-            if (inputStr == "QAR")
-            {
-                output = Currency::CurrencyQAR;
-                return;
-            }
-            if (inputStr == "RON")
-            {
-                output = Currency::CurrencyRON;
-                return;
-            }
-            if (inputStr == "RSD")
-            {
-                output = Currency::CurrencyRSD;
-                return;
-            }
-            if (inputStr == "RUB")
-            {
-                output = Currency::CurrencyRUB;
-                return;
-            }
-            if (inputStr == "RWF")
-            {
-                output = Currency::CurrencyRWF;
-                return;
-            }
-            if (inputStr == "SAR")
-            {
-                output = Currency::CurrencySAR;
-                return;
-            }
-            if (inputStr == "SBD")
-            {
-                output = Currency::CurrencySBD;
-                return;
-            }
-            if (inputStr == "SCR")
-            {
-                output = Currency::CurrencySCR;
-                return;
-            }
-            if (inputStr == "SDG")
-            {
-                output = Currency::CurrencySDG;
-                return;
-            }
-            if (inputStr == "SEK")
-            {
-                output = Currency::CurrencySEK;
-                return;
-            }
-            if (inputStr == "SGD")
-            {
-                output = Currency::CurrencySGD;
-                return;
-            }
-            if (inputStr == "SHP")
-            {
-                output = Currency::CurrencySHP;
-                return;
-            }
-            if (inputStr == "SLL")
-            {
-                output = Currency::CurrencySLL;
-                return;
-            }
-            if (inputStr == "SOS")
-            {
-                output = Currency::CurrencySOS;
-                return;
-            }
-            if (inputStr == "SPL")
-            {
-                output = Currency::CurrencySPL;
-                return;
-            }
-            if (inputStr == "SRD")
-            {
-                output = Currency::CurrencySRD;
-                return;
-            }
-            if (inputStr == "STD")
-            {
-                output = Currency::CurrencySTD;
-                return;
-            }
-            if (inputStr == "SVC")
-            {
-                output = Currency::CurrencySVC;
-                return;
-            }
-            if (inputStr == "SYP")
-            {
-                output = Currency::CurrencySYP;
-                return;
-            }
-            if (inputStr == "SZL")
-            {
-                output = Currency::CurrencySZL;
-                return;
-            }
-            if (inputStr == "THB")
-            {
-                output = Currency::CurrencyTHB;
-                return;
-            }
-            if (inputStr == "TJS")
-            {
-                output = Currency::CurrencyTJS;
-                return;
-            }
-            if (inputStr == "TMT")
-            {
-                output = Currency::CurrencyTMT;
-                return;
-            }
-            if (inputStr == "TND")
-            {
-                output = Currency::CurrencyTND;
-                return;
-            }
-            if (inputStr == "TOP")
-            {
-                output = Currency::CurrencyTOP;
-                return;
-            }
-            if (inputStr == "TRY")
-            {
-                output = Currency::CurrencyTRY;
-                return;
-            }
-            if (inputStr == "TTD")
-            {
-                output = Currency::CurrencyTTD;
-                return;
-            }
-            if (inputStr == "TVD")
-            {
-                output = Currency::CurrencyTVD;
-                return;
-            }
-            if (inputStr == "TWD")
-            {
-                output = Currency::CurrencyTWD;
-                return;
-            }
-            if (inputStr == "TZS")
-            {
-                output = Currency::CurrencyTZS;
-                return;
-            }
-            if (inputStr == "UAH")
-            {
-                output = Currency::CurrencyUAH;
-                return;
-            }
-            if (inputStr == "UGX")
-            {
-                output = Currency::CurrencyUGX;
-                return;
-            }
-            if (inputStr == "USD")
-            {
-                output = Currency::CurrencyUSD;
-                return;
-            }
-            if (inputStr == "UYU")
-            {
-                output = Currency::CurrencyUYU;
-                return;
-            }
-            if (inputStr == "UZS")
-            {
-                output = Currency::CurrencyUZS;
-                return;
-            }
-            if (inputStr == "VEF")
-            {
-                output = Currency::CurrencyVEF;
-                return;
-            }
-            if (inputStr == "VND")
-            {
-                output = Currency::CurrencyVND;
-                return;
-            }
-            if (inputStr == "VUV")
-            {
-                output = Currency::CurrencyVUV;
-                return;
-            }
-            if (inputStr == "WST")
-            {
-                output = Currency::CurrencyWST;
-                return;
-            }
-            if (inputStr == "XAF")
-            {
-                output = Currency::CurrencyXAF;
-                return;
-            }
-            if (inputStr == "XCD")
-            {
-                output = Currency::CurrencyXCD;
-                return;
-            }
-            if (inputStr == "XDR")
-            {
-                output = Currency::CurrencyXDR;
-                return;
-            }
-            if (inputStr == "XOF")
-            {
-                output = Currency::CurrencyXOF;
-                return;
-            }
-            if (inputStr == "XPF")
-            {
-                output = Currency::CurrencyXPF;
-                return;
-            }
-            if (inputStr == "YER")
-            {
-                output = Currency::CurrencyYER;
-                return;
-            }
-            if (inputStr == "ZAR")
-            {
-                output = Currency::CurrencyZAR;
-                return;
-            }
-            if (inputStr == "ZMW")
-            {
-                output = Currency::CurrencyZMW;
-                return;
-            }
-            if (inputStr == "ZWD")
-            {
-                output = Currency::CurrencyZWD;
-                return;
-            }
-        }
+        void ToJsonEnum(const Currency input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, Currency& output);
 
         enum class EmailVerificationStatus
         {
@@ -4772,47 +478,8 @@ namespace PlayFab
             EmailVerificationStatusConfirmed
         };
 
-        inline void ToJsonEnum(const EmailVerificationStatus input, Json::Value& output)
-        {
-            if (input == EmailVerificationStatus::EmailVerificationStatusUnverified)
-            {
-                output = Json::Value("Unverified");
-                return;
-            }
-            if (input == EmailVerificationStatus::EmailVerificationStatusPending)
-            {
-                output = Json::Value("Pending");
-                return;
-            }
-            if (input == EmailVerificationStatus::EmailVerificationStatusConfirmed)
-            {
-                output = Json::Value("Confirmed");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, EmailVerificationStatus& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "Unverified")
-            {
-                output = EmailVerificationStatus::EmailVerificationStatusUnverified;
-                return;
-            }
-            if (inputStr == "Pending")
-            {
-                output = EmailVerificationStatus::EmailVerificationStatusPending;
-                return;
-            }
-            if (inputStr == "Confirmed")
-            {
-                output = EmailVerificationStatus::EmailVerificationStatusConfirmed;
-                return;
-            }
-        }
+        void ToJsonEnum(const EmailVerificationStatus input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, EmailVerificationStatus& output);
 
         enum class GameInstanceState
         {
@@ -4820,37 +487,8 @@ namespace PlayFab
             GameInstanceStateClosed
         };
 
-        inline void ToJsonEnum(const GameInstanceState input, Json::Value& output)
-        {
-            if (input == GameInstanceState::GameInstanceStateOpen)
-            {
-                output = Json::Value("Open");
-                return;
-            }
-            if (input == GameInstanceState::GameInstanceStateClosed)
-            {
-                output = Json::Value("Closed");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, GameInstanceState& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "Open")
-            {
-                output = GameInstanceState::GameInstanceStateOpen;
-                return;
-            }
-            if (inputStr == "Closed")
-            {
-                output = GameInstanceState::GameInstanceStateClosed;
-                return;
-            }
-        }
+        void ToJsonEnum(const GameInstanceState input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, GameInstanceState& output);
 
         enum class LoginIdentityProvider
         {
@@ -4877,227 +515,8 @@ namespace PlayFab
             LoginIdentityProviderNintendoSwitchAccount
         };
 
-        inline void ToJsonEnum(const LoginIdentityProvider input, Json::Value& output)
-        {
-            if (input == LoginIdentityProvider::LoginIdentityProviderUnknown)
-            {
-                output = Json::Value("Unknown");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderPlayFab)
-            {
-                output = Json::Value("PlayFab");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderCustom)
-            {
-                output = Json::Value("Custom");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderGameCenter)
-            {
-                output = Json::Value("GameCenter");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderGooglePlay)
-            {
-                output = Json::Value("GooglePlay");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderSteam)
-            {
-                output = Json::Value("Steam");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderXBoxLive)
-            {
-                output = Json::Value("XBoxLive");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderPSN)
-            {
-                output = Json::Value("PSN");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderKongregate)
-            {
-                output = Json::Value("Kongregate");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderFacebook)
-            {
-                output = Json::Value("Facebook");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderIOSDevice)
-            {
-                output = Json::Value("IOSDevice");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderAndroidDevice)
-            {
-                output = Json::Value("AndroidDevice");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderTwitch)
-            {
-                output = Json::Value("Twitch");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderWindowsHello)
-            {
-                output = Json::Value("WindowsHello");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderGameServer)
-            {
-                output = Json::Value("GameServer");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderCustomServer)
-            {
-                output = Json::Value("CustomServer");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderNintendoSwitch)
-            {
-                output = Json::Value("NintendoSwitch");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderFacebookInstantGames)
-            {
-                output = Json::Value("FacebookInstantGames");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderOpenIdConnect)
-            {
-                output = Json::Value("OpenIdConnect");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderApple)
-            {
-                output = Json::Value("Apple");
-                return;
-            }
-            if (input == LoginIdentityProvider::LoginIdentityProviderNintendoSwitchAccount)
-            {
-                output = Json::Value("NintendoSwitchAccount");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, LoginIdentityProvider& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "Unknown")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderUnknown;
-                return;
-            }
-            if (inputStr == "PlayFab")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderPlayFab;
-                return;
-            }
-            if (inputStr == "Custom")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderCustom;
-                return;
-            }
-            if (inputStr == "GameCenter")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderGameCenter;
-                return;
-            }
-            if (inputStr == "GooglePlay")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderGooglePlay;
-                return;
-            }
-            if (inputStr == "Steam")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderSteam;
-                return;
-            }
-            if (inputStr == "XBoxLive")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderXBoxLive;
-                return;
-            }
-            if (inputStr == "PSN")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderPSN;
-                return;
-            }
-            if (inputStr == "Kongregate")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderKongregate;
-                return;
-            }
-            if (inputStr == "Facebook")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderFacebook;
-                return;
-            }
-            if (inputStr == "IOSDevice")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderIOSDevice;
-                return;
-            }
-            if (inputStr == "AndroidDevice")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderAndroidDevice;
-                return;
-            }
-            if (inputStr == "Twitch")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderTwitch;
-                return;
-            }
-            if (inputStr == "WindowsHello")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderWindowsHello;
-                return;
-            }
-            if (inputStr == "GameServer")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderGameServer;
-                return;
-            }
-            if (inputStr == "CustomServer")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderCustomServer;
-                return;
-            }
-            if (inputStr == "NintendoSwitch")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderNintendoSwitch;
-                return;
-            }
-            if (inputStr == "FacebookInstantGames")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderFacebookInstantGames;
-                return;
-            }
-            if (inputStr == "OpenIdConnect")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderOpenIdConnect;
-                return;
-            }
-            if (inputStr == "Apple")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderApple;
-                return;
-            }
-            if (inputStr == "NintendoSwitchAccount")
-            {
-                output = LoginIdentityProvider::LoginIdentityProviderNintendoSwitchAccount;
-                return;
-            }
-        }
+        void ToJsonEnum(const LoginIdentityProvider input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, LoginIdentityProvider& output);
 
         enum class MatchmakeStatus
         {
@@ -5108,67 +527,8 @@ namespace PlayFab
             MatchmakeStatusSessionClosed
         };
 
-        inline void ToJsonEnum(const MatchmakeStatus input, Json::Value& output)
-        {
-            if (input == MatchmakeStatus::MatchmakeStatusComplete)
-            {
-                output = Json::Value("Complete");
-                return;
-            }
-            if (input == MatchmakeStatus::MatchmakeStatusWaiting)
-            {
-                output = Json::Value("Waiting");
-                return;
-            }
-            if (input == MatchmakeStatus::MatchmakeStatusGameNotFound)
-            {
-                output = Json::Value("GameNotFound");
-                return;
-            }
-            if (input == MatchmakeStatus::MatchmakeStatusNoAvailableSlots)
-            {
-                output = Json::Value("NoAvailableSlots");
-                return;
-            }
-            if (input == MatchmakeStatus::MatchmakeStatusSessionClosed)
-            {
-                output = Json::Value("SessionClosed");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, MatchmakeStatus& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "Complete")
-            {
-                output = MatchmakeStatus::MatchmakeStatusComplete;
-                return;
-            }
-            if (inputStr == "Waiting")
-            {
-                output = MatchmakeStatus::MatchmakeStatusWaiting;
-                return;
-            }
-            if (inputStr == "GameNotFound")
-            {
-                output = MatchmakeStatus::MatchmakeStatusGameNotFound;
-                return;
-            }
-            if (inputStr == "NoAvailableSlots")
-            {
-                output = MatchmakeStatus::MatchmakeStatusNoAvailableSlots;
-                return;
-            }
-            if (inputStr == "SessionClosed")
-            {
-                output = MatchmakeStatus::MatchmakeStatusSessionClosed;
-                return;
-            }
-        }
+        void ToJsonEnum(const MatchmakeStatus input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, MatchmakeStatus& output);
 
         enum class PushNotificationPlatform
         {
@@ -5176,37 +536,8 @@ namespace PlayFab
             PushNotificationPlatformGoogleCloudMessaging
         };
 
-        inline void ToJsonEnum(const PushNotificationPlatform input, Json::Value& output)
-        {
-            if (input == PushNotificationPlatform::PushNotificationPlatformApplePushNotificationService)
-            {
-                output = Json::Value("ApplePushNotificationService");
-                return;
-            }
-            if (input == PushNotificationPlatform::PushNotificationPlatformGoogleCloudMessaging)
-            {
-                output = Json::Value("GoogleCloudMessaging");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, PushNotificationPlatform& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "ApplePushNotificationService")
-            {
-                output = PushNotificationPlatform::PushNotificationPlatformApplePushNotificationService;
-                return;
-            }
-            if (inputStr == "GoogleCloudMessaging")
-            {
-                output = PushNotificationPlatform::PushNotificationPlatformGoogleCloudMessaging;
-                return;
-            }
-        }
+        void ToJsonEnum(const PushNotificationPlatform input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, PushNotificationPlatform& output);
 
         enum class Region
         {
@@ -5219,87 +550,8 @@ namespace PlayFab
             RegionAustralia
         };
 
-        inline void ToJsonEnum(const Region input, Json::Value& output)
-        {
-            if (input == Region::RegionUSCentral)
-            {
-                output = Json::Value("USCentral");
-                return;
-            }
-            if (input == Region::RegionUSEast)
-            {
-                output = Json::Value("USEast");
-                return;
-            }
-            if (input == Region::RegionEUWest)
-            {
-                output = Json::Value("EUWest");
-                return;
-            }
-            if (input == Region::RegionSingapore)
-            {
-                output = Json::Value("Singapore");
-                return;
-            }
-            if (input == Region::RegionJapan)
-            {
-                output = Json::Value("Japan");
-                return;
-            }
-            if (input == Region::RegionBrazil)
-            {
-                output = Json::Value("Brazil");
-                return;
-            }
-            if (input == Region::RegionAustralia)
-            {
-                output = Json::Value("Australia");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, Region& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "USCentral")
-            {
-                output = Region::RegionUSCentral;
-                return;
-            }
-            if (inputStr == "USEast")
-            {
-                output = Region::RegionUSEast;
-                return;
-            }
-            if (inputStr == "EUWest")
-            {
-                output = Region::RegionEUWest;
-                return;
-            }
-            if (inputStr == "Singapore")
-            {
-                output = Region::RegionSingapore;
-                return;
-            }
-            if (inputStr == "Japan")
-            {
-                output = Region::RegionJapan;
-                return;
-            }
-            if (inputStr == "Brazil")
-            {
-                output = Region::RegionBrazil;
-                return;
-            }
-            if (inputStr == "Australia")
-            {
-                output = Region::RegionAustralia;
-                return;
-            }
-        }
+        void ToJsonEnum(const Region input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, Region& output);
 
         enum class SourceType
         {
@@ -5312,87 +564,8 @@ namespace PlayFab
             SourceTypeAPI
         };
 
-        inline void ToJsonEnum(const SourceType input, Json::Value& output)
-        {
-            if (input == SourceType::SourceTypeAdmin)
-            {
-                output = Json::Value("Admin");
-                return;
-            }
-            if (input == SourceType::SourceTypeBackEnd)
-            {
-                output = Json::Value("BackEnd");
-                return;
-            }
-            if (input == SourceType::SourceTypeGameClient)
-            {
-                output = Json::Value("GameClient");
-                return;
-            }
-            if (input == SourceType::SourceTypeGameServer)
-            {
-                output = Json::Value("GameServer");
-                return;
-            }
-            if (input == SourceType::SourceTypePartner)
-            {
-                output = Json::Value("Partner");
-                return;
-            }
-            if (input == SourceType::SourceTypeCustom)
-            {
-                output = Json::Value("Custom");
-                return;
-            }
-            if (input == SourceType::SourceTypeAPI)
-            {
-                output = Json::Value("API");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, SourceType& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "Admin")
-            {
-                output = SourceType::SourceTypeAdmin;
-                return;
-            }
-            if (inputStr == "BackEnd")
-            {
-                output = SourceType::SourceTypeBackEnd;
-                return;
-            }
-            if (inputStr == "GameClient")
-            {
-                output = SourceType::SourceTypeGameClient;
-                return;
-            }
-            if (inputStr == "GameServer")
-            {
-                output = SourceType::SourceTypeGameServer;
-                return;
-            }
-            if (inputStr == "Partner")
-            {
-                output = SourceType::SourceTypePartner;
-                return;
-            }
-            if (inputStr == "Custom")
-            {
-                output = SourceType::SourceTypeCustom;
-                return;
-            }
-            if (inputStr == "API")
-            {
-                output = SourceType::SourceTypeAPI;
-                return;
-            }
-        }
+        void ToJsonEnum(const SourceType input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, SourceType& output);
 
         enum class SubscriptionProviderStatus
         {
@@ -5406,97 +579,8 @@ namespace PlayFab
             SubscriptionProviderStatusPaymentPending
         };
 
-        inline void ToJsonEnum(const SubscriptionProviderStatus input, Json::Value& output)
-        {
-            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusNoError)
-            {
-                output = Json::Value("NoError");
-                return;
-            }
-            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusCancelled)
-            {
-                output = Json::Value("Cancelled");
-                return;
-            }
-            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusUnknownError)
-            {
-                output = Json::Value("UnknownError");
-                return;
-            }
-            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusBillingError)
-            {
-                output = Json::Value("BillingError");
-                return;
-            }
-            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusProductUnavailable)
-            {
-                output = Json::Value("ProductUnavailable");
-                return;
-            }
-            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusCustomerDidNotAcceptPriceChange)
-            {
-                output = Json::Value("CustomerDidNotAcceptPriceChange");
-                return;
-            }
-            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusFreeTrial)
-            {
-                output = Json::Value("FreeTrial");
-                return;
-            }
-            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusPaymentPending)
-            {
-                output = Json::Value("PaymentPending");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, SubscriptionProviderStatus& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "NoError")
-            {
-                output = SubscriptionProviderStatus::SubscriptionProviderStatusNoError;
-                return;
-            }
-            if (inputStr == "Cancelled")
-            {
-                output = SubscriptionProviderStatus::SubscriptionProviderStatusCancelled;
-                return;
-            }
-            if (inputStr == "UnknownError")
-            {
-                output = SubscriptionProviderStatus::SubscriptionProviderStatusUnknownError;
-                return;
-            }
-            if (inputStr == "BillingError")
-            {
-                output = SubscriptionProviderStatus::SubscriptionProviderStatusBillingError;
-                return;
-            }
-            if (inputStr == "ProductUnavailable")
-            {
-                output = SubscriptionProviderStatus::SubscriptionProviderStatusProductUnavailable;
-                return;
-            }
-            if (inputStr == "CustomerDidNotAcceptPriceChange")
-            {
-                output = SubscriptionProviderStatus::SubscriptionProviderStatusCustomerDidNotAcceptPriceChange;
-                return;
-            }
-            if (inputStr == "FreeTrial")
-            {
-                output = SubscriptionProviderStatus::SubscriptionProviderStatusFreeTrial;
-                return;
-            }
-            if (inputStr == "PaymentPending")
-            {
-                output = SubscriptionProviderStatus::SubscriptionProviderStatusPaymentPending;
-                return;
-            }
-        }
+        void ToJsonEnum(const SubscriptionProviderStatus input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, SubscriptionProviderStatus& output);
 
         enum class TitleActivationStatus
         {
@@ -5507,67 +591,8 @@ namespace PlayFab
             TitleActivationStatusRevokedSteam
         };
 
-        inline void ToJsonEnum(const TitleActivationStatus input, Json::Value& output)
-        {
-            if (input == TitleActivationStatus::TitleActivationStatusNone)
-            {
-                output = Json::Value("None");
-                return;
-            }
-            if (input == TitleActivationStatus::TitleActivationStatusActivatedTitleKey)
-            {
-                output = Json::Value("ActivatedTitleKey");
-                return;
-            }
-            if (input == TitleActivationStatus::TitleActivationStatusPendingSteam)
-            {
-                output = Json::Value("PendingSteam");
-                return;
-            }
-            if (input == TitleActivationStatus::TitleActivationStatusActivatedSteam)
-            {
-                output = Json::Value("ActivatedSteam");
-                return;
-            }
-            if (input == TitleActivationStatus::TitleActivationStatusRevokedSteam)
-            {
-                output = Json::Value("RevokedSteam");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, TitleActivationStatus& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "None")
-            {
-                output = TitleActivationStatus::TitleActivationStatusNone;
-                return;
-            }
-            if (inputStr == "ActivatedTitleKey")
-            {
-                output = TitleActivationStatus::TitleActivationStatusActivatedTitleKey;
-                return;
-            }
-            if (inputStr == "PendingSteam")
-            {
-                output = TitleActivationStatus::TitleActivationStatusPendingSteam;
-                return;
-            }
-            if (inputStr == "ActivatedSteam")
-            {
-                output = TitleActivationStatus::TitleActivationStatusActivatedSteam;
-                return;
-            }
-            if (inputStr == "RevokedSteam")
-            {
-                output = TitleActivationStatus::TitleActivationStatusRevokedSteam;
-                return;
-            }
-        }
+        void ToJsonEnum(const TitleActivationStatus input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, TitleActivationStatus& output);
 
         enum class TradeStatus
         {
@@ -5580,87 +605,8 @@ namespace PlayFab
             TradeStatusCancelled
         };
 
-        inline void ToJsonEnum(const TradeStatus input, Json::Value& output)
-        {
-            if (input == TradeStatus::TradeStatusInvalid)
-            {
-                output = Json::Value("Invalid");
-                return;
-            }
-            if (input == TradeStatus::TradeStatusOpening)
-            {
-                output = Json::Value("Opening");
-                return;
-            }
-            if (input == TradeStatus::TradeStatusOpen)
-            {
-                output = Json::Value("Open");
-                return;
-            }
-            if (input == TradeStatus::TradeStatusAccepting)
-            {
-                output = Json::Value("Accepting");
-                return;
-            }
-            if (input == TradeStatus::TradeStatusAccepted)
-            {
-                output = Json::Value("Accepted");
-                return;
-            }
-            if (input == TradeStatus::TradeStatusFilled)
-            {
-                output = Json::Value("Filled");
-                return;
-            }
-            if (input == TradeStatus::TradeStatusCancelled)
-            {
-                output = Json::Value("Cancelled");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, TradeStatus& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "Invalid")
-            {
-                output = TradeStatus::TradeStatusInvalid;
-                return;
-            }
-            if (inputStr == "Opening")
-            {
-                output = TradeStatus::TradeStatusOpening;
-                return;
-            }
-            if (inputStr == "Open")
-            {
-                output = TradeStatus::TradeStatusOpen;
-                return;
-            }
-            if (inputStr == "Accepting")
-            {
-                output = TradeStatus::TradeStatusAccepting;
-                return;
-            }
-            if (inputStr == "Accepted")
-            {
-                output = TradeStatus::TradeStatusAccepted;
-                return;
-            }
-            if (inputStr == "Filled")
-            {
-                output = TradeStatus::TradeStatusFilled;
-                return;
-            }
-            if (inputStr == "Cancelled")
-            {
-                output = TradeStatus::TradeStatusCancelled;
-                return;
-            }
-        }
+        void ToJsonEnum(const TradeStatus input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, TradeStatus& output);
 
         enum class TransactionStatus
         {
@@ -5686,217 +632,8 @@ namespace PlayFab
             TransactionStatusFailed
         };
 
-        inline void ToJsonEnum(const TransactionStatus input, Json::Value& output)
-        {
-            if (input == TransactionStatus::TransactionStatusCreateCart)
-            {
-                output = Json::Value("CreateCart");
-                return;
-            }
-            if (input == TransactionStatus::TransactionStatusInit)
-            {
-                output = Json::Value("Init");
-                return;
-            }
-            if (input == TransactionStatus::TransactionStatusApproved)
-            {
-                output = Json::Value("Approved");
-                return;
-            }
-            if (input == TransactionStatus::TransactionStatusSucceeded)
-            {
-                output = Json::Value("Succeeded");
-                return;
-            }
-            if (input == TransactionStatus::TransactionStatusFailedByProvider)
-            {
-                output = Json::Value("FailedByProvider");
-                return;
-            }
-            if (input == TransactionStatus::TransactionStatusDisputePending)
-            {
-                output = Json::Value("DisputePending");
-                return;
-            }
-            if (input == TransactionStatus::TransactionStatusRefundPending)
-            {
-                output = Json::Value("RefundPending");
-                return;
-            }
-            if (input == TransactionStatus::TransactionStatusRefunded)
-            {
-                output = Json::Value("Refunded");
-                return;
-            }
-            if (input == TransactionStatus::TransactionStatusRefundFailed)
-            {
-                output = Json::Value("RefundFailed");
-                return;
-            }
-            if (input == TransactionStatus::TransactionStatusChargedBack)
-            {
-                output = Json::Value("ChargedBack");
-                return;
-            }
-            if (input == TransactionStatus::TransactionStatusFailedByUber)
-            {
-                output = Json::Value("FailedByUber");
-                return;
-            }
-            if (input == TransactionStatus::TransactionStatusFailedByPlayFab)
-            {
-                output = Json::Value("FailedByPlayFab");
-                return;
-            }
-            if (input == TransactionStatus::TransactionStatusRevoked)
-            {
-                output = Json::Value("Revoked");
-                return;
-            }
-            if (input == TransactionStatus::TransactionStatusTradePending)
-            {
-                output = Json::Value("TradePending");
-                return;
-            }
-            if (input == TransactionStatus::TransactionStatusTraded)
-            {
-                output = Json::Value("Traded");
-                return;
-            }
-            if (input == TransactionStatus::TransactionStatusUpgraded)
-            {
-                output = Json::Value("Upgraded");
-                return;
-            }
-            if (input == TransactionStatus::TransactionStatusStackPending)
-            {
-                output = Json::Value("StackPending");
-                return;
-            }
-            if (input == TransactionStatus::TransactionStatusStacked)
-            {
-                output = Json::Value("Stacked");
-                return;
-            }
-            if (input == TransactionStatus::TransactionStatusOther)
-            {
-                output = Json::Value("Other");
-                return;
-            }
-            if (input == TransactionStatus::TransactionStatusFailed)
-            {
-                output = Json::Value("Failed");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, TransactionStatus& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "CreateCart")
-            {
-                output = TransactionStatus::TransactionStatusCreateCart;
-                return;
-            }
-            if (inputStr == "Init")
-            {
-                output = TransactionStatus::TransactionStatusInit;
-                return;
-            }
-            if (inputStr == "Approved")
-            {
-                output = TransactionStatus::TransactionStatusApproved;
-                return;
-            }
-            if (inputStr == "Succeeded")
-            {
-                output = TransactionStatus::TransactionStatusSucceeded;
-                return;
-            }
-            if (inputStr == "FailedByProvider")
-            {
-                output = TransactionStatus::TransactionStatusFailedByProvider;
-                return;
-            }
-            if (inputStr == "DisputePending")
-            {
-                output = TransactionStatus::TransactionStatusDisputePending;
-                return;
-            }
-            if (inputStr == "RefundPending")
-            {
-                output = TransactionStatus::TransactionStatusRefundPending;
-                return;
-            }
-            if (inputStr == "Refunded")
-            {
-                output = TransactionStatus::TransactionStatusRefunded;
-                return;
-            }
-            if (inputStr == "RefundFailed")
-            {
-                output = TransactionStatus::TransactionStatusRefundFailed;
-                return;
-            }
-            if (inputStr == "ChargedBack")
-            {
-                output = TransactionStatus::TransactionStatusChargedBack;
-                return;
-            }
-            if (inputStr == "FailedByUber")
-            {
-                output = TransactionStatus::TransactionStatusFailedByUber;
-                return;
-            }
-            if (inputStr == "FailedByPlayFab")
-            {
-                output = TransactionStatus::TransactionStatusFailedByPlayFab;
-                return;
-            }
-            if (inputStr == "Revoked")
-            {
-                output = TransactionStatus::TransactionStatusRevoked;
-                return;
-            }
-            if (inputStr == "TradePending")
-            {
-                output = TransactionStatus::TransactionStatusTradePending;
-                return;
-            }
-            if (inputStr == "Traded")
-            {
-                output = TransactionStatus::TransactionStatusTraded;
-                return;
-            }
-            if (inputStr == "Upgraded")
-            {
-                output = TransactionStatus::TransactionStatusUpgraded;
-                return;
-            }
-            if (inputStr == "StackPending")
-            {
-                output = TransactionStatus::TransactionStatusStackPending;
-                return;
-            }
-            if (inputStr == "Stacked")
-            {
-                output = TransactionStatus::TransactionStatusStacked;
-                return;
-            }
-            if (inputStr == "Other")
-            {
-                output = TransactionStatus::TransactionStatusOther;
-                return;
-            }
-            if (inputStr == "Failed")
-            {
-                output = TransactionStatus::TransactionStatusFailed;
-                return;
-            }
-        }
+        void ToJsonEnum(const TransactionStatus input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, TransactionStatus& output);
 
         enum class UserDataPermission
         {
@@ -5904,37 +641,8 @@ namespace PlayFab
             UserDataPermissionPublic
         };
 
-        inline void ToJsonEnum(const UserDataPermission input, Json::Value& output)
-        {
-            if (input == UserDataPermission::UserDataPermissionPrivate)
-            {
-                output = Json::Value("Private");
-                return;
-            }
-            if (input == UserDataPermission::UserDataPermissionPublic)
-            {
-                output = Json::Value("Public");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, UserDataPermission& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "Private")
-            {
-                output = UserDataPermission::UserDataPermissionPrivate;
-                return;
-            }
-            if (inputStr == "Public")
-            {
-                output = UserDataPermission::UserDataPermissionPublic;
-                return;
-            }
-        }
+        void ToJsonEnum(const UserDataPermission input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, UserDataPermission& output);
 
         enum class UserOrigination
         {
@@ -5964,257 +672,8 @@ namespace PlayFab
             UserOriginationNintendoSwitchAccount
         };
 
-        inline void ToJsonEnum(const UserOrigination input, Json::Value& output)
-        {
-            if (input == UserOrigination::UserOriginationOrganic)
-            {
-                output = Json::Value("Organic");
-                return;
-            }
-            if (input == UserOrigination::UserOriginationSteam)
-            {
-                output = Json::Value("Steam");
-                return;
-            }
-            if (input == UserOrigination::UserOriginationGoogle)
-            {
-                output = Json::Value("Google");
-                return;
-            }
-            if (input == UserOrigination::UserOriginationAmazon)
-            {
-                output = Json::Value("Amazon");
-                return;
-            }
-            if (input == UserOrigination::UserOriginationFacebook)
-            {
-                output = Json::Value("Facebook");
-                return;
-            }
-            if (input == UserOrigination::UserOriginationKongregate)
-            {
-                output = Json::Value("Kongregate");
-                return;
-            }
-            if (input == UserOrigination::UserOriginationGamersFirst)
-            {
-                output = Json::Value("GamersFirst");
-                return;
-            }
-            if (input == UserOrigination::UserOriginationUnknown)
-            {
-                output = Json::Value("Unknown");
-                return;
-            }
-            if (input == UserOrigination::UserOriginationIOS)
-            {
-                output = Json::Value("IOS");
-                return;
-            }
-            if (input == UserOrigination::UserOriginationLoadTest)
-            {
-                output = Json::Value("LoadTest");
-                return;
-            }
-            if (input == UserOrigination::UserOriginationAndroid)
-            {
-                output = Json::Value("Android");
-                return;
-            }
-            if (input == UserOrigination::UserOriginationPSN)
-            {
-                output = Json::Value("PSN");
-                return;
-            }
-            if (input == UserOrigination::UserOriginationGameCenter)
-            {
-                output = Json::Value("GameCenter");
-                return;
-            }
-            if (input == UserOrigination::UserOriginationCustomId)
-            {
-                output = Json::Value("CustomId");
-                return;
-            }
-            if (input == UserOrigination::UserOriginationXboxLive)
-            {
-                output = Json::Value("XboxLive");
-                return;
-            }
-            if (input == UserOrigination::UserOriginationParse)
-            {
-                output = Json::Value("Parse");
-                return;
-            }
-            if (input == UserOrigination::UserOriginationTwitch)
-            {
-                output = Json::Value("Twitch");
-                return;
-            }
-            if (input == UserOrigination::UserOriginationWindowsHello)
-            {
-                output = Json::Value("WindowsHello");
-                return;
-            }
-            if (input == UserOrigination::UserOriginationServerCustomId)
-            {
-                output = Json::Value("ServerCustomId");
-                return;
-            }
-            if (input == UserOrigination::UserOriginationNintendoSwitchDeviceId)
-            {
-                output = Json::Value("NintendoSwitchDeviceId");
-                return;
-            }
-            if (input == UserOrigination::UserOriginationFacebookInstantGamesId)
-            {
-                output = Json::Value("FacebookInstantGamesId");
-                return;
-            }
-            if (input == UserOrigination::UserOriginationOpenIdConnect)
-            {
-                output = Json::Value("OpenIdConnect");
-                return;
-            }
-            if (input == UserOrigination::UserOriginationApple)
-            {
-                output = Json::Value("Apple");
-                return;
-            }
-            if (input == UserOrigination::UserOriginationNintendoSwitchAccount)
-            {
-                output = Json::Value("NintendoSwitchAccount");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, UserOrigination& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "Organic")
-            {
-                output = UserOrigination::UserOriginationOrganic;
-                return;
-            }
-            if (inputStr == "Steam")
-            {
-                output = UserOrigination::UserOriginationSteam;
-                return;
-            }
-            if (inputStr == "Google")
-            {
-                output = UserOrigination::UserOriginationGoogle;
-                return;
-            }
-            if (inputStr == "Amazon")
-            {
-                output = UserOrigination::UserOriginationAmazon;
-                return;
-            }
-            if (inputStr == "Facebook")
-            {
-                output = UserOrigination::UserOriginationFacebook;
-                return;
-            }
-            if (inputStr == "Kongregate")
-            {
-                output = UserOrigination::UserOriginationKongregate;
-                return;
-            }
-            if (inputStr == "GamersFirst")
-            {
-                output = UserOrigination::UserOriginationGamersFirst;
-                return;
-            }
-            if (inputStr == "Unknown")
-            {
-                output = UserOrigination::UserOriginationUnknown;
-                return;
-            }
-            if (inputStr == "IOS")
-            {
-                output = UserOrigination::UserOriginationIOS;
-                return;
-            }
-            if (inputStr == "LoadTest")
-            {
-                output = UserOrigination::UserOriginationLoadTest;
-                return;
-            }
-            if (inputStr == "Android")
-            {
-                output = UserOrigination::UserOriginationAndroid;
-                return;
-            }
-            if (inputStr == "PSN")
-            {
-                output = UserOrigination::UserOriginationPSN;
-                return;
-            }
-            if (inputStr == "GameCenter")
-            {
-                output = UserOrigination::UserOriginationGameCenter;
-                return;
-            }
-            if (inputStr == "CustomId")
-            {
-                output = UserOrigination::UserOriginationCustomId;
-                return;
-            }
-            if (inputStr == "XboxLive")
-            {
-                output = UserOrigination::UserOriginationXboxLive;
-                return;
-            }
-            if (inputStr == "Parse")
-            {
-                output = UserOrigination::UserOriginationParse;
-                return;
-            }
-            if (inputStr == "Twitch")
-            {
-                output = UserOrigination::UserOriginationTwitch;
-                return;
-            }
-            if (inputStr == "WindowsHello")
-            {
-                output = UserOrigination::UserOriginationWindowsHello;
-                return;
-            }
-            if (inputStr == "ServerCustomId")
-            {
-                output = UserOrigination::UserOriginationServerCustomId;
-                return;
-            }
-            if (inputStr == "NintendoSwitchDeviceId")
-            {
-                output = UserOrigination::UserOriginationNintendoSwitchDeviceId;
-                return;
-            }
-            if (inputStr == "FacebookInstantGamesId")
-            {
-                output = UserOrigination::UserOriginationFacebookInstantGamesId;
-                return;
-            }
-            if (inputStr == "OpenIdConnect")
-            {
-                output = UserOrigination::UserOriginationOpenIdConnect;
-                return;
-            }
-            if (inputStr == "Apple")
-            {
-                output = UserOrigination::UserOriginationApple;
-                return;
-            }
-            if (inputStr == "NintendoSwitchAccount")
-            {
-                output = UserOrigination::UserOriginationNintendoSwitchAccount;
-                return;
-            }
-        }
+        void ToJsonEnum(const UserOrigination input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, UserOrigination& output);
 
         // Client Classes
         struct AcceptTradeRequest : public PlayFabRequestCommon
@@ -6239,21 +698,9 @@ namespace PlayFab
 
             ~AcceptTradeRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["AcceptedInventoryInstanceIds"], AcceptedInventoryInstanceIds);
-                FromJsonUtilS(input["OfferingPlayerId"], OfferingPlayerId);
-                FromJsonUtilS(input["TradeId"], TradeId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AcceptedInventoryInstanceIds; ToJsonUtilS(AcceptedInventoryInstanceIds, each_AcceptedInventoryInstanceIds); output["AcceptedInventoryInstanceIds"] = each_AcceptedInventoryInstanceIds;
-                Json::Value each_OfferingPlayerId; ToJsonUtilS(OfferingPlayerId, each_OfferingPlayerId); output["OfferingPlayerId"] = each_OfferingPlayerId;
-                Json::Value each_TradeId; ToJsonUtilS(TradeId, each_TradeId); output["TradeId"] = each_TradeId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct TradeInfo : public PlayFabBaseModel
@@ -6308,41 +755,9 @@ namespace PlayFab
 
             ~TradeInfo() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["AcceptedInventoryInstanceIds"], AcceptedInventoryInstanceIds);
-                FromJsonUtilS(input["AcceptedPlayerId"], AcceptedPlayerId);
-                FromJsonUtilS(input["AllowedPlayerIds"], AllowedPlayerIds);
-                FromJsonUtilT(input["CancelledAt"], CancelledAt);
-                FromJsonUtilT(input["FilledAt"], FilledAt);
-                FromJsonUtilT(input["InvalidatedAt"], InvalidatedAt);
-                FromJsonUtilS(input["OfferedCatalogItemIds"], OfferedCatalogItemIds);
-                FromJsonUtilS(input["OfferedInventoryInstanceIds"], OfferedInventoryInstanceIds);
-                FromJsonUtilS(input["OfferingPlayerId"], OfferingPlayerId);
-                FromJsonUtilT(input["OpenedAt"], OpenedAt);
-                FromJsonUtilS(input["RequestedCatalogItemIds"], RequestedCatalogItemIds);
-                FromJsonUtilE(input["Status"], Status);
-                FromJsonUtilS(input["TradeId"], TradeId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AcceptedInventoryInstanceIds; ToJsonUtilS(AcceptedInventoryInstanceIds, each_AcceptedInventoryInstanceIds); output["AcceptedInventoryInstanceIds"] = each_AcceptedInventoryInstanceIds;
-                Json::Value each_AcceptedPlayerId; ToJsonUtilS(AcceptedPlayerId, each_AcceptedPlayerId); output["AcceptedPlayerId"] = each_AcceptedPlayerId;
-                Json::Value each_AllowedPlayerIds; ToJsonUtilS(AllowedPlayerIds, each_AllowedPlayerIds); output["AllowedPlayerIds"] = each_AllowedPlayerIds;
-                Json::Value each_CancelledAt; ToJsonUtilT(CancelledAt, each_CancelledAt); output["CancelledAt"] = each_CancelledAt;
-                Json::Value each_FilledAt; ToJsonUtilT(FilledAt, each_FilledAt); output["FilledAt"] = each_FilledAt;
-                Json::Value each_InvalidatedAt; ToJsonUtilT(InvalidatedAt, each_InvalidatedAt); output["InvalidatedAt"] = each_InvalidatedAt;
-                Json::Value each_OfferedCatalogItemIds; ToJsonUtilS(OfferedCatalogItemIds, each_OfferedCatalogItemIds); output["OfferedCatalogItemIds"] = each_OfferedCatalogItemIds;
-                Json::Value each_OfferedInventoryInstanceIds; ToJsonUtilS(OfferedInventoryInstanceIds, each_OfferedInventoryInstanceIds); output["OfferedInventoryInstanceIds"] = each_OfferedInventoryInstanceIds;
-                Json::Value each_OfferingPlayerId; ToJsonUtilS(OfferingPlayerId, each_OfferingPlayerId); output["OfferingPlayerId"] = each_OfferingPlayerId;
-                Json::Value each_OpenedAt; ToJsonUtilT(OpenedAt, each_OpenedAt); output["OpenedAt"] = each_OpenedAt;
-                Json::Value each_RequestedCatalogItemIds; ToJsonUtilS(RequestedCatalogItemIds, each_RequestedCatalogItemIds); output["RequestedCatalogItemIds"] = each_RequestedCatalogItemIds;
-                Json::Value each_Status; ToJsonUtilE(Status, each_Status); output["Status"] = each_Status;
-                Json::Value each_TradeId; ToJsonUtilS(TradeId, each_TradeId); output["TradeId"] = each_TradeId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct AcceptTradeResponse : public PlayFabResultCommon
@@ -6361,17 +776,9 @@ namespace PlayFab
 
             ~AcceptTradeResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Trade"], Trade);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Trade; ToJsonUtilO(Trade, each_Trade); output["Trade"] = each_Trade;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct AdCampaignAttributionModel : public PlayFabBaseModel
@@ -6396,21 +803,9 @@ namespace PlayFab
 
             ~AdCampaignAttributionModel() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilT(input["AttributedAt"], AttributedAt);
-                FromJsonUtilS(input["CampaignId"], CampaignId);
-                FromJsonUtilS(input["Platform"], Platform);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AttributedAt; ToJsonUtilT(AttributedAt, each_AttributedAt); output["AttributedAt"] = each_AttributedAt;
-                Json::Value each_CampaignId; ToJsonUtilS(CampaignId, each_CampaignId); output["CampaignId"] = each_CampaignId;
-                Json::Value each_Platform; ToJsonUtilS(Platform, each_Platform); output["Platform"] = each_Platform;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct AddFriendRequest : public PlayFabRequestCommon
@@ -6438,23 +833,9 @@ namespace PlayFab
 
             ~AddFriendRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["FriendEmail"], FriendEmail);
-                FromJsonUtilS(input["FriendPlayFabId"], FriendPlayFabId);
-                FromJsonUtilS(input["FriendTitleDisplayName"], FriendTitleDisplayName);
-                FromJsonUtilS(input["FriendUsername"], FriendUsername);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_FriendEmail; ToJsonUtilS(FriendEmail, each_FriendEmail); output["FriendEmail"] = each_FriendEmail;
-                Json::Value each_FriendPlayFabId; ToJsonUtilS(FriendPlayFabId, each_FriendPlayFabId); output["FriendPlayFabId"] = each_FriendPlayFabId;
-                Json::Value each_FriendTitleDisplayName; ToJsonUtilS(FriendTitleDisplayName, each_FriendTitleDisplayName); output["FriendTitleDisplayName"] = each_FriendTitleDisplayName;
-                Json::Value each_FriendUsername; ToJsonUtilS(FriendUsername, each_FriendUsername); output["FriendUsername"] = each_FriendUsername;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct AddFriendResult : public PlayFabResultCommon
@@ -6473,17 +854,9 @@ namespace PlayFab
 
             ~AddFriendResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["Created"], Created);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Created; ToJsonUtilP(Created, each_Created); output["Created"] = each_Created;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GenericServiceId : public PlayFabBaseModel
@@ -6505,19 +878,9 @@ namespace PlayFab
 
             ~GenericServiceId() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["ServiceName"], ServiceName);
-                FromJsonUtilS(input["UserId"], UserId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ServiceName; ToJsonUtilS(ServiceName, each_ServiceName); output["ServiceName"] = each_ServiceName;
-                Json::Value each_UserId; ToJsonUtilS(UserId, each_UserId); output["UserId"] = each_UserId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct AddGenericIDRequest : public PlayFabRequestCommon
@@ -6536,17 +899,9 @@ namespace PlayFab
 
             ~AddGenericIDRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["GenericId"], GenericId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_GenericId; ToJsonUtilO(GenericId, each_GenericId); output["GenericId"] = each_GenericId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct AddGenericIDResult : public PlayFabResultCommon
@@ -6562,15 +917,9 @@ namespace PlayFab
 
             ~AddGenericIDResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct AddOrUpdateContactEmailRequest : public PlayFabRequestCommon
@@ -6592,19 +941,9 @@ namespace PlayFab
 
             ~AddOrUpdateContactEmailRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["EmailAddress"], EmailAddress);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_EmailAddress; ToJsonUtilS(EmailAddress, each_EmailAddress); output["EmailAddress"] = each_EmailAddress;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct AddOrUpdateContactEmailResult : public PlayFabResultCommon
@@ -6620,15 +959,9 @@ namespace PlayFab
 
             ~AddOrUpdateContactEmailResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct AddSharedGroupMembersRequest : public PlayFabRequestCommon
@@ -6650,19 +983,9 @@ namespace PlayFab
 
             ~AddSharedGroupMembersRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["PlayFabIds"], PlayFabIds);
-                FromJsonUtilS(input["SharedGroupId"], SharedGroupId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_PlayFabIds; ToJsonUtilS(PlayFabIds, each_PlayFabIds); output["PlayFabIds"] = each_PlayFabIds;
-                Json::Value each_SharedGroupId; ToJsonUtilS(SharedGroupId, each_SharedGroupId); output["SharedGroupId"] = each_SharedGroupId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct AddSharedGroupMembersResult : public PlayFabResultCommon
@@ -6678,15 +1001,9 @@ namespace PlayFab
 
             ~AddSharedGroupMembersResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct AddUsernamePasswordRequest : public PlayFabRequestCommon
@@ -6714,23 +1031,9 @@ namespace PlayFab
 
             ~AddUsernamePasswordRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["Email"], Email);
-                FromJsonUtilS(input["Password"], Password);
-                FromJsonUtilS(input["Username"], Username);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Email; ToJsonUtilS(Email, each_Email); output["Email"] = each_Email;
-                Json::Value each_Password; ToJsonUtilS(Password, each_Password); output["Password"] = each_Password;
-                Json::Value each_Username; ToJsonUtilS(Username, each_Username); output["Username"] = each_Username;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct AddUsernamePasswordResult : public PlayFabResultCommon
@@ -6749,17 +1052,9 @@ namespace PlayFab
 
             ~AddUsernamePasswordResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Username"], Username);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Username; ToJsonUtilS(Username, each_Username); output["Username"] = each_Username;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct AddUserVirtualCurrencyRequest : public PlayFabRequestCommon
@@ -6784,21 +1079,9 @@ namespace PlayFab
 
             ~AddUserVirtualCurrencyRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["Amount"], Amount);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["VirtualCurrency"], VirtualCurrency);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Amount; ToJsonUtilP(Amount, each_Amount); output["Amount"] = each_Amount;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_VirtualCurrency; ToJsonUtilS(VirtualCurrency, each_VirtualCurrency); output["VirtualCurrency"] = each_VirtualCurrency;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct AdPlacementDetails : public PlayFabBaseModel
@@ -6838,31 +1121,9 @@ namespace PlayFab
 
             ~AdPlacementDetails() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["PlacementId"], PlacementId);
-                FromJsonUtilS(input["PlacementName"], PlacementName);
-                FromJsonUtilP(input["PlacementViewsRemaining"], PlacementViewsRemaining);
-                FromJsonUtilP(input["PlacementViewsResetMinutes"], PlacementViewsResetMinutes);
-                FromJsonUtilS(input["RewardAssetUrl"], RewardAssetUrl);
-                FromJsonUtilS(input["RewardDescription"], RewardDescription);
-                FromJsonUtilS(input["RewardId"], RewardId);
-                FromJsonUtilS(input["RewardName"], RewardName);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_PlacementId; ToJsonUtilS(PlacementId, each_PlacementId); output["PlacementId"] = each_PlacementId;
-                Json::Value each_PlacementName; ToJsonUtilS(PlacementName, each_PlacementName); output["PlacementName"] = each_PlacementName;
-                Json::Value each_PlacementViewsRemaining; ToJsonUtilP(PlacementViewsRemaining, each_PlacementViewsRemaining); output["PlacementViewsRemaining"] = each_PlacementViewsRemaining;
-                Json::Value each_PlacementViewsResetMinutes; ToJsonUtilP(PlacementViewsResetMinutes, each_PlacementViewsResetMinutes); output["PlacementViewsResetMinutes"] = each_PlacementViewsResetMinutes;
-                Json::Value each_RewardAssetUrl; ToJsonUtilS(RewardAssetUrl, each_RewardAssetUrl); output["RewardAssetUrl"] = each_RewardAssetUrl;
-                Json::Value each_RewardDescription; ToJsonUtilS(RewardDescription, each_RewardDescription); output["RewardDescription"] = each_RewardDescription;
-                Json::Value each_RewardId; ToJsonUtilS(RewardId, each_RewardId); output["RewardId"] = each_RewardId;
-                Json::Value each_RewardName; ToJsonUtilS(RewardName, each_RewardName); output["RewardName"] = each_RewardName;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct AdRewardItemGranted : public PlayFabBaseModel
@@ -6890,23 +1151,9 @@ namespace PlayFab
 
             ~AdRewardItemGranted() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CatalogId"], CatalogId);
-                FromJsonUtilS(input["DisplayName"], DisplayName);
-                FromJsonUtilS(input["InstanceId"], InstanceId);
-                FromJsonUtilS(input["ItemId"], ItemId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CatalogId; ToJsonUtilS(CatalogId, each_CatalogId); output["CatalogId"] = each_CatalogId;
-                Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); output["DisplayName"] = each_DisplayName;
-                Json::Value each_InstanceId; ToJsonUtilS(InstanceId, each_InstanceId); output["InstanceId"] = each_InstanceId;
-                Json::Value each_ItemId; ToJsonUtilS(ItemId, each_ItemId); output["ItemId"] = each_ItemId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct AdRewardResults : public PlayFabBaseModel
@@ -6931,21 +1178,9 @@ namespace PlayFab
 
             ~AdRewardResults() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["GrantedItems"], GrantedItems);
-                FromJsonUtilP(input["GrantedVirtualCurrencies"], GrantedVirtualCurrencies);
-                FromJsonUtilP(input["IncrementedStatistics"], IncrementedStatistics);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_GrantedItems; ToJsonUtilO(GrantedItems, each_GrantedItems); output["GrantedItems"] = each_GrantedItems;
-                Json::Value each_GrantedVirtualCurrencies; ToJsonUtilP(GrantedVirtualCurrencies, each_GrantedVirtualCurrencies); output["GrantedVirtualCurrencies"] = each_GrantedVirtualCurrencies;
-                Json::Value each_IncrementedStatistics; ToJsonUtilP(IncrementedStatistics, each_IncrementedStatistics); output["IncrementedStatistics"] = each_IncrementedStatistics;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct AndroidDevicePushNotificationRegistrationRequest : public PlayFabRequestCommon
@@ -6970,21 +1205,9 @@ namespace PlayFab
 
             ~AndroidDevicePushNotificationRegistrationRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["ConfirmationMessage"], ConfirmationMessage);
-                FromJsonUtilS(input["DeviceToken"], DeviceToken);
-                FromJsonUtilP(input["SendPushNotificationConfirmation"], SendPushNotificationConfirmation);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ConfirmationMessage; ToJsonUtilS(ConfirmationMessage, each_ConfirmationMessage); output["ConfirmationMessage"] = each_ConfirmationMessage;
-                Json::Value each_DeviceToken; ToJsonUtilS(DeviceToken, each_DeviceToken); output["DeviceToken"] = each_DeviceToken;
-                Json::Value each_SendPushNotificationConfirmation; ToJsonUtilP(SendPushNotificationConfirmation, each_SendPushNotificationConfirmation); output["SendPushNotificationConfirmation"] = each_SendPushNotificationConfirmation;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct AndroidDevicePushNotificationRegistrationResult : public PlayFabResultCommon
@@ -7000,15 +1223,9 @@ namespace PlayFab
 
             ~AndroidDevicePushNotificationRegistrationResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct AttributeInstallRequest : public PlayFabRequestCommon
@@ -7030,19 +1247,9 @@ namespace PlayFab
 
             ~AttributeInstallRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Adid"], Adid);
-                FromJsonUtilS(input["Idfa"], Idfa);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Adid; ToJsonUtilS(Adid, each_Adid); output["Adid"] = each_Adid;
-                Json::Value each_Idfa; ToJsonUtilS(Idfa, each_Idfa); output["Idfa"] = each_Idfa;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct AttributeInstallResult : public PlayFabResultCommon
@@ -7058,15 +1265,9 @@ namespace PlayFab
 
             ~AttributeInstallResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct CancelTradeRequest : public PlayFabRequestCommon
@@ -7085,17 +1286,9 @@ namespace PlayFab
 
             ~CancelTradeRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["TradeId"], TradeId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_TradeId; ToJsonUtilS(TradeId, each_TradeId); output["TradeId"] = each_TradeId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct CancelTradeResponse : public PlayFabResultCommon
@@ -7114,17 +1307,9 @@ namespace PlayFab
 
             ~CancelTradeResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Trade"], Trade);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Trade; ToJsonUtilO(Trade, each_Trade); output["Trade"] = each_Trade;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct CartItem : public PlayFabBaseModel
@@ -7164,31 +1349,9 @@ namespace PlayFab
 
             ~CartItem() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Description"], Description);
-                FromJsonUtilS(input["DisplayName"], DisplayName);
-                FromJsonUtilS(input["ItemClass"], ItemClass);
-                FromJsonUtilS(input["ItemId"], ItemId);
-                FromJsonUtilS(input["ItemInstanceId"], ItemInstanceId);
-                FromJsonUtilP(input["RealCurrencyPrices"], RealCurrencyPrices);
-                FromJsonUtilP(input["VCAmount"], VCAmount);
-                FromJsonUtilP(input["VirtualCurrencyPrices"], VirtualCurrencyPrices);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Description; ToJsonUtilS(Description, each_Description); output["Description"] = each_Description;
-                Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); output["DisplayName"] = each_DisplayName;
-                Json::Value each_ItemClass; ToJsonUtilS(ItemClass, each_ItemClass); output["ItemClass"] = each_ItemClass;
-                Json::Value each_ItemId; ToJsonUtilS(ItemId, each_ItemId); output["ItemId"] = each_ItemId;
-                Json::Value each_ItemInstanceId; ToJsonUtilS(ItemInstanceId, each_ItemInstanceId); output["ItemInstanceId"] = each_ItemInstanceId;
-                Json::Value each_RealCurrencyPrices; ToJsonUtilP(RealCurrencyPrices, each_RealCurrencyPrices); output["RealCurrencyPrices"] = each_RealCurrencyPrices;
-                Json::Value each_VCAmount; ToJsonUtilP(VCAmount, each_VCAmount); output["VCAmount"] = each_VCAmount;
-                Json::Value each_VirtualCurrencyPrices; ToJsonUtilP(VirtualCurrencyPrices, each_VirtualCurrencyPrices); output["VirtualCurrencyPrices"] = each_VirtualCurrencyPrices;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct CatalogItemBundleInfo : public PlayFabBaseModel
@@ -7213,21 +1376,9 @@ namespace PlayFab
 
             ~CatalogItemBundleInfo() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["BundledItems"], BundledItems);
-                FromJsonUtilS(input["BundledResultTables"], BundledResultTables);
-                FromJsonUtilP(input["BundledVirtualCurrencies"], BundledVirtualCurrencies);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_BundledItems; ToJsonUtilS(BundledItems, each_BundledItems); output["BundledItems"] = each_BundledItems;
-                Json::Value each_BundledResultTables; ToJsonUtilS(BundledResultTables, each_BundledResultTables); output["BundledResultTables"] = each_BundledResultTables;
-                Json::Value each_BundledVirtualCurrencies; ToJsonUtilP(BundledVirtualCurrencies, each_BundledVirtualCurrencies); output["BundledVirtualCurrencies"] = each_BundledVirtualCurrencies;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct CatalogItemConsumableInfo : public PlayFabBaseModel
@@ -7252,21 +1403,9 @@ namespace PlayFab
 
             ~CatalogItemConsumableInfo() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["UsageCount"], UsageCount);
-                FromJsonUtilP(input["UsagePeriod"], UsagePeriod);
-                FromJsonUtilS(input["UsagePeriodGroup"], UsagePeriodGroup);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_UsageCount; ToJsonUtilP(UsageCount, each_UsageCount); output["UsageCount"] = each_UsageCount;
-                Json::Value each_UsagePeriod; ToJsonUtilP(UsagePeriod, each_UsagePeriod); output["UsagePeriod"] = each_UsagePeriod;
-                Json::Value each_UsagePeriodGroup; ToJsonUtilS(UsagePeriodGroup, each_UsagePeriodGroup); output["UsagePeriodGroup"] = each_UsagePeriodGroup;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct CatalogItemContainerInfo : public PlayFabBaseModel
@@ -7294,23 +1433,9 @@ namespace PlayFab
 
             ~CatalogItemContainerInfo() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["ItemContents"], ItemContents);
-                FromJsonUtilS(input["KeyItemId"], KeyItemId);
-                FromJsonUtilS(input["ResultTableContents"], ResultTableContents);
-                FromJsonUtilP(input["VirtualCurrencyContents"], VirtualCurrencyContents);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ItemContents; ToJsonUtilS(ItemContents, each_ItemContents); output["ItemContents"] = each_ItemContents;
-                Json::Value each_KeyItemId; ToJsonUtilS(KeyItemId, each_KeyItemId); output["KeyItemId"] = each_KeyItemId;
-                Json::Value each_ResultTableContents; ToJsonUtilS(ResultTableContents, each_ResultTableContents); output["ResultTableContents"] = each_ResultTableContents;
-                Json::Value each_VirtualCurrencyContents; ToJsonUtilP(VirtualCurrencyContents, each_VirtualCurrencyContents); output["VirtualCurrencyContents"] = each_VirtualCurrencyContents;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct CatalogItem : public PlayFabBaseModel
@@ -7380,51 +1505,9 @@ namespace PlayFab
 
             ~CatalogItem() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Bundle"], Bundle);
-                FromJsonUtilP(input["CanBecomeCharacter"], CanBecomeCharacter);
-                FromJsonUtilS(input["CatalogVersion"], CatalogVersion);
-                FromJsonUtilO(input["Consumable"], Consumable);
-                FromJsonUtilO(input["Container"], Container);
-                FromJsonUtilS(input["CustomData"], CustomData);
-                FromJsonUtilS(input["Description"], Description);
-                FromJsonUtilS(input["DisplayName"], DisplayName);
-                FromJsonUtilP(input["InitialLimitedEditionCount"], InitialLimitedEditionCount);
-                FromJsonUtilP(input["IsLimitedEdition"], IsLimitedEdition);
-                FromJsonUtilP(input["IsStackable"], IsStackable);
-                FromJsonUtilP(input["IsTradable"], IsTradable);
-                FromJsonUtilS(input["ItemClass"], ItemClass);
-                FromJsonUtilS(input["ItemId"], ItemId);
-                FromJsonUtilS(input["ItemImageUrl"], ItemImageUrl);
-                FromJsonUtilP(input["RealCurrencyPrices"], RealCurrencyPrices);
-                FromJsonUtilS(input["Tags"], Tags);
-                FromJsonUtilP(input["VirtualCurrencyPrices"], VirtualCurrencyPrices);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Bundle; ToJsonUtilO(Bundle, each_Bundle); output["Bundle"] = each_Bundle;
-                Json::Value each_CanBecomeCharacter; ToJsonUtilP(CanBecomeCharacter, each_CanBecomeCharacter); output["CanBecomeCharacter"] = each_CanBecomeCharacter;
-                Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); output["CatalogVersion"] = each_CatalogVersion;
-                Json::Value each_Consumable; ToJsonUtilO(Consumable, each_Consumable); output["Consumable"] = each_Consumable;
-                Json::Value each_Container; ToJsonUtilO(Container, each_Container); output["Container"] = each_Container;
-                Json::Value each_CustomData; ToJsonUtilS(CustomData, each_CustomData); output["CustomData"] = each_CustomData;
-                Json::Value each_Description; ToJsonUtilS(Description, each_Description); output["Description"] = each_Description;
-                Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); output["DisplayName"] = each_DisplayName;
-                Json::Value each_InitialLimitedEditionCount; ToJsonUtilP(InitialLimitedEditionCount, each_InitialLimitedEditionCount); output["InitialLimitedEditionCount"] = each_InitialLimitedEditionCount;
-                Json::Value each_IsLimitedEdition; ToJsonUtilP(IsLimitedEdition, each_IsLimitedEdition); output["IsLimitedEdition"] = each_IsLimitedEdition;
-                Json::Value each_IsStackable; ToJsonUtilP(IsStackable, each_IsStackable); output["IsStackable"] = each_IsStackable;
-                Json::Value each_IsTradable; ToJsonUtilP(IsTradable, each_IsTradable); output["IsTradable"] = each_IsTradable;
-                Json::Value each_ItemClass; ToJsonUtilS(ItemClass, each_ItemClass); output["ItemClass"] = each_ItemClass;
-                Json::Value each_ItemId; ToJsonUtilS(ItemId, each_ItemId); output["ItemId"] = each_ItemId;
-                Json::Value each_ItemImageUrl; ToJsonUtilS(ItemImageUrl, each_ItemImageUrl); output["ItemImageUrl"] = each_ItemImageUrl;
-                Json::Value each_RealCurrencyPrices; ToJsonUtilP(RealCurrencyPrices, each_RealCurrencyPrices); output["RealCurrencyPrices"] = each_RealCurrencyPrices;
-                Json::Value each_Tags; ToJsonUtilS(Tags, each_Tags); output["Tags"] = each_Tags;
-                Json::Value each_VirtualCurrencyPrices; ToJsonUtilP(VirtualCurrencyPrices, each_VirtualCurrencyPrices); output["VirtualCurrencyPrices"] = each_VirtualCurrencyPrices;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct ItemInstance : public PlayFabBaseModel
@@ -7485,45 +1568,9 @@ namespace PlayFab
 
             ~ItemInstance() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Annotation"], Annotation);
-                FromJsonUtilS(input["BundleContents"], BundleContents);
-                FromJsonUtilS(input["BundleParent"], BundleParent);
-                FromJsonUtilS(input["CatalogVersion"], CatalogVersion);
-                FromJsonUtilS(input["CustomData"], CustomData);
-                FromJsonUtilS(input["DisplayName"], DisplayName);
-                FromJsonUtilT(input["Expiration"], Expiration);
-                FromJsonUtilS(input["ItemClass"], ItemClass);
-                FromJsonUtilS(input["ItemId"], ItemId);
-                FromJsonUtilS(input["ItemInstanceId"], ItemInstanceId);
-                FromJsonUtilT(input["PurchaseDate"], PurchaseDate);
-                FromJsonUtilP(input["RemainingUses"], RemainingUses);
-                FromJsonUtilS(input["UnitCurrency"], UnitCurrency);
-                FromJsonUtilP(input["UnitPrice"], UnitPrice);
-                FromJsonUtilP(input["UsesIncrementedBy"], UsesIncrementedBy);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Annotation; ToJsonUtilS(Annotation, each_Annotation); output["Annotation"] = each_Annotation;
-                Json::Value each_BundleContents; ToJsonUtilS(BundleContents, each_BundleContents); output["BundleContents"] = each_BundleContents;
-                Json::Value each_BundleParent; ToJsonUtilS(BundleParent, each_BundleParent); output["BundleParent"] = each_BundleParent;
-                Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); output["CatalogVersion"] = each_CatalogVersion;
-                Json::Value each_CustomData; ToJsonUtilS(CustomData, each_CustomData); output["CustomData"] = each_CustomData;
-                Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); output["DisplayName"] = each_DisplayName;
-                Json::Value each_Expiration; ToJsonUtilT(Expiration, each_Expiration); output["Expiration"] = each_Expiration;
-                Json::Value each_ItemClass; ToJsonUtilS(ItemClass, each_ItemClass); output["ItemClass"] = each_ItemClass;
-                Json::Value each_ItemId; ToJsonUtilS(ItemId, each_ItemId); output["ItemId"] = each_ItemId;
-                Json::Value each_ItemInstanceId; ToJsonUtilS(ItemInstanceId, each_ItemInstanceId); output["ItemInstanceId"] = each_ItemInstanceId;
-                Json::Value each_PurchaseDate; ToJsonUtilT(PurchaseDate, each_PurchaseDate); output["PurchaseDate"] = each_PurchaseDate;
-                Json::Value each_RemainingUses; ToJsonUtilP(RemainingUses, each_RemainingUses); output["RemainingUses"] = each_RemainingUses;
-                Json::Value each_UnitCurrency; ToJsonUtilS(UnitCurrency, each_UnitCurrency); output["UnitCurrency"] = each_UnitCurrency;
-                Json::Value each_UnitPrice; ToJsonUtilP(UnitPrice, each_UnitPrice); output["UnitPrice"] = each_UnitPrice;
-                Json::Value each_UsesIncrementedBy; ToJsonUtilP(UsesIncrementedBy, each_UsesIncrementedBy); output["UsesIncrementedBy"] = each_UsesIncrementedBy;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct CharacterInventory : public PlayFabBaseModel
@@ -7545,19 +1592,9 @@ namespace PlayFab
 
             ~CharacterInventory() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CharacterId"], CharacterId);
-                FromJsonUtilO(input["Inventory"], Inventory);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); output["CharacterId"] = each_CharacterId;
-                Json::Value each_Inventory; ToJsonUtilO(Inventory, each_Inventory); output["Inventory"] = each_Inventory;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct CharacterLeaderboardEntry : public PlayFabBaseModel
@@ -7594,29 +1631,9 @@ namespace PlayFab
 
             ~CharacterLeaderboardEntry() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CharacterId"], CharacterId);
-                FromJsonUtilS(input["CharacterName"], CharacterName);
-                FromJsonUtilS(input["CharacterType"], CharacterType);
-                FromJsonUtilS(input["DisplayName"], DisplayName);
-                FromJsonUtilS(input["PlayFabId"], PlayFabId);
-                FromJsonUtilP(input["Position"], Position);
-                FromJsonUtilP(input["StatValue"], StatValue);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); output["CharacterId"] = each_CharacterId;
-                Json::Value each_CharacterName; ToJsonUtilS(CharacterName, each_CharacterName); output["CharacterName"] = each_CharacterName;
-                Json::Value each_CharacterType; ToJsonUtilS(CharacterType, each_CharacterType); output["CharacterType"] = each_CharacterType;
-                Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); output["DisplayName"] = each_DisplayName;
-                Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); output["PlayFabId"] = each_PlayFabId;
-                Json::Value each_Position; ToJsonUtilP(Position, each_Position); output["Position"] = each_Position;
-                Json::Value each_StatValue; ToJsonUtilP(StatValue, each_StatValue); output["StatValue"] = each_StatValue;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct CharacterResult : public PlayFabResultCommon
@@ -7641,21 +1658,9 @@ namespace PlayFab
 
             ~CharacterResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CharacterId"], CharacterId);
-                FromJsonUtilS(input["CharacterName"], CharacterName);
-                FromJsonUtilS(input["CharacterType"], CharacterType);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); output["CharacterId"] = each_CharacterId;
-                Json::Value each_CharacterName; ToJsonUtilS(CharacterName, each_CharacterName); output["CharacterName"] = each_CharacterName;
-                Json::Value each_CharacterType; ToJsonUtilS(CharacterType, each_CharacterType); output["CharacterType"] = each_CharacterType;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct Container_Dictionary_String_String : public PlayFabBaseModel
@@ -7674,17 +1679,9 @@ namespace PlayFab
 
             ~Container_Dictionary_String_String() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Data"], Data);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Data; ToJsonUtilS(Data, each_Data); output["Data"] = each_Data;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct CollectionFilter : public PlayFabBaseModel
@@ -7706,19 +1703,9 @@ namespace PlayFab
 
             ~CollectionFilter() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Excludes"], Excludes);
-                FromJsonUtilO(input["Includes"], Includes);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Excludes; ToJsonUtilO(Excludes, each_Excludes); output["Excludes"] = each_Excludes;
-                Json::Value each_Includes; ToJsonUtilO(Includes, each_Includes); output["Includes"] = each_Includes;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ConfirmPurchaseRequest : public PlayFabRequestCommon
@@ -7740,19 +1727,9 @@ namespace PlayFab
 
             ~ConfirmPurchaseRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["OrderId"], OrderId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_OrderId; ToJsonUtilS(OrderId, each_OrderId); output["OrderId"] = each_OrderId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ConfirmPurchaseResult : public PlayFabResultCommon
@@ -7777,21 +1754,9 @@ namespace PlayFab
 
             ~ConfirmPurchaseResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Items"], Items);
-                FromJsonUtilS(input["OrderId"], OrderId);
-                FromJsonUtilT(input["PurchaseDate"], PurchaseDate);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Items; ToJsonUtilO(Items, each_Items); output["Items"] = each_Items;
-                Json::Value each_OrderId; ToJsonUtilS(OrderId, each_OrderId); output["OrderId"] = each_OrderId;
-                Json::Value each_PurchaseDate; ToJsonUtilT(PurchaseDate, each_PurchaseDate); output["PurchaseDate"] = each_PurchaseDate;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ConsumeItemRequest : public PlayFabRequestCommon
@@ -7819,23 +1784,9 @@ namespace PlayFab
 
             ~ConsumeItemRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CharacterId"], CharacterId);
-                FromJsonUtilP(input["ConsumeCount"], ConsumeCount);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["ItemInstanceId"], ItemInstanceId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); output["CharacterId"] = each_CharacterId;
-                Json::Value each_ConsumeCount; ToJsonUtilP(ConsumeCount, each_ConsumeCount); output["ConsumeCount"] = each_ConsumeCount;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ItemInstanceId; ToJsonUtilS(ItemInstanceId, each_ItemInstanceId); output["ItemInstanceId"] = each_ItemInstanceId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct ConsumeItemResult : public PlayFabResultCommon
@@ -7857,19 +1808,9 @@ namespace PlayFab
 
             ~ConsumeItemResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["ItemInstanceId"], ItemInstanceId);
-                FromJsonUtilP(input["RemainingUses"], RemainingUses);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ItemInstanceId; ToJsonUtilS(ItemInstanceId, each_ItemInstanceId); output["ItemInstanceId"] = each_ItemInstanceId;
-                Json::Value each_RemainingUses; ToJsonUtilP(RemainingUses, each_RemainingUses); output["RemainingUses"] = each_RemainingUses;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct MicrosoftStorePayload : public PlayFabBaseModel
@@ -7894,21 +1835,9 @@ namespace PlayFab
 
             ~MicrosoftStorePayload() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CollectionsMsIdKey"], CollectionsMsIdKey);
-                FromJsonUtilS(input["UserId"], UserId);
-                FromJsonUtilS(input["XboxToken"], XboxToken);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CollectionsMsIdKey; ToJsonUtilS(CollectionsMsIdKey, each_CollectionsMsIdKey); output["CollectionsMsIdKey"] = each_CollectionsMsIdKey;
-                Json::Value each_UserId; ToJsonUtilS(UserId, each_UserId); output["UserId"] = each_UserId;
-                Json::Value each_XboxToken; ToJsonUtilS(XboxToken, each_XboxToken); output["XboxToken"] = each_XboxToken;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ConsumeMicrosoftStoreEntitlementsRequest : public PlayFabRequestCommon
@@ -7933,21 +1862,9 @@ namespace PlayFab
 
             ~ConsumeMicrosoftStoreEntitlementsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CatalogVersion"], CatalogVersion);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["MarketplaceSpecificData"], MarketplaceSpecificData);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); output["CatalogVersion"] = each_CatalogVersion;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_MarketplaceSpecificData; ToJsonUtilO(MarketplaceSpecificData, each_MarketplaceSpecificData); output["MarketplaceSpecificData"] = each_MarketplaceSpecificData;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ConsumeMicrosoftStoreEntitlementsResponse : public PlayFabResultCommon
@@ -7966,17 +1883,9 @@ namespace PlayFab
 
             ~ConsumeMicrosoftStoreEntitlementsResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Items"], Items);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Items; ToJsonUtilO(Items, each_Items); output["Items"] = each_Items;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct PlayStation5Payload : public PlayFabBaseModel
@@ -7998,19 +1907,9 @@ namespace PlayFab
 
             ~PlayStation5Payload() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Ids"], Ids);
-                FromJsonUtilS(input["ServiceLabel"], ServiceLabel);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Ids; ToJsonUtilS(Ids, each_Ids); output["Ids"] = each_Ids;
-                Json::Value each_ServiceLabel; ToJsonUtilS(ServiceLabel, each_ServiceLabel); output["ServiceLabel"] = each_ServiceLabel;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ConsumePS5EntitlementsRequest : public PlayFabRequestCommon
@@ -8035,21 +1934,9 @@ namespace PlayFab
 
             ~ConsumePS5EntitlementsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CatalogVersion"], CatalogVersion);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["MarketplaceSpecificData"], MarketplaceSpecificData);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); output["CatalogVersion"] = each_CatalogVersion;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_MarketplaceSpecificData; ToJsonUtilO(MarketplaceSpecificData, each_MarketplaceSpecificData); output["MarketplaceSpecificData"] = each_MarketplaceSpecificData;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ConsumePS5EntitlementsResult : public PlayFabResultCommon
@@ -8068,17 +1955,9 @@ namespace PlayFab
 
             ~ConsumePS5EntitlementsResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Items"], Items);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Items; ToJsonUtilO(Items, each_Items); output["Items"] = each_Items;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ConsumePSNEntitlementsRequest : public PlayFabRequestCommon
@@ -8103,21 +1982,9 @@ namespace PlayFab
 
             ~ConsumePSNEntitlementsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CatalogVersion"], CatalogVersion);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["ServiceLabel"], ServiceLabel);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); output["CatalogVersion"] = each_CatalogVersion;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ServiceLabel; ToJsonUtilP(ServiceLabel, each_ServiceLabel); output["ServiceLabel"] = each_ServiceLabel;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ConsumePSNEntitlementsResult : public PlayFabResultCommon
@@ -8136,17 +2003,9 @@ namespace PlayFab
 
             ~ConsumePSNEntitlementsResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["ItemsGranted"], ItemsGranted);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ItemsGranted; ToJsonUtilO(ItemsGranted, each_ItemsGranted); output["ItemsGranted"] = each_ItemsGranted;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ConsumeXboxEntitlementsRequest : public PlayFabRequestCommon
@@ -8171,21 +2030,9 @@ namespace PlayFab
 
             ~ConsumeXboxEntitlementsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CatalogVersion"], CatalogVersion);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["XboxToken"], XboxToken);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); output["CatalogVersion"] = each_CatalogVersion;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_XboxToken; ToJsonUtilS(XboxToken, each_XboxToken); output["XboxToken"] = each_XboxToken;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ConsumeXboxEntitlementsResult : public PlayFabResultCommon
@@ -8204,17 +2051,9 @@ namespace PlayFab
 
             ~ConsumeXboxEntitlementsResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Items"], Items);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Items; ToJsonUtilO(Items, each_Items); output["Items"] = each_Items;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ContactEmailInfoModel : public PlayFabBaseModel
@@ -8239,21 +2078,9 @@ namespace PlayFab
 
             ~ContactEmailInfoModel() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["EmailAddress"], EmailAddress);
-                FromJsonUtilS(input["Name"], Name);
-                FromJsonUtilE(input["VerificationStatus"], VerificationStatus);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_EmailAddress; ToJsonUtilS(EmailAddress, each_EmailAddress); output["EmailAddress"] = each_EmailAddress;
-                Json::Value each_Name; ToJsonUtilS(Name, each_Name); output["Name"] = each_Name;
-                Json::Value each_VerificationStatus; ToJsonUtilE(VerificationStatus, each_VerificationStatus); output["VerificationStatus"] = each_VerificationStatus;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct CreateSharedGroupRequest : public PlayFabRequestCommon
@@ -8272,17 +2099,9 @@ namespace PlayFab
 
             ~CreateSharedGroupRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["SharedGroupId"], SharedGroupId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_SharedGroupId; ToJsonUtilS(SharedGroupId, each_SharedGroupId); output["SharedGroupId"] = each_SharedGroupId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct CreateSharedGroupResult : public PlayFabResultCommon
@@ -8301,17 +2120,9 @@ namespace PlayFab
 
             ~CreateSharedGroupResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["SharedGroupId"], SharedGroupId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_SharedGroupId; ToJsonUtilS(SharedGroupId, each_SharedGroupId); output["SharedGroupId"] = each_SharedGroupId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct CurrentGamesRequest : public PlayFabRequestCommon
@@ -8342,25 +2153,9 @@ namespace PlayFab
 
             ~CurrentGamesRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["BuildVersion"], BuildVersion);
-                FromJsonUtilS(input["GameMode"], GameMode);
-                FromJsonUtilE(input["Region"], pfRegion);
-                FromJsonUtilS(input["StatisticName"], StatisticName);
-                FromJsonUtilO(input["TagFilter"], TagFilter);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_BuildVersion; ToJsonUtilS(BuildVersion, each_BuildVersion); output["BuildVersion"] = each_BuildVersion;
-                Json::Value each_GameMode; ToJsonUtilS(GameMode, each_GameMode); output["GameMode"] = each_GameMode;
-                Json::Value each_pfRegion; ToJsonUtilE(pfRegion, each_pfRegion); output["Region"] = each_pfRegion;
-                Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); output["StatisticName"] = each_StatisticName;
-                Json::Value each_TagFilter; ToJsonUtilO(TagFilter, each_TagFilter); output["TagFilter"] = each_TagFilter;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GameInfo : public PlayFabBaseModel
@@ -8424,47 +2219,9 @@ namespace PlayFab
 
             ~GameInfo() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["BuildVersion"], BuildVersion);
-                FromJsonUtilS(input["GameMode"], GameMode);
-                FromJsonUtilS(input["GameServerData"], GameServerData);
-                FromJsonUtilE(input["GameServerStateEnum"], GameServerStateEnum);
-                FromJsonUtilT(input["LastHeartbeat"], LastHeartbeat);
-                FromJsonUtilS(input["LobbyID"], LobbyID);
-                FromJsonUtilP(input["MaxPlayers"], MaxPlayers);
-                FromJsonUtilS(input["PlayerUserIds"], PlayerUserIds);
-                FromJsonUtilE(input["Region"], pfRegion);
-                FromJsonUtilP(input["RunTime"], RunTime);
-                FromJsonUtilS(input["ServerIPV4Address"], ServerIPV4Address);
-                FromJsonUtilS(input["ServerIPV6Address"], ServerIPV6Address);
-                FromJsonUtilP(input["ServerPort"], ServerPort);
-                FromJsonUtilS(input["ServerPublicDNSName"], ServerPublicDNSName);
-                FromJsonUtilS(input["StatisticName"], StatisticName);
-                FromJsonUtilS(input["Tags"], Tags);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_BuildVersion; ToJsonUtilS(BuildVersion, each_BuildVersion); output["BuildVersion"] = each_BuildVersion;
-                Json::Value each_GameMode; ToJsonUtilS(GameMode, each_GameMode); output["GameMode"] = each_GameMode;
-                Json::Value each_GameServerData; ToJsonUtilS(GameServerData, each_GameServerData); output["GameServerData"] = each_GameServerData;
-                Json::Value each_GameServerStateEnum; ToJsonUtilE(GameServerStateEnum, each_GameServerStateEnum); output["GameServerStateEnum"] = each_GameServerStateEnum;
-                Json::Value each_LastHeartbeat; ToJsonUtilT(LastHeartbeat, each_LastHeartbeat); output["LastHeartbeat"] = each_LastHeartbeat;
-                Json::Value each_LobbyID; ToJsonUtilS(LobbyID, each_LobbyID); output["LobbyID"] = each_LobbyID;
-                Json::Value each_MaxPlayers; ToJsonUtilP(MaxPlayers, each_MaxPlayers); output["MaxPlayers"] = each_MaxPlayers;
-                Json::Value each_PlayerUserIds; ToJsonUtilS(PlayerUserIds, each_PlayerUserIds); output["PlayerUserIds"] = each_PlayerUserIds;
-                Json::Value each_pfRegion; ToJsonUtilE(pfRegion, each_pfRegion); output["Region"] = each_pfRegion;
-                Json::Value each_RunTime; ToJsonUtilP(RunTime, each_RunTime); output["RunTime"] = each_RunTime;
-                Json::Value each_ServerIPV4Address; ToJsonUtilS(ServerIPV4Address, each_ServerIPV4Address); output["ServerIPV4Address"] = each_ServerIPV4Address;
-                Json::Value each_ServerIPV6Address; ToJsonUtilS(ServerIPV6Address, each_ServerIPV6Address); output["ServerIPV6Address"] = each_ServerIPV6Address;
-                Json::Value each_ServerPort; ToJsonUtilP(ServerPort, each_ServerPort); output["ServerPort"] = each_ServerPort;
-                Json::Value each_ServerPublicDNSName; ToJsonUtilS(ServerPublicDNSName, each_ServerPublicDNSName); output["ServerPublicDNSName"] = each_ServerPublicDNSName;
-                Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); output["StatisticName"] = each_StatisticName;
-                Json::Value each_Tags; ToJsonUtilS(Tags, each_Tags); output["Tags"] = each_Tags;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct CurrentGamesResult : public PlayFabResultCommon
@@ -8489,21 +2246,9 @@ namespace PlayFab
 
             ~CurrentGamesResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["GameCount"], GameCount);
-                FromJsonUtilO(input["Games"], Games);
-                FromJsonUtilP(input["PlayerCount"], PlayerCount);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_GameCount; ToJsonUtilP(GameCount, each_GameCount); output["GameCount"] = each_GameCount;
-                Json::Value each_Games; ToJsonUtilO(Games, each_Games); output["Games"] = each_Games;
-                Json::Value each_PlayerCount; ToJsonUtilP(PlayerCount, each_PlayerCount); output["PlayerCount"] = each_PlayerCount;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct DeviceInfoRequest : public PlayFabRequestCommon
@@ -8522,17 +2267,9 @@ namespace PlayFab
 
             ~DeviceInfoRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                Info = input["Info"];
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                output["Info"] = Info;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct EmptyResponse : public PlayFabResultCommon
@@ -8548,15 +2285,9 @@ namespace PlayFab
 
             ~EmptyResponse() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct EmptyResult : public PlayFabResultCommon
@@ -8572,15 +2303,9 @@ namespace PlayFab
 
             ~EmptyResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct EntityKey : public PlayFabBaseModel
@@ -8602,19 +2327,9 @@ namespace PlayFab
 
             ~EntityKey() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Id"], Id);
-                FromJsonUtilS(input["Type"], Type);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Id; ToJsonUtilS(Id, each_Id); output["Id"] = each_Id;
-                Json::Value each_Type; ToJsonUtilS(Type, each_Type); output["Type"] = each_Type;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct EntityTokenResponse : public PlayFabResultCommon
@@ -8639,21 +2354,9 @@ namespace PlayFab
 
             ~EntityTokenResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilS(input["EntityToken"], EntityToken);
-                FromJsonUtilT(input["TokenExpiration"], TokenExpiration);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_EntityToken; ToJsonUtilS(EntityToken, each_EntityToken); output["EntityToken"] = each_EntityToken;
-                Json::Value each_TokenExpiration; ToJsonUtilT(TokenExpiration, each_TokenExpiration); output["TokenExpiration"] = each_TokenExpiration;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ExecuteCloudScriptRequest : public PlayFabRequestCommon
@@ -8687,27 +2390,9 @@ namespace PlayFab
 
             ~ExecuteCloudScriptRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["FunctionName"], FunctionName);
-                FunctionParameter = input["FunctionParameter"];
-                FromJsonUtilP(input["GeneratePlayStreamEvent"], GeneratePlayStreamEvent);
-                FromJsonUtilE(input["RevisionSelection"], RevisionSelection);
-                FromJsonUtilP(input["SpecificRevision"], SpecificRevision);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_FunctionName; ToJsonUtilS(FunctionName, each_FunctionName); output["FunctionName"] = each_FunctionName;
-                output["FunctionParameter"] = FunctionParameter;
-                Json::Value each_GeneratePlayStreamEvent; ToJsonUtilP(GeneratePlayStreamEvent, each_GeneratePlayStreamEvent); output["GeneratePlayStreamEvent"] = each_GeneratePlayStreamEvent;
-                Json::Value each_RevisionSelection; ToJsonUtilE(RevisionSelection, each_RevisionSelection); output["RevisionSelection"] = each_RevisionSelection;
-                Json::Value each_SpecificRevision; ToJsonUtilP(SpecificRevision, each_SpecificRevision); output["SpecificRevision"] = each_SpecificRevision;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct ScriptExecutionError : public PlayFabBaseModel
@@ -8732,21 +2417,9 @@ namespace PlayFab
 
             ~ScriptExecutionError() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Error"], Error);
-                FromJsonUtilS(input["Message"], Message);
-                FromJsonUtilS(input["StackTrace"], StackTrace);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Error; ToJsonUtilS(Error, each_Error); output["Error"] = each_Error;
-                Json::Value each_Message; ToJsonUtilS(Message, each_Message); output["Message"] = each_Message;
-                Json::Value each_StackTrace; ToJsonUtilS(StackTrace, each_StackTrace); output["StackTrace"] = each_StackTrace;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct LogStatement : public PlayFabBaseModel
@@ -8771,21 +2444,9 @@ namespace PlayFab
 
             ~LogStatement() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                Data = input["Data"];
-                FromJsonUtilS(input["Level"], Level);
-                FromJsonUtilS(input["Message"], Message);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                output["Data"] = Data;
-                Json::Value each_Level; ToJsonUtilS(Level, each_Level); output["Level"] = each_Level;
-                Json::Value each_Message; ToJsonUtilS(Message, each_Message); output["Message"] = each_Message;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ExecuteCloudScriptResult : public PlayFabResultCommon
@@ -8837,39 +2498,9 @@ namespace PlayFab
 
             ~ExecuteCloudScriptResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["APIRequestsIssued"], APIRequestsIssued);
-                FromJsonUtilO(input["Error"], Error);
-                FromJsonUtilP(input["ExecutionTimeSeconds"], ExecutionTimeSeconds);
-                FromJsonUtilS(input["FunctionName"], FunctionName);
-                FunctionResult = input["FunctionResult"];
-                FromJsonUtilP(input["FunctionResultTooLarge"], FunctionResultTooLarge);
-                FromJsonUtilP(input["HttpRequestsIssued"], HttpRequestsIssued);
-                FromJsonUtilO(input["Logs"], Logs);
-                FromJsonUtilP(input["LogsTooLarge"], LogsTooLarge);
-                FromJsonUtilP(input["MemoryConsumedBytes"], MemoryConsumedBytes);
-                FromJsonUtilP(input["ProcessorTimeSeconds"], ProcessorTimeSeconds);
-                FromJsonUtilP(input["Revision"], Revision);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_APIRequestsIssued; ToJsonUtilP(APIRequestsIssued, each_APIRequestsIssued); output["APIRequestsIssued"] = each_APIRequestsIssued;
-                Json::Value each_Error; ToJsonUtilO(Error, each_Error); output["Error"] = each_Error;
-                Json::Value each_ExecutionTimeSeconds; ToJsonUtilP(ExecutionTimeSeconds, each_ExecutionTimeSeconds); output["ExecutionTimeSeconds"] = each_ExecutionTimeSeconds;
-                Json::Value each_FunctionName; ToJsonUtilS(FunctionName, each_FunctionName); output["FunctionName"] = each_FunctionName;
-                output["FunctionResult"] = FunctionResult;
-                Json::Value each_FunctionResultTooLarge; ToJsonUtilP(FunctionResultTooLarge, each_FunctionResultTooLarge); output["FunctionResultTooLarge"] = each_FunctionResultTooLarge;
-                Json::Value each_HttpRequestsIssued; ToJsonUtilP(HttpRequestsIssued, each_HttpRequestsIssued); output["HttpRequestsIssued"] = each_HttpRequestsIssued;
-                Json::Value each_Logs; ToJsonUtilO(Logs, each_Logs); output["Logs"] = each_Logs;
-                Json::Value each_LogsTooLarge; ToJsonUtilP(LogsTooLarge, each_LogsTooLarge); output["LogsTooLarge"] = each_LogsTooLarge;
-                Json::Value each_MemoryConsumedBytes; ToJsonUtilP(MemoryConsumedBytes, each_MemoryConsumedBytes); output["MemoryConsumedBytes"] = each_MemoryConsumedBytes;
-                Json::Value each_ProcessorTimeSeconds; ToJsonUtilP(ProcessorTimeSeconds, each_ProcessorTimeSeconds); output["ProcessorTimeSeconds"] = each_ProcessorTimeSeconds;
-                Json::Value each_Revision; ToJsonUtilP(Revision, each_Revision); output["Revision"] = each_Revision;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct FacebookInstantGamesPlayFabIdPair : public PlayFabBaseModel
@@ -8891,19 +2522,9 @@ namespace PlayFab
 
             ~FacebookInstantGamesPlayFabIdPair() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["FacebookInstantGamesId"], FacebookInstantGamesId);
-                FromJsonUtilS(input["PlayFabId"], PlayFabId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_FacebookInstantGamesId; ToJsonUtilS(FacebookInstantGamesId, each_FacebookInstantGamesId); output["FacebookInstantGamesId"] = each_FacebookInstantGamesId;
-                Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); output["PlayFabId"] = each_PlayFabId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct FacebookPlayFabIdPair : public PlayFabBaseModel
@@ -8925,19 +2546,9 @@ namespace PlayFab
 
             ~FacebookPlayFabIdPair() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["FacebookId"], FacebookId);
-                FromJsonUtilS(input["PlayFabId"], PlayFabId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_FacebookId; ToJsonUtilS(FacebookId, each_FacebookId); output["FacebookId"] = each_FacebookId;
-                Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); output["PlayFabId"] = each_PlayFabId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UserFacebookInfo : public PlayFabBaseModel
@@ -8959,19 +2570,9 @@ namespace PlayFab
 
             ~UserFacebookInfo() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["FacebookId"], FacebookId);
-                FromJsonUtilS(input["FullName"], FullName);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_FacebookId; ToJsonUtilS(FacebookId, each_FacebookId); output["FacebookId"] = each_FacebookId;
-                Json::Value each_FullName; ToJsonUtilS(FullName, each_FullName); output["FullName"] = each_FullName;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UserGameCenterInfo : public PlayFabBaseModel
@@ -8990,17 +2591,9 @@ namespace PlayFab
 
             ~UserGameCenterInfo() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["GameCenterId"], GameCenterId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_GameCenterId; ToJsonUtilS(GameCenterId, each_GameCenterId); output["GameCenterId"] = each_GameCenterId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct LinkedPlatformAccountModel : public PlayFabBaseModel
@@ -9028,23 +2621,9 @@ namespace PlayFab
 
             ~LinkedPlatformAccountModel() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Email"], Email);
-                FromJsonUtilE(input["Platform"], Platform);
-                FromJsonUtilS(input["PlatformUserId"], PlatformUserId);
-                FromJsonUtilS(input["Username"], Username);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Email; ToJsonUtilS(Email, each_Email); output["Email"] = each_Email;
-                Json::Value each_Platform; ToJsonUtilE(Platform, each_Platform); output["Platform"] = each_Platform;
-                Json::Value each_PlatformUserId; ToJsonUtilS(PlatformUserId, each_PlatformUserId); output["PlatformUserId"] = each_PlatformUserId;
-                Json::Value each_Username; ToJsonUtilS(Username, each_Username); output["Username"] = each_Username;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct LocationModel : public PlayFabBaseModel
@@ -9075,25 +2654,9 @@ namespace PlayFab
 
             ~LocationModel() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["City"], City);
-                FromJsonUtilE(input["ContinentCode"], pfContinentCode);
-                FromJsonUtilE(input["CountryCode"], pfCountryCode);
-                FromJsonUtilP(input["Latitude"], Latitude);
-                FromJsonUtilP(input["Longitude"], Longitude);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_City; ToJsonUtilS(City, each_City); output["City"] = each_City;
-                Json::Value each_pfContinentCode; ToJsonUtilE(pfContinentCode, each_pfContinentCode); output["ContinentCode"] = each_pfContinentCode;
-                Json::Value each_pfCountryCode; ToJsonUtilE(pfCountryCode, each_pfCountryCode); output["CountryCode"] = each_pfCountryCode;
-                Json::Value each_Latitude; ToJsonUtilP(Latitude, each_Latitude); output["Latitude"] = each_Latitude;
-                Json::Value each_Longitude; ToJsonUtilP(Longitude, each_Longitude); output["Longitude"] = each_Longitude;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct SubscriptionModel : public PlayFabBaseModel
@@ -9130,29 +2693,9 @@ namespace PlayFab
 
             ~SubscriptionModel() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilT(input["Expiration"], Expiration);
-                FromJsonUtilT(input["InitialSubscriptionTime"], InitialSubscriptionTime);
-                FromJsonUtilP(input["IsActive"], IsActive);
-                FromJsonUtilE(input["Status"], Status);
-                FromJsonUtilS(input["SubscriptionId"], SubscriptionId);
-                FromJsonUtilS(input["SubscriptionItemId"], SubscriptionItemId);
-                FromJsonUtilS(input["SubscriptionProvider"], SubscriptionProvider);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Expiration; ToJsonUtilT(Expiration, each_Expiration); output["Expiration"] = each_Expiration;
-                Json::Value each_InitialSubscriptionTime; ToJsonUtilT(InitialSubscriptionTime, each_InitialSubscriptionTime); output["InitialSubscriptionTime"] = each_InitialSubscriptionTime;
-                Json::Value each_IsActive; ToJsonUtilP(IsActive, each_IsActive); output["IsActive"] = each_IsActive;
-                Json::Value each_Status; ToJsonUtilE(Status, each_Status); output["Status"] = each_Status;
-                Json::Value each_SubscriptionId; ToJsonUtilS(SubscriptionId, each_SubscriptionId); output["SubscriptionId"] = each_SubscriptionId;
-                Json::Value each_SubscriptionItemId; ToJsonUtilS(SubscriptionItemId, each_SubscriptionItemId); output["SubscriptionItemId"] = each_SubscriptionItemId;
-                Json::Value each_SubscriptionProvider; ToJsonUtilS(SubscriptionProvider, each_SubscriptionProvider); output["SubscriptionProvider"] = each_SubscriptionProvider;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct MembershipModel : public PlayFabBaseModel
@@ -9183,25 +2726,9 @@ namespace PlayFab
 
             ~MembershipModel() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["IsActive"], IsActive);
-                FromJsonUtilT(input["MembershipExpiration"], MembershipExpiration);
-                FromJsonUtilS(input["MembershipId"], MembershipId);
-                FromJsonUtilT(input["OverrideExpiration"], OverrideExpiration);
-                FromJsonUtilO(input["Subscriptions"], Subscriptions);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_IsActive; ToJsonUtilP(IsActive, each_IsActive); output["IsActive"] = each_IsActive;
-                Json::Value each_MembershipExpiration; ToJsonUtilT(MembershipExpiration, each_MembershipExpiration); output["MembershipExpiration"] = each_MembershipExpiration;
-                Json::Value each_MembershipId; ToJsonUtilS(MembershipId, each_MembershipId); output["MembershipId"] = each_MembershipId;
-                Json::Value each_OverrideExpiration; ToJsonUtilT(OverrideExpiration, each_OverrideExpiration); output["OverrideExpiration"] = each_OverrideExpiration;
-                Json::Value each_Subscriptions; ToJsonUtilO(Subscriptions, each_Subscriptions); output["Subscriptions"] = each_Subscriptions;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct PushNotificationRegistrationModel : public PlayFabBaseModel
@@ -9223,19 +2750,9 @@ namespace PlayFab
 
             ~PushNotificationRegistrationModel() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["NotificationEndpointARN"], NotificationEndpointARN);
-                FromJsonUtilE(input["Platform"], Platform);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_NotificationEndpointARN; ToJsonUtilS(NotificationEndpointARN, each_NotificationEndpointARN); output["NotificationEndpointARN"] = each_NotificationEndpointARN;
-                Json::Value each_Platform; ToJsonUtilE(Platform, each_Platform); output["Platform"] = each_Platform;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct StatisticModel : public PlayFabBaseModel
@@ -9260,21 +2777,9 @@ namespace PlayFab
 
             ~StatisticModel() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Name"], Name);
-                FromJsonUtilP(input["Value"], Value);
-                FromJsonUtilP(input["Version"], Version);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Name; ToJsonUtilS(Name, each_Name); output["Name"] = each_Name;
-                Json::Value each_Value; ToJsonUtilP(Value, each_Value); output["Value"] = each_Value;
-                Json::Value each_Version; ToJsonUtilP(Version, each_Version); output["Version"] = each_Version;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct TagModel : public PlayFabBaseModel
@@ -9293,17 +2798,9 @@ namespace PlayFab
 
             ~TagModel() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["TagValue"], TagValue);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_TagValue; ToJsonUtilS(TagValue, each_TagValue); output["TagValue"] = each_TagValue;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ValueToDateModel : public PlayFabBaseModel
@@ -9328,21 +2825,9 @@ namespace PlayFab
 
             ~ValueToDateModel() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Currency"], Currency);
-                FromJsonUtilP(input["TotalValue"], TotalValue);
-                FromJsonUtilS(input["TotalValueAsDecimal"], TotalValueAsDecimal);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Currency; ToJsonUtilS(Currency, each_Currency); output["Currency"] = each_Currency;
-                Json::Value each_TotalValue; ToJsonUtilP(TotalValue, each_TotalValue); output["TotalValue"] = each_TotalValue;
-                Json::Value each_TotalValueAsDecimal; ToJsonUtilS(TotalValueAsDecimal, each_TotalValueAsDecimal); output["TotalValueAsDecimal"] = each_TotalValueAsDecimal;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct PlayerProfileModel : public PlayFabBaseModel
@@ -9418,55 +2903,9 @@ namespace PlayFab
 
             ~PlayerProfileModel() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["AdCampaignAttributions"], AdCampaignAttributions);
-                FromJsonUtilS(input["AvatarUrl"], AvatarUrl);
-                FromJsonUtilT(input["BannedUntil"], BannedUntil);
-                FromJsonUtilO(input["ContactEmailAddresses"], ContactEmailAddresses);
-                FromJsonUtilT(input["Created"], Created);
-                FromJsonUtilS(input["DisplayName"], DisplayName);
-                FromJsonUtilS(input["ExperimentVariants"], ExperimentVariants);
-                FromJsonUtilT(input["LastLogin"], LastLogin);
-                FromJsonUtilO(input["LinkedAccounts"], LinkedAccounts);
-                FromJsonUtilO(input["Locations"], Locations);
-                FromJsonUtilO(input["Memberships"], Memberships);
-                FromJsonUtilE(input["Origination"], Origination);
-                FromJsonUtilS(input["PlayerId"], PlayerId);
-                FromJsonUtilS(input["PublisherId"], PublisherId);
-                FromJsonUtilO(input["PushNotificationRegistrations"], PushNotificationRegistrations);
-                FromJsonUtilO(input["Statistics"], Statistics);
-                FromJsonUtilO(input["Tags"], Tags);
-                FromJsonUtilS(input["TitleId"], TitleId);
-                FromJsonUtilP(input["TotalValueToDateInUSD"], TotalValueToDateInUSD);
-                FromJsonUtilO(input["ValuesToDate"], ValuesToDate);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AdCampaignAttributions; ToJsonUtilO(AdCampaignAttributions, each_AdCampaignAttributions); output["AdCampaignAttributions"] = each_AdCampaignAttributions;
-                Json::Value each_AvatarUrl; ToJsonUtilS(AvatarUrl, each_AvatarUrl); output["AvatarUrl"] = each_AvatarUrl;
-                Json::Value each_BannedUntil; ToJsonUtilT(BannedUntil, each_BannedUntil); output["BannedUntil"] = each_BannedUntil;
-                Json::Value each_ContactEmailAddresses; ToJsonUtilO(ContactEmailAddresses, each_ContactEmailAddresses); output["ContactEmailAddresses"] = each_ContactEmailAddresses;
-                Json::Value each_Created; ToJsonUtilT(Created, each_Created); output["Created"] = each_Created;
-                Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); output["DisplayName"] = each_DisplayName;
-                Json::Value each_ExperimentVariants; ToJsonUtilS(ExperimentVariants, each_ExperimentVariants); output["ExperimentVariants"] = each_ExperimentVariants;
-                Json::Value each_LastLogin; ToJsonUtilT(LastLogin, each_LastLogin); output["LastLogin"] = each_LastLogin;
-                Json::Value each_LinkedAccounts; ToJsonUtilO(LinkedAccounts, each_LinkedAccounts); output["LinkedAccounts"] = each_LinkedAccounts;
-                Json::Value each_Locations; ToJsonUtilO(Locations, each_Locations); output["Locations"] = each_Locations;
-                Json::Value each_Memberships; ToJsonUtilO(Memberships, each_Memberships); output["Memberships"] = each_Memberships;
-                Json::Value each_Origination; ToJsonUtilE(Origination, each_Origination); output["Origination"] = each_Origination;
-                Json::Value each_PlayerId; ToJsonUtilS(PlayerId, each_PlayerId); output["PlayerId"] = each_PlayerId;
-                Json::Value each_PublisherId; ToJsonUtilS(PublisherId, each_PublisherId); output["PublisherId"] = each_PublisherId;
-                Json::Value each_PushNotificationRegistrations; ToJsonUtilO(PushNotificationRegistrations, each_PushNotificationRegistrations); output["PushNotificationRegistrations"] = each_PushNotificationRegistrations;
-                Json::Value each_Statistics; ToJsonUtilO(Statistics, each_Statistics); output["Statistics"] = each_Statistics;
-                Json::Value each_Tags; ToJsonUtilO(Tags, each_Tags); output["Tags"] = each_Tags;
-                Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); output["TitleId"] = each_TitleId;
-                Json::Value each_TotalValueToDateInUSD; ToJsonUtilP(TotalValueToDateInUSD, each_TotalValueToDateInUSD); output["TotalValueToDateInUSD"] = each_TotalValueToDateInUSD;
-                Json::Value each_ValuesToDate; ToJsonUtilO(ValuesToDate, each_ValuesToDate); output["ValuesToDate"] = each_ValuesToDate;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct UserPsnInfo : public PlayFabBaseModel
@@ -9488,19 +2927,9 @@ namespace PlayFab
 
             ~UserPsnInfo() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["PsnAccountId"], PsnAccountId);
-                FromJsonUtilS(input["PsnOnlineId"], PsnOnlineId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_PsnAccountId; ToJsonUtilS(PsnAccountId, each_PsnAccountId); output["PsnAccountId"] = each_PsnAccountId;
-                Json::Value each_PsnOnlineId; ToJsonUtilS(PsnOnlineId, each_PsnOnlineId); output["PsnOnlineId"] = each_PsnOnlineId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UserSteamInfo : public PlayFabBaseModel
@@ -9531,25 +2960,9 @@ namespace PlayFab
 
             ~UserSteamInfo() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilE(input["SteamActivationStatus"], SteamActivationStatus);
-                FromJsonUtilS(input["SteamCountry"], SteamCountry);
-                FromJsonUtilE(input["SteamCurrency"], SteamCurrency);
-                FromJsonUtilS(input["SteamId"], SteamId);
-                FromJsonUtilS(input["SteamName"], SteamName);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_SteamActivationStatus; ToJsonUtilE(SteamActivationStatus, each_SteamActivationStatus); output["SteamActivationStatus"] = each_SteamActivationStatus;
-                Json::Value each_SteamCountry; ToJsonUtilS(SteamCountry, each_SteamCountry); output["SteamCountry"] = each_SteamCountry;
-                Json::Value each_SteamCurrency; ToJsonUtilE(SteamCurrency, each_SteamCurrency); output["SteamCurrency"] = each_SteamCurrency;
-                Json::Value each_SteamId; ToJsonUtilS(SteamId, each_SteamId); output["SteamId"] = each_SteamId;
-                Json::Value each_SteamName; ToJsonUtilS(SteamName, each_SteamName); output["SteamName"] = each_SteamName;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct UserXboxInfo : public PlayFabBaseModel
@@ -9568,17 +2981,9 @@ namespace PlayFab
 
             ~UserXboxInfo() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["XboxUserId"], XboxUserId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_XboxUserId; ToJsonUtilS(XboxUserId, each_XboxUserId); output["XboxUserId"] = each_XboxUserId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct FriendInfo : public PlayFabBaseModel
@@ -9624,35 +3029,9 @@ namespace PlayFab
 
             ~FriendInfo() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["FacebookInfo"], FacebookInfo);
-                FromJsonUtilS(input["FriendPlayFabId"], FriendPlayFabId);
-                FromJsonUtilO(input["GameCenterInfo"], GameCenterInfo);
-                FromJsonUtilO(input["Profile"], Profile);
-                FromJsonUtilO(input["PSNInfo"], PSNInfo);
-                FromJsonUtilO(input["SteamInfo"], SteamInfo);
-                FromJsonUtilS(input["Tags"], Tags);
-                FromJsonUtilS(input["TitleDisplayName"], TitleDisplayName);
-                FromJsonUtilS(input["Username"], Username);
-                FromJsonUtilO(input["XboxInfo"], XboxInfo);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_FacebookInfo; ToJsonUtilO(FacebookInfo, each_FacebookInfo); output["FacebookInfo"] = each_FacebookInfo;
-                Json::Value each_FriendPlayFabId; ToJsonUtilS(FriendPlayFabId, each_FriendPlayFabId); output["FriendPlayFabId"] = each_FriendPlayFabId;
-                Json::Value each_GameCenterInfo; ToJsonUtilO(GameCenterInfo, each_GameCenterInfo); output["GameCenterInfo"] = each_GameCenterInfo;
-                Json::Value each_Profile; ToJsonUtilO(Profile, each_Profile); output["Profile"] = each_Profile;
-                Json::Value each_PSNInfo; ToJsonUtilO(PSNInfo, each_PSNInfo); output["PSNInfo"] = each_PSNInfo;
-                Json::Value each_SteamInfo; ToJsonUtilO(SteamInfo, each_SteamInfo); output["SteamInfo"] = each_SteamInfo;
-                Json::Value each_Tags; ToJsonUtilS(Tags, each_Tags); output["Tags"] = each_Tags;
-                Json::Value each_TitleDisplayName; ToJsonUtilS(TitleDisplayName, each_TitleDisplayName); output["TitleDisplayName"] = each_TitleDisplayName;
-                Json::Value each_Username; ToJsonUtilS(Username, each_Username); output["Username"] = each_Username;
-                Json::Value each_XboxInfo; ToJsonUtilO(XboxInfo, each_XboxInfo); output["XboxInfo"] = each_XboxInfo;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GameCenterPlayFabIdPair : public PlayFabBaseModel
@@ -9674,19 +3053,9 @@ namespace PlayFab
 
             ~GameCenterPlayFabIdPair() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["GameCenterId"], GameCenterId);
-                FromJsonUtilS(input["PlayFabId"], PlayFabId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_GameCenterId; ToJsonUtilS(GameCenterId, each_GameCenterId); output["GameCenterId"] = each_GameCenterId;
-                Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); output["PlayFabId"] = each_PlayFabId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GameServerRegionsRequest : public PlayFabRequestCommon
@@ -9708,19 +3077,9 @@ namespace PlayFab
 
             ~GameServerRegionsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["BuildVersion"], BuildVersion);
-                FromJsonUtilS(input["TitleId"], TitleId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_BuildVersion; ToJsonUtilS(BuildVersion, each_BuildVersion); output["BuildVersion"] = each_BuildVersion;
-                Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); output["TitleId"] = each_TitleId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct RegionInfo : public PlayFabBaseModel
@@ -9748,23 +3107,9 @@ namespace PlayFab
 
             ~RegionInfo() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["Available"], Available);
-                FromJsonUtilS(input["Name"], Name);
-                FromJsonUtilS(input["PingUrl"], PingUrl);
-                FromJsonUtilE(input["Region"], pfRegion);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Available; ToJsonUtilP(Available, each_Available); output["Available"] = each_Available;
-                Json::Value each_Name; ToJsonUtilS(Name, each_Name); output["Name"] = each_Name;
-                Json::Value each_PingUrl; ToJsonUtilS(PingUrl, each_PingUrl); output["PingUrl"] = each_PingUrl;
-                Json::Value each_pfRegion; ToJsonUtilE(pfRegion, each_pfRegion); output["Region"] = each_pfRegion;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GameServerRegionsResult : public PlayFabResultCommon
@@ -9783,17 +3128,9 @@ namespace PlayFab
 
             ~GameServerRegionsResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Regions"], Regions);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Regions; ToJsonUtilO(Regions, each_Regions); output["Regions"] = each_Regions;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GenericPlayFabIdPair : public PlayFabBaseModel
@@ -9815,19 +3152,9 @@ namespace PlayFab
 
             ~GenericPlayFabIdPair() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["GenericId"], GenericId);
-                FromJsonUtilS(input["PlayFabId"], PlayFabId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_GenericId; ToJsonUtilO(GenericId, each_GenericId); output["GenericId"] = each_GenericId;
-                Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); output["PlayFabId"] = each_PlayFabId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetAccountInfoRequest : public PlayFabRequestCommon
@@ -9855,23 +3182,9 @@ namespace PlayFab
 
             ~GetAccountInfoRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Email"], Email);
-                FromJsonUtilS(input["PlayFabId"], PlayFabId);
-                FromJsonUtilS(input["TitleDisplayName"], TitleDisplayName);
-                FromJsonUtilS(input["Username"], Username);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Email; ToJsonUtilS(Email, each_Email); output["Email"] = each_Email;
-                Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); output["PlayFabId"] = each_PlayFabId;
-                Json::Value each_TitleDisplayName; ToJsonUtilS(TitleDisplayName, each_TitleDisplayName); output["TitleDisplayName"] = each_TitleDisplayName;
-                Json::Value each_Username; ToJsonUtilS(Username, each_Username); output["Username"] = each_Username;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct UserAndroidDeviceInfo : public PlayFabBaseModel
@@ -9890,17 +3203,9 @@ namespace PlayFab
 
             ~UserAndroidDeviceInfo() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["AndroidDeviceId"], AndroidDeviceId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AndroidDeviceId; ToJsonUtilS(AndroidDeviceId, each_AndroidDeviceId); output["AndroidDeviceId"] = each_AndroidDeviceId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UserAppleIdInfo : public PlayFabBaseModel
@@ -9919,17 +3224,9 @@ namespace PlayFab
 
             ~UserAppleIdInfo() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["AppleSubjectId"], AppleSubjectId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AppleSubjectId; ToJsonUtilS(AppleSubjectId, each_AppleSubjectId); output["AppleSubjectId"] = each_AppleSubjectId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UserCustomIdInfo : public PlayFabBaseModel
@@ -9948,17 +3245,9 @@ namespace PlayFab
 
             ~UserCustomIdInfo() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomId"], CustomId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomId; ToJsonUtilS(CustomId, each_CustomId); output["CustomId"] = each_CustomId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UserFacebookInstantGamesIdInfo : public PlayFabBaseModel
@@ -9977,17 +3266,9 @@ namespace PlayFab
 
             ~UserFacebookInstantGamesIdInfo() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["FacebookInstantGamesId"], FacebookInstantGamesId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_FacebookInstantGamesId; ToJsonUtilS(FacebookInstantGamesId, each_FacebookInstantGamesId); output["FacebookInstantGamesId"] = each_FacebookInstantGamesId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UserGoogleInfo : public PlayFabBaseModel
@@ -10018,25 +3299,9 @@ namespace PlayFab
 
             ~UserGoogleInfo() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["GoogleEmail"], GoogleEmail);
-                FromJsonUtilS(input["GoogleGender"], GoogleGender);
-                FromJsonUtilS(input["GoogleId"], GoogleId);
-                FromJsonUtilS(input["GoogleLocale"], GoogleLocale);
-                FromJsonUtilS(input["GoogleName"], GoogleName);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_GoogleEmail; ToJsonUtilS(GoogleEmail, each_GoogleEmail); output["GoogleEmail"] = each_GoogleEmail;
-                Json::Value each_GoogleGender; ToJsonUtilS(GoogleGender, each_GoogleGender); output["GoogleGender"] = each_GoogleGender;
-                Json::Value each_GoogleId; ToJsonUtilS(GoogleId, each_GoogleId); output["GoogleId"] = each_GoogleId;
-                Json::Value each_GoogleLocale; ToJsonUtilS(GoogleLocale, each_GoogleLocale); output["GoogleLocale"] = each_GoogleLocale;
-                Json::Value each_GoogleName; ToJsonUtilS(GoogleName, each_GoogleName); output["GoogleName"] = each_GoogleName;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct UserIosDeviceInfo : public PlayFabBaseModel
@@ -10055,17 +3320,9 @@ namespace PlayFab
 
             ~UserIosDeviceInfo() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["IosDeviceId"], IosDeviceId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_IosDeviceId; ToJsonUtilS(IosDeviceId, each_IosDeviceId); output["IosDeviceId"] = each_IosDeviceId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UserKongregateInfo : public PlayFabBaseModel
@@ -10087,19 +3344,9 @@ namespace PlayFab
 
             ~UserKongregateInfo() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["KongregateId"], KongregateId);
-                FromJsonUtilS(input["KongregateName"], KongregateName);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_KongregateId; ToJsonUtilS(KongregateId, each_KongregateId); output["KongregateId"] = each_KongregateId;
-                Json::Value each_KongregateName; ToJsonUtilS(KongregateName, each_KongregateName); output["KongregateName"] = each_KongregateName;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UserNintendoSwitchAccountIdInfo : public PlayFabBaseModel
@@ -10118,17 +3365,9 @@ namespace PlayFab
 
             ~UserNintendoSwitchAccountIdInfo() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["NintendoSwitchAccountSubjectId"], NintendoSwitchAccountSubjectId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_NintendoSwitchAccountSubjectId; ToJsonUtilS(NintendoSwitchAccountSubjectId, each_NintendoSwitchAccountSubjectId); output["NintendoSwitchAccountSubjectId"] = each_NintendoSwitchAccountSubjectId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UserNintendoSwitchDeviceIdInfo : public PlayFabBaseModel
@@ -10147,17 +3386,9 @@ namespace PlayFab
 
             ~UserNintendoSwitchDeviceIdInfo() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["NintendoSwitchDeviceId"], NintendoSwitchDeviceId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_NintendoSwitchDeviceId; ToJsonUtilS(NintendoSwitchDeviceId, each_NintendoSwitchDeviceId); output["NintendoSwitchDeviceId"] = each_NintendoSwitchDeviceId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UserOpenIdInfo : public PlayFabBaseModel
@@ -10182,21 +3413,9 @@ namespace PlayFab
 
             ~UserOpenIdInfo() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["ConnectionId"], ConnectionId);
-                FromJsonUtilS(input["Issuer"], Issuer);
-                FromJsonUtilS(input["Subject"], Subject);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ConnectionId; ToJsonUtilS(ConnectionId, each_ConnectionId); output["ConnectionId"] = each_ConnectionId;
-                Json::Value each_Issuer; ToJsonUtilS(Issuer, each_Issuer); output["Issuer"] = each_Issuer;
-                Json::Value each_Subject; ToJsonUtilS(Subject, each_Subject); output["Subject"] = each_Subject;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UserPrivateAccountInfo : public PlayFabBaseModel
@@ -10215,17 +3434,9 @@ namespace PlayFab
 
             ~UserPrivateAccountInfo() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Email"], Email);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Email; ToJsonUtilS(Email, each_Email); output["Email"] = each_Email;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UserTitleInfo : public PlayFabBaseModel
@@ -10265,31 +3476,9 @@ namespace PlayFab
 
             ~UserTitleInfo() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["AvatarUrl"], AvatarUrl);
-                FromJsonUtilT(input["Created"], Created);
-                FromJsonUtilS(input["DisplayName"], DisplayName);
-                FromJsonUtilT(input["FirstLogin"], FirstLogin);
-                FromJsonUtilP(input["isBanned"], isBanned);
-                FromJsonUtilT(input["LastLogin"], LastLogin);
-                FromJsonUtilE(input["Origination"], Origination);
-                FromJsonUtilO(input["TitlePlayerAccount"], TitlePlayerAccount);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AvatarUrl; ToJsonUtilS(AvatarUrl, each_AvatarUrl); output["AvatarUrl"] = each_AvatarUrl;
-                Json::Value each_Created; ToJsonUtilT(Created, each_Created); output["Created"] = each_Created;
-                Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); output["DisplayName"] = each_DisplayName;
-                Json::Value each_FirstLogin; ToJsonUtilT(FirstLogin, each_FirstLogin); output["FirstLogin"] = each_FirstLogin;
-                Json::Value each_isBanned; ToJsonUtilP(isBanned, each_isBanned); output["isBanned"] = each_isBanned;
-                Json::Value each_LastLogin; ToJsonUtilT(LastLogin, each_LastLogin); output["LastLogin"] = each_LastLogin;
-                Json::Value each_Origination; ToJsonUtilE(Origination, each_Origination); output["Origination"] = each_Origination;
-                Json::Value each_TitlePlayerAccount; ToJsonUtilO(TitlePlayerAccount, each_TitlePlayerAccount); output["TitlePlayerAccount"] = each_TitlePlayerAccount;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct UserTwitchInfo : public PlayFabBaseModel
@@ -10311,19 +3500,9 @@ namespace PlayFab
 
             ~UserTwitchInfo() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["TwitchId"], TwitchId);
-                FromJsonUtilS(input["TwitchUserName"], TwitchUserName);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_TwitchId; ToJsonUtilS(TwitchId, each_TwitchId); output["TwitchId"] = each_TwitchId;
-                Json::Value each_TwitchUserName; ToJsonUtilS(TwitchUserName, each_TwitchUserName); output["TwitchUserName"] = each_TwitchUserName;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UserWindowsHelloInfo : public PlayFabBaseModel
@@ -10345,19 +3524,9 @@ namespace PlayFab
 
             ~UserWindowsHelloInfo() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["WindowsHelloDeviceName"], WindowsHelloDeviceName);
-                FromJsonUtilS(input["WindowsHelloPublicKeyHash"], WindowsHelloPublicKeyHash);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_WindowsHelloDeviceName; ToJsonUtilS(WindowsHelloDeviceName, each_WindowsHelloDeviceName); output["WindowsHelloDeviceName"] = each_WindowsHelloDeviceName;
-                Json::Value each_WindowsHelloPublicKeyHash; ToJsonUtilS(WindowsHelloPublicKeyHash, each_WindowsHelloPublicKeyHash); output["WindowsHelloPublicKeyHash"] = each_WindowsHelloPublicKeyHash;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UserAccountInfo : public PlayFabBaseModel
@@ -10439,59 +3608,9 @@ namespace PlayFab
 
             ~UserAccountInfo() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["AndroidDeviceInfo"], AndroidDeviceInfo);
-                FromJsonUtilO(input["AppleAccountInfo"], AppleAccountInfo);
-                FromJsonUtilT(input["Created"], Created);
-                FromJsonUtilO(input["CustomIdInfo"], CustomIdInfo);
-                FromJsonUtilO(input["FacebookInfo"], FacebookInfo);
-                FromJsonUtilO(input["FacebookInstantGamesIdInfo"], FacebookInstantGamesIdInfo);
-                FromJsonUtilO(input["GameCenterInfo"], GameCenterInfo);
-                FromJsonUtilO(input["GoogleInfo"], GoogleInfo);
-                FromJsonUtilO(input["IosDeviceInfo"], IosDeviceInfo);
-                FromJsonUtilO(input["KongregateInfo"], KongregateInfo);
-                FromJsonUtilO(input["NintendoSwitchAccountInfo"], NintendoSwitchAccountInfo);
-                FromJsonUtilO(input["NintendoSwitchDeviceIdInfo"], NintendoSwitchDeviceIdInfo);
-                FromJsonUtilO(input["OpenIdInfo"], OpenIdInfo);
-                FromJsonUtilS(input["PlayFabId"], PlayFabId);
-                FromJsonUtilO(input["PrivateInfo"], PrivateInfo);
-                FromJsonUtilO(input["PsnInfo"], PsnInfo);
-                FromJsonUtilO(input["SteamInfo"], SteamInfo);
-                FromJsonUtilO(input["TitleInfo"], TitleInfo);
-                FromJsonUtilO(input["TwitchInfo"], TwitchInfo);
-                FromJsonUtilS(input["Username"], Username);
-                FromJsonUtilO(input["WindowsHelloInfo"], WindowsHelloInfo);
-                FromJsonUtilO(input["XboxInfo"], XboxInfo);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AndroidDeviceInfo; ToJsonUtilO(AndroidDeviceInfo, each_AndroidDeviceInfo); output["AndroidDeviceInfo"] = each_AndroidDeviceInfo;
-                Json::Value each_AppleAccountInfo; ToJsonUtilO(AppleAccountInfo, each_AppleAccountInfo); output["AppleAccountInfo"] = each_AppleAccountInfo;
-                Json::Value each_Created; ToJsonUtilT(Created, each_Created); output["Created"] = each_Created;
-                Json::Value each_CustomIdInfo; ToJsonUtilO(CustomIdInfo, each_CustomIdInfo); output["CustomIdInfo"] = each_CustomIdInfo;
-                Json::Value each_FacebookInfo; ToJsonUtilO(FacebookInfo, each_FacebookInfo); output["FacebookInfo"] = each_FacebookInfo;
-                Json::Value each_FacebookInstantGamesIdInfo; ToJsonUtilO(FacebookInstantGamesIdInfo, each_FacebookInstantGamesIdInfo); output["FacebookInstantGamesIdInfo"] = each_FacebookInstantGamesIdInfo;
-                Json::Value each_GameCenterInfo; ToJsonUtilO(GameCenterInfo, each_GameCenterInfo); output["GameCenterInfo"] = each_GameCenterInfo;
-                Json::Value each_GoogleInfo; ToJsonUtilO(GoogleInfo, each_GoogleInfo); output["GoogleInfo"] = each_GoogleInfo;
-                Json::Value each_IosDeviceInfo; ToJsonUtilO(IosDeviceInfo, each_IosDeviceInfo); output["IosDeviceInfo"] = each_IosDeviceInfo;
-                Json::Value each_KongregateInfo; ToJsonUtilO(KongregateInfo, each_KongregateInfo); output["KongregateInfo"] = each_KongregateInfo;
-                Json::Value each_NintendoSwitchAccountInfo; ToJsonUtilO(NintendoSwitchAccountInfo, each_NintendoSwitchAccountInfo); output["NintendoSwitchAccountInfo"] = each_NintendoSwitchAccountInfo;
-                Json::Value each_NintendoSwitchDeviceIdInfo; ToJsonUtilO(NintendoSwitchDeviceIdInfo, each_NintendoSwitchDeviceIdInfo); output["NintendoSwitchDeviceIdInfo"] = each_NintendoSwitchDeviceIdInfo;
-                Json::Value each_OpenIdInfo; ToJsonUtilO(OpenIdInfo, each_OpenIdInfo); output["OpenIdInfo"] = each_OpenIdInfo;
-                Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); output["PlayFabId"] = each_PlayFabId;
-                Json::Value each_PrivateInfo; ToJsonUtilO(PrivateInfo, each_PrivateInfo); output["PrivateInfo"] = each_PrivateInfo;
-                Json::Value each_PsnInfo; ToJsonUtilO(PsnInfo, each_PsnInfo); output["PsnInfo"] = each_PsnInfo;
-                Json::Value each_SteamInfo; ToJsonUtilO(SteamInfo, each_SteamInfo); output["SteamInfo"] = each_SteamInfo;
-                Json::Value each_TitleInfo; ToJsonUtilO(TitleInfo, each_TitleInfo); output["TitleInfo"] = each_TitleInfo;
-                Json::Value each_TwitchInfo; ToJsonUtilO(TwitchInfo, each_TwitchInfo); output["TwitchInfo"] = each_TwitchInfo;
-                Json::Value each_Username; ToJsonUtilS(Username, each_Username); output["Username"] = each_Username;
-                Json::Value each_WindowsHelloInfo; ToJsonUtilO(WindowsHelloInfo, each_WindowsHelloInfo); output["WindowsHelloInfo"] = each_WindowsHelloInfo;
-                Json::Value each_XboxInfo; ToJsonUtilO(XboxInfo, each_XboxInfo); output["XboxInfo"] = each_XboxInfo;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetAccountInfoResult : public PlayFabResultCommon
@@ -10510,17 +3629,9 @@ namespace PlayFab
 
             ~GetAccountInfoResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["AccountInfo"], AccountInfo);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AccountInfo; ToJsonUtilO(AccountInfo, each_AccountInfo); output["AccountInfo"] = each_AccountInfo;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct NameIdentifier : public PlayFabBaseModel
@@ -10542,19 +3653,9 @@ namespace PlayFab
 
             ~NameIdentifier() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Id"], Id);
-                FromJsonUtilS(input["Name"], Name);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Id; ToJsonUtilS(Id, each_Id); output["Id"] = each_Id;
-                Json::Value each_Name; ToJsonUtilS(Name, each_Name); output["Name"] = each_Name;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetAdPlacementsRequest : public PlayFabRequestCommon
@@ -10576,19 +3677,9 @@ namespace PlayFab
 
             ~GetAdPlacementsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["AppId"], AppId);
-                FromJsonUtilO(input["Identifier"], Identifier);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AppId; ToJsonUtilS(AppId, each_AppId); output["AppId"] = each_AppId;
-                Json::Value each_Identifier; ToJsonUtilO(Identifier, each_Identifier); output["Identifier"] = each_Identifier;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetAdPlacementsResult : public PlayFabResultCommon
@@ -10607,17 +3698,9 @@ namespace PlayFab
 
             ~GetAdPlacementsResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["AdPlacements"], AdPlacements);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AdPlacements; ToJsonUtilO(AdPlacements, each_AdPlacements); output["AdPlacements"] = each_AdPlacements;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetCatalogItemsRequest : public PlayFabRequestCommon
@@ -10636,17 +3719,9 @@ namespace PlayFab
 
             ~GetCatalogItemsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CatalogVersion"], CatalogVersion);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); output["CatalogVersion"] = each_CatalogVersion;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetCatalogItemsResult : public PlayFabResultCommon
@@ -10665,17 +3740,9 @@ namespace PlayFab
 
             ~GetCatalogItemsResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Catalog"], Catalog);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Catalog; ToJsonUtilO(Catalog, each_Catalog); output["Catalog"] = each_Catalog;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetCharacterDataRequest : public PlayFabRequestCommon
@@ -10703,23 +3770,9 @@ namespace PlayFab
 
             ~GetCharacterDataRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CharacterId"], CharacterId);
-                FromJsonUtilP(input["IfChangedFromDataVersion"], IfChangedFromDataVersion);
-                FromJsonUtilS(input["Keys"], Keys);
-                FromJsonUtilS(input["PlayFabId"], PlayFabId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); output["CharacterId"] = each_CharacterId;
-                Json::Value each_IfChangedFromDataVersion; ToJsonUtilP(IfChangedFromDataVersion, each_IfChangedFromDataVersion); output["IfChangedFromDataVersion"] = each_IfChangedFromDataVersion;
-                Json::Value each_Keys; ToJsonUtilS(Keys, each_Keys); output["Keys"] = each_Keys;
-                Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); output["PlayFabId"] = each_PlayFabId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct UserDataRecord : public PlayFabBaseModel
@@ -10744,21 +3797,9 @@ namespace PlayFab
 
             ~UserDataRecord() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilT(input["LastUpdated"], LastUpdated);
-                FromJsonUtilE(input["Permission"], Permission);
-                FromJsonUtilS(input["Value"], Value);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_LastUpdated; ToJsonUtilT(LastUpdated, each_LastUpdated); output["LastUpdated"] = each_LastUpdated;
-                Json::Value each_Permission; ToJsonUtilE(Permission, each_Permission); output["Permission"] = each_Permission;
-                Json::Value each_Value; ToJsonUtilS(Value, each_Value); output["Value"] = each_Value;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetCharacterDataResult : public PlayFabResultCommon
@@ -10783,21 +3824,9 @@ namespace PlayFab
 
             ~GetCharacterDataResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CharacterId"], CharacterId);
-                FromJsonUtilO(input["Data"], Data);
-                FromJsonUtilP(input["DataVersion"], DataVersion);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); output["CharacterId"] = each_CharacterId;
-                Json::Value each_Data; ToJsonUtilO(Data, each_Data); output["Data"] = each_Data;
-                Json::Value each_DataVersion; ToJsonUtilP(DataVersion, each_DataVersion); output["DataVersion"] = each_DataVersion;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetCharacterInventoryRequest : public PlayFabRequestCommon
@@ -10822,21 +3851,9 @@ namespace PlayFab
 
             ~GetCharacterInventoryRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CatalogVersion"], CatalogVersion);
-                FromJsonUtilS(input["CharacterId"], CharacterId);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); output["CatalogVersion"] = each_CatalogVersion;
-                Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); output["CharacterId"] = each_CharacterId;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct VirtualCurrencyRechargeTime : public PlayFabBaseModel
@@ -10861,21 +3878,9 @@ namespace PlayFab
 
             ~VirtualCurrencyRechargeTime() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["RechargeMax"], RechargeMax);
-                FromJsonUtilT(input["RechargeTime"], RechargeTime);
-                FromJsonUtilP(input["SecondsToRecharge"], SecondsToRecharge);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_RechargeMax; ToJsonUtilP(RechargeMax, each_RechargeMax); output["RechargeMax"] = each_RechargeMax;
-                Json::Value each_RechargeTime; ToJsonUtilT(RechargeTime, each_RechargeTime); output["RechargeTime"] = each_RechargeTime;
-                Json::Value each_SecondsToRecharge; ToJsonUtilP(SecondsToRecharge, each_SecondsToRecharge); output["SecondsToRecharge"] = each_SecondsToRecharge;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetCharacterInventoryResult : public PlayFabResultCommon
@@ -10903,23 +3908,9 @@ namespace PlayFab
 
             ~GetCharacterInventoryResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CharacterId"], CharacterId);
-                FromJsonUtilO(input["Inventory"], Inventory);
-                FromJsonUtilP(input["VirtualCurrency"], VirtualCurrency);
-                FromJsonUtilO(input["VirtualCurrencyRechargeTimes"], VirtualCurrencyRechargeTimes);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); output["CharacterId"] = each_CharacterId;
-                Json::Value each_Inventory; ToJsonUtilO(Inventory, each_Inventory); output["Inventory"] = each_Inventory;
-                Json::Value each_VirtualCurrency; ToJsonUtilP(VirtualCurrency, each_VirtualCurrency); output["VirtualCurrency"] = each_VirtualCurrency;
-                Json::Value each_VirtualCurrencyRechargeTimes; ToJsonUtilO(VirtualCurrencyRechargeTimes, each_VirtualCurrencyRechargeTimes); output["VirtualCurrencyRechargeTimes"] = each_VirtualCurrencyRechargeTimes;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetCharacterLeaderboardRequest : public PlayFabRequestCommon
@@ -10947,23 +3938,9 @@ namespace PlayFab
 
             ~GetCharacterLeaderboardRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CharacterType"], CharacterType);
-                FromJsonUtilP(input["MaxResultsCount"], MaxResultsCount);
-                FromJsonUtilP(input["StartPosition"], StartPosition);
-                FromJsonUtilS(input["StatisticName"], StatisticName);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CharacterType; ToJsonUtilS(CharacterType, each_CharacterType); output["CharacterType"] = each_CharacterType;
-                Json::Value each_MaxResultsCount; ToJsonUtilP(MaxResultsCount, each_MaxResultsCount); output["MaxResultsCount"] = each_MaxResultsCount;
-                Json::Value each_StartPosition; ToJsonUtilP(StartPosition, each_StartPosition); output["StartPosition"] = each_StartPosition;
-                Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); output["StatisticName"] = each_StatisticName;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetCharacterLeaderboardResult : public PlayFabResultCommon
@@ -10982,17 +3959,9 @@ namespace PlayFab
 
             ~GetCharacterLeaderboardResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Leaderboard"], Leaderboard);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Leaderboard; ToJsonUtilO(Leaderboard, each_Leaderboard); output["Leaderboard"] = each_Leaderboard;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetCharacterStatisticsRequest : public PlayFabRequestCommon
@@ -11011,17 +3980,9 @@ namespace PlayFab
 
             ~GetCharacterStatisticsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CharacterId"], CharacterId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); output["CharacterId"] = each_CharacterId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetCharacterStatisticsResult : public PlayFabResultCommon
@@ -11040,17 +4001,9 @@ namespace PlayFab
 
             ~GetCharacterStatisticsResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["CharacterStatistics"], CharacterStatistics);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CharacterStatistics; ToJsonUtilP(CharacterStatistics, each_CharacterStatistics); output["CharacterStatistics"] = each_CharacterStatistics;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetContentDownloadUrlRequest : public PlayFabRequestCommon
@@ -11075,21 +4028,9 @@ namespace PlayFab
 
             ~GetContentDownloadUrlRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["HttpMethod"], HttpMethod);
-                FromJsonUtilS(input["Key"], Key);
-                FromJsonUtilP(input["ThruCDN"], ThruCDN);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_HttpMethod; ToJsonUtilS(HttpMethod, each_HttpMethod); output["HttpMethod"] = each_HttpMethod;
-                Json::Value each_Key; ToJsonUtilS(Key, each_Key); output["Key"] = each_Key;
-                Json::Value each_ThruCDN; ToJsonUtilP(ThruCDN, each_ThruCDN); output["ThruCDN"] = each_ThruCDN;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetContentDownloadUrlResult : public PlayFabResultCommon
@@ -11108,17 +4049,9 @@ namespace PlayFab
 
             ~GetContentDownloadUrlResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["URL"], URL);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_URL; ToJsonUtilS(URL, each_URL); output["URL"] = each_URL;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct PlayerProfileViewConstraints : public PlayFabBaseModel
@@ -11185,49 +4118,9 @@ namespace PlayFab
 
             ~PlayerProfileViewConstraints() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["ShowAvatarUrl"], ShowAvatarUrl);
-                FromJsonUtilP(input["ShowBannedUntil"], ShowBannedUntil);
-                FromJsonUtilP(input["ShowCampaignAttributions"], ShowCampaignAttributions);
-                FromJsonUtilP(input["ShowContactEmailAddresses"], ShowContactEmailAddresses);
-                FromJsonUtilP(input["ShowCreated"], ShowCreated);
-                FromJsonUtilP(input["ShowDisplayName"], ShowDisplayName);
-                FromJsonUtilP(input["ShowExperimentVariants"], ShowExperimentVariants);
-                FromJsonUtilP(input["ShowLastLogin"], ShowLastLogin);
-                FromJsonUtilP(input["ShowLinkedAccounts"], ShowLinkedAccounts);
-                FromJsonUtilP(input["ShowLocations"], ShowLocations);
-                FromJsonUtilP(input["ShowMemberships"], ShowMemberships);
-                FromJsonUtilP(input["ShowOrigination"], ShowOrigination);
-                FromJsonUtilP(input["ShowPushNotificationRegistrations"], ShowPushNotificationRegistrations);
-                FromJsonUtilP(input["ShowStatistics"], ShowStatistics);
-                FromJsonUtilP(input["ShowTags"], ShowTags);
-                FromJsonUtilP(input["ShowTotalValueToDateInUsd"], ShowTotalValueToDateInUsd);
-                FromJsonUtilP(input["ShowValuesToDate"], ShowValuesToDate);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ShowAvatarUrl; ToJsonUtilP(ShowAvatarUrl, each_ShowAvatarUrl); output["ShowAvatarUrl"] = each_ShowAvatarUrl;
-                Json::Value each_ShowBannedUntil; ToJsonUtilP(ShowBannedUntil, each_ShowBannedUntil); output["ShowBannedUntil"] = each_ShowBannedUntil;
-                Json::Value each_ShowCampaignAttributions; ToJsonUtilP(ShowCampaignAttributions, each_ShowCampaignAttributions); output["ShowCampaignAttributions"] = each_ShowCampaignAttributions;
-                Json::Value each_ShowContactEmailAddresses; ToJsonUtilP(ShowContactEmailAddresses, each_ShowContactEmailAddresses); output["ShowContactEmailAddresses"] = each_ShowContactEmailAddresses;
-                Json::Value each_ShowCreated; ToJsonUtilP(ShowCreated, each_ShowCreated); output["ShowCreated"] = each_ShowCreated;
-                Json::Value each_ShowDisplayName; ToJsonUtilP(ShowDisplayName, each_ShowDisplayName); output["ShowDisplayName"] = each_ShowDisplayName;
-                Json::Value each_ShowExperimentVariants; ToJsonUtilP(ShowExperimentVariants, each_ShowExperimentVariants); output["ShowExperimentVariants"] = each_ShowExperimentVariants;
-                Json::Value each_ShowLastLogin; ToJsonUtilP(ShowLastLogin, each_ShowLastLogin); output["ShowLastLogin"] = each_ShowLastLogin;
-                Json::Value each_ShowLinkedAccounts; ToJsonUtilP(ShowLinkedAccounts, each_ShowLinkedAccounts); output["ShowLinkedAccounts"] = each_ShowLinkedAccounts;
-                Json::Value each_ShowLocations; ToJsonUtilP(ShowLocations, each_ShowLocations); output["ShowLocations"] = each_ShowLocations;
-                Json::Value each_ShowMemberships; ToJsonUtilP(ShowMemberships, each_ShowMemberships); output["ShowMemberships"] = each_ShowMemberships;
-                Json::Value each_ShowOrigination; ToJsonUtilP(ShowOrigination, each_ShowOrigination); output["ShowOrigination"] = each_ShowOrigination;
-                Json::Value each_ShowPushNotificationRegistrations; ToJsonUtilP(ShowPushNotificationRegistrations, each_ShowPushNotificationRegistrations); output["ShowPushNotificationRegistrations"] = each_ShowPushNotificationRegistrations;
-                Json::Value each_ShowStatistics; ToJsonUtilP(ShowStatistics, each_ShowStatistics); output["ShowStatistics"] = each_ShowStatistics;
-                Json::Value each_ShowTags; ToJsonUtilP(ShowTags, each_ShowTags); output["ShowTags"] = each_ShowTags;
-                Json::Value each_ShowTotalValueToDateInUsd; ToJsonUtilP(ShowTotalValueToDateInUsd, each_ShowTotalValueToDateInUsd); output["ShowTotalValueToDateInUsd"] = each_ShowTotalValueToDateInUsd;
-                Json::Value each_ShowValuesToDate; ToJsonUtilP(ShowValuesToDate, each_ShowValuesToDate); output["ShowValuesToDate"] = each_ShowValuesToDate;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetFriendLeaderboardAroundPlayerRequest : public PlayFabRequestCommon
@@ -11270,33 +4163,9 @@ namespace PlayFab
 
             ~GetFriendLeaderboardAroundPlayerRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["IncludeFacebookFriends"], IncludeFacebookFriends);
-                FromJsonUtilP(input["IncludeSteamFriends"], IncludeSteamFriends);
-                FromJsonUtilP(input["MaxResultsCount"], MaxResultsCount);
-                FromJsonUtilS(input["PlayFabId"], PlayFabId);
-                FromJsonUtilO(input["ProfileConstraints"], ProfileConstraints);
-                FromJsonUtilS(input["StatisticName"], StatisticName);
-                FromJsonUtilP(input["Version"], Version);
-                FromJsonUtilS(input["XboxToken"], XboxToken);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_IncludeFacebookFriends; ToJsonUtilP(IncludeFacebookFriends, each_IncludeFacebookFriends); output["IncludeFacebookFriends"] = each_IncludeFacebookFriends;
-                Json::Value each_IncludeSteamFriends; ToJsonUtilP(IncludeSteamFriends, each_IncludeSteamFriends); output["IncludeSteamFriends"] = each_IncludeSteamFriends;
-                Json::Value each_MaxResultsCount; ToJsonUtilP(MaxResultsCount, each_MaxResultsCount); output["MaxResultsCount"] = each_MaxResultsCount;
-                Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); output["PlayFabId"] = each_PlayFabId;
-                Json::Value each_ProfileConstraints; ToJsonUtilO(ProfileConstraints, each_ProfileConstraints); output["ProfileConstraints"] = each_ProfileConstraints;
-                Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); output["StatisticName"] = each_StatisticName;
-                Json::Value each_Version; ToJsonUtilP(Version, each_Version); output["Version"] = each_Version;
-                Json::Value each_XboxToken; ToJsonUtilS(XboxToken, each_XboxToken); output["XboxToken"] = each_XboxToken;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct PlayerLeaderboardEntry : public PlayFabBaseModel
@@ -11327,25 +4196,9 @@ namespace PlayFab
 
             ~PlayerLeaderboardEntry() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["DisplayName"], DisplayName);
-                FromJsonUtilS(input["PlayFabId"], PlayFabId);
-                FromJsonUtilP(input["Position"], Position);
-                FromJsonUtilO(input["Profile"], Profile);
-                FromJsonUtilP(input["StatValue"], StatValue);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); output["DisplayName"] = each_DisplayName;
-                Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); output["PlayFabId"] = each_PlayFabId;
-                Json::Value each_Position; ToJsonUtilP(Position, each_Position); output["Position"] = each_Position;
-                Json::Value each_Profile; ToJsonUtilO(Profile, each_Profile); output["Profile"] = each_Profile;
-                Json::Value each_StatValue; ToJsonUtilP(StatValue, each_StatValue); output["StatValue"] = each_StatValue;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetFriendLeaderboardAroundPlayerResult : public PlayFabResultCommon
@@ -11370,21 +4223,9 @@ namespace PlayFab
 
             ~GetFriendLeaderboardAroundPlayerResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Leaderboard"], Leaderboard);
-                FromJsonUtilT(input["NextReset"], NextReset);
-                FromJsonUtilP(input["Version"], Version);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Leaderboard; ToJsonUtilO(Leaderboard, each_Leaderboard); output["Leaderboard"] = each_Leaderboard;
-                Json::Value each_NextReset; ToJsonUtilT(NextReset, each_NextReset); output["NextReset"] = each_NextReset;
-                Json::Value each_Version; ToJsonUtilP(Version, each_Version); output["Version"] = each_Version;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetFriendLeaderboardRequest : public PlayFabRequestCommon
@@ -11427,33 +4268,9 @@ namespace PlayFab
 
             ~GetFriendLeaderboardRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["IncludeFacebookFriends"], IncludeFacebookFriends);
-                FromJsonUtilP(input["IncludeSteamFriends"], IncludeSteamFriends);
-                FromJsonUtilP(input["MaxResultsCount"], MaxResultsCount);
-                FromJsonUtilO(input["ProfileConstraints"], ProfileConstraints);
-                FromJsonUtilP(input["StartPosition"], StartPosition);
-                FromJsonUtilS(input["StatisticName"], StatisticName);
-                FromJsonUtilP(input["Version"], Version);
-                FromJsonUtilS(input["XboxToken"], XboxToken);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_IncludeFacebookFriends; ToJsonUtilP(IncludeFacebookFriends, each_IncludeFacebookFriends); output["IncludeFacebookFriends"] = each_IncludeFacebookFriends;
-                Json::Value each_IncludeSteamFriends; ToJsonUtilP(IncludeSteamFriends, each_IncludeSteamFriends); output["IncludeSteamFriends"] = each_IncludeSteamFriends;
-                Json::Value each_MaxResultsCount; ToJsonUtilP(MaxResultsCount, each_MaxResultsCount); output["MaxResultsCount"] = each_MaxResultsCount;
-                Json::Value each_ProfileConstraints; ToJsonUtilO(ProfileConstraints, each_ProfileConstraints); output["ProfileConstraints"] = each_ProfileConstraints;
-                Json::Value each_StartPosition; ToJsonUtilP(StartPosition, each_StartPosition); output["StartPosition"] = each_StartPosition;
-                Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); output["StatisticName"] = each_StatisticName;
-                Json::Value each_Version; ToJsonUtilP(Version, each_Version); output["Version"] = each_Version;
-                Json::Value each_XboxToken; ToJsonUtilS(XboxToken, each_XboxToken); output["XboxToken"] = each_XboxToken;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetFriendsListRequest : public PlayFabRequestCommon
@@ -11484,25 +4301,9 @@ namespace PlayFab
 
             ~GetFriendsListRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["IncludeFacebookFriends"], IncludeFacebookFriends);
-                FromJsonUtilP(input["IncludeSteamFriends"], IncludeSteamFriends);
-                FromJsonUtilO(input["ProfileConstraints"], ProfileConstraints);
-                FromJsonUtilS(input["XboxToken"], XboxToken);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_IncludeFacebookFriends; ToJsonUtilP(IncludeFacebookFriends, each_IncludeFacebookFriends); output["IncludeFacebookFriends"] = each_IncludeFacebookFriends;
-                Json::Value each_IncludeSteamFriends; ToJsonUtilP(IncludeSteamFriends, each_IncludeSteamFriends); output["IncludeSteamFriends"] = each_IncludeSteamFriends;
-                Json::Value each_ProfileConstraints; ToJsonUtilO(ProfileConstraints, each_ProfileConstraints); output["ProfileConstraints"] = each_ProfileConstraints;
-                Json::Value each_XboxToken; ToJsonUtilS(XboxToken, each_XboxToken); output["XboxToken"] = each_XboxToken;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetFriendsListResult : public PlayFabResultCommon
@@ -11521,17 +4322,9 @@ namespace PlayFab
 
             ~GetFriendsListResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Friends"], Friends);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Friends; ToJsonUtilO(Friends, each_Friends); output["Friends"] = each_Friends;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetLeaderboardAroundCharacterRequest : public PlayFabRequestCommon
@@ -11559,23 +4352,9 @@ namespace PlayFab
 
             ~GetLeaderboardAroundCharacterRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CharacterId"], CharacterId);
-                FromJsonUtilS(input["CharacterType"], CharacterType);
-                FromJsonUtilP(input["MaxResultsCount"], MaxResultsCount);
-                FromJsonUtilS(input["StatisticName"], StatisticName);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); output["CharacterId"] = each_CharacterId;
-                Json::Value each_CharacterType; ToJsonUtilS(CharacterType, each_CharacterType); output["CharacterType"] = each_CharacterType;
-                Json::Value each_MaxResultsCount; ToJsonUtilP(MaxResultsCount, each_MaxResultsCount); output["MaxResultsCount"] = each_MaxResultsCount;
-                Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); output["StatisticName"] = each_StatisticName;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetLeaderboardAroundCharacterResult : public PlayFabResultCommon
@@ -11594,17 +4373,9 @@ namespace PlayFab
 
             ~GetLeaderboardAroundCharacterResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Leaderboard"], Leaderboard);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Leaderboard; ToJsonUtilO(Leaderboard, each_Leaderboard); output["Leaderboard"] = each_Leaderboard;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetLeaderboardAroundPlayerRequest : public PlayFabRequestCommon
@@ -11638,27 +4409,9 @@ namespace PlayFab
 
             ~GetLeaderboardAroundPlayerRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["MaxResultsCount"], MaxResultsCount);
-                FromJsonUtilS(input["PlayFabId"], PlayFabId);
-                FromJsonUtilO(input["ProfileConstraints"], ProfileConstraints);
-                FromJsonUtilS(input["StatisticName"], StatisticName);
-                FromJsonUtilP(input["Version"], Version);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_MaxResultsCount; ToJsonUtilP(MaxResultsCount, each_MaxResultsCount); output["MaxResultsCount"] = each_MaxResultsCount;
-                Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); output["PlayFabId"] = each_PlayFabId;
-                Json::Value each_ProfileConstraints; ToJsonUtilO(ProfileConstraints, each_ProfileConstraints); output["ProfileConstraints"] = each_ProfileConstraints;
-                Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); output["StatisticName"] = each_StatisticName;
-                Json::Value each_Version; ToJsonUtilP(Version, each_Version); output["Version"] = each_Version;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetLeaderboardAroundPlayerResult : public PlayFabResultCommon
@@ -11683,21 +4436,9 @@ namespace PlayFab
 
             ~GetLeaderboardAroundPlayerResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Leaderboard"], Leaderboard);
-                FromJsonUtilT(input["NextReset"], NextReset);
-                FromJsonUtilP(input["Version"], Version);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Leaderboard; ToJsonUtilO(Leaderboard, each_Leaderboard); output["Leaderboard"] = each_Leaderboard;
-                Json::Value each_NextReset; ToJsonUtilT(NextReset, each_NextReset); output["NextReset"] = each_NextReset;
-                Json::Value each_Version; ToJsonUtilP(Version, each_Version); output["Version"] = each_Version;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetLeaderboardForUsersCharactersRequest : public PlayFabRequestCommon
@@ -11719,19 +4460,9 @@ namespace PlayFab
 
             ~GetLeaderboardForUsersCharactersRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["MaxResultsCount"], MaxResultsCount);
-                FromJsonUtilS(input["StatisticName"], StatisticName);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_MaxResultsCount; ToJsonUtilP(MaxResultsCount, each_MaxResultsCount); output["MaxResultsCount"] = each_MaxResultsCount;
-                Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); output["StatisticName"] = each_StatisticName;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetLeaderboardForUsersCharactersResult : public PlayFabResultCommon
@@ -11750,17 +4481,9 @@ namespace PlayFab
 
             ~GetLeaderboardForUsersCharactersResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Leaderboard"], Leaderboard);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Leaderboard; ToJsonUtilO(Leaderboard, each_Leaderboard); output["Leaderboard"] = each_Leaderboard;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetLeaderboardRequest : public PlayFabRequestCommon
@@ -11794,27 +4517,9 @@ namespace PlayFab
 
             ~GetLeaderboardRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["MaxResultsCount"], MaxResultsCount);
-                FromJsonUtilO(input["ProfileConstraints"], ProfileConstraints);
-                FromJsonUtilP(input["StartPosition"], StartPosition);
-                FromJsonUtilS(input["StatisticName"], StatisticName);
-                FromJsonUtilP(input["Version"], Version);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_MaxResultsCount; ToJsonUtilP(MaxResultsCount, each_MaxResultsCount); output["MaxResultsCount"] = each_MaxResultsCount;
-                Json::Value each_ProfileConstraints; ToJsonUtilO(ProfileConstraints, each_ProfileConstraints); output["ProfileConstraints"] = each_ProfileConstraints;
-                Json::Value each_StartPosition; ToJsonUtilP(StartPosition, each_StartPosition); output["StartPosition"] = each_StartPosition;
-                Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); output["StatisticName"] = each_StatisticName;
-                Json::Value each_Version; ToJsonUtilP(Version, each_Version); output["Version"] = each_Version;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetLeaderboardResult : public PlayFabResultCommon
@@ -11839,21 +4544,9 @@ namespace PlayFab
 
             ~GetLeaderboardResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Leaderboard"], Leaderboard);
-                FromJsonUtilT(input["NextReset"], NextReset);
-                FromJsonUtilP(input["Version"], Version);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Leaderboard; ToJsonUtilO(Leaderboard, each_Leaderboard); output["Leaderboard"] = each_Leaderboard;
-                Json::Value each_NextReset; ToJsonUtilT(NextReset, each_NextReset); output["NextReset"] = each_NextReset;
-                Json::Value each_Version; ToJsonUtilP(Version, each_Version); output["Version"] = each_Version;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPaymentTokenRequest : public PlayFabRequestCommon
@@ -11872,17 +4565,9 @@ namespace PlayFab
 
             ~GetPaymentTokenRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["TokenProvider"], TokenProvider);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_TokenProvider; ToJsonUtilS(TokenProvider, each_TokenProvider); output["TokenProvider"] = each_TokenProvider;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPaymentTokenResult : public PlayFabResultCommon
@@ -11904,19 +4589,9 @@ namespace PlayFab
 
             ~GetPaymentTokenResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["OrderId"], OrderId);
-                FromJsonUtilS(input["ProviderToken"], ProviderToken);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_OrderId; ToJsonUtilS(OrderId, each_OrderId); output["OrderId"] = each_OrderId;
-                Json::Value each_ProviderToken; ToJsonUtilS(ProviderToken, each_ProviderToken); output["ProviderToken"] = each_ProviderToken;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPhotonAuthenticationTokenRequest : public PlayFabRequestCommon
@@ -11935,17 +4610,9 @@ namespace PlayFab
 
             ~GetPhotonAuthenticationTokenRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["PhotonApplicationId"], PhotonApplicationId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_PhotonApplicationId; ToJsonUtilS(PhotonApplicationId, each_PhotonApplicationId); output["PhotonApplicationId"] = each_PhotonApplicationId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPhotonAuthenticationTokenResult : public PlayFabResultCommon
@@ -11964,17 +4631,9 @@ namespace PlayFab
 
             ~GetPhotonAuthenticationTokenResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["PhotonCustomAuthenticationToken"], PhotonCustomAuthenticationToken);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_PhotonCustomAuthenticationToken; ToJsonUtilS(PhotonCustomAuthenticationToken, each_PhotonCustomAuthenticationToken); output["PhotonCustomAuthenticationToken"] = each_PhotonCustomAuthenticationToken;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayerCombinedInfoRequestParams : public PlayFabBaseModel
@@ -12035,45 +4694,9 @@ namespace PlayFab
 
             ~GetPlayerCombinedInfoRequestParams() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["GetCharacterInventories"], GetCharacterInventories);
-                FromJsonUtilP(input["GetCharacterList"], GetCharacterList);
-                FromJsonUtilP(input["GetPlayerProfile"], GetPlayerProfile);
-                FromJsonUtilP(input["GetPlayerStatistics"], GetPlayerStatistics);
-                FromJsonUtilP(input["GetTitleData"], GetTitleData);
-                FromJsonUtilP(input["GetUserAccountInfo"], GetUserAccountInfo);
-                FromJsonUtilP(input["GetUserData"], GetUserData);
-                FromJsonUtilP(input["GetUserInventory"], GetUserInventory);
-                FromJsonUtilP(input["GetUserReadOnlyData"], GetUserReadOnlyData);
-                FromJsonUtilP(input["GetUserVirtualCurrency"], GetUserVirtualCurrency);
-                FromJsonUtilS(input["PlayerStatisticNames"], PlayerStatisticNames);
-                FromJsonUtilO(input["ProfileConstraints"], ProfileConstraints);
-                FromJsonUtilS(input["TitleDataKeys"], TitleDataKeys);
-                FromJsonUtilS(input["UserDataKeys"], UserDataKeys);
-                FromJsonUtilS(input["UserReadOnlyDataKeys"], UserReadOnlyDataKeys);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_GetCharacterInventories; ToJsonUtilP(GetCharacterInventories, each_GetCharacterInventories); output["GetCharacterInventories"] = each_GetCharacterInventories;
-                Json::Value each_GetCharacterList; ToJsonUtilP(GetCharacterList, each_GetCharacterList); output["GetCharacterList"] = each_GetCharacterList;
-                Json::Value each_GetPlayerProfile; ToJsonUtilP(GetPlayerProfile, each_GetPlayerProfile); output["GetPlayerProfile"] = each_GetPlayerProfile;
-                Json::Value each_GetPlayerStatistics; ToJsonUtilP(GetPlayerStatistics, each_GetPlayerStatistics); output["GetPlayerStatistics"] = each_GetPlayerStatistics;
-                Json::Value each_GetTitleData; ToJsonUtilP(GetTitleData, each_GetTitleData); output["GetTitleData"] = each_GetTitleData;
-                Json::Value each_GetUserAccountInfo; ToJsonUtilP(GetUserAccountInfo, each_GetUserAccountInfo); output["GetUserAccountInfo"] = each_GetUserAccountInfo;
-                Json::Value each_GetUserData; ToJsonUtilP(GetUserData, each_GetUserData); output["GetUserData"] = each_GetUserData;
-                Json::Value each_GetUserInventory; ToJsonUtilP(GetUserInventory, each_GetUserInventory); output["GetUserInventory"] = each_GetUserInventory;
-                Json::Value each_GetUserReadOnlyData; ToJsonUtilP(GetUserReadOnlyData, each_GetUserReadOnlyData); output["GetUserReadOnlyData"] = each_GetUserReadOnlyData;
-                Json::Value each_GetUserVirtualCurrency; ToJsonUtilP(GetUserVirtualCurrency, each_GetUserVirtualCurrency); output["GetUserVirtualCurrency"] = each_GetUserVirtualCurrency;
-                Json::Value each_PlayerStatisticNames; ToJsonUtilS(PlayerStatisticNames, each_PlayerStatisticNames); output["PlayerStatisticNames"] = each_PlayerStatisticNames;
-                Json::Value each_ProfileConstraints; ToJsonUtilO(ProfileConstraints, each_ProfileConstraints); output["ProfileConstraints"] = each_ProfileConstraints;
-                Json::Value each_TitleDataKeys; ToJsonUtilS(TitleDataKeys, each_TitleDataKeys); output["TitleDataKeys"] = each_TitleDataKeys;
-                Json::Value each_UserDataKeys; ToJsonUtilS(UserDataKeys, each_UserDataKeys); output["UserDataKeys"] = each_UserDataKeys;
-                Json::Value each_UserReadOnlyDataKeys; ToJsonUtilS(UserReadOnlyDataKeys, each_UserReadOnlyDataKeys); output["UserReadOnlyDataKeys"] = each_UserReadOnlyDataKeys;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayerCombinedInfoRequest : public PlayFabRequestCommon
@@ -12098,21 +4721,9 @@ namespace PlayFab
 
             ~GetPlayerCombinedInfoRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["InfoRequestParameters"], InfoRequestParameters);
-                FromJsonUtilS(input["PlayFabId"], PlayFabId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); output["InfoRequestParameters"] = each_InfoRequestParameters;
-                Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); output["PlayFabId"] = each_PlayFabId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct StatisticValue : public PlayFabBaseModel
@@ -12137,21 +4748,9 @@ namespace PlayFab
 
             ~StatisticValue() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["StatisticName"], StatisticName);
-                FromJsonUtilP(input["Value"], Value);
-                FromJsonUtilP(input["Version"], Version);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); output["StatisticName"] = each_StatisticName;
-                Json::Value each_Value; ToJsonUtilP(Value, each_Value); output["Value"] = each_Value;
-                Json::Value each_Version; ToJsonUtilP(Version, each_Version); output["Version"] = each_Version;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayerCombinedInfoResultPayload : public PlayFabBaseModel
@@ -12206,41 +4805,9 @@ namespace PlayFab
 
             ~GetPlayerCombinedInfoResultPayload() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["AccountInfo"], AccountInfo);
-                FromJsonUtilO(input["CharacterInventories"], CharacterInventories);
-                FromJsonUtilO(input["CharacterList"], CharacterList);
-                FromJsonUtilO(input["PlayerProfile"], PlayerProfile);
-                FromJsonUtilO(input["PlayerStatistics"], PlayerStatistics);
-                FromJsonUtilS(input["TitleData"], TitleData);
-                FromJsonUtilO(input["UserData"], UserData);
-                FromJsonUtilP(input["UserDataVersion"], UserDataVersion);
-                FromJsonUtilO(input["UserInventory"], UserInventory);
-                FromJsonUtilO(input["UserReadOnlyData"], UserReadOnlyData);
-                FromJsonUtilP(input["UserReadOnlyDataVersion"], UserReadOnlyDataVersion);
-                FromJsonUtilP(input["UserVirtualCurrency"], UserVirtualCurrency);
-                FromJsonUtilO(input["UserVirtualCurrencyRechargeTimes"], UserVirtualCurrencyRechargeTimes);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AccountInfo; ToJsonUtilO(AccountInfo, each_AccountInfo); output["AccountInfo"] = each_AccountInfo;
-                Json::Value each_CharacterInventories; ToJsonUtilO(CharacterInventories, each_CharacterInventories); output["CharacterInventories"] = each_CharacterInventories;
-                Json::Value each_CharacterList; ToJsonUtilO(CharacterList, each_CharacterList); output["CharacterList"] = each_CharacterList;
-                Json::Value each_PlayerProfile; ToJsonUtilO(PlayerProfile, each_PlayerProfile); output["PlayerProfile"] = each_PlayerProfile;
-                Json::Value each_PlayerStatistics; ToJsonUtilO(PlayerStatistics, each_PlayerStatistics); output["PlayerStatistics"] = each_PlayerStatistics;
-                Json::Value each_TitleData; ToJsonUtilS(TitleData, each_TitleData); output["TitleData"] = each_TitleData;
-                Json::Value each_UserData; ToJsonUtilO(UserData, each_UserData); output["UserData"] = each_UserData;
-                Json::Value each_UserDataVersion; ToJsonUtilP(UserDataVersion, each_UserDataVersion); output["UserDataVersion"] = each_UserDataVersion;
-                Json::Value each_UserInventory; ToJsonUtilO(UserInventory, each_UserInventory); output["UserInventory"] = each_UserInventory;
-                Json::Value each_UserReadOnlyData; ToJsonUtilO(UserReadOnlyData, each_UserReadOnlyData); output["UserReadOnlyData"] = each_UserReadOnlyData;
-                Json::Value each_UserReadOnlyDataVersion; ToJsonUtilP(UserReadOnlyDataVersion, each_UserReadOnlyDataVersion); output["UserReadOnlyDataVersion"] = each_UserReadOnlyDataVersion;
-                Json::Value each_UserVirtualCurrency; ToJsonUtilP(UserVirtualCurrency, each_UserVirtualCurrency); output["UserVirtualCurrency"] = each_UserVirtualCurrency;
-                Json::Value each_UserVirtualCurrencyRechargeTimes; ToJsonUtilO(UserVirtualCurrencyRechargeTimes, each_UserVirtualCurrencyRechargeTimes); output["UserVirtualCurrencyRechargeTimes"] = each_UserVirtualCurrencyRechargeTimes;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayerCombinedInfoResult : public PlayFabResultCommon
@@ -12262,19 +4829,9 @@ namespace PlayFab
 
             ~GetPlayerCombinedInfoResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["InfoResultPayload"], InfoResultPayload);
-                FromJsonUtilS(input["PlayFabId"], PlayFabId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_InfoResultPayload; ToJsonUtilO(InfoResultPayload, each_InfoResultPayload); output["InfoResultPayload"] = each_InfoResultPayload;
-                Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); output["PlayFabId"] = each_PlayFabId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayerProfileRequest : public PlayFabRequestCommon
@@ -12299,21 +4856,9 @@ namespace PlayFab
 
             ~GetPlayerProfileRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["PlayFabId"], PlayFabId);
-                FromJsonUtilO(input["ProfileConstraints"], ProfileConstraints);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); output["PlayFabId"] = each_PlayFabId;
-                Json::Value each_ProfileConstraints; ToJsonUtilO(ProfileConstraints, each_ProfileConstraints); output["ProfileConstraints"] = each_ProfileConstraints;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayerProfileResult : public PlayFabResultCommon
@@ -12332,17 +4877,9 @@ namespace PlayFab
 
             ~GetPlayerProfileResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["PlayerProfile"], PlayerProfile);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_PlayerProfile; ToJsonUtilO(PlayerProfile, each_PlayerProfile); output["PlayerProfile"] = each_PlayerProfile;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayerSegmentsRequest : public PlayFabRequestCommon
@@ -12358,15 +4895,9 @@ namespace PlayFab
 
             ~GetPlayerSegmentsRequest() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetSegmentResult : public PlayFabResultCommon
@@ -12391,21 +4922,9 @@ namespace PlayFab
 
             ~GetSegmentResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["ABTestParent"], ABTestParent);
-                FromJsonUtilS(input["Id"], Id);
-                FromJsonUtilS(input["Name"], Name);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ABTestParent; ToJsonUtilS(ABTestParent, each_ABTestParent); output["ABTestParent"] = each_ABTestParent;
-                Json::Value each_Id; ToJsonUtilS(Id, each_Id); output["Id"] = each_Id;
-                Json::Value each_Name; ToJsonUtilS(Name, each_Name); output["Name"] = each_Name;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayerSegmentsResult : public PlayFabResultCommon
@@ -12424,17 +4943,9 @@ namespace PlayFab
 
             ~GetPlayerSegmentsResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Segments"], Segments);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Segments; ToJsonUtilO(Segments, each_Segments); output["Segments"] = each_Segments;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct StatisticNameVersion : public PlayFabBaseModel
@@ -12456,19 +4967,9 @@ namespace PlayFab
 
             ~StatisticNameVersion() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["StatisticName"], StatisticName);
-                FromJsonUtilP(input["Version"], Version);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); output["StatisticName"] = each_StatisticName;
-                Json::Value each_Version; ToJsonUtilP(Version, each_Version); output["Version"] = each_Version;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayerStatisticsRequest : public PlayFabRequestCommon
@@ -12493,21 +4994,9 @@ namespace PlayFab
 
             ~GetPlayerStatisticsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["StatisticNames"], StatisticNames);
-                FromJsonUtilO(input["StatisticNameVersions"], StatisticNameVersions);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_StatisticNames; ToJsonUtilS(StatisticNames, each_StatisticNames); output["StatisticNames"] = each_StatisticNames;
-                Json::Value each_StatisticNameVersions; ToJsonUtilO(StatisticNameVersions, each_StatisticNameVersions); output["StatisticNameVersions"] = each_StatisticNameVersions;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayerStatisticsResult : public PlayFabResultCommon
@@ -12526,17 +5015,9 @@ namespace PlayFab
 
             ~GetPlayerStatisticsResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Statistics"], Statistics);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Statistics; ToJsonUtilO(Statistics, each_Statistics); output["Statistics"] = each_Statistics;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayerStatisticVersionsRequest : public PlayFabRequestCommon
@@ -12558,19 +5039,9 @@ namespace PlayFab
 
             ~GetPlayerStatisticVersionsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["StatisticName"], StatisticName);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); output["StatisticName"] = each_StatisticName;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct PlayerStatisticVersion : public PlayFabBaseModel
@@ -12604,27 +5075,9 @@ namespace PlayFab
 
             ~PlayerStatisticVersion() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilT(input["ActivationTime"], ActivationTime);
-                FromJsonUtilT(input["DeactivationTime"], DeactivationTime);
-                FromJsonUtilT(input["ScheduledActivationTime"], ScheduledActivationTime);
-                FromJsonUtilT(input["ScheduledDeactivationTime"], ScheduledDeactivationTime);
-                FromJsonUtilS(input["StatisticName"], StatisticName);
-                FromJsonUtilP(input["Version"], Version);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ActivationTime; ToJsonUtilT(ActivationTime, each_ActivationTime); output["ActivationTime"] = each_ActivationTime;
-                Json::Value each_DeactivationTime; ToJsonUtilT(DeactivationTime, each_DeactivationTime); output["DeactivationTime"] = each_DeactivationTime;
-                Json::Value each_ScheduledActivationTime; ToJsonUtilT(ScheduledActivationTime, each_ScheduledActivationTime); output["ScheduledActivationTime"] = each_ScheduledActivationTime;
-                Json::Value each_ScheduledDeactivationTime; ToJsonUtilT(ScheduledDeactivationTime, each_ScheduledDeactivationTime); output["ScheduledDeactivationTime"] = each_ScheduledDeactivationTime;
-                Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); output["StatisticName"] = each_StatisticName;
-                Json::Value each_Version; ToJsonUtilP(Version, each_Version); output["Version"] = each_Version;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayerStatisticVersionsResult : public PlayFabResultCommon
@@ -12643,17 +5096,9 @@ namespace PlayFab
 
             ~GetPlayerStatisticVersionsResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["StatisticVersions"], StatisticVersions);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_StatisticVersions; ToJsonUtilO(StatisticVersions, each_StatisticVersions); output["StatisticVersions"] = each_StatisticVersions;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayerTagsRequest : public PlayFabRequestCommon
@@ -12678,21 +5123,9 @@ namespace PlayFab
 
             ~GetPlayerTagsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["Namespace"], Namespace);
-                FromJsonUtilS(input["PlayFabId"], PlayFabId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Namespace; ToJsonUtilS(Namespace, each_Namespace); output["Namespace"] = each_Namespace;
-                Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); output["PlayFabId"] = each_PlayFabId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayerTagsResult : public PlayFabResultCommon
@@ -12714,19 +5147,9 @@ namespace PlayFab
 
             ~GetPlayerTagsResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["PlayFabId"], PlayFabId);
-                FromJsonUtilS(input["Tags"], Tags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); output["PlayFabId"] = each_PlayFabId;
-                Json::Value each_Tags; ToJsonUtilS(Tags, each_Tags); output["Tags"] = each_Tags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayerTradesRequest : public PlayFabRequestCommon
@@ -12745,17 +5168,9 @@ namespace PlayFab
 
             ~GetPlayerTradesRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilE(input["StatusFilter"], StatusFilter);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_StatusFilter; ToJsonUtilE(StatusFilter, each_StatusFilter); output["StatusFilter"] = each_StatusFilter;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayerTradesResponse : public PlayFabResultCommon
@@ -12777,19 +5192,9 @@ namespace PlayFab
 
             ~GetPlayerTradesResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["AcceptedTrades"], AcceptedTrades);
-                FromJsonUtilO(input["OpenedTrades"], OpenedTrades);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AcceptedTrades; ToJsonUtilO(AcceptedTrades, each_AcceptedTrades); output["AcceptedTrades"] = each_AcceptedTrades;
-                Json::Value each_OpenedTrades; ToJsonUtilO(OpenedTrades, each_OpenedTrades); output["OpenedTrades"] = each_OpenedTrades;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayFabIDsFromFacebookIDsRequest : public PlayFabRequestCommon
@@ -12808,17 +5213,9 @@ namespace PlayFab
 
             ~GetPlayFabIDsFromFacebookIDsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["FacebookIDs"], FacebookIDs);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_FacebookIDs; ToJsonUtilS(FacebookIDs, each_FacebookIDs); output["FacebookIDs"] = each_FacebookIDs;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayFabIDsFromFacebookIDsResult : public PlayFabResultCommon
@@ -12837,17 +5234,9 @@ namespace PlayFab
 
             ~GetPlayFabIDsFromFacebookIDsResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Data"], Data);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Data; ToJsonUtilO(Data, each_Data); output["Data"] = each_Data;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayFabIDsFromFacebookInstantGamesIdsRequest : public PlayFabRequestCommon
@@ -12866,17 +5255,9 @@ namespace PlayFab
 
             ~GetPlayFabIDsFromFacebookInstantGamesIdsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["FacebookInstantGamesIds"], FacebookInstantGamesIds);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_FacebookInstantGamesIds; ToJsonUtilS(FacebookInstantGamesIds, each_FacebookInstantGamesIds); output["FacebookInstantGamesIds"] = each_FacebookInstantGamesIds;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayFabIDsFromFacebookInstantGamesIdsResult : public PlayFabResultCommon
@@ -12895,17 +5276,9 @@ namespace PlayFab
 
             ~GetPlayFabIDsFromFacebookInstantGamesIdsResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Data"], Data);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Data; ToJsonUtilO(Data, each_Data); output["Data"] = each_Data;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayFabIDsFromGameCenterIDsRequest : public PlayFabRequestCommon
@@ -12924,17 +5297,9 @@ namespace PlayFab
 
             ~GetPlayFabIDsFromGameCenterIDsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["GameCenterIDs"], GameCenterIDs);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_GameCenterIDs; ToJsonUtilS(GameCenterIDs, each_GameCenterIDs); output["GameCenterIDs"] = each_GameCenterIDs;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayFabIDsFromGameCenterIDsResult : public PlayFabResultCommon
@@ -12953,17 +5318,9 @@ namespace PlayFab
 
             ~GetPlayFabIDsFromGameCenterIDsResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Data"], Data);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Data; ToJsonUtilO(Data, each_Data); output["Data"] = each_Data;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayFabIDsFromGenericIDsRequest : public PlayFabRequestCommon
@@ -12982,17 +5339,9 @@ namespace PlayFab
 
             ~GetPlayFabIDsFromGenericIDsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["GenericIDs"], GenericIDs);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_GenericIDs; ToJsonUtilO(GenericIDs, each_GenericIDs); output["GenericIDs"] = each_GenericIDs;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayFabIDsFromGenericIDsResult : public PlayFabResultCommon
@@ -13011,17 +5360,9 @@ namespace PlayFab
 
             ~GetPlayFabIDsFromGenericIDsResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Data"], Data);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Data; ToJsonUtilO(Data, each_Data); output["Data"] = each_Data;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayFabIDsFromGoogleIDsRequest : public PlayFabRequestCommon
@@ -13040,17 +5381,9 @@ namespace PlayFab
 
             ~GetPlayFabIDsFromGoogleIDsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["GoogleIDs"], GoogleIDs);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_GoogleIDs; ToJsonUtilS(GoogleIDs, each_GoogleIDs); output["GoogleIDs"] = each_GoogleIDs;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GooglePlayFabIdPair : public PlayFabBaseModel
@@ -13072,19 +5405,9 @@ namespace PlayFab
 
             ~GooglePlayFabIdPair() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["GoogleId"], GoogleId);
-                FromJsonUtilS(input["PlayFabId"], PlayFabId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_GoogleId; ToJsonUtilS(GoogleId, each_GoogleId); output["GoogleId"] = each_GoogleId;
-                Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); output["PlayFabId"] = each_PlayFabId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayFabIDsFromGoogleIDsResult : public PlayFabResultCommon
@@ -13103,17 +5426,9 @@ namespace PlayFab
 
             ~GetPlayFabIDsFromGoogleIDsResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Data"], Data);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Data; ToJsonUtilO(Data, each_Data); output["Data"] = each_Data;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayFabIDsFromKongregateIDsRequest : public PlayFabRequestCommon
@@ -13132,17 +5447,9 @@ namespace PlayFab
 
             ~GetPlayFabIDsFromKongregateIDsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["KongregateIDs"], KongregateIDs);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_KongregateIDs; ToJsonUtilS(KongregateIDs, each_KongregateIDs); output["KongregateIDs"] = each_KongregateIDs;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct KongregatePlayFabIdPair : public PlayFabBaseModel
@@ -13164,19 +5471,9 @@ namespace PlayFab
 
             ~KongregatePlayFabIdPair() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["KongregateId"], KongregateId);
-                FromJsonUtilS(input["PlayFabId"], PlayFabId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_KongregateId; ToJsonUtilS(KongregateId, each_KongregateId); output["KongregateId"] = each_KongregateId;
-                Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); output["PlayFabId"] = each_PlayFabId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayFabIDsFromKongregateIDsResult : public PlayFabResultCommon
@@ -13195,17 +5492,9 @@ namespace PlayFab
 
             ~GetPlayFabIDsFromKongregateIDsResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Data"], Data);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Data; ToJsonUtilO(Data, each_Data); output["Data"] = each_Data;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayFabIDsFromNintendoSwitchDeviceIdsRequest : public PlayFabRequestCommon
@@ -13224,17 +5513,9 @@ namespace PlayFab
 
             ~GetPlayFabIDsFromNintendoSwitchDeviceIdsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["NintendoSwitchDeviceIds"], NintendoSwitchDeviceIds);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_NintendoSwitchDeviceIds; ToJsonUtilS(NintendoSwitchDeviceIds, each_NintendoSwitchDeviceIds); output["NintendoSwitchDeviceIds"] = each_NintendoSwitchDeviceIds;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct NintendoSwitchPlayFabIdPair : public PlayFabBaseModel
@@ -13256,19 +5537,9 @@ namespace PlayFab
 
             ~NintendoSwitchPlayFabIdPair() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["NintendoSwitchDeviceId"], NintendoSwitchDeviceId);
-                FromJsonUtilS(input["PlayFabId"], PlayFabId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_NintendoSwitchDeviceId; ToJsonUtilS(NintendoSwitchDeviceId, each_NintendoSwitchDeviceId); output["NintendoSwitchDeviceId"] = each_NintendoSwitchDeviceId;
-                Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); output["PlayFabId"] = each_PlayFabId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayFabIDsFromNintendoSwitchDeviceIdsResult : public PlayFabResultCommon
@@ -13287,17 +5558,9 @@ namespace PlayFab
 
             ~GetPlayFabIDsFromNintendoSwitchDeviceIdsResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Data"], Data);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Data; ToJsonUtilO(Data, each_Data); output["Data"] = each_Data;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayFabIDsFromPSNAccountIDsRequest : public PlayFabRequestCommon
@@ -13319,19 +5582,9 @@ namespace PlayFab
 
             ~GetPlayFabIDsFromPSNAccountIDsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["IssuerId"], IssuerId);
-                FromJsonUtilS(input["PSNAccountIDs"], PSNAccountIDs);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_IssuerId; ToJsonUtilP(IssuerId, each_IssuerId); output["IssuerId"] = each_IssuerId;
-                Json::Value each_PSNAccountIDs; ToJsonUtilS(PSNAccountIDs, each_PSNAccountIDs); output["PSNAccountIDs"] = each_PSNAccountIDs;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct PSNAccountPlayFabIdPair : public PlayFabBaseModel
@@ -13353,19 +5606,9 @@ namespace PlayFab
 
             ~PSNAccountPlayFabIdPair() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["PlayFabId"], PlayFabId);
-                FromJsonUtilS(input["PSNAccountId"], PSNAccountId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); output["PlayFabId"] = each_PlayFabId;
-                Json::Value each_PSNAccountId; ToJsonUtilS(PSNAccountId, each_PSNAccountId); output["PSNAccountId"] = each_PSNAccountId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayFabIDsFromPSNAccountIDsResult : public PlayFabResultCommon
@@ -13384,17 +5627,9 @@ namespace PlayFab
 
             ~GetPlayFabIDsFromPSNAccountIDsResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Data"], Data);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Data; ToJsonUtilO(Data, each_Data); output["Data"] = each_Data;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayFabIDsFromSteamIDsRequest : public PlayFabRequestCommon
@@ -13413,17 +5648,9 @@ namespace PlayFab
 
             ~GetPlayFabIDsFromSteamIDsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["SteamStringIDs"], SteamStringIDs);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_SteamStringIDs; ToJsonUtilS(SteamStringIDs, each_SteamStringIDs); output["SteamStringIDs"] = each_SteamStringIDs;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct SteamPlayFabIdPair : public PlayFabBaseModel
@@ -13445,19 +5672,9 @@ namespace PlayFab
 
             ~SteamPlayFabIdPair() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["PlayFabId"], PlayFabId);
-                FromJsonUtilS(input["SteamStringId"], SteamStringId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); output["PlayFabId"] = each_PlayFabId;
-                Json::Value each_SteamStringId; ToJsonUtilS(SteamStringId, each_SteamStringId); output["SteamStringId"] = each_SteamStringId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayFabIDsFromSteamIDsResult : public PlayFabResultCommon
@@ -13476,17 +5693,9 @@ namespace PlayFab
 
             ~GetPlayFabIDsFromSteamIDsResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Data"], Data);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Data; ToJsonUtilO(Data, each_Data); output["Data"] = each_Data;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayFabIDsFromTwitchIDsRequest : public PlayFabRequestCommon
@@ -13505,17 +5714,9 @@ namespace PlayFab
 
             ~GetPlayFabIDsFromTwitchIDsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["TwitchIds"], TwitchIds);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_TwitchIds; ToJsonUtilS(TwitchIds, each_TwitchIds); output["TwitchIds"] = each_TwitchIds;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct TwitchPlayFabIdPair : public PlayFabBaseModel
@@ -13537,19 +5738,9 @@ namespace PlayFab
 
             ~TwitchPlayFabIdPair() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["PlayFabId"], PlayFabId);
-                FromJsonUtilS(input["TwitchId"], TwitchId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); output["PlayFabId"] = each_PlayFabId;
-                Json::Value each_TwitchId; ToJsonUtilS(TwitchId, each_TwitchId); output["TwitchId"] = each_TwitchId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayFabIDsFromTwitchIDsResult : public PlayFabResultCommon
@@ -13568,17 +5759,9 @@ namespace PlayFab
 
             ~GetPlayFabIDsFromTwitchIDsResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Data"], Data);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Data; ToJsonUtilO(Data, each_Data); output["Data"] = each_Data;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayFabIDsFromXboxLiveIDsRequest : public PlayFabRequestCommon
@@ -13600,19 +5783,9 @@ namespace PlayFab
 
             ~GetPlayFabIDsFromXboxLiveIDsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Sandbox"], Sandbox);
-                FromJsonUtilS(input["XboxLiveAccountIDs"], XboxLiveAccountIDs);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Sandbox; ToJsonUtilS(Sandbox, each_Sandbox); output["Sandbox"] = each_Sandbox;
-                Json::Value each_XboxLiveAccountIDs; ToJsonUtilS(XboxLiveAccountIDs, each_XboxLiveAccountIDs); output["XboxLiveAccountIDs"] = each_XboxLiveAccountIDs;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct XboxLiveAccountPlayFabIdPair : public PlayFabBaseModel
@@ -13634,19 +5807,9 @@ namespace PlayFab
 
             ~XboxLiveAccountPlayFabIdPair() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["PlayFabId"], PlayFabId);
-                FromJsonUtilS(input["XboxLiveAccountId"], XboxLiveAccountId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); output["PlayFabId"] = each_PlayFabId;
-                Json::Value each_XboxLiveAccountId; ToJsonUtilS(XboxLiveAccountId, each_XboxLiveAccountId); output["XboxLiveAccountId"] = each_XboxLiveAccountId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPlayFabIDsFromXboxLiveIDsResult : public PlayFabResultCommon
@@ -13665,17 +5828,9 @@ namespace PlayFab
 
             ~GetPlayFabIDsFromXboxLiveIDsResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Data"], Data);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Data; ToJsonUtilO(Data, each_Data); output["Data"] = each_Data;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPublisherDataRequest : public PlayFabRequestCommon
@@ -13694,17 +5849,9 @@ namespace PlayFab
 
             ~GetPublisherDataRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Keys"], Keys);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Keys; ToJsonUtilS(Keys, each_Keys); output["Keys"] = each_Keys;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPublisherDataResult : public PlayFabResultCommon
@@ -13723,17 +5870,9 @@ namespace PlayFab
 
             ~GetPublisherDataResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Data"], Data);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Data; ToJsonUtilS(Data, each_Data); output["Data"] = each_Data;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPurchaseRequest : public PlayFabRequestCommon
@@ -13752,17 +5891,9 @@ namespace PlayFab
 
             ~GetPurchaseRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["OrderId"], OrderId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_OrderId; ToJsonUtilS(OrderId, each_OrderId); output["OrderId"] = each_OrderId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetPurchaseResult : public PlayFabResultCommon
@@ -13793,25 +5924,9 @@ namespace PlayFab
 
             ~GetPurchaseResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["OrderId"], OrderId);
-                FromJsonUtilS(input["PaymentProvider"], PaymentProvider);
-                FromJsonUtilT(input["PurchaseDate"], PurchaseDate);
-                FromJsonUtilS(input["TransactionId"], TransactionId);
-                FromJsonUtilS(input["TransactionStatus"], TransactionStatus);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_OrderId; ToJsonUtilS(OrderId, each_OrderId); output["OrderId"] = each_OrderId;
-                Json::Value each_PaymentProvider; ToJsonUtilS(PaymentProvider, each_PaymentProvider); output["PaymentProvider"] = each_PaymentProvider;
-                Json::Value each_PurchaseDate; ToJsonUtilT(PurchaseDate, each_PurchaseDate); output["PurchaseDate"] = each_PurchaseDate;
-                Json::Value each_TransactionId; ToJsonUtilS(TransactionId, each_TransactionId); output["TransactionId"] = each_TransactionId;
-                Json::Value each_TransactionStatus; ToJsonUtilS(TransactionStatus, each_TransactionStatus); output["TransactionStatus"] = each_TransactionStatus;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetSharedGroupDataRequest : public PlayFabRequestCommon
@@ -13836,21 +5951,9 @@ namespace PlayFab
 
             ~GetSharedGroupDataRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["GetMembers"], GetMembers);
-                FromJsonUtilS(input["Keys"], Keys);
-                FromJsonUtilS(input["SharedGroupId"], SharedGroupId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_GetMembers; ToJsonUtilP(GetMembers, each_GetMembers); output["GetMembers"] = each_GetMembers;
-                Json::Value each_Keys; ToJsonUtilS(Keys, each_Keys); output["Keys"] = each_Keys;
-                Json::Value each_SharedGroupId; ToJsonUtilS(SharedGroupId, each_SharedGroupId); output["SharedGroupId"] = each_SharedGroupId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct SharedGroupDataRecord : public PlayFabBaseModel
@@ -13878,23 +5981,9 @@ namespace PlayFab
 
             ~SharedGroupDataRecord() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilT(input["LastUpdated"], LastUpdated);
-                FromJsonUtilS(input["LastUpdatedBy"], LastUpdatedBy);
-                FromJsonUtilE(input["Permission"], Permission);
-                FromJsonUtilS(input["Value"], Value);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_LastUpdated; ToJsonUtilT(LastUpdated, each_LastUpdated); output["LastUpdated"] = each_LastUpdated;
-                Json::Value each_LastUpdatedBy; ToJsonUtilS(LastUpdatedBy, each_LastUpdatedBy); output["LastUpdatedBy"] = each_LastUpdatedBy;
-                Json::Value each_Permission; ToJsonUtilE(Permission, each_Permission); output["Permission"] = each_Permission;
-                Json::Value each_Value; ToJsonUtilS(Value, each_Value); output["Value"] = each_Value;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetSharedGroupDataResult : public PlayFabResultCommon
@@ -13916,19 +6005,9 @@ namespace PlayFab
 
             ~GetSharedGroupDataResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Data"], Data);
-                FromJsonUtilS(input["Members"], Members);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Data; ToJsonUtilO(Data, each_Data); output["Data"] = each_Data;
-                Json::Value each_Members; ToJsonUtilS(Members, each_Members); output["Members"] = each_Members;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetStoreItemsRequest : public PlayFabRequestCommon
@@ -13950,19 +6029,9 @@ namespace PlayFab
 
             ~GetStoreItemsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CatalogVersion"], CatalogVersion);
-                FromJsonUtilS(input["StoreId"], StoreId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); output["CatalogVersion"] = each_CatalogVersion;
-                Json::Value each_StoreId; ToJsonUtilS(StoreId, each_StoreId); output["StoreId"] = each_StoreId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct StoreMarketingModel : public PlayFabBaseModel
@@ -13987,21 +6056,9 @@ namespace PlayFab
 
             ~StoreMarketingModel() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Description"], Description);
-                FromJsonUtilS(input["DisplayName"], DisplayName);
-                Metadata = input["Metadata"];
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Description; ToJsonUtilS(Description, each_Description); output["Description"] = each_Description;
-                Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); output["DisplayName"] = each_DisplayName;
-                output["Metadata"] = Metadata;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct StoreItem : public PlayFabBaseModel
@@ -14032,25 +6089,9 @@ namespace PlayFab
 
             ~StoreItem() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                CustomData = input["CustomData"];
-                FromJsonUtilP(input["DisplayPosition"], DisplayPosition);
-                FromJsonUtilS(input["ItemId"], ItemId);
-                FromJsonUtilP(input["RealCurrencyPrices"], RealCurrencyPrices);
-                FromJsonUtilP(input["VirtualCurrencyPrices"], VirtualCurrencyPrices);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                output["CustomData"] = CustomData;
-                Json::Value each_DisplayPosition; ToJsonUtilP(DisplayPosition, each_DisplayPosition); output["DisplayPosition"] = each_DisplayPosition;
-                Json::Value each_ItemId; ToJsonUtilS(ItemId, each_ItemId); output["ItemId"] = each_ItemId;
-                Json::Value each_RealCurrencyPrices; ToJsonUtilP(RealCurrencyPrices, each_RealCurrencyPrices); output["RealCurrencyPrices"] = each_RealCurrencyPrices;
-                Json::Value each_VirtualCurrencyPrices; ToJsonUtilP(VirtualCurrencyPrices, each_VirtualCurrencyPrices); output["VirtualCurrencyPrices"] = each_VirtualCurrencyPrices;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetStoreItemsResult : public PlayFabResultCommon
@@ -14081,25 +6122,9 @@ namespace PlayFab
 
             ~GetStoreItemsResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CatalogVersion"], CatalogVersion);
-                FromJsonUtilO(input["MarketingData"], MarketingData);
-                FromJsonUtilE(input["Source"], Source);
-                FromJsonUtilO(input["Store"], Store);
-                FromJsonUtilS(input["StoreId"], StoreId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); output["CatalogVersion"] = each_CatalogVersion;
-                Json::Value each_MarketingData; ToJsonUtilO(MarketingData, each_MarketingData); output["MarketingData"] = each_MarketingData;
-                Json::Value each_Source; ToJsonUtilE(Source, each_Source); output["Source"] = each_Source;
-                Json::Value each_Store; ToJsonUtilO(Store, each_Store); output["Store"] = each_Store;
-                Json::Value each_StoreId; ToJsonUtilS(StoreId, each_StoreId); output["StoreId"] = each_StoreId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetTimeRequest : public PlayFabRequestCommon
@@ -14115,15 +6140,9 @@ namespace PlayFab
 
             ~GetTimeRequest() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetTimeResult : public PlayFabResultCommon
@@ -14142,17 +6161,9 @@ namespace PlayFab
 
             ~GetTimeResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilT(input["Time"], Time);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Time; ToJsonUtilT(Time, each_Time); output["Time"] = each_Time;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetTitleDataRequest : public PlayFabRequestCommon
@@ -14174,19 +6185,9 @@ namespace PlayFab
 
             ~GetTitleDataRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Keys"], Keys);
-                FromJsonUtilS(input["OverrideLabel"], OverrideLabel);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Keys; ToJsonUtilS(Keys, each_Keys); output["Keys"] = each_Keys;
-                Json::Value each_OverrideLabel; ToJsonUtilS(OverrideLabel, each_OverrideLabel); output["OverrideLabel"] = each_OverrideLabel;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetTitleDataResult : public PlayFabResultCommon
@@ -14205,17 +6206,9 @@ namespace PlayFab
 
             ~GetTitleDataResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Data"], Data);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Data; ToJsonUtilS(Data, each_Data); output["Data"] = each_Data;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetTitleNewsRequest : public PlayFabRequestCommon
@@ -14234,17 +6227,9 @@ namespace PlayFab
 
             ~GetTitleNewsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["Count"], Count);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Count; ToJsonUtilP(Count, each_Count); output["Count"] = each_Count;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct TitleNewsItem : public PlayFabBaseModel
@@ -14272,23 +6257,9 @@ namespace PlayFab
 
             ~TitleNewsItem() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Body"], Body);
-                FromJsonUtilS(input["NewsId"], NewsId);
-                FromJsonUtilT(input["Timestamp"], Timestamp);
-                FromJsonUtilS(input["Title"], Title);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Body; ToJsonUtilS(Body, each_Body); output["Body"] = each_Body;
-                Json::Value each_NewsId; ToJsonUtilS(NewsId, each_NewsId); output["NewsId"] = each_NewsId;
-                Json::Value each_Timestamp; ToJsonUtilT(Timestamp, each_Timestamp); output["Timestamp"] = each_Timestamp;
-                Json::Value each_Title; ToJsonUtilS(Title, each_Title); output["Title"] = each_Title;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetTitleNewsResult : public PlayFabResultCommon
@@ -14307,17 +6278,9 @@ namespace PlayFab
 
             ~GetTitleNewsResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["News"], News);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_News; ToJsonUtilO(News, each_News); output["News"] = each_News;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetTitlePublicKeyRequest : public PlayFabRequestCommon
@@ -14339,19 +6302,9 @@ namespace PlayFab
 
             ~GetTitlePublicKeyRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["TitleId"], TitleId);
-                FromJsonUtilS(input["TitleSharedSecret"], TitleSharedSecret);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); output["TitleId"] = each_TitleId;
-                Json::Value each_TitleSharedSecret; ToJsonUtilS(TitleSharedSecret, each_TitleSharedSecret); output["TitleSharedSecret"] = each_TitleSharedSecret;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetTitlePublicKeyResult : public PlayFabResultCommon
@@ -14370,17 +6323,9 @@ namespace PlayFab
 
             ~GetTitlePublicKeyResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["RSAPublicKey"], RSAPublicKey);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_RSAPublicKey; ToJsonUtilS(RSAPublicKey, each_RSAPublicKey); output["RSAPublicKey"] = each_RSAPublicKey;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetTradeStatusRequest : public PlayFabRequestCommon
@@ -14402,19 +6347,9 @@ namespace PlayFab
 
             ~GetTradeStatusRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["OfferingPlayerId"], OfferingPlayerId);
-                FromJsonUtilS(input["TradeId"], TradeId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_OfferingPlayerId; ToJsonUtilS(OfferingPlayerId, each_OfferingPlayerId); output["OfferingPlayerId"] = each_OfferingPlayerId;
-                Json::Value each_TradeId; ToJsonUtilS(TradeId, each_TradeId); output["TradeId"] = each_TradeId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetTradeStatusResponse : public PlayFabResultCommon
@@ -14433,17 +6368,9 @@ namespace PlayFab
 
             ~GetTradeStatusResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Trade"], Trade);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Trade; ToJsonUtilO(Trade, each_Trade); output["Trade"] = each_Trade;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetUserDataRequest : public PlayFabRequestCommon
@@ -14468,21 +6395,9 @@ namespace PlayFab
 
             ~GetUserDataRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["IfChangedFromDataVersion"], IfChangedFromDataVersion);
-                FromJsonUtilS(input["Keys"], Keys);
-                FromJsonUtilS(input["PlayFabId"], PlayFabId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_IfChangedFromDataVersion; ToJsonUtilP(IfChangedFromDataVersion, each_IfChangedFromDataVersion); output["IfChangedFromDataVersion"] = each_IfChangedFromDataVersion;
-                Json::Value each_Keys; ToJsonUtilS(Keys, each_Keys); output["Keys"] = each_Keys;
-                Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); output["PlayFabId"] = each_PlayFabId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetUserDataResult : public PlayFabResultCommon
@@ -14504,19 +6419,9 @@ namespace PlayFab
 
             ~GetUserDataResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Data"], Data);
-                FromJsonUtilP(input["DataVersion"], DataVersion);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Data; ToJsonUtilO(Data, each_Data); output["Data"] = each_Data;
-                Json::Value each_DataVersion; ToJsonUtilP(DataVersion, each_DataVersion); output["DataVersion"] = each_DataVersion;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetUserInventoryRequest : public PlayFabRequestCommon
@@ -14535,17 +6440,9 @@ namespace PlayFab
 
             ~GetUserInventoryRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetUserInventoryResult : public PlayFabResultCommon
@@ -14570,21 +6467,9 @@ namespace PlayFab
 
             ~GetUserInventoryResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Inventory"], Inventory);
-                FromJsonUtilP(input["VirtualCurrency"], VirtualCurrency);
-                FromJsonUtilO(input["VirtualCurrencyRechargeTimes"], VirtualCurrencyRechargeTimes);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Inventory; ToJsonUtilO(Inventory, each_Inventory); output["Inventory"] = each_Inventory;
-                Json::Value each_VirtualCurrency; ToJsonUtilP(VirtualCurrency, each_VirtualCurrency); output["VirtualCurrency"] = each_VirtualCurrency;
-                Json::Value each_VirtualCurrencyRechargeTimes; ToJsonUtilO(VirtualCurrencyRechargeTimes, each_VirtualCurrencyRechargeTimes); output["VirtualCurrencyRechargeTimes"] = each_VirtualCurrencyRechargeTimes;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetWindowsHelloChallengeRequest : public PlayFabRequestCommon
@@ -14606,19 +6491,9 @@ namespace PlayFab
 
             ~GetWindowsHelloChallengeRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["PublicKeyHint"], PublicKeyHint);
-                FromJsonUtilS(input["TitleId"], TitleId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_PublicKeyHint; ToJsonUtilS(PublicKeyHint, each_PublicKeyHint); output["PublicKeyHint"] = each_PublicKeyHint;
-                Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); output["TitleId"] = each_TitleId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetWindowsHelloChallengeResponse : public PlayFabResultCommon
@@ -14637,17 +6512,9 @@ namespace PlayFab
 
             ~GetWindowsHelloChallengeResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Challenge"], Challenge);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Challenge; ToJsonUtilS(Challenge, each_Challenge); output["Challenge"] = each_Challenge;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GrantCharacterToUserRequest : public PlayFabRequestCommon
@@ -14675,23 +6542,9 @@ namespace PlayFab
 
             ~GrantCharacterToUserRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CatalogVersion"], CatalogVersion);
-                FromJsonUtilS(input["CharacterName"], CharacterName);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["ItemId"], ItemId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); output["CatalogVersion"] = each_CatalogVersion;
-                Json::Value each_CharacterName; ToJsonUtilS(CharacterName, each_CharacterName); output["CharacterName"] = each_CharacterName;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ItemId; ToJsonUtilS(ItemId, each_ItemId); output["ItemId"] = each_ItemId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GrantCharacterToUserResult : public PlayFabResultCommon
@@ -14716,21 +6569,9 @@ namespace PlayFab
 
             ~GrantCharacterToUserResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CharacterId"], CharacterId);
-                FromJsonUtilS(input["CharacterType"], CharacterType);
-                FromJsonUtilP(input["Result"], Result);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); output["CharacterId"] = each_CharacterId;
-                Json::Value each_CharacterType; ToJsonUtilS(CharacterType, each_CharacterType); output["CharacterType"] = each_CharacterType;
-                Json::Value each_Result; ToJsonUtilP(Result, each_Result); output["Result"] = each_Result;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ItemPurchaseRequest : public PlayFabRequestCommon
@@ -14758,23 +6599,9 @@ namespace PlayFab
 
             ~ItemPurchaseRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Annotation"], Annotation);
-                FromJsonUtilS(input["ItemId"], ItemId);
-                FromJsonUtilP(input["Quantity"], Quantity);
-                FromJsonUtilS(input["UpgradeFromItems"], UpgradeFromItems);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Annotation; ToJsonUtilS(Annotation, each_Annotation); output["Annotation"] = each_Annotation;
-                Json::Value each_ItemId; ToJsonUtilS(ItemId, each_ItemId); output["ItemId"] = each_ItemId;
-                Json::Value each_Quantity; ToJsonUtilP(Quantity, each_Quantity); output["Quantity"] = each_Quantity;
-                Json::Value each_UpgradeFromItems; ToJsonUtilS(UpgradeFromItems, each_UpgradeFromItems); output["UpgradeFromItems"] = each_UpgradeFromItems;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct LinkAndroidDeviceIDRequest : public PlayFabRequestCommon
@@ -14805,25 +6632,9 @@ namespace PlayFab
 
             ~LinkAndroidDeviceIDRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["AndroidDevice"], AndroidDevice);
-                FromJsonUtilS(input["AndroidDeviceId"], AndroidDeviceId);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["ForceLink"], ForceLink);
-                FromJsonUtilS(input["OS"], OS);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AndroidDevice; ToJsonUtilS(AndroidDevice, each_AndroidDevice); output["AndroidDevice"] = each_AndroidDevice;
-                Json::Value each_AndroidDeviceId; ToJsonUtilS(AndroidDeviceId, each_AndroidDeviceId); output["AndroidDeviceId"] = each_AndroidDeviceId;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); output["ForceLink"] = each_ForceLink;
-                Json::Value each_OS; ToJsonUtilS(OS, each_OS); output["OS"] = each_OS;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct LinkAndroidDeviceIDResult : public PlayFabResultCommon
@@ -14839,15 +6650,9 @@ namespace PlayFab
 
             ~LinkAndroidDeviceIDResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct LinkAppleRequest : public PlayFabRequestCommon
@@ -14872,21 +6677,9 @@ namespace PlayFab
 
             ~LinkAppleRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["ForceLink"], ForceLink);
-                FromJsonUtilS(input["IdentityToken"], IdentityToken);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); output["ForceLink"] = each_ForceLink;
-                Json::Value each_IdentityToken; ToJsonUtilS(IdentityToken, each_IdentityToken); output["IdentityToken"] = each_IdentityToken;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct LinkCustomIDRequest : public PlayFabRequestCommon
@@ -14911,21 +6704,9 @@ namespace PlayFab
 
             ~LinkCustomIDRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomId"], CustomId);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["ForceLink"], ForceLink);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomId; ToJsonUtilS(CustomId, each_CustomId); output["CustomId"] = each_CustomId;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); output["ForceLink"] = each_ForceLink;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct LinkCustomIDResult : public PlayFabResultCommon
@@ -14941,15 +6722,9 @@ namespace PlayFab
 
             ~LinkCustomIDResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct LinkFacebookAccountRequest : public PlayFabRequestCommon
@@ -14974,21 +6749,9 @@ namespace PlayFab
 
             ~LinkFacebookAccountRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["AccessToken"], AccessToken);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["ForceLink"], ForceLink);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AccessToken; ToJsonUtilS(AccessToken, each_AccessToken); output["AccessToken"] = each_AccessToken;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); output["ForceLink"] = each_ForceLink;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct LinkFacebookAccountResult : public PlayFabResultCommon
@@ -15004,15 +6767,9 @@ namespace PlayFab
 
             ~LinkFacebookAccountResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct LinkFacebookInstantGamesIdRequest : public PlayFabRequestCommon
@@ -15037,21 +6794,9 @@ namespace PlayFab
 
             ~LinkFacebookInstantGamesIdRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["FacebookInstantGamesSignature"], FacebookInstantGamesSignature);
-                FromJsonUtilP(input["ForceLink"], ForceLink);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_FacebookInstantGamesSignature; ToJsonUtilS(FacebookInstantGamesSignature, each_FacebookInstantGamesSignature); output["FacebookInstantGamesSignature"] = each_FacebookInstantGamesSignature;
-                Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); output["ForceLink"] = each_ForceLink;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct LinkFacebookInstantGamesIdResult : public PlayFabResultCommon
@@ -15067,15 +6812,9 @@ namespace PlayFab
 
             ~LinkFacebookInstantGamesIdResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct LinkGameCenterAccountRequest : public PlayFabRequestCommon
@@ -15112,29 +6851,9 @@ namespace PlayFab
 
             ~LinkGameCenterAccountRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["ForceLink"], ForceLink);
-                FromJsonUtilS(input["GameCenterId"], GameCenterId);
-                FromJsonUtilS(input["PublicKeyUrl"], PublicKeyUrl);
-                FromJsonUtilS(input["Salt"], Salt);
-                FromJsonUtilS(input["Signature"], Signature);
-                FromJsonUtilS(input["Timestamp"], Timestamp);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); output["ForceLink"] = each_ForceLink;
-                Json::Value each_GameCenterId; ToJsonUtilS(GameCenterId, each_GameCenterId); output["GameCenterId"] = each_GameCenterId;
-                Json::Value each_PublicKeyUrl; ToJsonUtilS(PublicKeyUrl, each_PublicKeyUrl); output["PublicKeyUrl"] = each_PublicKeyUrl;
-                Json::Value each_Salt; ToJsonUtilS(Salt, each_Salt); output["Salt"] = each_Salt;
-                Json::Value each_Signature; ToJsonUtilS(Signature, each_Signature); output["Signature"] = each_Signature;
-                Json::Value each_Timestamp; ToJsonUtilS(Timestamp, each_Timestamp); output["Timestamp"] = each_Timestamp;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct LinkGameCenterAccountResult : public PlayFabResultCommon
@@ -15150,15 +6869,9 @@ namespace PlayFab
 
             ~LinkGameCenterAccountResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct LinkGoogleAccountRequest : public PlayFabRequestCommon
@@ -15183,21 +6896,9 @@ namespace PlayFab
 
             ~LinkGoogleAccountRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["ForceLink"], ForceLink);
-                FromJsonUtilS(input["ServerAuthCode"], ServerAuthCode);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); output["ForceLink"] = each_ForceLink;
-                Json::Value each_ServerAuthCode; ToJsonUtilS(ServerAuthCode, each_ServerAuthCode); output["ServerAuthCode"] = each_ServerAuthCode;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct LinkGoogleAccountResult : public PlayFabResultCommon
@@ -15213,15 +6914,9 @@ namespace PlayFab
 
             ~LinkGoogleAccountResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct LinkIOSDeviceIDRequest : public PlayFabRequestCommon
@@ -15252,25 +6947,9 @@ namespace PlayFab
 
             ~LinkIOSDeviceIDRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["DeviceId"], DeviceId);
-                FromJsonUtilS(input["DeviceModel"], DeviceModel);
-                FromJsonUtilP(input["ForceLink"], ForceLink);
-                FromJsonUtilS(input["OS"], OS);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_DeviceId; ToJsonUtilS(DeviceId, each_DeviceId); output["DeviceId"] = each_DeviceId;
-                Json::Value each_DeviceModel; ToJsonUtilS(DeviceModel, each_DeviceModel); output["DeviceModel"] = each_DeviceModel;
-                Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); output["ForceLink"] = each_ForceLink;
-                Json::Value each_OS; ToJsonUtilS(OS, each_OS); output["OS"] = each_OS;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct LinkIOSDeviceIDResult : public PlayFabResultCommon
@@ -15286,15 +6965,9 @@ namespace PlayFab
 
             ~LinkIOSDeviceIDResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct LinkKongregateAccountRequest : public PlayFabRequestCommon
@@ -15322,23 +6995,9 @@ namespace PlayFab
 
             ~LinkKongregateAccountRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["AuthTicket"], AuthTicket);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["ForceLink"], ForceLink);
-                FromJsonUtilS(input["KongregateId"], KongregateId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AuthTicket; ToJsonUtilS(AuthTicket, each_AuthTicket); output["AuthTicket"] = each_AuthTicket;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); output["ForceLink"] = each_ForceLink;
-                Json::Value each_KongregateId; ToJsonUtilS(KongregateId, each_KongregateId); output["KongregateId"] = each_KongregateId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct LinkKongregateAccountResult : public PlayFabResultCommon
@@ -15354,15 +7013,9 @@ namespace PlayFab
 
             ~LinkKongregateAccountResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct LinkNintendoServiceAccountRequest : public PlayFabRequestCommon
@@ -15387,21 +7040,9 @@ namespace PlayFab
 
             ~LinkNintendoServiceAccountRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["ForceLink"], ForceLink);
-                FromJsonUtilS(input["IdentityToken"], IdentityToken);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); output["ForceLink"] = each_ForceLink;
-                Json::Value each_IdentityToken; ToJsonUtilS(IdentityToken, each_IdentityToken); output["IdentityToken"] = each_IdentityToken;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct LinkNintendoSwitchDeviceIdRequest : public PlayFabRequestCommon
@@ -15426,21 +7067,9 @@ namespace PlayFab
 
             ~LinkNintendoSwitchDeviceIdRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["ForceLink"], ForceLink);
-                FromJsonUtilS(input["NintendoSwitchDeviceId"], NintendoSwitchDeviceId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); output["ForceLink"] = each_ForceLink;
-                Json::Value each_NintendoSwitchDeviceId; ToJsonUtilS(NintendoSwitchDeviceId, each_NintendoSwitchDeviceId); output["NintendoSwitchDeviceId"] = each_NintendoSwitchDeviceId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct LinkNintendoSwitchDeviceIdResult : public PlayFabResultCommon
@@ -15456,15 +7085,9 @@ namespace PlayFab
 
             ~LinkNintendoSwitchDeviceIdResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct LinkOpenIdConnectRequest : public PlayFabRequestCommon
@@ -15492,23 +7115,9 @@ namespace PlayFab
 
             ~LinkOpenIdConnectRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["ConnectionId"], ConnectionId);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["ForceLink"], ForceLink);
-                FromJsonUtilS(input["IdToken"], IdToken);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ConnectionId; ToJsonUtilS(ConnectionId, each_ConnectionId); output["ConnectionId"] = each_ConnectionId;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); output["ForceLink"] = each_ForceLink;
-                Json::Value each_IdToken; ToJsonUtilS(IdToken, each_IdToken); output["IdToken"] = each_IdToken;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct LinkPSNAccountRequest : public PlayFabRequestCommon
@@ -15539,25 +7148,9 @@ namespace PlayFab
 
             ~LinkPSNAccountRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["AuthCode"], AuthCode);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["ForceLink"], ForceLink);
-                FromJsonUtilP(input["IssuerId"], IssuerId);
-                FromJsonUtilS(input["RedirectUri"], RedirectUri);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AuthCode; ToJsonUtilS(AuthCode, each_AuthCode); output["AuthCode"] = each_AuthCode;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); output["ForceLink"] = each_ForceLink;
-                Json::Value each_IssuerId; ToJsonUtilP(IssuerId, each_IssuerId); output["IssuerId"] = each_IssuerId;
-                Json::Value each_RedirectUri; ToJsonUtilS(RedirectUri, each_RedirectUri); output["RedirectUri"] = each_RedirectUri;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct LinkPSNAccountResult : public PlayFabResultCommon
@@ -15573,15 +7166,9 @@ namespace PlayFab
 
             ~LinkPSNAccountResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct LinkSteamAccountRequest : public PlayFabRequestCommon
@@ -15606,21 +7193,9 @@ namespace PlayFab
 
             ~LinkSteamAccountRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["ForceLink"], ForceLink);
-                FromJsonUtilS(input["SteamTicket"], SteamTicket);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); output["ForceLink"] = each_ForceLink;
-                Json::Value each_SteamTicket; ToJsonUtilS(SteamTicket, each_SteamTicket); output["SteamTicket"] = each_SteamTicket;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct LinkSteamAccountResult : public PlayFabResultCommon
@@ -15636,15 +7211,9 @@ namespace PlayFab
 
             ~LinkSteamAccountResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct LinkTwitchAccountRequest : public PlayFabRequestCommon
@@ -15669,21 +7238,9 @@ namespace PlayFab
 
             ~LinkTwitchAccountRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["AccessToken"], AccessToken);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["ForceLink"], ForceLink);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AccessToken; ToJsonUtilS(AccessToken, each_AccessToken); output["AccessToken"] = each_AccessToken;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); output["ForceLink"] = each_ForceLink;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct LinkTwitchAccountResult : public PlayFabResultCommon
@@ -15699,15 +7256,9 @@ namespace PlayFab
 
             ~LinkTwitchAccountResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct LinkWindowsHelloAccountRequest : public PlayFabRequestCommon
@@ -15738,25 +7289,9 @@ namespace PlayFab
 
             ~LinkWindowsHelloAccountRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["DeviceName"], DeviceName);
-                FromJsonUtilP(input["ForceLink"], ForceLink);
-                FromJsonUtilS(input["PublicKey"], PublicKey);
-                FromJsonUtilS(input["UserName"], UserName);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_DeviceName; ToJsonUtilS(DeviceName, each_DeviceName); output["DeviceName"] = each_DeviceName;
-                Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); output["ForceLink"] = each_ForceLink;
-                Json::Value each_PublicKey; ToJsonUtilS(PublicKey, each_PublicKey); output["PublicKey"] = each_PublicKey;
-                Json::Value each_UserName; ToJsonUtilS(UserName, each_UserName); output["UserName"] = each_UserName;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct LinkWindowsHelloAccountResponse : public PlayFabResultCommon
@@ -15772,15 +7307,9 @@ namespace PlayFab
 
             ~LinkWindowsHelloAccountResponse() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct LinkXboxAccountRequest : public PlayFabRequestCommon
@@ -15805,21 +7334,9 @@ namespace PlayFab
 
             ~LinkXboxAccountRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["ForceLink"], ForceLink);
-                FromJsonUtilS(input["XboxToken"], XboxToken);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); output["ForceLink"] = each_ForceLink;
-                Json::Value each_XboxToken; ToJsonUtilS(XboxToken, each_XboxToken); output["XboxToken"] = each_XboxToken;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct LinkXboxAccountResult : public PlayFabResultCommon
@@ -15835,15 +7352,9 @@ namespace PlayFab
 
             ~LinkXboxAccountResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ListUsersCharactersRequest : public PlayFabRequestCommon
@@ -15862,17 +7373,9 @@ namespace PlayFab
 
             ~ListUsersCharactersRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["PlayFabId"], PlayFabId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); output["PlayFabId"] = each_PlayFabId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ListUsersCharactersResult : public PlayFabResultCommon
@@ -15891,17 +7394,9 @@ namespace PlayFab
 
             ~ListUsersCharactersResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Characters"], Characters);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Characters; ToJsonUtilO(Characters, each_Characters); output["Characters"] = each_Characters;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UserSettings : public PlayFabBaseModel
@@ -15926,21 +7421,9 @@ namespace PlayFab
 
             ~UserSettings() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["GatherDeviceInfo"], GatherDeviceInfo);
-                FromJsonUtilP(input["GatherFocusInfo"], GatherFocusInfo);
-                FromJsonUtilP(input["NeedsAttribution"], NeedsAttribution);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_GatherDeviceInfo; ToJsonUtilP(GatherDeviceInfo, each_GatherDeviceInfo); output["GatherDeviceInfo"] = each_GatherDeviceInfo;
-                Json::Value each_GatherFocusInfo; ToJsonUtilP(GatherFocusInfo, each_GatherFocusInfo); output["GatherFocusInfo"] = each_GatherFocusInfo;
-                Json::Value each_NeedsAttribution; ToJsonUtilP(NeedsAttribution, each_NeedsAttribution); output["NeedsAttribution"] = each_NeedsAttribution;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct Variable : public PlayFabBaseModel
@@ -15962,19 +7445,9 @@ namespace PlayFab
 
             ~Variable() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Name"], Name);
-                FromJsonUtilS(input["Value"], Value);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Name; ToJsonUtilS(Name, each_Name); output["Name"] = each_Name;
-                Json::Value each_Value; ToJsonUtilS(Value, each_Value); output["Value"] = each_Value;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct TreatmentAssignment : public PlayFabBaseModel
@@ -15996,19 +7469,9 @@ namespace PlayFab
 
             ~TreatmentAssignment() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Variables"], Variables);
-                FromJsonUtilS(input["Variants"], Variants);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Variables; ToJsonUtilO(Variables, each_Variables); output["Variables"] = each_Variables;
-                Json::Value each_Variants; ToJsonUtilS(Variants, each_Variants); output["Variants"] = each_Variants;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct LoginResult : public PlayFabLoginResultCommon
@@ -16048,31 +7511,9 @@ namespace PlayFab
 
             ~LoginResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["EntityToken"], EntityToken);
-                FromJsonUtilO(input["InfoResultPayload"], InfoResultPayload);
-                FromJsonUtilT(input["LastLoginTime"], LastLoginTime);
-                FromJsonUtilP(input["NewlyCreated"], NewlyCreated);
-                FromJsonUtilS(input["PlayFabId"], PlayFabId);
-                FromJsonUtilS(input["SessionTicket"], SessionTicket);
-                FromJsonUtilO(input["SettingsForUser"], SettingsForUser);
-                FromJsonUtilO(input["TreatmentAssignment"], pfTreatmentAssignment);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_EntityToken; ToJsonUtilO(EntityToken, each_EntityToken); output["EntityToken"] = each_EntityToken;
-                Json::Value each_InfoResultPayload; ToJsonUtilO(InfoResultPayload, each_InfoResultPayload); output["InfoResultPayload"] = each_InfoResultPayload;
-                Json::Value each_LastLoginTime; ToJsonUtilT(LastLoginTime, each_LastLoginTime); output["LastLoginTime"] = each_LastLoginTime;
-                Json::Value each_NewlyCreated; ToJsonUtilP(NewlyCreated, each_NewlyCreated); output["NewlyCreated"] = each_NewlyCreated;
-                Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); output["PlayFabId"] = each_PlayFabId;
-                Json::Value each_SessionTicket; ToJsonUtilS(SessionTicket, each_SessionTicket); output["SessionTicket"] = each_SessionTicket;
-                Json::Value each_SettingsForUser; ToJsonUtilO(SettingsForUser, each_SettingsForUser); output["SettingsForUser"] = each_SettingsForUser;
-                Json::Value each_pfTreatmentAssignment; ToJsonUtilO(pfTreatmentAssignment, each_pfTreatmentAssignment); output["TreatmentAssignment"] = each_pfTreatmentAssignment;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct LoginWithAndroidDeviceIDRequest : public PlayFabRequestCommon
@@ -16115,33 +7556,9 @@ namespace PlayFab
 
             ~LoginWithAndroidDeviceIDRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["AndroidDevice"], AndroidDevice);
-                FromJsonUtilS(input["AndroidDeviceId"], AndroidDeviceId);
-                FromJsonUtilP(input["CreateAccount"], CreateAccount);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["EncryptedRequest"], EncryptedRequest);
-                FromJsonUtilO(input["InfoRequestParameters"], InfoRequestParameters);
-                FromJsonUtilS(input["OS"], OS);
-                FromJsonUtilS(input["PlayerSecret"], PlayerSecret);
-                FromJsonUtilS(input["TitleId"], TitleId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AndroidDevice; ToJsonUtilS(AndroidDevice, each_AndroidDevice); output["AndroidDevice"] = each_AndroidDevice;
-                Json::Value each_AndroidDeviceId; ToJsonUtilS(AndroidDeviceId, each_AndroidDeviceId); output["AndroidDeviceId"] = each_AndroidDeviceId;
-                Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); output["CreateAccount"] = each_CreateAccount;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); output["EncryptedRequest"] = each_EncryptedRequest;
-                Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); output["InfoRequestParameters"] = each_InfoRequestParameters;
-                Json::Value each_OS; ToJsonUtilS(OS, each_OS); output["OS"] = each_OS;
-                Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); output["PlayerSecret"] = each_PlayerSecret;
-                Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); output["TitleId"] = each_TitleId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct LoginWithAppleRequest : public PlayFabRequestCommon
@@ -16178,29 +7595,9 @@ namespace PlayFab
 
             ~LoginWithAppleRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["CreateAccount"], CreateAccount);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["EncryptedRequest"], EncryptedRequest);
-                FromJsonUtilS(input["IdentityToken"], IdentityToken);
-                FromJsonUtilO(input["InfoRequestParameters"], InfoRequestParameters);
-                FromJsonUtilS(input["PlayerSecret"], PlayerSecret);
-                FromJsonUtilS(input["TitleId"], TitleId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); output["CreateAccount"] = each_CreateAccount;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); output["EncryptedRequest"] = each_EncryptedRequest;
-                Json::Value each_IdentityToken; ToJsonUtilS(IdentityToken, each_IdentityToken); output["IdentityToken"] = each_IdentityToken;
-                Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); output["InfoRequestParameters"] = each_InfoRequestParameters;
-                Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); output["PlayerSecret"] = each_PlayerSecret;
-                Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); output["TitleId"] = each_TitleId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct LoginWithCustomIDRequest : public PlayFabRequestCommon
@@ -16237,29 +7634,9 @@ namespace PlayFab
 
             ~LoginWithCustomIDRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["CreateAccount"], CreateAccount);
-                FromJsonUtilS(input["CustomId"], CustomId);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["EncryptedRequest"], EncryptedRequest);
-                FromJsonUtilO(input["InfoRequestParameters"], InfoRequestParameters);
-                FromJsonUtilS(input["PlayerSecret"], PlayerSecret);
-                FromJsonUtilS(input["TitleId"], TitleId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); output["CreateAccount"] = each_CreateAccount;
-                Json::Value each_CustomId; ToJsonUtilS(CustomId, each_CustomId); output["CustomId"] = each_CustomId;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); output["EncryptedRequest"] = each_EncryptedRequest;
-                Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); output["InfoRequestParameters"] = each_InfoRequestParameters;
-                Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); output["PlayerSecret"] = each_PlayerSecret;
-                Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); output["TitleId"] = each_TitleId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct LoginWithEmailAddressRequest : public PlayFabRequestCommon
@@ -16290,25 +7667,9 @@ namespace PlayFab
 
             ~LoginWithEmailAddressRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["Email"], Email);
-                FromJsonUtilO(input["InfoRequestParameters"], InfoRequestParameters);
-                FromJsonUtilS(input["Password"], Password);
-                FromJsonUtilS(input["TitleId"], TitleId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Email; ToJsonUtilS(Email, each_Email); output["Email"] = each_Email;
-                Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); output["InfoRequestParameters"] = each_InfoRequestParameters;
-                Json::Value each_Password; ToJsonUtilS(Password, each_Password); output["Password"] = each_Password;
-                Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); output["TitleId"] = each_TitleId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct LoginWithFacebookInstantGamesIdRequest : public PlayFabRequestCommon
@@ -16345,29 +7706,9 @@ namespace PlayFab
 
             ~LoginWithFacebookInstantGamesIdRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["CreateAccount"], CreateAccount);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["EncryptedRequest"], EncryptedRequest);
-                FromJsonUtilS(input["FacebookInstantGamesSignature"], FacebookInstantGamesSignature);
-                FromJsonUtilO(input["InfoRequestParameters"], InfoRequestParameters);
-                FromJsonUtilS(input["PlayerSecret"], PlayerSecret);
-                FromJsonUtilS(input["TitleId"], TitleId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); output["CreateAccount"] = each_CreateAccount;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); output["EncryptedRequest"] = each_EncryptedRequest;
-                Json::Value each_FacebookInstantGamesSignature; ToJsonUtilS(FacebookInstantGamesSignature, each_FacebookInstantGamesSignature); output["FacebookInstantGamesSignature"] = each_FacebookInstantGamesSignature;
-                Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); output["InfoRequestParameters"] = each_InfoRequestParameters;
-                Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); output["PlayerSecret"] = each_PlayerSecret;
-                Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); output["TitleId"] = each_TitleId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct LoginWithFacebookRequest : public PlayFabRequestCommon
@@ -16404,29 +7745,9 @@ namespace PlayFab
 
             ~LoginWithFacebookRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["AccessToken"], AccessToken);
-                FromJsonUtilP(input["CreateAccount"], CreateAccount);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["EncryptedRequest"], EncryptedRequest);
-                FromJsonUtilO(input["InfoRequestParameters"], InfoRequestParameters);
-                FromJsonUtilS(input["PlayerSecret"], PlayerSecret);
-                FromJsonUtilS(input["TitleId"], TitleId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AccessToken; ToJsonUtilS(AccessToken, each_AccessToken); output["AccessToken"] = each_AccessToken;
-                Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); output["CreateAccount"] = each_CreateAccount;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); output["EncryptedRequest"] = each_EncryptedRequest;
-                Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); output["InfoRequestParameters"] = each_InfoRequestParameters;
-                Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); output["PlayerSecret"] = each_PlayerSecret;
-                Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); output["TitleId"] = each_TitleId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct LoginWithGameCenterRequest : public PlayFabRequestCommon
@@ -16475,37 +7796,9 @@ namespace PlayFab
 
             ~LoginWithGameCenterRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["CreateAccount"], CreateAccount);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["EncryptedRequest"], EncryptedRequest);
-                FromJsonUtilO(input["InfoRequestParameters"], InfoRequestParameters);
-                FromJsonUtilS(input["PlayerId"], PlayerId);
-                FromJsonUtilS(input["PlayerSecret"], PlayerSecret);
-                FromJsonUtilS(input["PublicKeyUrl"], PublicKeyUrl);
-                FromJsonUtilS(input["Salt"], Salt);
-                FromJsonUtilS(input["Signature"], Signature);
-                FromJsonUtilS(input["Timestamp"], Timestamp);
-                FromJsonUtilS(input["TitleId"], TitleId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); output["CreateAccount"] = each_CreateAccount;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); output["EncryptedRequest"] = each_EncryptedRequest;
-                Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); output["InfoRequestParameters"] = each_InfoRequestParameters;
-                Json::Value each_PlayerId; ToJsonUtilS(PlayerId, each_PlayerId); output["PlayerId"] = each_PlayerId;
-                Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); output["PlayerSecret"] = each_PlayerSecret;
-                Json::Value each_PublicKeyUrl; ToJsonUtilS(PublicKeyUrl, each_PublicKeyUrl); output["PublicKeyUrl"] = each_PublicKeyUrl;
-                Json::Value each_Salt; ToJsonUtilS(Salt, each_Salt); output["Salt"] = each_Salt;
-                Json::Value each_Signature; ToJsonUtilS(Signature, each_Signature); output["Signature"] = each_Signature;
-                Json::Value each_Timestamp; ToJsonUtilS(Timestamp, each_Timestamp); output["Timestamp"] = each_Timestamp;
-                Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); output["TitleId"] = each_TitleId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct LoginWithGoogleAccountRequest : public PlayFabRequestCommon
@@ -16542,29 +7835,9 @@ namespace PlayFab
 
             ~LoginWithGoogleAccountRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["CreateAccount"], CreateAccount);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["EncryptedRequest"], EncryptedRequest);
-                FromJsonUtilO(input["InfoRequestParameters"], InfoRequestParameters);
-                FromJsonUtilS(input["PlayerSecret"], PlayerSecret);
-                FromJsonUtilS(input["ServerAuthCode"], ServerAuthCode);
-                FromJsonUtilS(input["TitleId"], TitleId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); output["CreateAccount"] = each_CreateAccount;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); output["EncryptedRequest"] = each_EncryptedRequest;
-                Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); output["InfoRequestParameters"] = each_InfoRequestParameters;
-                Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); output["PlayerSecret"] = each_PlayerSecret;
-                Json::Value each_ServerAuthCode; ToJsonUtilS(ServerAuthCode, each_ServerAuthCode); output["ServerAuthCode"] = each_ServerAuthCode;
-                Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); output["TitleId"] = each_TitleId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct LoginWithIOSDeviceIDRequest : public PlayFabRequestCommon
@@ -16607,33 +7880,9 @@ namespace PlayFab
 
             ~LoginWithIOSDeviceIDRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["CreateAccount"], CreateAccount);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["DeviceId"], DeviceId);
-                FromJsonUtilS(input["DeviceModel"], DeviceModel);
-                FromJsonUtilS(input["EncryptedRequest"], EncryptedRequest);
-                FromJsonUtilO(input["InfoRequestParameters"], InfoRequestParameters);
-                FromJsonUtilS(input["OS"], OS);
-                FromJsonUtilS(input["PlayerSecret"], PlayerSecret);
-                FromJsonUtilS(input["TitleId"], TitleId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); output["CreateAccount"] = each_CreateAccount;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_DeviceId; ToJsonUtilS(DeviceId, each_DeviceId); output["DeviceId"] = each_DeviceId;
-                Json::Value each_DeviceModel; ToJsonUtilS(DeviceModel, each_DeviceModel); output["DeviceModel"] = each_DeviceModel;
-                Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); output["EncryptedRequest"] = each_EncryptedRequest;
-                Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); output["InfoRequestParameters"] = each_InfoRequestParameters;
-                Json::Value each_OS; ToJsonUtilS(OS, each_OS); output["OS"] = each_OS;
-                Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); output["PlayerSecret"] = each_PlayerSecret;
-                Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); output["TitleId"] = each_TitleId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct LoginWithKongregateRequest : public PlayFabRequestCommon
@@ -16673,31 +7922,9 @@ namespace PlayFab
 
             ~LoginWithKongregateRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["AuthTicket"], AuthTicket);
-                FromJsonUtilP(input["CreateAccount"], CreateAccount);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["EncryptedRequest"], EncryptedRequest);
-                FromJsonUtilO(input["InfoRequestParameters"], InfoRequestParameters);
-                FromJsonUtilS(input["KongregateId"], KongregateId);
-                FromJsonUtilS(input["PlayerSecret"], PlayerSecret);
-                FromJsonUtilS(input["TitleId"], TitleId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AuthTicket; ToJsonUtilS(AuthTicket, each_AuthTicket); output["AuthTicket"] = each_AuthTicket;
-                Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); output["CreateAccount"] = each_CreateAccount;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); output["EncryptedRequest"] = each_EncryptedRequest;
-                Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); output["InfoRequestParameters"] = each_InfoRequestParameters;
-                Json::Value each_KongregateId; ToJsonUtilS(KongregateId, each_KongregateId); output["KongregateId"] = each_KongregateId;
-                Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); output["PlayerSecret"] = each_PlayerSecret;
-                Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); output["TitleId"] = each_TitleId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct LoginWithNintendoServiceAccountRequest : public PlayFabRequestCommon
@@ -16734,29 +7961,9 @@ namespace PlayFab
 
             ~LoginWithNintendoServiceAccountRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["CreateAccount"], CreateAccount);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["EncryptedRequest"], EncryptedRequest);
-                FromJsonUtilS(input["IdentityToken"], IdentityToken);
-                FromJsonUtilO(input["InfoRequestParameters"], InfoRequestParameters);
-                FromJsonUtilS(input["PlayerSecret"], PlayerSecret);
-                FromJsonUtilS(input["TitleId"], TitleId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); output["CreateAccount"] = each_CreateAccount;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); output["EncryptedRequest"] = each_EncryptedRequest;
-                Json::Value each_IdentityToken; ToJsonUtilS(IdentityToken, each_IdentityToken); output["IdentityToken"] = each_IdentityToken;
-                Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); output["InfoRequestParameters"] = each_InfoRequestParameters;
-                Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); output["PlayerSecret"] = each_PlayerSecret;
-                Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); output["TitleId"] = each_TitleId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct LoginWithNintendoSwitchDeviceIdRequest : public PlayFabRequestCommon
@@ -16793,29 +8000,9 @@ namespace PlayFab
 
             ~LoginWithNintendoSwitchDeviceIdRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["CreateAccount"], CreateAccount);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["EncryptedRequest"], EncryptedRequest);
-                FromJsonUtilO(input["InfoRequestParameters"], InfoRequestParameters);
-                FromJsonUtilS(input["NintendoSwitchDeviceId"], NintendoSwitchDeviceId);
-                FromJsonUtilS(input["PlayerSecret"], PlayerSecret);
-                FromJsonUtilS(input["TitleId"], TitleId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); output["CreateAccount"] = each_CreateAccount;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); output["EncryptedRequest"] = each_EncryptedRequest;
-                Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); output["InfoRequestParameters"] = each_InfoRequestParameters;
-                Json::Value each_NintendoSwitchDeviceId; ToJsonUtilS(NintendoSwitchDeviceId, each_NintendoSwitchDeviceId); output["NintendoSwitchDeviceId"] = each_NintendoSwitchDeviceId;
-                Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); output["PlayerSecret"] = each_PlayerSecret;
-                Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); output["TitleId"] = each_TitleId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct LoginWithOpenIdConnectRequest : public PlayFabRequestCommon
@@ -16855,31 +8042,9 @@ namespace PlayFab
 
             ~LoginWithOpenIdConnectRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["ConnectionId"], ConnectionId);
-                FromJsonUtilP(input["CreateAccount"], CreateAccount);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["EncryptedRequest"], EncryptedRequest);
-                FromJsonUtilS(input["IdToken"], IdToken);
-                FromJsonUtilO(input["InfoRequestParameters"], InfoRequestParameters);
-                FromJsonUtilS(input["PlayerSecret"], PlayerSecret);
-                FromJsonUtilS(input["TitleId"], TitleId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ConnectionId; ToJsonUtilS(ConnectionId, each_ConnectionId); output["ConnectionId"] = each_ConnectionId;
-                Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); output["CreateAccount"] = each_CreateAccount;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); output["EncryptedRequest"] = each_EncryptedRequest;
-                Json::Value each_IdToken; ToJsonUtilS(IdToken, each_IdToken); output["IdToken"] = each_IdToken;
-                Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); output["InfoRequestParameters"] = each_InfoRequestParameters;
-                Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); output["PlayerSecret"] = each_PlayerSecret;
-                Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); output["TitleId"] = each_TitleId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct LoginWithPlayFabRequest : public PlayFabRequestCommon
@@ -16910,25 +8075,9 @@ namespace PlayFab
 
             ~LoginWithPlayFabRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["InfoRequestParameters"], InfoRequestParameters);
-                FromJsonUtilS(input["Password"], Password);
-                FromJsonUtilS(input["TitleId"], TitleId);
-                FromJsonUtilS(input["Username"], Username);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); output["InfoRequestParameters"] = each_InfoRequestParameters;
-                Json::Value each_Password; ToJsonUtilS(Password, each_Password); output["Password"] = each_Password;
-                Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); output["TitleId"] = each_TitleId;
-                Json::Value each_Username; ToJsonUtilS(Username, each_Username); output["Username"] = each_Username;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct LoginWithPSNRequest : public PlayFabRequestCommon
@@ -16971,33 +8120,9 @@ namespace PlayFab
 
             ~LoginWithPSNRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["AuthCode"], AuthCode);
-                FromJsonUtilP(input["CreateAccount"], CreateAccount);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["EncryptedRequest"], EncryptedRequest);
-                FromJsonUtilO(input["InfoRequestParameters"], InfoRequestParameters);
-                FromJsonUtilP(input["IssuerId"], IssuerId);
-                FromJsonUtilS(input["PlayerSecret"], PlayerSecret);
-                FromJsonUtilS(input["RedirectUri"], RedirectUri);
-                FromJsonUtilS(input["TitleId"], TitleId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AuthCode; ToJsonUtilS(AuthCode, each_AuthCode); output["AuthCode"] = each_AuthCode;
-                Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); output["CreateAccount"] = each_CreateAccount;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); output["EncryptedRequest"] = each_EncryptedRequest;
-                Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); output["InfoRequestParameters"] = each_InfoRequestParameters;
-                Json::Value each_IssuerId; ToJsonUtilP(IssuerId, each_IssuerId); output["IssuerId"] = each_IssuerId;
-                Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); output["PlayerSecret"] = each_PlayerSecret;
-                Json::Value each_RedirectUri; ToJsonUtilS(RedirectUri, each_RedirectUri); output["RedirectUri"] = each_RedirectUri;
-                Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); output["TitleId"] = each_TitleId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct LoginWithSteamRequest : public PlayFabRequestCommon
@@ -17034,29 +8159,9 @@ namespace PlayFab
 
             ~LoginWithSteamRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["CreateAccount"], CreateAccount);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["EncryptedRequest"], EncryptedRequest);
-                FromJsonUtilO(input["InfoRequestParameters"], InfoRequestParameters);
-                FromJsonUtilS(input["PlayerSecret"], PlayerSecret);
-                FromJsonUtilS(input["SteamTicket"], SteamTicket);
-                FromJsonUtilS(input["TitleId"], TitleId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); output["CreateAccount"] = each_CreateAccount;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); output["EncryptedRequest"] = each_EncryptedRequest;
-                Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); output["InfoRequestParameters"] = each_InfoRequestParameters;
-                Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); output["PlayerSecret"] = each_PlayerSecret;
-                Json::Value each_SteamTicket; ToJsonUtilS(SteamTicket, each_SteamTicket); output["SteamTicket"] = each_SteamTicket;
-                Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); output["TitleId"] = each_TitleId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct LoginWithTwitchRequest : public PlayFabRequestCommon
@@ -17093,29 +8198,9 @@ namespace PlayFab
 
             ~LoginWithTwitchRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["AccessToken"], AccessToken);
-                FromJsonUtilP(input["CreateAccount"], CreateAccount);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["EncryptedRequest"], EncryptedRequest);
-                FromJsonUtilO(input["InfoRequestParameters"], InfoRequestParameters);
-                FromJsonUtilS(input["PlayerSecret"], PlayerSecret);
-                FromJsonUtilS(input["TitleId"], TitleId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AccessToken; ToJsonUtilS(AccessToken, each_AccessToken); output["AccessToken"] = each_AccessToken;
-                Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); output["CreateAccount"] = each_CreateAccount;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); output["EncryptedRequest"] = each_EncryptedRequest;
-                Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); output["InfoRequestParameters"] = each_InfoRequestParameters;
-                Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); output["PlayerSecret"] = each_PlayerSecret;
-                Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); output["TitleId"] = each_TitleId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct LoginWithWindowsHelloRequest : public PlayFabRequestCommon
@@ -17146,25 +8231,9 @@ namespace PlayFab
 
             ~LoginWithWindowsHelloRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["ChallengeSignature"], ChallengeSignature);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["InfoRequestParameters"], InfoRequestParameters);
-                FromJsonUtilS(input["PublicKeyHint"], PublicKeyHint);
-                FromJsonUtilS(input["TitleId"], TitleId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ChallengeSignature; ToJsonUtilS(ChallengeSignature, each_ChallengeSignature); output["ChallengeSignature"] = each_ChallengeSignature;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); output["InfoRequestParameters"] = each_InfoRequestParameters;
-                Json::Value each_PublicKeyHint; ToJsonUtilS(PublicKeyHint, each_PublicKeyHint); output["PublicKeyHint"] = each_PublicKeyHint;
-                Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); output["TitleId"] = each_TitleId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct LoginWithXboxRequest : public PlayFabRequestCommon
@@ -17201,29 +8270,9 @@ namespace PlayFab
 
             ~LoginWithXboxRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["CreateAccount"], CreateAccount);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["EncryptedRequest"], EncryptedRequest);
-                FromJsonUtilO(input["InfoRequestParameters"], InfoRequestParameters);
-                FromJsonUtilS(input["PlayerSecret"], PlayerSecret);
-                FromJsonUtilS(input["TitleId"], TitleId);
-                FromJsonUtilS(input["XboxToken"], XboxToken);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); output["CreateAccount"] = each_CreateAccount;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); output["EncryptedRequest"] = each_EncryptedRequest;
-                Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); output["InfoRequestParameters"] = each_InfoRequestParameters;
-                Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); output["PlayerSecret"] = each_PlayerSecret;
-                Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); output["TitleId"] = each_TitleId;
-                Json::Value each_XboxToken; ToJsonUtilS(XboxToken, each_XboxToken); output["XboxToken"] = each_XboxToken;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct MatchmakeRequest : public PlayFabRequestCommon
@@ -17266,33 +8315,9 @@ namespace PlayFab
 
             ~MatchmakeRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["BuildVersion"], BuildVersion);
-                FromJsonUtilS(input["CharacterId"], CharacterId);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["GameMode"], GameMode);
-                FromJsonUtilS(input["LobbyId"], LobbyId);
-                FromJsonUtilE(input["Region"], pfRegion);
-                FromJsonUtilP(input["StartNewIfNoneFound"], StartNewIfNoneFound);
-                FromJsonUtilS(input["StatisticName"], StatisticName);
-                FromJsonUtilO(input["TagFilter"], TagFilter);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_BuildVersion; ToJsonUtilS(BuildVersion, each_BuildVersion); output["BuildVersion"] = each_BuildVersion;
-                Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); output["CharacterId"] = each_CharacterId;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_GameMode; ToJsonUtilS(GameMode, each_GameMode); output["GameMode"] = each_GameMode;
-                Json::Value each_LobbyId; ToJsonUtilS(LobbyId, each_LobbyId); output["LobbyId"] = each_LobbyId;
-                Json::Value each_pfRegion; ToJsonUtilE(pfRegion, each_pfRegion); output["Region"] = each_pfRegion;
-                Json::Value each_StartNewIfNoneFound; ToJsonUtilP(StartNewIfNoneFound, each_StartNewIfNoneFound); output["StartNewIfNoneFound"] = each_StartNewIfNoneFound;
-                Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); output["StatisticName"] = each_StatisticName;
-                Json::Value each_TagFilter; ToJsonUtilO(TagFilter, each_TagFilter); output["TagFilter"] = each_TagFilter;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct MatchmakeResult : public PlayFabResultCommon
@@ -17335,33 +8360,9 @@ namespace PlayFab
 
             ~MatchmakeResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Expires"], Expires);
-                FromJsonUtilS(input["LobbyID"], LobbyID);
-                FromJsonUtilP(input["PollWaitTimeMS"], PollWaitTimeMS);
-                FromJsonUtilS(input["ServerIPV4Address"], ServerIPV4Address);
-                FromJsonUtilS(input["ServerIPV6Address"], ServerIPV6Address);
-                FromJsonUtilP(input["ServerPort"], ServerPort);
-                FromJsonUtilS(input["ServerPublicDNSName"], ServerPublicDNSName);
-                FromJsonUtilE(input["Status"], Status);
-                FromJsonUtilS(input["Ticket"], Ticket);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Expires; ToJsonUtilS(Expires, each_Expires); output["Expires"] = each_Expires;
-                Json::Value each_LobbyID; ToJsonUtilS(LobbyID, each_LobbyID); output["LobbyID"] = each_LobbyID;
-                Json::Value each_PollWaitTimeMS; ToJsonUtilP(PollWaitTimeMS, each_PollWaitTimeMS); output["PollWaitTimeMS"] = each_PollWaitTimeMS;
-                Json::Value each_ServerIPV4Address; ToJsonUtilS(ServerIPV4Address, each_ServerIPV4Address); output["ServerIPV4Address"] = each_ServerIPV4Address;
-                Json::Value each_ServerIPV6Address; ToJsonUtilS(ServerIPV6Address, each_ServerIPV6Address); output["ServerIPV6Address"] = each_ServerIPV6Address;
-                Json::Value each_ServerPort; ToJsonUtilP(ServerPort, each_ServerPort); output["ServerPort"] = each_ServerPort;
-                Json::Value each_ServerPublicDNSName; ToJsonUtilS(ServerPublicDNSName, each_ServerPublicDNSName); output["ServerPublicDNSName"] = each_ServerPublicDNSName;
-                Json::Value each_Status; ToJsonUtilE(Status, each_Status); output["Status"] = each_Status;
-                Json::Value each_Ticket; ToJsonUtilS(Ticket, each_Ticket); output["Ticket"] = each_Ticket;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct ModifyUserVirtualCurrencyResult : public PlayFabResultCommon
@@ -17389,23 +8390,9 @@ namespace PlayFab
 
             ~ModifyUserVirtualCurrencyResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["Balance"], Balance);
-                FromJsonUtilP(input["BalanceChange"], BalanceChange);
-                FromJsonUtilS(input["PlayFabId"], PlayFabId);
-                FromJsonUtilS(input["VirtualCurrency"], VirtualCurrency);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Balance; ToJsonUtilP(Balance, each_Balance); output["Balance"] = each_Balance;
-                Json::Value each_BalanceChange; ToJsonUtilP(BalanceChange, each_BalanceChange); output["BalanceChange"] = each_BalanceChange;
-                Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); output["PlayFabId"] = each_PlayFabId;
-                Json::Value each_VirtualCurrency; ToJsonUtilS(VirtualCurrency, each_VirtualCurrency); output["VirtualCurrency"] = each_VirtualCurrency;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct OpenTradeRequest : public PlayFabRequestCommon
@@ -17430,21 +8417,9 @@ namespace PlayFab
 
             ~OpenTradeRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["AllowedPlayerIds"], AllowedPlayerIds);
-                FromJsonUtilS(input["OfferedInventoryInstanceIds"], OfferedInventoryInstanceIds);
-                FromJsonUtilS(input["RequestedCatalogItemIds"], RequestedCatalogItemIds);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AllowedPlayerIds; ToJsonUtilS(AllowedPlayerIds, each_AllowedPlayerIds); output["AllowedPlayerIds"] = each_AllowedPlayerIds;
-                Json::Value each_OfferedInventoryInstanceIds; ToJsonUtilS(OfferedInventoryInstanceIds, each_OfferedInventoryInstanceIds); output["OfferedInventoryInstanceIds"] = each_OfferedInventoryInstanceIds;
-                Json::Value each_RequestedCatalogItemIds; ToJsonUtilS(RequestedCatalogItemIds, each_RequestedCatalogItemIds); output["RequestedCatalogItemIds"] = each_RequestedCatalogItemIds;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct OpenTradeResponse : public PlayFabResultCommon
@@ -17463,17 +8438,9 @@ namespace PlayFab
 
             ~OpenTradeResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Trade"], Trade);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Trade; ToJsonUtilO(Trade, each_Trade); output["Trade"] = each_Trade;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct PayForPurchaseRequest : public PlayFabRequestCommon
@@ -17504,25 +8471,9 @@ namespace PlayFab
 
             ~PayForPurchaseRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Currency"], Currency);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["OrderId"], OrderId);
-                FromJsonUtilS(input["ProviderName"], ProviderName);
-                FromJsonUtilS(input["ProviderTransactionId"], ProviderTransactionId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Currency; ToJsonUtilS(Currency, each_Currency); output["Currency"] = each_Currency;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_OrderId; ToJsonUtilS(OrderId, each_OrderId); output["OrderId"] = each_OrderId;
-                Json::Value each_ProviderName; ToJsonUtilS(ProviderName, each_ProviderName); output["ProviderName"] = each_ProviderName;
-                Json::Value each_ProviderTransactionId; ToJsonUtilS(ProviderTransactionId, each_ProviderTransactionId); output["ProviderTransactionId"] = each_ProviderTransactionId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct PayForPurchaseResult : public PlayFabResultCommon
@@ -17568,35 +8519,9 @@ namespace PlayFab
 
             ~PayForPurchaseResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["CreditApplied"], CreditApplied);
-                FromJsonUtilS(input["OrderId"], OrderId);
-                FromJsonUtilS(input["ProviderData"], ProviderData);
-                FromJsonUtilS(input["ProviderToken"], ProviderToken);
-                FromJsonUtilS(input["PurchaseConfirmationPageURL"], PurchaseConfirmationPageURL);
-                FromJsonUtilS(input["PurchaseCurrency"], PurchaseCurrency);
-                FromJsonUtilP(input["PurchasePrice"], PurchasePrice);
-                FromJsonUtilE(input["Status"], Status);
-                FromJsonUtilP(input["VCAmount"], VCAmount);
-                FromJsonUtilP(input["VirtualCurrency"], VirtualCurrency);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CreditApplied; ToJsonUtilP(CreditApplied, each_CreditApplied); output["CreditApplied"] = each_CreditApplied;
-                Json::Value each_OrderId; ToJsonUtilS(OrderId, each_OrderId); output["OrderId"] = each_OrderId;
-                Json::Value each_ProviderData; ToJsonUtilS(ProviderData, each_ProviderData); output["ProviderData"] = each_ProviderData;
-                Json::Value each_ProviderToken; ToJsonUtilS(ProviderToken, each_ProviderToken); output["ProviderToken"] = each_ProviderToken;
-                Json::Value each_PurchaseConfirmationPageURL; ToJsonUtilS(PurchaseConfirmationPageURL, each_PurchaseConfirmationPageURL); output["PurchaseConfirmationPageURL"] = each_PurchaseConfirmationPageURL;
-                Json::Value each_PurchaseCurrency; ToJsonUtilS(PurchaseCurrency, each_PurchaseCurrency); output["PurchaseCurrency"] = each_PurchaseCurrency;
-                Json::Value each_PurchasePrice; ToJsonUtilP(PurchasePrice, each_PurchasePrice); output["PurchasePrice"] = each_PurchasePrice;
-                Json::Value each_Status; ToJsonUtilE(Status, each_Status); output["Status"] = each_Status;
-                Json::Value each_VCAmount; ToJsonUtilP(VCAmount, each_VCAmount); output["VCAmount"] = each_VCAmount;
-                Json::Value each_VirtualCurrency; ToJsonUtilP(VirtualCurrency, each_VirtualCurrency); output["VirtualCurrency"] = each_VirtualCurrency;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct PaymentOption : public PlayFabBaseModel
@@ -17624,23 +8549,9 @@ namespace PlayFab
 
             ~PaymentOption() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Currency"], Currency);
-                FromJsonUtilP(input["Price"], Price);
-                FromJsonUtilS(input["ProviderName"], ProviderName);
-                FromJsonUtilP(input["StoreCredit"], StoreCredit);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Currency; ToJsonUtilS(Currency, each_Currency); output["Currency"] = each_Currency;
-                Json::Value each_Price; ToJsonUtilP(Price, each_Price); output["Price"] = each_Price;
-                Json::Value each_ProviderName; ToJsonUtilS(ProviderName, each_ProviderName); output["ProviderName"] = each_ProviderName;
-                Json::Value each_StoreCredit; ToJsonUtilP(StoreCredit, each_StoreCredit); output["StoreCredit"] = each_StoreCredit;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct PurchaseItemRequest : public PlayFabRequestCommon
@@ -17677,29 +8588,9 @@ namespace PlayFab
 
             ~PurchaseItemRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CatalogVersion"], CatalogVersion);
-                FromJsonUtilS(input["CharacterId"], CharacterId);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["ItemId"], ItemId);
-                FromJsonUtilP(input["Price"], Price);
-                FromJsonUtilS(input["StoreId"], StoreId);
-                FromJsonUtilS(input["VirtualCurrency"], VirtualCurrency);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); output["CatalogVersion"] = each_CatalogVersion;
-                Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); output["CharacterId"] = each_CharacterId;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ItemId; ToJsonUtilS(ItemId, each_ItemId); output["ItemId"] = each_ItemId;
-                Json::Value each_Price; ToJsonUtilP(Price, each_Price); output["Price"] = each_Price;
-                Json::Value each_StoreId; ToJsonUtilS(StoreId, each_StoreId); output["StoreId"] = each_StoreId;
-                Json::Value each_VirtualCurrency; ToJsonUtilS(VirtualCurrency, each_VirtualCurrency); output["VirtualCurrency"] = each_VirtualCurrency;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct PurchaseItemResult : public PlayFabResultCommon
@@ -17718,17 +8609,9 @@ namespace PlayFab
 
             ~PurchaseItemResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Items"], Items);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Items; ToJsonUtilO(Items, each_Items); output["Items"] = each_Items;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct PurchaseReceiptFulfillment : public PlayFabBaseModel
@@ -17756,23 +8639,9 @@ namespace PlayFab
 
             ~PurchaseReceiptFulfillment() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["FulfilledItems"], FulfilledItems);
-                FromJsonUtilS(input["RecordedPriceSource"], RecordedPriceSource);
-                FromJsonUtilS(input["RecordedTransactionCurrency"], RecordedTransactionCurrency);
-                FromJsonUtilP(input["RecordedTransactionTotal"], RecordedTransactionTotal);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_FulfilledItems; ToJsonUtilO(FulfilledItems, each_FulfilledItems); output["FulfilledItems"] = each_FulfilledItems;
-                Json::Value each_RecordedPriceSource; ToJsonUtilS(RecordedPriceSource, each_RecordedPriceSource); output["RecordedPriceSource"] = each_RecordedPriceSource;
-                Json::Value each_RecordedTransactionCurrency; ToJsonUtilS(RecordedTransactionCurrency, each_RecordedTransactionCurrency); output["RecordedTransactionCurrency"] = each_RecordedTransactionCurrency;
-                Json::Value each_RecordedTransactionTotal; ToJsonUtilP(RecordedTransactionTotal, each_RecordedTransactionTotal); output["RecordedTransactionTotal"] = each_RecordedTransactionTotal;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct RedeemCouponRequest : public PlayFabRequestCommon
@@ -17800,23 +8669,9 @@ namespace PlayFab
 
             ~RedeemCouponRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CatalogVersion"], CatalogVersion);
-                FromJsonUtilS(input["CharacterId"], CharacterId);
-                FromJsonUtilS(input["CouponCode"], CouponCode);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); output["CatalogVersion"] = each_CatalogVersion;
-                Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); output["CharacterId"] = each_CharacterId;
-                Json::Value each_CouponCode; ToJsonUtilS(CouponCode, each_CouponCode); output["CouponCode"] = each_CouponCode;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct RedeemCouponResult : public PlayFabResultCommon
@@ -17835,17 +8690,9 @@ namespace PlayFab
 
             ~RedeemCouponResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["GrantedItems"], GrantedItems);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_GrantedItems; ToJsonUtilO(GrantedItems, each_GrantedItems); output["GrantedItems"] = each_GrantedItems;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct RefreshPSNAuthTokenRequest : public PlayFabRequestCommon
@@ -17870,21 +8717,9 @@ namespace PlayFab
 
             ~RefreshPSNAuthTokenRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["AuthCode"], AuthCode);
-                FromJsonUtilP(input["IssuerId"], IssuerId);
-                FromJsonUtilS(input["RedirectUri"], RedirectUri);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AuthCode; ToJsonUtilS(AuthCode, each_AuthCode); output["AuthCode"] = each_AuthCode;
-                Json::Value each_IssuerId; ToJsonUtilP(IssuerId, each_IssuerId); output["IssuerId"] = each_IssuerId;
-                Json::Value each_RedirectUri; ToJsonUtilS(RedirectUri, each_RedirectUri); output["RedirectUri"] = each_RedirectUri;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct RegisterForIOSPushNotificationRequest : public PlayFabRequestCommon
@@ -17909,21 +8744,9 @@ namespace PlayFab
 
             ~RegisterForIOSPushNotificationRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["ConfirmationMessage"], ConfirmationMessage);
-                FromJsonUtilS(input["DeviceToken"], DeviceToken);
-                FromJsonUtilP(input["SendPushNotificationConfirmation"], SendPushNotificationConfirmation);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ConfirmationMessage; ToJsonUtilS(ConfirmationMessage, each_ConfirmationMessage); output["ConfirmationMessage"] = each_ConfirmationMessage;
-                Json::Value each_DeviceToken; ToJsonUtilS(DeviceToken, each_DeviceToken); output["DeviceToken"] = each_DeviceToken;
-                Json::Value each_SendPushNotificationConfirmation; ToJsonUtilP(SendPushNotificationConfirmation, each_SendPushNotificationConfirmation); output["SendPushNotificationConfirmation"] = each_SendPushNotificationConfirmation;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct RegisterForIOSPushNotificationResult : public PlayFabResultCommon
@@ -17939,15 +8762,9 @@ namespace PlayFab
 
             ~RegisterForIOSPushNotificationResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct RegisterPlayFabUserRequest : public PlayFabRequestCommon
@@ -17993,35 +8810,9 @@ namespace PlayFab
 
             ~RegisterPlayFabUserRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["DisplayName"], DisplayName);
-                FromJsonUtilS(input["Email"], Email);
-                FromJsonUtilS(input["EncryptedRequest"], EncryptedRequest);
-                FromJsonUtilO(input["InfoRequestParameters"], InfoRequestParameters);
-                FromJsonUtilS(input["Password"], Password);
-                FromJsonUtilS(input["PlayerSecret"], PlayerSecret);
-                FromJsonUtilP(input["RequireBothUsernameAndEmail"], RequireBothUsernameAndEmail);
-                FromJsonUtilS(input["TitleId"], TitleId);
-                FromJsonUtilS(input["Username"], Username);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); output["DisplayName"] = each_DisplayName;
-                Json::Value each_Email; ToJsonUtilS(Email, each_Email); output["Email"] = each_Email;
-                Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); output["EncryptedRequest"] = each_EncryptedRequest;
-                Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); output["InfoRequestParameters"] = each_InfoRequestParameters;
-                Json::Value each_Password; ToJsonUtilS(Password, each_Password); output["Password"] = each_Password;
-                Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); output["PlayerSecret"] = each_PlayerSecret;
-                Json::Value each_RequireBothUsernameAndEmail; ToJsonUtilP(RequireBothUsernameAndEmail, each_RequireBothUsernameAndEmail); output["RequireBothUsernameAndEmail"] = each_RequireBothUsernameAndEmail;
-                Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); output["TitleId"] = each_TitleId;
-                Json::Value each_Username; ToJsonUtilS(Username, each_Username); output["Username"] = each_Username;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct RegisterPlayFabUserResult : public PlayFabResultCommon
@@ -18052,25 +8843,9 @@ namespace PlayFab
 
             ~RegisterPlayFabUserResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["EntityToken"], EntityToken);
-                FromJsonUtilS(input["PlayFabId"], PlayFabId);
-                FromJsonUtilS(input["SessionTicket"], SessionTicket);
-                FromJsonUtilO(input["SettingsForUser"], SettingsForUser);
-                FromJsonUtilS(input["Username"], Username);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_EntityToken; ToJsonUtilO(EntityToken, each_EntityToken); output["EntityToken"] = each_EntityToken;
-                Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); output["PlayFabId"] = each_PlayFabId;
-                Json::Value each_SessionTicket; ToJsonUtilS(SessionTicket, each_SessionTicket); output["SessionTicket"] = each_SessionTicket;
-                Json::Value each_SettingsForUser; ToJsonUtilO(SettingsForUser, each_SettingsForUser); output["SettingsForUser"] = each_SettingsForUser;
-                Json::Value each_Username; ToJsonUtilS(Username, each_Username); output["Username"] = each_Username;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct RegisterWithWindowsHelloRequest : public PlayFabRequestCommon
@@ -18110,31 +8885,9 @@ namespace PlayFab
 
             ~RegisterWithWindowsHelloRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["DeviceName"], DeviceName);
-                FromJsonUtilS(input["EncryptedRequest"], EncryptedRequest);
-                FromJsonUtilO(input["InfoRequestParameters"], InfoRequestParameters);
-                FromJsonUtilS(input["PlayerSecret"], PlayerSecret);
-                FromJsonUtilS(input["PublicKey"], PublicKey);
-                FromJsonUtilS(input["TitleId"], TitleId);
-                FromJsonUtilS(input["UserName"], UserName);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_DeviceName; ToJsonUtilS(DeviceName, each_DeviceName); output["DeviceName"] = each_DeviceName;
-                Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); output["EncryptedRequest"] = each_EncryptedRequest;
-                Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); output["InfoRequestParameters"] = each_InfoRequestParameters;
-                Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); output["PlayerSecret"] = each_PlayerSecret;
-                Json::Value each_PublicKey; ToJsonUtilS(PublicKey, each_PublicKey); output["PublicKey"] = each_PublicKey;
-                Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); output["TitleId"] = each_TitleId;
-                Json::Value each_UserName; ToJsonUtilS(UserName, each_UserName); output["UserName"] = each_UserName;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct RemoveContactEmailRequest : public PlayFabRequestCommon
@@ -18153,17 +8906,9 @@ namespace PlayFab
 
             ~RemoveContactEmailRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct RemoveContactEmailResult : public PlayFabResultCommon
@@ -18179,15 +8924,9 @@ namespace PlayFab
 
             ~RemoveContactEmailResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct RemoveFriendRequest : public PlayFabRequestCommon
@@ -18206,17 +8945,9 @@ namespace PlayFab
 
             ~RemoveFriendRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["FriendPlayFabId"], FriendPlayFabId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_FriendPlayFabId; ToJsonUtilS(FriendPlayFabId, each_FriendPlayFabId); output["FriendPlayFabId"] = each_FriendPlayFabId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct RemoveFriendResult : public PlayFabResultCommon
@@ -18232,15 +8963,9 @@ namespace PlayFab
 
             ~RemoveFriendResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct RemoveGenericIDRequest : public PlayFabRequestCommon
@@ -18259,17 +8984,9 @@ namespace PlayFab
 
             ~RemoveGenericIDRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["GenericId"], GenericId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_GenericId; ToJsonUtilO(GenericId, each_GenericId); output["GenericId"] = each_GenericId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct RemoveGenericIDResult : public PlayFabResultCommon
@@ -18285,15 +9002,9 @@ namespace PlayFab
 
             ~RemoveGenericIDResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct RemoveSharedGroupMembersRequest : public PlayFabRequestCommon
@@ -18315,19 +9026,9 @@ namespace PlayFab
 
             ~RemoveSharedGroupMembersRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["PlayFabIds"], PlayFabIds);
-                FromJsonUtilS(input["SharedGroupId"], SharedGroupId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_PlayFabIds; ToJsonUtilS(PlayFabIds, each_PlayFabIds); output["PlayFabIds"] = each_PlayFabIds;
-                Json::Value each_SharedGroupId; ToJsonUtilS(SharedGroupId, each_SharedGroupId); output["SharedGroupId"] = each_SharedGroupId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct RemoveSharedGroupMembersResult : public PlayFabResultCommon
@@ -18343,15 +9044,9 @@ namespace PlayFab
 
             ~RemoveSharedGroupMembersResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ReportAdActivityRequest : public PlayFabRequestCommon
@@ -18379,23 +9074,9 @@ namespace PlayFab
 
             ~ReportAdActivityRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonEnum(input["Activity"], Activity);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["PlacementId"], PlacementId);
-                FromJsonUtilS(input["RewardId"], RewardId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Activity; ToJsonEnum(Activity, each_Activity); output["Activity"] = each_Activity;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_PlacementId; ToJsonUtilS(PlacementId, each_PlacementId); output["PlacementId"] = each_PlacementId;
-                Json::Value each_RewardId; ToJsonUtilS(RewardId, each_RewardId); output["RewardId"] = each_RewardId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct ReportAdActivityResult : public PlayFabResultCommon
@@ -18411,15 +9092,9 @@ namespace PlayFab
 
             ~ReportAdActivityResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ReportPlayerClientRequest : public PlayFabRequestCommon
@@ -18444,21 +9119,9 @@ namespace PlayFab
 
             ~ReportPlayerClientRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Comment"], Comment);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["ReporteeId"], ReporteeId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Comment; ToJsonUtilS(Comment, each_Comment); output["Comment"] = each_Comment;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ReporteeId; ToJsonUtilS(ReporteeId, each_ReporteeId); output["ReporteeId"] = each_ReporteeId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ReportPlayerClientResult : public PlayFabResultCommon
@@ -18477,17 +9140,9 @@ namespace PlayFab
 
             ~ReportPlayerClientResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["SubmissionsRemaining"], SubmissionsRemaining);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_SubmissionsRemaining; ToJsonUtilP(SubmissionsRemaining, each_SubmissionsRemaining); output["SubmissionsRemaining"] = each_SubmissionsRemaining;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct RestoreIOSPurchasesRequest : public PlayFabRequestCommon
@@ -18512,21 +9167,9 @@ namespace PlayFab
 
             ~RestoreIOSPurchasesRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CatalogVersion"], CatalogVersion);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["ReceiptData"], ReceiptData);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); output["CatalogVersion"] = each_CatalogVersion;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ReceiptData; ToJsonUtilS(ReceiptData, each_ReceiptData); output["ReceiptData"] = each_ReceiptData;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct RestoreIOSPurchasesResult : public PlayFabResultCommon
@@ -18545,17 +9188,9 @@ namespace PlayFab
 
             ~RestoreIOSPurchasesResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Fulfillments"], Fulfillments);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Fulfillments; ToJsonUtilO(Fulfillments, each_Fulfillments); output["Fulfillments"] = each_Fulfillments;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct RewardAdActivityRequest : public PlayFabRequestCommon
@@ -18580,21 +9215,9 @@ namespace PlayFab
 
             ~RewardAdActivityRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["PlacementId"], PlacementId);
-                FromJsonUtilS(input["RewardId"], RewardId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_PlacementId; ToJsonUtilS(PlacementId, each_PlacementId); output["PlacementId"] = each_PlacementId;
-                Json::Value each_RewardId; ToJsonUtilS(RewardId, each_RewardId); output["RewardId"] = each_RewardId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct RewardAdActivityResult : public PlayFabResultCommon
@@ -18631,29 +9254,9 @@ namespace PlayFab
 
             ~RewardAdActivityResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["AdActivityEventId"], AdActivityEventId);
-                FromJsonUtilS(input["DebugResults"], DebugResults);
-                FromJsonUtilS(input["PlacementId"], PlacementId);
-                FromJsonUtilS(input["PlacementName"], PlacementName);
-                FromJsonUtilP(input["PlacementViewsRemaining"], PlacementViewsRemaining);
-                FromJsonUtilP(input["PlacementViewsResetMinutes"], PlacementViewsResetMinutes);
-                FromJsonUtilO(input["RewardResults"], RewardResults);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AdActivityEventId; ToJsonUtilS(AdActivityEventId, each_AdActivityEventId); output["AdActivityEventId"] = each_AdActivityEventId;
-                Json::Value each_DebugResults; ToJsonUtilS(DebugResults, each_DebugResults); output["DebugResults"] = each_DebugResults;
-                Json::Value each_PlacementId; ToJsonUtilS(PlacementId, each_PlacementId); output["PlacementId"] = each_PlacementId;
-                Json::Value each_PlacementName; ToJsonUtilS(PlacementName, each_PlacementName); output["PlacementName"] = each_PlacementName;
-                Json::Value each_PlacementViewsRemaining; ToJsonUtilP(PlacementViewsRemaining, each_PlacementViewsRemaining); output["PlacementViewsRemaining"] = each_PlacementViewsRemaining;
-                Json::Value each_PlacementViewsResetMinutes; ToJsonUtilP(PlacementViewsResetMinutes, each_PlacementViewsResetMinutes); output["PlacementViewsResetMinutes"] = each_PlacementViewsResetMinutes;
-                Json::Value each_RewardResults; ToJsonUtilO(RewardResults, each_RewardResults); output["RewardResults"] = each_RewardResults;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct SendAccountRecoveryEmailRequest : public PlayFabRequestCommon
@@ -18681,23 +9284,9 @@ namespace PlayFab
 
             ~SendAccountRecoveryEmailRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["Email"], Email);
-                FromJsonUtilS(input["EmailTemplateId"], EmailTemplateId);
-                FromJsonUtilS(input["TitleId"], TitleId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Email; ToJsonUtilS(Email, each_Email); output["Email"] = each_Email;
-                Json::Value each_EmailTemplateId; ToJsonUtilS(EmailTemplateId, each_EmailTemplateId); output["EmailTemplateId"] = each_EmailTemplateId;
-                Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); output["TitleId"] = each_TitleId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct SendAccountRecoveryEmailResult : public PlayFabResultCommon
@@ -18713,15 +9302,9 @@ namespace PlayFab
 
             ~SendAccountRecoveryEmailResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct SetFriendTagsRequest : public PlayFabRequestCommon
@@ -18743,19 +9326,9 @@ namespace PlayFab
 
             ~SetFriendTagsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["FriendPlayFabId"], FriendPlayFabId);
-                FromJsonUtilS(input["Tags"], Tags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_FriendPlayFabId; ToJsonUtilS(FriendPlayFabId, each_FriendPlayFabId); output["FriendPlayFabId"] = each_FriendPlayFabId;
-                Json::Value each_Tags; ToJsonUtilS(Tags, each_Tags); output["Tags"] = each_Tags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct SetFriendTagsResult : public PlayFabResultCommon
@@ -18771,15 +9344,9 @@ namespace PlayFab
 
             ~SetFriendTagsResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct SetPlayerSecretRequest : public PlayFabRequestCommon
@@ -18801,19 +9368,9 @@ namespace PlayFab
 
             ~SetPlayerSecretRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["EncryptedRequest"], EncryptedRequest);
-                FromJsonUtilS(input["PlayerSecret"], PlayerSecret);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); output["EncryptedRequest"] = each_EncryptedRequest;
-                Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); output["PlayerSecret"] = each_PlayerSecret;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct SetPlayerSecretResult : public PlayFabResultCommon
@@ -18829,15 +9386,9 @@ namespace PlayFab
 
             ~SetPlayerSecretResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct StartGameRequest : public PlayFabRequestCommon
@@ -18874,29 +9425,9 @@ namespace PlayFab
 
             ~StartGameRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["BuildVersion"], BuildVersion);
-                FromJsonUtilS(input["CharacterId"], CharacterId);
-                FromJsonUtilS(input["CustomCommandLineData"], CustomCommandLineData);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["GameMode"], GameMode);
-                FromJsonEnum(input["Region"], pfRegion);
-                FromJsonUtilS(input["StatisticName"], StatisticName);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_BuildVersion; ToJsonUtilS(BuildVersion, each_BuildVersion); output["BuildVersion"] = each_BuildVersion;
-                Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); output["CharacterId"] = each_CharacterId;
-                Json::Value each_CustomCommandLineData; ToJsonUtilS(CustomCommandLineData, each_CustomCommandLineData); output["CustomCommandLineData"] = each_CustomCommandLineData;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_GameMode; ToJsonUtilS(GameMode, each_GameMode); output["GameMode"] = each_GameMode;
-                Json::Value each_pfRegion; ToJsonEnum(pfRegion, each_pfRegion); output["Region"] = each_pfRegion;
-                Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); output["StatisticName"] = each_StatisticName;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct StartGameResult : public PlayFabResultCommon
@@ -18936,31 +9467,9 @@ namespace PlayFab
 
             ~StartGameResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Expires"], Expires);
-                FromJsonUtilS(input["LobbyID"], LobbyID);
-                FromJsonUtilS(input["Password"], Password);
-                FromJsonUtilS(input["ServerIPV4Address"], ServerIPV4Address);
-                FromJsonUtilS(input["ServerIPV6Address"], ServerIPV6Address);
-                FromJsonUtilP(input["ServerPort"], ServerPort);
-                FromJsonUtilS(input["ServerPublicDNSName"], ServerPublicDNSName);
-                FromJsonUtilS(input["Ticket"], Ticket);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Expires; ToJsonUtilS(Expires, each_Expires); output["Expires"] = each_Expires;
-                Json::Value each_LobbyID; ToJsonUtilS(LobbyID, each_LobbyID); output["LobbyID"] = each_LobbyID;
-                Json::Value each_Password; ToJsonUtilS(Password, each_Password); output["Password"] = each_Password;
-                Json::Value each_ServerIPV4Address; ToJsonUtilS(ServerIPV4Address, each_ServerIPV4Address); output["ServerIPV4Address"] = each_ServerIPV4Address;
-                Json::Value each_ServerIPV6Address; ToJsonUtilS(ServerIPV6Address, each_ServerIPV6Address); output["ServerIPV6Address"] = each_ServerIPV6Address;
-                Json::Value each_ServerPort; ToJsonUtilP(ServerPort, each_ServerPort); output["ServerPort"] = each_ServerPort;
-                Json::Value each_ServerPublicDNSName; ToJsonUtilS(ServerPublicDNSName, each_ServerPublicDNSName); output["ServerPublicDNSName"] = each_ServerPublicDNSName;
-                Json::Value each_Ticket; ToJsonUtilS(Ticket, each_Ticket); output["Ticket"] = each_Ticket;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct StartPurchaseRequest : public PlayFabRequestCommon
@@ -18988,23 +9497,9 @@ namespace PlayFab
 
             ~StartPurchaseRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CatalogVersion"], CatalogVersion);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Items"], Items);
-                FromJsonUtilS(input["StoreId"], StoreId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); output["CatalogVersion"] = each_CatalogVersion;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Items; ToJsonUtilO(Items, each_Items); output["Items"] = each_Items;
-                Json::Value each_StoreId; ToJsonUtilS(StoreId, each_StoreId); output["StoreId"] = each_StoreId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct StartPurchaseResult : public PlayFabResultCommon
@@ -19032,23 +9527,9 @@ namespace PlayFab
 
             ~StartPurchaseResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Contents"], Contents);
-                FromJsonUtilS(input["OrderId"], OrderId);
-                FromJsonUtilO(input["PaymentOptions"], PaymentOptions);
-                FromJsonUtilP(input["VirtualCurrencyBalances"], VirtualCurrencyBalances);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Contents; ToJsonUtilO(Contents, each_Contents); output["Contents"] = each_Contents;
-                Json::Value each_OrderId; ToJsonUtilS(OrderId, each_OrderId); output["OrderId"] = each_OrderId;
-                Json::Value each_PaymentOptions; ToJsonUtilO(PaymentOptions, each_PaymentOptions); output["PaymentOptions"] = each_PaymentOptions;
-                Json::Value each_VirtualCurrencyBalances; ToJsonUtilP(VirtualCurrencyBalances, each_VirtualCurrencyBalances); output["VirtualCurrencyBalances"] = each_VirtualCurrencyBalances;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct StatisticUpdate : public PlayFabBaseModel
@@ -19073,21 +9554,9 @@ namespace PlayFab
 
             ~StatisticUpdate() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["StatisticName"], StatisticName);
-                FromJsonUtilP(input["Value"], Value);
-                FromJsonUtilP(input["Version"], Version);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); output["StatisticName"] = each_StatisticName;
-                Json::Value each_Value; ToJsonUtilP(Value, each_Value); output["Value"] = each_Value;
-                Json::Value each_Version; ToJsonUtilP(Version, each_Version); output["Version"] = each_Version;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct SubtractUserVirtualCurrencyRequest : public PlayFabRequestCommon
@@ -19112,21 +9581,9 @@ namespace PlayFab
 
             ~SubtractUserVirtualCurrencyRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["Amount"], Amount);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["VirtualCurrency"], VirtualCurrency);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Amount; ToJsonUtilP(Amount, each_Amount); output["Amount"] = each_Amount;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_VirtualCurrency; ToJsonUtilS(VirtualCurrency, each_VirtualCurrency); output["VirtualCurrency"] = each_VirtualCurrency;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UnlinkAndroidDeviceIDRequest : public PlayFabRequestCommon
@@ -19148,19 +9605,9 @@ namespace PlayFab
 
             ~UnlinkAndroidDeviceIDRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["AndroidDeviceId"], AndroidDeviceId);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AndroidDeviceId; ToJsonUtilS(AndroidDeviceId, each_AndroidDeviceId); output["AndroidDeviceId"] = each_AndroidDeviceId;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UnlinkAndroidDeviceIDResult : public PlayFabResultCommon
@@ -19176,15 +9623,9 @@ namespace PlayFab
 
             ~UnlinkAndroidDeviceIDResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UnlinkAppleRequest : public PlayFabRequestCommon
@@ -19203,17 +9644,9 @@ namespace PlayFab
 
             ~UnlinkAppleRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UnlinkCustomIDRequest : public PlayFabRequestCommon
@@ -19235,19 +9668,9 @@ namespace PlayFab
 
             ~UnlinkCustomIDRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomId"], CustomId);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomId; ToJsonUtilS(CustomId, each_CustomId); output["CustomId"] = each_CustomId;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UnlinkCustomIDResult : public PlayFabResultCommon
@@ -19263,15 +9686,9 @@ namespace PlayFab
 
             ~UnlinkCustomIDResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UnlinkFacebookAccountRequest : public PlayFabRequestCommon
@@ -19290,17 +9707,9 @@ namespace PlayFab
 
             ~UnlinkFacebookAccountRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UnlinkFacebookAccountResult : public PlayFabResultCommon
@@ -19316,15 +9725,9 @@ namespace PlayFab
 
             ~UnlinkFacebookAccountResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UnlinkFacebookInstantGamesIdRequest : public PlayFabRequestCommon
@@ -19346,19 +9749,9 @@ namespace PlayFab
 
             ~UnlinkFacebookInstantGamesIdRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["FacebookInstantGamesId"], FacebookInstantGamesId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_FacebookInstantGamesId; ToJsonUtilS(FacebookInstantGamesId, each_FacebookInstantGamesId); output["FacebookInstantGamesId"] = each_FacebookInstantGamesId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UnlinkFacebookInstantGamesIdResult : public PlayFabResultCommon
@@ -19374,15 +9767,9 @@ namespace PlayFab
 
             ~UnlinkFacebookInstantGamesIdResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UnlinkGameCenterAccountRequest : public PlayFabRequestCommon
@@ -19401,17 +9788,9 @@ namespace PlayFab
 
             ~UnlinkGameCenterAccountRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UnlinkGameCenterAccountResult : public PlayFabResultCommon
@@ -19427,15 +9806,9 @@ namespace PlayFab
 
             ~UnlinkGameCenterAccountResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UnlinkGoogleAccountRequest : public PlayFabRequestCommon
@@ -19454,17 +9827,9 @@ namespace PlayFab
 
             ~UnlinkGoogleAccountRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UnlinkGoogleAccountResult : public PlayFabResultCommon
@@ -19480,15 +9845,9 @@ namespace PlayFab
 
             ~UnlinkGoogleAccountResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UnlinkIOSDeviceIDRequest : public PlayFabRequestCommon
@@ -19510,19 +9869,9 @@ namespace PlayFab
 
             ~UnlinkIOSDeviceIDRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["DeviceId"], DeviceId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_DeviceId; ToJsonUtilS(DeviceId, each_DeviceId); output["DeviceId"] = each_DeviceId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UnlinkIOSDeviceIDResult : public PlayFabResultCommon
@@ -19538,15 +9887,9 @@ namespace PlayFab
 
             ~UnlinkIOSDeviceIDResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UnlinkKongregateAccountRequest : public PlayFabRequestCommon
@@ -19565,17 +9908,9 @@ namespace PlayFab
 
             ~UnlinkKongregateAccountRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UnlinkKongregateAccountResult : public PlayFabResultCommon
@@ -19591,15 +9926,9 @@ namespace PlayFab
 
             ~UnlinkKongregateAccountResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UnlinkNintendoServiceAccountRequest : public PlayFabRequestCommon
@@ -19618,17 +9947,9 @@ namespace PlayFab
 
             ~UnlinkNintendoServiceAccountRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UnlinkNintendoSwitchDeviceIdRequest : public PlayFabRequestCommon
@@ -19650,19 +9971,9 @@ namespace PlayFab
 
             ~UnlinkNintendoSwitchDeviceIdRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["NintendoSwitchDeviceId"], NintendoSwitchDeviceId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_NintendoSwitchDeviceId; ToJsonUtilS(NintendoSwitchDeviceId, each_NintendoSwitchDeviceId); output["NintendoSwitchDeviceId"] = each_NintendoSwitchDeviceId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UnlinkNintendoSwitchDeviceIdResult : public PlayFabResultCommon
@@ -19678,15 +9989,9 @@ namespace PlayFab
 
             ~UnlinkNintendoSwitchDeviceIdResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UnlinkOpenIdConnectRequest : public PlayFabRequestCommon
@@ -19708,19 +10013,9 @@ namespace PlayFab
 
             ~UnlinkOpenIdConnectRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["ConnectionId"], ConnectionId);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ConnectionId; ToJsonUtilS(ConnectionId, each_ConnectionId); output["ConnectionId"] = each_ConnectionId;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UnlinkPSNAccountRequest : public PlayFabRequestCommon
@@ -19739,17 +10034,9 @@ namespace PlayFab
 
             ~UnlinkPSNAccountRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UnlinkPSNAccountResult : public PlayFabResultCommon
@@ -19765,15 +10052,9 @@ namespace PlayFab
 
             ~UnlinkPSNAccountResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UnlinkSteamAccountRequest : public PlayFabRequestCommon
@@ -19792,17 +10073,9 @@ namespace PlayFab
 
             ~UnlinkSteamAccountRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UnlinkSteamAccountResult : public PlayFabResultCommon
@@ -19818,15 +10091,9 @@ namespace PlayFab
 
             ~UnlinkSteamAccountResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UnlinkTwitchAccountRequest : public PlayFabRequestCommon
@@ -19848,19 +10115,9 @@ namespace PlayFab
 
             ~UnlinkTwitchAccountRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["AccessToken"], AccessToken);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AccessToken; ToJsonUtilS(AccessToken, each_AccessToken); output["AccessToken"] = each_AccessToken;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UnlinkTwitchAccountResult : public PlayFabResultCommon
@@ -19876,15 +10133,9 @@ namespace PlayFab
 
             ~UnlinkTwitchAccountResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UnlinkWindowsHelloAccountRequest : public PlayFabRequestCommon
@@ -19906,19 +10157,9 @@ namespace PlayFab
 
             ~UnlinkWindowsHelloAccountRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["PublicKeyHint"], PublicKeyHint);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_PublicKeyHint; ToJsonUtilS(PublicKeyHint, each_PublicKeyHint); output["PublicKeyHint"] = each_PublicKeyHint;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UnlinkWindowsHelloAccountResponse : public PlayFabResultCommon
@@ -19934,15 +10175,9 @@ namespace PlayFab
 
             ~UnlinkWindowsHelloAccountResponse() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UnlinkXboxAccountRequest : public PlayFabRequestCommon
@@ -19961,17 +10196,9 @@ namespace PlayFab
 
             ~UnlinkXboxAccountRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UnlinkXboxAccountResult : public PlayFabResultCommon
@@ -19987,15 +10214,9 @@ namespace PlayFab
 
             ~UnlinkXboxAccountResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UnlockContainerInstanceRequest : public PlayFabRequestCommon
@@ -20026,25 +10247,9 @@ namespace PlayFab
 
             ~UnlockContainerInstanceRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CatalogVersion"], CatalogVersion);
-                FromJsonUtilS(input["CharacterId"], CharacterId);
-                FromJsonUtilS(input["ContainerItemInstanceId"], ContainerItemInstanceId);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["KeyItemInstanceId"], KeyItemInstanceId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); output["CatalogVersion"] = each_CatalogVersion;
-                Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); output["CharacterId"] = each_CharacterId;
-                Json::Value each_ContainerItemInstanceId; ToJsonUtilS(ContainerItemInstanceId, each_ContainerItemInstanceId); output["ContainerItemInstanceId"] = each_ContainerItemInstanceId;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_KeyItemInstanceId; ToJsonUtilS(KeyItemInstanceId, each_KeyItemInstanceId); output["KeyItemInstanceId"] = each_KeyItemInstanceId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct UnlockContainerItemRequest : public PlayFabRequestCommon
@@ -20072,23 +10277,9 @@ namespace PlayFab
 
             ~UnlockContainerItemRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CatalogVersion"], CatalogVersion);
-                FromJsonUtilS(input["CharacterId"], CharacterId);
-                FromJsonUtilS(input["ContainerItemId"], ContainerItemId);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); output["CatalogVersion"] = each_CatalogVersion;
-                Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); output["CharacterId"] = each_CharacterId;
-                Json::Value each_ContainerItemId; ToJsonUtilS(ContainerItemId, each_ContainerItemId); output["ContainerItemId"] = each_ContainerItemId;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct UnlockContainerItemResult : public PlayFabResultCommon
@@ -20116,23 +10307,9 @@ namespace PlayFab
 
             ~UnlockContainerItemResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["GrantedItems"], GrantedItems);
-                FromJsonUtilS(input["UnlockedItemInstanceId"], UnlockedItemInstanceId);
-                FromJsonUtilS(input["UnlockedWithItemInstanceId"], UnlockedWithItemInstanceId);
-                FromJsonUtilP(input["VirtualCurrency"], VirtualCurrency);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_GrantedItems; ToJsonUtilO(GrantedItems, each_GrantedItems); output["GrantedItems"] = each_GrantedItems;
-                Json::Value each_UnlockedItemInstanceId; ToJsonUtilS(UnlockedItemInstanceId, each_UnlockedItemInstanceId); output["UnlockedItemInstanceId"] = each_UnlockedItemInstanceId;
-                Json::Value each_UnlockedWithItemInstanceId; ToJsonUtilS(UnlockedWithItemInstanceId, each_UnlockedWithItemInstanceId); output["UnlockedWithItemInstanceId"] = each_UnlockedWithItemInstanceId;
-                Json::Value each_VirtualCurrency; ToJsonUtilP(VirtualCurrency, each_VirtualCurrency); output["VirtualCurrency"] = each_VirtualCurrency;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct UpdateAvatarUrlRequest : public PlayFabRequestCommon
@@ -20151,17 +10328,9 @@ namespace PlayFab
 
             ~UpdateAvatarUrlRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["ImageUrl"], ImageUrl);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ImageUrl; ToJsonUtilS(ImageUrl, each_ImageUrl); output["ImageUrl"] = each_ImageUrl;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UpdateCharacterDataRequest : public PlayFabRequestCommon
@@ -20192,25 +10361,9 @@ namespace PlayFab
 
             ~UpdateCharacterDataRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CharacterId"], CharacterId);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["Data"], Data);
-                FromJsonUtilS(input["KeysToRemove"], KeysToRemove);
-                FromJsonUtilE(input["Permission"], Permission);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); output["CharacterId"] = each_CharacterId;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Data; ToJsonUtilS(Data, each_Data); output["Data"] = each_Data;
-                Json::Value each_KeysToRemove; ToJsonUtilS(KeysToRemove, each_KeysToRemove); output["KeysToRemove"] = each_KeysToRemove;
-                Json::Value each_Permission; ToJsonUtilE(Permission, each_Permission); output["Permission"] = each_Permission;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct UpdateCharacterDataResult : public PlayFabResultCommon
@@ -20229,17 +10382,9 @@ namespace PlayFab
 
             ~UpdateCharacterDataResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["DataVersion"], DataVersion);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_DataVersion; ToJsonUtilP(DataVersion, each_DataVersion); output["DataVersion"] = each_DataVersion;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UpdateCharacterStatisticsRequest : public PlayFabRequestCommon
@@ -20264,21 +10409,9 @@ namespace PlayFab
 
             ~UpdateCharacterStatisticsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CharacterId"], CharacterId);
-                FromJsonUtilP(input["CharacterStatistics"], CharacterStatistics);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); output["CharacterId"] = each_CharacterId;
-                Json::Value each_CharacterStatistics; ToJsonUtilP(CharacterStatistics, each_CharacterStatistics); output["CharacterStatistics"] = each_CharacterStatistics;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UpdateCharacterStatisticsResult : public PlayFabResultCommon
@@ -20294,15 +10427,9 @@ namespace PlayFab
 
             ~UpdateCharacterStatisticsResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UpdatePlayerStatisticsRequest : public PlayFabRequestCommon
@@ -20324,19 +10451,9 @@ namespace PlayFab
 
             ~UpdatePlayerStatisticsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Statistics"], Statistics);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Statistics; ToJsonUtilO(Statistics, each_Statistics); output["Statistics"] = each_Statistics;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UpdatePlayerStatisticsResult : public PlayFabResultCommon
@@ -20352,15 +10469,9 @@ namespace PlayFab
 
             ~UpdatePlayerStatisticsResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UpdateSharedGroupDataRequest : public PlayFabRequestCommon
@@ -20391,25 +10502,9 @@ namespace PlayFab
 
             ~UpdateSharedGroupDataRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["Data"], Data);
-                FromJsonUtilS(input["KeysToRemove"], KeysToRemove);
-                FromJsonUtilE(input["Permission"], Permission);
-                FromJsonUtilS(input["SharedGroupId"], SharedGroupId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Data; ToJsonUtilS(Data, each_Data); output["Data"] = each_Data;
-                Json::Value each_KeysToRemove; ToJsonUtilS(KeysToRemove, each_KeysToRemove); output["KeysToRemove"] = each_KeysToRemove;
-                Json::Value each_Permission; ToJsonUtilE(Permission, each_Permission); output["Permission"] = each_Permission;
-                Json::Value each_SharedGroupId; ToJsonUtilS(SharedGroupId, each_SharedGroupId); output["SharedGroupId"] = each_SharedGroupId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct UpdateSharedGroupDataResult : public PlayFabResultCommon
@@ -20425,15 +10520,9 @@ namespace PlayFab
 
             ~UpdateSharedGroupDataResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UpdateUserDataRequest : public PlayFabRequestCommon
@@ -20461,23 +10550,9 @@ namespace PlayFab
 
             ~UpdateUserDataRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["Data"], Data);
-                FromJsonUtilS(input["KeysToRemove"], KeysToRemove);
-                FromJsonUtilE(input["Permission"], Permission);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Data; ToJsonUtilS(Data, each_Data); output["Data"] = each_Data;
-                Json::Value each_KeysToRemove; ToJsonUtilS(KeysToRemove, each_KeysToRemove); output["KeysToRemove"] = each_KeysToRemove;
-                Json::Value each_Permission; ToJsonUtilE(Permission, each_Permission); output["Permission"] = each_Permission;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct UpdateUserDataResult : public PlayFabResultCommon
@@ -20496,17 +10571,9 @@ namespace PlayFab
 
             ~UpdateUserDataResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["DataVersion"], DataVersion);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_DataVersion; ToJsonUtilP(DataVersion, each_DataVersion); output["DataVersion"] = each_DataVersion;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UpdateUserTitleDisplayNameRequest : public PlayFabRequestCommon
@@ -20528,19 +10595,9 @@ namespace PlayFab
 
             ~UpdateUserTitleDisplayNameRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["DisplayName"], DisplayName);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); output["DisplayName"] = each_DisplayName;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UpdateUserTitleDisplayNameResult : public PlayFabResultCommon
@@ -20559,17 +10616,9 @@ namespace PlayFab
 
             ~UpdateUserTitleDisplayNameResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["DisplayName"], DisplayName);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); output["DisplayName"] = each_DisplayName;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ValidateAmazonReceiptRequest : public PlayFabRequestCommon
@@ -20603,27 +10652,9 @@ namespace PlayFab
 
             ~ValidateAmazonReceiptRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CatalogVersion"], CatalogVersion);
-                FromJsonUtilS(input["CurrencyCode"], CurrencyCode);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["PurchasePrice"], PurchasePrice);
-                FromJsonUtilS(input["ReceiptId"], ReceiptId);
-                FromJsonUtilS(input["UserId"], UserId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); output["CatalogVersion"] = each_CatalogVersion;
-                Json::Value each_CurrencyCode; ToJsonUtilS(CurrencyCode, each_CurrencyCode); output["CurrencyCode"] = each_CurrencyCode;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_PurchasePrice; ToJsonUtilP(PurchasePrice, each_PurchasePrice); output["PurchasePrice"] = each_PurchasePrice;
-                Json::Value each_ReceiptId; ToJsonUtilS(ReceiptId, each_ReceiptId); output["ReceiptId"] = each_ReceiptId;
-                Json::Value each_UserId; ToJsonUtilS(UserId, each_UserId); output["UserId"] = each_UserId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct ValidateAmazonReceiptResult : public PlayFabResultCommon
@@ -20642,17 +10673,9 @@ namespace PlayFab
 
             ~ValidateAmazonReceiptResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Fulfillments"], Fulfillments);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Fulfillments; ToJsonUtilO(Fulfillments, each_Fulfillments); output["Fulfillments"] = each_Fulfillments;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ValidateGooglePlayPurchaseRequest : public PlayFabRequestCommon
@@ -20686,27 +10709,9 @@ namespace PlayFab
 
             ~ValidateGooglePlayPurchaseRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CatalogVersion"], CatalogVersion);
-                FromJsonUtilS(input["CurrencyCode"], CurrencyCode);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["PurchasePrice"], PurchasePrice);
-                FromJsonUtilS(input["ReceiptJson"], ReceiptJson);
-                FromJsonUtilS(input["Signature"], Signature);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); output["CatalogVersion"] = each_CatalogVersion;
-                Json::Value each_CurrencyCode; ToJsonUtilS(CurrencyCode, each_CurrencyCode); output["CurrencyCode"] = each_CurrencyCode;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_PurchasePrice; ToJsonUtilP(PurchasePrice, each_PurchasePrice); output["PurchasePrice"] = each_PurchasePrice;
-                Json::Value each_ReceiptJson; ToJsonUtilS(ReceiptJson, each_ReceiptJson); output["ReceiptJson"] = each_ReceiptJson;
-                Json::Value each_Signature; ToJsonUtilS(Signature, each_Signature); output["Signature"] = each_Signature;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct ValidateGooglePlayPurchaseResult : public PlayFabResultCommon
@@ -20725,17 +10730,9 @@ namespace PlayFab
 
             ~ValidateGooglePlayPurchaseResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Fulfillments"], Fulfillments);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Fulfillments; ToJsonUtilO(Fulfillments, each_Fulfillments); output["Fulfillments"] = each_Fulfillments;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ValidateIOSReceiptRequest : public PlayFabRequestCommon
@@ -20766,25 +10763,9 @@ namespace PlayFab
 
             ~ValidateIOSReceiptRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CatalogVersion"], CatalogVersion);
-                FromJsonUtilS(input["CurrencyCode"], CurrencyCode);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["PurchasePrice"], PurchasePrice);
-                FromJsonUtilS(input["ReceiptData"], ReceiptData);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); output["CatalogVersion"] = each_CatalogVersion;
-                Json::Value each_CurrencyCode; ToJsonUtilS(CurrencyCode, each_CurrencyCode); output["CurrencyCode"] = each_CurrencyCode;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_PurchasePrice; ToJsonUtilP(PurchasePrice, each_PurchasePrice); output["PurchasePrice"] = each_PurchasePrice;
-                Json::Value each_ReceiptData; ToJsonUtilS(ReceiptData, each_ReceiptData); output["ReceiptData"] = each_ReceiptData;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct ValidateIOSReceiptResult : public PlayFabResultCommon
@@ -20803,17 +10784,9 @@ namespace PlayFab
 
             ~ValidateIOSReceiptResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Fulfillments"], Fulfillments);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Fulfillments; ToJsonUtilO(Fulfillments, each_Fulfillments); output["Fulfillments"] = each_Fulfillments;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ValidateWindowsReceiptRequest : public PlayFabRequestCommon
@@ -20844,25 +10817,9 @@ namespace PlayFab
 
             ~ValidateWindowsReceiptRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CatalogVersion"], CatalogVersion);
-                FromJsonUtilS(input["CurrencyCode"], CurrencyCode);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["PurchasePrice"], PurchasePrice);
-                FromJsonUtilS(input["Receipt"], Receipt);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); output["CatalogVersion"] = each_CatalogVersion;
-                Json::Value each_CurrencyCode; ToJsonUtilS(CurrencyCode, each_CurrencyCode); output["CurrencyCode"] = each_CurrencyCode;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_PurchasePrice; ToJsonUtilP(PurchasePrice, each_PurchasePrice); output["PurchasePrice"] = each_PurchasePrice;
-                Json::Value each_Receipt; ToJsonUtilS(Receipt, each_Receipt); output["Receipt"] = each_Receipt;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct ValidateWindowsReceiptResult : public PlayFabResultCommon
@@ -20881,17 +10838,9 @@ namespace PlayFab
 
             ~ValidateWindowsReceiptResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Fulfillments"], Fulfillments);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Fulfillments; ToJsonUtilO(Fulfillments, each_Fulfillments); output["Fulfillments"] = each_Fulfillments;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct WriteClientCharacterEventRequest : public PlayFabRequestCommon
@@ -20922,25 +10871,9 @@ namespace PlayFab
 
             ~WriteClientCharacterEventRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                Body = input["Body"];
-                FromJsonUtilS(input["CharacterId"], CharacterId);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["EventName"], EventName);
-                FromJsonUtilT(input["Timestamp"], Timestamp);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                output["Body"] = Body;
-                Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); output["CharacterId"] = each_CharacterId;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_EventName; ToJsonUtilS(EventName, each_EventName); output["EventName"] = each_EventName;
-                Json::Value each_Timestamp; ToJsonUtilT(Timestamp, each_Timestamp); output["Timestamp"] = each_Timestamp;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct WriteClientPlayerEventRequest : public PlayFabRequestCommon
@@ -20968,23 +10901,9 @@ namespace PlayFab
 
             ~WriteClientPlayerEventRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                Body = input["Body"];
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["EventName"], EventName);
-                FromJsonUtilT(input["Timestamp"], Timestamp);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                output["Body"] = Body;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_EventName; ToJsonUtilS(EventName, each_EventName); output["EventName"] = each_EventName;
-                Json::Value each_Timestamp; ToJsonUtilT(Timestamp, each_Timestamp); output["Timestamp"] = each_Timestamp;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct WriteEventResponse : public PlayFabResultCommon
@@ -21003,17 +10922,9 @@ namespace PlayFab
 
             ~WriteEventResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["EventId"], EventId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_EventId; ToJsonUtilS(EventId, each_EventId); output["EventId"] = each_EventId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct WriteTitleEventRequest : public PlayFabRequestCommon
@@ -21041,23 +10952,9 @@ namespace PlayFab
 
             ~WriteTitleEventRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                Body = input["Body"];
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["EventName"], EventName);
-                FromJsonUtilT(input["Timestamp"], Timestamp);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                output["Body"] = Body;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_EventName; ToJsonUtilS(EventName, each_EventName); output["EventName"] = each_EventName;
-                Json::Value each_Timestamp; ToJsonUtilT(Timestamp, each_Timestamp); output["Timestamp"] = each_Timestamp;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
     }
@@ -0,0 +1,414 @@
+#pragma once
+
+#if !defined(DISABLE_PLAYFABCLIENT_API)
+
+namespace PlayFab
+{
+    namespace ClientModels
+    {
+        // Forward declarations of the Client models, for headers which only pass them by reference
+        enum class AdActivity;
+        enum class CloudScriptRevisionOption;
+        enum class ContinentCode;
+        enum class CountryCode;
+        enum class Currency;
+        enum class EmailVerificationStatus;
+        enum class GameInstanceState;
+        enum class LoginIdentityProvider;
+        enum class MatchmakeStatus;
+        enum class PushNotificationPlatform;
+        enum class Region;
+        enum class SourceType;
+        enum class SubscriptionProviderStatus;
+        enum class TitleActivationStatus;
+        enum class TradeStatus;
+        enum class TransactionStatus;
+        enum class UserDataPermission;
+        enum class UserOrigination;
+
+        struct AcceptTradeRequest;
+        struct TradeInfo;
+        struct AcceptTradeResponse;
+        struct AdCampaignAttributionModel;
+        struct AddFriendRequest;
+        struct AddFriendResult;
+        struct GenericServiceId;
+        struct AddGenericIDRequest;
+        struct AddGenericIDResult;
+        struct AddOrUpdateContactEmailRequest;
+        struct AddOrUpdateContactEmailResult;
+        struct AddSharedGroupMembersRequest;
+        struct AddSharedGroupMembersResult;
+        struct AddUsernamePasswordRequest;
+        struct AddUsernamePasswordResult;
+        struct AddUserVirtualCurrencyRequest;
+        struct AdPlacementDetails;
+        struct AdRewardItemGranted;
+        struct AdRewardResults;
+        struct AndroidDevicePushNotificationRegistrationRequest;
+        struct AndroidDevicePushNotificationRegistrationResult;
+        struct AttributeInstallRequest;
+        struct AttributeInstallResult;
+        struct CancelTradeRequest;
+        struct CancelTradeResponse;
+        struct CartItem;
+        struct CatalogItemBundleInfo;
+        struct CatalogItemConsumableInfo;
+        struct CatalogItemContainerInfo;
+        struct CatalogItem;
+        struct ItemInstance;
+        struct CharacterInventory;
+        struct CharacterLeaderboardEntry;
+        struct CharacterResult;
+        struct Container_Dictionary_String_String;
+        struct CollectionFilter;
+        struct ConfirmPurchaseRequest;
+        struct ConfirmPurchaseResult;
+        struct ConsumeItemRequest;
+        struct ConsumeItemResult;
+        struct MicrosoftStorePayload;
+        struct ConsumeMicrosoftStoreEntitlementsRequest;
+        struct ConsumeMicrosoftStoreEntitlementsResponse;
+        struct PlayStation5Payload;
+        struct ConsumePS5EntitlementsRequest;
+        struct ConsumePS5EntitlementsResult;
+        struct ConsumePSNEntitlementsRequest;
+        struct ConsumePSNEntitlementsResult;
+        struct ConsumeXboxEntitlementsRequest;
+        struct ConsumeXboxEntitlementsResult;
+        struct ContactEmailInfoModel;
+        struct CreateSharedGroupRequest;
+        struct CreateSharedGroupResult;
+        struct CurrentGamesRequest;
+        struct GameInfo;
+        struct CurrentGamesResult;
+        struct DeviceInfoRequest;
+        struct EmptyResponse;
+        struct EmptyResult;
+        struct EntityKey;
+        struct EntityTokenResponse;
+        struct ExecuteCloudScriptRequest;
+        struct ScriptExecutionError;
+        struct LogStatement;
+        struct ExecuteCloudScriptResult;
+        struct FacebookInstantGamesPlayFabIdPair;
+        struct FacebookPlayFabIdPair;
+        struct UserFacebookInfo;
+        struct UserGameCenterInfo;
+        struct LinkedPlatformAccountModel;
+        struct LocationModel;
+        struct SubscriptionModel;
+        struct MembershipModel;
+        struct PushNotificationRegistrationModel;
+        struct StatisticModel;
+        struct TagModel;
+        struct ValueToDateModel;
+        struct PlayerProfileModel;
+        struct UserPsnInfo;
+        struct UserSteamInfo;
+        struct UserXboxInfo;
+        struct FriendInfo;
+        struct GameCenterPlayFabIdPair;
+        struct GameServerRegionsRequest;
+        struct RegionInfo;
+        struct GameServerRegionsResult;
+        struct GenericPlayFabIdPair;
+        struct GetAccountInfoRequest;
+        struct UserAndroidDeviceInfo;
+        struct UserAppleIdInfo;
+        struct UserCustomIdInfo;
+        struct UserFacebookInstantGamesIdInfo;
+        struct UserGoogleInfo;
+        struct UserIosDeviceInfo;
+        struct UserKongregateInfo;
+        struct UserNintendoSwitchAccountIdInfo;
+        struct UserNintendoSwitchDeviceIdInfo;
+        struct UserOpenIdInfo;
+        struct UserPrivateAccountInfo;
+        struct UserTitleInfo;
+        struct UserTwitchInfo;
+        struct UserWindowsHelloInfo;
+        struct UserAccountInfo;
+        struct GetAccountInfoResult;
+        struct NameIdentifier;
+        struct GetAdPlacementsRequest;
+        struct GetAdPlacementsResult;
+        struct GetCatalogItemsRequest;
+        struct GetCatalogItemsResult;
+        struct GetCharacterDataRequest;
+        struct UserDataRecord;
+        struct GetCharacterDataResult;
+        struct GetCharacterInventoryRequest;
+        struct VirtualCurrencyRechargeTime;
+        struct GetCharacterInventoryResult;
+        struct GetCharacterLeaderboardRequest;
+        struct GetCharacterLeaderboardResult;
+        struct GetCharacterStatisticsRequest;
+        struct GetCharacterStatisticsResult;
+        struct GetContentDownloadUrlRequest;
+        struct GetContentDownloadUrlResult;
+        struct PlayerProfileViewConstraints;
+        struct GetFriendLeaderboardAroundPlayerRequest;
+        struct PlayerLeaderboardEntry;
+        struct GetFriendLeaderboardAroundPlayerResult;
+        struct GetFriendLeaderboardRequest;
+        struct GetFriendsListRequest;
+        struct GetFriendsListResult;
+        struct GetLeaderboardAroundCharacterRequest;
+        struct GetLeaderboardAroundCharacterResult;
+        struct GetLeaderboardAroundPlayerRequest;
+        struct GetLeaderboardAroundPlayerResult;
+        struct GetLeaderboardForUsersCharactersRequest;
+        struct GetLeaderboardForUsersCharactersResult;
+        struct GetLeaderboardRequest;
+        struct GetLeaderboardResult;
+        struct GetPaymentTokenRequest;
+        struct GetPaymentTokenResult;
+        struct GetPhotonAuthenticationTokenRequest;
+        struct GetPhotonAuthenticationTokenResult;
+        struct GetPlayerCombinedInfoRequestParams;
+        struct GetPlayerCombinedInfoRequest;
+        struct StatisticValue;
+        struct GetPlayerCombinedInfoResultPayload;
+        struct GetPlayerCombinedInfoResult;
+        struct GetPlayerProfileRequest;
+        struct GetPlayerProfileResult;
+        struct GetPlayerSegmentsRequest;
+        struct GetSegmentResult;
+        struct GetPlayerSegmentsResult;
+        struct StatisticNameVersion;
+        struct GetPlayerStatisticsRequest;
+        struct GetPlayerStatisticsResult;
+        struct GetPlayerStatisticVersionsRequest;
+        struct PlayerStatisticVersion;
+        struct GetPlayerStatisticVersionsResult;
+        struct GetPlayerTagsRequest;
+        struct GetPlayerTagsResult;
+        struct GetPlayerTradesRequest;
+        struct GetPlayerTradesResponse;
+        struct GetPlayFabIDsFromFacebookIDsRequest;
+        struct GetPlayFabIDsFromFacebookIDsResult;
+        struct GetPlayFabIDsFromFacebookInstantGamesIdsRequest;
+        struct GetPlayFabIDsFromFacebookInstantGamesIdsResult;
+        struct GetPlayFabIDsFromGameCenterIDsRequest;
+        struct GetPlayFabIDsFromGameCenterIDsResult;
+        struct GetPlayFabIDsFromGenericIDsRequest;
+        struct GetPlayFabIDsFromGenericIDsResult;
+        struct GetPlayFabIDsFromGoogleIDsRequest;
+        struct GooglePlayFabIdPair;
+        struct GetPlayFabIDsFromGoogleIDsResult;
+        struct GetPlayFabIDsFromKongregateIDsRequest;
+        struct KongregatePlayFabIdPair;
+        struct GetPlayFabIDsFromKongregateIDsResult;
+        struct GetPlayFabIDsFromNintendoSwitchDeviceIdsRequest;
+        struct NintendoSwitchPlayFabIdPair;
+        struct GetPlayFabIDsFromNintendoSwitchDeviceIdsResult;
+        struct GetPlayFabIDsFromPSNAccountIDsRequest;
+        struct PSNAccountPlayFabIdPair;
+        struct GetPlayFabIDsFromPSNAccountIDsResult;
+        struct GetPlayFabIDsFromSteamIDsRequest;
+        struct SteamPlayFabIdPair;
+        struct GetPlayFabIDsFromSteamIDsResult;
+        struct GetPlayFabIDsFromTwitchIDsRequest;
+        struct TwitchPlayFabIdPair;
+        struct GetPlayFabIDsFromTwitchIDsResult;
+        struct GetPlayFabIDsFromXboxLiveIDsRequest;
+        struct XboxLiveAccountPlayFabIdPair;
+        struct GetPlayFabIDsFromXboxLiveIDsResult;
+        struct GetPublisherDataRequest;
+        struct GetPublisherDataResult;
+        struct GetPurchaseRequest;
+        struct GetPurchaseResult;
+        struct GetSharedGroupDataRequest;
+        struct SharedGroupDataRecord;
+        struct GetSharedGroupDataResult;
+        struct GetStoreItemsRequest;
+        struct StoreMarketingModel;
+        struct StoreItem;
+        struct GetStoreItemsResult;
+        struct GetTimeRequest;
+        struct GetTimeResult;
+        struct GetTitleDataRequest;
+        struct GetTitleDataResult;
+        struct GetTitleNewsRequest;
+        struct TitleNewsItem;
+        struct GetTitleNewsResult;
+        struct GetTitlePublicKeyRequest;
+        struct GetTitlePublicKeyResult;
+        struct GetTradeStatusRequest;
+        struct GetTradeStatusResponse;
+        struct GetUserDataRequest;
+        struct GetUserDataResult;
+        struct GetUserInventoryRequest;
+        struct GetUserInventoryResult;
+        struct GetWindowsHelloChallengeRequest;
+        struct GetWindowsHelloChallengeResponse;
+        struct GrantCharacterToUserRequest;
+        struct GrantCharacterToUserResult;
+        struct ItemPurchaseRequest;
+        struct LinkAndroidDeviceIDRequest;
+        struct LinkAndroidDeviceIDResult;
+        struct LinkAppleRequest;
+        struct LinkCustomIDRequest;
+        struct LinkCustomIDResult;
+        struct LinkFacebookAccountRequest;
+        struct LinkFacebookAccountResult;
+        struct LinkFacebookInstantGamesIdRequest;
+        struct LinkFacebookInstantGamesIdResult;
+        struct LinkGameCenterAccountRequest;
+        struct LinkGameCenterAccountResult;
+        struct LinkGoogleAccountRequest;
+        struct LinkGoogleAccountResult;
+        struct LinkIOSDeviceIDRequest;
+        struct LinkIOSDeviceIDResult;
+        struct LinkKongregateAccountRequest;
+        struct LinkKongregateAccountResult;
+        struct LinkNintendoServiceAccountRequest;
+        struct LinkNintendoSwitchDeviceIdRequest;
+        struct LinkNintendoSwitchDeviceIdResult;
+        struct LinkOpenIdConnectRequest;
+        struct LinkPSNAccountRequest;
+        struct LinkPSNAccountResult;
+        struct LinkSteamAccountRequest;
+        struct LinkSteamAccountResult;
+        struct LinkTwitchAccountRequest;
+        struct LinkTwitchAccountResult;
+        struct LinkWindowsHelloAccountRequest;
+        struct LinkWindowsHelloAccountResponse;
+        struct LinkXboxAccountRequest;
+        struct LinkXboxAccountResult;
+        struct ListUsersCharactersRequest;
+        struct ListUsersCharactersResult;
+        struct UserSettings;
+        struct Variable;
+        struct TreatmentAssignment;
+        struct LoginResult;
+        struct LoginWithAndroidDeviceIDRequest;
+        struct LoginWithAppleRequest;
+        struct LoginWithCustomIDRequest;
+        struct LoginWithEmailAddressRequest;
+        struct LoginWithFacebookInstantGamesIdRequest;
+        struct LoginWithFacebookRequest;
+        struct LoginWithGameCenterRequest;
+        struct LoginWithGoogleAccountRequest;
+        struct LoginWithIOSDeviceIDRequest;
+        struct LoginWithKongregateRequest;
+        struct LoginWithNintendoServiceAccountRequest;
+        struct LoginWithNintendoSwitchDeviceIdRequest;
+        struct LoginWithOpenIdConnectRequest;
+        struct LoginWithPlayFabRequest;
+        struct LoginWithPSNRequest;
+        struct LoginWithSteamRequest;
+        struct LoginWithTwitchRequest;
+        struct LoginWithWindowsHelloRequest;
+        struct LoginWithXboxRequest;
+        struct MatchmakeRequest;
+        struct MatchmakeResult;
+        struct ModifyUserVirtualCurrencyResult;
+        struct OpenTradeRequest;
+        struct OpenTradeResponse;
+        struct PayForPurchaseRequest;
+        struct PayForPurchaseResult;
+        struct PaymentOption;
+        struct PurchaseItemRequest;
+        struct PurchaseItemResult;
+        struct PurchaseReceiptFulfillment;
+        struct RedeemCouponRequest;
+        struct RedeemCouponResult;
+        struct RefreshPSNAuthTokenRequest;
+        struct RegisterForIOSPushNotificationRequest;
+        struct RegisterForIOSPushNotificationResult;
+        struct RegisterPlayFabUserRequest;
+        struct RegisterPlayFabUserResult;
+        struct RegisterWithWindowsHelloRequest;
+        struct RemoveContactEmailRequest;
+        struct RemoveContactEmailResult;
+        struct RemoveFriendRequest;
+        struct RemoveFriendResult;
+        struct RemoveGenericIDRequest;
+        struct RemoveGenericIDResult;
+        struct RemoveSharedGroupMembersRequest;
+        struct RemoveSharedGroupMembersResult;
+        struct ReportAdActivityRequest;
+        struct ReportAdActivityResult;
+        struct ReportPlayerClientRequest;
+        struct ReportPlayerClientResult;
+        struct RestoreIOSPurchasesRequest;
+        struct RestoreIOSPurchasesResult;
+        struct RewardAdActivityRequest;
+        struct RewardAdActivityResult;
+        struct SendAccountRecoveryEmailRequest;
+        struct SendAccountRecoveryEmailResult;
+        struct SetFriendTagsRequest;
+        struct SetFriendTagsResult;
+        struct SetPlayerSecretRequest;
+        struct SetPlayerSecretResult;
+        struct StartGameRequest;
+        struct StartGameResult;
+        struct StartPurchaseRequest;
+        struct StartPurchaseResult;
+        struct StatisticUpdate;
+        struct SubtractUserVirtualCurrencyRequest;
+        struct UnlinkAndroidDeviceIDRequest;
+        struct UnlinkAndroidDeviceIDResult;
+        struct UnlinkAppleRequest;
+        struct UnlinkCustomIDRequest;
+        struct UnlinkCustomIDResult;
+        struct UnlinkFacebookAccountRequest;
+        struct UnlinkFacebookAccountResult;
+        struct UnlinkFacebookInstantGamesIdRequest;
+        struct UnlinkFacebookInstantGamesIdResult;
+        struct UnlinkGameCenterAccountRequest;
+        struct UnlinkGameCenterAccountResult;
+        struct UnlinkGoogleAccountRequest;
+        struct UnlinkGoogleAccountResult;
+        struct UnlinkIOSDeviceIDRequest;
+        struct UnlinkIOSDeviceIDResult;
+        struct UnlinkKongregateAccountRequest;
+        struct UnlinkKongregateAccountResult;
+        struct UnlinkNintendoServiceAccountRequest;
+        struct UnlinkNintendoSwitchDeviceIdRequest;
+        struct UnlinkNintendoSwitchDeviceIdResult;
+        struct UnlinkOpenIdConnectRequest;
+        struct UnlinkPSNAccountRequest;
+        struct UnlinkPSNAccountResult;
+        struct UnlinkSteamAccountRequest;
+        struct UnlinkSteamAccountResult;
+        struct UnlinkTwitchAccountRequest;
+        struct UnlinkTwitchAccountResult;
+        struct UnlinkWindowsHelloAccountRequest;
+        struct UnlinkWindowsHelloAccountResponse;
+        struct UnlinkXboxAccountRequest;
+        struct UnlinkXboxAccountResult;
+        struct UnlockContainerInstanceRequest;
+        struct UnlockContainerItemRequest;
+        struct UnlockContainerItemResult;
+        struct UpdateAvatarUrlRequest;
+        struct UpdateCharacterDataRequest;
+        struct UpdateCharacterDataResult;
+        struct UpdateCharacterStatisticsRequest;
+        struct UpdateCharacterStatisticsResult;
+        struct UpdatePlayerStatisticsRequest;
+        struct UpdatePlayerStatisticsResult;
+        struct UpdateSharedGroupDataRequest;
+        struct UpdateSharedGroupDataResult;
+        struct UpdateUserDataRequest;
+        struct UpdateUserDataResult;
+        struct UpdateUserTitleDisplayNameRequest;
+        struct UpdateUserTitleDisplayNameResult;
+        struct ValidateAmazonReceiptRequest;
+        struct ValidateAmazonReceiptResult;
+        struct ValidateGooglePlayPurchaseRequest;
+        struct ValidateGooglePlayPurchaseResult;
+        struct ValidateIOSReceiptRequest;
+        struct ValidateIOSReceiptResult;
+        struct ValidateWindowsReceiptRequest;
+        struct ValidateWindowsReceiptResult;
+        struct WriteClientCharacterEventRequest;
+        struct WriteClientPlayerEventRequest;
+        struct WriteEventResponse;
+        struct WriteTitleEventRequest;
+    }
+}
+
+#endif
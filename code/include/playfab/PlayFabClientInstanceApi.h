@@ -2,8 +2,14 @@
 
 #if !defined(DISABLE_PLAYFABCLIENT_API)
 
+// Opt-in: only forward-declare the models, for files which include the API header but never construct a model
+#if defined(PLAYFAB_API_HEADERS_FWD_MODELS_ONLY)
+#include <playfab/PlayFabClientDataModelsFwd.h>
+#else
 #include <playfab/PlayFabClientDataModels.h>
+#endif
 #include <playfab/PlayFabError.h>
+#include <playfab/PlayFabLazyResult.h>
 
 namespace PlayFab
 {
@@ -218,6 +224,9 @@ namespace PlayFab
         void WritePlayerEvent(ClientModels::WriteClientPlayerEventRequest& request, const ProcessApiCallback<ClientModels::WriteEventResponse> callback, const ErrorCallback errorCallback = nullptr, void* customData = nullptr);
         void WriteTitleEvent(ClientModels::WriteTitleEventRequest& request, const ProcessApiCallback<ClientModels::WriteEventResponse> callback, const ErrorCallback errorCallback = nullptr, void* customData = nullptr);
 
+        // ------------ Lazily decoded variants of API calls with very large results (see PlayFabLazyResult)
+        void GetTitleDataLazy(ClientModels::GetTitleDataRequest& request, const ProcessApiCallback<PlayFabLazyResult<ClientModels::GetTitleDataResult>> callback, const ErrorCallback errorCallback = nullptr, void* customData = nullptr);
+
         // ------------ Generated result handlers
         void OnAcceptTradeResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer);
         void OnAddFriendResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer);
@@ -386,6 +395,7 @@ namespace PlayFab
         void OnWriteCharacterEventResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer);
         void OnWritePlayerEventResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer);
         void OnWriteTitleEventResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer);
+        void OnGetTitleDataLazyResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer);
 
         // Private, Client-Specific
         void MultiStepClientLogin(std::shared_ptr<PlayFabAuthenticationContext> context, bool needsAttribution);
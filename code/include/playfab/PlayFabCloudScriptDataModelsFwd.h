@@ -0,0 +1,58 @@
+#pragma once
+
+#if !defined(DISABLE_PLAYFABENTITY_API)
+
+namespace PlayFab
+{
+    namespace CloudScriptModels
+    {
+        // Forward declarations of the CloudScript models, for headers which only pass them by reference
+        enum class CloudScriptRevisionOption;
+        enum class ContinentCode;
+        enum class CountryCode;
+        enum class EmailVerificationStatus;
+        enum class LoginIdentityProvider;
+        enum class PushNotificationPlatform;
+        enum class SubscriptionProviderStatus;
+        enum class TriggerType;
+
+        struct AdCampaignAttributionModel;
+        struct ContactEmailInfoModel;
+        struct EmptyResult;
+        struct EntityKey;
+        struct ScriptExecutionError;
+        struct LogStatement;
+        struct ExecuteCloudScriptResult;
+        struct ExecuteEntityCloudScriptRequest;
+        struct ExecuteFunctionRequest;
+        struct FunctionExecutionError;
+        struct ExecuteFunctionResult;
+        struct FunctionModel;
+        struct HttpFunctionModel;
+        struct LinkedPlatformAccountModel;
+        struct ListFunctionsRequest;
+        struct ListFunctionsResult;
+        struct ListHttpFunctionsResult;
+        struct QueuedFunctionModel;
+        struct ListQueuedFunctionsResult;
+        struct LocationModel;
+        struct SubscriptionModel;
+        struct MembershipModel;
+        struct NameIdentifier;
+        struct PushNotificationRegistrationModel;
+        struct StatisticModel;
+        struct TagModel;
+        struct ValueToDateModel;
+        struct PlayerProfileModel;
+        struct PlayStreamEventEnvelopeModel;
+        struct PostFunctionResultForEntityTriggeredActionRequest;
+        struct PostFunctionResultForFunctionExecutionRequest;
+        struct PostFunctionResultForPlayerTriggeredActionRequest;
+        struct PostFunctionResultForScheduledTaskRequest;
+        struct RegisterHttpFunctionRequest;
+        struct RegisterQueuedFunctionRequest;
+        struct UnregisterFunctionRequest;
+    }
+}
+
+#endif
@@ -2,6 +2,7 @@
 
 #if !defined(DISABLE_PLAYFABENTITY_API)
 
+#include <playfab/PlayFabDataDataModelsFwd.h>
 #include <playfab/PlayFabBaseModel.h>
 #include <playfab/PlayFabJsonHeaders.h>
 
@@ -18,57 +19,8 @@ namespace PlayFab
             OperationTypesNone
         };
 
-        inline void ToJsonEnum(const OperationTypes input, Json::Value& output)
-        {
-            if (input == OperationTypes::OperationTypesCreated)
-            {
-                output = Json::Value("Created");
-                return;
-            }
-            if (input == OperationTypes::OperationTypesUpdated)
-            {
-                output = Json::Value("Updated");
-                return;
-            }
-            if (input == OperationTypes::OperationTypesDeleted)
-            {
-                output = Json::Value("Deleted");
-                return;
-            }
-            if (input == OperationTypes::OperationTypesNone)
-            {
-                output = Json::Value("None");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, OperationTypes& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "Created")
-            {
-                output = OperationTypes::OperationTypesCreated;
-                return;
-            }
-            if (inputStr == "Updated")
-            {
-                output = OperationTypes::OperationTypesUpdated;
-                return;
-            }
-            if (inputStr == "Deleted")
-            {
-                output = OperationTypes::OperationTypesDeleted;
-                return;
-            }
-            if (inputStr == "None")
-            {
-                output = OperationTypes::OperationTypesNone;
-                return;
-            }
-        }
+        void ToJsonEnum(const OperationTypes input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, OperationTypes& output);
 
         // Data Classes
         struct EntityKey : public PlayFabBaseModel
@@ -90,19 +42,9 @@ namespace PlayFab
 
             ~EntityKey() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Id"], Id);
-                FromJsonUtilS(input["Type"], Type);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Id; ToJsonUtilS(Id, each_Id); output["Id"] = each_Id;
-                Json::Value each_Type; ToJsonUtilS(Type, each_Type); output["Type"] = each_Type;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct AbortFileUploadsRequest : public PlayFabRequestCommon
@@ -130,23 +72,9 @@ namespace PlayFab
 
             ~AbortFileUploadsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilS(input["FileNames"], FileNames);
-                FromJsonUtilP(input["ProfileVersion"], ProfileVersion);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_FileNames; ToJsonUtilS(FileNames, each_FileNames); output["FileNames"] = each_FileNames;
-                Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); output["ProfileVersion"] = each_ProfileVersion;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct AbortFileUploadsResponse : public PlayFabResultCommon
@@ -168,19 +96,9 @@ namespace PlayFab
 
             ~AbortFileUploadsResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilP(input["ProfileVersion"], ProfileVersion);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); output["ProfileVersion"] = each_ProfileVersion;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct DeleteFilesRequest : public PlayFabRequestCommon
@@ -208,23 +126,9 @@ namespace PlayFab
 
             ~DeleteFilesRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilS(input["FileNames"], FileNames);
-                FromJsonUtilP(input["ProfileVersion"], ProfileVersion);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_FileNames; ToJsonUtilS(FileNames, each_FileNames); output["FileNames"] = each_FileNames;
-                Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); output["ProfileVersion"] = each_ProfileVersion;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct DeleteFilesResponse : public PlayFabResultCommon
@@ -246,19 +150,9 @@ namespace PlayFab
 
             ~DeleteFilesResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilP(input["ProfileVersion"], ProfileVersion);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); output["ProfileVersion"] = each_ProfileVersion;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct FinalizeFileUploadsRequest : public PlayFabRequestCommon
@@ -286,23 +180,9 @@ namespace PlayFab
 
             ~FinalizeFileUploadsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilS(input["FileNames"], FileNames);
-                FromJsonUtilP(input["ProfileVersion"], ProfileVersion);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_FileNames; ToJsonUtilS(FileNames, each_FileNames); output["FileNames"] = each_FileNames;
-                Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); output["ProfileVersion"] = each_ProfileVersion;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetFileMetadata : public PlayFabBaseModel
@@ -333,25 +213,9 @@ namespace PlayFab
 
             ~GetFileMetadata() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Checksum"], Checksum);
-                FromJsonUtilS(input["DownloadUrl"], DownloadUrl);
-                FromJsonUtilS(input["FileName"], FileName);
-                FromJsonUtilT(input["LastModified"], LastModified);
-                FromJsonUtilP(input["Size"], Size);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Checksum; ToJsonUtilS(Checksum, each_Checksum); output["Checksum"] = each_Checksum;
-                Json::Value each_DownloadUrl; ToJsonUtilS(DownloadUrl, each_DownloadUrl); output["DownloadUrl"] = each_DownloadUrl;
-                Json::Value each_FileName; ToJsonUtilS(FileName, each_FileName); output["FileName"] = each_FileName;
-                Json::Value each_LastModified; ToJsonUtilT(LastModified, each_LastModified); output["LastModified"] = each_LastModified;
-                Json::Value each_Size; ToJsonUtilP(Size, each_Size); output["Size"] = each_Size;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct FinalizeFileUploadsResponse : public PlayFabResultCommon
@@ -376,21 +240,9 @@ namespace PlayFab
 
             ~FinalizeFileUploadsResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilO(input["Metadata"], Metadata);
-                FromJsonUtilP(input["ProfileVersion"], ProfileVersion);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_Metadata; ToJsonUtilO(Metadata, each_Metadata); output["Metadata"] = each_Metadata;
-                Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); output["ProfileVersion"] = each_ProfileVersion;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetFilesRequest : public PlayFabRequestCommon
@@ -412,19 +264,9 @@ namespace PlayFab
 
             ~GetFilesRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Entity"], Entity);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetFilesResponse : public PlayFabResultCommon
@@ -449,21 +291,9 @@ namespace PlayFab
 
             ~GetFilesResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilO(input["Metadata"], Metadata);
-                FromJsonUtilP(input["ProfileVersion"], ProfileVersion);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_Metadata; ToJsonUtilO(Metadata, each_Metadata); output["Metadata"] = each_Metadata;
-                Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); output["ProfileVersion"] = each_ProfileVersion;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetObjectsRequest : public PlayFabRequestCommon
@@ -488,21 +318,9 @@ namespace PlayFab
 
             ~GetObjectsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilP(input["EscapeObject"], EscapeObject);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_EscapeObject; ToJsonUtilP(EscapeObject, each_EscapeObject); output["EscapeObject"] = each_EscapeObject;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct ObjectResult : public PlayFabResultCommon
@@ -527,21 +345,9 @@ namespace PlayFab
 
             ~ObjectResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                DataObject = input["DataObject"];
-                FromJsonUtilS(input["EscapedDataObject"], EscapedDataObject);
-                FromJsonUtilS(input["ObjectName"], ObjectName);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                output["DataObject"] = DataObject;
-                Json::Value each_EscapedDataObject; ToJsonUtilS(EscapedDataObject, each_EscapedDataObject); output["EscapedDataObject"] = each_EscapedDataObject;
-                Json::Value each_ObjectName; ToJsonUtilS(ObjectName, each_ObjectName); output["ObjectName"] = each_ObjectName;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetObjectsResponse : public PlayFabResultCommon
@@ -566,21 +372,9 @@ namespace PlayFab
 
             ~GetObjectsResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilO(input["Objects"], Objects);
-                FromJsonUtilP(input["ProfileVersion"], ProfileVersion);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_Objects; ToJsonUtilO(Objects, each_Objects); output["Objects"] = each_Objects;
-                Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); output["ProfileVersion"] = each_ProfileVersion;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct InitiateFileUploadMetadata : public PlayFabBaseModel
@@ -602,19 +396,9 @@ namespace PlayFab
 
             ~InitiateFileUploadMetadata() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["FileName"], FileName);
-                FromJsonUtilS(input["UploadUrl"], UploadUrl);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_FileName; ToJsonUtilS(FileName, each_FileName); output["FileName"] = each_FileName;
-                Json::Value each_UploadUrl; ToJsonUtilS(UploadUrl, each_UploadUrl); output["UploadUrl"] = each_UploadUrl;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct InitiateFileUploadsRequest : public PlayFabRequestCommon
@@ -642,23 +426,9 @@ namespace PlayFab
 
             ~InitiateFileUploadsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilS(input["FileNames"], FileNames);
-                FromJsonUtilP(input["ProfileVersion"], ProfileVersion);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_FileNames; ToJsonUtilS(FileNames, each_FileNames); output["FileNames"] = each_FileNames;
-                Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); output["ProfileVersion"] = each_ProfileVersion;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct InitiateFileUploadsResponse : public PlayFabResultCommon
@@ -683,21 +453,9 @@ namespace PlayFab
 
             ~InitiateFileUploadsResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilP(input["ProfileVersion"], ProfileVersion);
-                FromJsonUtilO(input["UploadDetails"], UploadDetails);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); output["ProfileVersion"] = each_ProfileVersion;
-                Json::Value each_UploadDetails; ToJsonUtilO(UploadDetails, each_UploadDetails); output["UploadDetails"] = each_UploadDetails;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct SetObject : public PlayFabBaseModel
@@ -725,23 +483,9 @@ namespace PlayFab
 
             ~SetObject() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                DataObject = input["DataObject"];
-                FromJsonUtilP(input["DeleteObject"], DeleteObject);
-                FromJsonUtilS(input["EscapedDataObject"], EscapedDataObject);
-                FromJsonUtilS(input["ObjectName"], ObjectName);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                output["DataObject"] = DataObject;
-                Json::Value each_DeleteObject; ToJsonUtilP(DeleteObject, each_DeleteObject); output["DeleteObject"] = each_DeleteObject;
-                Json::Value each_EscapedDataObject; ToJsonUtilS(EscapedDataObject, each_EscapedDataObject); output["EscapedDataObject"] = each_EscapedDataObject;
-                Json::Value each_ObjectName; ToJsonUtilS(ObjectName, each_ObjectName); output["ObjectName"] = each_ObjectName;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct SetObjectInfo : public PlayFabBaseModel
@@ -766,21 +510,9 @@ namespace PlayFab
 
             ~SetObjectInfo() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["ObjectName"], ObjectName);
-                FromJsonUtilS(input["OperationReason"], OperationReason);
-                FromJsonUtilE(input["SetResult"], SetResult);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ObjectName; ToJsonUtilS(ObjectName, each_ObjectName); output["ObjectName"] = each_ObjectName;
-                Json::Value each_OperationReason; ToJsonUtilS(OperationReason, each_OperationReason); output["OperationReason"] = each_OperationReason;
-                Json::Value each_SetResult; ToJsonUtilE(SetResult, each_SetResult); output["SetResult"] = each_SetResult;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct SetObjectsRequest : public PlayFabRequestCommon
@@ -808,23 +540,9 @@ namespace PlayFab
 
             ~SetObjectsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilP(input["ExpectedProfileVersion"], ExpectedProfileVersion);
-                FromJsonUtilO(input["Objects"], Objects);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_ExpectedProfileVersion; ToJsonUtilP(ExpectedProfileVersion, each_ExpectedProfileVersion); output["ExpectedProfileVersion"] = each_ExpectedProfileVersion;
-                Json::Value each_Objects; ToJsonUtilO(Objects, each_Objects); output["Objects"] = each_Objects;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct SetObjectsResponse : public PlayFabResultCommon
@@ -846,19 +564,9 @@ namespace PlayFab
 
             ~SetObjectsResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["ProfileVersion"], ProfileVersion);
-                FromJsonUtilO(input["SetResults"], SetResults);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); output["ProfileVersion"] = each_ProfileVersion;
-                Json::Value each_SetResults; ToJsonUtilO(SetResults, each_SetResults); output["SetResults"] = each_SetResults;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
     }
@@ -0,0 +1,35 @@
+#pragma once
+
+#if !defined(DISABLE_PLAYFABENTITY_API)
+
+namespace PlayFab
+{
+    namespace DataModels
+    {
+        // Forward declarations of the Data models, for headers which only pass them by reference
+        enum class OperationTypes;
+
+        struct EntityKey;
+        struct AbortFileUploadsRequest;
+        struct AbortFileUploadsResponse;
+        struct DeleteFilesRequest;
+        struct DeleteFilesResponse;
+        struct FinalizeFileUploadsRequest;
+        struct GetFileMetadata;
+        struct FinalizeFileUploadsResponse;
+        struct GetFilesRequest;
+        struct GetFilesResponse;
+        struct GetObjectsRequest;
+        struct ObjectResult;
+        struct GetObjectsResponse;
+        struct InitiateFileUploadMetadata;
+        struct InitiateFileUploadsRequest;
+        struct InitiateFileUploadsResponse;
+        struct SetObject;
+        struct SetObjectInfo;
+        struct SetObjectsRequest;
+        struct SetObjectsResponse;
+    }
+}
+
+#endif
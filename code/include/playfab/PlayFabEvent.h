@@ -28,7 +28,8 @@ namespace PlayFab
         Success, // An event was successfully emitted
         Overflow, // An event wasn't emitted because the emitter capacity is full
         Disabled, // An event wasn't emitted because the emitter is disabled (its functionality is "turned off")
-        NotSupported // An event wasn't emitted because the emitter doesn't support the operation
+        NotSupported, // An event wasn't emitted because the emitter doesn't support the operation
+        Failed // An event was emitted but not delivered, as its batch got an error which is not transient or ran out of retries (see the error of the response)
     };
 
     /// <summary>
@@ -62,6 +63,8 @@ namespace PlayFab
         void SetProperty(const std::string& name, const uint32_t value); // Sets a value of a uint32_t property by name
         void SetProperty(const std::string& name, const uint64_t value); // Sets a value of a uint64_t property by name
         void SetProperty(const std::string& name, const double value); // Sets a value of a double property by name
+        size_t GetEstimatedSize() const; // Gets the estimated size of the event in a WriteEvents request, in bytes
+        std::string Serialize() const; // Gets the event as compact JSON, as it is written in a WriteEvents request
 
     public:
         PlayFabEventType eventType;
@@ -69,6 +72,7 @@ namespace PlayFab
         EventsModels::EventContents eventContents;
 
         friend class PlayFabEventPipeline; // to access eventContents directly from PF pipeline for perf optimization
+        friend class PlayFabMetricAggregator; // to write metric summaries, which are nested, into the payload
     };
 
     /// <summary>
@@ -102,20 +106,28 @@ namespace PlayFab
         std::shared_ptr<const PlayFabEvent> event; // a pointer to the user's event object itself
         PlayFabEmitEventCallback callback; // user's callback function to return the final result of emit event operation after event is completely sent out or any error occurred
         std::function<void(std::shared_ptr<const IPlayFabEvent>, std::shared_ptr<const IPlayFabEmitEventResponse>)> stdCallback; // same as EventCallback but can be used with member variables if needed.
+        size_t estimatedSize = 0; // the estimated size of the event in a WriteEvents request, in bytes, computed when the event is emitted (0 if it was not)
+        std::string serializedEvent; // the event as compact JSON (see PlayFabEvent::Serialize), encoded when the event is emitted (empty if it was not). The pipeline splices it into the batch as is.
     };
 
     /// <summary>
-    /// PlayFab-specific implementation of an emit event response
+    /// PlayFab-specific implementation of an emit event response.
+    /// All events of a batch share the response to the batch.
     /// </summary>
     class PlayFabEmitEventResponse : public IPlayFabEmitEventResponse
     {
     public:
-        EmitEventResult emitEventResult; // result of immediate "emit event" operation
+        EmitEventResult emitEventResult; // result of "emit event" operation: whether the event was taken by the emitter, and whether it was delivered
         std::shared_ptr<const PlayFabError> playFabError; // error information and/or operation result
         std::shared_ptr<const EventsModels::WriteEventsResponse> writeEventsResponse; // additional data with the outcome of the operation
         std::shared_ptr<const std::vector<std::shared_ptr<const IPlayFabEmitEventRequest>>> batch; // the batch this event was part of
         size_t batchNumber; // the incremental batch number
+        size_t retryCount = 0; // the number of times the batch was retried before this outcome
     };
+
+    // A callback that can be used to receive the outcome of a whole batch of events at once, as the response all of its events share.
+    // It is called before the emit event callbacks of the events, if any. The callback procedure must be thread-safe.
+    using PlayFabEmitBatchCallback = std::function<void(const std::vector<std::shared_ptr<const IPlayFabEmitEventRequest>>&, std::shared_ptr<const PlayFabEmitEventResponse>)>;
 }
 
 #endif
@@ -14,7 +14,12 @@ namespace PlayFab
     class PlayFabEventAPI
     {
     public:
-        PlayFabEventAPI(bool threadedEventPipeline=true);
+        /// <summary>
+        /// - threadedEventPipeline is whether the event pipelines use a background thread (otherwise Update must be called every game tick).
+        /// - preSerializeEvents is whether each event is encoded to JSON by EmitEvent, on the emitting thread, rather than by the pipeline thread.
+        ///   It takes load off the pipeline thread when events are emitted from several threads at a high rate.
+        /// </summary>
+        PlayFabEventAPI(bool threadedEventPipeline=true, bool preSerializeEvents=false);
 
         std::shared_ptr<IPlayFabEventRouter> GetEventRouter() const;
 
@@ -34,7 +39,10 @@ namespace PlayFab
         void Update();
 
     private:
+        void EncodeEvent(PlayFabEmitEventRequest& eventRequest) const;
+
         std::shared_ptr<IPlayFabEventRouter> eventRouter;
+        bool preSerializeEvents;
     };
 }
 
@@ -0,0 +1,72 @@
+#pragma once
+
+#ifndef DISABLE_PLAYFABENTITY_API
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+namespace PlayFab
+{
+    class PlayFabEventPipelineSettings;
+
+    /// <summary>
+    /// A snapshot of the state of an event pipeline and of the batching decisions it currently makes
+    /// </summary>
+    struct PlayFabEventPipelineStats
+    {
+        size_t batchItemLimit = 0; // The number of events at which a batch is currently sent out
+        std::chrono::milliseconds batchWaitTime = std::chrono::milliseconds(0); // The time after which an incomplete batch is currently sent out
+        std::chrono::milliseconds sendLatency = std::chrono::milliseconds(0); // The smoothed time from sending a batch to getting its response
+        size_t batchesInFlight = 0; // The number of batches in flight when the last batch was started
+        double bufferFillRatio = 0; // The share of the buffer capacity in use when the last batch was started
+        uint64_t batchesSent = 0; // The number of batches sent out
+        uint64_t eventsSent = 0; // The number of events sent out in batches
+        uint64_t eventsOverflowed = 0; // The number of events refused because the buffer was full
+    };
+
+    /// <summary>
+    /// Batching controller of PlayFabEventPipeline. With adaptive batching it tunes the number of events per batch and the batch wait time
+    /// to the load together: when batches in flight, the buffer fill or the send latency show congestion it doubles both (fewer, fuller
+    /// requests), and when the load is light it lowers the number of events per batch step by step and halves the wait time (faster delivery).
+    /// Once events back up in the buffer, batches take the maximal number of events, so that a burst is not sent in many small requests.
+    /// It starts out with the minimal limits (the minimal batch wait time, and a sixteenth of the maximal number of events per batch),
+    /// and stays within the pipeline settings.
+    /// Without adaptive batching it uses the limits of the settings as they are.
+    /// </summary>
+    class PlayFabEventBatchController
+    {
+    public:
+        PlayFabEventBatchController();
+
+        PlayFabEventBatchController(const PlayFabEventBatchController& source) = delete; // disable copy
+        PlayFabEventBatchController& operator=(const PlayFabEventBatchController& source) = delete; // disable assignment
+
+        // Adjusts the limits to the load when a batch is started. This and the getters of the limits are used by the pipeline's worker thread only.
+        void OnBatchStarted(const PlayFabEventPipelineSettings& settings, size_t batchesInFlight, double bufferFillRatio);
+        size_t GetBatchItemLimit(const PlayFabEventPipelineSettings& settings) const;
+        std::chrono::milliseconds GetBatchWaitTime(const PlayFabEventPipelineSettings& settings) const;
+
+        // Record the outcomes which the decisions are based on. These methods are thread-safe.
+        void OnBatchSent(size_t eventCount);
+        void OnBatchCompleted(std::chrono::microseconds latency); // Only for batches sent for the first time, so that retries and the spool backlog don't skew the latency of the current load
+        void OnEventOverflowed();
+
+        PlayFabEventPipelineStats GetStats(const PlayFabEventPipelineSettings& settings) const;
+
+    private:
+        // Decisions (touched by the worker thread only)
+        bool isStarted;
+        size_t batchItemLimit;
+        std::chrono::milliseconds batchWaitTime;
+
+        mutable std::mutex statsMutex;
+        PlayFabEventPipelineStats stats; // Guarded by statsMutex. The limits in it are the decisions as of the last batch started.
+        std::chrono::microseconds smoothedLatency; // The smoothed send latency, in microseconds so that small differences are not truncated away. Guarded by statsMutex.
+        std::chrono::microseconds minimalLatency; // The lowest send latency seen, as the baseline for the smoothed one. Guarded by statsMutex.
+        bool hasLatency; // Guarded by statsMutex
+        std::atomic<uint64_t> eventsOverflowed;
+    };
+}
+
+#endif
@@ -1,14 +1,19 @@
 #pragma once
 
-#include <playfab/PlayFabSpinLock.h>
 #include <playfab/PlayFabEvent.h>
 
+#include <atomic>
+#include <mutex>
+#include <vector>
+
 namespace PlayFab
 {
-#pragma pack(push)
-#pragma pack(8) // conservative memory alignment control to provide maximum platform compatibility
+    // The size of a slot of PlayFabEventBuffer, which is a common cache line size so that producers writing
+    // neighbouring slots do not contend for the same cache line
+    constexpr size_t PlayFabEventBufferCacheLineSize = 64;
+
     /// <summary>
-    /// A "packet" (wrapper) for an event request. The packets are internal custom allocations inside the buffer.
+    /// A "packet" (wrapper) for an event request. The packets are internal custom allocations inside the buffer, one per slot.
     /// Their purpose is to reduce heap churn as additional data about event (e.g. some event metadata) needs to be stored
     /// so that a wrapper object is not created on the heap for each event.
     /// The implementation is based on the implementation of FullEvent struct in Microsoft Gaming Cloud CELL library.
@@ -16,26 +21,35 @@ namespace PlayFab
     class PlayFabEventPacket final
     {
     public:
-        PlayFabEventPacket(const uint64_t index, const std::shared_ptr<const IPlayFabEmitEventRequest>& request) :
-            next(nullptr),
-            eventIndex(index),
-            timestamp(std::time(nullptr)), // current time
-            eventRequest(std::move(request))
+        explicit PlayFabEventPacket(const uint64_t initialSequence) :
+            sequence(initialSequence),
+            eventIndex(0),
+            timestamp(0)
         {
         }
         ~PlayFabEventPacket() {};
 
-        std::atomic<PlayFabEventPacket*> next; // a pointer to the next event packet in buffer
+        std::atomic<uint64_t> sequence; // The state of the slot holding this packet. It is equal to the position of the next producer
+                                        // that may write the slot, position + 1 once that producer has published the event in it,
+                                        // and position + capacity once the consumer has taken the event.
         uint64_t eventIndex; // the incremental index of an event
         std::time_t timestamp; // the timestamp of event packet creation
 
         std::shared_ptr<const IPlayFabEmitEventRequest> eventRequest; // the event request
     };
-#pragma pack(pop)
+
+    class PlayFabEventStagingRing;
 
     /// <summary>
-    /// Default PlayFab event buffer (a spinlock-enforced MPSC queue based on a circular buffer).
-    /// The implementation is based on the implementation of CircularBuffer in Microsoft Gaming Cloud CELL library.
+    /// Default PlayFab event buffer (a lock-free MPSC queue based on a circular buffer of fixed-size slots).
+    /// Producers reserve a slot by advancing the tail with a compare-exchange and publish the event through the sequence of
+    /// that slot, so they never wait for each other. The single consumer takes events in the order their slots were reserved.
+    /// The design follows the bounded queue of Dmitry Vyukov.
+    ///
+    /// With producer staging, each producer thread instead gets its own single-producer ring in the buffer, which the
+    /// consumer harvests round-robin. A producer then only writes cache lines of its own ring, except to draw a chunk of
+    /// capacity from the budget of the whole buffer every few events, which is how the buffer stays bounded.
+    /// The events of each producer are still taken in the order they were put.
     /// </summary>
     class PlayFabEventBuffer final
     {
@@ -58,7 +72,7 @@ namespace PlayFab
             Disabled // An event wasn't taken from buffer because the buffer is disabled (buffering functionality is "turned off")
         };
 
-        explicit PlayFabEventBuffer(const size_t bufferSize);
+        explicit PlayFabEventBuffer(const size_t bufferSize, const bool useProducerStaging = false);
         ~PlayFabEventBuffer();
 
         PlayFabEventBuffer(const PlayFabEventBuffer& source) = delete; // disable copy
@@ -69,38 +83,58 @@ namespace PlayFab
         // Attempts to put an event in buffer (add to the tail). This method must be thread-safe.
         EventProducingResult TryPut(std::shared_ptr<const IPlayFabEmitEventRequest> request);
 
-        // Attempts to take an event from buffer (update the head).
+        // Attempts to take an event from buffer (update the head). This method must only be called by one thread at a time.
         EventConsumingResult TryTake(std::shared_ptr<const IPlayFabEmitEventRequest>& request);
 
+        // Returns whether there is no event to take (an event still being put does not count yet). Like TryTake, this must only be called by the consumer.
+        bool IsEmpty() const;
+
+        // Returns the number of events in buffer, including those still being put. Like TryTake, this must only be called by the consumer.
+        size_t GetEventCount() const;
+
+        // Returns the number of events the buffer can hold
+        size_t GetCapacity() const;
+
     private:
-        // Creates (allocates and calls constructor) an event packet object in the buffer
-        PlayFabEventPacket* CreateEventPacket(uint8_t* location, const uint64_t index, std::shared_ptr<const IPlayFabEmitEventRequest> request);
+        // Returns the event packet in the slot for a position of the head or tail
+        PlayFabEventPacket* GetEventPacket(const uint64_t position) const;
 
-        // Deletes (calls destructor) an event packet object from the buffer
-        void DeleteEventPacket(PlayFabEventPacket* eventPacket);
+        EventProducingResult TryPutStaged(std::shared_ptr<const IPlayFabEmitEventRequest>&& request);
+        EventConsumingResult TryTakeStaged(std::shared_ptr<const IPlayFabEmitEventRequest>& request);
+
+        // Returns the staging ring of the calling thread, attaching a free or new one on the first call from the thread
+        PlayFabEventStagingRing* GetStagingRing();
 
-        AtomicSpin atomicSpin; // Used for spinlock in critical sections
         std::atomic<bool> disabled; // A state flag indicating whether the buffer is disabled/enabled
+        const bool useProducerStaging;
 
-        const size_t buffMask; // A bit mask that is used for very fast buffer pointer arithmetics.
-                               // The buffer's length is always a power of two and the buffer mask is (length - 1).
-                               // For example if buffer length is 0x100 (256) then buffer mask is 0xFF (255)
-                               // (or 100000000 and 011111111 in binary form). Performing binary "&" operations
-                               // with a mask like that allows for efficient pointer adjustments in a circular buffer.
+        const size_t buffMask; // A bit mask that is used for very fast slot position arithmetics.
+                               // The number of slots is always a power of two and the buffer mask is (number - 1).
+                               // For example if there are 0x40 (64) slots then buffer mask is 0x3F (63)
+                               // (or 1000000 and 0111111 in binary form). Performing binary "&" operations
+                               // with a mask like that maps an ever growing position to its slot in a circular buffer.
 
         std::unique_ptr<uint8_t[]> bufferArray;
-        const uint64_t buffStart; // A pointer to the beginning of buffer (first byte of the buffer).
-        const uint64_t buffEnd; // A pointer to the byte immediately after the last byte of buffer, i.e. (buffEnd - buffStart) gives the length of the buffer.
+        uint8_t* const buffStart; // A pointer to the first slot (aligned to a cache line, bufferArray is allocated with room for that)
+
+        // The head and the tail are written by different threads, so each is kept on its own cache line
 
-        std::atomic<PlayFabEventPacket*> head; // A pointer to the last consumed event packet. The last consumed event packet must always exist (not destroyed yet) by design,
-                                               // as it may be the same event packet pointed to by tail (e.g. when there are no events currently in the buffer).
-                                               // Events are consumed from the head (head is moving towards tail as events are consumed).
+        uint64_t head; // The position of the next event to consume. Only the consumer touches it.
+        uint8_t headPadding[PlayFabEventBufferCacheLineSize];
 
-        // Variables below are touched only behind the lock:
+        std::atomic<uint64_t> tail; // The position of the next slot to reserve for a produced event. It is also the index of that event.
+        uint8_t tailPadding[PlayFabEventBufferCacheLineSize];
 
-        PlayFabEventPacket* tail; // A pointer to the last event packet added to the buffer.
-                                  // Newly added events are added to the tail (tail is growing as new events are added).
+        // Variables below are used only with producer staging:
 
-        std::shared_ptr<std::atomic<uint64_t>> eventIndex; // The counter of produced events
+        const uint64_t stagingId; // Identifies the buffer in the per-thread staging ring caches, which outlive it
+        const int64_t stagingChunk; // The capacity a producer draws from (and the consumer returns to) stagingCapacity at once
+        std::shared_ptr<std::atomic<int64_t>> stagingCapacity; // The capacity not drawn by any producer (only allocated with producer staging). Shared with the rings, which return what they hold when their thread exits.
+        std::atomic<PlayFabEventStagingRing*> stagingRings; // The list of all staging rings, newest first. Rings are never removed from it, only reattached.
+        PlayFabEventStagingRing* nextStagingRing; // The ring the consumer harvests next. Only the consumer touches it.
+        size_t takenFromStagingRing; // The number of events the consumer took in a row from nextStagingRing
+        int64_t takenSinceReturn; // The capacity freed by the consumer and not yet returned to stagingCapacity
+        std::mutex stagingRingsMutex; // Serializes attaching rings to threads
+        std::vector<std::shared_ptr<PlayFabEventStagingRing>> ownedStagingRings; // Guarded by stagingRingsMutex
     };
 }
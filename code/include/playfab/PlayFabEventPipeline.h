@@ -6,15 +6,20 @@
 #define LOG_PIPELINE(S) /*std::cout << S*/
 
 #include <playfab/PlayFabEvent.h>
+#include <playfab/PlayFabEventBatchController.h>
 #include <playfab/PlayFabEventBuffer.h>
+#include <playfab/PlayFabEventSpool.h>
 
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
 #include <mutex>
+#include <random>
 #include <unordered_map>
 
 namespace PlayFab
 {
-    class PlayFabEventsInstanceAPI;
-
     enum class PlayFabEventPipelineType
     {
         PlayFabPlayStream,
@@ -35,15 +40,37 @@ namespace PlayFab
         PlayFabEventPipelineSettings(PlayFabEventPipelineType emitType, bool useBackgroundThread);
         virtual ~PlayFabEventPipelineSettings() {};
 
-        size_t bufferSize; // The minimal size of buffer, in bytes. The actually allocated size will be a power of 2 that is equal or greater than this value.
-        size_t maximalNumberOfItemsInBatch; // The maximal number of items (events) a batch can hold before it is sent out.
+        std::chrono::milliseconds GetMaximalBatchWaitTime() const; // maximalBatchWaitTimeMs if it is set, otherwise maximalBatchWaitTime
+
+        size_t bufferSize; // The minimal size of buffer, in bytes. The actually allocated size will be a power of 2 that is equal or greater than this value. The buffer holds at least as many events as that many bytes of event packets.
+        size_t maximalBatchSizeInBytes; // The maximal estimated size of the events in a batch, in bytes. A batch is sent out when it reaches this size, or before the event that would exceed it.
+        size_t maximalNumberOfItemsInBatch; // The maximal number of items (events) a batch can hold before it is sent out, even if it is below maximalBatchSizeInBytes.
         size_t maximalBatchWaitTime; // The maximal wait time before a batch must be sent out even if it's still incomplete, in seconds.
-        size_t maximalNumberOfRetries; // The maximal number of retries for transient transport errors, before a batch is discarded.
-        size_t maximalNumberOfBatchesInFlight; // The maximal number of batches currently "in flight" (sent to a transport plugin).
-        int64_t readBufferWaitTime; // The wait time between attempts to read events from buffer when it is empty, in milliseconds.
+        std::chrono::milliseconds maximalBatchWaitTimeMs; // The maximal batch wait time in milliseconds, for wait times that aren't whole seconds. Takes precedence over maximalBatchWaitTime unless it is 0 (the default).
+        std::chrono::milliseconds minimalBatchWaitTime; // The lowest batch wait time adaptive batching may lower the maximal batch wait time to.
+        size_t maximalNumberOfRetries; // The maximal number of retries of a batch which got a transient error (no response, throttling, or the service being unavailable),
+                                       // before its events are reported as failed. Other errors are not retried.
+        std::chrono::milliseconds retryWaitTime; // The wait time before the first retry of a batch. It doubles with each further retry, with random jitter.
+        size_t maximalNumberOfBatchesInFlight; // The maximal number of batches currently "in flight" (sent to a transport plugin). Retries and batches read back from
+                                               // the spool don't count against it, they have half as many batches in flight of their own.
+        int64_t readBufferWaitTime; // The wait time between checks for an entity token, which is needed before any event is taken from buffer, in milliseconds.
         std::shared_ptr<PlayFabAuthenticationContext> authenticationContext; // The optional PlayFab authentication context that can be used with static PlayFab events API
         PlayFabEventPipelineType emitType; // whether we call WriteEvent or WriteTelemetryEvent through PlayFab
         bool useBackgroundThread;
+        bool useProducerStaging; // Whether each thread emitting events puts them in its own ring of the buffer, so that emitting threads don't contend with each other.
+                                 // Each such ring takes 16 bytes per event the buffer can hold. The order of events is kept per emitting thread.
+        bool useAdaptiveBatching; // Whether the batch wait time and the number of items per batch are tuned to the load, between minimalBatchWaitTime and the maximal batch wait time,
+                                  // and between a sixteenth of maximalNumberOfItemsInBatch and maximalNumberOfItemsInBatch.
+                                  // See PlayFabEventBatchController and PlayFabEventPipeline::GetStats.
+        std::string spoolDirectory; // The directory of the durable event spool (see PlayFabEventSpool), or empty (the default) to keep events in memory only.
+                                    // Events are spooled as they are batched, until delivered. Events of earlier runs, and of batches which ran out of retries, are sent
+                                    // from the spool without emit event callbacks (on restart, and on reconnect, i.e. after a batch succeeds), so an event reported
+                                    // as failed may still be delivered, and an event may be delivered more than once.
+        size_t spoolSegmentSize; // The size of each spool segment file, in bytes
+        size_t maximalSpoolSizeInBytes; // The disk quota of the spool, in bytes. Events which would exceed it are still sent, but not spooled.
+        PlayFabEventSpoolSyncPolicy spoolSyncPolicy; // When spooled events are flushed to storage
+        PlayFabEmitBatchCallback emitBatchCallback; // The optional callback of each batch which was delivered or failed. Titles emitting many events can use it
+                                                    // in place of emit event callbacks, as it is called once per batch.
     };
 
     /// <summary>
@@ -85,15 +112,58 @@ namespace PlayFab
 
         void SetExceptionCallback(ExceptionCallback callback);
 
+        // Gets the current batching decisions and counters of the pipeline. This method is thread-safe.
+        PlayFabEventPipelineStats GetStats() const;
+
     protected:
         virtual void SendBatch(std::vector<std::shared_ptr<const IPlayFabEmitEventRequest>>& batch);
 
     private:
+        // What is tracked of a batch in flight besides its events
+        struct BatchInFlight
+        {
+            std::chrono::steady_clock::time_point sendTime;
+            PlayFabEventSpoolRange spoolRange; // The spooled events of the batch
+            size_t retryCount = 0; // The number of times the batch was retried
+            bool isFromSpool = false; // Whether the batch was read back from the spool backlog
+
+            bool IsResent() const { return retryCount > 0 || isFromSpool; }
+        };
+
+        // A batch waiting for its retry
+        struct RetryBatch
+        {
+            std::vector<std::shared_ptr<const IPlayFabEmitEventRequest>> events;
+            PlayFabEventSpoolRange spoolRange;
+            size_t retryCount = 0; // The number of times the batch was retried so far
+            std::shared_ptr<const PlayFabError> error; // The error of the last try
+        };
+
+        // What the worker thread waits for when there is no more work to process
+        enum class WorkerThreadWait
+        {
+            Events, // An event being put in buffer, or the deadline of the incomplete batch
+            BatchOutOfFlight, // A batch in flight getting its response, when batches in flight are at the maximal number
+            EntityToken // An entity token, which is checked every readBufferWaitTime
+        };
+
         void WorkerThread();
+        void WakeUpWorkerThread();
         bool DoWork();
+        bool IsBatchFull() const;
+        void SpoolEvent(const PlayFabEmitEventRequest& request);
+        bool SendRetryBatch();
+        bool SendSpoolBatch();
+        bool GetResendTime(std::chrono::steady_clock::time_point& resendTime);
+        size_t GetResentBatchLimit() const;
+        void SpliceBatchBody(const std::vector<std::shared_ptr<const IPlayFabEmitEventRequest>>& localbatch);
+        void WriteBatch(void* customData);
         void WriteEventsApiCallback(const EventsModels::WriteEventsResponse& result, void* customData);
         void WriteEventsApiErrorCallback(const PlayFabError& error, void* customData);
-        void CallbackRequest(std::shared_ptr<const IPlayFabEmitEventRequest> request, std::shared_ptr<const IPlayFabEmitEventResponse> response);
+        void CallbackFailedBatch(std::vector<std::shared_ptr<const IPlayFabEmitEventRequest>>&& failedBatch, const std::shared_ptr<const PlayFabError>& error,
+            size_t retryCount, void* customData);
+        void CallbackBatch(std::vector<std::shared_ptr<const IPlayFabEmitEventRequest>>&& completedBatch, const std::shared_ptr<PlayFabEmitEventResponse>& response);
+        void CallbackRequest(const IPlayFabEmitEventRequest& request, const std::shared_ptr<const IPlayFabEmitEventResponse>& response);
 
     protected:
         // PlayFab's public Events API (e.g. WriteEvents method) allows to pass only a pointer to some custom object (void* customData) that will be relayed back to its callbacks.
@@ -105,19 +175,33 @@ namespace PlayFab
         std::unordered_map<void*, std::vector<std::shared_ptr<const IPlayFabEmitEventRequest>>> batchesInFlight;
 
     private:
-        std::shared_ptr<PlayFabEventsInstanceAPI> eventsApi;
-
         std::atomic_uintptr_t batchCounter;
         std::vector<std::shared_ptr<const IPlayFabEmitEventRequest>> batch;
         std::chrono::steady_clock::time_point momentBatchStarted;
+        size_t batchSizeInBytes; // The estimated size of the events in batch
+        std::string batchBody; // The WriteEvents request body of the batch being sent, spliced together from serialized events. Its capacity is reused by every batch.
+        PlayFabEventBatchController batchController;
+        std::unordered_map<void*, BatchInFlight> batchesInFlightDetails; // Guarded by inFlightMutex
+        size_t resentBatchesInFlight; // The number of retries and batches read back from the spool in flight. Guarded by inFlightMutex.
+        std::multimap<std::chrono::steady_clock::time_point, RetryBatch> retryQueue; // Failed batches by the moment of their retry. Guarded by inFlightMutex.
+        std::minstd_rand retryJitter; // Guarded by inFlightMutex
+        std::unique_ptr<PlayFabEventSpool> spool; // Null unless spoolDirectory is set and the spool could be opened
+        PlayFabEventSpoolRange batchSpoolRange; // The spooled events of batch
+        std::deque<PlayFabEventSpoolRange> spoolBacklog; // Spooled events to send from the spool: left by earlier runs, or of failed batches. Guarded by inFlightMutex.
+        std::chrono::steady_clock::time_point spoolDrainResumeTime; // The backlog is not sent before this moment, which a transient error pushes back. Guarded by inFlightMutex.
         std::shared_ptr<PlayFabEventPipelineSettings> settings;
         PlayFabEventBuffer buffer;
         std::thread workerThread;
         std::atomic<bool> isWorkerThreadRunning;
+        WorkerThreadWait workerThreadWait; // Set by DoWork when it returns false
+        std::mutex workerThreadMutex;
+        std::condition_variable workerThreadWakeup;
+        bool isWorkerThreadWakeUpRequested; // Guarded by workerThreadMutex
+        std::atomic<bool> isWorkerThreadWaitingForEvents; // Whether IntakeEvent needs to wake the worker thread up
         std::mutex userExceptionCallbackMutex;
         ExceptionCallback userExceptionCallback;
 
-        bool TryGetBatchOutOfFlight(void* customData, std::vector<std::shared_ptr<const IPlayFabEmitEventRequest>>* batchReturn);
+        bool TryGetBatchOutOfFlight(void* customData, std::vector<std::shared_ptr<const IPlayFabEmitEventRequest>>* batchReturn, BatchInFlight* detailsReturn);
     };
 }
 
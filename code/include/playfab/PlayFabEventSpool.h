@@ -0,0 +1,93 @@
+#pragma once
+
+#ifndef DISABLE_PLAYFABENTITY_API
+
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace PlayFab
+{
+    /// <summary>
+    /// When a PlayFabEventSpool flushes the spooled events from memory to storage
+    /// </summary>
+    enum class PlayFabEventSpoolSyncPolicy
+    {
+        None, // Never flush explicitly. Spooled events survive a crash of the process, as the mapped pages belong to the OS, but not a crash of the OS or device.
+        SegmentFull, // Flush a segment file once it is full
+        EveryBatch // Flush the events of each batch before the batch is sent
+    };
+
+    /// <summary>
+    /// A run of consecutive records of a PlayFabEventSpool, by position
+    /// </summary>
+    struct PlayFabEventSpoolRange
+    {
+        uint64_t first = 0; // The position of the first record
+        uint64_t count = 0; // The number of records
+    };
+
+    /// <summary>
+    /// Durable spool of serialized events, made of append-only segment files which are memory-mapped.
+    /// Records get consecutive positions that carry on across runs, and each one is stored with its length and CRC-32,
+    /// so that a record torn by a crash is detected and dropped when the spool is recovered by the next run.
+    /// A segment file is deleted once all of its records are released. The released prefix is kept in the segment headers,
+    /// so a later run recovers only the records which were not released (or were released out of order past that prefix).
+    /// The size of all segment files is limited by a quota: appending fails when a new segment would exceed it.
+    /// This class is thread-safe.
+    /// </summary>
+    class PlayFabEventSpool
+    {
+    public:
+        PlayFabEventSpool(const std::string& directory, size_t segmentSize, size_t maximalSize, PlayFabEventSpoolSyncPolicy syncPolicy);
+        ~PlayFabEventSpool();
+
+        PlayFabEventSpool(const PlayFabEventSpool& source) = delete; // disable copy
+        PlayFabEventSpool& operator=(const PlayFabEventSpool& source) = delete; // disable assignment
+
+        // Opens the spool directory, creating it if needed, and returns the records earlier runs did not release as backlog.
+        // Returns false if the spool can't be used on this platform or in this directory.
+        bool Open(PlayFabEventSpoolRange& backlog);
+
+        // Appends a record and returns its position. Fails if the record can't fit in a segment, or if a new segment would exceed the quota.
+        bool Append(const std::string& record, uint64_t& position);
+
+        // Reads the record at a position. Fails if the record is released, or was lost (e.g. torn by a crash).
+        bool Read(uint64_t position, std::string& record) const;
+
+        // Releases records which were delivered, or given up on
+        void Release(const PlayFabEventSpoolRange& range);
+
+        // Flushes the records appended since the last flush to storage
+        void Sync();
+
+        uint64_t GetSizeInBytes() const; // The size of all segment files
+
+    private:
+        struct Segment;
+
+        bool StartSegment();
+        void SealSegment(Segment& segment);
+        void DeleteReleasedSegments();
+        void WriteReleasedPosition();
+        const Segment* FindSegment(uint64_t position) const;
+
+        const std::string directory;
+        const size_t segmentSize;
+        const uint64_t maximalSize;
+        const PlayFabEventSpoolSyncPolicy syncPolicy;
+
+        mutable std::mutex spoolMutex;
+        bool isOpen;
+        std::deque<std::unique_ptr<Segment>> segments; // Ordered by position. Only the last one can be appended to.
+        uint64_t appendPosition; // The position of the next record
+        uint64_t releasedPosition; // All records before this position are released
+        std::map<uint64_t, uint64_t> releasedRanges; // Records released past releasedPosition, as their first position mapped to their end position
+        uint64_t sizeInBytes;
+    };
+}
+
+#endif
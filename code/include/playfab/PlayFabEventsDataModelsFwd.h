@@ -0,0 +1,17 @@
+#pragma once
+
+#if !defined(DISABLE_PLAYFABENTITY_API)
+
+namespace PlayFab
+{
+    namespace EventsModels
+    {
+        // Forward declarations of the Events models, for headers which only pass them by reference
+        struct EntityKey;
+        struct EventContents;
+        struct WriteEventsRequest;
+        struct WriteEventsResponse;
+    }
+}
+
+#endif
@@ -2,7 +2,12 @@
 
 #if !defined(DISABLE_PLAYFABENTITY_API)
 
+// Opt-in: only forward-declare the models, for files which include the API header but never construct a model
+#if defined(PLAYFAB_API_HEADERS_FWD_MODELS_ONLY)
+#include <playfab/PlayFabEventsDataModelsFwd.h>
+#else
 #include <playfab/PlayFabEventsDataModels.h>
+#endif
 #include <playfab/PlayFabError.h>
 
 namespace PlayFab
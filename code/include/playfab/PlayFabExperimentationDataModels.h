@@ -2,6 +2,7 @@
 
 #if !defined(DISABLE_PLAYFABENTITY_API)
 
+#include <playfab/PlayFabExperimentationDataModelsFwd.h>
 #include <playfab/PlayFabBaseModel.h>
 #include <playfab/PlayFabJsonHeaders.h>
 
@@ -21,87 +22,8 @@ namespace PlayFab
             AnalysisTaskStateCanceled
         };
 
-        inline void ToJsonEnum(const AnalysisTaskState input, Json::Value& output)
-        {
-            if (input == AnalysisTaskState::AnalysisTaskStateWaiting)
-            {
-                output = Json::Value("Waiting");
-                return;
-            }
-            if (input == AnalysisTaskState::AnalysisTaskStateReadyForSubmission)
-            {
-                output = Json::Value("ReadyForSubmission");
-                return;
-            }
-            if (input == AnalysisTaskState::AnalysisTaskStateSubmittingToPipeline)
-            {
-                output = Json::Value("SubmittingToPipeline");
-                return;
-            }
-            if (input == AnalysisTaskState::AnalysisTaskStateRunning)
-            {
-                output = Json::Value("Running");
-                return;
-            }
-            if (input == AnalysisTaskState::AnalysisTaskStateCompleted)
-            {
-                output = Json::Value("Completed");
-                return;
-            }
-            if (input == AnalysisTaskState::AnalysisTaskStateFailed)
-            {
-                output = Json::Value("Failed");
-                return;
-            }
-            if (input == AnalysisTaskState::AnalysisTaskStateCanceled)
-            {
-                output = Json::Value("Canceled");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, AnalysisTaskState& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "Waiting")
-            {
-                output = AnalysisTaskState::AnalysisTaskStateWaiting;
-                return;
-            }
-            if (inputStr == "ReadyForSubmission")
-            {
-                output = AnalysisTaskState::AnalysisTaskStateReadyForSubmission;
-                return;
-            }
-            if (inputStr == "SubmittingToPipeline")
-            {
-                output = AnalysisTaskState::AnalysisTaskStateSubmittingToPipeline;
-                return;
-            }
-            if (inputStr == "Running")
-            {
-                output = AnalysisTaskState::AnalysisTaskStateRunning;
-                return;
-            }
-            if (inputStr == "Completed")
-            {
-                output = AnalysisTaskState::AnalysisTaskStateCompleted;
-                return;
-            }
-            if (inputStr == "Failed")
-            {
-                output = AnalysisTaskState::AnalysisTaskStateFailed;
-                return;
-            }
-            if (inputStr == "Canceled")
-            {
-                output = AnalysisTaskState::AnalysisTaskStateCanceled;
-                return;
-            }
-        }
+        void ToJsonEnum(const AnalysisTaskState input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, AnalysisTaskState& output);
 
         enum class ExperimentState
         {
@@ -111,57 +33,8 @@ namespace PlayFab
             ExperimentStateDeleted
         };
 
-        inline void ToJsonEnum(const ExperimentState input, Json::Value& output)
-        {
-            if (input == ExperimentState::ExperimentStateNew)
-            {
-                output = Json::Value("New");
-                return;
-            }
-            if (input == ExperimentState::ExperimentStateStarted)
-            {
-                output = Json::Value("Started");
-                return;
-            }
-            if (input == ExperimentState::ExperimentStateStopped)
-            {
-                output = Json::Value("Stopped");
-                return;
-            }
-            if (input == ExperimentState::ExperimentStateDeleted)
-            {
-                output = Json::Value("Deleted");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, ExperimentState& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "New")
-            {
-                output = ExperimentState::ExperimentStateNew;
-                return;
-            }
-            if (inputStr == "Started")
-            {
-                output = ExperimentState::ExperimentStateStarted;
-                return;
-            }
-            if (inputStr == "Stopped")
-            {
-                output = ExperimentState::ExperimentStateStopped;
-                return;
-            }
-            if (inputStr == "Deleted")
-            {
-                output = ExperimentState::ExperimentStateDeleted;
-                return;
-            }
-        }
+        void ToJsonEnum(const ExperimentState input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, ExperimentState& output);
 
         enum class ExperimentType
         {
@@ -169,37 +42,8 @@ namespace PlayFab
             ExperimentTypeSnapshot
         };
 
-        inline void ToJsonEnum(const ExperimentType input, Json::Value& output)
-        {
-            if (input == ExperimentType::ExperimentTypeActive)
-            {
-                output = Json::Value("Active");
-                return;
-            }
-            if (input == ExperimentType::ExperimentTypeSnapshot)
-            {
-                output = Json::Value("Snapshot");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, ExperimentType& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "Active")
-            {
-                output = ExperimentType::ExperimentTypeActive;
-                return;
-            }
-            if (inputStr == "Snapshot")
-            {
-                output = ExperimentType::ExperimentTypeSnapshot;
-                return;
-            }
-        }
+        void ToJsonEnum(const ExperimentType input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, ExperimentType& output);
 
         // Experimentation Classes
         struct CreateExclusionGroupRequest : public PlayFabRequestCommon
@@ -224,21 +68,9 @@ namespace PlayFab
 
             ~CreateExclusionGroupRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["Description"], Description);
-                FromJsonUtilS(input["Name"], Name);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Description; ToJsonUtilS(Description, each_Description); output["Description"] = each_Description;
-                Json::Value each_Name; ToJsonUtilS(Name, each_Name); output["Name"] = each_Name;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct CreateExclusionGroupResult : public PlayFabResultCommon
@@ -257,17 +89,9 @@ namespace PlayFab
 
             ~CreateExclusionGroupResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["ExclusionGroupId"], ExclusionGroupId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ExclusionGroupId; ToJsonUtilS(ExclusionGroupId, each_ExclusionGroupId); output["ExclusionGroupId"] = each_ExclusionGroupId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct Variable : public PlayFabBaseModel
@@ -289,19 +113,9 @@ namespace PlayFab
 
             ~Variable() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Name"], Name);
-                FromJsonUtilS(input["Value"], Value);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Name; ToJsonUtilS(Name, each_Name); output["Name"] = each_Name;
-                Json::Value each_Value; ToJsonUtilS(Value, each_Value); output["Value"] = each_Value;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct Variant : public PlayFabBaseModel
@@ -338,29 +152,9 @@ namespace PlayFab
 
             ~Variant() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Description"], Description);
-                FromJsonUtilS(input["Id"], Id);
-                FromJsonUtilP(input["IsControl"], IsControl);
-                FromJsonUtilS(input["Name"], Name);
-                FromJsonUtilS(input["TitleDataOverrideLabel"], TitleDataOverrideLabel);
-                FromJsonUtilP(input["TrafficPercentage"], TrafficPercentage);
-                FromJsonUtilO(input["Variables"], Variables);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Description; ToJsonUtilS(Description, each_Description); output["Description"] = each_Description;
-                Json::Value each_Id; ToJsonUtilS(Id, each_Id); output["Id"] = each_Id;
-                Json::Value each_IsControl; ToJsonUtilP(IsControl, each_IsControl); output["IsControl"] = each_IsControl;
-                Json::Value each_Name; ToJsonUtilS(Name, each_Name); output["Name"] = each_Name;
-                Json::Value each_TitleDataOverrideLabel; ToJsonUtilS(TitleDataOverrideLabel, each_TitleDataOverrideLabel); output["TitleDataOverrideLabel"] = each_TitleDataOverrideLabel;
-                Json::Value each_TrafficPercentage; ToJsonUtilP(TrafficPercentage, each_TrafficPercentage); output["TrafficPercentage"] = each_TrafficPercentage;
-                Json::Value each_Variables; ToJsonUtilO(Variables, each_Variables); output["Variables"] = each_Variables;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct CreateExperimentRequest : public PlayFabRequestCommon
@@ -412,39 +206,9 @@ namespace PlayFab
 
             ~CreateExperimentRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["Description"], Description);
-                FromJsonUtilP(input["Duration"], Duration);
-                FromJsonUtilT(input["EndDate"], EndDate);
-                FromJsonUtilS(input["ExclusionGroupId"], ExclusionGroupId);
-                FromJsonUtilP(input["ExclusionGroupTrafficAllocation"], ExclusionGroupTrafficAllocation);
-                FromJsonUtilE(input["ExperimentType"], pfExperimentType);
-                FromJsonUtilS(input["Name"], Name);
-                FromJsonUtilS(input["SegmentId"], SegmentId);
-                FromJsonUtilT(input["StartDate"], StartDate);
-                FromJsonUtilS(input["TitlePlayerAccountTestIds"], TitlePlayerAccountTestIds);
-                FromJsonUtilO(input["Variants"], Variants);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Description; ToJsonUtilS(Description, each_Description); output["Description"] = each_Description;
-                Json::Value each_Duration; ToJsonUtilP(Duration, each_Duration); output["Duration"] = each_Duration;
-                Json::Value each_EndDate; ToJsonUtilT(EndDate, each_EndDate); output["EndDate"] = each_EndDate;
-                Json::Value each_ExclusionGroupId; ToJsonUtilS(ExclusionGroupId, each_ExclusionGroupId); output["ExclusionGroupId"] = each_ExclusionGroupId;
-                Json::Value each_ExclusionGroupTrafficAllocation; ToJsonUtilP(ExclusionGroupTrafficAllocation, each_ExclusionGroupTrafficAllocation); output["ExclusionGroupTrafficAllocation"] = each_ExclusionGroupTrafficAllocation;
-                Json::Value each_pfExperimentType; ToJsonUtilE(pfExperimentType, each_pfExperimentType); output["ExperimentType"] = each_pfExperimentType;
-                Json::Value each_Name; ToJsonUtilS(Name, each_Name); output["Name"] = each_Name;
-                Json::Value each_SegmentId; ToJsonUtilS(SegmentId, each_SegmentId); output["SegmentId"] = each_SegmentId;
-                Json::Value each_StartDate; ToJsonUtilT(StartDate, each_StartDate); output["StartDate"] = each_StartDate;
-                Json::Value each_TitlePlayerAccountTestIds; ToJsonUtilS(TitlePlayerAccountTestIds, each_TitlePlayerAccountTestIds); output["TitlePlayerAccountTestIds"] = each_TitlePlayerAccountTestIds;
-                Json::Value each_Variants; ToJsonUtilO(Variants, each_Variants); output["Variants"] = each_Variants;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct CreateExperimentResult : public PlayFabResultCommon
@@ -463,17 +227,9 @@ namespace PlayFab
 
             ~CreateExperimentResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["ExperimentId"], ExperimentId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ExperimentId; ToJsonUtilS(ExperimentId, each_ExperimentId); output["ExperimentId"] = each_ExperimentId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct DeleteExclusionGroupRequest : public PlayFabRequestCommon
@@ -495,19 +251,9 @@ namespace PlayFab
 
             ~DeleteExclusionGroupRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["ExclusionGroupId"], ExclusionGroupId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ExclusionGroupId; ToJsonUtilS(ExclusionGroupId, each_ExclusionGroupId); output["ExclusionGroupId"] = each_ExclusionGroupId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct DeleteExperimentRequest : public PlayFabRequestCommon
@@ -529,19 +275,9 @@ namespace PlayFab
 
             ~DeleteExperimentRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["ExperimentId"], ExperimentId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ExperimentId; ToJsonUtilS(ExperimentId, each_ExperimentId); output["ExperimentId"] = each_ExperimentId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct EmptyResponse : public PlayFabResultCommon
@@ -557,15 +293,9 @@ namespace PlayFab
 
             ~EmptyResponse() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct EntityKey : public PlayFabBaseModel
@@ -587,19 +317,9 @@ namespace PlayFab
 
             ~EntityKey() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Id"], Id);
-                FromJsonUtilS(input["Type"], Type);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Id; ToJsonUtilS(Id, each_Id); output["Id"] = each_Id;
-                Json::Value each_Type; ToJsonUtilS(Type, each_Type); output["Type"] = each_Type;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct ExclusionGroupTrafficAllocation : public PlayFabBaseModel
@@ -621,19 +341,9 @@ namespace PlayFab
 
             ~ExclusionGroupTrafficAllocation() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["ExperimentId"], ExperimentId);
-                FromJsonUtilP(input["TrafficAllocation"], TrafficAllocation);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ExperimentId; ToJsonUtilS(ExperimentId, each_ExperimentId); output["ExperimentId"] = each_ExperimentId;
-                Json::Value each_TrafficAllocation; ToJsonUtilP(TrafficAllocation, each_TrafficAllocation); output["TrafficAllocation"] = each_TrafficAllocation;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct Experiment : public PlayFabBaseModel
@@ -688,41 +398,9 @@ namespace PlayFab
 
             ~Experiment() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Description"], Description);
-                FromJsonUtilP(input["Duration"], Duration);
-                FromJsonUtilT(input["EndDate"], EndDate);
-                FromJsonUtilS(input["ExclusionGroupId"], ExclusionGroupId);
-                FromJsonUtilP(input["ExclusionGroupTrafficAllocation"], ExclusionGroupTrafficAllocation);
-                FromJsonUtilE(input["ExperimentType"], pfExperimentType);
-                FromJsonUtilS(input["Id"], Id);
-                FromJsonUtilS(input["Name"], Name);
-                FromJsonUtilS(input["SegmentId"], SegmentId);
-                FromJsonUtilT(input["StartDate"], StartDate);
-                FromJsonUtilE(input["State"], State);
-                FromJsonUtilS(input["TitlePlayerAccountTestIds"], TitlePlayerAccountTestIds);
-                FromJsonUtilO(input["Variants"], Variants);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Description; ToJsonUtilS(Description, each_Description); output["Description"] = each_Description;
-                Json::Value each_Duration; ToJsonUtilP(Duration, each_Duration); output["Duration"] = each_Duration;
-                Json::Value each_EndDate; ToJsonUtilT(EndDate, each_EndDate); output["EndDate"] = each_EndDate;
-                Json::Value each_ExclusionGroupId; ToJsonUtilS(ExclusionGroupId, each_ExclusionGroupId); output["ExclusionGroupId"] = each_ExclusionGroupId;
-                Json::Value each_ExclusionGroupTrafficAllocation; ToJsonUtilP(ExclusionGroupTrafficAllocation, each_ExclusionGroupTrafficAllocation); output["ExclusionGroupTrafficAllocation"] = each_ExclusionGroupTrafficAllocation;
-                Json::Value each_pfExperimentType; ToJsonUtilE(pfExperimentType, each_pfExperimentType); output["ExperimentType"] = each_pfExperimentType;
-                Json::Value each_Id; ToJsonUtilS(Id, each_Id); output["Id"] = each_Id;
-                Json::Value each_Name; ToJsonUtilS(Name, each_Name); output["Name"] = each_Name;
-                Json::Value each_SegmentId; ToJsonUtilS(SegmentId, each_SegmentId); output["SegmentId"] = each_SegmentId;
-                Json::Value each_StartDate; ToJsonUtilT(StartDate, each_StartDate); output["StartDate"] = each_StartDate;
-                Json::Value each_State; ToJsonUtilE(State, each_State); output["State"] = each_State;
-                Json::Value each_TitlePlayerAccountTestIds; ToJsonUtilS(TitlePlayerAccountTestIds, each_TitlePlayerAccountTestIds); output["TitlePlayerAccountTestIds"] = each_TitlePlayerAccountTestIds;
-                Json::Value each_Variants; ToJsonUtilO(Variants, each_Variants); output["Variants"] = each_Variants;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct ExperimentExclusionGroup : public PlayFabBaseModel
@@ -747,21 +425,9 @@ namespace PlayFab
 
             ~ExperimentExclusionGroup() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Description"], Description);
-                FromJsonUtilS(input["ExclusionGroupId"], ExclusionGroupId);
-                FromJsonUtilS(input["Name"], Name);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Description; ToJsonUtilS(Description, each_Description); output["Description"] = each_Description;
-                Json::Value each_ExclusionGroupId; ToJsonUtilS(ExclusionGroupId, each_ExclusionGroupId); output["ExclusionGroupId"] = each_ExclusionGroupId;
-                Json::Value each_Name; ToJsonUtilS(Name, each_Name); output["Name"] = each_Name;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetExclusionGroupsRequest : public PlayFabRequestCommon
@@ -780,17 +446,9 @@ namespace PlayFab
 
             ~GetExclusionGroupsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetExclusionGroupsResult : public PlayFabResultCommon
@@ -809,17 +467,9 @@ namespace PlayFab
 
             ~GetExclusionGroupsResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["ExclusionGroups"], ExclusionGroups);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ExclusionGroups; ToJsonUtilO(ExclusionGroups, each_ExclusionGroups); output["ExclusionGroups"] = each_ExclusionGroups;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetExclusionGroupTrafficRequest : public PlayFabRequestCommon
@@ -841,19 +491,9 @@ namespace PlayFab
 
             ~GetExclusionGroupTrafficRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["ExclusionGroupId"], ExclusionGroupId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ExclusionGroupId; ToJsonUtilS(ExclusionGroupId, each_ExclusionGroupId); output["ExclusionGroupId"] = each_ExclusionGroupId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetExclusionGroupTrafficResult : public PlayFabResultCommon
@@ -872,17 +512,9 @@ namespace PlayFab
 
             ~GetExclusionGroupTrafficResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["TrafficAllocations"], TrafficAllocations);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_TrafficAllocations; ToJsonUtilO(TrafficAllocations, each_TrafficAllocations); output["TrafficAllocations"] = each_TrafficAllocations;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetExperimentsRequest : public PlayFabRequestCommon
@@ -901,17 +533,9 @@ namespace PlayFab
 
             ~GetExperimentsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetExperimentsResult : public PlayFabResultCommon
@@ -930,17 +554,9 @@ namespace PlayFab
 
             ~GetExperimentsResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Experiments"], Experiments);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Experiments; ToJsonUtilO(Experiments, each_Experiments); output["Experiments"] = each_Experiments;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetLatestScorecardRequest : public PlayFabRequestCommon
@@ -962,19 +578,9 @@ namespace PlayFab
 
             ~GetLatestScorecardRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["ExperimentId"], ExperimentId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ExperimentId; ToJsonUtilS(ExperimentId, each_ExperimentId); output["ExperimentId"] = each_ExperimentId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct MetricData : public PlayFabBaseModel
@@ -1029,41 +635,9 @@ namespace PlayFab
 
             ~MetricData() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["ConfidenceIntervalEnd"], ConfidenceIntervalEnd);
-                FromJsonUtilP(input["ConfidenceIntervalStart"], ConfidenceIntervalStart);
-                FromJsonUtilP(input["DeltaAbsoluteChange"], DeltaAbsoluteChange);
-                FromJsonUtilP(input["DeltaRelativeChange"], DeltaRelativeChange);
-                FromJsonUtilS(input["InternalName"], InternalName);
-                FromJsonUtilS(input["Movement"], Movement);
-                FromJsonUtilS(input["Name"], Name);
-                FromJsonUtilP(input["PMove"], PMove);
-                FromJsonUtilP(input["PValue"], PValue);
-                FromJsonUtilP(input["PValueThreshold"], PValueThreshold);
-                FromJsonUtilS(input["StatSigLevel"], StatSigLevel);
-                FromJsonUtilP(input["StdDev"], StdDev);
-                FromJsonUtilP(input["Value"], Value);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ConfidenceIntervalEnd; ToJsonUtilP(ConfidenceIntervalEnd, each_ConfidenceIntervalEnd); output["ConfidenceIntervalEnd"] = each_ConfidenceIntervalEnd;
-                Json::Value each_ConfidenceIntervalStart; ToJsonUtilP(ConfidenceIntervalStart, each_ConfidenceIntervalStart); output["ConfidenceIntervalStart"] = each_ConfidenceIntervalStart;
-                Json::Value each_DeltaAbsoluteChange; ToJsonUtilP(DeltaAbsoluteChange, each_DeltaAbsoluteChange); output["DeltaAbsoluteChange"] = each_DeltaAbsoluteChange;
-                Json::Value each_DeltaRelativeChange; ToJsonUtilP(DeltaRelativeChange, each_DeltaRelativeChange); output["DeltaRelativeChange"] = each_DeltaRelativeChange;
-                Json::Value each_InternalName; ToJsonUtilS(InternalName, each_InternalName); output["InternalName"] = each_InternalName;
-                Json::Value each_Movement; ToJsonUtilS(Movement, each_Movement); output["Movement"] = each_Movement;
-                Json::Value each_Name; ToJsonUtilS(Name, each_Name); output["Name"] = each_Name;
-                Json::Value each_PMove; ToJsonUtilP(PMove, each_PMove); output["PMove"] = each_PMove;
-                Json::Value each_PValue; ToJsonUtilP(PValue, each_PValue); output["PValue"] = each_PValue;
-                Json::Value each_PValueThreshold; ToJsonUtilP(PValueThreshold, each_PValueThreshold); output["PValueThreshold"] = each_PValueThreshold;
-                Json::Value each_StatSigLevel; ToJsonUtilS(StatSigLevel, each_StatSigLevel); output["StatSigLevel"] = each_StatSigLevel;
-                Json::Value each_StdDev; ToJsonUtilP(StdDev, each_StdDev); output["StdDev"] = each_StdDev;
-                Json::Value each_Value; ToJsonUtilP(Value, each_Value); output["Value"] = each_Value;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct ScorecardDataRow : public PlayFabBaseModel
@@ -1091,23 +665,9 @@ namespace PlayFab
 
             ~ScorecardDataRow() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["IsControl"], IsControl);
-                FromJsonUtilO(input["MetricDataRows"], MetricDataRows);
-                FromJsonUtilP(input["PlayerCount"], PlayerCount);
-                FromJsonUtilS(input["VariantName"], VariantName);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_IsControl; ToJsonUtilP(IsControl, each_IsControl); output["IsControl"] = each_IsControl;
-                Json::Value each_MetricDataRows; ToJsonUtilO(MetricDataRows, each_MetricDataRows); output["MetricDataRows"] = each_MetricDataRows;
-                Json::Value each_PlayerCount; ToJsonUtilP(PlayerCount, each_PlayerCount); output["PlayerCount"] = each_PlayerCount;
-                Json::Value each_VariantName; ToJsonUtilS(VariantName, each_VariantName); output["VariantName"] = each_VariantName;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct Scorecard : public PlayFabBaseModel
@@ -1147,31 +707,9 @@ namespace PlayFab
 
             ~Scorecard() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["DateGenerated"], DateGenerated);
-                FromJsonUtilS(input["Duration"], Duration);
-                FromJsonUtilP(input["EventsProcessed"], EventsProcessed);
-                FromJsonUtilS(input["ExperimentId"], ExperimentId);
-                FromJsonUtilS(input["ExperimentName"], ExperimentName);
-                FromJsonUtilE(input["LatestJobStatus"], LatestJobStatus);
-                FromJsonUtilP(input["SampleRatioMismatch"], SampleRatioMismatch);
-                FromJsonUtilO(input["ScorecardDataRows"], ScorecardDataRows);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_DateGenerated; ToJsonUtilS(DateGenerated, each_DateGenerated); output["DateGenerated"] = each_DateGenerated;
-                Json::Value each_Duration; ToJsonUtilS(Duration, each_Duration); output["Duration"] = each_Duration;
-                Json::Value each_EventsProcessed; ToJsonUtilP(EventsProcessed, each_EventsProcessed); output["EventsProcessed"] = each_EventsProcessed;
-                Json::Value each_ExperimentId; ToJsonUtilS(ExperimentId, each_ExperimentId); output["ExperimentId"] = each_ExperimentId;
-                Json::Value each_ExperimentName; ToJsonUtilS(ExperimentName, each_ExperimentName); output["ExperimentName"] = each_ExperimentName;
-                Json::Value each_LatestJobStatus; ToJsonUtilE(LatestJobStatus, each_LatestJobStatus); output["LatestJobStatus"] = each_LatestJobStatus;
-                Json::Value each_SampleRatioMismatch; ToJsonUtilP(SampleRatioMismatch, each_SampleRatioMismatch); output["SampleRatioMismatch"] = each_SampleRatioMismatch;
-                Json::Value each_ScorecardDataRows; ToJsonUtilO(ScorecardDataRows, each_ScorecardDataRows); output["ScorecardDataRows"] = each_ScorecardDataRows;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetLatestScorecardResult : public PlayFabResultCommon
@@ -1190,17 +728,9 @@ namespace PlayFab
 
             ~GetLatestScorecardResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Scorecard"], pfScorecard);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_pfScorecard; ToJsonUtilO(pfScorecard, each_pfScorecard); output["Scorecard"] = each_pfScorecard;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetTreatmentAssignmentRequest : public PlayFabRequestCommon
@@ -1222,19 +752,9 @@ namespace PlayFab
 
             ~GetTreatmentAssignmentRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Entity"], Entity);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct TreatmentAssignment : public PlayFabBaseModel
@@ -1256,19 +776,9 @@ namespace PlayFab
 
             ~TreatmentAssignment() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Variables"], Variables);
-                FromJsonUtilS(input["Variants"], Variants);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Variables; ToJsonUtilO(Variables, each_Variables); output["Variables"] = each_Variables;
-                Json::Value each_Variants; ToJsonUtilS(Variants, each_Variants); output["Variants"] = each_Variants;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetTreatmentAssignmentResult : public PlayFabResultCommon
@@ -1287,17 +797,9 @@ namespace PlayFab
 
             ~GetTreatmentAssignmentResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["TreatmentAssignment"], pfTreatmentAssignment);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_pfTreatmentAssignment; ToJsonUtilO(pfTreatmentAssignment, each_pfTreatmentAssignment); output["TreatmentAssignment"] = each_pfTreatmentAssignment;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct StartExperimentRequest : public PlayFabRequestCommon
@@ -1319,19 +821,9 @@ namespace PlayFab
 
             ~StartExperimentRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["ExperimentId"], ExperimentId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ExperimentId; ToJsonUtilS(ExperimentId, each_ExperimentId); output["ExperimentId"] = each_ExperimentId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct StopExperimentRequest : public PlayFabRequestCommon
@@ -1353,19 +845,9 @@ namespace PlayFab
 
             ~StopExperimentRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["ExperimentId"], ExperimentId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ExperimentId; ToJsonUtilS(ExperimentId, each_ExperimentId); output["ExperimentId"] = each_ExperimentId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct UpdateExclusionGroupRequest : public PlayFabRequestCommon
@@ -1393,23 +875,9 @@ namespace PlayFab
 
             ~UpdateExclusionGroupRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["Description"], Description);
-                FromJsonUtilS(input["ExclusionGroupId"], ExclusionGroupId);
-                FromJsonUtilS(input["Name"], Name);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Description; ToJsonUtilS(Description, each_Description); output["Description"] = each_Description;
-                Json::Value each_ExclusionGroupId; ToJsonUtilS(ExclusionGroupId, each_ExclusionGroupId); output["ExclusionGroupId"] = each_ExclusionGroupId;
-                Json::Value each_Name; ToJsonUtilS(Name, each_Name); output["Name"] = each_Name;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct UpdateExperimentRequest : public PlayFabRequestCommon
@@ -1464,41 +932,9 @@ namespace PlayFab
 
             ~UpdateExperimentRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["Description"], Description);
-                FromJsonUtilP(input["Duration"], Duration);
-                FromJsonUtilT(input["EndDate"], EndDate);
-                FromJsonUtilS(input["ExclusionGroupId"], ExclusionGroupId);
-                FromJsonUtilP(input["ExclusionGroupTrafficAllocation"], ExclusionGroupTrafficAllocation);
-                FromJsonUtilE(input["ExperimentType"], pfExperimentType);
-                FromJsonUtilS(input["Id"], Id);
-                FromJsonUtilS(input["Name"], Name);
-                FromJsonUtilS(input["SegmentId"], SegmentId);
-                FromJsonUtilT(input["StartDate"], StartDate);
-                FromJsonUtilS(input["TitlePlayerAccountTestIds"], TitlePlayerAccountTestIds);
-                FromJsonUtilO(input["Variants"], Variants);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Description; ToJsonUtilS(Description, each_Description); output["Description"] = each_Description;
-                Json::Value each_Duration; ToJsonUtilP(Duration, each_Duration); output["Duration"] = each_Duration;
-                Json::Value each_EndDate; ToJsonUtilT(EndDate, each_EndDate); output["EndDate"] = each_EndDate;
-                Json::Value each_ExclusionGroupId; ToJsonUtilS(ExclusionGroupId, each_ExclusionGroupId); output["ExclusionGroupId"] = each_ExclusionGroupId;
-                Json::Value each_ExclusionGroupTrafficAllocation; ToJsonUtilP(ExclusionGroupTrafficAllocation, each_ExclusionGroupTrafficAllocation); output["ExclusionGroupTrafficAllocation"] = each_ExclusionGroupTrafficAllocation;
-                Json::Value each_pfExperimentType; ToJsonUtilE(pfExperimentType, each_pfExperimentType); output["ExperimentType"] = each_pfExperimentType;
-                Json::Value each_Id; ToJsonUtilS(Id, each_Id); output["Id"] = each_Id;
-                Json::Value each_Name; ToJsonUtilS(Name, each_Name); output["Name"] = each_Name;
-                Json::Value each_SegmentId; ToJsonUtilS(SegmentId, each_SegmentId); output["SegmentId"] = each_SegmentId;
-                Json::Value each_StartDate; ToJsonUtilT(StartDate, each_StartDate); output["StartDate"] = each_StartDate;
-                Json::Value each_TitlePlayerAccountTestIds; ToJsonUtilS(TitlePlayerAccountTestIds, each_TitlePlayerAccountTestIds); output["TitlePlayerAccountTestIds"] = each_TitlePlayerAccountTestIds;
-                Json::Value each_Variants; ToJsonUtilO(Variants, each_Variants); output["Variants"] = each_Variants;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
     }
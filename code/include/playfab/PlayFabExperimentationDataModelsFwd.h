@@ -0,0 +1,48 @@
+#pragma once
+
+#if !defined(DISABLE_PLAYFABENTITY_API)
+
+namespace PlayFab
+{
+    namespace ExperimentationModels
+    {
+        // Forward declarations of the Experimentation models, for headers which only pass them by reference
+        enum class AnalysisTaskState;
+        enum class ExperimentState;
+        enum class ExperimentType;
+
+        struct CreateExclusionGroupRequest;
+        struct CreateExclusionGroupResult;
+        struct Variable;
+        struct Variant;
+        struct CreateExperimentRequest;
+        struct CreateExperimentResult;
+        struct DeleteExclusionGroupRequest;
+        struct DeleteExperimentRequest;
+        struct EmptyResponse;
+        struct EntityKey;
+        struct ExclusionGroupTrafficAllocation;
+        struct Experiment;
+        struct ExperimentExclusionGroup;
+        struct GetExclusionGroupsRequest;
+        struct GetExclusionGroupsResult;
+        struct GetExclusionGroupTrafficRequest;
+        struct GetExclusionGroupTrafficResult;
+        struct GetExperimentsRequest;
+        struct GetExperimentsResult;
+        struct GetLatestScorecardRequest;
+        struct MetricData;
+        struct ScorecardDataRow;
+        struct Scorecard;
+        struct GetLatestScorecardResult;
+        struct GetTreatmentAssignmentRequest;
+        struct TreatmentAssignment;
+        struct GetTreatmentAssignmentResult;
+        struct StartExperimentRequest;
+        struct StopExperimentRequest;
+        struct UpdateExclusionGroupRequest;
+        struct UpdateExperimentRequest;
+    }
+}
+
+#endif
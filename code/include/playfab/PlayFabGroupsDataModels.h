@@ -2,6 +2,7 @@
 
 #if !defined(DISABLE_PLAYFABENTITY_API)
 
+#include <playfab/PlayFabGroupsDataModelsFwd.h>
 #include <playfab/PlayFabBaseModel.h>
 #include <playfab/PlayFabJsonHeaders.h>
 
@@ -18,57 +19,8 @@ namespace PlayFab
             OperationTypesNone
         };
 
-        inline void ToJsonEnum(const OperationTypes input, Json::Value& output)
-        {
-            if (input == OperationTypes::OperationTypesCreated)
-            {
-                output = Json::Value("Created");
-                return;
-            }
-            if (input == OperationTypes::OperationTypesUpdated)
-            {
-                output = Json::Value("Updated");
-                return;
-            }
-            if (input == OperationTypes::OperationTypesDeleted)
-            {
-                output = Json::Value("Deleted");
-                return;
-            }
-            if (input == OperationTypes::OperationTypesNone)
-            {
-                output = Json::Value("None");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, OperationTypes& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "Created")
-            {
-                output = OperationTypes::OperationTypesCreated;
-                return;
-            }
-            if (inputStr == "Updated")
-            {
-                output = OperationTypes::OperationTypesUpdated;
-                return;
-            }
-            if (inputStr == "Deleted")
-            {
-                output = OperationTypes::OperationTypesDeleted;
-                return;
-            }
-            if (inputStr == "None")
-            {
-                output = OperationTypes::OperationTypesNone;
-                return;
-            }
-        }
+        void ToJsonEnum(const OperationTypes input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, OperationTypes& output);
 
         // Groups Classes
         struct EntityKey : public PlayFabBaseModel
@@ -90,19 +42,9 @@ namespace PlayFab
 
             ~EntityKey() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Id"], Id);
-                FromJsonUtilS(input["Type"], Type);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Id; ToJsonUtilS(Id, each_Id); output["Id"] = each_Id;
-                Json::Value each_Type; ToJsonUtilS(Type, each_Type); output["Type"] = each_Type;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct AcceptGroupApplicationRequest : public PlayFabRequestCommon
@@ -127,21 +69,9 @@ namespace PlayFab
 
             ~AcceptGroupApplicationRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilO(input["Group"], Group);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_Group; ToJsonUtilO(Group, each_Group); output["Group"] = each_Group;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct AcceptGroupInvitationRequest : public PlayFabRequestCommon
@@ -166,21 +96,9 @@ namespace PlayFab
 
             ~AcceptGroupInvitationRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilO(input["Group"], Group);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_Group; ToJsonUtilO(Group, each_Group); output["Group"] = each_Group;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct AddMembersRequest : public PlayFabRequestCommon
@@ -208,23 +126,9 @@ namespace PlayFab
 
             ~AddMembersRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Group"], Group);
-                FromJsonUtilO(input["Members"], Members);
-                FromJsonUtilS(input["RoleId"], RoleId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Group; ToJsonUtilO(Group, each_Group); output["Group"] = each_Group;
-                Json::Value each_Members; ToJsonUtilO(Members, each_Members); output["Members"] = each_Members;
-                Json::Value each_RoleId; ToJsonUtilS(RoleId, each_RoleId); output["RoleId"] = each_RoleId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct ApplyToGroupRequest : public PlayFabRequestCommon
@@ -252,23 +156,9 @@ namespace PlayFab
 
             ~ApplyToGroupRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["AutoAcceptOutstandingInvite"], AutoAcceptOutstandingInvite);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilO(input["Group"], Group);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AutoAcceptOutstandingInvite; ToJsonUtilP(AutoAcceptOutstandingInvite, each_AutoAcceptOutstandingInvite); output["AutoAcceptOutstandingInvite"] = each_AutoAcceptOutstandingInvite;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_Group; ToJsonUtilO(Group, each_Group); output["Group"] = each_Group;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct EntityWithLineage : public PlayFabBaseModel
@@ -290,19 +180,9 @@ namespace PlayFab
 
             ~EntityWithLineage() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Key"], Key);
-                FromJsonUtilO(input["Lineage"], Lineage);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Key; ToJsonUtilO(Key, each_Key); output["Key"] = each_Key;
-                Json::Value each_Lineage; ToJsonUtilO(Lineage, each_Lineage); output["Lineage"] = each_Lineage;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct ApplyToGroupResponse : public PlayFabResultCommon
@@ -327,21 +207,9 @@ namespace PlayFab
 
             ~ApplyToGroupResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilT(input["Expires"], Expires);
-                FromJsonUtilO(input["Group"], Group);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_Expires; ToJsonUtilT(Expires, each_Expires); output["Expires"] = each_Expires;
-                Json::Value each_Group; ToJsonUtilO(Group, each_Group); output["Group"] = each_Group;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct BlockEntityRequest : public PlayFabRequestCommon
@@ -366,21 +234,9 @@ namespace PlayFab
 
             ~BlockEntityRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilO(input["Group"], Group);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_Group; ToJsonUtilO(Group, each_Group); output["Group"] = each_Group;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct ChangeMemberRoleRequest : public PlayFabRequestCommon
@@ -411,25 +267,9 @@ namespace PlayFab
 
             ~ChangeMemberRoleRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["DestinationRoleId"], DestinationRoleId);
-                FromJsonUtilO(input["Group"], Group);
-                FromJsonUtilO(input["Members"], Members);
-                FromJsonUtilS(input["OriginRoleId"], OriginRoleId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_DestinationRoleId; ToJsonUtilS(DestinationRoleId, each_DestinationRoleId); output["DestinationRoleId"] = each_DestinationRoleId;
-                Json::Value each_Group; ToJsonUtilO(Group, each_Group); output["Group"] = each_Group;
-                Json::Value each_Members; ToJsonUtilO(Members, each_Members); output["Members"] = each_Members;
-                Json::Value each_OriginRoleId; ToJsonUtilS(OriginRoleId, each_OriginRoleId); output["OriginRoleId"] = each_OriginRoleId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct CreateGroupRequest : public PlayFabRequestCommon
@@ -454,21 +294,9 @@ namespace PlayFab
 
             ~CreateGroupRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilS(input["GroupName"], GroupName);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_GroupName; ToJsonUtilS(GroupName, each_GroupName); output["GroupName"] = each_GroupName;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct CreateGroupResponse : public PlayFabResultCommon
@@ -505,29 +333,9 @@ namespace PlayFab
 
             ~CreateGroupResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["AdminRoleId"], AdminRoleId);
-                FromJsonUtilT(input["Created"], Created);
-                FromJsonUtilO(input["Group"], Group);
-                FromJsonUtilS(input["GroupName"], GroupName);
-                FromJsonUtilS(input["MemberRoleId"], MemberRoleId);
-                FromJsonUtilP(input["ProfileVersion"], ProfileVersion);
-                FromJsonUtilS(input["Roles"], Roles);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AdminRoleId; ToJsonUtilS(AdminRoleId, each_AdminRoleId); output["AdminRoleId"] = each_AdminRoleId;
-                Json::Value each_Created; ToJsonUtilT(Created, each_Created); output["Created"] = each_Created;
-                Json::Value each_Group; ToJsonUtilO(Group, each_Group); output["Group"] = each_Group;
-                Json::Value each_GroupName; ToJsonUtilS(GroupName, each_GroupName); output["GroupName"] = each_GroupName;
-                Json::Value each_MemberRoleId; ToJsonUtilS(MemberRoleId, each_MemberRoleId); output["MemberRoleId"] = each_MemberRoleId;
-                Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); output["ProfileVersion"] = each_ProfileVersion;
-                Json::Value each_Roles; ToJsonUtilS(Roles, each_Roles); output["Roles"] = each_Roles;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct CreateGroupRoleRequest : public PlayFabRequestCommon
@@ -555,23 +363,9 @@ namespace PlayFab
 
             ~CreateGroupRoleRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Group"], Group);
-                FromJsonUtilS(input["RoleId"], RoleId);
-                FromJsonUtilS(input["RoleName"], RoleName);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Group; ToJsonUtilO(Group, each_Group); output["Group"] = each_Group;
-                Json::Value each_RoleId; ToJsonUtilS(RoleId, each_RoleId); output["RoleId"] = each_RoleId;
-                Json::Value each_RoleName; ToJsonUtilS(RoleName, each_RoleName); output["RoleName"] = each_RoleName;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct CreateGroupRoleResponse : public PlayFabResultCommon
@@ -596,21 +390,9 @@ namespace PlayFab
 
             ~CreateGroupRoleResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["ProfileVersion"], ProfileVersion);
-                FromJsonUtilS(input["RoleId"], RoleId);
-                FromJsonUtilS(input["RoleName"], RoleName);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); output["ProfileVersion"] = each_ProfileVersion;
-                Json::Value each_RoleId; ToJsonUtilS(RoleId, each_RoleId); output["RoleId"] = each_RoleId;
-                Json::Value each_RoleName; ToJsonUtilS(RoleName, each_RoleName); output["RoleName"] = each_RoleName;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct DeleteGroupRequest : public PlayFabRequestCommon
@@ -632,19 +414,9 @@ namespace PlayFab
 
             ~DeleteGroupRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Group"], Group);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Group; ToJsonUtilO(Group, each_Group); output["Group"] = each_Group;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct DeleteRoleRequest : public PlayFabRequestCommon
@@ -669,21 +441,9 @@ namespace PlayFab
 
             ~DeleteRoleRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Group"], Group);
-                FromJsonUtilS(input["RoleId"], RoleId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Group; ToJsonUtilO(Group, each_Group); output["Group"] = each_Group;
-                Json::Value each_RoleId; ToJsonUtilS(RoleId, each_RoleId); output["RoleId"] = each_RoleId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct EmptyResponse : public PlayFabResultCommon
@@ -699,15 +459,9 @@ namespace PlayFab
 
             ~EmptyResponse() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct EntityMemberRole : public PlayFabBaseModel
@@ -732,21 +486,9 @@ namespace PlayFab
 
             ~EntityMemberRole() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Members"], Members);
-                FromJsonUtilS(input["RoleId"], RoleId);
-                FromJsonUtilS(input["RoleName"], RoleName);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Members; ToJsonUtilO(Members, each_Members); output["Members"] = each_Members;
-                Json::Value each_RoleId; ToJsonUtilS(RoleId, each_RoleId); output["RoleId"] = each_RoleId;
-                Json::Value each_RoleName; ToJsonUtilS(RoleName, each_RoleName); output["RoleName"] = each_RoleName;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetGroupRequest : public PlayFabRequestCommon
@@ -771,21 +513,9 @@ namespace PlayFab
 
             ~GetGroupRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Group"], Group);
-                FromJsonUtilS(input["GroupName"], GroupName);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Group; ToJsonUtilO(Group, each_Group); output["Group"] = each_Group;
-                Json::Value each_GroupName; ToJsonUtilS(GroupName, each_GroupName); output["GroupName"] = each_GroupName;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetGroupResponse : public PlayFabResultCommon
@@ -822,29 +552,9 @@ namespace PlayFab
 
             ~GetGroupResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["AdminRoleId"], AdminRoleId);
-                FromJsonUtilT(input["Created"], Created);
-                FromJsonUtilO(input["Group"], Group);
-                FromJsonUtilS(input["GroupName"], GroupName);
-                FromJsonUtilS(input["MemberRoleId"], MemberRoleId);
-                FromJsonUtilP(input["ProfileVersion"], ProfileVersion);
-                FromJsonUtilS(input["Roles"], Roles);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AdminRoleId; ToJsonUtilS(AdminRoleId, each_AdminRoleId); output["AdminRoleId"] = each_AdminRoleId;
-                Json::Value each_Created; ToJsonUtilT(Created, each_Created); output["Created"] = each_Created;
-                Json::Value each_Group; ToJsonUtilO(Group, each_Group); output["Group"] = each_Group;
-                Json::Value each_GroupName; ToJsonUtilS(GroupName, each_GroupName); output["GroupName"] = each_GroupName;
-                Json::Value each_MemberRoleId; ToJsonUtilS(MemberRoleId, each_MemberRoleId); output["MemberRoleId"] = each_MemberRoleId;
-                Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); output["ProfileVersion"] = each_ProfileVersion;
-                Json::Value each_Roles; ToJsonUtilS(Roles, each_Roles); output["Roles"] = each_Roles;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GroupApplication : public PlayFabBaseModel
@@ -869,21 +579,9 @@ namespace PlayFab
 
             ~GroupApplication() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilT(input["Expires"], Expires);
-                FromJsonUtilO(input["Group"], Group);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_Expires; ToJsonUtilT(Expires, each_Expires); output["Expires"] = each_Expires;
-                Json::Value each_Group; ToJsonUtilO(Group, each_Group); output["Group"] = each_Group;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GroupBlock : public PlayFabBaseModel
@@ -905,19 +603,9 @@ namespace PlayFab
 
             ~GroupBlock() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilO(input["Group"], Group);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_Group; ToJsonUtilO(Group, each_Group); output["Group"] = each_Group;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GroupInvitation : public PlayFabBaseModel
@@ -948,25 +636,9 @@ namespace PlayFab
 
             ~GroupInvitation() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilT(input["Expires"], Expires);
-                FromJsonUtilO(input["Group"], Group);
-                FromJsonUtilO(input["InvitedByEntity"], InvitedByEntity);
-                FromJsonUtilO(input["InvitedEntity"], InvitedEntity);
-                FromJsonUtilS(input["RoleId"], RoleId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Expires; ToJsonUtilT(Expires, each_Expires); output["Expires"] = each_Expires;
-                Json::Value each_Group; ToJsonUtilO(Group, each_Group); output["Group"] = each_Group;
-                Json::Value each_InvitedByEntity; ToJsonUtilO(InvitedByEntity, each_InvitedByEntity); output["InvitedByEntity"] = each_InvitedByEntity;
-                Json::Value each_InvitedEntity; ToJsonUtilO(InvitedEntity, each_InvitedEntity); output["InvitedEntity"] = each_InvitedEntity;
-                Json::Value each_RoleId; ToJsonUtilS(RoleId, each_RoleId); output["RoleId"] = each_RoleId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GroupRole : public PlayFabBaseModel
@@ -988,19 +660,9 @@ namespace PlayFab
 
             ~GroupRole() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["RoleId"], RoleId);
-                FromJsonUtilS(input["RoleName"], RoleName);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_RoleId; ToJsonUtilS(RoleId, each_RoleId); output["RoleId"] = each_RoleId;
-                Json::Value each_RoleName; ToJsonUtilS(RoleName, each_RoleName); output["RoleName"] = each_RoleName;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GroupWithRoles : public PlayFabBaseModel
@@ -1028,23 +690,9 @@ namespace PlayFab
 
             ~GroupWithRoles() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Group"], Group);
-                FromJsonUtilS(input["GroupName"], GroupName);
-                FromJsonUtilP(input["ProfileVersion"], ProfileVersion);
-                FromJsonUtilO(input["Roles"], Roles);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Group; ToJsonUtilO(Group, each_Group); output["Group"] = each_Group;
-                Json::Value each_GroupName; ToJsonUtilS(GroupName, each_GroupName); output["GroupName"] = each_GroupName;
-                Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); output["ProfileVersion"] = each_ProfileVersion;
-                Json::Value each_Roles; ToJsonUtilO(Roles, each_Roles); output["Roles"] = each_Roles;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct InviteToGroupRequest : public PlayFabRequestCommon
@@ -1075,25 +723,9 @@ namespace PlayFab
 
             ~InviteToGroupRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["AutoAcceptOutstandingApplication"], AutoAcceptOutstandingApplication);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilO(input["Group"], Group);
-                FromJsonUtilS(input["RoleId"], RoleId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AutoAcceptOutstandingApplication; ToJsonUtilP(AutoAcceptOutstandingApplication, each_AutoAcceptOutstandingApplication); output["AutoAcceptOutstandingApplication"] = each_AutoAcceptOutstandingApplication;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_Group; ToJsonUtilO(Group, each_Group); output["Group"] = each_Group;
-                Json::Value each_RoleId; ToJsonUtilS(RoleId, each_RoleId); output["RoleId"] = each_RoleId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct InviteToGroupResponse : public PlayFabResultCommon
@@ -1124,25 +756,9 @@ namespace PlayFab
 
             ~InviteToGroupResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilT(input["Expires"], Expires);
-                FromJsonUtilO(input["Group"], Group);
-                FromJsonUtilO(input["InvitedByEntity"], InvitedByEntity);
-                FromJsonUtilO(input["InvitedEntity"], InvitedEntity);
-                FromJsonUtilS(input["RoleId"], RoleId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Expires; ToJsonUtilT(Expires, each_Expires); output["Expires"] = each_Expires;
-                Json::Value each_Group; ToJsonUtilO(Group, each_Group); output["Group"] = each_Group;
-                Json::Value each_InvitedByEntity; ToJsonUtilO(InvitedByEntity, each_InvitedByEntity); output["InvitedByEntity"] = each_InvitedByEntity;
-                Json::Value each_InvitedEntity; ToJsonUtilO(InvitedEntity, each_InvitedEntity); output["InvitedEntity"] = each_InvitedEntity;
-                Json::Value each_RoleId; ToJsonUtilS(RoleId, each_RoleId); output["RoleId"] = each_RoleId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct IsMemberRequest : public PlayFabRequestCommon
@@ -1170,23 +786,9 @@ namespace PlayFab
 
             ~IsMemberRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilO(input["Group"], Group);
-                FromJsonUtilS(input["RoleId"], RoleId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_Group; ToJsonUtilO(Group, each_Group); output["Group"] = each_Group;
-                Json::Value each_RoleId; ToJsonUtilS(RoleId, each_RoleId); output["RoleId"] = each_RoleId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct IsMemberResponse : public PlayFabResultCommon
@@ -1205,17 +807,9 @@ namespace PlayFab
 
             ~IsMemberResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["IsMember"], IsMember);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_IsMember; ToJsonUtilP(IsMember, each_IsMember); output["IsMember"] = each_IsMember;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct ListGroupApplicationsRequest : public PlayFabRequestCommon
@@ -1237,19 +831,9 @@ namespace PlayFab
 
             ~ListGroupApplicationsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Group"], Group);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Group; ToJsonUtilO(Group, each_Group); output["Group"] = each_Group;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct ListGroupApplicationsResponse : public PlayFabResultCommon
@@ -1268,17 +852,9 @@ namespace PlayFab
 
             ~ListGroupApplicationsResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Applications"], Applications);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Applications; ToJsonUtilO(Applications, each_Applications); output["Applications"] = each_Applications;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct ListGroupBlocksRequest : public PlayFabRequestCommon
@@ -1300,19 +876,9 @@ namespace PlayFab
 
             ~ListGroupBlocksRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Group"], Group);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Group; ToJsonUtilO(Group, each_Group); output["Group"] = each_Group;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct ListGroupBlocksResponse : public PlayFabResultCommon
@@ -1331,17 +897,9 @@ namespace PlayFab
 
             ~ListGroupBlocksResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["BlockedEntities"], BlockedEntities);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_BlockedEntities; ToJsonUtilO(BlockedEntities, each_BlockedEntities); output["BlockedEntities"] = each_BlockedEntities;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct ListGroupInvitationsRequest : public PlayFabRequestCommon
@@ -1363,19 +921,9 @@ namespace PlayFab
 
             ~ListGroupInvitationsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Group"], Group);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Group; ToJsonUtilO(Group, each_Group); output["Group"] = each_Group;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct ListGroupInvitationsResponse : public PlayFabResultCommon
@@ -1394,17 +942,9 @@ namespace PlayFab
 
             ~ListGroupInvitationsResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Invitations"], Invitations);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Invitations; ToJsonUtilO(Invitations, each_Invitations); output["Invitations"] = each_Invitations;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct ListGroupMembersRequest : public PlayFabRequestCommon
@@ -1426,19 +966,9 @@ namespace PlayFab
 
             ~ListGroupMembersRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Group"], Group);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Group; ToJsonUtilO(Group, each_Group); output["Group"] = each_Group;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct ListGroupMembersResponse : public PlayFabResultCommon
@@ -1457,17 +987,9 @@ namespace PlayFab
 
             ~ListGroupMembersResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Members"], Members);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Members; ToJsonUtilO(Members, each_Members); output["Members"] = each_Members;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct ListMembershipOpportunitiesRequest : public PlayFabRequestCommon
@@ -1489,19 +1011,9 @@ namespace PlayFab
 
             ~ListMembershipOpportunitiesRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Entity"], Entity);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct ListMembershipOpportunitiesResponse : public PlayFabResultCommon
@@ -1523,19 +1035,9 @@ namespace PlayFab
 
             ~ListMembershipOpportunitiesResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Applications"], Applications);
-                FromJsonUtilO(input["Invitations"], Invitations);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Applications; ToJsonUtilO(Applications, each_Applications); output["Applications"] = each_Applications;
-                Json::Value each_Invitations; ToJsonUtilO(Invitations, each_Invitations); output["Invitations"] = each_Invitations;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct ListMembershipRequest : public PlayFabRequestCommon
@@ -1557,19 +1059,9 @@ namespace PlayFab
 
             ~ListMembershipRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Entity"], Entity);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct ListMembershipResponse : public PlayFabResultCommon
@@ -1588,17 +1080,9 @@ namespace PlayFab
 
             ~ListMembershipResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Groups"], Groups);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Groups; ToJsonUtilO(Groups, each_Groups); output["Groups"] = each_Groups;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct RemoveGroupApplicationRequest : public PlayFabRequestCommon
@@ -1623,21 +1107,9 @@ namespace PlayFab
 
             ~RemoveGroupApplicationRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilO(input["Group"], Group);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_Group; ToJsonUtilO(Group, each_Group); output["Group"] = each_Group;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct RemoveGroupInvitationRequest : public PlayFabRequestCommon
@@ -1662,21 +1134,9 @@ namespace PlayFab
 
             ~RemoveGroupInvitationRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilO(input["Group"], Group);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_Group; ToJsonUtilO(Group, each_Group); output["Group"] = each_Group;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct RemoveMembersRequest : public PlayFabRequestCommon
@@ -1704,23 +1164,9 @@ namespace PlayFab
 
             ~RemoveMembersRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Group"], Group);
-                FromJsonUtilO(input["Members"], Members);
-                FromJsonUtilS(input["RoleId"], RoleId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Group; ToJsonUtilO(Group, each_Group); output["Group"] = each_Group;
-                Json::Value each_Members; ToJsonUtilO(Members, each_Members); output["Members"] = each_Members;
-                Json::Value each_RoleId; ToJsonUtilS(RoleId, each_RoleId); output["RoleId"] = each_RoleId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct UnblockEntityRequest : public PlayFabRequestCommon
@@ -1745,21 +1191,9 @@ namespace PlayFab
 
             ~UnblockEntityRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilO(input["Group"], Group);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_Group; ToJsonUtilO(Group, each_Group); output["Group"] = each_Group;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct UpdateGroupRequest : public PlayFabRequestCommon
@@ -1793,27 +1227,9 @@ namespace PlayFab
 
             ~UpdateGroupRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["AdminRoleId"], AdminRoleId);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["ExpectedProfileVersion"], ExpectedProfileVersion);
-                FromJsonUtilO(input["Group"], Group);
-                FromJsonUtilS(input["GroupName"], GroupName);
-                FromJsonUtilS(input["MemberRoleId"], MemberRoleId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AdminRoleId; ToJsonUtilS(AdminRoleId, each_AdminRoleId); output["AdminRoleId"] = each_AdminRoleId;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ExpectedProfileVersion; ToJsonUtilP(ExpectedProfileVersion, each_ExpectedProfileVersion); output["ExpectedProfileVersion"] = each_ExpectedProfileVersion;
-                Json::Value each_Group; ToJsonUtilO(Group, each_Group); output["Group"] = each_Group;
-                Json::Value each_GroupName; ToJsonUtilS(GroupName, each_GroupName); output["GroupName"] = each_GroupName;
-                Json::Value each_MemberRoleId; ToJsonUtilS(MemberRoleId, each_MemberRoleId); output["MemberRoleId"] = each_MemberRoleId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct UpdateGroupResponse : public PlayFabResultCommon
@@ -1838,21 +1254,9 @@ namespace PlayFab
 
             ~UpdateGroupResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["OperationReason"], OperationReason);
-                FromJsonUtilP(input["ProfileVersion"], ProfileVersion);
-                FromJsonUtilE(input["SetResult"], SetResult);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_OperationReason; ToJsonUtilS(OperationReason, each_OperationReason); output["OperationReason"] = each_OperationReason;
-                Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); output["ProfileVersion"] = each_ProfileVersion;
-                Json::Value each_SetResult; ToJsonUtilE(SetResult, each_SetResult); output["SetResult"] = each_SetResult;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct UpdateGroupRoleRequest : public PlayFabRequestCommon
@@ -1883,25 +1287,9 @@ namespace PlayFab
 
             ~UpdateGroupRoleRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["ExpectedProfileVersion"], ExpectedProfileVersion);
-                FromJsonUtilO(input["Group"], Group);
-                FromJsonUtilS(input["RoleId"], RoleId);
-                FromJsonUtilS(input["RoleName"], RoleName);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ExpectedProfileVersion; ToJsonUtilP(ExpectedProfileVersion, each_ExpectedProfileVersion); output["ExpectedProfileVersion"] = each_ExpectedProfileVersion;
-                Json::Value each_Group; ToJsonUtilO(Group, each_Group); output["Group"] = each_Group;
-                Json::Value each_RoleId; ToJsonUtilS(RoleId, each_RoleId); output["RoleId"] = each_RoleId;
-                Json::Value each_RoleName; ToJsonUtilS(RoleName, each_RoleName); output["RoleName"] = each_RoleName;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct UpdateGroupRoleResponse : public PlayFabResultCommon
@@ -1926,21 +1314,9 @@ namespace PlayFab
 
             ~UpdateGroupRoleResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["OperationReason"], OperationReason);
-                FromJsonUtilP(input["ProfileVersion"], ProfileVersion);
-                FromJsonUtilE(input["SetResult"], SetResult);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_OperationReason; ToJsonUtilS(OperationReason, each_OperationReason); output["OperationReason"] = each_OperationReason;
-                Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); output["ProfileVersion"] = each_ProfileVersion;
-                Json::Value each_SetResult; ToJsonUtilE(SetResult, each_SetResult); output["SetResult"] = each_SetResult;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
     }
@@ -0,0 +1,63 @@
+#pragma once
+
+#if !defined(DISABLE_PLAYFABENTITY_API)
+
+namespace PlayFab
+{
+    namespace GroupsModels
+    {
+        // Forward declarations of the Groups models, for headers which only pass them by reference
+        enum class OperationTypes;
+
+        struct EntityKey;
+        struct AcceptGroupApplicationRequest;
+        struct AcceptGroupInvitationRequest;
+        struct AddMembersRequest;
+        struct ApplyToGroupRequest;
+        struct EntityWithLineage;
+        struct ApplyToGroupResponse;
+        struct BlockEntityRequest;
+        struct ChangeMemberRoleRequest;
+        struct CreateGroupRequest;
+        struct CreateGroupResponse;
+        struct CreateGroupRoleRequest;
+        struct CreateGroupRoleResponse;
+        struct DeleteGroupRequest;
+        struct DeleteRoleRequest;
+        struct EmptyResponse;
+        struct EntityMemberRole;
+        struct GetGroupRequest;
+        struct GetGroupResponse;
+        struct GroupApplication;
+        struct GroupBlock;
+        struct GroupInvitation;
+        struct GroupRole;
+        struct GroupWithRoles;
+        struct InviteToGroupRequest;
+        struct InviteToGroupResponse;
+        struct IsMemberRequest;
+        struct IsMemberResponse;
+        struct ListGroupApplicationsRequest;
+        struct ListGroupApplicationsResponse;
+        struct ListGroupBlocksRequest;
+        struct ListGroupBlocksResponse;
+        struct ListGroupInvitationsRequest;
+        struct ListGroupInvitationsResponse;
+        struct ListGroupMembersRequest;
+        struct ListGroupMembersResponse;
+        struct ListMembershipOpportunitiesRequest;
+        struct ListMembershipOpportunitiesResponse;
+        struct ListMembershipRequest;
+        struct ListMembershipResponse;
+        struct RemoveGroupApplicationRequest;
+        struct RemoveGroupInvitationRequest;
+        struct RemoveMembersRequest;
+        struct UnblockEntityRequest;
+        struct UpdateGroupRequest;
+        struct UpdateGroupResponse;
+        struct UpdateGroupRoleRequest;
+        struct UpdateGroupRoleResponse;
+    }
+}
+
+#endif
@@ -2,6 +2,7 @@
 
 #if !defined(DISABLE_PLAYFABENTITY_API)
 
+#include <playfab/PlayFabInsightsDataModelsFwd.h>
 #include <playfab/PlayFabBaseModel.h>
 #include <playfab/PlayFabJsonHeaders.h>
 
@@ -27,17 +28,9 @@ namespace PlayFab
 
             ~InsightsEmptyRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct InsightsPerformanceLevel : public PlayFabBaseModel
@@ -77,31 +70,9 @@ namespace PlayFab
 
             ~InsightsPerformanceLevel() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["ActiveEventExports"], ActiveEventExports);
-                FromJsonUtilP(input["CacheSizeMB"], CacheSizeMB);
-                FromJsonUtilP(input["Concurrency"], Concurrency);
-                FromJsonUtilP(input["CreditsPerMinute"], CreditsPerMinute);
-                FromJsonUtilP(input["EventsPerSecond"], EventsPerSecond);
-                FromJsonUtilP(input["Level"], Level);
-                FromJsonUtilP(input["MaxMemoryPerQueryMB"], MaxMemoryPerQueryMB);
-                FromJsonUtilP(input["VirtualCpuCores"], VirtualCpuCores);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ActiveEventExports; ToJsonUtilP(ActiveEventExports, each_ActiveEventExports); output["ActiveEventExports"] = each_ActiveEventExports;
-                Json::Value each_CacheSizeMB; ToJsonUtilP(CacheSizeMB, each_CacheSizeMB); output["CacheSizeMB"] = each_CacheSizeMB;
-                Json::Value each_Concurrency; ToJsonUtilP(Concurrency, each_Concurrency); output["Concurrency"] = each_Concurrency;
-                Json::Value each_CreditsPerMinute; ToJsonUtilP(CreditsPerMinute, each_CreditsPerMinute); output["CreditsPerMinute"] = each_CreditsPerMinute;
-                Json::Value each_EventsPerSecond; ToJsonUtilP(EventsPerSecond, each_EventsPerSecond); output["EventsPerSecond"] = each_EventsPerSecond;
-                Json::Value each_Level; ToJsonUtilP(Level, each_Level); output["Level"] = each_Level;
-                Json::Value each_MaxMemoryPerQueryMB; ToJsonUtilP(MaxMemoryPerQueryMB, each_MaxMemoryPerQueryMB); output["MaxMemoryPerQueryMB"] = each_MaxMemoryPerQueryMB;
-                Json::Value each_VirtualCpuCores; ToJsonUtilP(VirtualCpuCores, each_VirtualCpuCores); output["VirtualCpuCores"] = each_VirtualCpuCores;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct InsightsGetLimitsResponse : public PlayFabResultCommon
@@ -132,25 +103,9 @@ namespace PlayFab
 
             ~InsightsGetLimitsResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["DefaultPerformanceLevel"], DefaultPerformanceLevel);
-                FromJsonUtilP(input["DefaultStorageRetentionDays"], DefaultStorageRetentionDays);
-                FromJsonUtilP(input["StorageMaxRetentionDays"], StorageMaxRetentionDays);
-                FromJsonUtilP(input["StorageMinRetentionDays"], StorageMinRetentionDays);
-                FromJsonUtilO(input["SubMeters"], SubMeters);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_DefaultPerformanceLevel; ToJsonUtilP(DefaultPerformanceLevel, each_DefaultPerformanceLevel); output["DefaultPerformanceLevel"] = each_DefaultPerformanceLevel;
-                Json::Value each_DefaultStorageRetentionDays; ToJsonUtilP(DefaultStorageRetentionDays, each_DefaultStorageRetentionDays); output["DefaultStorageRetentionDays"] = each_DefaultStorageRetentionDays;
-                Json::Value each_StorageMaxRetentionDays; ToJsonUtilP(StorageMaxRetentionDays, each_StorageMaxRetentionDays); output["StorageMaxRetentionDays"] = each_StorageMaxRetentionDays;
-                Json::Value each_StorageMinRetentionDays; ToJsonUtilP(StorageMinRetentionDays, each_StorageMinRetentionDays); output["StorageMinRetentionDays"] = each_StorageMinRetentionDays;
-                Json::Value each_SubMeters; ToJsonUtilO(SubMeters, each_SubMeters); output["SubMeters"] = each_SubMeters;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct InsightsGetOperationStatusResponse : public PlayFabResultCommon
@@ -190,31 +145,9 @@ namespace PlayFab
 
             ~InsightsGetOperationStatusResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Message"], Message);
-                FromJsonUtilT(input["OperationCompletedTime"], OperationCompletedTime);
-                FromJsonUtilS(input["OperationId"], OperationId);
-                FromJsonUtilT(input["OperationLastUpdated"], OperationLastUpdated);
-                FromJsonUtilT(input["OperationStartedTime"], OperationStartedTime);
-                FromJsonUtilS(input["OperationType"], OperationType);
-                FromJsonUtilP(input["OperationValue"], OperationValue);
-                FromJsonUtilS(input["Status"], Status);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Message; ToJsonUtilS(Message, each_Message); output["Message"] = each_Message;
-                Json::Value each_OperationCompletedTime; ToJsonUtilT(OperationCompletedTime, each_OperationCompletedTime); output["OperationCompletedTime"] = each_OperationCompletedTime;
-                Json::Value each_OperationId; ToJsonUtilS(OperationId, each_OperationId); output["OperationId"] = each_OperationId;
-                Json::Value each_OperationLastUpdated; ToJsonUtilT(OperationLastUpdated, each_OperationLastUpdated); output["OperationLastUpdated"] = each_OperationLastUpdated;
-                Json::Value each_OperationStartedTime; ToJsonUtilT(OperationStartedTime, each_OperationStartedTime); output["OperationStartedTime"] = each_OperationStartedTime;
-                Json::Value each_OperationType; ToJsonUtilS(OperationType, each_OperationType); output["OperationType"] = each_OperationType;
-                Json::Value each_OperationValue; ToJsonUtilP(OperationValue, each_OperationValue); output["OperationValue"] = each_OperationValue;
-                Json::Value each_Status; ToJsonUtilS(Status, each_Status); output["Status"] = each_Status;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct InsightsGetDetailsResponse : public PlayFabResultCommon
@@ -248,27 +181,9 @@ namespace PlayFab
 
             ~InsightsGetDetailsResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["DataUsageMb"], DataUsageMb);
-                FromJsonUtilS(input["ErrorMessage"], ErrorMessage);
-                FromJsonUtilO(input["Limits"], Limits);
-                FromJsonUtilO(input["PendingOperations"], PendingOperations);
-                FromJsonUtilP(input["PerformanceLevel"], PerformanceLevel);
-                FromJsonUtilP(input["RetentionDays"], RetentionDays);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_DataUsageMb; ToJsonUtilP(DataUsageMb, each_DataUsageMb); output["DataUsageMb"] = each_DataUsageMb;
-                Json::Value each_ErrorMessage; ToJsonUtilS(ErrorMessage, each_ErrorMessage); output["ErrorMessage"] = each_ErrorMessage;
-                Json::Value each_Limits; ToJsonUtilO(Limits, each_Limits); output["Limits"] = each_Limits;
-                Json::Value each_PendingOperations; ToJsonUtilO(PendingOperations, each_PendingOperations); output["PendingOperations"] = each_PendingOperations;
-                Json::Value each_PerformanceLevel; ToJsonUtilP(PerformanceLevel, each_PerformanceLevel); output["PerformanceLevel"] = each_PerformanceLevel;
-                Json::Value each_RetentionDays; ToJsonUtilP(RetentionDays, each_RetentionDays); output["RetentionDays"] = each_RetentionDays;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct InsightsGetOperationStatusRequest : public PlayFabRequestCommon
@@ -290,19 +205,9 @@ namespace PlayFab
 
             ~InsightsGetOperationStatusRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["OperationId"], OperationId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_OperationId; ToJsonUtilS(OperationId, each_OperationId); output["OperationId"] = each_OperationId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct InsightsGetPendingOperationsRequest : public PlayFabRequestCommon
@@ -324,19 +229,9 @@ namespace PlayFab
 
             ~InsightsGetPendingOperationsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["OperationType"], OperationType);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_OperationType; ToJsonUtilS(OperationType, each_OperationType); output["OperationType"] = each_OperationType;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct InsightsGetPendingOperationsResponse : public PlayFabResultCommon
@@ -355,17 +250,9 @@ namespace PlayFab
 
             ~InsightsGetPendingOperationsResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["PendingOperations"], PendingOperations);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_PendingOperations; ToJsonUtilO(PendingOperations, each_PendingOperations); output["PendingOperations"] = each_PendingOperations;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct InsightsOperationResponse : public PlayFabResultCommon
@@ -390,21 +277,9 @@ namespace PlayFab
 
             ~InsightsOperationResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Message"], Message);
-                FromJsonUtilS(input["OperationId"], OperationId);
-                FromJsonUtilS(input["OperationType"], OperationType);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Message; ToJsonUtilS(Message, each_Message); output["Message"] = each_Message;
-                Json::Value each_OperationId; ToJsonUtilS(OperationId, each_OperationId); output["OperationId"] = each_OperationId;
-                Json::Value each_OperationType; ToJsonUtilS(OperationType, each_OperationType); output["OperationType"] = each_OperationType;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct InsightsSetPerformanceRequest : public PlayFabRequestCommon
@@ -426,19 +301,9 @@ namespace PlayFab
 
             ~InsightsSetPerformanceRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["PerformanceLevel"], PerformanceLevel);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_PerformanceLevel; ToJsonUtilP(PerformanceLevel, each_PerformanceLevel); output["PerformanceLevel"] = each_PerformanceLevel;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct InsightsSetStorageRetentionRequest : public PlayFabRequestCommon
@@ -460,19 +325,9 @@ namespace PlayFab
 
             ~InsightsSetStorageRetentionRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["RetentionDays"], RetentionDays);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_RetentionDays; ToJsonUtilP(RetentionDays, each_RetentionDays); output["RetentionDays"] = each_RetentionDays;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
     }
@@ -0,0 +1,24 @@
+#pragma once
+
+#if !defined(DISABLE_PLAYFABENTITY_API)
+
+namespace PlayFab
+{
+    namespace InsightsModels
+    {
+        // Forward declarations of the Insights models, for headers which only pass them by reference
+        struct InsightsEmptyRequest;
+        struct InsightsPerformanceLevel;
+        struct InsightsGetLimitsResponse;
+        struct InsightsGetOperationStatusResponse;
+        struct InsightsGetDetailsResponse;
+        struct InsightsGetOperationStatusRequest;
+        struct InsightsGetPendingOperationsRequest;
+        struct InsightsGetPendingOperationsResponse;
+        struct InsightsOperationResponse;
+        struct InsightsSetPerformanceRequest;
+        struct InsightsSetStorageRetentionRequest;
+    }
+}
+
+#endif
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <playfab/PlayFabPluginManager.h>
+
+namespace PlayFab
+{
+    /// <summary>
+    /// PlayFabJsonSerializerPlugin is the default serializer: compact json text, the same format used to talk to PlayFab services.
+    /// </summary>
+    class PlayFabJsonSerializerPlugin : public IPlayFabSerializerPlugin
+    {
+    public:
+        virtual void Serialize(const Json::Value& input, std::string& output) override;
+        virtual bool Deserialize(const char* data, size_t length, Json::Value& output, std::string& errors) override;
+    };
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <playfab/PlayFabJsonHeaders.h>
+
+#include <string>
+
+namespace PlayFab
+{
+    /// <summary>
+    /// Json reading/writing helpers shared by the API layer and the transport plugins.
+    /// Each thread lazily creates one reader and one writer and keeps reusing them, so hot paths
+    /// don't pay for a new Json::CharReaderBuilder/StreamWriterBuilder (and their settings) on every call.
+    /// </summary>
+    class PlayFabJsonUtils
+    {
+    public:
+        // Writes the json value as compact (non-indented) json text
+        static std::string WriteToString(const Json::Value& input);
+
+        // Parses json text in range [begin, end) into output. Returns false and fills errors if the text can't be parsed.
+        static bool ParseFromString(const char* begin, const char* end, Json::Value& output, std::string& errors);
+        static bool ParseFromString(const std::string& input, Json::Value& output, std::string& errors);
+
+        // Approximate number of heap bytes held by the json value and its children (sizeof the value itself is not included)
+        static size_t GetMemoryUsage(const Json::Value& input);
+
+        // Approximate length of the compact json text of the value (special characters in strings are counted unescaped)
+        static size_t GetSerializedSize(const Json::Value& input);
+
+    private:
+        PlayFabJsonUtils() = delete; // static class should never have an instance
+    };
+}
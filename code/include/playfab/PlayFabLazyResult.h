@@ -0,0 +1,153 @@
+#pragma once
+
+#include <playfab/PlayFabBaseModel.h>
+#include <playfab/PlayFabJsonHeaders.h>
+
+#include <list>
+#include <map>
+#include <memory>
+#include <type_traits>
+
+namespace PlayFab
+{
+    class CallRequestContainer;
+
+    // Decodes a single json field with the same rules the generated FromJson methods use
+    inline void LazyResultDecode(const Json::Value& input, Json::Value& output) { output = input; }
+    inline void LazyResultDecode(const Json::Value& input, std::string& output) { FromJsonUtilS(input, output); }
+
+    template <typename FieldType>
+    inline typename std::enable_if<std::is_arithmetic<FieldType>::value>::type LazyResultDecode(const Json::Value& input, FieldType& output)
+    {
+        FromJsonUtilP(input, output);
+    }
+
+    // time_t is an integer type, and the same type as Int64 on most platforms, so it can't have an overload of its own.
+    // Time fields are serialized as ISO-8601 strings, so a string decoded into a time_t is parsed as a time.
+    inline void LazyResultDecode(const Json::Value& input, time_t& output)
+    {
+        if (input.isString())
+        {
+            FromJsonUtilT(input, output);
+        }
+        else if (input != Json::Value::null)
+        {
+            output = static_cast<time_t>(input.asInt64());
+        }
+    }
+
+    template <typename FieldType>
+    inline typename std::enable_if<std::is_base_of<PlayFabBaseModel, FieldType>::value>::type LazyResultDecode(const Json::Value& input, FieldType& output)
+    {
+        output.FromJson(input);
+    }
+
+    template <typename FieldType> inline void LazyResultDecode(const Json::Value& input, Boxed<FieldType>& output)
+    {
+        if (input == Json::Value::null)
+        {
+            output.setNull();
+            return;
+        }
+        FieldType outputVal;
+        LazyResultDecode(input, outputVal);
+        output = outputVal;
+    }
+
+    template <typename FieldType> inline void LazyResultDecode(const Json::Value& input, std::list<FieldType>& output)
+    {
+        output.clear();
+        if (!input.isArray())
+        {
+            return;
+        }
+        for (const Json::Value& element : input)
+        {
+            FieldType eachOutput;
+            LazyResultDecode(element, eachOutput);
+            output.push_back(std::move(eachOutput));
+        }
+    }
+
+    template <typename FieldType> inline void LazyResultDecode(const Json::Value& input, std::map<std::string, FieldType>& output)
+    {
+        output.clear();
+        if (!input.isObject())
+        {
+            return;
+        }
+        for (auto iter = input.begin(); iter != input.end(); ++iter)
+        {
+            FieldType eachOutput;
+            LazyResultDecode(*iter, eachOutput);
+            output[iter.name()] = std::move(eachOutput);
+        }
+    }
+
+    /// <summary>
+    /// The type independent part of PlayFabLazyResult.
+    /// It takes over the already parsed response of a successful API call (without copying it), and decodes fields only when asked.
+    /// Copies are cheap and share the same response, so a result may be kept after the callback returns.
+    /// </summary>
+    class PlayFabLazyResultBase
+    {
+    public:
+        // The json "data" object of the response, and the json of the request that produced it
+        const Json::Value& Data() const;
+        const Json::Value& Request() const;
+
+        bool Has(const char* fieldName) const;
+
+        // The raw json of a single field, or a null value if the response doesn't contain it
+        const Json::Value& GetJson(const char* fieldName) const;
+
+        // Decodes a single field. Returns false (leaving output untouched) if the response doesn't contain it.
+        template <typename FieldType> bool Get(const char* fieldName, FieldType& output) const
+        {
+            const Json::Value* field = Find(fieldName);
+            if (field == nullptr)
+            {
+                return false;
+            }
+            LazyResultDecode(*field, output);
+            return true;
+        }
+
+        bool GetTime(const char* fieldName, time_t& output) const;
+
+        // Used by the API classes to complete a call made with a PlayFabLazyResult callback.
+        // Returns true for a successful call, otherwise reports the error to the global and per-call error handlers (like ValidateResult).
+        static bool ValidateResult(CallRequestContainer& container);
+
+    protected:
+        explicit PlayFabLazyResultBase(CallRequestContainer& container);
+
+        const Json::Value* Find(const char* fieldName) const;
+
+        std::shared_ptr<const Json::Value> data;
+        std::shared_ptr<const Json::Value> request;
+    };
+
+    /// <summary>
+    /// An opt-in, lazily decoded alternative to the result model of an API call.
+    /// Fields are decoded on access with Get, so callbacks that need a few fields of a very large response skip building the full model.
+    /// Materialize decodes everything, producing the same ResType the regular API method would have.
+    /// </summary>
+    template <typename ResType>
+    class PlayFabLazyResult : public PlayFabLazyResultBase
+    {
+    public:
+        explicit PlayFabLazyResult(CallRequestContainer& container) :
+            PlayFabLazyResultBase(container)
+        {
+        }
+
+        ResType Materialize() const
+        {
+            ResType result;
+            result.FromJson(*data);
+            result.Request = *request;
+            return result;
+        }
+    };
+}
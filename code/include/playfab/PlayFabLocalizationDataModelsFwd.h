@@ -0,0 +1,15 @@
+#pragma once
+
+#if !defined(DISABLE_PLAYFABENTITY_API)
+
+namespace PlayFab
+{
+    namespace LocalizationModels
+    {
+        // Forward declarations of the Localization models, for headers which only pass them by reference
+        struct GetLanguageListRequest;
+        struct GetLanguageListResponse;
+    }
+}
+
+#endif
@@ -2,7 +2,12 @@
 
 #if !defined(DISABLE_PLAYFABENTITY_API)
 
+// Opt-in: only forward-declare the models, for files which include the API header but never construct a model
+#if defined(PLAYFAB_API_HEADERS_FWD_MODELS_ONLY)
+#include <playfab/PlayFabLocalizationDataModelsFwd.h>
+#else
 #include <playfab/PlayFabLocalizationDataModels.h>
+#endif
 #include <playfab/PlayFabError.h>
 
 namespace PlayFab
@@ -0,0 +1,27 @@
+#pragma once
+
+#if defined(ENABLE_PLAYFABSERVER_API)
+
+namespace PlayFab
+{
+    namespace MatchmakerModels
+    {
+        // Forward declarations of the Matchmaker models, for headers which only pass them by reference
+        enum class Region;
+
+        struct AuthUserRequest;
+        struct AuthUserResponse;
+        struct ItemInstance;
+        struct PlayerJoinedRequest;
+        struct PlayerJoinedResponse;
+        struct PlayerLeftRequest;
+        struct PlayerLeftResponse;
+        struct StartGameRequest;
+        struct StartGameResponse;
+        struct UserInfoRequest;
+        struct VirtualCurrencyRechargeTime;
+        struct UserInfoResponse;
+    }
+}
+
+#endif
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <playfab/PlayFabPluginManager.h>
+
+namespace PlayFab
+{
+    /// <summary>
+    /// PlayFabMessagePackSerializerPlugin is a compact binary serializer using the MessagePack format (https://msgpack.org).
+    /// Every json value maps to a MessagePack value: objects become maps with string keys, integers use the smallest encoding that fits,
+    /// and reals are always written as float64 so they round-trip exactly.
+    /// Use it for local persistence, caching and IPC of models; PlayFab services only accept json.
+    /// </summary>
+    class PlayFabMessagePackSerializerPlugin : public IPlayFabSerializerPlugin
+    {
+    public:
+        virtual void Serialize(const Json::Value& input, std::string& output) override;
+        virtual bool Deserialize(const char* data, size_t length, Json::Value& output, std::string& errors) override;
+    };
+}
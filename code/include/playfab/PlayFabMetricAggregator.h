@@ -0,0 +1,101 @@
+#pragma once
+
+#ifndef DISABLE_PLAYFABENTITY_API
+
+#include <playfab/PlayFabEventPipeline.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace PlayFab
+{
+    /// <summary>
+    /// The kinds of metrics a PlayFabMetricAggregator folds
+    /// </summary>
+    enum class PlayFabMetricType
+    {
+        Counter, // Updates add up. The summary has their count and sum.
+        Gauge, // Updates set the current value. The summary has the last value, and the count, minimum and maximum of the updates.
+        Histogram // Updates are samples. The summary has their count, sum, minimum, maximum, estimated percentiles, and the counts of buckets.
+    };
+
+    // The dimensions of a metric, as pairs of name and value
+    using PlayFabMetricDimensions = std::vector<std::pair<std::string, std::string>>;
+
+    /// <summary>
+    /// A handle to a metric registered with a PlayFabMetricAggregator
+    /// </summary>
+    struct PlayFabMetricId
+    {
+        size_t index = SIZE_MAX; // The index of the metric in its aggregator, or SIZE_MAX if it was not registered
+        PlayFabMetricType type = PlayFabMetricType::Counter;
+    };
+
+    struct PlayFabMetricState;
+    class PlayFabMetricShard;
+
+    /// <summary>
+    /// Aggregation stage in front of an event pipeline. It takes typed metric updates (counters, gauges and histograms, each keyed
+    /// by a name and dimensions), folds them per thread, and emits one summary event per metric per interval into the pipeline.
+    /// Every thread updating metrics folds them into a shard of its own without taking a lock. A shard has two sides: the thread
+    /// folds into the active one, and a flush makes the other side active and waits for the thread to leave the previous one
+    /// (which is at most one update) before it reads that side.
+    /// Histograms use buckets of a fixed layout, four per power of 2 (about 19% apart), from 2^-10 to 2^30.
+    /// Use the telemetry pipeline of PlayFabEventAPI (see IPlayFabEventRouter::GetPipelines) to send summaries as lightweight events.
+    /// </summary>
+    class PlayFabMetricAggregator
+    {
+    public:
+        // With useBackgroundThread, a thread of the aggregator flushes it every interval. Otherwise FlushIfDue must be called every game tick.
+        PlayFabMetricAggregator(const std::shared_ptr<IPlayFabEventPipeline>& pipeline, std::chrono::milliseconds interval, bool useBackgroundThread = true);
+        ~PlayFabMetricAggregator(); // Flushes the updates left
+
+        PlayFabMetricAggregator(const PlayFabMetricAggregator& source) = delete; // disable copy
+        PlayFabMetricAggregator& operator=(const PlayFabMetricAggregator& source) = delete; // disable assignment
+
+        // Registers a metric, or finds the one registered with the same type, name and dimensions. This takes a lock, so keep the id for updates.
+        PlayFabMetricId GetMetricId(PlayFabMetricType type, const std::string& name, const PlayFabMetricDimensions& dimensions = PlayFabMetricDimensions());
+
+        // Updates a metric: adds the value to a counter, sets a gauge to it, or records it as a sample of a histogram. This method is thread-safe and lock-free.
+        // Ids which were not registered with this aggregator, or name a metric of another type, are ignored.
+        void Update(const PlayFabMetricId& metricId, double value);
+
+        // Flushes the aggregator if the interval has elapsed since the last flush. Only needed without a background thread.
+        void FlushIfDue();
+
+        // Emits the summaries of the metrics updated since the last flush, and starts the next interval
+        void Flush();
+
+    private:
+        struct Metric;
+
+        PlayFabMetricShard& GetShard();
+        void EmitSummary(const Metric& metric, const PlayFabMetricState& state, std::chrono::milliseconds elapsed) const;
+        void WorkerThread();
+
+        const std::shared_ptr<IPlayFabEventPipeline> pipeline;
+        const std::chrono::milliseconds interval;
+        const uint64_t aggregatorId; // Identifies the aggregator in the per-thread shard caches, which outlive it
+
+        std::mutex metricsMutex; // Serializes registering metrics, attaching shards and flushing
+        std::vector<std::unique_ptr<Metric>> metrics; // Guarded by metricsMutex
+        std::atomic<size_t> metricCount; // The size of metrics, for Update to check ids without the lock
+        std::vector<std::shared_ptr<PlayFabMetricShard>> shards; // Shards are never removed, only reattached to another thread once their thread exits. Guarded by metricsMutex.
+        std::chrono::steady_clock::time_point intervalStarted; // Guarded by metricsMutex
+
+        std::thread workerThread;
+        bool isWorkerThreadRunning; // Guarded by workerThreadMutex
+        std::mutex workerThreadMutex;
+        std::condition_variable workerThreadWakeup;
+    };
+}
+
+#endif
@@ -2,6 +2,7 @@
 
 #if !defined(DISABLE_PLAYFABENTITY_API)
 
+#include <playfab/PlayFabMultiplayerDataModelsFwd.h>
 #include <playfab/PlayFabBaseModel.h>
 #include <playfab/PlayFabJsonHeaders.h>
 
@@ -39,267 +40,8 @@ namespace PlayFab
             AzureRegionUaeNorth
         };
 
-        inline void ToJsonEnum(const AzureRegion input, Json::Value& output)
-        {
-            if (input == AzureRegion::AzureRegionAustraliaEast)
-            {
-                output = Json::Value("AustraliaEast");
-                return;
-            }
-            if (input == AzureRegion::AzureRegionAustraliaSoutheast)
-            {
-                output = Json::Value("AustraliaSoutheast");
-                return;
-            }
-            if (input == AzureRegion::AzureRegionBrazilSouth)
-            {
-                output = Json::Value("BrazilSouth");
-                return;
-            }
-            if (input == AzureRegion::AzureRegionCentralUs)
-            {
-                output = Json::Value("CentralUs");
-                return;
-            }
-            if (input == AzureRegion::AzureRegionEastAsia)
-            {
-                output = Json::Value("EastAsia");
-                return;
-            }
-            if (input == AzureRegion::AzureRegionEastUs)
-            {
-                output = Json::Value("EastUs");
-                return;
-            }
-            if (input == AzureRegion::AzureRegionEastUs2)
-            {
-                output = Json::Value("EastUs2");
-                return;
-            }
-            if (input == AzureRegion::AzureRegionJapanEast)
-            {
-                output = Json::Value("JapanEast");
-                return;
-            }
-            if (input == AzureRegion::AzureRegionJapanWest)
-            {
-                output = Json::Value("JapanWest");
-                return;
-            }
-            if (input == AzureRegion::AzureRegionNorthCentralUs)
-            {
-                output = Json::Value("NorthCentralUs");
-                return;
-            }
-            if (input == AzureRegion::AzureRegionNorthEurope)
-            {
-                output = Json::Value("NorthEurope");
-                return;
-            }
-            if (input == AzureRegion::AzureRegionSouthCentralUs)
-            {
-                output = Json::Value("SouthCentralUs");
-                return;
-            }
-            if (input == AzureRegion::AzureRegionSoutheastAsia)
-            {
-                output = Json::Value("SoutheastAsia");
-                return;
-            }
-            if (input == AzureRegion::AzureRegionWestEurope)
-            {
-                output = Json::Value("WestEurope");
-                return;
-            }
-            if (input == AzureRegion::AzureRegionWestUs)
-            {
-                output = Json::Value("WestUs");
-                return;
-            }
-            if (input == AzureRegion::AzureRegionChinaEast2)
-            {
-                output = Json::Value("ChinaEast2");
-                return;
-            }
-            if (input == AzureRegion::AzureRegionChinaNorth2)
-            {
-                output = Json::Value("ChinaNorth2");
-                return;
-            }
-            if (input == AzureRegion::AzureRegionSouthAfricaNorth)
-            {
-                output = Json::Value("SouthAfricaNorth");
-                return;
-            }
-            if (input == AzureRegion::AzureRegionCentralUsEuap)
-            {
-                output = Json::Value("CentralUsEuap");
-                return;
-            }
-            if (input == AzureRegion::AzureRegionWestCentralUs)
-            {
-                output = Json::Value("WestCentralUs");
-                return;
-            }
-            if (input == AzureRegion::AzureRegionKoreaCentral)
-            {
-                output = Json::Value("KoreaCentral");
-                return;
-            }
-            if (input == AzureRegion::AzureRegionFranceCentral)
-            {
-                output = Json::Value("FranceCentral");
-                return;
-            }
-            if (input == AzureRegion::AzureRegionWestUs2)
-            {
-                output = Json::Value("WestUs2");
-                return;
-            }
-            if (input == AzureRegion::AzureRegionCentralIndia)
-            {
-                output = Json::Value("CentralIndia");
-                return;
-            }
-            if (input == AzureRegion::AzureRegionUaeNorth)
-            {
-                output = Json::Value("UaeNorth");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, AzureRegion& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "AustraliaEast")
-            {
-                output = AzureRegion::AzureRegionAustraliaEast;
-                return;
-            }
-            if (inputStr == "AustraliaSoutheast")
-            {
-                output = AzureRegion::AzureRegionAustraliaSoutheast;
-                return;
-            }
-            if (inputStr == "BrazilSouth")
-            {
-                output = AzureRegion::AzureRegionBrazilSouth;
-                return;
-            }
-            if (inputStr == "CentralUs")
-            {
-                output = AzureRegion::AzureRegionCentralUs;
-                return;
-            }
-            if (inputStr == "EastAsia")
-            {
-                output = AzureRegion::AzureRegionEastAsia;
-                return;
-            }
-            if (inputStr == "EastUs")
-            {
-                output = AzureRegion::AzureRegionEastUs;
-                return;
-            }
-            if (inputStr == "EastUs2")
-            {
-                output = AzureRegion::AzureRegionEastUs2;
-                return;
-            }
-            if (inputStr == "JapanEast")
-            {
-                output = AzureRegion::AzureRegionJapanEast;
-                return;
-            }
-            if (inputStr == "JapanWest")
-            {
-                output = AzureRegion::AzureRegionJapanWest;
-                return;
-            }
-            if (inputStr == "NorthCentralUs")
-            {
-                output = AzureRegion::AzureRegionNorthCentralUs;
-                return;
-            }
-            if (inputStr == "NorthEurope")
-            {
-                output = AzureRegion::AzureRegionNorthEurope;
-                return;
-            }
-            if (inputStr == "SouthCentralUs")
-            {
-                output = AzureRegion::AzureRegionSouthCentralUs;
-                return;
-            }
-            if (inputStr == "SoutheastAsia")
-            {
-                output = AzureRegion::AzureRegionSoutheastAsia;
-                return;
-            }
-            if (inputStr == "WestEurope")
-            {
-                output = AzureRegion::AzureRegionWestEurope;
-                return;
-            }
-            if (inputStr == "WestUs")
-            {
-                output = AzureRegion::AzureRegionWestUs;
-                return;
-            }
-            if (inputStr == "ChinaEast2")
-            {
-                output = AzureRegion::AzureRegionChinaEast2;
-                return;
-            }
-            if (inputStr == "ChinaNorth2")
-            {
-                output = AzureRegion::AzureRegionChinaNorth2;
-                return;
-            }
-            if (inputStr == "SouthAfricaNorth")
-            {
-                output = AzureRegion::AzureRegionSouthAfricaNorth;
-                return;
-            }
-            if (inputStr == "CentralUsEuap")
-            {
-                output = AzureRegion::AzureRegionCentralUsEuap;
-                return;
-            }
-            if (inputStr == "WestCentralUs")
-            {
-                output = AzureRegion::AzureRegionWestCentralUs;
-                return;
-            }
-            if (inputStr == "KoreaCentral")
-            {
-                output = AzureRegion::AzureRegionKoreaCentral;
-                return;
-            }
-            if (inputStr == "FranceCentral")
-            {
-                output = AzureRegion::AzureRegionFranceCentral;
-                return;
-            }
-            if (inputStr == "WestUs2")
-            {
-                output = AzureRegion::AzureRegionWestUs2;
-                return;
-            }
-            if (inputStr == "CentralIndia")
-            {
-                output = AzureRegion::AzureRegionCentralIndia;
-                return;
-            }
-            if (inputStr == "UaeNorth")
-            {
-                output = AzureRegion::AzureRegionUaeNorth;
-                return;
-            }
-        }
+        void ToJsonEnum(const AzureRegion input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, AzureRegion& output);
 
         enum class AzureVmFamily
         {
@@ -319,157 +61,8 @@ namespace PlayFab
             AzureVmFamilyDsv2
         };
 
-        inline void ToJsonEnum(const AzureVmFamily input, Json::Value& output)
-        {
-            if (input == AzureVmFamily::AzureVmFamilyA)
-            {
-                output = Json::Value("A");
-                return;
-            }
-            if (input == AzureVmFamily::AzureVmFamilyAv2)
-            {
-                output = Json::Value("Av2");
-                return;
-            }
-            if (input == AzureVmFamily::AzureVmFamilyDv2)
-            {
-                output = Json::Value("Dv2");
-                return;
-            }
-            if (input == AzureVmFamily::AzureVmFamilyDv3)
-            {
-                output = Json::Value("Dv3");
-                return;
-            }
-            if (input == AzureVmFamily::AzureVmFamilyF)
-            {
-                output = Json::Value("F");
-                return;
-            }
-            if (input == AzureVmFamily::AzureVmFamilyFsv2)
-            {
-                output = Json::Value("Fsv2");
-                return;
-            }
-            if (input == AzureVmFamily::AzureVmFamilyDasv4)
-            {
-                output = Json::Value("Dasv4");
-                return;
-            }
-            if (input == AzureVmFamily::AzureVmFamilyDav4)
-            {
-                output = Json::Value("Dav4");
-                return;
-            }
-            if (input == AzureVmFamily::AzureVmFamilyEav4)
-            {
-                output = Json::Value("Eav4");
-                return;
-            }
-            if (input == AzureVmFamily::AzureVmFamilyEasv4)
-            {
-                output = Json::Value("Easv4");
-                return;
-            }
-            if (input == AzureVmFamily::AzureVmFamilyEv4)
-            {
-                output = Json::Value("Ev4");
-                return;
-            }
-            if (input == AzureVmFamily::AzureVmFamilyEsv4)
-            {
-                output = Json::Value("Esv4");
-                return;
-            }
-            if (input == AzureVmFamily::AzureVmFamilyDsv3)
-            {
-                output = Json::Value("Dsv3");
-                return;
-            }
-            if (input == AzureVmFamily::AzureVmFamilyDsv2)
-            {
-                output = Json::Value("Dsv2");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, AzureVmFamily& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "A")
-            {
-                output = AzureVmFamily::AzureVmFamilyA;
-                return;
-            }
-            if (inputStr == "Av2")
-            {
-                output = AzureVmFamily::AzureVmFamilyAv2;
-                return;
-            }
-            if (inputStr == "Dv2")
-            {
-                output = AzureVmFamily::AzureVmFamilyDv2;
-                return;
-            }
-            if (inputStr == "Dv3")
-            {
-                output = AzureVmFamily::AzureVmFamilyDv3;
-                return;
-            }
-            if (inputStr == "F")
-            {
-                output = AzureVmFamily::AzureVmFamilyF;
-                return;
-            }
-            if (inputStr == "Fsv2")
-            {
-                output = AzureVmFamily::AzureVmFamilyFsv2;
-                return;
-            }
-            if (inputStr == "Dasv4")
-            {
-                output = AzureVmFamily::AzureVmFamilyDasv4;
-                return;
-            }
-            if (inputStr == "Dav4")
-            {
-                output = AzureVmFamily::AzureVmFamilyDav4;
-                return;
-            }
-            if (inputStr == "Eav4")
-            {
-                output = AzureVmFamily::AzureVmFamilyEav4;
-                return;
-            }
-            if (inputStr == "Easv4")
-            {
-                output = AzureVmFamily::AzureVmFamilyEasv4;
-                return;
-            }
-            if (inputStr == "Ev4")
-            {
-                output = AzureVmFamily::AzureVmFamilyEv4;
-                return;
-            }
-            if (inputStr == "Esv4")
-            {
-                output = AzureVmFamily::AzureVmFamilyEsv4;
-                return;
-            }
-            if (inputStr == "Dsv3")
-            {
-                output = AzureVmFamily::AzureVmFamilyDsv3;
-                return;
-            }
-            if (inputStr == "Dsv2")
-            {
-                output = AzureVmFamily::AzureVmFamilyDsv2;
-                return;
-            }
-        }
+        void ToJsonEnum(const AzureVmFamily input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, AzureVmFamily& output);
 
         enum class AzureVmSize
         {
@@ -526,527 +119,8 @@ namespace PlayFab
             AzureVmSizeStandard_DS5_v2
         };
 
-        inline void ToJsonEnum(const AzureVmSize input, Json::Value& output)
-        {
-            if (input == AzureVmSize::AzureVmSizeStandard_A1)
-            {
-                output = Json::Value("Standard_A1");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_A2)
-            {
-                output = Json::Value("Standard_A2");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_A3)
-            {
-                output = Json::Value("Standard_A3");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_A4)
-            {
-                output = Json::Value("Standard_A4");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_A1_v2)
-            {
-                output = Json::Value("Standard_A1_v2");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_A2_v2)
-            {
-                output = Json::Value("Standard_A2_v2");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_A4_v2)
-            {
-                output = Json::Value("Standard_A4_v2");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_A8_v2)
-            {
-                output = Json::Value("Standard_A8_v2");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_D1_v2)
-            {
-                output = Json::Value("Standard_D1_v2");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_D2_v2)
-            {
-                output = Json::Value("Standard_D2_v2");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_D3_v2)
-            {
-                output = Json::Value("Standard_D3_v2");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_D4_v2)
-            {
-                output = Json::Value("Standard_D4_v2");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_D5_v2)
-            {
-                output = Json::Value("Standard_D5_v2");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_D2_v3)
-            {
-                output = Json::Value("Standard_D2_v3");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_D4_v3)
-            {
-                output = Json::Value("Standard_D4_v3");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_D8_v3)
-            {
-                output = Json::Value("Standard_D8_v3");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_D16_v3)
-            {
-                output = Json::Value("Standard_D16_v3");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_F1)
-            {
-                output = Json::Value("Standard_F1");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_F2)
-            {
-                output = Json::Value("Standard_F2");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_F4)
-            {
-                output = Json::Value("Standard_F4");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_F8)
-            {
-                output = Json::Value("Standard_F8");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_F16)
-            {
-                output = Json::Value("Standard_F16");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_F2s_v2)
-            {
-                output = Json::Value("Standard_F2s_v2");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_F4s_v2)
-            {
-                output = Json::Value("Standard_F4s_v2");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_F8s_v2)
-            {
-                output = Json::Value("Standard_F8s_v2");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_F16s_v2)
-            {
-                output = Json::Value("Standard_F16s_v2");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_D2as_v4)
-            {
-                output = Json::Value("Standard_D2as_v4");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_D4as_v4)
-            {
-                output = Json::Value("Standard_D4as_v4");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_D8as_v4)
-            {
-                output = Json::Value("Standard_D8as_v4");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_D16as_v4)
-            {
-                output = Json::Value("Standard_D16as_v4");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_D2a_v4)
-            {
-                output = Json::Value("Standard_D2a_v4");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_D4a_v4)
-            {
-                output = Json::Value("Standard_D4a_v4");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_D8a_v4)
-            {
-                output = Json::Value("Standard_D8a_v4");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_D16a_v4)
-            {
-                output = Json::Value("Standard_D16a_v4");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_E2a_v4)
-            {
-                output = Json::Value("Standard_E2a_v4");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_E4a_v4)
-            {
-                output = Json::Value("Standard_E4a_v4");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_E8a_v4)
-            {
-                output = Json::Value("Standard_E8a_v4");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_E16a_v4)
-            {
-                output = Json::Value("Standard_E16a_v4");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_E2as_v4)
-            {
-                output = Json::Value("Standard_E2as_v4");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_E4as_v4)
-            {
-                output = Json::Value("Standard_E4as_v4");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_E8as_v4)
-            {
-                output = Json::Value("Standard_E8as_v4");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_E16as_v4)
-            {
-                output = Json::Value("Standard_E16as_v4");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_D2s_v3)
-            {
-                output = Json::Value("Standard_D2s_v3");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_D4s_v3)
-            {
-                output = Json::Value("Standard_D4s_v3");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_D8s_v3)
-            {
-                output = Json::Value("Standard_D8s_v3");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_D16s_v3)
-            {
-                output = Json::Value("Standard_D16s_v3");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_DS1_v2)
-            {
-                output = Json::Value("Standard_DS1_v2");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_DS2_v2)
-            {
-                output = Json::Value("Standard_DS2_v2");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_DS3_v2)
-            {
-                output = Json::Value("Standard_DS3_v2");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_DS4_v2)
-            {
-                output = Json::Value("Standard_DS4_v2");
-                return;
-            }
-            if (input == AzureVmSize::AzureVmSizeStandard_DS5_v2)
-            {
-                output = Json::Value("Standard_DS5_v2");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, AzureVmSize& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "Standard_A1")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_A1;
-                return;
-            }
-            if (inputStr == "Standard_A2")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_A2;
-                return;
-            }
-            if (inputStr == "Standard_A3")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_A3;
-                return;
-            }
-            if (inputStr == "Standard_A4")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_A4;
-                return;
-            }
-            if (inputStr == "Standard_A1_v2")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_A1_v2;
-                return;
-            }
-            if (inputStr == "Standard_A2_v2")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_A2_v2;
-                return;
-            }
-            if (inputStr == "Standard_A4_v2")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_A4_v2;
-                return;
-            }
-            if (inputStr == "Standard_A8_v2")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_A8_v2;
-                return;
-            }
-            if (inputStr == "Standard_D1_v2")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_D1_v2;
-                return;
-            }
-            if (inputStr == "Standard_D2_v2")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_D2_v2;
-                return;
-            }
-            if (inputStr == "Standard_D3_v2")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_D3_v2;
-                return;
-            }
-            if (inputStr == "Standard_D4_v2")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_D4_v2;
-                return;
-            }
-            if (inputStr == "Standard_D5_v2")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_D5_v2;
-                return;
-            }
-            if (inputStr == "Standard_D2_v3")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_D2_v3;
-                return;
-            }
-            if (inputStr == "Standard_D4_v3")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_D4_v3;
-                return;
-            }
-            if (inputStr == "Standard_D8_v3")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_D8_v3;
-                return;
-            }
-            if (inputStr == "Standard_D16_v3")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_D16_v3;
-                return;
-            }
-            if (inputStr == "Standard_F1")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_F1;
-                return;
-            }
-            if (inputStr == "Standard_F2")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_F2;
-                return;
-            }
-            if (inputStr == "Standard_F4")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_F4;
-                return;
-            }
-            if (inputStr == "Standard_F8")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_F8;
-                return;
-            }
-            if (inputStr == "Standard_F16")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_F16;
-                return;
-            }
-            if (inputStr == "Standard_F2s_v2")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_F2s_v2;
-                return;
-            }
-            if (inputStr == "Standard_F4s_v2")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_F4s_v2;
-                return;
-            }
-            if (inputStr == "Standard_F8s_v2")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_F8s_v2;
-                return;
-            }
-            if (inputStr == "Standard_F16s_v2")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_F16s_v2;
-                return;
-            }
-            if (inputStr == "Standard_D2as_v4")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_D2as_v4;
-                return;
-            }
-            if (inputStr == "Standard_D4as_v4")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_D4as_v4;
-                return;
-            }
-            if (inputStr == "Standard_D8as_v4")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_D8as_v4;
-                return;
-            }
-            if (inputStr == "Standard_D16as_v4")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_D16as_v4;
-                return;
-            }
-            if (inputStr == "Standard_D2a_v4")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_D2a_v4;
-                return;
-            }
-            if (inputStr == "Standard_D4a_v4")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_D4a_v4;
-                return;
-            }
-            if (inputStr == "Standard_D8a_v4")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_D8a_v4;
-                return;
-            }
-            if (inputStr == "Standard_D16a_v4")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_D16a_v4;
-                return;
-            }
-            if (inputStr == "Standard_E2a_v4")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_E2a_v4;
-                return;
-            }
-            if (inputStr == "Standard_E4a_v4")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_E4a_v4;
-                return;
-            }
-            if (inputStr == "Standard_E8a_v4")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_E8a_v4;
-                return;
-            }
-            if (inputStr == "Standard_E16a_v4")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_E16a_v4;
-                return;
-            }
-            if (inputStr == "Standard_E2as_v4")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_E2as_v4;
-                return;
-            }
-            if (inputStr == "Standard_E4as_v4")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_E4as_v4;
-                return;
-            }
-            if (inputStr == "Standard_E8as_v4")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_E8as_v4;
-                return;
-            }
-            if (inputStr == "Standard_E16as_v4")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_E16as_v4;
-                return;
-            }
-            if (inputStr == "Standard_D2s_v3")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_D2s_v3;
-                return;
-            }
-            if (inputStr == "Standard_D4s_v3")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_D4s_v3;
-                return;
-            }
-            if (inputStr == "Standard_D8s_v3")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_D8s_v3;
-                return;
-            }
-            if (inputStr == "Standard_D16s_v3")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_D16s_v3;
-                return;
-            }
-            if (inputStr == "Standard_DS1_v2")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_DS1_v2;
-                return;
-            }
-            if (inputStr == "Standard_DS2_v2")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_DS2_v2;
-                return;
-            }
-            if (inputStr == "Standard_DS3_v2")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_DS3_v2;
-                return;
-            }
-            if (inputStr == "Standard_DS4_v2")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_DS4_v2;
-                return;
-            }
-            if (inputStr == "Standard_DS5_v2")
-            {
-                output = AzureVmSize::AzureVmSizeStandard_DS5_v2;
-                return;
-            }
-        }
+        void ToJsonEnum(const AzureVmSize input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, AzureVmSize& output);
 
         enum class CancellationReason
         {
@@ -1055,47 +129,8 @@ namespace PlayFab
             CancellationReasonTimeout
         };
 
-        inline void ToJsonEnum(const CancellationReason input, Json::Value& output)
-        {
-            if (input == CancellationReason::CancellationReasonRequested)
-            {
-                output = Json::Value("Requested");
-                return;
-            }
-            if (input == CancellationReason::CancellationReasonInternal)
-            {
-                output = Json::Value("Internal");
-                return;
-            }
-            if (input == CancellationReason::CancellationReasonTimeout)
-            {
-                output = Json::Value("Timeout");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, CancellationReason& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "Requested")
-            {
-                output = CancellationReason::CancellationReasonRequested;
-                return;
-            }
-            if (inputStr == "Internal")
-            {
-                output = CancellationReason::CancellationReasonInternal;
-                return;
-            }
-            if (inputStr == "Timeout")
-            {
-                output = CancellationReason::CancellationReasonTimeout;
-                return;
-            }
-        }
+        void ToJsonEnum(const CancellationReason input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, CancellationReason& output);
 
         enum class ContainerFlavor
         {
@@ -1105,57 +140,8 @@ namespace PlayFab
             ContainerFlavorInvalid
         };
 
-        inline void ToJsonEnum(const ContainerFlavor input, Json::Value& output)
-        {
-            if (input == ContainerFlavor::ContainerFlavorManagedWindowsServerCore)
-            {
-                output = Json::Value("ManagedWindowsServerCore");
-                return;
-            }
-            if (input == ContainerFlavor::ContainerFlavorCustomLinux)
-            {
-                output = Json::Value("CustomLinux");
-                return;
-            }
-            if (input == ContainerFlavor::ContainerFlavorManagedWindowsServerCorePreview)
-            {
-                output = Json::Value("ManagedWindowsServerCorePreview");
-                return;
-            }
-            if (input == ContainerFlavor::ContainerFlavorInvalid)
-            {
-                output = Json::Value("Invalid");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, ContainerFlavor& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "ManagedWindowsServerCore")
-            {
-                output = ContainerFlavor::ContainerFlavorManagedWindowsServerCore;
-                return;
-            }
-            if (inputStr == "CustomLinux")
-            {
-                output = ContainerFlavor::ContainerFlavorCustomLinux;
-                return;
-            }
-            if (inputStr == "ManagedWindowsServerCorePreview")
-            {
-                output = ContainerFlavor::ContainerFlavorManagedWindowsServerCorePreview;
-                return;
-            }
-            if (inputStr == "Invalid")
-            {
-                output = ContainerFlavor::ContainerFlavorInvalid;
-                return;
-            }
-        }
+        void ToJsonEnum(const ContainerFlavor input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, ContainerFlavor& output);
 
         enum class OsPlatform
         {
@@ -1163,37 +149,8 @@ namespace PlayFab
             OsPlatformLinux
         };
 
-        inline void ToJsonEnum(const OsPlatform input, Json::Value& output)
-        {
-            if (input == OsPlatform::OsPlatformWindows)
-            {
-                output = Json::Value("Windows");
-                return;
-            }
-            if (input == OsPlatform::OsPlatformLinux)
-            {
-                output = Json::Value("Linux");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, OsPlatform& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "Windows")
-            {
-                output = OsPlatform::OsPlatformWindows;
-                return;
-            }
-            if (inputStr == "Linux")
-            {
-                output = OsPlatform::OsPlatformLinux;
-                return;
-            }
-        }
+        void ToJsonEnum(const OsPlatform input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, OsPlatform& output);
 
         enum class ProtocolType
         {
@@ -1201,37 +158,8 @@ namespace PlayFab
             ProtocolTypeUDP
         };
 
-        inline void ToJsonEnum(const ProtocolType input, Json::Value& output)
-        {
-            if (input == ProtocolType::ProtocolTypeTCP)
-            {
-                output = Json::Value("TCP");
-                return;
-            }
-            if (input == ProtocolType::ProtocolTypeUDP)
-            {
-                output = Json::Value("UDP");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, ProtocolType& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "TCP")
-            {
-                output = ProtocolType::ProtocolTypeTCP;
-                return;
-            }
-            if (inputStr == "UDP")
-            {
-                output = ProtocolType::ProtocolTypeUDP;
-                return;
-            }
-        }
+        void ToJsonEnum(const ProtocolType input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, ProtocolType& output);
 
         enum class ServerType
         {
@@ -1239,37 +167,8 @@ namespace PlayFab
             ServerTypeProcess
         };
 
-        inline void ToJsonEnum(const ServerType input, Json::Value& output)
-        {
-            if (input == ServerType::ServerTypeContainer)
-            {
-                output = Json::Value("Container");
-                return;
-            }
-            if (input == ServerType::ServerTypeProcess)
-            {
-                output = Json::Value("Process");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, ServerType& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "Container")
-            {
-                output = ServerType::ServerTypeContainer;
-                return;
-            }
-            if (inputStr == "Process")
-            {
-                output = ServerType::ServerTypeProcess;
-                return;
-            }
-        }
+        void ToJsonEnum(const ServerType input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, ServerType& output);
 
         enum class TitleMultiplayerServerEnabledStatus
         {
@@ -1278,47 +177,8 @@ namespace PlayFab
             TitleMultiplayerServerEnabledStatusDisabled
         };
 
-        inline void ToJsonEnum(const TitleMultiplayerServerEnabledStatus input, Json::Value& output)
-        {
-            if (input == TitleMultiplayerServerEnabledStatus::TitleMultiplayerServerEnabledStatusInitializing)
-            {
-                output = Json::Value("Initializing");
-                return;
-            }
-            if (input == TitleMultiplayerServerEnabledStatus::TitleMultiplayerServerEnabledStatusEnabled)
-            {
-                output = Json::Value("Enabled");
-                return;
-            }
-            if (input == TitleMultiplayerServerEnabledStatus::TitleMultiplayerServerEnabledStatusDisabled)
-            {
-                output = Json::Value("Disabled");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, TitleMultiplayerServerEnabledStatus& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "Initializing")
-            {
-                output = TitleMultiplayerServerEnabledStatus::TitleMultiplayerServerEnabledStatusInitializing;
-                return;
-            }
-            if (inputStr == "Enabled")
-            {
-                output = TitleMultiplayerServerEnabledStatus::TitleMultiplayerServerEnabledStatusEnabled;
-                return;
-            }
-            if (inputStr == "Disabled")
-            {
-                output = TitleMultiplayerServerEnabledStatus::TitleMultiplayerServerEnabledStatusDisabled;
-                return;
-            }
-        }
+        void ToJsonEnum(const TitleMultiplayerServerEnabledStatus input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, TitleMultiplayerServerEnabledStatus& output);
 
         // Multiplayer Classes
         struct AssetReference : public PlayFabBaseModel
@@ -1340,19 +200,9 @@ namespace PlayFab
 
             ~AssetReference() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["FileName"], FileName);
-                FromJsonUtilS(input["MountPath"], MountPath);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_FileName; ToJsonUtilS(FileName, each_FileName); output["FileName"] = each_FileName;
-                Json::Value each_MountPath; ToJsonUtilS(MountPath, each_MountPath); output["MountPath"] = each_MountPath;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct AssetReferenceParams : public PlayFabBaseModel
@@ -1374,19 +224,9 @@ namespace PlayFab
 
             ~AssetReferenceParams() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["FileName"], FileName);
-                FromJsonUtilS(input["MountPath"], MountPath);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_FileName; ToJsonUtilS(FileName, each_FileName); output["FileName"] = each_FileName;
-                Json::Value each_MountPath; ToJsonUtilS(MountPath, each_MountPath); output["MountPath"] = each_MountPath;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct AssetSummary : public PlayFabBaseModel
@@ -1408,19 +248,9 @@ namespace PlayFab
 
             ~AssetSummary() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["FileName"], FileName);
-                FromJsonUtilS(input["Metadata"], Metadata);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_FileName; ToJsonUtilS(FileName, each_FileName); output["FileName"] = each_FileName;
-                Json::Value each_Metadata; ToJsonUtilS(Metadata, each_Metadata); output["Metadata"] = each_Metadata;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct BuildSelectionCriterion : public PlayFabBaseModel
@@ -1439,17 +269,9 @@ namespace PlayFab
 
             ~BuildSelectionCriterion() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["BuildWeightDistribution"], BuildWeightDistribution);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_BuildWeightDistribution; ToJsonUtilP(BuildWeightDistribution, each_BuildWeightDistribution); output["BuildWeightDistribution"] = each_BuildWeightDistribution;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct BuildAliasDetailsResponse : public PlayFabResultCommon
@@ -1480,25 +302,9 @@ namespace PlayFab
 
             ~BuildAliasDetailsResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["AliasId"], AliasId);
-                FromJsonUtilS(input["AliasName"], AliasName);
-                FromJsonUtilO(input["BuildSelectionCriteria"], BuildSelectionCriteria);
-                FromJsonUtilP(input["PageSize"], PageSize);
-                FromJsonUtilS(input["SkipToken"], SkipToken);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AliasId; ToJsonUtilS(AliasId, each_AliasId); output["AliasId"] = each_AliasId;
-                Json::Value each_AliasName; ToJsonUtilS(AliasName, each_AliasName); output["AliasName"] = each_AliasName;
-                Json::Value each_BuildSelectionCriteria; ToJsonUtilO(BuildSelectionCriteria, each_BuildSelectionCriteria); output["BuildSelectionCriteria"] = each_BuildSelectionCriteria;
-                Json::Value each_PageSize; ToJsonUtilP(PageSize, each_PageSize); output["PageSize"] = each_PageSize;
-                Json::Value each_SkipToken; ToJsonUtilS(SkipToken, each_SkipToken); output["SkipToken"] = each_SkipToken;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct BuildAliasParams : public PlayFabBaseModel
@@ -1517,17 +323,9 @@ namespace PlayFab
 
             ~BuildAliasParams() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["AliasId"], AliasId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AliasId; ToJsonUtilS(AliasId, each_AliasId); output["AliasId"] = each_AliasId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct CurrentServerStats : public PlayFabBaseModel
@@ -1555,23 +353,9 @@ namespace PlayFab
 
             ~CurrentServerStats() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["Active"], Active);
-                FromJsonUtilP(input["Propping"], Propping);
-                FromJsonUtilP(input["StandingBy"], StandingBy);
-                FromJsonUtilP(input["Total"], Total);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Active; ToJsonUtilP(Active, each_Active); output["Active"] = each_Active;
-                Json::Value each_Propping; ToJsonUtilP(Propping, each_Propping); output["Propping"] = each_Propping;
-                Json::Value each_StandingBy; ToJsonUtilP(StandingBy, each_StandingBy); output["StandingBy"] = each_StandingBy;
-                Json::Value each_Total; ToJsonUtilP(Total, each_Total); output["Total"] = each_Total;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct DynamicStandbyThreshold : public PlayFabBaseModel
@@ -1593,19 +377,9 @@ namespace PlayFab
 
             ~DynamicStandbyThreshold() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["Multiplier"], Multiplier);
-                FromJsonUtilP(input["TriggerThresholdPercentage"], TriggerThresholdPercentage);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Multiplier; ToJsonUtilP(Multiplier, each_Multiplier); output["Multiplier"] = each_Multiplier;
-                Json::Value each_TriggerThresholdPercentage; ToJsonUtilP(TriggerThresholdPercentage, each_TriggerThresholdPercentage); output["TriggerThresholdPercentage"] = each_TriggerThresholdPercentage;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct DynamicStandbySettings : public PlayFabBaseModel
@@ -1630,21 +404,9 @@ namespace PlayFab
 
             ~DynamicStandbySettings() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["DynamicFloorMultiplierThresholds"], DynamicFloorMultiplierThresholds);
-                FromJsonUtilP(input["IsEnabled"], IsEnabled);
-                FromJsonUtilP(input["RampDownSeconds"], RampDownSeconds);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_DynamicFloorMultiplierThresholds; ToJsonUtilO(DynamicFloorMultiplierThresholds, each_DynamicFloorMultiplierThresholds); output["DynamicFloorMultiplierThresholds"] = each_DynamicFloorMultiplierThresholds;
-                Json::Value each_IsEnabled; ToJsonUtilP(IsEnabled, each_IsEnabled); output["IsEnabled"] = each_IsEnabled;
-                Json::Value each_RampDownSeconds; ToJsonUtilP(RampDownSeconds, each_RampDownSeconds); output["RampDownSeconds"] = each_RampDownSeconds;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct Schedule : public PlayFabBaseModel
@@ -1678,27 +440,9 @@ namespace PlayFab
 
             ~Schedule() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Description"], Description);
-                FromJsonUtilT(input["EndTime"], EndTime);
-                FromJsonUtilP(input["IsDisabled"], IsDisabled);
-                FromJsonUtilP(input["IsRecurringWeekly"], IsRecurringWeekly);
-                FromJsonUtilT(input["StartTime"], StartTime);
-                FromJsonUtilP(input["TargetStandby"], TargetStandby);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Description; ToJsonUtilS(Description, each_Description); output["Description"] = each_Description;
-                Json::Value each_EndTime; ToJsonUtilT(EndTime, each_EndTime); output["EndTime"] = each_EndTime;
-                Json::Value each_IsDisabled; ToJsonUtilP(IsDisabled, each_IsDisabled); output["IsDisabled"] = each_IsDisabled;
-                Json::Value each_IsRecurringWeekly; ToJsonUtilP(IsRecurringWeekly, each_IsRecurringWeekly); output["IsRecurringWeekly"] = each_IsRecurringWeekly;
-                Json::Value each_StartTime; ToJsonUtilT(StartTime, each_StartTime); output["StartTime"] = each_StartTime;
-                Json::Value each_TargetStandby; ToJsonUtilP(TargetStandby, each_TargetStandby); output["TargetStandby"] = each_TargetStandby;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct ScheduledStandbySettings : public PlayFabBaseModel
@@ -1720,19 +464,9 @@ namespace PlayFab
 
             ~ScheduledStandbySettings() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["IsEnabled"], IsEnabled);
-                FromJsonUtilO(input["ScheduleList"], ScheduleList);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_IsEnabled; ToJsonUtilP(IsEnabled, each_IsEnabled); output["IsEnabled"] = each_IsEnabled;
-                Json::Value each_ScheduleList; ToJsonUtilO(ScheduleList, each_ScheduleList); output["ScheduleList"] = each_ScheduleList;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct BuildRegion : public PlayFabBaseModel
@@ -1769,29 +503,9 @@ namespace PlayFab
 
             ~BuildRegion() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["CurrentServerStats"], pfCurrentServerStats);
-                FromJsonUtilO(input["DynamicStandbySettings"], pfDynamicStandbySettings);
-                FromJsonUtilP(input["MaxServers"], MaxServers);
-                FromJsonUtilS(input["Region"], Region);
-                FromJsonUtilO(input["ScheduledStandbySettings"], pfScheduledStandbySettings);
-                FromJsonUtilP(input["StandbyServers"], StandbyServers);
-                FromJsonUtilS(input["Status"], Status);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_pfCurrentServerStats; ToJsonUtilO(pfCurrentServerStats, each_pfCurrentServerStats); output["CurrentServerStats"] = each_pfCurrentServerStats;
-                Json::Value each_pfDynamicStandbySettings; ToJsonUtilO(pfDynamicStandbySettings, each_pfDynamicStandbySettings); output["DynamicStandbySettings"] = each_pfDynamicStandbySettings;
-                Json::Value each_MaxServers; ToJsonUtilP(MaxServers, each_MaxServers); output["MaxServers"] = each_MaxServers;
-                Json::Value each_Region; ToJsonUtilS(Region, each_Region); output["Region"] = each_Region;
-                Json::Value each_pfScheduledStandbySettings; ToJsonUtilO(pfScheduledStandbySettings, each_pfScheduledStandbySettings); output["ScheduledStandbySettings"] = each_pfScheduledStandbySettings;
-                Json::Value each_StandbyServers; ToJsonUtilP(StandbyServers, each_StandbyServers); output["StandbyServers"] = each_StandbyServers;
-                Json::Value each_Status; ToJsonUtilS(Status, each_Status); output["Status"] = each_Status;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct BuildRegionParams : public PlayFabBaseModel
@@ -1822,25 +536,9 @@ namespace PlayFab
 
             ~BuildRegionParams() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["DynamicStandbySettings"], pfDynamicStandbySettings);
-                FromJsonUtilP(input["MaxServers"], MaxServers);
-                FromJsonUtilS(input["Region"], Region);
-                FromJsonUtilO(input["ScheduledStandbySettings"], pfScheduledStandbySettings);
-                FromJsonUtilP(input["StandbyServers"], StandbyServers);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_pfDynamicStandbySettings; ToJsonUtilO(pfDynamicStandbySettings, each_pfDynamicStandbySettings); output["DynamicStandbySettings"] = each_pfDynamicStandbySettings;
-                Json::Value each_MaxServers; ToJsonUtilP(MaxServers, each_MaxServers); output["MaxServers"] = each_MaxServers;
-                Json::Value each_Region; ToJsonUtilS(Region, each_Region); output["Region"] = each_Region;
-                Json::Value each_pfScheduledStandbySettings; ToJsonUtilO(pfScheduledStandbySettings, each_pfScheduledStandbySettings); output["ScheduledStandbySettings"] = each_pfScheduledStandbySettings;
-                Json::Value each_StandbyServers; ToJsonUtilP(StandbyServers, each_StandbyServers); output["StandbyServers"] = each_StandbyServers;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct BuildSummary : public PlayFabBaseModel
@@ -1871,25 +569,9 @@ namespace PlayFab
 
             ~BuildSummary() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["BuildId"], BuildId);
-                FromJsonUtilS(input["BuildName"], BuildName);
-                FromJsonUtilT(input["CreationTime"], CreationTime);
-                FromJsonUtilS(input["Metadata"], Metadata);
-                FromJsonUtilO(input["RegionConfigurations"], RegionConfigurations);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); output["BuildId"] = each_BuildId;
-                Json::Value each_BuildName; ToJsonUtilS(BuildName, each_BuildName); output["BuildName"] = each_BuildName;
-                Json::Value each_CreationTime; ToJsonUtilT(CreationTime, each_CreationTime); output["CreationTime"] = each_CreationTime;
-                Json::Value each_Metadata; ToJsonUtilS(Metadata, each_Metadata); output["Metadata"] = each_Metadata;
-                Json::Value each_RegionConfigurations; ToJsonUtilO(RegionConfigurations, each_RegionConfigurations); output["RegionConfigurations"] = each_RegionConfigurations;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct EntityKey : public PlayFabBaseModel
@@ -1911,19 +593,9 @@ namespace PlayFab
 
             ~EntityKey() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Id"], Id);
-                FromJsonUtilS(input["Type"], Type);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Id; ToJsonUtilS(Id, each_Id); output["Id"] = each_Id;
-                Json::Value each_Type; ToJsonUtilS(Type, each_Type); output["Type"] = each_Type;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct CancelAllMatchmakingTicketsForPlayerRequest : public PlayFabRequestCommon
@@ -1948,21 +620,9 @@ namespace PlayFab
 
             ~CancelAllMatchmakingTicketsForPlayerRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilS(input["QueueName"], QueueName);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); output["QueueName"] = each_QueueName;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct CancelAllMatchmakingTicketsForPlayerResult : public PlayFabResultCommon
@@ -1978,15 +638,9 @@ namespace PlayFab
 
             ~CancelAllMatchmakingTicketsForPlayerResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct CancelAllServerBackfillTicketsForPlayerRequest : public PlayFabRequestCommon
@@ -2011,21 +665,9 @@ namespace PlayFab
 
             ~CancelAllServerBackfillTicketsForPlayerRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilS(input["QueueName"], QueueName);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); output["QueueName"] = each_QueueName;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct CancelAllServerBackfillTicketsForPlayerResult : public PlayFabResultCommon
@@ -2041,15 +683,9 @@ namespace PlayFab
 
             ~CancelAllServerBackfillTicketsForPlayerResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct CancelMatchmakingTicketRequest : public PlayFabRequestCommon
@@ -2074,21 +710,9 @@ namespace PlayFab
 
             ~CancelMatchmakingTicketRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["QueueName"], QueueName);
-                FromJsonUtilS(input["TicketId"], TicketId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); output["QueueName"] = each_QueueName;
-                Json::Value each_TicketId; ToJsonUtilS(TicketId, each_TicketId); output["TicketId"] = each_TicketId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct CancelMatchmakingTicketResult : public PlayFabResultCommon
@@ -2104,15 +728,9 @@ namespace PlayFab
 
             ~CancelMatchmakingTicketResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct CancelServerBackfillTicketRequest : public PlayFabRequestCommon
@@ -2137,21 +755,9 @@ namespace PlayFab
 
             ~CancelServerBackfillTicketRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["QueueName"], QueueName);
-                FromJsonUtilS(input["TicketId"], TicketId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); output["QueueName"] = each_QueueName;
-                Json::Value each_TicketId; ToJsonUtilS(TicketId, each_TicketId); output["TicketId"] = each_TicketId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct CancelServerBackfillTicketResult : public PlayFabResultCommon
@@ -2167,15 +773,9 @@ namespace PlayFab
 
             ~CancelServerBackfillTicketResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct Certificate : public PlayFabBaseModel
@@ -2200,21 +800,9 @@ namespace PlayFab
 
             ~Certificate() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Base64EncodedValue"], Base64EncodedValue);
-                FromJsonUtilS(input["Name"], Name);
-                FromJsonUtilS(input["Password"], Password);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Base64EncodedValue; ToJsonUtilS(Base64EncodedValue, each_Base64EncodedValue); output["Base64EncodedValue"] = each_Base64EncodedValue;
-                Json::Value each_Name; ToJsonUtilS(Name, each_Name); output["Name"] = each_Name;
-                Json::Value each_Password; ToJsonUtilS(Password, each_Password); output["Password"] = each_Password;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct CertificateSummary : public PlayFabBaseModel
@@ -2236,19 +824,9 @@ namespace PlayFab
 
             ~CertificateSummary() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Name"], Name);
-                FromJsonUtilS(input["Thumbprint"], Thumbprint);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Name; ToJsonUtilS(Name, each_Name); output["Name"] = each_Name;
-                Json::Value each_Thumbprint; ToJsonUtilS(Thumbprint, each_Thumbprint); output["Thumbprint"] = each_Thumbprint;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ConnectedPlayer : public PlayFabBaseModel
@@ -2267,17 +845,9 @@ namespace PlayFab
 
             ~ConnectedPlayer() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["PlayerId"], PlayerId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_PlayerId; ToJsonUtilS(PlayerId, each_PlayerId); output["PlayerId"] = each_PlayerId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ContainerImageReference : public PlayFabBaseModel
@@ -2299,19 +869,9 @@ namespace PlayFab
 
             ~ContainerImageReference() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["ImageName"], ImageName);
-                FromJsonUtilS(input["Tag"], Tag);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ImageName; ToJsonUtilS(ImageName, each_ImageName); output["ImageName"] = each_ImageName;
-                Json::Value each_Tag; ToJsonUtilS(Tag, each_Tag); output["Tag"] = each_Tag;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct CoreCapacity : public PlayFabBaseModel
@@ -2339,23 +899,9 @@ namespace PlayFab
 
             ~CoreCapacity() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["Available"], Available);
-                FromJsonUtilS(input["Region"], Region);
-                FromJsonUtilP(input["Total"], Total);
-                FromJsonUtilE(input["VmFamily"], VmFamily);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Available; ToJsonUtilP(Available, each_Available); output["Available"] = each_Available;
-                Json::Value each_Region; ToJsonUtilS(Region, each_Region); output["Region"] = each_Region;
-                Json::Value each_Total; ToJsonUtilP(Total, each_Total); output["Total"] = each_Total;
-                Json::Value each_VmFamily; ToJsonUtilE(VmFamily, each_VmFamily); output["VmFamily"] = each_VmFamily;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct CoreCapacityChange : public PlayFabBaseModel
@@ -2380,21 +926,9 @@ namespace PlayFab
 
             ~CoreCapacityChange() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["NewCoreLimit"], NewCoreLimit);
-                FromJsonUtilS(input["Region"], Region);
-                FromJsonEnum(input["VmFamily"], VmFamily);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_NewCoreLimit; ToJsonUtilP(NewCoreLimit, each_NewCoreLimit); output["NewCoreLimit"] = each_NewCoreLimit;
-                Json::Value each_Region; ToJsonUtilS(Region, each_Region); output["Region"] = each_Region;
-                Json::Value each_VmFamily; ToJsonEnum(VmFamily, each_VmFamily); output["VmFamily"] = each_VmFamily;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct CreateBuildAliasRequest : public PlayFabRequestCommon
@@ -2419,21 +953,9 @@ namespace PlayFab
 
             ~CreateBuildAliasRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["AliasName"], AliasName);
-                FromJsonUtilO(input["BuildSelectionCriteria"], BuildSelectionCriteria);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AliasName; ToJsonUtilS(AliasName, each_AliasName); output["AliasName"] = each_AliasName;
-                Json::Value each_BuildSelectionCriteria; ToJsonUtilO(BuildSelectionCriteria, each_BuildSelectionCriteria); output["BuildSelectionCriteria"] = each_BuildSelectionCriteria;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GameCertificateReferenceParams : public PlayFabBaseModel
@@ -2455,19 +977,9 @@ namespace PlayFab
 
             ~GameCertificateReferenceParams() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["GsdkAlias"], GsdkAlias);
-                FromJsonUtilS(input["Name"], Name);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_GsdkAlias; ToJsonUtilS(GsdkAlias, each_GsdkAlias); output["GsdkAlias"] = each_GsdkAlias;
-                Json::Value each_Name; ToJsonUtilS(Name, each_Name); output["Name"] = each_Name;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct LinuxInstrumentationConfiguration : public PlayFabBaseModel
@@ -2486,17 +998,9 @@ namespace PlayFab
 
             ~LinuxInstrumentationConfiguration() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["IsEnabled"], IsEnabled);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_IsEnabled; ToJsonUtilP(IsEnabled, each_IsEnabled); output["IsEnabled"] = each_IsEnabled;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct Port : public PlayFabBaseModel
@@ -2521,21 +1025,9 @@ namespace PlayFab
 
             ~Port() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Name"], Name);
-                FromJsonUtilP(input["Num"], Num);
-                FromJsonEnum(input["Protocol"], Protocol);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Name; ToJsonUtilS(Name, each_Name); output["Name"] = each_Name;
-                Json::Value each_Num; ToJsonUtilP(Num, each_Num); output["Num"] = each_Num;
-                Json::Value each_Protocol; ToJsonEnum(Protocol, each_Protocol); output["Protocol"] = each_Protocol;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct CreateBuildWithCustomContainerRequest : public PlayFabRequestCommon
@@ -2596,45 +1088,9 @@ namespace PlayFab
 
             ~CreateBuildWithCustomContainerRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["AreAssetsReadonly"], AreAssetsReadonly);
-                FromJsonUtilS(input["BuildName"], BuildName);
-                FromJsonUtilE(input["ContainerFlavor"], pfContainerFlavor);
-                FromJsonUtilO(input["ContainerImageReference"], pfContainerImageReference);
-                FromJsonUtilS(input["ContainerRunCommand"], ContainerRunCommand);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["GameAssetReferences"], GameAssetReferences);
-                FromJsonUtilO(input["GameCertificateReferences"], GameCertificateReferences);
-                FromJsonUtilO(input["LinuxInstrumentationConfiguration"], pfLinuxInstrumentationConfiguration);
-                FromJsonUtilS(input["Metadata"], Metadata);
-                FromJsonUtilP(input["MultiplayerServerCountPerVm"], MultiplayerServerCountPerVm);
-                FromJsonUtilO(input["Ports"], Ports);
-                FromJsonUtilO(input["RegionConfigurations"], RegionConfigurations);
-                FromJsonUtilP(input["UseStreamingForAssetDownloads"], UseStreamingForAssetDownloads);
-                FromJsonUtilE(input["VmSize"], VmSize);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AreAssetsReadonly; ToJsonUtilP(AreAssetsReadonly, each_AreAssetsReadonly); output["AreAssetsReadonly"] = each_AreAssetsReadonly;
-                Json::Value each_BuildName; ToJsonUtilS(BuildName, each_BuildName); output["BuildName"] = each_BuildName;
-                Json::Value each_pfContainerFlavor; ToJsonUtilE(pfContainerFlavor, each_pfContainerFlavor); output["ContainerFlavor"] = each_pfContainerFlavor;
-                Json::Value each_pfContainerImageReference; ToJsonUtilO(pfContainerImageReference, each_pfContainerImageReference); output["ContainerImageReference"] = each_pfContainerImageReference;
-                Json::Value each_ContainerRunCommand; ToJsonUtilS(ContainerRunCommand, each_ContainerRunCommand); output["ContainerRunCommand"] = each_ContainerRunCommand;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_GameAssetReferences; ToJsonUtilO(GameAssetReferences, each_GameAssetReferences); output["GameAssetReferences"] = each_GameAssetReferences;
-                Json::Value each_GameCertificateReferences; ToJsonUtilO(GameCertificateReferences, each_GameCertificateReferences); output["GameCertificateReferences"] = each_GameCertificateReferences;
-                Json::Value each_pfLinuxInstrumentationConfiguration; ToJsonUtilO(pfLinuxInstrumentationConfiguration, each_pfLinuxInstrumentationConfiguration); output["LinuxInstrumentationConfiguration"] = each_pfLinuxInstrumentationConfiguration;
-                Json::Value each_Metadata; ToJsonUtilS(Metadata, each_Metadata); output["Metadata"] = each_Metadata;
-                Json::Value each_MultiplayerServerCountPerVm; ToJsonUtilP(MultiplayerServerCountPerVm, each_MultiplayerServerCountPerVm); output["MultiplayerServerCountPerVm"] = each_MultiplayerServerCountPerVm;
-                Json::Value each_Ports; ToJsonUtilO(Ports, each_Ports); output["Ports"] = each_Ports;
-                Json::Value each_RegionConfigurations; ToJsonUtilO(RegionConfigurations, each_RegionConfigurations); output["RegionConfigurations"] = each_RegionConfigurations;
-                Json::Value each_UseStreamingForAssetDownloads; ToJsonUtilP(UseStreamingForAssetDownloads, each_UseStreamingForAssetDownloads); output["UseStreamingForAssetDownloads"] = each_UseStreamingForAssetDownloads;
-                Json::Value each_VmSize; ToJsonUtilE(VmSize, each_VmSize); output["VmSize"] = each_VmSize;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GameCertificateReference : public PlayFabBaseModel
@@ -2656,19 +1112,9 @@ namespace PlayFab
 
             ~GameCertificateReference() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["GsdkAlias"], GsdkAlias);
-                FromJsonUtilS(input["Name"], Name);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_GsdkAlias; ToJsonUtilS(GsdkAlias, each_GsdkAlias); output["GsdkAlias"] = each_GsdkAlias;
-                Json::Value each_Name; ToJsonUtilS(Name, each_Name); output["Name"] = each_Name;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct CreateBuildWithCustomContainerResponse : public PlayFabResultCommon
@@ -2738,51 +1184,9 @@ namespace PlayFab
 
             ~CreateBuildWithCustomContainerResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["AreAssetsReadonly"], AreAssetsReadonly);
-                FromJsonUtilS(input["BuildId"], BuildId);
-                FromJsonUtilS(input["BuildName"], BuildName);
-                FromJsonUtilE(input["ContainerFlavor"], pfContainerFlavor);
-                FromJsonUtilS(input["ContainerRunCommand"], ContainerRunCommand);
-                FromJsonUtilT(input["CreationTime"], CreationTime);
-                FromJsonUtilO(input["CustomGameContainerImage"], CustomGameContainerImage);
-                FromJsonUtilO(input["GameAssetReferences"], GameAssetReferences);
-                FromJsonUtilO(input["GameCertificateReferences"], GameCertificateReferences);
-                FromJsonUtilO(input["LinuxInstrumentationConfiguration"], pfLinuxInstrumentationConfiguration);
-                FromJsonUtilS(input["Metadata"], Metadata);
-                FromJsonUtilP(input["MultiplayerServerCountPerVm"], MultiplayerServerCountPerVm);
-                FromJsonUtilS(input["OsPlatform"], OsPlatform);
-                FromJsonUtilO(input["Ports"], Ports);
-                FromJsonUtilO(input["RegionConfigurations"], RegionConfigurations);
-                FromJsonUtilS(input["ServerType"], ServerType);
-                FromJsonUtilP(input["UseStreamingForAssetDownloads"], UseStreamingForAssetDownloads);
-                FromJsonUtilE(input["VmSize"], VmSize);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AreAssetsReadonly; ToJsonUtilP(AreAssetsReadonly, each_AreAssetsReadonly); output["AreAssetsReadonly"] = each_AreAssetsReadonly;
-                Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); output["BuildId"] = each_BuildId;
-                Json::Value each_BuildName; ToJsonUtilS(BuildName, each_BuildName); output["BuildName"] = each_BuildName;
-                Json::Value each_pfContainerFlavor; ToJsonUtilE(pfContainerFlavor, each_pfContainerFlavor); output["ContainerFlavor"] = each_pfContainerFlavor;
-                Json::Value each_ContainerRunCommand; ToJsonUtilS(ContainerRunCommand, each_ContainerRunCommand); output["ContainerRunCommand"] = each_ContainerRunCommand;
-                Json::Value each_CreationTime; ToJsonUtilT(CreationTime, each_CreationTime); output["CreationTime"] = each_CreationTime;
-                Json::Value each_CustomGameContainerImage; ToJsonUtilO(CustomGameContainerImage, each_CustomGameContainerImage); output["CustomGameContainerImage"] = each_CustomGameContainerImage;
-                Json::Value each_GameAssetReferences; ToJsonUtilO(GameAssetReferences, each_GameAssetReferences); output["GameAssetReferences"] = each_GameAssetReferences;
-                Json::Value each_GameCertificateReferences; ToJsonUtilO(GameCertificateReferences, each_GameCertificateReferences); output["GameCertificateReferences"] = each_GameCertificateReferences;
-                Json::Value each_pfLinuxInstrumentationConfiguration; ToJsonUtilO(pfLinuxInstrumentationConfiguration, each_pfLinuxInstrumentationConfiguration); output["LinuxInstrumentationConfiguration"] = each_pfLinuxInstrumentationConfiguration;
-                Json::Value each_Metadata; ToJsonUtilS(Metadata, each_Metadata); output["Metadata"] = each_Metadata;
-                Json::Value each_MultiplayerServerCountPerVm; ToJsonUtilP(MultiplayerServerCountPerVm, each_MultiplayerServerCountPerVm); output["MultiplayerServerCountPerVm"] = each_MultiplayerServerCountPerVm;
-                Json::Value each_OsPlatform; ToJsonUtilS(OsPlatform, each_OsPlatform); output["OsPlatform"] = each_OsPlatform;
-                Json::Value each_Ports; ToJsonUtilO(Ports, each_Ports); output["Ports"] = each_Ports;
-                Json::Value each_RegionConfigurations; ToJsonUtilO(RegionConfigurations, each_RegionConfigurations); output["RegionConfigurations"] = each_RegionConfigurations;
-                Json::Value each_ServerType; ToJsonUtilS(ServerType, each_ServerType); output["ServerType"] = each_ServerType;
-                Json::Value each_UseStreamingForAssetDownloads; ToJsonUtilP(UseStreamingForAssetDownloads, each_UseStreamingForAssetDownloads); output["UseStreamingForAssetDownloads"] = each_UseStreamingForAssetDownloads;
-                Json::Value each_VmSize; ToJsonUtilE(VmSize, each_VmSize); output["VmSize"] = each_VmSize;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct InstrumentationConfiguration : public PlayFabBaseModel
@@ -2801,17 +1205,9 @@ namespace PlayFab
 
             ~InstrumentationConfiguration() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["ProcessesToMonitor"], ProcessesToMonitor);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ProcessesToMonitor; ToJsonUtilS(ProcessesToMonitor, each_ProcessesToMonitor); output["ProcessesToMonitor"] = each_ProcessesToMonitor;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct CreateBuildWithManagedContainerRequest : public PlayFabRequestCommon
@@ -2872,45 +1268,9 @@ namespace PlayFab
 
             ~CreateBuildWithManagedContainerRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["AreAssetsReadonly"], AreAssetsReadonly);
-                FromJsonUtilS(input["BuildName"], BuildName);
-                FromJsonUtilE(input["ContainerFlavor"], pfContainerFlavor);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["GameAssetReferences"], GameAssetReferences);
-                FromJsonUtilO(input["GameCertificateReferences"], GameCertificateReferences);
-                FromJsonUtilS(input["GameWorkingDirectory"], GameWorkingDirectory);
-                FromJsonUtilO(input["InstrumentationConfiguration"], pfInstrumentationConfiguration);
-                FromJsonUtilS(input["Metadata"], Metadata);
-                FromJsonUtilP(input["MultiplayerServerCountPerVm"], MultiplayerServerCountPerVm);
-                FromJsonUtilO(input["Ports"], Ports);
-                FromJsonUtilO(input["RegionConfigurations"], RegionConfigurations);
-                FromJsonUtilS(input["StartMultiplayerServerCommand"], StartMultiplayerServerCommand);
-                FromJsonUtilP(input["UseStreamingForAssetDownloads"], UseStreamingForAssetDownloads);
-                FromJsonUtilE(input["VmSize"], VmSize);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AreAssetsReadonly; ToJsonUtilP(AreAssetsReadonly, each_AreAssetsReadonly); output["AreAssetsReadonly"] = each_AreAssetsReadonly;
-                Json::Value each_BuildName; ToJsonUtilS(BuildName, each_BuildName); output["BuildName"] = each_BuildName;
-                Json::Value each_pfContainerFlavor; ToJsonUtilE(pfContainerFlavor, each_pfContainerFlavor); output["ContainerFlavor"] = each_pfContainerFlavor;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_GameAssetReferences; ToJsonUtilO(GameAssetReferences, each_GameAssetReferences); output["GameAssetReferences"] = each_GameAssetReferences;
-                Json::Value each_GameCertificateReferences; ToJsonUtilO(GameCertificateReferences, each_GameCertificateReferences); output["GameCertificateReferences"] = each_GameCertificateReferences;
-                Json::Value each_GameWorkingDirectory; ToJsonUtilS(GameWorkingDirectory, each_GameWorkingDirectory); output["GameWorkingDirectory"] = each_GameWorkingDirectory;
-                Json::Value each_pfInstrumentationConfiguration; ToJsonUtilO(pfInstrumentationConfiguration, each_pfInstrumentationConfiguration); output["InstrumentationConfiguration"] = each_pfInstrumentationConfiguration;
-                Json::Value each_Metadata; ToJsonUtilS(Metadata, each_Metadata); output["Metadata"] = each_Metadata;
-                Json::Value each_MultiplayerServerCountPerVm; ToJsonUtilP(MultiplayerServerCountPerVm, each_MultiplayerServerCountPerVm); output["MultiplayerServerCountPerVm"] = each_MultiplayerServerCountPerVm;
-                Json::Value each_Ports; ToJsonUtilO(Ports, each_Ports); output["Ports"] = each_Ports;
-                Json::Value each_RegionConfigurations; ToJsonUtilO(RegionConfigurations, each_RegionConfigurations); output["RegionConfigurations"] = each_RegionConfigurations;
-                Json::Value each_StartMultiplayerServerCommand; ToJsonUtilS(StartMultiplayerServerCommand, each_StartMultiplayerServerCommand); output["StartMultiplayerServerCommand"] = each_StartMultiplayerServerCommand;
-                Json::Value each_UseStreamingForAssetDownloads; ToJsonUtilP(UseStreamingForAssetDownloads, each_UseStreamingForAssetDownloads); output["UseStreamingForAssetDownloads"] = each_UseStreamingForAssetDownloads;
-                Json::Value each_VmSize; ToJsonUtilE(VmSize, each_VmSize); output["VmSize"] = each_VmSize;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct CreateBuildWithManagedContainerResponse : public PlayFabResultCommon
@@ -2980,51 +1340,9 @@ namespace PlayFab
 
             ~CreateBuildWithManagedContainerResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["AreAssetsReadonly"], AreAssetsReadonly);
-                FromJsonUtilS(input["BuildId"], BuildId);
-                FromJsonUtilS(input["BuildName"], BuildName);
-                FromJsonUtilE(input["ContainerFlavor"], pfContainerFlavor);
-                FromJsonUtilT(input["CreationTime"], CreationTime);
-                FromJsonUtilO(input["GameAssetReferences"], GameAssetReferences);
-                FromJsonUtilO(input["GameCertificateReferences"], GameCertificateReferences);
-                FromJsonUtilS(input["GameWorkingDirectory"], GameWorkingDirectory);
-                FromJsonUtilO(input["InstrumentationConfiguration"], pfInstrumentationConfiguration);
-                FromJsonUtilS(input["Metadata"], Metadata);
-                FromJsonUtilP(input["MultiplayerServerCountPerVm"], MultiplayerServerCountPerVm);
-                FromJsonUtilS(input["OsPlatform"], OsPlatform);
-                FromJsonUtilO(input["Ports"], Ports);
-                FromJsonUtilO(input["RegionConfigurations"], RegionConfigurations);
-                FromJsonUtilS(input["ServerType"], ServerType);
-                FromJsonUtilS(input["StartMultiplayerServerCommand"], StartMultiplayerServerCommand);
-                FromJsonUtilP(input["UseStreamingForAssetDownloads"], UseStreamingForAssetDownloads);
-                FromJsonUtilE(input["VmSize"], VmSize);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AreAssetsReadonly; ToJsonUtilP(AreAssetsReadonly, each_AreAssetsReadonly); output["AreAssetsReadonly"] = each_AreAssetsReadonly;
-                Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); output["BuildId"] = each_BuildId;
-                Json::Value each_BuildName; ToJsonUtilS(BuildName, each_BuildName); output["BuildName"] = each_BuildName;
-                Json::Value each_pfContainerFlavor; ToJsonUtilE(pfContainerFlavor, each_pfContainerFlavor); output["ContainerFlavor"] = each_pfContainerFlavor;
-                Json::Value each_CreationTime; ToJsonUtilT(CreationTime, each_CreationTime); output["CreationTime"] = each_CreationTime;
-                Json::Value each_GameAssetReferences; ToJsonUtilO(GameAssetReferences, each_GameAssetReferences); output["GameAssetReferences"] = each_GameAssetReferences;
-                Json::Value each_GameCertificateReferences; ToJsonUtilO(GameCertificateReferences, each_GameCertificateReferences); output["GameCertificateReferences"] = each_GameCertificateReferences;
-                Json::Value each_GameWorkingDirectory; ToJsonUtilS(GameWorkingDirectory, each_GameWorkingDirectory); output["GameWorkingDirectory"] = each_GameWorkingDirectory;
-                Json::Value each_pfInstrumentationConfiguration; ToJsonUtilO(pfInstrumentationConfiguration, each_pfInstrumentationConfiguration); output["InstrumentationConfiguration"] = each_pfInstrumentationConfiguration;
-                Json::Value each_Metadata; ToJsonUtilS(Metadata, each_Metadata); output["Metadata"] = each_Metadata;
-                Json::Value each_MultiplayerServerCountPerVm; ToJsonUtilP(MultiplayerServerCountPerVm, each_MultiplayerServerCountPerVm); output["MultiplayerServerCountPerVm"] = each_MultiplayerServerCountPerVm;
-                Json::Value each_OsPlatform; ToJsonUtilS(OsPlatform, each_OsPlatform); output["OsPlatform"] = each_OsPlatform;
-                Json::Value each_Ports; ToJsonUtilO(Ports, each_Ports); output["Ports"] = each_Ports;
-                Json::Value each_RegionConfigurations; ToJsonUtilO(RegionConfigurations, each_RegionConfigurations); output["RegionConfigurations"] = each_RegionConfigurations;
-                Json::Value each_ServerType; ToJsonUtilS(ServerType, each_ServerType); output["ServerType"] = each_ServerType;
-                Json::Value each_StartMultiplayerServerCommand; ToJsonUtilS(StartMultiplayerServerCommand, each_StartMultiplayerServerCommand); output["StartMultiplayerServerCommand"] = each_StartMultiplayerServerCommand;
-                Json::Value each_UseStreamingForAssetDownloads; ToJsonUtilP(UseStreamingForAssetDownloads, each_UseStreamingForAssetDownloads); output["UseStreamingForAssetDownloads"] = each_UseStreamingForAssetDownloads;
-                Json::Value each_VmSize; ToJsonUtilE(VmSize, each_VmSize); output["VmSize"] = each_VmSize;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct CreateBuildWithProcessBasedServerRequest : public PlayFabRequestCommon
@@ -3088,47 +1406,9 @@ namespace PlayFab
 
             ~CreateBuildWithProcessBasedServerRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["AreAssetsReadonly"], AreAssetsReadonly);
-                FromJsonUtilS(input["BuildName"], BuildName);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["GameAssetReferences"], GameAssetReferences);
-                FromJsonUtilO(input["GameCertificateReferences"], GameCertificateReferences);
-                FromJsonUtilS(input["GameWorkingDirectory"], GameWorkingDirectory);
-                FromJsonUtilO(input["InstrumentationConfiguration"], pfInstrumentationConfiguration);
-                FromJsonUtilP(input["IsOSPreview"], IsOSPreview);
-                FromJsonUtilS(input["Metadata"], Metadata);
-                FromJsonUtilP(input["MultiplayerServerCountPerVm"], MultiplayerServerCountPerVm);
-                FromJsonUtilS(input["OsPlatform"], OsPlatform);
-                FromJsonUtilO(input["Ports"], Ports);
-                FromJsonUtilO(input["RegionConfigurations"], RegionConfigurations);
-                FromJsonUtilS(input["StartMultiplayerServerCommand"], StartMultiplayerServerCommand);
-                FromJsonUtilP(input["UseStreamingForAssetDownloads"], UseStreamingForAssetDownloads);
-                FromJsonUtilE(input["VmSize"], VmSize);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AreAssetsReadonly; ToJsonUtilP(AreAssetsReadonly, each_AreAssetsReadonly); output["AreAssetsReadonly"] = each_AreAssetsReadonly;
-                Json::Value each_BuildName; ToJsonUtilS(BuildName, each_BuildName); output["BuildName"] = each_BuildName;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_GameAssetReferences; ToJsonUtilO(GameAssetReferences, each_GameAssetReferences); output["GameAssetReferences"] = each_GameAssetReferences;
-                Json::Value each_GameCertificateReferences; ToJsonUtilO(GameCertificateReferences, each_GameCertificateReferences); output["GameCertificateReferences"] = each_GameCertificateReferences;
-                Json::Value each_GameWorkingDirectory; ToJsonUtilS(GameWorkingDirectory, each_GameWorkingDirectory); output["GameWorkingDirectory"] = each_GameWorkingDirectory;
-                Json::Value each_pfInstrumentationConfiguration; ToJsonUtilO(pfInstrumentationConfiguration, each_pfInstrumentationConfiguration); output["InstrumentationConfiguration"] = each_pfInstrumentationConfiguration;
-                Json::Value each_IsOSPreview; ToJsonUtilP(IsOSPreview, each_IsOSPreview); output["IsOSPreview"] = each_IsOSPreview;
-                Json::Value each_Metadata; ToJsonUtilS(Metadata, each_Metadata); output["Metadata"] = each_Metadata;
-                Json::Value each_MultiplayerServerCountPerVm; ToJsonUtilP(MultiplayerServerCountPerVm, each_MultiplayerServerCountPerVm); output["MultiplayerServerCountPerVm"] = each_MultiplayerServerCountPerVm;
-                Json::Value each_OsPlatform; ToJsonUtilS(OsPlatform, each_OsPlatform); output["OsPlatform"] = each_OsPlatform;
-                Json::Value each_Ports; ToJsonUtilO(Ports, each_Ports); output["Ports"] = each_Ports;
-                Json::Value each_RegionConfigurations; ToJsonUtilO(RegionConfigurations, each_RegionConfigurations); output["RegionConfigurations"] = each_RegionConfigurations;
-                Json::Value each_StartMultiplayerServerCommand; ToJsonUtilS(StartMultiplayerServerCommand, each_StartMultiplayerServerCommand); output["StartMultiplayerServerCommand"] = each_StartMultiplayerServerCommand;
-                Json::Value each_UseStreamingForAssetDownloads; ToJsonUtilP(UseStreamingForAssetDownloads, each_UseStreamingForAssetDownloads); output["UseStreamingForAssetDownloads"] = each_UseStreamingForAssetDownloads;
-                Json::Value each_VmSize; ToJsonUtilE(VmSize, each_VmSize); output["VmSize"] = each_VmSize;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct CreateBuildWithProcessBasedServerResponse : public PlayFabResultCommon
@@ -3201,53 +1481,9 @@ namespace PlayFab
 
             ~CreateBuildWithProcessBasedServerResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["AreAssetsReadonly"], AreAssetsReadonly);
-                FromJsonUtilS(input["BuildId"], BuildId);
-                FromJsonUtilS(input["BuildName"], BuildName);
-                FromJsonUtilE(input["ContainerFlavor"], pfContainerFlavor);
-                FromJsonUtilT(input["CreationTime"], CreationTime);
-                FromJsonUtilO(input["GameAssetReferences"], GameAssetReferences);
-                FromJsonUtilO(input["GameCertificateReferences"], GameCertificateReferences);
-                FromJsonUtilS(input["GameWorkingDirectory"], GameWorkingDirectory);
-                FromJsonUtilO(input["InstrumentationConfiguration"], pfInstrumentationConfiguration);
-                FromJsonUtilP(input["IsOSPreview"], IsOSPreview);
-                FromJsonUtilS(input["Metadata"], Metadata);
-                FromJsonUtilP(input["MultiplayerServerCountPerVm"], MultiplayerServerCountPerVm);
-                FromJsonUtilS(input["OsPlatform"], OsPlatform);
-                FromJsonUtilO(input["Ports"], Ports);
-                FromJsonUtilO(input["RegionConfigurations"], RegionConfigurations);
-                FromJsonUtilS(input["ServerType"], ServerType);
-                FromJsonUtilS(input["StartMultiplayerServerCommand"], StartMultiplayerServerCommand);
-                FromJsonUtilP(input["UseStreamingForAssetDownloads"], UseStreamingForAssetDownloads);
-                FromJsonUtilE(input["VmSize"], VmSize);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AreAssetsReadonly; ToJsonUtilP(AreAssetsReadonly, each_AreAssetsReadonly); output["AreAssetsReadonly"] = each_AreAssetsReadonly;
-                Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); output["BuildId"] = each_BuildId;
-                Json::Value each_BuildName; ToJsonUtilS(BuildName, each_BuildName); output["BuildName"] = each_BuildName;
-                Json::Value each_pfContainerFlavor; ToJsonUtilE(pfContainerFlavor, each_pfContainerFlavor); output["ContainerFlavor"] = each_pfContainerFlavor;
-                Json::Value each_CreationTime; ToJsonUtilT(CreationTime, each_CreationTime); output["CreationTime"] = each_CreationTime;
-                Json::Value each_GameAssetReferences; ToJsonUtilO(GameAssetReferences, each_GameAssetReferences); output["GameAssetReferences"] = each_GameAssetReferences;
-                Json::Value each_GameCertificateReferences; ToJsonUtilO(GameCertificateReferences, each_GameCertificateReferences); output["GameCertificateReferences"] = each_GameCertificateReferences;
-                Json::Value each_GameWorkingDirectory; ToJsonUtilS(GameWorkingDirectory, each_GameWorkingDirectory); output["GameWorkingDirectory"] = each_GameWorkingDirectory;
-                Json::Value each_pfInstrumentationConfiguration; ToJsonUtilO(pfInstrumentationConfiguration, each_pfInstrumentationConfiguration); output["InstrumentationConfiguration"] = each_pfInstrumentationConfiguration;
-                Json::Value each_IsOSPreview; ToJsonUtilP(IsOSPreview, each_IsOSPreview); output["IsOSPreview"] = each_IsOSPreview;
-                Json::Value each_Metadata; ToJsonUtilS(Metadata, each_Metadata); output["Metadata"] = each_Metadata;
-                Json::Value each_MultiplayerServerCountPerVm; ToJsonUtilP(MultiplayerServerCountPerVm, each_MultiplayerServerCountPerVm); output["MultiplayerServerCountPerVm"] = each_MultiplayerServerCountPerVm;
-                Json::Value each_OsPlatform; ToJsonUtilS(OsPlatform, each_OsPlatform); output["OsPlatform"] = each_OsPlatform;
-                Json::Value each_Ports; ToJsonUtilO(Ports, each_Ports); output["Ports"] = each_Ports;
-                Json::Value each_RegionConfigurations; ToJsonUtilO(RegionConfigurations, each_RegionConfigurations); output["RegionConfigurations"] = each_RegionConfigurations;
-                Json::Value each_ServerType; ToJsonUtilS(ServerType, each_ServerType); output["ServerType"] = each_ServerType;
-                Json::Value each_StartMultiplayerServerCommand; ToJsonUtilS(StartMultiplayerServerCommand, each_StartMultiplayerServerCommand); output["StartMultiplayerServerCommand"] = each_StartMultiplayerServerCommand;
-                Json::Value each_UseStreamingForAssetDownloads; ToJsonUtilP(UseStreamingForAssetDownloads, each_UseStreamingForAssetDownloads); output["UseStreamingForAssetDownloads"] = each_UseStreamingForAssetDownloads;
-                Json::Value each_VmSize; ToJsonUtilE(VmSize, each_VmSize); output["VmSize"] = each_VmSize;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct MatchmakingPlayerAttributes : public PlayFabBaseModel
@@ -3269,19 +1505,9 @@ namespace PlayFab
 
             ~MatchmakingPlayerAttributes() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                DataObject = input["DataObject"];
-                FromJsonUtilS(input["EscapedDataObject"], EscapedDataObject);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                output["DataObject"] = DataObject;
-                Json::Value each_EscapedDataObject; ToJsonUtilS(EscapedDataObject, each_EscapedDataObject); output["EscapedDataObject"] = each_EscapedDataObject;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct MatchmakingPlayer : public PlayFabBaseModel
@@ -3303,19 +1529,9 @@ namespace PlayFab
 
             ~MatchmakingPlayer() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Attributes"], Attributes);
-                FromJsonUtilO(input["Entity"], Entity);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Attributes; ToJsonUtilO(Attributes, each_Attributes); output["Attributes"] = each_Attributes;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct CreateMatchmakingTicketRequest : public PlayFabRequestCommon
@@ -3346,25 +1562,9 @@ namespace PlayFab
 
             ~CreateMatchmakingTicketRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Creator"], Creator);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["GiveUpAfterSeconds"], GiveUpAfterSeconds);
-                FromJsonUtilO(input["MembersToMatchWith"], MembersToMatchWith);
-                FromJsonUtilS(input["QueueName"], QueueName);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Creator; ToJsonUtilO(Creator, each_Creator); output["Creator"] = each_Creator;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_GiveUpAfterSeconds; ToJsonUtilP(GiveUpAfterSeconds, each_GiveUpAfterSeconds); output["GiveUpAfterSeconds"] = each_GiveUpAfterSeconds;
-                Json::Value each_MembersToMatchWith; ToJsonUtilO(MembersToMatchWith, each_MembersToMatchWith); output["MembersToMatchWith"] = each_MembersToMatchWith;
-                Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); output["QueueName"] = each_QueueName;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct CreateMatchmakingTicketResult : public PlayFabResultCommon
@@ -3383,17 +1583,9 @@ namespace PlayFab
 
             ~CreateMatchmakingTicketResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["TicketId"], TicketId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_TicketId; ToJsonUtilS(TicketId, each_TicketId); output["TicketId"] = each_TicketId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct CreateRemoteUserRequest : public PlayFabRequestCommon
@@ -3427,27 +1619,9 @@ namespace PlayFab
 
             ~CreateRemoteUserRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["BuildId"], BuildId);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilT(input["ExpirationTime"], ExpirationTime);
-                FromJsonUtilS(input["Region"], Region);
-                FromJsonUtilS(input["Username"], Username);
-                FromJsonUtilS(input["VmId"], VmId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); output["BuildId"] = each_BuildId;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ExpirationTime; ToJsonUtilT(ExpirationTime, each_ExpirationTime); output["ExpirationTime"] = each_ExpirationTime;
-                Json::Value each_Region; ToJsonUtilS(Region, each_Region); output["Region"] = each_Region;
-                Json::Value each_Username; ToJsonUtilS(Username, each_Username); output["Username"] = each_Username;
-                Json::Value each_VmId; ToJsonUtilS(VmId, each_VmId); output["VmId"] = each_VmId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct CreateRemoteUserResponse : public PlayFabResultCommon
@@ -3472,21 +1646,9 @@ namespace PlayFab
 
             ~CreateRemoteUserResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilT(input["ExpirationTime"], ExpirationTime);
-                FromJsonUtilS(input["Password"], Password);
-                FromJsonUtilS(input["Username"], Username);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ExpirationTime; ToJsonUtilT(ExpirationTime, each_ExpirationTime); output["ExpirationTime"] = each_ExpirationTime;
-                Json::Value each_Password; ToJsonUtilS(Password, each_Password); output["Password"] = each_Password;
-                Json::Value each_Username; ToJsonUtilS(Username, each_Username); output["Username"] = each_Username;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct MatchmakingPlayerWithTeamAssignment : public PlayFabBaseModel
@@ -3511,21 +1673,9 @@ namespace PlayFab
 
             ~MatchmakingPlayerWithTeamAssignment() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Attributes"], Attributes);
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilS(input["TeamId"], TeamId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Attributes; ToJsonUtilO(Attributes, each_Attributes); output["Attributes"] = each_Attributes;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_TeamId; ToJsonUtilS(TeamId, each_TeamId); output["TeamId"] = each_TeamId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ServerDetails : public PlayFabBaseModel
@@ -3550,21 +1700,9 @@ namespace PlayFab
 
             ~ServerDetails() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["IPV4Address"], IPV4Address);
-                FromJsonUtilO(input["Ports"], Ports);
-                FromJsonUtilS(input["Region"], Region);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_IPV4Address; ToJsonUtilS(IPV4Address, each_IPV4Address); output["IPV4Address"] = each_IPV4Address;
-                Json::Value each_Ports; ToJsonUtilO(Ports, each_Ports); output["Ports"] = each_Ports;
-                Json::Value each_Region; ToJsonUtilS(Region, each_Region); output["Region"] = each_Region;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct CreateServerBackfillTicketRequest : public PlayFabRequestCommon
@@ -3595,25 +1733,9 @@ namespace PlayFab
 
             ~CreateServerBackfillTicketRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["GiveUpAfterSeconds"], GiveUpAfterSeconds);
-                FromJsonUtilO(input["Members"], Members);
-                FromJsonUtilS(input["QueueName"], QueueName);
-                FromJsonUtilO(input["ServerDetails"], pfServerDetails);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_GiveUpAfterSeconds; ToJsonUtilP(GiveUpAfterSeconds, each_GiveUpAfterSeconds); output["GiveUpAfterSeconds"] = each_GiveUpAfterSeconds;
-                Json::Value each_Members; ToJsonUtilO(Members, each_Members); output["Members"] = each_Members;
-                Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); output["QueueName"] = each_QueueName;
-                Json::Value each_pfServerDetails; ToJsonUtilO(pfServerDetails, each_pfServerDetails); output["ServerDetails"] = each_pfServerDetails;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct CreateServerBackfillTicketResult : public PlayFabResultCommon
@@ -3632,17 +1754,9 @@ namespace PlayFab
 
             ~CreateServerBackfillTicketResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["TicketId"], TicketId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_TicketId; ToJsonUtilS(TicketId, each_TicketId); output["TicketId"] = each_TicketId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct CreateServerMatchmakingTicketRequest : public PlayFabRequestCommon
@@ -3670,23 +1784,9 @@ namespace PlayFab
 
             ~CreateServerMatchmakingTicketRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["GiveUpAfterSeconds"], GiveUpAfterSeconds);
-                FromJsonUtilO(input["Members"], Members);
-                FromJsonUtilS(input["QueueName"], QueueName);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_GiveUpAfterSeconds; ToJsonUtilP(GiveUpAfterSeconds, each_GiveUpAfterSeconds); output["GiveUpAfterSeconds"] = each_GiveUpAfterSeconds;
-                Json::Value each_Members; ToJsonUtilO(Members, each_Members); output["Members"] = each_Members;
-                Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); output["QueueName"] = each_QueueName;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct CreateTitleMultiplayerServersQuotaChangeRequest : public PlayFabRequestCommon
@@ -3720,27 +1820,9 @@ namespace PlayFab
 
             ~CreateTitleMultiplayerServersQuotaChangeRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["ChangeDescription"], ChangeDescription);
-                FromJsonUtilO(input["Changes"], Changes);
-                FromJsonUtilS(input["ContactEmail"], ContactEmail);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["Notes"], Notes);
-                FromJsonUtilT(input["StartDate"], StartDate);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ChangeDescription; ToJsonUtilS(ChangeDescription, each_ChangeDescription); output["ChangeDescription"] = each_ChangeDescription;
-                Json::Value each_Changes; ToJsonUtilO(Changes, each_Changes); output["Changes"] = each_Changes;
-                Json::Value each_ContactEmail; ToJsonUtilS(ContactEmail, each_ContactEmail); output["ContactEmail"] = each_ContactEmail;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Notes; ToJsonUtilS(Notes, each_Notes); output["Notes"] = each_Notes;
-                Json::Value each_StartDate; ToJsonUtilT(StartDate, each_StartDate); output["StartDate"] = each_StartDate;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct CreateTitleMultiplayerServersQuotaChangeResponse : public PlayFabResultCommon
@@ -3762,19 +1844,9 @@ namespace PlayFab
 
             ~CreateTitleMultiplayerServersQuotaChangeResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["RequestId"], RequestId);
-                FromJsonUtilP(input["WasApproved"], WasApproved);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_RequestId; ToJsonUtilS(RequestId, each_RequestId); output["RequestId"] = each_RequestId;
-                Json::Value each_WasApproved; ToJsonUtilP(WasApproved, each_WasApproved); output["WasApproved"] = each_WasApproved;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct DeleteAssetRequest : public PlayFabRequestCommon
@@ -3796,19 +1868,9 @@ namespace PlayFab
 
             ~DeleteAssetRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["FileName"], FileName);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_FileName; ToJsonUtilS(FileName, each_FileName); output["FileName"] = each_FileName;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct DeleteBuildAliasRequest : public PlayFabRequestCommon
@@ -3830,19 +1892,9 @@ namespace PlayFab
 
             ~DeleteBuildAliasRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["AliasId"], AliasId);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AliasId; ToJsonUtilS(AliasId, each_AliasId); output["AliasId"] = each_AliasId;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct DeleteBuildRegionRequest : public PlayFabRequestCommon
@@ -3867,21 +1919,9 @@ namespace PlayFab
 
             ~DeleteBuildRegionRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["BuildId"], BuildId);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["Region"], Region);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); output["BuildId"] = each_BuildId;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Region; ToJsonUtilS(Region, each_Region); output["Region"] = each_Region;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct DeleteBuildRequest : public PlayFabRequestCommon
@@ -3903,19 +1943,9 @@ namespace PlayFab
 
             ~DeleteBuildRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["BuildId"], BuildId);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); output["BuildId"] = each_BuildId;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct DeleteCertificateRequest : public PlayFabRequestCommon
@@ -3937,19 +1967,9 @@ namespace PlayFab
 
             ~DeleteCertificateRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["Name"], Name);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Name; ToJsonUtilS(Name, each_Name); output["Name"] = each_Name;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct DeleteContainerImageRequest : public PlayFabRequestCommon
@@ -3971,19 +1991,9 @@ namespace PlayFab
 
             ~DeleteContainerImageRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["ImageName"], ImageName);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ImageName; ToJsonUtilS(ImageName, each_ImageName); output["ImageName"] = each_ImageName;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct DeleteRemoteUserRequest : public PlayFabRequestCommon
@@ -4014,25 +2024,9 @@ namespace PlayFab
 
             ~DeleteRemoteUserRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["BuildId"], BuildId);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["Region"], Region);
-                FromJsonUtilS(input["Username"], Username);
-                FromJsonUtilS(input["VmId"], VmId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); output["BuildId"] = each_BuildId;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Region; ToJsonUtilS(Region, each_Region); output["Region"] = each_Region;
-                Json::Value each_Username; ToJsonUtilS(Username, each_Username); output["Username"] = each_Username;
-                Json::Value each_VmId; ToJsonUtilS(VmId, each_VmId); output["VmId"] = each_VmId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct EmptyResponse : public PlayFabResultCommon
@@ -4048,15 +2042,9 @@ namespace PlayFab
 
             ~EmptyResponse() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct EnableMultiplayerServersForTitleRequest : public PlayFabRequestCommon
@@ -4075,17 +2063,9 @@ namespace PlayFab
 
             ~EnableMultiplayerServersForTitleRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct EnableMultiplayerServersForTitleResponse : public PlayFabResultCommon
@@ -4104,17 +2084,9 @@ namespace PlayFab
 
             ~EnableMultiplayerServersForTitleResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilE(input["Status"], Status);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Status; ToJsonUtilE(Status, each_Status); output["Status"] = each_Status;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetAssetUploadUrlRequest : public PlayFabRequestCommon
@@ -4136,19 +2108,9 @@ namespace PlayFab
 
             ~GetAssetUploadUrlRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["FileName"], FileName);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_FileName; ToJsonUtilS(FileName, each_FileName); output["FileName"] = each_FileName;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetAssetUploadUrlResponse : public PlayFabResultCommon
@@ -4170,19 +2132,9 @@ namespace PlayFab
 
             ~GetAssetUploadUrlResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["AssetUploadUrl"], AssetUploadUrl);
-                FromJsonUtilS(input["FileName"], FileName);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AssetUploadUrl; ToJsonUtilS(AssetUploadUrl, each_AssetUploadUrl); output["AssetUploadUrl"] = each_AssetUploadUrl;
-                Json::Value each_FileName; ToJsonUtilS(FileName, each_FileName); output["FileName"] = each_FileName;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetBuildAliasRequest : public PlayFabRequestCommon
@@ -4204,19 +2156,9 @@ namespace PlayFab
 
             ~GetBuildAliasRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["AliasId"], AliasId);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AliasId; ToJsonUtilS(AliasId, each_AliasId); output["AliasId"] = each_AliasId;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetBuildRequest : public PlayFabRequestCommon
@@ -4238,19 +2180,9 @@ namespace PlayFab
 
             ~GetBuildRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["BuildId"], BuildId);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); output["BuildId"] = each_BuildId;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetBuildResponse : public PlayFabResultCommon
@@ -4326,55 +2258,9 @@ namespace PlayFab
 
             ~GetBuildResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["AreAssetsReadonly"], AreAssetsReadonly);
-                FromJsonUtilS(input["BuildId"], BuildId);
-                FromJsonUtilS(input["BuildName"], BuildName);
-                FromJsonUtilS(input["BuildStatus"], BuildStatus);
-                FromJsonUtilE(input["ContainerFlavor"], pfContainerFlavor);
-                FromJsonUtilS(input["ContainerRunCommand"], ContainerRunCommand);
-                FromJsonUtilT(input["CreationTime"], CreationTime);
-                FromJsonUtilO(input["CustomGameContainerImage"], CustomGameContainerImage);
-                FromJsonUtilO(input["GameAssetReferences"], GameAssetReferences);
-                FromJsonUtilO(input["GameCertificateReferences"], GameCertificateReferences);
-                FromJsonUtilO(input["InstrumentationConfiguration"], pfInstrumentationConfiguration);
-                FromJsonUtilS(input["Metadata"], Metadata);
-                FromJsonUtilP(input["MultiplayerServerCountPerVm"], MultiplayerServerCountPerVm);
-                FromJsonUtilS(input["OsPlatform"], OsPlatform);
-                FromJsonUtilO(input["Ports"], Ports);
-                FromJsonUtilO(input["RegionConfigurations"], RegionConfigurations);
-                FromJsonUtilS(input["ServerType"], ServerType);
-                FromJsonUtilS(input["StartMultiplayerServerCommand"], StartMultiplayerServerCommand);
-                FromJsonUtilP(input["UseStreamingForAssetDownloads"], UseStreamingForAssetDownloads);
-                FromJsonUtilE(input["VmSize"], VmSize);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AreAssetsReadonly; ToJsonUtilP(AreAssetsReadonly, each_AreAssetsReadonly); output["AreAssetsReadonly"] = each_AreAssetsReadonly;
-                Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); output["BuildId"] = each_BuildId;
-                Json::Value each_BuildName; ToJsonUtilS(BuildName, each_BuildName); output["BuildName"] = each_BuildName;
-                Json::Value each_BuildStatus; ToJsonUtilS(BuildStatus, each_BuildStatus); output["BuildStatus"] = each_BuildStatus;
-                Json::Value each_pfContainerFlavor; ToJsonUtilE(pfContainerFlavor, each_pfContainerFlavor); output["ContainerFlavor"] = each_pfContainerFlavor;
-                Json::Value each_ContainerRunCommand; ToJsonUtilS(ContainerRunCommand, each_ContainerRunCommand); output["ContainerRunCommand"] = each_ContainerRunCommand;
-                Json::Value each_CreationTime; ToJsonUtilT(CreationTime, each_CreationTime); output["CreationTime"] = each_CreationTime;
-                Json::Value each_CustomGameContainerImage; ToJsonUtilO(CustomGameContainerImage, each_CustomGameContainerImage); output["CustomGameContainerImage"] = each_CustomGameContainerImage;
-                Json::Value each_GameAssetReferences; ToJsonUtilO(GameAssetReferences, each_GameAssetReferences); output["GameAssetReferences"] = each_GameAssetReferences;
-                Json::Value each_GameCertificateReferences; ToJsonUtilO(GameCertificateReferences, each_GameCertificateReferences); output["GameCertificateReferences"] = each_GameCertificateReferences;
-                Json::Value each_pfInstrumentationConfiguration; ToJsonUtilO(pfInstrumentationConfiguration, each_pfInstrumentationConfiguration); output["InstrumentationConfiguration"] = each_pfInstrumentationConfiguration;
-                Json::Value each_Metadata; ToJsonUtilS(Metadata, each_Metadata); output["Metadata"] = each_Metadata;
-                Json::Value each_MultiplayerServerCountPerVm; ToJsonUtilP(MultiplayerServerCountPerVm, each_MultiplayerServerCountPerVm); output["MultiplayerServerCountPerVm"] = each_MultiplayerServerCountPerVm;
-                Json::Value each_OsPlatform; ToJsonUtilS(OsPlatform, each_OsPlatform); output["OsPlatform"] = each_OsPlatform;
-                Json::Value each_Ports; ToJsonUtilO(Ports, each_Ports); output["Ports"] = each_Ports;
-                Json::Value each_RegionConfigurations; ToJsonUtilO(RegionConfigurations, each_RegionConfigurations); output["RegionConfigurations"] = each_RegionConfigurations;
-                Json::Value each_ServerType; ToJsonUtilS(ServerType, each_ServerType); output["ServerType"] = each_ServerType;
-                Json::Value each_StartMultiplayerServerCommand; ToJsonUtilS(StartMultiplayerServerCommand, each_StartMultiplayerServerCommand); output["StartMultiplayerServerCommand"] = each_StartMultiplayerServerCommand;
-                Json::Value each_UseStreamingForAssetDownloads; ToJsonUtilP(UseStreamingForAssetDownloads, each_UseStreamingForAssetDownloads); output["UseStreamingForAssetDownloads"] = each_UseStreamingForAssetDownloads;
-                Json::Value each_VmSize; ToJsonUtilE(VmSize, each_VmSize); output["VmSize"] = each_VmSize;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetContainerRegistryCredentialsRequest : public PlayFabRequestCommon
@@ -4393,17 +2279,9 @@ namespace PlayFab
 
             ~GetContainerRegistryCredentialsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetContainerRegistryCredentialsResponse : public PlayFabResultCommon
@@ -4428,21 +2306,9 @@ namespace PlayFab
 
             ~GetContainerRegistryCredentialsResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["DnsName"], DnsName);
-                FromJsonUtilS(input["Password"], Password);
-                FromJsonUtilS(input["Username"], Username);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_DnsName; ToJsonUtilS(DnsName, each_DnsName); output["DnsName"] = each_DnsName;
-                Json::Value each_Password; ToJsonUtilS(Password, each_Password); output["Password"] = each_Password;
-                Json::Value each_Username; ToJsonUtilS(Username, each_Username); output["Username"] = each_Username;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetMatchmakingTicketRequest : public PlayFabRequestCommon
@@ -4470,23 +2336,9 @@ namespace PlayFab
 
             ~GetMatchmakingTicketRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["EscapeObject"], EscapeObject);
-                FromJsonUtilS(input["QueueName"], QueueName);
-                FromJsonUtilS(input["TicketId"], TicketId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_EscapeObject; ToJsonUtilP(EscapeObject, each_EscapeObject); output["EscapeObject"] = each_EscapeObject;
-                Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); output["QueueName"] = each_QueueName;
-                Json::Value each_TicketId; ToJsonUtilS(TicketId, each_TicketId); output["TicketId"] = each_TicketId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetMatchmakingTicketResult : public PlayFabResultCommon
@@ -4532,35 +2384,9 @@ namespace PlayFab
 
             ~GetMatchmakingTicketResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CancellationReasonString"], CancellationReasonString);
-                FromJsonUtilT(input["Created"], Created);
-                FromJsonUtilO(input["Creator"], Creator);
-                FromJsonUtilP(input["GiveUpAfterSeconds"], GiveUpAfterSeconds);
-                FromJsonUtilS(input["MatchId"], MatchId);
-                FromJsonUtilO(input["Members"], Members);
-                FromJsonUtilO(input["MembersToMatchWith"], MembersToMatchWith);
-                FromJsonUtilS(input["QueueName"], QueueName);
-                FromJsonUtilS(input["Status"], Status);
-                FromJsonUtilS(input["TicketId"], TicketId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CancellationReasonString; ToJsonUtilS(CancellationReasonString, each_CancellationReasonString); output["CancellationReasonString"] = each_CancellationReasonString;
-                Json::Value each_Created; ToJsonUtilT(Created, each_Created); output["Created"] = each_Created;
-                Json::Value each_Creator; ToJsonUtilO(Creator, each_Creator); output["Creator"] = each_Creator;
-                Json::Value each_GiveUpAfterSeconds; ToJsonUtilP(GiveUpAfterSeconds, each_GiveUpAfterSeconds); output["GiveUpAfterSeconds"] = each_GiveUpAfterSeconds;
-                Json::Value each_MatchId; ToJsonUtilS(MatchId, each_MatchId); output["MatchId"] = each_MatchId;
-                Json::Value each_Members; ToJsonUtilO(Members, each_Members); output["Members"] = each_Members;
-                Json::Value each_MembersToMatchWith; ToJsonUtilO(MembersToMatchWith, each_MembersToMatchWith); output["MembersToMatchWith"] = each_MembersToMatchWith;
-                Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); output["QueueName"] = each_QueueName;
-                Json::Value each_Status; ToJsonUtilS(Status, each_Status); output["Status"] = each_Status;
-                Json::Value each_TicketId; ToJsonUtilS(TicketId, each_TicketId); output["TicketId"] = each_TicketId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetMatchRequest : public PlayFabRequestCommon
@@ -4591,25 +2417,9 @@ namespace PlayFab
 
             ~GetMatchRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["EscapeObject"], EscapeObject);
-                FromJsonUtilS(input["MatchId"], MatchId);
-                FromJsonUtilS(input["QueueName"], QueueName);
-                FromJsonUtilP(input["ReturnMemberAttributes"], ReturnMemberAttributes);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_EscapeObject; ToJsonUtilP(EscapeObject, each_EscapeObject); output["EscapeObject"] = each_EscapeObject;
-                Json::Value each_MatchId; ToJsonUtilS(MatchId, each_MatchId); output["MatchId"] = each_MatchId;
-                Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); output["QueueName"] = each_QueueName;
-                Json::Value each_ReturnMemberAttributes; ToJsonUtilP(ReturnMemberAttributes, each_ReturnMemberAttributes); output["ReturnMemberAttributes"] = each_ReturnMemberAttributes;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetMatchResult : public PlayFabResultCommon
@@ -4637,23 +2447,9 @@ namespace PlayFab
 
             ~GetMatchResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["MatchId"], MatchId);
-                FromJsonUtilO(input["Members"], Members);
-                FromJsonUtilS(input["RegionPreferences"], RegionPreferences);
-                FromJsonUtilO(input["ServerDetails"], pfServerDetails);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_MatchId; ToJsonUtilS(MatchId, each_MatchId); output["MatchId"] = each_MatchId;
-                Json::Value each_Members; ToJsonUtilO(Members, each_Members); output["Members"] = each_Members;
-                Json::Value each_RegionPreferences; ToJsonUtilS(RegionPreferences, each_RegionPreferences); output["RegionPreferences"] = each_RegionPreferences;
-                Json::Value each_pfServerDetails; ToJsonUtilO(pfServerDetails, each_pfServerDetails); output["ServerDetails"] = each_pfServerDetails;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetMultiplayerServerDetailsRequest : public PlayFabRequestCommon
@@ -4681,23 +2477,9 @@ namespace PlayFab
 
             ~GetMultiplayerServerDetailsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["BuildId"], BuildId);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["Region"], Region);
-                FromJsonUtilS(input["SessionId"], SessionId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); output["BuildId"] = each_BuildId;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Region; ToJsonUtilS(Region, each_Region); output["Region"] = each_Region;
-                Json::Value each_SessionId; ToJsonUtilS(SessionId, each_SessionId); output["SessionId"] = each_SessionId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetMultiplayerServerDetailsResponse : public PlayFabResultCommon
@@ -4743,35 +2525,9 @@ namespace PlayFab
 
             ~GetMultiplayerServerDetailsResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["ConnectedPlayers"], ConnectedPlayers);
-                FromJsonUtilS(input["FQDN"], FQDN);
-                FromJsonUtilS(input["IPV4Address"], IPV4Address);
-                FromJsonUtilT(input["LastStateTransitionTime"], LastStateTransitionTime);
-                FromJsonUtilO(input["Ports"], Ports);
-                FromJsonUtilS(input["Region"], Region);
-                FromJsonUtilS(input["ServerId"], ServerId);
-                FromJsonUtilS(input["SessionId"], SessionId);
-                FromJsonUtilS(input["State"], State);
-                FromJsonUtilS(input["VmId"], VmId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ConnectedPlayers; ToJsonUtilO(ConnectedPlayers, each_ConnectedPlayers); output["ConnectedPlayers"] = each_ConnectedPlayers;
-                Json::Value each_FQDN; ToJsonUtilS(FQDN, each_FQDN); output["FQDN"] = each_FQDN;
-                Json::Value each_IPV4Address; ToJsonUtilS(IPV4Address, each_IPV4Address); output["IPV4Address"] = each_IPV4Address;
-                Json::Value each_LastStateTransitionTime; ToJsonUtilT(LastStateTransitionTime, each_LastStateTransitionTime); output["LastStateTransitionTime"] = each_LastStateTransitionTime;
-                Json::Value each_Ports; ToJsonUtilO(Ports, each_Ports); output["Ports"] = each_Ports;
-                Json::Value each_Region; ToJsonUtilS(Region, each_Region); output["Region"] = each_Region;
-                Json::Value each_ServerId; ToJsonUtilS(ServerId, each_ServerId); output["ServerId"] = each_ServerId;
-                Json::Value each_SessionId; ToJsonUtilS(SessionId, each_SessionId); output["SessionId"] = each_SessionId;
-                Json::Value each_State; ToJsonUtilS(State, each_State); output["State"] = each_State;
-                Json::Value each_VmId; ToJsonUtilS(VmId, each_VmId); output["VmId"] = each_VmId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetMultiplayerServerLogsRequest : public PlayFabRequestCommon
@@ -4793,19 +2549,9 @@ namespace PlayFab
 
             ~GetMultiplayerServerLogsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["ServerId"], ServerId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ServerId; ToJsonUtilS(ServerId, each_ServerId); output["ServerId"] = each_ServerId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetMultiplayerServerLogsResponse : public PlayFabResultCommon
@@ -4824,17 +2570,9 @@ namespace PlayFab
 
             ~GetMultiplayerServerLogsResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["LogDownloadUrl"], LogDownloadUrl);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_LogDownloadUrl; ToJsonUtilS(LogDownloadUrl, each_LogDownloadUrl); output["LogDownloadUrl"] = each_LogDownloadUrl;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetMultiplayerSessionLogsBySessionIdRequest : public PlayFabRequestCommon
@@ -4856,19 +2594,9 @@ namespace PlayFab
 
             ~GetMultiplayerSessionLogsBySessionIdRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["SessionId"], SessionId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_SessionId; ToJsonUtilS(SessionId, each_SessionId); output["SessionId"] = each_SessionId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetQueueStatisticsRequest : public PlayFabRequestCommon
@@ -4890,19 +2618,9 @@ namespace PlayFab
 
             ~GetQueueStatisticsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["QueueName"], QueueName);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); output["QueueName"] = each_QueueName;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct Statistics : public PlayFabBaseModel
@@ -4930,23 +2648,9 @@ namespace PlayFab
 
             ~Statistics() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["Average"], Average);
-                FromJsonUtilP(input["Percentile50"], Percentile50);
-                FromJsonUtilP(input["Percentile90"], Percentile90);
-                FromJsonUtilP(input["Percentile99"], Percentile99);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Average; ToJsonUtilP(Average, each_Average); output["Average"] = each_Average;
-                Json::Value each_Percentile50; ToJsonUtilP(Percentile50, each_Percentile50); output["Percentile50"] = each_Percentile50;
-                Json::Value each_Percentile90; ToJsonUtilP(Percentile90, each_Percentile90); output["Percentile90"] = each_Percentile90;
-                Json::Value each_Percentile99; ToJsonUtilP(Percentile99, each_Percentile99); output["Percentile99"] = each_Percentile99;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetQueueStatisticsResult : public PlayFabResultCommon
@@ -4968,19 +2672,9 @@ namespace PlayFab
 
             ~GetQueueStatisticsResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["NumberOfPlayersMatching"], NumberOfPlayersMatching);
-                FromJsonUtilO(input["TimeToMatchStatisticsInSeconds"], TimeToMatchStatisticsInSeconds);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_NumberOfPlayersMatching; ToJsonUtilP(NumberOfPlayersMatching, each_NumberOfPlayersMatching); output["NumberOfPlayersMatching"] = each_NumberOfPlayersMatching;
-                Json::Value each_TimeToMatchStatisticsInSeconds; ToJsonUtilO(TimeToMatchStatisticsInSeconds, each_TimeToMatchStatisticsInSeconds); output["TimeToMatchStatisticsInSeconds"] = each_TimeToMatchStatisticsInSeconds;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetRemoteLoginEndpointRequest : public PlayFabRequestCommon
@@ -5008,23 +2702,9 @@ namespace PlayFab
 
             ~GetRemoteLoginEndpointRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["BuildId"], BuildId);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["Region"], Region);
-                FromJsonUtilS(input["VmId"], VmId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); output["BuildId"] = each_BuildId;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Region; ToJsonUtilS(Region, each_Region); output["Region"] = each_Region;
-                Json::Value each_VmId; ToJsonUtilS(VmId, each_VmId); output["VmId"] = each_VmId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetRemoteLoginEndpointResponse : public PlayFabResultCommon
@@ -5046,19 +2726,9 @@ namespace PlayFab
 
             ~GetRemoteLoginEndpointResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["IPV4Address"], IPV4Address);
-                FromJsonUtilP(input["Port"], Port);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_IPV4Address; ToJsonUtilS(IPV4Address, each_IPV4Address); output["IPV4Address"] = each_IPV4Address;
-                Json::Value each_Port; ToJsonUtilP(Port, each_Port); output["Port"] = each_Port;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetServerBackfillTicketRequest : public PlayFabRequestCommon
@@ -5086,23 +2756,9 @@ namespace PlayFab
 
             ~GetServerBackfillTicketRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["EscapeObject"], EscapeObject);
-                FromJsonUtilS(input["QueueName"], QueueName);
-                FromJsonUtilS(input["TicketId"], TicketId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_EscapeObject; ToJsonUtilP(EscapeObject, each_EscapeObject); output["EscapeObject"] = each_EscapeObject;
-                Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); output["QueueName"] = each_QueueName;
-                Json::Value each_TicketId; ToJsonUtilS(TicketId, each_TicketId); output["TicketId"] = each_TicketId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetServerBackfillTicketResult : public PlayFabResultCommon
@@ -5145,33 +2801,9 @@ namespace PlayFab
 
             ~GetServerBackfillTicketResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CancellationReasonString"], CancellationReasonString);
-                FromJsonUtilT(input["Created"], Created);
-                FromJsonUtilP(input["GiveUpAfterSeconds"], GiveUpAfterSeconds);
-                FromJsonUtilS(input["MatchId"], MatchId);
-                FromJsonUtilO(input["Members"], Members);
-                FromJsonUtilS(input["QueueName"], QueueName);
-                FromJsonUtilO(input["ServerDetails"], pfServerDetails);
-                FromJsonUtilS(input["Status"], Status);
-                FromJsonUtilS(input["TicketId"], TicketId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CancellationReasonString; ToJsonUtilS(CancellationReasonString, each_CancellationReasonString); output["CancellationReasonString"] = each_CancellationReasonString;
-                Json::Value each_Created; ToJsonUtilT(Created, each_Created); output["Created"] = each_Created;
-                Json::Value each_GiveUpAfterSeconds; ToJsonUtilP(GiveUpAfterSeconds, each_GiveUpAfterSeconds); output["GiveUpAfterSeconds"] = each_GiveUpAfterSeconds;
-                Json::Value each_MatchId; ToJsonUtilS(MatchId, each_MatchId); output["MatchId"] = each_MatchId;
-                Json::Value each_Members; ToJsonUtilO(Members, each_Members); output["Members"] = each_Members;
-                Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); output["QueueName"] = each_QueueName;
-                Json::Value each_pfServerDetails; ToJsonUtilO(pfServerDetails, each_pfServerDetails); output["ServerDetails"] = each_pfServerDetails;
-                Json::Value each_Status; ToJsonUtilS(Status, each_Status); output["Status"] = each_Status;
-                Json::Value each_TicketId; ToJsonUtilS(TicketId, each_TicketId); output["TicketId"] = each_TicketId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetTitleEnabledForMultiplayerServersStatusRequest : public PlayFabRequestCommon
@@ -5190,17 +2822,9 @@ namespace PlayFab
 
             ~GetTitleEnabledForMultiplayerServersStatusRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetTitleEnabledForMultiplayerServersStatusResponse : public PlayFabResultCommon
@@ -5219,17 +2843,9 @@ namespace PlayFab
 
             ~GetTitleEnabledForMultiplayerServersStatusResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilE(input["Status"], Status);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Status; ToJsonUtilE(Status, each_Status); output["Status"] = each_Status;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetTitleMultiplayerServersQuotaChangeRequest : public PlayFabRequestCommon
@@ -5251,19 +2867,9 @@ namespace PlayFab
 
             ~GetTitleMultiplayerServersQuotaChangeRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["RequestId"], RequestId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_RequestId; ToJsonUtilS(RequestId, each_RequestId); output["RequestId"] = each_RequestId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct QuotaChange : public PlayFabBaseModel
@@ -5300,29 +2906,9 @@ namespace PlayFab
 
             ~QuotaChange() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["ChangeDescription"], ChangeDescription);
-                FromJsonUtilO(input["Changes"], Changes);
-                FromJsonUtilP(input["IsPendingReview"], IsPendingReview);
-                FromJsonUtilS(input["Notes"], Notes);
-                FromJsonUtilS(input["RequestId"], RequestId);
-                FromJsonUtilS(input["ReviewComments"], ReviewComments);
-                FromJsonUtilP(input["WasApproved"], WasApproved);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ChangeDescription; ToJsonUtilS(ChangeDescription, each_ChangeDescription); output["ChangeDescription"] = each_ChangeDescription;
-                Json::Value each_Changes; ToJsonUtilO(Changes, each_Changes); output["Changes"] = each_Changes;
-                Json::Value each_IsPendingReview; ToJsonUtilP(IsPendingReview, each_IsPendingReview); output["IsPendingReview"] = each_IsPendingReview;
-                Json::Value each_Notes; ToJsonUtilS(Notes, each_Notes); output["Notes"] = each_Notes;
-                Json::Value each_RequestId; ToJsonUtilS(RequestId, each_RequestId); output["RequestId"] = each_RequestId;
-                Json::Value each_ReviewComments; ToJsonUtilS(ReviewComments, each_ReviewComments); output["ReviewComments"] = each_ReviewComments;
-                Json::Value each_WasApproved; ToJsonUtilP(WasApproved, each_WasApproved); output["WasApproved"] = each_WasApproved;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetTitleMultiplayerServersQuotaChangeResponse : public PlayFabResultCommon
@@ -5341,17 +2927,9 @@ namespace PlayFab
 
             ~GetTitleMultiplayerServersQuotaChangeResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Change"], Change);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Change; ToJsonUtilO(Change, each_Change); output["Change"] = each_Change;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetTitleMultiplayerServersQuotasRequest : public PlayFabRequestCommon
@@ -5370,17 +2948,9 @@ namespace PlayFab
 
             ~GetTitleMultiplayerServersQuotasRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct TitleMultiplayerServersQuotas : public PlayFabBaseModel
@@ -5399,17 +2969,9 @@ namespace PlayFab
 
             ~TitleMultiplayerServersQuotas() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["CoreCapacities"], CoreCapacities);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CoreCapacities; ToJsonUtilO(CoreCapacities, each_CoreCapacities); output["CoreCapacities"] = each_CoreCapacities;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct GetTitleMultiplayerServersQuotasResponse : public PlayFabResultCommon
@@ -5428,17 +2990,9 @@ namespace PlayFab
 
             ~GetTitleMultiplayerServersQuotasResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Quotas"], Quotas);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Quotas; ToJsonUtilO(Quotas, each_Quotas); output["Quotas"] = each_Quotas;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct JoinMatchmakingTicketRequest : public PlayFabRequestCommon
@@ -5466,23 +3020,9 @@ namespace PlayFab
 
             ~JoinMatchmakingTicketRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Member"], Member);
-                FromJsonUtilS(input["QueueName"], QueueName);
-                FromJsonUtilS(input["TicketId"], TicketId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Member; ToJsonUtilO(Member, each_Member); output["Member"] = each_Member;
-                Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); output["QueueName"] = each_QueueName;
-                Json::Value each_TicketId; ToJsonUtilS(TicketId, each_TicketId); output["TicketId"] = each_TicketId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct JoinMatchmakingTicketResult : public PlayFabResultCommon
@@ -5498,15 +3038,9 @@ namespace PlayFab
 
             ~JoinMatchmakingTicketResult() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ListAssetSummariesRequest : public PlayFabRequestCommon
@@ -5531,21 +3065,9 @@ namespace PlayFab
 
             ~ListAssetSummariesRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["PageSize"], PageSize);
-                FromJsonUtilS(input["SkipToken"], SkipToken);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_PageSize; ToJsonUtilP(PageSize, each_PageSize); output["PageSize"] = each_PageSize;
-                Json::Value each_SkipToken; ToJsonUtilS(SkipToken, each_SkipToken); output["SkipToken"] = each_SkipToken;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ListAssetSummariesResponse : public PlayFabResultCommon
@@ -5570,21 +3092,9 @@ namespace PlayFab
 
             ~ListAssetSummariesResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["AssetSummaries"], AssetSummaries);
-                FromJsonUtilP(input["PageSize"], PageSize);
-                FromJsonUtilS(input["SkipToken"], SkipToken);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AssetSummaries; ToJsonUtilO(AssetSummaries, each_AssetSummaries); output["AssetSummaries"] = each_AssetSummaries;
-                Json::Value each_PageSize; ToJsonUtilP(PageSize, each_PageSize); output["PageSize"] = each_PageSize;
-                Json::Value each_SkipToken; ToJsonUtilS(SkipToken, each_SkipToken); output["SkipToken"] = each_SkipToken;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ListBuildAliasesForTitleResponse : public PlayFabResultCommon
@@ -5603,17 +3113,9 @@ namespace PlayFab
 
             ~ListBuildAliasesForTitleResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["BuildAliases"], BuildAliases);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_BuildAliases; ToJsonUtilO(BuildAliases, each_BuildAliases); output["BuildAliases"] = each_BuildAliases;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ListBuildSummariesRequest : public PlayFabRequestCommon
@@ -5638,21 +3140,9 @@ namespace PlayFab
 
             ~ListBuildSummariesRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["PageSize"], PageSize);
-                FromJsonUtilS(input["SkipToken"], SkipToken);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_PageSize; ToJsonUtilP(PageSize, each_PageSize); output["PageSize"] = each_PageSize;
-                Json::Value each_SkipToken; ToJsonUtilS(SkipToken, each_SkipToken); output["SkipToken"] = each_SkipToken;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ListBuildSummariesResponse : public PlayFabResultCommon
@@ -5677,21 +3167,9 @@ namespace PlayFab
 
             ~ListBuildSummariesResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["BuildSummaries"], BuildSummaries);
-                FromJsonUtilP(input["PageSize"], PageSize);
-                FromJsonUtilS(input["SkipToken"], SkipToken);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_BuildSummaries; ToJsonUtilO(BuildSummaries, each_BuildSummaries); output["BuildSummaries"] = each_BuildSummaries;
-                Json::Value each_PageSize; ToJsonUtilP(PageSize, each_PageSize); output["PageSize"] = each_PageSize;
-                Json::Value each_SkipToken; ToJsonUtilS(SkipToken, each_SkipToken); output["SkipToken"] = each_SkipToken;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ListCertificateSummariesRequest : public PlayFabRequestCommon
@@ -5716,21 +3194,9 @@ namespace PlayFab
 
             ~ListCertificateSummariesRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["PageSize"], PageSize);
-                FromJsonUtilS(input["SkipToken"], SkipToken);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_PageSize; ToJsonUtilP(PageSize, each_PageSize); output["PageSize"] = each_PageSize;
-                Json::Value each_SkipToken; ToJsonUtilS(SkipToken, each_SkipToken); output["SkipToken"] = each_SkipToken;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ListCertificateSummariesResponse : public PlayFabResultCommon
@@ -5755,21 +3221,9 @@ namespace PlayFab
 
             ~ListCertificateSummariesResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["CertificateSummaries"], CertificateSummaries);
-                FromJsonUtilP(input["PageSize"], PageSize);
-                FromJsonUtilS(input["SkipToken"], SkipToken);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CertificateSummaries; ToJsonUtilO(CertificateSummaries, each_CertificateSummaries); output["CertificateSummaries"] = each_CertificateSummaries;
-                Json::Value each_PageSize; ToJsonUtilP(PageSize, each_PageSize); output["PageSize"] = each_PageSize;
-                Json::Value each_SkipToken; ToJsonUtilS(SkipToken, each_SkipToken); output["SkipToken"] = each_SkipToken;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ListContainerImagesRequest : public PlayFabRequestCommon
@@ -5794,21 +3248,9 @@ namespace PlayFab
 
             ~ListContainerImagesRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["PageSize"], PageSize);
-                FromJsonUtilS(input["SkipToken"], SkipToken);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_PageSize; ToJsonUtilP(PageSize, each_PageSize); output["PageSize"] = each_PageSize;
-                Json::Value each_SkipToken; ToJsonUtilS(SkipToken, each_SkipToken); output["SkipToken"] = each_SkipToken;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ListContainerImagesResponse : public PlayFabResultCommon
@@ -5833,21 +3275,9 @@ namespace PlayFab
 
             ~ListContainerImagesResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Images"], Images);
-                FromJsonUtilP(input["PageSize"], PageSize);
-                FromJsonUtilS(input["SkipToken"], SkipToken);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Images; ToJsonUtilS(Images, each_Images); output["Images"] = each_Images;
-                Json::Value each_PageSize; ToJsonUtilP(PageSize, each_PageSize); output["PageSize"] = each_PageSize;
-                Json::Value each_SkipToken; ToJsonUtilS(SkipToken, each_SkipToken); output["SkipToken"] = each_SkipToken;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ListContainerImageTagsRequest : public PlayFabRequestCommon
@@ -5869,19 +3299,9 @@ namespace PlayFab
 
             ~ListContainerImageTagsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["ImageName"], ImageName);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ImageName; ToJsonUtilS(ImageName, each_ImageName); output["ImageName"] = each_ImageName;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ListContainerImageTagsResponse : public PlayFabResultCommon
@@ -5900,17 +3320,9 @@ namespace PlayFab
 
             ~ListContainerImageTagsResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Tags"], Tags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Tags; ToJsonUtilS(Tags, each_Tags); output["Tags"] = each_Tags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ListMatchmakingTicketsForPlayerRequest : public PlayFabRequestCommon
@@ -5935,21 +3347,9 @@ namespace PlayFab
 
             ~ListMatchmakingTicketsForPlayerRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilS(input["QueueName"], QueueName);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); output["QueueName"] = each_QueueName;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ListMatchmakingTicketsForPlayerResult : public PlayFabResultCommon
@@ -5968,17 +3368,9 @@ namespace PlayFab
 
             ~ListMatchmakingTicketsForPlayerResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["TicketIds"], TicketIds);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_TicketIds; ToJsonUtilS(TicketIds, each_TicketIds); output["TicketIds"] = each_TicketIds;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ListMultiplayerServersRequest : public PlayFabRequestCommon
@@ -6009,25 +3401,9 @@ namespace PlayFab
 
             ~ListMultiplayerServersRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["BuildId"], BuildId);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["PageSize"], PageSize);
-                FromJsonUtilS(input["Region"], Region);
-                FromJsonUtilS(input["SkipToken"], SkipToken);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); output["BuildId"] = each_BuildId;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_PageSize; ToJsonUtilP(PageSize, each_PageSize); output["PageSize"] = each_PageSize;
-                Json::Value each_Region; ToJsonUtilS(Region, each_Region); output["Region"] = each_Region;
-                Json::Value each_SkipToken; ToJsonUtilS(SkipToken, each_SkipToken); output["SkipToken"] = each_SkipToken;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct MultiplayerServerSummary : public PlayFabBaseModel
@@ -6064,29 +3440,9 @@ namespace PlayFab
 
             ~MultiplayerServerSummary() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["ConnectedPlayers"], ConnectedPlayers);
-                FromJsonUtilT(input["LastStateTransitionTime"], LastStateTransitionTime);
-                FromJsonUtilS(input["Region"], Region);
-                FromJsonUtilS(input["ServerId"], ServerId);
-                FromJsonUtilS(input["SessionId"], SessionId);
-                FromJsonUtilS(input["State"], State);
-                FromJsonUtilS(input["VmId"], VmId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ConnectedPlayers; ToJsonUtilO(ConnectedPlayers, each_ConnectedPlayers); output["ConnectedPlayers"] = each_ConnectedPlayers;
-                Json::Value each_LastStateTransitionTime; ToJsonUtilT(LastStateTransitionTime, each_LastStateTransitionTime); output["LastStateTransitionTime"] = each_LastStateTransitionTime;
-                Json::Value each_Region; ToJsonUtilS(Region, each_Region); output["Region"] = each_Region;
-                Json::Value each_ServerId; ToJsonUtilS(ServerId, each_ServerId); output["ServerId"] = each_ServerId;
-                Json::Value each_SessionId; ToJsonUtilS(SessionId, each_SessionId); output["SessionId"] = each_SessionId;
-                Json::Value each_State; ToJsonUtilS(State, each_State); output["State"] = each_State;
-                Json::Value each_VmId; ToJsonUtilS(VmId, each_VmId); output["VmId"] = each_VmId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct ListMultiplayerServersResponse : public PlayFabResultCommon
@@ -6111,21 +3467,9 @@ namespace PlayFab
 
             ~ListMultiplayerServersResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["MultiplayerServerSummaries"], MultiplayerServerSummaries);
-                FromJsonUtilP(input["PageSize"], PageSize);
-                FromJsonUtilS(input["SkipToken"], SkipToken);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_MultiplayerServerSummaries; ToJsonUtilO(MultiplayerServerSummaries, each_MultiplayerServerSummaries); output["MultiplayerServerSummaries"] = each_MultiplayerServerSummaries;
-                Json::Value each_PageSize; ToJsonUtilP(PageSize, each_PageSize); output["PageSize"] = each_PageSize;
-                Json::Value each_SkipToken; ToJsonUtilS(SkipToken, each_SkipToken); output["SkipToken"] = each_SkipToken;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ListPartyQosServersRequest : public PlayFabRequestCommon
@@ -6144,17 +3488,9 @@ namespace PlayFab
 
             ~ListPartyQosServersRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct QosServer : public PlayFabBaseModel
@@ -6176,19 +3512,9 @@ namespace PlayFab
 
             ~QosServer() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Region"], Region);
-                FromJsonUtilS(input["ServerUrl"], ServerUrl);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Region; ToJsonUtilS(Region, each_Region); output["Region"] = each_Region;
-                Json::Value each_ServerUrl; ToJsonUtilS(ServerUrl, each_ServerUrl); output["ServerUrl"] = each_ServerUrl;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ListPartyQosServersResponse : public PlayFabResultCommon
@@ -6213,21 +3539,9 @@ namespace PlayFab
 
             ~ListPartyQosServersResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["PageSize"], PageSize);
-                FromJsonUtilO(input["QosServers"], QosServers);
-                FromJsonUtilS(input["SkipToken"], SkipToken);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_PageSize; ToJsonUtilP(PageSize, each_PageSize); output["PageSize"] = each_PageSize;
-                Json::Value each_QosServers; ToJsonUtilO(QosServers, each_QosServers); output["QosServers"] = each_QosServers;
-                Json::Value each_SkipToken; ToJsonUtilS(SkipToken, each_SkipToken); output["SkipToken"] = each_SkipToken;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ListQosServersForTitleRequest : public PlayFabRequestCommon
@@ -6249,19 +3563,9 @@ namespace PlayFab
 
             ~ListQosServersForTitleRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["IncludeAllRegions"], IncludeAllRegions);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_IncludeAllRegions; ToJsonUtilP(IncludeAllRegions, each_IncludeAllRegions); output["IncludeAllRegions"] = each_IncludeAllRegions;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ListQosServersForTitleResponse : public PlayFabResultCommon
@@ -6286,21 +3590,9 @@ namespace PlayFab
 
             ~ListQosServersForTitleResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["PageSize"], PageSize);
-                FromJsonUtilO(input["QosServers"], QosServers);
-                FromJsonUtilS(input["SkipToken"], SkipToken);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_PageSize; ToJsonUtilP(PageSize, each_PageSize); output["PageSize"] = each_PageSize;
-                Json::Value each_QosServers; ToJsonUtilO(QosServers, each_QosServers); output["QosServers"] = each_QosServers;
-                Json::Value each_SkipToken; ToJsonUtilS(SkipToken, each_SkipToken); output["SkipToken"] = each_SkipToken;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ListServerBackfillTicketsForPlayerRequest : public PlayFabRequestCommon
@@ -6325,21 +3617,9 @@ namespace PlayFab
 
             ~ListServerBackfillTicketsForPlayerRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilS(input["QueueName"], QueueName);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); output["QueueName"] = each_QueueName;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ListServerBackfillTicketsForPlayerResult : public PlayFabResultCommon
@@ -6358,17 +3638,9 @@ namespace PlayFab
 
             ~ListServerBackfillTicketsForPlayerResult() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["TicketIds"], TicketIds);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_TicketIds; ToJsonUtilS(TicketIds, each_TicketIds); output["TicketIds"] = each_TicketIds;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ListTitleMultiplayerServersQuotaChangesRequest : public PlayFabRequestCommon
@@ -6387,17 +3659,9 @@ namespace PlayFab
 
             ~ListTitleMultiplayerServersQuotaChangesRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ListTitleMultiplayerServersQuotaChangesResponse : public PlayFabResultCommon
@@ -6416,17 +3680,9 @@ namespace PlayFab
 
             ~ListTitleMultiplayerServersQuotaChangesResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Changes"], Changes);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Changes; ToJsonUtilO(Changes, each_Changes); output["Changes"] = each_Changes;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ListVirtualMachineSummariesRequest : public PlayFabRequestCommon
@@ -6457,25 +3713,9 @@ namespace PlayFab
 
             ~ListVirtualMachineSummariesRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["BuildId"], BuildId);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["PageSize"], PageSize);
-                FromJsonUtilS(input["Region"], Region);
-                FromJsonUtilS(input["SkipToken"], SkipToken);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); output["BuildId"] = each_BuildId;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_PageSize; ToJsonUtilP(PageSize, each_PageSize); output["PageSize"] = each_PageSize;
-                Json::Value each_Region; ToJsonUtilS(Region, each_Region); output["Region"] = each_Region;
-                Json::Value each_SkipToken; ToJsonUtilS(SkipToken, each_SkipToken); output["SkipToken"] = each_SkipToken;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct VirtualMachineSummary : public PlayFabBaseModel
@@ -6500,21 +3740,9 @@ namespace PlayFab
 
             ~VirtualMachineSummary() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["HealthStatus"], HealthStatus);
-                FromJsonUtilS(input["State"], State);
-                FromJsonUtilS(input["VmId"], VmId);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_HealthStatus; ToJsonUtilS(HealthStatus, each_HealthStatus); output["HealthStatus"] = each_HealthStatus;
-                Json::Value each_State; ToJsonUtilS(State, each_State); output["State"] = each_State;
-                Json::Value each_VmId; ToJsonUtilS(VmId, each_VmId); output["VmId"] = each_VmId;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ListVirtualMachineSummariesResponse : public PlayFabResultCommon
@@ -6539,21 +3767,9 @@ namespace PlayFab
 
             ~ListVirtualMachineSummariesResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilP(input["PageSize"], PageSize);
-                FromJsonUtilS(input["SkipToken"], SkipToken);
-                FromJsonUtilO(input["VirtualMachines"], VirtualMachines);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_PageSize; ToJsonUtilP(PageSize, each_PageSize); output["PageSize"] = each_PageSize;
-                Json::Value each_SkipToken; ToJsonUtilS(SkipToken, each_SkipToken); output["SkipToken"] = each_SkipToken;
-                Json::Value each_VirtualMachines; ToJsonUtilO(VirtualMachines, each_VirtualMachines); output["VirtualMachines"] = each_VirtualMachines;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct MultiplayerEmptyRequest : public PlayFabRequestCommon
@@ -6572,17 +3788,9 @@ namespace PlayFab
 
             ~MultiplayerEmptyRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct RequestMultiplayerServerRequest : public PlayFabRequestCommon
@@ -6619,29 +3827,9 @@ namespace PlayFab
 
             ~RequestMultiplayerServerRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["BuildAliasParams"], pfBuildAliasParams);
-                FromJsonUtilS(input["BuildId"], BuildId);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["InitialPlayers"], InitialPlayers);
-                FromJsonUtilS(input["PreferredRegions"], PreferredRegions);
-                FromJsonUtilS(input["SessionCookie"], SessionCookie);
-                FromJsonUtilS(input["SessionId"], SessionId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_pfBuildAliasParams; ToJsonUtilO(pfBuildAliasParams, each_pfBuildAliasParams); output["BuildAliasParams"] = each_pfBuildAliasParams;
-                Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); output["BuildId"] = each_BuildId;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_InitialPlayers; ToJsonUtilS(InitialPlayers, each_InitialPlayers); output["InitialPlayers"] = each_InitialPlayers;
-                Json::Value each_PreferredRegions; ToJsonUtilS(PreferredRegions, each_PreferredRegions); output["PreferredRegions"] = each_PreferredRegions;
-                Json::Value each_SessionCookie; ToJsonUtilS(SessionCookie, each_SessionCookie); output["SessionCookie"] = each_SessionCookie;
-                Json::Value each_SessionId; ToJsonUtilS(SessionId, each_SessionId); output["SessionId"] = each_SessionId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct RequestMultiplayerServerResponse : public PlayFabResultCommon
@@ -6687,35 +3875,9 @@ namespace PlayFab
 
             ~RequestMultiplayerServerResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["ConnectedPlayers"], ConnectedPlayers);
-                FromJsonUtilS(input["FQDN"], FQDN);
-                FromJsonUtilS(input["IPV4Address"], IPV4Address);
-                FromJsonUtilT(input["LastStateTransitionTime"], LastStateTransitionTime);
-                FromJsonUtilO(input["Ports"], Ports);
-                FromJsonUtilS(input["Region"], Region);
-                FromJsonUtilS(input["ServerId"], ServerId);
-                FromJsonUtilS(input["SessionId"], SessionId);
-                FromJsonUtilS(input["State"], State);
-                FromJsonUtilS(input["VmId"], VmId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ConnectedPlayers; ToJsonUtilO(ConnectedPlayers, each_ConnectedPlayers); output["ConnectedPlayers"] = each_ConnectedPlayers;
-                Json::Value each_FQDN; ToJsonUtilS(FQDN, each_FQDN); output["FQDN"] = each_FQDN;
-                Json::Value each_IPV4Address; ToJsonUtilS(IPV4Address, each_IPV4Address); output["IPV4Address"] = each_IPV4Address;
-                Json::Value each_LastStateTransitionTime; ToJsonUtilT(LastStateTransitionTime, each_LastStateTransitionTime); output["LastStateTransitionTime"] = each_LastStateTransitionTime;
-                Json::Value each_Ports; ToJsonUtilO(Ports, each_Ports); output["Ports"] = each_Ports;
-                Json::Value each_Region; ToJsonUtilS(Region, each_Region); output["Region"] = each_Region;
-                Json::Value each_ServerId; ToJsonUtilS(ServerId, each_ServerId); output["ServerId"] = each_ServerId;
-                Json::Value each_SessionId; ToJsonUtilS(SessionId, each_SessionId); output["SessionId"] = each_SessionId;
-                Json::Value each_State; ToJsonUtilS(State, each_State); output["State"] = each_State;
-                Json::Value each_VmId; ToJsonUtilS(VmId, each_VmId); output["VmId"] = each_VmId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct RolloverContainerRegistryCredentialsRequest : public PlayFabRequestCommon
@@ -6734,17 +3896,9 @@ namespace PlayFab
 
             ~RolloverContainerRegistryCredentialsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct RolloverContainerRegistryCredentialsResponse : public PlayFabResultCommon
@@ -6769,21 +3923,9 @@ namespace PlayFab
 
             ~RolloverContainerRegistryCredentialsResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["DnsName"], DnsName);
-                FromJsonUtilS(input["Password"], Password);
-                FromJsonUtilS(input["Username"], Username);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_DnsName; ToJsonUtilS(DnsName, each_DnsName); output["DnsName"] = each_DnsName;
-                Json::Value each_Password; ToJsonUtilS(Password, each_Password); output["Password"] = each_Password;
-                Json::Value each_Username; ToJsonUtilS(Username, each_Username); output["Username"] = each_Username;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct ShutdownMultiplayerServerRequest : public PlayFabRequestCommon
@@ -6811,23 +3953,9 @@ namespace PlayFab
 
             ~ShutdownMultiplayerServerRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["BuildId"], BuildId);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["Region"], Region);
-                FromJsonUtilS(input["SessionId"], SessionId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); output["BuildId"] = each_BuildId;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Region; ToJsonUtilS(Region, each_Region); output["Region"] = each_Region;
-                Json::Value each_SessionId; ToJsonUtilS(SessionId, each_SessionId); output["SessionId"] = each_SessionId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct UntagContainerImageRequest : public PlayFabRequestCommon
@@ -6852,21 +3980,9 @@ namespace PlayFab
 
             ~UntagContainerImageRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["ImageName"], ImageName);
-                FromJsonUtilS(input["Tag"], Tag);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_ImageName; ToJsonUtilS(ImageName, each_ImageName); output["ImageName"] = each_ImageName;
-                Json::Value each_Tag; ToJsonUtilS(Tag, each_Tag); output["Tag"] = each_Tag;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UpdateBuildAliasRequest : public PlayFabRequestCommon
@@ -6894,23 +4010,9 @@ namespace PlayFab
 
             ~UpdateBuildAliasRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["AliasId"], AliasId);
-                FromJsonUtilS(input["AliasName"], AliasName);
-                FromJsonUtilO(input["BuildSelectionCriteria"], BuildSelectionCriteria);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AliasId; ToJsonUtilS(AliasId, each_AliasId); output["AliasId"] = each_AliasId;
-                Json::Value each_AliasName; ToJsonUtilS(AliasName, each_AliasName); output["AliasName"] = each_AliasName;
-                Json::Value each_BuildSelectionCriteria; ToJsonUtilO(BuildSelectionCriteria, each_BuildSelectionCriteria); output["BuildSelectionCriteria"] = each_BuildSelectionCriteria;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct UpdateBuildNameRequest : public PlayFabRequestCommon
@@ -6935,21 +4037,9 @@ namespace PlayFab
 
             ~UpdateBuildNameRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["BuildId"], BuildId);
-                FromJsonUtilS(input["BuildName"], BuildName);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); output["BuildId"] = each_BuildId;
-                Json::Value each_BuildName; ToJsonUtilS(BuildName, each_BuildName); output["BuildName"] = each_BuildName;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UpdateBuildRegionRequest : public PlayFabRequestCommon
@@ -6974,21 +4064,9 @@ namespace PlayFab
 
             ~UpdateBuildRegionRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["BuildId"], BuildId);
-                FromJsonUtilO(input["BuildRegion"], BuildRegion);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); output["BuildId"] = each_BuildId;
-                Json::Value each_BuildRegion; ToJsonUtilO(BuildRegion, each_BuildRegion); output["BuildRegion"] = each_BuildRegion;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UpdateBuildRegionsRequest : public PlayFabRequestCommon
@@ -7013,21 +4091,9 @@ namespace PlayFab
 
             ~UpdateBuildRegionsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["BuildId"], BuildId);
-                FromJsonUtilO(input["BuildRegions"], BuildRegions);
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
+            void FromJson(const Json::Value& input) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); output["BuildId"] = each_BuildId;
-                Json::Value each_BuildRegions; ToJsonUtilO(BuildRegions, each_BuildRegions); output["BuildRegions"] = each_BuildRegions;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct UploadCertificateRequest : public PlayFabRequestCommon
@@ -7049,19 +4115,9 @@ namespace PlayFab
 
             ~UploadCertificateRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["GameCertificate"], GameCertificate);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_GameCertificate; ToJsonUtilO(GameCertificate, each_GameCertificate); output["GameCertificate"] = each_GameCertificate;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
     }
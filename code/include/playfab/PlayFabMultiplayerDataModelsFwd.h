@@ -0,0 +1,160 @@
+#pragma once
+
+#if !defined(DISABLE_PLAYFABENTITY_API)
+
+namespace PlayFab
+{
+    namespace MultiplayerModels
+    {
+        // Forward declarations of the Multiplayer models, for headers which only pass them by reference
+        enum class AzureRegion;
+        enum class AzureVmFamily;
+        enum class AzureVmSize;
+        enum class CancellationReason;
+        enum class ContainerFlavor;
+        enum class OsPlatform;
+        enum class ProtocolType;
+        enum class ServerType;
+        enum class TitleMultiplayerServerEnabledStatus;
+
+        struct AssetReference;
+        struct AssetReferenceParams;
+        struct AssetSummary;
+        struct BuildSelectionCriterion;
+        struct BuildAliasDetailsResponse;
+        struct BuildAliasParams;
+        struct CurrentServerStats;
+        struct DynamicStandbyThreshold;
+        struct DynamicStandbySettings;
+        struct Schedule;
+        struct ScheduledStandbySettings;
+        struct BuildRegion;
+        struct BuildRegionParams;
+        struct BuildSummary;
+        struct EntityKey;
+        struct CancelAllMatchmakingTicketsForPlayerRequest;
+        struct CancelAllMatchmakingTicketsForPlayerResult;
+        struct CancelAllServerBackfillTicketsForPlayerRequest;
+        struct CancelAllServerBackfillTicketsForPlayerResult;
+        struct CancelMatchmakingTicketRequest;
+        struct CancelMatchmakingTicketResult;
+        struct CancelServerBackfillTicketRequest;
+        struct CancelServerBackfillTicketResult;
+        struct Certificate;
+        struct CertificateSummary;
+        struct ConnectedPlayer;
+        struct ContainerImageReference;
+        struct CoreCapacity;
+        struct CoreCapacityChange;
+        struct CreateBuildAliasRequest;
+        struct GameCertificateReferenceParams;
+        struct LinuxInstrumentationConfiguration;
+        struct Port;
+        struct CreateBuildWithCustomContainerRequest;
+        struct GameCertificateReference;
+        struct CreateBuildWithCustomContainerResponse;
+        struct InstrumentationConfiguration;
+        struct CreateBuildWithManagedContainerRequest;
+        struct CreateBuildWithManagedContainerResponse;
+        struct CreateBuildWithProcessBasedServerRequest;
+        struct CreateBuildWithProcessBasedServerResponse;
+        struct MatchmakingPlayerAttributes;
+        struct MatchmakingPlayer;
+        struct CreateMatchmakingTicketRequest;
+        struct CreateMatchmakingTicketResult;
+        struct CreateRemoteUserRequest;
+        struct CreateRemoteUserResponse;
+        struct MatchmakingPlayerWithTeamAssignment;
+        struct ServerDetails;
+        struct CreateServerBackfillTicketRequest;
+        struct CreateServerBackfillTicketResult;
+        struct CreateServerMatchmakingTicketRequest;
+        struct CreateTitleMultiplayerServersQuotaChangeRequest;
+        struct CreateTitleMultiplayerServersQuotaChangeResponse;
+        struct DeleteAssetRequest;
+        struct DeleteBuildAliasRequest;
+        struct DeleteBuildRegionRequest;
+        struct DeleteBuildRequest;
+        struct DeleteCertificateRequest;
+        struct DeleteContainerImageRequest;
+        struct DeleteRemoteUserRequest;
+        struct EmptyResponse;
+        struct EnableMultiplayerServersForTitleRequest;
+        struct EnableMultiplayerServersForTitleResponse;
+        struct GetAssetUploadUrlRequest;
+        struct GetAssetUploadUrlResponse;
+        struct GetBuildAliasRequest;
+        struct GetBuildRequest;
+        struct GetBuildResponse;
+        struct GetContainerRegistryCredentialsRequest;
+        struct GetContainerRegistryCredentialsResponse;
+        struct GetMatchmakingTicketRequest;
+        struct GetMatchmakingTicketResult;
+        struct GetMatchRequest;
+        struct GetMatchResult;
+        struct GetMultiplayerServerDetailsRequest;
+        struct GetMultiplayerServerDetailsResponse;
+        struct GetMultiplayerServerLogsRequest;
+        struct GetMultiplayerServerLogsResponse;
+        struct GetMultiplayerSessionLogsBySessionIdRequest;
+        struct GetQueueStatisticsRequest;
+        struct Statistics;
+        struct GetQueueStatisticsResult;
+        struct GetRemoteLoginEndpointRequest;
+        struct GetRemoteLoginEndpointResponse;
+        struct GetServerBackfillTicketRequest;
+        struct GetServerBackfillTicketResult;
+        struct GetTitleEnabledForMultiplayerServersStatusRequest;
+        struct GetTitleEnabledForMultiplayerServersStatusResponse;
+        struct GetTitleMultiplayerServersQuotaChangeRequest;
+        struct QuotaChange;
+        struct GetTitleMultiplayerServersQuotaChangeResponse;
+        struct GetTitleMultiplayerServersQuotasRequest;
+        struct TitleMultiplayerServersQuotas;
+        struct GetTitleMultiplayerServersQuotasResponse;
+        struct JoinMatchmakingTicketRequest;
+        struct JoinMatchmakingTicketResult;
+        struct ListAssetSummariesRequest;
+        struct ListAssetSummariesResponse;
+        struct ListBuildAliasesForTitleResponse;
+        struct ListBuildSummariesRequest;
+        struct ListBuildSummariesResponse;
+        struct ListCertificateSummariesRequest;
+        struct ListCertificateSummariesResponse;
+        struct ListContainerImagesRequest;
+        struct ListContainerImagesResponse;
+        struct ListContainerImageTagsRequest;
+        struct ListContainerImageTagsResponse;
+        struct ListMatchmakingTicketsForPlayerRequest;
+        struct ListMatchmakingTicketsForPlayerResult;
+        struct ListMultiplayerServersRequest;
+        struct MultiplayerServerSummary;
+        struct ListMultiplayerServersResponse;
+        struct ListPartyQosServersRequest;
+        struct QosServer;
+        struct ListPartyQosServersResponse;
+        struct ListQosServersForTitleRequest;
+        struct ListQosServersForTitleResponse;
+        struct ListServerBackfillTicketsForPlayerRequest;
+        struct ListServerBackfillTicketsForPlayerResult;
+        struct ListTitleMultiplayerServersQuotaChangesRequest;
+        struct ListTitleMultiplayerServersQuotaChangesResponse;
+        struct ListVirtualMachineSummariesRequest;
+        struct VirtualMachineSummary;
+        struct ListVirtualMachineSummariesResponse;
+        struct MultiplayerEmptyRequest;
+        struct RequestMultiplayerServerRequest;
+        struct RequestMultiplayerServerResponse;
+        struct RolloverContainerRegistryCredentialsRequest;
+        struct RolloverContainerRegistryCredentialsResponse;
+        struct ShutdownMultiplayerServerRequest;
+        struct UntagContainerImageRequest;
+        struct UpdateBuildAliasRequest;
+        struct UpdateBuildNameRequest;
+        struct UpdateBuildRegionRequest;
+        struct UpdateBuildRegionsRequest;
+        struct UploadCertificateRequest;
+    }
+}
+
+#endif
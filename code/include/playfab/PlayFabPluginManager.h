@@ -2,6 +2,7 @@
 
 #include <playfab/PlayFabCallRequestContainer.h>
 #include <playfab/PlayFabError.h>
+#include <atomic>
 #include <mutex>
 #include <unordered_map>
 
@@ -47,9 +48,40 @@ namespace PlayFab
 
     /// <summary>
     /// Interface of any data serializer SDK plugin.
+    /// Models are converted to and from Json::Value by their ToJson/FromJson methods; a serializer turns that value into bytes and back.
+    /// It is meant for local persistence, caching and IPC of models. Requests sent to PlayFab services are always json.
     /// </summary>
     class IPlayFabSerializerPlugin : public IPlayFabPlugin
     {
+    public:
+        virtual ~IPlayFabSerializerPlugin() = default;
+
+        /// <summary>
+        /// Serializes input and appends the result to output.
+        /// </summary>
+        virtual void Serialize(const Json::Value& input, std::string& output) = 0;
+
+        /// <summary>
+        /// Deserializes the bytes in range [data, data + length) into output.
+        /// Returns false and fills errors if the data can't be deserialized.
+        /// </summary>
+        virtual bool Deserialize(const char* data, size_t length, Json::Value& output, std::string& errors) = 0;
+
+        void SerializeModel(const PlayFabBaseModel& model, std::string& output)
+        {
+            Serialize(model.ToJson(), output);
+        }
+
+        bool DeserializeModel(const char* data, size_t length, PlayFabBaseModel& model, std::string& errors)
+        {
+            Json::Value modelJson;
+            if (!Deserialize(data, length, modelJson, errors))
+            {
+                return false;
+            }
+            model.FromJson(modelJson);
+            return true;
+        }
     };
 
     /// <summary>
@@ -74,6 +106,7 @@ namespace PlayFab
 
         // Gets a plugin.
         // If a plugin with specified contract and optional instance name does not exist, it will create a new one.
+        // Lookups with the default instance name are served from a per-thread cache and don't take any lock while the plugin set is unchanged.
         template <typename T>
         static std::shared_ptr<T> GetPlugin(const PlayFabPluginContract contract, const std::string& instanceName = defaultInstanceName)
         {
@@ -111,6 +144,7 @@ namespace PlayFab
         };
 
         std::shared_ptr<IPlayFabPlugin> GetPluginInternal(const PlayFabPluginContract contract, const std::string& instanceName = defaultInstanceName);
+        std::shared_ptr<IPlayFabPlugin> GetPluginLocked(const PlayFabPluginContract contract, const std::string& instanceName, uint64_t& generation);
         void SetPluginInternal(const std::shared_ptr<IPlayFabPlugin>& plugin, const PlayFabPluginContract contract, const std::string& instanceName = defaultInstanceName);
         PluginEntry& FindOrCreatePluginEntry(PlayFabPluginContract contract, const std::string& instanceName = defaultInstanceName);
 
@@ -120,6 +154,9 @@ namespace PlayFab
     private:
         std::mutex pluginsMutex;
         std::vector<PluginEntry> plugins;
+        // Changes every time a plugin is created or replaced. Values are unique across all manager instances,
+        // so a per-thread cached lookup is valid only while it still matches this manager's current generation.
+        std::atomic<uint64_t> pluginsGeneration;
         std::mutex userExceptionCallbackMutex;
         ExceptionCallback userExceptionCallback;
     };
@@ -2,6 +2,7 @@
 
 #if !defined(DISABLE_PLAYFABENTITY_API)
 
+#include <playfab/PlayFabProfilesDataModelsFwd.h>
 #include <playfab/PlayFabBaseModel.h>
 #include <playfab/PlayFabJsonHeaders.h>
 
@@ -16,37 +17,8 @@ namespace PlayFab
             EffectTypeDeny
         };
 
-        inline void ToJsonEnum(const EffectType input, Json::Value& output)
-        {
-            if (input == EffectType::EffectTypeAllow)
-            {
-                output = Json::Value("Allow");
-                return;
-            }
-            if (input == EffectType::EffectTypeDeny)
-            {
-                output = Json::Value("Deny");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, EffectType& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "Allow")
-            {
-                output = EffectType::EffectTypeAllow;
-                return;
-            }
-            if (inputStr == "Deny")
-            {
-                output = EffectType::EffectTypeDeny;
-                return;
-            }
-        }
+        void ToJsonEnum(const EffectType input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, EffectType& output);
 
         enum class OperationTypes
         {
@@ -56,57 +28,8 @@ namespace PlayFab
             OperationTypesNone
         };
 
-        inline void ToJsonEnum(const OperationTypes input, Json::Value& output)
-        {
-            if (input == OperationTypes::OperationTypesCreated)
-            {
-                output = Json::Value("Created");
-                return;
-            }
-            if (input == OperationTypes::OperationTypesUpdated)
-            {
-                output = Json::Value("Updated");
-                return;
-            }
-            if (input == OperationTypes::OperationTypesDeleted)
-            {
-                output = Json::Value("Deleted");
-                return;
-            }
-            if (input == OperationTypes::OperationTypesNone)
-            {
-                output = Json::Value("None");
-                return;
-            }
-        }
-        inline void FromJsonEnum(const Json::Value& input, OperationTypes& output)
-        {
-            if (!input.isString())
-            {
-                return;
-            }
-            const std::string& inputStr = input.asString();
-            if (inputStr == "Created")
-            {
-                output = OperationTypes::OperationTypesCreated;
-                return;
-            }
-            if (inputStr == "Updated")
-            {
-                output = OperationTypes::OperationTypesUpdated;
-                return;
-            }
-            if (inputStr == "Deleted")
-            {
-                output = OperationTypes::OperationTypesDeleted;
-                return;
-            }
-            if (inputStr == "None")
-            {
-                output = OperationTypes::OperationTypesNone;
-                return;
-            }
-        }
+        void ToJsonEnum(const OperationTypes input, Json::Value& output);
+        void FromJsonEnum(const Json::Value& input, OperationTypes& output);
 
         // Profiles Classes
         struct EntityDataObject : public PlayFabBaseModel
@@ -131,21 +54,9 @@ namespace PlayFab
 
             ~EntityDataObject() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                DataObject = input["DataObject"];
-                FromJsonUtilS(input["EscapedDataObject"], EscapedDataObject);
-                FromJsonUtilS(input["ObjectName"], ObjectName);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                output["DataObject"] = DataObject;
-                Json::Value each_EscapedDataObject; ToJsonUtilS(EscapedDataObject, each_EscapedDataObject); output["EscapedDataObject"] = each_EscapedDataObject;
-                Json::Value each_ObjectName; ToJsonUtilS(ObjectName, each_ObjectName); output["ObjectName"] = each_ObjectName;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct EntityKey : public PlayFabBaseModel
@@ -167,19 +78,9 @@ namespace PlayFab
 
             ~EntityKey() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Id"], Id);
-                FromJsonUtilS(input["Type"], Type);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Id; ToJsonUtilS(Id, each_Id); output["Id"] = each_Id;
-                Json::Value each_Type; ToJsonUtilS(Type, each_Type); output["Type"] = each_Type;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct EntityLineage : public PlayFabBaseModel
@@ -213,27 +114,9 @@ namespace PlayFab
 
             ~EntityLineage() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CharacterId"], CharacterId);
-                FromJsonUtilS(input["GroupId"], GroupId);
-                FromJsonUtilS(input["MasterPlayerAccountId"], MasterPlayerAccountId);
-                FromJsonUtilS(input["NamespaceId"], NamespaceId);
-                FromJsonUtilS(input["TitleId"], TitleId);
-                FromJsonUtilS(input["TitlePlayerAccountId"], TitlePlayerAccountId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); output["CharacterId"] = each_CharacterId;
-                Json::Value each_GroupId; ToJsonUtilS(GroupId, each_GroupId); output["GroupId"] = each_GroupId;
-                Json::Value each_MasterPlayerAccountId; ToJsonUtilS(MasterPlayerAccountId, each_MasterPlayerAccountId); output["MasterPlayerAccountId"] = each_MasterPlayerAccountId;
-                Json::Value each_NamespaceId; ToJsonUtilS(NamespaceId, each_NamespaceId); output["NamespaceId"] = each_NamespaceId;
-                Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); output["TitleId"] = each_TitleId;
-                Json::Value each_TitlePlayerAccountId; ToJsonUtilS(TitlePlayerAccountId, each_TitlePlayerAccountId); output["TitlePlayerAccountId"] = each_TitlePlayerAccountId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct EntityPermissionStatement : public PlayFabBaseModel
@@ -267,27 +150,9 @@ namespace PlayFab
 
             ~EntityPermissionStatement() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Action"], Action);
-                FromJsonUtilS(input["Comment"], Comment);
-                Condition = input["Condition"];
-                FromJsonEnum(input["Effect"], Effect);
-                Principal = input["Principal"];
-                FromJsonUtilS(input["Resource"], Resource);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Action; ToJsonUtilS(Action, each_Action); output["Action"] = each_Action;
-                Json::Value each_Comment; ToJsonUtilS(Comment, each_Comment); output["Comment"] = each_Comment;
-                output["Condition"] = Condition;
-                Json::Value each_Effect; ToJsonEnum(Effect, each_Effect); output["Effect"] = each_Effect;
-                output["Principal"] = Principal;
-                Json::Value each_Resource; ToJsonUtilS(Resource, each_Resource); output["Resource"] = each_Resource;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct EntityProfileFileMetadata : public PlayFabBaseModel
@@ -315,23 +180,9 @@ namespace PlayFab
 
             ~EntityProfileFileMetadata() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["Checksum"], Checksum);
-                FromJsonUtilS(input["FileName"], FileName);
-                FromJsonUtilT(input["LastModified"], LastModified);
-                FromJsonUtilP(input["Size"], Size);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Checksum; ToJsonUtilS(Checksum, each_Checksum); output["Checksum"] = each_Checksum;
-                Json::Value each_FileName; ToJsonUtilS(FileName, each_FileName); output["FileName"] = each_FileName;
-                Json::Value each_LastModified; ToJsonUtilT(LastModified, each_LastModified); output["LastModified"] = each_LastModified;
-                Json::Value each_Size; ToJsonUtilP(Size, each_Size); output["Size"] = each_Size;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct EntityStatisticChildValue : public PlayFabBaseModel
@@ -356,21 +207,9 @@ namespace PlayFab
 
             ~EntityStatisticChildValue() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["ChildName"], ChildName);
-                FromJsonUtilS(input["Metadata"], Metadata);
-                FromJsonUtilP(input["Value"], Value);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ChildName; ToJsonUtilS(ChildName, each_ChildName); output["ChildName"] = each_ChildName;
-                Json::Value each_Metadata; ToJsonUtilS(Metadata, each_Metadata); output["Metadata"] = each_Metadata;
-                Json::Value each_Value; ToJsonUtilP(Value, each_Value); output["Value"] = each_Value;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct EntityStatisticValue : public PlayFabBaseModel
@@ -401,25 +240,9 @@ namespace PlayFab
 
             ~EntityStatisticValue() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["ChildStatistics"], ChildStatistics);
-                FromJsonUtilS(input["Metadata"], Metadata);
-                FromJsonUtilS(input["Name"], Name);
-                FromJsonUtilP(input["Value"], Value);
-                FromJsonUtilP(input["Version"], Version);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_ChildStatistics; ToJsonUtilO(ChildStatistics, each_ChildStatistics); output["ChildStatistics"] = each_ChildStatistics;
-                Json::Value each_Metadata; ToJsonUtilS(Metadata, each_Metadata); output["Metadata"] = each_Metadata;
-                Json::Value each_Name; ToJsonUtilS(Name, each_Name); output["Name"] = each_Name;
-                Json::Value each_Value; ToJsonUtilP(Value, each_Value); output["Value"] = each_Value;
-                Json::Value each_Version; ToJsonUtilP(Version, each_Version); output["Version"] = each_Version;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct EntityProfileBody : public PlayFabBaseModel
@@ -477,43 +300,9 @@ namespace PlayFab
 
             ~EntityProfileBody() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["AvatarUrl"], AvatarUrl);
-                FromJsonUtilT(input["Created"], Created);
-                FromJsonUtilS(input["DisplayName"], DisplayName);
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilS(input["EntityChain"], EntityChain);
-                FromJsonUtilS(input["ExperimentVariants"], ExperimentVariants);
-                FromJsonUtilO(input["Files"], Files);
-                FromJsonUtilS(input["Language"], Language);
-                FromJsonUtilS(input["LeaderboardMetadata"], LeaderboardMetadata);
-                FromJsonUtilO(input["Lineage"], Lineage);
-                FromJsonUtilO(input["Objects"], Objects);
-                FromJsonUtilO(input["Permissions"], Permissions);
-                FromJsonUtilO(input["Statistics"], Statistics);
-                FromJsonUtilP(input["VersionNumber"], VersionNumber);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_AvatarUrl; ToJsonUtilS(AvatarUrl, each_AvatarUrl); output["AvatarUrl"] = each_AvatarUrl;
-                Json::Value each_Created; ToJsonUtilT(Created, each_Created); output["Created"] = each_Created;
-                Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); output["DisplayName"] = each_DisplayName;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_EntityChain; ToJsonUtilS(EntityChain, each_EntityChain); output["EntityChain"] = each_EntityChain;
-                Json::Value each_ExperimentVariants; ToJsonUtilS(ExperimentVariants, each_ExperimentVariants); output["ExperimentVariants"] = each_ExperimentVariants;
-                Json::Value each_Files; ToJsonUtilO(Files, each_Files); output["Files"] = each_Files;
-                Json::Value each_Language; ToJsonUtilS(Language, each_Language); output["Language"] = each_Language;
-                Json::Value each_LeaderboardMetadata; ToJsonUtilS(LeaderboardMetadata, each_LeaderboardMetadata); output["LeaderboardMetadata"] = each_LeaderboardMetadata;
-                Json::Value each_Lineage; ToJsonUtilO(Lineage, each_Lineage); output["Lineage"] = each_Lineage;
-                Json::Value each_Objects; ToJsonUtilO(Objects, each_Objects); output["Objects"] = each_Objects;
-                Json::Value each_Permissions; ToJsonUtilO(Permissions, each_Permissions); output["Permissions"] = each_Permissions;
-                Json::Value each_Statistics; ToJsonUtilO(Statistics, each_Statistics); output["Statistics"] = each_Statistics;
-                Json::Value each_VersionNumber; ToJsonUtilP(VersionNumber, each_VersionNumber); output["VersionNumber"] = each_VersionNumber;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetEntityProfileRequest : public PlayFabRequestCommon
@@ -538,21 +327,9 @@ namespace PlayFab
 
             ~GetEntityProfileRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["DataAsObject"], DataAsObject);
-                FromJsonUtilO(input["Entity"], Entity);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_DataAsObject; ToJsonUtilP(DataAsObject, each_DataAsObject); output["DataAsObject"] = each_DataAsObject;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetEntityProfileResponse : public PlayFabResultCommon
@@ -571,17 +348,9 @@ namespace PlayFab
 
             ~GetEntityProfileResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Profile"], Profile);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Profile; ToJsonUtilO(Profile, each_Profile); output["Profile"] = each_Profile;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetEntityProfilesRequest : public PlayFabRequestCommon
@@ -606,21 +375,9 @@ namespace PlayFab
 
             ~GetEntityProfilesRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilP(input["DataAsObject"], DataAsObject);
-                FromJsonUtilO(input["Entities"], Entities);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_DataAsObject; ToJsonUtilP(DataAsObject, each_DataAsObject); output["DataAsObject"] = each_DataAsObject;
-                Json::Value each_Entities; ToJsonUtilO(Entities, each_Entities); output["Entities"] = each_Entities;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetEntityProfilesResponse : public PlayFabResultCommon
@@ -639,17 +396,9 @@ namespace PlayFab
 
             ~GetEntityProfilesResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Profiles"], Profiles);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Profiles; ToJsonUtilO(Profiles, each_Profiles); output["Profiles"] = each_Profiles;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetGlobalPolicyRequest : public PlayFabRequestCommon
@@ -668,17 +417,9 @@ namespace PlayFab
 
             ~GetGlobalPolicyRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetGlobalPolicyResponse : public PlayFabResultCommon
@@ -697,17 +438,9 @@ namespace PlayFab
 
             ~GetGlobalPolicyResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Permissions"], Permissions);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Permissions; ToJsonUtilO(Permissions, each_Permissions); output["Permissions"] = each_Permissions;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetTitlePlayersFromMasterPlayerAccountIdsRequest : public PlayFabRequestCommon
@@ -732,21 +465,9 @@ namespace PlayFab
 
             ~GetTitlePlayersFromMasterPlayerAccountIdsRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilS(input["MasterPlayerAccountIds"], MasterPlayerAccountIds);
-                FromJsonUtilS(input["TitleId"], TitleId);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_MasterPlayerAccountIds; ToJsonUtilS(MasterPlayerAccountIds, each_MasterPlayerAccountIds); output["MasterPlayerAccountIds"] = each_MasterPlayerAccountIds;
-                Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); output["TitleId"] = each_TitleId;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct GetTitlePlayersFromMasterPlayerAccountIdsResponse : public PlayFabResultCommon
@@ -768,19 +489,9 @@ namespace PlayFab
 
             ~GetTitlePlayersFromMasterPlayerAccountIdsResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["TitleId"], TitleId);
-                FromJsonUtilO(input["TitlePlayerAccounts"], TitlePlayerAccounts);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); output["TitleId"] = each_TitleId;
-                Json::Value each_TitlePlayerAccounts; ToJsonUtilO(TitlePlayerAccounts, each_TitlePlayerAccounts); output["TitlePlayerAccounts"] = each_TitlePlayerAccounts;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct SetEntityProfilePolicyRequest : public PlayFabRequestCommon
@@ -805,21 +516,9 @@ namespace PlayFab
 
             ~SetEntityProfilePolicyRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilO(input["Statements"], Statements);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_Statements; ToJsonUtilO(Statements, each_Statements); output["Statements"] = each_Statements;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct SetEntityProfilePolicyResponse : public PlayFabResultCommon
@@ -838,17 +537,9 @@ namespace PlayFab
 
             ~SetEntityProfilePolicyResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilO(input["Permissions"], Permissions);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_Permissions; ToJsonUtilO(Permissions, each_Permissions); output["Permissions"] = each_Permissions;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct SetGlobalPolicyRequest : public PlayFabRequestCommon
@@ -870,19 +561,9 @@ namespace PlayFab
 
             ~SetGlobalPolicyRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Permissions"], Permissions);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Permissions; ToJsonUtilO(Permissions, each_Permissions); output["Permissions"] = each_Permissions;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct SetGlobalPolicyResponse : public PlayFabResultCommon
@@ -898,15 +579,9 @@ namespace PlayFab
 
             ~SetGlobalPolicyResponse() = default;
 
-            void FromJson(const Json::Value&) override
-            {
-            }
+            void FromJson(const Json::Value&) override;
 
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                return output;
-            }
+            Json::Value ToJson() const override;
         };
 
         struct SetProfileLanguageRequest : public PlayFabRequestCommon
@@ -934,23 +609,9 @@ namespace PlayFab
 
             ~SetProfileLanguageRequest() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilS(input["CustomTags"], CustomTags);
-                FromJsonUtilO(input["Entity"], Entity);
-                FromJsonUtilP(input["ExpectedVersion"], ExpectedVersion);
-                FromJsonUtilS(input["Language"], Language);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); output["CustomTags"] = each_CustomTags;
-                Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); output["Entity"] = each_Entity;
-                Json::Value each_ExpectedVersion; ToJsonUtilP(ExpectedVersion, each_ExpectedVersion); output["ExpectedVersion"] = each_ExpectedVersion;
-                Json::Value each_Language; ToJsonUtilS(Language, each_Language); output["Language"] = each_Language;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
         struct SetProfileLanguageResponse : public PlayFabResultCommon
@@ -972,19 +633,9 @@ namespace PlayFab
 
             ~SetProfileLanguageResponse() = default;
 
-            void FromJson(const Json::Value& input) override
-            {
-                FromJsonUtilE(input["OperationResult"], OperationResult);
-                FromJsonUtilP(input["VersionNumber"], VersionNumber);
-            }
-
-            Json::Value ToJson() const override
-            {
-                Json::Value output;
-                Json::Value each_OperationResult; ToJsonUtilE(OperationResult, each_OperationResult); output["OperationResult"] = each_OperationResult;
-                Json::Value each_VersionNumber; ToJsonUtilP(VersionNumber, each_VersionNumber); output["VersionNumber"] = each_VersionNumber;
-                return output;
-            }
+            void FromJson(const Json::Value& input) override;
+
+            Json::Value ToJson() const override;
         };
 
     }
@@ -0,0 +1,38 @@
+#pragma once
+
+#if !defined(DISABLE_PLAYFABENTITY_API)
+
+namespace PlayFab
+{
+    namespace ProfilesModels
+    {
+        // Forward declarations of the Profiles models, for headers which only pass them by reference
+        enum class EffectType;
+        enum class OperationTypes;
+
+        struct EntityDataObject;
+        struct EntityKey;
+        struct EntityLineage;
+        struct EntityPermissionStatement;
+        struct EntityProfileFileMetadata;
+        struct EntityStatisticChildValue;
+        struct EntityStatisticValue;
+        struct EntityProfileBody;
+        struct GetEntityProfileRequest;
+        struct GetEntityProfileResponse;
+        struct GetEntityProfilesRequest;
+        struct GetEntityProfilesResponse;
+        struct GetGlobalPolicyRequest;
+        struct GetGlobalPolicyResponse;
+        struct GetTitlePlayersFromMasterPlayerAccountIdsRequest;
+        struct GetTitlePlayersFromMasterPlayerAccountIdsResponse;
+        struct SetEntityProfilePolicyRequest;
+        struct SetEntityProfilePolicyResponse;
+        struct SetGlobalPolicyRequest;
+        struct SetGlobalPolicyResponse;
+        struct SetProfileLanguageRequest;
+        struct SetProfileLanguageResponse;
+    }
+}
+
+#endif
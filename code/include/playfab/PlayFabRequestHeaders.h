@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace PlayFab
+{
+    /// <summary>
+    /// The request headers which are set by the PlayFab API methods
+    /// </summary>
+    enum class PlayFabRequestHeaderKey : uint8_t
+    {
+        Authorization, // X-Authorization, the session ticket of a client
+        EntityToken, // X-EntityToken
+        SecretKey // X-SecretKey, the developer secret key of a title
+    };
+
+    /// <summary>
+    /// Fixed-capacity list of the headers of one API call, stored inline in the request container.
+    /// It holds at most one header per PlayFabRequestHeaderKey, so it never needs to grow. Each header is kept as its
+    /// formatted "Name: value" line, which transports that take whole header lines (curl, WinHttp) pass on as is.
+    /// </summary>
+    class PlayFabRequestHeaders
+    {
+    public:
+        class Header
+        {
+        public:
+            PlayFabRequestHeaderKey GetKey() const { return key; }
+            const char* GetName() const;
+            const char* GetValue() const;
+            const std::string& GetLine() const { return line; }
+
+        private:
+            friend class PlayFabRequestHeaders;
+
+            PlayFabRequestHeaderKey key = PlayFabRequestHeaderKey::Authorization;
+            std::string line;
+        };
+
+        // Sets the header for key, replacing any previous value. Empty values are never sent, so an empty value removes the header.
+        void Set(PlayFabRequestHeaderKey key, const std::string& value);
+        // Returns the header for key, or nullptr if it was not set
+        const Header* Find(PlayFabRequestHeaderKey key) const;
+
+        const Header* begin() const { return headers; }
+        const Header* end() const { return headers + count; }
+        size_t size() const { return count; }
+        bool empty() const { return count == 0; }
+
+        static const char* GetName(PlayFabRequestHeaderKey key);
+
+    private:
+        static const size_t MaxHeaders = static_cast<size_t>(PlayFabRequestHeaderKey::SecretKey) + 1; // One per key
+
+        Header headers[MaxHeaders];
+        size_t count = 0;
+    };
+}
@@ -0,0 +1,341 @@
+#pragma once
+
+#if defined(ENABLE_PLAYFABSERVER_API)
+
+namespace PlayFab
+{
+    namespace ServerModels
+    {
+        // Forward declarations of the Server models, for headers which only pass them by reference
+        enum class CloudScriptRevisionOption;
+        enum class ContinentCode;
+        enum class CountryCode;
+        enum class Currency;
+        enum class EmailVerificationStatus;
+        enum class GameInstanceState;
+        enum class GenericErrorCodes;
+        enum class LoginIdentityProvider;
+        enum class PlayerConnectionState;
+        enum class PushNotificationPlatform;
+        enum class Region;
+        enum class ResultTableNodeType;
+        enum class SourceType;
+        enum class SubscriptionProviderStatus;
+        enum class TitleActivationStatus;
+        enum class UserDataPermission;
+        enum class UserOrigination;
+
+        struct AdCampaignAttribution;
+        struct AdCampaignAttributionModel;
+        struct AddCharacterVirtualCurrencyRequest;
+        struct AddFriendRequest;
+        struct GenericServiceId;
+        struct AddGenericIDRequest;
+        struct AddPlayerTagRequest;
+        struct AddPlayerTagResult;
+        struct AddSharedGroupMembersRequest;
+        struct AddSharedGroupMembersResult;
+        struct AddUserVirtualCurrencyRequest;
+        struct AdvancedPushPlatformMsg;
+        struct AuthenticateSessionTicketRequest;
+        struct UserAndroidDeviceInfo;
+        struct UserAppleIdInfo;
+        struct UserCustomIdInfo;
+        struct UserFacebookInfo;
+        struct UserFacebookInstantGamesIdInfo;
+        struct UserGameCenterInfo;
+        struct UserGoogleInfo;
+        struct UserIosDeviceInfo;
+        struct UserKongregateInfo;
+        struct UserNintendoSwitchAccountIdInfo;
+        struct UserNintendoSwitchDeviceIdInfo;
+        struct UserOpenIdInfo;
+        struct UserPrivateAccountInfo;
+        struct UserPsnInfo;
+        struct UserSteamInfo;
+        struct EntityKey;
+        struct UserTitleInfo;
+        struct UserTwitchInfo;
+        struct UserWindowsHelloInfo;
+        struct UserXboxInfo;
+        struct UserAccountInfo;
+        struct AuthenticateSessionTicketResult;
+        struct AwardSteamAchievementItem;
+        struct AwardSteamAchievementRequest;
+        struct AwardSteamAchievementResult;
+        struct BanInfo;
+        struct BanRequest;
+        struct BanUsersRequest;
+        struct BanUsersResult;
+        struct CatalogItemBundleInfo;
+        struct CatalogItemConsumableInfo;
+        struct CatalogItemContainerInfo;
+        struct CatalogItem;
+        struct ItemInstance;
+        struct CharacterInventory;
+        struct CharacterLeaderboardEntry;
+        struct CharacterResult;
+        struct ConsumeItemRequest;
+        struct ConsumeItemResult;
+        struct ContactEmailInfo;
+        struct ContactEmailInfoModel;
+        struct CreateSharedGroupRequest;
+        struct CreateSharedGroupResult;
+        struct DeleteCharacterFromUserRequest;
+        struct DeleteCharacterFromUserResult;
+        struct DeletePlayerRequest;
+        struct DeletePlayerResult;
+        struct DeletePushNotificationTemplateRequest;
+        struct DeletePushNotificationTemplateResult;
+        struct DeleteSharedGroupRequest;
+        struct DeregisterGameRequest;
+        struct DeregisterGameResponse;
+        struct EmptyResponse;
+        struct EmptyResult;
+        struct EntityTokenResponse;
+        struct EvaluateRandomResultTableRequest;
+        struct EvaluateRandomResultTableResult;
+        struct ScriptExecutionError;
+        struct LogStatement;
+        struct ExecuteCloudScriptResult;
+        struct ExecuteCloudScriptServerRequest;
+        struct FacebookInstantGamesPlayFabIdPair;
+        struct FacebookPlayFabIdPair;
+        struct LinkedPlatformAccountModel;
+        struct LocationModel;
+        struct SubscriptionModel;
+        struct MembershipModel;
+        struct PushNotificationRegistrationModel;
+        struct StatisticModel;
+        struct TagModel;
+        struct ValueToDateModel;
+        struct PlayerProfileModel;
+        struct FriendInfo;
+        struct GenericPlayFabIdPair;
+        struct GetAllSegmentsRequest;
+        struct GetSegmentResult;
+        struct GetAllSegmentsResult;
+        struct GetCatalogItemsRequest;
+        struct GetCatalogItemsResult;
+        struct GetCharacterDataRequest;
+        struct UserDataRecord;
+        struct GetCharacterDataResult;
+        struct GetCharacterInventoryRequest;
+        struct VirtualCurrencyRechargeTime;
+        struct GetCharacterInventoryResult;
+        struct GetCharacterLeaderboardRequest;
+        struct GetCharacterLeaderboardResult;
+        struct GetCharacterStatisticsRequest;
+        struct GetCharacterStatisticsResult;
+        struct GetContentDownloadUrlRequest;
+        struct GetContentDownloadUrlResult;
+        struct PlayerProfileViewConstraints;
+        struct GetFriendLeaderboardRequest;
+        struct GetFriendsListRequest;
+        struct GetFriendsListResult;
+        struct GetLeaderboardAroundCharacterRequest;
+        struct GetLeaderboardAroundCharacterResult;
+        struct GetLeaderboardAroundUserRequest;
+        struct PlayerLeaderboardEntry;
+        struct GetLeaderboardAroundUserResult;
+        struct GetLeaderboardForUsersCharactersRequest;
+        struct GetLeaderboardForUsersCharactersResult;
+        struct GetLeaderboardRequest;
+        struct GetLeaderboardResult;
+        struct GetPlayerCombinedInfoRequestParams;
+        struct GetPlayerCombinedInfoRequest;
+        struct StatisticValue;
+        struct GetPlayerCombinedInfoResultPayload;
+        struct GetPlayerCombinedInfoResult;
+        struct GetPlayerProfileRequest;
+        struct GetPlayerProfileResult;
+        struct GetPlayerSegmentsResult;
+        struct GetPlayersInSegmentRequest;
+        struct PlayerLinkedAccount;
+        struct PlayerLocation;
+        struct PlayerStatistic;
+        struct PushNotificationRegistration;
+        struct PlayerProfile;
+        struct GetPlayersInSegmentResult;
+        struct GetPlayersSegmentsRequest;
+        struct StatisticNameVersion;
+        struct GetPlayerStatisticsRequest;
+        struct GetPlayerStatisticsResult;
+        struct GetPlayerStatisticVersionsRequest;
+        struct PlayerStatisticVersion;
+        struct GetPlayerStatisticVersionsResult;
+        struct GetPlayerTagsRequest;
+        struct GetPlayerTagsResult;
+        struct GetPlayFabIDsFromFacebookIDsRequest;
+        struct GetPlayFabIDsFromFacebookIDsResult;
+        struct GetPlayFabIDsFromFacebookInstantGamesIdsRequest;
+        struct GetPlayFabIDsFromFacebookInstantGamesIdsResult;
+        struct GetPlayFabIDsFromGenericIDsRequest;
+        struct GetPlayFabIDsFromGenericIDsResult;
+        struct GetPlayFabIDsFromNintendoSwitchDeviceIdsRequest;
+        struct NintendoSwitchPlayFabIdPair;
+        struct GetPlayFabIDsFromNintendoSwitchDeviceIdsResult;
+        struct GetPlayFabIDsFromPSNAccountIDsRequest;
+        struct PSNAccountPlayFabIdPair;
+        struct GetPlayFabIDsFromPSNAccountIDsResult;
+        struct GetPlayFabIDsFromSteamIDsRequest;
+        struct SteamPlayFabIdPair;
+        struct GetPlayFabIDsFromSteamIDsResult;
+        struct GetPlayFabIDsFromXboxLiveIDsRequest;
+        struct XboxLiveAccountPlayFabIdPair;
+        struct GetPlayFabIDsFromXboxLiveIDsResult;
+        struct GetPublisherDataRequest;
+        struct GetPublisherDataResult;
+        struct GetRandomResultTablesRequest;
+        struct ResultTableNode;
+        struct RandomResultTableListing;
+        struct GetRandomResultTablesResult;
+        struct GetServerCustomIDsFromPlayFabIDsRequest;
+        struct ServerCustomIDPlayFabIDPair;
+        struct GetServerCustomIDsFromPlayFabIDsResult;
+        struct GetSharedGroupDataRequest;
+        struct SharedGroupDataRecord;
+        struct GetSharedGroupDataResult;
+        struct StoreMarketingModel;
+        struct StoreItem;
+        struct GetStoreItemsResult;
+        struct GetStoreItemsServerRequest;
+        struct GetTimeRequest;
+        struct GetTimeResult;
+        struct GetTitleDataRequest;
+        struct GetTitleDataResult;
+        struct GetTitleNewsRequest;
+        struct TitleNewsItem;
+        struct GetTitleNewsResult;
+        struct GetUserAccountInfoRequest;
+        struct GetUserAccountInfoResult;
+        struct GetUserBansRequest;
+        struct GetUserBansResult;
+        struct GetUserDataRequest;
+        struct GetUserDataResult;
+        struct GetUserInventoryRequest;
+        struct GetUserInventoryResult;
+        struct GrantCharacterToUserRequest;
+        struct GrantCharacterToUserResult;
+        struct GrantedItemInstance;
+        struct GrantItemsToCharacterRequest;
+        struct GrantItemsToCharacterResult;
+        struct GrantItemsToUserRequest;
+        struct GrantItemsToUserResult;
+        struct ItemGrant;
+        struct GrantItemsToUsersRequest;
+        struct GrantItemsToUsersResult;
+        struct LinkPSNAccountRequest;
+        struct LinkPSNAccountResult;
+        struct LinkServerCustomIdRequest;
+        struct LinkServerCustomIdResult;
+        struct LinkXboxAccountRequest;
+        struct LinkXboxAccountResult;
+        struct ListUsersCharactersRequest;
+        struct ListUsersCharactersResult;
+        struct LocalizedPushNotificationProperties;
+        struct LoginWithServerCustomIdRequest;
+        struct LoginWithSteamIdRequest;
+        struct LoginWithXboxIdRequest;
+        struct LoginWithXboxRequest;
+        struct ModifyCharacterVirtualCurrencyResult;
+        struct ModifyItemUsesRequest;
+        struct ModifyItemUsesResult;
+        struct ModifyUserVirtualCurrencyResult;
+        struct MoveItemToCharacterFromCharacterRequest;
+        struct MoveItemToCharacterFromCharacterResult;
+        struct MoveItemToCharacterFromUserRequest;
+        struct MoveItemToCharacterFromUserResult;
+        struct MoveItemToUserFromCharacterRequest;
+        struct MoveItemToUserFromCharacterResult;
+        struct NotifyMatchmakerPlayerLeftRequest;
+        struct NotifyMatchmakerPlayerLeftResult;
+        struct PushNotificationPackage;
+        struct RedeemCouponRequest;
+        struct RedeemCouponResult;
+        struct RedeemMatchmakerTicketRequest;
+        struct RedeemMatchmakerTicketResult;
+        struct RefreshGameServerInstanceHeartbeatRequest;
+        struct RefreshGameServerInstanceHeartbeatResult;
+        struct RegisterGameRequest;
+        struct RegisterGameResponse;
+        struct RemoveFriendRequest;
+        struct RemoveGenericIDRequest;
+        struct RemovePlayerTagRequest;
+        struct RemovePlayerTagResult;
+        struct RemoveSharedGroupMembersRequest;
+        struct RemoveSharedGroupMembersResult;
+        struct ReportPlayerServerRequest;
+        struct ReportPlayerServerResult;
+        struct RevokeAllBansForUserRequest;
+        struct RevokeAllBansForUserResult;
+        struct RevokeBansRequest;
+        struct RevokeBansResult;
+        struct RevokeInventoryItem;
+        struct RevokeInventoryItemRequest;
+        struct RevokeInventoryItemsRequest;
+        struct RevokeItemError;
+        struct RevokeInventoryItemsResult;
+        struct RevokeInventoryResult;
+        struct SavePushNotificationTemplateRequest;
+        struct SavePushNotificationTemplateResult;
+        struct SendCustomAccountRecoveryEmailRequest;
+        struct SendCustomAccountRecoveryEmailResult;
+        struct SendEmailFromTemplateRequest;
+        struct SendEmailFromTemplateResult;
+        struct SendPushNotificationFromTemplateRequest;
+        struct SendPushNotificationRequest;
+        struct SendPushNotificationResult;
+        struct UserSettings;
+        struct Variable;
+        struct TreatmentAssignment;
+        struct ServerLoginResult;
+        struct SetFriendTagsRequest;
+        struct SetGameServerInstanceDataRequest;
+        struct SetGameServerInstanceDataResult;
+        struct SetGameServerInstanceStateRequest;
+        struct SetGameServerInstanceStateResult;
+        struct SetGameServerInstanceTagsRequest;
+        struct SetGameServerInstanceTagsResult;
+        struct SetPlayerSecretRequest;
+        struct SetPlayerSecretResult;
+        struct SetPublisherDataRequest;
+        struct SetPublisherDataResult;
+        struct SetTitleDataRequest;
+        struct SetTitleDataResult;
+        struct StatisticUpdate;
+        struct SubtractCharacterVirtualCurrencyRequest;
+        struct SubtractUserVirtualCurrencyRequest;
+        struct UnlinkPSNAccountRequest;
+        struct UnlinkPSNAccountResult;
+        struct UnlinkServerCustomIdRequest;
+        struct UnlinkServerCustomIdResult;
+        struct UnlinkXboxAccountRequest;
+        struct UnlinkXboxAccountResult;
+        struct UnlockContainerInstanceRequest;
+        struct UnlockContainerItemRequest;
+        struct UnlockContainerItemResult;
+        struct UpdateAvatarUrlRequest;
+        struct UpdateBanRequest;
+        struct UpdateBansRequest;
+        struct UpdateBansResult;
+        struct UpdateCharacterDataRequest;
+        struct UpdateCharacterDataResult;
+        struct UpdateCharacterStatisticsRequest;
+        struct UpdateCharacterStatisticsResult;
+        struct UpdatePlayerStatisticsRequest;
+        struct UpdatePlayerStatisticsResult;
+        struct UpdateSharedGroupDataRequest;
+        struct UpdateSharedGroupDataResult;
+        struct UpdateUserDataRequest;
+        struct UpdateUserDataResult;
+        struct UpdateUserInternalDataRequest;
+        struct UpdateUserInventoryItemDataRequest;
+        struct WriteEventResponse;
+        struct WriteServerCharacterEventRequest;
+        struct WriteServerPlayerEventRequest;
+        struct WriteTitleEventRequest;
+    }
+}
+
+#endif
@@ -2,8 +2,14 @@
 
 #if defined(ENABLE_PLAYFABSERVER_API)
 
+// Opt-in: only forward-declare the models, for files which include the API header but never construct a model
+#if defined(PLAYFAB_API_HEADERS_FWD_MODELS_ONLY)
+#include <playfab/PlayFabServerDataModelsFwd.h>
+#else
 #include <playfab/PlayFabServerDataModels.h>
+#endif
 #include <playfab/PlayFabError.h>
+#include <playfab/PlayFabLazyResult.h>
 
 namespace PlayFab
 {
@@ -181,6 +187,10 @@ namespace PlayFab
         void WritePlayerEvent(ServerModels::WriteServerPlayerEventRequest& request, const ProcessApiCallback<ServerModels::WriteEventResponse> callback, const ErrorCallback errorCallback = nullptr, void* customData = nullptr);
         void WriteTitleEvent(ServerModels::WriteTitleEventRequest& request, const ProcessApiCallback<ServerModels::WriteEventResponse> callback, const ErrorCallback errorCallback = nullptr, void* customData = nullptr);
 
+        // ------------ Lazily decoded variants of API calls with very large results (see PlayFabLazyResult)
+        void GetTitleDataLazy(ServerModels::GetTitleDataRequest& request, const ProcessApiCallback<PlayFabLazyResult<ServerModels::GetTitleDataResult>> callback, const ErrorCallback errorCallback = nullptr, void* customData = nullptr);
+        void GetPlayersInSegmentLazy(ServerModels::GetPlayersInSegmentRequest& request, const ProcessApiCallback<PlayFabLazyResult<ServerModels::GetPlayersInSegmentResult>> callback, const ErrorCallback errorCallback = nullptr, void* customData = nullptr);
+
         // ------------ Generated result handlers
         void OnAddCharacterVirtualCurrencyResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer);
         void OnAddFriendResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer);
@@ -315,6 +325,8 @@ namespace PlayFab
         void OnWriteCharacterEventResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer);
         void OnWritePlayerEventResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer);
         void OnWriteTitleEventResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer);
+        void OnGetTitleDataLazyResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer);
+        void OnGetPlayersInSegmentLazyResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer);
         bool ValidateResult(PlayFabResultCommon& resultCommon, const CallRequestContainer& container);
     };
 }
@@ -3,7 +3,9 @@
 #if defined(ENABLE_PLAYFABADMIN_API)
 
 #include <playfab/PlayFabAdminApi.h>
+#include <playfab/PlayFabAdminDataModels.h>
 #include <playfab/PlayFabPluginManager.h>
+#include <playfab/PlayFabApiDispatch.h>
 #include <playfab/PlayFabSettings.h>
 #include <playfab/PlayFabError.h>
 #include <memory>
@@ -31,5756 +33,2887 @@ namespace PlayFab
 
     void PlayFabAdminAPI::AbortTaskInstance(
         AbortTaskInstanceRequest& request,
-        const ProcessApiCallback<EmptyResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<EmptyResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<EmptyResponse>(
             "/Admin/AbortTaskInstance",
-            headers,
-            jsonAsString,
-            OnAbortTaskInstanceResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnAbortTaskInstanceResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        EmptyResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<EmptyResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::AddLocalizedNews(
         AddLocalizedNewsRequest& request,
-        const ProcessApiCallback<AddLocalizedNewsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<AddLocalizedNewsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<AddLocalizedNewsResult>(
             "/Admin/AddLocalizedNews",
-            headers,
-            jsonAsString,
-            OnAddLocalizedNewsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<AddLocalizedNewsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnAddLocalizedNewsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        AddLocalizedNewsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<AddLocalizedNewsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::AddNews(
         AddNewsRequest& request,
-        const ProcessApiCallback<AddNewsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<AddNewsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<AddNewsResult>(
             "/Admin/AddNews",
-            headers,
-            jsonAsString,
-            OnAddNewsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<AddNewsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnAddNewsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        AddNewsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<AddNewsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::AddPlayerTag(
         AddPlayerTagRequest& request,
-        const ProcessApiCallback<AddPlayerTagResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<AddPlayerTagResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<AddPlayerTagResult>(
             "/Admin/AddPlayerTag",
-            headers,
-            jsonAsString,
-            OnAddPlayerTagResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<AddPlayerTagResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnAddPlayerTagResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        AddPlayerTagResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<AddPlayerTagResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::AddServerBuild(
         AddServerBuildRequest& request,
-        const ProcessApiCallback<AddServerBuildResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<AddServerBuildResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<AddServerBuildResult>(
             "/Admin/AddServerBuild",
-            headers,
-            jsonAsString,
-            OnAddServerBuildResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<AddServerBuildResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnAddServerBuildResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        AddServerBuildResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<AddServerBuildResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::AddUserVirtualCurrency(
         AddUserVirtualCurrencyRequest& request,
-        const ProcessApiCallback<ModifyUserVirtualCurrencyResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ModifyUserVirtualCurrencyResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ModifyUserVirtualCurrencyResult>(
             "/Admin/AddUserVirtualCurrency",
-            headers,
-            jsonAsString,
-            OnAddUserVirtualCurrencyResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyUserVirtualCurrencyResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnAddUserVirtualCurrencyResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ModifyUserVirtualCurrencyResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<ModifyUserVirtualCurrencyResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::AddVirtualCurrencyTypes(
         AddVirtualCurrencyTypesRequest& request,
-        const ProcessApiCallback<BlankResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<BlankResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<BlankResult>(
             "/Admin/AddVirtualCurrencyTypes",
-            headers,
-            jsonAsString,
-            OnAddVirtualCurrencyTypesResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<BlankResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnAddVirtualCurrencyTypesResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        BlankResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<BlankResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::BanUsers(
         BanUsersRequest& request,
-        const ProcessApiCallback<BanUsersResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<BanUsersResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<BanUsersResult>(
             "/Admin/BanUsers",
-            headers,
-            jsonAsString,
-            OnBanUsersResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<BanUsersResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnBanUsersResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        BanUsersResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<BanUsersResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::CheckLimitedEditionItemAvailability(
         CheckLimitedEditionItemAvailabilityRequest& request,
-        const ProcessApiCallback<CheckLimitedEditionItemAvailabilityResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<CheckLimitedEditionItemAvailabilityResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<CheckLimitedEditionItemAvailabilityResult>(
             "/Admin/CheckLimitedEditionItemAvailability",
-            headers,
-            jsonAsString,
-            OnCheckLimitedEditionItemAvailabilityResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<CheckLimitedEditionItemAvailabilityResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnCheckLimitedEditionItemAvailabilityResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        CheckLimitedEditionItemAvailabilityResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<CheckLimitedEditionItemAvailabilityResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::CreateActionsOnPlayersInSegmentTask(
         CreateActionsOnPlayerSegmentTaskRequest& request,
-        const ProcessApiCallback<CreateTaskResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<CreateTaskResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<CreateTaskResult>(
             "/Admin/CreateActionsOnPlayersInSegmentTask",
-            headers,
-            jsonAsString,
-            OnCreateActionsOnPlayersInSegmentTaskResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateTaskResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnCreateActionsOnPlayersInSegmentTaskResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        CreateTaskResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<CreateTaskResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::CreateCloudScriptTask(
         CreateCloudScriptTaskRequest& request,
-        const ProcessApiCallback<CreateTaskResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<CreateTaskResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<CreateTaskResult>(
             "/Admin/CreateCloudScriptTask",
-            headers,
-            jsonAsString,
-            OnCreateCloudScriptTaskResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateTaskResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnCreateCloudScriptTaskResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        CreateTaskResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<CreateTaskResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::CreateInsightsScheduledScalingTask(
         CreateInsightsScheduledScalingTaskRequest& request,
-        const ProcessApiCallback<CreateTaskResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<CreateTaskResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<CreateTaskResult>(
             "/Admin/CreateInsightsScheduledScalingTask",
-            headers,
-            jsonAsString,
-            OnCreateInsightsScheduledScalingTaskResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateTaskResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnCreateInsightsScheduledScalingTaskResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        CreateTaskResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<CreateTaskResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::CreateOpenIdConnection(
         CreateOpenIdConnectionRequest& request,
-        const ProcessApiCallback<EmptyResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<EmptyResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<EmptyResponse>(
             "/Admin/CreateOpenIdConnection",
-            headers,
-            jsonAsString,
-            OnCreateOpenIdConnectionResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnCreateOpenIdConnectionResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        EmptyResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<EmptyResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::CreatePlayerSharedSecret(
         CreatePlayerSharedSecretRequest& request,
-        const ProcessApiCallback<CreatePlayerSharedSecretResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<CreatePlayerSharedSecretResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<CreatePlayerSharedSecretResult>(
             "/Admin/CreatePlayerSharedSecret",
-            headers,
-            jsonAsString,
-            OnCreatePlayerSharedSecretResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<CreatePlayerSharedSecretResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnCreatePlayerSharedSecretResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        CreatePlayerSharedSecretResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<CreatePlayerSharedSecretResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::CreatePlayerStatisticDefinition(
         CreatePlayerStatisticDefinitionRequest& request,
-        const ProcessApiCallback<CreatePlayerStatisticDefinitionResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<CreatePlayerStatisticDefinitionResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<CreatePlayerStatisticDefinitionResult>(
             "/Admin/CreatePlayerStatisticDefinition",
-            headers,
-            jsonAsString,
-            OnCreatePlayerStatisticDefinitionResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<CreatePlayerStatisticDefinitionResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnCreatePlayerStatisticDefinitionResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        CreatePlayerStatisticDefinitionResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<CreatePlayerStatisticDefinitionResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::CreateSegment(
         CreateSegmentRequest& request,
-        const ProcessApiCallback<CreateSegmentResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<CreateSegmentResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<CreateSegmentResponse>(
             "/Admin/CreateSegment",
-            headers,
-            jsonAsString,
-            OnCreateSegmentResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateSegmentResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnCreateSegmentResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        CreateSegmentResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<CreateSegmentResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::DeleteContent(
         DeleteContentRequest& request,
-        const ProcessApiCallback<BlankResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<BlankResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<BlankResult>(
             "/Admin/DeleteContent",
-            headers,
-            jsonAsString,
-            OnDeleteContentResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<BlankResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnDeleteContentResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        BlankResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<BlankResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::DeleteMasterPlayerAccount(
         DeleteMasterPlayerAccountRequest& request,
-        const ProcessApiCallback<DeleteMasterPlayerAccountResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<DeleteMasterPlayerAccountResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<DeleteMasterPlayerAccountResult>(
             "/Admin/DeleteMasterPlayerAccount",
-            headers,
-            jsonAsString,
-            OnDeleteMasterPlayerAccountResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<DeleteMasterPlayerAccountResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnDeleteMasterPlayerAccountResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        DeleteMasterPlayerAccountResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<DeleteMasterPlayerAccountResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::DeleteOpenIdConnection(
         DeleteOpenIdConnectionRequest& request,
-        const ProcessApiCallback<EmptyResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<EmptyResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<EmptyResponse>(
             "/Admin/DeleteOpenIdConnection",
-            headers,
-            jsonAsString,
-            OnDeleteOpenIdConnectionResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnDeleteOpenIdConnectionResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        EmptyResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<EmptyResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::DeletePlayer(
         DeletePlayerRequest& request,
-        const ProcessApiCallback<DeletePlayerResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<DeletePlayerResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<DeletePlayerResult>(
             "/Admin/DeletePlayer",
-            headers,
-            jsonAsString,
-            OnDeletePlayerResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<DeletePlayerResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminAPI::OnDeletePlayerResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        DeletePlayerResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<DeletePlayerResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
-    }
-
-    void PlayFabAdminAPI::DeletePlayerSharedSecret(
-        DeletePlayerSharedSecretRequest& request,
-        const ProcessApiCallback<DeletePlayerSharedSecretResult> callback,
-        const ErrorCallback errorCallback,
-        void* customData
-    )
+    void PlayFabAdminAPI::DeletePlayerSharedSecret(
+        DeletePlayerSharedSecretRequest& request,
+        ProcessApiCallback<DeletePlayerSharedSecretResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<DeletePlayerSharedSecretResult>(
             "/Admin/DeletePlayerSharedSecret",
-            headers,
-            jsonAsString,
-            OnDeletePlayerSharedSecretResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<DeletePlayerSharedSecretResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnDeletePlayerSharedSecretResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        DeletePlayerSharedSecretResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<DeletePlayerSharedSecretResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::DeleteSegment(
         DeleteSegmentRequest& request,
-        const ProcessApiCallback<DeleteSegmentsResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<DeleteSegmentsResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<DeleteSegmentsResponse>(
             "/Admin/DeleteSegment",
-            headers,
-            jsonAsString,
-            OnDeleteSegmentResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<DeleteSegmentsResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnDeleteSegmentResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        DeleteSegmentsResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<DeleteSegmentsResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::DeleteStore(
         DeleteStoreRequest& request,
-        const ProcessApiCallback<DeleteStoreResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<DeleteStoreResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<DeleteStoreResult>(
             "/Admin/DeleteStore",
-            headers,
-            jsonAsString,
-            OnDeleteStoreResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<DeleteStoreResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnDeleteStoreResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        DeleteStoreResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<DeleteStoreResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::DeleteTask(
         DeleteTaskRequest& request,
-        const ProcessApiCallback<EmptyResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<EmptyResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<EmptyResponse>(
             "/Admin/DeleteTask",
-            headers,
-            jsonAsString,
-            OnDeleteTaskResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnDeleteTaskResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        EmptyResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<EmptyResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::DeleteTitle(
         DeleteTitleRequest& request,
-        const ProcessApiCallback<DeleteTitleResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<DeleteTitleResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<DeleteTitleResult>(
             "/Admin/DeleteTitle",
-            headers,
-            jsonAsString,
-            OnDeleteTitleResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<DeleteTitleResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnDeleteTitleResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        DeleteTitleResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<DeleteTitleResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::DeleteTitleDataOverride(
         DeleteTitleDataOverrideRequest& request,
-        const ProcessApiCallback<DeleteTitleDataOverrideResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<DeleteTitleDataOverrideResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<DeleteTitleDataOverrideResult>(
             "/Admin/DeleteTitleDataOverride",
-            headers,
-            jsonAsString,
-            OnDeleteTitleDataOverrideResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<DeleteTitleDataOverrideResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnDeleteTitleDataOverrideResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        DeleteTitleDataOverrideResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<DeleteTitleDataOverrideResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::ExportMasterPlayerData(
         ExportMasterPlayerDataRequest& request,
-        const ProcessApiCallback<ExportMasterPlayerDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ExportMasterPlayerDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ExportMasterPlayerDataResult>(
             "/Admin/ExportMasterPlayerData",
-            headers,
-            jsonAsString,
-            OnExportMasterPlayerDataResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ExportMasterPlayerDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnExportMasterPlayerDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ExportMasterPlayerDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<ExportMasterPlayerDataResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetActionsOnPlayersInSegmentTaskInstance(
         GetTaskInstanceRequest& request,
-        const ProcessApiCallback<GetActionsOnPlayersInSegmentTaskInstanceResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetActionsOnPlayersInSegmentTaskInstanceResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetActionsOnPlayersInSegmentTaskInstanceResult>(
             "/Admin/GetActionsOnPlayersInSegmentTaskInstance",
-            headers,
-            jsonAsString,
-            OnGetActionsOnPlayersInSegmentTaskInstanceResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetActionsOnPlayersInSegmentTaskInstanceResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetActionsOnPlayersInSegmentTaskInstanceResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetActionsOnPlayersInSegmentTaskInstanceResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetActionsOnPlayersInSegmentTaskInstanceResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetAllSegments(
         GetAllSegmentsRequest& request,
-        const ProcessApiCallback<GetAllSegmentsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetAllSegmentsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetAllSegmentsResult>(
             "/Admin/GetAllSegments",
-            headers,
-            jsonAsString,
-            OnGetAllSegmentsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetAllSegmentsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetAllSegmentsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetAllSegmentsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetAllSegmentsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetCatalogItems(
         GetCatalogItemsRequest& request,
-        const ProcessApiCallback<GetCatalogItemsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetCatalogItemsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetCatalogItemsResult>(
             "/Admin/GetCatalogItems",
-            headers,
-            jsonAsString,
-            OnGetCatalogItemsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCatalogItemsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetCatalogItemsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetCatalogItemsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetCatalogItemsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetCloudScriptRevision(
         GetCloudScriptRevisionRequest& request,
-        const ProcessApiCallback<GetCloudScriptRevisionResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetCloudScriptRevisionResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetCloudScriptRevisionResult>(
             "/Admin/GetCloudScriptRevision",
-            headers,
-            jsonAsString,
-            OnGetCloudScriptRevisionResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCloudScriptRevisionResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetCloudScriptRevisionResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetCloudScriptRevisionResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetCloudScriptRevisionResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetCloudScriptTaskInstance(
         GetTaskInstanceRequest& request,
-        const ProcessApiCallback<GetCloudScriptTaskInstanceResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetCloudScriptTaskInstanceResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetCloudScriptTaskInstanceResult>(
             "/Admin/GetCloudScriptTaskInstance",
-            headers,
-            jsonAsString,
-            OnGetCloudScriptTaskInstanceResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCloudScriptTaskInstanceResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetCloudScriptTaskInstanceResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetCloudScriptTaskInstanceResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetCloudScriptTaskInstanceResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetCloudScriptVersions(
         GetCloudScriptVersionsRequest& request,
-        const ProcessApiCallback<GetCloudScriptVersionsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetCloudScriptVersionsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetCloudScriptVersionsResult>(
             "/Admin/GetCloudScriptVersions",
-            headers,
-            jsonAsString,
-            OnGetCloudScriptVersionsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCloudScriptVersionsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetCloudScriptVersionsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetCloudScriptVersionsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetCloudScriptVersionsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetContentList(
         GetContentListRequest& request,
-        const ProcessApiCallback<GetContentListResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetContentListResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetContentListResult>(
             "/Admin/GetContentList",
-            headers,
-            jsonAsString,
-            OnGetContentListResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetContentListResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetContentListResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetContentListResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetContentListResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetContentUploadUrl(
         GetContentUploadUrlRequest& request,
-        const ProcessApiCallback<GetContentUploadUrlResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetContentUploadUrlResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetContentUploadUrlResult>(
             "/Admin/GetContentUploadUrl",
-            headers,
-            jsonAsString,
-            OnGetContentUploadUrlResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetContentUploadUrlResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetContentUploadUrlResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetContentUploadUrlResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetContentUploadUrlResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetDataReport(
         GetDataReportRequest& request,
-        const ProcessApiCallback<GetDataReportResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetDataReportResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetDataReportResult>(
             "/Admin/GetDataReport",
-            headers,
-            jsonAsString,
-            OnGetDataReportResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetDataReportResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetDataReportResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetDataReportResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetDataReportResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetMatchmakerGameInfo(
         GetMatchmakerGameInfoRequest& request,
-        const ProcessApiCallback<GetMatchmakerGameInfoResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetMatchmakerGameInfoResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetMatchmakerGameInfoResult>(
             "/Admin/GetMatchmakerGameInfo",
-            headers,
-            jsonAsString,
-            OnGetMatchmakerGameInfoResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetMatchmakerGameInfoResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetMatchmakerGameInfoResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetMatchmakerGameInfoResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetMatchmakerGameInfoResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetMatchmakerGameModes(
         GetMatchmakerGameModesRequest& request,
-        const ProcessApiCallback<GetMatchmakerGameModesResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetMatchmakerGameModesResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetMatchmakerGameModesResult>(
             "/Admin/GetMatchmakerGameModes",
-            headers,
-            jsonAsString,
-            OnGetMatchmakerGameModesResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetMatchmakerGameModesResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetMatchmakerGameModesResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetMatchmakerGameModesResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetMatchmakerGameModesResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetPlayedTitleList(
         GetPlayedTitleListRequest& request,
-        const ProcessApiCallback<GetPlayedTitleListResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayedTitleListResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayedTitleListResult>(
             "/Admin/GetPlayedTitleList",
-            headers,
-            jsonAsString,
-            OnGetPlayedTitleListResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayedTitleListResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminAPI::OnGetPlayedTitleListResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayedTitleListResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPlayedTitleListResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
-    }
-
-    void PlayFabAdminAPI::GetPlayerIdFromAuthToken(
-        GetPlayerIdFromAuthTokenRequest& request,
-        const ProcessApiCallback<GetPlayerIdFromAuthTokenResult> callback,
-        const ErrorCallback errorCallback,
-        void* customData
-    )
+    void PlayFabAdminAPI::GetPlayerIdFromAuthToken(
+        GetPlayerIdFromAuthTokenRequest& request,
+        ProcessApiCallback<GetPlayerIdFromAuthTokenResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayerIdFromAuthTokenResult>(
             "/Admin/GetPlayerIdFromAuthToken",
-            headers,
-            jsonAsString,
-            OnGetPlayerIdFromAuthTokenResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerIdFromAuthTokenResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetPlayerIdFromAuthTokenResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayerIdFromAuthTokenResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPlayerIdFromAuthTokenResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetPlayerProfile(
         GetPlayerProfileRequest& request,
-        const ProcessApiCallback<GetPlayerProfileResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayerProfileResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayerProfileResult>(
             "/Admin/GetPlayerProfile",
-            headers,
-            jsonAsString,
-            OnGetPlayerProfileResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerProfileResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetPlayerProfileResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayerProfileResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPlayerProfileResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetPlayerSegments(
         GetPlayersSegmentsRequest& request,
-        const ProcessApiCallback<GetPlayerSegmentsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayerSegmentsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayerSegmentsResult>(
             "/Admin/GetPlayerSegments",
-            headers,
-            jsonAsString,
-            OnGetPlayerSegmentsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerSegmentsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetPlayerSegmentsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayerSegmentsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPlayerSegmentsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetPlayerSharedSecrets(
         GetPlayerSharedSecretsRequest& request,
-        const ProcessApiCallback<GetPlayerSharedSecretsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayerSharedSecretsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayerSharedSecretsResult>(
             "/Admin/GetPlayerSharedSecrets",
-            headers,
-            jsonAsString,
-            OnGetPlayerSharedSecretsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerSharedSecretsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetPlayerSharedSecretsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayerSharedSecretsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPlayerSharedSecretsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetPlayersInSegment(
         GetPlayersInSegmentRequest& request,
-        const ProcessApiCallback<GetPlayersInSegmentResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayersInSegmentResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayersInSegmentResult>(
             "/Admin/GetPlayersInSegment",
-            headers,
-            jsonAsString,
-            OnGetPlayersInSegmentResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayersInSegmentResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetPlayersInSegmentResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayersInSegmentResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPlayersInSegmentResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetPlayerStatisticDefinitions(
         GetPlayerStatisticDefinitionsRequest& request,
-        const ProcessApiCallback<GetPlayerStatisticDefinitionsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayerStatisticDefinitionsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayerStatisticDefinitionsResult>(
             "/Admin/GetPlayerStatisticDefinitions",
-            headers,
-            jsonAsString,
-            OnGetPlayerStatisticDefinitionsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerStatisticDefinitionsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetPlayerStatisticDefinitionsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayerStatisticDefinitionsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPlayerStatisticDefinitionsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetPlayerStatisticVersions(
         GetPlayerStatisticVersionsRequest& request,
-        const ProcessApiCallback<GetPlayerStatisticVersionsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayerStatisticVersionsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayerStatisticVersionsResult>(
             "/Admin/GetPlayerStatisticVersions",
-            headers,
-            jsonAsString,
-            OnGetPlayerStatisticVersionsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerStatisticVersionsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetPlayerStatisticVersionsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayerStatisticVersionsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPlayerStatisticVersionsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetPlayerTags(
         GetPlayerTagsRequest& request,
-        const ProcessApiCallback<GetPlayerTagsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayerTagsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayerTagsResult>(
             "/Admin/GetPlayerTags",
-            headers,
-            jsonAsString,
-            OnGetPlayerTagsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerTagsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetPlayerTagsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayerTagsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPlayerTagsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetPolicy(
         GetPolicyRequest& request,
-        const ProcessApiCallback<GetPolicyResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPolicyResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPolicyResponse>(
             "/Admin/GetPolicy",
-            headers,
-            jsonAsString,
-            OnGetPolicyResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPolicyResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetPolicyResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPolicyResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPolicyResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetPublisherData(
         GetPublisherDataRequest& request,
-        const ProcessApiCallback<GetPublisherDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPublisherDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPublisherDataResult>(
             "/Admin/GetPublisherData",
-            headers,
-            jsonAsString,
-            OnGetPublisherDataResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPublisherDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetPublisherDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPublisherDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPublisherDataResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetRandomResultTables(
         GetRandomResultTablesRequest& request,
-        const ProcessApiCallback<GetRandomResultTablesResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetRandomResultTablesResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetRandomResultTablesResult>(
             "/Admin/GetRandomResultTables",
-            headers,
-            jsonAsString,
-            OnGetRandomResultTablesResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetRandomResultTablesResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetRandomResultTablesResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetRandomResultTablesResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetRandomResultTablesResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetSegments(
         GetSegmentsRequest& request,
-        const ProcessApiCallback<GetSegmentsResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetSegmentsResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetSegmentsResponse>(
             "/Admin/GetSegments",
-            headers,
-            jsonAsString,
-            OnGetSegmentsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetSegmentsResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetSegmentsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetSegmentsResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetSegmentsResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetServerBuildInfo(
         GetServerBuildInfoRequest& request,
-        const ProcessApiCallback<GetServerBuildInfoResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetServerBuildInfoResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetServerBuildInfoResult>(
             "/Admin/GetServerBuildInfo",
-            headers,
-            jsonAsString,
-            OnGetServerBuildInfoResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetServerBuildInfoResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetServerBuildInfoResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetServerBuildInfoResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetServerBuildInfoResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetServerBuildUploadUrl(
         GetServerBuildUploadURLRequest& request,
-        const ProcessApiCallback<GetServerBuildUploadURLResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetServerBuildUploadURLResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetServerBuildUploadURLResult>(
             "/Admin/GetServerBuildUploadUrl",
-            headers,
-            jsonAsString,
-            OnGetServerBuildUploadUrlResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetServerBuildUploadURLResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetServerBuildUploadUrlResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetServerBuildUploadURLResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetServerBuildUploadURLResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetStoreItems(
         GetStoreItemsRequest& request,
-        const ProcessApiCallback<GetStoreItemsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetStoreItemsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetStoreItemsResult>(
             "/Admin/GetStoreItems",
-            headers,
-            jsonAsString,
-            OnGetStoreItemsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetStoreItemsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetStoreItemsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetStoreItemsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetStoreItemsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetTaskInstances(
         GetTaskInstancesRequest& request,
-        const ProcessApiCallback<GetTaskInstancesResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetTaskInstancesResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetTaskInstancesResult>(
             "/Admin/GetTaskInstances",
-            headers,
-            jsonAsString,
-            OnGetTaskInstancesResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTaskInstancesResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetTaskInstancesResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetTaskInstancesResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetTaskInstancesResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetTasks(
         GetTasksRequest& request,
-        const ProcessApiCallback<GetTasksResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetTasksResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetTasksResult>(
             "/Admin/GetTasks",
-            headers,
-            jsonAsString,
-            OnGetTasksResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTasksResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetTasksResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetTasksResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetTasksResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetTitleData(
         GetTitleDataRequest& request,
-        const ProcessApiCallback<GetTitleDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetTitleDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetTitleDataResult>(
             "/Admin/GetTitleData",
-            headers,
-            jsonAsString,
-            OnGetTitleDataResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetTitleDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetTitleDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetTitleDataResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetTitleInternalData(
         GetTitleDataRequest& request,
-        const ProcessApiCallback<GetTitleDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetTitleDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetTitleDataResult>(
             "/Admin/GetTitleInternalData",
-            headers,
-            jsonAsString,
-            OnGetTitleInternalDataResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminAPI::OnGetTitleInternalDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminAPI::GetUserAccountInfo(
+        LookupUserAccountInfoRequest& request,
+        ProcessApiCallback<LookupUserAccountInfoResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
+        std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
+        std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        GetTitleDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetTitleDataResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
-    }
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-    void PlayFabAdminAPI::GetUserAccountInfo(
-        LookupUserAccountInfoRequest& request,
-        const ProcessApiCallback<LookupUserAccountInfoResult> callback,
-        const ErrorCallback errorCallback,
-        void* customData
-    )
-    {
-        std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
-        std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
-
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
-
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LookupUserAccountInfoResult>(
             "/Admin/GetUserAccountInfo",
-            headers,
-            jsonAsString,
-            OnGetUserAccountInfoResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LookupUserAccountInfoResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetUserAccountInfoResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        LookupUserAccountInfoResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<LookupUserAccountInfoResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetUserBans(
         GetUserBansRequest& request,
-        const ProcessApiCallback<GetUserBansResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetUserBansResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetUserBansResult>(
             "/Admin/GetUserBans",
-            headers,
-            jsonAsString,
-            OnGetUserBansResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserBansResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetUserBansResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetUserBansResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetUserBansResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetUserData(
         GetUserDataRequest& request,
-        const ProcessApiCallback<GetUserDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetUserDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
-
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetUserDataResult>(
             "/Admin/GetUserData",
-            headers,
-            jsonAsString,
-            OnGetUserDataResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetUserDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetUserDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetUserDataResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetUserInternalData(
         GetUserDataRequest& request,
-        const ProcessApiCallback<GetUserDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetUserDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetUserDataResult>(
             "/Admin/GetUserInternalData",
-            headers,
-            jsonAsString,
-            OnGetUserInternalDataResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetUserInternalDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetUserDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetUserDataResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetUserInventory(
         GetUserInventoryRequest& request,
-        const ProcessApiCallback<GetUserInventoryResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetUserInventoryResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetUserInventoryResult>(
             "/Admin/GetUserInventory",
-            headers,
-            jsonAsString,
-            OnGetUserInventoryResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserInventoryResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetUserInventoryResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetUserInventoryResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetUserInventoryResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetUserPublisherData(
         GetUserDataRequest& request,
-        const ProcessApiCallback<GetUserDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetUserDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetUserDataResult>(
             "/Admin/GetUserPublisherData",
-            headers,
-            jsonAsString,
-            OnGetUserPublisherDataResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetUserPublisherDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetUserDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetUserDataResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetUserPublisherInternalData(
         GetUserDataRequest& request,
-        const ProcessApiCallback<GetUserDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetUserDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetUserDataResult>(
             "/Admin/GetUserPublisherInternalData",
-            headers,
-            jsonAsString,
-            OnGetUserPublisherInternalDataResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetUserPublisherInternalDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetUserDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetUserDataResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetUserPublisherReadOnlyData(
         GetUserDataRequest& request,
-        const ProcessApiCallback<GetUserDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetUserDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetUserDataResult>(
             "/Admin/GetUserPublisherReadOnlyData",
-            headers,
-            jsonAsString,
-            OnGetUserPublisherReadOnlyDataResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetUserPublisherReadOnlyDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetUserDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetUserDataResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GetUserReadOnlyData(
         GetUserDataRequest& request,
-        const ProcessApiCallback<GetUserDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetUserDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetUserDataResult>(
             "/Admin/GetUserReadOnlyData",
-            headers,
-            jsonAsString,
-            OnGetUserReadOnlyDataResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGetUserReadOnlyDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetUserDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetUserDataResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::GrantItemsToUsers(
         GrantItemsToUsersRequest& request,
-        const ProcessApiCallback<GrantItemsToUsersResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GrantItemsToUsersResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
-
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GrantItemsToUsersResult>(
             "/Admin/GrantItemsToUsers",
-            headers,
-            jsonAsString,
-            OnGrantItemsToUsersResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GrantItemsToUsersResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnGrantItemsToUsersResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GrantItemsToUsersResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GrantItemsToUsersResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::IncrementLimitedEditionItemAvailability(
         IncrementLimitedEditionItemAvailabilityRequest& request,
-        const ProcessApiCallback<IncrementLimitedEditionItemAvailabilityResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<IncrementLimitedEditionItemAvailabilityResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<IncrementLimitedEditionItemAvailabilityResult>(
             "/Admin/IncrementLimitedEditionItemAvailability",
-            headers,
-            jsonAsString,
-            OnIncrementLimitedEditionItemAvailabilityResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<IncrementLimitedEditionItemAvailabilityResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnIncrementLimitedEditionItemAvailabilityResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        IncrementLimitedEditionItemAvailabilityResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<IncrementLimitedEditionItemAvailabilityResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::IncrementPlayerStatisticVersion(
         IncrementPlayerStatisticVersionRequest& request,
-        const ProcessApiCallback<IncrementPlayerStatisticVersionResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<IncrementPlayerStatisticVersionResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
-
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<IncrementPlayerStatisticVersionResult>(
             "/Admin/IncrementPlayerStatisticVersion",
-            headers,
-            jsonAsString,
-            OnIncrementPlayerStatisticVersionResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<IncrementPlayerStatisticVersionResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnIncrementPlayerStatisticVersionResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        IncrementPlayerStatisticVersionResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<IncrementPlayerStatisticVersionResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::ListOpenIdConnection(
         ListOpenIdConnectionRequest& request,
-        const ProcessApiCallback<ListOpenIdConnectionResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ListOpenIdConnectionResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ListOpenIdConnectionResponse>(
             "/Admin/ListOpenIdConnection",
-            headers,
-            jsonAsString,
-            OnListOpenIdConnectionResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ListOpenIdConnectionResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnListOpenIdConnectionResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ListOpenIdConnectionResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<ListOpenIdConnectionResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::ListServerBuilds(
         ListBuildsRequest& request,
-        const ProcessApiCallback<ListBuildsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ListBuildsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
-
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ListBuildsResult>(
             "/Admin/ListServerBuilds",
-            headers,
-            jsonAsString,
-            OnListServerBuildsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ListBuildsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnListServerBuildsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ListBuildsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<ListBuildsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::ListVirtualCurrencyTypes(
         ListVirtualCurrencyTypesRequest& request,
-        const ProcessApiCallback<ListVirtualCurrencyTypesResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ListVirtualCurrencyTypesResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ListVirtualCurrencyTypesResult>(
             "/Admin/ListVirtualCurrencyTypes",
-            headers,
-            jsonAsString,
-            OnListVirtualCurrencyTypesResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ListVirtualCurrencyTypesResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnListVirtualCurrencyTypesResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ListVirtualCurrencyTypesResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<ListVirtualCurrencyTypesResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::ModifyMatchmakerGameModes(
         ModifyMatchmakerGameModesRequest& request,
-        const ProcessApiCallback<ModifyMatchmakerGameModesResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ModifyMatchmakerGameModesResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
-
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ModifyMatchmakerGameModesResult>(
             "/Admin/ModifyMatchmakerGameModes",
-            headers,
-            jsonAsString,
-            OnModifyMatchmakerGameModesResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyMatchmakerGameModesResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnModifyMatchmakerGameModesResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ModifyMatchmakerGameModesResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<ModifyMatchmakerGameModesResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::ModifyServerBuild(
         ModifyServerBuildRequest& request,
-        const ProcessApiCallback<ModifyServerBuildResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ModifyServerBuildResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ModifyServerBuildResult>(
             "/Admin/ModifyServerBuild",
-            headers,
-            jsonAsString,
-            OnModifyServerBuildResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyServerBuildResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnModifyServerBuildResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ModifyServerBuildResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<ModifyServerBuildResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::RefundPurchase(
         RefundPurchaseRequest& request,
-        const ProcessApiCallback<RefundPurchaseResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<RefundPurchaseResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<RefundPurchaseResponse>(
             "/Admin/RefundPurchase",
-            headers,
-            jsonAsString,
-            OnRefundPurchaseResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<RefundPurchaseResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnRefundPurchaseResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        RefundPurchaseResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<RefundPurchaseResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::RemovePlayerTag(
         RemovePlayerTagRequest& request,
-        const ProcessApiCallback<RemovePlayerTagResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<RemovePlayerTagResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<RemovePlayerTagResult>(
             "/Admin/RemovePlayerTag",
-            headers,
-            jsonAsString,
-            OnRemovePlayerTagResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<RemovePlayerTagResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnRemovePlayerTagResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        RemovePlayerTagResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<RemovePlayerTagResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::RemoveServerBuild(
         RemoveServerBuildRequest& request,
-        const ProcessApiCallback<RemoveServerBuildResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<RemoveServerBuildResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<RemoveServerBuildResult>(
             "/Admin/RemoveServerBuild",
-            headers,
-            jsonAsString,
-            OnRemoveServerBuildResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<RemoveServerBuildResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnRemoveServerBuildResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        RemoveServerBuildResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<RemoveServerBuildResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::RemoveVirtualCurrencyTypes(
         RemoveVirtualCurrencyTypesRequest& request,
-        const ProcessApiCallback<BlankResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<BlankResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<BlankResult>(
             "/Admin/RemoveVirtualCurrencyTypes",
-            headers,
-            jsonAsString,
-            OnRemoveVirtualCurrencyTypesResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<BlankResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnRemoveVirtualCurrencyTypesResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        BlankResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<BlankResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::ResetCharacterStatistics(
         ResetCharacterStatisticsRequest& request,
-        const ProcessApiCallback<ResetCharacterStatisticsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ResetCharacterStatisticsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
-    )
-    {
-        std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
-        std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
-
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
-
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
-            "/Admin/ResetCharacterStatistics",
-            headers,
-            jsonAsString,
-            OnResetCharacterStatisticsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ResetCharacterStatisticsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnResetCharacterStatisticsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    )
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
+        std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
+        std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        ResetCharacterStatisticsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<ResetCharacterStatisticsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
+
+        PlayFabApiDispatch::MakeApiCall<ResetCharacterStatisticsResult>(
+            "/Admin/ResetCharacterStatistics",
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::ResetPassword(
         ResetPasswordRequest& request,
-        const ProcessApiCallback<ResetPasswordResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ResetPasswordResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ResetPasswordResult>(
             "/Admin/ResetPassword",
-            headers,
-            jsonAsString,
-            OnResetPasswordResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ResetPasswordResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnResetPasswordResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ResetPasswordResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<ResetPasswordResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::ResetUserStatistics(
         ResetUserStatisticsRequest& request,
-        const ProcessApiCallback<ResetUserStatisticsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ResetUserStatisticsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ResetUserStatisticsResult>(
             "/Admin/ResetUserStatistics",
-            headers,
-            jsonAsString,
-            OnResetUserStatisticsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ResetUserStatisticsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnResetUserStatisticsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ResetUserStatisticsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<ResetUserStatisticsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::ResolvePurchaseDispute(
         ResolvePurchaseDisputeRequest& request,
-        const ProcessApiCallback<ResolvePurchaseDisputeResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ResolvePurchaseDisputeResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ResolvePurchaseDisputeResponse>(
             "/Admin/ResolvePurchaseDispute",
-            headers,
-            jsonAsString,
-            OnResolvePurchaseDisputeResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ResolvePurchaseDisputeResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnResolvePurchaseDisputeResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ResolvePurchaseDisputeResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<ResolvePurchaseDisputeResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::RevokeAllBansForUser(
         RevokeAllBansForUserRequest& request,
-        const ProcessApiCallback<RevokeAllBansForUserResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<RevokeAllBansForUserResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<RevokeAllBansForUserResult>(
             "/Admin/RevokeAllBansForUser",
-            headers,
-            jsonAsString,
-            OnRevokeAllBansForUserResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeAllBansForUserResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnRevokeAllBansForUserResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        RevokeAllBansForUserResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<RevokeAllBansForUserResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::RevokeBans(
         RevokeBansRequest& request,
-        const ProcessApiCallback<RevokeBansResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<RevokeBansResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<RevokeBansResult>(
             "/Admin/RevokeBans",
-            headers,
-            jsonAsString,
-            OnRevokeBansResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeBansResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnRevokeBansResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        RevokeBansResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<RevokeBansResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::RevokeInventoryItem(
         RevokeInventoryItemRequest& request,
-        const ProcessApiCallback<RevokeInventoryResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<RevokeInventoryResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<RevokeInventoryResult>(
             "/Admin/RevokeInventoryItem",
-            headers,
-            jsonAsString,
-            OnRevokeInventoryItemResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeInventoryResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnRevokeInventoryItemResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        RevokeInventoryResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<RevokeInventoryResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::RevokeInventoryItems(
         RevokeInventoryItemsRequest& request,
-        const ProcessApiCallback<RevokeInventoryItemsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<RevokeInventoryItemsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<RevokeInventoryItemsResult>(
             "/Admin/RevokeInventoryItems",
-            headers,
-            jsonAsString,
-            OnRevokeInventoryItemsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeInventoryItemsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnRevokeInventoryItemsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        RevokeInventoryItemsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<RevokeInventoryItemsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::RunTask(
         RunTaskRequest& request,
-        const ProcessApiCallback<RunTaskResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<RunTaskResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<RunTaskResult>(
             "/Admin/RunTask",
-            headers,
-            jsonAsString,
-            OnRunTaskResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<RunTaskResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnRunTaskResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        RunTaskResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<RunTaskResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::SendAccountRecoveryEmail(
         SendAccountRecoveryEmailRequest& request,
-        const ProcessApiCallback<SendAccountRecoveryEmailResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<SendAccountRecoveryEmailResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<SendAccountRecoveryEmailResult>(
             "/Admin/SendAccountRecoveryEmail",
-            headers,
-            jsonAsString,
-            OnSendAccountRecoveryEmailResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<SendAccountRecoveryEmailResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnSendAccountRecoveryEmailResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        SendAccountRecoveryEmailResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<SendAccountRecoveryEmailResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::SetCatalogItems(
         UpdateCatalogItemsRequest& request,
-        const ProcessApiCallback<UpdateCatalogItemsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateCatalogItemsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateCatalogItemsResult>(
             "/Admin/SetCatalogItems",
-            headers,
-            jsonAsString,
-            OnSetCatalogItemsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCatalogItemsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnSetCatalogItemsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateCatalogItemsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UpdateCatalogItemsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::SetPlayerSecret(
         SetPlayerSecretRequest& request,
-        const ProcessApiCallback<SetPlayerSecretResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<SetPlayerSecretResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<SetPlayerSecretResult>(
             "/Admin/SetPlayerSecret",
-            headers,
-            jsonAsString,
-            OnSetPlayerSecretResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<SetPlayerSecretResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnSetPlayerSecretResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        SetPlayerSecretResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<SetPlayerSecretResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::SetPublishedRevision(
         SetPublishedRevisionRequest& request,
-        const ProcessApiCallback<SetPublishedRevisionResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<SetPublishedRevisionResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<SetPublishedRevisionResult>(
             "/Admin/SetPublishedRevision",
-            headers,
-            jsonAsString,
-            OnSetPublishedRevisionResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<SetPublishedRevisionResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnSetPublishedRevisionResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        SetPublishedRevisionResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<SetPublishedRevisionResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::SetPublisherData(
         SetPublisherDataRequest& request,
-        const ProcessApiCallback<SetPublisherDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<SetPublisherDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<SetPublisherDataResult>(
             "/Admin/SetPublisherData",
-            headers,
-            jsonAsString,
-            OnSetPublisherDataResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<SetPublisherDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnSetPublisherDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        SetPublisherDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<SetPublisherDataResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::SetStoreItems(
         UpdateStoreItemsRequest& request,
-        const ProcessApiCallback<UpdateStoreItemsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateStoreItemsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateStoreItemsResult>(
             "/Admin/SetStoreItems",
-            headers,
-            jsonAsString,
-            OnSetStoreItemsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateStoreItemsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnSetStoreItemsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateStoreItemsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UpdateStoreItemsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::SetTitleData(
         SetTitleDataRequest& request,
-        const ProcessApiCallback<SetTitleDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<SetTitleDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<SetTitleDataResult>(
             "/Admin/SetTitleData",
-            headers,
-            jsonAsString,
-            OnSetTitleDataResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<SetTitleDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnSetTitleDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        SetTitleDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<SetTitleDataResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::SetTitleDataAndOverrides(
         SetTitleDataAndOverridesRequest& request,
-        const ProcessApiCallback<SetTitleDataAndOverridesResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<SetTitleDataAndOverridesResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<SetTitleDataAndOverridesResult>(
             "/Admin/SetTitleDataAndOverrides",
-            headers,
-            jsonAsString,
-            OnSetTitleDataAndOverridesResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<SetTitleDataAndOverridesResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnSetTitleDataAndOverridesResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        SetTitleDataAndOverridesResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<SetTitleDataAndOverridesResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::SetTitleInternalData(
         SetTitleDataRequest& request,
-        const ProcessApiCallback<SetTitleDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<SetTitleDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<SetTitleDataResult>(
             "/Admin/SetTitleInternalData",
-            headers,
-            jsonAsString,
-            OnSetTitleInternalDataResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<SetTitleDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnSetTitleInternalDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        SetTitleDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<SetTitleDataResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::SetupPushNotification(
         SetupPushNotificationRequest& request,
-        const ProcessApiCallback<SetupPushNotificationResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<SetupPushNotificationResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<SetupPushNotificationResult>(
             "/Admin/SetupPushNotification",
-            headers,
-            jsonAsString,
-            OnSetupPushNotificationResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<SetupPushNotificationResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnSetupPushNotificationResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        SetupPushNotificationResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<SetupPushNotificationResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::SubtractUserVirtualCurrency(
         SubtractUserVirtualCurrencyRequest& request,
-        const ProcessApiCallback<ModifyUserVirtualCurrencyResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ModifyUserVirtualCurrencyResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
-        std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
-        std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
-
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
-
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
-            "/Admin/SubtractUserVirtualCurrency",
-            headers,
-            jsonAsString,
-            OnSubtractUserVirtualCurrencyResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyUserVirtualCurrencyResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnSubtractUserVirtualCurrencyResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
+        std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
+        std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        ModifyUserVirtualCurrencyResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<ModifyUserVirtualCurrencyResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
+
+        PlayFabApiDispatch::MakeApiCall<ModifyUserVirtualCurrencyResult>(
+            "/Admin/SubtractUserVirtualCurrency",
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::UpdateBans(
         UpdateBansRequest& request,
-        const ProcessApiCallback<UpdateBansResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateBansResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateBansResult>(
             "/Admin/UpdateBans",
-            headers,
-            jsonAsString,
-            OnUpdateBansResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateBansResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnUpdateBansResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateBansResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UpdateBansResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::UpdateCatalogItems(
         UpdateCatalogItemsRequest& request,
-        const ProcessApiCallback<UpdateCatalogItemsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateCatalogItemsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateCatalogItemsResult>(
             "/Admin/UpdateCatalogItems",
-            headers,
-            jsonAsString,
-            OnUpdateCatalogItemsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCatalogItemsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnUpdateCatalogItemsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateCatalogItemsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UpdateCatalogItemsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::UpdateCloudScript(
         UpdateCloudScriptRequest& request,
-        const ProcessApiCallback<UpdateCloudScriptResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateCloudScriptResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateCloudScriptResult>(
             "/Admin/UpdateCloudScript",
-            headers,
-            jsonAsString,
-            OnUpdateCloudScriptResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCloudScriptResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnUpdateCloudScriptResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateCloudScriptResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UpdateCloudScriptResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::UpdateOpenIdConnection(
         UpdateOpenIdConnectionRequest& request,
-        const ProcessApiCallback<EmptyResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<EmptyResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<EmptyResponse>(
             "/Admin/UpdateOpenIdConnection",
-            headers,
-            jsonAsString,
-            OnUpdateOpenIdConnectionResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnUpdateOpenIdConnectionResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        EmptyResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<EmptyResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::UpdatePlayerSharedSecret(
         UpdatePlayerSharedSecretRequest& request,
-        const ProcessApiCallback<UpdatePlayerSharedSecretResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdatePlayerSharedSecretResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdatePlayerSharedSecretResult>(
             "/Admin/UpdatePlayerSharedSecret",
-            headers,
-            jsonAsString,
-            OnUpdatePlayerSharedSecretResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdatePlayerSharedSecretResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnUpdatePlayerSharedSecretResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdatePlayerSharedSecretResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UpdatePlayerSharedSecretResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::UpdatePlayerStatisticDefinition(
         UpdatePlayerStatisticDefinitionRequest& request,
-        const ProcessApiCallback<UpdatePlayerStatisticDefinitionResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdatePlayerStatisticDefinitionResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdatePlayerStatisticDefinitionResult>(
             "/Admin/UpdatePlayerStatisticDefinition",
-            headers,
-            jsonAsString,
-            OnUpdatePlayerStatisticDefinitionResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdatePlayerStatisticDefinitionResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnUpdatePlayerStatisticDefinitionResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdatePlayerStatisticDefinitionResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UpdatePlayerStatisticDefinitionResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::UpdatePolicy(
         UpdatePolicyRequest& request,
-        const ProcessApiCallback<UpdatePolicyResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdatePolicyResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdatePolicyResponse>(
             "/Admin/UpdatePolicy",
-            headers,
-            jsonAsString,
-            OnUpdatePolicyResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdatePolicyResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnUpdatePolicyResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdatePolicyResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UpdatePolicyResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::UpdateRandomResultTables(
         UpdateRandomResultTablesRequest& request,
-        const ProcessApiCallback<UpdateRandomResultTablesResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateRandomResultTablesResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateRandomResultTablesResult>(
             "/Admin/UpdateRandomResultTables",
-            headers,
-            jsonAsString,
-            OnUpdateRandomResultTablesResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateRandomResultTablesResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnUpdateRandomResultTablesResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateRandomResultTablesResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UpdateRandomResultTablesResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::UpdateSegment(
         UpdateSegmentRequest& request,
-        const ProcessApiCallback<UpdateSegmentResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateSegmentResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateSegmentResponse>(
             "/Admin/UpdateSegment",
-            headers,
-            jsonAsString,
-            OnUpdateSegmentResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateSegmentResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnUpdateSegmentResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateSegmentResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UpdateSegmentResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::UpdateStoreItems(
         UpdateStoreItemsRequest& request,
-        const ProcessApiCallback<UpdateStoreItemsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateStoreItemsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateStoreItemsResult>(
             "/Admin/UpdateStoreItems",
-            headers,
-            jsonAsString,
-            OnUpdateStoreItemsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateStoreItemsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnUpdateStoreItemsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateStoreItemsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UpdateStoreItemsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::UpdateTask(
         UpdateTaskRequest& request,
-        const ProcessApiCallback<EmptyResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<EmptyResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<EmptyResponse>(
             "/Admin/UpdateTask",
-            headers,
-            jsonAsString,
-            OnUpdateTaskResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnUpdateTaskResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        EmptyResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<EmptyResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::UpdateUserData(
         UpdateUserDataRequest& request,
-        const ProcessApiCallback<UpdateUserDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateUserDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateUserDataResult>(
             "/Admin/UpdateUserData",
-            headers,
-            jsonAsString,
-            OnUpdateUserDataResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnUpdateUserDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateUserDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UpdateUserDataResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::UpdateUserInternalData(
         UpdateUserInternalDataRequest& request,
-        const ProcessApiCallback<UpdateUserDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateUserDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateUserDataResult>(
             "/Admin/UpdateUserInternalData",
-            headers,
-            jsonAsString,
-            OnUpdateUserInternalDataResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnUpdateUserInternalDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateUserDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UpdateUserDataResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::UpdateUserPublisherData(
         UpdateUserDataRequest& request,
-        const ProcessApiCallback<UpdateUserDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateUserDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateUserDataResult>(
             "/Admin/UpdateUserPublisherData",
-            headers,
-            jsonAsString,
-            OnUpdateUserPublisherDataResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnUpdateUserPublisherDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateUserDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UpdateUserDataResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::UpdateUserPublisherInternalData(
         UpdateUserInternalDataRequest& request,
-        const ProcessApiCallback<UpdateUserDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateUserDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateUserDataResult>(
             "/Admin/UpdateUserPublisherInternalData",
-            headers,
-            jsonAsString,
-            OnUpdateUserPublisherInternalDataResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAdminAPI::OnUpdateUserPublisherInternalDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateUserDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UpdateUserDataResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAdminAPI::UpdateUserPublisherReadOnlyData(
         UpdateUserDataRequest& request,
-        const ProcessApiCallback<UpdateUserDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateUserDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateUserDataResult>(
             "/Admin/UpdateUserPublisherReadOnlyData",
-            headers,
-            jsonAsString,
-            OnUpdateUserPublisherReadOnlyDataResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminAPI::OnUpdateUserPublisherReadOnlyDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminAPI::UpdateUserReadOnlyData(
+        UpdateUserDataRequest& request,
+        ProcessApiCallback<UpdateUserDataResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
+        std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
+        std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        UpdateUserDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UpdateUserDataResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
+
+        PlayFabApiDispatch::MakeApiCall<UpdateUserDataResult>(
+            "/Admin/UpdateUserReadOnlyData",
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminAPI::UpdateUserReadOnlyData(
-        UpdateUserDataRequest& request,
-        const ProcessApiCallback<UpdateUserDataResult> callback,
-        const ErrorCallback errorCallback,
+    void PlayFabAdminAPI::UpdateUserTitleDisplayName(
+        UpdateUserTitleDisplayNameRequest& request,
+        ProcessApiCallback<UpdateUserTitleDisplayNameResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabApiDispatch::MakeApiCall<UpdateUserTitleDisplayNameResult>(
+            "/Admin/UpdateUserTitleDisplayName",
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
+    }
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
-            "/Admin/UpdateUserReadOnlyData",
-            headers,
-            jsonAsString,
-            OnUpdateUserReadOnlyDataResult,
-            settings,
-            context,
-            customData));
+    void PlayFabAdminAPI::GetTitleDataLazy(
+        GetTitleDataRequest& request,
+        ProcessApiCallback<PlayFabLazyResult<GetTitleDataResult>> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
+    {
+        std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
+        std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+        PlayFabApiDispatch::MakeApiCall<PlayFabLazyResult<GetTitleDataResult>>(
+            "/Admin/GetTitleData",
+            request,
+            std::move(headers),
+            OnGetTitleDataLazyResult,
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminAPI::OnUpdateUserReadOnlyDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminAPI::OnGetTitleDataLazyResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
         CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
 
-        UpdateUserDataResult outResult;
-        if (ValidateResult(outResult, container))
+        if (PlayFabLazyResultBase::ValidateResult(container))
         {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
+            const ProcessApiCallback<PlayFabLazyResult<GetTitleDataResult>>* callback = container.successCallback.Get<PlayFabLazyResult<GetTitleDataResult>>();
+            if (callback != nullptr)
             {
-                const auto& callback = (*static_cast<ProcessApiCallback<UpdateUserDataResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
+                (*callback)(PlayFabLazyResult<GetTitleDataResult>(container), container.GetCustomData());
             }
         }
     }
 
-    void PlayFabAdminAPI::UpdateUserTitleDisplayName(
-        UpdateUserTitleDisplayNameRequest& request,
-        const ProcessApiCallback<UpdateUserTitleDisplayNameResult> callback,
-        const ErrorCallback errorCallback,
+    void PlayFabAdminAPI::GetPlayersInSegmentLazy(
+        GetPlayersInSegmentRequest& request,
+        ProcessApiCallback<PlayFabLazyResult<GetPlayersInSegmentResult>> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
-
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
-            "/Admin/UpdateUserTitleDisplayName",
-            headers,
-            jsonAsString,
-            OnUpdateUserTitleDisplayNameResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserTitleDisplayNameResult>(callback));
-        reqContainer->errorCallback = errorCallback;
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+        PlayFabApiDispatch::MakeApiCall<PlayFabLazyResult<GetPlayersInSegmentResult>>(
+            "/Admin/GetPlayersInSegment",
+            request,
+            std::move(headers),
+            OnGetPlayersInSegmentLazyResult,
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminAPI::OnUpdateUserTitleDisplayNameResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminAPI::OnGetPlayersInSegmentLazyResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
         CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateUserTitleDisplayNameResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UpdateUserTitleDisplayNameResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
-    }
 
-    bool PlayFabAdminAPI::ValidateResult(PlayFabResultCommon& resultCommon, const CallRequestContainer& container)
-    {
-        if (container.errorWrapper.HttpCode == 200)
+        if (PlayFabLazyResultBase::ValidateResult(container))
         {
-            resultCommon.FromJson(container.errorWrapper.Data);
-            resultCommon.Request = container.errorWrapper.Request;
-            return true;
-        }
-        else // Process the error case
-        {
-            if (PlayFabSettings::globalErrorHandler != nullptr)
-            {
-                PlayFabSettings::globalErrorHandler(container.errorWrapper, container.GetCustomData());
-            }
-            if (container.errorCallback != nullptr)
+            const ProcessApiCallback<PlayFabLazyResult<GetPlayersInSegmentResult>>* callback = container.successCallback.Get<PlayFabLazyResult<GetPlayersInSegmentResult>>();
+            if (callback != nullptr)
             {
-                container.errorCallback(container.errorWrapper, container.GetCustomData());
+                (*callback)(PlayFabLazyResult<GetPlayersInSegmentResult>(container), container.GetCustomData());
             }
-            return false;
         }
     }
 }
@@ -0,0 +1,21819 @@
+#include <stdafx.h>
+
+#if defined(ENABLE_PLAYFABADMIN_API)
+
+#include <playfab/PlayFabAdminDataModels.h>
+
+namespace PlayFab
+{
+    namespace AdminModels
+    {
+        namespace
+        {
+            // The json field names of the models below
+            constexpr PlayFabJsonKey keyABTestParent("ABTestParent");
+            constexpr PlayFabJsonKey keyAPIRequestsIssued("APIRequestsIssued");
+            constexpr PlayFabJsonKey keyARN("ARN");
+            constexpr PlayFabJsonKey keyAction("Action");
+            constexpr PlayFabJsonKey keyActionId("ActionId");
+            constexpr PlayFabJsonKey keyActivationTime("ActivationTime");
+            constexpr PlayFabJsonKey keyActive("Active");
+            constexpr PlayFabJsonKey keyActiveRegions("ActiveRegions");
+            constexpr PlayFabJsonKey keyAdCampaignAttributions("AdCampaignAttributions");
+            constexpr PlayFabJsonKey keyAdCampaignFilter("AdCampaignFilter");
+            constexpr PlayFabJsonKey keyAggregationMethod("AggregationMethod");
+            constexpr PlayFabJsonKey keyAllPlayersFilter("AllPlayersFilter");
+            constexpr PlayFabJsonKey keyAmount("Amount");
+            constexpr PlayFabJsonKey keyAndroidDeviceId("AndroidDeviceId");
+            constexpr PlayFabJsonKey keyAndroidDeviceInfo("AndroidDeviceInfo");
+            constexpr PlayFabJsonKey keyAnnotation("Annotation");
+            constexpr PlayFabJsonKey keyApiConditions("ApiConditions");
+            constexpr PlayFabJsonKey keyAppleAccountInfo("AppleAccountInfo");
+            constexpr PlayFabJsonKey keyAppleSubjectId("AppleSubjectId");
+            constexpr PlayFabJsonKey keyArchiveDownloadUrl("ArchiveDownloadUrl");
+            constexpr PlayFabJsonKey keyArgument("Argument");
+            constexpr PlayFabJsonKey keyAttributedAt("AttributedAt");
+            constexpr PlayFabJsonKey keyAuthorizationUrl("AuthorizationUrl");
+            constexpr PlayFabJsonKey keyAvatarUrl("AvatarUrl");
+            constexpr PlayFabJsonKey keyAzureFunction("AzureFunction");
+            constexpr PlayFabJsonKey keyBalance("Balance");
+            constexpr PlayFabJsonKey keyBalanceChange("BalanceChange");
+            constexpr PlayFabJsonKey keyBanData("BanData");
+            constexpr PlayFabJsonKey keyBanHours("BanHours");
+            constexpr PlayFabJsonKey keyBanId("BanId");
+            constexpr PlayFabJsonKey keyBanIds("BanIds");
+            constexpr PlayFabJsonKey keyBanPlayerAction("BanPlayerAction");
+            constexpr PlayFabJsonKey keyBannedUntil("BannedUntil");
+            constexpr PlayFabJsonKey keyBans("Bans");
+            constexpr PlayFabJsonKey keyBody("Body");
+            constexpr PlayFabJsonKey keyBuildId("BuildId");
+            constexpr PlayFabJsonKey keyBuildVersion("BuildVersion");
+            constexpr PlayFabJsonKey keyBuilds("Builds");
+            constexpr PlayFabJsonKey keyBundle("Bundle");
+            constexpr PlayFabJsonKey keyBundleContents("BundleContents");
+            constexpr PlayFabJsonKey keyBundleParent("BundleParent");
+            constexpr PlayFabJsonKey keyBundledItems("BundledItems");
+            constexpr PlayFabJsonKey keyBundledResultTables("BundledResultTables");
+            constexpr PlayFabJsonKey keyBundledVirtualCurrencies("BundledVirtualCurrencies");
+            constexpr PlayFabJsonKey keyCampaignId("CampaignId");
+            constexpr PlayFabJsonKey keyCampaignSource("CampaignSource");
+            constexpr PlayFabJsonKey keyCanBecomeCharacter("CanBecomeCharacter");
+            constexpr PlayFabJsonKey keyCatalog("Catalog");
+            constexpr PlayFabJsonKey keyCatalogVersion("CatalogVersion");
+            constexpr PlayFabJsonKey keyCatelogId("CatelogId");
+            constexpr PlayFabJsonKey keyCharacterId("CharacterId");
+            constexpr PlayFabJsonKey keyCity("City");
+            constexpr PlayFabJsonKey keyClientId("ClientId");
+            constexpr PlayFabJsonKey keyClientSecret("ClientSecret");
+            constexpr PlayFabJsonKey keyCloudScriptFunction("CloudScriptFunction");
+            constexpr PlayFabJsonKey keyCloudScriptPublishResultsToPlayStream("CloudScriptPublishResultsToPlayStream");
+            constexpr PlayFabJsonKey keyCommandLineTemplate("CommandLineTemplate");
+            constexpr PlayFabJsonKey keyComment("Comment");
+            constexpr PlayFabJsonKey keyComparison("Comparison");
+            constexpr PlayFabJsonKey keyCompletedAt("CompletedAt");
+            constexpr PlayFabJsonKey keyConnectionId("ConnectionId");
+            constexpr PlayFabJsonKey keyConnections("Connections");
+            constexpr PlayFabJsonKey keyConsumable("Consumable");
+            constexpr PlayFabJsonKey keyContactEmailAddresses("ContactEmailAddresses");
+            constexpr PlayFabJsonKey keyContainer("Container");
+            constexpr PlayFabJsonKey keyContentType("ContentType");
+            constexpr PlayFabJsonKey keyContents("Contents");
+            constexpr PlayFabJsonKey keyContinentCode("ContinentCode");
+            constexpr PlayFabJsonKey keyContinuationToken("ContinuationToken");
+            constexpr PlayFabJsonKey keyCountryCode("CountryCode");
+            constexpr PlayFabJsonKey keyCreated("Created");
+            constexpr PlayFabJsonKey keyCreatedAt("CreatedAt");
+            constexpr PlayFabJsonKey keyCredential("Credential");
+            constexpr PlayFabJsonKey keyCurrency("Currency");
+            constexpr PlayFabJsonKey keyCurrencyCode("CurrencyCode");
+            constexpr PlayFabJsonKey keyCurrentVersion("CurrentVersion");
+            constexpr PlayFabJsonKey keyCustomData("CustomData");
+            constexpr PlayFabJsonKey keyCustomId("CustomId");
+            constexpr PlayFabJsonKey keyCustomIdInfo("CustomIdInfo");
+            constexpr PlayFabJsonKey keyCustomTags("CustomTags");
+            constexpr PlayFabJsonKey keyData("Data");
+            constexpr PlayFabJsonKey keyDataVersion("DataVersion");
+            constexpr PlayFabJsonKey keyDay("Day");
+            constexpr PlayFabJsonKey keyDeactivationTime("DeactivationTime");
+            constexpr PlayFabJsonKey keyDeletePlayerAction("DeletePlayerAction");
+            constexpr PlayFabJsonKey keyDeletePlayerStatisticAction("DeletePlayerStatisticAction");
+            constexpr PlayFabJsonKey keyDescription("Description");
+            constexpr PlayFabJsonKey keyDeveloperPlayFabId("DeveloperPlayFabId");
+            constexpr PlayFabJsonKey keyDisabled("Disabled");
+            constexpr PlayFabJsonKey keyDiscoverConfiguration("DiscoverConfiguration");
+            constexpr PlayFabJsonKey keyDisplayName("DisplayName");
+            constexpr PlayFabJsonKey keyDisplayPosition("DisplayPosition");
+            constexpr PlayFabJsonKey keyDownloadUrl("DownloadUrl");
+            constexpr PlayFabJsonKey keyDurationInHours("DurationInHours");
+            constexpr PlayFabJsonKey keyDurationInMinutes("DurationInMinutes");
+            constexpr PlayFabJsonKey keyEffect("Effect");
+            constexpr PlayFabJsonKey keyEmail("Email");
+            constexpr PlayFabJsonKey keyEmailAddress("EmailAddress");
+            constexpr PlayFabJsonKey keyEmailNotificationAction("EmailNotificationAction");
+            constexpr PlayFabJsonKey keyEmailTemplateId("EmailTemplateId");
+            constexpr PlayFabJsonKey keyEmailTemplateName("EmailTemplateName");
+            constexpr PlayFabJsonKey keyEndTime("EndTime");
+            constexpr PlayFabJsonKey keyEnteredSegmentActions("EnteredSegmentActions");
+            constexpr PlayFabJsonKey keyError("Error");
+            constexpr PlayFabJsonKey keyErrorMessage("ErrorMessage");
+            constexpr PlayFabJsonKey keyErrorWasFatal("ErrorWasFatal");
+            constexpr PlayFabJsonKey keyErrors("Errors");
+            constexpr PlayFabJsonKey keyEstimatedSecondsRemaining("EstimatedSecondsRemaining");
+            constexpr PlayFabJsonKey keyExecutablePath("ExecutablePath");
+            constexpr PlayFabJsonKey keyExecuteAzureFunctionAction("ExecuteAzureFunctionAction");
+            constexpr PlayFabJsonKey keyExecuteCloudScriptAction("ExecuteCloudScriptAction");
+            constexpr PlayFabJsonKey keyExecutionTimeSeconds("ExecutionTimeSeconds");
+            constexpr PlayFabJsonKey keyExperimentVariants("ExperimentVariants");
+            constexpr PlayFabJsonKey keyExpiration("Expiration");
+            constexpr PlayFabJsonKey keyExpires("Expires");
+            constexpr PlayFabJsonKey keyFacebookId("FacebookId");
+            constexpr PlayFabJsonKey keyFacebookInfo("FacebookInfo");
+            constexpr PlayFabJsonKey keyFacebookInstantGamesId("FacebookInstantGamesId");
+            constexpr PlayFabJsonKey keyFacebookInstantGamesIdInfo("FacebookInstantGamesIdInfo");
+            constexpr PlayFabJsonKey keyFileContents("FileContents");
+            constexpr PlayFabJsonKey keyFilename("Filename");
+            constexpr PlayFabJsonKey keyFiles("Files");
+            constexpr PlayFabJsonKey keyFilterValue("FilterValue");
+            constexpr PlayFabJsonKey keyFirstLogin("FirstLogin");
+            constexpr PlayFabJsonKey keyFirstLoginDateFilter("FirstLoginDateFilter");
+            constexpr PlayFabJsonKey keyFirstLoginFilter("FirstLoginFilter");
+            constexpr PlayFabJsonKey keyFriendlyName("FriendlyName");
+            constexpr PlayFabJsonKey keyFullName("FullName");
+            constexpr PlayFabJsonKey keyFunctionName("FunctionName");
+            constexpr PlayFabJsonKey keyFunctionParameter("FunctionParameter");
+            constexpr PlayFabJsonKey keyFunctionParameterJson("FunctionParameterJson");
+            constexpr PlayFabJsonKey keyFunctionResult("FunctionResult");
+            constexpr PlayFabJsonKey keyFunctionResultTooLarge("FunctionResultTooLarge");
+            constexpr PlayFabJsonKey keyGameCenterId("GameCenterId");
+            constexpr PlayFabJsonKey keyGameCenterInfo("GameCenterInfo");
+            constexpr PlayFabJsonKey keyGameModes("GameModes");
+            constexpr PlayFabJsonKey keyGamemode("Gamemode");
+            constexpr PlayFabJsonKey keyGenerateFunctionExecutedEvents("GenerateFunctionExecutedEvents");
+            constexpr PlayFabJsonKey keyGoogleEmail("GoogleEmail");
+            constexpr PlayFabJsonKey keyGoogleGender("GoogleGender");
+            constexpr PlayFabJsonKey keyGoogleId("GoogleId");
+            constexpr PlayFabJsonKey keyGoogleInfo("GoogleInfo");
+            constexpr PlayFabJsonKey keyGoogleLocale("GoogleLocale");
+            constexpr PlayFabJsonKey keyGoogleName("GoogleName");
+            constexpr PlayFabJsonKey keyGrantItemAction("GrantItemAction");
+            constexpr PlayFabJsonKey keyGrantVirtualCurrencyAction("GrantVirtualCurrencyAction");
+            constexpr PlayFabJsonKey keyHasSignatureOrEncryption("HasSignatureOrEncryption");
+            constexpr PlayFabJsonKey keyHttpRequestsIssued("HttpRequestsIssued");
+            constexpr PlayFabJsonKey keyIPAddress("IPAddress");
+            constexpr PlayFabJsonKey keyId("Id");
+            constexpr PlayFabJsonKey keyIdentifier("Identifier");
+            constexpr PlayFabJsonKey keyIfChangedFromDataVersion("IfChangedFromDataVersion");
+            constexpr PlayFabJsonKey keyIgnoreNonce("IgnoreNonce");
+            constexpr PlayFabJsonKey keyIncrementPlayerStatisticAction("IncrementPlayerStatisticAction");
+            constexpr PlayFabJsonKey keyIncrementValue("IncrementValue");
+            constexpr PlayFabJsonKey keyInitialDeposit("InitialDeposit");
+            constexpr PlayFabJsonKey keyInitialLimitedEditionCount("InitialLimitedEditionCount");
+            constexpr PlayFabJsonKey keyInitialSubscriptionTime("InitialSubscriptionTime");
+            constexpr PlayFabJsonKey keyInventory("Inventory");
+            constexpr PlayFabJsonKey keyIosDeviceId("IosDeviceId");
+            constexpr PlayFabJsonKey keyIosDeviceInfo("IosDeviceInfo");
+            constexpr PlayFabJsonKey keyIsActive("IsActive");
+            constexpr PlayFabJsonKey keyIsLimitedEdition("IsLimitedEdition");
+            constexpr PlayFabJsonKey keyIsPublished("IsPublished");
+            constexpr PlayFabJsonKey keyIsStackable("IsStackable");
+            constexpr PlayFabJsonKey keyIsTradable("IsTradable");
+            constexpr PlayFabJsonKey keyIssuer("Issuer");
+            constexpr PlayFabJsonKey keyIssuerDiscoveryUrl("IssuerDiscoveryUrl");
+            constexpr PlayFabJsonKey keyIssuerInformation("IssuerInformation");
+            constexpr PlayFabJsonKey keyItem("Item");
+            constexpr PlayFabJsonKey keyItemClass("ItemClass");
+            constexpr PlayFabJsonKey keyItemContents("ItemContents");
+            constexpr PlayFabJsonKey keyItemCount("ItemCount");
+            constexpr PlayFabJsonKey keyItemGrantResults("ItemGrantResults");
+            constexpr PlayFabJsonKey keyItemGrants("ItemGrants");
+            constexpr PlayFabJsonKey keyItemId("ItemId");
+            constexpr PlayFabJsonKey keyItemImageUrl("ItemImageUrl");
+            constexpr PlayFabJsonKey keyItemInstanceId("ItemInstanceId");
+            constexpr PlayFabJsonKey keyItems("Items");
+            constexpr PlayFabJsonKey keyJobReceiptId("JobReceiptId");
+            constexpr PlayFabJsonKey keyJsonWebKeySet("JsonWebKeySet");
+            constexpr PlayFabJsonKey keyKey("Key");
+            constexpr PlayFabJsonKey keyKeyItemId("KeyItemId");
+            constexpr PlayFabJsonKey keyKeyValues("KeyValues");
+            constexpr PlayFabJsonKey keyKeys("Keys");
+            constexpr PlayFabJsonKey keyKeysToRemove("KeysToRemove");
+            constexpr PlayFabJsonKey keyKongregateId("KongregateId");
+            constexpr PlayFabJsonKey keyKongregateInfo("KongregateInfo");
+            constexpr PlayFabJsonKey keyKongregateName("KongregateName");
+            constexpr PlayFabJsonKey keyLanguage("Language");
+            constexpr PlayFabJsonKey keyLastLogin("LastLogin");
+            constexpr PlayFabJsonKey keyLastLoginDateFilter("LastLoginDateFilter");
+            constexpr PlayFabJsonKey keyLastLoginFilter("LastLoginFilter");
+            constexpr PlayFabJsonKey keyLastModified("LastModified");
+            constexpr PlayFabJsonKey keyLastRunTime("LastRunTime");
+            constexpr PlayFabJsonKey keyLastUpdateTime("LastUpdateTime");
+            constexpr PlayFabJsonKey keyLastUpdated("LastUpdated");
+            constexpr PlayFabJsonKey keyLatestRevision("LatestRevision");
+            constexpr PlayFabJsonKey keyLatitude("Latitude");
+            constexpr PlayFabJsonKey keyLeftSegmentActions("LeftSegmentActions");
+            constexpr PlayFabJsonKey keyLevel("Level");
+            constexpr PlayFabJsonKey keyLinkedAccounts("LinkedAccounts");
+            constexpr PlayFabJsonKey keyLinkedUserAccountFilter("LinkedUserAccountFilter");
+            constexpr PlayFabJsonKey keyLinkedUserAccountHasEmailFilter("LinkedUserAccountHasEmailFilter");
+            constexpr PlayFabJsonKey keyLobbyId("LobbyId");
+            constexpr PlayFabJsonKey keyLocationFilter("LocationFilter");
+            constexpr PlayFabJsonKey keyLocations("Locations");
+            constexpr PlayFabJsonKey keyLogInDate("LogInDate");
+            constexpr PlayFabJsonKey keyLoginProvider("LoginProvider");
+            constexpr PlayFabJsonKey keyLogs("Logs");
+            constexpr PlayFabJsonKey keyLogsTooLarge("LogsTooLarge");
+            constexpr PlayFabJsonKey keyLongitude("Longitude");
+            constexpr PlayFabJsonKey keyMACAddress("MACAddress");
+            constexpr PlayFabJsonKey keyMarketingData("MarketingData");
+            constexpr PlayFabJsonKey keyMaxBatchSize("MaxBatchSize");
+            constexpr PlayFabJsonKey keyMaxGamesPerHost("MaxGamesPerHost");
+            constexpr PlayFabJsonKey keyMaxPlayerCount("MaxPlayerCount");
+            constexpr PlayFabJsonKey keyMembershipExpiration("MembershipExpiration");
+            constexpr PlayFabJsonKey keyMembershipId("MembershipId");
+            constexpr PlayFabJsonKey keyMemberships("Memberships");
+            constexpr PlayFabJsonKey keyMemoryConsumedBytes("MemoryConsumedBytes");
+            constexpr PlayFabJsonKey keyMessage("Message");
+            constexpr PlayFabJsonKey keyMetaData("MetaData");
+            constexpr PlayFabJsonKey keyMetadata("Metadata");
+            constexpr PlayFabJsonKey keyMinFreeGameSlots("MinFreeGameSlots");
+            constexpr PlayFabJsonKey keyMinPlayerCount("MinPlayerCount");
+            constexpr PlayFabJsonKey keyMode("Mode");
+            constexpr PlayFabJsonKey keyMonth("Month");
+            constexpr PlayFabJsonKey keyName("Name");
+            constexpr PlayFabJsonKey keyNamespace("Namespace");
+            constexpr PlayFabJsonKey keyNewsId("NewsId");
+            constexpr PlayFabJsonKey keyNextRunTime("NextRunTime");
+            constexpr PlayFabJsonKey keyNintendoSwitchAccountInfo("NintendoSwitchAccountInfo");
+            constexpr PlayFabJsonKey keyNintendoSwitchAccountSubjectId("NintendoSwitchAccountSubjectId");
+            constexpr PlayFabJsonKey keyNintendoSwitchDeviceId("NintendoSwitchDeviceId");
+            constexpr PlayFabJsonKey keyNintendoSwitchDeviceIdInfo("NintendoSwitchDeviceIdInfo");
+            constexpr PlayFabJsonKey keyNodes("Nodes");
+            constexpr PlayFabJsonKey keyNotificationEndpointARN("NotificationEndpointARN");
+            constexpr PlayFabJsonKey keyOpenIdInfo("OpenIdInfo");
+            constexpr PlayFabJsonKey keyOrderId("OrderId");
+            constexpr PlayFabJsonKey keyOrigination("Origination");
+            constexpr PlayFabJsonKey keyOutcome("Outcome");
+            constexpr PlayFabJsonKey keyOverrideExpiration("OverrideExpiration");
+            constexpr PlayFabJsonKey keyOverrideLabel("OverrideLabel");
+            constexpr PlayFabJsonKey keyOverwriteOldARN("OverwriteOldARN");
+            constexpr PlayFabJsonKey keyOverwritePolicy("OverwritePolicy");
+            constexpr PlayFabJsonKey keyParameter("Parameter");
+            constexpr PlayFabJsonKey keyPassword("Password");
+            constexpr PlayFabJsonKey keyPercentComplete("PercentComplete");
+            constexpr PlayFabJsonKey keyPermanent("Permanent");
+            constexpr PlayFabJsonKey keyPermission("Permission");
+            constexpr PlayFabJsonKey keyPlatform("Platform");
+            constexpr PlayFabJsonKey keyPlatformUserId("PlatformUserId");
+            constexpr PlayFabJsonKey keyPlayFabId("PlayFabId");
+            constexpr PlayFabJsonKey keyPlayerExperimentVariants("PlayerExperimentVariants");
+            constexpr PlayFabJsonKey keyPlayerId("PlayerId");
+            constexpr PlayFabJsonKey keyPlayerProfile("PlayerProfile");
+            constexpr PlayFabJsonKey keyPlayerProfiles("PlayerProfiles");
+            constexpr PlayFabJsonKey keyPlayerSecret("PlayerSecret");
+            constexpr PlayFabJsonKey keyPlayerStatistics("PlayerStatistics");
+            constexpr PlayFabJsonKey keyPlayers("Players");
+            constexpr PlayFabJsonKey keyPolicyName("PolicyName");
+            constexpr PlayFabJsonKey keyPrefix("Prefix");
+            constexpr PlayFabJsonKey keyPrincipal("Principal");
+            constexpr PlayFabJsonKey keyPrivateInfo("PrivateInfo");
+            constexpr PlayFabJsonKey keyProcessorTimeSeconds("ProcessorTimeSeconds");
+            constexpr PlayFabJsonKey keyProfileConstraints("ProfileConstraints");
+            constexpr PlayFabJsonKey keyProfilesInSegment("ProfilesInSegment");
+            constexpr PlayFabJsonKey keyPsnAccountId("PsnAccountId");
+            constexpr PlayFabJsonKey keyPsnInfo("PsnInfo");
+            constexpr PlayFabJsonKey keyPsnOnlineId("PsnOnlineId");
+            constexpr PlayFabJsonKey keyPublish("Publish");
+            constexpr PlayFabJsonKey keyPublishedRevision("PublishedRevision");
+            constexpr PlayFabJsonKey keyPublisherId("PublisherId");
+            constexpr PlayFabJsonKey keyPurchaseDate("PurchaseDate");
+            constexpr PlayFabJsonKey keyPurchaseStatus("PurchaseStatus");
+            constexpr PlayFabJsonKey keyPushNotificationAction("PushNotificationAction");
+            constexpr PlayFabJsonKey keyPushNotificationDevicePlatform("PushNotificationDevicePlatform");
+            constexpr PlayFabJsonKey keyPushNotificationFilter("PushNotificationFilter");
+            constexpr PlayFabJsonKey keyPushNotificationRegistrations("PushNotificationRegistrations");
+            constexpr PlayFabJsonKey keyPushNotificationTemplateId("PushNotificationTemplateId");
+            constexpr PlayFabJsonKey keyQuantity("Quantity");
+            constexpr PlayFabJsonKey keyRealCurrencyPrices("RealCurrencyPrices");
+            constexpr PlayFabJsonKey keyReason("Reason");
+            constexpr PlayFabJsonKey keyReasonForBan("ReasonForBan");
+            constexpr PlayFabJsonKey keyRechargeMax("RechargeMax");
+            constexpr PlayFabJsonKey keyRechargeRate("RechargeRate");
+            constexpr PlayFabJsonKey keyRechargeTime("RechargeTime");
+            constexpr PlayFabJsonKey keyRegion("Region");
+            constexpr PlayFabJsonKey keyRemainingUses("RemainingUses");
+            constexpr PlayFabJsonKey keyReportName("ReportName");
+            constexpr PlayFabJsonKey keyResource("Resource");
+            constexpr PlayFabJsonKey keyResult("Result");
+            constexpr PlayFabJsonKey keyResultItem("ResultItem");
+            constexpr PlayFabJsonKey keyResultItemType("ResultItemType");
+            constexpr PlayFabJsonKey keyResultTableContents("ResultTableContents");
+            constexpr PlayFabJsonKey keyRevision("Revision");
+            constexpr PlayFabJsonKey keySchedule("Schedule");
+            constexpr PlayFabJsonKey keyScheduledActivationTime("ScheduledActivationTime");
+            constexpr PlayFabJsonKey keyScheduledByUserId("ScheduledByUserId");
+            constexpr PlayFabJsonKey keyScheduledDeactivationTime("ScheduledDeactivationTime");
+            constexpr PlayFabJsonKey keySecondsToLive("SecondsToLive");
+            constexpr PlayFabJsonKey keySecondsToRecharge("SecondsToRecharge");
+            constexpr PlayFabJsonKey keySecretKey("SecretKey");
+            constexpr PlayFabJsonKey keySegmentAndDefinitions("SegmentAndDefinitions");
+            constexpr PlayFabJsonKey keySegmentId("SegmentId");
+            constexpr PlayFabJsonKey keySegmentIds("SegmentIds");
+            constexpr PlayFabJsonKey keySegmentModel("SegmentModel");
+            constexpr PlayFabJsonKey keySegmentOrDefinitions("SegmentOrDefinitions");
+            constexpr PlayFabJsonKey keySegments("Segments");
+            constexpr PlayFabJsonKey keyServerIPV4Address("ServerIPV4Address");
+            constexpr PlayFabJsonKey keyServerIPV6Address("ServerIPV6Address");
+            constexpr PlayFabJsonKey keyServerPort("ServerPort");
+            constexpr PlayFabJsonKey keyServerPublicDNSName("ServerPublicDNSName");
+            constexpr PlayFabJsonKey keySetAsDefaultCatalog("SetAsDefaultCatalog");
+            constexpr PlayFabJsonKey keySharedSecrets("SharedSecrets");
+            constexpr PlayFabJsonKey keyShowAvatarUrl("ShowAvatarUrl");
+            constexpr PlayFabJsonKey keyShowBannedUntil("ShowBannedUntil");
+            constexpr PlayFabJsonKey keyShowCampaignAttributions("ShowCampaignAttributions");
+            constexpr PlayFabJsonKey keyShowContactEmailAddresses("ShowContactEmailAddresses");
+            constexpr PlayFabJsonKey keyShowCreated("ShowCreated");
+            constexpr PlayFabJsonKey keyShowDisplayName("ShowDisplayName");
+            constexpr PlayFabJsonKey keyShowExperimentVariants("ShowExperimentVariants");
+            constexpr PlayFabJsonKey keyShowLastLogin("ShowLastLogin");
+            constexpr PlayFabJsonKey keyShowLinkedAccounts("ShowLinkedAccounts");
+            constexpr PlayFabJsonKey keyShowLocations("ShowLocations");
+            constexpr PlayFabJsonKey keyShowMemberships("ShowMemberships");
+            constexpr PlayFabJsonKey keyShowOrigination("ShowOrigination");
+            constexpr PlayFabJsonKey keyShowPushNotificationRegistrations("ShowPushNotificationRegistrations");
+            constexpr PlayFabJsonKey keyShowStatistics("ShowStatistics");
+            constexpr PlayFabJsonKey keyShowTags("ShowTags");
+            constexpr PlayFabJsonKey keyShowTotalValueToDateInUsd("ShowTotalValueToDateInUsd");
+            constexpr PlayFabJsonKey keyShowValuesToDate("ShowValuesToDate");
+            constexpr PlayFabJsonKey keySize("Size");
+            constexpr PlayFabJsonKey keySource("Source");
+            constexpr PlayFabJsonKey keyStackTrace("StackTrace");
+            constexpr PlayFabJsonKey keyStartOpen("StartOpen");
+            constexpr PlayFabJsonKey keyStartTime("StartTime");
+            constexpr PlayFabJsonKey keyStartedAt("StartedAt");
+            constexpr PlayFabJsonKey keyStartedAtRangeFrom("StartedAtRangeFrom");
+            constexpr PlayFabJsonKey keyStartedAtRangeTo("StartedAtRangeTo");
+            constexpr PlayFabJsonKey keyStatements("Statements");
+            constexpr PlayFabJsonKey keyStatistic("Statistic");
+            constexpr PlayFabJsonKey keyStatisticFilter("StatisticFilter");
+            constexpr PlayFabJsonKey keyStatisticName("StatisticName");
+            constexpr PlayFabJsonKey keyStatisticValue("StatisticValue");
+            constexpr PlayFabJsonKey keyStatisticVersion("StatisticVersion");
+            constexpr PlayFabJsonKey keyStatisticVersions("StatisticVersions");
+            constexpr PlayFabJsonKey keyStatistics("Statistics");
+            constexpr PlayFabJsonKey keyStatus("Status");
+            constexpr PlayFabJsonKey keyStatusFilter("StatusFilter");
+            constexpr PlayFabJsonKey keySteamActivationStatus("SteamActivationStatus");
+            constexpr PlayFabJsonKey keySteamCountry("SteamCountry");
+            constexpr PlayFabJsonKey keySteamCurrency("SteamCurrency");
+            constexpr PlayFabJsonKey keySteamId("SteamId");
+            constexpr PlayFabJsonKey keySteamInfo("SteamInfo");
+            constexpr PlayFabJsonKey keySteamName("SteamName");
+            constexpr PlayFabJsonKey keyStore("Store");
+            constexpr PlayFabJsonKey keyStoreId("StoreId");
+            constexpr PlayFabJsonKey keySubject("Subject");
+            constexpr PlayFabJsonKey keySubscriptionId("SubscriptionId");
+            constexpr PlayFabJsonKey keySubscriptionItemId("SubscriptionItemId");
+            constexpr PlayFabJsonKey keySubscriptionProvider("SubscriptionProvider");
+            constexpr PlayFabJsonKey keySubscriptions("Subscriptions");
+            constexpr PlayFabJsonKey keySummaries("Summaries");
+            constexpr PlayFabJsonKey keySummary("Summary");
+            constexpr PlayFabJsonKey keyTableId("TableId");
+            constexpr PlayFabJsonKey keyTables("Tables");
+            constexpr PlayFabJsonKey keyTagFilter("TagFilter");
+            constexpr PlayFabJsonKey keyTagName("TagName");
+            constexpr PlayFabJsonKey keyTagValue("TagValue");
+            constexpr PlayFabJsonKey keyTags("Tags");
+            constexpr PlayFabJsonKey keyTaskId("TaskId");
+            constexpr PlayFabJsonKey keyTaskIdentifier("TaskIdentifier");
+            constexpr PlayFabJsonKey keyTaskInstanceId("TaskInstanceId");
+            constexpr PlayFabJsonKey keyTasks("Tasks");
+            constexpr PlayFabJsonKey keyTimestamp("Timestamp");
+            constexpr PlayFabJsonKey keyTitle("Title");
+            constexpr PlayFabJsonKey keyTitleDisplayName("TitleDisplayName");
+            constexpr PlayFabJsonKey keyTitleId("TitleId");
+            constexpr PlayFabJsonKey keyTitleIds("TitleIds");
+            constexpr PlayFabJsonKey keyTitleInfo("TitleInfo");
+            constexpr PlayFabJsonKey keyTitlePlayerAccount("TitlePlayerAccount");
+            constexpr PlayFabJsonKey keyToken("Token");
+            constexpr PlayFabJsonKey keyTokenType("TokenType");
+            constexpr PlayFabJsonKey keyTokenUrl("TokenUrl");
+            constexpr PlayFabJsonKey keyTotalPlayersInSegment("TotalPlayersInSegment");
+            constexpr PlayFabJsonKey keyTotalPlayersProcessed("TotalPlayersProcessed");
+            constexpr PlayFabJsonKey keyTotalSize("TotalSize");
+            constexpr PlayFabJsonKey keyTotalValue("TotalValue");
+            constexpr PlayFabJsonKey keyTotalValueAsDecimal("TotalValueAsDecimal");
+            constexpr PlayFabJsonKey keyTotalValueToDateInUSD("TotalValueToDateInUSD");
+            constexpr PlayFabJsonKey keyTotalValueToDateInUSDFilter("TotalValueToDateInUSDFilter");
+            constexpr PlayFabJsonKey keyTwitchId("TwitchId");
+            constexpr PlayFabJsonKey keyTwitchInfo("TwitchInfo");
+            constexpr PlayFabJsonKey keyTwitchUserName("TwitchUserName");
+            constexpr PlayFabJsonKey keyType("Type");
+            constexpr PlayFabJsonKey keyURL("URL");
+            constexpr PlayFabJsonKey keyUnitCurrency("UnitCurrency");
+            constexpr PlayFabJsonKey keyUnitPrice("UnitPrice");
+            constexpr PlayFabJsonKey keyUsageCount("UsageCount");
+            constexpr PlayFabJsonKey keyUsagePeriod("UsagePeriod");
+            constexpr PlayFabJsonKey keyUsagePeriodGroup("UsagePeriodGroup");
+            constexpr PlayFabJsonKey keyUseCurrentVersion("UseCurrentVersion");
+            constexpr PlayFabJsonKey keyUserInfo("UserInfo");
+            constexpr PlayFabJsonKey keyUserOriginationFilter("UserOriginationFilter");
+            constexpr PlayFabJsonKey keyUsername("Username");
+            constexpr PlayFabJsonKey keyUsesIncrementedBy("UsesIncrementedBy");
+            constexpr PlayFabJsonKey keyValue("Value");
+            constexpr PlayFabJsonKey keyValueToDateFilter("ValueToDateFilter");
+            constexpr PlayFabJsonKey keyValuesToDate("ValuesToDate");
+            constexpr PlayFabJsonKey keyVerificationStatus("VerificationStatus");
+            constexpr PlayFabJsonKey keyVersion("Version");
+            constexpr PlayFabJsonKey keyVersionChangeInterval("VersionChangeInterval");
+            constexpr PlayFabJsonKey keyVersions("Versions");
+            constexpr PlayFabJsonKey keyVirtualCurrencies("VirtualCurrencies");
+            constexpr PlayFabJsonKey keyVirtualCurrency("VirtualCurrency");
+            constexpr PlayFabJsonKey keyVirtualCurrencyBalanceFilter("VirtualCurrencyBalanceFilter");
+            constexpr PlayFabJsonKey keyVirtualCurrencyBalances("VirtualCurrencyBalances");
+            constexpr PlayFabJsonKey keyVirtualCurrencyContents("VirtualCurrencyContents");
+            constexpr PlayFabJsonKey keyVirtualCurrencyPrices("VirtualCurrencyPrices");
+            constexpr PlayFabJsonKey keyVirtualCurrencyRechargeTimes("VirtualCurrencyRechargeTimes");
+            constexpr PlayFabJsonKey keyWeight("Weight");
+            constexpr PlayFabJsonKey keyWindowsHelloDeviceName("WindowsHelloDeviceName");
+            constexpr PlayFabJsonKey keyWindowsHelloInfo("WindowsHelloInfo");
+            constexpr PlayFabJsonKey keyWindowsHelloPublicKeyHash("WindowsHelloPublicKeyHash");
+            constexpr PlayFabJsonKey keyXboxInfo("XboxInfo");
+            constexpr PlayFabJsonKey keyXboxUserId("XboxUserId");
+            constexpr PlayFabJsonKey keyYear("Year");
+            constexpr PlayFabJsonKey keyisBanned("isBanned");
+        }
+
+        void ToJsonEnum(const AuthTokenType input, Json::Value& output)
+        {
+            if (input == AuthTokenType::AuthTokenTypeEmail)
+            {
+                output = Json::Value(Json::StaticString("Email"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, AuthTokenType& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Email")
+            {
+                output = AuthTokenType::AuthTokenTypeEmail;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const Conditionals input, Json::Value& output)
+        {
+            if (input == Conditionals::ConditionalsAny)
+            {
+                output = Json::Value(Json::StaticString("Any"));
+                return;
+            }
+            if (input == Conditionals::ConditionalsTrue)
+            {
+                output = Json::Value(Json::StaticString("True"));
+                return;
+            }
+            if (input == Conditionals::ConditionalsFalse)
+            {
+                output = Json::Value(Json::StaticString("False"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, Conditionals& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Any")
+            {
+                output = Conditionals::ConditionalsAny;
+                return;
+            }
+            if (inputStr == "True")
+            {
+                output = Conditionals::ConditionalsTrue;
+                return;
+            }
+            if (inputStr == "False")
+            {
+                output = Conditionals::ConditionalsFalse;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const ContinentCode input, Json::Value& output)
+        {
+            if (input == ContinentCode::ContinentCodeAF)
+            {
+                output = Json::Value(Json::StaticString("AF"));
+                return;
+            }
+            if (input == ContinentCode::ContinentCodeAN)
+            {
+                output = Json::Value(Json::StaticString("AN"));
+                return;
+            }
+            if (input == ContinentCode::ContinentCodeAS)
+            {
+                output = Json::Value(Json::StaticString("AS"));
+                return;
+            }
+            if (input == ContinentCode::ContinentCodeEU)
+            {
+                output = Json::Value(Json::StaticString("EU"));
+                return;
+            }
+            if (input == ContinentCode::ContinentCodeNA)
+            {
+                output = Json::Value(Json::StaticString("NA"));
+                return;
+            }
+            if (input == ContinentCode::ContinentCodeOC)
+            {
+                output = Json::Value(Json::StaticString("OC"));
+                return;
+            }
+            if (input == ContinentCode::ContinentCodeSA)
+            {
+                output = Json::Value(Json::StaticString("SA"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, ContinentCode& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "AF")
+            {
+                output = ContinentCode::ContinentCodeAF;
+                return;
+            }
+            if (inputStr == "AN")
+            {
+                output = ContinentCode::ContinentCodeAN;
+                return;
+            }
+            if (inputStr == "AS")
+            {
+                output = ContinentCode::ContinentCodeAS;
+                return;
+            }
+            if (inputStr == "EU")
+            {
+                output = ContinentCode::ContinentCodeEU;
+                return;
+            }
+            if (inputStr == "NA")
+            {
+                output = ContinentCode::ContinentCodeNA;
+                return;
+            }
+            if (inputStr == "OC")
+            {
+                output = ContinentCode::ContinentCodeOC;
+                return;
+            }
+            if (inputStr == "SA")
+            {
+                output = ContinentCode::ContinentCodeSA;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const CountryCode input, Json::Value& output)
+        {
+            if (input == CountryCode::CountryCodeAF)
+            {
+                output = Json::Value(Json::StaticString("AF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAX)
+            {
+                output = Json::Value(Json::StaticString("AX"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAL)
+            {
+                output = Json::Value(Json::StaticString("AL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeDZ)
+            {
+                output = Json::Value(Json::StaticString("DZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAS)
+            {
+                output = Json::Value(Json::StaticString("AS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAD)
+            {
+                output = Json::Value(Json::StaticString("AD"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAO)
+            {
+                output = Json::Value(Json::StaticString("AO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAI)
+            {
+                output = Json::Value(Json::StaticString("AI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAQ)
+            {
+                output = Json::Value(Json::StaticString("AQ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAG)
+            {
+                output = Json::Value(Json::StaticString("AG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAR)
+            {
+                output = Json::Value(Json::StaticString("AR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAM)
+            {
+                output = Json::Value(Json::StaticString("AM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAW)
+            {
+                output = Json::Value(Json::StaticString("AW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAU)
+            {
+                output = Json::Value(Json::StaticString("AU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAT)
+            {
+                output = Json::Value(Json::StaticString("AT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAZ)
+            {
+                output = Json::Value(Json::StaticString("AZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBS)
+            {
+                output = Json::Value(Json::StaticString("BS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBH)
+            {
+                output = Json::Value(Json::StaticString("BH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBD)
+            {
+                output = Json::Value(Json::StaticString("BD"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBB)
+            {
+                output = Json::Value(Json::StaticString("BB"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBY)
+            {
+                output = Json::Value(Json::StaticString("BY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBE)
+            {
+                output = Json::Value(Json::StaticString("BE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBZ)
+            {
+                output = Json::Value(Json::StaticString("BZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBJ)
+            {
+                output = Json::Value(Json::StaticString("BJ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBM)
+            {
+                output = Json::Value(Json::StaticString("BM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBT)
+            {
+                output = Json::Value(Json::StaticString("BT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBO)
+            {
+                output = Json::Value(Json::StaticString("BO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBQ)
+            {
+                output = Json::Value(Json::StaticString("BQ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBA)
+            {
+                output = Json::Value(Json::StaticString("BA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBW)
+            {
+                output = Json::Value(Json::StaticString("BW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBV)
+            {
+                output = Json::Value(Json::StaticString("BV"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBR)
+            {
+                output = Json::Value(Json::StaticString("BR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIO)
+            {
+                output = Json::Value(Json::StaticString("IO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBN)
+            {
+                output = Json::Value(Json::StaticString("BN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBG)
+            {
+                output = Json::Value(Json::StaticString("BG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBF)
+            {
+                output = Json::Value(Json::StaticString("BF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBI)
+            {
+                output = Json::Value(Json::StaticString("BI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKH)
+            {
+                output = Json::Value(Json::StaticString("KH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCM)
+            {
+                output = Json::Value(Json::StaticString("CM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCA)
+            {
+                output = Json::Value(Json::StaticString("CA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCV)
+            {
+                output = Json::Value(Json::StaticString("CV"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKY)
+            {
+                output = Json::Value(Json::StaticString("KY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCF)
+            {
+                output = Json::Value(Json::StaticString("CF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTD)
+            {
+                output = Json::Value(Json::StaticString("TD"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCL)
+            {
+                output = Json::Value(Json::StaticString("CL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCN)
+            {
+                output = Json::Value(Json::StaticString("CN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCX)
+            {
+                output = Json::Value(Json::StaticString("CX"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCC)
+            {
+                output = Json::Value(Json::StaticString("CC"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCO)
+            {
+                output = Json::Value(Json::StaticString("CO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKM)
+            {
+                output = Json::Value(Json::StaticString("KM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCG)
+            {
+                output = Json::Value(Json::StaticString("CG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCD)
+            {
+                output = Json::Value(Json::StaticString("CD"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCK)
+            {
+                output = Json::Value(Json::StaticString("CK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCR)
+            {
+                output = Json::Value(Json::StaticString("CR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCI)
+            {
+                output = Json::Value(Json::StaticString("CI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeHR)
+            {
+                output = Json::Value(Json::StaticString("HR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCU)
+            {
+                output = Json::Value(Json::StaticString("CU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCW)
+            {
+                output = Json::Value(Json::StaticString("CW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCY)
+            {
+                output = Json::Value(Json::StaticString("CY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCZ)
+            {
+                output = Json::Value(Json::StaticString("CZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeDK)
+            {
+                output = Json::Value(Json::StaticString("DK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeDJ)
+            {
+                output = Json::Value(Json::StaticString("DJ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeDM)
+            {
+                output = Json::Value(Json::StaticString("DM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeDO)
+            {
+                output = Json::Value(Json::StaticString("DO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeEC)
+            {
+                output = Json::Value(Json::StaticString("EC"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeEG)
+            {
+                output = Json::Value(Json::StaticString("EG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSV)
+            {
+                output = Json::Value(Json::StaticString("SV"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGQ)
+            {
+                output = Json::Value(Json::StaticString("GQ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeER)
+            {
+                output = Json::Value(Json::StaticString("ER"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeEE)
+            {
+                output = Json::Value(Json::StaticString("EE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeET)
+            {
+                output = Json::Value(Json::StaticString("ET"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeFK)
+            {
+                output = Json::Value(Json::StaticString("FK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeFO)
+            {
+                output = Json::Value(Json::StaticString("FO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeFJ)
+            {
+                output = Json::Value(Json::StaticString("FJ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeFI)
+            {
+                output = Json::Value(Json::StaticString("FI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeFR)
+            {
+                output = Json::Value(Json::StaticString("FR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGF)
+            {
+                output = Json::Value(Json::StaticString("GF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePF)
+            {
+                output = Json::Value(Json::StaticString("PF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTF)
+            {
+                output = Json::Value(Json::StaticString("TF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGA)
+            {
+                output = Json::Value(Json::StaticString("GA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGM)
+            {
+                output = Json::Value(Json::StaticString("GM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGE)
+            {
+                output = Json::Value(Json::StaticString("GE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeDE)
+            {
+                output = Json::Value(Json::StaticString("DE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGH)
+            {
+                output = Json::Value(Json::StaticString("GH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGI)
+            {
+                output = Json::Value(Json::StaticString("GI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGR)
+            {
+                output = Json::Value(Json::StaticString("GR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGL)
+            {
+                output = Json::Value(Json::StaticString("GL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGD)
+            {
+                output = Json::Value(Json::StaticString("GD"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGP)
+            {
+                output = Json::Value(Json::StaticString("GP"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGU)
+            {
+                output = Json::Value(Json::StaticString("GU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGT)
+            {
+                output = Json::Value(Json::StaticString("GT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGG)
+            {
+                output = Json::Value(Json::StaticString("GG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGN)
+            {
+                output = Json::Value(Json::StaticString("GN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGW)
+            {
+                output = Json::Value(Json::StaticString("GW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGY)
+            {
+                output = Json::Value(Json::StaticString("GY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeHT)
+            {
+                output = Json::Value(Json::StaticString("HT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeHM)
+            {
+                output = Json::Value(Json::StaticString("HM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeVA)
+            {
+                output = Json::Value(Json::StaticString("VA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeHN)
+            {
+                output = Json::Value(Json::StaticString("HN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeHK)
+            {
+                output = Json::Value(Json::StaticString("HK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeHU)
+            {
+                output = Json::Value(Json::StaticString("HU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIS)
+            {
+                output = Json::Value(Json::StaticString("IS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIN)
+            {
+                output = Json::Value(Json::StaticString("IN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeID)
+            {
+                output = Json::Value(Json::StaticString("ID"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIR)
+            {
+                output = Json::Value(Json::StaticString("IR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIQ)
+            {
+                output = Json::Value(Json::StaticString("IQ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIE)
+            {
+                output = Json::Value(Json::StaticString("IE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIM)
+            {
+                output = Json::Value(Json::StaticString("IM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIL)
+            {
+                output = Json::Value(Json::StaticString("IL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIT)
+            {
+                output = Json::Value(Json::StaticString("IT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeJM)
+            {
+                output = Json::Value(Json::StaticString("JM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeJP)
+            {
+                output = Json::Value(Json::StaticString("JP"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeJE)
+            {
+                output = Json::Value(Json::StaticString("JE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeJO)
+            {
+                output = Json::Value(Json::StaticString("JO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKZ)
+            {
+                output = Json::Value(Json::StaticString("KZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKE)
+            {
+                output = Json::Value(Json::StaticString("KE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKI)
+            {
+                output = Json::Value(Json::StaticString("KI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKP)
+            {
+                output = Json::Value(Json::StaticString("KP"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKR)
+            {
+                output = Json::Value(Json::StaticString("KR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKW)
+            {
+                output = Json::Value(Json::StaticString("KW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKG)
+            {
+                output = Json::Value(Json::StaticString("KG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLA)
+            {
+                output = Json::Value(Json::StaticString("LA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLV)
+            {
+                output = Json::Value(Json::StaticString("LV"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLB)
+            {
+                output = Json::Value(Json::StaticString("LB"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLS)
+            {
+                output = Json::Value(Json::StaticString("LS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLR)
+            {
+                output = Json::Value(Json::StaticString("LR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLY)
+            {
+                output = Json::Value(Json::StaticString("LY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLI)
+            {
+                output = Json::Value(Json::StaticString("LI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLT)
+            {
+                output = Json::Value(Json::StaticString("LT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLU)
+            {
+                output = Json::Value(Json::StaticString("LU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMO)
+            {
+                output = Json::Value(Json::StaticString("MO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMK)
+            {
+                output = Json::Value(Json::StaticString("MK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMG)
+            {
+                output = Json::Value(Json::StaticString("MG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMW)
+            {
+                output = Json::Value(Json::StaticString("MW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMY)
+            {
+                output = Json::Value(Json::StaticString("MY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMV)
+            {
+                output = Json::Value(Json::StaticString("MV"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeML)
+            {
+                output = Json::Value(Json::StaticString("ML"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMT)
+            {
+                output = Json::Value(Json::StaticString("MT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMH)
+            {
+                output = Json::Value(Json::StaticString("MH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMQ)
+            {
+                output = Json::Value(Json::StaticString("MQ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMR)
+            {
+                output = Json::Value(Json::StaticString("MR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMU)
+            {
+                output = Json::Value(Json::StaticString("MU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeYT)
+            {
+                output = Json::Value(Json::StaticString("YT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMX)
+            {
+                output = Json::Value(Json::StaticString("MX"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeFM)
+            {
+                output = Json::Value(Json::StaticString("FM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMD)
+            {
+                output = Json::Value(Json::StaticString("MD"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMC)
+            {
+                output = Json::Value(Json::StaticString("MC"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMN)
+            {
+                output = Json::Value(Json::StaticString("MN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeME)
+            {
+                output = Json::Value(Json::StaticString("ME"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMS)
+            {
+                output = Json::Value(Json::StaticString("MS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMA)
+            {
+                output = Json::Value(Json::StaticString("MA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMZ)
+            {
+                output = Json::Value(Json::StaticString("MZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMM)
+            {
+                output = Json::Value(Json::StaticString("MM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNA)
+            {
+                output = Json::Value(Json::StaticString("NA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNR)
+            {
+                output = Json::Value(Json::StaticString("NR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNP)
+            {
+                output = Json::Value(Json::StaticString("NP"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNL)
+            {
+                output = Json::Value(Json::StaticString("NL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNC)
+            {
+                output = Json::Value(Json::StaticString("NC"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNZ)
+            {
+                output = Json::Value(Json::StaticString("NZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNI)
+            {
+                output = Json::Value(Json::StaticString("NI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNE)
+            {
+                output = Json::Value(Json::StaticString("NE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNG)
+            {
+                output = Json::Value(Json::StaticString("NG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNU)
+            {
+                output = Json::Value(Json::StaticString("NU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNF)
+            {
+                output = Json::Value(Json::StaticString("NF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMP)
+            {
+                output = Json::Value(Json::StaticString("MP"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNO)
+            {
+                output = Json::Value(Json::StaticString("NO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeOM)
+            {
+                output = Json::Value(Json::StaticString("OM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePK)
+            {
+                output = Json::Value(Json::StaticString("PK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePW)
+            {
+                output = Json::Value(Json::StaticString("PW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePS)
+            {
+                output = Json::Value(Json::StaticString("PS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePA)
+            {
+                output = Json::Value(Json::StaticString("PA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePG)
+            {
+                output = Json::Value(Json::StaticString("PG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePY)
+            {
+                output = Json::Value(Json::StaticString("PY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePE)
+            {
+                output = Json::Value(Json::StaticString("PE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePH)
+            {
+                output = Json::Value(Json::StaticString("PH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePN)
+            {
+                output = Json::Value(Json::StaticString("PN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePL)
+            {
+                output = Json::Value(Json::StaticString("PL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePT)
+            {
+                output = Json::Value(Json::StaticString("PT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePR)
+            {
+                output = Json::Value(Json::StaticString("PR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeQA)
+            {
+                output = Json::Value(Json::StaticString("QA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeRE)
+            {
+                output = Json::Value(Json::StaticString("RE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeRO)
+            {
+                output = Json::Value(Json::StaticString("RO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeRU)
+            {
+                output = Json::Value(Json::StaticString("RU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeRW)
+            {
+                output = Json::Value(Json::StaticString("RW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBL)
+            {
+                output = Json::Value(Json::StaticString("BL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSH)
+            {
+                output = Json::Value(Json::StaticString("SH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKN)
+            {
+                output = Json::Value(Json::StaticString("KN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLC)
+            {
+                output = Json::Value(Json::StaticString("LC"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMF)
+            {
+                output = Json::Value(Json::StaticString("MF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePM)
+            {
+                output = Json::Value(Json::StaticString("PM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeVC)
+            {
+                output = Json::Value(Json::StaticString("VC"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeWS)
+            {
+                output = Json::Value(Json::StaticString("WS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSM)
+            {
+                output = Json::Value(Json::StaticString("SM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeST)
+            {
+                output = Json::Value(Json::StaticString("ST"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSA)
+            {
+                output = Json::Value(Json::StaticString("SA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSN)
+            {
+                output = Json::Value(Json::StaticString("SN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeRS)
+            {
+                output = Json::Value(Json::StaticString("RS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSC)
+            {
+                output = Json::Value(Json::StaticString("SC"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSL)
+            {
+                output = Json::Value(Json::StaticString("SL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSG)
+            {
+                output = Json::Value(Json::StaticString("SG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSX)
+            {
+                output = Json::Value(Json::StaticString("SX"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSK)
+            {
+                output = Json::Value(Json::StaticString("SK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSI)
+            {
+                output = Json::Value(Json::StaticString("SI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSB)
+            {
+                output = Json::Value(Json::StaticString("SB"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSO)
+            {
+                output = Json::Value(Json::StaticString("SO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeZA)
+            {
+                output = Json::Value(Json::StaticString("ZA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGS)
+            {
+                output = Json::Value(Json::StaticString("GS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSS)
+            {
+                output = Json::Value(Json::StaticString("SS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeES)
+            {
+                output = Json::Value(Json::StaticString("ES"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLK)
+            {
+                output = Json::Value(Json::StaticString("LK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSD)
+            {
+                output = Json::Value(Json::StaticString("SD"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSR)
+            {
+                output = Json::Value(Json::StaticString("SR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSJ)
+            {
+                output = Json::Value(Json::StaticString("SJ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSZ)
+            {
+                output = Json::Value(Json::StaticString("SZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSE)
+            {
+                output = Json::Value(Json::StaticString("SE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCH)
+            {
+                output = Json::Value(Json::StaticString("CH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSY)
+            {
+                output = Json::Value(Json::StaticString("SY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTW)
+            {
+                output = Json::Value(Json::StaticString("TW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTJ)
+            {
+                output = Json::Value(Json::StaticString("TJ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTZ)
+            {
+                output = Json::Value(Json::StaticString("TZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTH)
+            {
+                output = Json::Value(Json::StaticString("TH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTL)
+            {
+                output = Json::Value(Json::StaticString("TL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTG)
+            {
+                output = Json::Value(Json::StaticString("TG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTK)
+            {
+                output = Json::Value(Json::StaticString("TK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTO)
+            {
+                output = Json::Value(Json::StaticString("TO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTT)
+            {
+                output = Json::Value(Json::StaticString("TT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTN)
+            {
+                output = Json::Value(Json::StaticString("TN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTR)
+            {
+                output = Json::Value(Json::StaticString("TR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTM)
+            {
+                output = Json::Value(Json::StaticString("TM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTC)
+            {
+                output = Json::Value(Json::StaticString("TC"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTV)
+            {
+                output = Json::Value(Json::StaticString("TV"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeUG)
+            {
+                output = Json::Value(Json::StaticString("UG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeUA)
+            {
+                output = Json::Value(Json::StaticString("UA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAE)
+            {
+                output = Json::Value(Json::StaticString("AE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGB)
+            {
+                output = Json::Value(Json::StaticString("GB"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeUS)
+            {
+                output = Json::Value(Json::StaticString("US"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeUM)
+            {
+                output = Json::Value(Json::StaticString("UM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeUY)
+            {
+                output = Json::Value(Json::StaticString("UY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeUZ)
+            {
+                output = Json::Value(Json::StaticString("UZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeVU)
+            {
+                output = Json::Value(Json::StaticString("VU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeVE)
+            {
+                output = Json::Value(Json::StaticString("VE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeVN)
+            {
+                output = Json::Value(Json::StaticString("VN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeVG)
+            {
+                output = Json::Value(Json::StaticString("VG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeVI)
+            {
+                output = Json::Value(Json::StaticString("VI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeWF)
+            {
+                output = Json::Value(Json::StaticString("WF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeEH)
+            {
+                output = Json::Value(Json::StaticString("EH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeYE)
+            {
+                output = Json::Value(Json::StaticString("YE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeZM)
+            {
+                output = Json::Value(Json::StaticString("ZM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeZW)
+            {
+                output = Json::Value(Json::StaticString("ZW"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, CountryCode& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "AF")
+            {
+                output = CountryCode::CountryCodeAF;
+                return;
+            }
+            if (inputStr == "AX")
+            {
+                output = CountryCode::CountryCodeAX;
+                return;
+            }
+            if (inputStr == "AL")
+            {
+                output = CountryCode::CountryCodeAL;
+                return;
+            }
+            if (inputStr == "DZ")
+            {
+                output = CountryCode::CountryCodeDZ;
+                return;
+            }
+            if (inputStr == "AS")
+            {
+                output = CountryCode::CountryCodeAS;
+                return;
+            }
+            if (inputStr == "AD")
+            {
+                output = CountryCode::CountryCodeAD;
+                return;
+            }
+            if (inputStr == "AO")
+            {
+                output = CountryCode::CountryCodeAO;
+                return;
+            }
+            if (inputStr == "AI")
+            {
+                output = CountryCode::CountryCodeAI;
+                return;
+            }
+            if (inputStr == "AQ")
+            {
+                output = CountryCode::CountryCodeAQ;
+                return;
+            }
+            if (inputStr == "AG")
+            {
+                output = CountryCode::CountryCodeAG;
+                return;
+            }
+            if (inputStr == "AR")
+            {
+                output = CountryCode::CountryCodeAR;
+                return;
+            }
+            if (inputStr == "AM")
+            {
+                output = CountryCode::CountryCodeAM;
+                return;
+            }
+            if (inputStr == "AW")
+            {
+                output = CountryCode::CountryCodeAW;
+                return;
+            }
+            if (inputStr == "AU")
+            {
+                output = CountryCode::CountryCodeAU;
+                return;
+            }
+            if (inputStr == "AT")
+            {
+                output = CountryCode::CountryCodeAT;
+                return;
+            }
+            if (inputStr == "AZ")
+            {
+                output = CountryCode::CountryCodeAZ;
+                return;
+            }
+            if (inputStr == "BS")
+            {
+                output = CountryCode::CountryCodeBS;
+                return;
+            }
+            if (inputStr == "BH")
+            {
+                output = CountryCode::CountryCodeBH;
+                return;
+            }
+            if (inputStr == "BD")
+            {
+                output = CountryCode::CountryCodeBD;
+                return;
+            }
+            if (inputStr == "BB")
+            {
+                output = CountryCode::CountryCodeBB;
+                return;
+            }
+            if (inputStr == "BY")
+            {
+                output = CountryCode::CountryCodeBY;
+                return;
+            }
+            if (inputStr == "BE")
+            {
+                output = CountryCode::CountryCodeBE;
+                return;
+            }
+            if (inputStr == "BZ")
+            {
+                output = CountryCode::CountryCodeBZ;
+                return;
+            }
+            if (inputStr == "BJ")
+            {
+                output = CountryCode::CountryCodeBJ;
+                return;
+            }
+            if (inputStr == "BM")
+            {
+                output = CountryCode::CountryCodeBM;
+                return;
+            }
+            if (inputStr == "BT")
+            {
+                output = CountryCode::CountryCodeBT;
+                return;
+            }
+            if (inputStr == "BO")
+            {
+                output = CountryCode::CountryCodeBO;
+                return;
+            }
+            if (inputStr == "BQ")
+            {
+                output = CountryCode::CountryCodeBQ;
+                return;
+            }
+            if (inputStr == "BA")
+            {
+                output = CountryCode::CountryCodeBA;
+                return;
+            }
+            if (inputStr == "BW")
+            {
+                output = CountryCode::CountryCodeBW;
+                return;
+            }
+            if (inputStr == "BV")
+            {
+                output = CountryCode::CountryCodeBV;
+                return;
+            }
+            if (inputStr == "BR")
+            {
+                output = CountryCode::CountryCodeBR;
+                return;
+            }
+            if (inputStr == "IO")
+            {
+                output = CountryCode::CountryCodeIO;
+                return;
+            }
+            if (inputStr == "BN")
+            {
+                output = CountryCode::CountryCodeBN;
+                return;
+            }
+            if (inputStr == "BG")
+            {
+                output = CountryCode::CountryCodeBG;
+                return;
+            }
+            if (inputStr == "BF")
+            {
+                output = CountryCode::CountryCodeBF;
+                return;
+            }
+            if (inputStr == "BI")
+            {
+                output = CountryCode::CountryCodeBI;
+                return;
+            }
+            if (inputStr == "KH")
+            {
+                output = CountryCode::CountryCodeKH;
+                return;
+            }
+            if (inputStr == "CM")
+            {
+                output = CountryCode::CountryCodeCM;
+                return;
+            }
+            if (inputStr == "CA")
+            {
+                output = CountryCode::CountryCodeCA;
+                return;
+            }
+            if (inputStr == "CV")
+            {
+                output = CountryCode::CountryCodeCV;
+                return;
+            }
+            if (inputStr == "KY")
+            {
+                output = CountryCode::CountryCodeKY;
+                return;
+            }
+            if (inputStr == "CF")
+            {
+                output = CountryCode::CountryCodeCF;
+                return;
+            }
+            if (inputStr == "TD")
+            {
+                output = CountryCode::CountryCodeTD;
+                return;
+            }
+            if (inputStr == "CL")
+            {
+                output = CountryCode::CountryCodeCL;
+                return;
+            }
+            if (inputStr == "CN")
+            {
+                output = CountryCode::CountryCodeCN;
+                return;
+            }
+            if (inputStr == "CX")
+            {
+                output = CountryCode::CountryCodeCX;
+                return;
+            }
+            if (inputStr == "CC")
+            {
+                output = CountryCode::CountryCodeCC;
+                return;
+            }
+            if (inputStr == "CO")
+            {
+                output = CountryCode::CountryCodeCO;
+                return;
+            }
+            if (inputStr == "KM")
+            {
+                output = CountryCode::CountryCodeKM;
+                return;
+            }
+            if (inputStr == "CG")
+            {
+                output = CountryCode::CountryCodeCG;
+                return;
+            }
+            if (inputStr == "CD")
+            {
+                output = CountryCode::CountryCodeCD;
+                return;
+            }
+            if (inputStr == "CK")
+            {
+                output = CountryCode::CountryCodeCK;
+                return;
+            }
+            if (inputStr == "CR")
+            {
+                output = CountryCode::CountryCodeCR;
+                return;
+            }
+            if (inputStr == "CI")
+            {
+                output = CountryCode::CountryCodeCI;
+                return;
+            }
+            if (inputStr == "HR")
+            {
+                output = CountryCode::CountryCodeHR;
+                return;
+            }
+            if (inputStr == "CU")
+            {
+                output = CountryCode::CountryCodeCU;
+                return;
+            }
+            if (inputStr == "CW")
+            {
+                output = CountryCode::CountryCodeCW;
+                return;
+            }
+            if (inputStr == "CY")
+            {
+                output = CountryCode::CountryCodeCY;
+                return;
+            }
+            if (inputStr == "CZ")
+            {
+                output = CountryCode::CountryCodeCZ;
+                return;
+            }
+            if (inputStr == "DK")
+            {
+                output = CountryCode::CountryCodeDK;
+                return;
+            }
+            if (inputStr == "DJ")
+            {
+                output = CountryCode::CountryCodeDJ;
+                return;
+            }
+            if (inputStr == "DM")
+            {
+                output = CountryCode::CountryCodeDM;
+                return;
+            }
+            if (inputStr == "DO")
+            {
+                output = CountryCode::CountryCodeDO;
+                return;
+            }
+            if (inputStr == "EC")
+            {
+                output = CountryCode::CountryCodeEC;
+                return;
+            }
+            if (inputStr == "EG")
+            {
+                output = CountryCode::CountryCodeEG;
+                return;
+            }
+            if (inputStr == "SV")
+            {
+                output = CountryCode::CountryCodeSV;
+                return;
+            }
+            if (inputStr == "GQ")
+            {
+                output = CountryCode::CountryCodeGQ;
+                return;
+            }
+            if (inputStr == "ER")
+            {
+                output = CountryCode::CountryCodeER;
+                return;
+            }
+            if (inputStr == "EE")
+            {
+                output = CountryCode::CountryCodeEE;
+                return;
+            }
+            if (inputStr == "ET")
+            {
+                output = CountryCode::CountryCodeET;
+                return;
+            }
+            if (inputStr == "FK")
+            {
+                output = CountryCode::CountryCodeFK;
+                return;
+            }
+            if (inputStr == "FO")
+            {
+                output = CountryCode::CountryCodeFO;
+                return;
+            }
+            if (inputStr == "FJ")
+            {
+                output = CountryCode::CountryCodeFJ;
+                return;
+            }
+            if (inputStr == "FI")
+            {
+                output = CountryCode::CountryCodeFI;
+                return;
+            }
+            if (inputStr == "FR")
+            {
+                output = CountryCode::CountryCodeFR;
+                return;
+            }
+            if (inputStr == "GF")
+            {
+                output = CountryCode::CountryCodeGF;
+                return;
+            }
+            if (inputStr == "PF")
+            {
+                output = CountryCode::CountryCodePF;
+                return;
+            }
+            if (inputStr == "TF")
+            {
+                output = CountryCode::CountryCodeTF;
+                return;
+            }
+            if (inputStr == "GA")
+            {
+                output = CountryCode::CountryCodeGA;
+                return;
+            }
+            if (inputStr == "GM")
+            {
+                output = CountryCode::CountryCodeGM;
+                return;
+            }
+            if (inputStr == "GE")
+            {
+                output = CountryCode::CountryCodeGE;
+                return;
+            }
+            if (inputStr == "DE")
+            {
+                output = CountryCode::CountryCodeDE;
+                return;
+            }
+            if (inputStr == "GH")
+            {
+                output = CountryCode::CountryCodeGH;
+                return;
+            }
+            if (inputStr == "GI")
+            {
+                output = CountryCode::CountryCodeGI;
+                return;
+            }
+            if (inputStr == "GR")
+            {
+                output = CountryCode::CountryCodeGR;
+                return;
+            }
+            if (inputStr == "GL")
+            {
+                output = CountryCode::CountryCodeGL;
+                return;
+            }
+            if (inputStr == "GD")
+            {
+                output = CountryCode::CountryCodeGD;
+                return;
+            }
+            if (inputStr == "GP")
+            {
+                output = CountryCode::CountryCodeGP;
+                return;
+            }
+            if (inputStr == "GU")
+            {
+                output = CountryCode::CountryCodeGU;
+                return;
+            }
+            if (inputStr == "GT")
+            {
+                output = CountryCode::CountryCodeGT;
+                return;
+            }
+            if (inputStr == "GG")
+            {
+                output = CountryCode::CountryCodeGG;
+                return;
+            }
+            if (inputStr == "GN")
+            {
+                output = CountryCode::CountryCodeGN;
+                return;
+            }
+            if (inputStr == "GW")
+            {
+                output = CountryCode::CountryCodeGW;
+                return;
+            }
+            if (inputStr == "GY")
+            {
+                output = CountryCode::CountryCodeGY;
+                return;
+            }
+            if (inputStr == "HT")
+            {
+                output = CountryCode::CountryCodeHT;
+                return;
+            }
+            if (inputStr == "HM")
+            {
+                output = CountryCode::CountryCodeHM;
+                return;
+            }
+            if (inputStr == "VA")
+            {
+                output = CountryCode::CountryCodeVA;
+                return;
+            }
+            if (inputStr == "HN")
+            {
+                output = CountryCode::CountryCodeHN;
+                return;
+            }
+            if (inputStr == "HK")
+            {
+                output = CountryCode::CountryCodeHK;
+                return;
+            }
+            if (inputStr == "HU")
+            {
+                output = CountryCode::CountryCodeHU;
+                return;
+            }
+            if (inputStr == "IS")
+            {
+                output = CountryCode::CountryCodeIS;
+                return;
+            }
+            if (inputStr == "IN")
+            {
+                output = CountryCode::CountryCodeIN;
+                return;
+            }
+            if (inputStr == "ID")
+            {
+                output = CountryCode::CountryCodeID;
+                return;
+            }
+            if (inputStr == "IR")
+            {
+                output = CountryCode::CountryCodeIR;
+                return;
+            }
+            if (inputStr == "IQ")
+            {
+                output = CountryCode::CountryCodeIQ;
+                return;
+            }
+            if (inputStr == "IE")
+            {
+                output = CountryCode::CountryCodeIE;
+                return;
+            }
+            if (inputStr == "IM")
+            {
+                output = CountryCode::CountryCodeIM;
+                return;
+            }
+            if (inputStr == "IL")
+            {
+                output = CountryCode::CountryCodeIL;
+                return;
+            }
+            if (inputStr == "IT")
+            {
+                output = CountryCode::CountryCodeIT;
+                return;
+            }
+            if (inputStr == "JM")
+            {
+                output = CountryCode::CountryCodeJM;
+                return;
+            }
+            if (inputStr == "JP")
+            {
+                output = CountryCode::CountryCodeJP;
+                return;
+            }
+            if (inputStr == "JE")
+            {
+                output = CountryCode::CountryCodeJE;
+                return;
+            }
+            if (inputStr == "JO")
+            {
+                output = CountryCode::CountryCodeJO;
+                return;
+            }
+            if (inputStr == "KZ")
+            {
+                output = CountryCode::CountryCodeKZ;
+                return;
+            }
+            if (inputStr == "KE")
+            {
+                output = CountryCode::CountryCodeKE;
+                return;
+            }
+            if (inputStr == "KI")
+            {
+                output = CountryCode::CountryCodeKI;
+                return;
+            }
+            if (inputStr == "KP")
+            {
+                output = CountryCode::CountryCodeKP;
+                return;
+            }
+            if (inputStr == "KR")
+            {
+                output = CountryCode::CountryCodeKR;
+                return;
+            }
+            if (inputStr == "KW")
+            {
+                output = CountryCode::CountryCodeKW;
+                return;
+            }
+            if (inputStr == "KG")
+            {
+                output = CountryCode::CountryCodeKG;
+                return;
+            }
+            if (inputStr == "LA")
+            {
+                output = CountryCode::CountryCodeLA;
+                return;
+            }
+            if (inputStr == "LV")
+            {
+                output = CountryCode::CountryCodeLV;
+                return;
+            }
+            if (inputStr == "LB")
+            {
+                output = CountryCode::CountryCodeLB;
+                return;
+            }
+            if (inputStr == "LS")
+            {
+                output = CountryCode::CountryCodeLS;
+                return;
+            }
+            if (inputStr == "LR")
+            {
+                output = CountryCode::CountryCodeLR;
+                return;
+            }
+            if (inputStr == "LY")
+            {
+                output = CountryCode::CountryCodeLY;
+                return;
+            }
+            if (inputStr == "LI")
+            {
+                output = CountryCode::CountryCodeLI;
+                return;
+            }
+            if (inputStr == "LT")
+            {
+                output = CountryCode::CountryCodeLT;
+                return;
+            }
+            if (inputStr == "LU")
+            {
+                output = CountryCode::CountryCodeLU;
+                return;
+            }
+            if (inputStr == "MO")
+            {
+                output = CountryCode::CountryCodeMO;
+                return;
+            }
+            if (inputStr == "MK")
+            {
+                output = CountryCode::CountryCodeMK;
+                return;
+            }
+            if (inputStr == "MG")
+            {
+                output = CountryCode::CountryCodeMG;
+                return;
+            }
+            if (inputStr == "MW")
+            {
+                output = CountryCode::CountryCodeMW;
+                return;
+            }
+            if (inputStr == "MY")
+            {
+                output = CountryCode::CountryCodeMY;
+                return;
+            }
+            if (inputStr == "MV")
+            {
+                output = CountryCode::CountryCodeMV;
+                return;
+            }
+            if (inputStr == "ML")
+            {
+                output = CountryCode::CountryCodeML;
+                return;
+            }
+            if (inputStr == "MT")
+            {
+                output = CountryCode::CountryCodeMT;
+                return;
+            }
+            if (inputStr == "MH")
+            {
+                output = CountryCode::CountryCodeMH;
+                return;
+            }
+            if (inputStr == "MQ")
+            {
+                output = CountryCode::CountryCodeMQ;
+                return;
+            }
+            if (inputStr == "MR")
+            {
+                output = CountryCode::CountryCodeMR;
+                return;
+            }
+            if (inputStr == "MU")
+            {
+                output = CountryCode::CountryCodeMU;
+                return;
+            }
+            if (inputStr == "YT")
+            {
+                output = CountryCode::CountryCodeYT;
+                return;
+            }
+            if (inputStr == "MX")
+            {
+                output = CountryCode::CountryCodeMX;
+                return;
+            }
+            if (inputStr == "FM")
+            {
+                output = CountryCode::CountryCodeFM;
+                return;
+            }
+            if (inputStr == "MD")
+            {
+                output = CountryCode::CountryCodeMD;
+                return;
+            }
+            if (inputStr == "MC")
+            {
+                output = CountryCode::CountryCodeMC;
+                return;
+            }
+            if (inputStr == "MN")
+            {
+                output = CountryCode::CountryCodeMN;
+                return;
+            }
+            if (inputStr == "ME")
+            {
+                output = CountryCode::CountryCodeME;
+                return;
+            }
+            if (inputStr == "MS")
+            {
+                output = CountryCode::CountryCodeMS;
+                return;
+            }
+            if (inputStr == "MA")
+            {
+                output = CountryCode::CountryCodeMA;
+                return;
+            }
+            if (inputStr == "MZ")
+            {
+                output = CountryCode::CountryCodeMZ;
+                return;
+            }
+            if (inputStr == "MM")
+            {
+                output = CountryCode::CountryCodeMM;
+                return;
+            }
+            if (inputStr == "NA")
+            {
+                output = CountryCode::CountryCodeNA;
+                return;
+            }
+            if (inputStr == "NR")
+            {
+                output = CountryCode::CountryCodeNR;
+                return;
+            }
+            if (inputStr == "NP")
+            {
+                output = CountryCode::CountryCodeNP;
+                return;
+            }
+            if (inputStr == "NL")
+            {
+                output = CountryCode::CountryCodeNL;
+                return;
+            }
+            if (inputStr == "NC")
+            {
+                output = CountryCode::CountryCodeNC;
+                return;
+            }
+            if (inputStr == "NZ")
+            {
+                output = CountryCode::CountryCodeNZ;
+                return;
+            }
+            if (inputStr == "NI")
+            {
+                output = CountryCode::CountryCodeNI;
+                return;
+            }
+            if (inputStr == "NE")
+            {
+                output = CountryCode::CountryCodeNE;
+                return;
+            }
+            if (inputStr == "NG")
+            {
+                output = CountryCode::CountryCodeNG;
+                return;
+            }
+            if (inputStr == "NU")
+            {
+                output = CountryCode::CountryCodeNU;
+                return;
+            }
+            if (inputStr == "NF")
+            {
+                output = CountryCode::CountryCodeNF;
+                return;
+            }
+            if (inputStr == "MP")
+            {
+                output = CountryCode::CountryCodeMP;
+                return;
+            }
+            if (inputStr == "NO")
+            {
+                output = CountryCode::CountryCodeNO;
+                return;
+            }
+            if (inputStr == "OM")
+            {
+                output = CountryCode::CountryCodeOM;
+                return;
+            }
+            if (inputStr == "PK")
+            {
+                output = CountryCode::CountryCodePK;
+                return;
+            }
+            if (inputStr == "PW")
+            {
+                output = CountryCode::CountryCodePW;
+                return;
+            }
+            if (inputStr == "PS")
+            {
+                output = CountryCode::CountryCodePS;
+                return;
+            }
+            if (inputStr == "PA")
+            {
+                output = CountryCode::CountryCodePA;
+                return;
+            }
+            if (inputStr == "PG")
+            {
+                output = CountryCode::CountryCodePG;
+                return;
+            }
+            if (inputStr == "PY")
+            {
+                output = CountryCode::CountryCodePY;
+                return;
+            }
+            if (inputStr == "PE")
+            {
+                output = CountryCode::CountryCodePE;
+                return;
+            }
+            if (inputStr == "PH")
+            {
+                output = CountryCode::CountryCodePH;
+                return;
+            }
+            if (inputStr == "PN")
+            {
+                output = CountryCode::CountryCodePN;
+                return;
+            }
+            if (inputStr == "PL")
+            {
+                output = CountryCode::CountryCodePL;
+                return;
+            }
+            if (inputStr == "PT")
+            {
+                output = CountryCode::CountryCodePT;
+                return;
+            }
+            if (inputStr == "PR")
+            {
+                output = CountryCode::CountryCodePR;
+                return;
+            }
+            if (inputStr == "QA")
+            {
+                output = CountryCode::CountryCodeQA;
+                return;
+            }
+            if (inputStr == "RE")
+            {
+                output = CountryCode::CountryCodeRE;
+                return;
+            }
+            if (inputStr == "RO")
+            {
+                output = CountryCode::CountryCodeRO;
+                return;
+            }
+            if (inputStr == "RU")
+            {
+                output = CountryCode::CountryCodeRU;
+                return;
+            }
+            if (inputStr == "RW")
+            {
+                output = CountryCode::CountryCodeRW;
+                return;
+            }
+            if (inputStr == "BL")
+            {
+                output = CountryCode::CountryCodeBL;
+                return;
+            }
+            if (inputStr == "SH")
+            {
+                output = CountryCode::CountryCodeSH;
+                return;
+            }
+            if (inputStr == "KN")
+            {
+                output = CountryCode::CountryCodeKN;
+                return;
+            }
+            if (inputStr == "LC")
+            {
+                output = CountryCode::CountryCodeLC;
+                return;
+            }
+            if (inputStr == "MF")
+            {
+                output = CountryCode::CountryCodeMF;
+                return;
+            }
+            if (inputStr == "PM")
+            {
+                output = CountryCode::CountryCodePM;
+                return;
+            }
+            if (inputStr == "VC")
+            {
+                output = CountryCode::CountryCodeVC;
+                return;
+            }
+            if (inputStr == "WS")
+            {
+                output = CountryCode::CountryCodeWS;
+                return;
+            }
+            if (inputStr == "SM")
+            {
+                output = CountryCode::CountryCodeSM;
+                return;
+            }
+            if (inputStr == "ST")
+            {
+                output = CountryCode::CountryCodeST;
+                return;
+            }
+            if (inputStr == "SA")
+            {
+                output = CountryCode::CountryCodeSA;
+                return;
+            }
+            if (inputStr == "SN")
+            {
+                output = CountryCode::CountryCodeSN;
+                return;
+            }
+            if (inputStr == "RS")
+            {
+                output = CountryCode::CountryCodeRS;
+                return;
+            }
+            if (inputStr == "SC")
+            {
+                output = CountryCode::CountryCodeSC;
+                return;
+            }
+            if (inputStr == "SL")
+            {
+                output = CountryCode::CountryCodeSL;
+                return;
+            }
+            if (inputStr == "SG")
+            {
+                output = CountryCode::CountryCodeSG;
+                return;
+            }
+            if (inputStr == "SX")
+            {
+                output = CountryCode::CountryCodeSX;
+                return;
+            }
+            if (inputStr == "SK")
+            {
+                output = CountryCode::CountryCodeSK;
+                return;
+            }
+            if (inputStr == "SI")
+            {
+                output = CountryCode::CountryCodeSI;
+                return;
+            }
+            if (inputStr == "SB")
+            {
+                output = CountryCode::CountryCodeSB;
+                return;
+            }
+            if (inputStr == "SO")
+            {
+                output = CountryCode::CountryCodeSO;
+                return;
+            }
+            if (inputStr == "ZA")
+            {
+                output = CountryCode::CountryCodeZA;
+                return;
+            }
+            if (inputStr == "GS")
+            {
+                output = CountryCode::CountryCodeGS;
+                return;
+            }
+            if (inputStr == "SS")
+            {
+                output = CountryCode::CountryCodeSS;
+                return;
+            }
+            if (inputStr == "ES")
+            {
+                output = CountryCode::CountryCodeES;
+                return;
+            }
+            if (inputStr == "LK")
+            {
+                output = CountryCode::CountryCodeLK;
+                return;
+            }
+            if (inputStr == "SD")
+            {
+                output = CountryCode::CountryCodeSD;
+                return;
+            }
+            if (inputStr == "SR")
+            {
+                output = CountryCode::CountryCodeSR;
+                return;
+            }
+            if (inputStr == "SJ")
+            {
+                output = CountryCode::CountryCodeSJ;
+                return;
+            }
+            if (inputStr == "SZ")
+            {
+                output = CountryCode::CountryCodeSZ;
+                return;
+            }
+            if (inputStr == "SE")
+            {
+                output = CountryCode::CountryCodeSE;
+                return;
+            }
+            if (inputStr == "CH")
+            {
+                output = CountryCode::CountryCodeCH;
+                return;
+            }
+            if (inputStr == "SY")
+            {
+                output = CountryCode::CountryCodeSY;
+                return;
+            }
+            if (inputStr == "TW")
+            {
+                output = CountryCode::CountryCodeTW;
+                return;
+            }
+            if (inputStr == "TJ")
+            {
+                output = CountryCode::CountryCodeTJ;
+                return;
+            }
+            if (inputStr == "TZ")
+            {
+                output = CountryCode::CountryCodeTZ;
+                return;
+            }
+            if (inputStr == "TH")
+            {
+                output = CountryCode::CountryCodeTH;
+                return;
+            }
+            if (inputStr == "TL")
+            {
+                output = CountryCode::CountryCodeTL;
+                return;
+            }
+            if (inputStr == "TG")
+            {
+                output = CountryCode::CountryCodeTG;
+                return;
+            }
+            if (inputStr == "TK")
+            {
+                output = CountryCode::CountryCodeTK;
+                return;
+            }
+            if (inputStr == "TO")
+            {
+                output = CountryCode::CountryCodeTO;
+                return;
+            }
+            if (inputStr == "TT")
+            {
+                output = CountryCode::CountryCodeTT;
+                return;
+            }
+            if (inputStr == "TN")
+            {
+                output = CountryCode::CountryCodeTN;
+                return;
+            }
+            if (inputStr == "TR")
+            {
+                output = CountryCode::CountryCodeTR;
+                return;
+            }
+            if (inputStr == "TM")
+            {
+                output = CountryCode::CountryCodeTM;
+                return;
+            }
+            if (inputStr == "TC")
+            {
+                output = CountryCode::CountryCodeTC;
+                return;
+            }
+            if (inputStr == "TV")
+            {
+                output = CountryCode::CountryCodeTV;
+                return;
+            }
+            if (inputStr == "UG")
+            {
+                output = CountryCode::CountryCodeUG;
+                return;
+            }
+            if (inputStr == "UA")
+            {
+                output = CountryCode::CountryCodeUA;
+                return;
+            }
+            if (inputStr == "AE")
+            {
+                output = CountryCode::CountryCodeAE;
+                return;
+            }
+            if (inputStr == "GB")
+            {
+                output = CountryCode::CountryCodeGB;
+                return;
+            }
+            if (inputStr == "US")
+            {
+                output = CountryCode::CountryCodeUS;
+                return;
+            }
+            if (inputStr == "UM")
+            {
+                output = CountryCode::CountryCodeUM;
+                return;
+            }
+            if (inputStr == "UY")
+            {
+                output = CountryCode::CountryCodeUY;
+                return;
+            }
+            if (inputStr == "UZ")
+            {
+                output = CountryCode::CountryCodeUZ;
+                return;
+            }
+            if (inputStr == "VU")
+            {
+                output = CountryCode::CountryCodeVU;
+                return;
+            }
+            if (inputStr == "VE")
+            {
+                output = CountryCode::CountryCodeVE;
+                return;
+            }
+            if (inputStr == "VN")
+            {
+                output = CountryCode::CountryCodeVN;
+                return;
+            }
+            if (inputStr == "VG")
+            {
+                output = CountryCode::CountryCodeVG;
+                return;
+            }
+            if (inputStr == "VI")
+            {
+                output = CountryCode::CountryCodeVI;
+                return;
+            }
+            if (inputStr == "WF")
+            {
+                output = CountryCode::CountryCodeWF;
+                return;
+            }
+            if (inputStr == "EH")
+            {
+                output = CountryCode::CountryCodeEH;
+                return;
+            }
+            if (inputStr == "YE")
+            {
+                output = CountryCode::CountryCodeYE;
+                return;
+            }
+            if (inputStr == "ZM")
+            {
+                output = CountryCode::CountryCodeZM;
+                return;
+            }
+            if (inputStr == "ZW")
+            {
+                output = CountryCode::CountryCodeZW;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const Currency input, Json::Value& output)
+        {
+            if (input == Currency::CurrencyAED)
+            {
+                output = Json::Value(Json::StaticString("AED"));
+                return;
+            }
+            if (input == Currency::CurrencyAFN)
+            {
+                output = Json::Value(Json::StaticString("AFN"));
+                return;
+            }
+            if (input == Currency::CurrencyALL)
+            {
+                output = Json::Value(Json::StaticString("ALL"));
+                return;
+            }
+            if (input == Currency::CurrencyAMD)
+            {
+                output = Json::Value(Json::StaticString("AMD"));
+                return;
+            }
+            if (input == Currency::CurrencyANG)
+            {
+                output = Json::Value(Json::StaticString("ANG"));
+                return;
+            }
+            if (input == Currency::CurrencyAOA)
+            {
+                output = Json::Value(Json::StaticString("AOA"));
+                return;
+            }
+            if (input == Currency::CurrencyARS)
+            {
+                output = Json::Value(Json::StaticString("ARS"));
+                return;
+            }
+            if (input == Currency::CurrencyAUD)
+            {
+                output = Json::Value(Json::StaticString("AUD"));
+                return;
+            }
+            if (input == Currency::CurrencyAWG)
+            {
+                output = Json::Value(Json::StaticString("AWG"));
+                return;
+            }
+            if (input == Currency::CurrencyAZN)
+            {
+                output = Json::Value(Json::StaticString("AZN"));
+                return;
+            }
+            if (input == Currency::CurrencyBAM)
+            {
+                output = Json::Value(Json::StaticString("BAM"));
+                return;
+            }
+            if (input == Currency::CurrencyBBD)
+            {
+                output = Json::Value(Json::StaticString("BBD"));
+                return;
+            }
+            if (input == Currency::CurrencyBDT)
+            {
+                output = Json::Value(Json::StaticString("BDT"));
+                return;
+            }
+            if (input == Currency::CurrencyBGN)
+            {
+                output = Json::Value(Json::StaticString("BGN"));
+                return;
+            }
+            if (input == Currency::CurrencyBHD)
+            {
+                output = Json::Value(Json::StaticString("BHD"));
+                return;
+            }
+            if (input == Currency::CurrencyBIF)
+            {
+                output = Json::Value(Json::StaticString("BIF"));
+                return;
+            }
+            if (input == Currency::CurrencyBMD)
+            {
+                output = Json::Value(Json::StaticString("BMD"));
+                return;
+            }
+            if (input == Currency::CurrencyBND)
+            {
+                output = Json::Value(Json::StaticString("BND"));
+                return;
+            }
+            if (input == Currency::CurrencyBOB)
+            {
+                output = Json::Value(Json::StaticString("BOB"));
+                return;
+            }
+            if (input == Currency::CurrencyBRL)
+            {
+                output = Json::Value(Json::StaticString("BRL"));
+                return;
+            }
+            if (input == Currency::CurrencyBSD)
+            {
+                output = Json::Value(Json::StaticString("BSD"));
+                return;
+            }
+            if (input == Currency::CurrencyBTN)
+            {
+                output = Json::Value(Json::StaticString("BTN"));
+                return;
+            }
+            if (input == Currency::CurrencyBWP)
+            {
+                output = Json::Value(Json::StaticString("BWP"));
+                return;
+            }
+            if (input == Currency::CurrencyBYR)
+            {
+                output = Json::Value(Json::StaticString("BYR"));
+                return;
+            }
+            if (input == Currency::CurrencyBZD)
+            {
+                output = Json::Value(Json::StaticString("BZD"));
+                return;
+            }
+            if (input == Currency::CurrencyCAD)
+            {
+                output = Json::Value(Json::StaticString("CAD"));
+                return;
+            }
+            if (input == Currency::CurrencyCDF)
+            {
+                output = Json::Value(Json::StaticString("CDF"));
+                return;
+            }
+            if (input == Currency::CurrencyCHF)
+            {
+                output = Json::Value(Json::StaticString("CHF"));
+                return;
+            }
+            if (input == Currency::CurrencyCLP)
+            {
+                output = Json::Value(Json::StaticString("CLP"));
+                return;
+            }
+            if (input == Currency::CurrencyCNY)
+            {
+                output = Json::Value(Json::StaticString("CNY"));
+                return;
+            }
+            if (input == Currency::CurrencyCOP)
+            {
+                output = Json::Value(Json::StaticString("COP"));
+                return;
+            }
+            if (input == Currency::CurrencyCRC)
+            {
+                output = Json::Value(Json::StaticString("CRC"));
+                return;
+            }
+            if (input == Currency::CurrencyCUC)
+            {
+                output = Json::Value(Json::StaticString("CUC"));
+                return;
+            }
+            if (input == Currency::CurrencyCUP)
+            {
+                output = Json::Value(Json::StaticString("CUP"));
+                return;
+            }
+            if (input == Currency::CurrencyCVE)
+            {
+                output = Json::Value(Json::StaticString("CVE"));
+                return;
+            }
+            if (input == Currency::CurrencyCZK)
+            {
+                output = Json::Value(Json::StaticString("CZK"));
+                return;
+            }
+            if (input == Currency::CurrencyDJF)
+            {
+                output = Json::Value(Json::StaticString("DJF"));
+                return;
+            }
+            if (input == Currency::CurrencyDKK)
+            {
+                output = Json::Value(Json::StaticString("DKK"));
+                return;
+            }
+            if (input == Currency::CurrencyDOP)
+            {
+                output = Json::Value(Json::StaticString("DOP"));
+                return;
+            }
+            if (input == Currency::CurrencyDZD)
+            {
+                output = Json::Value(Json::StaticString("DZD"));
+                return;
+            }
+            if (input == Currency::CurrencyEGP)
+            {
+                output = Json::Value(Json::StaticString("EGP"));
+                return;
+            }
+            if (input == Currency::CurrencyERN)
+            {
+                output = Json::Value(Json::StaticString("ERN"));
+                return;
+            }
+            if (input == Currency::CurrencyETB)
+            {
+                output = Json::Value(Json::StaticString("ETB"));
+                return;
+            }
+            if (input == Currency::CurrencyEUR)
+            {
+                output = Json::Value(Json::StaticString("EUR"));
+                return;
+            }
+            if (input == Currency::CurrencyFJD)
+            {
+                output = Json::Value(Json::StaticString("FJD"));
+                return;
+            }
+            if (input == Currency::CurrencyFKP)
+            {
+                output = Json::Value(Json::StaticString("FKP"));
+                return;
+            }
+            if (input == Currency::CurrencyGBP)
+            {
+                output = Json::Value(Json::StaticString("GBP"));
+                return;
+            }
+            if (input == Currency::CurrencyGEL)
+            {
+                output = Json::Value(Json::StaticString("GEL"));
+                return;
+            }
+            if (input == Currency::CurrencyGGP)
+            {
+                output = Json::Value(Json::StaticString("GGP"));
+                return;
+            }
+            if (input == Currency::CurrencyGHS)
+            {
+                output = Json::Value(Json::StaticString("GHS"));
+                return;
+            }
+            if (input == Currency::CurrencyGIP)
+            {
+                output = Json::Value(Json::StaticString("GIP"));
+                return;
+            }
+            if (input == Currency::CurrencyGMD)
+            {
+                output = Json::Value(Json::StaticString("GMD"));
+                return;
+            }
+            if (input == Currency::CurrencyGNF)
+            {
+                output = Json::Value(Json::StaticString("GNF"));
+                return;
+            }
+            if (input == Currency::CurrencyGTQ)
+            {
+                output = Json::Value(Json::StaticString("GTQ"));
+                return;
+            }
+            if (input == Currency::CurrencyGYD)
+            {
+                output = Json::Value(Json::StaticString("GYD"));
+                return;
+            }
+            if (input == Currency::CurrencyHKD)
+            {
+                output = Json::Value(Json::StaticString("HKD"));
+                return;
+            }
+            if (input == Currency::CurrencyHNL)
+            {
+                output = Json::Value(Json::StaticString("HNL"));
+                return;
+            }
+            if (input == Currency::CurrencyHRK)
+            {
+                output = Json::Value(Json::StaticString("HRK"));
+                return;
+            }
+            if (input == Currency::CurrencyHTG)
+            {
+                output = Json::Value(Json::StaticString("HTG"));
+                return;
+            }
+            if (input == Currency::CurrencyHUF)
+            {
+                output = Json::Value(Json::StaticString("HUF"));
+                return;
+            }
+            if (input == Currency::CurrencyIDR)
+            {
+                output = Json::Value(Json::StaticString("IDR"));
+                return;
+            }
+            if (input == Currency::CurrencyILS)
+            {
+                output = Json::Value(Json::StaticString("ILS"));
+                return;
+            }
+            if (input == Currency::CurrencyIMP)
+            {
+                output = Json::Value(Json::StaticString("IMP"));
+                return;
+            }
+            if (input == Currency::CurrencyINR)
+            {
+                output = Json::Value(Json::StaticString("INR"));
+                return;
+            }
+            if (input == Currency::CurrencyIQD)
+            {
+                output = Json::Value(Json::StaticString("IQD"));
+                return;
+            }
+            if (input == Currency::CurrencyIRR)
+            {
+                output = Json::Value(Json::StaticString("IRR"));
+                return;
+            }
+            if (input == Currency::CurrencyISK)
+            {
+                output = Json::Value(Json::StaticString("ISK"));
+                return;
+            }
+            if (input == Currency::CurrencyJEP)
+            {
+                output = Json::Value(Json::StaticString("JEP"));
+                return;
+            }
+            if (input == Currency::CurrencyJMD)
+            {
+                output = Json::Value(Json::StaticString("JMD"));
+                return;
+            }
+            if (input == Currency::CurrencyJOD)
+            {
+                output = Json::Value(Json::StaticString("JOD"));
+                return;
+            }
+            if (input == Currency::CurrencyJPY)
+            {
+                output = Json::Value(Json::StaticString("JPY"));
+                return;
+            }
+            if (input == Currency::CurrencyKES)
+            {
+                output = Json::Value(Json::StaticString("KES"));
+                return;
+            }
+            if (input == Currency::CurrencyKGS)
+            {
+                output = Json::Value(Json::StaticString("KGS"));
+                return;
+            }
+            if (input == Currency::CurrencyKHR)
+            {
+                output = Json::Value(Json::StaticString("KHR"));
+                return;
+            }
+            if (input == Currency::CurrencyKMF)
+            {
+                output = Json::Value(Json::StaticString("KMF"));
+                return;
+            }
+            if (input == Currency::CurrencyKPW)
+            {
+                output = Json::Value(Json::StaticString("KPW"));
+                return;
+            }
+            if (input == Currency::CurrencyKRW)
+            {
+                output = Json::Value(Json::StaticString("KRW"));
+                return;
+            }
+            if (input == Currency::CurrencyKWD)
+            {
+                output = Json::Value(Json::StaticString("KWD"));
+                return;
+            }
+            if (input == Currency::CurrencyKYD)
+            {
+                output = Json::Value(Json::StaticString("KYD"));
+                return;
+            }
+            if (input == Currency::CurrencyKZT)
+            {
+                output = Json::Value(Json::StaticString("KZT"));
+                return;
+            }
+            if (input == Currency::CurrencyLAK)
+            {
+                output = Json::Value(Json::StaticString("LAK"));
+                return;
+            }
+            if (input == Currency::CurrencyLBP)
+            {
+                output = Json::Value(Json::StaticString("LBP"));
+                return;
+            }
+            if (input == Currency::CurrencyLKR)
+            {
+                output = Json::Value(Json::StaticString("LKR"));
+                return;
+            }
+            if (input == Currency::CurrencyLRD)
+            {
+                output = Json::Value(Json::StaticString("LRD"));
+                return;
+            }
+            if (input == Currency::CurrencyLSL)
+            {
+                output = Json::Value(Json::StaticString("LSL"));
+                return;
+            }
+            if (input == Currency::CurrencyLYD)
+            {
+                output = Json::Value(Json::StaticString("LYD"));
+                return;
+            }
+            if (input == Currency::CurrencyMAD)
+            {
+                output = Json::Value(Json::StaticString("MAD"));
+                return;
+            }
+            if (input == Currency::CurrencyMDL)
+            {
+                output = Json::Value(Json::StaticString("MDL"));
+                return;
+            }
+            if (input == Currency::CurrencyMGA)
+            {
+                output = Json::Value(Json::StaticString("MGA"));
+                return;
+            }
+            if (input == Currency::CurrencyMKD)
+            {
+                output = Json::Value(Json::StaticString("MKD"));
+                return;
+            }
+            if (input == Currency::CurrencyMMK)
+            {
+                output = Json::Value(Json::StaticString("MMK"));
+                return;
+            }
+            if (input == Currency::CurrencyMNT)
+            {
+                output = Json::Value(Json::StaticString("MNT"));
+                return;
+            }
+            if (input == Currency::CurrencyMOP)
+            {
+                output = Json::Value(Json::StaticString("MOP"));
+                return;
+            }
+            if (input == Currency::CurrencyMRO)
+            {
+                output = Json::Value(Json::StaticString("MRO"));
+                return;
+            }
+            if (input == Currency::CurrencyMUR)
+            {
+                output = Json::Value(Json::StaticString("MUR"));
+                return;
+            }
+            if (input == Currency::CurrencyMVR)
+            {
+                output = Json::Value(Json::StaticString("MVR"));
+                return;
+            }
+            if (input == Currency::CurrencyMWK)
+            {
+                output = Json::Value(Json::StaticString("MWK"));
+                return;
+            }
+            if (input == Currency::CurrencyMXN)
+            {
+                output = Json::Value(Json::StaticString("MXN"));
+                return;
+            }
+            if (input == Currency::CurrencyMYR)
+            {
+                output = Json::Value(Json::StaticString("MYR"));
+                return;
+            }
+            if (input == Currency::CurrencyMZN)
+            {
+                output = Json::Value(Json::StaticString("MZN"));
+                return;
+            }
+            if (input == Currency::CurrencyNAD)
+            {
+                output = Json::Value(Json::StaticString("NAD"));
+                return;
+            }
+            if (input == Currency::CurrencyNGN)
+            {
+                output = Json::Value(Json::StaticString("NGN"));
+                return;
+            }
+            if (input == Currency::CurrencyNIO)
+            {
+                output = Json::Value(Json::StaticString("NIO"));
+                return;
+            }
+            if (input == Currency::CurrencyNOK)
+            {
+                output = Json::Value(Json::StaticString("NOK"));
+                return;
+            }
+            if (input == Currency::CurrencyNPR)
+            {
+                output = Json::Value(Json::StaticString("NPR"));
+                return;
+            }
+            if (input == Currency::CurrencyNZD)
+            {
+                output = Json::Value(Json::StaticString("NZD"));
+                return;
+            }
+            if (input == Currency::CurrencyOMR)
+            {
+                output = Json::Value(Json::StaticString("OMR"));
+                return;
+            }
+            if (input == Currency::CurrencyPAB)
+            {
+                output = Json::Value(Json::StaticString("PAB"));
+                return;
+            }
+            if (input == Currency::CurrencyPEN)
+            {
+                output = Json::Value(Json::StaticString("PEN"));
+                return;
+            }
+            if (input == Currency::CurrencyPGK)
+            {
+                output = Json::Value(Json::StaticString("PGK"));
+                return;
+            }
+            if (input == Currency::CurrencyPHP)
+            {
+                output = Json::Value(Json::StaticString("PHP"));
+                return;
+            }
+            if (input == Currency::CurrencyPKR)
+            {
+                output = Json::Value(Json::StaticString("PKR"));
+                return;
+            }
+            if (input == Currency::CurrencyPLN)
+            {
+                output = Json::Value(Json::StaticString("PLN"));
+                return;
+            }
+            if (input == Currency::CurrencyPYG)
+            {
+                output = Json::Value(Json::StaticString("PYG"));
+                return;
+            }
+            if (input == Currency::CurrencyQAR)
+            {
+                output = Json::Value(Json::StaticString("QAR"));
+                return;
+            }
+            if (input == Currency::CurrencyRON)
+            {
+                output = Json::Value(Json::StaticString("RON"));
+                return;
+            }
+            if (input == Currency::CurrencyRSD)
+            {
+                output = Json::Value(Json::StaticString("RSD"));
+                return;
+            }
+            if (input == Currency::CurrencyRUB)
+            {
+                output = Json::Value(Json::StaticString("RUB"));
+                return;
+            }
+            if (input == Currency::CurrencyRWF)
+            {
+                output = Json::Value(Json::StaticString("RWF"));
+                return;
+            }
+            if (input == Currency::CurrencySAR)
+            {
+                output = Json::Value(Json::StaticString("SAR"));
+                return;
+            }
+            if (input == Currency::CurrencySBD)
+            {
+                output = Json::Value(Json::StaticString("SBD"));
+                return;
+            }
+            if (input == Currency::CurrencySCR)
+            {
+                output = Json::Value(Json::StaticString("SCR"));
+                return;
+            }
+            if (input == Currency::CurrencySDG)
+            {
+                output = Json::Value(Json::StaticString("SDG"));
+                return;
+            }
+            if (input == Currency::CurrencySEK)
+            {
+                output = Json::Value(Json::StaticString("SEK"));
+                return;
+            }
+            if (input == Currency::CurrencySGD)
+            {
+                output = Json::Value(Json::StaticString("SGD"));
+                return;
+            }
+            if (input == Currency::CurrencySHP)
+            {
+                output = Json::Value(Json::StaticString("SHP"));
+                return;
+            }
+            if (input == Currency::CurrencySLL)
+            {
+                output = Json::Value(Json::StaticString("SLL"));
+                return;
+            }
+            if (input == Currency::CurrencySOS)
+            {
+                output = Json::Value(Json::StaticString("SOS"));
+                return;
+            }
+            if (input == Currency::CurrencySPL)
+            {
+                output = Json::Value(Json::StaticString("SPL"));
+                return;
+            }
+            if (input == Currency::CurrencySRD)
+            {
+                output = Json::Value(Json::StaticString("SRD"));
+                return;
+            }
+            if (input == Currency::CurrencySTD)
+            {
+                output = Json::Value(Json::StaticString("STD"));
+                return;
+            }
+            if (input == Currency::CurrencySVC)
+            {
+                output = Json::Value(Json::StaticString("SVC"));
+                return;
+            }
+            if (input == Currency::CurrencySYP)
+            {
+                output = Json::Value(Json::StaticString("SYP"));
+                return;
+            }
+            if (input == Currency::CurrencySZL)
+            {
+                output = Json::Value(Json::StaticString("SZL"));
+                return;
+            }
+            if (input == Currency::CurrencyTHB)
+            {
+                output = Json::Value(Json::StaticString("THB"));
+                return;
+            }
+            if (input == Currency::CurrencyTJS)
+            {
+                output = Json::Value(Json::StaticString("TJS"));
+                return;
+            }
+            if (input == Currency::CurrencyTMT)
+            {
+                output = Json::Value(Json::StaticString("TMT"));
+                return;
+            }
+            if (input == Currency::CurrencyTND)
+            {
+                output = Json::Value(Json::StaticString("TND"));
+                return;
+            }
+            if (input == Currency::CurrencyTOP)
+            {
+                output = Json::Value(Json::StaticString("TOP"));
+                return;
+            }
+            if (input == Currency::CurrencyTRY)
+            {
+                output = Json::Value(Json::StaticString("TRY"));
+                return;
+            }
+            if (input == Currency::CurrencyTTD)
+            {
+                output = Json::Value(Json::StaticString("TTD"));
+                return;
+            }
+            if (input == Currency::CurrencyTVD)
+            {
+                output = Json::Value(Json::StaticString("TVD"));
+                return;
+            }
+            if (input == Currency::CurrencyTWD)
+            {
+                output = Json::Value(Json::StaticString("TWD"));
+                return;
+            }
+            if (input == Currency::CurrencyTZS)
+            {
+                output = Json::Value(Json::StaticString("TZS"));
+                return;
+            }
+            if (input == Currency::CurrencyUAH)
+            {
+                output = Json::Value(Json::StaticString("UAH"));
+                return;
+            }
+            if (input == Currency::CurrencyUGX)
+            {
+                output = Json::Value(Json::StaticString("UGX"));
+                return;
+            }
+            if (input == Currency::CurrencyUSD)
+            {
+                output = Json::Value(Json::StaticString("USD"));
+                return;
+            }
+            if (input == Currency::CurrencyUYU)
+            {
+                output = Json::Value(Json::StaticString("UYU"));
+                return;
+            }
+            if (input == Currency::CurrencyUZS)
+            {
+                output = Json::Value(Json::StaticString("UZS"));
+                return;
+            }
+            if (input == Currency::CurrencyVEF)
+            {
+                output = Json::Value(Json::StaticString("VEF"));
+                return;
+            }
+            if (input == Currency::CurrencyVND)
+            {
+                output = Json::Value(Json::StaticString("VND"));
+                return;
+            }
+            if (input == Currency::CurrencyVUV)
+            {
+                output = Json::Value(Json::StaticString("VUV"));
+                return;
+            }
+            if (input == Currency::CurrencyWST)
+            {
+                output = Json::Value(Json::StaticString("WST"));
+                return;
+            }
+            if (input == Currency::CurrencyXAF)
+            {
+                output = Json::Value(Json::StaticString("XAF"));
+                return;
+            }
+            if (input == Currency::CurrencyXCD)
+            {
+                output = Json::Value(Json::StaticString("XCD"));
+                return;
+            }
+            if (input == Currency::CurrencyXDR)
+            {
+                output = Json::Value(Json::StaticString("XDR"));
+                return;
+            }
+            if (input == Currency::CurrencyXOF)
+            {
+                output = Json::Value(Json::StaticString("XOF"));
+                return;
+            }
+            if (input == Currency::CurrencyXPF)
+            {
+                output = Json::Value(Json::StaticString("XPF"));
+                return;
+            }
+            if (input == Currency::CurrencyYER)
+            {
+                output = Json::Value(Json::StaticString("YER"));
+                return;
+            }
+            if (input == Currency::CurrencyZAR)
+            {
+                output = Json::Value(Json::StaticString("ZAR"));
+                return;
+            }
+            if (input == Currency::CurrencyZMW)
+            {
+                output = Json::Value(Json::StaticString("ZMW"));
+                return;
+            }
+            if (input == Currency::CurrencyZWD)
+            {
+                output = Json::Value(Json::StaticString("ZWD"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, Currency& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "AED")
+            {
+                output = Currency::CurrencyAED;
+                return;
+            }
+            if (inputStr == "AFN")
+            {
+                output = Currency::CurrencyAFN;
+                return;
+            }
+            if (inputStr == "ALL")
+            {
+                output = Currency::CurrencyALL;
+                return;
+            }
+            if (inputStr == "AMD")
+            {
+                output = Currency::CurrencyAMD;
+                return;
+            }
+            if (inputStr == "ANG")
+            {
+                output = Currency::CurrencyANG;
+                return;
+            }
+            if (inputStr == "AOA")
+            {
+                output = Currency::CurrencyAOA;
+                return;
+            }
+            if (inputStr == "ARS")
+            {
+                output = Currency::CurrencyARS;
+                return;
+            }
+            if (inputStr == "AUD")
+            {
+                output = Currency::CurrencyAUD;
+                return;
+            }
+            if (inputStr == "AWG")
+            {
+                output = Currency::CurrencyAWG;
+                return;
+            }
+            if (inputStr == "AZN")
+            {
+                output = Currency::CurrencyAZN;
+                return;
+            }
+            if (inputStr == "BAM")
+            {
+                output = Currency::CurrencyBAM;
+                return;
+            }
+            if (inputStr == "BBD")
+            {
+                output = Currency::CurrencyBBD;
+                return;
+            }
+            if (inputStr == "BDT")
+            {
+                output = Currency::CurrencyBDT;
+                return;
+            }
+            if (inputStr == "BGN")
+            {
+                output = Currency::CurrencyBGN;
+                return;
+            }
+            if (inputStr == "BHD")
+            {
+                output = Currency::CurrencyBHD;
+                return;
+            }
+            if (inputStr == "BIF")
+            {
+                output = Currency::CurrencyBIF;
+                return;
+            }
+            if (inputStr == "BMD")
+            {
+                output = Currency::CurrencyBMD;
+                return;
+            }
+            if (inputStr == "BND")
+            {
+                output = Currency::CurrencyBND;
+                return;
+            }
+            if (inputStr == "BOB")
+            {
+                output = Currency::CurrencyBOB;
+                return;
+            }
+            if (inputStr == "BRL")
+            {
+                output = Currency::CurrencyBRL;
+                return;
+            }
+            if (inputStr == "BSD")
+            {
+                output = Currency::CurrencyBSD;
+                return;
+            }
+            if (inputStr == "BTN")
+            {
+                output = Currency::CurrencyBTN;
+                return;
+            }
+            if (inputStr == "BWP")
+            {
+                output = Currency::CurrencyBWP;
+                return;
+            }
+            if (inputStr == "BYR")
+            {
+                output = Currency::CurrencyBYR;
+                return;
+            }
+            if (inputStr == "BZD")
+            {
+                output = Currency::CurrencyBZD;
+                return;
+            }
+            if (inputStr == "CAD")
+            {
+                output = Currency::CurrencyCAD;
+                return;
+            }
+            if (inputStr == "CDF")
+            {
+                output = Currency::CurrencyCDF;
+                return;
+            }
+            if (inputStr == "CHF")
+            {
+                output = Currency::CurrencyCHF;
+                return;
+            }
+            if (inputStr == "CLP")
+            {
+                output = Currency::CurrencyCLP;
+                return;
+            }
+            if (inputStr == "CNY")
+            {
+                output = Currency::CurrencyCNY;
+                return;
+            }
+            if (inputStr == "COP")
+            {
+                output = Currency::CurrencyCOP;
+                return;
+            }
+            if (inputStr == "CRC")
+            {
+                output = Currency::CurrencyCRC;
+                return;
+            }
+            if (inputStr == "CUC")
+            {
+                output = Currency::CurrencyCUC;
+                return;
+            }
+            if (inputStr == "CUP")
+            {
+                output = Currency::CurrencyCUP;
+                return;
+            }
+            if (inputStr == "CVE")
+            {
+                output = Currency::CurrencyCVE;
+                return;
+            }
+            if (inputStr == "CZK")
+            {
+                output = Currency::CurrencyCZK;
+                return;
+            }
+            if (inputStr == "DJF")
+            {
+                output = Currency::CurrencyDJF;
+                return;
+            }
+            if (inputStr == "DKK")
+            {
+                output = Currency::CurrencyDKK;
+                return;
+            }
+            if (inputStr == "DOP")
+            {
+                output = Currency::CurrencyDOP;
+                return;
+            }
+            if (inputStr == "DZD")
+            {
+                output = Currency::CurrencyDZD;
+                return;
+            }
+            if (inputStr == "EGP")
+            {
+                output = Currency::CurrencyEGP;
+                return;
+            }
+            if (inputStr == "ERN")
+            {
+                output = Currency::CurrencyERN;
+                return;
+            }
+            if (inputStr == "ETB")
+            {
+                output = Currency::CurrencyETB;
+                return;
+            }
+            if (inputStr == "EUR")
+            {
+                output = Currency::CurrencyEUR;
+                return;
+            }
+            if (inputStr == "FJD")
+            {
+                output = Currency::CurrencyFJD;
+                return;
+            }
+            if (inputStr == "FKP")
+            {
+                output = Currency::CurrencyFKP;
+                return;
+            }
+            if (inputStr == "GBP")
+            {
+                output = Currency::CurrencyGBP;
+                return;
+            }
+            if (inputStr == "GEL")
+            {
+                output = Currency::CurrencyGEL;
+                return;
+            }
+            if (inputStr == "GGP")
+            {
+                output = Currency::CurrencyGGP;
+                return;
+            }
+            if (inputStr == "GHS")
+            {
+                output = Currency::CurrencyGHS;
+                return;
+            }
+            if (inputStr == "GIP")
+            {
+                output = Currency::CurrencyGIP;
+                return;
+            }
+            if (inputStr == "GMD")
+            {
+                output = Currency::CurrencyGMD;
+                return;
+            }
+            if (inputStr == "GNF")
+            {
+                output = Currency::CurrencyGNF;
+                return;
+            }
+            if (inputStr == "GTQ")
+            {
+                output = Currency::CurrencyGTQ;
+                return;
+            }
+            if (inputStr == "GYD")
+            {
+                output = Currency::CurrencyGYD;
+                return;
+            }
+            if (inputStr == "HKD")
+            {
+                output = Currency::CurrencyHKD;
+                return;
+            }
+            if (inputStr == "HNL")
+            {
+                output = Currency::CurrencyHNL;
+                return;
+            }
+            if (inputStr == "HRK")
+            {
+                output = Currency::CurrencyHRK;
+                return;
+            }
+            if (inputStr == "HTG")
+            {
+                output = Currency::CurrencyHTG;
+                return;
+            }
+            if (inputStr == "HUF")
+            {
+                output = Currency::CurrencyHUF;
+                return;
+            }
+            if (inputStr == "IDR")
+            {
+                output = Currency::CurrencyIDR;
+                return;
+            }
+            if (inputStr == "ILS")
+            {
+                output = Currency::CurrencyILS;
+                return;
+            }
+            if (inputStr == "IMP")
+            {
+                output = Currency::CurrencyIMP;
+                return;
+            }
+            if (inputStr == "INR")
+            {
+                output = Currency::CurrencyINR;
+                return;
+            }
+            if (inputStr == "IQD")
+            {
+                output = Currency::CurrencyIQD;
+                return;
+            }
+            if (inputStr == "IRR")
+            {
+                output = Currency::CurrencyIRR;
+                return;
+            }
+            if (inputStr == "ISK")
+            {
+                output = Currency::CurrencyISK;
+                return;
+            }
+            if (inputStr == "JEP")
+            {
+                output = Currency::CurrencyJEP;
+                return;
+            }
+            if (inputStr == "JMD")
+            {
+                output = Currency::CurrencyJMD;
+                return;
+            }
+            if (inputStr == "JOD")
+            {
+                output = Currency::CurrencyJOD;
+                return;
+            }
+            if (inputStr == "JPY")
+            {
+                output = Currency::CurrencyJPY;
+                return;
+            }
+            if (inputStr == "KES")
+            {
+                output = Currency::CurrencyKES;
+                return;
+            }
+            if (inputStr == "KGS")
+            {
+                output = Currency::CurrencyKGS;
+                return;
+            }
+            if (inputStr == "KHR")
+            {
+                output = Currency::CurrencyKHR;
+                return;
+            }
+            if (inputStr == "KMF")
+            {
+                output = Currency::CurrencyKMF;
+                return;
+            }
+            if (inputStr == "KPW")
+            {
+                output = Currency::CurrencyKPW;
+                return;
+            }
+            if (inputStr == "KRW")
+            {
+                output = Currency::CurrencyKRW;
+                return;
+            }
+            if (inputStr == "KWD")
+            {
+                output = Currency::CurrencyKWD;
+                return;
+            }
+            if (inputStr == "KYD")
+            {
+                output = Currency::CurrencyKYD;
+                return;
+            }
+            if (inputStr == "KZT")
+            {
+                output = Currency::CurrencyKZT;
+                return;
+            }
+            if (inputStr == "LAK")
+            {
+                output = Currency::CurrencyLAK;
+                return;
+            }
+            if (inputStr == "LBP")
+            {
+                output = Currency::CurrencyLBP;
+                return;
+            }
+            if (inputStr == "LKR")
+            {
+                output = Currency::CurrencyLKR;
+                return;
+            }
+            if (inputStr == "LRD")
+            {
+                output = Currency::CurrencyLRD;
+                return;
+            }
+            if (inputStr == "LSL")
+            {
+                output = Currency::CurrencyLSL;
+                return;
+            }
+            if (inputStr == "LYD")
+            {
+                output = Currency::CurrencyLYD;
+                return;
+            }
+            if (inputStr == "MAD")
+            {
+                output = Currency::CurrencyMAD;
+                return;
+            }
+            if (inputStr == "MDL")
+            {
+                output = Currency::CurrencyMDL;
+                return;
+            }
+            if (inputStr == "MGA")
+            {
+                output = Currency::CurrencyMGA;
+                return;
+            }
+            if (inputStr == "MKD")
+            {
+                output = Currency::CurrencyMKD;
+                return;
+            }
+            if (inputStr == "MMK")
+            {
+                output = Currency::CurrencyMMK;
+                return;
+            }
+            if (inputStr == "MNT")
+            {
+                output = Currency::CurrencyMNT;
+                return;
+            }
+            if (inputStr == "MOP")
+            {
+                output = Currency::CurrencyMOP;
+                return;
+            }
+            if (inputStr == "MRO")
+            {
+                output = Currency::CurrencyMRO;
+                return;
+            }
+            if (inputStr == "MUR")
+            {
+                output = Currency::CurrencyMUR;
+                return;
+            }
+            if (inputStr == "MVR")
+            {
+                output = Currency::CurrencyMVR;
+                return;
+            }
+            if (inputStr == "MWK")
+            {
+                output = Currency::CurrencyMWK;
+                return;
+            }
+            if (inputStr == "MXN")
+            {
+                output = Currency::CurrencyMXN;
+                return;
+            }
+            if (inputStr == "MYR")
+            {
+                output = Currency::CurrencyMYR;
+                return;
+            }
+            if (inputStr == "MZN")
+            {
+                output = Currency::CurrencyMZN;
+                return;
+            }
+            if (inputStr == "NAD")
+            {
+                output = Currency::CurrencyNAD;
+                return;
+            }
+            if (inputStr == "NGN")
+            {
+                output = Currency::CurrencyNGN;
+                return;
+            }
+            if (inputStr == "NIO")
+            {
+                output = Currency::CurrencyNIO;
+                return;
+            }
+            if (inputStr == "NOK")
+            {
+                output = Currency::CurrencyNOK;
+                return;
+            }
+            if (inputStr == "NPR")
+            {
+                output = Currency::CurrencyNPR;
+                return;
+            }
+            if (inputStr == "NZD")
+            {
+                output = Currency::CurrencyNZD;
+                return;
+            }
+            if (inputStr == "OMR")
+            {
+                output = Currency::CurrencyOMR;
+                return;
+            }
+            if (inputStr == "PAB")
+            {
+                output = Currency::CurrencyPAB;
+                return;
+            }
+            if (inputStr == "PEN")
+            {
+                output = Currency::CurrencyPEN;
+                return;
+            }
+            if (inputStr == "PGK")
+            {
+                output = Currency::CurrencyPGK;
+                return;
+            }
+            if (inputStr == "PHP")
+            {
+                output = Currency::CurrencyPHP;
+                return;
+            }
+            if (inputStr == "PKR")
+            {
+                output = Currency::CurrencyPKR;
+                return;
+            }
+            if (inputStr == "PLN")
+            {
+                output = Currency::CurrencyPLN;
+                return;
+            }
+            if (inputStr == "PYG")
+            {
+                output = Currency::CurrencyPYG;
+                return;
+            }
+            if (inputStr == "QAR")
+            {
+                output = Currency::CurrencyQAR;
+                return;
+            }
+            if (inputStr == "RON")
+            {
+                output = Currency::CurrencyRON;
+                return;
+            }
+            if (inputStr == "RSD")
+            {
+                output = Currency::CurrencyRSD;
+                return;
+            }
+            if (inputStr == "RUB")
+            {
+                output = Currency::CurrencyRUB;
+                return;
+            }
+            if (inputStr == "RWF")
+            {
+                output = Currency::CurrencyRWF;
+                return;
+            }
+            if (inputStr == "SAR")
+            {
+                output = Currency::CurrencySAR;
+                return;
+            }
+            if (inputStr == "SBD")
+            {
+                output = Currency::CurrencySBD;
+                return;
+            }
+            if (inputStr == "SCR")
+            {
+                output = Currency::CurrencySCR;
+                return;
+            }
+            if (inputStr == "SDG")
+            {
+                output = Currency::CurrencySDG;
+                return;
+            }
+            if (inputStr == "SEK")
+            {
+                output = Currency::CurrencySEK;
+                return;
+            }
+            if (inputStr == "SGD")
+            {
+                output = Currency::CurrencySGD;
+                return;
+            }
+            if (inputStr == "SHP")
+            {
+                output = Currency::CurrencySHP;
+                return;
+            }
+            if (inputStr == "SLL")
+            {
+                output = Currency::CurrencySLL;
+                return;
+            }
+            if (inputStr == "SOS")
+            {
+                output = Currency::CurrencySOS;
+                return;
+            }
+            if (inputStr == "SPL")
+            {
+                output = Currency::CurrencySPL;
+                return;
+            }
+            if (inputStr == "SRD")
+            {
+                output = Currency::CurrencySRD;
+                return;
+            }
+            if (inputStr == "STD")
+            {
+                output = Currency::CurrencySTD;
+                return;
+            }
+            if (inputStr == "SVC")
+            {
+                output = Currency::CurrencySVC;
+                return;
+            }
+            if (inputStr == "SYP")
+            {
+                output = Currency::CurrencySYP;
+                return;
+            }
+            if (inputStr == "SZL")
+            {
+                output = Currency::CurrencySZL;
+                return;
+            }
+            if (inputStr == "THB")
+            {
+                output = Currency::CurrencyTHB;
+                return;
+            }
+            if (inputStr == "TJS")
+            {
+                output = Currency::CurrencyTJS;
+                return;
+            }
+            if (inputStr == "TMT")
+            {
+                output = Currency::CurrencyTMT;
+                return;
+            }
+            if (inputStr == "TND")
+            {
+                output = Currency::CurrencyTND;
+                return;
+            }
+            if (inputStr == "TOP")
+            {
+                output = Currency::CurrencyTOP;
+                return;
+            }
+            if (inputStr == "TRY")
+            {
+                output = Currency::CurrencyTRY;
+                return;
+            }
+            if (inputStr == "TTD")
+            {
+                output = Currency::CurrencyTTD;
+                return;
+            }
+            if (inputStr == "TVD")
+            {
+                output = Currency::CurrencyTVD;
+                return;
+            }
+            if (inputStr == "TWD")
+            {
+                output = Currency::CurrencyTWD;
+                return;
+            }
+            if (inputStr == "TZS")
+            {
+                output = Currency::CurrencyTZS;
+                return;
+            }
+            if (inputStr == "UAH")
+            {
+                output = Currency::CurrencyUAH;
+                return;
+            }
+            if (inputStr == "UGX")
+            {
+                output = Currency::CurrencyUGX;
+                return;
+            }
+            if (inputStr == "USD")
+            {
+                output = Currency::CurrencyUSD;
+                return;
+            }
+            if (inputStr == "UYU")
+            {
+                output = Currency::CurrencyUYU;
+                return;
+            }
+            if (inputStr == "UZS")
+            {
+                output = Currency::CurrencyUZS;
+                return;
+            }
+            if (inputStr == "VEF")
+            {
+                output = Currency::CurrencyVEF;
+                return;
+            }
+            if (inputStr == "VND")
+            {
+                output = Currency::CurrencyVND;
+                return;
+            }
+            if (inputStr == "VUV")
+            {
+                output = Currency::CurrencyVUV;
+                return;
+            }
+            if (inputStr == "WST")
+            {
+                output = Currency::CurrencyWST;
+                return;
+            }
+            if (inputStr == "XAF")
+            {
+                output = Currency::CurrencyXAF;
+                return;
+            }
+            if (inputStr == "XCD")
+            {
+                output = Currency::CurrencyXCD;
+                return;
+            }
+            if (inputStr == "XDR")
+            {
+                output = Currency::CurrencyXDR;
+                return;
+            }
+            if (inputStr == "XOF")
+            {
+                output = Currency::CurrencyXOF;
+                return;
+            }
+            if (inputStr == "XPF")
+            {
+                output = Currency::CurrencyXPF;
+                return;
+            }
+            if (inputStr == "YER")
+            {
+                output = Currency::CurrencyYER;
+                return;
+            }
+            if (inputStr == "ZAR")
+            {
+                output = Currency::CurrencyZAR;
+                return;
+            }
+            if (inputStr == "ZMW")
+            {
+                output = Currency::CurrencyZMW;
+                return;
+            }
+            if (inputStr == "ZWD")
+            {
+                output = Currency::CurrencyZWD;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const EffectType input, Json::Value& output)
+        {
+            if (input == EffectType::EffectTypeAllow)
+            {
+                output = Json::Value(Json::StaticString("Allow"));
+                return;
+            }
+            if (input == EffectType::EffectTypeDeny)
+            {
+                output = Json::Value(Json::StaticString("Deny"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, EffectType& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Allow")
+            {
+                output = EffectType::EffectTypeAllow;
+                return;
+            }
+            if (inputStr == "Deny")
+            {
+                output = EffectType::EffectTypeDeny;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const EmailVerificationStatus input, Json::Value& output)
+        {
+            if (input == EmailVerificationStatus::EmailVerificationStatusUnverified)
+            {
+                output = Json::Value(Json::StaticString("Unverified"));
+                return;
+            }
+            if (input == EmailVerificationStatus::EmailVerificationStatusPending)
+            {
+                output = Json::Value(Json::StaticString("Pending"));
+                return;
+            }
+            if (input == EmailVerificationStatus::EmailVerificationStatusConfirmed)
+            {
+                output = Json::Value(Json::StaticString("Confirmed"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, EmailVerificationStatus& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Unverified")
+            {
+                output = EmailVerificationStatus::EmailVerificationStatusUnverified;
+                return;
+            }
+            if (inputStr == "Pending")
+            {
+                output = EmailVerificationStatus::EmailVerificationStatusPending;
+                return;
+            }
+            if (inputStr == "Confirmed")
+            {
+                output = EmailVerificationStatus::EmailVerificationStatusConfirmed;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const GameBuildStatus input, Json::Value& output)
+        {
+            if (input == GameBuildStatus::GameBuildStatusAvailable)
+            {
+                output = Json::Value(Json::StaticString("Available"));
+                return;
+            }
+            if (input == GameBuildStatus::GameBuildStatusValidating)
+            {
+                output = Json::Value(Json::StaticString("Validating"));
+                return;
+            }
+            if (input == GameBuildStatus::GameBuildStatusInvalidBuildPackage)
+            {
+                output = Json::Value(Json::StaticString("InvalidBuildPackage"));
+                return;
+            }
+            if (input == GameBuildStatus::GameBuildStatusProcessing)
+            {
+                output = Json::Value(Json::StaticString("Processing"));
+                return;
+            }
+            if (input == GameBuildStatus::GameBuildStatusFailedToProcess)
+            {
+                output = Json::Value(Json::StaticString("FailedToProcess"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, GameBuildStatus& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Available")
+            {
+                output = GameBuildStatus::GameBuildStatusAvailable;
+                return;
+            }
+            if (inputStr == "Validating")
+            {
+                output = GameBuildStatus::GameBuildStatusValidating;
+                return;
+            }
+            if (inputStr == "InvalidBuildPackage")
+            {
+                output = GameBuildStatus::GameBuildStatusInvalidBuildPackage;
+                return;
+            }
+            if (inputStr == "Processing")
+            {
+                output = GameBuildStatus::GameBuildStatusProcessing;
+                return;
+            }
+            if (inputStr == "FailedToProcess")
+            {
+                output = GameBuildStatus::GameBuildStatusFailedToProcess;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const GenericErrorCodes input, Json::Value& output)
+        {
+            if (input == GenericErrorCodes::GenericErrorCodesSuccess)
+            {
+                output = Json::Value(Json::StaticString("Success"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesUnkownError)
+            {
+                output = Json::Value(Json::StaticString("UnkownError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidParams)
+            {
+                output = Json::Value(Json::StaticString("InvalidParams"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAccountNotFound)
+            {
+                output = Json::Value(Json::StaticString("AccountNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAccountBanned)
+            {
+                output = Json::Value(Json::StaticString("AccountBanned"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidUsernameOrPassword)
+            {
+                output = Json::Value(Json::StaticString("InvalidUsernameOrPassword"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidTitleId)
+            {
+                output = Json::Value(Json::StaticString("InvalidTitleId"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidEmailAddress)
+            {
+                output = Json::Value(Json::StaticString("InvalidEmailAddress"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEmailAddressNotAvailable)
+            {
+                output = Json::Value(Json::StaticString("EmailAddressNotAvailable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidUsername)
+            {
+                output = Json::Value(Json::StaticString("InvalidUsername"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidPassword)
+            {
+                output = Json::Value(Json::StaticString("InvalidPassword"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesUsernameNotAvailable)
+            {
+                output = Json::Value(Json::StaticString("UsernameNotAvailable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidSteamTicket)
+            {
+                output = Json::Value(Json::StaticString("InvalidSteamTicket"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAccountAlreadyLinked)
+            {
+                output = Json::Value(Json::StaticString("AccountAlreadyLinked"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesLinkedAccountAlreadyClaimed)
+            {
+                output = Json::Value(Json::StaticString("LinkedAccountAlreadyClaimed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidFacebookToken)
+            {
+                output = Json::Value(Json::StaticString("InvalidFacebookToken"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAccountNotLinked)
+            {
+                output = Json::Value(Json::StaticString("AccountNotLinked"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesFailedByPaymentProvider)
+            {
+                output = Json::Value(Json::StaticString("FailedByPaymentProvider"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCouponCodeNotFound)
+            {
+                output = Json::Value(Json::StaticString("CouponCodeNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidContainerItem)
+            {
+                output = Json::Value(Json::StaticString("InvalidContainerItem"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesContainerNotOwned)
+            {
+                output = Json::Value(Json::StaticString("ContainerNotOwned"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesKeyNotOwned)
+            {
+                output = Json::Value(Json::StaticString("KeyNotOwned"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidItemIdInTable)
+            {
+                output = Json::Value(Json::StaticString("InvalidItemIdInTable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidReceipt)
+            {
+                output = Json::Value(Json::StaticString("InvalidReceipt"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesReceiptAlreadyUsed)
+            {
+                output = Json::Value(Json::StaticString("ReceiptAlreadyUsed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesReceiptCancelled)
+            {
+                output = Json::Value(Json::StaticString("ReceiptCancelled"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGameNotFound)
+            {
+                output = Json::Value(Json::StaticString("GameNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGameModeNotFound)
+            {
+                output = Json::Value(Json::StaticString("GameModeNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidGoogleToken)
+            {
+                output = Json::Value(Json::StaticString("InvalidGoogleToken"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesUserIsNotPartOfDeveloper)
+            {
+                output = Json::Value(Json::StaticString("UserIsNotPartOfDeveloper"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidTitleForDeveloper)
+            {
+                output = Json::Value(Json::StaticString("InvalidTitleForDeveloper"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleNameConflicts)
+            {
+                output = Json::Value(Json::StaticString("TitleNameConflicts"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesUserisNotValid)
+            {
+                output = Json::Value(Json::StaticString("UserisNotValid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesValueAlreadyExists)
+            {
+                output = Json::Value(Json::StaticString("ValueAlreadyExists"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesBuildNotFound)
+            {
+                output = Json::Value(Json::StaticString("BuildNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPlayerNotInGame)
+            {
+                output = Json::Value(Json::StaticString("PlayerNotInGame"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidTicket)
+            {
+                output = Json::Value(Json::StaticString("InvalidTicket"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidDeveloper)
+            {
+                output = Json::Value(Json::StaticString("InvalidDeveloper"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidOrderInfo)
+            {
+                output = Json::Value(Json::StaticString("InvalidOrderInfo"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesRegistrationIncomplete)
+            {
+                output = Json::Value(Json::StaticString("RegistrationIncomplete"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidPlatform)
+            {
+                output = Json::Value(Json::StaticString("InvalidPlatform"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesUnknownError)
+            {
+                output = Json::Value(Json::StaticString("UnknownError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSteamApplicationNotOwned)
+            {
+                output = Json::Value(Json::StaticString("SteamApplicationNotOwned"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesWrongSteamAccount)
+            {
+                output = Json::Value(Json::StaticString("WrongSteamAccount"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleNotActivated)
+            {
+                output = Json::Value(Json::StaticString("TitleNotActivated"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesRegistrationSessionNotFound)
+            {
+                output = Json::Value(Json::StaticString("RegistrationSessionNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNoSuchMod)
+            {
+                output = Json::Value(Json::StaticString("NoSuchMod"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesFileNotFound)
+            {
+                output = Json::Value(Json::StaticString("FileNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDuplicateEmail)
+            {
+                output = Json::Value(Json::StaticString("DuplicateEmail"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesItemNotFound)
+            {
+                output = Json::Value(Json::StaticString("ItemNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesItemNotOwned)
+            {
+                output = Json::Value(Json::StaticString("ItemNotOwned"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesItemNotRecycleable)
+            {
+                output = Json::Value(Json::StaticString("ItemNotRecycleable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesItemNotAffordable)
+            {
+                output = Json::Value(Json::StaticString("ItemNotAffordable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidVirtualCurrency)
+            {
+                output = Json::Value(Json::StaticString("InvalidVirtualCurrency"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesWrongVirtualCurrency)
+            {
+                output = Json::Value(Json::StaticString("WrongVirtualCurrency"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesWrongPrice)
+            {
+                output = Json::Value(Json::StaticString("WrongPrice"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNonPositiveValue)
+            {
+                output = Json::Value(Json::StaticString("NonPositiveValue"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidRegion)
+            {
+                output = Json::Value(Json::StaticString("InvalidRegion"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesRegionAtCapacity)
+            {
+                output = Json::Value(Json::StaticString("RegionAtCapacity"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesServerFailedToStart)
+            {
+                output = Json::Value(Json::StaticString("ServerFailedToStart"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNameNotAvailable)
+            {
+                output = Json::Value(Json::StaticString("NameNotAvailable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInsufficientFunds)
+            {
+                output = Json::Value(Json::StaticString("InsufficientFunds"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidDeviceID)
+            {
+                output = Json::Value(Json::StaticString("InvalidDeviceID"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidPushNotificationToken)
+            {
+                output = Json::Value(Json::StaticString("InvalidPushNotificationToken"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNoRemainingUses)
+            {
+                output = Json::Value(Json::StaticString("NoRemainingUses"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidPaymentProvider)
+            {
+                output = Json::Value(Json::StaticString("InvalidPaymentProvider"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPurchaseInitializationFailure)
+            {
+                output = Json::Value(Json::StaticString("PurchaseInitializationFailure"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDuplicateUsername)
+            {
+                output = Json::Value(Json::StaticString("DuplicateUsername"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidBuyerInfo)
+            {
+                output = Json::Value(Json::StaticString("InvalidBuyerInfo"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNoGameModeParamsSet)
+            {
+                output = Json::Value(Json::StaticString("NoGameModeParamsSet"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesBodyTooLarge)
+            {
+                output = Json::Value(Json::StaticString("BodyTooLarge"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesReservedWordInBody)
+            {
+                output = Json::Value(Json::StaticString("ReservedWordInBody"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidTypeInBody)
+            {
+                output = Json::Value(Json::StaticString("InvalidTypeInBody"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidRequest)
+            {
+                output = Json::Value(Json::StaticString("InvalidRequest"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesReservedEventName)
+            {
+                output = Json::Value(Json::StaticString("ReservedEventName"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidUserStatistics)
+            {
+                output = Json::Value(Json::StaticString("InvalidUserStatistics"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNotAuthenticated)
+            {
+                output = Json::Value(Json::StaticString("NotAuthenticated"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStreamAlreadyExists)
+            {
+                output = Json::Value(Json::StaticString("StreamAlreadyExists"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesErrorCreatingStream)
+            {
+                output = Json::Value(Json::StaticString("ErrorCreatingStream"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStreamNotFound)
+            {
+                output = Json::Value(Json::StaticString("StreamNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidAccount)
+            {
+                output = Json::Value(Json::StaticString("InvalidAccount"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPurchaseDoesNotExist)
+            {
+                output = Json::Value(Json::StaticString("PurchaseDoesNotExist"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidPurchaseTransactionStatus)
+            {
+                output = Json::Value(Json::StaticString("InvalidPurchaseTransactionStatus"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAPINotEnabledForGameClientAccess)
+            {
+                output = Json::Value(Json::StaticString("APINotEnabledForGameClientAccess"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNoPushNotificationARNForTitle)
+            {
+                output = Json::Value(Json::StaticString("NoPushNotificationARNForTitle"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesBuildAlreadyExists)
+            {
+                output = Json::Value(Json::StaticString("BuildAlreadyExists"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesBuildPackageDoesNotExist)
+            {
+                output = Json::Value(Json::StaticString("BuildPackageDoesNotExist"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCustomAnalyticsEventsNotEnabledForTitle)
+            {
+                output = Json::Value(Json::StaticString("CustomAnalyticsEventsNotEnabledForTitle"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidSharedGroupId)
+            {
+                output = Json::Value(Json::StaticString("InvalidSharedGroupId"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNotAuthorized)
+            {
+                output = Json::Value(Json::StaticString("NotAuthorized"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMissingTitleGoogleProperties)
+            {
+                output = Json::Value(Json::StaticString("MissingTitleGoogleProperties"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidItemProperties)
+            {
+                output = Json::Value(Json::StaticString("InvalidItemProperties"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidPSNAuthCode)
+            {
+                output = Json::Value(Json::StaticString("InvalidPSNAuthCode"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidItemId)
+            {
+                output = Json::Value(Json::StaticString("InvalidItemId"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPushNotEnabledForAccount)
+            {
+                output = Json::Value(Json::StaticString("PushNotEnabledForAccount"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPushServiceError)
+            {
+                output = Json::Value(Json::StaticString("PushServiceError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesReceiptDoesNotContainInAppItems)
+            {
+                output = Json::Value(Json::StaticString("ReceiptDoesNotContainInAppItems"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesReceiptContainsMultipleInAppItems)
+            {
+                output = Json::Value(Json::StaticString("ReceiptContainsMultipleInAppItems"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidBundleID)
+            {
+                output = Json::Value(Json::StaticString("InvalidBundleID"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesJavascriptException)
+            {
+                output = Json::Value(Json::StaticString("JavascriptException"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidSessionTicket)
+            {
+                output = Json::Value(Json::StaticString("InvalidSessionTicket"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesUnableToConnectToDatabase)
+            {
+                output = Json::Value(Json::StaticString("UnableToConnectToDatabase"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInternalServerError)
+            {
+                output = Json::Value(Json::StaticString("InternalServerError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidReportDate)
+            {
+                output = Json::Value(Json::StaticString("InvalidReportDate"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesReportNotAvailable)
+            {
+                output = Json::Value(Json::StaticString("ReportNotAvailable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDatabaseThroughputExceeded)
+            {
+                output = Json::Value(Json::StaticString("DatabaseThroughputExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidGameTicket)
+            {
+                output = Json::Value(Json::StaticString("InvalidGameTicket"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExpiredGameTicket)
+            {
+                output = Json::Value(Json::StaticString("ExpiredGameTicket"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGameTicketDoesNotMatchLobby)
+            {
+                output = Json::Value(Json::StaticString("GameTicketDoesNotMatchLobby"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesLinkedDeviceAlreadyClaimed)
+            {
+                output = Json::Value(Json::StaticString("LinkedDeviceAlreadyClaimed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDeviceAlreadyLinked)
+            {
+                output = Json::Value(Json::StaticString("DeviceAlreadyLinked"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDeviceNotLinked)
+            {
+                output = Json::Value(Json::StaticString("DeviceNotLinked"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPartialFailure)
+            {
+                output = Json::Value(Json::StaticString("PartialFailure"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPublisherNotSet)
+            {
+                output = Json::Value(Json::StaticString("PublisherNotSet"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesServiceUnavailable)
+            {
+                output = Json::Value(Json::StaticString("ServiceUnavailable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesVersionNotFound)
+            {
+                output = Json::Value(Json::StaticString("VersionNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesRevisionNotFound)
+            {
+                output = Json::Value(Json::StaticString("RevisionNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidPublisherId)
+            {
+                output = Json::Value(Json::StaticString("InvalidPublisherId"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDownstreamServiceUnavailable)
+            {
+                output = Json::Value(Json::StaticString("DownstreamServiceUnavailable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAPINotIncludedInTitleUsageTier)
+            {
+                output = Json::Value(Json::StaticString("APINotIncludedInTitleUsageTier"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDAULimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("DAULimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAPIRequestLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("APIRequestLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidAPIEndpoint)
+            {
+                output = Json::Value(Json::StaticString("InvalidAPIEndpoint"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesBuildNotAvailable)
+            {
+                output = Json::Value(Json::StaticString("BuildNotAvailable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesConcurrentEditError)
+            {
+                output = Json::Value(Json::StaticString("ConcurrentEditError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesContentNotFound)
+            {
+                output = Json::Value(Json::StaticString("ContentNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCharacterNotFound)
+            {
+                output = Json::Value(Json::StaticString("CharacterNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCloudScriptNotFound)
+            {
+                output = Json::Value(Json::StaticString("CloudScriptNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesContentQuotaExceeded)
+            {
+                output = Json::Value(Json::StaticString("ContentQuotaExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidCharacterStatistics)
+            {
+                output = Json::Value(Json::StaticString("InvalidCharacterStatistics"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPhotonNotEnabledForTitle)
+            {
+                output = Json::Value(Json::StaticString("PhotonNotEnabledForTitle"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPhotonApplicationNotFound)
+            {
+                output = Json::Value(Json::StaticString("PhotonApplicationNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPhotonApplicationNotAssociatedWithTitle)
+            {
+                output = Json::Value(Json::StaticString("PhotonApplicationNotAssociatedWithTitle"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidEmailOrPassword)
+            {
+                output = Json::Value(Json::StaticString("InvalidEmailOrPassword"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesFacebookAPIError)
+            {
+                output = Json::Value(Json::StaticString("FacebookAPIError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidContentType)
+            {
+                output = Json::Value(Json::StaticString("InvalidContentType"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesKeyLengthExceeded)
+            {
+                output = Json::Value(Json::StaticString("KeyLengthExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDataLengthExceeded)
+            {
+                output = Json::Value(Json::StaticString("DataLengthExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTooManyKeys)
+            {
+                output = Json::Value(Json::StaticString("TooManyKeys"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesFreeTierCannotHaveVirtualCurrency)
+            {
+                output = Json::Value(Json::StaticString("FreeTierCannotHaveVirtualCurrency"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMissingAmazonSharedKey)
+            {
+                output = Json::Value(Json::StaticString("MissingAmazonSharedKey"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAmazonValidationError)
+            {
+                output = Json::Value(Json::StaticString("AmazonValidationError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidPSNIssuerId)
+            {
+                output = Json::Value(Json::StaticString("InvalidPSNIssuerId"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPSNInaccessible)
+            {
+                output = Json::Value(Json::StaticString("PSNInaccessible"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExpiredAuthToken)
+            {
+                output = Json::Value(Json::StaticString("ExpiredAuthToken"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesFailedToGetEntitlements)
+            {
+                output = Json::Value(Json::StaticString("FailedToGetEntitlements"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesFailedToConsumeEntitlement)
+            {
+                output = Json::Value(Json::StaticString("FailedToConsumeEntitlement"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeAcceptingUserNotAllowed)
+            {
+                output = Json::Value(Json::StaticString("TradeAcceptingUserNotAllowed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeInventoryItemIsAssignedToCharacter)
+            {
+                output = Json::Value(Json::StaticString("TradeInventoryItemIsAssignedToCharacter"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeInventoryItemIsBundle)
+            {
+                output = Json::Value(Json::StaticString("TradeInventoryItemIsBundle"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeStatusNotValidForCancelling)
+            {
+                output = Json::Value(Json::StaticString("TradeStatusNotValidForCancelling"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeStatusNotValidForAccepting)
+            {
+                output = Json::Value(Json::StaticString("TradeStatusNotValidForAccepting"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeDoesNotExist)
+            {
+                output = Json::Value(Json::StaticString("TradeDoesNotExist"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeCancelled)
+            {
+                output = Json::Value(Json::StaticString("TradeCancelled"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeAlreadyFilled)
+            {
+                output = Json::Value(Json::StaticString("TradeAlreadyFilled"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeWaitForStatusTimeout)
+            {
+                output = Json::Value(Json::StaticString("TradeWaitForStatusTimeout"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeInventoryItemExpired)
+            {
+                output = Json::Value(Json::StaticString("TradeInventoryItemExpired"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeMissingOfferedAndAcceptedItems)
+            {
+                output = Json::Value(Json::StaticString("TradeMissingOfferedAndAcceptedItems"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeAcceptedItemIsBundle)
+            {
+                output = Json::Value(Json::StaticString("TradeAcceptedItemIsBundle"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeAcceptedItemIsStackable)
+            {
+                output = Json::Value(Json::StaticString("TradeAcceptedItemIsStackable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeInventoryItemInvalidStatus)
+            {
+                output = Json::Value(Json::StaticString("TradeInventoryItemInvalidStatus"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeAcceptedCatalogItemInvalid)
+            {
+                output = Json::Value(Json::StaticString("TradeAcceptedCatalogItemInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeAllowedUsersInvalid)
+            {
+                output = Json::Value(Json::StaticString("TradeAllowedUsersInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeInventoryItemDoesNotExist)
+            {
+                output = Json::Value(Json::StaticString("TradeInventoryItemDoesNotExist"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeInventoryItemIsConsumed)
+            {
+                output = Json::Value(Json::StaticString("TradeInventoryItemIsConsumed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeInventoryItemIsStackable)
+            {
+                output = Json::Value(Json::StaticString("TradeInventoryItemIsStackable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeAcceptedItemsMismatch)
+            {
+                output = Json::Value(Json::StaticString("TradeAcceptedItemsMismatch"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidKongregateToken)
+            {
+                output = Json::Value(Json::StaticString("InvalidKongregateToken"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesFeatureNotConfiguredForTitle)
+            {
+                output = Json::Value(Json::StaticString("FeatureNotConfiguredForTitle"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNoMatchingCatalogItemForReceipt)
+            {
+                output = Json::Value(Json::StaticString("NoMatchingCatalogItemForReceipt"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidCurrencyCode)
+            {
+                output = Json::Value(Json::StaticString("InvalidCurrencyCode"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNoRealMoneyPriceForCatalogItem)
+            {
+                output = Json::Value(Json::StaticString("NoRealMoneyPriceForCatalogItem"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeInventoryItemIsNotTradable)
+            {
+                output = Json::Value(Json::StaticString("TradeInventoryItemIsNotTradable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeAcceptedCatalogItemIsNotTradable)
+            {
+                output = Json::Value(Json::StaticString("TradeAcceptedCatalogItemIsNotTradable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesUsersAlreadyFriends)
+            {
+                output = Json::Value(Json::StaticString("UsersAlreadyFriends"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesLinkedIdentifierAlreadyClaimed)
+            {
+                output = Json::Value(Json::StaticString("LinkedIdentifierAlreadyClaimed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCustomIdNotLinked)
+            {
+                output = Json::Value(Json::StaticString("CustomIdNotLinked"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTotalDataSizeExceeded)
+            {
+                output = Json::Value(Json::StaticString("TotalDataSizeExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDeleteKeyConflict)
+            {
+                output = Json::Value(Json::StaticString("DeleteKeyConflict"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidXboxLiveToken)
+            {
+                output = Json::Value(Json::StaticString("InvalidXboxLiveToken"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExpiredXboxLiveToken)
+            {
+                output = Json::Value(Json::StaticString("ExpiredXboxLiveToken"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesResettableStatisticVersionRequired)
+            {
+                output = Json::Value(Json::StaticString("ResettableStatisticVersionRequired"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNotAuthorizedByTitle)
+            {
+                output = Json::Value(Json::StaticString("NotAuthorizedByTitle"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNoPartnerEnabled)
+            {
+                output = Json::Value(Json::StaticString("NoPartnerEnabled"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidPartnerResponse)
+            {
+                output = Json::Value(Json::StaticString("InvalidPartnerResponse"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAPINotEnabledForGameServerAccess)
+            {
+                output = Json::Value(Json::StaticString("APINotEnabledForGameServerAccess"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStatisticNotFound)
+            {
+                output = Json::Value(Json::StaticString("StatisticNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStatisticNameConflict)
+            {
+                output = Json::Value(Json::StaticString("StatisticNameConflict"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStatisticVersionClosedForWrites)
+            {
+                output = Json::Value(Json::StaticString("StatisticVersionClosedForWrites"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStatisticVersionInvalid)
+            {
+                output = Json::Value(Json::StaticString("StatisticVersionInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAPIClientRequestRateLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("APIClientRequestRateLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidJSONContent)
+            {
+                output = Json::Value(Json::StaticString("InvalidJSONContent"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidDropTable)
+            {
+                output = Json::Value(Json::StaticString("InvalidDropTable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStatisticVersionAlreadyIncrementedForScheduledInterval)
+            {
+                output = Json::Value(Json::StaticString("StatisticVersionAlreadyIncrementedForScheduledInterval"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStatisticCountLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("StatisticCountLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStatisticVersionIncrementRateExceeded)
+            {
+                output = Json::Value(Json::StaticString("StatisticVersionIncrementRateExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesContainerKeyInvalid)
+            {
+                output = Json::Value(Json::StaticString("ContainerKeyInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCloudScriptExecutionTimeLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("CloudScriptExecutionTimeLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNoWritePermissionsForEvent)
+            {
+                output = Json::Value(Json::StaticString("NoWritePermissionsForEvent"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCloudScriptFunctionArgumentSizeExceeded)
+            {
+                output = Json::Value(Json::StaticString("CloudScriptFunctionArgumentSizeExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCloudScriptAPIRequestCountExceeded)
+            {
+                output = Json::Value(Json::StaticString("CloudScriptAPIRequestCountExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCloudScriptAPIRequestError)
+            {
+                output = Json::Value(Json::StaticString("CloudScriptAPIRequestError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCloudScriptHTTPRequestError)
+            {
+                output = Json::Value(Json::StaticString("CloudScriptHTTPRequestError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInsufficientGuildRole)
+            {
+                output = Json::Value(Json::StaticString("InsufficientGuildRole"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGuildNotFound)
+            {
+                output = Json::Value(Json::StaticString("GuildNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesOverLimit)
+            {
+                output = Json::Value(Json::StaticString("OverLimit"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEventNotFound)
+            {
+                output = Json::Value(Json::StaticString("EventNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidEventField)
+            {
+                output = Json::Value(Json::StaticString("InvalidEventField"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidEventName)
+            {
+                output = Json::Value(Json::StaticString("InvalidEventName"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCatalogNotConfigured)
+            {
+                output = Json::Value(Json::StaticString("CatalogNotConfigured"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesOperationNotSupportedForPlatform)
+            {
+                output = Json::Value(Json::StaticString("OperationNotSupportedForPlatform"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSegmentNotFound)
+            {
+                output = Json::Value(Json::StaticString("SegmentNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStoreNotFound)
+            {
+                output = Json::Value(Json::StaticString("StoreNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidStatisticName)
+            {
+                output = Json::Value(Json::StaticString("InvalidStatisticName"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleNotQualifiedForLimit)
+            {
+                output = Json::Value(Json::StaticString("TitleNotQualifiedForLimit"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidServiceLimitLevel)
+            {
+                output = Json::Value(Json::StaticString("InvalidServiceLimitLevel"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesServiceLimitLevelInTransition)
+            {
+                output = Json::Value(Json::StaticString("ServiceLimitLevelInTransition"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCouponAlreadyRedeemed)
+            {
+                output = Json::Value(Json::StaticString("CouponAlreadyRedeemed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGameServerBuildSizeLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("GameServerBuildSizeLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGameServerBuildCountLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("GameServerBuildCountLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesVirtualCurrencyCountLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("VirtualCurrencyCountLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesVirtualCurrencyCodeExists)
+            {
+                output = Json::Value(Json::StaticString("VirtualCurrencyCodeExists"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleNewsItemCountLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("TitleNewsItemCountLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidTwitchToken)
+            {
+                output = Json::Value(Json::StaticString("InvalidTwitchToken"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTwitchResponseError)
+            {
+                output = Json::Value(Json::StaticString("TwitchResponseError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesProfaneDisplayName)
+            {
+                output = Json::Value(Json::StaticString("ProfaneDisplayName"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesUserAlreadyAdded)
+            {
+                output = Json::Value(Json::StaticString("UserAlreadyAdded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidVirtualCurrencyCode)
+            {
+                output = Json::Value(Json::StaticString("InvalidVirtualCurrencyCode"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesVirtualCurrencyCannotBeDeleted)
+            {
+                output = Json::Value(Json::StaticString("VirtualCurrencyCannotBeDeleted"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesIdentifierAlreadyClaimed)
+            {
+                output = Json::Value(Json::StaticString("IdentifierAlreadyClaimed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesIdentifierNotLinked)
+            {
+                output = Json::Value(Json::StaticString("IdentifierNotLinked"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidContinuationToken)
+            {
+                output = Json::Value(Json::StaticString("InvalidContinuationToken"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExpiredContinuationToken)
+            {
+                output = Json::Value(Json::StaticString("ExpiredContinuationToken"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidSegment)
+            {
+                output = Json::Value(Json::StaticString("InvalidSegment"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidSessionId)
+            {
+                output = Json::Value(Json::StaticString("InvalidSessionId"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSessionLogNotFound)
+            {
+                output = Json::Value(Json::StaticString("SessionLogNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidSearchTerm)
+            {
+                output = Json::Value(Json::StaticString("InvalidSearchTerm"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTwoFactorAuthenticationTokenRequired)
+            {
+                output = Json::Value(Json::StaticString("TwoFactorAuthenticationTokenRequired"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGameServerHostCountLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("GameServerHostCountLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPlayerTagCountLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("PlayerTagCountLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesRequestAlreadyRunning)
+            {
+                output = Json::Value(Json::StaticString("RequestAlreadyRunning"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesActionGroupNotFound)
+            {
+                output = Json::Value(Json::StaticString("ActionGroupNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMaximumSegmentBulkActionJobsRunning)
+            {
+                output = Json::Value(Json::StaticString("MaximumSegmentBulkActionJobsRunning"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNoActionsOnPlayersInSegmentJob)
+            {
+                output = Json::Value(Json::StaticString("NoActionsOnPlayersInSegmentJob"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDuplicateStatisticName)
+            {
+                output = Json::Value(Json::StaticString("DuplicateStatisticName"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesScheduledTaskNameConflict)
+            {
+                output = Json::Value(Json::StaticString("ScheduledTaskNameConflict"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesScheduledTaskCreateConflict)
+            {
+                output = Json::Value(Json::StaticString("ScheduledTaskCreateConflict"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidScheduledTaskName)
+            {
+                output = Json::Value(Json::StaticString("InvalidScheduledTaskName"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidTaskSchedule)
+            {
+                output = Json::Value(Json::StaticString("InvalidTaskSchedule"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSteamNotEnabledForTitle)
+            {
+                output = Json::Value(Json::StaticString("SteamNotEnabledForTitle"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesLimitNotAnUpgradeOption)
+            {
+                output = Json::Value(Json::StaticString("LimitNotAnUpgradeOption"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNoSecretKeyEnabledForCloudScript)
+            {
+                output = Json::Value(Json::StaticString("NoSecretKeyEnabledForCloudScript"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTaskNotFound)
+            {
+                output = Json::Value(Json::StaticString("TaskNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTaskInstanceNotFound)
+            {
+                output = Json::Value(Json::StaticString("TaskInstanceNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidIdentityProviderId)
+            {
+                output = Json::Value(Json::StaticString("InvalidIdentityProviderId"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMisconfiguredIdentityProvider)
+            {
+                output = Json::Value(Json::StaticString("MisconfiguredIdentityProvider"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidScheduledTaskType)
+            {
+                output = Json::Value(Json::StaticString("InvalidScheduledTaskType"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesBillingInformationRequired)
+            {
+                output = Json::Value(Json::StaticString("BillingInformationRequired"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesLimitedEditionItemUnavailable)
+            {
+                output = Json::Value(Json::StaticString("LimitedEditionItemUnavailable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidAdPlacementAndReward)
+            {
+                output = Json::Value(Json::StaticString("InvalidAdPlacementAndReward"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAllAdPlacementViewsAlreadyConsumed)
+            {
+                output = Json::Value(Json::StaticString("AllAdPlacementViewsAlreadyConsumed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGoogleOAuthNotConfiguredForTitle)
+            {
+                output = Json::Value(Json::StaticString("GoogleOAuthNotConfiguredForTitle"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGoogleOAuthError)
+            {
+                output = Json::Value(Json::StaticString("GoogleOAuthError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesUserNotFriend)
+            {
+                output = Json::Value(Json::StaticString("UserNotFriend"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidSignature)
+            {
+                output = Json::Value(Json::StaticString("InvalidSignature"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidPublicKey)
+            {
+                output = Json::Value(Json::StaticString("InvalidPublicKey"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGoogleOAuthNoIdTokenIncludedInResponse)
+            {
+                output = Json::Value(Json::StaticString("GoogleOAuthNoIdTokenIncludedInResponse"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStatisticUpdateInProgress)
+            {
+                output = Json::Value(Json::StaticString("StatisticUpdateInProgress"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesLeaderboardVersionNotAvailable)
+            {
+                output = Json::Value(Json::StaticString("LeaderboardVersionNotAvailable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStatisticAlreadyHasPrizeTable)
+            {
+                output = Json::Value(Json::StaticString("StatisticAlreadyHasPrizeTable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPrizeTableHasOverlappingRanks)
+            {
+                output = Json::Value(Json::StaticString("PrizeTableHasOverlappingRanks"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPrizeTableHasMissingRanks)
+            {
+                output = Json::Value(Json::StaticString("PrizeTableHasMissingRanks"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPrizeTableRankStartsAtZero)
+            {
+                output = Json::Value(Json::StaticString("PrizeTableRankStartsAtZero"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidStatistic)
+            {
+                output = Json::Value(Json::StaticString("InvalidStatistic"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExpressionParseFailure)
+            {
+                output = Json::Value(Json::StaticString("ExpressionParseFailure"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExpressionInvokeFailure)
+            {
+                output = Json::Value(Json::StaticString("ExpressionInvokeFailure"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExpressionTooLong)
+            {
+                output = Json::Value(Json::StaticString("ExpressionTooLong"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDataUpdateRateExceeded)
+            {
+                output = Json::Value(Json::StaticString("DataUpdateRateExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesRestrictedEmailDomain)
+            {
+                output = Json::Value(Json::StaticString("RestrictedEmailDomain"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEncryptionKeyDisabled)
+            {
+                output = Json::Value(Json::StaticString("EncryptionKeyDisabled"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEncryptionKeyMissing)
+            {
+                output = Json::Value(Json::StaticString("EncryptionKeyMissing"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEncryptionKeyBroken)
+            {
+                output = Json::Value(Json::StaticString("EncryptionKeyBroken"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNoSharedSecretKeyConfigured)
+            {
+                output = Json::Value(Json::StaticString("NoSharedSecretKeyConfigured"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSecretKeyNotFound)
+            {
+                output = Json::Value(Json::StaticString("SecretKeyNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPlayerSecretAlreadyConfigured)
+            {
+                output = Json::Value(Json::StaticString("PlayerSecretAlreadyConfigured"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAPIRequestsDisabledForTitle)
+            {
+                output = Json::Value(Json::StaticString("APIRequestsDisabledForTitle"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidSharedSecretKey)
+            {
+                output = Json::Value(Json::StaticString("InvalidSharedSecretKey"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPrizeTableHasNoRanks)
+            {
+                output = Json::Value(Json::StaticString("PrizeTableHasNoRanks"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesProfileDoesNotExist)
+            {
+                output = Json::Value(Json::StaticString("ProfileDoesNotExist"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesContentS3OriginBucketNotConfigured)
+            {
+                output = Json::Value(Json::StaticString("ContentS3OriginBucketNotConfigured"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidEnvironmentForReceipt)
+            {
+                output = Json::Value(Json::StaticString("InvalidEnvironmentForReceipt"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEncryptedRequestNotAllowed)
+            {
+                output = Json::Value(Json::StaticString("EncryptedRequestNotAllowed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSignedRequestNotAllowed)
+            {
+                output = Json::Value(Json::StaticString("SignedRequestNotAllowed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesRequestViewConstraintParamsNotAllowed)
+            {
+                output = Json::Value(Json::StaticString("RequestViewConstraintParamsNotAllowed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesBadPartnerConfiguration)
+            {
+                output = Json::Value(Json::StaticString("BadPartnerConfiguration"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesXboxBPCertificateFailure)
+            {
+                output = Json::Value(Json::StaticString("XboxBPCertificateFailure"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesXboxXASSExchangeFailure)
+            {
+                output = Json::Value(Json::StaticString("XboxXASSExchangeFailure"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidEntityId)
+            {
+                output = Json::Value(Json::StaticString("InvalidEntityId"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStatisticValueAggregationOverflow)
+            {
+                output = Json::Value(Json::StaticString("StatisticValueAggregationOverflow"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEmailMessageFromAddressIsMissing)
+            {
+                output = Json::Value(Json::StaticString("EmailMessageFromAddressIsMissing"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEmailMessageToAddressIsMissing)
+            {
+                output = Json::Value(Json::StaticString("EmailMessageToAddressIsMissing"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSmtpServerAuthenticationError)
+            {
+                output = Json::Value(Json::StaticString("SmtpServerAuthenticationError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSmtpServerLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("SmtpServerLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSmtpServerInsufficientStorage)
+            {
+                output = Json::Value(Json::StaticString("SmtpServerInsufficientStorage"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSmtpServerCommunicationError)
+            {
+                output = Json::Value(Json::StaticString("SmtpServerCommunicationError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSmtpServerGeneralFailure)
+            {
+                output = Json::Value(Json::StaticString("SmtpServerGeneralFailure"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEmailClientTimeout)
+            {
+                output = Json::Value(Json::StaticString("EmailClientTimeout"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEmailClientCanceledTask)
+            {
+                output = Json::Value(Json::StaticString("EmailClientCanceledTask"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEmailTemplateMissing)
+            {
+                output = Json::Value(Json::StaticString("EmailTemplateMissing"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidHostForTitleId)
+            {
+                output = Json::Value(Json::StaticString("InvalidHostForTitleId"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEmailConfirmationTokenDoesNotExist)
+            {
+                output = Json::Value(Json::StaticString("EmailConfirmationTokenDoesNotExist"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEmailConfirmationTokenExpired)
+            {
+                output = Json::Value(Json::StaticString("EmailConfirmationTokenExpired"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAccountDeleted)
+            {
+                output = Json::Value(Json::StaticString("AccountDeleted"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPlayerSecretNotConfigured)
+            {
+                output = Json::Value(Json::StaticString("PlayerSecretNotConfigured"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidSignatureTime)
+            {
+                output = Json::Value(Json::StaticString("InvalidSignatureTime"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNoContactEmailAddressFound)
+            {
+                output = Json::Value(Json::StaticString("NoContactEmailAddressFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidAuthToken)
+            {
+                output = Json::Value(Json::StaticString("InvalidAuthToken"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAuthTokenDoesNotExist)
+            {
+                output = Json::Value(Json::StaticString("AuthTokenDoesNotExist"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAuthTokenExpired)
+            {
+                output = Json::Value(Json::StaticString("AuthTokenExpired"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAuthTokenAlreadyUsedToResetPassword)
+            {
+                output = Json::Value(Json::StaticString("AuthTokenAlreadyUsedToResetPassword"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMembershipNameTooLong)
+            {
+                output = Json::Value(Json::StaticString("MembershipNameTooLong"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMembershipNotFound)
+            {
+                output = Json::Value(Json::StaticString("MembershipNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGoogleServiceAccountInvalid)
+            {
+                output = Json::Value(Json::StaticString("GoogleServiceAccountInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGoogleServiceAccountParseFailure)
+            {
+                output = Json::Value(Json::StaticString("GoogleServiceAccountParseFailure"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEntityTokenMissing)
+            {
+                output = Json::Value(Json::StaticString("EntityTokenMissing"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEntityTokenInvalid)
+            {
+                output = Json::Value(Json::StaticString("EntityTokenInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEntityTokenExpired)
+            {
+                output = Json::Value(Json::StaticString("EntityTokenExpired"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEntityTokenRevoked)
+            {
+                output = Json::Value(Json::StaticString("EntityTokenRevoked"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidProductForSubscription)
+            {
+                output = Json::Value(Json::StaticString("InvalidProductForSubscription"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesXboxInaccessible)
+            {
+                output = Json::Value(Json::StaticString("XboxInaccessible"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSubscriptionAlreadyTaken)
+            {
+                output = Json::Value(Json::StaticString("SubscriptionAlreadyTaken"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSmtpAddonNotEnabled)
+            {
+                output = Json::Value(Json::StaticString("SmtpAddonNotEnabled"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAPIConcurrentRequestLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("APIConcurrentRequestLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesXboxRejectedXSTSExchangeRequest)
+            {
+                output = Json::Value(Json::StaticString("XboxRejectedXSTSExchangeRequest"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesVariableNotDefined)
+            {
+                output = Json::Value(Json::StaticString("VariableNotDefined"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTemplateVersionNotDefined)
+            {
+                output = Json::Value(Json::StaticString("TemplateVersionNotDefined"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesFileTooLarge)
+            {
+                output = Json::Value(Json::StaticString("FileTooLarge"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleDeleted)
+            {
+                output = Json::Value(Json::StaticString("TitleDeleted"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleContainsUserAccounts)
+            {
+                output = Json::Value(Json::StaticString("TitleContainsUserAccounts"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleDeletionPlayerCleanupFailure)
+            {
+                output = Json::Value(Json::StaticString("TitleDeletionPlayerCleanupFailure"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEntityFileOperationPending)
+            {
+                output = Json::Value(Json::StaticString("EntityFileOperationPending"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNoEntityFileOperationPending)
+            {
+                output = Json::Value(Json::StaticString("NoEntityFileOperationPending"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEntityProfileVersionMismatch)
+            {
+                output = Json::Value(Json::StaticString("EntityProfileVersionMismatch"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTemplateVersionTooOld)
+            {
+                output = Json::Value(Json::StaticString("TemplateVersionTooOld"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMembershipDefinitionInUse)
+            {
+                output = Json::Value(Json::StaticString("MembershipDefinitionInUse"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPaymentPageNotConfigured)
+            {
+                output = Json::Value(Json::StaticString("PaymentPageNotConfigured"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesFailedLoginAttemptRateLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("FailedLoginAttemptRateLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEntityBlockedByGroup)
+            {
+                output = Json::Value(Json::StaticString("EntityBlockedByGroup"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesRoleDoesNotExist)
+            {
+                output = Json::Value(Json::StaticString("RoleDoesNotExist"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEntityIsAlreadyMember)
+            {
+                output = Json::Value(Json::StaticString("EntityIsAlreadyMember"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDuplicateRoleId)
+            {
+                output = Json::Value(Json::StaticString("DuplicateRoleId"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGroupInvitationNotFound)
+            {
+                output = Json::Value(Json::StaticString("GroupInvitationNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGroupApplicationNotFound)
+            {
+                output = Json::Value(Json::StaticString("GroupApplicationNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesOutstandingInvitationAcceptedInstead)
+            {
+                output = Json::Value(Json::StaticString("OutstandingInvitationAcceptedInstead"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesOutstandingApplicationAcceptedInstead)
+            {
+                output = Json::Value(Json::StaticString("OutstandingApplicationAcceptedInstead"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesRoleIsGroupDefaultMember)
+            {
+                output = Json::Value(Json::StaticString("RoleIsGroupDefaultMember"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesRoleIsGroupAdmin)
+            {
+                output = Json::Value(Json::StaticString("RoleIsGroupAdmin"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesRoleNameNotAvailable)
+            {
+                output = Json::Value(Json::StaticString("RoleNameNotAvailable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGroupNameNotAvailable)
+            {
+                output = Json::Value(Json::StaticString("GroupNameNotAvailable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEmailReportAlreadySent)
+            {
+                output = Json::Value(Json::StaticString("EmailReportAlreadySent"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEmailReportRecipientBlacklisted)
+            {
+                output = Json::Value(Json::StaticString("EmailReportRecipientBlacklisted"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEventNamespaceNotAllowed)
+            {
+                output = Json::Value(Json::StaticString("EventNamespaceNotAllowed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEventEntityNotAllowed)
+            {
+                output = Json::Value(Json::StaticString("EventEntityNotAllowed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidEntityType)
+            {
+                output = Json::Value(Json::StaticString("InvalidEntityType"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNullTokenResultFromAad)
+            {
+                output = Json::Value(Json::StaticString("NullTokenResultFromAad"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidTokenResultFromAad)
+            {
+                output = Json::Value(Json::StaticString("InvalidTokenResultFromAad"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNoValidCertificateForAad)
+            {
+                output = Json::Value(Json::StaticString("NoValidCertificateForAad"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidCertificateForAad)
+            {
+                output = Json::Value(Json::StaticString("InvalidCertificateForAad"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDuplicateDropTableId)
+            {
+                output = Json::Value(Json::StaticString("DuplicateDropTableId"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMultiplayerServerError)
+            {
+                output = Json::Value(Json::StaticString("MultiplayerServerError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMultiplayerServerTooManyRequests)
+            {
+                output = Json::Value(Json::StaticString("MultiplayerServerTooManyRequests"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMultiplayerServerNoContent)
+            {
+                output = Json::Value(Json::StaticString("MultiplayerServerNoContent"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMultiplayerServerBadRequest)
+            {
+                output = Json::Value(Json::StaticString("MultiplayerServerBadRequest"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMultiplayerServerUnauthorized)
+            {
+                output = Json::Value(Json::StaticString("MultiplayerServerUnauthorized"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMultiplayerServerForbidden)
+            {
+                output = Json::Value(Json::StaticString("MultiplayerServerForbidden"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMultiplayerServerNotFound)
+            {
+                output = Json::Value(Json::StaticString("MultiplayerServerNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMultiplayerServerConflict)
+            {
+                output = Json::Value(Json::StaticString("MultiplayerServerConflict"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMultiplayerServerInternalServerError)
+            {
+                output = Json::Value(Json::StaticString("MultiplayerServerInternalServerError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMultiplayerServerUnavailable)
+            {
+                output = Json::Value(Json::StaticString("MultiplayerServerUnavailable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExplicitContentDetected)
+            {
+                output = Json::Value(Json::StaticString("ExplicitContentDetected"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPIIContentDetected)
+            {
+                output = Json::Value(Json::StaticString("PIIContentDetected"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidScheduledTaskParameter)
+            {
+                output = Json::Value(Json::StaticString("InvalidScheduledTaskParameter"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPerEntityEventRateLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("PerEntityEventRateLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleDefaultLanguageNotSet)
+            {
+                output = Json::Value(Json::StaticString("TitleDefaultLanguageNotSet"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEmailTemplateMissingDefaultVersion)
+            {
+                output = Json::Value(Json::StaticString("EmailTemplateMissingDefaultVersion"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesFacebookInstantGamesIdNotLinked)
+            {
+                output = Json::Value(Json::StaticString("FacebookInstantGamesIdNotLinked"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidFacebookInstantGamesSignature)
+            {
+                output = Json::Value(Json::StaticString("InvalidFacebookInstantGamesSignature"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesFacebookInstantGamesAuthNotConfiguredForTitle)
+            {
+                output = Json::Value(Json::StaticString("FacebookInstantGamesAuthNotConfiguredForTitle"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEntityProfileConstraintValidationFailed)
+            {
+                output = Json::Value(Json::StaticString("EntityProfileConstraintValidationFailed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTelemetryIngestionKeyPending)
+            {
+                output = Json::Value(Json::StaticString("TelemetryIngestionKeyPending"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTelemetryIngestionKeyNotFound)
+            {
+                output = Json::Value(Json::StaticString("TelemetryIngestionKeyNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStatisticChildNameInvalid)
+            {
+                output = Json::Value(Json::StaticString("StatisticChildNameInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDataIntegrityError)
+            {
+                output = Json::Value(Json::StaticString("DataIntegrityError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesVirtualCurrencyCannotBeSetToOlderVersion)
+            {
+                output = Json::Value(Json::StaticString("VirtualCurrencyCannotBeSetToOlderVersion"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesVirtualCurrencyMustBeWithinIntegerRange)
+            {
+                output = Json::Value(Json::StaticString("VirtualCurrencyMustBeWithinIntegerRange"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEmailTemplateInvalidSyntax)
+            {
+                output = Json::Value(Json::StaticString("EmailTemplateInvalidSyntax"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEmailTemplateMissingCallback)
+            {
+                output = Json::Value(Json::StaticString("EmailTemplateMissingCallback"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPushNotificationTemplateInvalidPayload)
+            {
+                output = Json::Value(Json::StaticString("PushNotificationTemplateInvalidPayload"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidLocalizedPushNotificationLanguage)
+            {
+                output = Json::Value(Json::StaticString("InvalidLocalizedPushNotificationLanguage"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMissingLocalizedPushNotificationMessage)
+            {
+                output = Json::Value(Json::StaticString("MissingLocalizedPushNotificationMessage"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPushNotificationTemplateMissingPlatformPayload)
+            {
+                output = Json::Value(Json::StaticString("PushNotificationTemplateMissingPlatformPayload"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPushNotificationTemplatePayloadContainsInvalidJson)
+            {
+                output = Json::Value(Json::StaticString("PushNotificationTemplatePayloadContainsInvalidJson"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPushNotificationTemplateContainsInvalidIosPayload)
+            {
+                output = Json::Value(Json::StaticString("PushNotificationTemplateContainsInvalidIosPayload"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPushNotificationTemplateContainsInvalidAndroidPayload)
+            {
+                output = Json::Value(Json::StaticString("PushNotificationTemplateContainsInvalidAndroidPayload"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPushNotificationTemplateIosPayloadMissingNotificationBody)
+            {
+                output = Json::Value(Json::StaticString("PushNotificationTemplateIosPayloadMissingNotificationBody"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPushNotificationTemplateAndroidPayloadMissingNotificationBody)
+            {
+                output = Json::Value(Json::StaticString("PushNotificationTemplateAndroidPayloadMissingNotificationBody"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPushNotificationTemplateNotFound)
+            {
+                output = Json::Value(Json::StaticString("PushNotificationTemplateNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPushNotificationTemplateMissingDefaultVersion)
+            {
+                output = Json::Value(Json::StaticString("PushNotificationTemplateMissingDefaultVersion"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPushNotificationTemplateInvalidSyntax)
+            {
+                output = Json::Value(Json::StaticString("PushNotificationTemplateInvalidSyntax"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPushNotificationTemplateNoCustomPayloadForV1)
+            {
+                output = Json::Value(Json::StaticString("PushNotificationTemplateNoCustomPayloadForV1"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNoLeaderboardForStatistic)
+            {
+                output = Json::Value(Json::StaticString("NoLeaderboardForStatistic"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleNewsMissingDefaultLanguage)
+            {
+                output = Json::Value(Json::StaticString("TitleNewsMissingDefaultLanguage"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleNewsNotFound)
+            {
+                output = Json::Value(Json::StaticString("TitleNewsNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleNewsDuplicateLanguage)
+            {
+                output = Json::Value(Json::StaticString("TitleNewsDuplicateLanguage"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleNewsMissingTitleOrBody)
+            {
+                output = Json::Value(Json::StaticString("TitleNewsMissingTitleOrBody"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleNewsInvalidLanguage)
+            {
+                output = Json::Value(Json::StaticString("TitleNewsInvalidLanguage"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEmailRecipientBlacklisted)
+            {
+                output = Json::Value(Json::StaticString("EmailRecipientBlacklisted"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidGameCenterAuthRequest)
+            {
+                output = Json::Value(Json::StaticString("InvalidGameCenterAuthRequest"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGameCenterAuthenticationFailed)
+            {
+                output = Json::Value(Json::StaticString("GameCenterAuthenticationFailed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCannotEnablePartiesForTitle)
+            {
+                output = Json::Value(Json::StaticString("CannotEnablePartiesForTitle"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPartyError)
+            {
+                output = Json::Value(Json::StaticString("PartyError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPartyRequests)
+            {
+                output = Json::Value(Json::StaticString("PartyRequests"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPartyNoContent)
+            {
+                output = Json::Value(Json::StaticString("PartyNoContent"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPartyBadRequest)
+            {
+                output = Json::Value(Json::StaticString("PartyBadRequest"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPartyUnauthorized)
+            {
+                output = Json::Value(Json::StaticString("PartyUnauthorized"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPartyForbidden)
+            {
+                output = Json::Value(Json::StaticString("PartyForbidden"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPartyNotFound)
+            {
+                output = Json::Value(Json::StaticString("PartyNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPartyConflict)
+            {
+                output = Json::Value(Json::StaticString("PartyConflict"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPartyInternalServerError)
+            {
+                output = Json::Value(Json::StaticString("PartyInternalServerError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPartyUnavailable)
+            {
+                output = Json::Value(Json::StaticString("PartyUnavailable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPartyTooManyRequests)
+            {
+                output = Json::Value(Json::StaticString("PartyTooManyRequests"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPushNotificationTemplateMissingName)
+            {
+                output = Json::Value(Json::StaticString("PushNotificationTemplateMissingName"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCannotEnableMultiplayerServersForTitle)
+            {
+                output = Json::Value(Json::StaticString("CannotEnableMultiplayerServersForTitle"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesWriteAttemptedDuringExport)
+            {
+                output = Json::Value(Json::StaticString("WriteAttemptedDuringExport"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMultiplayerServerTitleQuotaCoresExceeded)
+            {
+                output = Json::Value(Json::StaticString("MultiplayerServerTitleQuotaCoresExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAutomationRuleNotFound)
+            {
+                output = Json::Value(Json::StaticString("AutomationRuleNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEntityAPIKeyLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("EntityAPIKeyLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEntityAPIKeyNotFound)
+            {
+                output = Json::Value(Json::StaticString("EntityAPIKeyNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEntityAPIKeyOrSecretInvalid)
+            {
+                output = Json::Value(Json::StaticString("EntityAPIKeyOrSecretInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEconomyServiceUnavailable)
+            {
+                output = Json::Value(Json::StaticString("EconomyServiceUnavailable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEconomyServiceInternalError)
+            {
+                output = Json::Value(Json::StaticString("EconomyServiceInternalError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesQueryRateLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("QueryRateLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEntityAPIKeyCreationDisabledForEntity)
+            {
+                output = Json::Value(Json::StaticString("EntityAPIKeyCreationDisabledForEntity"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesForbiddenByEntityPolicy)
+            {
+                output = Json::Value(Json::StaticString("ForbiddenByEntityPolicy"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesUpdateInventoryRateLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("UpdateInventoryRateLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStudioCreationRateLimited)
+            {
+                output = Json::Value(Json::StaticString("StudioCreationRateLimited"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStudioCreationInProgress)
+            {
+                output = Json::Value(Json::StaticString("StudioCreationInProgress"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDuplicateStudioName)
+            {
+                output = Json::Value(Json::StaticString("DuplicateStudioName"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStudioNotFound)
+            {
+                output = Json::Value(Json::StaticString("StudioNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStudioDeleted)
+            {
+                output = Json::Value(Json::StaticString("StudioDeleted"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStudioDeactivated)
+            {
+                output = Json::Value(Json::StaticString("StudioDeactivated"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStudioActivated)
+            {
+                output = Json::Value(Json::StaticString("StudioActivated"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleCreationRateLimited)
+            {
+                output = Json::Value(Json::StaticString("TitleCreationRateLimited"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleCreationInProgress)
+            {
+                output = Json::Value(Json::StaticString("TitleCreationInProgress"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDuplicateTitleName)
+            {
+                output = Json::Value(Json::StaticString("DuplicateTitleName"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleActivationRateLimited)
+            {
+                output = Json::Value(Json::StaticString("TitleActivationRateLimited"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleActivationInProgress)
+            {
+                output = Json::Value(Json::StaticString("TitleActivationInProgress"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleDeactivated)
+            {
+                output = Json::Value(Json::StaticString("TitleDeactivated"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleActivated)
+            {
+                output = Json::Value(Json::StaticString("TitleActivated"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCloudScriptAzureFunctionsExecutionTimeLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("CloudScriptAzureFunctionsExecutionTimeLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCloudScriptAzureFunctionsArgumentSizeExceeded)
+            {
+                output = Json::Value(Json::StaticString("CloudScriptAzureFunctionsArgumentSizeExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCloudScriptAzureFunctionsReturnSizeExceeded)
+            {
+                output = Json::Value(Json::StaticString("CloudScriptAzureFunctionsReturnSizeExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCloudScriptAzureFunctionsHTTPRequestError)
+            {
+                output = Json::Value(Json::StaticString("CloudScriptAzureFunctionsHTTPRequestError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesVirtualCurrencyBetaGetError)
+            {
+                output = Json::Value(Json::StaticString("VirtualCurrencyBetaGetError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesVirtualCurrencyBetaCreateError)
+            {
+                output = Json::Value(Json::StaticString("VirtualCurrencyBetaCreateError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesVirtualCurrencyBetaInitialDepositSaveError)
+            {
+                output = Json::Value(Json::StaticString("VirtualCurrencyBetaInitialDepositSaveError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesVirtualCurrencyBetaSaveError)
+            {
+                output = Json::Value(Json::StaticString("VirtualCurrencyBetaSaveError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesVirtualCurrencyBetaDeleteError)
+            {
+                output = Json::Value(Json::StaticString("VirtualCurrencyBetaDeleteError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesVirtualCurrencyBetaRestoreError)
+            {
+                output = Json::Value(Json::StaticString("VirtualCurrencyBetaRestoreError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesVirtualCurrencyBetaSaveConflict)
+            {
+                output = Json::Value(Json::StaticString("VirtualCurrencyBetaSaveConflict"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesVirtualCurrencyBetaUpdateError)
+            {
+                output = Json::Value(Json::StaticString("VirtualCurrencyBetaUpdateError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInsightsManagementDatabaseNotFound)
+            {
+                output = Json::Value(Json::StaticString("InsightsManagementDatabaseNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInsightsManagementOperationNotFound)
+            {
+                output = Json::Value(Json::StaticString("InsightsManagementOperationNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInsightsManagementErrorPendingOperationExists)
+            {
+                output = Json::Value(Json::StaticString("InsightsManagementErrorPendingOperationExists"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInsightsManagementSetPerformanceLevelInvalidParameter)
+            {
+                output = Json::Value(Json::StaticString("InsightsManagementSetPerformanceLevelInvalidParameter"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInsightsManagementSetStorageRetentionInvalidParameter)
+            {
+                output = Json::Value(Json::StaticString("InsightsManagementSetStorageRetentionInvalidParameter"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInsightsManagementGetStorageUsageInvalidParameter)
+            {
+                output = Json::Value(Json::StaticString("InsightsManagementGetStorageUsageInvalidParameter"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInsightsManagementGetOperationStatusInvalidParameter)
+            {
+                output = Json::Value(Json::StaticString("InsightsManagementGetOperationStatusInvalidParameter"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDuplicatePurchaseTransactionId)
+            {
+                output = Json::Value(Json::StaticString("DuplicatePurchaseTransactionId"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEvaluationModePlayerCountExceeded)
+            {
+                output = Json::Value(Json::StaticString("EvaluationModePlayerCountExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGetPlayersInSegmentRateLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("GetPlayersInSegmentRateLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCloudScriptFunctionNameSizeExceeded)
+            {
+                output = Json::Value(Json::StaticString("CloudScriptFunctionNameSizeExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInsightsManagementTitleInEvaluationMode)
+            {
+                output = Json::Value(Json::StaticString("InsightsManagementTitleInEvaluationMode"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCloudScriptAzureFunctionsQueueRequestError)
+            {
+                output = Json::Value(Json::StaticString("CloudScriptAzureFunctionsQueueRequestError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEvaluationModeTitleCountExceeded)
+            {
+                output = Json::Value(Json::StaticString("EvaluationModeTitleCountExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInsightsManagementTitleNotInFlight)
+            {
+                output = Json::Value(Json::StaticString("InsightsManagementTitleNotInFlight"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesLimitNotFound)
+            {
+                output = Json::Value(Json::StaticString("LimitNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesLimitNotAvailableViaAPI)
+            {
+                output = Json::Value(Json::StaticString("LimitNotAvailableViaAPI"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInsightsManagementSetStorageRetentionBelowMinimum)
+            {
+                output = Json::Value(Json::StaticString("InsightsManagementSetStorageRetentionBelowMinimum"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInsightsManagementSetStorageRetentionAboveMaximum)
+            {
+                output = Json::Value(Json::StaticString("InsightsManagementSetStorageRetentionAboveMaximum"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAppleNotEnabledForTitle)
+            {
+                output = Json::Value(Json::StaticString("AppleNotEnabledForTitle"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInsightsManagementNewActiveEventExportLimitInvalid)
+            {
+                output = Json::Value(Json::StaticString("InsightsManagementNewActiveEventExportLimitInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInsightsManagementSetPerformanceRateLimited)
+            {
+                output = Json::Value(Json::StaticString("InsightsManagementSetPerformanceRateLimited"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPartyRequestsThrottledFromRateLimiter)
+            {
+                output = Json::Value(Json::StaticString("PartyRequestsThrottledFromRateLimiter"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesXboxServiceTooManyRequests)
+            {
+                output = Json::Value(Json::StaticString("XboxServiceTooManyRequests"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNintendoSwitchNotEnabledForTitle)
+            {
+                output = Json::Value(Json::StaticString("NintendoSwitchNotEnabledForTitle"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesRequestMultiplayerServersThrottledFromRateLimiter)
+            {
+                output = Json::Value(Json::StaticString("RequestMultiplayerServersThrottledFromRateLimiter"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleDataOverrideNotFound)
+            {
+                output = Json::Value(Json::StaticString("TitleDataOverrideNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDuplicateKeys)
+            {
+                output = Json::Value(Json::StaticString("DuplicateKeys"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesWasNotCreatedWithCloudRoot)
+            {
+                output = Json::Value(Json::StaticString("WasNotCreatedWithCloudRoot"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesLegacyMultiplayerServersDeprecated)
+            {
+                output = Json::Value(Json::StaticString("LegacyMultiplayerServersDeprecated"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesVirtualCurrencyCurrentlyUnavailable)
+            {
+                output = Json::Value(Json::StaticString("VirtualCurrencyCurrentlyUnavailable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSteamUserNotFound)
+            {
+                output = Json::Value(Json::StaticString("SteamUserNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesElasticSearchOperationFailed)
+            {
+                output = Json::Value(Json::StaticString("ElasticSearchOperationFailed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingEntityInvalid)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingEntityInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingPlayerAttributesInvalid)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingPlayerAttributesInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingQueueNotFound)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingQueueNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingMatchNotFound)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingMatchNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingTicketNotFound)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingTicketNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingAlreadyJoinedTicket)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingAlreadyJoinedTicket"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingTicketAlreadyCompleted)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingTicketAlreadyCompleted"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingQueueConfigInvalid)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingQueueConfigInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingMemberProfileInvalid)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingMemberProfileInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNintendoSwitchDeviceIdNotLinked)
+            {
+                output = Json::Value(Json::StaticString("NintendoSwitchDeviceIdNotLinked"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingNotEnabled)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingNotEnabled"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingPlayerAttributesTooLarge)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingPlayerAttributesTooLarge"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingNumberOfPlayersInTicketTooLarge)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingNumberOfPlayersInTicketTooLarge"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingAttributeInvalid)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingAttributeInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingPlayerHasNotJoinedTicket)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingPlayerHasNotJoinedTicket"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingRateLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingRateLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingTicketMembershipLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingTicketMembershipLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingUnauthorized)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingUnauthorized"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingQueueLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingQueueLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingRequestTypeMismatch)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingRequestTypeMismatch"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingBadRequest)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingBadRequest"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleConfigNotFound)
+            {
+                output = Json::Value(Json::StaticString("TitleConfigNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleConfigUpdateConflict)
+            {
+                output = Json::Value(Json::StaticString("TitleConfigUpdateConflict"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleConfigSerializationError)
+            {
+                output = Json::Value(Json::StaticString("TitleConfigSerializationError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCatalogApiNotImplemented)
+            {
+                output = Json::Value(Json::StaticString("CatalogApiNotImplemented"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCatalogEntityInvalid)
+            {
+                output = Json::Value(Json::StaticString("CatalogEntityInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCatalogTitleIdMissing)
+            {
+                output = Json::Value(Json::StaticString("CatalogTitleIdMissing"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCatalogPlayerIdMissing)
+            {
+                output = Json::Value(Json::StaticString("CatalogPlayerIdMissing"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCatalogClientIdentityInvalid)
+            {
+                output = Json::Value(Json::StaticString("CatalogClientIdentityInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCatalogOneOrMoreFilesInvalid)
+            {
+                output = Json::Value(Json::StaticString("CatalogOneOrMoreFilesInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCatalogItemMetadataInvalid)
+            {
+                output = Json::Value(Json::StaticString("CatalogItemMetadataInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCatalogItemIdInvalid)
+            {
+                output = Json::Value(Json::StaticString("CatalogItemIdInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCatalogSearchParameterInvalid)
+            {
+                output = Json::Value(Json::StaticString("CatalogSearchParameterInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCatalogFeatureDisabled)
+            {
+                output = Json::Value(Json::StaticString("CatalogFeatureDisabled"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCatalogConfigInvalid)
+            {
+                output = Json::Value(Json::StaticString("CatalogConfigInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCatalogItemTypeInvalid)
+            {
+                output = Json::Value(Json::StaticString("CatalogItemTypeInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCatalogBadRequest)
+            {
+                output = Json::Value(Json::StaticString("CatalogBadRequest"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCatalogTooManyRequests)
+            {
+                output = Json::Value(Json::StaticString("CatalogTooManyRequests"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportInvalidStatusUpdate)
+            {
+                output = Json::Value(Json::StaticString("ExportInvalidStatusUpdate"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportInvalidPrefix)
+            {
+                output = Json::Value(Json::StaticString("ExportInvalidPrefix"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportBlobContainerDoesNotExist)
+            {
+                output = Json::Value(Json::StaticString("ExportBlobContainerDoesNotExist"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportNotFound)
+            {
+                output = Json::Value(Json::StaticString("ExportNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportCouldNotUpdate)
+            {
+                output = Json::Value(Json::StaticString("ExportCouldNotUpdate"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportInvalidStorageType)
+            {
+                output = Json::Value(Json::StaticString("ExportInvalidStorageType"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportAmazonBucketDoesNotExist)
+            {
+                output = Json::Value(Json::StaticString("ExportAmazonBucketDoesNotExist"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportInvalidBlobStorage)
+            {
+                output = Json::Value(Json::StaticString("ExportInvalidBlobStorage"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportKustoException)
+            {
+                output = Json::Value(Json::StaticString("ExportKustoException"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportKustoConnectionFailed)
+            {
+                output = Json::Value(Json::StaticString("ExportKustoConnectionFailed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportUnknownError)
+            {
+                output = Json::Value(Json::StaticString("ExportUnknownError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportCantEditPendingExport)
+            {
+                output = Json::Value(Json::StaticString("ExportCantEditPendingExport"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportLimitExports)
+            {
+                output = Json::Value(Json::StaticString("ExportLimitExports"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportLimitEvents)
+            {
+                output = Json::Value(Json::StaticString("ExportLimitEvents"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportInvalidPartitionStatusModification)
+            {
+                output = Json::Value(Json::StaticString("ExportInvalidPartitionStatusModification"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportCouldNotCreate)
+            {
+                output = Json::Value(Json::StaticString("ExportCouldNotCreate"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportNoBackingDatabaseFound)
+            {
+                output = Json::Value(Json::StaticString("ExportNoBackingDatabaseFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportCouldNotDelete)
+            {
+                output = Json::Value(Json::StaticString("ExportCouldNotDelete"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportCannotDetermineEventQuery)
+            {
+                output = Json::Value(Json::StaticString("ExportCannotDetermineEventQuery"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportInvalidQuerySchemaModification)
+            {
+                output = Json::Value(Json::StaticString("ExportInvalidQuerySchemaModification"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportQuerySchemaMissingRequiredColumns)
+            {
+                output = Json::Value(Json::StaticString("ExportQuerySchemaMissingRequiredColumns"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportCannotParseQuery)
+            {
+                output = Json::Value(Json::StaticString("ExportCannotParseQuery"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportControlCommandsNotAllowed)
+            {
+                output = Json::Value(Json::StaticString("ExportControlCommandsNotAllowed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportQueryMissingTableReference)
+            {
+                output = Json::Value(Json::StaticString("ExportQueryMissingTableReference"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExplorerBasicInvalidQueryName)
+            {
+                output = Json::Value(Json::StaticString("ExplorerBasicInvalidQueryName"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExplorerBasicInvalidQueryDescription)
+            {
+                output = Json::Value(Json::StaticString("ExplorerBasicInvalidQueryDescription"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExplorerBasicInvalidQueryConditions)
+            {
+                output = Json::Value(Json::StaticString("ExplorerBasicInvalidQueryConditions"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExplorerBasicInvalidQueryStartDate)
+            {
+                output = Json::Value(Json::StaticString("ExplorerBasicInvalidQueryStartDate"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExplorerBasicInvalidQueryEndDate)
+            {
+                output = Json::Value(Json::StaticString("ExplorerBasicInvalidQueryEndDate"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExplorerBasicInvalidQueryGroupBy)
+            {
+                output = Json::Value(Json::StaticString("ExplorerBasicInvalidQueryGroupBy"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExplorerBasicInvalidQueryAggregateType)
+            {
+                output = Json::Value(Json::StaticString("ExplorerBasicInvalidQueryAggregateType"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExplorerBasicInvalidQueryAggregateProperty)
+            {
+                output = Json::Value(Json::StaticString("ExplorerBasicInvalidQueryAggregateProperty"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExplorerBasicLoadQueriesError)
+            {
+                output = Json::Value(Json::StaticString("ExplorerBasicLoadQueriesError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExplorerBasicLoadQueryError)
+            {
+                output = Json::Value(Json::StaticString("ExplorerBasicLoadQueryError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExplorerBasicCreateQueryError)
+            {
+                output = Json::Value(Json::StaticString("ExplorerBasicCreateQueryError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExplorerBasicDeleteQueryError)
+            {
+                output = Json::Value(Json::StaticString("ExplorerBasicDeleteQueryError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExplorerBasicUpdateQueryError)
+            {
+                output = Json::Value(Json::StaticString("ExplorerBasicUpdateQueryError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExplorerBasicSavedQueriesLimit)
+            {
+                output = Json::Value(Json::StaticString("ExplorerBasicSavedQueriesLimit"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExplorerBasicSavedQueryNotFound)
+            {
+                output = Json::Value(Json::StaticString("ExplorerBasicSavedQueryNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleNotEnabledForParty)
+            {
+                output = Json::Value(Json::StaticString("TitleNotEnabledForParty"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPartyVersionNotFound)
+            {
+                output = Json::Value(Json::StaticString("PartyVersionNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMultiplayerServerBuildReferencedByMatchmakingQueue)
+            {
+                output = Json::Value(Json::StaticString("MultiplayerServerBuildReferencedByMatchmakingQueue"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationExperimentStopped)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationExperimentStopped"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationExperimentRunning)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationExperimentRunning"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationExperimentNotFound)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationExperimentNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationExperimentNeverStarted)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationExperimentNeverStarted"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationExperimentDeleted)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationExperimentDeleted"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationClientTimeout)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationClientTimeout"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationInvalidVariantConfiguration)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationInvalidVariantConfiguration"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationInvalidVariableConfiguration)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationInvalidVariableConfiguration"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentInvalidId)
+            {
+                output = Json::Value(Json::StaticString("ExperimentInvalidId"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationNoScorecard)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationNoScorecard"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationTreatmentAssignmentFailed)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationTreatmentAssignmentFailed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationTreatmentAssignmentDisabled)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationTreatmentAssignmentDisabled"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationInvalidDuration)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationInvalidDuration"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationMaxExperimentsReached)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationMaxExperimentsReached"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationExperimentSchedulingInProgress)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationExperimentSchedulingInProgress"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationInvalidEndDate)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationInvalidEndDate"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationInvalidStartDate)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationInvalidStartDate"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationMaxDurationExceeded)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationMaxDurationExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationExclusionGroupNotFound)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationExclusionGroupNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationExclusionGroupInsufficientCapacity)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationExclusionGroupInsufficientCapacity"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationExclusionGroupCannotDelete)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationExclusionGroupCannotDelete"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationExclusionGroupInvalidTrafficAllocation)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationExclusionGroupInvalidTrafficAllocation"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationExclusionGroupInvalidName)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationExclusionGroupInvalidName"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMaxActionDepthExceeded)
+            {
+                output = Json::Value(Json::StaticString("MaxActionDepthExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleNotOnUpdatedPricingPlan)
+            {
+                output = Json::Value(Json::StaticString("TitleNotOnUpdatedPricingPlan"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSegmentManagementTitleNotInFlight)
+            {
+                output = Json::Value(Json::StaticString("SegmentManagementTitleNotInFlight"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSegmentManagementNoExpressionTree)
+            {
+                output = Json::Value(Json::StaticString("SegmentManagementNoExpressionTree"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSegmentManagementTriggerActionCountOverLimit)
+            {
+                output = Json::Value(Json::StaticString("SegmentManagementTriggerActionCountOverLimit"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSegmentManagementSegmentCountOverLimit)
+            {
+                output = Json::Value(Json::StaticString("SegmentManagementSegmentCountOverLimit"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSegmentManagementInvalidSegmentId)
+            {
+                output = Json::Value(Json::StaticString("SegmentManagementInvalidSegmentId"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSegmentManagementInvalidInput)
+            {
+                output = Json::Value(Json::StaticString("SegmentManagementInvalidInput"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSegmentManagementInvalidSegmentName)
+            {
+                output = Json::Value(Json::StaticString("SegmentManagementInvalidSegmentName"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDeleteSegmentRateLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("DeleteSegmentRateLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCreateSegmentRateLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("CreateSegmentRateLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesUpdateSegmentRateLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("UpdateSegmentRateLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGetSegmentsRateLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("GetSegmentsRateLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSnapshotNotFound)
+            {
+                output = Json::Value(Json::StaticString("SnapshotNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInventoryApiNotImplemented)
+            {
+                output = Json::Value(Json::StaticString("InventoryApiNotImplemented"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, GenericErrorCodes& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Success")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSuccess;
+                return;
+            }
+            if (inputStr == "UnkownError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesUnkownError;
+                return;
+            }
+            if (inputStr == "InvalidParams")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidParams;
+                return;
+            }
+            if (inputStr == "AccountNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAccountNotFound;
+                return;
+            }
+            if (inputStr == "AccountBanned")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAccountBanned;
+                return;
+            }
+            if (inputStr == "InvalidUsernameOrPassword")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidUsernameOrPassword;
+                return;
+            }
+            if (inputStr == "InvalidTitleId")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidTitleId;
+                return;
+            }
+            if (inputStr == "InvalidEmailAddress")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidEmailAddress;
+                return;
+            }
+            if (inputStr == "EmailAddressNotAvailable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEmailAddressNotAvailable;
+                return;
+            }
+            if (inputStr == "InvalidUsername")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidUsername;
+                return;
+            }
+            if (inputStr == "InvalidPassword")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidPassword;
+                return;
+            }
+            if (inputStr == "UsernameNotAvailable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesUsernameNotAvailable;
+                return;
+            }
+            if (inputStr == "InvalidSteamTicket")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidSteamTicket;
+                return;
+            }
+            if (inputStr == "AccountAlreadyLinked")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAccountAlreadyLinked;
+                return;
+            }
+            if (inputStr == "LinkedAccountAlreadyClaimed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesLinkedAccountAlreadyClaimed;
+                return;
+            }
+            if (inputStr == "InvalidFacebookToken")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidFacebookToken;
+                return;
+            }
+            if (inputStr == "AccountNotLinked")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAccountNotLinked;
+                return;
+            }
+            if (inputStr == "FailedByPaymentProvider")
+            {
+                output = GenericErrorCodes::GenericErrorCodesFailedByPaymentProvider;
+                return;
+            }
+            if (inputStr == "CouponCodeNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCouponCodeNotFound;
+                return;
+            }
+            if (inputStr == "InvalidContainerItem")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidContainerItem;
+                return;
+            }
+            if (inputStr == "ContainerNotOwned")
+            {
+                output = GenericErrorCodes::GenericErrorCodesContainerNotOwned;
+                return;
+            }
+            if (inputStr == "KeyNotOwned")
+            {
+                output = GenericErrorCodes::GenericErrorCodesKeyNotOwned;
+                return;
+            }
+            if (inputStr == "InvalidItemIdInTable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidItemIdInTable;
+                return;
+            }
+            if (inputStr == "InvalidReceipt")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidReceipt;
+                return;
+            }
+            if (inputStr == "ReceiptAlreadyUsed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesReceiptAlreadyUsed;
+                return;
+            }
+            if (inputStr == "ReceiptCancelled")
+            {
+                output = GenericErrorCodes::GenericErrorCodesReceiptCancelled;
+                return;
+            }
+            if (inputStr == "GameNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGameNotFound;
+                return;
+            }
+            if (inputStr == "GameModeNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGameModeNotFound;
+                return;
+            }
+            if (inputStr == "InvalidGoogleToken")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidGoogleToken;
+                return;
+            }
+            if (inputStr == "UserIsNotPartOfDeveloper")
+            {
+                output = GenericErrorCodes::GenericErrorCodesUserIsNotPartOfDeveloper;
+                return;
+            }
+            if (inputStr == "InvalidTitleForDeveloper")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidTitleForDeveloper;
+                return;
+            }
+            if (inputStr == "TitleNameConflicts")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleNameConflicts;
+                return;
+            }
+            if (inputStr == "UserisNotValid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesUserisNotValid;
+                return;
+            }
+            if (inputStr == "ValueAlreadyExists")
+            {
+                output = GenericErrorCodes::GenericErrorCodesValueAlreadyExists;
+                return;
+            }
+            if (inputStr == "BuildNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesBuildNotFound;
+                return;
+            }
+            if (inputStr == "PlayerNotInGame")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPlayerNotInGame;
+                return;
+            }
+            if (inputStr == "InvalidTicket")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidTicket;
+                return;
+            }
+            if (inputStr == "InvalidDeveloper")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidDeveloper;
+                return;
+            }
+            if (inputStr == "InvalidOrderInfo")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidOrderInfo;
+                return;
+            }
+            if (inputStr == "RegistrationIncomplete")
+            {
+                output = GenericErrorCodes::GenericErrorCodesRegistrationIncomplete;
+                return;
+            }
+            if (inputStr == "InvalidPlatform")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidPlatform;
+                return;
+            }
+            if (inputStr == "UnknownError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesUnknownError;
+                return;
+            }
+            if (inputStr == "SteamApplicationNotOwned")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSteamApplicationNotOwned;
+                return;
+            }
+            if (inputStr == "WrongSteamAccount")
+            {
+                output = GenericErrorCodes::GenericErrorCodesWrongSteamAccount;
+                return;
+            }
+            if (inputStr == "TitleNotActivated")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleNotActivated;
+                return;
+            }
+            if (inputStr == "RegistrationSessionNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesRegistrationSessionNotFound;
+                return;
+            }
+            if (inputStr == "NoSuchMod")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNoSuchMod;
+                return;
+            }
+            if (inputStr == "FileNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesFileNotFound;
+                return;
+            }
+            if (inputStr == "DuplicateEmail")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDuplicateEmail;
+                return;
+            }
+            if (inputStr == "ItemNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesItemNotFound;
+                return;
+            }
+            if (inputStr == "ItemNotOwned")
+            {
+                output = GenericErrorCodes::GenericErrorCodesItemNotOwned;
+                return;
+            }
+            if (inputStr == "ItemNotRecycleable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesItemNotRecycleable;
+                return;
+            }
+            if (inputStr == "ItemNotAffordable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesItemNotAffordable;
+                return;
+            }
+            if (inputStr == "InvalidVirtualCurrency")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidVirtualCurrency;
+                return;
+            }
+            if (inputStr == "WrongVirtualCurrency")
+            {
+                output = GenericErrorCodes::GenericErrorCodesWrongVirtualCurrency;
+                return;
+            }
+            if (inputStr == "WrongPrice")
+            {
+                output = GenericErrorCodes::GenericErrorCodesWrongPrice;
+                return;
+            }
+            if (inputStr == "NonPositiveValue")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNonPositiveValue;
+                return;
+            }
+            if (inputStr == "InvalidRegion")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidRegion;
+                return;
+            }
+            if (inputStr == "RegionAtCapacity")
+            {
+                output = GenericErrorCodes::GenericErrorCodesRegionAtCapacity;
+                return;
+            }
+            if (inputStr == "ServerFailedToStart")
+            {
+                output = GenericErrorCodes::GenericErrorCodesServerFailedToStart;
+                return;
+            }
+            if (inputStr == "NameNotAvailable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNameNotAvailable;
+                return;
+            }
+            if (inputStr == "InsufficientFunds")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInsufficientFunds;
+                return;
+            }
+            if (inputStr == "InvalidDeviceID")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidDeviceID;
+                return;
+            }
+            if (inputStr == "InvalidPushNotificationToken")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidPushNotificationToken;
+                return;
+            }
+            if (inputStr == "NoRemainingUses")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNoRemainingUses;
+                return;
+            }
+            if (inputStr == "InvalidPaymentProvider")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidPaymentProvider;
+                return;
+            }
+            if (inputStr == "PurchaseInitializationFailure")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPurchaseInitializationFailure;
+                return;
+            }
+            if (inputStr == "DuplicateUsername")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDuplicateUsername;
+                return;
+            }
+            if (inputStr == "InvalidBuyerInfo")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidBuyerInfo;
+                return;
+            }
+            if (inputStr == "NoGameModeParamsSet")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNoGameModeParamsSet;
+                return;
+            }
+            if (inputStr == "BodyTooLarge")
+            {
+                output = GenericErrorCodes::GenericErrorCodesBodyTooLarge;
+                return;
+            }
+            if (inputStr == "ReservedWordInBody")
+            {
+                output = GenericErrorCodes::GenericErrorCodesReservedWordInBody;
+                return;
+            }
+            if (inputStr == "InvalidTypeInBody")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidTypeInBody;
+                return;
+            }
+            if (inputStr == "InvalidRequest")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidRequest;
+                return;
+            }
+            if (inputStr == "ReservedEventName")
+            {
+                output = GenericErrorCodes::GenericErrorCodesReservedEventName;
+                return;
+            }
+            if (inputStr == "InvalidUserStatistics")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidUserStatistics;
+                return;
+            }
+            if (inputStr == "NotAuthenticated")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNotAuthenticated;
+                return;
+            }
+            if (inputStr == "StreamAlreadyExists")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStreamAlreadyExists;
+                return;
+            }
+            if (inputStr == "ErrorCreatingStream")
+            {
+                output = GenericErrorCodes::GenericErrorCodesErrorCreatingStream;
+                return;
+            }
+            if (inputStr == "StreamNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStreamNotFound;
+                return;
+            }
+            if (inputStr == "InvalidAccount")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidAccount;
+                return;
+            }
+            if (inputStr == "PurchaseDoesNotExist")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPurchaseDoesNotExist;
+                return;
+            }
+            if (inputStr == "InvalidPurchaseTransactionStatus")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidPurchaseTransactionStatus;
+                return;
+            }
+            if (inputStr == "APINotEnabledForGameClientAccess")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAPINotEnabledForGameClientAccess;
+                return;
+            }
+            if (inputStr == "NoPushNotificationARNForTitle")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNoPushNotificationARNForTitle;
+                return;
+            }
+            if (inputStr == "BuildAlreadyExists")
+            {
+                output = GenericErrorCodes::GenericErrorCodesBuildAlreadyExists;
+                return;
+            }
+            if (inputStr == "BuildPackageDoesNotExist")
+            {
+                output = GenericErrorCodes::GenericErrorCodesBuildPackageDoesNotExist;
+                return;
+            }
+            if (inputStr == "CustomAnalyticsEventsNotEnabledForTitle")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCustomAnalyticsEventsNotEnabledForTitle;
+                return;
+            }
+            if (inputStr == "InvalidSharedGroupId")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidSharedGroupId;
+                return;
+            }
+            if (inputStr == "NotAuthorized")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNotAuthorized;
+                return;
+            }
+            if (inputStr == "MissingTitleGoogleProperties")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMissingTitleGoogleProperties;
+                return;
+            }
+            if (inputStr == "InvalidItemProperties")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidItemProperties;
+                return;
+            }
+            if (inputStr == "InvalidPSNAuthCode")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidPSNAuthCode;
+                return;
+            }
+            if (inputStr == "InvalidItemId")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidItemId;
+                return;
+            }
+            if (inputStr == "PushNotEnabledForAccount")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPushNotEnabledForAccount;
+                return;
+            }
+            if (inputStr == "PushServiceError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPushServiceError;
+                return;
+            }
+            if (inputStr == "ReceiptDoesNotContainInAppItems")
+            {
+                output = GenericErrorCodes::GenericErrorCodesReceiptDoesNotContainInAppItems;
+                return;
+            }
+            if (inputStr == "ReceiptContainsMultipleInAppItems")
+            {
+                output = GenericErrorCodes::GenericErrorCodesReceiptContainsMultipleInAppItems;
+                return;
+            }
+            if (inputStr == "InvalidBundleID")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidBundleID;
+                return;
+            }
+            if (inputStr == "JavascriptException")
+            {
+                output = GenericErrorCodes::GenericErrorCodesJavascriptException;
+                return;
+            }
+            if (inputStr == "InvalidSessionTicket")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidSessionTicket;
+                return;
+            }
+            if (inputStr == "UnableToConnectToDatabase")
+            {
+                output = GenericErrorCodes::GenericErrorCodesUnableToConnectToDatabase;
+                return;
+            }
+            if (inputStr == "InternalServerError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInternalServerError;
+                return;
+            }
+            if (inputStr == "InvalidReportDate")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidReportDate;
+                return;
+            }
+            if (inputStr == "ReportNotAvailable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesReportNotAvailable;
+                return;
+            }
+            if (inputStr == "DatabaseThroughputExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDatabaseThroughputExceeded;
+                return;
+            }
+            if (inputStr == "InvalidGameTicket")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidGameTicket;
+                return;
+            }
+            if (inputStr == "ExpiredGameTicket")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExpiredGameTicket;
+                return;
+            }
+            if (inputStr == "GameTicketDoesNotMatchLobby")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGameTicketDoesNotMatchLobby;
+                return;
+            }
+            if (inputStr == "LinkedDeviceAlreadyClaimed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesLinkedDeviceAlreadyClaimed;
+                return;
+            }
+            if (inputStr == "DeviceAlreadyLinked")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDeviceAlreadyLinked;
+                return;
+            }
+            if (inputStr == "DeviceNotLinked")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDeviceNotLinked;
+                return;
+            }
+            if (inputStr == "PartialFailure")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPartialFailure;
+                return;
+            }
+            if (inputStr == "PublisherNotSet")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPublisherNotSet;
+                return;
+            }
+            if (inputStr == "ServiceUnavailable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesServiceUnavailable;
+                return;
+            }
+            if (inputStr == "VersionNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesVersionNotFound;
+                return;
+            }
+            if (inputStr == "RevisionNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesRevisionNotFound;
+                return;
+            }
+            if (inputStr == "InvalidPublisherId")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidPublisherId;
+                return;
+            }
+            if (inputStr == "DownstreamServiceUnavailable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDownstreamServiceUnavailable;
+                return;
+            }
+            if (inputStr == "APINotIncludedInTitleUsageTier")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAPINotIncludedInTitleUsageTier;
+                return;
+            }
+            if (inputStr == "DAULimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDAULimitExceeded;
+                return;
+            }
+            if (inputStr == "APIRequestLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAPIRequestLimitExceeded;
+                return;
+            }
+            if (inputStr == "InvalidAPIEndpoint")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidAPIEndpoint;
+                return;
+            }
+            if (inputStr == "BuildNotAvailable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesBuildNotAvailable;
+                return;
+            }
+            if (inputStr == "ConcurrentEditError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesConcurrentEditError;
+                return;
+            }
+            if (inputStr == "ContentNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesContentNotFound;
+                return;
+            }
+            if (inputStr == "CharacterNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCharacterNotFound;
+                return;
+            }
+            if (inputStr == "CloudScriptNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCloudScriptNotFound;
+                return;
+            }
+            if (inputStr == "ContentQuotaExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesContentQuotaExceeded;
+                return;
+            }
+            if (inputStr == "InvalidCharacterStatistics")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidCharacterStatistics;
+                return;
+            }
+            if (inputStr == "PhotonNotEnabledForTitle")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPhotonNotEnabledForTitle;
+                return;
+            }
+            if (inputStr == "PhotonApplicationNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPhotonApplicationNotFound;
+                return;
+            }
+            if (inputStr == "PhotonApplicationNotAssociatedWithTitle")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPhotonApplicationNotAssociatedWithTitle;
+                return;
+            }
+            if (inputStr == "InvalidEmailOrPassword")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidEmailOrPassword;
+                return;
+            }
+            if (inputStr == "FacebookAPIError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesFacebookAPIError;
+                return;
+            }
+            if (inputStr == "InvalidContentType")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidContentType;
+                return;
+            }
+            if (inputStr == "KeyLengthExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesKeyLengthExceeded;
+                return;
+            }
+            if (inputStr == "DataLengthExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDataLengthExceeded;
+                return;
+            }
+            if (inputStr == "TooManyKeys")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTooManyKeys;
+                return;
+            }
+            if (inputStr == "FreeTierCannotHaveVirtualCurrency")
+            {
+                output = GenericErrorCodes::GenericErrorCodesFreeTierCannotHaveVirtualCurrency;
+                return;
+            }
+            if (inputStr == "MissingAmazonSharedKey")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMissingAmazonSharedKey;
+                return;
+            }
+            if (inputStr == "AmazonValidationError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAmazonValidationError;
+                return;
+            }
+            if (inputStr == "InvalidPSNIssuerId")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidPSNIssuerId;
+                return;
+            }
+            if (inputStr == "PSNInaccessible")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPSNInaccessible;
+                return;
+            }
+            if (inputStr == "ExpiredAuthToken")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExpiredAuthToken;
+                return;
+            }
+            if (inputStr == "FailedToGetEntitlements")
+            {
+                output = GenericErrorCodes::GenericErrorCodesFailedToGetEntitlements;
+                return;
+            }
+            if (inputStr == "FailedToConsumeEntitlement")
+            {
+                output = GenericErrorCodes::GenericErrorCodesFailedToConsumeEntitlement;
+                return;
+            }
+            if (inputStr == "TradeAcceptingUserNotAllowed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeAcceptingUserNotAllowed;
+                return;
+            }
+            if (inputStr == "TradeInventoryItemIsAssignedToCharacter")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeInventoryItemIsAssignedToCharacter;
+                return;
+            }
+            if (inputStr == "TradeInventoryItemIsBundle")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeInventoryItemIsBundle;
+                return;
+            }
+            if (inputStr == "TradeStatusNotValidForCancelling")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeStatusNotValidForCancelling;
+                return;
+            }
+            if (inputStr == "TradeStatusNotValidForAccepting")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeStatusNotValidForAccepting;
+                return;
+            }
+            if (inputStr == "TradeDoesNotExist")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeDoesNotExist;
+                return;
+            }
+            if (inputStr == "TradeCancelled")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeCancelled;
+                return;
+            }
+            if (inputStr == "TradeAlreadyFilled")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeAlreadyFilled;
+                return;
+            }
+            if (inputStr == "TradeWaitForStatusTimeout")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeWaitForStatusTimeout;
+                return;
+            }
+            if (inputStr == "TradeInventoryItemExpired")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeInventoryItemExpired;
+                return;
+            }
+            if (inputStr == "TradeMissingOfferedAndAcceptedItems")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeMissingOfferedAndAcceptedItems;
+                return;
+            }
+            if (inputStr == "TradeAcceptedItemIsBundle")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeAcceptedItemIsBundle;
+                return;
+            }
+            if (inputStr == "TradeAcceptedItemIsStackable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeAcceptedItemIsStackable;
+                return;
+            }
+            if (inputStr == "TradeInventoryItemInvalidStatus")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeInventoryItemInvalidStatus;
+                return;
+            }
+            if (inputStr == "TradeAcceptedCatalogItemInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeAcceptedCatalogItemInvalid;
+                return;
+            }
+            if (inputStr == "TradeAllowedUsersInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeAllowedUsersInvalid;
+                return;
+            }
+            if (inputStr == "TradeInventoryItemDoesNotExist")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeInventoryItemDoesNotExist;
+                return;
+            }
+            if (inputStr == "TradeInventoryItemIsConsumed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeInventoryItemIsConsumed;
+                return;
+            }
+            if (inputStr == "TradeInventoryItemIsStackable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeInventoryItemIsStackable;
+                return;
+            }
+            if (inputStr == "TradeAcceptedItemsMismatch")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeAcceptedItemsMismatch;
+                return;
+            }
+            if (inputStr == "InvalidKongregateToken")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidKongregateToken;
+                return;
+            }
+            if (inputStr == "FeatureNotConfiguredForTitle")
+            {
+                output = GenericErrorCodes::GenericErrorCodesFeatureNotConfiguredForTitle;
+                return;
+            }
+            if (inputStr == "NoMatchingCatalogItemForReceipt")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNoMatchingCatalogItemForReceipt;
+                return;
+            }
+            if (inputStr == "InvalidCurrencyCode")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidCurrencyCode;
+                return;
+            }
+            if (inputStr == "NoRealMoneyPriceForCatalogItem")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNoRealMoneyPriceForCatalogItem;
+                return;
+            }
+            if (inputStr == "TradeInventoryItemIsNotTradable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeInventoryItemIsNotTradable;
+                return;
+            }
+            if (inputStr == "TradeAcceptedCatalogItemIsNotTradable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeAcceptedCatalogItemIsNotTradable;
+                return;
+            }
+            if (inputStr == "UsersAlreadyFriends")
+            {
+                output = GenericErrorCodes::GenericErrorCodesUsersAlreadyFriends;
+                return;
+            }
+            if (inputStr == "LinkedIdentifierAlreadyClaimed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesLinkedIdentifierAlreadyClaimed;
+                return;
+            }
+            if (inputStr == "CustomIdNotLinked")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCustomIdNotLinked;
+                return;
+            }
+            if (inputStr == "TotalDataSizeExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTotalDataSizeExceeded;
+                return;
+            }
+            if (inputStr == "DeleteKeyConflict")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDeleteKeyConflict;
+                return;
+            }
+            if (inputStr == "InvalidXboxLiveToken")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidXboxLiveToken;
+                return;
+            }
+            if (inputStr == "ExpiredXboxLiveToken")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExpiredXboxLiveToken;
+                return;
+            }
+            if (inputStr == "ResettableStatisticVersionRequired")
+            {
+                output = GenericErrorCodes::GenericErrorCodesResettableStatisticVersionRequired;
+                return;
+            }
+            if (inputStr == "NotAuthorizedByTitle")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNotAuthorizedByTitle;
+                return;
+            }
+            if (inputStr == "NoPartnerEnabled")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNoPartnerEnabled;
+                return;
+            }
+            if (inputStr == "InvalidPartnerResponse")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidPartnerResponse;
+                return;
+            }
+            if (inputStr == "APINotEnabledForGameServerAccess")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAPINotEnabledForGameServerAccess;
+                return;
+            }
+            if (inputStr == "StatisticNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStatisticNotFound;
+                return;
+            }
+            if (inputStr == "StatisticNameConflict")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStatisticNameConflict;
+                return;
+            }
+            if (inputStr == "StatisticVersionClosedForWrites")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStatisticVersionClosedForWrites;
+                return;
+            }
+            if (inputStr == "StatisticVersionInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStatisticVersionInvalid;
+                return;
+            }
+            if (inputStr == "APIClientRequestRateLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAPIClientRequestRateLimitExceeded;
+                return;
+            }
+            if (inputStr == "InvalidJSONContent")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidJSONContent;
+                return;
+            }
+            if (inputStr == "InvalidDropTable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidDropTable;
+                return;
+            }
+            if (inputStr == "StatisticVersionAlreadyIncrementedForScheduledInterval")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStatisticVersionAlreadyIncrementedForScheduledInterval;
+                return;
+            }
+            if (inputStr == "StatisticCountLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStatisticCountLimitExceeded;
+                return;
+            }
+            if (inputStr == "StatisticVersionIncrementRateExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStatisticVersionIncrementRateExceeded;
+                return;
+            }
+            if (inputStr == "ContainerKeyInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesContainerKeyInvalid;
+                return;
+            }
+            if (inputStr == "CloudScriptExecutionTimeLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCloudScriptExecutionTimeLimitExceeded;
+                return;
+            }
+            if (inputStr == "NoWritePermissionsForEvent")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNoWritePermissionsForEvent;
+                return;
+            }
+            if (inputStr == "CloudScriptFunctionArgumentSizeExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCloudScriptFunctionArgumentSizeExceeded;
+                return;
+            }
+            if (inputStr == "CloudScriptAPIRequestCountExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCloudScriptAPIRequestCountExceeded;
+                return;
+            }
+            if (inputStr == "CloudScriptAPIRequestError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCloudScriptAPIRequestError;
+                return;
+            }
+            if (inputStr == "CloudScriptHTTPRequestError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCloudScriptHTTPRequestError;
+                return;
+            }
+            if (inputStr == "InsufficientGuildRole")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInsufficientGuildRole;
+                return;
+            }
+            if (inputStr == "GuildNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGuildNotFound;
+                return;
+            }
+            if (inputStr == "OverLimit")
+            {
+                output = GenericErrorCodes::GenericErrorCodesOverLimit;
+                return;
+            }
+            if (inputStr == "EventNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEventNotFound;
+                return;
+            }
+            if (inputStr == "InvalidEventField")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidEventField;
+                return;
+            }
+            if (inputStr == "InvalidEventName")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidEventName;
+                return;
+            }
+            if (inputStr == "CatalogNotConfigured")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCatalogNotConfigured;
+                return;
+            }
+            if (inputStr == "OperationNotSupportedForPlatform")
+            {
+                output = GenericErrorCodes::GenericErrorCodesOperationNotSupportedForPlatform;
+                return;
+            }
+            if (inputStr == "SegmentNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSegmentNotFound;
+                return;
+            }
+            if (inputStr == "StoreNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStoreNotFound;
+                return;
+            }
+            if (inputStr == "InvalidStatisticName")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidStatisticName;
+                return;
+            }
+            if (inputStr == "TitleNotQualifiedForLimit")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleNotQualifiedForLimit;
+                return;
+            }
+            if (inputStr == "InvalidServiceLimitLevel")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidServiceLimitLevel;
+                return;
+            }
+            if (inputStr == "ServiceLimitLevelInTransition")
+            {
+                output = GenericErrorCodes::GenericErrorCodesServiceLimitLevelInTransition;
+                return;
+            }
+            if (inputStr == "CouponAlreadyRedeemed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCouponAlreadyRedeemed;
+                return;
+            }
+            if (inputStr == "GameServerBuildSizeLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGameServerBuildSizeLimitExceeded;
+                return;
+            }
+            if (inputStr == "GameServerBuildCountLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGameServerBuildCountLimitExceeded;
+                return;
+            }
+            if (inputStr == "VirtualCurrencyCountLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesVirtualCurrencyCountLimitExceeded;
+                return;
+            }
+            if (inputStr == "VirtualCurrencyCodeExists")
+            {
+                output = GenericErrorCodes::GenericErrorCodesVirtualCurrencyCodeExists;
+                return;
+            }
+            if (inputStr == "TitleNewsItemCountLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleNewsItemCountLimitExceeded;
+                return;
+            }
+            if (inputStr == "InvalidTwitchToken")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidTwitchToken;
+                return;
+            }
+            if (inputStr == "TwitchResponseError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTwitchResponseError;
+                return;
+            }
+            if (inputStr == "ProfaneDisplayName")
+            {
+                output = GenericErrorCodes::GenericErrorCodesProfaneDisplayName;
+                return;
+            }
+            if (inputStr == "UserAlreadyAdded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesUserAlreadyAdded;
+                return;
+            }
+            if (inputStr == "InvalidVirtualCurrencyCode")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidVirtualCurrencyCode;
+                return;
+            }
+            if (inputStr == "VirtualCurrencyCannotBeDeleted")
+            {
+                output = GenericErrorCodes::GenericErrorCodesVirtualCurrencyCannotBeDeleted;
+                return;
+            }
+            if (inputStr == "IdentifierAlreadyClaimed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesIdentifierAlreadyClaimed;
+                return;
+            }
+            if (inputStr == "IdentifierNotLinked")
+            {
+                output = GenericErrorCodes::GenericErrorCodesIdentifierNotLinked;
+                return;
+            }
+            if (inputStr == "InvalidContinuationToken")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidContinuationToken;
+                return;
+            }
+            if (inputStr == "ExpiredContinuationToken")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExpiredContinuationToken;
+                return;
+            }
+            if (inputStr == "InvalidSegment")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidSegment;
+                return;
+            }
+            if (inputStr == "InvalidSessionId")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidSessionId;
+                return;
+            }
+            if (inputStr == "SessionLogNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSessionLogNotFound;
+                return;
+            }
+            if (inputStr == "InvalidSearchTerm")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidSearchTerm;
+                return;
+            }
+            if (inputStr == "TwoFactorAuthenticationTokenRequired")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTwoFactorAuthenticationTokenRequired;
+                return;
+            }
+            if (inputStr == "GameServerHostCountLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGameServerHostCountLimitExceeded;
+                return;
+            }
+            if (inputStr == "PlayerTagCountLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPlayerTagCountLimitExceeded;
+                return;
+            }
+            if (inputStr == "RequestAlreadyRunning")
+            {
+                output = GenericErrorCodes::GenericErrorCodesRequestAlreadyRunning;
+                return;
+            }
+            if (inputStr == "ActionGroupNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesActionGroupNotFound;
+                return;
+            }
+            if (inputStr == "MaximumSegmentBulkActionJobsRunning")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMaximumSegmentBulkActionJobsRunning;
+                return;
+            }
+            if (inputStr == "NoActionsOnPlayersInSegmentJob")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNoActionsOnPlayersInSegmentJob;
+                return;
+            }
+            if (inputStr == "DuplicateStatisticName")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDuplicateStatisticName;
+                return;
+            }
+            if (inputStr == "ScheduledTaskNameConflict")
+            {
+                output = GenericErrorCodes::GenericErrorCodesScheduledTaskNameConflict;
+                return;
+            }
+            if (inputStr == "ScheduledTaskCreateConflict")
+            {
+                output = GenericErrorCodes::GenericErrorCodesScheduledTaskCreateConflict;
+                return;
+            }
+            if (inputStr == "InvalidScheduledTaskName")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidScheduledTaskName;
+                return;
+            }
+            if (inputStr == "InvalidTaskSchedule")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidTaskSchedule;
+                return;
+            }
+            if (inputStr == "SteamNotEnabledForTitle")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSteamNotEnabledForTitle;
+                return;
+            }
+            if (inputStr == "LimitNotAnUpgradeOption")
+            {
+                output = GenericErrorCodes::GenericErrorCodesLimitNotAnUpgradeOption;
+                return;
+            }
+            if (inputStr == "NoSecretKeyEnabledForCloudScript")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNoSecretKeyEnabledForCloudScript;
+                return;
+            }
+            if (inputStr == "TaskNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTaskNotFound;
+                return;
+            }
+            if (inputStr == "TaskInstanceNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTaskInstanceNotFound;
+                return;
+            }
+            if (inputStr == "InvalidIdentityProviderId")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidIdentityProviderId;
+                return;
+            }
+            if (inputStr == "MisconfiguredIdentityProvider")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMisconfiguredIdentityProvider;
+                return;
+            }
+            if (inputStr == "InvalidScheduledTaskType")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidScheduledTaskType;
+                return;
+            }
+            if (inputStr == "BillingInformationRequired")
+            {
+                output = GenericErrorCodes::GenericErrorCodesBillingInformationRequired;
+                return;
+            }
+            if (inputStr == "LimitedEditionItemUnavailable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesLimitedEditionItemUnavailable;
+                return;
+            }
+            if (inputStr == "InvalidAdPlacementAndReward")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidAdPlacementAndReward;
+                return;
+            }
+            if (inputStr == "AllAdPlacementViewsAlreadyConsumed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAllAdPlacementViewsAlreadyConsumed;
+                return;
+            }
+            if (inputStr == "GoogleOAuthNotConfiguredForTitle")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGoogleOAuthNotConfiguredForTitle;
+                return;
+            }
+            if (inputStr == "GoogleOAuthError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGoogleOAuthError;
+                return;
+            }
+            if (inputStr == "UserNotFriend")
+            {
+                output = GenericErrorCodes::GenericErrorCodesUserNotFriend;
+                return;
+            }
+            if (inputStr == "InvalidSignature")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidSignature;
+                return;
+            }
+            if (inputStr == "InvalidPublicKey")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidPublicKey;
+                return;
+            }
+            if (inputStr == "GoogleOAuthNoIdTokenIncludedInResponse")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGoogleOAuthNoIdTokenIncludedInResponse;
+                return;
+            }
+            if (inputStr == "StatisticUpdateInProgress")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStatisticUpdateInProgress;
+                return;
+            }
+            if (inputStr == "LeaderboardVersionNotAvailable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesLeaderboardVersionNotAvailable;
+                return;
+            }
+            if (inputStr == "StatisticAlreadyHasPrizeTable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStatisticAlreadyHasPrizeTable;
+                return;
+            }
+            if (inputStr == "PrizeTableHasOverlappingRanks")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPrizeTableHasOverlappingRanks;
+                return;
+            }
+            if (inputStr == "PrizeTableHasMissingRanks")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPrizeTableHasMissingRanks;
+                return;
+            }
+            if (inputStr == "PrizeTableRankStartsAtZero")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPrizeTableRankStartsAtZero;
+                return;
+            }
+            if (inputStr == "InvalidStatistic")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidStatistic;
+                return;
+            }
+            if (inputStr == "ExpressionParseFailure")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExpressionParseFailure;
+                return;
+            }
+            if (inputStr == "ExpressionInvokeFailure")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExpressionInvokeFailure;
+                return;
+            }
+            if (inputStr == "ExpressionTooLong")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExpressionTooLong;
+                return;
+            }
+            if (inputStr == "DataUpdateRateExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDataUpdateRateExceeded;
+                return;
+            }
+            if (inputStr == "RestrictedEmailDomain")
+            {
+                output = GenericErrorCodes::GenericErrorCodesRestrictedEmailDomain;
+                return;
+            }
+            if (inputStr == "EncryptionKeyDisabled")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEncryptionKeyDisabled;
+                return;
+            }
+            if (inputStr == "EncryptionKeyMissing")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEncryptionKeyMissing;
+                return;
+            }
+            if (inputStr == "EncryptionKeyBroken")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEncryptionKeyBroken;
+                return;
+            }
+            if (inputStr == "NoSharedSecretKeyConfigured")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNoSharedSecretKeyConfigured;
+                return;
+            }
+            if (inputStr == "SecretKeyNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSecretKeyNotFound;
+                return;
+            }
+            if (inputStr == "PlayerSecretAlreadyConfigured")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPlayerSecretAlreadyConfigured;
+                return;
+            }
+            if (inputStr == "APIRequestsDisabledForTitle")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAPIRequestsDisabledForTitle;
+                return;
+            }
+            if (inputStr == "InvalidSharedSecretKey")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidSharedSecretKey;
+                return;
+            }
+            if (inputStr == "PrizeTableHasNoRanks")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPrizeTableHasNoRanks;
+                return;
+            }
+            if (inputStr == "ProfileDoesNotExist")
+            {
+                output = GenericErrorCodes::GenericErrorCodesProfileDoesNotExist;
+                return;
+            }
+            if (inputStr == "ContentS3OriginBucketNotConfigured")
+            {
+                output = GenericErrorCodes::GenericErrorCodesContentS3OriginBucketNotConfigured;
+                return;
+            }
+            if (inputStr == "InvalidEnvironmentForReceipt")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidEnvironmentForReceipt;
+                return;
+            }
+            if (inputStr == "EncryptedRequestNotAllowed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEncryptedRequestNotAllowed;
+                return;
+            }
+            if (inputStr == "SignedRequestNotAllowed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSignedRequestNotAllowed;
+                return;
+            }
+            if (inputStr == "RequestViewConstraintParamsNotAllowed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesRequestViewConstraintParamsNotAllowed;
+                return;
+            }
+            if (inputStr == "BadPartnerConfiguration")
+            {
+                output = GenericErrorCodes::GenericErrorCodesBadPartnerConfiguration;
+                return;
+            }
+            if (inputStr == "XboxBPCertificateFailure")
+            {
+                output = GenericErrorCodes::GenericErrorCodesXboxBPCertificateFailure;
+                return;
+            }
+            if (inputStr == "XboxXASSExchangeFailure")
+            {
+                output = GenericErrorCodes::GenericErrorCodesXboxXASSExchangeFailure;
+                return;
+            }
+            if (inputStr == "InvalidEntityId")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidEntityId;
+                return;
+            }
+            if (inputStr == "StatisticValueAggregationOverflow")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStatisticValueAggregationOverflow;
+                return;
+            }
+            if (inputStr == "EmailMessageFromAddressIsMissing")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEmailMessageFromAddressIsMissing;
+                return;
+            }
+            if (inputStr == "EmailMessageToAddressIsMissing")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEmailMessageToAddressIsMissing;
+                return;
+            }
+            if (inputStr == "SmtpServerAuthenticationError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSmtpServerAuthenticationError;
+                return;
+            }
+            if (inputStr == "SmtpServerLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSmtpServerLimitExceeded;
+                return;
+            }
+            if (inputStr == "SmtpServerInsufficientStorage")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSmtpServerInsufficientStorage;
+                return;
+            }
+            if (inputStr == "SmtpServerCommunicationError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSmtpServerCommunicationError;
+                return;
+            }
+            if (inputStr == "SmtpServerGeneralFailure")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSmtpServerGeneralFailure;
+                return;
+            }
+            if (inputStr == "EmailClientTimeout")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEmailClientTimeout;
+                return;
+            }
+            if (inputStr == "EmailClientCanceledTask")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEmailClientCanceledTask;
+                return;
+            }
+            if (inputStr == "EmailTemplateMissing")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEmailTemplateMissing;
+                return;
+            }
+            if (inputStr == "InvalidHostForTitleId")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidHostForTitleId;
+                return;
+            }
+            if (inputStr == "EmailConfirmationTokenDoesNotExist")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEmailConfirmationTokenDoesNotExist;
+                return;
+            }
+            if (inputStr == "EmailConfirmationTokenExpired")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEmailConfirmationTokenExpired;
+                return;
+            }
+            if (inputStr == "AccountDeleted")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAccountDeleted;
+                return;
+            }
+            if (inputStr == "PlayerSecretNotConfigured")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPlayerSecretNotConfigured;
+                return;
+            }
+            if (inputStr == "InvalidSignatureTime")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidSignatureTime;
+                return;
+            }
+            if (inputStr == "NoContactEmailAddressFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNoContactEmailAddressFound;
+                return;
+            }
+            if (inputStr == "InvalidAuthToken")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidAuthToken;
+                return;
+            }
+            if (inputStr == "AuthTokenDoesNotExist")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAuthTokenDoesNotExist;
+                return;
+            }
+            if (inputStr == "AuthTokenExpired")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAuthTokenExpired;
+                return;
+            }
+            if (inputStr == "AuthTokenAlreadyUsedToResetPassword")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAuthTokenAlreadyUsedToResetPassword;
+                return;
+            }
+            if (inputStr == "MembershipNameTooLong")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMembershipNameTooLong;
+                return;
+            }
+            if (inputStr == "MembershipNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMembershipNotFound;
+                return;
+            }
+            if (inputStr == "GoogleServiceAccountInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGoogleServiceAccountInvalid;
+                return;
+            }
+            if (inputStr == "GoogleServiceAccountParseFailure")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGoogleServiceAccountParseFailure;
+                return;
+            }
+            if (inputStr == "EntityTokenMissing")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEntityTokenMissing;
+                return;
+            }
+            if (inputStr == "EntityTokenInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEntityTokenInvalid;
+                return;
+            }
+            if (inputStr == "EntityTokenExpired")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEntityTokenExpired;
+                return;
+            }
+            if (inputStr == "EntityTokenRevoked")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEntityTokenRevoked;
+                return;
+            }
+            if (inputStr == "InvalidProductForSubscription")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidProductForSubscription;
+                return;
+            }
+            if (inputStr == "XboxInaccessible")
+            {
+                output = GenericErrorCodes::GenericErrorCodesXboxInaccessible;
+                return;
+            }
+            if (inputStr == "SubscriptionAlreadyTaken")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSubscriptionAlreadyTaken;
+                return;
+            }
+            if (inputStr == "SmtpAddonNotEnabled")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSmtpAddonNotEnabled;
+                return;
+            }
+            if (inputStr == "APIConcurrentRequestLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAPIConcurrentRequestLimitExceeded;
+                return;
+            }
+            if (inputStr == "XboxRejectedXSTSExchangeRequest")
+            {
+                output = GenericErrorCodes::GenericErrorCodesXboxRejectedXSTSExchangeRequest;
+                return;
+            }
+            if (inputStr == "VariableNotDefined")
+            {
+                output = GenericErrorCodes::GenericErrorCodesVariableNotDefined;
+                return;
+            }
+            if (inputStr == "TemplateVersionNotDefined")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTemplateVersionNotDefined;
+                return;
+            }
+            if (inputStr == "FileTooLarge")
+            {
+                output = GenericErrorCodes::GenericErrorCodesFileTooLarge;
+                return;
+            }
+            if (inputStr == "TitleDeleted")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleDeleted;
+                return;
+            }
+            if (inputStr == "TitleContainsUserAccounts")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleContainsUserAccounts;
+                return;
+            }
+            if (inputStr == "TitleDeletionPlayerCleanupFailure")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleDeletionPlayerCleanupFailure;
+                return;
+            }
+            if (inputStr == "EntityFileOperationPending")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEntityFileOperationPending;
+                return;
+            }
+            if (inputStr == "NoEntityFileOperationPending")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNoEntityFileOperationPending;
+                return;
+            }
+            if (inputStr == "EntityProfileVersionMismatch")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEntityProfileVersionMismatch;
+                return;
+            }
+            if (inputStr == "TemplateVersionTooOld")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTemplateVersionTooOld;
+                return;
+            }
+            if (inputStr == "MembershipDefinitionInUse")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMembershipDefinitionInUse;
+                return;
+            }
+            if (inputStr == "PaymentPageNotConfigured")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPaymentPageNotConfigured;
+                return;
+            }
+            if (inputStr == "FailedLoginAttemptRateLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesFailedLoginAttemptRateLimitExceeded;
+                return;
+            }
+            if (inputStr == "EntityBlockedByGroup")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEntityBlockedByGroup;
+                return;
+            }
+            if (inputStr == "RoleDoesNotExist")
+            {
+                output = GenericErrorCodes::GenericErrorCodesRoleDoesNotExist;
+                return;
+            }
+            if (inputStr == "EntityIsAlreadyMember")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEntityIsAlreadyMember;
+                return;
+            }
+            if (inputStr == "DuplicateRoleId")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDuplicateRoleId;
+                return;
+            }
+            if (inputStr == "GroupInvitationNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGroupInvitationNotFound;
+                return;
+            }
+            if (inputStr == "GroupApplicationNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGroupApplicationNotFound;
+                return;
+            }
+            if (inputStr == "OutstandingInvitationAcceptedInstead")
+            {
+                output = GenericErrorCodes::GenericErrorCodesOutstandingInvitationAcceptedInstead;
+                return;
+            }
+            if (inputStr == "OutstandingApplicationAcceptedInstead")
+            {
+                output = GenericErrorCodes::GenericErrorCodesOutstandingApplicationAcceptedInstead;
+                return;
+            }
+            if (inputStr == "RoleIsGroupDefaultMember")
+            {
+                output = GenericErrorCodes::GenericErrorCodesRoleIsGroupDefaultMember;
+                return;
+            }
+            if (inputStr == "RoleIsGroupAdmin")
+            {
+                output = GenericErrorCodes::GenericErrorCodesRoleIsGroupAdmin;
+                return;
+            }
+            if (inputStr == "RoleNameNotAvailable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesRoleNameNotAvailable;
+                return;
+            }
+            if (inputStr == "GroupNameNotAvailable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGroupNameNotAvailable;
+                return;
+            }
+            if (inputStr == "EmailReportAlreadySent")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEmailReportAlreadySent;
+                return;
+            }
+            if (inputStr == "EmailReportRecipientBlacklisted")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEmailReportRecipientBlacklisted;
+                return;
+            }
+            if (inputStr == "EventNamespaceNotAllowed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEventNamespaceNotAllowed;
+                return;
+            }
+            if (inputStr == "EventEntityNotAllowed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEventEntityNotAllowed;
+                return;
+            }
+            if (inputStr == "InvalidEntityType")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidEntityType;
+                return;
+            }
+            if (inputStr == "NullTokenResultFromAad")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNullTokenResultFromAad;
+                return;
+            }
+            if (inputStr == "InvalidTokenResultFromAad")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidTokenResultFromAad;
+                return;
+            }
+            if (inputStr == "NoValidCertificateForAad")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNoValidCertificateForAad;
+                return;
+            }
+            if (inputStr == "InvalidCertificateForAad")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidCertificateForAad;
+                return;
+            }
+            if (inputStr == "DuplicateDropTableId")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDuplicateDropTableId;
+                return;
+            }
+            if (inputStr == "MultiplayerServerError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMultiplayerServerError;
+                return;
+            }
+            if (inputStr == "MultiplayerServerTooManyRequests")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMultiplayerServerTooManyRequests;
+                return;
+            }
+            if (inputStr == "MultiplayerServerNoContent")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMultiplayerServerNoContent;
+                return;
+            }
+            if (inputStr == "MultiplayerServerBadRequest")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMultiplayerServerBadRequest;
+                return;
+            }
+            if (inputStr == "MultiplayerServerUnauthorized")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMultiplayerServerUnauthorized;
+                return;
+            }
+            if (inputStr == "MultiplayerServerForbidden")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMultiplayerServerForbidden;
+                return;
+            }
+            if (inputStr == "MultiplayerServerNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMultiplayerServerNotFound;
+                return;
+            }
+            if (inputStr == "MultiplayerServerConflict")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMultiplayerServerConflict;
+                return;
+            }
+            if (inputStr == "MultiplayerServerInternalServerError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMultiplayerServerInternalServerError;
+                return;
+            }
+            if (inputStr == "MultiplayerServerUnavailable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMultiplayerServerUnavailable;
+                return;
+            }
+            if (inputStr == "ExplicitContentDetected")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExplicitContentDetected;
+                return;
+            }
+            if (inputStr == "PIIContentDetected")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPIIContentDetected;
+                return;
+            }
+            if (inputStr == "InvalidScheduledTaskParameter")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidScheduledTaskParameter;
+                return;
+            }
+            if (inputStr == "PerEntityEventRateLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPerEntityEventRateLimitExceeded;
+                return;
+            }
+            if (inputStr == "TitleDefaultLanguageNotSet")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleDefaultLanguageNotSet;
+                return;
+            }
+            if (inputStr == "EmailTemplateMissingDefaultVersion")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEmailTemplateMissingDefaultVersion;
+                return;
+            }
+            if (inputStr == "FacebookInstantGamesIdNotLinked")
+            {
+                output = GenericErrorCodes::GenericErrorCodesFacebookInstantGamesIdNotLinked;
+                return;
+            }
+            if (inputStr == "InvalidFacebookInstantGamesSignature")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidFacebookInstantGamesSignature;
+                return;
+            }
+            if (inputStr == "FacebookInstantGamesAuthNotConfiguredForTitle")
+            {
+                output = GenericErrorCodes::GenericErrorCodesFacebookInstantGamesAuthNotConfiguredForTitle;
+                return;
+            }
+            if (inputStr == "EntityProfileConstraintValidationFailed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEntityProfileConstraintValidationFailed;
+                return;
+            }
+            if (inputStr == "TelemetryIngestionKeyPending")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTelemetryIngestionKeyPending;
+                return;
+            }
+            if (inputStr == "TelemetryIngestionKeyNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTelemetryIngestionKeyNotFound;
+                return;
+            }
+            if (inputStr == "StatisticChildNameInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStatisticChildNameInvalid;
+                return;
+            }
+            if (inputStr == "DataIntegrityError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDataIntegrityError;
+                return;
+            }
+            if (inputStr == "VirtualCurrencyCannotBeSetToOlderVersion")
+            {
+                output = GenericErrorCodes::GenericErrorCodesVirtualCurrencyCannotBeSetToOlderVersion;
+                return;
+            }
+            if (inputStr == "VirtualCurrencyMustBeWithinIntegerRange")
+            {
+                output = GenericErrorCodes::GenericErrorCodesVirtualCurrencyMustBeWithinIntegerRange;
+                return;
+            }
+            if (inputStr == "EmailTemplateInvalidSyntax")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEmailTemplateInvalidSyntax;
+                return;
+            }
+            if (inputStr == "EmailTemplateMissingCallback")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEmailTemplateMissingCallback;
+                return;
+            }
+            if (inputStr == "PushNotificationTemplateInvalidPayload")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPushNotificationTemplateInvalidPayload;
+                return;
+            }
+            if (inputStr == "InvalidLocalizedPushNotificationLanguage")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidLocalizedPushNotificationLanguage;
+                return;
+            }
+            if (inputStr == "MissingLocalizedPushNotificationMessage")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMissingLocalizedPushNotificationMessage;
+                return;
+            }
+            if (inputStr == "PushNotificationTemplateMissingPlatformPayload")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPushNotificationTemplateMissingPlatformPayload;
+                return;
+            }
+            if (inputStr == "PushNotificationTemplatePayloadContainsInvalidJson")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPushNotificationTemplatePayloadContainsInvalidJson;
+                return;
+            }
+            if (inputStr == "PushNotificationTemplateContainsInvalidIosPayload")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPushNotificationTemplateContainsInvalidIosPayload;
+                return;
+            }
+            if (inputStr == "PushNotificationTemplateContainsInvalidAndroidPayload")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPushNotificationTemplateContainsInvalidAndroidPayload;
+                return;
+            }
+            if (inputStr == "PushNotificationTemplateIosPayloadMissingNotificationBody")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPushNotificationTemplateIosPayloadMissingNotificationBody;
+                return;
+            }
+            if (inputStr == "PushNotificationTemplateAndroidPayloadMissingNotificationBody")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPushNotificationTemplateAndroidPayloadMissingNotificationBody;
+                return;
+            }
+            if (inputStr == "PushNotificationTemplateNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPushNotificationTemplateNotFound;
+                return;
+            }
+            if (inputStr == "PushNotificationTemplateMissingDefaultVersion")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPushNotificationTemplateMissingDefaultVersion;
+                return;
+            }
+            if (inputStr == "PushNotificationTemplateInvalidSyntax")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPushNotificationTemplateInvalidSyntax;
+                return;
+            }
+            if (inputStr == "PushNotificationTemplateNoCustomPayloadForV1")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPushNotificationTemplateNoCustomPayloadForV1;
+                return;
+            }
+            if (inputStr == "NoLeaderboardForStatistic")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNoLeaderboardForStatistic;
+                return;
+            }
+            if (inputStr == "TitleNewsMissingDefaultLanguage")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleNewsMissingDefaultLanguage;
+                return;
+            }
+            if (inputStr == "TitleNewsNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleNewsNotFound;
+                return;
+            }
+            if (inputStr == "TitleNewsDuplicateLanguage")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleNewsDuplicateLanguage;
+                return;
+            }
+            if (inputStr == "TitleNewsMissingTitleOrBody")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleNewsMissingTitleOrBody;
+                return;
+            }
+            if (inputStr == "TitleNewsInvalidLanguage")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleNewsInvalidLanguage;
+                return;
+            }
+            if (inputStr == "EmailRecipientBlacklisted")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEmailRecipientBlacklisted;
+                return;
+            }
+            if (inputStr == "InvalidGameCenterAuthRequest")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidGameCenterAuthRequest;
+                return;
+            }
+            if (inputStr == "GameCenterAuthenticationFailed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGameCenterAuthenticationFailed;
+                return;
+            }
+            if (inputStr == "CannotEnablePartiesForTitle")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCannotEnablePartiesForTitle;
+                return;
+            }
+            if (inputStr == "PartyError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPartyError;
+                return;
+            }
+            if (inputStr == "PartyRequests")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPartyRequests;
+                return;
+            }
+            if (inputStr == "PartyNoContent")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPartyNoContent;
+                return;
+            }
+            if (inputStr == "PartyBadRequest")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPartyBadRequest;
+                return;
+            }
+            if (inputStr == "PartyUnauthorized")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPartyUnauthorized;
+                return;
+            }
+            if (inputStr == "PartyForbidden")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPartyForbidden;
+                return;
+            }
+            if (inputStr == "PartyNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPartyNotFound;
+                return;
+            }
+            if (inputStr == "PartyConflict")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPartyConflict;
+                return;
+            }
+            if (inputStr == "PartyInternalServerError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPartyInternalServerError;
+                return;
+            }
+            if (inputStr == "PartyUnavailable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPartyUnavailable;
+                return;
+            }
+            if (inputStr == "PartyTooManyRequests")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPartyTooManyRequests;
+                return;
+            }
+            if (inputStr == "PushNotificationTemplateMissingName")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPushNotificationTemplateMissingName;
+                return;
+            }
+            if (inputStr == "CannotEnableMultiplayerServersForTitle")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCannotEnableMultiplayerServersForTitle;
+                return;
+            }
+            if (inputStr == "WriteAttemptedDuringExport")
+            {
+                output = GenericErrorCodes::GenericErrorCodesWriteAttemptedDuringExport;
+                return;
+            }
+            if (inputStr == "MultiplayerServerTitleQuotaCoresExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMultiplayerServerTitleQuotaCoresExceeded;
+                return;
+            }
+            if (inputStr == "AutomationRuleNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAutomationRuleNotFound;
+                return;
+            }
+            if (inputStr == "EntityAPIKeyLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEntityAPIKeyLimitExceeded;
+                return;
+            }
+            if (inputStr == "EntityAPIKeyNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEntityAPIKeyNotFound;
+                return;
+            }
+            if (inputStr == "EntityAPIKeyOrSecretInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEntityAPIKeyOrSecretInvalid;
+                return;
+            }
+            if (inputStr == "EconomyServiceUnavailable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEconomyServiceUnavailable;
+                return;
+            }
+            if (inputStr == "EconomyServiceInternalError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEconomyServiceInternalError;
+                return;
+            }
+            if (inputStr == "QueryRateLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesQueryRateLimitExceeded;
+                return;
+            }
+            if (inputStr == "EntityAPIKeyCreationDisabledForEntity")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEntityAPIKeyCreationDisabledForEntity;
+                return;
+            }
+            if (inputStr == "ForbiddenByEntityPolicy")
+            {
+                output = GenericErrorCodes::GenericErrorCodesForbiddenByEntityPolicy;
+                return;
+            }
+            if (inputStr == "UpdateInventoryRateLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesUpdateInventoryRateLimitExceeded;
+                return;
+            }
+            if (inputStr == "StudioCreationRateLimited")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStudioCreationRateLimited;
+                return;
+            }
+            if (inputStr == "StudioCreationInProgress")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStudioCreationInProgress;
+                return;
+            }
+            if (inputStr == "DuplicateStudioName")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDuplicateStudioName;
+                return;
+            }
+            if (inputStr == "StudioNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStudioNotFound;
+                return;
+            }
+            if (inputStr == "StudioDeleted")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStudioDeleted;
+                return;
+            }
+            if (inputStr == "StudioDeactivated")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStudioDeactivated;
+                return;
+            }
+            if (inputStr == "StudioActivated")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStudioActivated;
+                return;
+            }
+            if (inputStr == "TitleCreationRateLimited")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleCreationRateLimited;
+                return;
+            }
+            if (inputStr == "TitleCreationInProgress")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleCreationInProgress;
+                return;
+            }
+            if (inputStr == "DuplicateTitleName")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDuplicateTitleName;
+                return;
+            }
+            if (inputStr == "TitleActivationRateLimited")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleActivationRateLimited;
+                return;
+            }
+            if (inputStr == "TitleActivationInProgress")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleActivationInProgress;
+                return;
+            }
+            if (inputStr == "TitleDeactivated")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleDeactivated;
+                return;
+            }
+            if (inputStr == "TitleActivated")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleActivated;
+                return;
+            }
+            if (inputStr == "CloudScriptAzureFunctionsExecutionTimeLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCloudScriptAzureFunctionsExecutionTimeLimitExceeded;
+                return;
+            }
+            if (inputStr == "CloudScriptAzureFunctionsArgumentSizeExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCloudScriptAzureFunctionsArgumentSizeExceeded;
+                return;
+            }
+            if (inputStr == "CloudScriptAzureFunctionsReturnSizeExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCloudScriptAzureFunctionsReturnSizeExceeded;
+                return;
+            }
+            if (inputStr == "CloudScriptAzureFunctionsHTTPRequestError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCloudScriptAzureFunctionsHTTPRequestError;
+                return;
+            }
+            if (inputStr == "VirtualCurrencyBetaGetError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesVirtualCurrencyBetaGetError;
+                return;
+            }
+            if (inputStr == "VirtualCurrencyBetaCreateError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesVirtualCurrencyBetaCreateError;
+                return;
+            }
+            if (inputStr == "VirtualCurrencyBetaInitialDepositSaveError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesVirtualCurrencyBetaInitialDepositSaveError;
+                return;
+            }
+            if (inputStr == "VirtualCurrencyBetaSaveError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesVirtualCurrencyBetaSaveError;
+                return;
+            }
+            if (inputStr == "VirtualCurrencyBetaDeleteError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesVirtualCurrencyBetaDeleteError;
+                return;
+            }
+            if (inputStr == "VirtualCurrencyBetaRestoreError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesVirtualCurrencyBetaRestoreError;
+                return;
+            }
+            if (inputStr == "VirtualCurrencyBetaSaveConflict")
+            {
+                output = GenericErrorCodes::GenericErrorCodesVirtualCurrencyBetaSaveConflict;
+                return;
+            }
+            if (inputStr == "VirtualCurrencyBetaUpdateError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesVirtualCurrencyBetaUpdateError;
+                return;
+            }
+            if (inputStr == "InsightsManagementDatabaseNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInsightsManagementDatabaseNotFound;
+                return;
+            }
+            if (inputStr == "InsightsManagementOperationNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInsightsManagementOperationNotFound;
+                return;
+            }
+            if (inputStr == "InsightsManagementErrorPendingOperationExists")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInsightsManagementErrorPendingOperationExists;
+                return;
+            }
+            if (inputStr == "InsightsManagementSetPerformanceLevelInvalidParameter")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInsightsManagementSetPerformanceLevelInvalidParameter;
+                return;
+            }
+            if (inputStr == "InsightsManagementSetStorageRetentionInvalidParameter")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInsightsManagementSetStorageRetentionInvalidParameter;
+                return;
+            }
+            if (inputStr == "InsightsManagementGetStorageUsageInvalidParameter")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInsightsManagementGetStorageUsageInvalidParameter;
+                return;
+            }
+            if (inputStr == "InsightsManagementGetOperationStatusInvalidParameter")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInsightsManagementGetOperationStatusInvalidParameter;
+                return;
+            }
+            if (inputStr == "DuplicatePurchaseTransactionId")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDuplicatePurchaseTransactionId;
+                return;
+            }
+            if (inputStr == "EvaluationModePlayerCountExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEvaluationModePlayerCountExceeded;
+                return;
+            }
+            if (inputStr == "GetPlayersInSegmentRateLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGetPlayersInSegmentRateLimitExceeded;
+                return;
+            }
+            if (inputStr == "CloudScriptFunctionNameSizeExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCloudScriptFunctionNameSizeExceeded;
+                return;
+            }
+            if (inputStr == "InsightsManagementTitleInEvaluationMode")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInsightsManagementTitleInEvaluationMode;
+                return;
+            }
+            if (inputStr == "CloudScriptAzureFunctionsQueueRequestError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCloudScriptAzureFunctionsQueueRequestError;
+                return;
+            }
+            if (inputStr == "EvaluationModeTitleCountExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEvaluationModeTitleCountExceeded;
+                return;
+            }
+            if (inputStr == "InsightsManagementTitleNotInFlight")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInsightsManagementTitleNotInFlight;
+                return;
+            }
+            if (inputStr == "LimitNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesLimitNotFound;
+                return;
+            }
+            if (inputStr == "LimitNotAvailableViaAPI")
+            {
+                output = GenericErrorCodes::GenericErrorCodesLimitNotAvailableViaAPI;
+                return;
+            }
+            if (inputStr == "InsightsManagementSetStorageRetentionBelowMinimum")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInsightsManagementSetStorageRetentionBelowMinimum;
+                return;
+            }
+            if (inputStr == "InsightsManagementSetStorageRetentionAboveMaximum")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInsightsManagementSetStorageRetentionAboveMaximum;
+                return;
+            }
+            if (inputStr == "AppleNotEnabledForTitle")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAppleNotEnabledForTitle;
+                return;
+            }
+            if (inputStr == "InsightsManagementNewActiveEventExportLimitInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInsightsManagementNewActiveEventExportLimitInvalid;
+                return;
+            }
+            if (inputStr == "InsightsManagementSetPerformanceRateLimited")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInsightsManagementSetPerformanceRateLimited;
+                return;
+            }
+            if (inputStr == "PartyRequestsThrottledFromRateLimiter")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPartyRequestsThrottledFromRateLimiter;
+                return;
+            }
+            if (inputStr == "XboxServiceTooManyRequests")
+            {
+                output = GenericErrorCodes::GenericErrorCodesXboxServiceTooManyRequests;
+                return;
+            }
+            if (inputStr == "NintendoSwitchNotEnabledForTitle")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNintendoSwitchNotEnabledForTitle;
+                return;
+            }
+            if (inputStr == "RequestMultiplayerServersThrottledFromRateLimiter")
+            {
+                output = GenericErrorCodes::GenericErrorCodesRequestMultiplayerServersThrottledFromRateLimiter;
+                return;
+            }
+            if (inputStr == "TitleDataOverrideNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleDataOverrideNotFound;
+                return;
+            }
+            if (inputStr == "DuplicateKeys")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDuplicateKeys;
+                return;
+            }
+            if (inputStr == "WasNotCreatedWithCloudRoot")
+            {
+                output = GenericErrorCodes::GenericErrorCodesWasNotCreatedWithCloudRoot;
+                return;
+            }
+            if (inputStr == "LegacyMultiplayerServersDeprecated")
+            {
+                output = GenericErrorCodes::GenericErrorCodesLegacyMultiplayerServersDeprecated;
+                return;
+            }
+            if (inputStr == "VirtualCurrencyCurrentlyUnavailable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesVirtualCurrencyCurrentlyUnavailable;
+                return;
+            }
+            if (inputStr == "SteamUserNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSteamUserNotFound;
+                return;
+            }
+            if (inputStr == "ElasticSearchOperationFailed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesElasticSearchOperationFailed;
+                return;
+            }
+            if (inputStr == "MatchmakingEntityInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingEntityInvalid;
+                return;
+            }
+            if (inputStr == "MatchmakingPlayerAttributesInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingPlayerAttributesInvalid;
+                return;
+            }
+            if (inputStr == "MatchmakingQueueNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingQueueNotFound;
+                return;
+            }
+            if (inputStr == "MatchmakingMatchNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingMatchNotFound;
+                return;
+            }
+            if (inputStr == "MatchmakingTicketNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingTicketNotFound;
+                return;
+            }
+            if (inputStr == "MatchmakingAlreadyJoinedTicket")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingAlreadyJoinedTicket;
+                return;
+            }
+            if (inputStr == "MatchmakingTicketAlreadyCompleted")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingTicketAlreadyCompleted;
+                return;
+            }
+            if (inputStr == "MatchmakingQueueConfigInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingQueueConfigInvalid;
+                return;
+            }
+            if (inputStr == "MatchmakingMemberProfileInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingMemberProfileInvalid;
+                return;
+            }
+            if (inputStr == "NintendoSwitchDeviceIdNotLinked")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNintendoSwitchDeviceIdNotLinked;
+                return;
+            }
+            if (inputStr == "MatchmakingNotEnabled")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingNotEnabled;
+                return;
+            }
+            if (inputStr == "MatchmakingPlayerAttributesTooLarge")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingPlayerAttributesTooLarge;
+                return;
+            }
+            if (inputStr == "MatchmakingNumberOfPlayersInTicketTooLarge")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingNumberOfPlayersInTicketTooLarge;
+                return;
+            }
+            if (inputStr == "MatchmakingAttributeInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingAttributeInvalid;
+                return;
+            }
+            if (inputStr == "MatchmakingPlayerHasNotJoinedTicket")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingPlayerHasNotJoinedTicket;
+                return;
+            }
+            if (inputStr == "MatchmakingRateLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingRateLimitExceeded;
+                return;
+            }
+            if (inputStr == "MatchmakingTicketMembershipLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingTicketMembershipLimitExceeded;
+                return;
+            }
+            if (inputStr == "MatchmakingUnauthorized")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingUnauthorized;
+                return;
+            }
+            if (inputStr == "MatchmakingQueueLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingQueueLimitExceeded;
+                return;
+            }
+            if (inputStr == "MatchmakingRequestTypeMismatch")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingRequestTypeMismatch;
+                return;
+            }
+            if (inputStr == "MatchmakingBadRequest")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingBadRequest;
+                return;
+            }
+            if (inputStr == "TitleConfigNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleConfigNotFound;
+                return;
+            }
+            if (inputStr == "TitleConfigUpdateConflict")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleConfigUpdateConflict;
+                return;
+            }
+            if (inputStr == "TitleConfigSerializationError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleConfigSerializationError;
+                return;
+            }
+            if (inputStr == "CatalogApiNotImplemented")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCatalogApiNotImplemented;
+                return;
+            }
+            if (inputStr == "CatalogEntityInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCatalogEntityInvalid;
+                return;
+            }
+            if (inputStr == "CatalogTitleIdMissing")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCatalogTitleIdMissing;
+                return;
+            }
+            if (inputStr == "CatalogPlayerIdMissing")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCatalogPlayerIdMissing;
+                return;
+            }
+            if (inputStr == "CatalogClientIdentityInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCatalogClientIdentityInvalid;
+                return;
+            }
+            if (inputStr == "CatalogOneOrMoreFilesInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCatalogOneOrMoreFilesInvalid;
+                return;
+            }
+            if (inputStr == "CatalogItemMetadataInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCatalogItemMetadataInvalid;
+                return;
+            }
+            if (inputStr == "CatalogItemIdInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCatalogItemIdInvalid;
+                return;
+            }
+            if (inputStr == "CatalogSearchParameterInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCatalogSearchParameterInvalid;
+                return;
+            }
+            if (inputStr == "CatalogFeatureDisabled")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCatalogFeatureDisabled;
+                return;
+            }
+            if (inputStr == "CatalogConfigInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCatalogConfigInvalid;
+                return;
+            }
+            if (inputStr == "CatalogItemTypeInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCatalogItemTypeInvalid;
+                return;
+            }
+            if (inputStr == "CatalogBadRequest")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCatalogBadRequest;
+                return;
+            }
+            if (inputStr == "CatalogTooManyRequests")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCatalogTooManyRequests;
+                return;
+            }
+            if (inputStr == "ExportInvalidStatusUpdate")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportInvalidStatusUpdate;
+                return;
+            }
+            if (inputStr == "ExportInvalidPrefix")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportInvalidPrefix;
+                return;
+            }
+            if (inputStr == "ExportBlobContainerDoesNotExist")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportBlobContainerDoesNotExist;
+                return;
+            }
+            if (inputStr == "ExportNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportNotFound;
+                return;
+            }
+            if (inputStr == "ExportCouldNotUpdate")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportCouldNotUpdate;
+                return;
+            }
+            if (inputStr == "ExportInvalidStorageType")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportInvalidStorageType;
+                return;
+            }
+            if (inputStr == "ExportAmazonBucketDoesNotExist")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportAmazonBucketDoesNotExist;
+                return;
+            }
+            if (inputStr == "ExportInvalidBlobStorage")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportInvalidBlobStorage;
+                return;
+            }
+            if (inputStr == "ExportKustoException")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportKustoException;
+                return;
+            }
+            if (inputStr == "ExportKustoConnectionFailed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportKustoConnectionFailed;
+                return;
+            }
+            if (inputStr == "ExportUnknownError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportUnknownError;
+                return;
+            }
+            if (inputStr == "ExportCantEditPendingExport")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportCantEditPendingExport;
+                return;
+            }
+            if (inputStr == "ExportLimitExports")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportLimitExports;
+                return;
+            }
+            if (inputStr == "ExportLimitEvents")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportLimitEvents;
+                return;
+            }
+            if (inputStr == "ExportInvalidPartitionStatusModification")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportInvalidPartitionStatusModification;
+                return;
+            }
+            if (inputStr == "ExportCouldNotCreate")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportCouldNotCreate;
+                return;
+            }
+            if (inputStr == "ExportNoBackingDatabaseFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportNoBackingDatabaseFound;
+                return;
+            }
+            if (inputStr == "ExportCouldNotDelete")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportCouldNotDelete;
+                return;
+            }
+            if (inputStr == "ExportCannotDetermineEventQuery")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportCannotDetermineEventQuery;
+                return;
+            }
+            if (inputStr == "ExportInvalidQuerySchemaModification")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportInvalidQuerySchemaModification;
+                return;
+            }
+            if (inputStr == "ExportQuerySchemaMissingRequiredColumns")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportQuerySchemaMissingRequiredColumns;
+                return;
+            }
+            if (inputStr == "ExportCannotParseQuery")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportCannotParseQuery;
+                return;
+            }
+            if (inputStr == "ExportControlCommandsNotAllowed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportControlCommandsNotAllowed;
+                return;
+            }
+            if (inputStr == "ExportQueryMissingTableReference")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportQueryMissingTableReference;
+                return;
+            }
+            if (inputStr == "ExplorerBasicInvalidQueryName")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExplorerBasicInvalidQueryName;
+                return;
+            }
+            if (inputStr == "ExplorerBasicInvalidQueryDescription")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExplorerBasicInvalidQueryDescription;
+                return;
+            }
+            if (inputStr == "ExplorerBasicInvalidQueryConditions")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExplorerBasicInvalidQueryConditions;
+                return;
+            }
+            if (inputStr == "ExplorerBasicInvalidQueryStartDate")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExplorerBasicInvalidQueryStartDate;
+                return;
+            }
+            if (inputStr == "ExplorerBasicInvalidQueryEndDate")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExplorerBasicInvalidQueryEndDate;
+                return;
+            }
+            if (inputStr == "ExplorerBasicInvalidQueryGroupBy")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExplorerBasicInvalidQueryGroupBy;
+                return;
+            }
+            if (inputStr == "ExplorerBasicInvalidQueryAggregateType")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExplorerBasicInvalidQueryAggregateType;
+                return;
+            }
+            if (inputStr == "ExplorerBasicInvalidQueryAggregateProperty")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExplorerBasicInvalidQueryAggregateProperty;
+                return;
+            }
+            if (inputStr == "ExplorerBasicLoadQueriesError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExplorerBasicLoadQueriesError;
+                return;
+            }
+            if (inputStr == "ExplorerBasicLoadQueryError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExplorerBasicLoadQueryError;
+                return;
+            }
+            if (inputStr == "ExplorerBasicCreateQueryError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExplorerBasicCreateQueryError;
+                return;
+            }
+            if (inputStr == "ExplorerBasicDeleteQueryError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExplorerBasicDeleteQueryError;
+                return;
+            }
+            if (inputStr == "ExplorerBasicUpdateQueryError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExplorerBasicUpdateQueryError;
+                return;
+            }
+            if (inputStr == "ExplorerBasicSavedQueriesLimit")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExplorerBasicSavedQueriesLimit;
+                return;
+            }
+            if (inputStr == "ExplorerBasicSavedQueryNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExplorerBasicSavedQueryNotFound;
+                return;
+            }
+            if (inputStr == "TitleNotEnabledForParty")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleNotEnabledForParty;
+                return;
+            }
+            if (inputStr == "PartyVersionNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPartyVersionNotFound;
+                return;
+            }
+            if (inputStr == "MultiplayerServerBuildReferencedByMatchmakingQueue")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMultiplayerServerBuildReferencedByMatchmakingQueue;
+                return;
+            }
+            if (inputStr == "ExperimentationExperimentStopped")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationExperimentStopped;
+                return;
+            }
+            if (inputStr == "ExperimentationExperimentRunning")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationExperimentRunning;
+                return;
+            }
+            if (inputStr == "ExperimentationExperimentNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationExperimentNotFound;
+                return;
+            }
+            if (inputStr == "ExperimentationExperimentNeverStarted")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationExperimentNeverStarted;
+                return;
+            }
+            if (inputStr == "ExperimentationExperimentDeleted")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationExperimentDeleted;
+                return;
+            }
+            if (inputStr == "ExperimentationClientTimeout")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationClientTimeout;
+                return;
+            }
+            if (inputStr == "ExperimentationInvalidVariantConfiguration")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationInvalidVariantConfiguration;
+                return;
+            }
+            if (inputStr == "ExperimentationInvalidVariableConfiguration")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationInvalidVariableConfiguration;
+                return;
+            }
+            if (inputStr == "ExperimentInvalidId")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentInvalidId;
+                return;
+            }
+            if (inputStr == "ExperimentationNoScorecard")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationNoScorecard;
+                return;
+            }
+            if (inputStr == "ExperimentationTreatmentAssignmentFailed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationTreatmentAssignmentFailed;
+                return;
+            }
+            if (inputStr == "ExperimentationTreatmentAssignmentDisabled")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationTreatmentAssignmentDisabled;
+                return;
+            }
+            if (inputStr == "ExperimentationInvalidDuration")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationInvalidDuration;
+                return;
+            }
+            if (inputStr == "ExperimentationMaxExperimentsReached")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationMaxExperimentsReached;
+                return;
+            }
+            if (inputStr == "ExperimentationExperimentSchedulingInProgress")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationExperimentSchedulingInProgress;
+                return;
+            }
+            if (inputStr == "ExperimentationInvalidEndDate")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationInvalidEndDate;
+                return;
+            }
+            if (inputStr == "ExperimentationInvalidStartDate")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationInvalidStartDate;
+                return;
+            }
+            if (inputStr == "ExperimentationMaxDurationExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationMaxDurationExceeded;
+                return;
+            }
+            if (inputStr == "ExperimentationExclusionGroupNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationExclusionGroupNotFound;
+                return;
+            }
+            if (inputStr == "ExperimentationExclusionGroupInsufficientCapacity")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationExclusionGroupInsufficientCapacity;
+                return;
+            }
+            if (inputStr == "ExperimentationExclusionGroupCannotDelete")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationExclusionGroupCannotDelete;
+                return;
+            }
+            if (inputStr == "ExperimentationExclusionGroupInvalidTrafficAllocation")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationExclusionGroupInvalidTrafficAllocation;
+                return;
+            }
+            if (inputStr == "ExperimentationExclusionGroupInvalidName")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationExclusionGroupInvalidName;
+                return;
+            }
+            if (inputStr == "MaxActionDepthExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMaxActionDepthExceeded;
+                return;
+            }
+            if (inputStr == "TitleNotOnUpdatedPricingPlan")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleNotOnUpdatedPricingPlan;
+                return;
+            }
+            if (inputStr == "SegmentManagementTitleNotInFlight")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSegmentManagementTitleNotInFlight;
+                return;
+            }
+            if (inputStr == "SegmentManagementNoExpressionTree")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSegmentManagementNoExpressionTree;
+                return;
+            }
+            if (inputStr == "SegmentManagementTriggerActionCountOverLimit")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSegmentManagementTriggerActionCountOverLimit;
+                return;
+            }
+            if (inputStr == "SegmentManagementSegmentCountOverLimit")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSegmentManagementSegmentCountOverLimit;
+                return;
+            }
+            if (inputStr == "SegmentManagementInvalidSegmentId")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSegmentManagementInvalidSegmentId;
+                return;
+            }
+            if (inputStr == "SegmentManagementInvalidInput")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSegmentManagementInvalidInput;
+                return;
+            }
+            if (inputStr == "SegmentManagementInvalidSegmentName")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSegmentManagementInvalidSegmentName;
+                return;
+            }
+            if (inputStr == "DeleteSegmentRateLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDeleteSegmentRateLimitExceeded;
+                return;
+            }
+            if (inputStr == "CreateSegmentRateLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCreateSegmentRateLimitExceeded;
+                return;
+            }
+            if (inputStr == "UpdateSegmentRateLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesUpdateSegmentRateLimitExceeded;
+                return;
+            }
+            if (inputStr == "GetSegmentsRateLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGetSegmentsRateLimitExceeded;
+                return;
+            }
+            if (inputStr == "SnapshotNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSnapshotNotFound;
+                return;
+            }
+            if (inputStr == "InventoryApiNotImplemented")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInventoryApiNotImplemented;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const LoginIdentityProvider input, Json::Value& output)
+        {
+            if (input == LoginIdentityProvider::LoginIdentityProviderUnknown)
+            {
+                output = Json::Value(Json::StaticString("Unknown"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderPlayFab)
+            {
+                output = Json::Value(Json::StaticString("PlayFab"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderCustom)
+            {
+                output = Json::Value(Json::StaticString("Custom"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderGameCenter)
+            {
+                output = Json::Value(Json::StaticString("GameCenter"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderGooglePlay)
+            {
+                output = Json::Value(Json::StaticString("GooglePlay"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderSteam)
+            {
+                output = Json::Value(Json::StaticString("Steam"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderXBoxLive)
+            {
+                output = Json::Value(Json::StaticString("XBoxLive"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderPSN)
+            {
+                output = Json::Value(Json::StaticString("PSN"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderKongregate)
+            {
+                output = Json::Value(Json::StaticString("Kongregate"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderFacebook)
+            {
+                output = Json::Value(Json::StaticString("Facebook"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderIOSDevice)
+            {
+                output = Json::Value(Json::StaticString("IOSDevice"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderAndroidDevice)
+            {
+                output = Json::Value(Json::StaticString("AndroidDevice"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderTwitch)
+            {
+                output = Json::Value(Json::StaticString("Twitch"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderWindowsHello)
+            {
+                output = Json::Value(Json::StaticString("WindowsHello"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderGameServer)
+            {
+                output = Json::Value(Json::StaticString("GameServer"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderCustomServer)
+            {
+                output = Json::Value(Json::StaticString("CustomServer"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderNintendoSwitch)
+            {
+                output = Json::Value(Json::StaticString("NintendoSwitch"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderFacebookInstantGames)
+            {
+                output = Json::Value(Json::StaticString("FacebookInstantGames"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderOpenIdConnect)
+            {
+                output = Json::Value(Json::StaticString("OpenIdConnect"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderApple)
+            {
+                output = Json::Value(Json::StaticString("Apple"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderNintendoSwitchAccount)
+            {
+                output = Json::Value(Json::StaticString("NintendoSwitchAccount"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, LoginIdentityProvider& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Unknown")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderUnknown;
+                return;
+            }
+            if (inputStr == "PlayFab")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderPlayFab;
+                return;
+            }
+            if (inputStr == "Custom")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderCustom;
+                return;
+            }
+            if (inputStr == "GameCenter")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderGameCenter;
+                return;
+            }
+            if (inputStr == "GooglePlay")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderGooglePlay;
+                return;
+            }
+            if (inputStr == "Steam")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderSteam;
+                return;
+            }
+            if (inputStr == "XBoxLive")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderXBoxLive;
+                return;
+            }
+            if (inputStr == "PSN")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderPSN;
+                return;
+            }
+            if (inputStr == "Kongregate")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderKongregate;
+                return;
+            }
+            if (inputStr == "Facebook")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderFacebook;
+                return;
+            }
+            if (inputStr == "IOSDevice")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderIOSDevice;
+                return;
+            }
+            if (inputStr == "AndroidDevice")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderAndroidDevice;
+                return;
+            }
+            if (inputStr == "Twitch")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderTwitch;
+                return;
+            }
+            if (inputStr == "WindowsHello")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderWindowsHello;
+                return;
+            }
+            if (inputStr == "GameServer")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderGameServer;
+                return;
+            }
+            if (inputStr == "CustomServer")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderCustomServer;
+                return;
+            }
+            if (inputStr == "NintendoSwitch")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderNintendoSwitch;
+                return;
+            }
+            if (inputStr == "FacebookInstantGames")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderFacebookInstantGames;
+                return;
+            }
+            if (inputStr == "OpenIdConnect")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderOpenIdConnect;
+                return;
+            }
+            if (inputStr == "Apple")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderApple;
+                return;
+            }
+            if (inputStr == "NintendoSwitchAccount")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderNintendoSwitchAccount;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const PushNotificationPlatform input, Json::Value& output)
+        {
+            if (input == PushNotificationPlatform::PushNotificationPlatformApplePushNotificationService)
+            {
+                output = Json::Value(Json::StaticString("ApplePushNotificationService"));
+                return;
+            }
+            if (input == PushNotificationPlatform::PushNotificationPlatformGoogleCloudMessaging)
+            {
+                output = Json::Value(Json::StaticString("GoogleCloudMessaging"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, PushNotificationPlatform& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "ApplePushNotificationService")
+            {
+                output = PushNotificationPlatform::PushNotificationPlatformApplePushNotificationService;
+                return;
+            }
+            if (inputStr == "GoogleCloudMessaging")
+            {
+                output = PushNotificationPlatform::PushNotificationPlatformGoogleCloudMessaging;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const PushSetupPlatform input, Json::Value& output)
+        {
+            if (input == PushSetupPlatform::PushSetupPlatformGCM)
+            {
+                output = Json::Value(Json::StaticString("GCM"));
+                return;
+            }
+            if (input == PushSetupPlatform::PushSetupPlatformAPNS)
+            {
+                output = Json::Value(Json::StaticString("APNS"));
+                return;
+            }
+            if (input == PushSetupPlatform::PushSetupPlatformAPNS_SANDBOX)
+            {
+                output = Json::Value(Json::StaticString("APNS_SANDBOX"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, PushSetupPlatform& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "GCM")
+            {
+                output = PushSetupPlatform::PushSetupPlatformGCM;
+                return;
+            }
+            if (inputStr == "APNS")
+            {
+                output = PushSetupPlatform::PushSetupPlatformAPNS;
+                return;
+            }
+            if (inputStr == "APNS_SANDBOX")
+            {
+                output = PushSetupPlatform::PushSetupPlatformAPNS_SANDBOX;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const Region input, Json::Value& output)
+        {
+            if (input == Region::RegionUSCentral)
+            {
+                output = Json::Value(Json::StaticString("USCentral"));
+                return;
+            }
+            if (input == Region::RegionUSEast)
+            {
+                output = Json::Value(Json::StaticString("USEast"));
+                return;
+            }
+            if (input == Region::RegionEUWest)
+            {
+                output = Json::Value(Json::StaticString("EUWest"));
+                return;
+            }
+            if (input == Region::RegionSingapore)
+            {
+                output = Json::Value(Json::StaticString("Singapore"));
+                return;
+            }
+            if (input == Region::RegionJapan)
+            {
+                output = Json::Value(Json::StaticString("Japan"));
+                return;
+            }
+            if (input == Region::RegionBrazil)
+            {
+                output = Json::Value(Json::StaticString("Brazil"));
+                return;
+            }
+            if (input == Region::RegionAustralia)
+            {
+                output = Json::Value(Json::StaticString("Australia"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, Region& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "USCentral")
+            {
+                output = Region::RegionUSCentral;
+                return;
+            }
+            if (inputStr == "USEast")
+            {
+                output = Region::RegionUSEast;
+                return;
+            }
+            if (inputStr == "EUWest")
+            {
+                output = Region::RegionEUWest;
+                return;
+            }
+            if (inputStr == "Singapore")
+            {
+                output = Region::RegionSingapore;
+                return;
+            }
+            if (inputStr == "Japan")
+            {
+                output = Region::RegionJapan;
+                return;
+            }
+            if (inputStr == "Brazil")
+            {
+                output = Region::RegionBrazil;
+                return;
+            }
+            if (inputStr == "Australia")
+            {
+                output = Region::RegionAustralia;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const ResolutionOutcome input, Json::Value& output)
+        {
+            if (input == ResolutionOutcome::ResolutionOutcomeRevoke)
+            {
+                output = Json::Value(Json::StaticString("Revoke"));
+                return;
+            }
+            if (input == ResolutionOutcome::ResolutionOutcomeReinstate)
+            {
+                output = Json::Value(Json::StaticString("Reinstate"));
+                return;
+            }
+            if (input == ResolutionOutcome::ResolutionOutcomeManual)
+            {
+                output = Json::Value(Json::StaticString("Manual"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, ResolutionOutcome& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Revoke")
+            {
+                output = ResolutionOutcome::ResolutionOutcomeRevoke;
+                return;
+            }
+            if (inputStr == "Reinstate")
+            {
+                output = ResolutionOutcome::ResolutionOutcomeReinstate;
+                return;
+            }
+            if (inputStr == "Manual")
+            {
+                output = ResolutionOutcome::ResolutionOutcomeManual;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const ResultTableNodeType input, Json::Value& output)
+        {
+            if (input == ResultTableNodeType::ResultTableNodeTypeItemId)
+            {
+                output = Json::Value(Json::StaticString("ItemId"));
+                return;
+            }
+            if (input == ResultTableNodeType::ResultTableNodeTypeTableId)
+            {
+                output = Json::Value(Json::StaticString("TableId"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, ResultTableNodeType& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "ItemId")
+            {
+                output = ResultTableNodeType::ResultTableNodeTypeItemId;
+                return;
+            }
+            if (inputStr == "TableId")
+            {
+                output = ResultTableNodeType::ResultTableNodeTypeTableId;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const ScheduledTaskType input, Json::Value& output)
+        {
+            if (input == ScheduledTaskType::ScheduledTaskTypeCloudScript)
+            {
+                output = Json::Value(Json::StaticString("CloudScript"));
+                return;
+            }
+            if (input == ScheduledTaskType::ScheduledTaskTypeActionsOnPlayerSegment)
+            {
+                output = Json::Value(Json::StaticString("ActionsOnPlayerSegment"));
+                return;
+            }
+            if (input == ScheduledTaskType::ScheduledTaskTypeCloudScriptAzureFunctions)
+            {
+                output = Json::Value(Json::StaticString("CloudScriptAzureFunctions"));
+                return;
+            }
+            if (input == ScheduledTaskType::ScheduledTaskTypeInsightsScheduledScaling)
+            {
+                output = Json::Value(Json::StaticString("InsightsScheduledScaling"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, ScheduledTaskType& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "CloudScript")
+            {
+                output = ScheduledTaskType::ScheduledTaskTypeCloudScript;
+                return;
+            }
+            if (inputStr == "ActionsOnPlayerSegment")
+            {
+                output = ScheduledTaskType::ScheduledTaskTypeActionsOnPlayerSegment;
+                return;
+            }
+            if (inputStr == "CloudScriptAzureFunctions")
+            {
+                output = ScheduledTaskType::ScheduledTaskTypeCloudScriptAzureFunctions;
+                return;
+            }
+            if (inputStr == "InsightsScheduledScaling")
+            {
+                output = ScheduledTaskType::ScheduledTaskTypeInsightsScheduledScaling;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const SegmentCountryCode input, Json::Value& output)
+        {
+            if (input == SegmentCountryCode::SegmentCountryCodeAF)
+            {
+                output = Json::Value(Json::StaticString("AF"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeAX)
+            {
+                output = Json::Value(Json::StaticString("AX"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeAL)
+            {
+                output = Json::Value(Json::StaticString("AL"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeDZ)
+            {
+                output = Json::Value(Json::StaticString("DZ"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeAS)
+            {
+                output = Json::Value(Json::StaticString("AS"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeAD)
+            {
+                output = Json::Value(Json::StaticString("AD"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeAO)
+            {
+                output = Json::Value(Json::StaticString("AO"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeAI)
+            {
+                output = Json::Value(Json::StaticString("AI"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeAQ)
+            {
+                output = Json::Value(Json::StaticString("AQ"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeAG)
+            {
+                output = Json::Value(Json::StaticString("AG"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeAR)
+            {
+                output = Json::Value(Json::StaticString("AR"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeAM)
+            {
+                output = Json::Value(Json::StaticString("AM"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeAW)
+            {
+                output = Json::Value(Json::StaticString("AW"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeAU)
+            {
+                output = Json::Value(Json::StaticString("AU"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeAT)
+            {
+                output = Json::Value(Json::StaticString("AT"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeAZ)
+            {
+                output = Json::Value(Json::StaticString("AZ"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeBS)
+            {
+                output = Json::Value(Json::StaticString("BS"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeBH)
+            {
+                output = Json::Value(Json::StaticString("BH"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeBD)
+            {
+                output = Json::Value(Json::StaticString("BD"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeBB)
+            {
+                output = Json::Value(Json::StaticString("BB"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeBY)
+            {
+                output = Json::Value(Json::StaticString("BY"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeBE)
+            {
+                output = Json::Value(Json::StaticString("BE"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeBZ)
+            {
+                output = Json::Value(Json::StaticString("BZ"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeBJ)
+            {
+                output = Json::Value(Json::StaticString("BJ"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeBM)
+            {
+                output = Json::Value(Json::StaticString("BM"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeBT)
+            {
+                output = Json::Value(Json::StaticString("BT"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeBO)
+            {
+                output = Json::Value(Json::StaticString("BO"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeBQ)
+            {
+                output = Json::Value(Json::StaticString("BQ"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeBA)
+            {
+                output = Json::Value(Json::StaticString("BA"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeBW)
+            {
+                output = Json::Value(Json::StaticString("BW"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeBV)
+            {
+                output = Json::Value(Json::StaticString("BV"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeBR)
+            {
+                output = Json::Value(Json::StaticString("BR"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeIO)
+            {
+                output = Json::Value(Json::StaticString("IO"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeBN)
+            {
+                output = Json::Value(Json::StaticString("BN"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeBG)
+            {
+                output = Json::Value(Json::StaticString("BG"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeBF)
+            {
+                output = Json::Value(Json::StaticString("BF"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeBI)
+            {
+                output = Json::Value(Json::StaticString("BI"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeKH)
+            {
+                output = Json::Value(Json::StaticString("KH"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeCM)
+            {
+                output = Json::Value(Json::StaticString("CM"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeCA)
+            {
+                output = Json::Value(Json::StaticString("CA"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeCV)
+            {
+                output = Json::Value(Json::StaticString("CV"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeKY)
+            {
+                output = Json::Value(Json::StaticString("KY"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeCF)
+            {
+                output = Json::Value(Json::StaticString("CF"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeTD)
+            {
+                output = Json::Value(Json::StaticString("TD"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeCL)
+            {
+                output = Json::Value(Json::StaticString("CL"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeCN)
+            {
+                output = Json::Value(Json::StaticString("CN"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeCX)
+            {
+                output = Json::Value(Json::StaticString("CX"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeCC)
+            {
+                output = Json::Value(Json::StaticString("CC"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeCO)
+            {
+                output = Json::Value(Json::StaticString("CO"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeKM)
+            {
+                output = Json::Value(Json::StaticString("KM"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeCG)
+            {
+                output = Json::Value(Json::StaticString("CG"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeCD)
+            {
+                output = Json::Value(Json::StaticString("CD"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeCK)
+            {
+                output = Json::Value(Json::StaticString("CK"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeCR)
+            {
+                output = Json::Value(Json::StaticString("CR"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeCI)
+            {
+                output = Json::Value(Json::StaticString("CI"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeHR)
+            {
+                output = Json::Value(Json::StaticString("HR"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeCU)
+            {
+                output = Json::Value(Json::StaticString("CU"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeCW)
+            {
+                output = Json::Value(Json::StaticString("CW"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeCY)
+            {
+                output = Json::Value(Json::StaticString("CY"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeCZ)
+            {
+                output = Json::Value(Json::StaticString("CZ"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeDK)
+            {
+                output = Json::Value(Json::StaticString("DK"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeDJ)
+            {
+                output = Json::Value(Json::StaticString("DJ"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeDM)
+            {
+                output = Json::Value(Json::StaticString("DM"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeDO)
+            {
+                output = Json::Value(Json::StaticString("DO"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeEC)
+            {
+                output = Json::Value(Json::StaticString("EC"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeEG)
+            {
+                output = Json::Value(Json::StaticString("EG"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeSV)
+            {
+                output = Json::Value(Json::StaticString("SV"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeGQ)
+            {
+                output = Json::Value(Json::StaticString("GQ"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeER)
+            {
+                output = Json::Value(Json::StaticString("ER"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeEE)
+            {
+                output = Json::Value(Json::StaticString("EE"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeET)
+            {
+                output = Json::Value(Json::StaticString("ET"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeFK)
+            {
+                output = Json::Value(Json::StaticString("FK"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeFO)
+            {
+                output = Json::Value(Json::StaticString("FO"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeFJ)
+            {
+                output = Json::Value(Json::StaticString("FJ"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeFI)
+            {
+                output = Json::Value(Json::StaticString("FI"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeFR)
+            {
+                output = Json::Value(Json::StaticString("FR"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeGF)
+            {
+                output = Json::Value(Json::StaticString("GF"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodePF)
+            {
+                output = Json::Value(Json::StaticString("PF"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeTF)
+            {
+                output = Json::Value(Json::StaticString("TF"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeGA)
+            {
+                output = Json::Value(Json::StaticString("GA"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeGM)
+            {
+                output = Json::Value(Json::StaticString("GM"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeGE)
+            {
+                output = Json::Value(Json::StaticString("GE"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeDE)
+            {
+                output = Json::Value(Json::StaticString("DE"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeGH)
+            {
+                output = Json::Value(Json::StaticString("GH"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeGI)
+            {
+                output = Json::Value(Json::StaticString("GI"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeGR)
+            {
+                output = Json::Value(Json::StaticString("GR"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeGL)
+            {
+                output = Json::Value(Json::StaticString("GL"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeGD)
+            {
+                output = Json::Value(Json::StaticString("GD"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeGP)
+            {
+                output = Json::Value(Json::StaticString("GP"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeGU)
+            {
+                output = Json::Value(Json::StaticString("GU"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeGT)
+            {
+                output = Json::Value(Json::StaticString("GT"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeGG)
+            {
+                output = Json::Value(Json::StaticString("GG"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeGN)
+            {
+                output = Json::Value(Json::StaticString("GN"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeGW)
+            {
+                output = Json::Value(Json::StaticString("GW"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeGY)
+            {
+                output = Json::Value(Json::StaticString("GY"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeHT)
+            {
+                output = Json::Value(Json::StaticString("HT"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeHM)
+            {
+                output = Json::Value(Json::StaticString("HM"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeVA)
+            {
+                output = Json::Value(Json::StaticString("VA"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeHN)
+            {
+                output = Json::Value(Json::StaticString("HN"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeHK)
+            {
+                output = Json::Value(Json::StaticString("HK"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeHU)
+            {
+                output = Json::Value(Json::StaticString("HU"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeIS)
+            {
+                output = Json::Value(Json::StaticString("IS"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeIN)
+            {
+                output = Json::Value(Json::StaticString("IN"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeID)
+            {
+                output = Json::Value(Json::StaticString("ID"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeIR)
+            {
+                output = Json::Value(Json::StaticString("IR"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeIQ)
+            {
+                output = Json::Value(Json::StaticString("IQ"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeIE)
+            {
+                output = Json::Value(Json::StaticString("IE"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeIM)
+            {
+                output = Json::Value(Json::StaticString("IM"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeIL)
+            {
+                output = Json::Value(Json::StaticString("IL"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeIT)
+            {
+                output = Json::Value(Json::StaticString("IT"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeJM)
+            {
+                output = Json::Value(Json::StaticString("JM"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeJP)
+            {
+                output = Json::Value(Json::StaticString("JP"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeJE)
+            {
+                output = Json::Value(Json::StaticString("JE"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeJO)
+            {
+                output = Json::Value(Json::StaticString("JO"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeKZ)
+            {
+                output = Json::Value(Json::StaticString("KZ"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeKE)
+            {
+                output = Json::Value(Json::StaticString("KE"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeKI)
+            {
+                output = Json::Value(Json::StaticString("KI"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeKP)
+            {
+                output = Json::Value(Json::StaticString("KP"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeKR)
+            {
+                output = Json::Value(Json::StaticString("KR"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeKW)
+            {
+                output = Json::Value(Json::StaticString("KW"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeKG)
+            {
+                output = Json::Value(Json::StaticString("KG"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeLA)
+            {
+                output = Json::Value(Json::StaticString("LA"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeLV)
+            {
+                output = Json::Value(Json::StaticString("LV"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeLB)
+            {
+                output = Json::Value(Json::StaticString("LB"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeLS)
+            {
+                output = Json::Value(Json::StaticString("LS"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeLR)
+            {
+                output = Json::Value(Json::StaticString("LR"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeLY)
+            {
+                output = Json::Value(Json::StaticString("LY"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeLI)
+            {
+                output = Json::Value(Json::StaticString("LI"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeLT)
+            {
+                output = Json::Value(Json::StaticString("LT"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeLU)
+            {
+                output = Json::Value(Json::StaticString("LU"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeMO)
+            {
+                output = Json::Value(Json::StaticString("MO"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeMK)
+            {
+                output = Json::Value(Json::StaticString("MK"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeMG)
+            {
+                output = Json::Value(Json::StaticString("MG"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeMW)
+            {
+                output = Json::Value(Json::StaticString("MW"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeMY)
+            {
+                output = Json::Value(Json::StaticString("MY"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeMV)
+            {
+                output = Json::Value(Json::StaticString("MV"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeML)
+            {
+                output = Json::Value(Json::StaticString("ML"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeMT)
+            {
+                output = Json::Value(Json::StaticString("MT"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeMH)
+            {
+                output = Json::Value(Json::StaticString("MH"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeMQ)
+            {
+                output = Json::Value(Json::StaticString("MQ"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeMR)
+            {
+                output = Json::Value(Json::StaticString("MR"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeMU)
+            {
+                output = Json::Value(Json::StaticString("MU"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeYT)
+            {
+                output = Json::Value(Json::StaticString("YT"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeMX)
+            {
+                output = Json::Value(Json::StaticString("MX"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeFM)
+            {
+                output = Json::Value(Json::StaticString("FM"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeMD)
+            {
+                output = Json::Value(Json::StaticString("MD"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeMC)
+            {
+                output = Json::Value(Json::StaticString("MC"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeMN)
+            {
+                output = Json::Value(Json::StaticString("MN"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeME)
+            {
+                output = Json::Value(Json::StaticString("ME"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeMS)
+            {
+                output = Json::Value(Json::StaticString("MS"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeMA)
+            {
+                output = Json::Value(Json::StaticString("MA"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeMZ)
+            {
+                output = Json::Value(Json::StaticString("MZ"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeMM)
+            {
+                output = Json::Value(Json::StaticString("MM"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeNA)
+            {
+                output = Json::Value(Json::StaticString("NA"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeNR)
+            {
+                output = Json::Value(Json::StaticString("NR"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeNP)
+            {
+                output = Json::Value(Json::StaticString("NP"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeNL)
+            {
+                output = Json::Value(Json::StaticString("NL"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeNC)
+            {
+                output = Json::Value(Json::StaticString("NC"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeNZ)
+            {
+                output = Json::Value(Json::StaticString("NZ"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeNI)
+            {
+                output = Json::Value(Json::StaticString("NI"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeNE)
+            {
+                output = Json::Value(Json::StaticString("NE"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeNG)
+            {
+                output = Json::Value(Json::StaticString("NG"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeNU)
+            {
+                output = Json::Value(Json::StaticString("NU"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeNF)
+            {
+                output = Json::Value(Json::StaticString("NF"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeMP)
+            {
+                output = Json::Value(Json::StaticString("MP"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeNO)
+            {
+                output = Json::Value(Json::StaticString("NO"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeOM)
+            {
+                output = Json::Value(Json::StaticString("OM"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodePK)
+            {
+                output = Json::Value(Json::StaticString("PK"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodePW)
+            {
+                output = Json::Value(Json::StaticString("PW"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodePS)
+            {
+                output = Json::Value(Json::StaticString("PS"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodePA)
+            {
+                output = Json::Value(Json::StaticString("PA"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodePG)
+            {
+                output = Json::Value(Json::StaticString("PG"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodePY)
+            {
+                output = Json::Value(Json::StaticString("PY"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodePE)
+            {
+                output = Json::Value(Json::StaticString("PE"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodePH)
+            {
+                output = Json::Value(Json::StaticString("PH"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodePN)
+            {
+                output = Json::Value(Json::StaticString("PN"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodePL)
+            {
+                output = Json::Value(Json::StaticString("PL"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodePT)
+            {
+                output = Json::Value(Json::StaticString("PT"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodePR)
+            {
+                output = Json::Value(Json::StaticString("PR"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeQA)
+            {
+                output = Json::Value(Json::StaticString("QA"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeRE)
+            {
+                output = Json::Value(Json::StaticString("RE"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeRO)
+            {
+                output = Json::Value(Json::StaticString("RO"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeRU)
+            {
+                output = Json::Value(Json::StaticString("RU"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeRW)
+            {
+                output = Json::Value(Json::StaticString("RW"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeBL)
+            {
+                output = Json::Value(Json::StaticString("BL"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeSH)
+            {
+                output = Json::Value(Json::StaticString("SH"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeKN)
+            {
+                output = Json::Value(Json::StaticString("KN"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeLC)
+            {
+                output = Json::Value(Json::StaticString("LC"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeMF)
+            {
+                output = Json::Value(Json::StaticString("MF"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodePM)
+            {
+                output = Json::Value(Json::StaticString("PM"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeVC)
+            {
+                output = Json::Value(Json::StaticString("VC"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeWS)
+            {
+                output = Json::Value(Json::StaticString("WS"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeSM)
+            {
+                output = Json::Value(Json::StaticString("SM"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeST)
+            {
+                output = Json::Value(Json::StaticString("ST"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeSA)
+            {
+                output = Json::Value(Json::StaticString("SA"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeSN)
+            {
+                output = Json::Value(Json::StaticString("SN"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeRS)
+            {
+                output = Json::Value(Json::StaticString("RS"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeSC)
+            {
+                output = Json::Value(Json::StaticString("SC"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeSL)
+            {
+                output = Json::Value(Json::StaticString("SL"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeSG)
+            {
+                output = Json::Value(Json::StaticString("SG"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeSX)
+            {
+                output = Json::Value(Json::StaticString("SX"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeSK)
+            {
+                output = Json::Value(Json::StaticString("SK"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeSI)
+            {
+                output = Json::Value(Json::StaticString("SI"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeSB)
+            {
+                output = Json::Value(Json::StaticString("SB"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeSO)
+            {
+                output = Json::Value(Json::StaticString("SO"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeZA)
+            {
+                output = Json::Value(Json::StaticString("ZA"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeGS)
+            {
+                output = Json::Value(Json::StaticString("GS"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeSS)
+            {
+                output = Json::Value(Json::StaticString("SS"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeES)
+            {
+                output = Json::Value(Json::StaticString("ES"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeLK)
+            {
+                output = Json::Value(Json::StaticString("LK"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeSD)
+            {
+                output = Json::Value(Json::StaticString("SD"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeSR)
+            {
+                output = Json::Value(Json::StaticString("SR"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeSJ)
+            {
+                output = Json::Value(Json::StaticString("SJ"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeSZ)
+            {
+                output = Json::Value(Json::StaticString("SZ"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeSE)
+            {
+                output = Json::Value(Json::StaticString("SE"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeCH)
+            {
+                output = Json::Value(Json::StaticString("CH"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeSY)
+            {
+                output = Json::Value(Json::StaticString("SY"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeTW)
+            {
+                output = Json::Value(Json::StaticString("TW"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeTJ)
+            {
+                output = Json::Value(Json::StaticString("TJ"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeTZ)
+            {
+                output = Json::Value(Json::StaticString("TZ"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeTH)
+            {
+                output = Json::Value(Json::StaticString("TH"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeTL)
+            {
+                output = Json::Value(Json::StaticString("TL"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeTG)
+            {
+                output = Json::Value(Json::StaticString("TG"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeTK)
+            {
+                output = Json::Value(Json::StaticString("TK"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeTO)
+            {
+                output = Json::Value(Json::StaticString("TO"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeTT)
+            {
+                output = Json::Value(Json::StaticString("TT"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeTN)
+            {
+                output = Json::Value(Json::StaticString("TN"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeTR)
+            {
+                output = Json::Value(Json::StaticString("TR"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeTM)
+            {
+                output = Json::Value(Json::StaticString("TM"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeTC)
+            {
+                output = Json::Value(Json::StaticString("TC"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeTV)
+            {
+                output = Json::Value(Json::StaticString("TV"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeUG)
+            {
+                output = Json::Value(Json::StaticString("UG"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeUA)
+            {
+                output = Json::Value(Json::StaticString("UA"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeAE)
+            {
+                output = Json::Value(Json::StaticString("AE"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeGB)
+            {
+                output = Json::Value(Json::StaticString("GB"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeUS)
+            {
+                output = Json::Value(Json::StaticString("US"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeUM)
+            {
+                output = Json::Value(Json::StaticString("UM"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeUY)
+            {
+                output = Json::Value(Json::StaticString("UY"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeUZ)
+            {
+                output = Json::Value(Json::StaticString("UZ"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeVU)
+            {
+                output = Json::Value(Json::StaticString("VU"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeVE)
+            {
+                output = Json::Value(Json::StaticString("VE"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeVN)
+            {
+                output = Json::Value(Json::StaticString("VN"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeVG)
+            {
+                output = Json::Value(Json::StaticString("VG"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeVI)
+            {
+                output = Json::Value(Json::StaticString("VI"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeWF)
+            {
+                output = Json::Value(Json::StaticString("WF"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeEH)
+            {
+                output = Json::Value(Json::StaticString("EH"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeYE)
+            {
+                output = Json::Value(Json::StaticString("YE"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeZM)
+            {
+                output = Json::Value(Json::StaticString("ZM"));
+                return;
+            }
+            if (input == SegmentCountryCode::SegmentCountryCodeZW)
+            {
+                output = Json::Value(Json::StaticString("ZW"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, SegmentCountryCode& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "AF")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeAF;
+                return;
+            }
+            if (inputStr == "AX")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeAX;
+                return;
+            }
+            if (inputStr == "AL")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeAL;
+                return;
+            }
+            if (inputStr == "DZ")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeDZ;
+                return;
+            }
+            if (inputStr == "AS")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeAS;
+                return;
+            }
+            if (inputStr == "AD")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeAD;
+                return;
+            }
+            if (inputStr == "AO")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeAO;
+                return;
+            }
+            if (inputStr == "AI")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeAI;
+                return;
+            }
+            if (inputStr == "AQ")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeAQ;
+                return;
+            }
+            if (inputStr == "AG")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeAG;
+                return;
+            }
+            if (inputStr == "AR")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeAR;
+                return;
+            }
+            if (inputStr == "AM")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeAM;
+                return;
+            }
+            if (inputStr == "AW")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeAW;
+                return;
+            }
+            if (inputStr == "AU")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeAU;
+                return;
+            }
+            if (inputStr == "AT")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeAT;
+                return;
+            }
+            if (inputStr == "AZ")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeAZ;
+                return;
+            }
+            if (inputStr == "BS")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeBS;
+                return;
+            }
+            if (inputStr == "BH")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeBH;
+                return;
+            }
+            if (inputStr == "BD")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeBD;
+                return;
+            }
+            if (inputStr == "BB")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeBB;
+                return;
+            }
+            if (inputStr == "BY")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeBY;
+                return;
+            }
+            if (inputStr == "BE")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeBE;
+                return;
+            }
+            if (inputStr == "BZ")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeBZ;
+                return;
+            }
+            if (inputStr == "BJ")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeBJ;
+                return;
+            }
+            if (inputStr == "BM")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeBM;
+                return;
+            }
+            if (inputStr == "BT")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeBT;
+                return;
+            }
+            if (inputStr == "BO")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeBO;
+                return;
+            }
+            if (inputStr == "BQ")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeBQ;
+                return;
+            }
+            if (inputStr == "BA")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeBA;
+                return;
+            }
+            if (inputStr == "BW")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeBW;
+                return;
+            }
+            if (inputStr == "BV")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeBV;
+                return;
+            }
+            if (inputStr == "BR")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeBR;
+                return;
+            }
+            if (inputStr == "IO")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeIO;
+                return;
+            }
+            if (inputStr == "BN")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeBN;
+                return;
+            }
+            if (inputStr == "BG")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeBG;
+                return;
+            }
+            if (inputStr == "BF")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeBF;
+                return;
+            }
+            if (inputStr == "BI")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeBI;
+                return;
+            }
+            if (inputStr == "KH")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeKH;
+                return;
+            }
+            if (inputStr == "CM")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeCM;
+                return;
+            }
+            if (inputStr == "CA")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeCA;
+                return;
+            }
+            if (inputStr == "CV")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeCV;
+                return;
+            }
+            if (inputStr == "KY")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeKY;
+                return;
+            }
+            if (inputStr == "CF")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeCF;
+                return;
+            }
+            if (inputStr == "TD")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeTD;
+                return;
+            }
+            if (inputStr == "CL")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeCL;
+                return;
+            }
+            if (inputStr == "CN")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeCN;
+                return;
+            }
+            if (inputStr == "CX")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeCX;
+                return;
+            }
+            if (inputStr == "CC")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeCC;
+                return;
+            }
+            if (inputStr == "CO")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeCO;
+                return;
+            }
+            if (inputStr == "KM")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeKM;
+                return;
+            }
+            if (inputStr == "CG")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeCG;
+                return;
+            }
+            if (inputStr == "CD")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeCD;
+                return;
+            }
+            if (inputStr == "CK")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeCK;
+                return;
+            }
+            if (inputStr == "CR")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeCR;
+                return;
+            }
+            if (inputStr == "CI")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeCI;
+                return;
+            }
+            if (inputStr == "HR")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeHR;
+                return;
+            }
+            if (inputStr == "CU")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeCU;
+                return;
+            }
+            if (inputStr == "CW")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeCW;
+                return;
+            }
+            if (inputStr == "CY")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeCY;
+                return;
+            }
+            if (inputStr == "CZ")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeCZ;
+                return;
+            }
+            if (inputStr == "DK")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeDK;
+                return;
+            }
+            if (inputStr == "DJ")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeDJ;
+                return;
+            }
+            if (inputStr == "DM")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeDM;
+                return;
+            }
+            if (inputStr == "DO")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeDO;
+                return;
+            }
+            if (inputStr == "EC")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeEC;
+                return;
+            }
+            if (inputStr == "EG")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeEG;
+                return;
+            }
+            if (inputStr == "SV")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeSV;
+                return;
+            }
+            if (inputStr == "GQ")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeGQ;
+                return;
+            }
+            if (inputStr == "ER")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeER;
+                return;
+            }
+            if (inputStr == "EE")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeEE;
+                return;
+            }
+            if (inputStr == "ET")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeET;
+                return;
+            }
+            if (inputStr == "FK")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeFK;
+                return;
+            }
+            if (inputStr == "FO")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeFO;
+                return;
+            }
+            if (inputStr == "FJ")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeFJ;
+                return;
+            }
+            if (inputStr == "FI")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeFI;
+                return;
+            }
+            if (inputStr == "FR")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeFR;
+                return;
+            }
+            if (inputStr == "GF")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeGF;
+                return;
+            }
+            if (inputStr == "PF")
+            {
+                output = SegmentCountryCode::SegmentCountryCodePF;
+                return;
+            }
+            if (inputStr == "TF")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeTF;
+                return;
+            }
+            if (inputStr == "GA")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeGA;
+                return;
+            }
+            if (inputStr == "GM")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeGM;
+                return;
+            }
+            if (inputStr == "GE")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeGE;
+                return;
+            }
+            if (inputStr == "DE")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeDE;
+                return;
+            }
+            if (inputStr == "GH")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeGH;
+                return;
+            }
+            if (inputStr == "GI")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeGI;
+                return;
+            }
+            if (inputStr == "GR")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeGR;
+                return;
+            }
+            if (inputStr == "GL")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeGL;
+                return;
+            }
+            if (inputStr == "GD")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeGD;
+                return;
+            }
+            if (inputStr == "GP")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeGP;
+                return;
+            }
+            if (inputStr == "GU")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeGU;
+                return;
+            }
+            if (inputStr == "GT")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeGT;
+                return;
+            }
+            if (inputStr == "GG")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeGG;
+                return;
+            }
+            if (inputStr == "GN")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeGN;
+                return;
+            }
+            if (inputStr == "GW")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeGW;
+                return;
+            }
+            if (inputStr == "GY")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeGY;
+                return;
+            }
+            if (inputStr == "HT")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeHT;
+                return;
+            }
+            if (inputStr == "HM")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeHM;
+                return;
+            }
+            if (inputStr == "VA")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeVA;
+                return;
+            }
+            if (inputStr == "HN")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeHN;
+                return;
+            }
+            if (inputStr == "HK")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeHK;
+                return;
+            }
+            if (inputStr == "HU")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeHU;
+                return;
+            }
+            if (inputStr == "IS")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeIS;
+                return;
+            }
+            if (inputStr == "IN")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeIN;
+                return;
+            }
+            if (inputStr == "ID")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeID;
+                return;
+            }
+            if (inputStr == "IR")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeIR;
+                return;
+            }
+            if (inputStr == "IQ")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeIQ;
+                return;
+            }
+            if (inputStr == "IE")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeIE;
+                return;
+            }
+            if (inputStr == "IM")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeIM;
+                return;
+            }
+            if (inputStr == "IL")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeIL;
+                return;
+            }
+            if (inputStr == "IT")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeIT;
+                return;
+            }
+            if (inputStr == "JM")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeJM;
+                return;
+            }
+            if (inputStr == "JP")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeJP;
+                return;
+            }
+            if (inputStr == "JE")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeJE;
+                return;
+            }
+            if (inputStr == "JO")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeJO;
+                return;
+            }
+            if (inputStr == "KZ")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeKZ;
+                return;
+            }
+            if (inputStr == "KE")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeKE;
+                return;
+            }
+            if (inputStr == "KI")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeKI;
+                return;
+            }
+            if (inputStr == "KP")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeKP;
+                return;
+            }
+            if (inputStr == "KR")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeKR;
+                return;
+            }
+            if (inputStr == "KW")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeKW;
+                return;
+            }
+            if (inputStr == "KG")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeKG;
+                return;
+            }
+            if (inputStr == "LA")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeLA;
+                return;
+            }
+            if (inputStr == "LV")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeLV;
+                return;
+            }
+            if (inputStr == "LB")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeLB;
+                return;
+            }
+            if (inputStr == "LS")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeLS;
+                return;
+            }
+            if (inputStr == "LR")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeLR;
+                return;
+            }
+            if (inputStr == "LY")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeLY;
+                return;
+            }
+            if (inputStr == "LI")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeLI;
+                return;
+            }
+            if (inputStr == "LT")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeLT;
+                return;
+            }
+            if (inputStr == "LU")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeLU;
+                return;
+            }
+            if (inputStr == "MO")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeMO;
+                return;
+            }
+            if (inputStr == "MK")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeMK;
+                return;
+            }
+            if (inputStr == "MG")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeMG;
+                return;
+            }
+            if (inputStr == "MW")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeMW;
+                return;
+            }
+            if (inputStr == "MY")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeMY;
+                return;
+            }
+            if (inputStr == "MV")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeMV;
+                return;
+            }
+            if (inputStr == "ML")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeML;
+                return;
+            }
+            if (inputStr == "MT")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeMT;
+                return;
+            }
+            if (inputStr == "MH")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeMH;
+                return;
+            }
+            if (inputStr == "MQ")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeMQ;
+                return;
+            }
+            if (inputStr == "MR")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeMR;
+                return;
+            }
+            if (inputStr == "MU")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeMU;
+                return;
+            }
+            if (inputStr == "YT")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeYT;
+                return;
+            }
+            if (inputStr == "MX")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeMX;
+                return;
+            }
+            if (inputStr == "FM")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeFM;
+                return;
+            }
+            if (inputStr == "MD")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeMD;
+                return;
+            }
+            if (inputStr == "MC")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeMC;
+                return;
+            }
+            if (inputStr == "MN")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeMN;
+                return;
+            }
+            if (inputStr == "ME")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeME;
+                return;
+            }
+            if (inputStr == "MS")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeMS;
+                return;
+            }
+            if (inputStr == "MA")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeMA;
+                return;
+            }
+            if (inputStr == "MZ")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeMZ;
+                return;
+            }
+            if (inputStr == "MM")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeMM;
+                return;
+            }
+            if (inputStr == "NA")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeNA;
+                return;
+            }
+            if (inputStr == "NR")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeNR;
+                return;
+            }
+            if (inputStr == "NP")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeNP;
+                return;
+            }
+            if (inputStr == "NL")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeNL;
+                return;
+            }
+            if (inputStr == "NC")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeNC;
+                return;
+            }
+            if (inputStr == "NZ")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeNZ;
+                return;
+            }
+            if (inputStr == "NI")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeNI;
+                return;
+            }
+            if (inputStr == "NE")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeNE;
+                return;
+            }
+            if (inputStr == "NG")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeNG;
+                return;
+            }
+            if (inputStr == "NU")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeNU;
+                return;
+            }
+            if (inputStr == "NF")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeNF;
+                return;
+            }
+            if (inputStr == "MP")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeMP;
+                return;
+            }
+            if (inputStr == "NO")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeNO;
+                return;
+            }
+            if (inputStr == "OM")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeOM;
+                return;
+            }
+            if (inputStr == "PK")
+            {
+                output = SegmentCountryCode::SegmentCountryCodePK;
+                return;
+            }
+            if (inputStr == "PW")
+            {
+                output = SegmentCountryCode::SegmentCountryCodePW;
+                return;
+            }
+            if (inputStr == "PS")
+            {
+                output = SegmentCountryCode::SegmentCountryCodePS;
+                return;
+            }
+            if (inputStr == "PA")
+            {
+                output = SegmentCountryCode::SegmentCountryCodePA;
+                return;
+            }
+            if (inputStr == "PG")
+            {
+                output = SegmentCountryCode::SegmentCountryCodePG;
+                return;
+            }
+            if (inputStr == "PY")
+            {
+                output = SegmentCountryCode::SegmentCountryCodePY;
+                return;
+            }
+            if (inputStr == "PE")
+            {
+                output = SegmentCountryCode::SegmentCountryCodePE;
+                return;
+            }
+            if (inputStr == "PH")
+            {
+                output = SegmentCountryCode::SegmentCountryCodePH;
+                return;
+            }
+            if (inputStr == "PN")
+            {
+                output = SegmentCountryCode::SegmentCountryCodePN;
+                return;
+            }
+            if (inputStr == "PL")
+            {
+                output = SegmentCountryCode::SegmentCountryCodePL;
+                return;
+            }
+            if (inputStr == "PT")
+            {
+                output = SegmentCountryCode::SegmentCountryCodePT;
+                return;
+            }
+            if (inputStr == "PR")
+            {
+                output = SegmentCountryCode::SegmentCountryCodePR;
+                return;
+            }
+            if (inputStr == "QA")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeQA;
+                return;
+            }
+            if (inputStr == "RE")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeRE;
+                return;
+            }
+            if (inputStr == "RO")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeRO;
+                return;
+            }
+            if (inputStr == "RU")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeRU;
+                return;
+            }
+            if (inputStr == "RW")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeRW;
+                return;
+            }
+            if (inputStr == "BL")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeBL;
+                return;
+            }
+            if (inputStr == "SH")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeSH;
+                return;
+            }
+            if (inputStr == "KN")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeKN;
+                return;
+            }
+            if (inputStr == "LC")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeLC;
+                return;
+            }
+            if (inputStr == "MF")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeMF;
+                return;
+            }
+            if (inputStr == "PM")
+            {
+                output = SegmentCountryCode::SegmentCountryCodePM;
+                return;
+            }
+            if (inputStr == "VC")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeVC;
+                return;
+            }
+            if (inputStr == "WS")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeWS;
+                return;
+            }
+            if (inputStr == "SM")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeSM;
+                return;
+            }
+            if (inputStr == "ST")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeST;
+                return;
+            }
+            if (inputStr == "SA")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeSA;
+                return;
+            }
+            if (inputStr == "SN")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeSN;
+                return;
+            }
+            if (inputStr == "RS")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeRS;
+                return;
+            }
+            if (inputStr == "SC")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeSC;
+                return;
+            }
+            if (inputStr == "SL")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeSL;
+                return;
+            }
+            if (inputStr == "SG")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeSG;
+                return;
+            }
+            if (inputStr == "SX")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeSX;
+                return;
+            }
+            if (inputStr == "SK")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeSK;
+                return;
+            }
+            if (inputStr == "SI")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeSI;
+                return;
+            }
+            if (inputStr == "SB")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeSB;
+                return;
+            }
+            if (inputStr == "SO")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeSO;
+                return;
+            }
+            if (inputStr == "ZA")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeZA;
+                return;
+            }
+            if (inputStr == "GS")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeGS;
+                return;
+            }
+            if (inputStr == "SS")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeSS;
+                return;
+            }
+            if (inputStr == "ES")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeES;
+                return;
+            }
+            if (inputStr == "LK")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeLK;
+                return;
+            }
+            if (inputStr == "SD")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeSD;
+                return;
+            }
+            if (inputStr == "SR")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeSR;
+                return;
+            }
+            if (inputStr == "SJ")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeSJ;
+                return;
+            }
+            if (inputStr == "SZ")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeSZ;
+                return;
+            }
+            if (inputStr == "SE")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeSE;
+                return;
+            }
+            if (inputStr == "CH")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeCH;
+                return;
+            }
+            if (inputStr == "SY")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeSY;
+                return;
+            }
+            if (inputStr == "TW")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeTW;
+                return;
+            }
+            if (inputStr == "TJ")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeTJ;
+                return;
+            }
+            if (inputStr == "TZ")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeTZ;
+                return;
+            }
+            if (inputStr == "TH")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeTH;
+                return;
+            }
+            if (inputStr == "TL")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeTL;
+                return;
+            }
+            if (inputStr == "TG")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeTG;
+                return;
+            }
+            if (inputStr == "TK")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeTK;
+                return;
+            }
+            if (inputStr == "TO")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeTO;
+                return;
+            }
+            if (inputStr == "TT")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeTT;
+                return;
+            }
+            if (inputStr == "TN")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeTN;
+                return;
+            }
+            if (inputStr == "TR")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeTR;
+                return;
+            }
+            if (inputStr == "TM")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeTM;
+                return;
+            }
+            if (inputStr == "TC")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeTC;
+                return;
+            }
+            if (inputStr == "TV")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeTV;
+                return;
+            }
+            if (inputStr == "UG")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeUG;
+                return;
+            }
+            if (inputStr == "UA")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeUA;
+                return;
+            }
+            if (inputStr == "AE")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeAE;
+                return;
+            }
+            if (inputStr == "GB")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeGB;
+                return;
+            }
+            if (inputStr == "US")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeUS;
+                return;
+            }
+            if (inputStr == "UM")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeUM;
+                return;
+            }
+            if (inputStr == "UY")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeUY;
+                return;
+            }
+            if (inputStr == "UZ")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeUZ;
+                return;
+            }
+            if (inputStr == "VU")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeVU;
+                return;
+            }
+            if (inputStr == "VE")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeVE;
+                return;
+            }
+            if (inputStr == "VN")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeVN;
+                return;
+            }
+            if (inputStr == "VG")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeVG;
+                return;
+            }
+            if (inputStr == "VI")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeVI;
+                return;
+            }
+            if (inputStr == "WF")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeWF;
+                return;
+            }
+            if (inputStr == "EH")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeEH;
+                return;
+            }
+            if (inputStr == "YE")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeYE;
+                return;
+            }
+            if (inputStr == "ZM")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeZM;
+                return;
+            }
+            if (inputStr == "ZW")
+            {
+                output = SegmentCountryCode::SegmentCountryCodeZW;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const SegmentCurrency input, Json::Value& output)
+        {
+            if (input == SegmentCurrency::SegmentCurrencyAED)
+            {
+                output = Json::Value(Json::StaticString("AED"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyAFN)
+            {
+                output = Json::Value(Json::StaticString("AFN"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyALL)
+            {
+                output = Json::Value(Json::StaticString("ALL"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyAMD)
+            {
+                output = Json::Value(Json::StaticString("AMD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyANG)
+            {
+                output = Json::Value(Json::StaticString("ANG"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyAOA)
+            {
+                output = Json::Value(Json::StaticString("AOA"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyARS)
+            {
+                output = Json::Value(Json::StaticString("ARS"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyAUD)
+            {
+                output = Json::Value(Json::StaticString("AUD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyAWG)
+            {
+                output = Json::Value(Json::StaticString("AWG"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyAZN)
+            {
+                output = Json::Value(Json::StaticString("AZN"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyBAM)
+            {
+                output = Json::Value(Json::StaticString("BAM"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyBBD)
+            {
+                output = Json::Value(Json::StaticString("BBD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyBDT)
+            {
+                output = Json::Value(Json::StaticString("BDT"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyBGN)
+            {
+                output = Json::Value(Json::StaticString("BGN"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyBHD)
+            {
+                output = Json::Value(Json::StaticString("BHD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyBIF)
+            {
+                output = Json::Value(Json::StaticString("BIF"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyBMD)
+            {
+                output = Json::Value(Json::StaticString("BMD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyBND)
+            {
+                output = Json::Value(Json::StaticString("BND"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyBOB)
+            {
+                output = Json::Value(Json::StaticString("BOB"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyBRL)
+            {
+                output = Json::Value(Json::StaticString("BRL"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyBSD)
+            {
+                output = Json::Value(Json::StaticString("BSD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyBTN)
+            {
+                output = Json::Value(Json::StaticString("BTN"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyBWP)
+            {
+                output = Json::Value(Json::StaticString("BWP"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyBYR)
+            {
+                output = Json::Value(Json::StaticString("BYR"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyBZD)
+            {
+                output = Json::Value(Json::StaticString("BZD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyCAD)
+            {
+                output = Json::Value(Json::StaticString("CAD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyCDF)
+            {
+                output = Json::Value(Json::StaticString("CDF"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyCHF)
+            {
+                output = Json::Value(Json::StaticString("CHF"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyCLP)
+            {
+                output = Json::Value(Json::StaticString("CLP"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyCNY)
+            {
+                output = Json::Value(Json::StaticString("CNY"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyCOP)
+            {
+                output = Json::Value(Json::StaticString("COP"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyCRC)
+            {
+                output = Json::Value(Json::StaticString("CRC"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyCUC)
+            {
+                output = Json::Value(Json::StaticString("CUC"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyCUP)
+            {
+                output = Json::Value(Json::StaticString("CUP"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyCVE)
+            {
+                output = Json::Value(Json::StaticString("CVE"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyCZK)
+            {
+                output = Json::Value(Json::StaticString("CZK"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyDJF)
+            {
+                output = Json::Value(Json::StaticString("DJF"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyDKK)
+            {
+                output = Json::Value(Json::StaticString("DKK"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyDOP)
+            {
+                output = Json::Value(Json::StaticString("DOP"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyDZD)
+            {
+                output = Json::Value(Json::StaticString("DZD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyEGP)
+            {
+                output = Json::Value(Json::StaticString("EGP"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyERN)
+            {
+                output = Json::Value(Json::StaticString("ERN"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyETB)
+            {
+                output = Json::Value(Json::StaticString("ETB"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyEUR)
+            {
+                output = Json::Value(Json::StaticString("EUR"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyFJD)
+            {
+                output = Json::Value(Json::StaticString("FJD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyFKP)
+            {
+                output = Json::Value(Json::StaticString("FKP"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyGBP)
+            {
+                output = Json::Value(Json::StaticString("GBP"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyGEL)
+            {
+                output = Json::Value(Json::StaticString("GEL"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyGGP)
+            {
+                output = Json::Value(Json::StaticString("GGP"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyGHS)
+            {
+                output = Json::Value(Json::StaticString("GHS"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyGIP)
+            {
+                output = Json::Value(Json::StaticString("GIP"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyGMD)
+            {
+                output = Json::Value(Json::StaticString("GMD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyGNF)
+            {
+                output = Json::Value(Json::StaticString("GNF"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyGTQ)
+            {
+                output = Json::Value(Json::StaticString("GTQ"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyGYD)
+            {
+                output = Json::Value(Json::StaticString("GYD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyHKD)
+            {
+                output = Json::Value(Json::StaticString("HKD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyHNL)
+            {
+                output = Json::Value(Json::StaticString("HNL"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyHRK)
+            {
+                output = Json::Value(Json::StaticString("HRK"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyHTG)
+            {
+                output = Json::Value(Json::StaticString("HTG"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyHUF)
+            {
+                output = Json::Value(Json::StaticString("HUF"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyIDR)
+            {
+                output = Json::Value(Json::StaticString("IDR"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyILS)
+            {
+                output = Json::Value(Json::StaticString("ILS"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyIMP)
+            {
+                output = Json::Value(Json::StaticString("IMP"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyINR)
+            {
+                output = Json::Value(Json::StaticString("INR"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyIQD)
+            {
+                output = Json::Value(Json::StaticString("IQD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyIRR)
+            {
+                output = Json::Value(Json::StaticString("IRR"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyISK)
+            {
+                output = Json::Value(Json::StaticString("ISK"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyJEP)
+            {
+                output = Json::Value(Json::StaticString("JEP"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyJMD)
+            {
+                output = Json::Value(Json::StaticString("JMD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyJOD)
+            {
+                output = Json::Value(Json::StaticString("JOD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyJPY)
+            {
+                output = Json::Value(Json::StaticString("JPY"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyKES)
+            {
+                output = Json::Value(Json::StaticString("KES"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyKGS)
+            {
+                output = Json::Value(Json::StaticString("KGS"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyKHR)
+            {
+                output = Json::Value(Json::StaticString("KHR"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyKMF)
+            {
+                output = Json::Value(Json::StaticString("KMF"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyKPW)
+            {
+                output = Json::Value(Json::StaticString("KPW"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyKRW)
+            {
+                output = Json::Value(Json::StaticString("KRW"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyKWD)
+            {
+                output = Json::Value(Json::StaticString("KWD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyKYD)
+            {
+                output = Json::Value(Json::StaticString("KYD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyKZT)
+            {
+                output = Json::Value(Json::StaticString("KZT"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyLAK)
+            {
+                output = Json::Value(Json::StaticString("LAK"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyLBP)
+            {
+                output = Json::Value(Json::StaticString("LBP"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyLKR)
+            {
+                output = Json::Value(Json::StaticString("LKR"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyLRD)
+            {
+                output = Json::Value(Json::StaticString("LRD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyLSL)
+            {
+                output = Json::Value(Json::StaticString("LSL"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyLYD)
+            {
+                output = Json::Value(Json::StaticString("LYD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyMAD)
+            {
+                output = Json::Value(Json::StaticString("MAD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyMDL)
+            {
+                output = Json::Value(Json::StaticString("MDL"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyMGA)
+            {
+                output = Json::Value(Json::StaticString("MGA"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyMKD)
+            {
+                output = Json::Value(Json::StaticString("MKD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyMMK)
+            {
+                output = Json::Value(Json::StaticString("MMK"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyMNT)
+            {
+                output = Json::Value(Json::StaticString("MNT"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyMOP)
+            {
+                output = Json::Value(Json::StaticString("MOP"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyMRO)
+            {
+                output = Json::Value(Json::StaticString("MRO"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyMUR)
+            {
+                output = Json::Value(Json::StaticString("MUR"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyMVR)
+            {
+                output = Json::Value(Json::StaticString("MVR"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyMWK)
+            {
+                output = Json::Value(Json::StaticString("MWK"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyMXN)
+            {
+                output = Json::Value(Json::StaticString("MXN"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyMYR)
+            {
+                output = Json::Value(Json::StaticString("MYR"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyMZN)
+            {
+                output = Json::Value(Json::StaticString("MZN"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyNAD)
+            {
+                output = Json::Value(Json::StaticString("NAD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyNGN)
+            {
+                output = Json::Value(Json::StaticString("NGN"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyNIO)
+            {
+                output = Json::Value(Json::StaticString("NIO"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyNOK)
+            {
+                output = Json::Value(Json::StaticString("NOK"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyNPR)
+            {
+                output = Json::Value(Json::StaticString("NPR"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyNZD)
+            {
+                output = Json::Value(Json::StaticString("NZD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyOMR)
+            {
+                output = Json::Value(Json::StaticString("OMR"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyPAB)
+            {
+                output = Json::Value(Json::StaticString("PAB"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyPEN)
+            {
+                output = Json::Value(Json::StaticString("PEN"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyPGK)
+            {
+                output = Json::Value(Json::StaticString("PGK"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyPHP)
+            {
+                output = Json::Value(Json::StaticString("PHP"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyPKR)
+            {
+                output = Json::Value(Json::StaticString("PKR"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyPLN)
+            {
+                output = Json::Value(Json::StaticString("PLN"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyPYG)
+            {
+                output = Json::Value(Json::StaticString("PYG"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyQAR)
+            {
+                output = Json::Value(Json::StaticString("QAR"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyRON)
+            {
+                output = Json::Value(Json::StaticString("RON"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyRSD)
+            {
+                output = Json::Value(Json::StaticString("RSD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyRUB)
+            {
+                output = Json::Value(Json::StaticString("RUB"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyRWF)
+            {
+                output = Json::Value(Json::StaticString("RWF"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencySAR)
+            {
+                output = Json::Value(Json::StaticString("SAR"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencySBD)
+            {
+                output = Json::Value(Json::StaticString("SBD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencySCR)
+            {
+                output = Json::Value(Json::StaticString("SCR"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencySDG)
+            {
+                output = Json::Value(Json::StaticString("SDG"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencySEK)
+            {
+                output = Json::Value(Json::StaticString("SEK"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencySGD)
+            {
+                output = Json::Value(Json::StaticString("SGD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencySHP)
+            {
+                output = Json::Value(Json::StaticString("SHP"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencySLL)
+            {
+                output = Json::Value(Json::StaticString("SLL"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencySOS)
+            {
+                output = Json::Value(Json::StaticString("SOS"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencySPL)
+            {
+                output = Json::Value(Json::StaticString("SPL"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencySRD)
+            {
+                output = Json::Value(Json::StaticString("SRD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencySTD)
+            {
+                output = Json::Value(Json::StaticString("STD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencySVC)
+            {
+                output = Json::Value(Json::StaticString("SVC"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencySYP)
+            {
+                output = Json::Value(Json::StaticString("SYP"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencySZL)
+            {
+                output = Json::Value(Json::StaticString("SZL"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyTHB)
+            {
+                output = Json::Value(Json::StaticString("THB"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyTJS)
+            {
+                output = Json::Value(Json::StaticString("TJS"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyTMT)
+            {
+                output = Json::Value(Json::StaticString("TMT"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyTND)
+            {
+                output = Json::Value(Json::StaticString("TND"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyTOP)
+            {
+                output = Json::Value(Json::StaticString("TOP"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyTRY)
+            {
+                output = Json::Value(Json::StaticString("TRY"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyTTD)
+            {
+                output = Json::Value(Json::StaticString("TTD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyTVD)
+            {
+                output = Json::Value(Json::StaticString("TVD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyTWD)
+            {
+                output = Json::Value(Json::StaticString("TWD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyTZS)
+            {
+                output = Json::Value(Json::StaticString("TZS"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyUAH)
+            {
+                output = Json::Value(Json::StaticString("UAH"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyUGX)
+            {
+                output = Json::Value(Json::StaticString("UGX"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyUSD)
+            {
+                output = Json::Value(Json::StaticString("USD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyUYU)
+            {
+                output = Json::Value(Json::StaticString("UYU"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyUZS)
+            {
+                output = Json::Value(Json::StaticString("UZS"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyVEF)
+            {
+                output = Json::Value(Json::StaticString("VEF"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyVND)
+            {
+                output = Json::Value(Json::StaticString("VND"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyVUV)
+            {
+                output = Json::Value(Json::StaticString("VUV"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyWST)
+            {
+                output = Json::Value(Json::StaticString("WST"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyXAF)
+            {
+                output = Json::Value(Json::StaticString("XAF"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyXCD)
+            {
+                output = Json::Value(Json::StaticString("XCD"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyXDR)
+            {
+                output = Json::Value(Json::StaticString("XDR"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyXOF)
+            {
+                output = Json::Value(Json::StaticString("XOF"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyXPF)
+            {
+                output = Json::Value(Json::StaticString("XPF"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyYER)
+            {
+                output = Json::Value(Json::StaticString("YER"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyZAR)
+            {
+                output = Json::Value(Json::StaticString("ZAR"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyZMW)
+            {
+                output = Json::Value(Json::StaticString("ZMW"));
+                return;
+            }
+            if (input == SegmentCurrency::SegmentCurrencyZWD)
+            {
+                output = Json::Value(Json::StaticString("ZWD"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, SegmentCurrency& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "AED")
+            {
+                output = SegmentCurrency::SegmentCurrencyAED;
+                return;
+            }
+            if (inputStr == "AFN")
+            {
+                output = SegmentCurrency::SegmentCurrencyAFN;
+                return;
+            }
+            if (inputStr == "ALL")
+            {
+                output = SegmentCurrency::SegmentCurrencyALL;
+                return;
+            }
+            if (inputStr == "AMD")
+            {
+                output = SegmentCurrency::SegmentCurrencyAMD;
+                return;
+            }
+            if (inputStr == "ANG")
+            {
+                output = SegmentCurrency::SegmentCurrencyANG;
+                return;
+            }
+            if (inputStr == "AOA")
+            {
+                output = SegmentCurrency::SegmentCurrencyAOA;
+                return;
+            }
+            if (inputStr == "ARS")
+            {
+                output = SegmentCurrency::SegmentCurrencyARS;
+                return;
+            }
+            if (inputStr == "AUD")
+            {
+                output = SegmentCurrency::SegmentCurrencyAUD;
+                return;
+            }
+            if (inputStr == "AWG")
+            {
+                output = SegmentCurrency::SegmentCurrencyAWG;
+                return;
+            }
+            if (inputStr == "AZN")
+            {
+                output = SegmentCurrency::SegmentCurrencyAZN;
+                return;
+            }
+            if (inputStr == "BAM")
+            {
+                output = SegmentCurrency::SegmentCurrencyBAM;
+                return;
+            }
+            if (inputStr == "BBD")
+            {
+                output = SegmentCurrency::SegmentCurrencyBBD;
+                return;
+            }
+            if (inputStr == "BDT")
+            {
+                output = SegmentCurrency::SegmentCurrencyBDT;
+                return;
+            }
+            if (inputStr == "BGN")
+            {
+                output = SegmentCurrency::SegmentCurrencyBGN;
+                return;
+            }
+            if (inputStr == "BHD")
+            {
+                output = SegmentCurrency::SegmentCurrencyBHD;
+                return;
+            }
+            if (inputStr == "BIF")
+            {
+                output = SegmentCurrency::SegmentCurrencyBIF;
+                return;
+            }
+            if (inputStr == "BMD")
+            {
+                output = SegmentCurrency::SegmentCurrencyBMD;
+                return;
+            }
+            if (inputStr == "BND")
+            {
+                output = SegmentCurrency::SegmentCurrencyBND;
+                return;
+            }
+            if (inputStr == "BOB")
+            {
+                output = SegmentCurrency::SegmentCurrencyBOB;
+                return;
+            }
+            if (inputStr == "BRL")
+            {
+                output = SegmentCurrency::SegmentCurrencyBRL;
+                return;
+            }
+            if (inputStr == "BSD")
+            {
+                output = SegmentCurrency::SegmentCurrencyBSD;
+                return;
+            }
+            if (inputStr == "BTN")
+            {
+                output = SegmentCurrency::SegmentCurrencyBTN;
+                return;
+            }
+            if (inputStr == "BWP")
+            {
+                output = SegmentCurrency::SegmentCurrencyBWP;
+                return;
+            }
+            if (inputStr == "BYR")
+            {
+                output = SegmentCurrency::SegmentCurrencyBYR;
+                return;
+            }
+            if (inputStr == "BZD")
+            {
+                output = SegmentCurrency::SegmentCurrencyBZD;
+                return;
+            }
+            if (inputStr == "CAD")
+            {
+                output = SegmentCurrency::SegmentCurrencyCAD;
+                return;
+            }
+            if (inputStr == "CDF")
+            {
+                output = SegmentCurrency::SegmentCurrencyCDF;
+                return;
+            }
+            if (inputStr == "CHF")
+            {
+                output = SegmentCurrency::SegmentCurrencyCHF;
+                return;
+            }
+            if (inputStr == "CLP")
+            {
+                output = SegmentCurrency::SegmentCurrencyCLP;
+                return;
+            }
+            if (inputStr == "CNY")
+            {
+                output = SegmentCurrency::SegmentCurrencyCNY;
+                return;
+            }
+            if (inputStr == "COP")
+            {
+                output = SegmentCurrency::SegmentCurrencyCOP;
+                return;
+            }
+            if (inputStr == "CRC")
+            {
+                output = SegmentCurrency::SegmentCurrencyCRC;
+                return;
+            }
+            if (inputStr == "CUC")
+            {
+                output = SegmentCurrency::SegmentCurrencyCUC;
+                return;
+            }
+            if (inputStr == "CUP")
+            {
+                output = SegmentCurrency::SegmentCurrencyCUP;
+                return;
+            }
+            if (inputStr == "CVE")
+            {
+                output = SegmentCurrency::SegmentCurrencyCVE;
+                return;
+            }
+            if (inputStr == "CZK")
+            {
+                output = SegmentCurrency::SegmentCurrencyCZK;
+                return;
+            }
+            if (inputStr == "DJF")
+            {
+                output = SegmentCurrency::SegmentCurrencyDJF;
+                return;
+            }
+            if (inputStr == "DKK")
+            {
+                output = SegmentCurrency::SegmentCurrencyDKK;
+                return;
+            }
+            if (inputStr == "DOP")
+            {
+                output = SegmentCurrency::SegmentCurrencyDOP;
+                return;
+            }
+            if (inputStr == "DZD")
+            {
+                output = SegmentCurrency::SegmentCurrencyDZD;
+                return;
+            }
+            if (inputStr == "EGP")
+            {
+                output = SegmentCurrency::SegmentCurrencyEGP;
+                return;
+            }
+            if (inputStr == "ERN")
+            {
+                output = SegmentCurrency::SegmentCurrencyERN;
+                return;
+            }
+            if (inputStr == "ETB")
+            {
+                output = SegmentCurrency::SegmentCurrencyETB;
+                return;
+            }
+            if (inputStr == "EUR")
+            {
+                output = SegmentCurrency::SegmentCurrencyEUR;
+                return;
+            }
+            if (inputStr == "FJD")
+            {
+                output = SegmentCurrency::SegmentCurrencyFJD;
+                return;
+            }
+            if (inputStr == "FKP")
+            {
+                output = SegmentCurrency::SegmentCurrencyFKP;
+                return;
+            }
+            if (inputStr == "GBP")
+            {
+                output = SegmentCurrency::SegmentCurrencyGBP;
+                return;
+            }
+            if (inputStr == "GEL")
+            {
+                output = SegmentCurrency::SegmentCurrencyGEL;
+                return;
+            }
+            if (inputStr == "GGP")
+            {
+                output = SegmentCurrency::SegmentCurrencyGGP;
+                return;
+            }
+            if (inputStr == "GHS")
+            {
+                output = SegmentCurrency::SegmentCurrencyGHS;
+                return;
+            }
+            if (inputStr == "GIP")
+            {
+                output = SegmentCurrency::SegmentCurrencyGIP;
+                return;
+            }
+            if (inputStr == "GMD")
+            {
+                output = SegmentCurrency::SegmentCurrencyGMD;
+                return;
+            }
+            if (inputStr == "GNF")
+            {
+                output = SegmentCurrency::SegmentCurrencyGNF;
+                return;
+            }
+            if (inputStr == "GTQ")
+            {
+                output = SegmentCurrency::SegmentCurrencyGTQ;
+                return;
+            }
+            if (inputStr == "GYD")
+            {
+                output = SegmentCurrency::SegmentCurrencyGYD;
+                return;
+            }
+            if (inputStr == "HKD")
+            {
+                output = SegmentCurrency::SegmentCurrencyHKD;
+                return;
+            }
+            if (inputStr == "HNL")
+            {
+                output = SegmentCurrency::SegmentCurrencyHNL;
+                return;
+            }
+            if (inputStr == "HRK")
+            {
+                output = SegmentCurrency::SegmentCurrencyHRK;
+                return;
+            }
+            if (inputStr == "HTG")
+            {
+                output = SegmentCurrency::SegmentCurrencyHTG;
+                return;
+            }
+            if (inputStr == "HUF")
+            {
+                output = SegmentCurrency::SegmentCurrencyHUF;
+                return;
+            }
+            if (inputStr == "IDR")
+            {
+                output = SegmentCurrency::SegmentCurrencyIDR;
+                return;
+            }
+            if (inputStr == "ILS")
+            {
+                output = SegmentCurrency::SegmentCurrencyILS;
+                return;
+            }
+            if (inputStr == "IMP")
+            {
+                output = SegmentCurrency::SegmentCurrencyIMP;
+                return;
+            }
+            if (inputStr == "INR")
+            {
+                output = SegmentCurrency::SegmentCurrencyINR;
+                return;
+            }
+            if (inputStr == "IQD")
+            {
+                output = SegmentCurrency::SegmentCurrencyIQD;
+                return;
+            }
+            if (inputStr == "IRR")
+            {
+                output = SegmentCurrency::SegmentCurrencyIRR;
+                return;
+            }
+            if (inputStr == "ISK")
+            {
+                output = SegmentCurrency::SegmentCurrencyISK;
+                return;
+            }
+            if (inputStr == "JEP")
+            {
+                output = SegmentCurrency::SegmentCurrencyJEP;
+                return;
+            }
+            if (inputStr == "JMD")
+            {
+                output = SegmentCurrency::SegmentCurrencyJMD;
+                return;
+            }
+            if (inputStr == "JOD")
+            {
+                output = SegmentCurrency::SegmentCurrencyJOD;
+                return;
+            }
+            if (inputStr == "JPY")
+            {
+                output = SegmentCurrency::SegmentCurrencyJPY;
+                return;
+            }
+            if (inputStr == "KES")
+            {
+                output = SegmentCurrency::SegmentCurrencyKES;
+                return;
+            }
+            if (inputStr == "KGS")
+            {
+                output = SegmentCurrency::SegmentCurrencyKGS;
+                return;
+            }
+            if (inputStr == "KHR")
+            {
+                output = SegmentCurrency::SegmentCurrencyKHR;
+                return;
+            }
+            if (inputStr == "KMF")
+            {
+                output = SegmentCurrency::SegmentCurrencyKMF;
+                return;
+            }
+            if (inputStr == "KPW")
+            {
+                output = SegmentCurrency::SegmentCurrencyKPW;
+                return;
+            }
+            if (inputStr == "KRW")
+            {
+                output = SegmentCurrency::SegmentCurrencyKRW;
+                return;
+            }
+            if (inputStr == "KWD")
+            {
+                output = SegmentCurrency::SegmentCurrencyKWD;
+                return;
+            }
+            if (inputStr == "KYD")
+            {
+                output = SegmentCurrency::SegmentCurrencyKYD;
+                return;
+            }
+            if (inputStr == "KZT")
+            {
+                output = SegmentCurrency::SegmentCurrencyKZT;
+                return;
+            }
+            if (inputStr == "LAK")
+            {
+                output = SegmentCurrency::SegmentCurrencyLAK;
+                return;
+            }
+            if (inputStr == "LBP")
+            {
+                output = SegmentCurrency::SegmentCurrencyLBP;
+                return;
+            }
+            if (inputStr == "LKR")
+            {
+                output = SegmentCurrency::SegmentCurrencyLKR;
+                return;
+            }
+            if (inputStr == "LRD")
+            {
+                output = SegmentCurrency::SegmentCurrencyLRD;
+                return;
+            }
+            if (inputStr == "LSL")
+            {
+                output = SegmentCurrency::SegmentCurrencyLSL;
+                return;
+            }
+            if (inputStr == "LYD")
+            {
+                output = SegmentCurrency::SegmentCurrencyLYD;
+                return;
+            }
+            if (inputStr == "MAD")
+            {
+                output = SegmentCurrency::SegmentCurrencyMAD;
+                return;
+            }
+            if (inputStr == "MDL")
+            {
+                output = SegmentCurrency::SegmentCurrencyMDL;
+                return;
+            }
+            if (inputStr == "MGA")
+            {
+                output = SegmentCurrency::SegmentCurrencyMGA;
+                return;
+            }
+            if (inputStr == "MKD")
+            {
+                output = SegmentCurrency::SegmentCurrencyMKD;
+                return;
+            }
+            if (inputStr == "MMK")
+            {
+                output = SegmentCurrency::SegmentCurrencyMMK;
+                return;
+            }
+            if (inputStr == "MNT")
+            {
+                output = SegmentCurrency::SegmentCurrencyMNT;
+                return;
+            }
+            if (inputStr == "MOP")
+            {
+                output = SegmentCurrency::SegmentCurrencyMOP;
+                return;
+            }
+            if (inputStr == "MRO")
+            {
+                output = SegmentCurrency::SegmentCurrencyMRO;
+                return;
+            }
+            if (inputStr == "MUR")
+            {
+                output = SegmentCurrency::SegmentCurrencyMUR;
+                return;
+            }
+            if (inputStr == "MVR")
+            {
+                output = SegmentCurrency::SegmentCurrencyMVR;
+                return;
+            }
+            if (inputStr == "MWK")
+            {
+                output = SegmentCurrency::SegmentCurrencyMWK;
+                return;
+            }
+            if (inputStr == "MXN")
+            {
+                output = SegmentCurrency::SegmentCurrencyMXN;
+                return;
+            }
+            if (inputStr == "MYR")
+            {
+                output = SegmentCurrency::SegmentCurrencyMYR;
+                return;
+            }
+            if (inputStr == "MZN")
+            {
+                output = SegmentCurrency::SegmentCurrencyMZN;
+                return;
+            }
+            if (inputStr == "NAD")
+            {
+                output = SegmentCurrency::SegmentCurrencyNAD;
+                return;
+            }
+            if (inputStr == "NGN")
+            {
+                output = SegmentCurrency::SegmentCurrencyNGN;
+                return;
+            }
+            if (inputStr == "NIO")
+            {
+                output = SegmentCurrency::SegmentCurrencyNIO;
+                return;
+            }
+            if (inputStr == "NOK")
+            {
+                output = SegmentCurrency::SegmentCurrencyNOK;
+                return;
+            }
+            if (inputStr == "NPR")
+            {
+                output = SegmentCurrency::SegmentCurrencyNPR;
+                return;
+            }
+            if (inputStr == "NZD")
+            {
+                output = SegmentCurrency::SegmentCurrencyNZD;
+                return;
+            }
+            if (inputStr == "OMR")
+            {
+                output = SegmentCurrency::SegmentCurrencyOMR;
+                return;
+            }
+            if (inputStr == "PAB")
+            {
+                output = SegmentCurrency::SegmentCurrencyPAB;
+                return;
+            }
+            if (inputStr == "PEN")
+            {
+                output = SegmentCurrency::SegmentCurrencyPEN;
+                return;
+            }
+            if (inputStr == "PGK")
+            {
+                output = SegmentCurrency::SegmentCurrencyPGK;
+                return;
+            }
+            if (inputStr == "PHP")
+            {
+                output = SegmentCurrency::SegmentCurrencyPHP;
+                return;
+            }
+            if (inputStr == "PKR")
+            {
+                output = SegmentCurrency::SegmentCurrencyPKR;
+                return;
+            }
+            if (inputStr == "PLN")
+            {
+                output = SegmentCurrency::SegmentCurrencyPLN;
+                return;
+            }
+            if (inputStr == "PYG")
+            {
+                output = SegmentCurrency::SegmentCurrencyPYG;
+                return;
+            }
+            if (inputStr == "QAR")
+            {
+                output = SegmentCurrency::SegmentCurrencyQAR;
+                return;
+            }
+            if (inputStr == "RON")
+            {
+                output = SegmentCurrency::SegmentCurrencyRON;
+                return;
+            }
+            if (inputStr == "RSD")
+            {
+                output = SegmentCurrency::SegmentCurrencyRSD;
+                return;
+            }
+            if (inputStr == "RUB")
+            {
+                output = SegmentCurrency::SegmentCurrencyRUB;
+                return;
+            }
+            if (inputStr == "RWF")
+            {
+                output = SegmentCurrency::SegmentCurrencyRWF;
+                return;
+            }
+            if (inputStr == "SAR")
+            {
+                output = SegmentCurrency::SegmentCurrencySAR;
+                return;
+            }
+            if (inputStr == "SBD")
+            {
+                output = SegmentCurrency::SegmentCurrencySBD;
+                return;
+            }
+            if (inputStr == "SCR")
+            {
+                output = SegmentCurrency::SegmentCurrencySCR;
+                return;
+            }
+            if (inputStr == "SDG")
+            {
+                output = SegmentCurrency::SegmentCurrencySDG;
+                return;
+            }
+            if (inputStr == "SEK")
+            {
+                output = SegmentCurrency::SegmentCurrencySEK;
+                return;
+            }
+            if (inputStr == "SGD")
+            {
+                output = SegmentCurrency::SegmentCurrencySGD;
+                return;
+            }
+            if (inputStr == "SHP")
+            {
+                output = SegmentCurrency::SegmentCurrencySHP;
+                return;
+            }
+            if (inputStr == "SLL")
+            {
+                output = SegmentCurrency::SegmentCurrencySLL;
+                return;
+            }
+            if (inputStr == "SOS")
+            {
+                output = SegmentCurrency::SegmentCurrencySOS;
+                return;
+            }
+            if (inputStr == "SPL")
+            {
+                output = SegmentCurrency::SegmentCurrencySPL;
+                return;
+            }
+            if (inputStr == "SRD")
+            {
+                output = SegmentCurrency::SegmentCurrencySRD;
+                return;
+            }
+            if (inputStr == "STD")
+            {
+                output = SegmentCurrency::SegmentCurrencySTD;
+                return;
+            }
+            if (inputStr == "SVC")
+            {
+                output = SegmentCurrency::SegmentCurrencySVC;
+                return;
+            }
+            if (inputStr == "SYP")
+            {
+                output = SegmentCurrency::SegmentCurrencySYP;
+                return;
+            }
+            if (inputStr == "SZL")
+            {
+                output = SegmentCurrency::SegmentCurrencySZL;
+                return;
+            }
+            if (inputStr == "THB")
+            {
+                output = SegmentCurrency::SegmentCurrencyTHB;
+                return;
+            }
+            if (inputStr == "TJS")
+            {
+                output = SegmentCurrency::SegmentCurrencyTJS;
+                return;
+            }
+            if (inputStr == "TMT")
+            {
+                output = SegmentCurrency::SegmentCurrencyTMT;
+                return;
+            }
+            if (inputStr == "TND")
+            {
+                output = SegmentCurrency::SegmentCurrencyTND;
+                return;
+            }
+            if (inputStr == "TOP")
+            {
+                output = SegmentCurrency::SegmentCurrencyTOP;
+                return;
+            }
+            if (inputStr == "TRY")
+            {
+                output = SegmentCurrency::SegmentCurrencyTRY;
+                return;
+            }
+            if (inputStr == "TTD")
+            {
+                output = SegmentCurrency::SegmentCurrencyTTD;
+                return;
+            }
+            if (inputStr == "TVD")
+            {
+                output = SegmentCurrency::SegmentCurrencyTVD;
+                return;
+            }
+            if (inputStr == "TWD")
+            {
+                output = SegmentCurrency::SegmentCurrencyTWD;
+                return;
+            }
+            if (inputStr == "TZS")
+            {
+                output = SegmentCurrency::SegmentCurrencyTZS;
+                return;
+            }
+            if (inputStr == "UAH")
+            {
+                output = SegmentCurrency::SegmentCurrencyUAH;
+                return;
+            }
+            if (inputStr == "UGX")
+            {
+                output = SegmentCurrency::SegmentCurrencyUGX;
+                return;
+            }
+            if (inputStr == "USD")
+            {
+                output = SegmentCurrency::SegmentCurrencyUSD;
+                return;
+            }
+            if (inputStr == "UYU")
+            {
+                output = SegmentCurrency::SegmentCurrencyUYU;
+                return;
+            }
+            if (inputStr == "UZS")
+            {
+                output = SegmentCurrency::SegmentCurrencyUZS;
+                return;
+            }
+            if (inputStr == "VEF")
+            {
+                output = SegmentCurrency::SegmentCurrencyVEF;
+                return;
+            }
+            if (inputStr == "VND")
+            {
+                output = SegmentCurrency::SegmentCurrencyVND;
+                return;
+            }
+            if (inputStr == "VUV")
+            {
+                output = SegmentCurrency::SegmentCurrencyVUV;
+                return;
+            }
+            if (inputStr == "WST")
+            {
+                output = SegmentCurrency::SegmentCurrencyWST;
+                return;
+            }
+            if (inputStr == "XAF")
+            {
+                output = SegmentCurrency::SegmentCurrencyXAF;
+                return;
+            }
+            if (inputStr == "XCD")
+            {
+                output = SegmentCurrency::SegmentCurrencyXCD;
+                return;
+            }
+            if (inputStr == "XDR")
+            {
+                output = SegmentCurrency::SegmentCurrencyXDR;
+                return;
+            }
+            if (inputStr == "XOF")
+            {
+                output = SegmentCurrency::SegmentCurrencyXOF;
+                return;
+            }
+            if (inputStr == "XPF")
+            {
+                output = SegmentCurrency::SegmentCurrencyXPF;
+                return;
+            }
+            if (inputStr == "YER")
+            {
+                output = SegmentCurrency::SegmentCurrencyYER;
+                return;
+            }
+            if (inputStr == "ZAR")
+            {
+                output = SegmentCurrency::SegmentCurrencyZAR;
+                return;
+            }
+            if (inputStr == "ZMW")
+            {
+                output = SegmentCurrency::SegmentCurrencyZMW;
+                return;
+            }
+            if (inputStr == "ZWD")
+            {
+                output = SegmentCurrency::SegmentCurrencyZWD;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const SegmentFilterComparison input, Json::Value& output)
+        {
+            if (input == SegmentFilterComparison::SegmentFilterComparisonGreaterThan)
+            {
+                output = Json::Value(Json::StaticString("GreaterThan"));
+                return;
+            }
+            if (input == SegmentFilterComparison::SegmentFilterComparisonLessThan)
+            {
+                output = Json::Value(Json::StaticString("LessThan"));
+                return;
+            }
+            if (input == SegmentFilterComparison::SegmentFilterComparisonEqualTo)
+            {
+                output = Json::Value(Json::StaticString("EqualTo"));
+                return;
+            }
+            if (input == SegmentFilterComparison::SegmentFilterComparisonNotEqualTo)
+            {
+                output = Json::Value(Json::StaticString("NotEqualTo"));
+                return;
+            }
+            if (input == SegmentFilterComparison::SegmentFilterComparisonGreaterThanOrEqual)
+            {
+                output = Json::Value(Json::StaticString("GreaterThanOrEqual"));
+                return;
+            }
+            if (input == SegmentFilterComparison::SegmentFilterComparisonLessThanOrEqual)
+            {
+                output = Json::Value(Json::StaticString("LessThanOrEqual"));
+                return;
+            }
+            if (input == SegmentFilterComparison::SegmentFilterComparisonExists)
+            {
+                output = Json::Value(Json::StaticString("Exists"));
+                return;
+            }
+            if (input == SegmentFilterComparison::SegmentFilterComparisonContains)
+            {
+                output = Json::Value(Json::StaticString("Contains"));
+                return;
+            }
+            if (input == SegmentFilterComparison::SegmentFilterComparisonNotContains)
+            {
+                output = Json::Value(Json::StaticString("NotContains"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, SegmentFilterComparison& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "GreaterThan")
+            {
+                output = SegmentFilterComparison::SegmentFilterComparisonGreaterThan;
+                return;
+            }
+            if (inputStr == "LessThan")
+            {
+                output = SegmentFilterComparison::SegmentFilterComparisonLessThan;
+                return;
+            }
+            if (inputStr == "EqualTo")
+            {
+                output = SegmentFilterComparison::SegmentFilterComparisonEqualTo;
+                return;
+            }
+            if (inputStr == "NotEqualTo")
+            {
+                output = SegmentFilterComparison::SegmentFilterComparisonNotEqualTo;
+                return;
+            }
+            if (inputStr == "GreaterThanOrEqual")
+            {
+                output = SegmentFilterComparison::SegmentFilterComparisonGreaterThanOrEqual;
+                return;
+            }
+            if (inputStr == "LessThanOrEqual")
+            {
+                output = SegmentFilterComparison::SegmentFilterComparisonLessThanOrEqual;
+                return;
+            }
+            if (inputStr == "Exists")
+            {
+                output = SegmentFilterComparison::SegmentFilterComparisonExists;
+                return;
+            }
+            if (inputStr == "Contains")
+            {
+                output = SegmentFilterComparison::SegmentFilterComparisonContains;
+                return;
+            }
+            if (inputStr == "NotContains")
+            {
+                output = SegmentFilterComparison::SegmentFilterComparisonNotContains;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const SegmentLoginIdentityProvider input, Json::Value& output)
+        {
+            if (input == SegmentLoginIdentityProvider::SegmentLoginIdentityProviderUnknown)
+            {
+                output = Json::Value(Json::StaticString("Unknown"));
+                return;
+            }
+            if (input == SegmentLoginIdentityProvider::SegmentLoginIdentityProviderPlayFab)
+            {
+                output = Json::Value(Json::StaticString("PlayFab"));
+                return;
+            }
+            if (input == SegmentLoginIdentityProvider::SegmentLoginIdentityProviderCustom)
+            {
+                output = Json::Value(Json::StaticString("Custom"));
+                return;
+            }
+            if (input == SegmentLoginIdentityProvider::SegmentLoginIdentityProviderGameCenter)
+            {
+                output = Json::Value(Json::StaticString("GameCenter"));
+                return;
+            }
+            if (input == SegmentLoginIdentityProvider::SegmentLoginIdentityProviderGooglePlay)
+            {
+                output = Json::Value(Json::StaticString("GooglePlay"));
+                return;
+            }
+            if (input == SegmentLoginIdentityProvider::SegmentLoginIdentityProviderSteam)
+            {
+                output = Json::Value(Json::StaticString("Steam"));
+                return;
+            }
+            if (input == SegmentLoginIdentityProvider::SegmentLoginIdentityProviderXBoxLive)
+            {
+                output = Json::Value(Json::StaticString("XBoxLive"));
+                return;
+            }
+            if (input == SegmentLoginIdentityProvider::SegmentLoginIdentityProviderPSN)
+            {
+                output = Json::Value(Json::StaticString("PSN"));
+                return;
+            }
+            if (input == SegmentLoginIdentityProvider::SegmentLoginIdentityProviderKongregate)
+            {
+                output = Json::Value(Json::StaticString("Kongregate"));
+                return;
+            }
+            if (input == SegmentLoginIdentityProvider::SegmentLoginIdentityProviderFacebook)
+            {
+                output = Json::Value(Json::StaticString("Facebook"));
+                return;
+            }
+            if (input == SegmentLoginIdentityProvider::SegmentLoginIdentityProviderIOSDevice)
+            {
+                output = Json::Value(Json::StaticString("IOSDevice"));
+                return;
+            }
+            if (input == SegmentLoginIdentityProvider::SegmentLoginIdentityProviderAndroidDevice)
+            {
+                output = Json::Value(Json::StaticString("AndroidDevice"));
+                return;
+            }
+            if (input == SegmentLoginIdentityProvider::SegmentLoginIdentityProviderTwitch)
+            {
+                output = Json::Value(Json::StaticString("Twitch"));
+                return;
+            }
+            if (input == SegmentLoginIdentityProvider::SegmentLoginIdentityProviderWindowsHello)
+            {
+                output = Json::Value(Json::StaticString("WindowsHello"));
+                return;
+            }
+            if (input == SegmentLoginIdentityProvider::SegmentLoginIdentityProviderGameServer)
+            {
+                output = Json::Value(Json::StaticString("GameServer"));
+                return;
+            }
+            if (input == SegmentLoginIdentityProvider::SegmentLoginIdentityProviderCustomServer)
+            {
+                output = Json::Value(Json::StaticString("CustomServer"));
+                return;
+            }
+            if (input == SegmentLoginIdentityProvider::SegmentLoginIdentityProviderNintendoSwitch)
+            {
+                output = Json::Value(Json::StaticString("NintendoSwitch"));
+                return;
+            }
+            if (input == SegmentLoginIdentityProvider::SegmentLoginIdentityProviderFacebookInstantGames)
+            {
+                output = Json::Value(Json::StaticString("FacebookInstantGames"));
+                return;
+            }
+            if (input == SegmentLoginIdentityProvider::SegmentLoginIdentityProviderOpenIdConnect)
+            {
+                output = Json::Value(Json::StaticString("OpenIdConnect"));
+                return;
+            }
+            if (input == SegmentLoginIdentityProvider::SegmentLoginIdentityProviderApple)
+            {
+                output = Json::Value(Json::StaticString("Apple"));
+                return;
+            }
+            if (input == SegmentLoginIdentityProvider::SegmentLoginIdentityProviderNintendoSwitchAccount)
+            {
+                output = Json::Value(Json::StaticString("NintendoSwitchAccount"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, SegmentLoginIdentityProvider& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Unknown")
+            {
+                output = SegmentLoginIdentityProvider::SegmentLoginIdentityProviderUnknown;
+                return;
+            }
+            if (inputStr == "PlayFab")
+            {
+                output = SegmentLoginIdentityProvider::SegmentLoginIdentityProviderPlayFab;
+                return;
+            }
+            if (inputStr == "Custom")
+            {
+                output = SegmentLoginIdentityProvider::SegmentLoginIdentityProviderCustom;
+                return;
+            }
+            if (inputStr == "GameCenter")
+            {
+                output = SegmentLoginIdentityProvider::SegmentLoginIdentityProviderGameCenter;
+                return;
+            }
+            if (inputStr == "GooglePlay")
+            {
+                output = SegmentLoginIdentityProvider::SegmentLoginIdentityProviderGooglePlay;
+                return;
+            }
+            if (inputStr == "Steam")
+            {
+                output = SegmentLoginIdentityProvider::SegmentLoginIdentityProviderSteam;
+                return;
+            }
+            if (inputStr == "XBoxLive")
+            {
+                output = SegmentLoginIdentityProvider::SegmentLoginIdentityProviderXBoxLive;
+                return;
+            }
+            if (inputStr == "PSN")
+            {
+                output = SegmentLoginIdentityProvider::SegmentLoginIdentityProviderPSN;
+                return;
+            }
+            if (inputStr == "Kongregate")
+            {
+                output = SegmentLoginIdentityProvider::SegmentLoginIdentityProviderKongregate;
+                return;
+            }
+            if (inputStr == "Facebook")
+            {
+                output = SegmentLoginIdentityProvider::SegmentLoginIdentityProviderFacebook;
+                return;
+            }
+            if (inputStr == "IOSDevice")
+            {
+                output = SegmentLoginIdentityProvider::SegmentLoginIdentityProviderIOSDevice;
+                return;
+            }
+            if (inputStr == "AndroidDevice")
+            {
+                output = SegmentLoginIdentityProvider::SegmentLoginIdentityProviderAndroidDevice;
+                return;
+            }
+            if (inputStr == "Twitch")
+            {
+                output = SegmentLoginIdentityProvider::SegmentLoginIdentityProviderTwitch;
+                return;
+            }
+            if (inputStr == "WindowsHello")
+            {
+                output = SegmentLoginIdentityProvider::SegmentLoginIdentityProviderWindowsHello;
+                return;
+            }
+            if (inputStr == "GameServer")
+            {
+                output = SegmentLoginIdentityProvider::SegmentLoginIdentityProviderGameServer;
+                return;
+            }
+            if (inputStr == "CustomServer")
+            {
+                output = SegmentLoginIdentityProvider::SegmentLoginIdentityProviderCustomServer;
+                return;
+            }
+            if (inputStr == "NintendoSwitch")
+            {
+                output = SegmentLoginIdentityProvider::SegmentLoginIdentityProviderNintendoSwitch;
+                return;
+            }
+            if (inputStr == "FacebookInstantGames")
+            {
+                output = SegmentLoginIdentityProvider::SegmentLoginIdentityProviderFacebookInstantGames;
+                return;
+            }
+            if (inputStr == "OpenIdConnect")
+            {
+                output = SegmentLoginIdentityProvider::SegmentLoginIdentityProviderOpenIdConnect;
+                return;
+            }
+            if (inputStr == "Apple")
+            {
+                output = SegmentLoginIdentityProvider::SegmentLoginIdentityProviderApple;
+                return;
+            }
+            if (inputStr == "NintendoSwitchAccount")
+            {
+                output = SegmentLoginIdentityProvider::SegmentLoginIdentityProviderNintendoSwitchAccount;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const SegmentPushNotificationDevicePlatform input, Json::Value& output)
+        {
+            if (input == SegmentPushNotificationDevicePlatform::SegmentPushNotificationDevicePlatformApplePushNotificationService)
+            {
+                output = Json::Value(Json::StaticString("ApplePushNotificationService"));
+                return;
+            }
+            if (input == SegmentPushNotificationDevicePlatform::SegmentPushNotificationDevicePlatformGoogleCloudMessaging)
+            {
+                output = Json::Value(Json::StaticString("GoogleCloudMessaging"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, SegmentPushNotificationDevicePlatform& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "ApplePushNotificationService")
+            {
+                output = SegmentPushNotificationDevicePlatform::SegmentPushNotificationDevicePlatformApplePushNotificationService;
+                return;
+            }
+            if (inputStr == "GoogleCloudMessaging")
+            {
+                output = SegmentPushNotificationDevicePlatform::SegmentPushNotificationDevicePlatformGoogleCloudMessaging;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const SourceType input, Json::Value& output)
+        {
+            if (input == SourceType::SourceTypeAdmin)
+            {
+                output = Json::Value(Json::StaticString("Admin"));
+                return;
+            }
+            if (input == SourceType::SourceTypeBackEnd)
+            {
+                output = Json::Value(Json::StaticString("BackEnd"));
+                return;
+            }
+            if (input == SourceType::SourceTypeGameClient)
+            {
+                output = Json::Value(Json::StaticString("GameClient"));
+                return;
+            }
+            if (input == SourceType::SourceTypeGameServer)
+            {
+                output = Json::Value(Json::StaticString("GameServer"));
+                return;
+            }
+            if (input == SourceType::SourceTypePartner)
+            {
+                output = Json::Value(Json::StaticString("Partner"));
+                return;
+            }
+            if (input == SourceType::SourceTypeCustom)
+            {
+                output = Json::Value(Json::StaticString("Custom"));
+                return;
+            }
+            if (input == SourceType::SourceTypeAPI)
+            {
+                output = Json::Value(Json::StaticString("API"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, SourceType& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Admin")
+            {
+                output = SourceType::SourceTypeAdmin;
+                return;
+            }
+            if (inputStr == "BackEnd")
+            {
+                output = SourceType::SourceTypeBackEnd;
+                return;
+            }
+            if (inputStr == "GameClient")
+            {
+                output = SourceType::SourceTypeGameClient;
+                return;
+            }
+            if (inputStr == "GameServer")
+            {
+                output = SourceType::SourceTypeGameServer;
+                return;
+            }
+            if (inputStr == "Partner")
+            {
+                output = SourceType::SourceTypePartner;
+                return;
+            }
+            if (inputStr == "Custom")
+            {
+                output = SourceType::SourceTypeCustom;
+                return;
+            }
+            if (inputStr == "API")
+            {
+                output = SourceType::SourceTypeAPI;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const StatisticAggregationMethod input, Json::Value& output)
+        {
+            if (input == StatisticAggregationMethod::StatisticAggregationMethodLast)
+            {
+                output = Json::Value(Json::StaticString("Last"));
+                return;
+            }
+            if (input == StatisticAggregationMethod::StatisticAggregationMethodMin)
+            {
+                output = Json::Value(Json::StaticString("Min"));
+                return;
+            }
+            if (input == StatisticAggregationMethod::StatisticAggregationMethodMax)
+            {
+                output = Json::Value(Json::StaticString("Max"));
+                return;
+            }
+            if (input == StatisticAggregationMethod::StatisticAggregationMethodSum)
+            {
+                output = Json::Value(Json::StaticString("Sum"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, StatisticAggregationMethod& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Last")
+            {
+                output = StatisticAggregationMethod::StatisticAggregationMethodLast;
+                return;
+            }
+            if (inputStr == "Min")
+            {
+                output = StatisticAggregationMethod::StatisticAggregationMethodMin;
+                return;
+            }
+            if (inputStr == "Max")
+            {
+                output = StatisticAggregationMethod::StatisticAggregationMethodMax;
+                return;
+            }
+            if (inputStr == "Sum")
+            {
+                output = StatisticAggregationMethod::StatisticAggregationMethodSum;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const StatisticResetIntervalOption input, Json::Value& output)
+        {
+            if (input == StatisticResetIntervalOption::StatisticResetIntervalOptionNever)
+            {
+                output = Json::Value(Json::StaticString("Never"));
+                return;
+            }
+            if (input == StatisticResetIntervalOption::StatisticResetIntervalOptionHour)
+            {
+                output = Json::Value(Json::StaticString("Hour"));
+                return;
+            }
+            if (input == StatisticResetIntervalOption::StatisticResetIntervalOptionDay)
+            {
+                output = Json::Value(Json::StaticString("Day"));
+                return;
+            }
+            if (input == StatisticResetIntervalOption::StatisticResetIntervalOptionWeek)
+            {
+                output = Json::Value(Json::StaticString("Week"));
+                return;
+            }
+            if (input == StatisticResetIntervalOption::StatisticResetIntervalOptionMonth)
+            {
+                output = Json::Value(Json::StaticString("Month"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, StatisticResetIntervalOption& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Never")
+            {
+                output = StatisticResetIntervalOption::StatisticResetIntervalOptionNever;
+                return;
+            }
+            if (inputStr == "Hour")
+            {
+                output = StatisticResetIntervalOption::StatisticResetIntervalOptionHour;
+                return;
+            }
+            if (inputStr == "Day")
+            {
+                output = StatisticResetIntervalOption::StatisticResetIntervalOptionDay;
+                return;
+            }
+            if (inputStr == "Week")
+            {
+                output = StatisticResetIntervalOption::StatisticResetIntervalOptionWeek;
+                return;
+            }
+            if (inputStr == "Month")
+            {
+                output = StatisticResetIntervalOption::StatisticResetIntervalOptionMonth;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const StatisticVersionArchivalStatus input, Json::Value& output)
+        {
+            if (input == StatisticVersionArchivalStatus::StatisticVersionArchivalStatusNotScheduled)
+            {
+                output = Json::Value(Json::StaticString("NotScheduled"));
+                return;
+            }
+            if (input == StatisticVersionArchivalStatus::StatisticVersionArchivalStatusScheduled)
+            {
+                output = Json::Value(Json::StaticString("Scheduled"));
+                return;
+            }
+            if (input == StatisticVersionArchivalStatus::StatisticVersionArchivalStatusQueued)
+            {
+                output = Json::Value(Json::StaticString("Queued"));
+                return;
+            }
+            if (input == StatisticVersionArchivalStatus::StatisticVersionArchivalStatusInProgress)
+            {
+                output = Json::Value(Json::StaticString("InProgress"));
+                return;
+            }
+            if (input == StatisticVersionArchivalStatus::StatisticVersionArchivalStatusComplete)
+            {
+                output = Json::Value(Json::StaticString("Complete"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, StatisticVersionArchivalStatus& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "NotScheduled")
+            {
+                output = StatisticVersionArchivalStatus::StatisticVersionArchivalStatusNotScheduled;
+                return;
+            }
+            if (inputStr == "Scheduled")
+            {
+                output = StatisticVersionArchivalStatus::StatisticVersionArchivalStatusScheduled;
+                return;
+            }
+            if (inputStr == "Queued")
+            {
+                output = StatisticVersionArchivalStatus::StatisticVersionArchivalStatusQueued;
+                return;
+            }
+            if (inputStr == "InProgress")
+            {
+                output = StatisticVersionArchivalStatus::StatisticVersionArchivalStatusInProgress;
+                return;
+            }
+            if (inputStr == "Complete")
+            {
+                output = StatisticVersionArchivalStatus::StatisticVersionArchivalStatusComplete;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const StatisticVersionStatus input, Json::Value& output)
+        {
+            if (input == StatisticVersionStatus::StatisticVersionStatusActive)
+            {
+                output = Json::Value(Json::StaticString("Active"));
+                return;
+            }
+            if (input == StatisticVersionStatus::StatisticVersionStatusSnapshotPending)
+            {
+                output = Json::Value(Json::StaticString("SnapshotPending"));
+                return;
+            }
+            if (input == StatisticVersionStatus::StatisticVersionStatusSnapshot)
+            {
+                output = Json::Value(Json::StaticString("Snapshot"));
+                return;
+            }
+            if (input == StatisticVersionStatus::StatisticVersionStatusArchivalPending)
+            {
+                output = Json::Value(Json::StaticString("ArchivalPending"));
+                return;
+            }
+            if (input == StatisticVersionStatus::StatisticVersionStatusArchived)
+            {
+                output = Json::Value(Json::StaticString("Archived"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, StatisticVersionStatus& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Active")
+            {
+                output = StatisticVersionStatus::StatisticVersionStatusActive;
+                return;
+            }
+            if (inputStr == "SnapshotPending")
+            {
+                output = StatisticVersionStatus::StatisticVersionStatusSnapshotPending;
+                return;
+            }
+            if (inputStr == "Snapshot")
+            {
+                output = StatisticVersionStatus::StatisticVersionStatusSnapshot;
+                return;
+            }
+            if (inputStr == "ArchivalPending")
+            {
+                output = StatisticVersionStatus::StatisticVersionStatusArchivalPending;
+                return;
+            }
+            if (inputStr == "Archived")
+            {
+                output = StatisticVersionStatus::StatisticVersionStatusArchived;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const SubscriptionProviderStatus input, Json::Value& output)
+        {
+            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusNoError)
+            {
+                output = Json::Value(Json::StaticString("NoError"));
+                return;
+            }
+            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusCancelled)
+            {
+                output = Json::Value(Json::StaticString("Cancelled"));
+                return;
+            }
+            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusUnknownError)
+            {
+                output = Json::Value(Json::StaticString("UnknownError"));
+                return;
+            }
+            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusBillingError)
+            {
+                output = Json::Value(Json::StaticString("BillingError"));
+                return;
+            }
+            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusProductUnavailable)
+            {
+                output = Json::Value(Json::StaticString("ProductUnavailable"));
+                return;
+            }
+            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusCustomerDidNotAcceptPriceChange)
+            {
+                output = Json::Value(Json::StaticString("CustomerDidNotAcceptPriceChange"));
+                return;
+            }
+            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusFreeTrial)
+            {
+                output = Json::Value(Json::StaticString("FreeTrial"));
+                return;
+            }
+            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusPaymentPending)
+            {
+                output = Json::Value(Json::StaticString("PaymentPending"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, SubscriptionProviderStatus& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "NoError")
+            {
+                output = SubscriptionProviderStatus::SubscriptionProviderStatusNoError;
+                return;
+            }
+            if (inputStr == "Cancelled")
+            {
+                output = SubscriptionProviderStatus::SubscriptionProviderStatusCancelled;
+                return;
+            }
+            if (inputStr == "UnknownError")
+            {
+                output = SubscriptionProviderStatus::SubscriptionProviderStatusUnknownError;
+                return;
+            }
+            if (inputStr == "BillingError")
+            {
+                output = SubscriptionProviderStatus::SubscriptionProviderStatusBillingError;
+                return;
+            }
+            if (inputStr == "ProductUnavailable")
+            {
+                output = SubscriptionProviderStatus::SubscriptionProviderStatusProductUnavailable;
+                return;
+            }
+            if (inputStr == "CustomerDidNotAcceptPriceChange")
+            {
+                output = SubscriptionProviderStatus::SubscriptionProviderStatusCustomerDidNotAcceptPriceChange;
+                return;
+            }
+            if (inputStr == "FreeTrial")
+            {
+                output = SubscriptionProviderStatus::SubscriptionProviderStatusFreeTrial;
+                return;
+            }
+            if (inputStr == "PaymentPending")
+            {
+                output = SubscriptionProviderStatus::SubscriptionProviderStatusPaymentPending;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const TaskInstanceStatus input, Json::Value& output)
+        {
+            if (input == TaskInstanceStatus::TaskInstanceStatusSucceeded)
+            {
+                output = Json::Value(Json::StaticString("Succeeded"));
+                return;
+            }
+            if (input == TaskInstanceStatus::TaskInstanceStatusStarting)
+            {
+                output = Json::Value(Json::StaticString("Starting"));
+                return;
+            }
+            if (input == TaskInstanceStatus::TaskInstanceStatusInProgress)
+            {
+                output = Json::Value(Json::StaticString("InProgress"));
+                return;
+            }
+            if (input == TaskInstanceStatus::TaskInstanceStatusFailed)
+            {
+                output = Json::Value(Json::StaticString("Failed"));
+                return;
+            }
+            if (input == TaskInstanceStatus::TaskInstanceStatusAborted)
+            {
+                output = Json::Value(Json::StaticString("Aborted"));
+                return;
+            }
+            if (input == TaskInstanceStatus::TaskInstanceStatusStalled)
+            {
+                output = Json::Value(Json::StaticString("Stalled"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, TaskInstanceStatus& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Succeeded")
+            {
+                output = TaskInstanceStatus::TaskInstanceStatusSucceeded;
+                return;
+            }
+            if (inputStr == "Starting")
+            {
+                output = TaskInstanceStatus::TaskInstanceStatusStarting;
+                return;
+            }
+            if (inputStr == "InProgress")
+            {
+                output = TaskInstanceStatus::TaskInstanceStatusInProgress;
+                return;
+            }
+            if (inputStr == "Failed")
+            {
+                output = TaskInstanceStatus::TaskInstanceStatusFailed;
+                return;
+            }
+            if (inputStr == "Aborted")
+            {
+                output = TaskInstanceStatus::TaskInstanceStatusAborted;
+                return;
+            }
+            if (inputStr == "Stalled")
+            {
+                output = TaskInstanceStatus::TaskInstanceStatusStalled;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const TitleActivationStatus input, Json::Value& output)
+        {
+            if (input == TitleActivationStatus::TitleActivationStatusNone)
+            {
+                output = Json::Value(Json::StaticString("None"));
+                return;
+            }
+            if (input == TitleActivationStatus::TitleActivationStatusActivatedTitleKey)
+            {
+                output = Json::Value(Json::StaticString("ActivatedTitleKey"));
+                return;
+            }
+            if (input == TitleActivationStatus::TitleActivationStatusPendingSteam)
+            {
+                output = Json::Value(Json::StaticString("PendingSteam"));
+                return;
+            }
+            if (input == TitleActivationStatus::TitleActivationStatusActivatedSteam)
+            {
+                output = Json::Value(Json::StaticString("ActivatedSteam"));
+                return;
+            }
+            if (input == TitleActivationStatus::TitleActivationStatusRevokedSteam)
+            {
+                output = Json::Value(Json::StaticString("RevokedSteam"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, TitleActivationStatus& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "None")
+            {
+                output = TitleActivationStatus::TitleActivationStatusNone;
+                return;
+            }
+            if (inputStr == "ActivatedTitleKey")
+            {
+                output = TitleActivationStatus::TitleActivationStatusActivatedTitleKey;
+                return;
+            }
+            if (inputStr == "PendingSteam")
+            {
+                output = TitleActivationStatus::TitleActivationStatusPendingSteam;
+                return;
+            }
+            if (inputStr == "ActivatedSteam")
+            {
+                output = TitleActivationStatus::TitleActivationStatusActivatedSteam;
+                return;
+            }
+            if (inputStr == "RevokedSteam")
+            {
+                output = TitleActivationStatus::TitleActivationStatusRevokedSteam;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const UserDataPermission input, Json::Value& output)
+        {
+            if (input == UserDataPermission::UserDataPermissionPrivate)
+            {
+                output = Json::Value(Json::StaticString("Private"));
+                return;
+            }
+            if (input == UserDataPermission::UserDataPermissionPublic)
+            {
+                output = Json::Value(Json::StaticString("Public"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, UserDataPermission& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Private")
+            {
+                output = UserDataPermission::UserDataPermissionPrivate;
+                return;
+            }
+            if (inputStr == "Public")
+            {
+                output = UserDataPermission::UserDataPermissionPublic;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const UserOrigination input, Json::Value& output)
+        {
+            if (input == UserOrigination::UserOriginationOrganic)
+            {
+                output = Json::Value(Json::StaticString("Organic"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationSteam)
+            {
+                output = Json::Value(Json::StaticString("Steam"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationGoogle)
+            {
+                output = Json::Value(Json::StaticString("Google"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationAmazon)
+            {
+                output = Json::Value(Json::StaticString("Amazon"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationFacebook)
+            {
+                output = Json::Value(Json::StaticString("Facebook"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationKongregate)
+            {
+                output = Json::Value(Json::StaticString("Kongregate"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationGamersFirst)
+            {
+                output = Json::Value(Json::StaticString("GamersFirst"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationUnknown)
+            {
+                output = Json::Value(Json::StaticString("Unknown"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationIOS)
+            {
+                output = Json::Value(Json::StaticString("IOS"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationLoadTest)
+            {
+                output = Json::Value(Json::StaticString("LoadTest"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationAndroid)
+            {
+                output = Json::Value(Json::StaticString("Android"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationPSN)
+            {
+                output = Json::Value(Json::StaticString("PSN"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationGameCenter)
+            {
+                output = Json::Value(Json::StaticString("GameCenter"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationCustomId)
+            {
+                output = Json::Value(Json::StaticString("CustomId"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationXboxLive)
+            {
+                output = Json::Value(Json::StaticString("XboxLive"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationParse)
+            {
+                output = Json::Value(Json::StaticString("Parse"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationTwitch)
+            {
+                output = Json::Value(Json::StaticString("Twitch"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationWindowsHello)
+            {
+                output = Json::Value(Json::StaticString("WindowsHello"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationServerCustomId)
+            {
+                output = Json::Value(Json::StaticString("ServerCustomId"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationNintendoSwitchDeviceId)
+            {
+                output = Json::Value(Json::StaticString("NintendoSwitchDeviceId"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationFacebookInstantGamesId)
+            {
+                output = Json::Value(Json::StaticString("FacebookInstantGamesId"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationOpenIdConnect)
+            {
+                output = Json::Value(Json::StaticString("OpenIdConnect"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationApple)
+            {
+                output = Json::Value(Json::StaticString("Apple"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationNintendoSwitchAccount)
+            {
+                output = Json::Value(Json::StaticString("NintendoSwitchAccount"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, UserOrigination& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Organic")
+            {
+                output = UserOrigination::UserOriginationOrganic;
+                return;
+            }
+            if (inputStr == "Steam")
+            {
+                output = UserOrigination::UserOriginationSteam;
+                return;
+            }
+            if (inputStr == "Google")
+            {
+                output = UserOrigination::UserOriginationGoogle;
+                return;
+            }
+            if (inputStr == "Amazon")
+            {
+                output = UserOrigination::UserOriginationAmazon;
+                return;
+            }
+            if (inputStr == "Facebook")
+            {
+                output = UserOrigination::UserOriginationFacebook;
+                return;
+            }
+            if (inputStr == "Kongregate")
+            {
+                output = UserOrigination::UserOriginationKongregate;
+                return;
+            }
+            if (inputStr == "GamersFirst")
+            {
+                output = UserOrigination::UserOriginationGamersFirst;
+                return;
+            }
+            if (inputStr == "Unknown")
+            {
+                output = UserOrigination::UserOriginationUnknown;
+                return;
+            }
+            if (inputStr == "IOS")
+            {
+                output = UserOrigination::UserOriginationIOS;
+                return;
+            }
+            if (inputStr == "LoadTest")
+            {
+                output = UserOrigination::UserOriginationLoadTest;
+                return;
+            }
+            if (inputStr == "Android")
+            {
+                output = UserOrigination::UserOriginationAndroid;
+                return;
+            }
+            if (inputStr == "PSN")
+            {
+                output = UserOrigination::UserOriginationPSN;
+                return;
+            }
+            if (inputStr == "GameCenter")
+            {
+                output = UserOrigination::UserOriginationGameCenter;
+                return;
+            }
+            if (inputStr == "CustomId")
+            {
+                output = UserOrigination::UserOriginationCustomId;
+                return;
+            }
+            if (inputStr == "XboxLive")
+            {
+                output = UserOrigination::UserOriginationXboxLive;
+                return;
+            }
+            if (inputStr == "Parse")
+            {
+                output = UserOrigination::UserOriginationParse;
+                return;
+            }
+            if (inputStr == "Twitch")
+            {
+                output = UserOrigination::UserOriginationTwitch;
+                return;
+            }
+            if (inputStr == "WindowsHello")
+            {
+                output = UserOrigination::UserOriginationWindowsHello;
+                return;
+            }
+            if (inputStr == "ServerCustomId")
+            {
+                output = UserOrigination::UserOriginationServerCustomId;
+                return;
+            }
+            if (inputStr == "NintendoSwitchDeviceId")
+            {
+                output = UserOrigination::UserOriginationNintendoSwitchDeviceId;
+                return;
+            }
+            if (inputStr == "FacebookInstantGamesId")
+            {
+                output = UserOrigination::UserOriginationFacebookInstantGamesId;
+                return;
+            }
+            if (inputStr == "OpenIdConnect")
+            {
+                output = UserOrigination::UserOriginationOpenIdConnect;
+                return;
+            }
+            if (inputStr == "Apple")
+            {
+                output = UserOrigination::UserOriginationApple;
+                return;
+            }
+            if (inputStr == "NintendoSwitchAccount")
+            {
+                output = UserOrigination::UserOriginationNintendoSwitchAccount;
+                return;
+            }
+        }
+
+        void AbortTaskInstanceRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyTaskInstanceId), TaskInstanceId);
+        }
+
+        Json::Value AbortTaskInstanceRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_TaskInstanceId; ToJsonUtilS(TaskInstanceId, each_TaskInstanceId); ToJsonField(output, keyTaskInstanceId) = each_TaskInstanceId;
+            return output;
+        }
+
+        void ActionsOnPlayersInSegmentTaskParameter::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyActionId), ActionId);
+            FromJsonUtilS(FromJsonField(input, keySegmentId), SegmentId);
+        }
+
+        Json::Value ActionsOnPlayersInSegmentTaskParameter::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ActionId; ToJsonUtilS(ActionId, each_ActionId); ToJsonField(output, keyActionId) = each_ActionId;
+            Json::Value each_SegmentId; ToJsonUtilS(SegmentId, each_SegmentId); ToJsonField(output, keySegmentId) = each_SegmentId;
+            return output;
+        }
+
+        void NameIdentifier::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyId), Id);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+        }
+
+        Json::Value NameIdentifier::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Id; ToJsonUtilS(Id, each_Id); ToJsonField(output, keyId) = each_Id;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            return output;
+        }
+
+        void ActionsOnPlayersInSegmentTaskSummary::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilT(FromJsonField(input, keyCompletedAt), CompletedAt);
+            FromJsonUtilS(FromJsonField(input, keyErrorMessage), ErrorMessage);
+            FromJsonUtilP(FromJsonField(input, keyErrorWasFatal), ErrorWasFatal);
+            FromJsonUtilP(FromJsonField(input, keyEstimatedSecondsRemaining), EstimatedSecondsRemaining);
+            FromJsonUtilP(FromJsonField(input, keyPercentComplete), PercentComplete);
+            FromJsonUtilS(FromJsonField(input, keyScheduledByUserId), ScheduledByUserId);
+            FromJsonUtilT(FromJsonField(input, keyStartedAt), StartedAt);
+            FromJsonUtilE(FromJsonField(input, keyStatus), Status);
+            FromJsonUtilO(FromJsonField(input, keyTaskIdentifier), TaskIdentifier);
+            FromJsonUtilS(FromJsonField(input, keyTaskInstanceId), TaskInstanceId);
+            FromJsonUtilP(FromJsonField(input, keyTotalPlayersInSegment), TotalPlayersInSegment);
+            FromJsonUtilP(FromJsonField(input, keyTotalPlayersProcessed), TotalPlayersProcessed);
+        }
+
+        Json::Value ActionsOnPlayersInSegmentTaskSummary::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CompletedAt; ToJsonUtilT(CompletedAt, each_CompletedAt); ToJsonField(output, keyCompletedAt) = each_CompletedAt;
+            Json::Value each_ErrorMessage; ToJsonUtilS(ErrorMessage, each_ErrorMessage); ToJsonField(output, keyErrorMessage) = each_ErrorMessage;
+            Json::Value each_ErrorWasFatal; ToJsonUtilP(ErrorWasFatal, each_ErrorWasFatal); ToJsonField(output, keyErrorWasFatal) = each_ErrorWasFatal;
+            Json::Value each_EstimatedSecondsRemaining; ToJsonUtilP(EstimatedSecondsRemaining, each_EstimatedSecondsRemaining); ToJsonField(output, keyEstimatedSecondsRemaining) = each_EstimatedSecondsRemaining;
+            Json::Value each_PercentComplete; ToJsonUtilP(PercentComplete, each_PercentComplete); ToJsonField(output, keyPercentComplete) = each_PercentComplete;
+            Json::Value each_ScheduledByUserId; ToJsonUtilS(ScheduledByUserId, each_ScheduledByUserId); ToJsonField(output, keyScheduledByUserId) = each_ScheduledByUserId;
+            Json::Value each_StartedAt; ToJsonUtilT(StartedAt, each_StartedAt); ToJsonField(output, keyStartedAt) = each_StartedAt;
+            Json::Value each_Status; ToJsonUtilE(Status, each_Status); ToJsonField(output, keyStatus) = each_Status;
+            Json::Value each_TaskIdentifier; ToJsonUtilO(TaskIdentifier, each_TaskIdentifier); ToJsonField(output, keyTaskIdentifier) = each_TaskIdentifier;
+            Json::Value each_TaskInstanceId; ToJsonUtilS(TaskInstanceId, each_TaskInstanceId); ToJsonField(output, keyTaskInstanceId) = each_TaskInstanceId;
+            Json::Value each_TotalPlayersInSegment; ToJsonUtilP(TotalPlayersInSegment, each_TotalPlayersInSegment); ToJsonField(output, keyTotalPlayersInSegment) = each_TotalPlayersInSegment;
+            Json::Value each_TotalPlayersProcessed; ToJsonUtilP(TotalPlayersProcessed, each_TotalPlayersProcessed); ToJsonField(output, keyTotalPlayersProcessed) = each_TotalPlayersProcessed;
+            return output;
+        }
+
+        void AdCampaignAttribution::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilT(FromJsonField(input, keyAttributedAt), AttributedAt);
+            FromJsonUtilS(FromJsonField(input, keyCampaignId), CampaignId);
+            FromJsonUtilS(FromJsonField(input, keyPlatform), Platform);
+        }
+
+        Json::Value AdCampaignAttribution::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AttributedAt; ToJsonUtilT(AttributedAt, each_AttributedAt); ToJsonField(output, keyAttributedAt) = each_AttributedAt;
+            Json::Value each_CampaignId; ToJsonUtilS(CampaignId, each_CampaignId); ToJsonField(output, keyCampaignId) = each_CampaignId;
+            Json::Value each_Platform; ToJsonUtilS(Platform, each_Platform); ToJsonField(output, keyPlatform) = each_Platform;
+            return output;
+        }
+
+        void AdCampaignAttributionModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilT(FromJsonField(input, keyAttributedAt), AttributedAt);
+            FromJsonUtilS(FromJsonField(input, keyCampaignId), CampaignId);
+            FromJsonUtilS(FromJsonField(input, keyPlatform), Platform);
+        }
+
+        Json::Value AdCampaignAttributionModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AttributedAt; ToJsonUtilT(AttributedAt, each_AttributedAt); ToJsonField(output, keyAttributedAt) = each_AttributedAt;
+            Json::Value each_CampaignId; ToJsonUtilS(CampaignId, each_CampaignId); ToJsonField(output, keyCampaignId) = each_CampaignId;
+            Json::Value each_Platform; ToJsonUtilS(Platform, each_Platform); ToJsonField(output, keyPlatform) = each_Platform;
+            return output;
+        }
+
+        void AdCampaignSegmentFilter::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCampaignId), CampaignId);
+            FromJsonUtilS(FromJsonField(input, keyCampaignSource), CampaignSource);
+            FromJsonUtilE(FromJsonField(input, keyComparison), Comparison);
+        }
+
+        Json::Value AdCampaignSegmentFilter::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CampaignId; ToJsonUtilS(CampaignId, each_CampaignId); ToJsonField(output, keyCampaignId) = each_CampaignId;
+            Json::Value each_CampaignSource; ToJsonUtilS(CampaignSource, each_CampaignSource); ToJsonField(output, keyCampaignSource) = each_CampaignSource;
+            Json::Value each_Comparison; ToJsonUtilE(Comparison, each_Comparison); ToJsonField(output, keyComparison) = each_Comparison;
+            return output;
+        }
+
+        void AddLocalizedNewsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBody), Body);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyLanguage), Language);
+            FromJsonUtilS(FromJsonField(input, keyNewsId), NewsId);
+            FromJsonUtilS(FromJsonField(input, keyTitle), Title);
+        }
+
+        Json::Value AddLocalizedNewsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Body; ToJsonUtilS(Body, each_Body); ToJsonField(output, keyBody) = each_Body;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Language; ToJsonUtilS(Language, each_Language); ToJsonField(output, keyLanguage) = each_Language;
+            Json::Value each_NewsId; ToJsonUtilS(NewsId, each_NewsId); ToJsonField(output, keyNewsId) = each_NewsId;
+            Json::Value each_Title; ToJsonUtilS(Title, each_Title); ToJsonField(output, keyTitle) = each_Title;
+            return output;
+        }
+
+        void AddLocalizedNewsResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value AddLocalizedNewsResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void AddNewsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBody), Body);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilT(FromJsonField(input, keyTimestamp), Timestamp);
+            FromJsonUtilS(FromJsonField(input, keyTitle), Title);
+        }
+
+        Json::Value AddNewsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Body; ToJsonUtilS(Body, each_Body); ToJsonField(output, keyBody) = each_Body;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Timestamp; ToJsonUtilT(Timestamp, each_Timestamp); ToJsonField(output, keyTimestamp) = each_Timestamp;
+            Json::Value each_Title; ToJsonUtilS(Title, each_Title); ToJsonField(output, keyTitle) = each_Title;
+            return output;
+        }
+
+        void AddNewsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyNewsId), NewsId);
+        }
+
+        Json::Value AddNewsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_NewsId; ToJsonUtilS(NewsId, each_NewsId); ToJsonField(output, keyNewsId) = each_NewsId;
+            return output;
+        }
+
+        void AddPlayerTagRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyTagName), TagName);
+        }
+
+        Json::Value AddPlayerTagRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_TagName; ToJsonUtilS(TagName, each_TagName); ToJsonField(output, keyTagName) = each_TagName;
+            return output;
+        }
+
+        void AddPlayerTagResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value AddPlayerTagResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void AddServerBuildRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilE(FromJsonField(input, keyActiveRegions), ActiveRegions);
+            FromJsonUtilS(FromJsonField(input, keyBuildId), BuildId);
+            FromJsonUtilS(FromJsonField(input, keyCommandLineTemplate), CommandLineTemplate);
+            FromJsonUtilS(FromJsonField(input, keyComment), Comment);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyExecutablePath), ExecutablePath);
+            FromJsonUtilP(FromJsonField(input, keyMaxGamesPerHost), MaxGamesPerHost);
+            FromJsonUtilP(FromJsonField(input, keyMinFreeGameSlots), MinFreeGameSlots);
+        }
+
+        Json::Value AddServerBuildRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ActiveRegions; ToJsonUtilE(ActiveRegions, each_ActiveRegions); ToJsonField(output, keyActiveRegions) = each_ActiveRegions;
+            Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); ToJsonField(output, keyBuildId) = each_BuildId;
+            Json::Value each_CommandLineTemplate; ToJsonUtilS(CommandLineTemplate, each_CommandLineTemplate); ToJsonField(output, keyCommandLineTemplate) = each_CommandLineTemplate;
+            Json::Value each_Comment; ToJsonUtilS(Comment, each_Comment); ToJsonField(output, keyComment) = each_Comment;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ExecutablePath; ToJsonUtilS(ExecutablePath, each_ExecutablePath); ToJsonField(output, keyExecutablePath) = each_ExecutablePath;
+            Json::Value each_MaxGamesPerHost; ToJsonUtilP(MaxGamesPerHost, each_MaxGamesPerHost); ToJsonField(output, keyMaxGamesPerHost) = each_MaxGamesPerHost;
+            Json::Value each_MinFreeGameSlots; ToJsonUtilP(MinFreeGameSlots, each_MinFreeGameSlots); ToJsonField(output, keyMinFreeGameSlots) = each_MinFreeGameSlots;
+            return output;
+        }
+
+        void AddServerBuildResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilE(FromJsonField(input, keyActiveRegions), ActiveRegions);
+            FromJsonUtilS(FromJsonField(input, keyBuildId), BuildId);
+            FromJsonUtilS(FromJsonField(input, keyCommandLineTemplate), CommandLineTemplate);
+            FromJsonUtilS(FromJsonField(input, keyComment), Comment);
+            FromJsonUtilS(FromJsonField(input, keyExecutablePath), ExecutablePath);
+            FromJsonUtilP(FromJsonField(input, keyMaxGamesPerHost), MaxGamesPerHost);
+            FromJsonUtilP(FromJsonField(input, keyMinFreeGameSlots), MinFreeGameSlots);
+            FromJsonUtilE(FromJsonField(input, keyStatus), Status);
+            FromJsonUtilT(FromJsonField(input, keyTimestamp), Timestamp);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+        }
+
+        Json::Value AddServerBuildResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ActiveRegions; ToJsonUtilE(ActiveRegions, each_ActiveRegions); ToJsonField(output, keyActiveRegions) = each_ActiveRegions;
+            Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); ToJsonField(output, keyBuildId) = each_BuildId;
+            Json::Value each_CommandLineTemplate; ToJsonUtilS(CommandLineTemplate, each_CommandLineTemplate); ToJsonField(output, keyCommandLineTemplate) = each_CommandLineTemplate;
+            Json::Value each_Comment; ToJsonUtilS(Comment, each_Comment); ToJsonField(output, keyComment) = each_Comment;
+            Json::Value each_ExecutablePath; ToJsonUtilS(ExecutablePath, each_ExecutablePath); ToJsonField(output, keyExecutablePath) = each_ExecutablePath;
+            Json::Value each_MaxGamesPerHost; ToJsonUtilP(MaxGamesPerHost, each_MaxGamesPerHost); ToJsonField(output, keyMaxGamesPerHost) = each_MaxGamesPerHost;
+            Json::Value each_MinFreeGameSlots; ToJsonUtilP(MinFreeGameSlots, each_MinFreeGameSlots); ToJsonField(output, keyMinFreeGameSlots) = each_MinFreeGameSlots;
+            Json::Value each_Status; ToJsonUtilE(Status, each_Status); ToJsonField(output, keyStatus) = each_Status;
+            Json::Value each_Timestamp; ToJsonUtilT(Timestamp, each_Timestamp); ToJsonField(output, keyTimestamp) = each_Timestamp;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            return output;
+        }
+
+        void AddUserVirtualCurrencyRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyAmount), Amount);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyVirtualCurrency), VirtualCurrency);
+        }
+
+        Json::Value AddUserVirtualCurrencyRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Amount; ToJsonUtilP(Amount, each_Amount); ToJsonField(output, keyAmount) = each_Amount;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_VirtualCurrency; ToJsonUtilS(VirtualCurrency, each_VirtualCurrency); ToJsonField(output, keyVirtualCurrency) = each_VirtualCurrency;
+            return output;
+        }
+
+        void VirtualCurrencyData::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCurrencyCode), CurrencyCode);
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+            FromJsonUtilP(FromJsonField(input, keyInitialDeposit), InitialDeposit);
+            FromJsonUtilP(FromJsonField(input, keyRechargeMax), RechargeMax);
+            FromJsonUtilP(FromJsonField(input, keyRechargeRate), RechargeRate);
+        }
+
+        Json::Value VirtualCurrencyData::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CurrencyCode; ToJsonUtilS(CurrencyCode, each_CurrencyCode); ToJsonField(output, keyCurrencyCode) = each_CurrencyCode;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            Json::Value each_InitialDeposit; ToJsonUtilP(InitialDeposit, each_InitialDeposit); ToJsonField(output, keyInitialDeposit) = each_InitialDeposit;
+            Json::Value each_RechargeMax; ToJsonUtilP(RechargeMax, each_RechargeMax); ToJsonField(output, keyRechargeMax) = each_RechargeMax;
+            Json::Value each_RechargeRate; ToJsonUtilP(RechargeRate, each_RechargeRate); ToJsonField(output, keyRechargeRate) = each_RechargeRate;
+            return output;
+        }
+
+        void AddVirtualCurrencyTypesRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyVirtualCurrencies), VirtualCurrencies);
+        }
+
+        Json::Value AddVirtualCurrencyTypesRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_VirtualCurrencies; ToJsonUtilO(VirtualCurrencies, each_VirtualCurrencies); ToJsonField(output, keyVirtualCurrencies) = each_VirtualCurrencies;
+            return output;
+        }
+
+        void AllPlayersSegmentFilter::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value AllPlayersSegmentFilter::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void ApiCondition::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilE(FromJsonField(input, keyHasSignatureOrEncryption), HasSignatureOrEncryption);
+        }
+
+        Json::Value ApiCondition::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_HasSignatureOrEncryption; ToJsonUtilE(HasSignatureOrEncryption, each_HasSignatureOrEncryption); ToJsonField(output, keyHasSignatureOrEncryption) = each_HasSignatureOrEncryption;
+            return output;
+        }
+
+        void BanInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyActive), Active);
+            FromJsonUtilS(FromJsonField(input, keyBanId), BanId);
+            FromJsonUtilT(FromJsonField(input, keyCreated), Created);
+            FromJsonUtilT(FromJsonField(input, keyExpires), Expires);
+            FromJsonUtilS(FromJsonField(input, keyIPAddress), IPAddress);
+            FromJsonUtilS(FromJsonField(input, keyMACAddress), MACAddress);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyReason), Reason);
+        }
+
+        Json::Value BanInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Active; ToJsonUtilP(Active, each_Active); ToJsonField(output, keyActive) = each_Active;
+            Json::Value each_BanId; ToJsonUtilS(BanId, each_BanId); ToJsonField(output, keyBanId) = each_BanId;
+            Json::Value each_Created; ToJsonUtilT(Created, each_Created); ToJsonField(output, keyCreated) = each_Created;
+            Json::Value each_Expires; ToJsonUtilT(Expires, each_Expires); ToJsonField(output, keyExpires) = each_Expires;
+            Json::Value each_IPAddress; ToJsonUtilS(IPAddress, each_IPAddress); ToJsonField(output, keyIPAddress) = each_IPAddress;
+            Json::Value each_MACAddress; ToJsonUtilS(MACAddress, each_MACAddress); ToJsonField(output, keyMACAddress) = each_MACAddress;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_Reason; ToJsonUtilS(Reason, each_Reason); ToJsonField(output, keyReason) = each_Reason;
+            return output;
+        }
+
+        void BanPlayerSegmentAction::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyBanHours), BanHours);
+            FromJsonUtilS(FromJsonField(input, keyReasonForBan), ReasonForBan);
+        }
+
+        Json::Value BanPlayerSegmentAction::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BanHours; ToJsonUtilP(BanHours, each_BanHours); ToJsonField(output, keyBanHours) = each_BanHours;
+            Json::Value each_ReasonForBan; ToJsonUtilS(ReasonForBan, each_ReasonForBan); ToJsonField(output, keyReasonForBan) = each_ReasonForBan;
+            return output;
+        }
+
+        void BanRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyDurationInHours), DurationInHours);
+            FromJsonUtilS(FromJsonField(input, keyIPAddress), IPAddress);
+            FromJsonUtilS(FromJsonField(input, keyMACAddress), MACAddress);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyReason), Reason);
+        }
+
+        Json::Value BanRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_DurationInHours; ToJsonUtilP(DurationInHours, each_DurationInHours); ToJsonField(output, keyDurationInHours) = each_DurationInHours;
+            Json::Value each_IPAddress; ToJsonUtilS(IPAddress, each_IPAddress); ToJsonField(output, keyIPAddress) = each_IPAddress;
+            Json::Value each_MACAddress; ToJsonUtilS(MACAddress, each_MACAddress); ToJsonField(output, keyMACAddress) = each_MACAddress;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_Reason; ToJsonUtilS(Reason, each_Reason); ToJsonField(output, keyReason) = each_Reason;
+            return output;
+        }
+
+        void BanUsersRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyBans), Bans);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value BanUsersRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Bans; ToJsonUtilO(Bans, each_Bans); ToJsonField(output, keyBans) = each_Bans;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void BanUsersResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyBanData), BanData);
+        }
+
+        Json::Value BanUsersResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BanData; ToJsonUtilO(BanData, each_BanData); ToJsonField(output, keyBanData) = each_BanData;
+            return output;
+        }
+
+        void BlankResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value BlankResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void CatalogItemBundleInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBundledItems), BundledItems);
+            FromJsonUtilS(FromJsonField(input, keyBundledResultTables), BundledResultTables);
+            FromJsonUtilP(FromJsonField(input, keyBundledVirtualCurrencies), BundledVirtualCurrencies);
+        }
+
+        Json::Value CatalogItemBundleInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BundledItems; ToJsonUtilS(BundledItems, each_BundledItems); ToJsonField(output, keyBundledItems) = each_BundledItems;
+            Json::Value each_BundledResultTables; ToJsonUtilS(BundledResultTables, each_BundledResultTables); ToJsonField(output, keyBundledResultTables) = each_BundledResultTables;
+            Json::Value each_BundledVirtualCurrencies; ToJsonUtilP(BundledVirtualCurrencies, each_BundledVirtualCurrencies); ToJsonField(output, keyBundledVirtualCurrencies) = each_BundledVirtualCurrencies;
+            return output;
+        }
+
+        void CatalogItemConsumableInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyUsageCount), UsageCount);
+            FromJsonUtilP(FromJsonField(input, keyUsagePeriod), UsagePeriod);
+            FromJsonUtilS(FromJsonField(input, keyUsagePeriodGroup), UsagePeriodGroup);
+        }
+
+        Json::Value CatalogItemConsumableInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_UsageCount; ToJsonUtilP(UsageCount, each_UsageCount); ToJsonField(output, keyUsageCount) = each_UsageCount;
+            Json::Value each_UsagePeriod; ToJsonUtilP(UsagePeriod, each_UsagePeriod); ToJsonField(output, keyUsagePeriod) = each_UsagePeriod;
+            Json::Value each_UsagePeriodGroup; ToJsonUtilS(UsagePeriodGroup, each_UsagePeriodGroup); ToJsonField(output, keyUsagePeriodGroup) = each_UsagePeriodGroup;
+            return output;
+        }
+
+        void CatalogItemContainerInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyItemContents), ItemContents);
+            FromJsonUtilS(FromJsonField(input, keyKeyItemId), KeyItemId);
+            FromJsonUtilS(FromJsonField(input, keyResultTableContents), ResultTableContents);
+            FromJsonUtilP(FromJsonField(input, keyVirtualCurrencyContents), VirtualCurrencyContents);
+        }
+
+        Json::Value CatalogItemContainerInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ItemContents; ToJsonUtilS(ItemContents, each_ItemContents); ToJsonField(output, keyItemContents) = each_ItemContents;
+            Json::Value each_KeyItemId; ToJsonUtilS(KeyItemId, each_KeyItemId); ToJsonField(output, keyKeyItemId) = each_KeyItemId;
+            Json::Value each_ResultTableContents; ToJsonUtilS(ResultTableContents, each_ResultTableContents); ToJsonField(output, keyResultTableContents) = each_ResultTableContents;
+            Json::Value each_VirtualCurrencyContents; ToJsonUtilP(VirtualCurrencyContents, each_VirtualCurrencyContents); ToJsonField(output, keyVirtualCurrencyContents) = each_VirtualCurrencyContents;
+            return output;
+        }
+
+        void CatalogItem::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyBundle), Bundle);
+            FromJsonUtilP(FromJsonField(input, keyCanBecomeCharacter), CanBecomeCharacter);
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilO(FromJsonField(input, keyConsumable), Consumable);
+            FromJsonUtilO(FromJsonField(input, keyContainer), Container);
+            FromJsonUtilS(FromJsonField(input, keyCustomData), CustomData);
+            FromJsonUtilS(FromJsonField(input, keyDescription), Description);
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+            FromJsonUtilP(FromJsonField(input, keyInitialLimitedEditionCount), InitialLimitedEditionCount);
+            FromJsonUtilP(FromJsonField(input, keyIsLimitedEdition), IsLimitedEdition);
+            FromJsonUtilP(FromJsonField(input, keyIsStackable), IsStackable);
+            FromJsonUtilP(FromJsonField(input, keyIsTradable), IsTradable);
+            FromJsonUtilS(FromJsonField(input, keyItemClass), ItemClass);
+            FromJsonUtilS(FromJsonField(input, keyItemId), ItemId);
+            FromJsonUtilS(FromJsonField(input, keyItemImageUrl), ItemImageUrl);
+            FromJsonUtilP(FromJsonField(input, keyRealCurrencyPrices), RealCurrencyPrices);
+            FromJsonUtilS(FromJsonField(input, keyTags), Tags);
+            FromJsonUtilP(FromJsonField(input, keyVirtualCurrencyPrices), VirtualCurrencyPrices);
+        }
+
+        Json::Value CatalogItem::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Bundle; ToJsonUtilO(Bundle, each_Bundle); ToJsonField(output, keyBundle) = each_Bundle;
+            Json::Value each_CanBecomeCharacter; ToJsonUtilP(CanBecomeCharacter, each_CanBecomeCharacter); ToJsonField(output, keyCanBecomeCharacter) = each_CanBecomeCharacter;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_Consumable; ToJsonUtilO(Consumable, each_Consumable); ToJsonField(output, keyConsumable) = each_Consumable;
+            Json::Value each_Container; ToJsonUtilO(Container, each_Container); ToJsonField(output, keyContainer) = each_Container;
+            Json::Value each_CustomData; ToJsonUtilS(CustomData, each_CustomData); ToJsonField(output, keyCustomData) = each_CustomData;
+            Json::Value each_Description; ToJsonUtilS(Description, each_Description); ToJsonField(output, keyDescription) = each_Description;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            Json::Value each_InitialLimitedEditionCount; ToJsonUtilP(InitialLimitedEditionCount, each_InitialLimitedEditionCount); ToJsonField(output, keyInitialLimitedEditionCount) = each_InitialLimitedEditionCount;
+            Json::Value each_IsLimitedEdition; ToJsonUtilP(IsLimitedEdition, each_IsLimitedEdition); ToJsonField(output, keyIsLimitedEdition) = each_IsLimitedEdition;
+            Json::Value each_IsStackable; ToJsonUtilP(IsStackable, each_IsStackable); ToJsonField(output, keyIsStackable) = each_IsStackable;
+            Json::Value each_IsTradable; ToJsonUtilP(IsTradable, each_IsTradable); ToJsonField(output, keyIsTradable) = each_IsTradable;
+            Json::Value each_ItemClass; ToJsonUtilS(ItemClass, each_ItemClass); ToJsonField(output, keyItemClass) = each_ItemClass;
+            Json::Value each_ItemId; ToJsonUtilS(ItemId, each_ItemId); ToJsonField(output, keyItemId) = each_ItemId;
+            Json::Value each_ItemImageUrl; ToJsonUtilS(ItemImageUrl, each_ItemImageUrl); ToJsonField(output, keyItemImageUrl) = each_ItemImageUrl;
+            Json::Value each_RealCurrencyPrices; ToJsonUtilP(RealCurrencyPrices, each_RealCurrencyPrices); ToJsonField(output, keyRealCurrencyPrices) = each_RealCurrencyPrices;
+            Json::Value each_Tags; ToJsonUtilS(Tags, each_Tags); ToJsonField(output, keyTags) = each_Tags;
+            Json::Value each_VirtualCurrencyPrices; ToJsonUtilP(VirtualCurrencyPrices, each_VirtualCurrencyPrices); ToJsonField(output, keyVirtualCurrencyPrices) = each_VirtualCurrencyPrices;
+            return output;
+        }
+
+        void CheckLimitedEditionItemAvailabilityRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyItemId), ItemId);
+        }
+
+        Json::Value CheckLimitedEditionItemAvailabilityRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_ItemId; ToJsonUtilS(ItemId, each_ItemId); ToJsonField(output, keyItemId) = each_ItemId;
+            return output;
+        }
+
+        void CheckLimitedEditionItemAvailabilityResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyAmount), Amount);
+        }
+
+        Json::Value CheckLimitedEditionItemAvailabilityResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Amount; ToJsonUtilP(Amount, each_Amount); ToJsonField(output, keyAmount) = each_Amount;
+            return output;
+        }
+
+        void CloudScriptFile::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyFileContents), FileContents);
+            FromJsonUtilS(FromJsonField(input, keyFilename), Filename);
+        }
+
+        Json::Value CloudScriptFile::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_FileContents; ToJsonUtilS(FileContents, each_FileContents); ToJsonField(output, keyFileContents) = each_FileContents;
+            Json::Value each_Filename; ToJsonUtilS(Filename, each_Filename); ToJsonField(output, keyFilename) = each_Filename;
+            return output;
+        }
+
+        void CloudScriptTaskParameter::FromJson(const Json::Value& input)
+        {
+            Argument = FromJsonField(input, keyArgument);
+            FromJsonUtilS(FromJsonField(input, keyFunctionName), FunctionName);
+        }
+
+        Json::Value CloudScriptTaskParameter::ToJson() const
+        {
+            Json::Value output;
+            ToJsonField(output, keyArgument) = Argument;
+            Json::Value each_FunctionName; ToJsonUtilS(FunctionName, each_FunctionName); ToJsonField(output, keyFunctionName) = each_FunctionName;
+            return output;
+        }
+
+        void ScriptExecutionError::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyError), Error);
+            FromJsonUtilS(FromJsonField(input, keyMessage), Message);
+            FromJsonUtilS(FromJsonField(input, keyStackTrace), StackTrace);
+        }
+
+        Json::Value ScriptExecutionError::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Error; ToJsonUtilS(Error, each_Error); ToJsonField(output, keyError) = each_Error;
+            Json::Value each_Message; ToJsonUtilS(Message, each_Message); ToJsonField(output, keyMessage) = each_Message;
+            Json::Value each_StackTrace; ToJsonUtilS(StackTrace, each_StackTrace); ToJsonField(output, keyStackTrace) = each_StackTrace;
+            return output;
+        }
+
+        void LogStatement::FromJson(const Json::Value& input)
+        {
+            Data = FromJsonField(input, keyData);
+            FromJsonUtilS(FromJsonField(input, keyLevel), Level);
+            FromJsonUtilS(FromJsonField(input, keyMessage), Message);
+        }
+
+        Json::Value LogStatement::ToJson() const
+        {
+            Json::Value output;
+            ToJsonField(output, keyData) = Data;
+            Json::Value each_Level; ToJsonUtilS(Level, each_Level); ToJsonField(output, keyLevel) = each_Level;
+            Json::Value each_Message; ToJsonUtilS(Message, each_Message); ToJsonField(output, keyMessage) = each_Message;
+            return output;
+        }
+
+        void ExecuteCloudScriptResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyAPIRequestsIssued), APIRequestsIssued);
+            FromJsonUtilO(FromJsonField(input, keyError), Error);
+            FromJsonUtilP(FromJsonField(input, keyExecutionTimeSeconds), ExecutionTimeSeconds);
+            FromJsonUtilS(FromJsonField(input, keyFunctionName), FunctionName);
+            FunctionResult = FromJsonField(input, keyFunctionResult);
+            FromJsonUtilP(FromJsonField(input, keyFunctionResultTooLarge), FunctionResultTooLarge);
+            FromJsonUtilP(FromJsonField(input, keyHttpRequestsIssued), HttpRequestsIssued);
+            FromJsonUtilO(FromJsonField(input, keyLogs), Logs);
+            FromJsonUtilP(FromJsonField(input, keyLogsTooLarge), LogsTooLarge);
+            FromJsonUtilP(FromJsonField(input, keyMemoryConsumedBytes), MemoryConsumedBytes);
+            FromJsonUtilP(FromJsonField(input, keyProcessorTimeSeconds), ProcessorTimeSeconds);
+            FromJsonUtilP(FromJsonField(input, keyRevision), Revision);
+        }
+
+        Json::Value ExecuteCloudScriptResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_APIRequestsIssued; ToJsonUtilP(APIRequestsIssued, each_APIRequestsIssued); ToJsonField(output, keyAPIRequestsIssued) = each_APIRequestsIssued;
+            Json::Value each_Error; ToJsonUtilO(Error, each_Error); ToJsonField(output, keyError) = each_Error;
+            Json::Value each_ExecutionTimeSeconds; ToJsonUtilP(ExecutionTimeSeconds, each_ExecutionTimeSeconds); ToJsonField(output, keyExecutionTimeSeconds) = each_ExecutionTimeSeconds;
+            Json::Value each_FunctionName; ToJsonUtilS(FunctionName, each_FunctionName); ToJsonField(output, keyFunctionName) = each_FunctionName;
+            ToJsonField(output, keyFunctionResult) = FunctionResult;
+            Json::Value each_FunctionResultTooLarge; ToJsonUtilP(FunctionResultTooLarge, each_FunctionResultTooLarge); ToJsonField(output, keyFunctionResultTooLarge) = each_FunctionResultTooLarge;
+            Json::Value each_HttpRequestsIssued; ToJsonUtilP(HttpRequestsIssued, each_HttpRequestsIssued); ToJsonField(output, keyHttpRequestsIssued) = each_HttpRequestsIssued;
+            Json::Value each_Logs; ToJsonUtilO(Logs, each_Logs); ToJsonField(output, keyLogs) = each_Logs;
+            Json::Value each_LogsTooLarge; ToJsonUtilP(LogsTooLarge, each_LogsTooLarge); ToJsonField(output, keyLogsTooLarge) = each_LogsTooLarge;
+            Json::Value each_MemoryConsumedBytes; ToJsonUtilP(MemoryConsumedBytes, each_MemoryConsumedBytes); ToJsonField(output, keyMemoryConsumedBytes) = each_MemoryConsumedBytes;
+            Json::Value each_ProcessorTimeSeconds; ToJsonUtilP(ProcessorTimeSeconds, each_ProcessorTimeSeconds); ToJsonField(output, keyProcessorTimeSeconds) = each_ProcessorTimeSeconds;
+            Json::Value each_Revision; ToJsonUtilP(Revision, each_Revision); ToJsonField(output, keyRevision) = each_Revision;
+            return output;
+        }
+
+        void CloudScriptTaskSummary::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilT(FromJsonField(input, keyCompletedAt), CompletedAt);
+            FromJsonUtilP(FromJsonField(input, keyEstimatedSecondsRemaining), EstimatedSecondsRemaining);
+            FromJsonUtilP(FromJsonField(input, keyPercentComplete), PercentComplete);
+            FromJsonUtilO(FromJsonField(input, keyResult), Result);
+            FromJsonUtilS(FromJsonField(input, keyScheduledByUserId), ScheduledByUserId);
+            FromJsonUtilT(FromJsonField(input, keyStartedAt), StartedAt);
+            FromJsonUtilE(FromJsonField(input, keyStatus), Status);
+            FromJsonUtilO(FromJsonField(input, keyTaskIdentifier), TaskIdentifier);
+            FromJsonUtilS(FromJsonField(input, keyTaskInstanceId), TaskInstanceId);
+        }
+
+        Json::Value CloudScriptTaskSummary::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CompletedAt; ToJsonUtilT(CompletedAt, each_CompletedAt); ToJsonField(output, keyCompletedAt) = each_CompletedAt;
+            Json::Value each_EstimatedSecondsRemaining; ToJsonUtilP(EstimatedSecondsRemaining, each_EstimatedSecondsRemaining); ToJsonField(output, keyEstimatedSecondsRemaining) = each_EstimatedSecondsRemaining;
+            Json::Value each_PercentComplete; ToJsonUtilP(PercentComplete, each_PercentComplete); ToJsonField(output, keyPercentComplete) = each_PercentComplete;
+            Json::Value each_Result; ToJsonUtilO(Result, each_Result); ToJsonField(output, keyResult) = each_Result;
+            Json::Value each_ScheduledByUserId; ToJsonUtilS(ScheduledByUserId, each_ScheduledByUserId); ToJsonField(output, keyScheduledByUserId) = each_ScheduledByUserId;
+            Json::Value each_StartedAt; ToJsonUtilT(StartedAt, each_StartedAt); ToJsonField(output, keyStartedAt) = each_StartedAt;
+            Json::Value each_Status; ToJsonUtilE(Status, each_Status); ToJsonField(output, keyStatus) = each_Status;
+            Json::Value each_TaskIdentifier; ToJsonUtilO(TaskIdentifier, each_TaskIdentifier); ToJsonField(output, keyTaskIdentifier) = each_TaskIdentifier;
+            Json::Value each_TaskInstanceId; ToJsonUtilS(TaskInstanceId, each_TaskInstanceId); ToJsonField(output, keyTaskInstanceId) = each_TaskInstanceId;
+            return output;
+        }
+
+        void CloudScriptVersionStatus::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyLatestRevision), LatestRevision);
+            FromJsonUtilP(FromJsonField(input, keyPublishedRevision), PublishedRevision);
+            FromJsonUtilP(FromJsonField(input, keyVersion), Version);
+        }
+
+        Json::Value CloudScriptVersionStatus::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_LatestRevision; ToJsonUtilP(LatestRevision, each_LatestRevision); ToJsonField(output, keyLatestRevision) = each_LatestRevision;
+            Json::Value each_PublishedRevision; ToJsonUtilP(PublishedRevision, each_PublishedRevision); ToJsonField(output, keyPublishedRevision) = each_PublishedRevision;
+            Json::Value each_Version; ToJsonUtilP(Version, each_Version); ToJsonField(output, keyVersion) = each_Version;
+            return output;
+        }
+
+        void ContactEmailInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyEmailAddress), EmailAddress);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilE(FromJsonField(input, keyVerificationStatus), VerificationStatus);
+        }
+
+        Json::Value ContactEmailInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_EmailAddress; ToJsonUtilS(EmailAddress, each_EmailAddress); ToJsonField(output, keyEmailAddress) = each_EmailAddress;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_VerificationStatus; ToJsonUtilE(VerificationStatus, each_VerificationStatus); ToJsonField(output, keyVerificationStatus) = each_VerificationStatus;
+            return output;
+        }
+
+        void ContactEmailInfoModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyEmailAddress), EmailAddress);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilE(FromJsonField(input, keyVerificationStatus), VerificationStatus);
+        }
+
+        Json::Value ContactEmailInfoModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_EmailAddress; ToJsonUtilS(EmailAddress, each_EmailAddress); ToJsonField(output, keyEmailAddress) = each_EmailAddress;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_VerificationStatus; ToJsonUtilE(VerificationStatus, each_VerificationStatus); ToJsonField(output, keyVerificationStatus) = each_VerificationStatus;
+            return output;
+        }
+
+        void ContentInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyKey), Key);
+            FromJsonUtilT(FromJsonField(input, keyLastModified), LastModified);
+            FromJsonUtilP(FromJsonField(input, keySize), Size);
+        }
+
+        Json::Value ContentInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Key; ToJsonUtilS(Key, each_Key); ToJsonField(output, keyKey) = each_Key;
+            Json::Value each_LastModified; ToJsonUtilT(LastModified, each_LastModified); ToJsonField(output, keyLastModified) = each_LastModified;
+            Json::Value each_Size; ToJsonUtilP(Size, each_Size); ToJsonField(output, keySize) = each_Size;
+            return output;
+        }
+
+        void CreateActionsOnPlayerSegmentTaskRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyDescription), Description);
+            FromJsonUtilP(FromJsonField(input, keyIsActive), IsActive);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilO(FromJsonField(input, keyParameter), Parameter);
+            FromJsonUtilS(FromJsonField(input, keySchedule), Schedule);
+        }
+
+        Json::Value CreateActionsOnPlayerSegmentTaskRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Description; ToJsonUtilS(Description, each_Description); ToJsonField(output, keyDescription) = each_Description;
+            Json::Value each_IsActive; ToJsonUtilP(IsActive, each_IsActive); ToJsonField(output, keyIsActive) = each_IsActive;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_Parameter; ToJsonUtilO(Parameter, each_Parameter); ToJsonField(output, keyParameter) = each_Parameter;
+            Json::Value each_Schedule; ToJsonUtilS(Schedule, each_Schedule); ToJsonField(output, keySchedule) = each_Schedule;
+            return output;
+        }
+
+        void CreateCloudScriptTaskRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyDescription), Description);
+            FromJsonUtilP(FromJsonField(input, keyIsActive), IsActive);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilO(FromJsonField(input, keyParameter), Parameter);
+            FromJsonUtilS(FromJsonField(input, keySchedule), Schedule);
+        }
+
+        Json::Value CreateCloudScriptTaskRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Description; ToJsonUtilS(Description, each_Description); ToJsonField(output, keyDescription) = each_Description;
+            Json::Value each_IsActive; ToJsonUtilP(IsActive, each_IsActive); ToJsonField(output, keyIsActive) = each_IsActive;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_Parameter; ToJsonUtilO(Parameter, each_Parameter); ToJsonField(output, keyParameter) = each_Parameter;
+            Json::Value each_Schedule; ToJsonUtilS(Schedule, each_Schedule); ToJsonField(output, keySchedule) = each_Schedule;
+            return output;
+        }
+
+        void InsightsScalingTaskParameter::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyLevel), Level);
+        }
+
+        Json::Value InsightsScalingTaskParameter::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Level; ToJsonUtilP(Level, each_Level); ToJsonField(output, keyLevel) = each_Level;
+            return output;
+        }
+
+        void CreateInsightsScheduledScalingTaskRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyDescription), Description);
+            FromJsonUtilP(FromJsonField(input, keyIsActive), IsActive);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilO(FromJsonField(input, keyParameter), Parameter);
+            FromJsonUtilS(FromJsonField(input, keySchedule), Schedule);
+        }
+
+        Json::Value CreateInsightsScheduledScalingTaskRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Description; ToJsonUtilS(Description, each_Description); ToJsonField(output, keyDescription) = each_Description;
+            Json::Value each_IsActive; ToJsonUtilP(IsActive, each_IsActive); ToJsonField(output, keyIsActive) = each_IsActive;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_Parameter; ToJsonUtilO(Parameter, each_Parameter); ToJsonField(output, keyParameter) = each_Parameter;
+            Json::Value each_Schedule; ToJsonUtilS(Schedule, each_Schedule); ToJsonField(output, keySchedule) = each_Schedule;
+            return output;
+        }
+
+        void OpenIdIssuerInformation::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAuthorizationUrl), AuthorizationUrl);
+            FromJsonUtilS(FromJsonField(input, keyIssuer), Issuer);
+            JsonWebKeySet = FromJsonField(input, keyJsonWebKeySet);
+            FromJsonUtilS(FromJsonField(input, keyTokenUrl), TokenUrl);
+        }
+
+        Json::Value OpenIdIssuerInformation::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AuthorizationUrl; ToJsonUtilS(AuthorizationUrl, each_AuthorizationUrl); ToJsonField(output, keyAuthorizationUrl) = each_AuthorizationUrl;
+            Json::Value each_Issuer; ToJsonUtilS(Issuer, each_Issuer); ToJsonField(output, keyIssuer) = each_Issuer;
+            ToJsonField(output, keyJsonWebKeySet) = JsonWebKeySet;
+            Json::Value each_TokenUrl; ToJsonUtilS(TokenUrl, each_TokenUrl); ToJsonField(output, keyTokenUrl) = each_TokenUrl;
+            return output;
+        }
+
+        void CreateOpenIdConnectionRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyClientId), ClientId);
+            FromJsonUtilS(FromJsonField(input, keyClientSecret), ClientSecret);
+            FromJsonUtilS(FromJsonField(input, keyConnectionId), ConnectionId);
+            FromJsonUtilP(FromJsonField(input, keyIgnoreNonce), IgnoreNonce);
+            FromJsonUtilS(FromJsonField(input, keyIssuerDiscoveryUrl), IssuerDiscoveryUrl);
+            FromJsonUtilO(FromJsonField(input, keyIssuerInformation), IssuerInformation);
+        }
+
+        Json::Value CreateOpenIdConnectionRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ClientId; ToJsonUtilS(ClientId, each_ClientId); ToJsonField(output, keyClientId) = each_ClientId;
+            Json::Value each_ClientSecret; ToJsonUtilS(ClientSecret, each_ClientSecret); ToJsonField(output, keyClientSecret) = each_ClientSecret;
+            Json::Value each_ConnectionId; ToJsonUtilS(ConnectionId, each_ConnectionId); ToJsonField(output, keyConnectionId) = each_ConnectionId;
+            Json::Value each_IgnoreNonce; ToJsonUtilP(IgnoreNonce, each_IgnoreNonce); ToJsonField(output, keyIgnoreNonce) = each_IgnoreNonce;
+            Json::Value each_IssuerDiscoveryUrl; ToJsonUtilS(IssuerDiscoveryUrl, each_IssuerDiscoveryUrl); ToJsonField(output, keyIssuerDiscoveryUrl) = each_IssuerDiscoveryUrl;
+            Json::Value each_IssuerInformation; ToJsonUtilO(IssuerInformation, each_IssuerInformation); ToJsonField(output, keyIssuerInformation) = each_IssuerInformation;
+            return output;
+        }
+
+        void CreatePlayerSharedSecretRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyFriendlyName), FriendlyName);
+        }
+
+        Json::Value CreatePlayerSharedSecretRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_FriendlyName; ToJsonUtilS(FriendlyName, each_FriendlyName); ToJsonField(output, keyFriendlyName) = each_FriendlyName;
+            return output;
+        }
+
+        void CreatePlayerSharedSecretResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keySecretKey), SecretKey);
+        }
+
+        Json::Value CreatePlayerSharedSecretResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_SecretKey; ToJsonUtilS(SecretKey, each_SecretKey); ToJsonField(output, keySecretKey) = each_SecretKey;
+            return output;
+        }
+
+        void CreatePlayerStatisticDefinitionRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilE(FromJsonField(input, keyAggregationMethod), AggregationMethod);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+            FromJsonUtilE(FromJsonField(input, keyVersionChangeInterval), VersionChangeInterval);
+        }
+
+        Json::Value CreatePlayerStatisticDefinitionRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AggregationMethod; ToJsonUtilE(AggregationMethod, each_AggregationMethod); ToJsonField(output, keyAggregationMethod) = each_AggregationMethod;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            Json::Value each_VersionChangeInterval; ToJsonUtilE(VersionChangeInterval, each_VersionChangeInterval); ToJsonField(output, keyVersionChangeInterval) = each_VersionChangeInterval;
+            return output;
+        }
+
+        void PlayerStatisticDefinition::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilE(FromJsonField(input, keyAggregationMethod), AggregationMethod);
+            FromJsonUtilP(FromJsonField(input, keyCurrentVersion), CurrentVersion);
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+            FromJsonUtilE(FromJsonField(input, keyVersionChangeInterval), VersionChangeInterval);
+        }
+
+        Json::Value PlayerStatisticDefinition::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AggregationMethod; ToJsonUtilE(AggregationMethod, each_AggregationMethod); ToJsonField(output, keyAggregationMethod) = each_AggregationMethod;
+            Json::Value each_CurrentVersion; ToJsonUtilP(CurrentVersion, each_CurrentVersion); ToJsonField(output, keyCurrentVersion) = each_CurrentVersion;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            Json::Value each_VersionChangeInterval; ToJsonUtilE(VersionChangeInterval, each_VersionChangeInterval); ToJsonField(output, keyVersionChangeInterval) = each_VersionChangeInterval;
+            return output;
+        }
+
+        void CreatePlayerStatisticDefinitionResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyStatistic), Statistic);
+        }
+
+        Json::Value CreatePlayerStatisticDefinitionResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Statistic; ToJsonUtilO(Statistic, each_Statistic); ToJsonField(output, keyStatistic) = each_Statistic;
+            return output;
+        }
+
+        void DeletePlayerSegmentAction::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value DeletePlayerSegmentAction::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void DeletePlayerStatisticSegmentAction::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+        }
+
+        Json::Value DeletePlayerStatisticSegmentAction::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            return output;
+        }
+
+        void EmailNotificationSegmentAction::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyEmailTemplateId), EmailTemplateId);
+            FromJsonUtilS(FromJsonField(input, keyEmailTemplateName), EmailTemplateName);
+        }
+
+        Json::Value EmailNotificationSegmentAction::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_EmailTemplateId; ToJsonUtilS(EmailTemplateId, each_EmailTemplateId); ToJsonField(output, keyEmailTemplateId) = each_EmailTemplateId;
+            Json::Value each_EmailTemplateName; ToJsonUtilS(EmailTemplateName, each_EmailTemplateName); ToJsonField(output, keyEmailTemplateName) = each_EmailTemplateName;
+            return output;
+        }
+
+        void ExecuteAzureFunctionSegmentAction::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAzureFunction), AzureFunction);
+            FunctionParameter = FromJsonField(input, keyFunctionParameter);
+            FromJsonUtilP(FromJsonField(input, keyGenerateFunctionExecutedEvents), GenerateFunctionExecutedEvents);
+        }
+
+        Json::Value ExecuteAzureFunctionSegmentAction::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AzureFunction; ToJsonUtilS(AzureFunction, each_AzureFunction); ToJsonField(output, keyAzureFunction) = each_AzureFunction;
+            ToJsonField(output, keyFunctionParameter) = FunctionParameter;
+            Json::Value each_GenerateFunctionExecutedEvents; ToJsonUtilP(GenerateFunctionExecutedEvents, each_GenerateFunctionExecutedEvents); ToJsonField(output, keyGenerateFunctionExecutedEvents) = each_GenerateFunctionExecutedEvents;
+            return output;
+        }
+
+        void ExecuteCloudScriptSegmentAction::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCloudScriptFunction), CloudScriptFunction);
+            FromJsonUtilP(FromJsonField(input, keyCloudScriptPublishResultsToPlayStream), CloudScriptPublishResultsToPlayStream);
+            FunctionParameter = FromJsonField(input, keyFunctionParameter);
+            FromJsonUtilS(FromJsonField(input, keyFunctionParameterJson), FunctionParameterJson);
+        }
+
+        Json::Value ExecuteCloudScriptSegmentAction::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CloudScriptFunction; ToJsonUtilS(CloudScriptFunction, each_CloudScriptFunction); ToJsonField(output, keyCloudScriptFunction) = each_CloudScriptFunction;
+            Json::Value each_CloudScriptPublishResultsToPlayStream; ToJsonUtilP(CloudScriptPublishResultsToPlayStream, each_CloudScriptPublishResultsToPlayStream); ToJsonField(output, keyCloudScriptPublishResultsToPlayStream) = each_CloudScriptPublishResultsToPlayStream;
+            ToJsonField(output, keyFunctionParameter) = FunctionParameter;
+            Json::Value each_FunctionParameterJson; ToJsonUtilS(FunctionParameterJson, each_FunctionParameterJson); ToJsonField(output, keyFunctionParameterJson) = each_FunctionParameterJson;
+            return output;
+        }
+
+        void GrantItemSegmentAction::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatelogId), CatelogId);
+            FromJsonUtilS(FromJsonField(input, keyItemId), ItemId);
+            FromJsonUtilP(FromJsonField(input, keyQuantity), Quantity);
+        }
+
+        Json::Value GrantItemSegmentAction::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatelogId; ToJsonUtilS(CatelogId, each_CatelogId); ToJsonField(output, keyCatelogId) = each_CatelogId;
+            Json::Value each_ItemId; ToJsonUtilS(ItemId, each_ItemId); ToJsonField(output, keyItemId) = each_ItemId;
+            Json::Value each_Quantity; ToJsonUtilP(Quantity, each_Quantity); ToJsonField(output, keyQuantity) = each_Quantity;
+            return output;
+        }
+
+        void GrantVirtualCurrencySegmentAction::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyAmount), Amount);
+            FromJsonUtilS(FromJsonField(input, keyCurrencyCode), CurrencyCode);
+        }
+
+        Json::Value GrantVirtualCurrencySegmentAction::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Amount; ToJsonUtilP(Amount, each_Amount); ToJsonField(output, keyAmount) = each_Amount;
+            Json::Value each_CurrencyCode; ToJsonUtilS(CurrencyCode, each_CurrencyCode); ToJsonField(output, keyCurrencyCode) = each_CurrencyCode;
+            return output;
+        }
+
+        void IncrementPlayerStatisticSegmentAction::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyIncrementValue), IncrementValue);
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+        }
+
+        Json::Value IncrementPlayerStatisticSegmentAction::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_IncrementValue; ToJsonUtilP(IncrementValue, each_IncrementValue); ToJsonField(output, keyIncrementValue) = each_IncrementValue;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            return output;
+        }
+
+        void PushNotificationSegmentAction::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPushNotificationTemplateId), PushNotificationTemplateId);
+        }
+
+        Json::Value PushNotificationSegmentAction::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PushNotificationTemplateId; ToJsonUtilS(PushNotificationTemplateId, each_PushNotificationTemplateId); ToJsonField(output, keyPushNotificationTemplateId) = each_PushNotificationTemplateId;
+            return output;
+        }
+
+        void SegmentTrigger::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyBanPlayerAction), BanPlayerAction);
+            FromJsonUtilO(FromJsonField(input, keyDeletePlayerAction), DeletePlayerAction);
+            FromJsonUtilO(FromJsonField(input, keyDeletePlayerStatisticAction), DeletePlayerStatisticAction);
+            FromJsonUtilO(FromJsonField(input, keyEmailNotificationAction), EmailNotificationAction);
+            FromJsonUtilO(FromJsonField(input, keyExecuteAzureFunctionAction), ExecuteAzureFunctionAction);
+            FromJsonUtilO(FromJsonField(input, keyExecuteCloudScriptAction), ExecuteCloudScriptAction);
+            FromJsonUtilO(FromJsonField(input, keyGrantItemAction), GrantItemAction);
+            FromJsonUtilO(FromJsonField(input, keyGrantVirtualCurrencyAction), GrantVirtualCurrencyAction);
+            FromJsonUtilO(FromJsonField(input, keyIncrementPlayerStatisticAction), IncrementPlayerStatisticAction);
+            FromJsonUtilO(FromJsonField(input, keyPushNotificationAction), PushNotificationAction);
+        }
+
+        Json::Value SegmentTrigger::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BanPlayerAction; ToJsonUtilO(BanPlayerAction, each_BanPlayerAction); ToJsonField(output, keyBanPlayerAction) = each_BanPlayerAction;
+            Json::Value each_DeletePlayerAction; ToJsonUtilO(DeletePlayerAction, each_DeletePlayerAction); ToJsonField(output, keyDeletePlayerAction) = each_DeletePlayerAction;
+            Json::Value each_DeletePlayerStatisticAction; ToJsonUtilO(DeletePlayerStatisticAction, each_DeletePlayerStatisticAction); ToJsonField(output, keyDeletePlayerStatisticAction) = each_DeletePlayerStatisticAction;
+            Json::Value each_EmailNotificationAction; ToJsonUtilO(EmailNotificationAction, each_EmailNotificationAction); ToJsonField(output, keyEmailNotificationAction) = each_EmailNotificationAction;
+            Json::Value each_ExecuteAzureFunctionAction; ToJsonUtilO(ExecuteAzureFunctionAction, each_ExecuteAzureFunctionAction); ToJsonField(output, keyExecuteAzureFunctionAction) = each_ExecuteAzureFunctionAction;
+            Json::Value each_ExecuteCloudScriptAction; ToJsonUtilO(ExecuteCloudScriptAction, each_ExecuteCloudScriptAction); ToJsonField(output, keyExecuteCloudScriptAction) = each_ExecuteCloudScriptAction;
+            Json::Value each_GrantItemAction; ToJsonUtilO(GrantItemAction, each_GrantItemAction); ToJsonField(output, keyGrantItemAction) = each_GrantItemAction;
+            Json::Value each_GrantVirtualCurrencyAction; ToJsonUtilO(GrantVirtualCurrencyAction, each_GrantVirtualCurrencyAction); ToJsonField(output, keyGrantVirtualCurrencyAction) = each_GrantVirtualCurrencyAction;
+            Json::Value each_IncrementPlayerStatisticAction; ToJsonUtilO(IncrementPlayerStatisticAction, each_IncrementPlayerStatisticAction); ToJsonField(output, keyIncrementPlayerStatisticAction) = each_IncrementPlayerStatisticAction;
+            Json::Value each_PushNotificationAction; ToJsonUtilO(PushNotificationAction, each_PushNotificationAction); ToJsonField(output, keyPushNotificationAction) = each_PushNotificationAction;
+            return output;
+        }
+
+        void FirstLoginDateSegmentFilter::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilE(FromJsonField(input, keyComparison), Comparison);
+            FromJsonUtilT(FromJsonField(input, keyLogInDate), LogInDate);
+        }
+
+        Json::Value FirstLoginDateSegmentFilter::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Comparison; ToJsonUtilE(Comparison, each_Comparison); ToJsonField(output, keyComparison) = each_Comparison;
+            Json::Value each_LogInDate; ToJsonUtilT(LogInDate, each_LogInDate); ToJsonField(output, keyLogInDate) = each_LogInDate;
+            return output;
+        }
+
+        void FirstLoginTimespanSegmentFilter::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilE(FromJsonField(input, keyComparison), Comparison);
+            FromJsonUtilP(FromJsonField(input, keyDurationInMinutes), DurationInMinutes);
+        }
+
+        Json::Value FirstLoginTimespanSegmentFilter::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Comparison; ToJsonUtilE(Comparison, each_Comparison); ToJsonField(output, keyComparison) = each_Comparison;
+            Json::Value each_DurationInMinutes; ToJsonUtilP(DurationInMinutes, each_DurationInMinutes); ToJsonField(output, keyDurationInMinutes) = each_DurationInMinutes;
+            return output;
+        }
+
+        void LastLoginDateSegmentFilter::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilE(FromJsonField(input, keyComparison), Comparison);
+            FromJsonUtilT(FromJsonField(input, keyLogInDate), LogInDate);
+        }
+
+        Json::Value LastLoginDateSegmentFilter::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Comparison; ToJsonUtilE(Comparison, each_Comparison); ToJsonField(output, keyComparison) = each_Comparison;
+            Json::Value each_LogInDate; ToJsonUtilT(LogInDate, each_LogInDate); ToJsonField(output, keyLogInDate) = each_LogInDate;
+            return output;
+        }
+
+        void LastLoginTimespanSegmentFilter::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilE(FromJsonField(input, keyComparison), Comparison);
+            FromJsonUtilP(FromJsonField(input, keyDurationInMinutes), DurationInMinutes);
+        }
+
+        Json::Value LastLoginTimespanSegmentFilter::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Comparison; ToJsonUtilE(Comparison, each_Comparison); ToJsonField(output, keyComparison) = each_Comparison;
+            Json::Value each_DurationInMinutes; ToJsonUtilP(DurationInMinutes, each_DurationInMinutes); ToJsonField(output, keyDurationInMinutes) = each_DurationInMinutes;
+            return output;
+        }
+
+        void LinkedUserAccountSegmentFilter::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilE(FromJsonField(input, keyLoginProvider), LoginProvider);
+        }
+
+        Json::Value LinkedUserAccountSegmentFilter::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_LoginProvider; ToJsonUtilE(LoginProvider, each_LoginProvider); ToJsonField(output, keyLoginProvider) = each_LoginProvider;
+            return output;
+        }
+
+        void LinkedUserAccountHasEmailSegmentFilter::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilE(FromJsonField(input, keyComparison), Comparison);
+            FromJsonUtilE(FromJsonField(input, keyLoginProvider), LoginProvider);
+        }
+
+        Json::Value LinkedUserAccountHasEmailSegmentFilter::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Comparison; ToJsonUtilE(Comparison, each_Comparison); ToJsonField(output, keyComparison) = each_Comparison;
+            Json::Value each_LoginProvider; ToJsonUtilE(LoginProvider, each_LoginProvider); ToJsonField(output, keyLoginProvider) = each_LoginProvider;
+            return output;
+        }
+
+        void LocationSegmentFilter::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilE(FromJsonField(input, keyCountryCode), CountryCode);
+        }
+
+        Json::Value LocationSegmentFilter::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CountryCode; ToJsonUtilE(CountryCode, each_CountryCode); ToJsonField(output, keyCountryCode) = each_CountryCode;
+            return output;
+        }
+
+        void PushNotificationSegmentFilter::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilE(FromJsonField(input, keyPushNotificationDevicePlatform), PushNotificationDevicePlatform);
+        }
+
+        Json::Value PushNotificationSegmentFilter::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PushNotificationDevicePlatform; ToJsonUtilE(PushNotificationDevicePlatform, each_PushNotificationDevicePlatform); ToJsonField(output, keyPushNotificationDevicePlatform) = each_PushNotificationDevicePlatform;
+            return output;
+        }
+
+        void StatisticSegmentFilter::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilE(FromJsonField(input, keyComparison), Comparison);
+            FromJsonUtilS(FromJsonField(input, keyFilterValue), FilterValue);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilP(FromJsonField(input, keyUseCurrentVersion), UseCurrentVersion);
+            FromJsonUtilP(FromJsonField(input, keyVersion), Version);
+        }
+
+        Json::Value StatisticSegmentFilter::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Comparison; ToJsonUtilE(Comparison, each_Comparison); ToJsonField(output, keyComparison) = each_Comparison;
+            Json::Value each_FilterValue; ToJsonUtilS(FilterValue, each_FilterValue); ToJsonField(output, keyFilterValue) = each_FilterValue;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_UseCurrentVersion; ToJsonUtilP(UseCurrentVersion, each_UseCurrentVersion); ToJsonField(output, keyUseCurrentVersion) = each_UseCurrentVersion;
+            Json::Value each_Version; ToJsonUtilP(Version, each_Version); ToJsonField(output, keyVersion) = each_Version;
+            return output;
+        }
+
+        void TagSegmentFilter::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilE(FromJsonField(input, keyComparison), Comparison);
+            FromJsonUtilS(FromJsonField(input, keyTagValue), TagValue);
+        }
+
+        Json::Value TagSegmentFilter::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Comparison; ToJsonUtilE(Comparison, each_Comparison); ToJsonField(output, keyComparison) = each_Comparison;
+            Json::Value each_TagValue; ToJsonUtilS(TagValue, each_TagValue); ToJsonField(output, keyTagValue) = each_TagValue;
+            return output;
+        }
+
+        void TotalValueToDateInUSDSegmentFilter::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAmount), Amount);
+            FromJsonUtilE(FromJsonField(input, keyComparison), Comparison);
+        }
+
+        Json::Value TotalValueToDateInUSDSegmentFilter::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Amount; ToJsonUtilS(Amount, each_Amount); ToJsonField(output, keyAmount) = each_Amount;
+            Json::Value each_Comparison; ToJsonUtilE(Comparison, each_Comparison); ToJsonField(output, keyComparison) = each_Comparison;
+            return output;
+        }
+
+        void UserOriginationSegmentFilter::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilE(FromJsonField(input, keyLoginProvider), LoginProvider);
+        }
+
+        Json::Value UserOriginationSegmentFilter::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_LoginProvider; ToJsonUtilE(LoginProvider, each_LoginProvider); ToJsonField(output, keyLoginProvider) = each_LoginProvider;
+            return output;
+        }
+
+        void ValueToDateSegmentFilter::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAmount), Amount);
+            FromJsonUtilE(FromJsonField(input, keyComparison), Comparison);
+            FromJsonUtilE(FromJsonField(input, keyCurrency), Currency);
+        }
+
+        Json::Value ValueToDateSegmentFilter::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Amount; ToJsonUtilS(Amount, each_Amount); ToJsonField(output, keyAmount) = each_Amount;
+            Json::Value each_Comparison; ToJsonUtilE(Comparison, each_Comparison); ToJsonField(output, keyComparison) = each_Comparison;
+            Json::Value each_Currency; ToJsonUtilE(Currency, each_Currency); ToJsonField(output, keyCurrency) = each_Currency;
+            return output;
+        }
+
+        void VirtualCurrencyBalanceSegmentFilter::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyAmount), Amount);
+            FromJsonUtilE(FromJsonField(input, keyComparison), Comparison);
+            FromJsonUtilS(FromJsonField(input, keyCurrencyCode), CurrencyCode);
+        }
+
+        Json::Value VirtualCurrencyBalanceSegmentFilter::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Amount; ToJsonUtilP(Amount, each_Amount); ToJsonField(output, keyAmount) = each_Amount;
+            Json::Value each_Comparison; ToJsonUtilE(Comparison, each_Comparison); ToJsonField(output, keyComparison) = each_Comparison;
+            Json::Value each_CurrencyCode; ToJsonUtilS(CurrencyCode, each_CurrencyCode); ToJsonField(output, keyCurrencyCode) = each_CurrencyCode;
+            return output;
+        }
+
+        void SegmentAndDefinition::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyAdCampaignFilter), AdCampaignFilter);
+            FromJsonUtilO(FromJsonField(input, keyAllPlayersFilter), AllPlayersFilter);
+            FromJsonUtilO(FromJsonField(input, keyFirstLoginDateFilter), FirstLoginDateFilter);
+            FromJsonUtilO(FromJsonField(input, keyFirstLoginFilter), FirstLoginFilter);
+            FromJsonUtilO(FromJsonField(input, keyLastLoginDateFilter), LastLoginDateFilter);
+            FromJsonUtilO(FromJsonField(input, keyLastLoginFilter), LastLoginFilter);
+            FromJsonUtilO(FromJsonField(input, keyLinkedUserAccountFilter), LinkedUserAccountFilter);
+            FromJsonUtilO(FromJsonField(input, keyLinkedUserAccountHasEmailFilter), LinkedUserAccountHasEmailFilter);
+            FromJsonUtilO(FromJsonField(input, keyLocationFilter), LocationFilter);
+            FromJsonUtilO(FromJsonField(input, keyPushNotificationFilter), PushNotificationFilter);
+            FromJsonUtilO(FromJsonField(input, keyStatisticFilter), StatisticFilter);
+            FromJsonUtilO(FromJsonField(input, keyTagFilter), TagFilter);
+            FromJsonUtilO(FromJsonField(input, keyTotalValueToDateInUSDFilter), TotalValueToDateInUSDFilter);
+            FromJsonUtilO(FromJsonField(input, keyUserOriginationFilter), UserOriginationFilter);
+            FromJsonUtilO(FromJsonField(input, keyValueToDateFilter), ValueToDateFilter);
+            FromJsonUtilO(FromJsonField(input, keyVirtualCurrencyBalanceFilter), VirtualCurrencyBalanceFilter);
+        }
+
+        Json::Value SegmentAndDefinition::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AdCampaignFilter; ToJsonUtilO(AdCampaignFilter, each_AdCampaignFilter); ToJsonField(output, keyAdCampaignFilter) = each_AdCampaignFilter;
+            Json::Value each_AllPlayersFilter; ToJsonUtilO(AllPlayersFilter, each_AllPlayersFilter); ToJsonField(output, keyAllPlayersFilter) = each_AllPlayersFilter;
+            Json::Value each_FirstLoginDateFilter; ToJsonUtilO(FirstLoginDateFilter, each_FirstLoginDateFilter); ToJsonField(output, keyFirstLoginDateFilter) = each_FirstLoginDateFilter;
+            Json::Value each_FirstLoginFilter; ToJsonUtilO(FirstLoginFilter, each_FirstLoginFilter); ToJsonField(output, keyFirstLoginFilter) = each_FirstLoginFilter;
+            Json::Value each_LastLoginDateFilter; ToJsonUtilO(LastLoginDateFilter, each_LastLoginDateFilter); ToJsonField(output, keyLastLoginDateFilter) = each_LastLoginDateFilter;
+            Json::Value each_LastLoginFilter; ToJsonUtilO(LastLoginFilter, each_LastLoginFilter); ToJsonField(output, keyLastLoginFilter) = each_LastLoginFilter;
+            Json::Value each_LinkedUserAccountFilter; ToJsonUtilO(LinkedUserAccountFilter, each_LinkedUserAccountFilter); ToJsonField(output, keyLinkedUserAccountFilter) = each_LinkedUserAccountFilter;
+            Json::Value each_LinkedUserAccountHasEmailFilter; ToJsonUtilO(LinkedUserAccountHasEmailFilter, each_LinkedUserAccountHasEmailFilter); ToJsonField(output, keyLinkedUserAccountHasEmailFilter) = each_LinkedUserAccountHasEmailFilter;
+            Json::Value each_LocationFilter; ToJsonUtilO(LocationFilter, each_LocationFilter); ToJsonField(output, keyLocationFilter) = each_LocationFilter;
+            Json::Value each_PushNotificationFilter; ToJsonUtilO(PushNotificationFilter, each_PushNotificationFilter); ToJsonField(output, keyPushNotificationFilter) = each_PushNotificationFilter;
+            Json::Value each_StatisticFilter; ToJsonUtilO(StatisticFilter, each_StatisticFilter); ToJsonField(output, keyStatisticFilter) = each_StatisticFilter;
+            Json::Value each_TagFilter; ToJsonUtilO(TagFilter, each_TagFilter); ToJsonField(output, keyTagFilter) = each_TagFilter;
+            Json::Value each_TotalValueToDateInUSDFilter; ToJsonUtilO(TotalValueToDateInUSDFilter, each_TotalValueToDateInUSDFilter); ToJsonField(output, keyTotalValueToDateInUSDFilter) = each_TotalValueToDateInUSDFilter;
+            Json::Value each_UserOriginationFilter; ToJsonUtilO(UserOriginationFilter, each_UserOriginationFilter); ToJsonField(output, keyUserOriginationFilter) = each_UserOriginationFilter;
+            Json::Value each_ValueToDateFilter; ToJsonUtilO(ValueToDateFilter, each_ValueToDateFilter); ToJsonField(output, keyValueToDateFilter) = each_ValueToDateFilter;
+            Json::Value each_VirtualCurrencyBalanceFilter; ToJsonUtilO(VirtualCurrencyBalanceFilter, each_VirtualCurrencyBalanceFilter); ToJsonField(output, keyVirtualCurrencyBalanceFilter) = each_VirtualCurrencyBalanceFilter;
+            return output;
+        }
+
+        void SegmentOrDefinition::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keySegmentAndDefinitions), SegmentAndDefinitions);
+        }
+
+        Json::Value SegmentOrDefinition::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_SegmentAndDefinitions; ToJsonUtilO(SegmentAndDefinitions, each_SegmentAndDefinitions); ToJsonField(output, keySegmentAndDefinitions) = each_SegmentAndDefinitions;
+            return output;
+        }
+
+        void SegmentModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyDescription), Description);
+            FromJsonUtilO(FromJsonField(input, keyEnteredSegmentActions), EnteredSegmentActions);
+            FromJsonUtilT(FromJsonField(input, keyLastUpdateTime), LastUpdateTime);
+            FromJsonUtilO(FromJsonField(input, keyLeftSegmentActions), LeftSegmentActions);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilS(FromJsonField(input, keySegmentId), SegmentId);
+            FromJsonUtilO(FromJsonField(input, keySegmentOrDefinitions), SegmentOrDefinitions);
+        }
+
+        Json::Value SegmentModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Description; ToJsonUtilS(Description, each_Description); ToJsonField(output, keyDescription) = each_Description;
+            Json::Value each_EnteredSegmentActions; ToJsonUtilO(EnteredSegmentActions, each_EnteredSegmentActions); ToJsonField(output, keyEnteredSegmentActions) = each_EnteredSegmentActions;
+            Json::Value each_LastUpdateTime; ToJsonUtilT(LastUpdateTime, each_LastUpdateTime); ToJsonField(output, keyLastUpdateTime) = each_LastUpdateTime;
+            Json::Value each_LeftSegmentActions; ToJsonUtilO(LeftSegmentActions, each_LeftSegmentActions); ToJsonField(output, keyLeftSegmentActions) = each_LeftSegmentActions;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_SegmentId; ToJsonUtilS(SegmentId, each_SegmentId); ToJsonField(output, keySegmentId) = each_SegmentId;
+            Json::Value each_SegmentOrDefinitions; ToJsonUtilO(SegmentOrDefinitions, each_SegmentOrDefinitions); ToJsonField(output, keySegmentOrDefinitions) = each_SegmentOrDefinitions;
+            return output;
+        }
+
+        void CreateSegmentRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keySegmentModel), pfSegmentModel);
+        }
+
+        Json::Value CreateSegmentRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_pfSegmentModel; ToJsonUtilO(pfSegmentModel, each_pfSegmentModel); ToJsonField(output, keySegmentModel) = each_pfSegmentModel;
+            return output;
+        }
+
+        void CreateSegmentResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyErrorMessage), ErrorMessage);
+            FromJsonUtilS(FromJsonField(input, keySegmentId), SegmentId);
+        }
+
+        Json::Value CreateSegmentResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ErrorMessage; ToJsonUtilS(ErrorMessage, each_ErrorMessage); ToJsonField(output, keyErrorMessage) = each_ErrorMessage;
+            Json::Value each_SegmentId; ToJsonUtilS(SegmentId, each_SegmentId); ToJsonField(output, keySegmentId) = each_SegmentId;
+            return output;
+        }
+
+        void CreateTaskResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyTaskId), TaskId);
+        }
+
+        Json::Value CreateTaskResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_TaskId; ToJsonUtilS(TaskId, each_TaskId); ToJsonField(output, keyTaskId) = each_TaskId;
+            return output;
+        }
+
+        void DeleteContentRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyKey), Key);
+        }
+
+        Json::Value DeleteContentRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Key; ToJsonUtilS(Key, each_Key); ToJsonField(output, keyKey) = each_Key;
+            return output;
+        }
+
+        void DeleteMasterPlayerAccountRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyMetaData), MetaData);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value DeleteMasterPlayerAccountRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_MetaData; ToJsonUtilS(MetaData, each_MetaData); ToJsonField(output, keyMetaData) = each_MetaData;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void DeleteMasterPlayerAccountResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyJobReceiptId), JobReceiptId);
+            FromJsonUtilS(FromJsonField(input, keyTitleIds), TitleIds);
+        }
+
+        Json::Value DeleteMasterPlayerAccountResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_JobReceiptId; ToJsonUtilS(JobReceiptId, each_JobReceiptId); ToJsonField(output, keyJobReceiptId) = each_JobReceiptId;
+            Json::Value each_TitleIds; ToJsonUtilS(TitleIds, each_TitleIds); ToJsonField(output, keyTitleIds) = each_TitleIds;
+            return output;
+        }
+
+        void DeleteOpenIdConnectionRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyConnectionId), ConnectionId);
+        }
+
+        Json::Value DeleteOpenIdConnectionRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ConnectionId; ToJsonUtilS(ConnectionId, each_ConnectionId); ToJsonField(output, keyConnectionId) = each_ConnectionId;
+            return output;
+        }
+
+        void DeletePlayerRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value DeletePlayerRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void DeletePlayerResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value DeletePlayerResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void DeletePlayerSharedSecretRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keySecretKey), SecretKey);
+        }
+
+        Json::Value DeletePlayerSharedSecretRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_SecretKey; ToJsonUtilS(SecretKey, each_SecretKey); ToJsonField(output, keySecretKey) = each_SecretKey;
+            return output;
+        }
+
+        void DeletePlayerSharedSecretResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value DeletePlayerSharedSecretResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void DeleteSegmentRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keySegmentId), SegmentId);
+        }
+
+        Json::Value DeleteSegmentRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_SegmentId; ToJsonUtilS(SegmentId, each_SegmentId); ToJsonField(output, keySegmentId) = each_SegmentId;
+            return output;
+        }
+
+        void DeleteSegmentsResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyErrorMessage), ErrorMessage);
+        }
+
+        Json::Value DeleteSegmentsResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ErrorMessage; ToJsonUtilS(ErrorMessage, each_ErrorMessage); ToJsonField(output, keyErrorMessage) = each_ErrorMessage;
+            return output;
+        }
+
+        void DeleteStoreRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyStoreId), StoreId);
+        }
+
+        Json::Value DeleteStoreRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_StoreId; ToJsonUtilS(StoreId, each_StoreId); ToJsonField(output, keyStoreId) = each_StoreId;
+            return output;
+        }
+
+        void DeleteStoreResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value DeleteStoreResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void DeleteTaskRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyIdentifier), Identifier);
+        }
+
+        Json::Value DeleteTaskRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Identifier; ToJsonUtilO(Identifier, each_Identifier); ToJsonField(output, keyIdentifier) = each_Identifier;
+            return output;
+        }
+
+        void DeleteTitleDataOverrideRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyOverrideLabel), OverrideLabel);
+        }
+
+        Json::Value DeleteTitleDataOverrideRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_OverrideLabel; ToJsonUtilS(OverrideLabel, each_OverrideLabel); ToJsonField(output, keyOverrideLabel) = each_OverrideLabel;
+            return output;
+        }
+
+        void DeleteTitleDataOverrideResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value DeleteTitleDataOverrideResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void DeleteTitleRequest::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value DeleteTitleRequest::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void DeleteTitleResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value DeleteTitleResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void EmptyResponse::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value EmptyResponse::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void EntityKey::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyId), Id);
+            FromJsonUtilS(FromJsonField(input, keyType), Type);
+        }
+
+        Json::Value EntityKey::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Id; ToJsonUtilS(Id, each_Id); ToJsonField(output, keyId) = each_Id;
+            Json::Value each_Type; ToJsonUtilS(Type, each_Type); ToJsonField(output, keyType) = each_Type;
+            return output;
+        }
+
+        void ExportMasterPlayerDataRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value ExportMasterPlayerDataRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void ExportMasterPlayerDataResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyJobReceiptId), JobReceiptId);
+        }
+
+        Json::Value ExportMasterPlayerDataResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_JobReceiptId; ToJsonUtilS(JobReceiptId, each_JobReceiptId); ToJsonField(output, keyJobReceiptId) = each_JobReceiptId;
+            return output;
+        }
+
+        void GameModeInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyGamemode), Gamemode);
+            FromJsonUtilP(FromJsonField(input, keyMaxPlayerCount), MaxPlayerCount);
+            FromJsonUtilP(FromJsonField(input, keyMinPlayerCount), MinPlayerCount);
+            FromJsonUtilP(FromJsonField(input, keyStartOpen), StartOpen);
+        }
+
+        Json::Value GameModeInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Gamemode; ToJsonUtilS(Gamemode, each_Gamemode); ToJsonField(output, keyGamemode) = each_Gamemode;
+            Json::Value each_MaxPlayerCount; ToJsonUtilP(MaxPlayerCount, each_MaxPlayerCount); ToJsonField(output, keyMaxPlayerCount) = each_MaxPlayerCount;
+            Json::Value each_MinPlayerCount; ToJsonUtilP(MinPlayerCount, each_MinPlayerCount); ToJsonField(output, keyMinPlayerCount) = each_MinPlayerCount;
+            Json::Value each_StartOpen; ToJsonUtilP(StartOpen, each_StartOpen); ToJsonField(output, keyStartOpen) = each_StartOpen;
+            return output;
+        }
+
+        void GetActionsOnPlayersInSegmentTaskInstanceResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyParameter), Parameter);
+            FromJsonUtilO(FromJsonField(input, keySummary), Summary);
+        }
+
+        Json::Value GetActionsOnPlayersInSegmentTaskInstanceResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Parameter; ToJsonUtilO(Parameter, each_Parameter); ToJsonField(output, keyParameter) = each_Parameter;
+            Json::Value each_Summary; ToJsonUtilO(Summary, each_Summary); ToJsonField(output, keySummary) = each_Summary;
+            return output;
+        }
+
+        void GetAllSegmentsRequest::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value GetAllSegmentsRequest::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void GetSegmentResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyABTestParent), ABTestParent);
+            FromJsonUtilS(FromJsonField(input, keyId), Id);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+        }
+
+        Json::Value GetSegmentResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ABTestParent; ToJsonUtilS(ABTestParent, each_ABTestParent); ToJsonField(output, keyABTestParent) = each_ABTestParent;
+            Json::Value each_Id; ToJsonUtilS(Id, each_Id); ToJsonField(output, keyId) = each_Id;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            return output;
+        }
+
+        void GetAllSegmentsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keySegments), Segments);
+        }
+
+        Json::Value GetAllSegmentsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Segments; ToJsonUtilO(Segments, each_Segments); ToJsonField(output, keySegments) = each_Segments;
+            return output;
+        }
+
+        void GetCatalogItemsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+        }
+
+        Json::Value GetCatalogItemsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            return output;
+        }
+
+        void GetCatalogItemsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyCatalog), Catalog);
+        }
+
+        Json::Value GetCatalogItemsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Catalog; ToJsonUtilO(Catalog, each_Catalog); ToJsonField(output, keyCatalog) = each_Catalog;
+            return output;
+        }
+
+        void GetCloudScriptRevisionRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyRevision), Revision);
+            FromJsonUtilP(FromJsonField(input, keyVersion), Version);
+        }
+
+        Json::Value GetCloudScriptRevisionRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Revision; ToJsonUtilP(Revision, each_Revision); ToJsonField(output, keyRevision) = each_Revision;
+            Json::Value each_Version; ToJsonUtilP(Version, each_Version); ToJsonField(output, keyVersion) = each_Version;
+            return output;
+        }
+
+        void GetCloudScriptRevisionResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilT(FromJsonField(input, keyCreatedAt), CreatedAt);
+            FromJsonUtilO(FromJsonField(input, keyFiles), Files);
+            FromJsonUtilP(FromJsonField(input, keyIsPublished), IsPublished);
+            FromJsonUtilP(FromJsonField(input, keyRevision), Revision);
+            FromJsonUtilP(FromJsonField(input, keyVersion), Version);
+        }
+
+        Json::Value GetCloudScriptRevisionResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CreatedAt; ToJsonUtilT(CreatedAt, each_CreatedAt); ToJsonField(output, keyCreatedAt) = each_CreatedAt;
+            Json::Value each_Files; ToJsonUtilO(Files, each_Files); ToJsonField(output, keyFiles) = each_Files;
+            Json::Value each_IsPublished; ToJsonUtilP(IsPublished, each_IsPublished); ToJsonField(output, keyIsPublished) = each_IsPublished;
+            Json::Value each_Revision; ToJsonUtilP(Revision, each_Revision); ToJsonField(output, keyRevision) = each_Revision;
+            Json::Value each_Version; ToJsonUtilP(Version, each_Version); ToJsonField(output, keyVersion) = each_Version;
+            return output;
+        }
+
+        void GetCloudScriptTaskInstanceResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyParameter), Parameter);
+            FromJsonUtilO(FromJsonField(input, keySummary), Summary);
+        }
+
+        Json::Value GetCloudScriptTaskInstanceResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Parameter; ToJsonUtilO(Parameter, each_Parameter); ToJsonField(output, keyParameter) = each_Parameter;
+            Json::Value each_Summary; ToJsonUtilO(Summary, each_Summary); ToJsonField(output, keySummary) = each_Summary;
+            return output;
+        }
+
+        void GetCloudScriptVersionsRequest::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value GetCloudScriptVersionsRequest::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void GetCloudScriptVersionsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyVersions), Versions);
+        }
+
+        Json::Value GetCloudScriptVersionsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Versions; ToJsonUtilO(Versions, each_Versions); ToJsonField(output, keyVersions) = each_Versions;
+            return output;
+        }
+
+        void GetContentListRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPrefix), Prefix);
+        }
+
+        Json::Value GetContentListRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Prefix; ToJsonUtilS(Prefix, each_Prefix); ToJsonField(output, keyPrefix) = each_Prefix;
+            return output;
+        }
+
+        void GetContentListResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyContents), Contents);
+            FromJsonUtilP(FromJsonField(input, keyItemCount), ItemCount);
+            FromJsonUtilP(FromJsonField(input, keyTotalSize), TotalSize);
+        }
+
+        Json::Value GetContentListResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Contents; ToJsonUtilO(Contents, each_Contents); ToJsonField(output, keyContents) = each_Contents;
+            Json::Value each_ItemCount; ToJsonUtilP(ItemCount, each_ItemCount); ToJsonField(output, keyItemCount) = each_ItemCount;
+            Json::Value each_TotalSize; ToJsonUtilP(TotalSize, each_TotalSize); ToJsonField(output, keyTotalSize) = each_TotalSize;
+            return output;
+        }
+
+        void GetContentUploadUrlRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyContentType), ContentType);
+            FromJsonUtilS(FromJsonField(input, keyKey), Key);
+        }
+
+        Json::Value GetContentUploadUrlRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ContentType; ToJsonUtilS(ContentType, each_ContentType); ToJsonField(output, keyContentType) = each_ContentType;
+            Json::Value each_Key; ToJsonUtilS(Key, each_Key); ToJsonField(output, keyKey) = each_Key;
+            return output;
+        }
+
+        void GetContentUploadUrlResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyURL), URL);
+        }
+
+        Json::Value GetContentUploadUrlResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_URL; ToJsonUtilS(URL, each_URL); ToJsonField(output, keyURL) = each_URL;
+            return output;
+        }
+
+        void GetDataReportRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyDay), Day);
+            FromJsonUtilP(FromJsonField(input, keyMonth), Month);
+            FromJsonUtilS(FromJsonField(input, keyReportName), ReportName);
+            FromJsonUtilP(FromJsonField(input, keyYear), Year);
+        }
+
+        Json::Value GetDataReportRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Day; ToJsonUtilP(Day, each_Day); ToJsonField(output, keyDay) = each_Day;
+            Json::Value each_Month; ToJsonUtilP(Month, each_Month); ToJsonField(output, keyMonth) = each_Month;
+            Json::Value each_ReportName; ToJsonUtilS(ReportName, each_ReportName); ToJsonField(output, keyReportName) = each_ReportName;
+            Json::Value each_Year; ToJsonUtilP(Year, each_Year); ToJsonField(output, keyYear) = each_Year;
+            return output;
+        }
+
+        void GetDataReportResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyDownloadUrl), DownloadUrl);
+        }
+
+        Json::Value GetDataReportResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_DownloadUrl; ToJsonUtilS(DownloadUrl, each_DownloadUrl); ToJsonField(output, keyDownloadUrl) = each_DownloadUrl;
+            return output;
+        }
+
+        void GetMatchmakerGameInfoRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyLobbyId), LobbyId);
+        }
+
+        Json::Value GetMatchmakerGameInfoRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_LobbyId; ToJsonUtilS(LobbyId, each_LobbyId); ToJsonField(output, keyLobbyId) = each_LobbyId;
+            return output;
+        }
+
+        void GetMatchmakerGameInfoResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBuildVersion), BuildVersion);
+            FromJsonUtilT(FromJsonField(input, keyEndTime), EndTime);
+            FromJsonUtilS(FromJsonField(input, keyLobbyId), LobbyId);
+            FromJsonUtilS(FromJsonField(input, keyMode), Mode);
+            FromJsonUtilS(FromJsonField(input, keyPlayers), Players);
+            FromJsonUtilE(FromJsonField(input, keyRegion), pfRegion);
+            FromJsonUtilS(FromJsonField(input, keyServerIPV4Address), ServerIPV4Address);
+            FromJsonUtilS(FromJsonField(input, keyServerIPV6Address), ServerIPV6Address);
+            FromJsonUtilP(FromJsonField(input, keyServerPort), ServerPort);
+            FromJsonUtilS(FromJsonField(input, keyServerPublicDNSName), ServerPublicDNSName);
+            FromJsonUtilT(FromJsonField(input, keyStartTime), StartTime);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+        }
+
+        Json::Value GetMatchmakerGameInfoResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BuildVersion; ToJsonUtilS(BuildVersion, each_BuildVersion); ToJsonField(output, keyBuildVersion) = each_BuildVersion;
+            Json::Value each_EndTime; ToJsonUtilT(EndTime, each_EndTime); ToJsonField(output, keyEndTime) = each_EndTime;
+            Json::Value each_LobbyId; ToJsonUtilS(LobbyId, each_LobbyId); ToJsonField(output, keyLobbyId) = each_LobbyId;
+            Json::Value each_Mode; ToJsonUtilS(Mode, each_Mode); ToJsonField(output, keyMode) = each_Mode;
+            Json::Value each_Players; ToJsonUtilS(Players, each_Players); ToJsonField(output, keyPlayers) = each_Players;
+            Json::Value each_pfRegion; ToJsonUtilE(pfRegion, each_pfRegion); ToJsonField(output, keyRegion) = each_pfRegion;
+            Json::Value each_ServerIPV4Address; ToJsonUtilS(ServerIPV4Address, each_ServerIPV4Address); ToJsonField(output, keyServerIPV4Address) = each_ServerIPV4Address;
+            Json::Value each_ServerIPV6Address; ToJsonUtilS(ServerIPV6Address, each_ServerIPV6Address); ToJsonField(output, keyServerIPV6Address) = each_ServerIPV6Address;
+            Json::Value each_ServerPort; ToJsonUtilP(ServerPort, each_ServerPort); ToJsonField(output, keyServerPort) = each_ServerPort;
+            Json::Value each_ServerPublicDNSName; ToJsonUtilS(ServerPublicDNSName, each_ServerPublicDNSName); ToJsonField(output, keyServerPublicDNSName) = each_ServerPublicDNSName;
+            Json::Value each_StartTime; ToJsonUtilT(StartTime, each_StartTime); ToJsonField(output, keyStartTime) = each_StartTime;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            return output;
+        }
+
+        void GetMatchmakerGameModesRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBuildVersion), BuildVersion);
+        }
+
+        Json::Value GetMatchmakerGameModesRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BuildVersion; ToJsonUtilS(BuildVersion, each_BuildVersion); ToJsonField(output, keyBuildVersion) = each_BuildVersion;
+            return output;
+        }
+
+        void GetMatchmakerGameModesResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyGameModes), GameModes);
+        }
+
+        Json::Value GetMatchmakerGameModesResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GameModes; ToJsonUtilO(GameModes, each_GameModes); ToJsonField(output, keyGameModes) = each_GameModes;
+            return output;
+        }
+
+        void GetPlayedTitleListRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GetPlayedTitleListRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void GetPlayedTitleListResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyTitleIds), TitleIds);
+        }
+
+        Json::Value GetPlayedTitleListResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_TitleIds; ToJsonUtilS(TitleIds, each_TitleIds); ToJsonField(output, keyTitleIds) = each_TitleIds;
+            return output;
+        }
+
+        void GetPlayerIdFromAuthTokenRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyToken), Token);
+            FromJsonEnum(FromJsonField(input, keyTokenType), TokenType);
+        }
+
+        Json::Value GetPlayerIdFromAuthTokenRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Token; ToJsonUtilS(Token, each_Token); ToJsonField(output, keyToken) = each_Token;
+            Json::Value each_TokenType; ToJsonEnum(TokenType, each_TokenType); ToJsonField(output, keyTokenType) = each_TokenType;
+            return output;
+        }
+
+        void GetPlayerIdFromAuthTokenResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GetPlayerIdFromAuthTokenResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void PlayerProfileViewConstraints::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyShowAvatarUrl), ShowAvatarUrl);
+            FromJsonUtilP(FromJsonField(input, keyShowBannedUntil), ShowBannedUntil);
+            FromJsonUtilP(FromJsonField(input, keyShowCampaignAttributions), ShowCampaignAttributions);
+            FromJsonUtilP(FromJsonField(input, keyShowContactEmailAddresses), ShowContactEmailAddresses);
+            FromJsonUtilP(FromJsonField(input, keyShowCreated), ShowCreated);
+            FromJsonUtilP(FromJsonField(input, keyShowDisplayName), ShowDisplayName);
+            FromJsonUtilP(FromJsonField(input, keyShowExperimentVariants), ShowExperimentVariants);
+            FromJsonUtilP(FromJsonField(input, keyShowLastLogin), ShowLastLogin);
+            FromJsonUtilP(FromJsonField(input, keyShowLinkedAccounts), ShowLinkedAccounts);
+            FromJsonUtilP(FromJsonField(input, keyShowLocations), ShowLocations);
+            FromJsonUtilP(FromJsonField(input, keyShowMemberships), ShowMemberships);
+            FromJsonUtilP(FromJsonField(input, keyShowOrigination), ShowOrigination);
+            FromJsonUtilP(FromJsonField(input, keyShowPushNotificationRegistrations), ShowPushNotificationRegistrations);
+            FromJsonUtilP(FromJsonField(input, keyShowStatistics), ShowStatistics);
+            FromJsonUtilP(FromJsonField(input, keyShowTags), ShowTags);
+            FromJsonUtilP(FromJsonField(input, keyShowTotalValueToDateInUsd), ShowTotalValueToDateInUsd);
+            FromJsonUtilP(FromJsonField(input, keyShowValuesToDate), ShowValuesToDate);
+        }
+
+        Json::Value PlayerProfileViewConstraints::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ShowAvatarUrl; ToJsonUtilP(ShowAvatarUrl, each_ShowAvatarUrl); ToJsonField(output, keyShowAvatarUrl) = each_ShowAvatarUrl;
+            Json::Value each_ShowBannedUntil; ToJsonUtilP(ShowBannedUntil, each_ShowBannedUntil); ToJsonField(output, keyShowBannedUntil) = each_ShowBannedUntil;
+            Json::Value each_ShowCampaignAttributions; ToJsonUtilP(ShowCampaignAttributions, each_ShowCampaignAttributions); ToJsonField(output, keyShowCampaignAttributions) = each_ShowCampaignAttributions;
+            Json::Value each_ShowContactEmailAddresses; ToJsonUtilP(ShowContactEmailAddresses, each_ShowContactEmailAddresses); ToJsonField(output, keyShowContactEmailAddresses) = each_ShowContactEmailAddresses;
+            Json::Value each_ShowCreated; ToJsonUtilP(ShowCreated, each_ShowCreated); ToJsonField(output, keyShowCreated) = each_ShowCreated;
+            Json::Value each_ShowDisplayName; ToJsonUtilP(ShowDisplayName, each_ShowDisplayName); ToJsonField(output, keyShowDisplayName) = each_ShowDisplayName;
+            Json::Value each_ShowExperimentVariants; ToJsonUtilP(ShowExperimentVariants, each_ShowExperimentVariants); ToJsonField(output, keyShowExperimentVariants) = each_ShowExperimentVariants;
+            Json::Value each_ShowLastLogin; ToJsonUtilP(ShowLastLogin, each_ShowLastLogin); ToJsonField(output, keyShowLastLogin) = each_ShowLastLogin;
+            Json::Value each_ShowLinkedAccounts; ToJsonUtilP(ShowLinkedAccounts, each_ShowLinkedAccounts); ToJsonField(output, keyShowLinkedAccounts) = each_ShowLinkedAccounts;
+            Json::Value each_ShowLocations; ToJsonUtilP(ShowLocations, each_ShowLocations); ToJsonField(output, keyShowLocations) = each_ShowLocations;
+            Json::Value each_ShowMemberships; ToJsonUtilP(ShowMemberships, each_ShowMemberships); ToJsonField(output, keyShowMemberships) = each_ShowMemberships;
+            Json::Value each_ShowOrigination; ToJsonUtilP(ShowOrigination, each_ShowOrigination); ToJsonField(output, keyShowOrigination) = each_ShowOrigination;
+            Json::Value each_ShowPushNotificationRegistrations; ToJsonUtilP(ShowPushNotificationRegistrations, each_ShowPushNotificationRegistrations); ToJsonField(output, keyShowPushNotificationRegistrations) = each_ShowPushNotificationRegistrations;
+            Json::Value each_ShowStatistics; ToJsonUtilP(ShowStatistics, each_ShowStatistics); ToJsonField(output, keyShowStatistics) = each_ShowStatistics;
+            Json::Value each_ShowTags; ToJsonUtilP(ShowTags, each_ShowTags); ToJsonField(output, keyShowTags) = each_ShowTags;
+            Json::Value each_ShowTotalValueToDateInUsd; ToJsonUtilP(ShowTotalValueToDateInUsd, each_ShowTotalValueToDateInUsd); ToJsonField(output, keyShowTotalValueToDateInUsd) = each_ShowTotalValueToDateInUsd;
+            Json::Value each_ShowValuesToDate; ToJsonUtilP(ShowValuesToDate, each_ShowValuesToDate); ToJsonField(output, keyShowValuesToDate) = each_ShowValuesToDate;
+            return output;
+        }
+
+        void GetPlayerProfileRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilO(FromJsonField(input, keyProfileConstraints), ProfileConstraints);
+        }
+
+        Json::Value GetPlayerProfileRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_ProfileConstraints; ToJsonUtilO(ProfileConstraints, each_ProfileConstraints); ToJsonField(output, keyProfileConstraints) = each_ProfileConstraints;
+            return output;
+        }
+
+        void LinkedPlatformAccountModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyEmail), Email);
+            FromJsonUtilE(FromJsonField(input, keyPlatform), Platform);
+            FromJsonUtilS(FromJsonField(input, keyPlatformUserId), PlatformUserId);
+            FromJsonUtilS(FromJsonField(input, keyUsername), Username);
+        }
+
+        Json::Value LinkedPlatformAccountModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Email; ToJsonUtilS(Email, each_Email); ToJsonField(output, keyEmail) = each_Email;
+            Json::Value each_Platform; ToJsonUtilE(Platform, each_Platform); ToJsonField(output, keyPlatform) = each_Platform;
+            Json::Value each_PlatformUserId; ToJsonUtilS(PlatformUserId, each_PlatformUserId); ToJsonField(output, keyPlatformUserId) = each_PlatformUserId;
+            Json::Value each_Username; ToJsonUtilS(Username, each_Username); ToJsonField(output, keyUsername) = each_Username;
+            return output;
+        }
+
+        void LocationModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCity), City);
+            FromJsonUtilE(FromJsonField(input, keyContinentCode), pfContinentCode);
+            FromJsonUtilE(FromJsonField(input, keyCountryCode), pfCountryCode);
+            FromJsonUtilP(FromJsonField(input, keyLatitude), Latitude);
+            FromJsonUtilP(FromJsonField(input, keyLongitude), Longitude);
+        }
+
+        Json::Value LocationModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_City; ToJsonUtilS(City, each_City); ToJsonField(output, keyCity) = each_City;
+            Json::Value each_pfContinentCode; ToJsonUtilE(pfContinentCode, each_pfContinentCode); ToJsonField(output, keyContinentCode) = each_pfContinentCode;
+            Json::Value each_pfCountryCode; ToJsonUtilE(pfCountryCode, each_pfCountryCode); ToJsonField(output, keyCountryCode) = each_pfCountryCode;
+            Json::Value each_Latitude; ToJsonUtilP(Latitude, each_Latitude); ToJsonField(output, keyLatitude) = each_Latitude;
+            Json::Value each_Longitude; ToJsonUtilP(Longitude, each_Longitude); ToJsonField(output, keyLongitude) = each_Longitude;
+            return output;
+        }
+
+        void SubscriptionModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilT(FromJsonField(input, keyExpiration), Expiration);
+            FromJsonUtilT(FromJsonField(input, keyInitialSubscriptionTime), InitialSubscriptionTime);
+            FromJsonUtilP(FromJsonField(input, keyIsActive), IsActive);
+            FromJsonUtilE(FromJsonField(input, keyStatus), Status);
+            FromJsonUtilS(FromJsonField(input, keySubscriptionId), SubscriptionId);
+            FromJsonUtilS(FromJsonField(input, keySubscriptionItemId), SubscriptionItemId);
+            FromJsonUtilS(FromJsonField(input, keySubscriptionProvider), SubscriptionProvider);
+        }
+
+        Json::Value SubscriptionModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Expiration; ToJsonUtilT(Expiration, each_Expiration); ToJsonField(output, keyExpiration) = each_Expiration;
+            Json::Value each_InitialSubscriptionTime; ToJsonUtilT(InitialSubscriptionTime, each_InitialSubscriptionTime); ToJsonField(output, keyInitialSubscriptionTime) = each_InitialSubscriptionTime;
+            Json::Value each_IsActive; ToJsonUtilP(IsActive, each_IsActive); ToJsonField(output, keyIsActive) = each_IsActive;
+            Json::Value each_Status; ToJsonUtilE(Status, each_Status); ToJsonField(output, keyStatus) = each_Status;
+            Json::Value each_SubscriptionId; ToJsonUtilS(SubscriptionId, each_SubscriptionId); ToJsonField(output, keySubscriptionId) = each_SubscriptionId;
+            Json::Value each_SubscriptionItemId; ToJsonUtilS(SubscriptionItemId, each_SubscriptionItemId); ToJsonField(output, keySubscriptionItemId) = each_SubscriptionItemId;
+            Json::Value each_SubscriptionProvider; ToJsonUtilS(SubscriptionProvider, each_SubscriptionProvider); ToJsonField(output, keySubscriptionProvider) = each_SubscriptionProvider;
+            return output;
+        }
+
+        void MembershipModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyIsActive), IsActive);
+            FromJsonUtilT(FromJsonField(input, keyMembershipExpiration), MembershipExpiration);
+            FromJsonUtilS(FromJsonField(input, keyMembershipId), MembershipId);
+            FromJsonUtilT(FromJsonField(input, keyOverrideExpiration), OverrideExpiration);
+            FromJsonUtilO(FromJsonField(input, keySubscriptions), Subscriptions);
+        }
+
+        Json::Value MembershipModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_IsActive; ToJsonUtilP(IsActive, each_IsActive); ToJsonField(output, keyIsActive) = each_IsActive;
+            Json::Value each_MembershipExpiration; ToJsonUtilT(MembershipExpiration, each_MembershipExpiration); ToJsonField(output, keyMembershipExpiration) = each_MembershipExpiration;
+            Json::Value each_MembershipId; ToJsonUtilS(MembershipId, each_MembershipId); ToJsonField(output, keyMembershipId) = each_MembershipId;
+            Json::Value each_OverrideExpiration; ToJsonUtilT(OverrideExpiration, each_OverrideExpiration); ToJsonField(output, keyOverrideExpiration) = each_OverrideExpiration;
+            Json::Value each_Subscriptions; ToJsonUtilO(Subscriptions, each_Subscriptions); ToJsonField(output, keySubscriptions) = each_Subscriptions;
+            return output;
+        }
+
+        void PushNotificationRegistrationModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyNotificationEndpointARN), NotificationEndpointARN);
+            FromJsonUtilE(FromJsonField(input, keyPlatform), Platform);
+        }
+
+        Json::Value PushNotificationRegistrationModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_NotificationEndpointARN; ToJsonUtilS(NotificationEndpointARN, each_NotificationEndpointARN); ToJsonField(output, keyNotificationEndpointARN) = each_NotificationEndpointARN;
+            Json::Value each_Platform; ToJsonUtilE(Platform, each_Platform); ToJsonField(output, keyPlatform) = each_Platform;
+            return output;
+        }
+
+        void StatisticModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilP(FromJsonField(input, keyValue), Value);
+            FromJsonUtilP(FromJsonField(input, keyVersion), Version);
+        }
+
+        Json::Value StatisticModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_Value; ToJsonUtilP(Value, each_Value); ToJsonField(output, keyValue) = each_Value;
+            Json::Value each_Version; ToJsonUtilP(Version, each_Version); ToJsonField(output, keyVersion) = each_Version;
+            return output;
+        }
+
+        void TagModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyTagValue), TagValue);
+        }
+
+        Json::Value TagModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_TagValue; ToJsonUtilS(TagValue, each_TagValue); ToJsonField(output, keyTagValue) = each_TagValue;
+            return output;
+        }
+
+        void ValueToDateModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCurrency), Currency);
+            FromJsonUtilP(FromJsonField(input, keyTotalValue), TotalValue);
+            FromJsonUtilS(FromJsonField(input, keyTotalValueAsDecimal), TotalValueAsDecimal);
+        }
+
+        Json::Value ValueToDateModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Currency; ToJsonUtilS(Currency, each_Currency); ToJsonField(output, keyCurrency) = each_Currency;
+            Json::Value each_TotalValue; ToJsonUtilP(TotalValue, each_TotalValue); ToJsonField(output, keyTotalValue) = each_TotalValue;
+            Json::Value each_TotalValueAsDecimal; ToJsonUtilS(TotalValueAsDecimal, each_TotalValueAsDecimal); ToJsonField(output, keyTotalValueAsDecimal) = each_TotalValueAsDecimal;
+            return output;
+        }
+
+        void PlayerProfileModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyAdCampaignAttributions), AdCampaignAttributions);
+            FromJsonUtilS(FromJsonField(input, keyAvatarUrl), AvatarUrl);
+            FromJsonUtilT(FromJsonField(input, keyBannedUntil), BannedUntil);
+            FromJsonUtilO(FromJsonField(input, keyContactEmailAddresses), ContactEmailAddresses);
+            FromJsonUtilT(FromJsonField(input, keyCreated), Created);
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+            FromJsonUtilS(FromJsonField(input, keyExperimentVariants), ExperimentVariants);
+            FromJsonUtilT(FromJsonField(input, keyLastLogin), LastLogin);
+            FromJsonUtilO(FromJsonField(input, keyLinkedAccounts), LinkedAccounts);
+            FromJsonUtilO(FromJsonField(input, keyLocations), Locations);
+            FromJsonUtilO(FromJsonField(input, keyMemberships), Memberships);
+            FromJsonUtilE(FromJsonField(input, keyOrigination), Origination);
+            FromJsonUtilS(FromJsonField(input, keyPlayerId), PlayerId);
+            FromJsonUtilS(FromJsonField(input, keyPublisherId), PublisherId);
+            FromJsonUtilO(FromJsonField(input, keyPushNotificationRegistrations), PushNotificationRegistrations);
+            FromJsonUtilO(FromJsonField(input, keyStatistics), Statistics);
+            FromJsonUtilO(FromJsonField(input, keyTags), Tags);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+            FromJsonUtilP(FromJsonField(input, keyTotalValueToDateInUSD), TotalValueToDateInUSD);
+            FromJsonUtilO(FromJsonField(input, keyValuesToDate), ValuesToDate);
+        }
+
+        Json::Value PlayerProfileModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AdCampaignAttributions; ToJsonUtilO(AdCampaignAttributions, each_AdCampaignAttributions); ToJsonField(output, keyAdCampaignAttributions) = each_AdCampaignAttributions;
+            Json::Value each_AvatarUrl; ToJsonUtilS(AvatarUrl, each_AvatarUrl); ToJsonField(output, keyAvatarUrl) = each_AvatarUrl;
+            Json::Value each_BannedUntil; ToJsonUtilT(BannedUntil, each_BannedUntil); ToJsonField(output, keyBannedUntil) = each_BannedUntil;
+            Json::Value each_ContactEmailAddresses; ToJsonUtilO(ContactEmailAddresses, each_ContactEmailAddresses); ToJsonField(output, keyContactEmailAddresses) = each_ContactEmailAddresses;
+            Json::Value each_Created; ToJsonUtilT(Created, each_Created); ToJsonField(output, keyCreated) = each_Created;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            Json::Value each_ExperimentVariants; ToJsonUtilS(ExperimentVariants, each_ExperimentVariants); ToJsonField(output, keyExperimentVariants) = each_ExperimentVariants;
+            Json::Value each_LastLogin; ToJsonUtilT(LastLogin, each_LastLogin); ToJsonField(output, keyLastLogin) = each_LastLogin;
+            Json::Value each_LinkedAccounts; ToJsonUtilO(LinkedAccounts, each_LinkedAccounts); ToJsonField(output, keyLinkedAccounts) = each_LinkedAccounts;
+            Json::Value each_Locations; ToJsonUtilO(Locations, each_Locations); ToJsonField(output, keyLocations) = each_Locations;
+            Json::Value each_Memberships; ToJsonUtilO(Memberships, each_Memberships); ToJsonField(output, keyMemberships) = each_Memberships;
+            Json::Value each_Origination; ToJsonUtilE(Origination, each_Origination); ToJsonField(output, keyOrigination) = each_Origination;
+            Json::Value each_PlayerId; ToJsonUtilS(PlayerId, each_PlayerId); ToJsonField(output, keyPlayerId) = each_PlayerId;
+            Json::Value each_PublisherId; ToJsonUtilS(PublisherId, each_PublisherId); ToJsonField(output, keyPublisherId) = each_PublisherId;
+            Json::Value each_PushNotificationRegistrations; ToJsonUtilO(PushNotificationRegistrations, each_PushNotificationRegistrations); ToJsonField(output, keyPushNotificationRegistrations) = each_PushNotificationRegistrations;
+            Json::Value each_Statistics; ToJsonUtilO(Statistics, each_Statistics); ToJsonField(output, keyStatistics) = each_Statistics;
+            Json::Value each_Tags; ToJsonUtilO(Tags, each_Tags); ToJsonField(output, keyTags) = each_Tags;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            Json::Value each_TotalValueToDateInUSD; ToJsonUtilP(TotalValueToDateInUSD, each_TotalValueToDateInUSD); ToJsonField(output, keyTotalValueToDateInUSD) = each_TotalValueToDateInUSD;
+            Json::Value each_ValuesToDate; ToJsonUtilO(ValuesToDate, each_ValuesToDate); ToJsonField(output, keyValuesToDate) = each_ValuesToDate;
+            return output;
+        }
+
+        void GetPlayerProfileResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyPlayerProfile), PlayerProfile);
+        }
+
+        Json::Value GetPlayerProfileResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayerProfile; ToJsonUtilO(PlayerProfile, each_PlayerProfile); ToJsonField(output, keyPlayerProfile) = each_PlayerProfile;
+            return output;
+        }
+
+        void GetPlayerSegmentsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keySegments), Segments);
+        }
+
+        Json::Value GetPlayerSegmentsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Segments; ToJsonUtilO(Segments, each_Segments); ToJsonField(output, keySegments) = each_Segments;
+            return output;
+        }
+
+        void GetPlayerSharedSecretsRequest::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value GetPlayerSharedSecretsRequest::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void SharedSecret::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyDisabled), Disabled);
+            FromJsonUtilS(FromJsonField(input, keyFriendlyName), FriendlyName);
+            FromJsonUtilS(FromJsonField(input, keySecretKey), SecretKey);
+        }
+
+        Json::Value SharedSecret::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Disabled; ToJsonUtilP(Disabled, each_Disabled); ToJsonField(output, keyDisabled) = each_Disabled;
+            Json::Value each_FriendlyName; ToJsonUtilS(FriendlyName, each_FriendlyName); ToJsonField(output, keyFriendlyName) = each_FriendlyName;
+            Json::Value each_SecretKey; ToJsonUtilS(SecretKey, each_SecretKey); ToJsonField(output, keySecretKey) = each_SecretKey;
+            return output;
+        }
+
+        void GetPlayerSharedSecretsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keySharedSecrets), SharedSecrets);
+        }
+
+        Json::Value GetPlayerSharedSecretsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_SharedSecrets; ToJsonUtilO(SharedSecrets, each_SharedSecrets); ToJsonField(output, keySharedSecrets) = each_SharedSecrets;
+            return output;
+        }
+
+        void GetPlayersInSegmentRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyContinuationToken), ContinuationToken);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyMaxBatchSize), MaxBatchSize);
+            FromJsonUtilP(FromJsonField(input, keySecondsToLive), SecondsToLive);
+            FromJsonUtilS(FromJsonField(input, keySegmentId), SegmentId);
+        }
+
+        Json::Value GetPlayersInSegmentRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ContinuationToken; ToJsonUtilS(ContinuationToken, each_ContinuationToken); ToJsonField(output, keyContinuationToken) = each_ContinuationToken;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_MaxBatchSize; ToJsonUtilP(MaxBatchSize, each_MaxBatchSize); ToJsonField(output, keyMaxBatchSize) = each_MaxBatchSize;
+            Json::Value each_SecondsToLive; ToJsonUtilP(SecondsToLive, each_SecondsToLive); ToJsonField(output, keySecondsToLive) = each_SecondsToLive;
+            Json::Value each_SegmentId; ToJsonUtilS(SegmentId, each_SegmentId); ToJsonField(output, keySegmentId) = each_SegmentId;
+            return output;
+        }
+
+        void PlayerLinkedAccount::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyEmail), Email);
+            FromJsonUtilE(FromJsonField(input, keyPlatform), Platform);
+            FromJsonUtilS(FromJsonField(input, keyPlatformUserId), PlatformUserId);
+            FromJsonUtilS(FromJsonField(input, keyUsername), Username);
+        }
+
+        Json::Value PlayerLinkedAccount::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Email; ToJsonUtilS(Email, each_Email); ToJsonField(output, keyEmail) = each_Email;
+            Json::Value each_Platform; ToJsonUtilE(Platform, each_Platform); ToJsonField(output, keyPlatform) = each_Platform;
+            Json::Value each_PlatformUserId; ToJsonUtilS(PlatformUserId, each_PlatformUserId); ToJsonField(output, keyPlatformUserId) = each_PlatformUserId;
+            Json::Value each_Username; ToJsonUtilS(Username, each_Username); ToJsonField(output, keyUsername) = each_Username;
+            return output;
+        }
+
+        void PlayerLocation::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCity), City);
+            FromJsonEnum(FromJsonField(input, keyContinentCode), pfContinentCode);
+            FromJsonEnum(FromJsonField(input, keyCountryCode), pfCountryCode);
+            FromJsonUtilP(FromJsonField(input, keyLatitude), Latitude);
+            FromJsonUtilP(FromJsonField(input, keyLongitude), Longitude);
+        }
+
+        Json::Value PlayerLocation::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_City; ToJsonUtilS(City, each_City); ToJsonField(output, keyCity) = each_City;
+            Json::Value each_pfContinentCode; ToJsonEnum(pfContinentCode, each_pfContinentCode); ToJsonField(output, keyContinentCode) = each_pfContinentCode;
+            Json::Value each_pfCountryCode; ToJsonEnum(pfCountryCode, each_pfCountryCode); ToJsonField(output, keyCountryCode) = each_pfCountryCode;
+            Json::Value each_Latitude; ToJsonUtilP(Latitude, each_Latitude); ToJsonField(output, keyLatitude) = each_Latitude;
+            Json::Value each_Longitude; ToJsonUtilP(Longitude, each_Longitude); ToJsonField(output, keyLongitude) = each_Longitude;
+            return output;
+        }
+
+        void PlayerStatistic::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyId), Id);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilP(FromJsonField(input, keyStatisticValue), StatisticValue);
+            FromJsonUtilP(FromJsonField(input, keyStatisticVersion), StatisticVersion);
+        }
+
+        Json::Value PlayerStatistic::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Id; ToJsonUtilS(Id, each_Id); ToJsonField(output, keyId) = each_Id;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_StatisticValue; ToJsonUtilP(StatisticValue, each_StatisticValue); ToJsonField(output, keyStatisticValue) = each_StatisticValue;
+            Json::Value each_StatisticVersion; ToJsonUtilP(StatisticVersion, each_StatisticVersion); ToJsonField(output, keyStatisticVersion) = each_StatisticVersion;
+            return output;
+        }
+
+        void PushNotificationRegistration::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyNotificationEndpointARN), NotificationEndpointARN);
+            FromJsonUtilE(FromJsonField(input, keyPlatform), Platform);
+        }
+
+        Json::Value PushNotificationRegistration::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_NotificationEndpointARN; ToJsonUtilS(NotificationEndpointARN, each_NotificationEndpointARN); ToJsonField(output, keyNotificationEndpointARN) = each_NotificationEndpointARN;
+            Json::Value each_Platform; ToJsonUtilE(Platform, each_Platform); ToJsonField(output, keyPlatform) = each_Platform;
+            return output;
+        }
+
+        void PlayerProfile::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyAdCampaignAttributions), AdCampaignAttributions);
+            FromJsonUtilS(FromJsonField(input, keyAvatarUrl), AvatarUrl);
+            FromJsonUtilT(FromJsonField(input, keyBannedUntil), BannedUntil);
+            FromJsonUtilO(FromJsonField(input, keyContactEmailAddresses), ContactEmailAddresses);
+            FromJsonUtilT(FromJsonField(input, keyCreated), Created);
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+            FromJsonUtilT(FromJsonField(input, keyLastLogin), LastLogin);
+            FromJsonUtilO(FromJsonField(input, keyLinkedAccounts), LinkedAccounts);
+            FromJsonUtilO(FromJsonField(input, keyLocations), Locations);
+            FromJsonUtilE(FromJsonField(input, keyOrigination), Origination);
+            FromJsonUtilS(FromJsonField(input, keyPlayerExperimentVariants), PlayerExperimentVariants);
+            FromJsonUtilS(FromJsonField(input, keyPlayerId), PlayerId);
+            FromJsonUtilO(FromJsonField(input, keyPlayerStatistics), PlayerStatistics);
+            FromJsonUtilS(FromJsonField(input, keyPublisherId), PublisherId);
+            FromJsonUtilO(FromJsonField(input, keyPushNotificationRegistrations), PushNotificationRegistrations);
+            FromJsonUtilP(FromJsonField(input, keyStatistics), Statistics);
+            FromJsonUtilS(FromJsonField(input, keyTags), Tags);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+            FromJsonUtilP(FromJsonField(input, keyTotalValueToDateInUSD), TotalValueToDateInUSD);
+            FromJsonUtilP(FromJsonField(input, keyValuesToDate), ValuesToDate);
+            FromJsonUtilP(FromJsonField(input, keyVirtualCurrencyBalances), VirtualCurrencyBalances);
+        }
+
+        Json::Value PlayerProfile::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AdCampaignAttributions; ToJsonUtilO(AdCampaignAttributions, each_AdCampaignAttributions); ToJsonField(output, keyAdCampaignAttributions) = each_AdCampaignAttributions;
+            Json::Value each_AvatarUrl; ToJsonUtilS(AvatarUrl, each_AvatarUrl); ToJsonField(output, keyAvatarUrl) = each_AvatarUrl;
+            Json::Value each_BannedUntil; ToJsonUtilT(BannedUntil, each_BannedUntil); ToJsonField(output, keyBannedUntil) = each_BannedUntil;
+            Json::Value each_ContactEmailAddresses; ToJsonUtilO(ContactEmailAddresses, each_ContactEmailAddresses); ToJsonField(output, keyContactEmailAddresses) = each_ContactEmailAddresses;
+            Json::Value each_Created; ToJsonUtilT(Created, each_Created); ToJsonField(output, keyCreated) = each_Created;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            Json::Value each_LastLogin; ToJsonUtilT(LastLogin, each_LastLogin); ToJsonField(output, keyLastLogin) = each_LastLogin;
+            Json::Value each_LinkedAccounts; ToJsonUtilO(LinkedAccounts, each_LinkedAccounts); ToJsonField(output, keyLinkedAccounts) = each_LinkedAccounts;
+            Json::Value each_Locations; ToJsonUtilO(Locations, each_Locations); ToJsonField(output, keyLocations) = each_Locations;
+            Json::Value each_Origination; ToJsonUtilE(Origination, each_Origination); ToJsonField(output, keyOrigination) = each_Origination;
+            Json::Value each_PlayerExperimentVariants; ToJsonUtilS(PlayerExperimentVariants, each_PlayerExperimentVariants); ToJsonField(output, keyPlayerExperimentVariants) = each_PlayerExperimentVariants;
+            Json::Value each_PlayerId; ToJsonUtilS(PlayerId, each_PlayerId); ToJsonField(output, keyPlayerId) = each_PlayerId;
+            Json::Value each_PlayerStatistics; ToJsonUtilO(PlayerStatistics, each_PlayerStatistics); ToJsonField(output, keyPlayerStatistics) = each_PlayerStatistics;
+            Json::Value each_PublisherId; ToJsonUtilS(PublisherId, each_PublisherId); ToJsonField(output, keyPublisherId) = each_PublisherId;
+            Json::Value each_PushNotificationRegistrations; ToJsonUtilO(PushNotificationRegistrations, each_PushNotificationRegistrations); ToJsonField(output, keyPushNotificationRegistrations) = each_PushNotificationRegistrations;
+            Json::Value each_Statistics; ToJsonUtilP(Statistics, each_Statistics); ToJsonField(output, keyStatistics) = each_Statistics;
+            Json::Value each_Tags; ToJsonUtilS(Tags, each_Tags); ToJsonField(output, keyTags) = each_Tags;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            Json::Value each_TotalValueToDateInUSD; ToJsonUtilP(TotalValueToDateInUSD, each_TotalValueToDateInUSD); ToJsonField(output, keyTotalValueToDateInUSD) = each_TotalValueToDateInUSD;
+            Json::Value each_ValuesToDate; ToJsonUtilP(ValuesToDate, each_ValuesToDate); ToJsonField(output, keyValuesToDate) = each_ValuesToDate;
+            Json::Value each_VirtualCurrencyBalances; ToJsonUtilP(VirtualCurrencyBalances, each_VirtualCurrencyBalances); ToJsonField(output, keyVirtualCurrencyBalances) = each_VirtualCurrencyBalances;
+            return output;
+        }
+
+        void GetPlayersInSegmentResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyContinuationToken), ContinuationToken);
+            FromJsonUtilO(FromJsonField(input, keyPlayerProfiles), PlayerProfiles);
+            FromJsonUtilP(FromJsonField(input, keyProfilesInSegment), ProfilesInSegment);
+        }
+
+        Json::Value GetPlayersInSegmentResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ContinuationToken; ToJsonUtilS(ContinuationToken, each_ContinuationToken); ToJsonField(output, keyContinuationToken) = each_ContinuationToken;
+            Json::Value each_PlayerProfiles; ToJsonUtilO(PlayerProfiles, each_PlayerProfiles); ToJsonField(output, keyPlayerProfiles) = each_PlayerProfiles;
+            Json::Value each_ProfilesInSegment; ToJsonUtilP(ProfilesInSegment, each_ProfilesInSegment); ToJsonField(output, keyProfilesInSegment) = each_ProfilesInSegment;
+            return output;
+        }
+
+        void GetPlayersSegmentsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GetPlayersSegmentsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void GetPlayerStatisticDefinitionsRequest::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value GetPlayerStatisticDefinitionsRequest::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void GetPlayerStatisticDefinitionsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyStatistics), Statistics);
+        }
+
+        Json::Value GetPlayerStatisticDefinitionsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Statistics; ToJsonUtilO(Statistics, each_Statistics); ToJsonField(output, keyStatistics) = each_Statistics;
+            return output;
+        }
+
+        void GetPlayerStatisticVersionsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+        }
+
+        Json::Value GetPlayerStatisticVersionsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            return output;
+        }
+
+        void PlayerStatisticVersion::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilT(FromJsonField(input, keyActivationTime), ActivationTime);
+            FromJsonUtilS(FromJsonField(input, keyArchiveDownloadUrl), ArchiveDownloadUrl);
+            FromJsonUtilT(FromJsonField(input, keyDeactivationTime), DeactivationTime);
+            FromJsonUtilT(FromJsonField(input, keyScheduledActivationTime), ScheduledActivationTime);
+            FromJsonUtilT(FromJsonField(input, keyScheduledDeactivationTime), ScheduledDeactivationTime);
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+            FromJsonUtilE(FromJsonField(input, keyStatus), Status);
+            FromJsonUtilP(FromJsonField(input, keyVersion), Version);
+        }
+
+        Json::Value PlayerStatisticVersion::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ActivationTime; ToJsonUtilT(ActivationTime, each_ActivationTime); ToJsonField(output, keyActivationTime) = each_ActivationTime;
+            Json::Value each_ArchiveDownloadUrl; ToJsonUtilS(ArchiveDownloadUrl, each_ArchiveDownloadUrl); ToJsonField(output, keyArchiveDownloadUrl) = each_ArchiveDownloadUrl;
+            Json::Value each_DeactivationTime; ToJsonUtilT(DeactivationTime, each_DeactivationTime); ToJsonField(output, keyDeactivationTime) = each_DeactivationTime;
+            Json::Value each_ScheduledActivationTime; ToJsonUtilT(ScheduledActivationTime, each_ScheduledActivationTime); ToJsonField(output, keyScheduledActivationTime) = each_ScheduledActivationTime;
+            Json::Value each_ScheduledDeactivationTime; ToJsonUtilT(ScheduledDeactivationTime, each_ScheduledDeactivationTime); ToJsonField(output, keyScheduledDeactivationTime) = each_ScheduledDeactivationTime;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            Json::Value each_Status; ToJsonUtilE(Status, each_Status); ToJsonField(output, keyStatus) = each_Status;
+            Json::Value each_Version; ToJsonUtilP(Version, each_Version); ToJsonField(output, keyVersion) = each_Version;
+            return output;
+        }
+
+        void GetPlayerStatisticVersionsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyStatisticVersions), StatisticVersions);
+        }
+
+        Json::Value GetPlayerStatisticVersionsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_StatisticVersions; ToJsonUtilO(StatisticVersions, each_StatisticVersions); ToJsonField(output, keyStatisticVersions) = each_StatisticVersions;
+            return output;
+        }
+
+        void GetPlayerTagsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyNamespace), Namespace);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GetPlayerTagsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Namespace; ToJsonUtilS(Namespace, each_Namespace); ToJsonField(output, keyNamespace) = each_Namespace;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void GetPlayerTagsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyTags), Tags);
+        }
+
+        Json::Value GetPlayerTagsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_Tags; ToJsonUtilS(Tags, each_Tags); ToJsonField(output, keyTags) = each_Tags;
+            return output;
+        }
+
+        void GetPolicyRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPolicyName), PolicyName);
+        }
+
+        Json::Value GetPolicyRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PolicyName; ToJsonUtilS(PolicyName, each_PolicyName); ToJsonField(output, keyPolicyName) = each_PolicyName;
+            return output;
+        }
+
+        void PermissionStatement::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAction), Action);
+            FromJsonUtilO(FromJsonField(input, keyApiConditions), ApiConditions);
+            FromJsonUtilS(FromJsonField(input, keyComment), Comment);
+            FromJsonEnum(FromJsonField(input, keyEffect), Effect);
+            FromJsonUtilS(FromJsonField(input, keyPrincipal), Principal);
+            FromJsonUtilS(FromJsonField(input, keyResource), Resource);
+        }
+
+        Json::Value PermissionStatement::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Action; ToJsonUtilS(Action, each_Action); ToJsonField(output, keyAction) = each_Action;
+            Json::Value each_ApiConditions; ToJsonUtilO(ApiConditions, each_ApiConditions); ToJsonField(output, keyApiConditions) = each_ApiConditions;
+            Json::Value each_Comment; ToJsonUtilS(Comment, each_Comment); ToJsonField(output, keyComment) = each_Comment;
+            Json::Value each_Effect; ToJsonEnum(Effect, each_Effect); ToJsonField(output, keyEffect) = each_Effect;
+            Json::Value each_Principal; ToJsonUtilS(Principal, each_Principal); ToJsonField(output, keyPrincipal) = each_Principal;
+            Json::Value each_Resource; ToJsonUtilS(Resource, each_Resource); ToJsonField(output, keyResource) = each_Resource;
+            return output;
+        }
+
+        void GetPolicyResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPolicyName), PolicyName);
+            FromJsonUtilO(FromJsonField(input, keyStatements), Statements);
+        }
+
+        Json::Value GetPolicyResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PolicyName; ToJsonUtilS(PolicyName, each_PolicyName); ToJsonField(output, keyPolicyName) = each_PolicyName;
+            Json::Value each_Statements; ToJsonUtilO(Statements, each_Statements); ToJsonField(output, keyStatements) = each_Statements;
+            return output;
+        }
+
+        void GetPublisherDataRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyKeys), Keys);
+        }
+
+        Json::Value GetPublisherDataRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Keys; ToJsonUtilS(Keys, each_Keys); ToJsonField(output, keyKeys) = each_Keys;
+            return output;
+        }
+
+        void GetPublisherDataResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyData), Data);
+        }
+
+        Json::Value GetPublisherDataResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Data; ToJsonUtilS(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            return output;
+        }
+
+        void GetRandomResultTablesRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+        }
+
+        Json::Value GetRandomResultTablesRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            return output;
+        }
+
+        void ResultTableNode::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyResultItem), ResultItem);
+            FromJsonEnum(FromJsonField(input, keyResultItemType), ResultItemType);
+            FromJsonUtilP(FromJsonField(input, keyWeight), Weight);
+        }
+
+        Json::Value ResultTableNode::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ResultItem; ToJsonUtilS(ResultItem, each_ResultItem); ToJsonField(output, keyResultItem) = each_ResultItem;
+            Json::Value each_ResultItemType; ToJsonEnum(ResultItemType, each_ResultItemType); ToJsonField(output, keyResultItemType) = each_ResultItemType;
+            Json::Value each_Weight; ToJsonUtilP(Weight, each_Weight); ToJsonField(output, keyWeight) = each_Weight;
+            return output;
+        }
+
+        void RandomResultTableListing::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilO(FromJsonField(input, keyNodes), Nodes);
+            FromJsonUtilS(FromJsonField(input, keyTableId), TableId);
+        }
+
+        Json::Value RandomResultTableListing::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_Nodes; ToJsonUtilO(Nodes, each_Nodes); ToJsonField(output, keyNodes) = each_Nodes;
+            Json::Value each_TableId; ToJsonUtilS(TableId, each_TableId); ToJsonField(output, keyTableId) = each_TableId;
+            return output;
+        }
+
+        void GetRandomResultTablesResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyTables), Tables);
+        }
+
+        Json::Value GetRandomResultTablesResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Tables; ToJsonUtilO(Tables, each_Tables); ToJsonField(output, keyTables) = each_Tables;
+            return output;
+        }
+
+        void GetSegmentsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keySegmentIds), SegmentIds);
+        }
+
+        Json::Value GetSegmentsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_SegmentIds; ToJsonUtilS(SegmentIds, each_SegmentIds); ToJsonField(output, keySegmentIds) = each_SegmentIds;
+            return output;
+        }
+
+        void GetSegmentsResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyErrorMessage), ErrorMessage);
+            FromJsonUtilO(FromJsonField(input, keySegments), Segments);
+        }
+
+        Json::Value GetSegmentsResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ErrorMessage; ToJsonUtilS(ErrorMessage, each_ErrorMessage); ToJsonField(output, keyErrorMessage) = each_ErrorMessage;
+            Json::Value each_Segments; ToJsonUtilO(Segments, each_Segments); ToJsonField(output, keySegments) = each_Segments;
+            return output;
+        }
+
+        void GetServerBuildInfoRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBuildId), BuildId);
+        }
+
+        Json::Value GetServerBuildInfoRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); ToJsonField(output, keyBuildId) = each_BuildId;
+            return output;
+        }
+
+        void GetServerBuildInfoResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilE(FromJsonField(input, keyActiveRegions), ActiveRegions);
+            FromJsonUtilS(FromJsonField(input, keyBuildId), BuildId);
+            FromJsonUtilS(FromJsonField(input, keyComment), Comment);
+            FromJsonUtilS(FromJsonField(input, keyErrorMessage), ErrorMessage);
+            FromJsonUtilP(FromJsonField(input, keyMaxGamesPerHost), MaxGamesPerHost);
+            FromJsonUtilP(FromJsonField(input, keyMinFreeGameSlots), MinFreeGameSlots);
+            FromJsonUtilE(FromJsonField(input, keyStatus), Status);
+            FromJsonUtilT(FromJsonField(input, keyTimestamp), Timestamp);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+        }
+
+        Json::Value GetServerBuildInfoResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ActiveRegions; ToJsonUtilE(ActiveRegions, each_ActiveRegions); ToJsonField(output, keyActiveRegions) = each_ActiveRegions;
+            Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); ToJsonField(output, keyBuildId) = each_BuildId;
+            Json::Value each_Comment; ToJsonUtilS(Comment, each_Comment); ToJsonField(output, keyComment) = each_Comment;
+            Json::Value each_ErrorMessage; ToJsonUtilS(ErrorMessage, each_ErrorMessage); ToJsonField(output, keyErrorMessage) = each_ErrorMessage;
+            Json::Value each_MaxGamesPerHost; ToJsonUtilP(MaxGamesPerHost, each_MaxGamesPerHost); ToJsonField(output, keyMaxGamesPerHost) = each_MaxGamesPerHost;
+            Json::Value each_MinFreeGameSlots; ToJsonUtilP(MinFreeGameSlots, each_MinFreeGameSlots); ToJsonField(output, keyMinFreeGameSlots) = each_MinFreeGameSlots;
+            Json::Value each_Status; ToJsonUtilE(Status, each_Status); ToJsonField(output, keyStatus) = each_Status;
+            Json::Value each_Timestamp; ToJsonUtilT(Timestamp, each_Timestamp); ToJsonField(output, keyTimestamp) = each_Timestamp;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            return output;
+        }
+
+        void GetServerBuildUploadURLRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBuildId), BuildId);
+        }
+
+        Json::Value GetServerBuildUploadURLRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); ToJsonField(output, keyBuildId) = each_BuildId;
+            return output;
+        }
+
+        void GetServerBuildUploadURLResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyURL), URL);
+        }
+
+        Json::Value GetServerBuildUploadURLResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_URL; ToJsonUtilS(URL, each_URL); ToJsonField(output, keyURL) = each_URL;
+            return output;
+        }
+
+        void GetStoreItemsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyStoreId), StoreId);
+        }
+
+        Json::Value GetStoreItemsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_StoreId; ToJsonUtilS(StoreId, each_StoreId); ToJsonField(output, keyStoreId) = each_StoreId;
+            return output;
+        }
+
+        void StoreMarketingModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyDescription), Description);
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+            Metadata = FromJsonField(input, keyMetadata);
+        }
+
+        Json::Value StoreMarketingModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Description; ToJsonUtilS(Description, each_Description); ToJsonField(output, keyDescription) = each_Description;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            ToJsonField(output, keyMetadata) = Metadata;
+            return output;
+        }
+
+        void StoreItem::FromJson(const Json::Value& input)
+        {
+            CustomData = FromJsonField(input, keyCustomData);
+            FromJsonUtilP(FromJsonField(input, keyDisplayPosition), DisplayPosition);
+            FromJsonUtilS(FromJsonField(input, keyItemId), ItemId);
+            FromJsonUtilP(FromJsonField(input, keyRealCurrencyPrices), RealCurrencyPrices);
+            FromJsonUtilP(FromJsonField(input, keyVirtualCurrencyPrices), VirtualCurrencyPrices);
+        }
+
+        Json::Value StoreItem::ToJson() const
+        {
+            Json::Value output;
+            ToJsonField(output, keyCustomData) = CustomData;
+            Json::Value each_DisplayPosition; ToJsonUtilP(DisplayPosition, each_DisplayPosition); ToJsonField(output, keyDisplayPosition) = each_DisplayPosition;
+            Json::Value each_ItemId; ToJsonUtilS(ItemId, each_ItemId); ToJsonField(output, keyItemId) = each_ItemId;
+            Json::Value each_RealCurrencyPrices; ToJsonUtilP(RealCurrencyPrices, each_RealCurrencyPrices); ToJsonField(output, keyRealCurrencyPrices) = each_RealCurrencyPrices;
+            Json::Value each_VirtualCurrencyPrices; ToJsonUtilP(VirtualCurrencyPrices, each_VirtualCurrencyPrices); ToJsonField(output, keyVirtualCurrencyPrices) = each_VirtualCurrencyPrices;
+            return output;
+        }
+
+        void GetStoreItemsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilO(FromJsonField(input, keyMarketingData), MarketingData);
+            FromJsonUtilE(FromJsonField(input, keySource), Source);
+            FromJsonUtilO(FromJsonField(input, keyStore), Store);
+            FromJsonUtilS(FromJsonField(input, keyStoreId), StoreId);
+        }
+
+        Json::Value GetStoreItemsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_MarketingData; ToJsonUtilO(MarketingData, each_MarketingData); ToJsonField(output, keyMarketingData) = each_MarketingData;
+            Json::Value each_Source; ToJsonUtilE(Source, each_Source); ToJsonField(output, keySource) = each_Source;
+            Json::Value each_Store; ToJsonUtilO(Store, each_Store); ToJsonField(output, keyStore) = each_Store;
+            Json::Value each_StoreId; ToJsonUtilS(StoreId, each_StoreId); ToJsonField(output, keyStoreId) = each_StoreId;
+            return output;
+        }
+
+        void GetTaskInstanceRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyTaskInstanceId), TaskInstanceId);
+        }
+
+        Json::Value GetTaskInstanceRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_TaskInstanceId; ToJsonUtilS(TaskInstanceId, each_TaskInstanceId); ToJsonField(output, keyTaskInstanceId) = each_TaskInstanceId;
+            return output;
+        }
+
+        void GetTaskInstancesRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilT(FromJsonField(input, keyStartedAtRangeFrom), StartedAtRangeFrom);
+            FromJsonUtilT(FromJsonField(input, keyStartedAtRangeTo), StartedAtRangeTo);
+            FromJsonUtilE(FromJsonField(input, keyStatusFilter), StatusFilter);
+            FromJsonUtilO(FromJsonField(input, keyTaskIdentifier), TaskIdentifier);
+        }
+
+        Json::Value GetTaskInstancesRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_StartedAtRangeFrom; ToJsonUtilT(StartedAtRangeFrom, each_StartedAtRangeFrom); ToJsonField(output, keyStartedAtRangeFrom) = each_StartedAtRangeFrom;
+            Json::Value each_StartedAtRangeTo; ToJsonUtilT(StartedAtRangeTo, each_StartedAtRangeTo); ToJsonField(output, keyStartedAtRangeTo) = each_StartedAtRangeTo;
+            Json::Value each_StatusFilter; ToJsonUtilE(StatusFilter, each_StatusFilter); ToJsonField(output, keyStatusFilter) = each_StatusFilter;
+            Json::Value each_TaskIdentifier; ToJsonUtilO(TaskIdentifier, each_TaskIdentifier); ToJsonField(output, keyTaskIdentifier) = each_TaskIdentifier;
+            return output;
+        }
+
+        void TaskInstanceBasicSummary::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilT(FromJsonField(input, keyCompletedAt), CompletedAt);
+            FromJsonUtilS(FromJsonField(input, keyErrorMessage), ErrorMessage);
+            FromJsonUtilP(FromJsonField(input, keyEstimatedSecondsRemaining), EstimatedSecondsRemaining);
+            FromJsonUtilP(FromJsonField(input, keyPercentComplete), PercentComplete);
+            FromJsonUtilS(FromJsonField(input, keyScheduledByUserId), ScheduledByUserId);
+            FromJsonUtilT(FromJsonField(input, keyStartedAt), StartedAt);
+            FromJsonUtilE(FromJsonField(input, keyStatus), Status);
+            FromJsonUtilO(FromJsonField(input, keyTaskIdentifier), TaskIdentifier);
+            FromJsonUtilS(FromJsonField(input, keyTaskInstanceId), TaskInstanceId);
+            FromJsonUtilE(FromJsonField(input, keyType), Type);
+        }
+
+        Json::Value TaskInstanceBasicSummary::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CompletedAt; ToJsonUtilT(CompletedAt, each_CompletedAt); ToJsonField(output, keyCompletedAt) = each_CompletedAt;
+            Json::Value each_ErrorMessage; ToJsonUtilS(ErrorMessage, each_ErrorMessage); ToJsonField(output, keyErrorMessage) = each_ErrorMessage;
+            Json::Value each_EstimatedSecondsRemaining; ToJsonUtilP(EstimatedSecondsRemaining, each_EstimatedSecondsRemaining); ToJsonField(output, keyEstimatedSecondsRemaining) = each_EstimatedSecondsRemaining;
+            Json::Value each_PercentComplete; ToJsonUtilP(PercentComplete, each_PercentComplete); ToJsonField(output, keyPercentComplete) = each_PercentComplete;
+            Json::Value each_ScheduledByUserId; ToJsonUtilS(ScheduledByUserId, each_ScheduledByUserId); ToJsonField(output, keyScheduledByUserId) = each_ScheduledByUserId;
+            Json::Value each_StartedAt; ToJsonUtilT(StartedAt, each_StartedAt); ToJsonField(output, keyStartedAt) = each_StartedAt;
+            Json::Value each_Status; ToJsonUtilE(Status, each_Status); ToJsonField(output, keyStatus) = each_Status;
+            Json::Value each_TaskIdentifier; ToJsonUtilO(TaskIdentifier, each_TaskIdentifier); ToJsonField(output, keyTaskIdentifier) = each_TaskIdentifier;
+            Json::Value each_TaskInstanceId; ToJsonUtilS(TaskInstanceId, each_TaskInstanceId); ToJsonField(output, keyTaskInstanceId) = each_TaskInstanceId;
+            Json::Value each_Type; ToJsonUtilE(Type, each_Type); ToJsonField(output, keyType) = each_Type;
+            return output;
+        }
+
+        void GetTaskInstancesResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keySummaries), Summaries);
+        }
+
+        Json::Value GetTaskInstancesResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Summaries; ToJsonUtilO(Summaries, each_Summaries); ToJsonField(output, keySummaries) = each_Summaries;
+            return output;
+        }
+
+        void GetTasksRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyIdentifier), Identifier);
+        }
+
+        Json::Value GetTasksRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Identifier; ToJsonUtilO(Identifier, each_Identifier); ToJsonField(output, keyIdentifier) = each_Identifier;
+            return output;
+        }
+
+        void ScheduledTask::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyDescription), Description);
+            FromJsonUtilP(FromJsonField(input, keyIsActive), IsActive);
+            FromJsonUtilT(FromJsonField(input, keyLastRunTime), LastRunTime);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilT(FromJsonField(input, keyNextRunTime), NextRunTime);
+            Parameter = FromJsonField(input, keyParameter);
+            FromJsonUtilS(FromJsonField(input, keySchedule), Schedule);
+            FromJsonUtilS(FromJsonField(input, keyTaskId), TaskId);
+            FromJsonUtilE(FromJsonField(input, keyType), Type);
+        }
+
+        Json::Value ScheduledTask::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Description; ToJsonUtilS(Description, each_Description); ToJsonField(output, keyDescription) = each_Description;
+            Json::Value each_IsActive; ToJsonUtilP(IsActive, each_IsActive); ToJsonField(output, keyIsActive) = each_IsActive;
+            Json::Value each_LastRunTime; ToJsonUtilT(LastRunTime, each_LastRunTime); ToJsonField(output, keyLastRunTime) = each_LastRunTime;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_NextRunTime; ToJsonUtilT(NextRunTime, each_NextRunTime); ToJsonField(output, keyNextRunTime) = each_NextRunTime;
+            ToJsonField(output, keyParameter) = Parameter;
+            Json::Value each_Schedule; ToJsonUtilS(Schedule, each_Schedule); ToJsonField(output, keySchedule) = each_Schedule;
+            Json::Value each_TaskId; ToJsonUtilS(TaskId, each_TaskId); ToJsonField(output, keyTaskId) = each_TaskId;
+            Json::Value each_Type; ToJsonUtilE(Type, each_Type); ToJsonField(output, keyType) = each_Type;
+            return output;
+        }
+
+        void GetTasksResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyTasks), Tasks);
+        }
+
+        Json::Value GetTasksResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Tasks; ToJsonUtilO(Tasks, each_Tasks); ToJsonField(output, keyTasks) = each_Tasks;
+            return output;
+        }
+
+        void GetTitleDataRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyKeys), Keys);
+            FromJsonUtilS(FromJsonField(input, keyOverrideLabel), OverrideLabel);
+        }
+
+        Json::Value GetTitleDataRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Keys; ToJsonUtilS(Keys, each_Keys); ToJsonField(output, keyKeys) = each_Keys;
+            Json::Value each_OverrideLabel; ToJsonUtilS(OverrideLabel, each_OverrideLabel); ToJsonField(output, keyOverrideLabel) = each_OverrideLabel;
+            return output;
+        }
+
+        void GetTitleDataResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyData), Data);
+        }
+
+        Json::Value GetTitleDataResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Data; ToJsonUtilS(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            return output;
+        }
+
+        void GetUserBansRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GetUserBansRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void GetUserBansResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyBanData), BanData);
+        }
+
+        Json::Value GetUserBansResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BanData; ToJsonUtilO(BanData, each_BanData); ToJsonField(output, keyBanData) = each_BanData;
+            return output;
+        }
+
+        void GetUserDataRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyIfChangedFromDataVersion), IfChangedFromDataVersion);
+            FromJsonUtilS(FromJsonField(input, keyKeys), Keys);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GetUserDataRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_IfChangedFromDataVersion; ToJsonUtilP(IfChangedFromDataVersion, each_IfChangedFromDataVersion); ToJsonField(output, keyIfChangedFromDataVersion) = each_IfChangedFromDataVersion;
+            Json::Value each_Keys; ToJsonUtilS(Keys, each_Keys); ToJsonField(output, keyKeys) = each_Keys;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void UserDataRecord::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilT(FromJsonField(input, keyLastUpdated), LastUpdated);
+            FromJsonUtilE(FromJsonField(input, keyPermission), Permission);
+            FromJsonUtilS(FromJsonField(input, keyValue), Value);
+        }
+
+        Json::Value UserDataRecord::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_LastUpdated; ToJsonUtilT(LastUpdated, each_LastUpdated); ToJsonField(output, keyLastUpdated) = each_LastUpdated;
+            Json::Value each_Permission; ToJsonUtilE(Permission, each_Permission); ToJsonField(output, keyPermission) = each_Permission;
+            Json::Value each_Value; ToJsonUtilS(Value, each_Value); ToJsonField(output, keyValue) = each_Value;
+            return output;
+        }
+
+        void GetUserDataResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyData), Data);
+            FromJsonUtilP(FromJsonField(input, keyDataVersion), DataVersion);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GetUserDataResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Data; ToJsonUtilO(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            Json::Value each_DataVersion; ToJsonUtilP(DataVersion, each_DataVersion); ToJsonField(output, keyDataVersion) = each_DataVersion;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void GetUserInventoryRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GetUserInventoryRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void ItemInstance::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAnnotation), Annotation);
+            FromJsonUtilS(FromJsonField(input, keyBundleContents), BundleContents);
+            FromJsonUtilS(FromJsonField(input, keyBundleParent), BundleParent);
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCustomData), CustomData);
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+            FromJsonUtilT(FromJsonField(input, keyExpiration), Expiration);
+            FromJsonUtilS(FromJsonField(input, keyItemClass), ItemClass);
+            FromJsonUtilS(FromJsonField(input, keyItemId), ItemId);
+            FromJsonUtilS(FromJsonField(input, keyItemInstanceId), ItemInstanceId);
+            FromJsonUtilT(FromJsonField(input, keyPurchaseDate), PurchaseDate);
+            FromJsonUtilP(FromJsonField(input, keyRemainingUses), RemainingUses);
+            FromJsonUtilS(FromJsonField(input, keyUnitCurrency), UnitCurrency);
+            FromJsonUtilP(FromJsonField(input, keyUnitPrice), UnitPrice);
+            FromJsonUtilP(FromJsonField(input, keyUsesIncrementedBy), UsesIncrementedBy);
+        }
+
+        Json::Value ItemInstance::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Annotation; ToJsonUtilS(Annotation, each_Annotation); ToJsonField(output, keyAnnotation) = each_Annotation;
+            Json::Value each_BundleContents; ToJsonUtilS(BundleContents, each_BundleContents); ToJsonField(output, keyBundleContents) = each_BundleContents;
+            Json::Value each_BundleParent; ToJsonUtilS(BundleParent, each_BundleParent); ToJsonField(output, keyBundleParent) = each_BundleParent;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CustomData; ToJsonUtilS(CustomData, each_CustomData); ToJsonField(output, keyCustomData) = each_CustomData;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            Json::Value each_Expiration; ToJsonUtilT(Expiration, each_Expiration); ToJsonField(output, keyExpiration) = each_Expiration;
+            Json::Value each_ItemClass; ToJsonUtilS(ItemClass, each_ItemClass); ToJsonField(output, keyItemClass) = each_ItemClass;
+            Json::Value each_ItemId; ToJsonUtilS(ItemId, each_ItemId); ToJsonField(output, keyItemId) = each_ItemId;
+            Json::Value each_ItemInstanceId; ToJsonUtilS(ItemInstanceId, each_ItemInstanceId); ToJsonField(output, keyItemInstanceId) = each_ItemInstanceId;
+            Json::Value each_PurchaseDate; ToJsonUtilT(PurchaseDate, each_PurchaseDate); ToJsonField(output, keyPurchaseDate) = each_PurchaseDate;
+            Json::Value each_RemainingUses; ToJsonUtilP(RemainingUses, each_RemainingUses); ToJsonField(output, keyRemainingUses) = each_RemainingUses;
+            Json::Value each_UnitCurrency; ToJsonUtilS(UnitCurrency, each_UnitCurrency); ToJsonField(output, keyUnitCurrency) = each_UnitCurrency;
+            Json::Value each_UnitPrice; ToJsonUtilP(UnitPrice, each_UnitPrice); ToJsonField(output, keyUnitPrice) = each_UnitPrice;
+            Json::Value each_UsesIncrementedBy; ToJsonUtilP(UsesIncrementedBy, each_UsesIncrementedBy); ToJsonField(output, keyUsesIncrementedBy) = each_UsesIncrementedBy;
+            return output;
+        }
+
+        void VirtualCurrencyRechargeTime::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyRechargeMax), RechargeMax);
+            FromJsonUtilT(FromJsonField(input, keyRechargeTime), RechargeTime);
+            FromJsonUtilP(FromJsonField(input, keySecondsToRecharge), SecondsToRecharge);
+        }
+
+        Json::Value VirtualCurrencyRechargeTime::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_RechargeMax; ToJsonUtilP(RechargeMax, each_RechargeMax); ToJsonField(output, keyRechargeMax) = each_RechargeMax;
+            Json::Value each_RechargeTime; ToJsonUtilT(RechargeTime, each_RechargeTime); ToJsonField(output, keyRechargeTime) = each_RechargeTime;
+            Json::Value each_SecondsToRecharge; ToJsonUtilP(SecondsToRecharge, each_SecondsToRecharge); ToJsonField(output, keySecondsToRecharge) = each_SecondsToRecharge;
+            return output;
+        }
+
+        void GetUserInventoryResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyInventory), Inventory);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilP(FromJsonField(input, keyVirtualCurrency), VirtualCurrency);
+            FromJsonUtilO(FromJsonField(input, keyVirtualCurrencyRechargeTimes), VirtualCurrencyRechargeTimes);
+        }
+
+        Json::Value GetUserInventoryResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Inventory; ToJsonUtilO(Inventory, each_Inventory); ToJsonField(output, keyInventory) = each_Inventory;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_VirtualCurrency; ToJsonUtilP(VirtualCurrency, each_VirtualCurrency); ToJsonField(output, keyVirtualCurrency) = each_VirtualCurrency;
+            Json::Value each_VirtualCurrencyRechargeTimes; ToJsonUtilO(VirtualCurrencyRechargeTimes, each_VirtualCurrencyRechargeTimes); ToJsonField(output, keyVirtualCurrencyRechargeTimes) = each_VirtualCurrencyRechargeTimes;
+            return output;
+        }
+
+        void GrantedItemInstance::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAnnotation), Annotation);
+            FromJsonUtilS(FromJsonField(input, keyBundleContents), BundleContents);
+            FromJsonUtilS(FromJsonField(input, keyBundleParent), BundleParent);
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyCustomData), CustomData);
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+            FromJsonUtilT(FromJsonField(input, keyExpiration), Expiration);
+            FromJsonUtilS(FromJsonField(input, keyItemClass), ItemClass);
+            FromJsonUtilS(FromJsonField(input, keyItemId), ItemId);
+            FromJsonUtilS(FromJsonField(input, keyItemInstanceId), ItemInstanceId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilT(FromJsonField(input, keyPurchaseDate), PurchaseDate);
+            FromJsonUtilP(FromJsonField(input, keyRemainingUses), RemainingUses);
+            FromJsonUtilP(FromJsonField(input, keyResult), Result);
+            FromJsonUtilS(FromJsonField(input, keyUnitCurrency), UnitCurrency);
+            FromJsonUtilP(FromJsonField(input, keyUnitPrice), UnitPrice);
+            FromJsonUtilP(FromJsonField(input, keyUsesIncrementedBy), UsesIncrementedBy);
+        }
+
+        Json::Value GrantedItemInstance::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Annotation; ToJsonUtilS(Annotation, each_Annotation); ToJsonField(output, keyAnnotation) = each_Annotation;
+            Json::Value each_BundleContents; ToJsonUtilS(BundleContents, each_BundleContents); ToJsonField(output, keyBundleContents) = each_BundleContents;
+            Json::Value each_BundleParent; ToJsonUtilS(BundleParent, each_BundleParent); ToJsonField(output, keyBundleParent) = each_BundleParent;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_CustomData; ToJsonUtilS(CustomData, each_CustomData); ToJsonField(output, keyCustomData) = each_CustomData;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            Json::Value each_Expiration; ToJsonUtilT(Expiration, each_Expiration); ToJsonField(output, keyExpiration) = each_Expiration;
+            Json::Value each_ItemClass; ToJsonUtilS(ItemClass, each_ItemClass); ToJsonField(output, keyItemClass) = each_ItemClass;
+            Json::Value each_ItemId; ToJsonUtilS(ItemId, each_ItemId); ToJsonField(output, keyItemId) = each_ItemId;
+            Json::Value each_ItemInstanceId; ToJsonUtilS(ItemInstanceId, each_ItemInstanceId); ToJsonField(output, keyItemInstanceId) = each_ItemInstanceId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_PurchaseDate; ToJsonUtilT(PurchaseDate, each_PurchaseDate); ToJsonField(output, keyPurchaseDate) = each_PurchaseDate;
+            Json::Value each_RemainingUses; ToJsonUtilP(RemainingUses, each_RemainingUses); ToJsonField(output, keyRemainingUses) = each_RemainingUses;
+            Json::Value each_Result; ToJsonUtilP(Result, each_Result); ToJsonField(output, keyResult) = each_Result;
+            Json::Value each_UnitCurrency; ToJsonUtilS(UnitCurrency, each_UnitCurrency); ToJsonField(output, keyUnitCurrency) = each_UnitCurrency;
+            Json::Value each_UnitPrice; ToJsonUtilP(UnitPrice, each_UnitPrice); ToJsonField(output, keyUnitPrice) = each_UnitPrice;
+            Json::Value each_UsesIncrementedBy; ToJsonUtilP(UsesIncrementedBy, each_UsesIncrementedBy); ToJsonField(output, keyUsesIncrementedBy) = each_UsesIncrementedBy;
+            return output;
+        }
+
+        void ItemGrant::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAnnotation), Annotation);
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyData), Data);
+            FromJsonUtilS(FromJsonField(input, keyItemId), ItemId);
+            FromJsonUtilS(FromJsonField(input, keyKeysToRemove), KeysToRemove);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value ItemGrant::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Annotation; ToJsonUtilS(Annotation, each_Annotation); ToJsonField(output, keyAnnotation) = each_Annotation;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_Data; ToJsonUtilS(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            Json::Value each_ItemId; ToJsonUtilS(ItemId, each_ItemId); ToJsonField(output, keyItemId) = each_ItemId;
+            Json::Value each_KeysToRemove; ToJsonUtilS(KeysToRemove, each_KeysToRemove); ToJsonField(output, keyKeysToRemove) = each_KeysToRemove;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void GrantItemsToUsersRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyItemGrants), ItemGrants);
+        }
+
+        Json::Value GrantItemsToUsersRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ItemGrants; ToJsonUtilO(ItemGrants, each_ItemGrants); ToJsonField(output, keyItemGrants) = each_ItemGrants;
+            return output;
+        }
+
+        void GrantItemsToUsersResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyItemGrantResults), ItemGrantResults);
+        }
+
+        Json::Value GrantItemsToUsersResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ItemGrantResults; ToJsonUtilO(ItemGrantResults, each_ItemGrantResults); ToJsonField(output, keyItemGrantResults) = each_ItemGrantResults;
+            return output;
+        }
+
+        void IncrementLimitedEditionItemAvailabilityRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyAmount), Amount);
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyItemId), ItemId);
+        }
+
+        Json::Value IncrementLimitedEditionItemAvailabilityRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Amount; ToJsonUtilP(Amount, each_Amount); ToJsonField(output, keyAmount) = each_Amount;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ItemId; ToJsonUtilS(ItemId, each_ItemId); ToJsonField(output, keyItemId) = each_ItemId;
+            return output;
+        }
+
+        void IncrementLimitedEditionItemAvailabilityResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value IncrementLimitedEditionItemAvailabilityResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void IncrementPlayerStatisticVersionRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+        }
+
+        Json::Value IncrementPlayerStatisticVersionRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            return output;
+        }
+
+        void IncrementPlayerStatisticVersionResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyStatisticVersion), StatisticVersion);
+        }
+
+        Json::Value IncrementPlayerStatisticVersionResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_StatisticVersion; ToJsonUtilO(StatisticVersion, each_StatisticVersion); ToJsonField(output, keyStatisticVersion) = each_StatisticVersion;
+            return output;
+        }
+
+        void ListBuildsRequest::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value ListBuildsRequest::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void ListBuildsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyBuilds), Builds);
+        }
+
+        Json::Value ListBuildsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Builds; ToJsonUtilO(Builds, each_Builds); ToJsonField(output, keyBuilds) = each_Builds;
+            return output;
+        }
+
+        void ListOpenIdConnectionRequest::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value ListOpenIdConnectionRequest::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void OpenIdConnection::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyClientId), ClientId);
+            FromJsonUtilS(FromJsonField(input, keyClientSecret), ClientSecret);
+            FromJsonUtilS(FromJsonField(input, keyConnectionId), ConnectionId);
+            FromJsonUtilP(FromJsonField(input, keyDiscoverConfiguration), DiscoverConfiguration);
+            FromJsonUtilO(FromJsonField(input, keyIssuerInformation), IssuerInformation);
+        }
+
+        Json::Value OpenIdConnection::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ClientId; ToJsonUtilS(ClientId, each_ClientId); ToJsonField(output, keyClientId) = each_ClientId;
+            Json::Value each_ClientSecret; ToJsonUtilS(ClientSecret, each_ClientSecret); ToJsonField(output, keyClientSecret) = each_ClientSecret;
+            Json::Value each_ConnectionId; ToJsonUtilS(ConnectionId, each_ConnectionId); ToJsonField(output, keyConnectionId) = each_ConnectionId;
+            Json::Value each_DiscoverConfiguration; ToJsonUtilP(DiscoverConfiguration, each_DiscoverConfiguration); ToJsonField(output, keyDiscoverConfiguration) = each_DiscoverConfiguration;
+            Json::Value each_IssuerInformation; ToJsonUtilO(IssuerInformation, each_IssuerInformation); ToJsonField(output, keyIssuerInformation) = each_IssuerInformation;
+            return output;
+        }
+
+        void ListOpenIdConnectionResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyConnections), Connections);
+        }
+
+        Json::Value ListOpenIdConnectionResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Connections; ToJsonUtilO(Connections, each_Connections); ToJsonField(output, keyConnections) = each_Connections;
+            return output;
+        }
+
+        void ListVirtualCurrencyTypesRequest::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value ListVirtualCurrencyTypesRequest::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void ListVirtualCurrencyTypesResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyVirtualCurrencies), VirtualCurrencies);
+        }
+
+        Json::Value ListVirtualCurrencyTypesResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_VirtualCurrencies; ToJsonUtilO(VirtualCurrencies, each_VirtualCurrencies); ToJsonField(output, keyVirtualCurrencies) = each_VirtualCurrencies;
+            return output;
+        }
+
+        void LookupUserAccountInfoRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyEmail), Email);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyTitleDisplayName), TitleDisplayName);
+            FromJsonUtilS(FromJsonField(input, keyUsername), Username);
+        }
+
+        Json::Value LookupUserAccountInfoRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Email; ToJsonUtilS(Email, each_Email); ToJsonField(output, keyEmail) = each_Email;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_TitleDisplayName; ToJsonUtilS(TitleDisplayName, each_TitleDisplayName); ToJsonField(output, keyTitleDisplayName) = each_TitleDisplayName;
+            Json::Value each_Username; ToJsonUtilS(Username, each_Username); ToJsonField(output, keyUsername) = each_Username;
+            return output;
+        }
+
+        void UserAndroidDeviceInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAndroidDeviceId), AndroidDeviceId);
+        }
+
+        Json::Value UserAndroidDeviceInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AndroidDeviceId; ToJsonUtilS(AndroidDeviceId, each_AndroidDeviceId); ToJsonField(output, keyAndroidDeviceId) = each_AndroidDeviceId;
+            return output;
+        }
+
+        void UserAppleIdInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAppleSubjectId), AppleSubjectId);
+        }
+
+        Json::Value UserAppleIdInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AppleSubjectId; ToJsonUtilS(AppleSubjectId, each_AppleSubjectId); ToJsonField(output, keyAppleSubjectId) = each_AppleSubjectId;
+            return output;
+        }
+
+        void UserCustomIdInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomId), CustomId);
+        }
+
+        Json::Value UserCustomIdInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomId; ToJsonUtilS(CustomId, each_CustomId); ToJsonField(output, keyCustomId) = each_CustomId;
+            return output;
+        }
+
+        void UserFacebookInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyFacebookId), FacebookId);
+            FromJsonUtilS(FromJsonField(input, keyFullName), FullName);
+        }
+
+        Json::Value UserFacebookInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_FacebookId; ToJsonUtilS(FacebookId, each_FacebookId); ToJsonField(output, keyFacebookId) = each_FacebookId;
+            Json::Value each_FullName; ToJsonUtilS(FullName, each_FullName); ToJsonField(output, keyFullName) = each_FullName;
+            return output;
+        }
+
+        void UserFacebookInstantGamesIdInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyFacebookInstantGamesId), FacebookInstantGamesId);
+        }
+
+        Json::Value UserFacebookInstantGamesIdInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_FacebookInstantGamesId; ToJsonUtilS(FacebookInstantGamesId, each_FacebookInstantGamesId); ToJsonField(output, keyFacebookInstantGamesId) = each_FacebookInstantGamesId;
+            return output;
+        }
+
+        void UserGameCenterInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyGameCenterId), GameCenterId);
+        }
+
+        Json::Value UserGameCenterInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GameCenterId; ToJsonUtilS(GameCenterId, each_GameCenterId); ToJsonField(output, keyGameCenterId) = each_GameCenterId;
+            return output;
+        }
+
+        void UserGoogleInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyGoogleEmail), GoogleEmail);
+            FromJsonUtilS(FromJsonField(input, keyGoogleGender), GoogleGender);
+            FromJsonUtilS(FromJsonField(input, keyGoogleId), GoogleId);
+            FromJsonUtilS(FromJsonField(input, keyGoogleLocale), GoogleLocale);
+            FromJsonUtilS(FromJsonField(input, keyGoogleName), GoogleName);
+        }
+
+        Json::Value UserGoogleInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GoogleEmail; ToJsonUtilS(GoogleEmail, each_GoogleEmail); ToJsonField(output, keyGoogleEmail) = each_GoogleEmail;
+            Json::Value each_GoogleGender; ToJsonUtilS(GoogleGender, each_GoogleGender); ToJsonField(output, keyGoogleGender) = each_GoogleGender;
+            Json::Value each_GoogleId; ToJsonUtilS(GoogleId, each_GoogleId); ToJsonField(output, keyGoogleId) = each_GoogleId;
+            Json::Value each_GoogleLocale; ToJsonUtilS(GoogleLocale, each_GoogleLocale); ToJsonField(output, keyGoogleLocale) = each_GoogleLocale;
+            Json::Value each_GoogleName; ToJsonUtilS(GoogleName, each_GoogleName); ToJsonField(output, keyGoogleName) = each_GoogleName;
+            return output;
+        }
+
+        void UserIosDeviceInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyIosDeviceId), IosDeviceId);
+        }
+
+        Json::Value UserIosDeviceInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_IosDeviceId; ToJsonUtilS(IosDeviceId, each_IosDeviceId); ToJsonField(output, keyIosDeviceId) = each_IosDeviceId;
+            return output;
+        }
+
+        void UserKongregateInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyKongregateId), KongregateId);
+            FromJsonUtilS(FromJsonField(input, keyKongregateName), KongregateName);
+        }
+
+        Json::Value UserKongregateInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_KongregateId; ToJsonUtilS(KongregateId, each_KongregateId); ToJsonField(output, keyKongregateId) = each_KongregateId;
+            Json::Value each_KongregateName; ToJsonUtilS(KongregateName, each_KongregateName); ToJsonField(output, keyKongregateName) = each_KongregateName;
+            return output;
+        }
+
+        void UserNintendoSwitchAccountIdInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyNintendoSwitchAccountSubjectId), NintendoSwitchAccountSubjectId);
+        }
+
+        Json::Value UserNintendoSwitchAccountIdInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_NintendoSwitchAccountSubjectId; ToJsonUtilS(NintendoSwitchAccountSubjectId, each_NintendoSwitchAccountSubjectId); ToJsonField(output, keyNintendoSwitchAccountSubjectId) = each_NintendoSwitchAccountSubjectId;
+            return output;
+        }
+
+        void UserNintendoSwitchDeviceIdInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyNintendoSwitchDeviceId), NintendoSwitchDeviceId);
+        }
+
+        Json::Value UserNintendoSwitchDeviceIdInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_NintendoSwitchDeviceId; ToJsonUtilS(NintendoSwitchDeviceId, each_NintendoSwitchDeviceId); ToJsonField(output, keyNintendoSwitchDeviceId) = each_NintendoSwitchDeviceId;
+            return output;
+        }
+
+        void UserOpenIdInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyConnectionId), ConnectionId);
+            FromJsonUtilS(FromJsonField(input, keyIssuer), Issuer);
+            FromJsonUtilS(FromJsonField(input, keySubject), Subject);
+        }
+
+        Json::Value UserOpenIdInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ConnectionId; ToJsonUtilS(ConnectionId, each_ConnectionId); ToJsonField(output, keyConnectionId) = each_ConnectionId;
+            Json::Value each_Issuer; ToJsonUtilS(Issuer, each_Issuer); ToJsonField(output, keyIssuer) = each_Issuer;
+            Json::Value each_Subject; ToJsonUtilS(Subject, each_Subject); ToJsonField(output, keySubject) = each_Subject;
+            return output;
+        }
+
+        void UserPrivateAccountInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyEmail), Email);
+        }
+
+        Json::Value UserPrivateAccountInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Email; ToJsonUtilS(Email, each_Email); ToJsonField(output, keyEmail) = each_Email;
+            return output;
+        }
+
+        void UserPsnInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPsnAccountId), PsnAccountId);
+            FromJsonUtilS(FromJsonField(input, keyPsnOnlineId), PsnOnlineId);
+        }
+
+        Json::Value UserPsnInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PsnAccountId; ToJsonUtilS(PsnAccountId, each_PsnAccountId); ToJsonField(output, keyPsnAccountId) = each_PsnAccountId;
+            Json::Value each_PsnOnlineId; ToJsonUtilS(PsnOnlineId, each_PsnOnlineId); ToJsonField(output, keyPsnOnlineId) = each_PsnOnlineId;
+            return output;
+        }
+
+        void UserSteamInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilE(FromJsonField(input, keySteamActivationStatus), SteamActivationStatus);
+            FromJsonUtilS(FromJsonField(input, keySteamCountry), SteamCountry);
+            FromJsonUtilE(FromJsonField(input, keySteamCurrency), SteamCurrency);
+            FromJsonUtilS(FromJsonField(input, keySteamId), SteamId);
+            FromJsonUtilS(FromJsonField(input, keySteamName), SteamName);
+        }
+
+        Json::Value UserSteamInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_SteamActivationStatus; ToJsonUtilE(SteamActivationStatus, each_SteamActivationStatus); ToJsonField(output, keySteamActivationStatus) = each_SteamActivationStatus;
+            Json::Value each_SteamCountry; ToJsonUtilS(SteamCountry, each_SteamCountry); ToJsonField(output, keySteamCountry) = each_SteamCountry;
+            Json::Value each_SteamCurrency; ToJsonUtilE(SteamCurrency, each_SteamCurrency); ToJsonField(output, keySteamCurrency) = each_SteamCurrency;
+            Json::Value each_SteamId; ToJsonUtilS(SteamId, each_SteamId); ToJsonField(output, keySteamId) = each_SteamId;
+            Json::Value each_SteamName; ToJsonUtilS(SteamName, each_SteamName); ToJsonField(output, keySteamName) = each_SteamName;
+            return output;
+        }
+
+        void UserTitleInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAvatarUrl), AvatarUrl);
+            FromJsonUtilT(FromJsonField(input, keyCreated), Created);
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+            FromJsonUtilT(FromJsonField(input, keyFirstLogin), FirstLogin);
+            FromJsonUtilP(FromJsonField(input, keyisBanned), isBanned);
+            FromJsonUtilT(FromJsonField(input, keyLastLogin), LastLogin);
+            FromJsonUtilE(FromJsonField(input, keyOrigination), Origination);
+            FromJsonUtilO(FromJsonField(input, keyTitlePlayerAccount), TitlePlayerAccount);
+        }
+
+        Json::Value UserTitleInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AvatarUrl; ToJsonUtilS(AvatarUrl, each_AvatarUrl); ToJsonField(output, keyAvatarUrl) = each_AvatarUrl;
+            Json::Value each_Created; ToJsonUtilT(Created, each_Created); ToJsonField(output, keyCreated) = each_Created;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            Json::Value each_FirstLogin; ToJsonUtilT(FirstLogin, each_FirstLogin); ToJsonField(output, keyFirstLogin) = each_FirstLogin;
+            Json::Value each_isBanned; ToJsonUtilP(isBanned, each_isBanned); ToJsonField(output, keyisBanned) = each_isBanned;
+            Json::Value each_LastLogin; ToJsonUtilT(LastLogin, each_LastLogin); ToJsonField(output, keyLastLogin) = each_LastLogin;
+            Json::Value each_Origination; ToJsonUtilE(Origination, each_Origination); ToJsonField(output, keyOrigination) = each_Origination;
+            Json::Value each_TitlePlayerAccount; ToJsonUtilO(TitlePlayerAccount, each_TitlePlayerAccount); ToJsonField(output, keyTitlePlayerAccount) = each_TitlePlayerAccount;
+            return output;
+        }
+
+        void UserTwitchInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyTwitchId), TwitchId);
+            FromJsonUtilS(FromJsonField(input, keyTwitchUserName), TwitchUserName);
+        }
+
+        Json::Value UserTwitchInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_TwitchId; ToJsonUtilS(TwitchId, each_TwitchId); ToJsonField(output, keyTwitchId) = each_TwitchId;
+            Json::Value each_TwitchUserName; ToJsonUtilS(TwitchUserName, each_TwitchUserName); ToJsonField(output, keyTwitchUserName) = each_TwitchUserName;
+            return output;
+        }
+
+        void UserWindowsHelloInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyWindowsHelloDeviceName), WindowsHelloDeviceName);
+            FromJsonUtilS(FromJsonField(input, keyWindowsHelloPublicKeyHash), WindowsHelloPublicKeyHash);
+        }
+
+        Json::Value UserWindowsHelloInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_WindowsHelloDeviceName; ToJsonUtilS(WindowsHelloDeviceName, each_WindowsHelloDeviceName); ToJsonField(output, keyWindowsHelloDeviceName) = each_WindowsHelloDeviceName;
+            Json::Value each_WindowsHelloPublicKeyHash; ToJsonUtilS(WindowsHelloPublicKeyHash, each_WindowsHelloPublicKeyHash); ToJsonField(output, keyWindowsHelloPublicKeyHash) = each_WindowsHelloPublicKeyHash;
+            return output;
+        }
+
+        void UserXboxInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyXboxUserId), XboxUserId);
+        }
+
+        Json::Value UserXboxInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_XboxUserId; ToJsonUtilS(XboxUserId, each_XboxUserId); ToJsonField(output, keyXboxUserId) = each_XboxUserId;
+            return output;
+        }
+
+        void UserAccountInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyAndroidDeviceInfo), AndroidDeviceInfo);
+            FromJsonUtilO(FromJsonField(input, keyAppleAccountInfo), AppleAccountInfo);
+            FromJsonUtilT(FromJsonField(input, keyCreated), Created);
+            FromJsonUtilO(FromJsonField(input, keyCustomIdInfo), CustomIdInfo);
+            FromJsonUtilO(FromJsonField(input, keyFacebookInfo), FacebookInfo);
+            FromJsonUtilO(FromJsonField(input, keyFacebookInstantGamesIdInfo), FacebookInstantGamesIdInfo);
+            FromJsonUtilO(FromJsonField(input, keyGameCenterInfo), GameCenterInfo);
+            FromJsonUtilO(FromJsonField(input, keyGoogleInfo), GoogleInfo);
+            FromJsonUtilO(FromJsonField(input, keyIosDeviceInfo), IosDeviceInfo);
+            FromJsonUtilO(FromJsonField(input, keyKongregateInfo), KongregateInfo);
+            FromJsonUtilO(FromJsonField(input, keyNintendoSwitchAccountInfo), NintendoSwitchAccountInfo);
+            FromJsonUtilO(FromJsonField(input, keyNintendoSwitchDeviceIdInfo), NintendoSwitchDeviceIdInfo);
+            FromJsonUtilO(FromJsonField(input, keyOpenIdInfo), OpenIdInfo);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilO(FromJsonField(input, keyPrivateInfo), PrivateInfo);
+            FromJsonUtilO(FromJsonField(input, keyPsnInfo), PsnInfo);
+            FromJsonUtilO(FromJsonField(input, keySteamInfo), SteamInfo);
+            FromJsonUtilO(FromJsonField(input, keyTitleInfo), TitleInfo);
+            FromJsonUtilO(FromJsonField(input, keyTwitchInfo), TwitchInfo);
+            FromJsonUtilS(FromJsonField(input, keyUsername), Username);
+            FromJsonUtilO(FromJsonField(input, keyWindowsHelloInfo), WindowsHelloInfo);
+            FromJsonUtilO(FromJsonField(input, keyXboxInfo), XboxInfo);
+        }
+
+        Json::Value UserAccountInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AndroidDeviceInfo; ToJsonUtilO(AndroidDeviceInfo, each_AndroidDeviceInfo); ToJsonField(output, keyAndroidDeviceInfo) = each_AndroidDeviceInfo;
+            Json::Value each_AppleAccountInfo; ToJsonUtilO(AppleAccountInfo, each_AppleAccountInfo); ToJsonField(output, keyAppleAccountInfo) = each_AppleAccountInfo;
+            Json::Value each_Created; ToJsonUtilT(Created, each_Created); ToJsonField(output, keyCreated) = each_Created;
+            Json::Value each_CustomIdInfo; ToJsonUtilO(CustomIdInfo, each_CustomIdInfo); ToJsonField(output, keyCustomIdInfo) = each_CustomIdInfo;
+            Json::Value each_FacebookInfo; ToJsonUtilO(FacebookInfo, each_FacebookInfo); ToJsonField(output, keyFacebookInfo) = each_FacebookInfo;
+            Json::Value each_FacebookInstantGamesIdInfo; ToJsonUtilO(FacebookInstantGamesIdInfo, each_FacebookInstantGamesIdInfo); ToJsonField(output, keyFacebookInstantGamesIdInfo) = each_FacebookInstantGamesIdInfo;
+            Json::Value each_GameCenterInfo; ToJsonUtilO(GameCenterInfo, each_GameCenterInfo); ToJsonField(output, keyGameCenterInfo) = each_GameCenterInfo;
+            Json::Value each_GoogleInfo; ToJsonUtilO(GoogleInfo, each_GoogleInfo); ToJsonField(output, keyGoogleInfo) = each_GoogleInfo;
+            Json::Value each_IosDeviceInfo; ToJsonUtilO(IosDeviceInfo, each_IosDeviceInfo); ToJsonField(output, keyIosDeviceInfo) = each_IosDeviceInfo;
+            Json::Value each_KongregateInfo; ToJsonUtilO(KongregateInfo, each_KongregateInfo); ToJsonField(output, keyKongregateInfo) = each_KongregateInfo;
+            Json::Value each_NintendoSwitchAccountInfo; ToJsonUtilO(NintendoSwitchAccountInfo, each_NintendoSwitchAccountInfo); ToJsonField(output, keyNintendoSwitchAccountInfo) = each_NintendoSwitchAccountInfo;
+            Json::Value each_NintendoSwitchDeviceIdInfo; ToJsonUtilO(NintendoSwitchDeviceIdInfo, each_NintendoSwitchDeviceIdInfo); ToJsonField(output, keyNintendoSwitchDeviceIdInfo) = each_NintendoSwitchDeviceIdInfo;
+            Json::Value each_OpenIdInfo; ToJsonUtilO(OpenIdInfo, each_OpenIdInfo); ToJsonField(output, keyOpenIdInfo) = each_OpenIdInfo;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_PrivateInfo; ToJsonUtilO(PrivateInfo, each_PrivateInfo); ToJsonField(output, keyPrivateInfo) = each_PrivateInfo;
+            Json::Value each_PsnInfo; ToJsonUtilO(PsnInfo, each_PsnInfo); ToJsonField(output, keyPsnInfo) = each_PsnInfo;
+            Json::Value each_SteamInfo; ToJsonUtilO(SteamInfo, each_SteamInfo); ToJsonField(output, keySteamInfo) = each_SteamInfo;
+            Json::Value each_TitleInfo; ToJsonUtilO(TitleInfo, each_TitleInfo); ToJsonField(output, keyTitleInfo) = each_TitleInfo;
+            Json::Value each_TwitchInfo; ToJsonUtilO(TwitchInfo, each_TwitchInfo); ToJsonField(output, keyTwitchInfo) = each_TwitchInfo;
+            Json::Value each_Username; ToJsonUtilS(Username, each_Username); ToJsonField(output, keyUsername) = each_Username;
+            Json::Value each_WindowsHelloInfo; ToJsonUtilO(WindowsHelloInfo, each_WindowsHelloInfo); ToJsonField(output, keyWindowsHelloInfo) = each_WindowsHelloInfo;
+            Json::Value each_XboxInfo; ToJsonUtilO(XboxInfo, each_XboxInfo); ToJsonField(output, keyXboxInfo) = each_XboxInfo;
+            return output;
+        }
+
+        void LookupUserAccountInfoResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyUserInfo), UserInfo);
+        }
+
+        Json::Value LookupUserAccountInfoResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_UserInfo; ToJsonUtilO(UserInfo, each_UserInfo); ToJsonField(output, keyUserInfo) = each_UserInfo;
+            return output;
+        }
+
+        void ModifyMatchmakerGameModesRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBuildVersion), BuildVersion);
+            FromJsonUtilO(FromJsonField(input, keyGameModes), GameModes);
+        }
+
+        Json::Value ModifyMatchmakerGameModesRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BuildVersion; ToJsonUtilS(BuildVersion, each_BuildVersion); ToJsonField(output, keyBuildVersion) = each_BuildVersion;
+            Json::Value each_GameModes; ToJsonUtilO(GameModes, each_GameModes); ToJsonField(output, keyGameModes) = each_GameModes;
+            return output;
+        }
+
+        void ModifyMatchmakerGameModesResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value ModifyMatchmakerGameModesResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void ModifyServerBuildRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilE(FromJsonField(input, keyActiveRegions), ActiveRegions);
+            FromJsonUtilS(FromJsonField(input, keyBuildId), BuildId);
+            FromJsonUtilS(FromJsonField(input, keyCommandLineTemplate), CommandLineTemplate);
+            FromJsonUtilS(FromJsonField(input, keyComment), Comment);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyExecutablePath), ExecutablePath);
+            FromJsonUtilP(FromJsonField(input, keyMaxGamesPerHost), MaxGamesPerHost);
+            FromJsonUtilP(FromJsonField(input, keyMinFreeGameSlots), MinFreeGameSlots);
+            FromJsonUtilT(FromJsonField(input, keyTimestamp), Timestamp);
+        }
+
+        Json::Value ModifyServerBuildRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ActiveRegions; ToJsonUtilE(ActiveRegions, each_ActiveRegions); ToJsonField(output, keyActiveRegions) = each_ActiveRegions;
+            Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); ToJsonField(output, keyBuildId) = each_BuildId;
+            Json::Value each_CommandLineTemplate; ToJsonUtilS(CommandLineTemplate, each_CommandLineTemplate); ToJsonField(output, keyCommandLineTemplate) = each_CommandLineTemplate;
+            Json::Value each_Comment; ToJsonUtilS(Comment, each_Comment); ToJsonField(output, keyComment) = each_Comment;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ExecutablePath; ToJsonUtilS(ExecutablePath, each_ExecutablePath); ToJsonField(output, keyExecutablePath) = each_ExecutablePath;
+            Json::Value each_MaxGamesPerHost; ToJsonUtilP(MaxGamesPerHost, each_MaxGamesPerHost); ToJsonField(output, keyMaxGamesPerHost) = each_MaxGamesPerHost;
+            Json::Value each_MinFreeGameSlots; ToJsonUtilP(MinFreeGameSlots, each_MinFreeGameSlots); ToJsonField(output, keyMinFreeGameSlots) = each_MinFreeGameSlots;
+            Json::Value each_Timestamp; ToJsonUtilT(Timestamp, each_Timestamp); ToJsonField(output, keyTimestamp) = each_Timestamp;
+            return output;
+        }
+
+        void ModifyServerBuildResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilE(FromJsonField(input, keyActiveRegions), ActiveRegions);
+            FromJsonUtilS(FromJsonField(input, keyBuildId), BuildId);
+            FromJsonUtilS(FromJsonField(input, keyCommandLineTemplate), CommandLineTemplate);
+            FromJsonUtilS(FromJsonField(input, keyComment), Comment);
+            FromJsonUtilS(FromJsonField(input, keyExecutablePath), ExecutablePath);
+            FromJsonUtilP(FromJsonField(input, keyMaxGamesPerHost), MaxGamesPerHost);
+            FromJsonUtilP(FromJsonField(input, keyMinFreeGameSlots), MinFreeGameSlots);
+            FromJsonUtilE(FromJsonField(input, keyStatus), Status);
+            FromJsonUtilT(FromJsonField(input, keyTimestamp), Timestamp);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+        }
+
+        Json::Value ModifyServerBuildResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ActiveRegions; ToJsonUtilE(ActiveRegions, each_ActiveRegions); ToJsonField(output, keyActiveRegions) = each_ActiveRegions;
+            Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); ToJsonField(output, keyBuildId) = each_BuildId;
+            Json::Value each_CommandLineTemplate; ToJsonUtilS(CommandLineTemplate, each_CommandLineTemplate); ToJsonField(output, keyCommandLineTemplate) = each_CommandLineTemplate;
+            Json::Value each_Comment; ToJsonUtilS(Comment, each_Comment); ToJsonField(output, keyComment) = each_Comment;
+            Json::Value each_ExecutablePath; ToJsonUtilS(ExecutablePath, each_ExecutablePath); ToJsonField(output, keyExecutablePath) = each_ExecutablePath;
+            Json::Value each_MaxGamesPerHost; ToJsonUtilP(MaxGamesPerHost, each_MaxGamesPerHost); ToJsonField(output, keyMaxGamesPerHost) = each_MaxGamesPerHost;
+            Json::Value each_MinFreeGameSlots; ToJsonUtilP(MinFreeGameSlots, each_MinFreeGameSlots); ToJsonField(output, keyMinFreeGameSlots) = each_MinFreeGameSlots;
+            Json::Value each_Status; ToJsonUtilE(Status, each_Status); ToJsonField(output, keyStatus) = each_Status;
+            Json::Value each_Timestamp; ToJsonUtilT(Timestamp, each_Timestamp); ToJsonField(output, keyTimestamp) = each_Timestamp;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            return output;
+        }
+
+        void ModifyUserVirtualCurrencyResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyBalance), Balance);
+            FromJsonUtilP(FromJsonField(input, keyBalanceChange), BalanceChange);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyVirtualCurrency), VirtualCurrency);
+        }
+
+        Json::Value ModifyUserVirtualCurrencyResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Balance; ToJsonUtilP(Balance, each_Balance); ToJsonField(output, keyBalance) = each_Balance;
+            Json::Value each_BalanceChange; ToJsonUtilP(BalanceChange, each_BalanceChange); ToJsonField(output, keyBalanceChange) = each_BalanceChange;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_VirtualCurrency; ToJsonUtilS(VirtualCurrency, each_VirtualCurrency); ToJsonField(output, keyVirtualCurrency) = each_VirtualCurrency;
+            return output;
+        }
+
+        void RandomResultTable::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyNodes), Nodes);
+            FromJsonUtilS(FromJsonField(input, keyTableId), TableId);
+        }
+
+        Json::Value RandomResultTable::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Nodes; ToJsonUtilO(Nodes, each_Nodes); ToJsonField(output, keyNodes) = each_Nodes;
+            Json::Value each_TableId; ToJsonUtilS(TableId, each_TableId); ToJsonField(output, keyTableId) = each_TableId;
+            return output;
+        }
+
+        void RefundPurchaseRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyOrderId), OrderId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyReason), Reason);
+        }
+
+        Json::Value RefundPurchaseRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_OrderId; ToJsonUtilS(OrderId, each_OrderId); ToJsonField(output, keyOrderId) = each_OrderId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_Reason; ToJsonUtilS(Reason, each_Reason); ToJsonField(output, keyReason) = each_Reason;
+            return output;
+        }
+
+        void RefundPurchaseResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPurchaseStatus), PurchaseStatus);
+        }
+
+        Json::Value RefundPurchaseResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PurchaseStatus; ToJsonUtilS(PurchaseStatus, each_PurchaseStatus); ToJsonField(output, keyPurchaseStatus) = each_PurchaseStatus;
+            return output;
+        }
+
+        void RemovePlayerTagRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyTagName), TagName);
+        }
+
+        Json::Value RemovePlayerTagRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_TagName; ToJsonUtilS(TagName, each_TagName); ToJsonField(output, keyTagName) = each_TagName;
+            return output;
+        }
+
+        void RemovePlayerTagResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value RemovePlayerTagResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void RemoveServerBuildRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBuildId), BuildId);
+        }
+
+        Json::Value RemoveServerBuildRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); ToJsonField(output, keyBuildId) = each_BuildId;
+            return output;
+        }
+
+        void RemoveServerBuildResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value RemoveServerBuildResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void RemoveVirtualCurrencyTypesRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyVirtualCurrencies), VirtualCurrencies);
+        }
+
+        Json::Value RemoveVirtualCurrencyTypesRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_VirtualCurrencies; ToJsonUtilO(VirtualCurrencies, each_VirtualCurrencies); ToJsonField(output, keyVirtualCurrencies) = each_VirtualCurrencies;
+            return output;
+        }
+
+        void ResetCharacterStatisticsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value ResetCharacterStatisticsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void ResetCharacterStatisticsResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value ResetCharacterStatisticsResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void ResetPasswordRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPassword), Password);
+            FromJsonUtilS(FromJsonField(input, keyToken), Token);
+        }
+
+        Json::Value ResetPasswordRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Password; ToJsonUtilS(Password, each_Password); ToJsonField(output, keyPassword) = each_Password;
+            Json::Value each_Token; ToJsonUtilS(Token, each_Token); ToJsonField(output, keyToken) = each_Token;
+            return output;
+        }
+
+        void ResetPasswordResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value ResetPasswordResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void ResetUserStatisticsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value ResetUserStatisticsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void ResetUserStatisticsResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value ResetUserStatisticsResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void ResolvePurchaseDisputeRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyOrderId), OrderId);
+            FromJsonEnum(FromJsonField(input, keyOutcome), Outcome);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyReason), Reason);
+        }
+
+        Json::Value ResolvePurchaseDisputeRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_OrderId; ToJsonUtilS(OrderId, each_OrderId); ToJsonField(output, keyOrderId) = each_OrderId;
+            Json::Value each_Outcome; ToJsonEnum(Outcome, each_Outcome); ToJsonField(output, keyOutcome) = each_Outcome;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_Reason; ToJsonUtilS(Reason, each_Reason); ToJsonField(output, keyReason) = each_Reason;
+            return output;
+        }
+
+        void ResolvePurchaseDisputeResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPurchaseStatus), PurchaseStatus);
+        }
+
+        Json::Value ResolvePurchaseDisputeResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PurchaseStatus; ToJsonUtilS(PurchaseStatus, each_PurchaseStatus); ToJsonField(output, keyPurchaseStatus) = each_PurchaseStatus;
+            return output;
+        }
+
+        void RevokeAllBansForUserRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value RevokeAllBansForUserRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void RevokeAllBansForUserResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyBanData), BanData);
+        }
+
+        Json::Value RevokeAllBansForUserResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BanData; ToJsonUtilO(BanData, each_BanData); ToJsonField(output, keyBanData) = each_BanData;
+            return output;
+        }
+
+        void RevokeBansRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBanIds), BanIds);
+        }
+
+        Json::Value RevokeBansRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BanIds; ToJsonUtilS(BanIds, each_BanIds); ToJsonField(output, keyBanIds) = each_BanIds;
+            return output;
+        }
+
+        void RevokeBansResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyBanData), BanData);
+        }
+
+        Json::Value RevokeBansResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BanData; ToJsonUtilO(BanData, each_BanData); ToJsonField(output, keyBanData) = each_BanData;
+            return output;
+        }
+
+        void RevokeInventoryItem::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyItemInstanceId), ItemInstanceId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value RevokeInventoryItem::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_ItemInstanceId; ToJsonUtilS(ItemInstanceId, each_ItemInstanceId); ToJsonField(output, keyItemInstanceId) = each_ItemInstanceId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void RevokeInventoryItemRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyItemInstanceId), ItemInstanceId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value RevokeInventoryItemRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_ItemInstanceId; ToJsonUtilS(ItemInstanceId, each_ItemInstanceId); ToJsonField(output, keyItemInstanceId) = each_ItemInstanceId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void RevokeInventoryItemsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyItems), Items);
+        }
+
+        Json::Value RevokeInventoryItemsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Items; ToJsonUtilO(Items, each_Items); ToJsonField(output, keyItems) = each_Items;
+            return output;
+        }
+
+        void RevokeItemError::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilE(FromJsonField(input, keyError), Error);
+            FromJsonUtilO(FromJsonField(input, keyItem), Item);
+        }
+
+        Json::Value RevokeItemError::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Error; ToJsonUtilE(Error, each_Error); ToJsonField(output, keyError) = each_Error;
+            Json::Value each_Item; ToJsonUtilO(Item, each_Item); ToJsonField(output, keyItem) = each_Item;
+            return output;
+        }
+
+        void RevokeInventoryItemsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyErrors), Errors);
+        }
+
+        Json::Value RevokeInventoryItemsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Errors; ToJsonUtilO(Errors, each_Errors); ToJsonField(output, keyErrors) = each_Errors;
+            return output;
+        }
+
+        void RevokeInventoryResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value RevokeInventoryResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void RunTaskRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyIdentifier), Identifier);
+        }
+
+        Json::Value RunTaskRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Identifier; ToJsonUtilO(Identifier, each_Identifier); ToJsonField(output, keyIdentifier) = each_Identifier;
+            return output;
+        }
+
+        void RunTaskResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyTaskInstanceId), TaskInstanceId);
+        }
+
+        Json::Value RunTaskResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_TaskInstanceId; ToJsonUtilS(TaskInstanceId, each_TaskInstanceId); ToJsonField(output, keyTaskInstanceId) = each_TaskInstanceId;
+            return output;
+        }
+
+        void SendAccountRecoveryEmailRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyEmail), Email);
+            FromJsonUtilS(FromJsonField(input, keyEmailTemplateId), EmailTemplateId);
+        }
+
+        Json::Value SendAccountRecoveryEmailRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Email; ToJsonUtilS(Email, each_Email); ToJsonField(output, keyEmail) = each_Email;
+            Json::Value each_EmailTemplateId; ToJsonUtilS(EmailTemplateId, each_EmailTemplateId); ToJsonField(output, keyEmailTemplateId) = each_EmailTemplateId;
+            return output;
+        }
+
+        void SendAccountRecoveryEmailResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value SendAccountRecoveryEmailResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void SetPlayerSecretRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlayerSecret), PlayerSecret);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value SetPlayerSecretRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); ToJsonField(output, keyPlayerSecret) = each_PlayerSecret;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void SetPlayerSecretResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value SetPlayerSecretResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void SetPublishedRevisionRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyRevision), Revision);
+            FromJsonUtilP(FromJsonField(input, keyVersion), Version);
+        }
+
+        Json::Value SetPublishedRevisionRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Revision; ToJsonUtilP(Revision, each_Revision); ToJsonField(output, keyRevision) = each_Revision;
+            Json::Value each_Version; ToJsonUtilP(Version, each_Version); ToJsonField(output, keyVersion) = each_Version;
+            return output;
+        }
+
+        void SetPublishedRevisionResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value SetPublishedRevisionResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void SetPublisherDataRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyKey), Key);
+            FromJsonUtilS(FromJsonField(input, keyValue), Value);
+        }
+
+        Json::Value SetPublisherDataRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Key; ToJsonUtilS(Key, each_Key); ToJsonField(output, keyKey) = each_Key;
+            Json::Value each_Value; ToJsonUtilS(Value, each_Value); ToJsonField(output, keyValue) = each_Value;
+            return output;
+        }
+
+        void SetPublisherDataResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value SetPublisherDataResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void TitleDataKeyValue::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyKey), Key);
+            FromJsonUtilS(FromJsonField(input, keyValue), Value);
+        }
+
+        Json::Value TitleDataKeyValue::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Key; ToJsonUtilS(Key, each_Key); ToJsonField(output, keyKey) = each_Key;
+            Json::Value each_Value; ToJsonUtilS(Value, each_Value); ToJsonField(output, keyValue) = each_Value;
+            return output;
+        }
+
+        void SetTitleDataAndOverridesRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyKeyValues), KeyValues);
+            FromJsonUtilS(FromJsonField(input, keyOverrideLabel), OverrideLabel);
+        }
+
+        Json::Value SetTitleDataAndOverridesRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_KeyValues; ToJsonUtilO(KeyValues, each_KeyValues); ToJsonField(output, keyKeyValues) = each_KeyValues;
+            Json::Value each_OverrideLabel; ToJsonUtilS(OverrideLabel, each_OverrideLabel); ToJsonField(output, keyOverrideLabel) = each_OverrideLabel;
+            return output;
+        }
+
+        void SetTitleDataAndOverridesResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value SetTitleDataAndOverridesResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void SetTitleDataRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyKey), Key);
+            FromJsonUtilS(FromJsonField(input, keyValue), Value);
+        }
+
+        Json::Value SetTitleDataRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Key; ToJsonUtilS(Key, each_Key); ToJsonField(output, keyKey) = each_Key;
+            Json::Value each_Value; ToJsonUtilS(Value, each_Value); ToJsonField(output, keyValue) = each_Value;
+            return output;
+        }
+
+        void SetTitleDataResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value SetTitleDataResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void SetupPushNotificationRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCredential), Credential);
+            FromJsonUtilS(FromJsonField(input, keyKey), Key);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilP(FromJsonField(input, keyOverwriteOldARN), OverwriteOldARN);
+            FromJsonEnum(FromJsonField(input, keyPlatform), Platform);
+        }
+
+        Json::Value SetupPushNotificationRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Credential; ToJsonUtilS(Credential, each_Credential); ToJsonField(output, keyCredential) = each_Credential;
+            Json::Value each_Key; ToJsonUtilS(Key, each_Key); ToJsonField(output, keyKey) = each_Key;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_OverwriteOldARN; ToJsonUtilP(OverwriteOldARN, each_OverwriteOldARN); ToJsonField(output, keyOverwriteOldARN) = each_OverwriteOldARN;
+            Json::Value each_Platform; ToJsonEnum(Platform, each_Platform); ToJsonField(output, keyPlatform) = each_Platform;
+            return output;
+        }
+
+        void SetupPushNotificationResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyARN), ARN);
+        }
+
+        Json::Value SetupPushNotificationResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ARN; ToJsonUtilS(ARN, each_ARN); ToJsonField(output, keyARN) = each_ARN;
+            return output;
+        }
+
+        void SubtractUserVirtualCurrencyRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyAmount), Amount);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyVirtualCurrency), VirtualCurrency);
+        }
+
+        Json::Value SubtractUserVirtualCurrencyRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Amount; ToJsonUtilP(Amount, each_Amount); ToJsonField(output, keyAmount) = each_Amount;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_VirtualCurrency; ToJsonUtilS(VirtualCurrency, each_VirtualCurrency); ToJsonField(output, keyVirtualCurrency) = each_VirtualCurrency;
+            return output;
+        }
+
+        void UpdateBanRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyActive), Active);
+            FromJsonUtilS(FromJsonField(input, keyBanId), BanId);
+            FromJsonUtilT(FromJsonField(input, keyExpires), Expires);
+            FromJsonUtilS(FromJsonField(input, keyIPAddress), IPAddress);
+            FromJsonUtilS(FromJsonField(input, keyMACAddress), MACAddress);
+            FromJsonUtilP(FromJsonField(input, keyPermanent), Permanent);
+            FromJsonUtilS(FromJsonField(input, keyReason), Reason);
+        }
+
+        Json::Value UpdateBanRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Active; ToJsonUtilP(Active, each_Active); ToJsonField(output, keyActive) = each_Active;
+            Json::Value each_BanId; ToJsonUtilS(BanId, each_BanId); ToJsonField(output, keyBanId) = each_BanId;
+            Json::Value each_Expires; ToJsonUtilT(Expires, each_Expires); ToJsonField(output, keyExpires) = each_Expires;
+            Json::Value each_IPAddress; ToJsonUtilS(IPAddress, each_IPAddress); ToJsonField(output, keyIPAddress) = each_IPAddress;
+            Json::Value each_MACAddress; ToJsonUtilS(MACAddress, each_MACAddress); ToJsonField(output, keyMACAddress) = each_MACAddress;
+            Json::Value each_Permanent; ToJsonUtilP(Permanent, each_Permanent); ToJsonField(output, keyPermanent) = each_Permanent;
+            Json::Value each_Reason; ToJsonUtilS(Reason, each_Reason); ToJsonField(output, keyReason) = each_Reason;
+            return output;
+        }
+
+        void UpdateBansRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyBans), Bans);
+        }
+
+        Json::Value UpdateBansRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Bans; ToJsonUtilO(Bans, each_Bans); ToJsonField(output, keyBans) = each_Bans;
+            return output;
+        }
+
+        void UpdateBansResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyBanData), BanData);
+        }
+
+        Json::Value UpdateBansResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BanData; ToJsonUtilO(BanData, each_BanData); ToJsonField(output, keyBanData) = each_BanData;
+            return output;
+        }
+
+        void UpdateCatalogItemsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyCatalog), Catalog);
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keySetAsDefaultCatalog), SetAsDefaultCatalog);
+        }
+
+        Json::Value UpdateCatalogItemsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Catalog; ToJsonUtilO(Catalog, each_Catalog); ToJsonField(output, keyCatalog) = each_Catalog;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_SetAsDefaultCatalog; ToJsonUtilP(SetAsDefaultCatalog, each_SetAsDefaultCatalog); ToJsonField(output, keySetAsDefaultCatalog) = each_SetAsDefaultCatalog;
+            return output;
+        }
+
+        void UpdateCatalogItemsResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value UpdateCatalogItemsResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void UpdateCloudScriptRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyDeveloperPlayFabId), DeveloperPlayFabId);
+            FromJsonUtilO(FromJsonField(input, keyFiles), Files);
+            FromJsonUtilP(FromJsonField(input, keyPublish), Publish);
+        }
+
+        Json::Value UpdateCloudScriptRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_DeveloperPlayFabId; ToJsonUtilS(DeveloperPlayFabId, each_DeveloperPlayFabId); ToJsonField(output, keyDeveloperPlayFabId) = each_DeveloperPlayFabId;
+            Json::Value each_Files; ToJsonUtilO(Files, each_Files); ToJsonField(output, keyFiles) = each_Files;
+            Json::Value each_Publish; ToJsonUtilP(Publish, each_Publish); ToJsonField(output, keyPublish) = each_Publish;
+            return output;
+        }
+
+        void UpdateCloudScriptResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyRevision), Revision);
+            FromJsonUtilP(FromJsonField(input, keyVersion), Version);
+        }
+
+        Json::Value UpdateCloudScriptResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Revision; ToJsonUtilP(Revision, each_Revision); ToJsonField(output, keyRevision) = each_Revision;
+            Json::Value each_Version; ToJsonUtilP(Version, each_Version); ToJsonField(output, keyVersion) = each_Version;
+            return output;
+        }
+
+        void UpdateOpenIdConnectionRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyClientId), ClientId);
+            FromJsonUtilS(FromJsonField(input, keyClientSecret), ClientSecret);
+            FromJsonUtilS(FromJsonField(input, keyConnectionId), ConnectionId);
+            FromJsonUtilS(FromJsonField(input, keyIssuerDiscoveryUrl), IssuerDiscoveryUrl);
+            FromJsonUtilO(FromJsonField(input, keyIssuerInformation), IssuerInformation);
+        }
+
+        Json::Value UpdateOpenIdConnectionRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ClientId; ToJsonUtilS(ClientId, each_ClientId); ToJsonField(output, keyClientId) = each_ClientId;
+            Json::Value each_ClientSecret; ToJsonUtilS(ClientSecret, each_ClientSecret); ToJsonField(output, keyClientSecret) = each_ClientSecret;
+            Json::Value each_ConnectionId; ToJsonUtilS(ConnectionId, each_ConnectionId); ToJsonField(output, keyConnectionId) = each_ConnectionId;
+            Json::Value each_IssuerDiscoveryUrl; ToJsonUtilS(IssuerDiscoveryUrl, each_IssuerDiscoveryUrl); ToJsonField(output, keyIssuerDiscoveryUrl) = each_IssuerDiscoveryUrl;
+            Json::Value each_IssuerInformation; ToJsonUtilO(IssuerInformation, each_IssuerInformation); ToJsonField(output, keyIssuerInformation) = each_IssuerInformation;
+            return output;
+        }
+
+        void UpdatePlayerSharedSecretRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyDisabled), Disabled);
+            FromJsonUtilS(FromJsonField(input, keyFriendlyName), FriendlyName);
+            FromJsonUtilS(FromJsonField(input, keySecretKey), SecretKey);
+        }
+
+        Json::Value UpdatePlayerSharedSecretRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Disabled; ToJsonUtilP(Disabled, each_Disabled); ToJsonField(output, keyDisabled) = each_Disabled;
+            Json::Value each_FriendlyName; ToJsonUtilS(FriendlyName, each_FriendlyName); ToJsonField(output, keyFriendlyName) = each_FriendlyName;
+            Json::Value each_SecretKey; ToJsonUtilS(SecretKey, each_SecretKey); ToJsonField(output, keySecretKey) = each_SecretKey;
+            return output;
+        }
+
+        void UpdatePlayerSharedSecretResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value UpdatePlayerSharedSecretResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void UpdatePlayerStatisticDefinitionRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilE(FromJsonField(input, keyAggregationMethod), AggregationMethod);
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+            FromJsonUtilE(FromJsonField(input, keyVersionChangeInterval), VersionChangeInterval);
+        }
+
+        Json::Value UpdatePlayerStatisticDefinitionRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AggregationMethod; ToJsonUtilE(AggregationMethod, each_AggregationMethod); ToJsonField(output, keyAggregationMethod) = each_AggregationMethod;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            Json::Value each_VersionChangeInterval; ToJsonUtilE(VersionChangeInterval, each_VersionChangeInterval); ToJsonField(output, keyVersionChangeInterval) = each_VersionChangeInterval;
+            return output;
+        }
+
+        void UpdatePlayerStatisticDefinitionResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyStatistic), Statistic);
+        }
+
+        Json::Value UpdatePlayerStatisticDefinitionResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Statistic; ToJsonUtilO(Statistic, each_Statistic); ToJsonField(output, keyStatistic) = each_Statistic;
+            return output;
+        }
+
+        void UpdatePolicyRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyOverwritePolicy), OverwritePolicy);
+            FromJsonUtilS(FromJsonField(input, keyPolicyName), PolicyName);
+            FromJsonUtilO(FromJsonField(input, keyStatements), Statements);
+        }
+
+        Json::Value UpdatePolicyRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_OverwritePolicy; ToJsonUtilP(OverwritePolicy, each_OverwritePolicy); ToJsonField(output, keyOverwritePolicy) = each_OverwritePolicy;
+            Json::Value each_PolicyName; ToJsonUtilS(PolicyName, each_PolicyName); ToJsonField(output, keyPolicyName) = each_PolicyName;
+            Json::Value each_Statements; ToJsonUtilO(Statements, each_Statements); ToJsonField(output, keyStatements) = each_Statements;
+            return output;
+        }
+
+        void UpdatePolicyResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPolicyName), PolicyName);
+            FromJsonUtilO(FromJsonField(input, keyStatements), Statements);
+        }
+
+        Json::Value UpdatePolicyResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PolicyName; ToJsonUtilS(PolicyName, each_PolicyName); ToJsonField(output, keyPolicyName) = each_PolicyName;
+            Json::Value each_Statements; ToJsonUtilO(Statements, each_Statements); ToJsonField(output, keyStatements) = each_Statements;
+            return output;
+        }
+
+        void UpdateRandomResultTablesRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyTables), Tables);
+        }
+
+        Json::Value UpdateRandomResultTablesRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Tables; ToJsonUtilO(Tables, each_Tables); ToJsonField(output, keyTables) = each_Tables;
+            return output;
+        }
+
+        void UpdateRandomResultTablesResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value UpdateRandomResultTablesResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void UpdateSegmentRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keySegmentModel), pfSegmentModel);
+        }
+
+        Json::Value UpdateSegmentRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_pfSegmentModel; ToJsonUtilO(pfSegmentModel, each_pfSegmentModel); ToJsonField(output, keySegmentModel) = each_pfSegmentModel;
+            return output;
+        }
+
+        void UpdateSegmentResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyErrorMessage), ErrorMessage);
+            FromJsonUtilS(FromJsonField(input, keySegmentId), SegmentId);
+        }
+
+        Json::Value UpdateSegmentResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ErrorMessage; ToJsonUtilS(ErrorMessage, each_ErrorMessage); ToJsonField(output, keyErrorMessage) = each_ErrorMessage;
+            Json::Value each_SegmentId; ToJsonUtilS(SegmentId, each_SegmentId); ToJsonField(output, keySegmentId) = each_SegmentId;
+            return output;
+        }
+
+        void UpdateStoreItemsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyMarketingData), MarketingData);
+            FromJsonUtilO(FromJsonField(input, keyStore), Store);
+            FromJsonUtilS(FromJsonField(input, keyStoreId), StoreId);
+        }
+
+        Json::Value UpdateStoreItemsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_MarketingData; ToJsonUtilO(MarketingData, each_MarketingData); ToJsonField(output, keyMarketingData) = each_MarketingData;
+            Json::Value each_Store; ToJsonUtilO(Store, each_Store); ToJsonField(output, keyStore) = each_Store;
+            Json::Value each_StoreId; ToJsonUtilS(StoreId, each_StoreId); ToJsonField(output, keyStoreId) = each_StoreId;
+            return output;
+        }
+
+        void UpdateStoreItemsResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value UpdateStoreItemsResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void UpdateTaskRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyDescription), Description);
+            FromJsonUtilO(FromJsonField(input, keyIdentifier), Identifier);
+            FromJsonUtilP(FromJsonField(input, keyIsActive), IsActive);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            Parameter = FromJsonField(input, keyParameter);
+            FromJsonUtilS(FromJsonField(input, keySchedule), Schedule);
+            FromJsonEnum(FromJsonField(input, keyType), Type);
+        }
+
+        Json::Value UpdateTaskRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Description; ToJsonUtilS(Description, each_Description); ToJsonField(output, keyDescription) = each_Description;
+            Json::Value each_Identifier; ToJsonUtilO(Identifier, each_Identifier); ToJsonField(output, keyIdentifier) = each_Identifier;
+            Json::Value each_IsActive; ToJsonUtilP(IsActive, each_IsActive); ToJsonField(output, keyIsActive) = each_IsActive;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            ToJsonField(output, keyParameter) = Parameter;
+            Json::Value each_Schedule; ToJsonUtilS(Schedule, each_Schedule); ToJsonField(output, keySchedule) = each_Schedule;
+            Json::Value each_Type; ToJsonEnum(Type, each_Type); ToJsonField(output, keyType) = each_Type;
+            return output;
+        }
+
+        void UpdateUserDataRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyData), Data);
+            FromJsonUtilS(FromJsonField(input, keyKeysToRemove), KeysToRemove);
+            FromJsonUtilE(FromJsonField(input, keyPermission), Permission);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value UpdateUserDataRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Data; ToJsonUtilS(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            Json::Value each_KeysToRemove; ToJsonUtilS(KeysToRemove, each_KeysToRemove); ToJsonField(output, keyKeysToRemove) = each_KeysToRemove;
+            Json::Value each_Permission; ToJsonUtilE(Permission, each_Permission); ToJsonField(output, keyPermission) = each_Permission;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void UpdateUserDataResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyDataVersion), DataVersion);
+        }
+
+        Json::Value UpdateUserDataResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_DataVersion; ToJsonUtilP(DataVersion, each_DataVersion); ToJsonField(output, keyDataVersion) = each_DataVersion;
+            return output;
+        }
+
+        void UpdateUserInternalDataRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyData), Data);
+            FromJsonUtilS(FromJsonField(input, keyKeysToRemove), KeysToRemove);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value UpdateUserInternalDataRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Data; ToJsonUtilS(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            Json::Value each_KeysToRemove; ToJsonUtilS(KeysToRemove, each_KeysToRemove); ToJsonField(output, keyKeysToRemove) = each_KeysToRemove;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void UpdateUserTitleDisplayNameRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value UpdateUserTitleDisplayNameRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void UpdateUserTitleDisplayNameResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+        }
+
+        Json::Value UpdateUserTitleDisplayNameResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            return output;
+        }
+    }
+}
+
+#endif
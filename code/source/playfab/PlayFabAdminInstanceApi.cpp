@@ -3,7 +3,9 @@
 #if defined(ENABLE_PLAYFABADMIN_API)
 
 #include <playfab/PlayFabAdminInstanceApi.h>
+#include <playfab/PlayFabAdminDataModels.h>
 #include <playfab/PlayFabPluginManager.h>
+#include <playfab/PlayFabApiDispatch.h>
 #include <playfab/PlayFabSettings.h>
 
 #if defined(PLAYFAB_PLATFORM_WINDOWS)
@@ -62,5876 +64,3479 @@ namespace PlayFab
 
     void PlayFabAdminInstanceAPI::AbortTaskInstance(
         AbortTaskInstanceRequest& request,
-        const ProcessApiCallback<EmptyResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<EmptyResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<EmptyResponse>(
             "/Admin/AbortTaskInstance",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnAbortTaskInstanceResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnAbortTaskInstanceResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnAbortTaskInstanceResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        EmptyResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<EmptyResponse> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<EmptyResponse>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::AddLocalizedNews(
         AddLocalizedNewsRequest& request,
-        const ProcessApiCallback<AddLocalizedNewsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<AddLocalizedNewsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<AddLocalizedNewsResult>(
             "/Admin/AddLocalizedNews",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnAddLocalizedNewsResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<AddLocalizedNewsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnAddLocalizedNewsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnAddLocalizedNewsResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        AddLocalizedNewsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<AddLocalizedNewsResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<AddLocalizedNewsResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::AddNews(
         AddNewsRequest& request,
-        const ProcessApiCallback<AddNewsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<AddNewsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<AddNewsResult>(
             "/Admin/AddNews",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnAddNewsResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<AddNewsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnAddNewsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnAddNewsResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        AddNewsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<AddNewsResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<AddNewsResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::AddPlayerTag(
         AddPlayerTagRequest& request,
-        const ProcessApiCallback<AddPlayerTagResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<AddPlayerTagResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<AddPlayerTagResult>(
             "/Admin/AddPlayerTag",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnAddPlayerTagResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<AddPlayerTagResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnAddPlayerTagResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnAddPlayerTagResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        AddPlayerTagResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<AddPlayerTagResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<AddPlayerTagResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::AddServerBuild(
         AddServerBuildRequest& request,
-        const ProcessApiCallback<AddServerBuildResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<AddServerBuildResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<AddServerBuildResult>(
             "/Admin/AddServerBuild",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnAddServerBuildResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<AddServerBuildResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnAddServerBuildResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnAddServerBuildResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        AddServerBuildResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<AddServerBuildResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<AddServerBuildResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::AddUserVirtualCurrency(
         AddUserVirtualCurrencyRequest& request,
-        const ProcessApiCallback<ModifyUserVirtualCurrencyResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ModifyUserVirtualCurrencyResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ModifyUserVirtualCurrencyResult>(
             "/Admin/AddUserVirtualCurrency",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnAddUserVirtualCurrencyResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyUserVirtualCurrencyResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnAddUserVirtualCurrencyResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnAddUserVirtualCurrencyResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ModifyUserVirtualCurrencyResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<ModifyUserVirtualCurrencyResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<ModifyUserVirtualCurrencyResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::AddVirtualCurrencyTypes(
         AddVirtualCurrencyTypesRequest& request,
-        const ProcessApiCallback<BlankResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<BlankResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<BlankResult>(
             "/Admin/AddVirtualCurrencyTypes",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnAddVirtualCurrencyTypesResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<BlankResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnAddVirtualCurrencyTypesResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnAddVirtualCurrencyTypesResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        BlankResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<BlankResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<BlankResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::BanUsers(
         BanUsersRequest& request,
-        const ProcessApiCallback<BanUsersResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<BanUsersResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<BanUsersResult>(
             "/Admin/BanUsers",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnBanUsersResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<BanUsersResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnBanUsersResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnBanUsersResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        BanUsersResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<BanUsersResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<BanUsersResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::CheckLimitedEditionItemAvailability(
         CheckLimitedEditionItemAvailabilityRequest& request,
-        const ProcessApiCallback<CheckLimitedEditionItemAvailabilityResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<CheckLimitedEditionItemAvailabilityResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<CheckLimitedEditionItemAvailabilityResult>(
             "/Admin/CheckLimitedEditionItemAvailability",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnCheckLimitedEditionItemAvailabilityResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<CheckLimitedEditionItemAvailabilityResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnCheckLimitedEditionItemAvailabilityResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnCheckLimitedEditionItemAvailabilityResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        CheckLimitedEditionItemAvailabilityResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<CheckLimitedEditionItemAvailabilityResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<CheckLimitedEditionItemAvailabilityResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::CreateActionsOnPlayersInSegmentTask(
         CreateActionsOnPlayerSegmentTaskRequest& request,
-        const ProcessApiCallback<CreateTaskResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<CreateTaskResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<CreateTaskResult>(
             "/Admin/CreateActionsOnPlayersInSegmentTask",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnCreateActionsOnPlayersInSegmentTaskResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateTaskResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnCreateActionsOnPlayersInSegmentTaskResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnCreateActionsOnPlayersInSegmentTaskResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        CreateTaskResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<CreateTaskResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<CreateTaskResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::CreateCloudScriptTask(
         CreateCloudScriptTaskRequest& request,
-        const ProcessApiCallback<CreateTaskResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<CreateTaskResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<CreateTaskResult>(
             "/Admin/CreateCloudScriptTask",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnCreateCloudScriptTaskResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateTaskResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnCreateCloudScriptTaskResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnCreateCloudScriptTaskResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        CreateTaskResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<CreateTaskResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<CreateTaskResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::CreateInsightsScheduledScalingTask(
         CreateInsightsScheduledScalingTaskRequest& request,
-        const ProcessApiCallback<CreateTaskResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<CreateTaskResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<CreateTaskResult>(
             "/Admin/CreateInsightsScheduledScalingTask",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnCreateInsightsScheduledScalingTaskResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateTaskResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnCreateInsightsScheduledScalingTaskResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnCreateInsightsScheduledScalingTaskResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        CreateTaskResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<CreateTaskResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<CreateTaskResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::CreateOpenIdConnection(
         CreateOpenIdConnectionRequest& request,
-        const ProcessApiCallback<EmptyResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<EmptyResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<EmptyResponse>(
             "/Admin/CreateOpenIdConnection",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnCreateOpenIdConnectionResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnCreateOpenIdConnectionResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnCreateOpenIdConnectionResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        EmptyResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<EmptyResponse> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<EmptyResponse>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::CreatePlayerSharedSecret(
         CreatePlayerSharedSecretRequest& request,
-        const ProcessApiCallback<CreatePlayerSharedSecretResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<CreatePlayerSharedSecretResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<CreatePlayerSharedSecretResult>(
             "/Admin/CreatePlayerSharedSecret",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnCreatePlayerSharedSecretResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<CreatePlayerSharedSecretResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnCreatePlayerSharedSecretResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnCreatePlayerSharedSecretResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        CreatePlayerSharedSecretResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<CreatePlayerSharedSecretResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<CreatePlayerSharedSecretResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::CreatePlayerStatisticDefinition(
         CreatePlayerStatisticDefinitionRequest& request,
-        const ProcessApiCallback<CreatePlayerStatisticDefinitionResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<CreatePlayerStatisticDefinitionResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<CreatePlayerStatisticDefinitionResult>(
             "/Admin/CreatePlayerStatisticDefinition",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnCreatePlayerStatisticDefinitionResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<CreatePlayerStatisticDefinitionResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnCreatePlayerStatisticDefinitionResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnCreatePlayerStatisticDefinitionResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        CreatePlayerStatisticDefinitionResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<CreatePlayerStatisticDefinitionResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<CreatePlayerStatisticDefinitionResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::CreateSegment(
         CreateSegmentRequest& request,
-        const ProcessApiCallback<CreateSegmentResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<CreateSegmentResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<CreateSegmentResponse>(
             "/Admin/CreateSegment",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnCreateSegmentResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateSegmentResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnCreateSegmentResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnCreateSegmentResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        CreateSegmentResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<CreateSegmentResponse> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<CreateSegmentResponse>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::DeleteContent(
         DeleteContentRequest& request,
-        const ProcessApiCallback<BlankResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<BlankResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<BlankResult>(
             "/Admin/DeleteContent",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnDeleteContentResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<BlankResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnDeleteContentResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnDeleteContentResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        BlankResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<BlankResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<BlankResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::DeleteMasterPlayerAccount(
         DeleteMasterPlayerAccountRequest& request,
-        const ProcessApiCallback<DeleteMasterPlayerAccountResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<DeleteMasterPlayerAccountResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<DeleteMasterPlayerAccountResult>(
             "/Admin/DeleteMasterPlayerAccount",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnDeleteMasterPlayerAccountResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<DeleteMasterPlayerAccountResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnDeleteMasterPlayerAccountResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnDeleteMasterPlayerAccountResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        DeleteMasterPlayerAccountResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<DeleteMasterPlayerAccountResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<DeleteMasterPlayerAccountResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::DeleteOpenIdConnection(
         DeleteOpenIdConnectionRequest& request,
-        const ProcessApiCallback<EmptyResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<EmptyResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<EmptyResponse>(
             "/Admin/DeleteOpenIdConnection",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnDeleteOpenIdConnectionResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnDeleteOpenIdConnectionResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnDeleteOpenIdConnectionResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        EmptyResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<EmptyResponse> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<EmptyResponse>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::DeletePlayer(
         DeletePlayerRequest& request,
-        const ProcessApiCallback<DeletePlayerResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<DeletePlayerResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<DeletePlayerResult>(
             "/Admin/DeletePlayer",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnDeletePlayerResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<DeletePlayerResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnDeletePlayerResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnDeletePlayerResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        DeletePlayerResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<DeletePlayerResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<DeletePlayerResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::DeletePlayerSharedSecret(
         DeletePlayerSharedSecretRequest& request,
-        const ProcessApiCallback<DeletePlayerSharedSecretResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<DeletePlayerSharedSecretResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<DeletePlayerSharedSecretResult>(
             "/Admin/DeletePlayerSharedSecret",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnDeletePlayerSharedSecretResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<DeletePlayerSharedSecretResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnDeletePlayerSharedSecretResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnDeletePlayerSharedSecretResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        DeletePlayerSharedSecretResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<DeletePlayerSharedSecretResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<DeletePlayerSharedSecretResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::DeleteSegment(
         DeleteSegmentRequest& request,
-        const ProcessApiCallback<DeleteSegmentsResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<DeleteSegmentsResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<DeleteSegmentsResponse>(
             "/Admin/DeleteSegment",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnDeleteSegmentResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<DeleteSegmentsResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnDeleteSegmentResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnDeleteSegmentResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        DeleteSegmentsResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<DeleteSegmentsResponse> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<DeleteSegmentsResponse>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::DeleteStore(
         DeleteStoreRequest& request,
-        const ProcessApiCallback<DeleteStoreResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<DeleteStoreResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<DeleteStoreResult>(
             "/Admin/DeleteStore",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnDeleteStoreResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<DeleteStoreResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnDeleteStoreResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnDeleteStoreResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        DeleteStoreResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<DeleteStoreResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<DeleteStoreResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::DeleteTask(
         DeleteTaskRequest& request,
-        const ProcessApiCallback<EmptyResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<EmptyResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<EmptyResponse>(
             "/Admin/DeleteTask",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnDeleteTaskResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnDeleteTaskResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnDeleteTaskResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        EmptyResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<EmptyResponse> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<EmptyResponse>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::DeleteTitle(
         DeleteTitleRequest& request,
-        const ProcessApiCallback<DeleteTitleResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<DeleteTitleResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<DeleteTitleResult>(
             "/Admin/DeleteTitle",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnDeleteTitleResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<DeleteTitleResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnDeleteTitleResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnDeleteTitleResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        DeleteTitleResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<DeleteTitleResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<DeleteTitleResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::DeleteTitleDataOverride(
         DeleteTitleDataOverrideRequest& request,
-        const ProcessApiCallback<DeleteTitleDataOverrideResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<DeleteTitleDataOverrideResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<DeleteTitleDataOverrideResult>(
             "/Admin/DeleteTitleDataOverride",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnDeleteTitleDataOverrideResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<DeleteTitleDataOverrideResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnDeleteTitleDataOverrideResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnDeleteTitleDataOverrideResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        DeleteTitleDataOverrideResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<DeleteTitleDataOverrideResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
-    }
+        PlayFabApiDispatch::OnApiResult<DeleteTitleDataOverrideResult>(httpCode, result, reqContainer);
+    }
 
     void PlayFabAdminInstanceAPI::ExportMasterPlayerData(
         ExportMasterPlayerDataRequest& request,
-        const ProcessApiCallback<ExportMasterPlayerDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ExportMasterPlayerDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ExportMasterPlayerDataResult>(
             "/Admin/ExportMasterPlayerData",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnExportMasterPlayerDataResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ExportMasterPlayerDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnExportMasterPlayerDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnExportMasterPlayerDataResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ExportMasterPlayerDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<ExportMasterPlayerDataResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<ExportMasterPlayerDataResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetActionsOnPlayersInSegmentTaskInstance(
         GetTaskInstanceRequest& request,
-        const ProcessApiCallback<GetActionsOnPlayersInSegmentTaskInstanceResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetActionsOnPlayersInSegmentTaskInstanceResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetActionsOnPlayersInSegmentTaskInstanceResult>(
             "/Admin/GetActionsOnPlayersInSegmentTaskInstance",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetActionsOnPlayersInSegmentTaskInstanceResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetActionsOnPlayersInSegmentTaskInstanceResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetActionsOnPlayersInSegmentTaskInstanceResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetActionsOnPlayersInSegmentTaskInstanceResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetActionsOnPlayersInSegmentTaskInstanceResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetActionsOnPlayersInSegmentTaskInstanceResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetActionsOnPlayersInSegmentTaskInstanceResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetAllSegments(
         GetAllSegmentsRequest& request,
-        const ProcessApiCallback<GetAllSegmentsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetAllSegmentsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetAllSegmentsResult>(
             "/Admin/GetAllSegments",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetAllSegmentsResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetAllSegmentsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetAllSegmentsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetAllSegmentsResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetAllSegmentsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetAllSegmentsResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetAllSegmentsResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetCatalogItems(
         GetCatalogItemsRequest& request,
-        const ProcessApiCallback<GetCatalogItemsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetCatalogItemsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetCatalogItemsResult>(
             "/Admin/GetCatalogItems",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetCatalogItemsResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCatalogItemsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetCatalogItemsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetCatalogItemsResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetCatalogItemsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetCatalogItemsResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetCatalogItemsResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetCloudScriptRevision(
         GetCloudScriptRevisionRequest& request,
-        const ProcessApiCallback<GetCloudScriptRevisionResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetCloudScriptRevisionResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetCloudScriptRevisionResult>(
             "/Admin/GetCloudScriptRevision",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetCloudScriptRevisionResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCloudScriptRevisionResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetCloudScriptRevisionResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetCloudScriptRevisionResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetCloudScriptRevisionResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetCloudScriptRevisionResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetCloudScriptRevisionResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetCloudScriptTaskInstance(
         GetTaskInstanceRequest& request,
-        const ProcessApiCallback<GetCloudScriptTaskInstanceResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetCloudScriptTaskInstanceResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetCloudScriptTaskInstanceResult>(
             "/Admin/GetCloudScriptTaskInstance",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetCloudScriptTaskInstanceResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCloudScriptTaskInstanceResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetCloudScriptTaskInstanceResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetCloudScriptTaskInstanceResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetCloudScriptTaskInstanceResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetCloudScriptTaskInstanceResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetCloudScriptTaskInstanceResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetCloudScriptVersions(
         GetCloudScriptVersionsRequest& request,
-        const ProcessApiCallback<GetCloudScriptVersionsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetCloudScriptVersionsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetCloudScriptVersionsResult>(
             "/Admin/GetCloudScriptVersions",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetCloudScriptVersionsResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCloudScriptVersionsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetCloudScriptVersionsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetCloudScriptVersionsResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetCloudScriptVersionsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetCloudScriptVersionsResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetCloudScriptVersionsResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetContentList(
         GetContentListRequest& request,
-        const ProcessApiCallback<GetContentListResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetContentListResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetContentListResult>(
             "/Admin/GetContentList",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetContentListResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetContentListResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetContentListResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetContentListResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetContentListResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetContentListResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetContentListResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetContentUploadUrl(
         GetContentUploadUrlRequest& request,
-        const ProcessApiCallback<GetContentUploadUrlResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetContentUploadUrlResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetContentUploadUrlResult>(
             "/Admin/GetContentUploadUrl",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetContentUploadUrlResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetContentUploadUrlResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetContentUploadUrlResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetContentUploadUrlResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetContentUploadUrlResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetContentUploadUrlResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetContentUploadUrlResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetDataReport(
         GetDataReportRequest& request,
-        const ProcessApiCallback<GetDataReportResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetDataReportResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetDataReportResult>(
             "/Admin/GetDataReport",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetDataReportResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetDataReportResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetDataReportResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetDataReportResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetDataReportResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetDataReportResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetDataReportResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetMatchmakerGameInfo(
         GetMatchmakerGameInfoRequest& request,
-        const ProcessApiCallback<GetMatchmakerGameInfoResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetMatchmakerGameInfoResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetMatchmakerGameInfoResult>(
             "/Admin/GetMatchmakerGameInfo",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetMatchmakerGameInfoResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetMatchmakerGameInfoResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetMatchmakerGameInfoResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetMatchmakerGameInfoResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetMatchmakerGameInfoResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetMatchmakerGameInfoResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetMatchmakerGameInfoResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetMatchmakerGameModes(
         GetMatchmakerGameModesRequest& request,
-        const ProcessApiCallback<GetMatchmakerGameModesResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetMatchmakerGameModesResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetMatchmakerGameModesResult>(
             "/Admin/GetMatchmakerGameModes",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetMatchmakerGameModesResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetMatchmakerGameModesResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetMatchmakerGameModesResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetMatchmakerGameModesResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetMatchmakerGameModesResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetMatchmakerGameModesResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetMatchmakerGameModesResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetPlayedTitleList(
         GetPlayedTitleListRequest& request,
-        const ProcessApiCallback<GetPlayedTitleListResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayedTitleListResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayedTitleListResult>(
             "/Admin/GetPlayedTitleList",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetPlayedTitleListResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayedTitleListResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetPlayedTitleListResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetPlayedTitleListResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayedTitleListResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetPlayedTitleListResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetPlayedTitleListResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetPlayerIdFromAuthToken(
         GetPlayerIdFromAuthTokenRequest& request,
-        const ProcessApiCallback<GetPlayerIdFromAuthTokenResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayerIdFromAuthTokenResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayerIdFromAuthTokenResult>(
             "/Admin/GetPlayerIdFromAuthToken",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetPlayerIdFromAuthTokenResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerIdFromAuthTokenResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetPlayerIdFromAuthTokenResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetPlayerIdFromAuthTokenResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayerIdFromAuthTokenResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetPlayerIdFromAuthTokenResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetPlayerIdFromAuthTokenResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetPlayerProfile(
         GetPlayerProfileRequest& request,
-        const ProcessApiCallback<GetPlayerProfileResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayerProfileResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayerProfileResult>(
             "/Admin/GetPlayerProfile",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetPlayerProfileResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerProfileResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetPlayerProfileResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetPlayerProfileResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayerProfileResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetPlayerProfileResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetPlayerProfileResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetPlayerSegments(
         GetPlayersSegmentsRequest& request,
-        const ProcessApiCallback<GetPlayerSegmentsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayerSegmentsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayerSegmentsResult>(
             "/Admin/GetPlayerSegments",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetPlayerSegmentsResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerSegmentsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetPlayerSegmentsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetPlayerSegmentsResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayerSegmentsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetPlayerSegmentsResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetPlayerSegmentsResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetPlayerSharedSecrets(
         GetPlayerSharedSecretsRequest& request,
-        const ProcessApiCallback<GetPlayerSharedSecretsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayerSharedSecretsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayerSharedSecretsResult>(
             "/Admin/GetPlayerSharedSecrets",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetPlayerSharedSecretsResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerSharedSecretsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetPlayerSharedSecretsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetPlayerSharedSecretsResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayerSharedSecretsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetPlayerSharedSecretsResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetPlayerSharedSecretsResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetPlayersInSegment(
         GetPlayersInSegmentRequest& request,
-        const ProcessApiCallback<GetPlayersInSegmentResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayersInSegmentResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayersInSegmentResult>(
             "/Admin/GetPlayersInSegment",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetPlayersInSegmentResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayersInSegmentResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetPlayersInSegmentResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetPlayersInSegmentResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayersInSegmentResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetPlayersInSegmentResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetPlayersInSegmentResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetPlayerStatisticDefinitions(
         GetPlayerStatisticDefinitionsRequest& request,
-        const ProcessApiCallback<GetPlayerStatisticDefinitionsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayerStatisticDefinitionsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayerStatisticDefinitionsResult>(
             "/Admin/GetPlayerStatisticDefinitions",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetPlayerStatisticDefinitionsResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerStatisticDefinitionsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetPlayerStatisticDefinitionsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetPlayerStatisticDefinitionsResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayerStatisticDefinitionsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetPlayerStatisticDefinitionsResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetPlayerStatisticDefinitionsResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetPlayerStatisticVersions(
         GetPlayerStatisticVersionsRequest& request,
-        const ProcessApiCallback<GetPlayerStatisticVersionsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayerStatisticVersionsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayerStatisticVersionsResult>(
             "/Admin/GetPlayerStatisticVersions",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetPlayerStatisticVersionsResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerStatisticVersionsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetPlayerStatisticVersionsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetPlayerStatisticVersionsResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayerStatisticVersionsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetPlayerStatisticVersionsResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetPlayerStatisticVersionsResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetPlayerTags(
         GetPlayerTagsRequest& request,
-        const ProcessApiCallback<GetPlayerTagsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayerTagsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayerTagsResult>(
             "/Admin/GetPlayerTags",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetPlayerTagsResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerTagsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetPlayerTagsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetPlayerTagsResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayerTagsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetPlayerTagsResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetPlayerTagsResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetPolicy(
         GetPolicyRequest& request,
-        const ProcessApiCallback<GetPolicyResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPolicyResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPolicyResponse>(
             "/Admin/GetPolicy",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetPolicyResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPolicyResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetPolicyResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetPolicyResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPolicyResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetPolicyResponse> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetPolicyResponse>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetPublisherData(
         GetPublisherDataRequest& request,
-        const ProcessApiCallback<GetPublisherDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPublisherDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPublisherDataResult>(
             "/Admin/GetPublisherData",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetPublisherDataResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPublisherDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetPublisherDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetPublisherDataResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPublisherDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetPublisherDataResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetPublisherDataResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetRandomResultTables(
         GetRandomResultTablesRequest& request,
-        const ProcessApiCallback<GetRandomResultTablesResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetRandomResultTablesResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetRandomResultTablesResult>(
             "/Admin/GetRandomResultTables",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetRandomResultTablesResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetRandomResultTablesResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetRandomResultTablesResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetRandomResultTablesResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetRandomResultTablesResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetRandomResultTablesResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetRandomResultTablesResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetSegments(
         GetSegmentsRequest& request,
-        const ProcessApiCallback<GetSegmentsResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetSegmentsResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetSegmentsResponse>(
             "/Admin/GetSegments",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetSegmentsResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetSegmentsResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetSegmentsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetSegmentsResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetSegmentsResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetSegmentsResponse> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetSegmentsResponse>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetServerBuildInfo(
         GetServerBuildInfoRequest& request,
-        const ProcessApiCallback<GetServerBuildInfoResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetServerBuildInfoResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetServerBuildInfoResult>(
             "/Admin/GetServerBuildInfo",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetServerBuildInfoResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetServerBuildInfoResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetServerBuildInfoResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetServerBuildInfoResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetServerBuildInfoResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetServerBuildInfoResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetServerBuildInfoResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetServerBuildUploadUrl(
         GetServerBuildUploadURLRequest& request,
-        const ProcessApiCallback<GetServerBuildUploadURLResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetServerBuildUploadURLResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetServerBuildUploadURLResult>(
             "/Admin/GetServerBuildUploadUrl",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetServerBuildUploadUrlResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetServerBuildUploadURLResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetServerBuildUploadUrlResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetServerBuildUploadUrlResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetServerBuildUploadURLResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetServerBuildUploadURLResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetServerBuildUploadURLResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetStoreItems(
         GetStoreItemsRequest& request,
-        const ProcessApiCallback<GetStoreItemsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetStoreItemsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetStoreItemsResult>(
             "/Admin/GetStoreItems",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetStoreItemsResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetStoreItemsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetStoreItemsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetStoreItemsResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetStoreItemsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetStoreItemsResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetStoreItemsResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetTaskInstances(
         GetTaskInstancesRequest& request,
-        const ProcessApiCallback<GetTaskInstancesResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetTaskInstancesResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetTaskInstancesResult>(
             "/Admin/GetTaskInstances",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetTaskInstancesResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTaskInstancesResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetTaskInstancesResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetTaskInstancesResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetTaskInstancesResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetTaskInstancesResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetTaskInstancesResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetTasks(
         GetTasksRequest& request,
-        const ProcessApiCallback<GetTasksResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetTasksResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetTasksResult>(
             "/Admin/GetTasks",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetTasksResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTasksResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetTasksResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetTasksResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetTasksResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetTasksResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetTasksResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetTitleData(
         GetTitleDataRequest& request,
-        const ProcessApiCallback<GetTitleDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetTitleDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetTitleDataResult>(
             "/Admin/GetTitleData",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetTitleDataResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetTitleDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetTitleDataResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetTitleDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetTitleDataResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetTitleDataResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetTitleInternalData(
         GetTitleDataRequest& request,
-        const ProcessApiCallback<GetTitleDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetTitleDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetTitleDataResult>(
             "/Admin/GetTitleInternalData",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetTitleInternalDataResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetTitleInternalDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetTitleInternalDataResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetTitleDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetTitleDataResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetTitleDataResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetUserAccountInfo(
         LookupUserAccountInfoRequest& request,
-        const ProcessApiCallback<LookupUserAccountInfoResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LookupUserAccountInfoResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LookupUserAccountInfoResult>(
             "/Admin/GetUserAccountInfo",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetUserAccountInfoResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LookupUserAccountInfoResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetUserAccountInfoResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetUserAccountInfoResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        LookupUserAccountInfoResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<LookupUserAccountInfoResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<LookupUserAccountInfoResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetUserBans(
         GetUserBansRequest& request,
-        const ProcessApiCallback<GetUserBansResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetUserBansResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetUserBansResult>(
             "/Admin/GetUserBans",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetUserBansResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserBansResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetUserBansResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetUserBansResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetUserBansResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetUserBansResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetUserBansResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetUserData(
         GetUserDataRequest& request,
-        const ProcessApiCallback<GetUserDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetUserDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetUserDataResult>(
             "/Admin/GetUserData",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetUserDataResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetUserDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetUserDataResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetUserDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetUserDataResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetUserDataResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetUserInternalData(
         GetUserDataRequest& request,
-        const ProcessApiCallback<GetUserDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetUserDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetUserDataResult>(
             "/Admin/GetUserInternalData",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetUserInternalDataResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetUserInternalDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetUserInternalDataResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetUserDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetUserDataResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetUserDataResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetUserInventory(
         GetUserInventoryRequest& request,
-        const ProcessApiCallback<GetUserInventoryResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetUserInventoryResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetUserInventoryResult>(
             "/Admin/GetUserInventory",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetUserInventoryResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserInventoryResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetUserInventoryResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetUserInventoryResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetUserInventoryResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetUserInventoryResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetUserInventoryResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetUserPublisherData(
         GetUserDataRequest& request,
-        const ProcessApiCallback<GetUserDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetUserDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetUserDataResult>(
             "/Admin/GetUserPublisherData",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetUserPublisherDataResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetUserPublisherDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetUserPublisherDataResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetUserDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetUserDataResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetUserDataResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetUserPublisherInternalData(
         GetUserDataRequest& request,
-        const ProcessApiCallback<GetUserDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetUserDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetUserDataResult>(
             "/Admin/GetUserPublisherInternalData",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetUserPublisherInternalDataResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetUserPublisherInternalDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetUserPublisherInternalDataResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetUserDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetUserDataResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetUserDataResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetUserPublisherReadOnlyData(
         GetUserDataRequest& request,
-        const ProcessApiCallback<GetUserDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetUserDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetUserDataResult>(
             "/Admin/GetUserPublisherReadOnlyData",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetUserPublisherReadOnlyDataResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetUserPublisherReadOnlyDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetUserPublisherReadOnlyDataResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetUserDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetUserDataResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetUserDataResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GetUserReadOnlyData(
         GetUserDataRequest& request,
-        const ProcessApiCallback<GetUserDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetUserDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetUserDataResult>(
             "/Admin/GetUserReadOnlyData",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGetUserReadOnlyDataResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGetUserReadOnlyDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetUserReadOnlyDataResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetUserDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GetUserDataResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GetUserDataResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::GrantItemsToUsers(
         GrantItemsToUsersRequest& request,
-        const ProcessApiCallback<GrantItemsToUsersResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GrantItemsToUsersResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GrantItemsToUsersResult>(
             "/Admin/GrantItemsToUsers",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnGrantItemsToUsersResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GrantItemsToUsersResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnGrantItemsToUsersResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGrantItemsToUsersResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GrantItemsToUsersResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<GrantItemsToUsersResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<GrantItemsToUsersResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::IncrementLimitedEditionItemAvailability(
         IncrementLimitedEditionItemAvailabilityRequest& request,
-        const ProcessApiCallback<IncrementLimitedEditionItemAvailabilityResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<IncrementLimitedEditionItemAvailabilityResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<IncrementLimitedEditionItemAvailabilityResult>(
             "/Admin/IncrementLimitedEditionItemAvailability",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnIncrementLimitedEditionItemAvailabilityResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<IncrementLimitedEditionItemAvailabilityResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnIncrementLimitedEditionItemAvailabilityResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnIncrementLimitedEditionItemAvailabilityResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        IncrementLimitedEditionItemAvailabilityResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<IncrementLimitedEditionItemAvailabilityResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<IncrementLimitedEditionItemAvailabilityResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::IncrementPlayerStatisticVersion(
         IncrementPlayerStatisticVersionRequest& request,
-        const ProcessApiCallback<IncrementPlayerStatisticVersionResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<IncrementPlayerStatisticVersionResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<IncrementPlayerStatisticVersionResult>(
             "/Admin/IncrementPlayerStatisticVersion",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnIncrementPlayerStatisticVersionResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<IncrementPlayerStatisticVersionResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnIncrementPlayerStatisticVersionResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnIncrementPlayerStatisticVersionResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        IncrementPlayerStatisticVersionResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<IncrementPlayerStatisticVersionResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<IncrementPlayerStatisticVersionResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::ListOpenIdConnection(
         ListOpenIdConnectionRequest& request,
-        const ProcessApiCallback<ListOpenIdConnectionResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ListOpenIdConnectionResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ListOpenIdConnectionResponse>(
             "/Admin/ListOpenIdConnection",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnListOpenIdConnectionResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ListOpenIdConnectionResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnListOpenIdConnectionResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnListOpenIdConnectionResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ListOpenIdConnectionResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<ListOpenIdConnectionResponse> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<ListOpenIdConnectionResponse>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::ListServerBuilds(
         ListBuildsRequest& request,
-        const ProcessApiCallback<ListBuildsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ListBuildsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ListBuildsResult>(
             "/Admin/ListServerBuilds",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnListServerBuildsResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ListBuildsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnListServerBuildsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnListServerBuildsResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ListBuildsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<ListBuildsResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<ListBuildsResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::ListVirtualCurrencyTypes(
         ListVirtualCurrencyTypesRequest& request,
-        const ProcessApiCallback<ListVirtualCurrencyTypesResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ListVirtualCurrencyTypesResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ListVirtualCurrencyTypesResult>(
             "/Admin/ListVirtualCurrencyTypes",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnListVirtualCurrencyTypesResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ListVirtualCurrencyTypesResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnListVirtualCurrencyTypesResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnListVirtualCurrencyTypesResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ListVirtualCurrencyTypesResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<ListVirtualCurrencyTypesResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<ListVirtualCurrencyTypesResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::ModifyMatchmakerGameModes(
         ModifyMatchmakerGameModesRequest& request,
-        const ProcessApiCallback<ModifyMatchmakerGameModesResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ModifyMatchmakerGameModesResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ModifyMatchmakerGameModesResult>(
             "/Admin/ModifyMatchmakerGameModes",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnModifyMatchmakerGameModesResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyMatchmakerGameModesResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnModifyMatchmakerGameModesResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnModifyMatchmakerGameModesResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ModifyMatchmakerGameModesResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<ModifyMatchmakerGameModesResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<ModifyMatchmakerGameModesResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::ModifyServerBuild(
         ModifyServerBuildRequest& request,
-        const ProcessApiCallback<ModifyServerBuildResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ModifyServerBuildResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ModifyServerBuildResult>(
             "/Admin/ModifyServerBuild",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnModifyServerBuildResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyServerBuildResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnModifyServerBuildResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnModifyServerBuildResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ModifyServerBuildResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<ModifyServerBuildResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<ModifyServerBuildResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::RefundPurchase(
         RefundPurchaseRequest& request,
-        const ProcessApiCallback<RefundPurchaseResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<RefundPurchaseResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<RefundPurchaseResponse>(
             "/Admin/RefundPurchase",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnRefundPurchaseResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<RefundPurchaseResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnRefundPurchaseResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnRefundPurchaseResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        RefundPurchaseResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<RefundPurchaseResponse> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<RefundPurchaseResponse>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::RemovePlayerTag(
         RemovePlayerTagRequest& request,
-        const ProcessApiCallback<RemovePlayerTagResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<RemovePlayerTagResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<RemovePlayerTagResult>(
             "/Admin/RemovePlayerTag",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnRemovePlayerTagResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<RemovePlayerTagResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnRemovePlayerTagResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnRemovePlayerTagResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        RemovePlayerTagResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<RemovePlayerTagResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
-    }
+        PlayFabApiDispatch::OnApiResult<RemovePlayerTagResult>(httpCode, result, reqContainer);
+    }
 
     void PlayFabAdminInstanceAPI::RemoveServerBuild(
         RemoveServerBuildRequest& request,
-        const ProcessApiCallback<RemoveServerBuildResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<RemoveServerBuildResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<RemoveServerBuildResult>(
             "/Admin/RemoveServerBuild",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnRemoveServerBuildResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<RemoveServerBuildResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnRemoveServerBuildResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnRemoveServerBuildResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        RemoveServerBuildResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<RemoveServerBuildResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<RemoveServerBuildResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::RemoveVirtualCurrencyTypes(
         RemoveVirtualCurrencyTypesRequest& request,
-        const ProcessApiCallback<BlankResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<BlankResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<BlankResult>(
             "/Admin/RemoveVirtualCurrencyTypes",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnRemoveVirtualCurrencyTypesResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<BlankResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnRemoveVirtualCurrencyTypesResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnRemoveVirtualCurrencyTypesResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        BlankResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<BlankResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<BlankResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::ResetCharacterStatistics(
         ResetCharacterStatisticsRequest& request,
-        const ProcessApiCallback<ResetCharacterStatisticsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ResetCharacterStatisticsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ResetCharacterStatisticsResult>(
             "/Admin/ResetCharacterStatistics",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnResetCharacterStatisticsResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ResetCharacterStatisticsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnResetCharacterStatisticsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnResetCharacterStatisticsResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ResetCharacterStatisticsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<ResetCharacterStatisticsResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<ResetCharacterStatisticsResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::ResetPassword(
         ResetPasswordRequest& request,
-        const ProcessApiCallback<ResetPasswordResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ResetPasswordResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ResetPasswordResult>(
             "/Admin/ResetPassword",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnResetPasswordResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ResetPasswordResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnResetPasswordResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnResetPasswordResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ResetPasswordResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<ResetPasswordResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<ResetPasswordResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::ResetUserStatistics(
         ResetUserStatisticsRequest& request,
-        const ProcessApiCallback<ResetUserStatisticsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ResetUserStatisticsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ResetUserStatisticsResult>(
             "/Admin/ResetUserStatistics",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnResetUserStatisticsResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ResetUserStatisticsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnResetUserStatisticsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnResetUserStatisticsResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ResetUserStatisticsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<ResetUserStatisticsResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<ResetUserStatisticsResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::ResolvePurchaseDispute(
         ResolvePurchaseDisputeRequest& request,
-        const ProcessApiCallback<ResolvePurchaseDisputeResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ResolvePurchaseDisputeResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ResolvePurchaseDisputeResponse>(
             "/Admin/ResolvePurchaseDispute",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnResolvePurchaseDisputeResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ResolvePurchaseDisputeResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnResolvePurchaseDisputeResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnResolvePurchaseDisputeResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ResolvePurchaseDisputeResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<ResolvePurchaseDisputeResponse> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<ResolvePurchaseDisputeResponse>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::RevokeAllBansForUser(
         RevokeAllBansForUserRequest& request,
-        const ProcessApiCallback<RevokeAllBansForUserResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<RevokeAllBansForUserResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<RevokeAllBansForUserResult>(
             "/Admin/RevokeAllBansForUser",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnRevokeAllBansForUserResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeAllBansForUserResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnRevokeAllBansForUserResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnRevokeAllBansForUserResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        RevokeAllBansForUserResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<RevokeAllBansForUserResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<RevokeAllBansForUserResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::RevokeBans(
         RevokeBansRequest& request,
-        const ProcessApiCallback<RevokeBansResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<RevokeBansResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<RevokeBansResult>(
             "/Admin/RevokeBans",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnRevokeBansResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeBansResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnRevokeBansResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnRevokeBansResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        RevokeBansResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<RevokeBansResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<RevokeBansResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::RevokeInventoryItem(
         RevokeInventoryItemRequest& request,
-        const ProcessApiCallback<RevokeInventoryResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<RevokeInventoryResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<RevokeInventoryResult>(
             "/Admin/RevokeInventoryItem",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnRevokeInventoryItemResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeInventoryResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnRevokeInventoryItemResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnRevokeInventoryItemResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        RevokeInventoryResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<RevokeInventoryResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<RevokeInventoryResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::RevokeInventoryItems(
         RevokeInventoryItemsRequest& request,
-        const ProcessApiCallback<RevokeInventoryItemsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<RevokeInventoryItemsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<RevokeInventoryItemsResult>(
             "/Admin/RevokeInventoryItems",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnRevokeInventoryItemsResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<RevokeInventoryItemsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnRevokeInventoryItemsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnRevokeInventoryItemsResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        RevokeInventoryItemsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<RevokeInventoryItemsResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<RevokeInventoryItemsResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::RunTask(
         RunTaskRequest& request,
-        const ProcessApiCallback<RunTaskResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<RunTaskResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<RunTaskResult>(
             "/Admin/RunTask",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnRunTaskResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<RunTaskResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnRunTaskResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnRunTaskResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        RunTaskResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<RunTaskResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<RunTaskResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::SendAccountRecoveryEmail(
         SendAccountRecoveryEmailRequest& request,
-        const ProcessApiCallback<SendAccountRecoveryEmailResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<SendAccountRecoveryEmailResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<SendAccountRecoveryEmailResult>(
             "/Admin/SendAccountRecoveryEmail",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnSendAccountRecoveryEmailResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<SendAccountRecoveryEmailResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnSendAccountRecoveryEmailResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnSendAccountRecoveryEmailResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        SendAccountRecoveryEmailResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<SendAccountRecoveryEmailResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<SendAccountRecoveryEmailResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::SetCatalogItems(
         UpdateCatalogItemsRequest& request,
-        const ProcessApiCallback<UpdateCatalogItemsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateCatalogItemsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
-
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateCatalogItemsResult>(
             "/Admin/SetCatalogItems",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnSetCatalogItemsResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCatalogItemsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnSetCatalogItemsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnSetCatalogItemsResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateCatalogItemsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<UpdateCatalogItemsResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<UpdateCatalogItemsResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::SetPlayerSecret(
         SetPlayerSecretRequest& request,
-        const ProcessApiCallback<SetPlayerSecretResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<SetPlayerSecretResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<SetPlayerSecretResult>(
             "/Admin/SetPlayerSecret",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnSetPlayerSecretResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<SetPlayerSecretResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnSetPlayerSecretResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnSetPlayerSecretResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        SetPlayerSecretResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<SetPlayerSecretResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<SetPlayerSecretResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::SetPublishedRevision(
         SetPublishedRevisionRequest& request,
-        const ProcessApiCallback<SetPublishedRevisionResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<SetPublishedRevisionResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
-
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<SetPublishedRevisionResult>(
             "/Admin/SetPublishedRevision",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnSetPublishedRevisionResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<SetPublishedRevisionResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnSetPublishedRevisionResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnSetPublishedRevisionResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        SetPublishedRevisionResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<SetPublishedRevisionResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<SetPublishedRevisionResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::SetPublisherData(
         SetPublisherDataRequest& request,
-        const ProcessApiCallback<SetPublisherDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<SetPublisherDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
-
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<SetPublisherDataResult>(
             "/Admin/SetPublisherData",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnSetPublisherDataResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<SetPublisherDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnSetPublisherDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnSetPublisherDataResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        SetPublisherDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<SetPublisherDataResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<SetPublisherDataResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::SetStoreItems(
         UpdateStoreItemsRequest& request,
-        const ProcessApiCallback<UpdateStoreItemsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateStoreItemsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
-
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateStoreItemsResult>(
             "/Admin/SetStoreItems",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnSetStoreItemsResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateStoreItemsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnSetStoreItemsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnSetStoreItemsResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateStoreItemsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<UpdateStoreItemsResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<UpdateStoreItemsResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::SetTitleData(
         SetTitleDataRequest& request,
-        const ProcessApiCallback<SetTitleDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<SetTitleDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
-
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<SetTitleDataResult>(
             "/Admin/SetTitleData",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnSetTitleDataResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<SetTitleDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnSetTitleDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnSetTitleDataResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        SetTitleDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<SetTitleDataResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<SetTitleDataResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::SetTitleDataAndOverrides(
         SetTitleDataAndOverridesRequest& request,
-        const ProcessApiCallback<SetTitleDataAndOverridesResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<SetTitleDataAndOverridesResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<SetTitleDataAndOverridesResult>(
             "/Admin/SetTitleDataAndOverrides",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnSetTitleDataAndOverridesResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<SetTitleDataAndOverridesResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnSetTitleDataAndOverridesResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnSetTitleDataAndOverridesResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        SetTitleDataAndOverridesResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<SetTitleDataAndOverridesResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<SetTitleDataAndOverridesResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::SetTitleInternalData(
         SetTitleDataRequest& request,
-        const ProcessApiCallback<SetTitleDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<SetTitleDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<SetTitleDataResult>(
             "/Admin/SetTitleInternalData",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnSetTitleInternalDataResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<SetTitleDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnSetTitleInternalDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnSetTitleInternalDataResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        SetTitleDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<SetTitleDataResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<SetTitleDataResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::SetupPushNotification(
         SetupPushNotificationRequest& request,
-        const ProcessApiCallback<SetupPushNotificationResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<SetupPushNotificationResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<SetupPushNotificationResult>(
             "/Admin/SetupPushNotification",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnSetupPushNotificationResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<SetupPushNotificationResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnSetupPushNotificationResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnSetupPushNotificationResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        SetupPushNotificationResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<SetupPushNotificationResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<SetupPushNotificationResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::SubtractUserVirtualCurrency(
         SubtractUserVirtualCurrencyRequest& request,
-        const ProcessApiCallback<ModifyUserVirtualCurrencyResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ModifyUserVirtualCurrencyResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
-
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ModifyUserVirtualCurrencyResult>(
             "/Admin/SubtractUserVirtualCurrency",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnSubtractUserVirtualCurrencyResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyUserVirtualCurrencyResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnSubtractUserVirtualCurrencyResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnSubtractUserVirtualCurrencyResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ModifyUserVirtualCurrencyResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<ModifyUserVirtualCurrencyResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<ModifyUserVirtualCurrencyResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::UpdateBans(
         UpdateBansRequest& request,
-        const ProcessApiCallback<UpdateBansResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateBansResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateBansResult>(
             "/Admin/UpdateBans",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnUpdateBansResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateBansResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnUpdateBansResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnUpdateBansResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateBansResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<UpdateBansResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<UpdateBansResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::UpdateCatalogItems(
         UpdateCatalogItemsRequest& request,
-        const ProcessApiCallback<UpdateCatalogItemsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateCatalogItemsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateCatalogItemsResult>(
             "/Admin/UpdateCatalogItems",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnUpdateCatalogItemsResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCatalogItemsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnUpdateCatalogItemsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnUpdateCatalogItemsResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateCatalogItemsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<UpdateCatalogItemsResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<UpdateCatalogItemsResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::UpdateCloudScript(
         UpdateCloudScriptRequest& request,
-        const ProcessApiCallback<UpdateCloudScriptResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateCloudScriptResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateCloudScriptResult>(
             "/Admin/UpdateCloudScript",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnUpdateCloudScriptResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCloudScriptResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnUpdateCloudScriptResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnUpdateCloudScriptResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateCloudScriptResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<UpdateCloudScriptResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<UpdateCloudScriptResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::UpdateOpenIdConnection(
         UpdateOpenIdConnectionRequest& request,
-        const ProcessApiCallback<EmptyResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<EmptyResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<EmptyResponse>(
             "/Admin/UpdateOpenIdConnection",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnUpdateOpenIdConnectionResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnUpdateOpenIdConnectionResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnUpdateOpenIdConnectionResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        EmptyResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<EmptyResponse> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<EmptyResponse>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::UpdatePlayerSharedSecret(
         UpdatePlayerSharedSecretRequest& request,
-        const ProcessApiCallback<UpdatePlayerSharedSecretResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdatePlayerSharedSecretResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdatePlayerSharedSecretResult>(
             "/Admin/UpdatePlayerSharedSecret",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnUpdatePlayerSharedSecretResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdatePlayerSharedSecretResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnUpdatePlayerSharedSecretResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnUpdatePlayerSharedSecretResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdatePlayerSharedSecretResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<UpdatePlayerSharedSecretResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<UpdatePlayerSharedSecretResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::UpdatePlayerStatisticDefinition(
         UpdatePlayerStatisticDefinitionRequest& request,
-        const ProcessApiCallback<UpdatePlayerStatisticDefinitionResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdatePlayerStatisticDefinitionResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdatePlayerStatisticDefinitionResult>(
             "/Admin/UpdatePlayerStatisticDefinition",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnUpdatePlayerStatisticDefinitionResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdatePlayerStatisticDefinitionResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnUpdatePlayerStatisticDefinitionResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnUpdatePlayerStatisticDefinitionResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdatePlayerStatisticDefinitionResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<UpdatePlayerStatisticDefinitionResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<UpdatePlayerStatisticDefinitionResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::UpdatePolicy(
         UpdatePolicyRequest& request,
-        const ProcessApiCallback<UpdatePolicyResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdatePolicyResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdatePolicyResponse>(
             "/Admin/UpdatePolicy",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnUpdatePolicyResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdatePolicyResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnUpdatePolicyResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnUpdatePolicyResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdatePolicyResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<UpdatePolicyResponse> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<UpdatePolicyResponse>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::UpdateRandomResultTables(
         UpdateRandomResultTablesRequest& request,
-        const ProcessApiCallback<UpdateRandomResultTablesResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateRandomResultTablesResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateRandomResultTablesResult>(
             "/Admin/UpdateRandomResultTables",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnUpdateRandomResultTablesResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateRandomResultTablesResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnUpdateRandomResultTablesResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnUpdateRandomResultTablesResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateRandomResultTablesResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<UpdateRandomResultTablesResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<UpdateRandomResultTablesResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::UpdateSegment(
         UpdateSegmentRequest& request,
-        const ProcessApiCallback<UpdateSegmentResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateSegmentResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateSegmentResponse>(
             "/Admin/UpdateSegment",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnUpdateSegmentResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateSegmentResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnUpdateSegmentResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnUpdateSegmentResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateSegmentResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<UpdateSegmentResponse> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<UpdateSegmentResponse>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::UpdateStoreItems(
         UpdateStoreItemsRequest& request,
-        const ProcessApiCallback<UpdateStoreItemsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateStoreItemsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateStoreItemsResult>(
             "/Admin/UpdateStoreItems",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnUpdateStoreItemsResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateStoreItemsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnUpdateStoreItemsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnUpdateStoreItemsResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateStoreItemsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<UpdateStoreItemsResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<UpdateStoreItemsResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::UpdateTask(
         UpdateTaskRequest& request,
-        const ProcessApiCallback<EmptyResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<EmptyResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<EmptyResponse>(
             "/Admin/UpdateTask",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnUpdateTaskResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnUpdateTaskResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnUpdateTaskResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        EmptyResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<EmptyResponse> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<EmptyResponse>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::UpdateUserData(
         UpdateUserDataRequest& request,
-        const ProcessApiCallback<UpdateUserDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateUserDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateUserDataResult>(
             "/Admin/UpdateUserData",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnUpdateUserDataResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnUpdateUserDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnUpdateUserDataResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateUserDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<UpdateUserDataResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<UpdateUserDataResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::UpdateUserInternalData(
         UpdateUserInternalDataRequest& request,
-        const ProcessApiCallback<UpdateUserDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateUserDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateUserDataResult>(
             "/Admin/UpdateUserInternalData",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnUpdateUserInternalDataResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnUpdateUserInternalDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnUpdateUserInternalDataResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateUserDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<UpdateUserDataResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<UpdateUserDataResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::UpdateUserPublisherData(
         UpdateUserDataRequest& request,
-        const ProcessApiCallback<UpdateUserDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateUserDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateUserDataResult>(
             "/Admin/UpdateUserPublisherData",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnUpdateUserPublisherDataResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnUpdateUserPublisherDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnUpdateUserPublisherDataResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateUserDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<UpdateUserDataResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<UpdateUserDataResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::UpdateUserPublisherInternalData(
         UpdateUserInternalDataRequest& request,
-        const ProcessApiCallback<UpdateUserDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateUserDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateUserDataResult>(
             "/Admin/UpdateUserPublisherInternalData",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnUpdateUserPublisherInternalDataResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnUpdateUserPublisherInternalDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnUpdateUserPublisherInternalDataResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateUserDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<UpdateUserDataResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<UpdateUserDataResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::UpdateUserPublisherReadOnlyData(
         UpdateUserDataRequest& request,
-        const ProcessApiCallback<UpdateUserDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateUserDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateUserDataResult>(
             "/Admin/UpdateUserPublisherReadOnlyData",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnUpdateUserPublisherReadOnlyDataResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnUpdateUserPublisherReadOnlyDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnUpdateUserPublisherReadOnlyDataResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateUserDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<UpdateUserDataResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<UpdateUserDataResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::UpdateUserReadOnlyData(
         UpdateUserDataRequest& request,
-        const ProcessApiCallback<UpdateUserDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateUserDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateUserDataResult>(
             "/Admin/UpdateUserReadOnlyData",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnUpdateUserReadOnlyDataResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnUpdateUserReadOnlyDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnUpdateUserReadOnlyDataResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateUserDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<UpdateUserDataResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<UpdateUserDataResult>(httpCode, result, reqContainer);
     }
 
     void PlayFabAdminInstanceAPI::UpdateUserTitleDisplayName(
         UpdateUserTitleDisplayNameRequest& request,
-        const ProcessApiCallback<UpdateUserTitleDisplayNameResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateUserTitleDisplayNameResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-SecretKey", settings->developerSecretKey);
-
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateUserTitleDisplayNameResult>(
             "/Admin/UpdateUserTitleDisplayName",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAdminInstanceAPI::OnUpdateUserTitleDisplayNameResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
+    }
+
+    void PlayFabAdminInstanceAPI::OnUpdateUserTitleDisplayNameResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    {
+        PlayFabApiDispatch::OnApiResult<UpdateUserTitleDisplayNameResult>(httpCode, result, reqContainer);
+    }
+
+    void PlayFabAdminInstanceAPI::GetTitleDataLazy(
+        GetTitleDataRequest& request,
+        ProcessApiCallback<PlayFabLazyResult<GetTitleDataResult>> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
+    {
+        std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
+        std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserTitleDisplayNameResult>(callback));
-        reqContainer->errorCallback = errorCallback;
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+        PlayFabApiDispatch::MakeApiCall<PlayFabLazyResult<GetTitleDataResult>>(
+            "/Admin/GetTitleData",
+            request,
+            std::move(headers),
+            [this](int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& container) { OnGetTitleDataLazyResult(httpCode, result, container); },
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAdminInstanceAPI::OnUpdateUserTitleDisplayNameResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAdminInstanceAPI::OnGetTitleDataLazyResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
         CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
 
-        UpdateUserTitleDisplayNameResult outResult;
-        if (ValidateResult(outResult, container))
+        if (PlayFabLazyResultBase::ValidateResult(container))
         {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
+            const ProcessApiCallback<PlayFabLazyResult<GetTitleDataResult>>* callback = container.successCallback.Get<PlayFabLazyResult<GetTitleDataResult>>();
+            if (callback != nullptr)
             {
-                const auto& callback = *static_cast<ProcessApiCallback<UpdateUserTitleDisplayNameResult> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
+                (*callback)(PlayFabLazyResult<GetTitleDataResult>(container), container.GetCustomData());
             }
         }
     }
 
-    bool PlayFabAdminInstanceAPI::ValidateResult(PlayFabResultCommon& resultCommon, const CallRequestContainer& container)
+    void PlayFabAdminInstanceAPI::GetPlayersInSegmentLazy(
+        GetPlayersInSegmentRequest& request,
+        ProcessApiCallback<PlayFabLazyResult<GetPlayersInSegmentResult>> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
-        if (container.errorWrapper.HttpCode == 200)
-        {
-            resultCommon.FromJson(container.errorWrapper.Data);
-            resultCommon.Request = container.errorWrapper.Request;
-            return true;
-        }
-        else // Process the error case
-        {
-            if (PlayFabSettings::globalErrorHandler != nullptr)
-            {
-                PlayFabSettings::globalErrorHandler(container.errorWrapper, container.GetCustomData());
-            }
+        std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
+        std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
+
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
 
-            if (container.errorCallback != nullptr)
+        PlayFabApiDispatch::MakeApiCall<PlayFabLazyResult<GetPlayersInSegmentResult>>(
+            "/Admin/GetPlayersInSegment",
+            request,
+            std::move(headers),
+            [this](int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& container) { OnGetPlayersInSegmentLazyResult(httpCode, result, container); },
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
+    }
+
+    void PlayFabAdminInstanceAPI::OnGetPlayersInSegmentLazyResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    {
+        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
+
+        if (PlayFabLazyResultBase::ValidateResult(container))
+        {
+            const ProcessApiCallback<PlayFabLazyResult<GetPlayersInSegmentResult>>* callback = container.successCallback.Get<PlayFabLazyResult<GetPlayersInSegmentResult>>();
+            if (callback != nullptr)
             {
-                container.errorCallback(container.errorWrapper, container.GetCustomData());
+                (*callback)(PlayFabLazyResult<GetPlayersInSegmentResult>(container), container.GetCustomData());
             }
-            return false;
         }
     }
+
+    bool PlayFabAdminInstanceAPI::ValidateResult(PlayFabResultCommon& resultCommon, const CallRequestContainer& container)
+    {
+        return PlayFabApiDispatch::ValidateResult(resultCommon, container);
+    }
 }
 
 #endif
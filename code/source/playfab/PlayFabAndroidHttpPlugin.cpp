@@ -5,6 +5,7 @@
 
 #include <playfab/PlayFabAndroidHttpPlugin.h>
 #include <playfab/PlayFabSettings.h>
+#include <playfab/PlayFabJsonUtils.h>
 #include <stdexcept>
 #include <vector>
 
@@ -463,17 +464,9 @@ namespace PlayFab
         SetPredefinedHeaders(requestTask);
 
         // Call SetHeader
-        const std::unordered_map<std::string, std::string> headers = requestContainer.GetRequestHeaders();
-
-        if (!headers.empty())
+        for (const PlayFabRequestHeaders::Header& header : requestContainer.GetRequestHeaders())
         {
-            for (auto const &obj : headers)
-            {
-                if (obj.first.length() != 0 && obj.second.length() != 0) // no empty keys or values in headers
-                {
-                    SetHeader(requestTask, obj.first.c_str(), obj.second.c_str());
-                }
-            }
+            SetHeader(requestTask, header.GetName(), header.GetValue());
         }
 
         // Call SetBody
@@ -484,7 +477,6 @@ namespace PlayFab
                 return false;
             }
 
-            std::string requestBody;
             size_t payloadSize = 0;
             void* payload = nullptr;
             jbyteArray bodyArray = nullptr;
@@ -492,7 +484,7 @@ namespace PlayFab
             if (!GetBinaryPayload(requestTask, payload, payloadSize))
             {
                 // set string payload if binary wasn't provided
-                requestBody = requestContainer.GetRequestBody();
+                const std::string& requestBody = requestContainer.GetRequestBody();
                 payloadSize = (size_t)requestBody.size();
                 payload = (void*)requestBody.c_str();
             }
@@ -676,21 +668,13 @@ namespace PlayFab
     void PlayFabAndroidHttpPlugin::ProcessResponse(RequestTask& requestTask, const int httpCode)
     {
         CallRequestContainer& requestContainer = requestTask.RequestContainer();
-        Json::CharReaderBuilder jsonReaderFactory;
-        std::unique_ptr<Json::CharReader> jsonReader(jsonReaderFactory.newCharReader());
-        JSONCPP_STRING jsonParseErrors;
-        const bool parsedSuccessfully = jsonReader->parse(requestContainer.responseString.c_str(), requestContainer.responseString.c_str() + requestContainer.responseString.length(), &requestContainer.responseJson, &jsonParseErrors);
+        std::string jsonParseErrors;
+        const bool parsedSuccessfully = PlayFabJsonUtils::ParseFromString(requestContainer.responseString, requestContainer.responseJson, jsonParseErrors);
 
         if (parsedSuccessfully)
         {
             // fully successful response
-            requestContainer.errorWrapper.HttpCode = requestContainer.responseJson.get("code", Json::Value::null).asInt();
-            requestContainer.errorWrapper.HttpStatus = requestContainer.responseJson.get("status", Json::Value::null).asString();
-            requestContainer.errorWrapper.Data = requestContainer.responseJson.get("data", Json::Value::null);
-            requestContainer.errorWrapper.ErrorName = requestContainer.responseJson.get("error", Json::Value::null).asString();
-            requestContainer.errorWrapper.ErrorCode = static_cast<PlayFabErrorCode>(requestContainer.responseJson.get("errorCode", Json::Value::null).asInt());
-            requestContainer.errorWrapper.ErrorMessage = requestContainer.responseJson.get("errorMessage", Json::Value::null).asString();
-            requestContainer.errorWrapper.ErrorDetails = requestContainer.responseJson.get("errorDetails", Json::Value::null);
+            requestContainer.ProcessResponseJson();
         }
         else
         {
@@ -0,0 +1,94 @@
+#include <stdafx.h>
+
+#include <playfab/PlayFabApiDispatch.h>
+#include <playfab/PlayFabJsonUtils.h>
+#include <playfab/PlayFabPluginManager.h>
+#include <playfab/PlayFabSettings.h>
+
+namespace PlayFab
+{
+    bool PlayFabApiDispatch::ValidateResult(PlayFabResultCommon& resultCommon, CallRequestContainer& container)
+    {
+        container.ReleaseRequestBody();
+        if (container.errorWrapper.HttpCode == 200)
+        {
+            resultCommon.FromJson(container.GetResultData());
+            resultCommon.Request.swap(container.errorWrapper.Request);
+            return true;
+        }
+        else // Process the error case
+        {
+            ReportError(container);
+            return false;
+        }
+    }
+
+    bool PlayFabApiDispatch::ValidateResult(PlayFabResultCommon& resultCommon, const CallRequestContainer& container)
+    {
+        if (container.errorWrapper.HttpCode == 200)
+        {
+            resultCommon.FromJson(container.GetResultData());
+            resultCommon.Request = container.errorWrapper.Request;
+            return true;
+        }
+        else // Process the error case
+        {
+            ReportError(container);
+            return false;
+        }
+    }
+
+    std::unique_ptr<CallRequestContainer> PlayFabApiDispatch::CreateRequestContainer(
+        const char* urlPath,
+        const PlayFabBaseModel& request,
+        PlayFabRequestHeaders&& headers,
+        CallRequestContainerCallback&& resultHandler,
+        ErrorCallback&& errorCallback,
+        std::shared_ptr<PlayFabApiSettings>&& settings,
+        std::shared_ptr<PlayFabAuthenticationContext>&& context,
+        void* customData)
+    {
+        const Json::Value requestJson = request.ToJson();
+        return CreateRequestContainer(urlPath, PlayFabJsonUtils::WriteToString(requestJson), std::move(headers), std::move(resultHandler), std::move(errorCallback), std::move(settings), std::move(context), customData);
+    }
+
+    std::unique_ptr<CallRequestContainer> PlayFabApiDispatch::CreateRequestContainer(
+        const char* urlPath,
+        std::string&& requestBody,
+        PlayFabRequestHeaders&& headers,
+        CallRequestContainerCallback&& resultHandler,
+        ErrorCallback&& errorCallback,
+        std::shared_ptr<PlayFabApiSettings>&& settings,
+        std::shared_ptr<PlayFabAuthenticationContext>&& context,
+        void* customData)
+    {
+        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+            urlPath,
+            std::move(headers),
+            std::move(requestBody),
+            std::move(resultHandler),
+            std::move(settings),
+            std::move(context),
+            customData));
+        reqContainer->errorCallback = std::move(errorCallback);
+        return reqContainer;
+    }
+
+    void PlayFabApiDispatch::SendRequest(std::unique_ptr<CallRequestContainer> reqContainer)
+    {
+        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
+        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+    }
+
+    void PlayFabApiDispatch::ReportError(const CallRequestContainer& container)
+    {
+        if (PlayFabSettings::globalErrorHandler != nullptr)
+        {
+            PlayFabSettings::globalErrorHandler(container.errorWrapper, container.GetCustomData());
+        }
+        if (container.errorCallback != nullptr)
+        {
+            container.errorCallback(container.errorWrapper, container.GetCustomData());
+        }
+    }
+}
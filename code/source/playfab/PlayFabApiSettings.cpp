@@ -5,45 +5,114 @@
 
 namespace PlayFab
 {
-    PlayFabApiSettings::PlayFabApiSettings() :
-        baseServiceHost(PlayFabSettings::productionEnvironmentURL)
+    PlayFabApiSettings::PlayFabApiSettings()
     {
-        requestGetParams["sdk"] = PlayFabSettings::versionString;
+        std::shared_ptr<UrlParts> parts = std::make_shared<UrlParts>();
+        parts->baseServiceHost = PlayFabSettings::productionEnvironmentURL;
+        parts->requestGetParams["sdk"] = PlayFabSettings::versionString;
 
         // Don't let PlayFabSettings::staticSettings pull titleId from itself
         if (PlayFabSettings::staticSettings != nullptr)
         {
-            titleId = PlayFabSettings::staticSettings->titleId;
+            parts->titleId = PlayFabSettings::staticSettings->GetTitleId();
         }
+
+        PublishUrlParts(std::move(parts));
+    }
+
+    std::string PlayFabApiSettings::GetTitleId() const
+    {
+        return std::atomic_load(&urlParts)->titleId;
+    }
+
+    void PlayFabApiSettings::SetTitleId(const std::string& titleId)
+    {
+        std::unique_lock<std::mutex> lock(settersMutex);
+        std::shared_ptr<UrlParts> parts = std::make_shared<UrlParts>(*std::atomic_load(&urlParts));
+        parts->titleId = titleId;
+        PublishUrlParts(std::move(parts));
+    }
+
+    std::string PlayFabApiSettings::GetBaseServiceHost() const
+    {
+        return std::atomic_load(&urlParts)->baseServiceHost;
+    }
+
+    void PlayFabApiSettings::SetBaseServiceHost(const std::string& baseServiceHost)
+    {
+        std::unique_lock<std::mutex> lock(settersMutex);
+        std::shared_ptr<UrlParts> parts = std::make_shared<UrlParts>(*std::atomic_load(&urlParts));
+        parts->baseServiceHost = baseServiceHost;
+        PublishUrlParts(std::move(parts));
+    }
+
+    std::map<std::string, std::string> PlayFabApiSettings::GetRequestGetParams() const
+    {
+        return std::atomic_load(&urlParts)->requestGetParams;
+    }
+
+    void PlayFabApiSettings::SetRequestGetParams(const std::map<std::string, std::string>& requestGetParams)
+    {
+        std::unique_lock<std::mutex> lock(settersMutex);
+        std::shared_ptr<UrlParts> parts = std::make_shared<UrlParts>(*std::atomic_load(&urlParts));
+        parts->requestGetParams = requestGetParams;
+        PublishUrlParts(std::move(parts));
+    }
+
+    void PlayFabApiSettings::SetRequestGetParam(const std::string& key, const std::string& value)
+    {
+        std::unique_lock<std::mutex> lock(settersMutex);
+        std::shared_ptr<UrlParts> parts = std::make_shared<UrlParts>(*std::atomic_load(&urlParts));
+        parts->requestGetParams[key] = value;
+        PublishUrlParts(std::move(parts));
+    }
+
+    void PlayFabApiSettings::RemoveRequestGetParam(const std::string& key)
+    {
+        std::unique_lock<std::mutex> lock(settersMutex);
+        std::shared_ptr<UrlParts> parts = std::make_shared<UrlParts>(*std::atomic_load(&urlParts));
+        parts->requestGetParams.erase(key);
+        PublishUrlParts(std::move(parts));
     }
 
     std::string PlayFabApiSettings::GetUrl(const std::string& urlPath) const
     {
-        std::string fullUrl;
-        fullUrl.reserve(1000);
+        const std::shared_ptr<const UrlParts> parts = std::atomic_load(&urlParts);
 
-        fullUrl += "https://";
-        fullUrl += titleId;
-        fullUrl += baseServiceHost;
+        std::string fullUrl;
+        fullUrl.reserve(parts->prefix.length() + urlPath.length() + parts->suffix.length());
+        fullUrl += parts->prefix;
         fullUrl += urlPath;
+        fullUrl += parts->suffix;
+        return fullUrl;
+    }
+
+    void PlayFabApiSettings::PublishUrlParts(std::shared_ptr<UrlParts> parts)
+    {
+        parts->prefix.clear();
+        parts->prefix.reserve(8 + parts->titleId.length() + parts->baseServiceHost.length());
+        parts->prefix += "https://";
+        parts->prefix += parts->titleId;
+        parts->prefix += parts->baseServiceHost;
 
+        parts->suffix.clear();
         bool firstParam = true;
-        for (auto const& paramPair : requestGetParams)
+        for (auto const& paramPair : parts->requestGetParams)
         {
             if (firstParam)
             {
-                fullUrl += "?";
+                parts->suffix += "?";
                 firstParam = false;
             }
             else
             {
-                fullUrl += "&";
+                parts->suffix += "&";
             }
-            fullUrl += paramPair.first;
-            fullUrl += "=";
-            fullUrl += paramPair.second;
+            parts->suffix += paramPair.first;
+            parts->suffix += "=";
+            parts->suffix += paramPair.second;
         }
 
-        return fullUrl;
+        std::atomic_store(&urlParts, std::shared_ptr<const UrlParts>(std::move(parts)));
     }
 }
@@ -3,7 +3,9 @@
 #if !defined(DISABLE_PLAYFABENTITY_API)
 
 #include <playfab/PlayFabAuthenticationApi.h>
+#include <playfab/PlayFabAuthenticationDataModels.h>
 #include <playfab/PlayFabPluginManager.h>
+#include <playfab/PlayFabApiDispatch.h>
 #include <playfab/PlayFabSettings.h>
 #include <playfab/PlayFabError.h>
 #include <memory>
@@ -31,49 +33,40 @@ namespace PlayFab
 
     void PlayFabAuthenticationAPI::GetEntityToken(
         GetEntityTokenRequest& request,
-        const ProcessApiCallback<GetEntityTokenResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetEntityTokenResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
-        std::string authKey, authValue;
+
+        PlayFabRequestHeaders headers;
         if (context->entityToken.length() > 0)
         {
-            authKey = "X-EntityToken"; authValue = context->entityToken;
+            headers.Set(PlayFabRequestHeaderKey::EntityToken, context->entityToken);
         }
         else if (context->clientSessionTicket.length() > 0)
         {
-            authKey = "X-Authorization"; authValue = context->clientSessionTicket;
+            headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
         }
 #if defined(ENABLE_PLAYFABSERVER_API) || defined(ENABLE_PLAYFABADMIN_API)
         else if (settings->developerSecretKey.length() > 0)
         {
-            authKey = "X-SecretKey"; authValue = settings->developerSecretKey;
+            headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
         }
 #endif
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace(authKey, authValue);
-
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetEntityTokenResponse>(
             "/Authentication/GetEntityToken",
-            headers,
-            jsonAsString,
+            request,
+            std::move(headers),
             OnGetEntityTokenResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetEntityTokenResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAuthenticationAPI::OnGetEntityTokenResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
@@ -82,87 +75,39 @@ namespace PlayFab
         std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
 
         GetEntityTokenResponse outResult;
-        if (ValidateResult(outResult, container))
+        if (PlayFabApiDispatch::ValidateResult(outResult, container))
         {            context->HandlePlayFabLogin("", "", outResult.Entity->Id, outResult.Entity->Type, outResult.EntityToken);
 
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
+            const ProcessApiCallback<GetEntityTokenResponse>* callback = container.successCallback.Get<GetEntityTokenResponse>();
+            if (callback != nullptr)
             {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetEntityTokenResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
+                (*callback)(outResult, container.GetCustomData());
             }
         }
     }
 
     void PlayFabAuthenticationAPI::ValidateEntityToken(
         ValidateEntityTokenRequest& request,
-        const ProcessApiCallback<ValidateEntityTokenResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ValidateEntityTokenResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-EntityToken", context->entityToken);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::EntityToken, context->entityToken);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ValidateEntityTokenResponse>(
             "/Authentication/ValidateEntityToken",
-            headers,
-            jsonAsString,
-            OnValidateEntityTokenResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ValidateEntityTokenResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabAuthenticationAPI::OnValidateEntityTokenResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ValidateEntityTokenResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<ValidateEntityTokenResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
-    }
-
-    bool PlayFabAuthenticationAPI::ValidateResult(PlayFabResultCommon& resultCommon, const CallRequestContainer& container)
-    {
-        if (container.errorWrapper.HttpCode == 200)
-        {
-            resultCommon.FromJson(container.errorWrapper.Data);
-            resultCommon.Request = container.errorWrapper.Request;
-            return true;
-        }
-        else // Process the error case
-        {
-            if (PlayFabSettings::globalErrorHandler != nullptr)
-            {
-                PlayFabSettings::globalErrorHandler(container.errorWrapper, container.GetCustomData());
-            }
-            if (container.errorCallback != nullptr)
-            {
-                container.errorCallback(container.errorWrapper, container.GetCustomData());
-            }
-            return false;
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 }
 
@@ -0,0 +1,397 @@
+#include <stdafx.h>
+
+#if !defined(DISABLE_PLAYFABENTITY_API)
+
+#include <playfab/PlayFabAuthenticationDataModels.h>
+
+namespace PlayFab
+{
+    namespace AuthenticationModels
+    {
+        namespace
+        {
+            // The json field names of the models below
+            constexpr PlayFabJsonKey keyCharacterId("CharacterId");
+            constexpr PlayFabJsonKey keyCustomTags("CustomTags");
+            constexpr PlayFabJsonKey keyEntity("Entity");
+            constexpr PlayFabJsonKey keyEntityToken("EntityToken");
+            constexpr PlayFabJsonKey keyGroupId("GroupId");
+            constexpr PlayFabJsonKey keyId("Id");
+            constexpr PlayFabJsonKey keyIdentifiedDeviceType("IdentifiedDeviceType");
+            constexpr PlayFabJsonKey keyIdentityProvider("IdentityProvider");
+            constexpr PlayFabJsonKey keyLineage("Lineage");
+            constexpr PlayFabJsonKey keyMasterPlayerAccountId("MasterPlayerAccountId");
+            constexpr PlayFabJsonKey keyNamespaceId("NamespaceId");
+            constexpr PlayFabJsonKey keyTitleId("TitleId");
+            constexpr PlayFabJsonKey keyTitlePlayerAccountId("TitlePlayerAccountId");
+            constexpr PlayFabJsonKey keyTokenExpiration("TokenExpiration");
+            constexpr PlayFabJsonKey keyType("Type");
+        }
+
+        void ToJsonEnum(const IdentifiedDeviceType input, Json::Value& output)
+        {
+            if (input == IdentifiedDeviceType::IdentifiedDeviceTypeUnknown)
+            {
+                output = Json::Value(Json::StaticString("Unknown"));
+                return;
+            }
+            if (input == IdentifiedDeviceType::IdentifiedDeviceTypeXboxOne)
+            {
+                output = Json::Value(Json::StaticString("XboxOne"));
+                return;
+            }
+            if (input == IdentifiedDeviceType::IdentifiedDeviceTypeScarlett)
+            {
+                output = Json::Value(Json::StaticString("Scarlett"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, IdentifiedDeviceType& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Unknown")
+            {
+                output = IdentifiedDeviceType::IdentifiedDeviceTypeUnknown;
+                return;
+            }
+            if (inputStr == "XboxOne")
+            {
+                output = IdentifiedDeviceType::IdentifiedDeviceTypeXboxOne;
+                return;
+            }
+            if (inputStr == "Scarlett")
+            {
+                output = IdentifiedDeviceType::IdentifiedDeviceTypeScarlett;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const LoginIdentityProvider input, Json::Value& output)
+        {
+            if (input == LoginIdentityProvider::LoginIdentityProviderUnknown)
+            {
+                output = Json::Value(Json::StaticString("Unknown"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderPlayFab)
+            {
+                output = Json::Value(Json::StaticString("PlayFab"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderCustom)
+            {
+                output = Json::Value(Json::StaticString("Custom"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderGameCenter)
+            {
+                output = Json::Value(Json::StaticString("GameCenter"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderGooglePlay)
+            {
+                output = Json::Value(Json::StaticString("GooglePlay"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderSteam)
+            {
+                output = Json::Value(Json::StaticString("Steam"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderXBoxLive)
+            {
+                output = Json::Value(Json::StaticString("XBoxLive"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderPSN)
+            {
+                output = Json::Value(Json::StaticString("PSN"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderKongregate)
+            {
+                output = Json::Value(Json::StaticString("Kongregate"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderFacebook)
+            {
+                output = Json::Value(Json::StaticString("Facebook"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderIOSDevice)
+            {
+                output = Json::Value(Json::StaticString("IOSDevice"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderAndroidDevice)
+            {
+                output = Json::Value(Json::StaticString("AndroidDevice"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderTwitch)
+            {
+                output = Json::Value(Json::StaticString("Twitch"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderWindowsHello)
+            {
+                output = Json::Value(Json::StaticString("WindowsHello"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderGameServer)
+            {
+                output = Json::Value(Json::StaticString("GameServer"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderCustomServer)
+            {
+                output = Json::Value(Json::StaticString("CustomServer"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderNintendoSwitch)
+            {
+                output = Json::Value(Json::StaticString("NintendoSwitch"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderFacebookInstantGames)
+            {
+                output = Json::Value(Json::StaticString("FacebookInstantGames"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderOpenIdConnect)
+            {
+                output = Json::Value(Json::StaticString("OpenIdConnect"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderApple)
+            {
+                output = Json::Value(Json::StaticString("Apple"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderNintendoSwitchAccount)
+            {
+                output = Json::Value(Json::StaticString("NintendoSwitchAccount"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, LoginIdentityProvider& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Unknown")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderUnknown;
+                return;
+            }
+            if (inputStr == "PlayFab")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderPlayFab;
+                return;
+            }
+            if (inputStr == "Custom")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderCustom;
+                return;
+            }
+            if (inputStr == "GameCenter")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderGameCenter;
+                return;
+            }
+            if (inputStr == "GooglePlay")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderGooglePlay;
+                return;
+            }
+            if (inputStr == "Steam")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderSteam;
+                return;
+            }
+            if (inputStr == "XBoxLive")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderXBoxLive;
+                return;
+            }
+            if (inputStr == "PSN")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderPSN;
+                return;
+            }
+            if (inputStr == "Kongregate")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderKongregate;
+                return;
+            }
+            if (inputStr == "Facebook")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderFacebook;
+                return;
+            }
+            if (inputStr == "IOSDevice")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderIOSDevice;
+                return;
+            }
+            if (inputStr == "AndroidDevice")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderAndroidDevice;
+                return;
+            }
+            if (inputStr == "Twitch")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderTwitch;
+                return;
+            }
+            if (inputStr == "WindowsHello")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderWindowsHello;
+                return;
+            }
+            if (inputStr == "GameServer")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderGameServer;
+                return;
+            }
+            if (inputStr == "CustomServer")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderCustomServer;
+                return;
+            }
+            if (inputStr == "NintendoSwitch")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderNintendoSwitch;
+                return;
+            }
+            if (inputStr == "FacebookInstantGames")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderFacebookInstantGames;
+                return;
+            }
+            if (inputStr == "OpenIdConnect")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderOpenIdConnect;
+                return;
+            }
+            if (inputStr == "Apple")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderApple;
+                return;
+            }
+            if (inputStr == "NintendoSwitchAccount")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderNintendoSwitchAccount;
+                return;
+            }
+        }
+
+        void EntityKey::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyId), Id);
+            FromJsonUtilS(FromJsonField(input, keyType), Type);
+        }
+
+        Json::Value EntityKey::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Id; ToJsonUtilS(Id, each_Id); ToJsonField(output, keyId) = each_Id;
+            Json::Value each_Type; ToJsonUtilS(Type, each_Type); ToJsonField(output, keyType) = each_Type;
+            return output;
+        }
+
+        void EntityLineage::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyGroupId), GroupId);
+            FromJsonUtilS(FromJsonField(input, keyMasterPlayerAccountId), MasterPlayerAccountId);
+            FromJsonUtilS(FromJsonField(input, keyNamespaceId), NamespaceId);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+            FromJsonUtilS(FromJsonField(input, keyTitlePlayerAccountId), TitlePlayerAccountId);
+        }
+
+        Json::Value EntityLineage::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_GroupId; ToJsonUtilS(GroupId, each_GroupId); ToJsonField(output, keyGroupId) = each_GroupId;
+            Json::Value each_MasterPlayerAccountId; ToJsonUtilS(MasterPlayerAccountId, each_MasterPlayerAccountId); ToJsonField(output, keyMasterPlayerAccountId) = each_MasterPlayerAccountId;
+            Json::Value each_NamespaceId; ToJsonUtilS(NamespaceId, each_NamespaceId); ToJsonField(output, keyNamespaceId) = each_NamespaceId;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            Json::Value each_TitlePlayerAccountId; ToJsonUtilS(TitlePlayerAccountId, each_TitlePlayerAccountId); ToJsonField(output, keyTitlePlayerAccountId) = each_TitlePlayerAccountId;
+            return output;
+        }
+
+        void GetEntityTokenRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+        }
+
+        Json::Value GetEntityTokenRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            return output;
+        }
+
+        void GetEntityTokenResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilS(FromJsonField(input, keyEntityToken), EntityToken);
+            FromJsonUtilT(FromJsonField(input, keyTokenExpiration), TokenExpiration);
+        }
+
+        Json::Value GetEntityTokenResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_EntityToken; ToJsonUtilS(EntityToken, each_EntityToken); ToJsonField(output, keyEntityToken) = each_EntityToken;
+            Json::Value each_TokenExpiration; ToJsonUtilT(TokenExpiration, each_TokenExpiration); ToJsonField(output, keyTokenExpiration) = each_TokenExpiration;
+            return output;
+        }
+
+        void ValidateEntityTokenRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyEntityToken), EntityToken);
+        }
+
+        Json::Value ValidateEntityTokenRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_EntityToken; ToJsonUtilS(EntityToken, each_EntityToken); ToJsonField(output, keyEntityToken) = each_EntityToken;
+            return output;
+        }
+
+        void ValidateEntityTokenResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilE(FromJsonField(input, keyIdentifiedDeviceType), pfIdentifiedDeviceType);
+            FromJsonUtilE(FromJsonField(input, keyIdentityProvider), IdentityProvider);
+            FromJsonUtilO(FromJsonField(input, keyLineage), Lineage);
+        }
+
+        Json::Value ValidateEntityTokenResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_pfIdentifiedDeviceType; ToJsonUtilE(pfIdentifiedDeviceType, each_pfIdentifiedDeviceType); ToJsonField(output, keyIdentifiedDeviceType) = each_pfIdentifiedDeviceType;
+            Json::Value each_IdentityProvider; ToJsonUtilE(IdentityProvider, each_IdentityProvider); ToJsonField(output, keyIdentityProvider) = each_IdentityProvider;
+            Json::Value each_Lineage; ToJsonUtilO(Lineage, each_Lineage); ToJsonField(output, keyLineage) = each_Lineage;
+            return output;
+        }
+    }
+}
+
+#endif
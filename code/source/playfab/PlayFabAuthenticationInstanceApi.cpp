@@ -3,7 +3,9 @@
 #if !defined(DISABLE_PLAYFABENTITY_API)
 
 #include <playfab/PlayFabAuthenticationInstanceApi.h>
+#include <playfab/PlayFabAuthenticationDataModels.h>
 #include <playfab/PlayFabPluginManager.h>
+#include <playfab/PlayFabApiDispatch.h>
 #include <playfab/PlayFabSettings.h>
 
 #if defined(PLAYFAB_PLATFORM_WINDOWS)
@@ -64,50 +66,40 @@ namespace PlayFab
 
     void PlayFabAuthenticationInstanceAPI::GetEntityToken(
         GetEntityTokenRequest& request,
-        const ProcessApiCallback<GetEntityTokenResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetEntityTokenResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
-        std::string authKey, authValue;
+
+        PlayFabRequestHeaders headers;
         if (context->entityToken.length() > 0)
         {
-            authKey = "X-EntityToken"; authValue = context->entityToken;
+            headers.Set(PlayFabRequestHeaderKey::EntityToken, context->entityToken);
         }
         else if (context->clientSessionTicket.length() > 0)
         {
-            authKey = "X-Authorization"; authValue = context->clientSessionTicket;
+            headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
         }
 #if defined(ENABLE_PLAYFABSERVER_API) || defined(ENABLE_PLAYFABADMIN_API)
         else if (settings->developerSecretKey.length() > 0)
         {
-            authKey = "X-SecretKey"; authValue = settings->developerSecretKey;
+            headers.Set(PlayFabRequestHeaderKey::SecretKey, settings->developerSecretKey);
         }
 #endif
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace(authKey, authValue);
-
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetEntityTokenResponse>(
             "/Authentication/GetEntityToken",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAuthenticationInstanceAPI::OnGetEntityTokenResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetEntityTokenResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            [this](int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& container) { OnGetEntityTokenResult(httpCode, result, container); },
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabAuthenticationInstanceAPI::OnGetEntityTokenResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
@@ -116,89 +108,49 @@ namespace PlayFab
         std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
 
         GetEntityTokenResponse outResult;
-        if (ValidateResult(outResult, container))
+        if (PlayFabApiDispatch::ValidateResult(outResult, container))
         {            context->HandlePlayFabLogin("", "", outResult.Entity->Id, outResult.Entity->Type, outResult.EntityToken);
 
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
+            const ProcessApiCallback<GetEntityTokenResponse>* callback = container.successCallback.Get<GetEntityTokenResponse>();
+            if (callback != nullptr)
             {
-                const auto& callback = *static_cast<ProcessApiCallback<GetEntityTokenResponse> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
+                (*callback)(outResult, container.GetCustomData());
             }
         }
     }
 
     void PlayFabAuthenticationInstanceAPI::ValidateEntityToken(
         ValidateEntityTokenRequest& request,
-        const ProcessApiCallback<ValidateEntityTokenResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ValidateEntityTokenResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : this->m_context;
         std::shared_ptr<PlayFabApiSettings> settings = this->m_settings != nullptr ? this->m_settings : PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::EntityToken, context->entityToken);
 
-        std::shared_ptr<PlayFabAuthenticationContext> authenticationContext = request.authenticationContext == nullptr ? this->m_context : request.authenticationContext;
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-EntityToken", context->entityToken);
-
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ValidateEntityTokenResponse>(
             "/Authentication/ValidateEntityToken",
-            headers,
-            jsonAsString,
-            std::bind(&PlayFabAuthenticationInstanceAPI::OnValidateEntityTokenResult, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ValidateEntityTokenResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabAuthenticationInstanceAPI::OnValidateEntityTokenResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
+    void PlayFabAuthenticationInstanceAPI::OnValidateEntityTokenResult(int httpCode, const std::string& result, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ValidateEntityTokenResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = *static_cast<ProcessApiCallback<ValidateEntityTokenResponse> *>(internalPtr.get());
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::OnApiResult<ValidateEntityTokenResponse>(httpCode, result, reqContainer);
     }
 
     bool PlayFabAuthenticationInstanceAPI::ValidateResult(PlayFabResultCommon& resultCommon, const CallRequestContainer& container)
     {
-        if (container.errorWrapper.HttpCode == 200)
-        {
-            resultCommon.FromJson(container.errorWrapper.Data);
-            resultCommon.Request = container.errorWrapper.Request;
-            return true;
-        }
-        else // Process the error case
-        {
-            if (PlayFabSettings::globalErrorHandler != nullptr)
-            {
-                PlayFabSettings::globalErrorHandler(container.errorWrapper, container.GetCustomData());
-            }
-
-            if (container.errorCallback != nullptr)
-            {
-                container.errorCallback(container.errorWrapper, container.GetCustomData());
-            }
-            return false;
-        }
+        return PlayFabApiDispatch::ValidateResult(resultCommon, container);
     }
 }
 
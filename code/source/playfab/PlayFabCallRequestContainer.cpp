@@ -2,47 +2,27 @@
 
 #include <playfab/PlayFabCallRequestContainer.h>
 #include <playfab/PlayFabSettings.h>
+#include <playfab/PlayFabJsonUtils.h>
 
 namespace PlayFab
 {
-    CallRequestContainer::CallRequestContainer(const std::string& url,
-        const std::unordered_map<std::string, std::string>& headers,
-        const std::string& requestBody,
+    CallRequestContainer::CallRequestContainer(std::string url,
+        PlayFabRequestHeaders headers,
+        std::string requestBody,
         CallRequestContainerCallback callback,
         std::shared_ptr<PlayFabApiSettings> settings,
         std::shared_ptr<PlayFabAuthenticationContext> context,
         void* customData) :
-        CallRequestContainerBase(url, headers, requestBody, callback, customData),
+        CallRequestContainerBase(std::move(url), std::move(headers), std::move(requestBody), std::move(callback), customData),
         finished(false),
         responseString(""),
         responseJson(Json::Value::null),
         errorWrapper(),
-        successCallback(nullptr),
+        successCallback(),
         errorCallback(nullptr),
-        m_settings(settings),
-        m_context(context)
+        m_settings(std::move(settings)),
+        m_context(std::move(context))
     {
-        errorWrapper.UrlPath = url;
-
-        Json::Value request;
-        std::string errs;
-        Json::CharReaderBuilder builder;
-        std::unique_ptr<Json::CharReader> reader(builder.newCharReader());
-
-        const char* reqBod = requestBody.c_str();
-        size_t reqBodLength = requestBody.length();
-
-        try {
-            bool parsingSuccessful = reader->parse(reqBod, reqBod + reqBodLength, &request, &errs);
-            if (parsingSuccessful)
-            {
-                errorWrapper.Request = request;
-            }
-        }
-        catch (const std::exception&)
-        {
-            // We can't parse the request back into a JSON::Value, so the caller won't receive it back...?
-        }
     }
 
     CallRequestContainer::~CallRequestContainer()
@@ -75,9 +55,88 @@ namespace PlayFab
         this->errorWrapper.RequestId = newRequestId;
     }
 
+    void CallRequestContainer::ProcessResponseJson()
+    {
+        std::string().swap(responseString);
+
+        errorWrapper.HttpCode = responseJson.get("code", Json::Value::null).asInt();
+        if (errorWrapper.HttpCode == 200)
+        {
+            return;
+        }
+
+        errorWrapper.HttpStatus = responseJson.get("status", Json::Value::null).asString();
+        errorWrapper.Data = GetResultData();
+        errorWrapper.ErrorName = responseJson.get("error", Json::Value::null).asString();
+        errorWrapper.ErrorCode = static_cast<PlayFabErrorCode>(responseJson.get("errorCode", Json::Value::null).asInt());
+        errorWrapper.ErrorMessage = responseJson.get("errorMessage", Json::Value::null).asString();
+        errorWrapper.ErrorDetails = responseJson.get("errorDetails", Json::Value::null);
+    }
+
+    const Json::Value& CallRequestContainer::GetResultData() const
+    {
+        static constexpr char dataKey[] = "data";
+        const Json::Value* data = responseJson.isObject() ? responseJson.find(dataKey, dataKey + sizeof(dataKey) - 1) : nullptr;
+        return (data == nullptr) ? Json::Value::null : *data;
+    }
+
+    void CallRequestContainer::ReleaseRequestBody()
+    {
+        errorWrapper.UrlPath = this->url;
+        if (requestBody.empty())
+        {
+            return; // Already released
+        }
+
+        Json::Value request;
+        std::string errs;
+
+        try {
+            bool parsingSuccessful = PlayFabJsonUtils::ParseFromString(this->requestBody, request, errs);
+            if (parsingSuccessful)
+            {
+                errorWrapper.Request.swap(request);
+            }
+        }
+        catch (const std::exception&)
+        {
+            // We can't parse the request back into a JSON::Value, so the caller won't receive it back...?
+        }
+
+        std::string().swap(requestBody);
+    }
+
+    size_t CallRequestContainer::GetMemoryUsage() const
+    {
+        // Short strings are stored inside the container, which sizeof already accounts for
+        const uintptr_t containerBegin = reinterpret_cast<uintptr_t>(this);
+        const uintptr_t containerEnd = reinterpret_cast<uintptr_t>(this + 1);
+        auto heapCapacity = [containerBegin, containerEnd](const std::string& buffer) -> size_t
+        {
+            const uintptr_t data = reinterpret_cast<uintptr_t>(buffer.data());
+            return (data >= containerBegin && data < containerEnd) ? 0 : buffer.capacity() + 1;
+        };
+
+        size_t usage = sizeof(*this);
+        for (const std::string* buffer : { &url, &requestBody, &responseString, &requestId,
+            &errorWrapper.HttpStatus, &errorWrapper.ErrorName, &errorWrapper.ErrorMessage, &errorWrapper.RequestId, &errorWrapper.UrlPath })
+        {
+            usage += heapCapacity(*buffer);
+        }
+        for (const PlayFabRequestHeaders::Header& header : requestHeaders)
+        {
+            usage += heapCapacity(header.GetLine());
+        }
+        for (const Json::Value* json : { &responseJson, &errorWrapper.ErrorDetails, &errorWrapper.Data, &errorWrapper.Request })
+        {
+            usage += PlayFabJsonUtils::GetMemoryUsage(*json);
+        }
+        return usage;
+    }
+
     void CallRequestContainer::ThrowIfSettingsInvalid()
     {
-        if (m_settings->titleId.empty())
+        if (m_settings->GetTitleId().empty())
         {
             throw new PlayFabException(PlayFabExceptionCode::TitleNotSet, "PlayFabSettings::staticSettings->titleId has not been set properly. It must not be empty.");
         }
@@ -5,30 +5,30 @@
 namespace PlayFab
 {
     CallRequestContainerBase::CallRequestContainerBase(
-        const std::string& url,
-        const std::unordered_map<std::string, std::string>& headers,
-        const std::string& requestBody,
+        std::string url,
+        PlayFabRequestHeaders headers,
+        std::string requestBody,
         CallRequestContainerCallback callback,
         void* customData) :
-        url(url),
-        requestHeaders(headers),
-        requestBody(requestBody),
-        callback(callback),
+        url(std::move(url)),
+        requestHeaders(std::move(headers)),
+        requestBody(std::move(requestBody)),
+        callback(std::move(callback)),
         customData(customData)
     {
     }
 
-    std::string CallRequestContainerBase::GetUrl() const
+    const std::string& CallRequestContainerBase::GetUrl() const
     {
         return this->url;
     }
 
-    std::unordered_map<std::string, std::string> CallRequestContainerBase::GetRequestHeaders() const
+    const PlayFabRequestHeaders& CallRequestContainerBase::GetRequestHeaders() const
     {
         return this->requestHeaders;
     }
 
-    std::string CallRequestContainerBase::GetRequestBody() const
+    const std::string& CallRequestContainerBase::GetRequestBody() const
     {
         return this->requestBody;
     }
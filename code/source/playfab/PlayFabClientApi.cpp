@@ -3,7 +3,9 @@
 #if !defined(DISABLE_PLAYFABCLIENT_API)
 
 #include <playfab/PlayFabClientApi.h>
+#include <playfab/PlayFabClientDataModels.h>
 #include <playfab/PlayFabPluginManager.h>
+#include <playfab/PlayFabApiDispatch.h>
 #include <playfab/PlayFabSettings.h>
 #include <playfab/PlayFabError.h>
 #include <memory>
@@ -31,426 +33,219 @@ namespace PlayFab
 
     void PlayFabClientAPI::AcceptTrade(
         AcceptTradeRequest& request,
-        const ProcessApiCallback<AcceptTradeResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<AcceptTradeResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<AcceptTradeResponse>(
             "/Client/AcceptTrade",
-            headers,
-            jsonAsString,
-            OnAcceptTradeResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<AcceptTradeResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnAcceptTradeResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        AcceptTradeResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<AcceptTradeResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::AddFriend(
         AddFriendRequest& request,
-        const ProcessApiCallback<AddFriendResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<AddFriendResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<AddFriendResult>(
             "/Client/AddFriend",
-            headers,
-            jsonAsString,
-            OnAddFriendResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<AddFriendResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnAddFriendResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        AddFriendResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<AddFriendResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::AddGenericID(
         AddGenericIDRequest& request,
-        const ProcessApiCallback<AddGenericIDResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<AddGenericIDResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<AddGenericIDResult>(
             "/Client/AddGenericID",
-            headers,
-            jsonAsString,
-            OnAddGenericIDResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<AddGenericIDResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnAddGenericIDResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        AddGenericIDResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<AddGenericIDResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::AddOrUpdateContactEmail(
         AddOrUpdateContactEmailRequest& request,
-        const ProcessApiCallback<AddOrUpdateContactEmailResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<AddOrUpdateContactEmailResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<AddOrUpdateContactEmailResult>(
             "/Client/AddOrUpdateContactEmail",
-            headers,
-            jsonAsString,
-            OnAddOrUpdateContactEmailResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<AddOrUpdateContactEmailResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnAddOrUpdateContactEmailResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        AddOrUpdateContactEmailResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<AddOrUpdateContactEmailResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::AddSharedGroupMembers(
         AddSharedGroupMembersRequest& request,
-        const ProcessApiCallback<AddSharedGroupMembersResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<AddSharedGroupMembersResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<AddSharedGroupMembersResult>(
             "/Client/AddSharedGroupMembers",
-            headers,
-            jsonAsString,
-            OnAddSharedGroupMembersResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<AddSharedGroupMembersResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnAddSharedGroupMembersResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        AddSharedGroupMembersResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<AddSharedGroupMembersResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::AddUsernamePassword(
         AddUsernamePasswordRequest& request,
-        const ProcessApiCallback<AddUsernamePasswordResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<AddUsernamePasswordResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<AddUsernamePasswordResult>(
             "/Client/AddUsernamePassword",
-            headers,
-            jsonAsString,
-            OnAddUsernamePasswordResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<AddUsernamePasswordResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnAddUsernamePasswordResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        AddUsernamePasswordResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<AddUsernamePasswordResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::AddUserVirtualCurrency(
         AddUserVirtualCurrencyRequest& request,
-        const ProcessApiCallback<ModifyUserVirtualCurrencyResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ModifyUserVirtualCurrencyResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ModifyUserVirtualCurrencyResult>(
             "/Client/AddUserVirtualCurrency",
-            headers,
-            jsonAsString,
-            OnAddUserVirtualCurrencyResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyUserVirtualCurrencyResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnAddUserVirtualCurrencyResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ModifyUserVirtualCurrencyResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<ModifyUserVirtualCurrencyResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::AndroidDevicePushNotificationRegistration(
         AndroidDevicePushNotificationRegistrationRequest& request,
-        const ProcessApiCallback<AndroidDevicePushNotificationRegistrationResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<AndroidDevicePushNotificationRegistrationResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<AndroidDevicePushNotificationRegistrationResult>(
             "/Client/AndroidDevicePushNotificationRegistration",
-            headers,
-            jsonAsString,
-            OnAndroidDevicePushNotificationRegistrationResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<AndroidDevicePushNotificationRegistrationResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnAndroidDevicePushNotificationRegistrationResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        AndroidDevicePushNotificationRegistrationResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<AndroidDevicePushNotificationRegistrationResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::AttributeInstall(
         AttributeInstallRequest& request,
-        const ProcessApiCallback<AttributeInstallResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<AttributeInstallResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<AttributeInstallResult>(
             "/Client/AttributeInstall",
-            headers,
-            jsonAsString,
+            request,
+            std::move(headers),
             OnAttributeInstallResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<AttributeInstallResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::OnAttributeInstallResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
@@ -459,3989 +254,1963 @@ namespace PlayFab
         std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
 
         AttributeInstallResult outResult;
-        if (ValidateResult(outResult, container))
+        if (PlayFabApiDispatch::ValidateResult(outResult, container))
         {            context->advertisingIdType += "_Successful";
 
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
+            const ProcessApiCallback<AttributeInstallResult>* callback = container.successCallback.Get<AttributeInstallResult>();
+            if (callback != nullptr)
             {
-                const auto& callback = (*static_cast<ProcessApiCallback<AttributeInstallResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
+                (*callback)(outResult, container.GetCustomData());
             }
         }
     }
 
     void PlayFabClientAPI::CancelTrade(
         CancelTradeRequest& request,
-        const ProcessApiCallback<CancelTradeResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<CancelTradeResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<CancelTradeResponse>(
             "/Client/CancelTrade",
-            headers,
-            jsonAsString,
-            OnCancelTradeResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<CancelTradeResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnCancelTradeResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        CancelTradeResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<CancelTradeResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::ConfirmPurchase(
         ConfirmPurchaseRequest& request,
-        const ProcessApiCallback<ConfirmPurchaseResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ConfirmPurchaseResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ConfirmPurchaseResult>(
             "/Client/ConfirmPurchase",
-            headers,
-            jsonAsString,
-            OnConfirmPurchaseResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ConfirmPurchaseResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnConfirmPurchaseResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ConfirmPurchaseResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<ConfirmPurchaseResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::ConsumeItem(
         ConsumeItemRequest& request,
-        const ProcessApiCallback<ConsumeItemResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ConsumeItemResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ConsumeItemResult>(
             "/Client/ConsumeItem",
-            headers,
-            jsonAsString,
-            OnConsumeItemResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ConsumeItemResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnConsumeItemResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ConsumeItemResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<ConsumeItemResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::ConsumeMicrosoftStoreEntitlements(
         ConsumeMicrosoftStoreEntitlementsRequest& request,
-        const ProcessApiCallback<ConsumeMicrosoftStoreEntitlementsResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ConsumeMicrosoftStoreEntitlementsResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ConsumeMicrosoftStoreEntitlementsResponse>(
             "/Client/ConsumeMicrosoftStoreEntitlements",
-            headers,
-            jsonAsString,
-            OnConsumeMicrosoftStoreEntitlementsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ConsumeMicrosoftStoreEntitlementsResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnConsumeMicrosoftStoreEntitlementsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ConsumeMicrosoftStoreEntitlementsResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<ConsumeMicrosoftStoreEntitlementsResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::ConsumePS5Entitlements(
         ConsumePS5EntitlementsRequest& request,
-        const ProcessApiCallback<ConsumePS5EntitlementsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ConsumePS5EntitlementsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ConsumePS5EntitlementsResult>(
             "/Client/ConsumePS5Entitlements",
-            headers,
-            jsonAsString,
-            OnConsumePS5EntitlementsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ConsumePS5EntitlementsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnConsumePS5EntitlementsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ConsumePS5EntitlementsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<ConsumePS5EntitlementsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::ConsumePSNEntitlements(
         ConsumePSNEntitlementsRequest& request,
-        const ProcessApiCallback<ConsumePSNEntitlementsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ConsumePSNEntitlementsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ConsumePSNEntitlementsResult>(
             "/Client/ConsumePSNEntitlements",
-            headers,
-            jsonAsString,
-            OnConsumePSNEntitlementsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ConsumePSNEntitlementsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnConsumePSNEntitlementsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ConsumePSNEntitlementsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<ConsumePSNEntitlementsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::ConsumeXboxEntitlements(
         ConsumeXboxEntitlementsRequest& request,
-        const ProcessApiCallback<ConsumeXboxEntitlementsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ConsumeXboxEntitlementsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ConsumeXboxEntitlementsResult>(
             "/Client/ConsumeXboxEntitlements",
-            headers,
-            jsonAsString,
-            OnConsumeXboxEntitlementsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ConsumeXboxEntitlementsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnConsumeXboxEntitlementsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ConsumeXboxEntitlementsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<ConsumeXboxEntitlementsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::CreateSharedGroup(
         CreateSharedGroupRequest& request,
-        const ProcessApiCallback<CreateSharedGroupResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<CreateSharedGroupResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<CreateSharedGroupResult>(
             "/Client/CreateSharedGroup",
-            headers,
-            jsonAsString,
-            OnCreateSharedGroupResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<CreateSharedGroupResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnCreateSharedGroupResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        CreateSharedGroupResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<CreateSharedGroupResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::ExecuteCloudScript(
         ExecuteCloudScriptRequest& request,
-        const ProcessApiCallback<ExecuteCloudScriptResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ExecuteCloudScriptResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ExecuteCloudScriptResult>(
             "/Client/ExecuteCloudScript",
-            headers,
-            jsonAsString,
-            OnExecuteCloudScriptResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ExecuteCloudScriptResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnExecuteCloudScriptResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ExecuteCloudScriptResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<ExecuteCloudScriptResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetAccountInfo(
         GetAccountInfoRequest& request,
-        const ProcessApiCallback<GetAccountInfoResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetAccountInfoResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetAccountInfoResult>(
             "/Client/GetAccountInfo",
-            headers,
-            jsonAsString,
-            OnGetAccountInfoResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetAccountInfoResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetAccountInfoResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetAccountInfoResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetAccountInfoResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetAdPlacements(
         GetAdPlacementsRequest& request,
-        const ProcessApiCallback<GetAdPlacementsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetAdPlacementsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetAdPlacementsResult>(
             "/Client/GetAdPlacements",
-            headers,
-            jsonAsString,
-            OnGetAdPlacementsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetAdPlacementsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetAdPlacementsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetAdPlacementsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetAdPlacementsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetAllUsersCharacters(
         ListUsersCharactersRequest& request,
-        const ProcessApiCallback<ListUsersCharactersResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ListUsersCharactersResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ListUsersCharactersResult>(
             "/Client/GetAllUsersCharacters",
-            headers,
-            jsonAsString,
-            OnGetAllUsersCharactersResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ListUsersCharactersResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetAllUsersCharactersResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ListUsersCharactersResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<ListUsersCharactersResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetCatalogItems(
         GetCatalogItemsRequest& request,
-        const ProcessApiCallback<GetCatalogItemsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetCatalogItemsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetCatalogItemsResult>(
             "/Client/GetCatalogItems",
-            headers,
-            jsonAsString,
-            OnGetCatalogItemsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCatalogItemsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetCatalogItemsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetCatalogItemsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetCatalogItemsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetCharacterData(
         GetCharacterDataRequest& request,
-        const ProcessApiCallback<GetCharacterDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetCharacterDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetCharacterDataResult>(
             "/Client/GetCharacterData",
-            headers,
-            jsonAsString,
-            OnGetCharacterDataResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetCharacterDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetCharacterDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetCharacterDataResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetCharacterInventory(
         GetCharacterInventoryRequest& request,
-        const ProcessApiCallback<GetCharacterInventoryResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetCharacterInventoryResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetCharacterInventoryResult>(
             "/Client/GetCharacterInventory",
-            headers,
-            jsonAsString,
-            OnGetCharacterInventoryResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterInventoryResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetCharacterInventoryResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetCharacterInventoryResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetCharacterInventoryResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetCharacterLeaderboard(
         GetCharacterLeaderboardRequest& request,
-        const ProcessApiCallback<GetCharacterLeaderboardResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetCharacterLeaderboardResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetCharacterLeaderboardResult>(
             "/Client/GetCharacterLeaderboard",
-            headers,
-            jsonAsString,
-            OnGetCharacterLeaderboardResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterLeaderboardResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetCharacterLeaderboardResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetCharacterLeaderboardResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetCharacterLeaderboardResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetCharacterReadOnlyData(
         GetCharacterDataRequest& request,
-        const ProcessApiCallback<GetCharacterDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetCharacterDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetCharacterDataResult>(
             "/Client/GetCharacterReadOnlyData",
-            headers,
-            jsonAsString,
-            OnGetCharacterReadOnlyDataResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetCharacterReadOnlyDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetCharacterDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetCharacterDataResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetCharacterStatistics(
         GetCharacterStatisticsRequest& request,
-        const ProcessApiCallback<GetCharacterStatisticsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetCharacterStatisticsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetCharacterStatisticsResult>(
             "/Client/GetCharacterStatistics",
-            headers,
-            jsonAsString,
-            OnGetCharacterStatisticsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetCharacterStatisticsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetCharacterStatisticsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetCharacterStatisticsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetCharacterStatisticsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetContentDownloadUrl(
         GetContentDownloadUrlRequest& request,
-        const ProcessApiCallback<GetContentDownloadUrlResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetContentDownloadUrlResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetContentDownloadUrlResult>(
             "/Client/GetContentDownloadUrl",
-            headers,
-            jsonAsString,
-            OnGetContentDownloadUrlResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetContentDownloadUrlResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetContentDownloadUrlResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetContentDownloadUrlResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetContentDownloadUrlResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetCurrentGames(
         CurrentGamesRequest& request,
-        const ProcessApiCallback<CurrentGamesResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<CurrentGamesResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<CurrentGamesResult>(
             "/Client/GetCurrentGames",
-            headers,
-            jsonAsString,
-            OnGetCurrentGamesResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<CurrentGamesResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetCurrentGamesResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        CurrentGamesResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<CurrentGamesResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetFriendLeaderboard(
         GetFriendLeaderboardRequest& request,
-        const ProcessApiCallback<GetLeaderboardResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetLeaderboardResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetLeaderboardResult>(
             "/Client/GetFriendLeaderboard",
-            headers,
-            jsonAsString,
-            OnGetFriendLeaderboardResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetFriendLeaderboardResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetLeaderboardResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetLeaderboardResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetFriendLeaderboardAroundPlayer(
         GetFriendLeaderboardAroundPlayerRequest& request,
-        const ProcessApiCallback<GetFriendLeaderboardAroundPlayerResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetFriendLeaderboardAroundPlayerResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetFriendLeaderboardAroundPlayerResult>(
             "/Client/GetFriendLeaderboardAroundPlayer",
-            headers,
-            jsonAsString,
-            OnGetFriendLeaderboardAroundPlayerResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetFriendLeaderboardAroundPlayerResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetFriendLeaderboardAroundPlayerResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetFriendLeaderboardAroundPlayerResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetFriendLeaderboardAroundPlayerResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetFriendsList(
         GetFriendsListRequest& request,
-        const ProcessApiCallback<GetFriendsListResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetFriendsListResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetFriendsListResult>(
             "/Client/GetFriendsList",
-            headers,
-            jsonAsString,
-            OnGetFriendsListResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetFriendsListResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetFriendsListResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetFriendsListResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetFriendsListResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetGameServerRegions(
         GameServerRegionsRequest& request,
-        const ProcessApiCallback<GameServerRegionsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GameServerRegionsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GameServerRegionsResult>(
             "/Client/GetGameServerRegions",
-            headers,
-            jsonAsString,
-            OnGetGameServerRegionsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GameServerRegionsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetGameServerRegionsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GameServerRegionsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GameServerRegionsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetLeaderboard(
         GetLeaderboardRequest& request,
-        const ProcessApiCallback<GetLeaderboardResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetLeaderboardResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetLeaderboardResult>(
             "/Client/GetLeaderboard",
-            headers,
-            jsonAsString,
-            OnGetLeaderboardResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetLeaderboardResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetLeaderboardResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetLeaderboardResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetLeaderboardAroundCharacter(
         GetLeaderboardAroundCharacterRequest& request,
-        const ProcessApiCallback<GetLeaderboardAroundCharacterResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetLeaderboardAroundCharacterResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetLeaderboardAroundCharacterResult>(
             "/Client/GetLeaderboardAroundCharacter",
-            headers,
-            jsonAsString,
-            OnGetLeaderboardAroundCharacterResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardAroundCharacterResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetLeaderboardAroundCharacterResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetLeaderboardAroundCharacterResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetLeaderboardAroundCharacterResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetLeaderboardAroundPlayer(
         GetLeaderboardAroundPlayerRequest& request,
-        const ProcessApiCallback<GetLeaderboardAroundPlayerResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetLeaderboardAroundPlayerResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetLeaderboardAroundPlayerResult>(
             "/Client/GetLeaderboardAroundPlayer",
-            headers,
-            jsonAsString,
-            OnGetLeaderboardAroundPlayerResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardAroundPlayerResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetLeaderboardAroundPlayerResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetLeaderboardAroundPlayerResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetLeaderboardAroundPlayerResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetLeaderboardForUserCharacters(
         GetLeaderboardForUsersCharactersRequest& request,
-        const ProcessApiCallback<GetLeaderboardForUsersCharactersResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetLeaderboardForUsersCharactersResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetLeaderboardForUsersCharactersResult>(
             "/Client/GetLeaderboardForUserCharacters",
-            headers,
-            jsonAsString,
-            OnGetLeaderboardForUserCharactersResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetLeaderboardForUsersCharactersResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetLeaderboardForUserCharactersResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetLeaderboardForUsersCharactersResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetLeaderboardForUsersCharactersResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetPaymentToken(
         GetPaymentTokenRequest& request,
-        const ProcessApiCallback<GetPaymentTokenResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPaymentTokenResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPaymentTokenResult>(
             "/Client/GetPaymentToken",
-            headers,
-            jsonAsString,
-            OnGetPaymentTokenResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPaymentTokenResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetPaymentTokenResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPaymentTokenResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPaymentTokenResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetPhotonAuthenticationToken(
         GetPhotonAuthenticationTokenRequest& request,
-        const ProcessApiCallback<GetPhotonAuthenticationTokenResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPhotonAuthenticationTokenResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPhotonAuthenticationTokenResult>(
             "/Client/GetPhotonAuthenticationToken",
-            headers,
-            jsonAsString,
-            OnGetPhotonAuthenticationTokenResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPhotonAuthenticationTokenResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetPhotonAuthenticationTokenResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPhotonAuthenticationTokenResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPhotonAuthenticationTokenResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetPlayerCombinedInfo(
         GetPlayerCombinedInfoRequest& request,
-        const ProcessApiCallback<GetPlayerCombinedInfoResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayerCombinedInfoResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayerCombinedInfoResult>(
             "/Client/GetPlayerCombinedInfo",
-            headers,
-            jsonAsString,
-            OnGetPlayerCombinedInfoResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerCombinedInfoResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetPlayerCombinedInfoResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayerCombinedInfoResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPlayerCombinedInfoResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetPlayerProfile(
         GetPlayerProfileRequest& request,
-        const ProcessApiCallback<GetPlayerProfileResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayerProfileResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayerProfileResult>(
             "/Client/GetPlayerProfile",
-            headers,
-            jsonAsString,
-            OnGetPlayerProfileResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerProfileResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetPlayerProfileResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayerProfileResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPlayerProfileResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetPlayerSegments(
         GetPlayerSegmentsRequest& request,
-        const ProcessApiCallback<GetPlayerSegmentsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayerSegmentsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayerSegmentsResult>(
             "/Client/GetPlayerSegments",
-            headers,
-            jsonAsString,
-            OnGetPlayerSegmentsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerSegmentsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetPlayerSegmentsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayerSegmentsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPlayerSegmentsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetPlayerStatistics(
         GetPlayerStatisticsRequest& request,
-        const ProcessApiCallback<GetPlayerStatisticsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayerStatisticsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayerStatisticsResult>(
             "/Client/GetPlayerStatistics",
-            headers,
-            jsonAsString,
-            OnGetPlayerStatisticsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerStatisticsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetPlayerStatisticsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayerStatisticsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPlayerStatisticsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetPlayerStatisticVersions(
         GetPlayerStatisticVersionsRequest& request,
-        const ProcessApiCallback<GetPlayerStatisticVersionsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayerStatisticVersionsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayerStatisticVersionsResult>(
             "/Client/GetPlayerStatisticVersions",
-            headers,
-            jsonAsString,
-            OnGetPlayerStatisticVersionsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerStatisticVersionsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetPlayerStatisticVersionsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayerStatisticVersionsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPlayerStatisticVersionsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetPlayerTags(
         GetPlayerTagsRequest& request,
-        const ProcessApiCallback<GetPlayerTagsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayerTagsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayerTagsResult>(
             "/Client/GetPlayerTags",
-            headers,
-            jsonAsString,
-            OnGetPlayerTagsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerTagsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetPlayerTagsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayerTagsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPlayerTagsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetPlayerTrades(
         GetPlayerTradesRequest& request,
-        const ProcessApiCallback<GetPlayerTradesResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayerTradesResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayerTradesResponse>(
             "/Client/GetPlayerTrades",
-            headers,
-            jsonAsString,
-            OnGetPlayerTradesResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayerTradesResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetPlayerTradesResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayerTradesResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPlayerTradesResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetPlayFabIDsFromFacebookIDs(
         GetPlayFabIDsFromFacebookIDsRequest& request,
-        const ProcessApiCallback<GetPlayFabIDsFromFacebookIDsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayFabIDsFromFacebookIDsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayFabIDsFromFacebookIDsResult>(
             "/Client/GetPlayFabIDsFromFacebookIDs",
-            headers,
-            jsonAsString,
-            OnGetPlayFabIDsFromFacebookIDsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromFacebookIDsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetPlayFabIDsFromFacebookIDsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayFabIDsFromFacebookIDsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPlayFabIDsFromFacebookIDsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetPlayFabIDsFromFacebookInstantGamesIds(
         GetPlayFabIDsFromFacebookInstantGamesIdsRequest& request,
-        const ProcessApiCallback<GetPlayFabIDsFromFacebookInstantGamesIdsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayFabIDsFromFacebookInstantGamesIdsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayFabIDsFromFacebookInstantGamesIdsResult>(
             "/Client/GetPlayFabIDsFromFacebookInstantGamesIds",
-            headers,
-            jsonAsString,
-            OnGetPlayFabIDsFromFacebookInstantGamesIdsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromFacebookInstantGamesIdsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetPlayFabIDsFromFacebookInstantGamesIdsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayFabIDsFromFacebookInstantGamesIdsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPlayFabIDsFromFacebookInstantGamesIdsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetPlayFabIDsFromGameCenterIDs(
         GetPlayFabIDsFromGameCenterIDsRequest& request,
-        const ProcessApiCallback<GetPlayFabIDsFromGameCenterIDsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayFabIDsFromGameCenterIDsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayFabIDsFromGameCenterIDsResult>(
             "/Client/GetPlayFabIDsFromGameCenterIDs",
-            headers,
-            jsonAsString,
-            OnGetPlayFabIDsFromGameCenterIDsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromGameCenterIDsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetPlayFabIDsFromGameCenterIDsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayFabIDsFromGameCenterIDsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPlayFabIDsFromGameCenterIDsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetPlayFabIDsFromGenericIDs(
         GetPlayFabIDsFromGenericIDsRequest& request,
-        const ProcessApiCallback<GetPlayFabIDsFromGenericIDsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayFabIDsFromGenericIDsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayFabIDsFromGenericIDsResult>(
             "/Client/GetPlayFabIDsFromGenericIDs",
-            headers,
-            jsonAsString,
-            OnGetPlayFabIDsFromGenericIDsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromGenericIDsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetPlayFabIDsFromGenericIDsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayFabIDsFromGenericIDsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPlayFabIDsFromGenericIDsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetPlayFabIDsFromGoogleIDs(
         GetPlayFabIDsFromGoogleIDsRequest& request,
-        const ProcessApiCallback<GetPlayFabIDsFromGoogleIDsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayFabIDsFromGoogleIDsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayFabIDsFromGoogleIDsResult>(
             "/Client/GetPlayFabIDsFromGoogleIDs",
-            headers,
-            jsonAsString,
-            OnGetPlayFabIDsFromGoogleIDsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromGoogleIDsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetPlayFabIDsFromGoogleIDsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayFabIDsFromGoogleIDsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPlayFabIDsFromGoogleIDsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetPlayFabIDsFromKongregateIDs(
         GetPlayFabIDsFromKongregateIDsRequest& request,
-        const ProcessApiCallback<GetPlayFabIDsFromKongregateIDsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayFabIDsFromKongregateIDsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayFabIDsFromKongregateIDsResult>(
             "/Client/GetPlayFabIDsFromKongregateIDs",
-            headers,
-            jsonAsString,
-            OnGetPlayFabIDsFromKongregateIDsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromKongregateIDsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetPlayFabIDsFromKongregateIDsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayFabIDsFromKongregateIDsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPlayFabIDsFromKongregateIDsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetPlayFabIDsFromNintendoSwitchDeviceIds(
         GetPlayFabIDsFromNintendoSwitchDeviceIdsRequest& request,
-        const ProcessApiCallback<GetPlayFabIDsFromNintendoSwitchDeviceIdsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayFabIDsFromNintendoSwitchDeviceIdsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayFabIDsFromNintendoSwitchDeviceIdsResult>(
             "/Client/GetPlayFabIDsFromNintendoSwitchDeviceIds",
-            headers,
-            jsonAsString,
-            OnGetPlayFabIDsFromNintendoSwitchDeviceIdsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromNintendoSwitchDeviceIdsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetPlayFabIDsFromNintendoSwitchDeviceIdsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayFabIDsFromNintendoSwitchDeviceIdsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPlayFabIDsFromNintendoSwitchDeviceIdsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetPlayFabIDsFromPSNAccountIDs(
         GetPlayFabIDsFromPSNAccountIDsRequest& request,
-        const ProcessApiCallback<GetPlayFabIDsFromPSNAccountIDsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayFabIDsFromPSNAccountIDsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayFabIDsFromPSNAccountIDsResult>(
             "/Client/GetPlayFabIDsFromPSNAccountIDs",
-            headers,
-            jsonAsString,
-            OnGetPlayFabIDsFromPSNAccountIDsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromPSNAccountIDsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetPlayFabIDsFromPSNAccountIDsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayFabIDsFromPSNAccountIDsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPlayFabIDsFromPSNAccountIDsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetPlayFabIDsFromSteamIDs(
         GetPlayFabIDsFromSteamIDsRequest& request,
-        const ProcessApiCallback<GetPlayFabIDsFromSteamIDsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayFabIDsFromSteamIDsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayFabIDsFromSteamIDsResult>(
             "/Client/GetPlayFabIDsFromSteamIDs",
-            headers,
-            jsonAsString,
-            OnGetPlayFabIDsFromSteamIDsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromSteamIDsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetPlayFabIDsFromSteamIDsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayFabIDsFromSteamIDsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPlayFabIDsFromSteamIDsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetPlayFabIDsFromTwitchIDs(
         GetPlayFabIDsFromTwitchIDsRequest& request,
-        const ProcessApiCallback<GetPlayFabIDsFromTwitchIDsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPlayFabIDsFromTwitchIDsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayFabIDsFromTwitchIDsResult>(
             "/Client/GetPlayFabIDsFromTwitchIDs",
-            headers,
-            jsonAsString,
-            OnGetPlayFabIDsFromTwitchIDsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromTwitchIDsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
-    void PlayFabClientAPI::OnGetPlayFabIDsFromTwitchIDsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayFabIDsFromTwitchIDsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPlayFabIDsFromTwitchIDsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
-    }
-
-    void PlayFabClientAPI::GetPlayFabIDsFromXboxLiveIDs(
-        GetPlayFabIDsFromXboxLiveIDsRequest& request,
-        const ProcessApiCallback<GetPlayFabIDsFromXboxLiveIDsResult> callback,
-        const ErrorCallback errorCallback,
-        void* customData
-    )
+    void PlayFabClientAPI::GetPlayFabIDsFromXboxLiveIDs(
+        GetPlayFabIDsFromXboxLiveIDsRequest& request,
+        ProcessApiCallback<GetPlayFabIDsFromXboxLiveIDsResult> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPlayFabIDsFromXboxLiveIDsResult>(
             "/Client/GetPlayFabIDsFromXboxLiveIDs",
-            headers,
-            jsonAsString,
-            OnGetPlayFabIDsFromXboxLiveIDsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPlayFabIDsFromXboxLiveIDsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetPlayFabIDsFromXboxLiveIDsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPlayFabIDsFromXboxLiveIDsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPlayFabIDsFromXboxLiveIDsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetPublisherData(
         GetPublisherDataRequest& request,
-        const ProcessApiCallback<GetPublisherDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPublisherDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPublisherDataResult>(
             "/Client/GetPublisherData",
-            headers,
-            jsonAsString,
-            OnGetPublisherDataResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPublisherDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetPublisherDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPublisherDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPublisherDataResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetPurchase(
         GetPurchaseRequest& request,
-        const ProcessApiCallback<GetPurchaseResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetPurchaseResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetPurchaseResult>(
             "/Client/GetPurchase",
-            headers,
-            jsonAsString,
-            OnGetPurchaseResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetPurchaseResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetPurchaseResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetPurchaseResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetPurchaseResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetSharedGroupData(
         GetSharedGroupDataRequest& request,
-        const ProcessApiCallback<GetSharedGroupDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetSharedGroupDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetSharedGroupDataResult>(
             "/Client/GetSharedGroupData",
-            headers,
-            jsonAsString,
-            OnGetSharedGroupDataResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetSharedGroupDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetSharedGroupDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetSharedGroupDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetSharedGroupDataResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetStoreItems(
         GetStoreItemsRequest& request,
-        const ProcessApiCallback<GetStoreItemsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetStoreItemsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetStoreItemsResult>(
             "/Client/GetStoreItems",
-            headers,
-            jsonAsString,
-            OnGetStoreItemsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetStoreItemsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetStoreItemsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetStoreItemsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetStoreItemsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetTime(
         GetTimeRequest& request,
-        const ProcessApiCallback<GetTimeResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetTimeResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetTimeResult>(
             "/Client/GetTime",
-            headers,
-            jsonAsString,
-            OnGetTimeResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTimeResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetTimeResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetTimeResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetTimeResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetTitleData(
         GetTitleDataRequest& request,
-        const ProcessApiCallback<GetTitleDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetTitleDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetTitleDataResult>(
             "/Client/GetTitleData",
-            headers,
-            jsonAsString,
-            OnGetTitleDataResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetTitleDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetTitleDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetTitleDataResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetTitleNews(
         GetTitleNewsRequest& request,
-        const ProcessApiCallback<GetTitleNewsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetTitleNewsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
-
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetTitleNewsResult>(
             "/Client/GetTitleNews",
-            headers,
-            jsonAsString,
-            OnGetTitleNewsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitleNewsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetTitleNewsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetTitleNewsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetTitleNewsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetTitlePublicKey(
         GetTitlePublicKeyRequest& request,
-        const ProcessApiCallback<GetTitlePublicKeyResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetTitlePublicKeyResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
+        PlayFabRequestHeaders headers;
 
-        std::unordered_map<std::string, std::string> headers;
-
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetTitlePublicKeyResult>(
             "/Client/GetTitlePublicKey",
-            headers,
-            jsonAsString,
-            OnGetTitlePublicKeyResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTitlePublicKeyResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetTitlePublicKeyResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetTitlePublicKeyResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetTitlePublicKeyResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetTradeStatus(
         GetTradeStatusRequest& request,
-        const ProcessApiCallback<GetTradeStatusResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetTradeStatusResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetTradeStatusResponse>(
             "/Client/GetTradeStatus",
-            headers,
-            jsonAsString,
-            OnGetTradeStatusResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetTradeStatusResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetTradeStatusResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetTradeStatusResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetTradeStatusResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetUserData(
         GetUserDataRequest& request,
-        const ProcessApiCallback<GetUserDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetUserDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetUserDataResult>(
             "/Client/GetUserData",
-            headers,
-            jsonAsString,
-            OnGetUserDataResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetUserDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetUserDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetUserDataResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetUserInventory(
         GetUserInventoryRequest& request,
-        const ProcessApiCallback<GetUserInventoryResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetUserInventoryResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetUserInventoryResult>(
             "/Client/GetUserInventory",
-            headers,
-            jsonAsString,
-            OnGetUserInventoryResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserInventoryResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetUserInventoryResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetUserInventoryResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetUserInventoryResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetUserPublisherData(
         GetUserDataRequest& request,
-        const ProcessApiCallback<GetUserDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetUserDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetUserDataResult>(
             "/Client/GetUserPublisherData",
-            headers,
-            jsonAsString,
-            OnGetUserPublisherDataResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetUserPublisherDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetUserDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetUserDataResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetUserPublisherReadOnlyData(
         GetUserDataRequest& request,
-        const ProcessApiCallback<GetUserDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetUserDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetUserDataResult>(
             "/Client/GetUserPublisherReadOnlyData",
-            headers,
-            jsonAsString,
-            OnGetUserPublisherReadOnlyDataResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetUserPublisherReadOnlyDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetUserDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetUserDataResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetUserReadOnlyData(
         GetUserDataRequest& request,
-        const ProcessApiCallback<GetUserDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetUserDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetUserDataResult>(
             "/Client/GetUserReadOnlyData",
-            headers,
-            jsonAsString,
-            OnGetUserReadOnlyDataResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetUserDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetUserReadOnlyDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetUserDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetUserDataResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GetWindowsHelloChallenge(
         GetWindowsHelloChallengeRequest& request,
-        const ProcessApiCallback<GetWindowsHelloChallengeResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GetWindowsHelloChallengeResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
+        PlayFabRequestHeaders headers;
 
-        std::unordered_map<std::string, std::string> headers;
-
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GetWindowsHelloChallengeResponse>(
             "/Client/GetWindowsHelloChallenge",
-            headers,
-            jsonAsString,
-            OnGetWindowsHelloChallengeResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GetWindowsHelloChallengeResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGetWindowsHelloChallengeResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GetWindowsHelloChallengeResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GetWindowsHelloChallengeResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::GrantCharacterToUser(
         GrantCharacterToUserRequest& request,
-        const ProcessApiCallback<GrantCharacterToUserResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<GrantCharacterToUserResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<GrantCharacterToUserResult>(
             "/Client/GrantCharacterToUser",
-            headers,
-            jsonAsString,
-            OnGrantCharacterToUserResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<GrantCharacterToUserResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnGrantCharacterToUserResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        GrantCharacterToUserResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<GrantCharacterToUserResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::LinkAndroidDeviceID(
         LinkAndroidDeviceIDRequest& request,
-        const ProcessApiCallback<LinkAndroidDeviceIDResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LinkAndroidDeviceIDResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LinkAndroidDeviceIDResult>(
             "/Client/LinkAndroidDeviceID",
-            headers,
-            jsonAsString,
-            OnLinkAndroidDeviceIDResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkAndroidDeviceIDResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnLinkAndroidDeviceIDResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        LinkAndroidDeviceIDResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<LinkAndroidDeviceIDResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::LinkApple(
         LinkAppleRequest& request,
-        const ProcessApiCallback<EmptyResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<EmptyResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<EmptyResult>(
             "/Client/LinkApple",
-            headers,
-            jsonAsString,
-            OnLinkAppleResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnLinkAppleResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        EmptyResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<EmptyResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::LinkCustomID(
         LinkCustomIDRequest& request,
-        const ProcessApiCallback<LinkCustomIDResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LinkCustomIDResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LinkCustomIDResult>(
             "/Client/LinkCustomID",
-            headers,
-            jsonAsString,
-            OnLinkCustomIDResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkCustomIDResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnLinkCustomIDResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        LinkCustomIDResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<LinkCustomIDResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::LinkFacebookAccount(
         LinkFacebookAccountRequest& request,
-        const ProcessApiCallback<LinkFacebookAccountResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LinkFacebookAccountResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LinkFacebookAccountResult>(
             "/Client/LinkFacebookAccount",
-            headers,
-            jsonAsString,
-            OnLinkFacebookAccountResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkFacebookAccountResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnLinkFacebookAccountResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        LinkFacebookAccountResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<LinkFacebookAccountResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::LinkFacebookInstantGamesId(
         LinkFacebookInstantGamesIdRequest& request,
-        const ProcessApiCallback<LinkFacebookInstantGamesIdResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LinkFacebookInstantGamesIdResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LinkFacebookInstantGamesIdResult>(
             "/Client/LinkFacebookInstantGamesId",
-            headers,
-            jsonAsString,
-            OnLinkFacebookInstantGamesIdResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkFacebookInstantGamesIdResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnLinkFacebookInstantGamesIdResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        LinkFacebookInstantGamesIdResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<LinkFacebookInstantGamesIdResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::LinkGameCenterAccount(
         LinkGameCenterAccountRequest& request,
-        const ProcessApiCallback<LinkGameCenterAccountResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LinkGameCenterAccountResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LinkGameCenterAccountResult>(
             "/Client/LinkGameCenterAccount",
-            headers,
-            jsonAsString,
-            OnLinkGameCenterAccountResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkGameCenterAccountResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnLinkGameCenterAccountResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        LinkGameCenterAccountResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<LinkGameCenterAccountResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::LinkGoogleAccount(
         LinkGoogleAccountRequest& request,
-        const ProcessApiCallback<LinkGoogleAccountResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LinkGoogleAccountResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LinkGoogleAccountResult>(
             "/Client/LinkGoogleAccount",
-            headers,
-            jsonAsString,
-            OnLinkGoogleAccountResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkGoogleAccountResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnLinkGoogleAccountResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        LinkGoogleAccountResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<LinkGoogleAccountResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::LinkIOSDeviceID(
         LinkIOSDeviceIDRequest& request,
-        const ProcessApiCallback<LinkIOSDeviceIDResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LinkIOSDeviceIDResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
-
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LinkIOSDeviceIDResult>(
             "/Client/LinkIOSDeviceID",
-            headers,
-            jsonAsString,
-            OnLinkIOSDeviceIDResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkIOSDeviceIDResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnLinkIOSDeviceIDResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        LinkIOSDeviceIDResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<LinkIOSDeviceIDResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::LinkKongregate(
         LinkKongregateAccountRequest& request,
-        const ProcessApiCallback<LinkKongregateAccountResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LinkKongregateAccountResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
-        std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
-
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
+        std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LinkKongregateAccountResult>(
             "/Client/LinkKongregate",
-            headers,
-            jsonAsString,
-            OnLinkKongregateResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkKongregateAccountResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnLinkKongregateResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        LinkKongregateAccountResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<LinkKongregateAccountResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::LinkNintendoServiceAccount(
         LinkNintendoServiceAccountRequest& request,
-        const ProcessApiCallback<EmptyResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<EmptyResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<EmptyResult>(
             "/Client/LinkNintendoServiceAccount",
-            headers,
-            jsonAsString,
-            OnLinkNintendoServiceAccountResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnLinkNintendoServiceAccountResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        EmptyResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<EmptyResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::LinkNintendoSwitchDeviceId(
         LinkNintendoSwitchDeviceIdRequest& request,
-        const ProcessApiCallback<LinkNintendoSwitchDeviceIdResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LinkNintendoSwitchDeviceIdResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LinkNintendoSwitchDeviceIdResult>(
             "/Client/LinkNintendoSwitchDeviceId",
-            headers,
-            jsonAsString,
-            OnLinkNintendoSwitchDeviceIdResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkNintendoSwitchDeviceIdResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnLinkNintendoSwitchDeviceIdResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        LinkNintendoSwitchDeviceIdResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<LinkNintendoSwitchDeviceIdResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::LinkOpenIdConnect(
         LinkOpenIdConnectRequest& request,
-        const ProcessApiCallback<EmptyResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<EmptyResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<EmptyResult>(
             "/Client/LinkOpenIdConnect",
-            headers,
-            jsonAsString,
-            OnLinkOpenIdConnectResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnLinkOpenIdConnectResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        EmptyResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<EmptyResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::LinkPSNAccount(
         LinkPSNAccountRequest& request,
-        const ProcessApiCallback<LinkPSNAccountResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LinkPSNAccountResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LinkPSNAccountResult>(
             "/Client/LinkPSNAccount",
-            headers,
-            jsonAsString,
-            OnLinkPSNAccountResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkPSNAccountResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnLinkPSNAccountResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        LinkPSNAccountResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<LinkPSNAccountResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::LinkSteamAccount(
         LinkSteamAccountRequest& request,
-        const ProcessApiCallback<LinkSteamAccountResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LinkSteamAccountResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LinkSteamAccountResult>(
             "/Client/LinkSteamAccount",
-            headers,
-            jsonAsString,
-            OnLinkSteamAccountResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkSteamAccountResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnLinkSteamAccountResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        LinkSteamAccountResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<LinkSteamAccountResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::LinkTwitch(
         LinkTwitchAccountRequest& request,
-        const ProcessApiCallback<LinkTwitchAccountResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LinkTwitchAccountResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LinkTwitchAccountResult>(
             "/Client/LinkTwitch",
-            headers,
-            jsonAsString,
-            OnLinkTwitchResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkTwitchAccountResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnLinkTwitchResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        LinkTwitchAccountResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<LinkTwitchAccountResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::LinkWindowsHello(
         LinkWindowsHelloAccountRequest& request,
-        const ProcessApiCallback<LinkWindowsHelloAccountResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LinkWindowsHelloAccountResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LinkWindowsHelloAccountResponse>(
             "/Client/LinkWindowsHello",
-            headers,
-            jsonAsString,
-            OnLinkWindowsHelloResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkWindowsHelloAccountResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnLinkWindowsHelloResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        LinkWindowsHelloAccountResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<LinkWindowsHelloAccountResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::LinkXboxAccount(
         LinkXboxAccountRequest& request,
-        const ProcessApiCallback<LinkXboxAccountResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LinkXboxAccountResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LinkXboxAccountResult>(
             "/Client/LinkXboxAccount",
-            headers,
-            jsonAsString,
-            OnLinkXboxAccountResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LinkXboxAccountResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnLinkXboxAccountResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        LinkXboxAccountResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<LinkXboxAccountResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::LoginWithAndroidDeviceID(
         LoginWithAndroidDeviceIDRequest& request,
-        const ProcessApiCallback<LoginResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
@@ -4449,28 +2218,21 @@ namespace PlayFab
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
         if (request.TitleId.empty())
         {
-            request.TitleId = settings->titleId;
+            request.TitleId = settings->GetTitleId();
         }
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
+        PlayFabRequestHeaders headers;
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LoginResult>(
             "/Client/LoginWithAndroidDeviceID",
-            headers,
-            jsonAsString,
+            request,
+            std::move(headers),
             OnLoginWithAndroidDeviceIDResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::OnLoginWithAndroidDeviceIDResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
@@ -4479,25 +2241,24 @@ namespace PlayFab
         std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
 
         LoginResult outResult;
-        if (ValidateResult(outResult, container))
+        if (PlayFabApiDispatch::ValidateResult(outResult, container))
         {            outResult.authenticationContext = std::make_shared<PlayFabAuthenticationContext>();
             outResult.authenticationContext->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             context->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             MultiStepClientLogin(context, outResult.SettingsForUser->NeedsAttribution);
 
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
+            const ProcessApiCallback<LoginResult>* callback = container.successCallback.Get<LoginResult>();
+            if (callback != nullptr)
             {
-                const auto& callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
+                (*callback)(outResult, container.GetCustomData());
             }
         }
     }
 
     void PlayFabClientAPI::LoginWithApple(
         LoginWithAppleRequest& request,
-        const ProcessApiCallback<LoginResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
@@ -4505,28 +2266,21 @@ namespace PlayFab
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
         if (request.TitleId.empty())
         {
-            request.TitleId = settings->titleId;
+            request.TitleId = settings->GetTitleId();
         }
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
+        PlayFabRequestHeaders headers;
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LoginResult>(
             "/Client/LoginWithApple",
-            headers,
-            jsonAsString,
+            request,
+            std::move(headers),
             OnLoginWithAppleResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::OnLoginWithAppleResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
@@ -4535,25 +2289,24 @@ namespace PlayFab
         std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
 
         LoginResult outResult;
-        if (ValidateResult(outResult, container))
+        if (PlayFabApiDispatch::ValidateResult(outResult, container))
         {            outResult.authenticationContext = std::make_shared<PlayFabAuthenticationContext>();
             outResult.authenticationContext->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             context->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             MultiStepClientLogin(context, outResult.SettingsForUser->NeedsAttribution);
 
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
+            const ProcessApiCallback<LoginResult>* callback = container.successCallback.Get<LoginResult>();
+            if (callback != nullptr)
             {
-                const auto& callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
+                (*callback)(outResult, container.GetCustomData());
             }
         }
     }
 
     void PlayFabClientAPI::LoginWithCustomID(
         LoginWithCustomIDRequest& request,
-        const ProcessApiCallback<LoginResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
@@ -4561,28 +2314,21 @@ namespace PlayFab
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
         if (request.TitleId.empty())
         {
-            request.TitleId = settings->titleId;
+            request.TitleId = settings->GetTitleId();
         }
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
+        PlayFabRequestHeaders headers;
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LoginResult>(
             "/Client/LoginWithCustomID",
-            headers,
-            jsonAsString,
+            request,
+            std::move(headers),
             OnLoginWithCustomIDResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::OnLoginWithCustomIDResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
@@ -4591,25 +2337,24 @@ namespace PlayFab
         std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
 
         LoginResult outResult;
-        if (ValidateResult(outResult, container))
+        if (PlayFabApiDispatch::ValidateResult(outResult, container))
         {            outResult.authenticationContext = std::make_shared<PlayFabAuthenticationContext>();
             outResult.authenticationContext->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             context->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             MultiStepClientLogin(context, outResult.SettingsForUser->NeedsAttribution);
 
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
+            const ProcessApiCallback<LoginResult>* callback = container.successCallback.Get<LoginResult>();
+            if (callback != nullptr)
             {
-                const auto& callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
+                (*callback)(outResult, container.GetCustomData());
             }
         }
     }
 
     void PlayFabClientAPI::LoginWithEmailAddress(
         LoginWithEmailAddressRequest& request,
-        const ProcessApiCallback<LoginResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
@@ -4617,28 +2362,21 @@ namespace PlayFab
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
         if (request.TitleId.empty())
         {
-            request.TitleId = settings->titleId;
+            request.TitleId = settings->GetTitleId();
         }
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
+        PlayFabRequestHeaders headers;
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LoginResult>(
             "/Client/LoginWithEmailAddress",
-            headers,
-            jsonAsString,
+            request,
+            std::move(headers),
             OnLoginWithEmailAddressResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::OnLoginWithEmailAddressResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
@@ -4647,25 +2385,24 @@ namespace PlayFab
         std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
 
         LoginResult outResult;
-        if (ValidateResult(outResult, container))
+        if (PlayFabApiDispatch::ValidateResult(outResult, container))
         {            outResult.authenticationContext = std::make_shared<PlayFabAuthenticationContext>();
             outResult.authenticationContext->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             context->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             MultiStepClientLogin(context, outResult.SettingsForUser->NeedsAttribution);
 
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
+            const ProcessApiCallback<LoginResult>* callback = container.successCallback.Get<LoginResult>();
+            if (callback != nullptr)
             {
-                const auto& callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
+                (*callback)(outResult, container.GetCustomData());
             }
         }
     }
 
     void PlayFabClientAPI::LoginWithFacebook(
         LoginWithFacebookRequest& request,
-        const ProcessApiCallback<LoginResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
@@ -4673,28 +2410,21 @@ namespace PlayFab
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
         if (request.TitleId.empty())
         {
-            request.TitleId = settings->titleId;
+            request.TitleId = settings->GetTitleId();
         }
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
+        PlayFabRequestHeaders headers;
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LoginResult>(
             "/Client/LoginWithFacebook",
-            headers,
-            jsonAsString,
+            request,
+            std::move(headers),
             OnLoginWithFacebookResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::OnLoginWithFacebookResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
@@ -4703,25 +2433,24 @@ namespace PlayFab
         std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
 
         LoginResult outResult;
-        if (ValidateResult(outResult, container))
+        if (PlayFabApiDispatch::ValidateResult(outResult, container))
         {            outResult.authenticationContext = std::make_shared<PlayFabAuthenticationContext>();
             outResult.authenticationContext->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             context->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             MultiStepClientLogin(context, outResult.SettingsForUser->NeedsAttribution);
 
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
+            const ProcessApiCallback<LoginResult>* callback = container.successCallback.Get<LoginResult>();
+            if (callback != nullptr)
             {
-                const auto& callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
+                (*callback)(outResult, container.GetCustomData());
             }
         }
     }
 
     void PlayFabClientAPI::LoginWithFacebookInstantGamesId(
         LoginWithFacebookInstantGamesIdRequest& request,
-        const ProcessApiCallback<LoginResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
@@ -4729,28 +2458,21 @@ namespace PlayFab
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
         if (request.TitleId.empty())
         {
-            request.TitleId = settings->titleId;
+            request.TitleId = settings->GetTitleId();
         }
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
+        PlayFabRequestHeaders headers;
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LoginResult>(
             "/Client/LoginWithFacebookInstantGamesId",
-            headers,
-            jsonAsString,
+            request,
+            std::move(headers),
             OnLoginWithFacebookInstantGamesIdResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::OnLoginWithFacebookInstantGamesIdResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
@@ -4759,25 +2481,24 @@ namespace PlayFab
         std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
 
         LoginResult outResult;
-        if (ValidateResult(outResult, container))
+        if (PlayFabApiDispatch::ValidateResult(outResult, container))
         {            outResult.authenticationContext = std::make_shared<PlayFabAuthenticationContext>();
             outResult.authenticationContext->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             context->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             MultiStepClientLogin(context, outResult.SettingsForUser->NeedsAttribution);
 
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
+            const ProcessApiCallback<LoginResult>* callback = container.successCallback.Get<LoginResult>();
+            if (callback != nullptr)
             {
-                const auto& callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
+                (*callback)(outResult, container.GetCustomData());
             }
         }
     }
 
     void PlayFabClientAPI::LoginWithGameCenter(
         LoginWithGameCenterRequest& request,
-        const ProcessApiCallback<LoginResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
@@ -4785,28 +2506,21 @@ namespace PlayFab
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
         if (request.TitleId.empty())
         {
-            request.TitleId = settings->titleId;
+            request.TitleId = settings->GetTitleId();
         }
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
+        PlayFabRequestHeaders headers;
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LoginResult>(
             "/Client/LoginWithGameCenter",
-            headers,
-            jsonAsString,
+            request,
+            std::move(headers),
             OnLoginWithGameCenterResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::OnLoginWithGameCenterResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
@@ -4815,25 +2529,24 @@ namespace PlayFab
         std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
 
         LoginResult outResult;
-        if (ValidateResult(outResult, container))
+        if (PlayFabApiDispatch::ValidateResult(outResult, container))
         {            outResult.authenticationContext = std::make_shared<PlayFabAuthenticationContext>();
             outResult.authenticationContext->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             context->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             MultiStepClientLogin(context, outResult.SettingsForUser->NeedsAttribution);
 
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
+            const ProcessApiCallback<LoginResult>* callback = container.successCallback.Get<LoginResult>();
+            if (callback != nullptr)
             {
-                const auto& callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
+                (*callback)(outResult, container.GetCustomData());
             }
         }
     }
 
     void PlayFabClientAPI::LoginWithGoogleAccount(
         LoginWithGoogleAccountRequest& request,
-        const ProcessApiCallback<LoginResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
@@ -4841,28 +2554,21 @@ namespace PlayFab
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
         if (request.TitleId.empty())
         {
-            request.TitleId = settings->titleId;
+            request.TitleId = settings->GetTitleId();
         }
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
+        PlayFabRequestHeaders headers;
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LoginResult>(
             "/Client/LoginWithGoogleAccount",
-            headers,
-            jsonAsString,
+            request,
+            std::move(headers),
             OnLoginWithGoogleAccountResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::OnLoginWithGoogleAccountResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
@@ -4871,25 +2577,24 @@ namespace PlayFab
         std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
 
         LoginResult outResult;
-        if (ValidateResult(outResult, container))
+        if (PlayFabApiDispatch::ValidateResult(outResult, container))
         {            outResult.authenticationContext = std::make_shared<PlayFabAuthenticationContext>();
             outResult.authenticationContext->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             context->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             MultiStepClientLogin(context, outResult.SettingsForUser->NeedsAttribution);
 
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
+            const ProcessApiCallback<LoginResult>* callback = container.successCallback.Get<LoginResult>();
+            if (callback != nullptr)
             {
-                const auto& callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
+                (*callback)(outResult, container.GetCustomData());
             }
         }
     }
 
     void PlayFabClientAPI::LoginWithIOSDeviceID(
         LoginWithIOSDeviceIDRequest& request,
-        const ProcessApiCallback<LoginResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
@@ -4897,28 +2602,21 @@ namespace PlayFab
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
         if (request.TitleId.empty())
         {
-            request.TitleId = settings->titleId;
+            request.TitleId = settings->GetTitleId();
         }
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
+        PlayFabRequestHeaders headers;
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LoginResult>(
             "/Client/LoginWithIOSDeviceID",
-            headers,
-            jsonAsString,
+            request,
+            std::move(headers),
             OnLoginWithIOSDeviceIDResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::OnLoginWithIOSDeviceIDResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
@@ -4927,25 +2625,24 @@ namespace PlayFab
         std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
 
         LoginResult outResult;
-        if (ValidateResult(outResult, container))
+        if (PlayFabApiDispatch::ValidateResult(outResult, container))
         {            outResult.authenticationContext = std::make_shared<PlayFabAuthenticationContext>();
             outResult.authenticationContext->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             context->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             MultiStepClientLogin(context, outResult.SettingsForUser->NeedsAttribution);
 
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
+            const ProcessApiCallback<LoginResult>* callback = container.successCallback.Get<LoginResult>();
+            if (callback != nullptr)
             {
-                const auto& callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
+                (*callback)(outResult, container.GetCustomData());
             }
         }
     }
 
     void PlayFabClientAPI::LoginWithKongregate(
         LoginWithKongregateRequest& request,
-        const ProcessApiCallback<LoginResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
@@ -4953,28 +2650,21 @@ namespace PlayFab
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
         if (request.TitleId.empty())
         {
-            request.TitleId = settings->titleId;
+            request.TitleId = settings->GetTitleId();
         }
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
+        PlayFabRequestHeaders headers;
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LoginResult>(
             "/Client/LoginWithKongregate",
-            headers,
-            jsonAsString,
+            request,
+            std::move(headers),
             OnLoginWithKongregateResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::OnLoginWithKongregateResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
@@ -4983,25 +2673,24 @@ namespace PlayFab
         std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
 
         LoginResult outResult;
-        if (ValidateResult(outResult, container))
+        if (PlayFabApiDispatch::ValidateResult(outResult, container))
         {            outResult.authenticationContext = std::make_shared<PlayFabAuthenticationContext>();
             outResult.authenticationContext->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             context->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             MultiStepClientLogin(context, outResult.SettingsForUser->NeedsAttribution);
 
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
+            const ProcessApiCallback<LoginResult>* callback = container.successCallback.Get<LoginResult>();
+            if (callback != nullptr)
             {
-                const auto& callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
+                (*callback)(outResult, container.GetCustomData());
             }
         }
     }
 
     void PlayFabClientAPI::LoginWithNintendoServiceAccount(
         LoginWithNintendoServiceAccountRequest& request,
-        const ProcessApiCallback<LoginResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
@@ -5009,28 +2698,21 @@ namespace PlayFab
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
         if (request.TitleId.empty())
         {
-            request.TitleId = settings->titleId;
+            request.TitleId = settings->GetTitleId();
         }
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
+        PlayFabRequestHeaders headers;
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LoginResult>(
             "/Client/LoginWithNintendoServiceAccount",
-            headers,
-            jsonAsString,
+            request,
+            std::move(headers),
             OnLoginWithNintendoServiceAccountResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::OnLoginWithNintendoServiceAccountResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
@@ -5039,25 +2721,24 @@ namespace PlayFab
         std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
 
         LoginResult outResult;
-        if (ValidateResult(outResult, container))
+        if (PlayFabApiDispatch::ValidateResult(outResult, container))
         {            outResult.authenticationContext = std::make_shared<PlayFabAuthenticationContext>();
             outResult.authenticationContext->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             context->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             MultiStepClientLogin(context, outResult.SettingsForUser->NeedsAttribution);
 
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
+            const ProcessApiCallback<LoginResult>* callback = container.successCallback.Get<LoginResult>();
+            if (callback != nullptr)
             {
-                const auto& callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
+                (*callback)(outResult, container.GetCustomData());
             }
         }
     }
 
     void PlayFabClientAPI::LoginWithNintendoSwitchDeviceId(
         LoginWithNintendoSwitchDeviceIdRequest& request,
-        const ProcessApiCallback<LoginResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
@@ -5065,28 +2746,21 @@ namespace PlayFab
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
         if (request.TitleId.empty())
         {
-            request.TitleId = settings->titleId;
+            request.TitleId = settings->GetTitleId();
         }
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
+        PlayFabRequestHeaders headers;
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LoginResult>(
             "/Client/LoginWithNintendoSwitchDeviceId",
-            headers,
-            jsonAsString,
+            request,
+            std::move(headers),
             OnLoginWithNintendoSwitchDeviceIdResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::OnLoginWithNintendoSwitchDeviceIdResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
@@ -5095,25 +2769,24 @@ namespace PlayFab
         std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
 
         LoginResult outResult;
-        if (ValidateResult(outResult, container))
+        if (PlayFabApiDispatch::ValidateResult(outResult, container))
         {            outResult.authenticationContext = std::make_shared<PlayFabAuthenticationContext>();
             outResult.authenticationContext->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             context->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             MultiStepClientLogin(context, outResult.SettingsForUser->NeedsAttribution);
 
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
+            const ProcessApiCallback<LoginResult>* callback = container.successCallback.Get<LoginResult>();
+            if (callback != nullptr)
             {
-                const auto& callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
+                (*callback)(outResult, container.GetCustomData());
             }
         }
     }
 
     void PlayFabClientAPI::LoginWithOpenIdConnect(
         LoginWithOpenIdConnectRequest& request,
-        const ProcessApiCallback<LoginResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
@@ -5121,28 +2794,21 @@ namespace PlayFab
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
         if (request.TitleId.empty())
         {
-            request.TitleId = settings->titleId;
+            request.TitleId = settings->GetTitleId();
         }
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
+        PlayFabRequestHeaders headers;
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LoginResult>(
             "/Client/LoginWithOpenIdConnect",
-            headers,
-            jsonAsString,
+            request,
+            std::move(headers),
             OnLoginWithOpenIdConnectResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::OnLoginWithOpenIdConnectResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
@@ -5151,25 +2817,24 @@ namespace PlayFab
         std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
 
         LoginResult outResult;
-        if (ValidateResult(outResult, container))
+        if (PlayFabApiDispatch::ValidateResult(outResult, container))
         {            outResult.authenticationContext = std::make_shared<PlayFabAuthenticationContext>();
             outResult.authenticationContext->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             context->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             MultiStepClientLogin(context, outResult.SettingsForUser->NeedsAttribution);
 
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
+            const ProcessApiCallback<LoginResult>* callback = container.successCallback.Get<LoginResult>();
+            if (callback != nullptr)
             {
-                const auto& callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
+                (*callback)(outResult, container.GetCustomData());
             }
         }
     }
 
     void PlayFabClientAPI::LoginWithPlayFab(
         LoginWithPlayFabRequest& request,
-        const ProcessApiCallback<LoginResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
@@ -5177,28 +2842,21 @@ namespace PlayFab
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
         if (request.TitleId.empty())
         {
-            request.TitleId = settings->titleId;
+            request.TitleId = settings->GetTitleId();
         }
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
+        PlayFabRequestHeaders headers;
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LoginResult>(
             "/Client/LoginWithPlayFab",
-            headers,
-            jsonAsString,
+            request,
+            std::move(headers),
             OnLoginWithPlayFabResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::OnLoginWithPlayFabResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
@@ -5207,25 +2865,24 @@ namespace PlayFab
         std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
 
         LoginResult outResult;
-        if (ValidateResult(outResult, container))
+        if (PlayFabApiDispatch::ValidateResult(outResult, container))
         {            outResult.authenticationContext = std::make_shared<PlayFabAuthenticationContext>();
             outResult.authenticationContext->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             context->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             MultiStepClientLogin(context, outResult.SettingsForUser->NeedsAttribution);
 
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
+            const ProcessApiCallback<LoginResult>* callback = container.successCallback.Get<LoginResult>();
+            if (callback != nullptr)
             {
-                const auto& callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
+                (*callback)(outResult, container.GetCustomData());
             }
         }
     }
 
     void PlayFabClientAPI::LoginWithPSN(
         LoginWithPSNRequest& request,
-        const ProcessApiCallback<LoginResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
@@ -5233,28 +2890,21 @@ namespace PlayFab
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
         if (request.TitleId.empty())
         {
-            request.TitleId = settings->titleId;
+            request.TitleId = settings->GetTitleId();
         }
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
+        PlayFabRequestHeaders headers;
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LoginResult>(
             "/Client/LoginWithPSN",
-            headers,
-            jsonAsString,
+            request,
+            std::move(headers),
             OnLoginWithPSNResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::OnLoginWithPSNResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
@@ -5263,25 +2913,24 @@ namespace PlayFab
         std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
 
         LoginResult outResult;
-        if (ValidateResult(outResult, container))
+        if (PlayFabApiDispatch::ValidateResult(outResult, container))
         {            outResult.authenticationContext = std::make_shared<PlayFabAuthenticationContext>();
             outResult.authenticationContext->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             context->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             MultiStepClientLogin(context, outResult.SettingsForUser->NeedsAttribution);
 
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
+            const ProcessApiCallback<LoginResult>* callback = container.successCallback.Get<LoginResult>();
+            if (callback != nullptr)
             {
-                const auto& callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
+                (*callback)(outResult, container.GetCustomData());
             }
         }
     }
 
     void PlayFabClientAPI::LoginWithSteam(
         LoginWithSteamRequest& request,
-        const ProcessApiCallback<LoginResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
@@ -5289,28 +2938,21 @@ namespace PlayFab
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
         if (request.TitleId.empty())
         {
-            request.TitleId = settings->titleId;
+            request.TitleId = settings->GetTitleId();
         }
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
+        PlayFabRequestHeaders headers;
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LoginResult>(
             "/Client/LoginWithSteam",
-            headers,
-            jsonAsString,
+            request,
+            std::move(headers),
             OnLoginWithSteamResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::OnLoginWithSteamResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
@@ -5319,25 +2961,24 @@ namespace PlayFab
         std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
 
         LoginResult outResult;
-        if (ValidateResult(outResult, container))
+        if (PlayFabApiDispatch::ValidateResult(outResult, container))
         {            outResult.authenticationContext = std::make_shared<PlayFabAuthenticationContext>();
             outResult.authenticationContext->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             context->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             MultiStepClientLogin(context, outResult.SettingsForUser->NeedsAttribution);
 
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
+            const ProcessApiCallback<LoginResult>* callback = container.successCallback.Get<LoginResult>();
+            if (callback != nullptr)
             {
-                const auto& callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
+                (*callback)(outResult, container.GetCustomData());
             }
         }
     }
 
     void PlayFabClientAPI::LoginWithTwitch(
         LoginWithTwitchRequest& request,
-        const ProcessApiCallback<LoginResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
@@ -5345,28 +2986,21 @@ namespace PlayFab
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
         if (request.TitleId.empty())
         {
-            request.TitleId = settings->titleId;
+            request.TitleId = settings->GetTitleId();
         }
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
+        PlayFabRequestHeaders headers;
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LoginResult>(
             "/Client/LoginWithTwitch",
-            headers,
-            jsonAsString,
+            request,
+            std::move(headers),
             OnLoginWithTwitchResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::OnLoginWithTwitchResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
@@ -5375,25 +3009,24 @@ namespace PlayFab
         std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
 
         LoginResult outResult;
-        if (ValidateResult(outResult, container))
+        if (PlayFabApiDispatch::ValidateResult(outResult, container))
         {            outResult.authenticationContext = std::make_shared<PlayFabAuthenticationContext>();
             outResult.authenticationContext->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             context->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             MultiStepClientLogin(context, outResult.SettingsForUser->NeedsAttribution);
 
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
+            const ProcessApiCallback<LoginResult>* callback = container.successCallback.Get<LoginResult>();
+            if (callback != nullptr)
             {
-                const auto& callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
+                (*callback)(outResult, container.GetCustomData());
             }
         }
     }
 
     void PlayFabClientAPI::LoginWithWindowsHello(
         LoginWithWindowsHelloRequest& request,
-        const ProcessApiCallback<LoginResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
@@ -5401,28 +3034,21 @@ namespace PlayFab
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
         if (request.TitleId.empty())
         {
-            request.TitleId = settings->titleId;
+            request.TitleId = settings->GetTitleId();
         }
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
+        PlayFabRequestHeaders headers;
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LoginResult>(
             "/Client/LoginWithWindowsHello",
-            headers,
-            jsonAsString,
+            request,
+            std::move(headers),
             OnLoginWithWindowsHelloResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::OnLoginWithWindowsHelloResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
@@ -5431,25 +3057,24 @@ namespace PlayFab
         std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
 
         LoginResult outResult;
-        if (ValidateResult(outResult, container))
+        if (PlayFabApiDispatch::ValidateResult(outResult, container))
         {            outResult.authenticationContext = std::make_shared<PlayFabAuthenticationContext>();
             outResult.authenticationContext->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             context->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             MultiStepClientLogin(context, outResult.SettingsForUser->NeedsAttribution);
 
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
+            const ProcessApiCallback<LoginResult>* callback = container.successCallback.Get<LoginResult>();
+            if (callback != nullptr)
             {
-                const auto& callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
+                (*callback)(outResult, container.GetCustomData());
             }
         }
     }
 
     void PlayFabClientAPI::LoginWithXbox(
         LoginWithXboxRequest& request,
-        const ProcessApiCallback<LoginResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
@@ -5457,28 +3082,21 @@ namespace PlayFab
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
         if (request.TitleId.empty())
         {
-            request.TitleId = settings->titleId;
+            request.TitleId = settings->GetTitleId();
         }
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
+        PlayFabRequestHeaders headers;
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LoginResult>(
             "/Client/LoginWithXbox",
-            headers,
-            jsonAsString,
+            request,
+            std::move(headers),
             OnLoginWithXboxResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::OnLoginWithXboxResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
@@ -5487,368 +3105,192 @@ namespace PlayFab
         std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
 
         LoginResult outResult;
-        if (ValidateResult(outResult, container))
+        if (PlayFabApiDispatch::ValidateResult(outResult, container))
         {            outResult.authenticationContext = std::make_shared<PlayFabAuthenticationContext>();
             outResult.authenticationContext->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             context->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             MultiStepClientLogin(context, outResult.SettingsForUser->NeedsAttribution);
 
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
+            const ProcessApiCallback<LoginResult>* callback = container.successCallback.Get<LoginResult>();
+            if (callback != nullptr)
             {
-                const auto& callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
+                (*callback)(outResult, container.GetCustomData());
             }
         }
     }
 
     void PlayFabClientAPI::Matchmake(
         MatchmakeRequest& request,
-        const ProcessApiCallback<MatchmakeResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<MatchmakeResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<MatchmakeResult>(
             "/Client/Matchmake",
-            headers,
-            jsonAsString,
-            OnMatchmakeResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<MatchmakeResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnMatchmakeResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        MatchmakeResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<MatchmakeResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::OpenTrade(
         OpenTradeRequest& request,
-        const ProcessApiCallback<OpenTradeResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<OpenTradeResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<OpenTradeResponse>(
             "/Client/OpenTrade",
-            headers,
-            jsonAsString,
-            OnOpenTradeResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<OpenTradeResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnOpenTradeResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        OpenTradeResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<OpenTradeResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::PayForPurchase(
         PayForPurchaseRequest& request,
-        const ProcessApiCallback<PayForPurchaseResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<PayForPurchaseResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<PayForPurchaseResult>(
             "/Client/PayForPurchase",
-            headers,
-            jsonAsString,
-            OnPayForPurchaseResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<PayForPurchaseResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnPayForPurchaseResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        PayForPurchaseResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<PayForPurchaseResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::PurchaseItem(
         PurchaseItemRequest& request,
-        const ProcessApiCallback<PurchaseItemResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<PurchaseItemResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
-        std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
-
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
-
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
-            "/Client/PurchaseItem",
-            headers,
-            jsonAsString,
-            OnPurchaseItemResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<PurchaseItemResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnPurchaseItemResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
+        std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        PurchaseItemResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<PurchaseItemResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
+
+        PlayFabApiDispatch::MakeApiCall<PurchaseItemResult>(
+            "/Client/PurchaseItem",
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::RedeemCoupon(
         RedeemCouponRequest& request,
-        const ProcessApiCallback<RedeemCouponResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<RedeemCouponResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<RedeemCouponResult>(
             "/Client/RedeemCoupon",
-            headers,
-            jsonAsString,
-            OnRedeemCouponResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<RedeemCouponResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnRedeemCouponResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        RedeemCouponResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<RedeemCouponResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::RefreshPSNAuthToken(
         RefreshPSNAuthTokenRequest& request,
-        const ProcessApiCallback<EmptyResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<EmptyResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<EmptyResponse>(
             "/Client/RefreshPSNAuthToken",
-            headers,
-            jsonAsString,
-            OnRefreshPSNAuthTokenResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnRefreshPSNAuthTokenResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        EmptyResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<EmptyResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::RegisterForIOSPushNotification(
         RegisterForIOSPushNotificationRequest& request,
-        const ProcessApiCallback<RegisterForIOSPushNotificationResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<RegisterForIOSPushNotificationResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<RegisterForIOSPushNotificationResult>(
             "/Client/RegisterForIOSPushNotification",
-            headers,
-            jsonAsString,
-            OnRegisterForIOSPushNotificationResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<RegisterForIOSPushNotificationResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnRegisterForIOSPushNotificationResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        RegisterForIOSPushNotificationResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<RegisterForIOSPushNotificationResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::RegisterPlayFabUser(
         RegisterPlayFabUserRequest& request,
-        const ProcessApiCallback<RegisterPlayFabUserResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<RegisterPlayFabUserResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
@@ -5856,28 +3298,21 @@ namespace PlayFab
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
         if (request.TitleId.empty())
         {
-            request.TitleId = settings->titleId;
+            request.TitleId = settings->GetTitleId();
         }
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
+        PlayFabRequestHeaders headers;
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<RegisterPlayFabUserResult>(
             "/Client/RegisterPlayFabUser",
-            headers,
-            jsonAsString,
+            request,
+            std::move(headers),
             OnRegisterPlayFabUserResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<RegisterPlayFabUserResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::OnRegisterPlayFabUserResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
@@ -5886,23 +3321,22 @@ namespace PlayFab
         std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
 
         RegisterPlayFabUserResult outResult;
-        if (ValidateResult(outResult, container))
+        if (PlayFabApiDispatch::ValidateResult(outResult, container))
         {            context->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             MultiStepClientLogin(context, outResult.SettingsForUser->NeedsAttribution);
 
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
+            const ProcessApiCallback<RegisterPlayFabUserResult>* callback = container.successCallback.Get<RegisterPlayFabUserResult>();
+            if (callback != nullptr)
             {
-                const auto& callback = (*static_cast<ProcessApiCallback<RegisterPlayFabUserResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
+                (*callback)(outResult, container.GetCustomData());
             }
         }
     }
 
     void PlayFabClientAPI::RegisterWithWindowsHello(
         RegisterWithWindowsHelloRequest& request,
-        const ProcessApiCallback<LoginResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<LoginResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
@@ -5910,28 +3344,21 @@ namespace PlayFab
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
         if (request.TitleId.empty())
         {
-            request.TitleId = settings->titleId;
+            request.TitleId = settings->GetTitleId();
         }
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
+        PlayFabRequestHeaders headers;
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<LoginResult>(
             "/Client/RegisterWithWindowsHello",
-            headers,
-            jsonAsString,
+            request,
+            std::move(headers),
             OnRegisterWithWindowsHelloResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<LoginResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::OnRegisterWithWindowsHelloResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
@@ -5940,2419 +3367,1193 @@ namespace PlayFab
         std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
 
         LoginResult outResult;
-        if (ValidateResult(outResult, container))
+        if (PlayFabApiDispatch::ValidateResult(outResult, container))
         {            outResult.authenticationContext = std::make_shared<PlayFabAuthenticationContext>();
             outResult.authenticationContext->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             context->HandlePlayFabLogin(outResult.PlayFabId, outResult.SessionTicket, outResult.EntityToken->Entity->Id, outResult.EntityToken->Entity->Type, outResult.EntityToken->EntityToken);
             MultiStepClientLogin(context, outResult.SettingsForUser->NeedsAttribution);
 
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
+            const ProcessApiCallback<LoginResult>* callback = container.successCallback.Get<LoginResult>();
+            if (callback != nullptr)
             {
-                const auto& callback = (*static_cast<ProcessApiCallback<LoginResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
+                (*callback)(outResult, container.GetCustomData());
             }
         }
     }
 
     void PlayFabClientAPI::RemoveContactEmail(
         RemoveContactEmailRequest& request,
-        const ProcessApiCallback<RemoveContactEmailResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<RemoveContactEmailResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<RemoveContactEmailResult>(
             "/Client/RemoveContactEmail",
-            headers,
-            jsonAsString,
-            OnRemoveContactEmailResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<RemoveContactEmailResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnRemoveContactEmailResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        RemoveContactEmailResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<RemoveContactEmailResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::RemoveFriend(
         RemoveFriendRequest& request,
-        const ProcessApiCallback<RemoveFriendResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<RemoveFriendResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<RemoveFriendResult>(
             "/Client/RemoveFriend",
-            headers,
-            jsonAsString,
-            OnRemoveFriendResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<RemoveFriendResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnRemoveFriendResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        RemoveFriendResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<RemoveFriendResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::RemoveGenericID(
         RemoveGenericIDRequest& request,
-        const ProcessApiCallback<RemoveGenericIDResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<RemoveGenericIDResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<RemoveGenericIDResult>(
             "/Client/RemoveGenericID",
-            headers,
-            jsonAsString,
-            OnRemoveGenericIDResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<RemoveGenericIDResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnRemoveGenericIDResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        RemoveGenericIDResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<RemoveGenericIDResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::RemoveSharedGroupMembers(
         RemoveSharedGroupMembersRequest& request,
-        const ProcessApiCallback<RemoveSharedGroupMembersResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<RemoveSharedGroupMembersResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<RemoveSharedGroupMembersResult>(
             "/Client/RemoveSharedGroupMembers",
-            headers,
-            jsonAsString,
-            OnRemoveSharedGroupMembersResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<RemoveSharedGroupMembersResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnRemoveSharedGroupMembersResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        RemoveSharedGroupMembersResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<RemoveSharedGroupMembersResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::ReportAdActivity(
         ReportAdActivityRequest& request,
-        const ProcessApiCallback<ReportAdActivityResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ReportAdActivityResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ReportAdActivityResult>(
             "/Client/ReportAdActivity",
-            headers,
-            jsonAsString,
-            OnReportAdActivityResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ReportAdActivityResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnReportAdActivityResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ReportAdActivityResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<ReportAdActivityResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::ReportDeviceInfo(
         DeviceInfoRequest& request,
-        const ProcessApiCallback<EmptyResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<EmptyResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<EmptyResponse>(
             "/Client/ReportDeviceInfo",
-            headers,
-            jsonAsString,
-            OnReportDeviceInfoResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnReportDeviceInfoResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        EmptyResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<EmptyResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::ReportPlayer(
         ReportPlayerClientRequest& request,
-        const ProcessApiCallback<ReportPlayerClientResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ReportPlayerClientResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ReportPlayerClientResult>(
             "/Client/ReportPlayer",
-            headers,
-            jsonAsString,
-            OnReportPlayerResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ReportPlayerClientResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnReportPlayerResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ReportPlayerClientResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<ReportPlayerClientResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::RestoreIOSPurchases(
         RestoreIOSPurchasesRequest& request,
-        const ProcessApiCallback<RestoreIOSPurchasesResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<RestoreIOSPurchasesResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<RestoreIOSPurchasesResult>(
             "/Client/RestoreIOSPurchases",
-            headers,
-            jsonAsString,
-            OnRestoreIOSPurchasesResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<RestoreIOSPurchasesResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnRestoreIOSPurchasesResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        RestoreIOSPurchasesResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<RestoreIOSPurchasesResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::RewardAdActivity(
         RewardAdActivityRequest& request,
-        const ProcessApiCallback<RewardAdActivityResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<RewardAdActivityResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<RewardAdActivityResult>(
             "/Client/RewardAdActivity",
-            headers,
-            jsonAsString,
-            OnRewardAdActivityResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<RewardAdActivityResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnRewardAdActivityResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        RewardAdActivityResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<RewardAdActivityResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::SendAccountRecoveryEmail(
         SendAccountRecoveryEmailRequest& request,
-        const ProcessApiCallback<SendAccountRecoveryEmailResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<SendAccountRecoveryEmailResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
+        PlayFabRequestHeaders headers;
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<SendAccountRecoveryEmailResult>(
             "/Client/SendAccountRecoveryEmail",
-            headers,
-            jsonAsString,
-            OnSendAccountRecoveryEmailResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<SendAccountRecoveryEmailResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnSendAccountRecoveryEmailResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        SendAccountRecoveryEmailResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<SendAccountRecoveryEmailResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::SetFriendTags(
         SetFriendTagsRequest& request,
-        const ProcessApiCallback<SetFriendTagsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<SetFriendTagsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<SetFriendTagsResult>(
             "/Client/SetFriendTags",
-            headers,
-            jsonAsString,
-            OnSetFriendTagsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<SetFriendTagsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnSetFriendTagsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        SetFriendTagsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<SetFriendTagsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::SetPlayerSecret(
         SetPlayerSecretRequest& request,
-        const ProcessApiCallback<SetPlayerSecretResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<SetPlayerSecretResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<SetPlayerSecretResult>(
             "/Client/SetPlayerSecret",
-            headers,
-            jsonAsString,
-            OnSetPlayerSecretResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<SetPlayerSecretResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnSetPlayerSecretResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        SetPlayerSecretResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<SetPlayerSecretResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::StartGame(
         StartGameRequest& request,
-        const ProcessApiCallback<StartGameResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<StartGameResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<StartGameResult>(
             "/Client/StartGame",
-            headers,
-            jsonAsString,
-            OnStartGameResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<StartGameResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnStartGameResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        StartGameResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<StartGameResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::StartPurchase(
         StartPurchaseRequest& request,
-        const ProcessApiCallback<StartPurchaseResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<StartPurchaseResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
-
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
-
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
-            "/Client/StartPurchase",
-            headers,
-            jsonAsString,
-            OnStartPurchaseResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<StartPurchaseResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnStartPurchaseResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        StartPurchaseResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<StartPurchaseResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
+
+        PlayFabApiDispatch::MakeApiCall<StartPurchaseResult>(
+            "/Client/StartPurchase",
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::SubtractUserVirtualCurrency(
         SubtractUserVirtualCurrencyRequest& request,
-        const ProcessApiCallback<ModifyUserVirtualCurrencyResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ModifyUserVirtualCurrencyResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ModifyUserVirtualCurrencyResult>(
             "/Client/SubtractUserVirtualCurrency",
-            headers,
-            jsonAsString,
-            OnSubtractUserVirtualCurrencyResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ModifyUserVirtualCurrencyResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnSubtractUserVirtualCurrencyResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ModifyUserVirtualCurrencyResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<ModifyUserVirtualCurrencyResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::UnlinkAndroidDeviceID(
         UnlinkAndroidDeviceIDRequest& request,
-        const ProcessApiCallback<UnlinkAndroidDeviceIDResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UnlinkAndroidDeviceIDResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UnlinkAndroidDeviceIDResult>(
             "/Client/UnlinkAndroidDeviceID",
-            headers,
-            jsonAsString,
-            OnUnlinkAndroidDeviceIDResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkAndroidDeviceIDResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnUnlinkAndroidDeviceIDResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UnlinkAndroidDeviceIDResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UnlinkAndroidDeviceIDResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::UnlinkApple(
         UnlinkAppleRequest& request,
-        const ProcessApiCallback<EmptyResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<EmptyResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<EmptyResponse>(
             "/Client/UnlinkApple",
-            headers,
-            jsonAsString,
-            OnUnlinkAppleResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnUnlinkAppleResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        EmptyResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<EmptyResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::UnlinkCustomID(
         UnlinkCustomIDRequest& request,
-        const ProcessApiCallback<UnlinkCustomIDResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UnlinkCustomIDResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UnlinkCustomIDResult>(
             "/Client/UnlinkCustomID",
-            headers,
-            jsonAsString,
-            OnUnlinkCustomIDResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkCustomIDResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnUnlinkCustomIDResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UnlinkCustomIDResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UnlinkCustomIDResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::UnlinkFacebookAccount(
         UnlinkFacebookAccountRequest& request,
-        const ProcessApiCallback<UnlinkFacebookAccountResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UnlinkFacebookAccountResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UnlinkFacebookAccountResult>(
             "/Client/UnlinkFacebookAccount",
-            headers,
-            jsonAsString,
-            OnUnlinkFacebookAccountResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkFacebookAccountResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnUnlinkFacebookAccountResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UnlinkFacebookAccountResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UnlinkFacebookAccountResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::UnlinkFacebookInstantGamesId(
         UnlinkFacebookInstantGamesIdRequest& request,
-        const ProcessApiCallback<UnlinkFacebookInstantGamesIdResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UnlinkFacebookInstantGamesIdResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UnlinkFacebookInstantGamesIdResult>(
             "/Client/UnlinkFacebookInstantGamesId",
-            headers,
-            jsonAsString,
-            OnUnlinkFacebookInstantGamesIdResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkFacebookInstantGamesIdResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnUnlinkFacebookInstantGamesIdResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UnlinkFacebookInstantGamesIdResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UnlinkFacebookInstantGamesIdResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::UnlinkGameCenterAccount(
         UnlinkGameCenterAccountRequest& request,
-        const ProcessApiCallback<UnlinkGameCenterAccountResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UnlinkGameCenterAccountResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UnlinkGameCenterAccountResult>(
             "/Client/UnlinkGameCenterAccount",
-            headers,
-            jsonAsString,
-            OnUnlinkGameCenterAccountResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkGameCenterAccountResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnUnlinkGameCenterAccountResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UnlinkGameCenterAccountResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UnlinkGameCenterAccountResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::UnlinkGoogleAccount(
         UnlinkGoogleAccountRequest& request,
-        const ProcessApiCallback<UnlinkGoogleAccountResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UnlinkGoogleAccountResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UnlinkGoogleAccountResult>(
             "/Client/UnlinkGoogleAccount",
-            headers,
-            jsonAsString,
-            OnUnlinkGoogleAccountResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkGoogleAccountResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnUnlinkGoogleAccountResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UnlinkGoogleAccountResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UnlinkGoogleAccountResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::UnlinkIOSDeviceID(
         UnlinkIOSDeviceIDRequest& request,
-        const ProcessApiCallback<UnlinkIOSDeviceIDResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UnlinkIOSDeviceIDResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UnlinkIOSDeviceIDResult>(
             "/Client/UnlinkIOSDeviceID",
-            headers,
-            jsonAsString,
-            OnUnlinkIOSDeviceIDResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkIOSDeviceIDResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnUnlinkIOSDeviceIDResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UnlinkIOSDeviceIDResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UnlinkIOSDeviceIDResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::UnlinkKongregate(
         UnlinkKongregateAccountRequest& request,
-        const ProcessApiCallback<UnlinkKongregateAccountResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UnlinkKongregateAccountResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UnlinkKongregateAccountResult>(
             "/Client/UnlinkKongregate",
-            headers,
-            jsonAsString,
-            OnUnlinkKongregateResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkKongregateAccountResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnUnlinkKongregateResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UnlinkKongregateAccountResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UnlinkKongregateAccountResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::UnlinkNintendoServiceAccount(
         UnlinkNintendoServiceAccountRequest& request,
-        const ProcessApiCallback<EmptyResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<EmptyResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<EmptyResponse>(
             "/Client/UnlinkNintendoServiceAccount",
-            headers,
-            jsonAsString,
-            OnUnlinkNintendoServiceAccountResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnUnlinkNintendoServiceAccountResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        EmptyResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<EmptyResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::UnlinkNintendoSwitchDeviceId(
         UnlinkNintendoSwitchDeviceIdRequest& request,
-        const ProcessApiCallback<UnlinkNintendoSwitchDeviceIdResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UnlinkNintendoSwitchDeviceIdResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UnlinkNintendoSwitchDeviceIdResult>(
             "/Client/UnlinkNintendoSwitchDeviceId",
-            headers,
-            jsonAsString,
-            OnUnlinkNintendoSwitchDeviceIdResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkNintendoSwitchDeviceIdResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnUnlinkNintendoSwitchDeviceIdResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UnlinkNintendoSwitchDeviceIdResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UnlinkNintendoSwitchDeviceIdResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::UnlinkOpenIdConnect(
         UnlinkOpenIdConnectRequest& request,
-        const ProcessApiCallback<EmptyResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<EmptyResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<EmptyResponse>(
             "/Client/UnlinkOpenIdConnect",
-            headers,
-            jsonAsString,
-            OnUnlinkOpenIdConnectResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnUnlinkOpenIdConnectResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        EmptyResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<EmptyResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::UnlinkPSNAccount(
         UnlinkPSNAccountRequest& request,
-        const ProcessApiCallback<UnlinkPSNAccountResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UnlinkPSNAccountResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UnlinkPSNAccountResult>(
             "/Client/UnlinkPSNAccount",
-            headers,
-            jsonAsString,
-            OnUnlinkPSNAccountResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkPSNAccountResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnUnlinkPSNAccountResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UnlinkPSNAccountResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UnlinkPSNAccountResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::UnlinkSteamAccount(
         UnlinkSteamAccountRequest& request,
-        const ProcessApiCallback<UnlinkSteamAccountResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UnlinkSteamAccountResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UnlinkSteamAccountResult>(
             "/Client/UnlinkSteamAccount",
-            headers,
-            jsonAsString,
-            OnUnlinkSteamAccountResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkSteamAccountResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnUnlinkSteamAccountResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UnlinkSteamAccountResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UnlinkSteamAccountResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::UnlinkTwitch(
         UnlinkTwitchAccountRequest& request,
-        const ProcessApiCallback<UnlinkTwitchAccountResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UnlinkTwitchAccountResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UnlinkTwitchAccountResult>(
             "/Client/UnlinkTwitch",
-            headers,
-            jsonAsString,
-            OnUnlinkTwitchResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkTwitchAccountResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnUnlinkTwitchResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UnlinkTwitchAccountResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UnlinkTwitchAccountResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::UnlinkWindowsHello(
         UnlinkWindowsHelloAccountRequest& request,
-        const ProcessApiCallback<UnlinkWindowsHelloAccountResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UnlinkWindowsHelloAccountResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UnlinkWindowsHelloAccountResponse>(
             "/Client/UnlinkWindowsHello",
-            headers,
-            jsonAsString,
-            OnUnlinkWindowsHelloResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkWindowsHelloAccountResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnUnlinkWindowsHelloResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UnlinkWindowsHelloAccountResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UnlinkWindowsHelloAccountResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::UnlinkXboxAccount(
         UnlinkXboxAccountRequest& request,
-        const ProcessApiCallback<UnlinkXboxAccountResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UnlinkXboxAccountResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
-
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
-            "/Client/UnlinkXboxAccount",
-            headers,
-            jsonAsString,
-            OnUnlinkXboxAccountResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlinkXboxAccountResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnUnlinkXboxAccountResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        UnlinkXboxAccountResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UnlinkXboxAccountResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+        PlayFabApiDispatch::MakeApiCall<UnlinkXboxAccountResult>(
+            "/Client/UnlinkXboxAccount",
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::UnlockContainerInstance(
         UnlockContainerInstanceRequest& request,
-        const ProcessApiCallback<UnlockContainerItemResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UnlockContainerItemResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UnlockContainerItemResult>(
             "/Client/UnlockContainerInstance",
-            headers,
-            jsonAsString,
-            OnUnlockContainerInstanceResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlockContainerItemResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnUnlockContainerInstanceResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UnlockContainerItemResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UnlockContainerItemResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::UnlockContainerItem(
         UnlockContainerItemRequest& request,
-        const ProcessApiCallback<UnlockContainerItemResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UnlockContainerItemResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UnlockContainerItemResult>(
             "/Client/UnlockContainerItem",
-            headers,
-            jsonAsString,
-            OnUnlockContainerItemResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UnlockContainerItemResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnUnlockContainerItemResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UnlockContainerItemResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UnlockContainerItemResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::UpdateAvatarUrl(
         UpdateAvatarUrlRequest& request,
-        const ProcessApiCallback<EmptyResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<EmptyResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<EmptyResponse>(
             "/Client/UpdateAvatarUrl",
-            headers,
-            jsonAsString,
-            OnUpdateAvatarUrlResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<EmptyResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnUpdateAvatarUrlResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        EmptyResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<EmptyResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::UpdateCharacterData(
         UpdateCharacterDataRequest& request,
-        const ProcessApiCallback<UpdateCharacterDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateCharacterDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateCharacterDataResult>(
             "/Client/UpdateCharacterData",
-            headers,
-            jsonAsString,
-            OnUpdateCharacterDataResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCharacterDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnUpdateCharacterDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateCharacterDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UpdateCharacterDataResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::UpdateCharacterStatistics(
         UpdateCharacterStatisticsRequest& request,
-        const ProcessApiCallback<UpdateCharacterStatisticsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateCharacterStatisticsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateCharacterStatisticsResult>(
             "/Client/UpdateCharacterStatistics",
-            headers,
-            jsonAsString,
-            OnUpdateCharacterStatisticsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateCharacterStatisticsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnUpdateCharacterStatisticsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateCharacterStatisticsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UpdateCharacterStatisticsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::UpdatePlayerStatistics(
         UpdatePlayerStatisticsRequest& request,
-        const ProcessApiCallback<UpdatePlayerStatisticsResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdatePlayerStatisticsResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdatePlayerStatisticsResult>(
             "/Client/UpdatePlayerStatistics",
-            headers,
-            jsonAsString,
-            OnUpdatePlayerStatisticsResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdatePlayerStatisticsResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnUpdatePlayerStatisticsResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdatePlayerStatisticsResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UpdatePlayerStatisticsResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::UpdateSharedGroupData(
         UpdateSharedGroupDataRequest& request,
-        const ProcessApiCallback<UpdateSharedGroupDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateSharedGroupDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateSharedGroupDataResult>(
             "/Client/UpdateSharedGroupData",
-            headers,
-            jsonAsString,
-            OnUpdateSharedGroupDataResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateSharedGroupDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnUpdateSharedGroupDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateSharedGroupDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UpdateSharedGroupDataResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::UpdateUserData(
         UpdateUserDataRequest& request,
-        const ProcessApiCallback<UpdateUserDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateUserDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateUserDataResult>(
             "/Client/UpdateUserData",
-            headers,
-            jsonAsString,
-            OnUpdateUserDataResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnUpdateUserDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateUserDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UpdateUserDataResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::UpdateUserPublisherData(
         UpdateUserDataRequest& request,
-        const ProcessApiCallback<UpdateUserDataResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateUserDataResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateUserDataResult>(
             "/Client/UpdateUserPublisherData",
-            headers,
-            jsonAsString,
-            OnUpdateUserPublisherDataResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserDataResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnUpdateUserPublisherDataResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateUserDataResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UpdateUserDataResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::UpdateUserTitleDisplayName(
         UpdateUserTitleDisplayNameRequest& request,
-        const ProcessApiCallback<UpdateUserTitleDisplayNameResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<UpdateUserTitleDisplayNameResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<UpdateUserTitleDisplayNameResult>(
             "/Client/UpdateUserTitleDisplayName",
-            headers,
-            jsonAsString,
-            OnUpdateUserTitleDisplayNameResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<UpdateUserTitleDisplayNameResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnUpdateUserTitleDisplayNameResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        UpdateUserTitleDisplayNameResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<UpdateUserTitleDisplayNameResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::ValidateAmazonIAPReceipt(
         ValidateAmazonReceiptRequest& request,
-        const ProcessApiCallback<ValidateAmazonReceiptResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ValidateAmazonReceiptResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ValidateAmazonReceiptResult>(
             "/Client/ValidateAmazonIAPReceipt",
-            headers,
-            jsonAsString,
-            OnValidateAmazonIAPReceiptResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ValidateAmazonReceiptResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnValidateAmazonIAPReceiptResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ValidateAmazonReceiptResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<ValidateAmazonReceiptResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::ValidateGooglePlayPurchase(
         ValidateGooglePlayPurchaseRequest& request,
-        const ProcessApiCallback<ValidateGooglePlayPurchaseResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ValidateGooglePlayPurchaseResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ValidateGooglePlayPurchaseResult>(
             "/Client/ValidateGooglePlayPurchase",
-            headers,
-            jsonAsString,
-            OnValidateGooglePlayPurchaseResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ValidateGooglePlayPurchaseResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnValidateGooglePlayPurchaseResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ValidateGooglePlayPurchaseResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<ValidateGooglePlayPurchaseResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::ValidateIOSReceipt(
         ValidateIOSReceiptRequest& request,
-        const ProcessApiCallback<ValidateIOSReceiptResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ValidateIOSReceiptResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ValidateIOSReceiptResult>(
             "/Client/ValidateIOSReceipt",
-            headers,
-            jsonAsString,
-            OnValidateIOSReceiptResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ValidateIOSReceiptResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnValidateIOSReceiptResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ValidateIOSReceiptResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<ValidateIOSReceiptResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::ValidateWindowsStoreReceipt(
         ValidateWindowsReceiptRequest& request,
-        const ProcessApiCallback<ValidateWindowsReceiptResult> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<ValidateWindowsReceiptResult> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<ValidateWindowsReceiptResult>(
             "/Client/ValidateWindowsStoreReceipt",
-            headers,
-            jsonAsString,
-            OnValidateWindowsStoreReceiptResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<ValidateWindowsReceiptResult>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnValidateWindowsStoreReceiptResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        ValidateWindowsReceiptResult outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<ValidateWindowsReceiptResult> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::WriteCharacterEvent(
         WriteClientCharacterEventRequest& request,
-        const ProcessApiCallback<WriteEventResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<WriteEventResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<WriteEventResponse>(
             "/Client/WriteCharacterEvent",
-            headers,
-            jsonAsString,
-            OnWriteCharacterEventResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<WriteEventResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnWriteCharacterEventResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        WriteEventResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<WriteEventResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::WritePlayerEvent(
         WriteClientPlayerEventRequest& request,
-        const ProcessApiCallback<WriteEventResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<WriteEventResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<WriteEventResponse>(
             "/Client/WritePlayerEvent",
-            headers,
-            jsonAsString,
-            OnWritePlayerEventResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<WriteEventResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnWritePlayerEventResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        WriteEventResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<WriteEventResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabClientAPI::WriteTitleEvent(
         WriteTitleEventRequest& request,
-        const ProcessApiCallback<WriteEventResponse> callback,
-        const ErrorCallback errorCallback,
+        ProcessApiCallback<WriteEventResponse> callback,
+        ErrorCallback errorCallback,
         void* customData
     )
     {
         std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
         std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
 
-        IPlayFabHttpPlugin& http = *PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
-        const Json::Value requestJson = request.ToJson();
-        std::string jsonAsString = requestJson.toStyledString();
-
-        std::unordered_map<std::string, std::string> headers;
-        headers.emplace("X-Authorization", context->clientSessionTicket);
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
 
-        auto reqContainer = std::unique_ptr<CallRequestContainer>(new CallRequestContainer(
+        PlayFabApiDispatch::MakeApiCall<WriteEventResponse>(
             "/Client/WriteTitleEvent",
-            headers,
-            jsonAsString,
-            OnWriteTitleEventResult,
-            settings,
-            context,
-            customData));
-
-        reqContainer->successCallback = std::shared_ptr<void>((callback == nullptr) ? nullptr : new ProcessApiCallback<WriteEventResponse>(callback));
-        reqContainer->errorCallback = errorCallback;
-
-        http.MakePostRequest(std::unique_ptr<CallRequestContainerBase>(static_cast<CallRequestContainerBase*>(reqContainer.release())));
-    }
-
-    void PlayFabClientAPI::OnWriteTitleEventResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
-    {
-        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
-        std::shared_ptr<PlayFabAuthenticationContext> context = container.GetContext();
-
-        WriteEventResponse outResult;
-        if (ValidateResult(outResult, container))
-        {
-            std::shared_ptr<void> internalPtr = container.successCallback;
-            if (internalPtr.get() != nullptr)
-            {
-                const auto& callback = (*static_cast<ProcessApiCallback<WriteEventResponse> *>(internalPtr.get()));
-                callback(outResult, container.GetCustomData());
-            }
-        }
+            request,
+            std::move(headers),
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
     }
 
     // Private PlayFabClientAPI specific
@@ -8379,25 +4580,42 @@ namespace PlayFab
         }
     }
 
-    bool PlayFabClientAPI::ValidateResult(PlayFabResultCommon& resultCommon, const CallRequestContainer& container)
+    void PlayFabClientAPI::GetTitleDataLazy(
+        GetTitleDataRequest& request,
+        ProcessApiCallback<PlayFabLazyResult<GetTitleDataResult>> callback,
+        ErrorCallback errorCallback,
+        void* customData
+    )
+    {
+        std::shared_ptr<PlayFabAuthenticationContext> context = request.authenticationContext != nullptr ? request.authenticationContext : PlayFabSettings::staticPlayer;
+        std::shared_ptr<PlayFabApiSettings> settings = PlayFabSettings::staticSettings;
+
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::Authorization, context->clientSessionTicket);
+
+        PlayFabApiDispatch::MakeApiCall<PlayFabLazyResult<GetTitleDataResult>>(
+            "/Client/GetTitleData",
+            request,
+            std::move(headers),
+            OnGetTitleDataLazyResult,
+            std::move(callback),
+            std::move(errorCallback),
+            std::move(settings),
+            std::move(context),
+            customData);
+    }
+
+    void PlayFabClientAPI::OnGetTitleDataLazyResult(int /*httpCode*/, const std::string& /*result*/, const std::shared_ptr<CallRequestContainerBase>& reqContainer)
     {
-        if (container.errorWrapper.HttpCode == 200)
-        {
-            resultCommon.FromJson(container.errorWrapper.Data);
-            resultCommon.Request = container.errorWrapper.Request;
-            return true;
-        }
-        else // Process the error case
+        CallRequestContainer& container = static_cast<CallRequestContainer&>(*reqContainer);
+
+        if (PlayFabLazyResultBase::ValidateResult(container))
         {
-            if (PlayFabSettings::globalErrorHandler != nullptr)
-            {
-                PlayFabSettings::globalErrorHandler(container.errorWrapper, container.GetCustomData());
-            }
-            if (container.errorCallback != nullptr)
+            const ProcessApiCallback<PlayFabLazyResult<GetTitleDataResult>>* callback = container.successCallback.Get<PlayFabLazyResult<GetTitleDataResult>>();
+            if (callback != nullptr)
             {
-                container.errorCallback(container.errorWrapper, container.GetCustomData());
+                (*callback)(PlayFabLazyResult<GetTitleDataResult>(container), container.GetCustomData());
             }
-            return false;
         }
     }
 }
@@ -0,0 +1,12193 @@
+#include <stdafx.h>
+
+#if !defined(DISABLE_PLAYFABCLIENT_API)
+
+#include <playfab/PlayFabClientDataModels.h>
+
+namespace PlayFab
+{
+    namespace ClientModels
+    {
+        namespace
+        {
+            // The json field names of the models below
+            constexpr PlayFabJsonKey keyABTestParent("ABTestParent");
+            constexpr PlayFabJsonKey keyAPIRequestsIssued("APIRequestsIssued");
+            constexpr PlayFabJsonKey keyAcceptedInventoryInstanceIds("AcceptedInventoryInstanceIds");
+            constexpr PlayFabJsonKey keyAcceptedPlayerId("AcceptedPlayerId");
+            constexpr PlayFabJsonKey keyAcceptedTrades("AcceptedTrades");
+            constexpr PlayFabJsonKey keyAccessToken("AccessToken");
+            constexpr PlayFabJsonKey keyAccountInfo("AccountInfo");
+            constexpr PlayFabJsonKey keyActivationTime("ActivationTime");
+            constexpr PlayFabJsonKey keyActivity("Activity");
+            constexpr PlayFabJsonKey keyAdActivityEventId("AdActivityEventId");
+            constexpr PlayFabJsonKey keyAdCampaignAttributions("AdCampaignAttributions");
+            constexpr PlayFabJsonKey keyAdPlacements("AdPlacements");
+            constexpr PlayFabJsonKey keyAdid("Adid");
+            constexpr PlayFabJsonKey keyAllowedPlayerIds("AllowedPlayerIds");
+            constexpr PlayFabJsonKey keyAmount("Amount");
+            constexpr PlayFabJsonKey keyAndroidDevice("AndroidDevice");
+            constexpr PlayFabJsonKey keyAndroidDeviceId("AndroidDeviceId");
+            constexpr PlayFabJsonKey keyAndroidDeviceInfo("AndroidDeviceInfo");
+            constexpr PlayFabJsonKey keyAnnotation("Annotation");
+            constexpr PlayFabJsonKey keyAppId("AppId");
+            constexpr PlayFabJsonKey keyAppleAccountInfo("AppleAccountInfo");
+            constexpr PlayFabJsonKey keyAppleSubjectId("AppleSubjectId");
+            constexpr PlayFabJsonKey keyAttributedAt("AttributedAt");
+            constexpr PlayFabJsonKey keyAuthCode("AuthCode");
+            constexpr PlayFabJsonKey keyAuthTicket("AuthTicket");
+            constexpr PlayFabJsonKey keyAvailable("Available");
+            constexpr PlayFabJsonKey keyAvatarUrl("AvatarUrl");
+            constexpr PlayFabJsonKey keyBalance("Balance");
+            constexpr PlayFabJsonKey keyBalanceChange("BalanceChange");
+            constexpr PlayFabJsonKey keyBannedUntil("BannedUntil");
+            constexpr PlayFabJsonKey keyBody("Body");
+            constexpr PlayFabJsonKey keyBuildVersion("BuildVersion");
+            constexpr PlayFabJsonKey keyBundle("Bundle");
+            constexpr PlayFabJsonKey keyBundleContents("BundleContents");
+            constexpr PlayFabJsonKey keyBundleParent("BundleParent");
+            constexpr PlayFabJsonKey keyBundledItems("BundledItems");
+            constexpr PlayFabJsonKey keyBundledResultTables("BundledResultTables");
+            constexpr PlayFabJsonKey keyBundledVirtualCurrencies("BundledVirtualCurrencies");
+            constexpr PlayFabJsonKey keyCampaignId("CampaignId");
+            constexpr PlayFabJsonKey keyCanBecomeCharacter("CanBecomeCharacter");
+            constexpr PlayFabJsonKey keyCancelledAt("CancelledAt");
+            constexpr PlayFabJsonKey keyCatalog("Catalog");
+            constexpr PlayFabJsonKey keyCatalogId("CatalogId");
+            constexpr PlayFabJsonKey keyCatalogVersion("CatalogVersion");
+            constexpr PlayFabJsonKey keyChallenge("Challenge");
+            constexpr PlayFabJsonKey keyChallengeSignature("ChallengeSignature");
+            constexpr PlayFabJsonKey keyCharacterId("CharacterId");
+            constexpr PlayFabJsonKey keyCharacterInventories("CharacterInventories");
+            constexpr PlayFabJsonKey keyCharacterList("CharacterList");
+            constexpr PlayFabJsonKey keyCharacterName("CharacterName");
+            constexpr PlayFabJsonKey keyCharacterStatistics("CharacterStatistics");
+            constexpr PlayFabJsonKey keyCharacterType("CharacterType");
+            constexpr PlayFabJsonKey keyCharacters("Characters");
+            constexpr PlayFabJsonKey keyCity("City");
+            constexpr PlayFabJsonKey keyCollectionsMsIdKey("CollectionsMsIdKey");
+            constexpr PlayFabJsonKey keyComment("Comment");
+            constexpr PlayFabJsonKey keyConfirmationMessage("ConfirmationMessage");
+            constexpr PlayFabJsonKey keyConnectionId("ConnectionId");
+            constexpr PlayFabJsonKey keyConsumable("Consumable");
+            constexpr PlayFabJsonKey keyConsumeCount("ConsumeCount");
+            constexpr PlayFabJsonKey keyContactEmailAddresses("ContactEmailAddresses");
+            constexpr PlayFabJsonKey keyContainer("Container");
+            constexpr PlayFabJsonKey keyContainerItemId("ContainerItemId");
+            constexpr PlayFabJsonKey keyContainerItemInstanceId("ContainerItemInstanceId");
+            constexpr PlayFabJsonKey keyContents("Contents");
+            constexpr PlayFabJsonKey keyContinentCode("ContinentCode");
+            constexpr PlayFabJsonKey keyCount("Count");
+            constexpr PlayFabJsonKey keyCountryCode("CountryCode");
+            constexpr PlayFabJsonKey keyCouponCode("CouponCode");
+            constexpr PlayFabJsonKey keyCreateAccount("CreateAccount");
+            constexpr PlayFabJsonKey keyCreated("Created");
+            constexpr PlayFabJsonKey keyCreditApplied("CreditApplied");
+            constexpr PlayFabJsonKey keyCurrency("Currency");
+            constexpr PlayFabJsonKey keyCurrencyCode("CurrencyCode");
+            constexpr PlayFabJsonKey keyCustomCommandLineData("CustomCommandLineData");
+            constexpr PlayFabJsonKey keyCustomData("CustomData");
+            constexpr PlayFabJsonKey keyCustomId("CustomId");
+            constexpr PlayFabJsonKey keyCustomIdInfo("CustomIdInfo");
+            constexpr PlayFabJsonKey keyCustomTags("CustomTags");
+            constexpr PlayFabJsonKey keyData("Data");
+            constexpr PlayFabJsonKey keyDataVersion("DataVersion");
+            constexpr PlayFabJsonKey keyDeactivationTime("DeactivationTime");
+            constexpr PlayFabJsonKey keyDebugResults("DebugResults");
+            constexpr PlayFabJsonKey keyDescription("Description");
+            constexpr PlayFabJsonKey keyDeviceId("DeviceId");
+            constexpr PlayFabJsonKey keyDeviceModel("DeviceModel");
+            constexpr PlayFabJsonKey keyDeviceName("DeviceName");
+            constexpr PlayFabJsonKey keyDeviceToken("DeviceToken");
+            constexpr PlayFabJsonKey keyDisplayName("DisplayName");
+            constexpr PlayFabJsonKey keyDisplayPosition("DisplayPosition");
+            constexpr PlayFabJsonKey keyEmail("Email");
+            constexpr PlayFabJsonKey keyEmailAddress("EmailAddress");
+            constexpr PlayFabJsonKey keyEmailTemplateId("EmailTemplateId");
+            constexpr PlayFabJsonKey keyEncryptedRequest("EncryptedRequest");
+            constexpr PlayFabJsonKey keyEntity("Entity");
+            constexpr PlayFabJsonKey keyEntityToken("EntityToken");
+            constexpr PlayFabJsonKey keyError("Error");
+            constexpr PlayFabJsonKey keyEventId("EventId");
+            constexpr PlayFabJsonKey keyEventName("EventName");
+            constexpr PlayFabJsonKey keyExcludes("Excludes");
+            constexpr PlayFabJsonKey keyExecutionTimeSeconds("ExecutionTimeSeconds");
+            constexpr PlayFabJsonKey keyExperimentVariants("ExperimentVariants");
+            constexpr PlayFabJsonKey keyExpiration("Expiration");
+            constexpr PlayFabJsonKey keyExpires("Expires");
+            constexpr PlayFabJsonKey keyFacebookIDs("FacebookIDs");
+            constexpr PlayFabJsonKey keyFacebookId("FacebookId");
+            constexpr PlayFabJsonKey keyFacebookInfo("FacebookInfo");
+            constexpr PlayFabJsonKey keyFacebookInstantGamesId("FacebookInstantGamesId");
+            constexpr PlayFabJsonKey keyFacebookInstantGamesIdInfo("FacebookInstantGamesIdInfo");
+            constexpr PlayFabJsonKey keyFacebookInstantGamesIds("FacebookInstantGamesIds");
+            constexpr PlayFabJsonKey keyFacebookInstantGamesSignature("FacebookInstantGamesSignature");
+            constexpr PlayFabJsonKey keyFilledAt("FilledAt");
+            constexpr PlayFabJsonKey keyFirstLogin("FirstLogin");
+            constexpr PlayFabJsonKey keyForceLink("ForceLink");
+            constexpr PlayFabJsonKey keyFriendEmail("FriendEmail");
+            constexpr PlayFabJsonKey keyFriendPlayFabId("FriendPlayFabId");
+            constexpr PlayFabJsonKey keyFriendTitleDisplayName("FriendTitleDisplayName");
+            constexpr PlayFabJsonKey keyFriendUsername("FriendUsername");
+            constexpr PlayFabJsonKey keyFriends("Friends");
+            constexpr PlayFabJsonKey keyFulfilledItems("FulfilledItems");
+            constexpr PlayFabJsonKey keyFulfillments("Fulfillments");
+            constexpr PlayFabJsonKey keyFullName("FullName");
+            constexpr PlayFabJsonKey keyFunctionName("FunctionName");
+            constexpr PlayFabJsonKey keyFunctionParameter("FunctionParameter");
+            constexpr PlayFabJsonKey keyFunctionResult("FunctionResult");
+            constexpr PlayFabJsonKey keyFunctionResultTooLarge("FunctionResultTooLarge");
+            constexpr PlayFabJsonKey keyGameCenterIDs("GameCenterIDs");
+            constexpr PlayFabJsonKey keyGameCenterId("GameCenterId");
+            constexpr PlayFabJsonKey keyGameCenterInfo("GameCenterInfo");
+            constexpr PlayFabJsonKey keyGameCount("GameCount");
+            constexpr PlayFabJsonKey keyGameMode("GameMode");
+            constexpr PlayFabJsonKey keyGameServerData("GameServerData");
+            constexpr PlayFabJsonKey keyGameServerStateEnum("GameServerStateEnum");
+            constexpr PlayFabJsonKey keyGames("Games");
+            constexpr PlayFabJsonKey keyGatherDeviceInfo("GatherDeviceInfo");
+            constexpr PlayFabJsonKey keyGatherFocusInfo("GatherFocusInfo");
+            constexpr PlayFabJsonKey keyGeneratePlayStreamEvent("GeneratePlayStreamEvent");
+            constexpr PlayFabJsonKey keyGenericIDs("GenericIDs");
+            constexpr PlayFabJsonKey keyGenericId("GenericId");
+            constexpr PlayFabJsonKey keyGetCharacterInventories("GetCharacterInventories");
+            constexpr PlayFabJsonKey keyGetCharacterList("GetCharacterList");
+            constexpr PlayFabJsonKey keyGetMembers("GetMembers");
+            constexpr PlayFabJsonKey keyGetPlayerProfile("GetPlayerProfile");
+            constexpr PlayFabJsonKey keyGetPlayerStatistics("GetPlayerStatistics");
+            constexpr PlayFabJsonKey keyGetTitleData("GetTitleData");
+            constexpr PlayFabJsonKey keyGetUserAccountInfo("GetUserAccountInfo");
+            constexpr PlayFabJsonKey keyGetUserData("GetUserData");
+            constexpr PlayFabJsonKey keyGetUserInventory("GetUserInventory");
+            constexpr PlayFabJsonKey keyGetUserReadOnlyData("GetUserReadOnlyData");
+            constexpr PlayFabJsonKey keyGetUserVirtualCurrency("GetUserVirtualCurrency");
+            constexpr PlayFabJsonKey keyGoogleEmail("GoogleEmail");
+            constexpr PlayFabJsonKey keyGoogleGender("GoogleGender");
+            constexpr PlayFabJsonKey keyGoogleIDs("GoogleIDs");
+            constexpr PlayFabJsonKey keyGoogleId("GoogleId");
+            constexpr PlayFabJsonKey keyGoogleInfo("GoogleInfo");
+            constexpr PlayFabJsonKey keyGoogleLocale("GoogleLocale");
+            constexpr PlayFabJsonKey keyGoogleName("GoogleName");
+            constexpr PlayFabJsonKey keyGrantedItems("GrantedItems");
+            constexpr PlayFabJsonKey keyGrantedVirtualCurrencies("GrantedVirtualCurrencies");
+            constexpr PlayFabJsonKey keyHttpMethod("HttpMethod");
+            constexpr PlayFabJsonKey keyHttpRequestsIssued("HttpRequestsIssued");
+            constexpr PlayFabJsonKey keyId("Id");
+            constexpr PlayFabJsonKey keyIdToken("IdToken");
+            constexpr PlayFabJsonKey keyIdentifier("Identifier");
+            constexpr PlayFabJsonKey keyIdentityToken("IdentityToken");
+            constexpr PlayFabJsonKey keyIdfa("Idfa");
+            constexpr PlayFabJsonKey keyIds("Ids");
+            constexpr PlayFabJsonKey keyIfChangedFromDataVersion("IfChangedFromDataVersion");
+            constexpr PlayFabJsonKey keyImageUrl("ImageUrl");
+            constexpr PlayFabJsonKey keyIncludeFacebookFriends("IncludeFacebookFriends");
+            constexpr PlayFabJsonKey keyIncludeSteamFriends("IncludeSteamFriends");
+            constexpr PlayFabJsonKey keyIncludes("Includes");
+            constexpr PlayFabJsonKey keyIncrementedStatistics("IncrementedStatistics");
+            constexpr PlayFabJsonKey keyInfo("Info");
+            constexpr PlayFabJsonKey keyInfoRequestParameters("InfoRequestParameters");
+            constexpr PlayFabJsonKey keyInfoResultPayload("InfoResultPayload");
+            constexpr PlayFabJsonKey keyInitialLimitedEditionCount("InitialLimitedEditionCount");
+            constexpr PlayFabJsonKey keyInitialSubscriptionTime("InitialSubscriptionTime");
+            constexpr PlayFabJsonKey keyInstanceId("InstanceId");
+            constexpr PlayFabJsonKey keyInvalidatedAt("InvalidatedAt");
+            constexpr PlayFabJsonKey keyInventory("Inventory");
+            constexpr PlayFabJsonKey keyIosDeviceId("IosDeviceId");
+            constexpr PlayFabJsonKey keyIosDeviceInfo("IosDeviceInfo");
+            constexpr PlayFabJsonKey keyIsActive("IsActive");
+            constexpr PlayFabJsonKey keyIsLimitedEdition("IsLimitedEdition");
+            constexpr PlayFabJsonKey keyIsStackable("IsStackable");
+            constexpr PlayFabJsonKey keyIsTradable("IsTradable");
+            constexpr PlayFabJsonKey keyIssuer("Issuer");
+            constexpr PlayFabJsonKey keyIssuerId("IssuerId");
+            constexpr PlayFabJsonKey keyItemClass("ItemClass");
+            constexpr PlayFabJsonKey keyItemContents("ItemContents");
+            constexpr PlayFabJsonKey keyItemId("ItemId");
+            constexpr PlayFabJsonKey keyItemImageUrl("ItemImageUrl");
+            constexpr PlayFabJsonKey keyItemInstanceId("ItemInstanceId");
+            constexpr PlayFabJsonKey keyItems("Items");
+            constexpr PlayFabJsonKey keyItemsGranted("ItemsGranted");
+            constexpr PlayFabJsonKey keyKey("Key");
+            constexpr PlayFabJsonKey keyKeyItemId("KeyItemId");
+            constexpr PlayFabJsonKey keyKeyItemInstanceId("KeyItemInstanceId");
+            constexpr PlayFabJsonKey keyKeys("Keys");
+            constexpr PlayFabJsonKey keyKeysToRemove("KeysToRemove");
+            constexpr PlayFabJsonKey keyKongregateIDs("KongregateIDs");
+            constexpr PlayFabJsonKey keyKongregateId("KongregateId");
+            constexpr PlayFabJsonKey keyKongregateInfo("KongregateInfo");
+            constexpr PlayFabJsonKey keyKongregateName("KongregateName");
+            constexpr PlayFabJsonKey keyLastHeartbeat("LastHeartbeat");
+            constexpr PlayFabJsonKey keyLastLogin("LastLogin");
+            constexpr PlayFabJsonKey keyLastLoginTime("LastLoginTime");
+            constexpr PlayFabJsonKey keyLastUpdated("LastUpdated");
+            constexpr PlayFabJsonKey keyLastUpdatedBy("LastUpdatedBy");
+            constexpr PlayFabJsonKey keyLatitude("Latitude");
+            constexpr PlayFabJsonKey keyLeaderboard("Leaderboard");
+            constexpr PlayFabJsonKey keyLevel("Level");
+            constexpr PlayFabJsonKey keyLinkedAccounts("LinkedAccounts");
+            constexpr PlayFabJsonKey keyLobbyID("LobbyID");
+            constexpr PlayFabJsonKey keyLobbyId("LobbyId");
+            constexpr PlayFabJsonKey keyLocations("Locations");
+            constexpr PlayFabJsonKey keyLogs("Logs");
+            constexpr PlayFabJsonKey keyLogsTooLarge("LogsTooLarge");
+            constexpr PlayFabJsonKey keyLongitude("Longitude");
+            constexpr PlayFabJsonKey keyMarketingData("MarketingData");
+            constexpr PlayFabJsonKey keyMarketplaceSpecificData("MarketplaceSpecificData");
+            constexpr PlayFabJsonKey keyMaxPlayers("MaxPlayers");
+            constexpr PlayFabJsonKey keyMaxResultsCount("MaxResultsCount");
+            constexpr PlayFabJsonKey keyMembers("Members");
+            constexpr PlayFabJsonKey keyMembershipExpiration("MembershipExpiration");
+            constexpr PlayFabJsonKey keyMembershipId("MembershipId");
+            constexpr PlayFabJsonKey keyMemberships("Memberships");
+            constexpr PlayFabJsonKey keyMemoryConsumedBytes("MemoryConsumedBytes");
+            constexpr PlayFabJsonKey keyMessage("Message");
+            constexpr PlayFabJsonKey keyMetadata("Metadata");
+            constexpr PlayFabJsonKey keyName("Name");
+            constexpr PlayFabJsonKey keyNamespace("Namespace");
+            constexpr PlayFabJsonKey keyNeedsAttribution("NeedsAttribution");
+            constexpr PlayFabJsonKey keyNewlyCreated("NewlyCreated");
+            constexpr PlayFabJsonKey keyNews("News");
+            constexpr PlayFabJsonKey keyNewsId("NewsId");
+            constexpr PlayFabJsonKey keyNextReset("NextReset");
+            constexpr PlayFabJsonKey keyNintendoSwitchAccountInfo("NintendoSwitchAccountInfo");
+            constexpr PlayFabJsonKey keyNintendoSwitchAccountSubjectId("NintendoSwitchAccountSubjectId");
+            constexpr PlayFabJsonKey keyNintendoSwitchDeviceId("NintendoSwitchDeviceId");
+            constexpr PlayFabJsonKey keyNintendoSwitchDeviceIdInfo("NintendoSwitchDeviceIdInfo");
+            constexpr PlayFabJsonKey keyNintendoSwitchDeviceIds("NintendoSwitchDeviceIds");
+            constexpr PlayFabJsonKey keyNotificationEndpointARN("NotificationEndpointARN");
+            constexpr PlayFabJsonKey keyOS("OS");
+            constexpr PlayFabJsonKey keyOfferedCatalogItemIds("OfferedCatalogItemIds");
+            constexpr PlayFabJsonKey keyOfferedInventoryInstanceIds("OfferedInventoryInstanceIds");
+            constexpr PlayFabJsonKey keyOfferingPlayerId("OfferingPlayerId");
+            constexpr PlayFabJsonKey keyOpenIdInfo("OpenIdInfo");
+            constexpr PlayFabJsonKey keyOpenedAt("OpenedAt");
+            constexpr PlayFabJsonKey keyOpenedTrades("OpenedTrades");
+            constexpr PlayFabJsonKey keyOrderId("OrderId");
+            constexpr PlayFabJsonKey keyOrigination("Origination");
+            constexpr PlayFabJsonKey keyOverrideExpiration("OverrideExpiration");
+            constexpr PlayFabJsonKey keyOverrideLabel("OverrideLabel");
+            constexpr PlayFabJsonKey keyPSNAccountIDs("PSNAccountIDs");
+            constexpr PlayFabJsonKey keyPSNAccountId("PSNAccountId");
+            constexpr PlayFabJsonKey keyPSNInfo("PSNInfo");
+            constexpr PlayFabJsonKey keyPassword("Password");
+            constexpr PlayFabJsonKey keyPaymentOptions("PaymentOptions");
+            constexpr PlayFabJsonKey keyPaymentProvider("PaymentProvider");
+            constexpr PlayFabJsonKey keyPermission("Permission");
+            constexpr PlayFabJsonKey keyPhotonApplicationId("PhotonApplicationId");
+            constexpr PlayFabJsonKey keyPhotonCustomAuthenticationToken("PhotonCustomAuthenticationToken");
+            constexpr PlayFabJsonKey keyPingUrl("PingUrl");
+            constexpr PlayFabJsonKey keyPlacementId("PlacementId");
+            constexpr PlayFabJsonKey keyPlacementName("PlacementName");
+            constexpr PlayFabJsonKey keyPlacementViewsRemaining("PlacementViewsRemaining");
+            constexpr PlayFabJsonKey keyPlacementViewsResetMinutes("PlacementViewsResetMinutes");
+            constexpr PlayFabJsonKey keyPlatform("Platform");
+            constexpr PlayFabJsonKey keyPlatformUserId("PlatformUserId");
+            constexpr PlayFabJsonKey keyPlayFabId("PlayFabId");
+            constexpr PlayFabJsonKey keyPlayFabIds("PlayFabIds");
+            constexpr PlayFabJsonKey keyPlayerCount("PlayerCount");
+            constexpr PlayFabJsonKey keyPlayerId("PlayerId");
+            constexpr PlayFabJsonKey keyPlayerProfile("PlayerProfile");
+            constexpr PlayFabJsonKey keyPlayerSecret("PlayerSecret");
+            constexpr PlayFabJsonKey keyPlayerStatisticNames("PlayerStatisticNames");
+            constexpr PlayFabJsonKey keyPlayerStatistics("PlayerStatistics");
+            constexpr PlayFabJsonKey keyPlayerUserIds("PlayerUserIds");
+            constexpr PlayFabJsonKey keyPollWaitTimeMS("PollWaitTimeMS");
+            constexpr PlayFabJsonKey keyPosition("Position");
+            constexpr PlayFabJsonKey keyPrice("Price");
+            constexpr PlayFabJsonKey keyPrivateInfo("PrivateInfo");
+            constexpr PlayFabJsonKey keyProcessorTimeSeconds("ProcessorTimeSeconds");
+            constexpr PlayFabJsonKey keyProfile("Profile");
+            constexpr PlayFabJsonKey keyProfileConstraints("ProfileConstraints");
+            constexpr PlayFabJsonKey keyProviderData("ProviderData");
+            constexpr PlayFabJsonKey keyProviderName("ProviderName");
+            constexpr PlayFabJsonKey keyProviderToken("ProviderToken");
+            constexpr PlayFabJsonKey keyProviderTransactionId("ProviderTransactionId");
+            constexpr PlayFabJsonKey keyPsnAccountId("PsnAccountId");
+            constexpr PlayFabJsonKey keyPsnInfo("PsnInfo");
+            constexpr PlayFabJsonKey keyPsnOnlineId("PsnOnlineId");
+            constexpr PlayFabJsonKey keyPublicKey("PublicKey");
+            constexpr PlayFabJsonKey keyPublicKeyHint("PublicKeyHint");
+            constexpr PlayFabJsonKey keyPublicKeyUrl("PublicKeyUrl");
+            constexpr PlayFabJsonKey keyPublisherId("PublisherId");
+            constexpr PlayFabJsonKey keyPurchaseConfirmationPageURL("PurchaseConfirmationPageURL");
+            constexpr PlayFabJsonKey keyPurchaseCurrency("PurchaseCurrency");
+            constexpr PlayFabJsonKey keyPurchaseDate("PurchaseDate");
+            constexpr PlayFabJsonKey keyPurchasePrice("PurchasePrice");
+            constexpr PlayFabJsonKey keyPushNotificationRegistrations("PushNotificationRegistrations");
+            constexpr PlayFabJsonKey keyQuantity("Quantity");
+            constexpr PlayFabJsonKey keyRSAPublicKey("RSAPublicKey");
+            constexpr PlayFabJsonKey keyRealCurrencyPrices("RealCurrencyPrices");
+            constexpr PlayFabJsonKey keyReceipt("Receipt");
+            constexpr PlayFabJsonKey keyReceiptData("ReceiptData");
+            constexpr PlayFabJsonKey keyReceiptId("ReceiptId");
+            constexpr PlayFabJsonKey keyReceiptJson("ReceiptJson");
+            constexpr PlayFabJsonKey keyRechargeMax("RechargeMax");
+            constexpr PlayFabJsonKey keyRechargeTime("RechargeTime");
+            constexpr PlayFabJsonKey keyRecordedPriceSource("RecordedPriceSource");
+            constexpr PlayFabJsonKey keyRecordedTransactionCurrency("RecordedTransactionCurrency");
+            constexpr PlayFabJsonKey keyRecordedTransactionTotal("RecordedTransactionTotal");
+            constexpr PlayFabJsonKey keyRedirectUri("RedirectUri");
+            constexpr PlayFabJsonKey keyRegion("Region");
+            constexpr PlayFabJsonKey keyRegions("Regions");
+            constexpr PlayFabJsonKey keyRemainingUses("RemainingUses");
+            constexpr PlayFabJsonKey keyReporteeId("ReporteeId");
+            constexpr PlayFabJsonKey keyRequestedCatalogItemIds("RequestedCatalogItemIds");
+            constexpr PlayFabJsonKey keyRequireBothUsernameAndEmail("RequireBothUsernameAndEmail");
+            constexpr PlayFabJsonKey keyResult("Result");
+            constexpr PlayFabJsonKey keyResultTableContents("ResultTableContents");
+            constexpr PlayFabJsonKey keyRevision("Revision");
+            constexpr PlayFabJsonKey keyRevisionSelection("RevisionSelection");
+            constexpr PlayFabJsonKey keyRewardAssetUrl("RewardAssetUrl");
+            constexpr PlayFabJsonKey keyRewardDescription("RewardDescription");
+            constexpr PlayFabJsonKey keyRewardId("RewardId");
+            constexpr PlayFabJsonKey keyRewardName("RewardName");
+            constexpr PlayFabJsonKey keyRewardResults("RewardResults");
+            constexpr PlayFabJsonKey keyRunTime("RunTime");
+            constexpr PlayFabJsonKey keySalt("Salt");
+            constexpr PlayFabJsonKey keySandbox("Sandbox");
+            constexpr PlayFabJsonKey keyScheduledActivationTime("ScheduledActivationTime");
+            constexpr PlayFabJsonKey keyScheduledDeactivationTime("ScheduledDeactivationTime");
+            constexpr PlayFabJsonKey keySecondsToRecharge("SecondsToRecharge");
+            constexpr PlayFabJsonKey keySegments("Segments");
+            constexpr PlayFabJsonKey keySendPushNotificationConfirmation("SendPushNotificationConfirmation");
+            constexpr PlayFabJsonKey keyServerAuthCode("ServerAuthCode");
+            constexpr PlayFabJsonKey keyServerIPV4Address("ServerIPV4Address");
+            constexpr PlayFabJsonKey keyServerIPV6Address("ServerIPV6Address");
+            constexpr PlayFabJsonKey keyServerPort("ServerPort");
+            constexpr PlayFabJsonKey keyServerPublicDNSName("ServerPublicDNSName");
+            constexpr PlayFabJsonKey keyServiceLabel("ServiceLabel");
+            constexpr PlayFabJsonKey keyServiceName("ServiceName");
+            constexpr PlayFabJsonKey keySessionTicket("SessionTicket");
+            constexpr PlayFabJsonKey keySettingsForUser("SettingsForUser");
+            constexpr PlayFabJsonKey keySharedGroupId("SharedGroupId");
+            constexpr PlayFabJsonKey keyShowAvatarUrl("ShowAvatarUrl");
+            constexpr PlayFabJsonKey keyShowBannedUntil("ShowBannedUntil");
+            constexpr PlayFabJsonKey keyShowCampaignAttributions("ShowCampaignAttributions");
+            constexpr PlayFabJsonKey keyShowContactEmailAddresses("ShowContactEmailAddresses");
+            constexpr PlayFabJsonKey keyShowCreated("ShowCreated");
+            constexpr PlayFabJsonKey keyShowDisplayName("ShowDisplayName");
+            constexpr PlayFabJsonKey keyShowExperimentVariants("ShowExperimentVariants");
+            constexpr PlayFabJsonKey keyShowLastLogin("ShowLastLogin");
+            constexpr PlayFabJsonKey keyShowLinkedAccounts("ShowLinkedAccounts");
+            constexpr PlayFabJsonKey keyShowLocations("ShowLocations");
+            constexpr PlayFabJsonKey keyShowMemberships("ShowMemberships");
+            constexpr PlayFabJsonKey keyShowOrigination("ShowOrigination");
+            constexpr PlayFabJsonKey keyShowPushNotificationRegistrations("ShowPushNotificationRegistrations");
+            constexpr PlayFabJsonKey keyShowStatistics("ShowStatistics");
+            constexpr PlayFabJsonKey keyShowTags("ShowTags");
+            constexpr PlayFabJsonKey keyShowTotalValueToDateInUsd("ShowTotalValueToDateInUsd");
+            constexpr PlayFabJsonKey keyShowValuesToDate("ShowValuesToDate");
+            constexpr PlayFabJsonKey keySignature("Signature");
+            constexpr PlayFabJsonKey keySource("Source");
+            constexpr PlayFabJsonKey keySpecificRevision("SpecificRevision");
+            constexpr PlayFabJsonKey keyStackTrace("StackTrace");
+            constexpr PlayFabJsonKey keyStartNewIfNoneFound("StartNewIfNoneFound");
+            constexpr PlayFabJsonKey keyStartPosition("StartPosition");
+            constexpr PlayFabJsonKey keyStatValue("StatValue");
+            constexpr PlayFabJsonKey keyStatisticName("StatisticName");
+            constexpr PlayFabJsonKey keyStatisticNameVersions("StatisticNameVersions");
+            constexpr PlayFabJsonKey keyStatisticNames("StatisticNames");
+            constexpr PlayFabJsonKey keyStatisticVersions("StatisticVersions");
+            constexpr PlayFabJsonKey keyStatistics("Statistics");
+            constexpr PlayFabJsonKey keyStatus("Status");
+            constexpr PlayFabJsonKey keyStatusFilter("StatusFilter");
+            constexpr PlayFabJsonKey keySteamActivationStatus("SteamActivationStatus");
+            constexpr PlayFabJsonKey keySteamCountry("SteamCountry");
+            constexpr PlayFabJsonKey keySteamCurrency("SteamCurrency");
+            constexpr PlayFabJsonKey keySteamId("SteamId");
+            constexpr PlayFabJsonKey keySteamInfo("SteamInfo");
+            constexpr PlayFabJsonKey keySteamName("SteamName");
+            constexpr PlayFabJsonKey keySteamStringIDs("SteamStringIDs");
+            constexpr PlayFabJsonKey keySteamStringId("SteamStringId");
+            constexpr PlayFabJsonKey keySteamTicket("SteamTicket");
+            constexpr PlayFabJsonKey keyStore("Store");
+            constexpr PlayFabJsonKey keyStoreCredit("StoreCredit");
+            constexpr PlayFabJsonKey keyStoreId("StoreId");
+            constexpr PlayFabJsonKey keySubject("Subject");
+            constexpr PlayFabJsonKey keySubmissionsRemaining("SubmissionsRemaining");
+            constexpr PlayFabJsonKey keySubscriptionId("SubscriptionId");
+            constexpr PlayFabJsonKey keySubscriptionItemId("SubscriptionItemId");
+            constexpr PlayFabJsonKey keySubscriptionProvider("SubscriptionProvider");
+            constexpr PlayFabJsonKey keySubscriptions("Subscriptions");
+            constexpr PlayFabJsonKey keyTagFilter("TagFilter");
+            constexpr PlayFabJsonKey keyTagValue("TagValue");
+            constexpr PlayFabJsonKey keyTags("Tags");
+            constexpr PlayFabJsonKey keyThruCDN("ThruCDN");
+            constexpr PlayFabJsonKey keyTicket("Ticket");
+            constexpr PlayFabJsonKey keyTime("Time");
+            constexpr PlayFabJsonKey keyTimestamp("Timestamp");
+            constexpr PlayFabJsonKey keyTitle("Title");
+            constexpr PlayFabJsonKey keyTitleData("TitleData");
+            constexpr PlayFabJsonKey keyTitleDataKeys("TitleDataKeys");
+            constexpr PlayFabJsonKey keyTitleDisplayName("TitleDisplayName");
+            constexpr PlayFabJsonKey keyTitleId("TitleId");
+            constexpr PlayFabJsonKey keyTitleInfo("TitleInfo");
+            constexpr PlayFabJsonKey keyTitlePlayerAccount("TitlePlayerAccount");
+            constexpr PlayFabJsonKey keyTitleSharedSecret("TitleSharedSecret");
+            constexpr PlayFabJsonKey keyTokenExpiration("TokenExpiration");
+            constexpr PlayFabJsonKey keyTokenProvider("TokenProvider");
+            constexpr PlayFabJsonKey keyTotalValue("TotalValue");
+            constexpr PlayFabJsonKey keyTotalValueAsDecimal("TotalValueAsDecimal");
+            constexpr PlayFabJsonKey keyTotalValueToDateInUSD("TotalValueToDateInUSD");
+            constexpr PlayFabJsonKey keyTrade("Trade");
+            constexpr PlayFabJsonKey keyTradeId("TradeId");
+            constexpr PlayFabJsonKey keyTransactionId("TransactionId");
+            constexpr PlayFabJsonKey keyTransactionStatus("TransactionStatus");
+            constexpr PlayFabJsonKey keyTreatmentAssignment("TreatmentAssignment");
+            constexpr PlayFabJsonKey keyTwitchId("TwitchId");
+            constexpr PlayFabJsonKey keyTwitchIds("TwitchIds");
+            constexpr PlayFabJsonKey keyTwitchInfo("TwitchInfo");
+            constexpr PlayFabJsonKey keyTwitchUserName("TwitchUserName");
+            constexpr PlayFabJsonKey keyType("Type");
+            constexpr PlayFabJsonKey keyURL("URL");
+            constexpr PlayFabJsonKey keyUnitCurrency("UnitCurrency");
+            constexpr PlayFabJsonKey keyUnitPrice("UnitPrice");
+            constexpr PlayFabJsonKey keyUnlockedItemInstanceId("UnlockedItemInstanceId");
+            constexpr PlayFabJsonKey keyUnlockedWithItemInstanceId("UnlockedWithItemInstanceId");
+            constexpr PlayFabJsonKey keyUpgradeFromItems("UpgradeFromItems");
+            constexpr PlayFabJsonKey keyUsageCount("UsageCount");
+            constexpr PlayFabJsonKey keyUsagePeriod("UsagePeriod");
+            constexpr PlayFabJsonKey keyUsagePeriodGroup("UsagePeriodGroup");
+            constexpr PlayFabJsonKey keyUserData("UserData");
+            constexpr PlayFabJsonKey keyUserDataKeys("UserDataKeys");
+            constexpr PlayFabJsonKey keyUserDataVersion("UserDataVersion");
+            constexpr PlayFabJsonKey keyUserId("UserId");
+            constexpr PlayFabJsonKey keyUserInventory("UserInventory");
+            constexpr PlayFabJsonKey keyUserName("UserName");
+            constexpr PlayFabJsonKey keyUserReadOnlyData("UserReadOnlyData");
+            constexpr PlayFabJsonKey keyUserReadOnlyDataKeys("UserReadOnlyDataKeys");
+            constexpr PlayFabJsonKey keyUserReadOnlyDataVersion("UserReadOnlyDataVersion");
+            constexpr PlayFabJsonKey keyUserVirtualCurrency("UserVirtualCurrency");
+            constexpr PlayFabJsonKey keyUserVirtualCurrencyRechargeTimes("UserVirtualCurrencyRechargeTimes");
+            constexpr PlayFabJsonKey keyUsername("Username");
+            constexpr PlayFabJsonKey keyUsesIncrementedBy("UsesIncrementedBy");
+            constexpr PlayFabJsonKey keyVCAmount("VCAmount");
+            constexpr PlayFabJsonKey keyValue("Value");
+            constexpr PlayFabJsonKey keyValuesToDate("ValuesToDate");
+            constexpr PlayFabJsonKey keyVariables("Variables");
+            constexpr PlayFabJsonKey keyVariants("Variants");
+            constexpr PlayFabJsonKey keyVerificationStatus("VerificationStatus");
+            constexpr PlayFabJsonKey keyVersion("Version");
+            constexpr PlayFabJsonKey keyVirtualCurrency("VirtualCurrency");
+            constexpr PlayFabJsonKey keyVirtualCurrencyBalances("VirtualCurrencyBalances");
+            constexpr PlayFabJsonKey keyVirtualCurrencyContents("VirtualCurrencyContents");
+            constexpr PlayFabJsonKey keyVirtualCurrencyPrices("VirtualCurrencyPrices");
+            constexpr PlayFabJsonKey keyVirtualCurrencyRechargeTimes("VirtualCurrencyRechargeTimes");
+            constexpr PlayFabJsonKey keyWindowsHelloDeviceName("WindowsHelloDeviceName");
+            constexpr PlayFabJsonKey keyWindowsHelloInfo("WindowsHelloInfo");
+            constexpr PlayFabJsonKey keyWindowsHelloPublicKeyHash("WindowsHelloPublicKeyHash");
+            constexpr PlayFabJsonKey keyXboxInfo("XboxInfo");
+            constexpr PlayFabJsonKey keyXboxLiveAccountIDs("XboxLiveAccountIDs");
+            constexpr PlayFabJsonKey keyXboxLiveAccountId("XboxLiveAccountId");
+            constexpr PlayFabJsonKey keyXboxToken("XboxToken");
+            constexpr PlayFabJsonKey keyXboxUserId("XboxUserId");
+            constexpr PlayFabJsonKey keyisBanned("isBanned");
+        }
+
+        void ToJsonEnum(const AdActivity input, Json::Value& output)
+        {
+            if (input == AdActivity::AdActivityOpened)
+            {
+                output = Json::Value(Json::StaticString("Opened"));
+                return;
+            }
+            if (input == AdActivity::AdActivityClosed)
+            {
+                output = Json::Value(Json::StaticString("Closed"));
+                return;
+            }
+            if (input == AdActivity::AdActivityStart)
+            {
+                output = Json::Value(Json::StaticString("Start"));
+                return;
+            }
+            if (input == AdActivity::AdActivityEnd)
+            {
+                output = Json::Value(Json::StaticString("End"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, AdActivity& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Opened")
+            {
+                output = AdActivity::AdActivityOpened;
+                return;
+            }
+            if (inputStr == "Closed")
+            {
+                output = AdActivity::AdActivityClosed;
+                return;
+            }
+            if (inputStr == "Start")
+            {
+                output = AdActivity::AdActivityStart;
+                return;
+            }
+            if (inputStr == "End")
+            {
+                output = AdActivity::AdActivityEnd;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const CloudScriptRevisionOption input, Json::Value& output)
+        {
+            if (input == CloudScriptRevisionOption::CloudScriptRevisionOptionLive)
+            {
+                output = Json::Value(Json::StaticString("Live"));
+                return;
+            }
+            if (input == CloudScriptRevisionOption::CloudScriptRevisionOptionLatest)
+            {
+                output = Json::Value(Json::StaticString("Latest"));
+                return;
+            }
+            if (input == CloudScriptRevisionOption::CloudScriptRevisionOptionSpecific)
+            {
+                output = Json::Value(Json::StaticString("Specific"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, CloudScriptRevisionOption& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Live")
+            {
+                output = CloudScriptRevisionOption::CloudScriptRevisionOptionLive;
+                return;
+            }
+            if (inputStr == "Latest")
+            {
+                output = CloudScriptRevisionOption::CloudScriptRevisionOptionLatest;
+                return;
+            }
+            if (inputStr == "Specific")
+            {
+                output = CloudScriptRevisionOption::CloudScriptRevisionOptionSpecific;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const ContinentCode input, Json::Value& output)
+        {
+            if (input == ContinentCode::ContinentCodeAF)
+            {
+                output = Json::Value(Json::StaticString("AF"));
+                return;
+            }
+            if (input == ContinentCode::ContinentCodeAN)
+            {
+                output = Json::Value(Json::StaticString("AN"));
+                return;
+            }
+            if (input == ContinentCode::ContinentCodeAS)
+            {
+                output = Json::Value(Json::StaticString("AS"));
+                return;
+            }
+            if (input == ContinentCode::ContinentCodeEU)
+            {
+                output = Json::Value(Json::StaticString("EU"));
+                return;
+            }
+            if (input == ContinentCode::ContinentCodeNA)
+            {
+                output = Json::Value(Json::StaticString("NA"));
+                return;
+            }
+            if (input == ContinentCode::ContinentCodeOC)
+            {
+                output = Json::Value(Json::StaticString("OC"));
+                return;
+            }
+            if (input == ContinentCode::ContinentCodeSA)
+            {
+                output = Json::Value(Json::StaticString("SA"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, ContinentCode& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "AF")
+            {
+                output = ContinentCode::ContinentCodeAF;
+                return;
+            }
+            if (inputStr == "AN")
+            {
+                output = ContinentCode::ContinentCodeAN;
+                return;
+            }
+            if (inputStr == "AS")
+            {
+                output = ContinentCode::ContinentCodeAS;
+                return;
+            }
+            if (inputStr == "EU")
+            {
+                output = ContinentCode::ContinentCodeEU;
+                return;
+            }
+            if (inputStr == "NA")
+            {
+                output = ContinentCode::ContinentCodeNA;
+                return;
+            }
+            if (inputStr == "OC")
+            {
+                output = ContinentCode::ContinentCodeOC;
+                return;
+            }
+            if (inputStr == "SA")
+            {
+                output = ContinentCode::ContinentCodeSA;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const CountryCode input, Json::Value& output)
+        {
+            if (input == CountryCode::CountryCodeAF)
+            {
+                output = Json::Value(Json::StaticString("AF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAX)
+            {
+                output = Json::Value(Json::StaticString("AX"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAL)
+            {
+                output = Json::Value(Json::StaticString("AL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeDZ)
+            {
+                output = Json::Value(Json::StaticString("DZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAS)
+            {
+                output = Json::Value(Json::StaticString("AS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAD)
+            {
+                output = Json::Value(Json::StaticString("AD"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAO)
+            {
+                output = Json::Value(Json::StaticString("AO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAI)
+            {
+                output = Json::Value(Json::StaticString("AI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAQ)
+            {
+                output = Json::Value(Json::StaticString("AQ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAG)
+            {
+                output = Json::Value(Json::StaticString("AG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAR)
+            {
+                output = Json::Value(Json::StaticString("AR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAM)
+            {
+                output = Json::Value(Json::StaticString("AM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAW)
+            {
+                output = Json::Value(Json::StaticString("AW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAU)
+            {
+                output = Json::Value(Json::StaticString("AU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAT)
+            {
+                output = Json::Value(Json::StaticString("AT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAZ)
+            {
+                output = Json::Value(Json::StaticString("AZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBS)
+            {
+                output = Json::Value(Json::StaticString("BS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBH)
+            {
+                output = Json::Value(Json::StaticString("BH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBD)
+            {
+                output = Json::Value(Json::StaticString("BD"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBB)
+            {
+                output = Json::Value(Json::StaticString("BB"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBY)
+            {
+                output = Json::Value(Json::StaticString("BY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBE)
+            {
+                output = Json::Value(Json::StaticString("BE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBZ)
+            {
+                output = Json::Value(Json::StaticString("BZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBJ)
+            {
+                output = Json::Value(Json::StaticString("BJ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBM)
+            {
+                output = Json::Value(Json::StaticString("BM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBT)
+            {
+                output = Json::Value(Json::StaticString("BT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBO)
+            {
+                output = Json::Value(Json::StaticString("BO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBQ)
+            {
+                output = Json::Value(Json::StaticString("BQ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBA)
+            {
+                output = Json::Value(Json::StaticString("BA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBW)
+            {
+                output = Json::Value(Json::StaticString("BW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBV)
+            {
+                output = Json::Value(Json::StaticString("BV"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBR)
+            {
+                output = Json::Value(Json::StaticString("BR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIO)
+            {
+                output = Json::Value(Json::StaticString("IO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBN)
+            {
+                output = Json::Value(Json::StaticString("BN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBG)
+            {
+                output = Json::Value(Json::StaticString("BG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBF)
+            {
+                output = Json::Value(Json::StaticString("BF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBI)
+            {
+                output = Json::Value(Json::StaticString("BI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKH)
+            {
+                output = Json::Value(Json::StaticString("KH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCM)
+            {
+                output = Json::Value(Json::StaticString("CM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCA)
+            {
+                output = Json::Value(Json::StaticString("CA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCV)
+            {
+                output = Json::Value(Json::StaticString("CV"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKY)
+            {
+                output = Json::Value(Json::StaticString("KY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCF)
+            {
+                output = Json::Value(Json::StaticString("CF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTD)
+            {
+                output = Json::Value(Json::StaticString("TD"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCL)
+            {
+                output = Json::Value(Json::StaticString("CL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCN)
+            {
+                output = Json::Value(Json::StaticString("CN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCX)
+            {
+                output = Json::Value(Json::StaticString("CX"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCC)
+            {
+                output = Json::Value(Json::StaticString("CC"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCO)
+            {
+                output = Json::Value(Json::StaticString("CO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKM)
+            {
+                output = Json::Value(Json::StaticString("KM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCG)
+            {
+                output = Json::Value(Json::StaticString("CG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCD)
+            {
+                output = Json::Value(Json::StaticString("CD"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCK)
+            {
+                output = Json::Value(Json::StaticString("CK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCR)
+            {
+                output = Json::Value(Json::StaticString("CR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCI)
+            {
+                output = Json::Value(Json::StaticString("CI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeHR)
+            {
+                output = Json::Value(Json::StaticString("HR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCU)
+            {
+                output = Json::Value(Json::StaticString("CU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCW)
+            {
+                output = Json::Value(Json::StaticString("CW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCY)
+            {
+                output = Json::Value(Json::StaticString("CY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCZ)
+            {
+                output = Json::Value(Json::StaticString("CZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeDK)
+            {
+                output = Json::Value(Json::StaticString("DK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeDJ)
+            {
+                output = Json::Value(Json::StaticString("DJ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeDM)
+            {
+                output = Json::Value(Json::StaticString("DM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeDO)
+            {
+                output = Json::Value(Json::StaticString("DO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeEC)
+            {
+                output = Json::Value(Json::StaticString("EC"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeEG)
+            {
+                output = Json::Value(Json::StaticString("EG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSV)
+            {
+                output = Json::Value(Json::StaticString("SV"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGQ)
+            {
+                output = Json::Value(Json::StaticString("GQ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeER)
+            {
+                output = Json::Value(Json::StaticString("ER"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeEE)
+            {
+                output = Json::Value(Json::StaticString("EE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeET)
+            {
+                output = Json::Value(Json::StaticString("ET"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeFK)
+            {
+                output = Json::Value(Json::StaticString("FK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeFO)
+            {
+                output = Json::Value(Json::StaticString("FO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeFJ)
+            {
+                output = Json::Value(Json::StaticString("FJ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeFI)
+            {
+                output = Json::Value(Json::StaticString("FI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeFR)
+            {
+                output = Json::Value(Json::StaticString("FR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGF)
+            {
+                output = Json::Value(Json::StaticString("GF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePF)
+            {
+                output = Json::Value(Json::StaticString("PF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTF)
+            {
+                output = Json::Value(Json::StaticString("TF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGA)
+            {
+                output = Json::Value(Json::StaticString("GA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGM)
+            {
+                output = Json::Value(Json::StaticString("GM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGE)
+            {
+                output = Json::Value(Json::StaticString("GE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeDE)
+            {
+                output = Json::Value(Json::StaticString("DE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGH)
+            {
+                output = Json::Value(Json::StaticString("GH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGI)
+            {
+                output = Json::Value(Json::StaticString("GI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGR)
+            {
+                output = Json::Value(Json::StaticString("GR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGL)
+            {
+                output = Json::Value(Json::StaticString("GL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGD)
+            {
+                output = Json::Value(Json::StaticString("GD"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGP)
+            {
+                output = Json::Value(Json::StaticString("GP"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGU)
+            {
+                output = Json::Value(Json::StaticString("GU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGT)
+            {
+                output = Json::Value(Json::StaticString("GT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGG)
+            {
+                output = Json::Value(Json::StaticString("GG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGN)
+            {
+                output = Json::Value(Json::StaticString("GN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGW)
+            {
+                output = Json::Value(Json::StaticString("GW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGY)
+            {
+                output = Json::Value(Json::StaticString("GY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeHT)
+            {
+                output = Json::Value(Json::StaticString("HT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeHM)
+            {
+                output = Json::Value(Json::StaticString("HM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeVA)
+            {
+                output = Json::Value(Json::StaticString("VA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeHN)
+            {
+                output = Json::Value(Json::StaticString("HN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeHK)
+            {
+                output = Json::Value(Json::StaticString("HK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeHU)
+            {
+                output = Json::Value(Json::StaticString("HU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIS)
+            {
+                output = Json::Value(Json::StaticString("IS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIN)
+            {
+                output = Json::Value(Json::StaticString("IN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeID)
+            {
+                output = Json::Value(Json::StaticString("ID"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIR)
+            {
+                output = Json::Value(Json::StaticString("IR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIQ)
+            {
+                output = Json::Value(Json::StaticString("IQ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIE)
+            {
+                output = Json::Value(Json::StaticString("IE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIM)
+            {
+                output = Json::Value(Json::StaticString("IM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIL)
+            {
+                output = Json::Value(Json::StaticString("IL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIT)
+            {
+                output = Json::Value(Json::StaticString("IT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeJM)
+            {
+                output = Json::Value(Json::StaticString("JM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeJP)
+            {
+                output = Json::Value(Json::StaticString("JP"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeJE)
+            {
+                output = Json::Value(Json::StaticString("JE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeJO)
+            {
+                output = Json::Value(Json::StaticString("JO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKZ)
+            {
+                output = Json::Value(Json::StaticString("KZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKE)
+            {
+                output = Json::Value(Json::StaticString("KE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKI)
+            {
+                output = Json::Value(Json::StaticString("KI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKP)
+            {
+                output = Json::Value(Json::StaticString("KP"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKR)
+            {
+                output = Json::Value(Json::StaticString("KR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKW)
+            {
+                output = Json::Value(Json::StaticString("KW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKG)
+            {
+                output = Json::Value(Json::StaticString("KG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLA)
+            {
+                output = Json::Value(Json::StaticString("LA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLV)
+            {
+                output = Json::Value(Json::StaticString("LV"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLB)
+            {
+                output = Json::Value(Json::StaticString("LB"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLS)
+            {
+                output = Json::Value(Json::StaticString("LS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLR)
+            {
+                output = Json::Value(Json::StaticString("LR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLY)
+            {
+                output = Json::Value(Json::StaticString("LY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLI)
+            {
+                output = Json::Value(Json::StaticString("LI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLT)
+            {
+                output = Json::Value(Json::StaticString("LT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLU)
+            {
+                output = Json::Value(Json::StaticString("LU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMO)
+            {
+                output = Json::Value(Json::StaticString("MO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMK)
+            {
+                output = Json::Value(Json::StaticString("MK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMG)
+            {
+                output = Json::Value(Json::StaticString("MG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMW)
+            {
+                output = Json::Value(Json::StaticString("MW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMY)
+            {
+                output = Json::Value(Json::StaticString("MY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMV)
+            {
+                output = Json::Value(Json::StaticString("MV"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeML)
+            {
+                output = Json::Value(Json::StaticString("ML"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMT)
+            {
+                output = Json::Value(Json::StaticString("MT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMH)
+            {
+                output = Json::Value(Json::StaticString("MH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMQ)
+            {
+                output = Json::Value(Json::StaticString("MQ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMR)
+            {
+                output = Json::Value(Json::StaticString("MR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMU)
+            {
+                output = Json::Value(Json::StaticString("MU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeYT)
+            {
+                output = Json::Value(Json::StaticString("YT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMX)
+            {
+                output = Json::Value(Json::StaticString("MX"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeFM)
+            {
+                output = Json::Value(Json::StaticString("FM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMD)
+            {
+                output = Json::Value(Json::StaticString("MD"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMC)
+            {
+                output = Json::Value(Json::StaticString("MC"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMN)
+            {
+                output = Json::Value(Json::StaticString("MN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeME)
+            {
+                output = Json::Value(Json::StaticString("ME"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMS)
+            {
+                output = Json::Value(Json::StaticString("MS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMA)
+            {
+                output = Json::Value(Json::StaticString("MA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMZ)
+            {
+                output = Json::Value(Json::StaticString("MZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMM)
+            {
+                output = Json::Value(Json::StaticString("MM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNA)
+            {
+                output = Json::Value(Json::StaticString("NA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNR)
+            {
+                output = Json::Value(Json::StaticString("NR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNP)
+            {
+                output = Json::Value(Json::StaticString("NP"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNL)
+            {
+                output = Json::Value(Json::StaticString("NL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNC)
+            {
+                output = Json::Value(Json::StaticString("NC"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNZ)
+            {
+                output = Json::Value(Json::StaticString("NZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNI)
+            {
+                output = Json::Value(Json::StaticString("NI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNE)
+            {
+                output = Json::Value(Json::StaticString("NE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNG)
+            {
+                output = Json::Value(Json::StaticString("NG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNU)
+            {
+                output = Json::Value(Json::StaticString("NU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNF)
+            {
+                output = Json::Value(Json::StaticString("NF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMP)
+            {
+                output = Json::Value(Json::StaticString("MP"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNO)
+            {
+                output = Json::Value(Json::StaticString("NO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeOM)
+            {
+                output = Json::Value(Json::StaticString("OM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePK)
+            {
+                output = Json::Value(Json::StaticString("PK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePW)
+            {
+                output = Json::Value(Json::StaticString("PW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePS)
+            {
+                output = Json::Value(Json::StaticString("PS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePA)
+            {
+                output = Json::Value(Json::StaticString("PA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePG)
+            {
+                output = Json::Value(Json::StaticString("PG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePY)
+            {
+                output = Json::Value(Json::StaticString("PY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePE)
+            {
+                output = Json::Value(Json::StaticString("PE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePH)
+            {
+                output = Json::Value(Json::StaticString("PH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePN)
+            {
+                output = Json::Value(Json::StaticString("PN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePL)
+            {
+                output = Json::Value(Json::StaticString("PL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePT)
+            {
+                output = Json::Value(Json::StaticString("PT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePR)
+            {
+                output = Json::Value(Json::StaticString("PR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeQA)
+            {
+                output = Json::Value(Json::StaticString("QA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeRE)
+            {
+                output = Json::Value(Json::StaticString("RE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeRO)
+            {
+                output = Json::Value(Json::StaticString("RO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeRU)
+            {
+                output = Json::Value(Json::StaticString("RU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeRW)
+            {
+                output = Json::Value(Json::StaticString("RW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBL)
+            {
+                output = Json::Value(Json::StaticString("BL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSH)
+            {
+                output = Json::Value(Json::StaticString("SH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKN)
+            {
+                output = Json::Value(Json::StaticString("KN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLC)
+            {
+                output = Json::Value(Json::StaticString("LC"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMF)
+            {
+                output = Json::Value(Json::StaticString("MF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePM)
+            {
+                output = Json::Value(Json::StaticString("PM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeVC)
+            {
+                output = Json::Value(Json::StaticString("VC"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeWS)
+            {
+                output = Json::Value(Json::StaticString("WS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSM)
+            {
+                output = Json::Value(Json::StaticString("SM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeST)
+            {
+                output = Json::Value(Json::StaticString("ST"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSA)
+            {
+                output = Json::Value(Json::StaticString("SA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSN)
+            {
+                output = Json::Value(Json::StaticString("SN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeRS)
+            {
+                output = Json::Value(Json::StaticString("RS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSC)
+            {
+                output = Json::Value(Json::StaticString("SC"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSL)
+            {
+                output = Json::Value(Json::StaticString("SL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSG)
+            {
+                output = Json::Value(Json::StaticString("SG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSX)
+            {
+                output = Json::Value(Json::StaticString("SX"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSK)
+            {
+                output = Json::Value(Json::StaticString("SK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSI)
+            {
+                output = Json::Value(Json::StaticString("SI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSB)
+            {
+                output = Json::Value(Json::StaticString("SB"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSO)
+            {
+                output = Json::Value(Json::StaticString("SO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeZA)
+            {
+                output = Json::Value(Json::StaticString("ZA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGS)
+            {
+                output = Json::Value(Json::StaticString("GS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSS)
+            {
+                output = Json::Value(Json::StaticString("SS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeES)
+            {
+                output = Json::Value(Json::StaticString("ES"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLK)
+            {
+                output = Json::Value(Json::StaticString("LK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSD)
+            {
+                output = Json::Value(Json::StaticString("SD"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSR)
+            {
+                output = Json::Value(Json::StaticString("SR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSJ)
+            {
+                output = Json::Value(Json::StaticString("SJ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSZ)
+            {
+                output = Json::Value(Json::StaticString("SZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSE)
+            {
+                output = Json::Value(Json::StaticString("SE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCH)
+            {
+                output = Json::Value(Json::StaticString("CH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSY)
+            {
+                output = Json::Value(Json::StaticString("SY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTW)
+            {
+                output = Json::Value(Json::StaticString("TW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTJ)
+            {
+                output = Json::Value(Json::StaticString("TJ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTZ)
+            {
+                output = Json::Value(Json::StaticString("TZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTH)
+            {
+                output = Json::Value(Json::StaticString("TH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTL)
+            {
+                output = Json::Value(Json::StaticString("TL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTG)
+            {
+                output = Json::Value(Json::StaticString("TG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTK)
+            {
+                output = Json::Value(Json::StaticString("TK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTO)
+            {
+                output = Json::Value(Json::StaticString("TO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTT)
+            {
+                output = Json::Value(Json::StaticString("TT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTN)
+            {
+                output = Json::Value(Json::StaticString("TN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTR)
+            {
+                output = Json::Value(Json::StaticString("TR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTM)
+            {
+                output = Json::Value(Json::StaticString("TM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTC)
+            {
+                output = Json::Value(Json::StaticString("TC"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTV)
+            {
+                output = Json::Value(Json::StaticString("TV"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeUG)
+            {
+                output = Json::Value(Json::StaticString("UG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeUA)
+            {
+                output = Json::Value(Json::StaticString("UA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAE)
+            {
+                output = Json::Value(Json::StaticString("AE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGB)
+            {
+                output = Json::Value(Json::StaticString("GB"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeUS)
+            {
+                output = Json::Value(Json::StaticString("US"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeUM)
+            {
+                output = Json::Value(Json::StaticString("UM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeUY)
+            {
+                output = Json::Value(Json::StaticString("UY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeUZ)
+            {
+                output = Json::Value(Json::StaticString("UZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeVU)
+            {
+                output = Json::Value(Json::StaticString("VU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeVE)
+            {
+                output = Json::Value(Json::StaticString("VE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeVN)
+            {
+                output = Json::Value(Json::StaticString("VN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeVG)
+            {
+                output = Json::Value(Json::StaticString("VG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeVI)
+            {
+                output = Json::Value(Json::StaticString("VI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeWF)
+            {
+                output = Json::Value(Json::StaticString("WF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeEH)
+            {
+                output = Json::Value(Json::StaticString("EH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeYE)
+            {
+                output = Json::Value(Json::StaticString("YE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeZM)
+            {
+                output = Json::Value(Json::StaticString("ZM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeZW)
+            {
+                output = Json::Value(Json::StaticString("ZW"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, CountryCode& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "AF")
+            {
+                output = CountryCode::CountryCodeAF;
+                return;
+            }
+            if (inputStr == "AX")
+            {
+                output = CountryCode::CountryCodeAX;
+                return;
+            }
+            if (inputStr == "AL")
+            {
+                output = CountryCode::CountryCodeAL;
+                return;
+            }
+            if (inputStr == "DZ")
+            {
+                output = CountryCode::CountryCodeDZ;
+                return;
+            }
+            if (inputStr == "AS")
+            {
+                output = CountryCode::CountryCodeAS;
+                return;
+            }
+            if (inputStr == "AD")
+            {
+                output = CountryCode::CountryCodeAD;
+                return;
+            }
+            if (inputStr == "AO")
+            {
+                output = CountryCode::CountryCodeAO;
+                return;
+            }
+            if (inputStr == "AI")
+            {
+                output = CountryCode::CountryCodeAI;
+                return;
+            }
+            if (inputStr == "AQ")
+            {
+                output = CountryCode::CountryCodeAQ;
+                return;
+            }
+            if (inputStr == "AG")
+            {
+                output = CountryCode::CountryCodeAG;
+                return;
+            }
+            if (inputStr == "AR")
+            {
+                output = CountryCode::CountryCodeAR;
+                return;
+            }
+            if (inputStr == "AM")
+            {
+                output = CountryCode::CountryCodeAM;
+                return;
+            }
+            if (inputStr == "AW")
+            {
+                output = CountryCode::CountryCodeAW;
+                return;
+            }
+            if (inputStr == "AU")
+            {
+                output = CountryCode::CountryCodeAU;
+                return;
+            }
+            if (inputStr == "AT")
+            {
+                output = CountryCode::CountryCodeAT;
+                return;
+            }
+            if (inputStr == "AZ")
+            {
+                output = CountryCode::CountryCodeAZ;
+                return;
+            }
+            if (inputStr == "BS")
+            {
+                output = CountryCode::CountryCodeBS;
+                return;
+            }
+            if (inputStr == "BH")
+            {
+                output = CountryCode::CountryCodeBH;
+                return;
+            }
+            if (inputStr == "BD")
+            {
+                output = CountryCode::CountryCodeBD;
+                return;
+            }
+            if (inputStr == "BB")
+            {
+                output = CountryCode::CountryCodeBB;
+                return;
+            }
+            if (inputStr == "BY")
+            {
+                output = CountryCode::CountryCodeBY;
+                return;
+            }
+            if (inputStr == "BE")
+            {
+                output = CountryCode::CountryCodeBE;
+                return;
+            }
+            if (inputStr == "BZ")
+            {
+                output = CountryCode::CountryCodeBZ;
+                return;
+            }
+            if (inputStr == "BJ")
+            {
+                output = CountryCode::CountryCodeBJ;
+                return;
+            }
+            if (inputStr == "BM")
+            {
+                output = CountryCode::CountryCodeBM;
+                return;
+            }
+            if (inputStr == "BT")
+            {
+                output = CountryCode::CountryCodeBT;
+                return;
+            }
+            if (inputStr == "BO")
+            {
+                output = CountryCode::CountryCodeBO;
+                return;
+            }
+            if (inputStr == "BQ")
+            {
+                output = CountryCode::CountryCodeBQ;
+                return;
+            }
+            if (inputStr == "BA")
+            {
+                output = CountryCode::CountryCodeBA;
+                return;
+            }
+            if (inputStr == "BW")
+            {
+                output = CountryCode::CountryCodeBW;
+                return;
+            }
+            if (inputStr == "BV")
+            {
+                output = CountryCode::CountryCodeBV;
+                return;
+            }
+            if (inputStr == "BR")
+            {
+                output = CountryCode::CountryCodeBR;
+                return;
+            }
+            if (inputStr == "IO")
+            {
+                output = CountryCode::CountryCodeIO;
+                return;
+            }
+            if (inputStr == "BN")
+            {
+                output = CountryCode::CountryCodeBN;
+                return;
+            }
+            if (inputStr == "BG")
+            {
+                output = CountryCode::CountryCodeBG;
+                return;
+            }
+            if (inputStr == "BF")
+            {
+                output = CountryCode::CountryCodeBF;
+                return;
+            }
+            if (inputStr == "BI")
+            {
+                output = CountryCode::CountryCodeBI;
+                return;
+            }
+            if (inputStr == "KH")
+            {
+                output = CountryCode::CountryCodeKH;
+                return;
+            }
+            if (inputStr == "CM")
+            {
+                output = CountryCode::CountryCodeCM;
+                return;
+            }
+            if (inputStr == "CA")
+            {
+                output = CountryCode::CountryCodeCA;
+                return;
+            }
+            if (inputStr == "CV")
+            {
+                output = CountryCode::CountryCodeCV;
+                return;
+            }
+            if (inputStr == "KY")
+            {
+                output = CountryCode::CountryCodeKY;
+                return;
+            }
+            if (inputStr == "CF")
+            {
+                output = CountryCode::CountryCodeCF;
+                return;
+            }
+            if (inputStr == "TD")
+            {
+                output = CountryCode::CountryCodeTD;
+                return;
+            }
+            if (inputStr == "CL")
+            {
+                output = CountryCode::CountryCodeCL;
+                return;
+            }
+            if (inputStr == "CN")
+            {
+                output = CountryCode::CountryCodeCN;
+                return;
+            }
+            if (inputStr == "CX")
+            {
+                output = CountryCode::CountryCodeCX;
+                return;
+            }
+            if (inputStr == "CC")
+            {
+                output = CountryCode::CountryCodeCC;
+                return;
+            }
+            if (inputStr == "CO")
+            {
+                output = CountryCode::CountryCodeCO;
+                return;
+            }
+            if (inputStr == "KM")
+            {
+                output = CountryCode::CountryCodeKM;
+                return;
+            }
+            if (inputStr == "CG")
+            {
+                output = CountryCode::CountryCodeCG;
+                return;
+            }
+            if (inputStr == "CD")
+            {
+                output = CountryCode::CountryCodeCD;
+                return;
+            }
+            if (inputStr == "CK")
+            {
+                output = CountryCode::CountryCodeCK;
+                return;
+            }
+            if (inputStr == "CR")
+            {
+                output = CountryCode::CountryCodeCR;
+                return;
+            }
+            if (inputStr == "CI")
+            {
+                output = CountryCode::CountryCodeCI;
+                return;
+            }
+            if (inputStr == "HR")
+            {
+                output = CountryCode::CountryCodeHR;
+                return;
+            }
+            if (inputStr == "CU")
+            {
+                output = CountryCode::CountryCodeCU;
+                return;
+            }
+            if (inputStr == "CW")
+            {
+                output = CountryCode::CountryCodeCW;
+                return;
+            }
+            if (inputStr == "CY")
+            {
+                output = CountryCode::CountryCodeCY;
+                return;
+            }
+            if (inputStr == "CZ")
+            {
+                output = CountryCode::CountryCodeCZ;
+                return;
+            }
+            if (inputStr == "DK")
+            {
+                output = CountryCode::CountryCodeDK;
+                return;
+            }
+            if (inputStr == "DJ")
+            {
+                output = CountryCode::CountryCodeDJ;
+                return;
+            }
+            if (inputStr == "DM")
+            {
+                output = CountryCode::CountryCodeDM;
+                return;
+            }
+            if (inputStr == "DO")
+            {
+                output = CountryCode::CountryCodeDO;
+                return;
+            }
+            if (inputStr == "EC")
+            {
+                output = CountryCode::CountryCodeEC;
+                return;
+            }
+            if (inputStr == "EG")
+            {
+                output = CountryCode::CountryCodeEG;
+                return;
+            }
+            if (inputStr == "SV")
+            {
+                output = CountryCode::CountryCodeSV;
+                return;
+            }
+            if (inputStr == "GQ")
+            {
+                output = CountryCode::CountryCodeGQ;
+                return;
+            }
+            if (inputStr == "ER")
+            {
+                output = CountryCode::CountryCodeER;
+                return;
+            }
+            if (inputStr == "EE")
+            {
+                output = CountryCode::CountryCodeEE;
+                return;
+            }
+            if (inputStr == "ET")
+            {
+                output = CountryCode::CountryCodeET;
+                return;
+            }
+            if (inputStr == "FK")
+            {
+                output = CountryCode::CountryCodeFK;
+                return;
+            }
+            if (inputStr == "FO")
+            {
+                output = CountryCode::CountryCodeFO;
+                return;
+            }
+            if (inputStr == "FJ")
+            {
+                output = CountryCode::CountryCodeFJ;
+                return;
+            }
+            if (inputStr == "FI")
+            {
+                output = CountryCode::CountryCodeFI;
+                return;
+            }
+            if (inputStr == "FR")
+            {
+                output = CountryCode::CountryCodeFR;
+                return;
+            }
+            if (inputStr == "GF")
+            {
+                output = CountryCode::CountryCodeGF;
+                return;
+            }
+            if (inputStr == "PF")
+            {
+                output = CountryCode::CountryCodePF;
+                return;
+            }
+            if (inputStr == "TF")
+            {
+                output = CountryCode::CountryCodeTF;
+                return;
+            }
+            if (inputStr == "GA")
+            {
+                output = CountryCode::CountryCodeGA;
+                return;
+            }
+            if (inputStr == "GM")
+            {
+                output = CountryCode::CountryCodeGM;
+                return;
+            }
+            if (inputStr == "GE")
+            {
+                output = CountryCode::CountryCodeGE;
+                return;
+            }
+            if (inputStr == "DE")
+            {
+                output = CountryCode::CountryCodeDE;
+                return;
+            }
+            if (inputStr == "GH")
+            {
+                output = CountryCode::CountryCodeGH;
+                return;
+            }
+            if (inputStr == "GI")
+            {
+                output = CountryCode::CountryCodeGI;
+                return;
+            }
+            if (inputStr == "GR")
+            {
+                output = CountryCode::CountryCodeGR;
+                return;
+            }
+            if (inputStr == "GL")
+            {
+                output = CountryCode::CountryCodeGL;
+                return;
+            }
+            if (inputStr == "GD")
+            {
+                output = CountryCode::CountryCodeGD;
+                return;
+            }
+            if (inputStr == "GP")
+            {
+                output = CountryCode::CountryCodeGP;
+                return;
+            }
+            if (inputStr == "GU")
+            {
+                output = CountryCode::CountryCodeGU;
+                return;
+            }
+            if (inputStr == "GT")
+            {
+                output = CountryCode::CountryCodeGT;
+                return;
+            }
+            if (inputStr == "GG")
+            {
+                output = CountryCode::CountryCodeGG;
+                return;
+            }
+            if (inputStr == "GN")
+            {
+                output = CountryCode::CountryCodeGN;
+                return;
+            }
+            if (inputStr == "GW")
+            {
+                output = CountryCode::CountryCodeGW;
+                return;
+            }
+            if (inputStr == "GY")
+            {
+                output = CountryCode::CountryCodeGY;
+                return;
+            }
+            if (inputStr == "HT")
+            {
+                output = CountryCode::CountryCodeHT;
+                return;
+            }
+            if (inputStr == "HM")
+            {
+                output = CountryCode::CountryCodeHM;
+                return;
+            }
+            if (inputStr == "VA")
+            {
+                output = CountryCode::CountryCodeVA;
+                return;
+            }
+            if (inputStr == "HN")
+            {
+                output = CountryCode::CountryCodeHN;
+                return;
+            }
+            if (inputStr == "HK")
+            {
+                output = CountryCode::CountryCodeHK;
+                return;
+            }
+            if (inputStr == "HU")
+            {
+                output = CountryCode::CountryCodeHU;
+                return;
+            }
+            if (inputStr == "IS")
+            {
+                output = CountryCode::CountryCodeIS;
+                return;
+            }
+            if (inputStr == "IN")
+            {
+                output = CountryCode::CountryCodeIN;
+                return;
+            }
+            if (inputStr == "ID")
+            {
+                output = CountryCode::CountryCodeID;
+                return;
+            }
+            if (inputStr == "IR")
+            {
+                output = CountryCode::CountryCodeIR;
+                return;
+            }
+            if (inputStr == "IQ")
+            {
+                output = CountryCode::CountryCodeIQ;
+                return;
+            }
+            if (inputStr == "IE")
+            {
+                output = CountryCode::CountryCodeIE;
+                return;
+            }
+            if (inputStr == "IM")
+            {
+                output = CountryCode::CountryCodeIM;
+                return;
+            }
+            if (inputStr == "IL")
+            {
+                output = CountryCode::CountryCodeIL;
+                return;
+            }
+            if (inputStr == "IT")
+            {
+                output = CountryCode::CountryCodeIT;
+                return;
+            }
+            if (inputStr == "JM")
+            {
+                output = CountryCode::CountryCodeJM;
+                return;
+            }
+            if (inputStr == "JP")
+            {
+                output = CountryCode::CountryCodeJP;
+                return;
+            }
+            if (inputStr == "JE")
+            {
+                output = CountryCode::CountryCodeJE;
+                return;
+            }
+            if (inputStr == "JO")
+            {
+                output = CountryCode::CountryCodeJO;
+                return;
+            }
+            if (inputStr == "KZ")
+            {
+                output = CountryCode::CountryCodeKZ;
+                return;
+            }
+            if (inputStr == "KE")
+            {
+                output = CountryCode::CountryCodeKE;
+                return;
+            }
+            if (inputStr == "KI")
+            {
+                output = CountryCode::CountryCodeKI;
+                return;
+            }
+            if (inputStr == "KP")
+            {
+                output = CountryCode::CountryCodeKP;
+                return;
+            }
+            if (inputStr == "KR")
+            {
+                output = CountryCode::CountryCodeKR;
+                return;
+            }
+            if (inputStr == "KW")
+            {
+                output = CountryCode::CountryCodeKW;
+                return;
+            }
+            if (inputStr == "KG")
+            {
+                output = CountryCode::CountryCodeKG;
+                return;
+            }
+            if (inputStr == "LA")
+            {
+                output = CountryCode::CountryCodeLA;
+                return;
+            }
+            if (inputStr == "LV")
+            {
+                output = CountryCode::CountryCodeLV;
+                return;
+            }
+            if (inputStr == "LB")
+            {
+                output = CountryCode::CountryCodeLB;
+                return;
+            }
+            if (inputStr == "LS")
+            {
+                output = CountryCode::CountryCodeLS;
+                return;
+            }
+            if (inputStr == "LR")
+            {
+                output = CountryCode::CountryCodeLR;
+                return;
+            }
+            if (inputStr == "LY")
+            {
+                output = CountryCode::CountryCodeLY;
+                return;
+            }
+            if (inputStr == "LI")
+            {
+                output = CountryCode::CountryCodeLI;
+                return;
+            }
+            if (inputStr == "LT")
+            {
+                output = CountryCode::CountryCodeLT;
+                return;
+            }
+            if (inputStr == "LU")
+            {
+                output = CountryCode::CountryCodeLU;
+                return;
+            }
+            if (inputStr == "MO")
+            {
+                output = CountryCode::CountryCodeMO;
+                return;
+            }
+            if (inputStr == "MK")
+            {
+                output = CountryCode::CountryCodeMK;
+                return;
+            }
+            if (inputStr == "MG")
+            {
+                output = CountryCode::CountryCodeMG;
+                return;
+            }
+            if (inputStr == "MW")
+            {
+                output = CountryCode::CountryCodeMW;
+                return;
+            }
+            if (inputStr == "MY")
+            {
+                output = CountryCode::CountryCodeMY;
+                return;
+            }
+            if (inputStr == "MV")
+            {
+                output = CountryCode::CountryCodeMV;
+                return;
+            }
+            if (inputStr == "ML")
+            {
+                output = CountryCode::CountryCodeML;
+                return;
+            }
+            if (inputStr == "MT")
+            {
+                output = CountryCode::CountryCodeMT;
+                return;
+            }
+            if (inputStr == "MH")
+            {
+                output = CountryCode::CountryCodeMH;
+                return;
+            }
+            if (inputStr == "MQ")
+            {
+                output = CountryCode::CountryCodeMQ;
+                return;
+            }
+            if (inputStr == "MR")
+            {
+                output = CountryCode::CountryCodeMR;
+                return;
+            }
+            if (inputStr == "MU")
+            {
+                output = CountryCode::CountryCodeMU;
+                return;
+            }
+            if (inputStr == "YT")
+            {
+                output = CountryCode::CountryCodeYT;
+                return;
+            }
+            if (inputStr == "MX")
+            {
+                output = CountryCode::CountryCodeMX;
+                return;
+            }
+            if (inputStr == "FM")
+            {
+                output = CountryCode::CountryCodeFM;
+                return;
+            }
+            if (inputStr == "MD")
+            {
+                output = CountryCode::CountryCodeMD;
+                return;
+            }
+            if (inputStr == "MC")
+            {
+                output = CountryCode::CountryCodeMC;
+                return;
+            }
+            if (inputStr == "MN")
+            {
+                output = CountryCode::CountryCodeMN;
+                return;
+            }
+            if (inputStr == "ME")
+            {
+                output = CountryCode::CountryCodeME;
+                return;
+            }
+            if (inputStr == "MS")
+            {
+                output = CountryCode::CountryCodeMS;
+                return;
+            }
+            if (inputStr == "MA")
+            {
+                output = CountryCode::CountryCodeMA;
+                return;
+            }
+            if (inputStr == "MZ")
+            {
+                output = CountryCode::CountryCodeMZ;
+                return;
+            }
+            if (inputStr == "MM")
+            {
+                output = CountryCode::CountryCodeMM;
+                return;
+            }
+            if (inputStr == "NA")
+            {
+                output = CountryCode::CountryCodeNA;
+                return;
+            }
+            if (inputStr == "NR")
+            {
+                output = CountryCode::CountryCodeNR;
+                return;
+            }
+            if (inputStr == "NP")
+            {
+                output = CountryCode::CountryCodeNP;
+                return;
+            }
+            if (inputStr == "NL")
+            {
+                output = CountryCode::CountryCodeNL;
+                return;
+            }
+            if (inputStr == "NC")
+            {
+                output = CountryCode::CountryCodeNC;
+                return;
+            }
+            if (inputStr == "NZ")
+            {
+                output = CountryCode::CountryCodeNZ;
+                return;
+            }
+            if (inputStr == "NI")
+            {
+                output = CountryCode::CountryCodeNI;
+                return;
+            }
+            if (inputStr == "NE")
+            {
+                output = CountryCode::CountryCodeNE;
+                return;
+            }
+            if (inputStr == "NG")
+            {
+                output = CountryCode::CountryCodeNG;
+                return;
+            }
+            if (inputStr == "NU")
+            {
+                output = CountryCode::CountryCodeNU;
+                return;
+            }
+            if (inputStr == "NF")
+            {
+                output = CountryCode::CountryCodeNF;
+                return;
+            }
+            if (inputStr == "MP")
+            {
+                output = CountryCode::CountryCodeMP;
+                return;
+            }
+            if (inputStr == "NO")
+            {
+                output = CountryCode::CountryCodeNO;
+                return;
+            }
+            if (inputStr == "OM")
+            {
+                output = CountryCode::CountryCodeOM;
+                return;
+            }
+            if (inputStr == "PK")
+            {
+                output = CountryCode::CountryCodePK;
+                return;
+            }
+            if (inputStr == "PW")
+            {
+                output = CountryCode::CountryCodePW;
+                return;
+            }
+            if (inputStr == "PS")
+            {
+                output = CountryCode::CountryCodePS;
+                return;
+            }
+            if (inputStr == "PA")
+            {
+                output = CountryCode::CountryCodePA;
+                return;
+            }
+            if (inputStr == "PG")
+            {
+                output = CountryCode::CountryCodePG;
+                return;
+            }
+            if (inputStr == "PY")
+            {
+                output = CountryCode::CountryCodePY;
+                return;
+            }
+            if (inputStr == "PE")
+            {
+                output = CountryCode::CountryCodePE;
+                return;
+            }
+            if (inputStr == "PH")
+            {
+                output = CountryCode::CountryCodePH;
+                return;
+            }
+            if (inputStr == "PN")
+            {
+                output = CountryCode::CountryCodePN;
+                return;
+            }
+            if (inputStr == "PL")
+            {
+                output = CountryCode::CountryCodePL;
+                return;
+            }
+            if (inputStr == "PT")
+            {
+                output = CountryCode::CountryCodePT;
+                return;
+            }
+            if (inputStr == "PR")
+            {
+                output = CountryCode::CountryCodePR;
+                return;
+            }
+            if (inputStr == "QA")
+            {
+                output = CountryCode::CountryCodeQA;
+                return;
+            }
+            if (inputStr == "RE")
+            {
+                output = CountryCode::CountryCodeRE;
+                return;
+            }
+            if (inputStr == "RO")
+            {
+                output = CountryCode::CountryCodeRO;
+                return;
+            }
+            if (inputStr == "RU")
+            {
+                output = CountryCode::CountryCodeRU;
+                return;
+            }
+            if (inputStr == "RW")
+            {
+                output = CountryCode::CountryCodeRW;
+                return;
+            }
+            if (inputStr == "BL")
+            {
+                output = CountryCode::CountryCodeBL;
+                return;
+            }
+            if (inputStr == "SH")
+            {
+                output = CountryCode::CountryCodeSH;
+                return;
+            }
+            if (inputStr == "KN")
+            {
+                output = CountryCode::CountryCodeKN;
+                return;
+            }
+            if (inputStr == "LC")
+            {
+                output = CountryCode::CountryCodeLC;
+                return;
+            }
+            if (inputStr == "MF")
+            {
+                output = CountryCode::CountryCodeMF;
+                return;
+            }
+            if (inputStr == "PM")
+            {
+                output = CountryCode::CountryCodePM;
+                return;
+            }
+            if (inputStr == "VC")
+            {
+                output = CountryCode::CountryCodeVC;
+                return;
+            }
+            if (inputStr == "WS")
+            {
+                output = CountryCode::CountryCodeWS;
+                return;
+            }
+            if (inputStr == "SM")
+            {
+                output = CountryCode::CountryCodeSM;
+                return;
+            }
+            if (inputStr == "ST")
+            {
+                output = CountryCode::CountryCodeST;
+                return;
+            }
+            if (inputStr == "SA")
+            {
+                output = CountryCode::CountryCodeSA;
+                return;
+            }
+            if (inputStr == "SN")
+            {
+                output = CountryCode::CountryCodeSN;
+                return;
+            }
+            if (inputStr == "RS")
+            {
+                output = CountryCode::CountryCodeRS;
+                return;
+            }
+            if (inputStr == "SC")
+            {
+                output = CountryCode::CountryCodeSC;
+                return;
+            }
+            if (inputStr == "SL")
+            {
+                output = CountryCode::CountryCodeSL;
+                return;
+            }
+            if (inputStr == "SG")
+            {
+                output = CountryCode::CountryCodeSG;
+                return;
+            }
+            if (inputStr == "SX")
+            {
+                output = CountryCode::CountryCodeSX;
+                return;
+            }
+            if (inputStr == "SK")
+            {
+                output = CountryCode::CountryCodeSK;
+                return;
+            }
+            if (inputStr == "SI")
+            {
+                output = CountryCode::CountryCodeSI;
+                return;
+            }
+            if (inputStr == "SB")
+            {
+                output = CountryCode::CountryCodeSB;
+                return;
+            }
+            if (inputStr == "SO")
+            {
+                output = CountryCode::CountryCodeSO;
+                return;
+            }
+            if (inputStr == "ZA")
+            {
+                output = CountryCode::CountryCodeZA;
+                return;
+            }
+            if (inputStr == "GS")
+            {
+                output = CountryCode::CountryCodeGS;
+                return;
+            }
+            if (inputStr == "SS")
+            {
+                output = CountryCode::CountryCodeSS;
+                return;
+            }
+            if (inputStr == "ES")
+            {
+                output = CountryCode::CountryCodeES;
+                return;
+            }
+            if (inputStr == "LK")
+            {
+                output = CountryCode::CountryCodeLK;
+                return;
+            }
+            if (inputStr == "SD")
+            {
+                output = CountryCode::CountryCodeSD;
+                return;
+            }
+            if (inputStr == "SR")
+            {
+                output = CountryCode::CountryCodeSR;
+                return;
+            }
+            if (inputStr == "SJ")
+            {
+                output = CountryCode::CountryCodeSJ;
+                return;
+            }
+            if (inputStr == "SZ")
+            {
+                output = CountryCode::CountryCodeSZ;
+                return;
+            }
+            if (inputStr == "SE")
+            {
+                output = CountryCode::CountryCodeSE;
+                return;
+            }
+            if (inputStr == "CH")
+            {
+                output = CountryCode::CountryCodeCH;
+                return;
+            }
+            if (inputStr == "SY")
+            {
+                output = CountryCode::CountryCodeSY;
+                return;
+            }
+            if (inputStr == "TW")
+            {
+                output = CountryCode::CountryCodeTW;
+                return;
+            }
+            if (inputStr == "TJ")
+            {
+                output = CountryCode::CountryCodeTJ;
+                return;
+            }
+            if (inputStr == "TZ")
+            {
+                output = CountryCode::CountryCodeTZ;
+                return;
+            }
+            if (inputStr == "TH")
+            {
+                output = CountryCode::CountryCodeTH;
+                return;
+            }
+            if (inputStr == "TL")
+            {
+                output = CountryCode::CountryCodeTL;
+                return;
+            }
+            if (inputStr == "TG")
+            {
+                output = CountryCode::CountryCodeTG;
+                return;
+            }
+            if (inputStr == "TK")
+            {
+                output = CountryCode::CountryCodeTK;
+                return;
+            }
+            if (inputStr == "TO")
+            {
+                output = CountryCode::CountryCodeTO;
+                return;
+            }
+            if (inputStr == "TT")
+            {
+                output = CountryCode::CountryCodeTT;
+                return;
+            }
+            if (inputStr == "TN")
+            {
+                output = CountryCode::CountryCodeTN;
+                return;
+            }
+            if (inputStr == "TR")
+            {
+                output = CountryCode::CountryCodeTR;
+                return;
+            }
+            if (inputStr == "TM")
+            {
+                output = CountryCode::CountryCodeTM;
+                return;
+            }
+            if (inputStr == "TC")
+            {
+                output = CountryCode::CountryCodeTC;
+                return;
+            }
+            if (inputStr == "TV")
+            {
+                output = CountryCode::CountryCodeTV;
+                return;
+            }
+            if (inputStr == "UG")
+            {
+                output = CountryCode::CountryCodeUG;
+                return;
+            }
+            if (inputStr == "UA")
+            {
+                output = CountryCode::CountryCodeUA;
+                return;
+            }
+            if (inputStr == "AE")
+            {
+                output = CountryCode::CountryCodeAE;
+                return;
+            }
+            if (inputStr == "GB")
+            {
+                output = CountryCode::CountryCodeGB;
+                return;
+            }
+            if (inputStr == "US")
+            {
+                output = CountryCode::CountryCodeUS;
+                return;
+            }
+            if (inputStr == "UM")
+            {
+                output = CountryCode::CountryCodeUM;
+                return;
+            }
+            if (inputStr == "UY")
+            {
+                output = CountryCode::CountryCodeUY;
+                return;
+            }
+            if (inputStr == "UZ")
+            {
+                output = CountryCode::CountryCodeUZ;
+                return;
+            }
+            if (inputStr == "VU")
+            {
+                output = CountryCode::CountryCodeVU;
+                return;
+            }
+            if (inputStr == "VE")
+            {
+                output = CountryCode::CountryCodeVE;
+                return;
+            }
+            if (inputStr == "VN")
+            {
+                output = CountryCode::CountryCodeVN;
+                return;
+            }
+            if (inputStr == "VG")
+            {
+                output = CountryCode::CountryCodeVG;
+                return;
+            }
+            if (inputStr == "VI")
+            {
+                output = CountryCode::CountryCodeVI;
+                return;
+            }
+            if (inputStr == "WF")
+            {
+                output = CountryCode::CountryCodeWF;
+                return;
+            }
+            if (inputStr == "EH")
+            {
+                output = CountryCode::CountryCodeEH;
+                return;
+            }
+            if (inputStr == "YE")
+            {
+                output = CountryCode::CountryCodeYE;
+                return;
+            }
+            if (inputStr == "ZM")
+            {
+                output = CountryCode::CountryCodeZM;
+                return;
+            }
+            if (inputStr == "ZW")
+            {
+                output = CountryCode::CountryCodeZW;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const Currency input, Json::Value& output)
+        {
+            if (input == Currency::CurrencyAED)
+            {
+                output = Json::Value(Json::StaticString("AED"));
+                return;
+            }
+            if (input == Currency::CurrencyAFN)
+            {
+                output = Json::Value(Json::StaticString("AFN"));
+                return;
+            }
+            if (input == Currency::CurrencyALL)
+            {
+                output = Json::Value(Json::StaticString("ALL"));
+                return;
+            }
+            if (input == Currency::CurrencyAMD)
+            {
+                output = Json::Value(Json::StaticString("AMD"));
+                return;
+            }
+            if (input == Currency::CurrencyANG)
+            {
+                output = Json::Value(Json::StaticString("ANG"));
+                return;
+            }
+            if (input == Currency::CurrencyAOA)
+            {
+                output = Json::Value(Json::StaticString("AOA"));
+                return;
+            }
+            if (input == Currency::CurrencyARS)
+            {
+                output = Json::Value(Json::StaticString("ARS"));
+                return;
+            }
+            if (input == Currency::CurrencyAUD)
+            {
+                output = Json::Value(Json::StaticString("AUD"));
+                return;
+            }
+            if (input == Currency::CurrencyAWG)
+            {
+                output = Json::Value(Json::StaticString("AWG"));
+                return;
+            }
+            if (input == Currency::CurrencyAZN)
+            {
+                output = Json::Value(Json::StaticString("AZN"));
+                return;
+            }
+            if (input == Currency::CurrencyBAM)
+            {
+                output = Json::Value(Json::StaticString("BAM"));
+                return;
+            }
+            if (input == Currency::CurrencyBBD)
+            {
+                output = Json::Value(Json::StaticString("BBD"));
+                return;
+            }
+            if (input == Currency::CurrencyBDT)
+            {
+                output = Json::Value(Json::StaticString("BDT"));
+                return;
+            }
+            if (input == Currency::CurrencyBGN)
+            {
+                output = Json::Value(Json::StaticString("BGN"));
+                return;
+            }
+            if (input == Currency::CurrencyBHD)
+            {
+                output = Json::Value(Json::StaticString("BHD"));
+                return;
+            }
+            if (input == Currency::CurrencyBIF)
+            {
+                output = Json::Value(Json::StaticString("BIF"));
+                return;
+            }
+            if (input == Currency::CurrencyBMD)
+            {
+                output = Json::Value(Json::StaticString("BMD"));
+                return;
+            }
+            if (input == Currency::CurrencyBND)
+            {
+                output = Json::Value(Json::StaticString("BND"));
+                return;
+            }
+            if (input == Currency::CurrencyBOB)
+            {
+                output = Json::Value(Json::StaticString("BOB"));
+                return;
+            }
+            if (input == Currency::CurrencyBRL)
+            {
+                output = Json::Value(Json::StaticString("BRL"));
+                return;
+            }
+            if (input == Currency::CurrencyBSD)
+            {
+                output = Json::Value(Json::StaticString("BSD"));
+                return;
+            }
+            if (input == Currency::CurrencyBTN)
+            {
+                output = Json::Value(Json::StaticString("BTN"));
+                return;
+            }
+            if (input == Currency::CurrencyBWP)
+            {
+                output = Json::Value(Json::StaticString("BWP"));
+                return;
+            }
+            if (input == Currency::CurrencyBYR)
+            {
+                output = Json::Value(Json::StaticString("BYR"));
+                return;
+            }
+            if (input == Currency::CurrencyBZD)
+            {
+                output = Json::Value(Json::StaticString("BZD"));
+                return;
+            }
+            if (input == Currency::CurrencyCAD)
+            {
+                output = Json::Value(Json::StaticString("CAD"));
+                return;
+            }
+            if (input == Currency::CurrencyCDF)
+            {
+                output = Json::Value(Json::StaticString("CDF"));
+                return;
+            }
+            if (input == Currency::CurrencyCHF)
+            {
+                output = Json::Value(Json::StaticString("CHF"));
+                return;
+            }
+            if (input == Currency::CurrencyCLP)
+            {
+                output = Json::Value(Json::StaticString("CLP"));
+                return;
+            }
+            if (input == Currency::CurrencyCNY)
+            {
+                output = Json::Value(Json::StaticString("CNY"));
+                return;
+            }
+            if (input == Currency::CurrencyCOP)
+            {
+                output = Json::Value(Json::StaticString("COP"));
+                return;
+            }
+            if (input == Currency::CurrencyCRC)
+            {
+                output = Json::Value(Json::StaticString("CRC"));
+                return;
+            }
+            if (input == Currency::CurrencyCUC)
+            {
+                output = Json::Value(Json::StaticString("CUC"));
+                return;
+            }
+            if (input == Currency::CurrencyCUP)
+            {
+                output = Json::Value(Json::StaticString("CUP"));
+                return;
+            }
+            if (input == Currency::CurrencyCVE)
+            {
+                output = Json::Value(Json::StaticString("CVE"));
+                return;
+            }
+            if (input == Currency::CurrencyCZK)
+            {
+                output = Json::Value(Json::StaticString("CZK"));
+                return;
+            }
+            if (input == Currency::CurrencyDJF)
+            {
+                output = Json::Value(Json::StaticString("DJF"));
+                return;
+            }
+            if (input == Currency::CurrencyDKK)
+            {
+                output = Json::Value(Json::StaticString("DKK"));
+                return;
+            }
+            if (input == Currency::CurrencyDOP)
+            {
+                output = Json::Value(Json::StaticString("DOP"));
+                return;
+            }
+            if (input == Currency::CurrencyDZD)
+            {
+                output = Json::Value(Json::StaticString("DZD"));
+                return;
+            }
+            if (input == Currency::CurrencyEGP)
+            {
+                output = Json::Value(Json::StaticString("EGP"));
+                return;
+            }
+            if (input == Currency::CurrencyERN)
+            {
+                output = Json::Value(Json::StaticString("ERN"));
+                return;
+            }
+            if (input == Currency::CurrencyETB)
+            {
+                output = Json::Value(Json::StaticString("ETB"));
+                return;
+            }
+            if (input == Currency::CurrencyEUR)
+            {
+                output = Json::Value(Json::StaticString("EUR"));
+                return;
+            }
+            if (input == Currency::CurrencyFJD)
+            {
+                output = Json::Value(Json::StaticString("FJD"));
+                return;
+            }
+            if (input == Currency::CurrencyFKP)
+            {
+                output = Json::Value(Json::StaticString("FKP"));
+                return;
+            }
+            if (input == Currency::CurrencyGBP)
+            {
+                output = Json::Value(Json::StaticString("GBP"));
+                return;
+            }
+            if (input == Currency::CurrencyGEL)
+            {
+                output = Json::Value(Json::StaticString("GEL"));
+                return;
+            }
+            if (input == Currency::CurrencyGGP)
+            {
+                output = Json::Value(Json::StaticString("GGP"));
+                return;
+            }
+            if (input == Currency::CurrencyGHS)
+            {
+                output = Json::Value(Json::StaticString("GHS"));
+                return;
+            }
+            if (input == Currency::CurrencyGIP)
+            {
+                output = Json::Value(Json::StaticString("GIP"));
+                return;
+            }
+            if (input == Currency::CurrencyGMD)
+            {
+                output = Json::Value(Json::StaticString("GMD"));
+                return;
+            }
+            if (input == Currency::CurrencyGNF)
+            {
+                output = Json::Value(Json::StaticString("GNF"));
+                return;
+            }
+            if (input == Currency::CurrencyGTQ)
+            {
+                output = Json::Value(Json::StaticString("GTQ"));
+                return;
+            }
+            if (input == Currency::CurrencyGYD)
+            {
+                output = Json::Value(Json::StaticString("GYD"));
+                return;
+            }
+            if (input == Currency::CurrencyHKD)
+            {
+                output = Json::Value(Json::StaticString("HKD"));
+                return;
+            }
+            if (input == Currency::CurrencyHNL)
+            {
+                output = Json::Value(Json::StaticString("HNL"));
+                return;
+            }
+            if (input == Currency::CurrencyHRK)
+            {
+                output = Json::Value(Json::StaticString("HRK"));
+                return;
+            }
+            if (input == Currency::CurrencyHTG)
+            {
+                output = Json::Value(Json::StaticString("HTG"));
+                return;
+            }
+            if (input == Currency::CurrencyHUF)
+            {
+                output = Json::Value(Json::StaticString("HUF"));
+                return;
+            }
+            if (input == Currency::CurrencyIDR)
+            {
+                output = Json::Value(Json::StaticString("IDR"));
+                return;
+            }
+            if (input == Currency::CurrencyILS)
+            {
+                output = Json::Value(Json::StaticString("ILS"));
+                return;
+            }
+            if (input == Currency::CurrencyIMP)
+            {
+                output = Json::Value(Json::StaticString("IMP"));
+                return;
+            }
+            if (input == Currency::CurrencyINR)
+            {
+                output = Json::Value(Json::StaticString("INR"));
+                return;
+            }
+            if (input == Currency::CurrencyIQD)
+            {
+                output = Json::Value(Json::StaticString("IQD"));
+                return;
+            }
+            if (input == Currency::CurrencyIRR)
+            {
+                output = Json::Value(Json::StaticString("IRR"));
+                return;
+            }
+            if (input == Currency::CurrencyISK)
+            {
+                output = Json::Value(Json::StaticString("ISK"));
+                return;
+            }
+            if (input == Currency::CurrencyJEP)
+            {
+                output = Json::Value(Json::StaticString("JEP"));
+                return;
+            }
+            if (input == Currency::CurrencyJMD)
+            {
+                output = Json::Value(Json::StaticString("JMD"));
+                return;
+            }
+            if (input == Currency::CurrencyJOD)
+            {
+                output = Json::Value(Json::StaticString("JOD"));
+                return;
+            }
+            if (input == Currency::CurrencyJPY)
+            {
+                output = Json::Value(Json::StaticString("JPY"));
+                return;
+            }
+            if (input == Currency::CurrencyKES)
+            {
+                output = Json::Value(Json::StaticString("KES"));
+                return;
+            }
+            if (input == Currency::CurrencyKGS)
+            {
+                output = Json::Value(Json::StaticString("KGS"));
+                return;
+            }
+            if (input == Currency::CurrencyKHR)
+            {
+                output = Json::Value(Json::StaticString("KHR"));
+                return;
+            }
+            if (input == Currency::CurrencyKMF)
+            {
+                output = Json::Value(Json::StaticString("KMF"));
+                return;
+            }
+            if (input == Currency::CurrencyKPW)
+            {
+                output = Json::Value(Json::StaticString("KPW"));
+                return;
+            }
+            if (input == Currency::CurrencyKRW)
+            {
+                output = Json::Value(Json::StaticString("KRW"));
+                return;
+            }
+            if (input == Currency::CurrencyKWD)
+            {
+                output = Json::Value(Json::StaticString("KWD"));
+                return;
+            }
+            if (input == Currency::CurrencyKYD)
+            {
+                output = Json::Value(Json::StaticString("KYD"));
+                return;
+            }
+            if (input == Currency::CurrencyKZT)
+            {
+                output = Json::Value(Json::StaticString("KZT"));
+                return;
+            }
+            if (input == Currency::CurrencyLAK)
+            {
+                output = Json::Value(Json::StaticString("LAK"));
+                return;
+            }
+            if (input == Currency::CurrencyLBP)
+            {
+                output = Json::Value(Json::StaticString("LBP"));
+                return;
+            }
+            if (input == Currency::CurrencyLKR)
+            {
+                output = Json::Value(Json::StaticString("LKR"));
+                return;
+            }
+            if (input == Currency::CurrencyLRD)
+            {
+                output = Json::Value(Json::StaticString("LRD"));
+                return;
+            }
+            if (input == Currency::CurrencyLSL)
+            {
+                output = Json::Value(Json::StaticString("LSL"));
+                return;
+            }
+            if (input == Currency::CurrencyLYD)
+            {
+                output = Json::Value(Json::StaticString("LYD"));
+                return;
+            }
+            if (input == Currency::CurrencyMAD)
+            {
+                output = Json::Value(Json::StaticString("MAD"));
+                return;
+            }
+            if (input == Currency::CurrencyMDL)
+            {
+                output = Json::Value(Json::StaticString("MDL"));
+                return;
+            }
+            if (input == Currency::CurrencyMGA)
+            {
+                output = Json::Value(Json::StaticString("MGA"));
+                return;
+            }
+            if (input == Currency::CurrencyMKD)
+            {
+                output = Json::Value(Json::StaticString("MKD"));
+                return;
+            }
+            if (input == Currency::CurrencyMMK)
+            {
+                output = Json::Value(Json::StaticString("MMK"));
+                return;
+            }
+            if (input == Currency::CurrencyMNT)
+            {
+                output = Json::Value(Json::StaticString("MNT"));
+                return;
+            }
+            if (input == Currency::CurrencyMOP)
+            {
+                output = Json::Value(Json::StaticString("MOP"));
+                return;
+            }
+            if (input == Currency::CurrencyMRO)
+            {
+                output = Json::Value(Json::StaticString("MRO"));
+                return;
+            }
+            if (input == Currency::CurrencyMUR)
+            {
+                output = Json::Value(Json::StaticString("MUR"));
+                return;
+            }
+            if (input == Currency::CurrencyMVR)
+            {
+                output = Json::Value(Json::StaticString("MVR"));
+                return;
+            }
+            if (input == Currency::CurrencyMWK)
+            {
+                output = Json::Value(Json::StaticString("MWK"));
+                return;
+            }
+            if (input == Currency::CurrencyMXN)
+            {
+                output = Json::Value(Json::StaticString("MXN"));
+                return;
+            }
+            if (input == Currency::CurrencyMYR)
+            {
+                output = Json::Value(Json::StaticString("MYR"));
+                return;
+            }
+            if (input == Currency::CurrencyMZN)
+            {
+                output = Json::Value(Json::StaticString("MZN"));
+                return;
+            }
+            if (input == Currency::CurrencyNAD)
+            {
+                output = Json::Value(Json::StaticString("NAD"));
+                return;
+            }
+            if (input == Currency::CurrencyNGN)
+            {
+                output = Json::Value(Json::StaticString("NGN"));
+                return;
+            }
+            if (input == Currency::CurrencyNIO)
+            {
+                output = Json::Value(Json::StaticString("NIO"));
+                return;
+            }
+            if (input == Currency::CurrencyNOK)
+            {
+                output = Json::Value(Json::StaticString("NOK"));
+                return;
+            }
+            if (input == Currency::CurrencyNPR)
+            {
+                output = Json::Value(Json::StaticString("NPR"));
+                return;
+            }
+            if (input == Currency::CurrencyNZD)
+            {
+                output = Json::Value(Json::StaticString("NZD"));
+                return;
+            }
+            if (input == Currency::CurrencyOMR)
+            {
+                output = Json::Value(Json::StaticString("OMR"));
+                return;
+            }
+            if (input == Currency::CurrencyPAB)
+            {
+                output = Json::Value(Json::StaticString("PAB"));
+                return;
+            }
+            if (input == Currency::CurrencyPEN)
+            {
+                output = Json::Value(Json::StaticString("PEN"));
+                return;
+            }
+            if (input == Currency::CurrencyPGK)
+            {
+                output = Json::Value(Json::StaticString("PGK"));
+                return;
+            }
+            if (input == Currency::CurrencyPHP)
+            {
+                output = Json::Value(Json::StaticString("PHP"));
+                return;
+            }
+            if (input == Currency::CurrencyPKR)
+            {
+                output = Json::Value(Json::StaticString("PKR"));
+                return;
+            }
+            if (input == Currency::CurrencyPLN)
+            {
+                output = Json::Value(Json::StaticString("PLN"));
+                return;
+            }
+            if (input == Currency::CurrencyPYG)
+            {
+                output = Json::Value(Json::StaticString("PYG"));
+                return;
+            }
+            if (input == Currency::CurrencyQAR)
+            {
+                output = Json::Value(Json::StaticString("QAR"));
+                return;
+            }
+            if (input == Currency::CurrencyRON)
+            {
+                output = Json::Value(Json::StaticString("RON"));
+                return;
+            }
+            if (input == Currency::CurrencyRSD)
+            {
+                output = Json::Value(Json::StaticString("RSD"));
+                return;
+            }
+            if (input == Currency::CurrencyRUB)
+            {
+                output = Json::Value(Json::StaticString("RUB"));
+                return;
+            }
+            if (input == Currency::CurrencyRWF)
+            {
+                output = Json::Value(Json::StaticString("RWF"));
+                return;
+            }
+            if (input == Currency::CurrencySAR)
+            {
+                output = Json::Value(Json::StaticString("SAR"));
+                return;
+            }
+            if (input == Currency::CurrencySBD)
+            {
+                output = Json::Value(Json::StaticString("SBD"));
+                return;
+            }
+            if (input == Currency::CurrencySCR)
+            {
+                output = Json::Value(Json::StaticString("SCR"));
+                return;
+            }
+            if (input == Currency::CurrencySDG)
+            {
+                output = Json::Value(Json::StaticString("SDG"));
+                return;
+            }
+            if (input == Currency::CurrencySEK)
+            {
+                output = Json::Value(Json::StaticString("SEK"));
+                return;
+            }
+            if (input == Currency::CurrencySGD)
+            {
+                output = Json::Value(Json::StaticString("SGD"));
+                return;
+            }
+            if (input == Currency::CurrencySHP)
+            {
+                output = Json::Value(Json::StaticString("SHP"));
+                return;
+            }
+            if (input == Currency::CurrencySLL)
+            {
+                output = Json::Value(Json::StaticString("SLL"));
+                return;
+            }
+            if (input == Currency::CurrencySOS)
+            {
+                output = Json::Value(Json::StaticString("SOS"));
+                return;
+            }
+            if (input == Currency::CurrencySPL)
+            {
+                output = Json::Value(Json::StaticString("SPL"));
+                return;
+            }
+            if (input == Currency::CurrencySRD)
+            {
+                output = Json::Value(Json::StaticString("SRD"));
+                return;
+            }
+            if (input == Currency::CurrencySTD)
+            {
+                output = Json::Value(Json::StaticString("STD"));
+                return;
+            }
+            if (input == Currency::CurrencySVC)
+            {
+                output = Json::Value(Json::StaticString("SVC"));
+                return;
+            }
+            if (input == Currency::CurrencySYP)
+            {
+                output = Json::Value(Json::StaticString("SYP"));
+                return;
+            }
+            if (input == Currency::CurrencySZL)
+            {
+                output = Json::Value(Json::StaticString("SZL"));
+                return;
+            }
+            if (input == Currency::CurrencyTHB)
+            {
+                output = Json::Value(Json::StaticString("THB"));
+                return;
+            }
+            if (input == Currency::CurrencyTJS)
+            {
+                output = Json::Value(Json::StaticString("TJS"));
+                return;
+            }
+            if (input == Currency::CurrencyTMT)
+            {
+                output = Json::Value(Json::StaticString("TMT"));
+                return;
+            }
+            if (input == Currency::CurrencyTND)
+            {
+                output = Json::Value(Json::StaticString("TND"));
+                return;
+            }
+            if (input == Currency::CurrencyTOP)
+            {
+                output = Json::Value(Json::StaticString("TOP"));
+                return;
+            }
+            if (input == Currency::CurrencyTRY)
+            {
+                output = Json::Value(Json::StaticString("TRY"));
+                return;
+            }
+            if (input == Currency::CurrencyTTD)
+            {
+                output = Json::Value(Json::StaticString("TTD"));
+                return;
+            }
+            if (input == Currency::CurrencyTVD)
+            {
+                output = Json::Value(Json::StaticString("TVD"));
+                return;
+            }
+            if (input == Currency::CurrencyTWD)
+            {
+                output = Json::Value(Json::StaticString("TWD"));
+                return;
+            }
+            if (input == Currency::CurrencyTZS)
+            {
+                output = Json::Value(Json::StaticString("TZS"));
+                return;
+            }
+            if (input == Currency::CurrencyUAH)
+            {
+                output = Json::Value(Json::StaticString("UAH"));
+                return;
+            }
+            if (input == Currency::CurrencyUGX)
+            {
+                output = Json::Value(Json::StaticString("UGX"));
+                return;
+            }
+            if (input == Currency::CurrencyUSD)
+            {
+                output = Json::Value(Json::StaticString("USD"));
+                return;
+            }
+            if (input == Currency::CurrencyUYU)
+            {
+                output = Json::Value(Json::StaticString("UYU"));
+                return;
+            }
+            if (input == Currency::CurrencyUZS)
+            {
+                output = Json::Value(Json::StaticString("UZS"));
+                return;
+            }
+            if (input == Currency::CurrencyVEF)
+            {
+                output = Json::Value(Json::StaticString("VEF"));
+                return;
+            }
+            if (input == Currency::CurrencyVND)
+            {
+                output = Json::Value(Json::StaticString("VND"));
+                return;
+            }
+            if (input == Currency::CurrencyVUV)
+            {
+                output = Json::Value(Json::StaticString("VUV"));
+                return;
+            }
+            if (input == Currency::CurrencyWST)
+            {
+                output = Json::Value(Json::StaticString("WST"));
+                return;
+            }
+            if (input == Currency::CurrencyXAF)
+            {
+                output = Json::Value(Json::StaticString("XAF"));
+                return;
+            }
+            if (input == Currency::CurrencyXCD)
+            {
+                output = Json::Value(Json::StaticString("XCD"));
+                return;
+            }
+            if (input == Currency::CurrencyXDR)
+            {
+                output = Json::Value(Json::StaticString("XDR"));
+                return;
+            }
+            if (input == Currency::CurrencyXOF)
+            {
+                output = Json::Value(Json::StaticString("XOF"));
+                return;
+            }
+            if (input == Currency::CurrencyXPF)
+            {
+                output = Json::Value(Json::StaticString("XPF"));
+                return;
+            }
+            if (input == Currency::CurrencyYER)
+            {
+                output = Json::Value(Json::StaticString("YER"));
+                return;
+            }
+            if (input == Currency::CurrencyZAR)
+            {
+                output = Json::Value(Json::StaticString("ZAR"));
+                return;
+            }
+            if (input == Currency::CurrencyZMW)
+            {
+                output = Json::Value(Json::StaticString("ZMW"));
+                return;
+            }
+            if (input == Currency::CurrencyZWD)
+            {
+                output = Json::Value(Json::StaticString("ZWD"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, Currency& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "AED")
+            {
+                output = Currency::CurrencyAED;
+                return;
+            }
+            if (inputStr == "AFN")
+            {
+                output = Currency::CurrencyAFN;
+                return;
+            }
+            if (inputStr == "ALL")
+            {
+                output = Currency::CurrencyALL;
+                return;
+            }
+            if (inputStr == "AMD")
+            {
+                output = Currency::CurrencyAMD;
+                return;
+            }
+            if (inputStr == "ANG")
+            {
+                output = Currency::CurrencyANG;
+                return;
+            }
+            if (inputStr == "AOA")
+            {
+                output = Currency::CurrencyAOA;
+                return;
+            }
+            if (inputStr == "ARS")
+            {
+                output = Currency::CurrencyARS;
+                return;
+            }
+            if (inputStr == "AUD")
+            {
+                output = Currency::CurrencyAUD;
+                return;
+            }
+            if (inputStr == "AWG")
+            {
+                output = Currency::CurrencyAWG;
+                return;
+            }
+            if (inputStr == "AZN")
+            {
+                output = Currency::CurrencyAZN;
+                return;
+            }
+            if (inputStr == "BAM")
+            {
+                output = Currency::CurrencyBAM;
+                return;
+            }
+            if (inputStr == "BBD")
+            {
+                output = Currency::CurrencyBBD;
+                return;
+            }
+            if (inputStr == "BDT")
+            {
+                output = Currency::CurrencyBDT;
+                return;
+            }
+            if (inputStr == "BGN")
+            {
+                output = Currency::CurrencyBGN;
+                return;
+            }
+            if (inputStr == "BHD")
+            {
+                output = Currency::CurrencyBHD;
+                return;
+            }
+            if (inputStr == "BIF")
+            {
+                output = Currency::CurrencyBIF;
+                return;
+            }
+            if (inputStr == "BMD")
+            {
+                output = Currency::CurrencyBMD;
+                return;
+            }
+            if (inputStr == "BND")
+            {
+                output = Currency::CurrencyBND;
+                return;
+            }
+            if (inputStr == "BOB")
+            {
+                output = Currency::CurrencyBOB;
+                return;
+            }
+            if (inputStr == "BRL")
+            {
+                output = Currency::CurrencyBRL;
+                return;
+            }
+            if (inputStr == "BSD")
+            {
+                output = Currency::CurrencyBSD;
+                return;
+            }
+            if (inputStr == "BTN")
+            {
+                output = Currency::CurrencyBTN;
+                return;
+            }
+            if (inputStr == "BWP")
+            {
+                output = Currency::CurrencyBWP;
+                return;
+            }
+            if (inputStr == "BYR")
+            {
+                output = Currency::CurrencyBYR;
+                return;
+            }
+            if (inputStr == "BZD")
+            {
+                output = Currency::CurrencyBZD;
+                return;
+            }
+            if (inputStr == "CAD")
+            {
+                output = Currency::CurrencyCAD;
+                return;
+            }
+            if (inputStr == "CDF")
+            {
+                output = Currency::CurrencyCDF;
+                return;
+            }
+            if (inputStr == "CHF")
+            {
+                output = Currency::CurrencyCHF;
+                return;
+            }
+            if (inputStr == "CLP")
+            {
+                output = Currency::CurrencyCLP;
+                return;
+            }
+            if (inputStr == "CNY")
+            {
+                output = Currency::CurrencyCNY;
+                return;
+            }
+            if (inputStr == "COP")
+            {
+                output = Currency::CurrencyCOP;
+                return;
+            }
+            if (inputStr == "CRC")
+            {
+                output = Currency::CurrencyCRC;
+                return;
+            }
+            if (inputStr == "CUC")
+            {
+                output = Currency::CurrencyCUC;
+                return;
+            }
+            if (inputStr == "CUP")
+            {
+                output = Currency::CurrencyCUP;
+                return;
+            }
+            if (inputStr == "CVE")
+            {
+                output = Currency::CurrencyCVE;
+                return;
+            }
+            if (inputStr == "CZK")
+            {
+                output = Currency::CurrencyCZK;
+                return;
+            }
+            if (inputStr == "DJF")
+            {
+                output = Currency::CurrencyDJF;
+                return;
+            }
+            if (inputStr == "DKK")
+            {
+                output = Currency::CurrencyDKK;
+                return;
+            }
+            if (inputStr == "DOP")
+            {
+                output = Currency::CurrencyDOP;
+                return;
+            }
+            if (inputStr == "DZD")
+            {
+                output = Currency::CurrencyDZD;
+                return;
+            }
+            if (inputStr == "EGP")
+            {
+                output = Currency::CurrencyEGP;
+                return;
+            }
+            if (inputStr == "ERN")
+            {
+                output = Currency::CurrencyERN;
+                return;
+            }
+            if (inputStr == "ETB")
+            {
+                output = Currency::CurrencyETB;
+                return;
+            }
+            if (inputStr == "EUR")
+            {
+                output = Currency::CurrencyEUR;
+                return;
+            }
+            if (inputStr == "FJD")
+            {
+                output = Currency::CurrencyFJD;
+                return;
+            }
+            if (inputStr == "FKP")
+            {
+                output = Currency::CurrencyFKP;
+                return;
+            }
+            if (inputStr == "GBP")
+            {
+                output = Currency::CurrencyGBP;
+                return;
+            }
+            if (inputStr == "GEL")
+            {
+                output = Currency::CurrencyGEL;
+                return;
+            }
+            if (inputStr == "GGP")
+            {
+                output = Currency::CurrencyGGP;
+                return;
+            }
+            if (inputStr == "GHS")
+            {
+                output = Currency::CurrencyGHS;
+                return;
+            }
+            if (inputStr == "GIP")
+            {
+                output = Currency::CurrencyGIP;
+                return;
+            }
+            if (inputStr == "GMD")
+            {
+                output = Currency::CurrencyGMD;
+                return;
+            }
+            if (inputStr == "GNF")
+            {
+                output = Currency::CurrencyGNF;
+                return;
+            }
+            if (inputStr == "GTQ")
+            {
+                output = Currency::CurrencyGTQ;
+                return;
+            }
+            if (inputStr == "GYD")
+            {
+                output = Currency::CurrencyGYD;
+                return;
+            }
+            if (inputStr == "HKD")
+            {
+                output = Currency::CurrencyHKD;
+                return;
+            }
+            if (inputStr == "HNL")
+            {
+                output = Currency::CurrencyHNL;
+                return;
+            }
+            if (inputStr == "HRK")
+            {
+                output = Currency::CurrencyHRK;
+                return;
+            }
+            if (inputStr == "HTG")
+            {
+                output = Currency::CurrencyHTG;
+                return;
+            }
+            if (inputStr == "HUF")
+            {
+                output = Currency::CurrencyHUF;
+                return;
+            }
+            if (inputStr == "IDR")
+            {
+                output = Currency::CurrencyIDR;
+                return;
+            }
+            if (inputStr == "ILS")
+            {
+                output = Currency::CurrencyILS;
+                return;
+            }
+            if (inputStr == "IMP")
+            {
+                output = Currency::CurrencyIMP;
+                return;
+            }
+            if (inputStr == "INR")
+            {
+                output = Currency::CurrencyINR;
+                return;
+            }
+            if (inputStr == "IQD")
+            {
+                output = Currency::CurrencyIQD;
+                return;
+            }
+            if (inputStr == "IRR")
+            {
+                output = Currency::CurrencyIRR;
+                return;
+            }
+            if (inputStr == "ISK")
+            {
+                output = Currency::CurrencyISK;
+                return;
+            }
+            if (inputStr == "JEP")
+            {
+                output = Currency::CurrencyJEP;
+                return;
+            }
+            if (inputStr == "JMD")
+            {
+                output = Currency::CurrencyJMD;
+                return;
+            }
+            if (inputStr == "JOD")
+            {
+                output = Currency::CurrencyJOD;
+                return;
+            }
+            if (inputStr == "JPY")
+            {
+                output = Currency::CurrencyJPY;
+                return;
+            }
+            if (inputStr == "KES")
+            {
+                output = Currency::CurrencyKES;
+                return;
+            }
+            if (inputStr == "KGS")
+            {
+                output = Currency::CurrencyKGS;
+                return;
+            }
+            if (inputStr == "KHR")
+            {
+                output = Currency::CurrencyKHR;
+                return;
+            }
+            if (inputStr == "KMF")
+            {
+                output = Currency::CurrencyKMF;
+                return;
+            }
+            if (inputStr == "KPW")
+            {
+                output = Currency::CurrencyKPW;
+                return;
+            }
+            if (inputStr == "KRW")
+            {
+                output = Currency::CurrencyKRW;
+                return;
+            }
+            if (inputStr == "KWD")
+            {
+                output = Currency::CurrencyKWD;
+                return;
+            }
+            if (inputStr == "KYD")
+            {
+                output = Currency::CurrencyKYD;
+                return;
+            }
+            if (inputStr == "KZT")
+            {
+                output = Currency::CurrencyKZT;
+                return;
+            }
+            if (inputStr == "LAK")
+            {
+                output = Currency::CurrencyLAK;
+                return;
+            }
+            if (inputStr == "LBP")
+            {
+                output = Currency::CurrencyLBP;
+                return;
+            }
+            if (inputStr == "LKR")
+            {
+                output = Currency::CurrencyLKR;
+                return;
+            }
+            if (inputStr == "LRD")
+            {
+                output = Currency::CurrencyLRD;
+                return;
+            }
+            if (inputStr == "LSL")
+            {
+                output = Currency::CurrencyLSL;
+                return;
+            }
+            if (inputStr == "LYD")
+            {
+                output = Currency::CurrencyLYD;
+                return;
+            }
+            if (inputStr == "MAD")
+            {
+                output = Currency::CurrencyMAD;
+                return;
+            }
+            if (inputStr == "MDL")
+            {
+                output = Currency::CurrencyMDL;
+                return;
+            }
+            if (inputStr == "MGA")
+            {
+                output = Currency::CurrencyMGA;
+                return;
+            }
+            if (inputStr == "MKD")
+            {
+                output = Currency::CurrencyMKD;
+                return;
+            }
+            if (inputStr == "MMK")
+            {
+                output = Currency::CurrencyMMK;
+                return;
+            }
+            if (inputStr == "MNT")
+            {
+                output = Currency::CurrencyMNT;
+                return;
+            }
+            if (inputStr == "MOP")
+            {
+                output = Currency::CurrencyMOP;
+                return;
+            }
+            if (inputStr == "MRO")
+            {
+                output = Currency::CurrencyMRO;
+                return;
+            }
+            if (inputStr == "MUR")
+            {
+                output = Currency::CurrencyMUR;
+                return;
+            }
+            if (inputStr == "MVR")
+            {
+                output = Currency::CurrencyMVR;
+                return;
+            }
+            if (inputStr == "MWK")
+            {
+                output = Currency::CurrencyMWK;
+                return;
+            }
+            if (inputStr == "MXN")
+            {
+                output = Currency::CurrencyMXN;
+                return;
+            }
+            if (inputStr == "MYR")
+            {
+                output = Currency::CurrencyMYR;
+                return;
+            }
+            if (inputStr == "MZN")
+            {
+                output = Currency::CurrencyMZN;
+                return;
+            }
+            if (inputStr == "NAD")
+            {
+                output = Currency::CurrencyNAD;
+                return;
+            }
+            if (inputStr == "NGN")
+            {
+                output = Currency::CurrencyNGN;
+                return;
+            }
+            if (inputStr == "NIO")
+            {
+                output = Currency::CurrencyNIO;
+                return;
+            }
+            if (inputStr == "NOK")
+            {
+                output = Currency::CurrencyNOK;
+                return;
+            }
+            if (inputStr == "NPR")
+            {
+                output = Currency::CurrencyNPR;
+                return;
+            }
+            if (inputStr == "NZD")
+            {
+                output = Currency::CurrencyNZD;
+                return;
+            }
+            if (inputStr == "OMR")
+            {
+                output = Currency::CurrencyOMR;
+                return;
+            }
+            if (inputStr == "PAB")
+            {
+                output = Currency::CurrencyPAB;
+                return;
+            }
+            if (inputStr == "PEN")
+            {
+                output = Currency::CurrencyPEN;
+                return;
+            }
+            if (inputStr == "PGK")
+            {
+                output = Currency::CurrencyPGK;
+                return;
+            }
+            if (inputStr == "PHP")
+            {
+                output = Currency::CurrencyPHP;
+                return;
+            }
+            if (inputStr == "PKR")
+            {
+                output = Currency::CurrencyPKR;
+                return;
+            }
+            if (inputStr == "PLN")
+            {
+                output = Currency::CurrencyPLN;
+                return;
+            }
+            if (inputStr == "PYG")
+            {
+                output = Currency::CurrencyPYG;
+                return;
+            }
+            if (inputStr == "QAR")
+            {
+                output = Currency::CurrencyQAR;
+                return;
+            }
+            if (inputStr == "RON")
+            {
+                output = Currency::CurrencyRON;
+                return;
+            }
+            if (inputStr == "RSD")
+            {
+                output = Currency::CurrencyRSD;
+                return;
+            }
+            if (inputStr == "RUB")
+            {
+                output = Currency::CurrencyRUB;
+                return;
+            }
+            if (inputStr == "RWF")
+            {
+                output = Currency::CurrencyRWF;
+                return;
+            }
+            if (inputStr == "SAR")
+            {
+                output = Currency::CurrencySAR;
+                return;
+            }
+            if (inputStr == "SBD")
+            {
+                output = Currency::CurrencySBD;
+                return;
+            }
+            if (inputStr == "SCR")
+            {
+                output = Currency::CurrencySCR;
+                return;
+            }
+            if (inputStr == "SDG")
+            {
+                output = Currency::CurrencySDG;
+                return;
+            }
+            if (inputStr == "SEK")
+            {
+                output = Currency::CurrencySEK;
+                return;
+            }
+            if (inputStr == "SGD")
+            {
+                output = Currency::CurrencySGD;
+                return;
+            }
+            if (inputStr == "SHP")
+            {
+                output = Currency::CurrencySHP;
+                return;
+            }
+            if (inputStr == "SLL")
+            {
+                output = Currency::CurrencySLL;
+                return;
+            }
+            if (inputStr == "SOS")
+            {
+                output = Currency::CurrencySOS;
+                return;
+            }
+            if (inputStr == "SPL")
+            {
+                output = Currency::CurrencySPL;
+                return;
+            }
+            if (inputStr == "SRD")
+            {
+                output = Currency::CurrencySRD;
+                return;
+            }
+            if (inputStr == "STD")
+            {
+                output = Currency::CurrencySTD;
+                return;
+            }
+            if (inputStr == "SVC")
+            {
+                output = Currency::CurrencySVC;
+                return;
+            }
+            if (inputStr == "SYP")
+            {
+                output = Currency::CurrencySYP;
+                return;
+            }
+            if (inputStr == "SZL")
+            {
+                output = Currency::CurrencySZL;
+                return;
+            }
+            if (inputStr == "THB")
+            {
+                output = Currency::CurrencyTHB;
+                return;
+            }
+            if (inputStr == "TJS")
+            {
+                output = Currency::CurrencyTJS;
+                return;
+            }
+            if (inputStr == "TMT")
+            {
+                output = Currency::CurrencyTMT;
+                return;
+            }
+            if (inputStr == "TND")
+            {
+                output = Currency::CurrencyTND;
+                return;
+            }
+            if (inputStr == "TOP")
+            {
+                output = Currency::CurrencyTOP;
+                return;
+            }
+            if (inputStr == "TRY")
+            {
+                output = Currency::CurrencyTRY;
+                return;
+            }
+            if (inputStr == "TTD")
+            {
+                output = Currency::CurrencyTTD;
+                return;
+            }
+            if (inputStr == "TVD")
+            {
+                output = Currency::CurrencyTVD;
+                return;
+            }
+            if (inputStr == "TWD")
+            {
+                output = Currency::CurrencyTWD;
+                return;
+            }
+            if (inputStr == "TZS")
+            {
+                output = Currency::CurrencyTZS;
+                return;
+            }
+            if (inputStr == "UAH")
+            {
+                output = Currency::CurrencyUAH;
+                return;
+            }
+            if (inputStr == "UGX")
+            {
+                output = Currency::CurrencyUGX;
+                return;
+            }
+            if (inputStr == "USD")
+            {
+                output = Currency::CurrencyUSD;
+                return;
+            }
+            if (inputStr == "UYU")
+            {
+                output = Currency::CurrencyUYU;
+                return;
+            }
+            if (inputStr == "UZS")
+            {
+                output = Currency::CurrencyUZS;
+                return;
+            }
+            if (inputStr == "VEF")
+            {
+                output = Currency::CurrencyVEF;
+                return;
+            }
+            if (inputStr == "VND")
+            {
+                output = Currency::CurrencyVND;
+                return;
+            }
+            if (inputStr == "VUV")
+            {
+                output = Currency::CurrencyVUV;
+                return;
+            }
+            if (inputStr == "WST")
+            {
+                output = Currency::CurrencyWST;
+                return;
+            }
+            if (inputStr == "XAF")
+            {
+                output = Currency::CurrencyXAF;
+                return;
+            }
+            if (inputStr == "XCD")
+            {
+                output = Currency::CurrencyXCD;
+                return;
+            }
+            if (inputStr == "XDR")
+            {
+                output = Currency::CurrencyXDR;
+                return;
+            }
+            if (inputStr == "XOF")
+            {
+                output = Currency::CurrencyXOF;
+                return;
+            }
+            if (inputStr == "XPF")
+            {
+                output = Currency::CurrencyXPF;
+                return;
+            }
+            if (inputStr == "YER")
+            {
+                output = Currency::CurrencyYER;
+                return;
+            }
+            if (inputStr == "ZAR")
+            {
+                output = Currency::CurrencyZAR;
+                return;
+            }
+            if (inputStr == "ZMW")
+            {
+                output = Currency::CurrencyZMW;
+                return;
+            }
+            if (inputStr == "ZWD")
+            {
+                output = Currency::CurrencyZWD;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const EmailVerificationStatus input, Json::Value& output)
+        {
+            if (input == EmailVerificationStatus::EmailVerificationStatusUnverified)
+            {
+                output = Json::Value(Json::StaticString("Unverified"));
+                return;
+            }
+            if (input == EmailVerificationStatus::EmailVerificationStatusPending)
+            {
+                output = Json::Value(Json::StaticString("Pending"));
+                return;
+            }
+            if (input == EmailVerificationStatus::EmailVerificationStatusConfirmed)
+            {
+                output = Json::Value(Json::StaticString("Confirmed"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, EmailVerificationStatus& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Unverified")
+            {
+                output = EmailVerificationStatus::EmailVerificationStatusUnverified;
+                return;
+            }
+            if (inputStr == "Pending")
+            {
+                output = EmailVerificationStatus::EmailVerificationStatusPending;
+                return;
+            }
+            if (inputStr == "Confirmed")
+            {
+                output = EmailVerificationStatus::EmailVerificationStatusConfirmed;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const GameInstanceState input, Json::Value& output)
+        {
+            if (input == GameInstanceState::GameInstanceStateOpen)
+            {
+                output = Json::Value(Json::StaticString("Open"));
+                return;
+            }
+            if (input == GameInstanceState::GameInstanceStateClosed)
+            {
+                output = Json::Value(Json::StaticString("Closed"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, GameInstanceState& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Open")
+            {
+                output = GameInstanceState::GameInstanceStateOpen;
+                return;
+            }
+            if (inputStr == "Closed")
+            {
+                output = GameInstanceState::GameInstanceStateClosed;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const LoginIdentityProvider input, Json::Value& output)
+        {
+            if (input == LoginIdentityProvider::LoginIdentityProviderUnknown)
+            {
+                output = Json::Value(Json::StaticString("Unknown"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderPlayFab)
+            {
+                output = Json::Value(Json::StaticString("PlayFab"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderCustom)
+            {
+                output = Json::Value(Json::StaticString("Custom"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderGameCenter)
+            {
+                output = Json::Value(Json::StaticString("GameCenter"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderGooglePlay)
+            {
+                output = Json::Value(Json::StaticString("GooglePlay"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderSteam)
+            {
+                output = Json::Value(Json::StaticString("Steam"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderXBoxLive)
+            {
+                output = Json::Value(Json::StaticString("XBoxLive"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderPSN)
+            {
+                output = Json::Value(Json::StaticString("PSN"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderKongregate)
+            {
+                output = Json::Value(Json::StaticString("Kongregate"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderFacebook)
+            {
+                output = Json::Value(Json::StaticString("Facebook"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderIOSDevice)
+            {
+                output = Json::Value(Json::StaticString("IOSDevice"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderAndroidDevice)
+            {
+                output = Json::Value(Json::StaticString("AndroidDevice"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderTwitch)
+            {
+                output = Json::Value(Json::StaticString("Twitch"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderWindowsHello)
+            {
+                output = Json::Value(Json::StaticString("WindowsHello"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderGameServer)
+            {
+                output = Json::Value(Json::StaticString("GameServer"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderCustomServer)
+            {
+                output = Json::Value(Json::StaticString("CustomServer"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderNintendoSwitch)
+            {
+                output = Json::Value(Json::StaticString("NintendoSwitch"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderFacebookInstantGames)
+            {
+                output = Json::Value(Json::StaticString("FacebookInstantGames"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderOpenIdConnect)
+            {
+                output = Json::Value(Json::StaticString("OpenIdConnect"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderApple)
+            {
+                output = Json::Value(Json::StaticString("Apple"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderNintendoSwitchAccount)
+            {
+                output = Json::Value(Json::StaticString("NintendoSwitchAccount"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, LoginIdentityProvider& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Unknown")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderUnknown;
+                return;
+            }
+            if (inputStr == "PlayFab")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderPlayFab;
+                return;
+            }
+            if (inputStr == "Custom")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderCustom;
+                return;
+            }
+            if (inputStr == "GameCenter")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderGameCenter;
+                return;
+            }
+            if (inputStr == "GooglePlay")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderGooglePlay;
+                return;
+            }
+            if (inputStr == "Steam")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderSteam;
+                return;
+            }
+            if (inputStr == "XBoxLive")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderXBoxLive;
+                return;
+            }
+            if (inputStr == "PSN")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderPSN;
+                return;
+            }
+            if (inputStr == "Kongregate")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderKongregate;
+                return;
+            }
+            if (inputStr == "Facebook")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderFacebook;
+                return;
+            }
+            if (inputStr == "IOSDevice")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderIOSDevice;
+                return;
+            }
+            if (inputStr == "AndroidDevice")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderAndroidDevice;
+                return;
+            }
+            if (inputStr == "Twitch")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderTwitch;
+                return;
+            }
+            if (inputStr == "WindowsHello")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderWindowsHello;
+                return;
+            }
+            if (inputStr == "GameServer")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderGameServer;
+                return;
+            }
+            if (inputStr == "CustomServer")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderCustomServer;
+                return;
+            }
+            if (inputStr == "NintendoSwitch")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderNintendoSwitch;
+                return;
+            }
+            if (inputStr == "FacebookInstantGames")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderFacebookInstantGames;
+                return;
+            }
+            if (inputStr == "OpenIdConnect")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderOpenIdConnect;
+                return;
+            }
+            if (inputStr == "Apple")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderApple;
+                return;
+            }
+            if (inputStr == "NintendoSwitchAccount")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderNintendoSwitchAccount;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const MatchmakeStatus input, Json::Value& output)
+        {
+            if (input == MatchmakeStatus::MatchmakeStatusComplete)
+            {
+                output = Json::Value(Json::StaticString("Complete"));
+                return;
+            }
+            if (input == MatchmakeStatus::MatchmakeStatusWaiting)
+            {
+                output = Json::Value(Json::StaticString("Waiting"));
+                return;
+            }
+            if (input == MatchmakeStatus::MatchmakeStatusGameNotFound)
+            {
+                output = Json::Value(Json::StaticString("GameNotFound"));
+                return;
+            }
+            if (input == MatchmakeStatus::MatchmakeStatusNoAvailableSlots)
+            {
+                output = Json::Value(Json::StaticString("NoAvailableSlots"));
+                return;
+            }
+            if (input == MatchmakeStatus::MatchmakeStatusSessionClosed)
+            {
+                output = Json::Value(Json::StaticString("SessionClosed"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, MatchmakeStatus& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Complete")
+            {
+                output = MatchmakeStatus::MatchmakeStatusComplete;
+                return;
+            }
+            if (inputStr == "Waiting")
+            {
+                output = MatchmakeStatus::MatchmakeStatusWaiting;
+                return;
+            }
+            if (inputStr == "GameNotFound")
+            {
+                output = MatchmakeStatus::MatchmakeStatusGameNotFound;
+                return;
+            }
+            if (inputStr == "NoAvailableSlots")
+            {
+                output = MatchmakeStatus::MatchmakeStatusNoAvailableSlots;
+                return;
+            }
+            if (inputStr == "SessionClosed")
+            {
+                output = MatchmakeStatus::MatchmakeStatusSessionClosed;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const PushNotificationPlatform input, Json::Value& output)
+        {
+            if (input == PushNotificationPlatform::PushNotificationPlatformApplePushNotificationService)
+            {
+                output = Json::Value(Json::StaticString("ApplePushNotificationService"));
+                return;
+            }
+            if (input == PushNotificationPlatform::PushNotificationPlatformGoogleCloudMessaging)
+            {
+                output = Json::Value(Json::StaticString("GoogleCloudMessaging"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, PushNotificationPlatform& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "ApplePushNotificationService")
+            {
+                output = PushNotificationPlatform::PushNotificationPlatformApplePushNotificationService;
+                return;
+            }
+            if (inputStr == "GoogleCloudMessaging")
+            {
+                output = PushNotificationPlatform::PushNotificationPlatformGoogleCloudMessaging;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const Region input, Json::Value& output)
+        {
+            if (input == Region::RegionUSCentral)
+            {
+                output = Json::Value(Json::StaticString("USCentral"));
+                return;
+            }
+            if (input == Region::RegionUSEast)
+            {
+                output = Json::Value(Json::StaticString("USEast"));
+                return;
+            }
+            if (input == Region::RegionEUWest)
+            {
+                output = Json::Value(Json::StaticString("EUWest"));
+                return;
+            }
+            if (input == Region::RegionSingapore)
+            {
+                output = Json::Value(Json::StaticString("Singapore"));
+                return;
+            }
+            if (input == Region::RegionJapan)
+            {
+                output = Json::Value(Json::StaticString("Japan"));
+                return;
+            }
+            if (input == Region::RegionBrazil)
+            {
+                output = Json::Value(Json::StaticString("Brazil"));
+                return;
+            }
+            if (input == Region::RegionAustralia)
+            {
+                output = Json::Value(Json::StaticString("Australia"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, Region& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "USCentral")
+            {
+                output = Region::RegionUSCentral;
+                return;
+            }
+            if (inputStr == "USEast")
+            {
+                output = Region::RegionUSEast;
+                return;
+            }
+            if (inputStr == "EUWest")
+            {
+                output = Region::RegionEUWest;
+                return;
+            }
+            if (inputStr == "Singapore")
+            {
+                output = Region::RegionSingapore;
+                return;
+            }
+            if (inputStr == "Japan")
+            {
+                output = Region::RegionJapan;
+                return;
+            }
+            if (inputStr == "Brazil")
+            {
+                output = Region::RegionBrazil;
+                return;
+            }
+            if (inputStr == "Australia")
+            {
+                output = Region::RegionAustralia;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const SourceType input, Json::Value& output)
+        {
+            if (input == SourceType::SourceTypeAdmin)
+            {
+                output = Json::Value(Json::StaticString("Admin"));
+                return;
+            }
+            if (input == SourceType::SourceTypeBackEnd)
+            {
+                output = Json::Value(Json::StaticString("BackEnd"));
+                return;
+            }
+            if (input == SourceType::SourceTypeGameClient)
+            {
+                output = Json::Value(Json::StaticString("GameClient"));
+                return;
+            }
+            if (input == SourceType::SourceTypeGameServer)
+            {
+                output = Json::Value(Json::StaticString("GameServer"));
+                return;
+            }
+            if (input == SourceType::SourceTypePartner)
+            {
+                output = Json::Value(Json::StaticString("Partner"));
+                return;
+            }
+            if (input == SourceType::SourceTypeCustom)
+            {
+                output = Json::Value(Json::StaticString("Custom"));
+                return;
+            }
+            if (input == SourceType::SourceTypeAPI)
+            {
+                output = Json::Value(Json::StaticString("API"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, SourceType& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Admin")
+            {
+                output = SourceType::SourceTypeAdmin;
+                return;
+            }
+            if (inputStr == "BackEnd")
+            {
+                output = SourceType::SourceTypeBackEnd;
+                return;
+            }
+            if (inputStr == "GameClient")
+            {
+                output = SourceType::SourceTypeGameClient;
+                return;
+            }
+            if (inputStr == "GameServer")
+            {
+                output = SourceType::SourceTypeGameServer;
+                return;
+            }
+            if (inputStr == "Partner")
+            {
+                output = SourceType::SourceTypePartner;
+                return;
+            }
+            if (inputStr == "Custom")
+            {
+                output = SourceType::SourceTypeCustom;
+                return;
+            }
+            if (inputStr == "API")
+            {
+                output = SourceType::SourceTypeAPI;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const SubscriptionProviderStatus input, Json::Value& output)
+        {
+            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusNoError)
+            {
+                output = Json::Value(Json::StaticString("NoError"));
+                return;
+            }
+            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusCancelled)
+            {
+                output = Json::Value(Json::StaticString("Cancelled"));
+                return;
+            }
+            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusUnknownError)
+            {
+                output = Json::Value(Json::StaticString("UnknownError"));
+                return;
+            }
+            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusBillingError)
+            {
+                output = Json::Value(Json::StaticString("BillingError"));
+                return;
+            }
+            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusProductUnavailable)
+            {
+                output = Json::Value(Json::StaticString("ProductUnavailable"));
+                return;
+            }
+            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusCustomerDidNotAcceptPriceChange)
+            {
+                output = Json::Value(Json::StaticString("CustomerDidNotAcceptPriceChange"));
+                return;
+            }
+            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusFreeTrial)
+            {
+                output = Json::Value(Json::StaticString("FreeTrial"));
+                return;
+            }
+            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusPaymentPending)
+            {
+                output = Json::Value(Json::StaticString("PaymentPending"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, SubscriptionProviderStatus& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "NoError")
+            {
+                output = SubscriptionProviderStatus::SubscriptionProviderStatusNoError;
+                return;
+            }
+            if (inputStr == "Cancelled")
+            {
+                output = SubscriptionProviderStatus::SubscriptionProviderStatusCancelled;
+                return;
+            }
+            if (inputStr == "UnknownError")
+            {
+                output = SubscriptionProviderStatus::SubscriptionProviderStatusUnknownError;
+                return;
+            }
+            if (inputStr == "BillingError")
+            {
+                output = SubscriptionProviderStatus::SubscriptionProviderStatusBillingError;
+                return;
+            }
+            if (inputStr == "ProductUnavailable")
+            {
+                output = SubscriptionProviderStatus::SubscriptionProviderStatusProductUnavailable;
+                return;
+            }
+            if (inputStr == "CustomerDidNotAcceptPriceChange")
+            {
+                output = SubscriptionProviderStatus::SubscriptionProviderStatusCustomerDidNotAcceptPriceChange;
+                return;
+            }
+            if (inputStr == "FreeTrial")
+            {
+                output = SubscriptionProviderStatus::SubscriptionProviderStatusFreeTrial;
+                return;
+            }
+            if (inputStr == "PaymentPending")
+            {
+                output = SubscriptionProviderStatus::SubscriptionProviderStatusPaymentPending;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const TitleActivationStatus input, Json::Value& output)
+        {
+            if (input == TitleActivationStatus::TitleActivationStatusNone)
+            {
+                output = Json::Value(Json::StaticString("None"));
+                return;
+            }
+            if (input == TitleActivationStatus::TitleActivationStatusActivatedTitleKey)
+            {
+                output = Json::Value(Json::StaticString("ActivatedTitleKey"));
+                return;
+            }
+            if (input == TitleActivationStatus::TitleActivationStatusPendingSteam)
+            {
+                output = Json::Value(Json::StaticString("PendingSteam"));
+                return;
+            }
+            if (input == TitleActivationStatus::TitleActivationStatusActivatedSteam)
+            {
+                output = Json::Value(Json::StaticString("ActivatedSteam"));
+                return;
+            }
+            if (input == TitleActivationStatus::TitleActivationStatusRevokedSteam)
+            {
+                output = Json::Value(Json::StaticString("RevokedSteam"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, TitleActivationStatus& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "None")
+            {
+                output = TitleActivationStatus::TitleActivationStatusNone;
+                return;
+            }
+            if (inputStr == "ActivatedTitleKey")
+            {
+                output = TitleActivationStatus::TitleActivationStatusActivatedTitleKey;
+                return;
+            }
+            if (inputStr == "PendingSteam")
+            {
+                output = TitleActivationStatus::TitleActivationStatusPendingSteam;
+                return;
+            }
+            if (inputStr == "ActivatedSteam")
+            {
+                output = TitleActivationStatus::TitleActivationStatusActivatedSteam;
+                return;
+            }
+            if (inputStr == "RevokedSteam")
+            {
+                output = TitleActivationStatus::TitleActivationStatusRevokedSteam;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const TradeStatus input, Json::Value& output)
+        {
+            if (input == TradeStatus::TradeStatusInvalid)
+            {
+                output = Json::Value(Json::StaticString("Invalid"));
+                return;
+            }
+            if (input == TradeStatus::TradeStatusOpening)
+            {
+                output = Json::Value(Json::StaticString("Opening"));
+                return;
+            }
+            if (input == TradeStatus::TradeStatusOpen)
+            {
+                output = Json::Value(Json::StaticString("Open"));
+                return;
+            }
+            if (input == TradeStatus::TradeStatusAccepting)
+            {
+                output = Json::Value(Json::StaticString("Accepting"));
+                return;
+            }
+            if (input == TradeStatus::TradeStatusAccepted)
+            {
+                output = Json::Value(Json::StaticString("Accepted"));
+                return;
+            }
+            if (input == TradeStatus::TradeStatusFilled)
+            {
+                output = Json::Value(Json::StaticString("Filled"));
+                return;
+            }
+            if (input == TradeStatus::TradeStatusCancelled)
+            {
+                output = Json::Value(Json::StaticString("Cancelled"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, TradeStatus& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Invalid")
+            {
+                output = TradeStatus::TradeStatusInvalid;
+                return;
+            }
+            if (inputStr == "Opening")
+            {
+                output = TradeStatus::TradeStatusOpening;
+                return;
+            }
+            if (inputStr == "Open")
+            {
+                output = TradeStatus::TradeStatusOpen;
+                return;
+            }
+            if (inputStr == "Accepting")
+            {
+                output = TradeStatus::TradeStatusAccepting;
+                return;
+            }
+            if (inputStr == "Accepted")
+            {
+                output = TradeStatus::TradeStatusAccepted;
+                return;
+            }
+            if (inputStr == "Filled")
+            {
+                output = TradeStatus::TradeStatusFilled;
+                return;
+            }
+            if (inputStr == "Cancelled")
+            {
+                output = TradeStatus::TradeStatusCancelled;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const TransactionStatus input, Json::Value& output)
+        {
+            if (input == TransactionStatus::TransactionStatusCreateCart)
+            {
+                output = Json::Value(Json::StaticString("CreateCart"));
+                return;
+            }
+            if (input == TransactionStatus::TransactionStatusInit)
+            {
+                output = Json::Value(Json::StaticString("Init"));
+                return;
+            }
+            if (input == TransactionStatus::TransactionStatusApproved)
+            {
+                output = Json::Value(Json::StaticString("Approved"));
+                return;
+            }
+            if (input == TransactionStatus::TransactionStatusSucceeded)
+            {
+                output = Json::Value(Json::StaticString("Succeeded"));
+                return;
+            }
+            if (input == TransactionStatus::TransactionStatusFailedByProvider)
+            {
+                output = Json::Value(Json::StaticString("FailedByProvider"));
+                return;
+            }
+            if (input == TransactionStatus::TransactionStatusDisputePending)
+            {
+                output = Json::Value(Json::StaticString("DisputePending"));
+                return;
+            }
+            if (input == TransactionStatus::TransactionStatusRefundPending)
+            {
+                output = Json::Value(Json::StaticString("RefundPending"));
+                return;
+            }
+            if (input == TransactionStatus::TransactionStatusRefunded)
+            {
+                output = Json::Value(Json::StaticString("Refunded"));
+                return;
+            }
+            if (input == TransactionStatus::TransactionStatusRefundFailed)
+            {
+                output = Json::Value(Json::StaticString("RefundFailed"));
+                return;
+            }
+            if (input == TransactionStatus::TransactionStatusChargedBack)
+            {
+                output = Json::Value(Json::StaticString("ChargedBack"));
+                return;
+            }
+            if (input == TransactionStatus::TransactionStatusFailedByUber)
+            {
+                output = Json::Value(Json::StaticString("FailedByUber"));
+                return;
+            }
+            if (input == TransactionStatus::TransactionStatusFailedByPlayFab)
+            {
+                output = Json::Value(Json::StaticString("FailedByPlayFab"));
+                return;
+            }
+            if (input == TransactionStatus::TransactionStatusRevoked)
+            {
+                output = Json::Value(Json::StaticString("Revoked"));
+                return;
+            }
+            if (input == TransactionStatus::TransactionStatusTradePending)
+            {
+                output = Json::Value(Json::StaticString("TradePending"));
+                return;
+            }
+            if (input == TransactionStatus::TransactionStatusTraded)
+            {
+                output = Json::Value(Json::StaticString("Traded"));
+                return;
+            }
+            if (input == TransactionStatus::TransactionStatusUpgraded)
+            {
+                output = Json::Value(Json::StaticString("Upgraded"));
+                return;
+            }
+            if (input == TransactionStatus::TransactionStatusStackPending)
+            {
+                output = Json::Value(Json::StaticString("StackPending"));
+                return;
+            }
+            if (input == TransactionStatus::TransactionStatusStacked)
+            {
+                output = Json::Value(Json::StaticString("Stacked"));
+                return;
+            }
+            if (input == TransactionStatus::TransactionStatusOther)
+            {
+                output = Json::Value(Json::StaticString("Other"));
+                return;
+            }
+            if (input == TransactionStatus::TransactionStatusFailed)
+            {
+                output = Json::Value(Json::StaticString("Failed"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, TransactionStatus& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "CreateCart")
+            {
+                output = TransactionStatus::TransactionStatusCreateCart;
+                return;
+            }
+            if (inputStr == "Init")
+            {
+                output = TransactionStatus::TransactionStatusInit;
+                return;
+            }
+            if (inputStr == "Approved")
+            {
+                output = TransactionStatus::TransactionStatusApproved;
+                return;
+            }
+            if (inputStr == "Succeeded")
+            {
+                output = TransactionStatus::TransactionStatusSucceeded;
+                return;
+            }
+            if (inputStr == "FailedByProvider")
+            {
+                output = TransactionStatus::TransactionStatusFailedByProvider;
+                return;
+            }
+            if (inputStr == "DisputePending")
+            {
+                output = TransactionStatus::TransactionStatusDisputePending;
+                return;
+            }
+            if (inputStr == "RefundPending")
+            {
+                output = TransactionStatus::TransactionStatusRefundPending;
+                return;
+            }
+            if (inputStr == "Refunded")
+            {
+                output = TransactionStatus::TransactionStatusRefunded;
+                return;
+            }
+            if (inputStr == "RefundFailed")
+            {
+                output = TransactionStatus::TransactionStatusRefundFailed;
+                return;
+            }
+            if (inputStr == "ChargedBack")
+            {
+                output = TransactionStatus::TransactionStatusChargedBack;
+                return;
+            }
+            if (inputStr == "FailedByUber")
+            {
+                output = TransactionStatus::TransactionStatusFailedByUber;
+                return;
+            }
+            if (inputStr == "FailedByPlayFab")
+            {
+                output = TransactionStatus::TransactionStatusFailedByPlayFab;
+                return;
+            }
+            if (inputStr == "Revoked")
+            {
+                output = TransactionStatus::TransactionStatusRevoked;
+                return;
+            }
+            if (inputStr == "TradePending")
+            {
+                output = TransactionStatus::TransactionStatusTradePending;
+                return;
+            }
+            if (inputStr == "Traded")
+            {
+                output = TransactionStatus::TransactionStatusTraded;
+                return;
+            }
+            if (inputStr == "Upgraded")
+            {
+                output = TransactionStatus::TransactionStatusUpgraded;
+                return;
+            }
+            if (inputStr == "StackPending")
+            {
+                output = TransactionStatus::TransactionStatusStackPending;
+                return;
+            }
+            if (inputStr == "Stacked")
+            {
+                output = TransactionStatus::TransactionStatusStacked;
+                return;
+            }
+            if (inputStr == "Other")
+            {
+                output = TransactionStatus::TransactionStatusOther;
+                return;
+            }
+            if (inputStr == "Failed")
+            {
+                output = TransactionStatus::TransactionStatusFailed;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const UserDataPermission input, Json::Value& output)
+        {
+            if (input == UserDataPermission::UserDataPermissionPrivate)
+            {
+                output = Json::Value(Json::StaticString("Private"));
+                return;
+            }
+            if (input == UserDataPermission::UserDataPermissionPublic)
+            {
+                output = Json::Value(Json::StaticString("Public"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, UserDataPermission& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Private")
+            {
+                output = UserDataPermission::UserDataPermissionPrivate;
+                return;
+            }
+            if (inputStr == "Public")
+            {
+                output = UserDataPermission::UserDataPermissionPublic;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const UserOrigination input, Json::Value& output)
+        {
+            if (input == UserOrigination::UserOriginationOrganic)
+            {
+                output = Json::Value(Json::StaticString("Organic"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationSteam)
+            {
+                output = Json::Value(Json::StaticString("Steam"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationGoogle)
+            {
+                output = Json::Value(Json::StaticString("Google"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationAmazon)
+            {
+                output = Json::Value(Json::StaticString("Amazon"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationFacebook)
+            {
+                output = Json::Value(Json::StaticString("Facebook"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationKongregate)
+            {
+                output = Json::Value(Json::StaticString("Kongregate"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationGamersFirst)
+            {
+                output = Json::Value(Json::StaticString("GamersFirst"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationUnknown)
+            {
+                output = Json::Value(Json::StaticString("Unknown"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationIOS)
+            {
+                output = Json::Value(Json::StaticString("IOS"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationLoadTest)
+            {
+                output = Json::Value(Json::StaticString("LoadTest"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationAndroid)
+            {
+                output = Json::Value(Json::StaticString("Android"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationPSN)
+            {
+                output = Json::Value(Json::StaticString("PSN"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationGameCenter)
+            {
+                output = Json::Value(Json::StaticString("GameCenter"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationCustomId)
+            {
+                output = Json::Value(Json::StaticString("CustomId"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationXboxLive)
+            {
+                output = Json::Value(Json::StaticString("XboxLive"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationParse)
+            {
+                output = Json::Value(Json::StaticString("Parse"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationTwitch)
+            {
+                output = Json::Value(Json::StaticString("Twitch"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationWindowsHello)
+            {
+                output = Json::Value(Json::StaticString("WindowsHello"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationServerCustomId)
+            {
+                output = Json::Value(Json::StaticString("ServerCustomId"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationNintendoSwitchDeviceId)
+            {
+                output = Json::Value(Json::StaticString("NintendoSwitchDeviceId"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationFacebookInstantGamesId)
+            {
+                output = Json::Value(Json::StaticString("FacebookInstantGamesId"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationOpenIdConnect)
+            {
+                output = Json::Value(Json::StaticString("OpenIdConnect"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationApple)
+            {
+                output = Json::Value(Json::StaticString("Apple"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationNintendoSwitchAccount)
+            {
+                output = Json::Value(Json::StaticString("NintendoSwitchAccount"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, UserOrigination& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Organic")
+            {
+                output = UserOrigination::UserOriginationOrganic;
+                return;
+            }
+            if (inputStr == "Steam")
+            {
+                output = UserOrigination::UserOriginationSteam;
+                return;
+            }
+            if (inputStr == "Google")
+            {
+                output = UserOrigination::UserOriginationGoogle;
+                return;
+            }
+            if (inputStr == "Amazon")
+            {
+                output = UserOrigination::UserOriginationAmazon;
+                return;
+            }
+            if (inputStr == "Facebook")
+            {
+                output = UserOrigination::UserOriginationFacebook;
+                return;
+            }
+            if (inputStr == "Kongregate")
+            {
+                output = UserOrigination::UserOriginationKongregate;
+                return;
+            }
+            if (inputStr == "GamersFirst")
+            {
+                output = UserOrigination::UserOriginationGamersFirst;
+                return;
+            }
+            if (inputStr == "Unknown")
+            {
+                output = UserOrigination::UserOriginationUnknown;
+                return;
+            }
+            if (inputStr == "IOS")
+            {
+                output = UserOrigination::UserOriginationIOS;
+                return;
+            }
+            if (inputStr == "LoadTest")
+            {
+                output = UserOrigination::UserOriginationLoadTest;
+                return;
+            }
+            if (inputStr == "Android")
+            {
+                output = UserOrigination::UserOriginationAndroid;
+                return;
+            }
+            if (inputStr == "PSN")
+            {
+                output = UserOrigination::UserOriginationPSN;
+                return;
+            }
+            if (inputStr == "GameCenter")
+            {
+                output = UserOrigination::UserOriginationGameCenter;
+                return;
+            }
+            if (inputStr == "CustomId")
+            {
+                output = UserOrigination::UserOriginationCustomId;
+                return;
+            }
+            if (inputStr == "XboxLive")
+            {
+                output = UserOrigination::UserOriginationXboxLive;
+                return;
+            }
+            if (inputStr == "Parse")
+            {
+                output = UserOrigination::UserOriginationParse;
+                return;
+            }
+            if (inputStr == "Twitch")
+            {
+                output = UserOrigination::UserOriginationTwitch;
+                return;
+            }
+            if (inputStr == "WindowsHello")
+            {
+                output = UserOrigination::UserOriginationWindowsHello;
+                return;
+            }
+            if (inputStr == "ServerCustomId")
+            {
+                output = UserOrigination::UserOriginationServerCustomId;
+                return;
+            }
+            if (inputStr == "NintendoSwitchDeviceId")
+            {
+                output = UserOrigination::UserOriginationNintendoSwitchDeviceId;
+                return;
+            }
+            if (inputStr == "FacebookInstantGamesId")
+            {
+                output = UserOrigination::UserOriginationFacebookInstantGamesId;
+                return;
+            }
+            if (inputStr == "OpenIdConnect")
+            {
+                output = UserOrigination::UserOriginationOpenIdConnect;
+                return;
+            }
+            if (inputStr == "Apple")
+            {
+                output = UserOrigination::UserOriginationApple;
+                return;
+            }
+            if (inputStr == "NintendoSwitchAccount")
+            {
+                output = UserOrigination::UserOriginationNintendoSwitchAccount;
+                return;
+            }
+        }
+
+        void AcceptTradeRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAcceptedInventoryInstanceIds), AcceptedInventoryInstanceIds);
+            FromJsonUtilS(FromJsonField(input, keyOfferingPlayerId), OfferingPlayerId);
+            FromJsonUtilS(FromJsonField(input, keyTradeId), TradeId);
+        }
+
+        Json::Value AcceptTradeRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AcceptedInventoryInstanceIds; ToJsonUtilS(AcceptedInventoryInstanceIds, each_AcceptedInventoryInstanceIds); ToJsonField(output, keyAcceptedInventoryInstanceIds) = each_AcceptedInventoryInstanceIds;
+            Json::Value each_OfferingPlayerId; ToJsonUtilS(OfferingPlayerId, each_OfferingPlayerId); ToJsonField(output, keyOfferingPlayerId) = each_OfferingPlayerId;
+            Json::Value each_TradeId; ToJsonUtilS(TradeId, each_TradeId); ToJsonField(output, keyTradeId) = each_TradeId;
+            return output;
+        }
+
+        void TradeInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAcceptedInventoryInstanceIds), AcceptedInventoryInstanceIds);
+            FromJsonUtilS(FromJsonField(input, keyAcceptedPlayerId), AcceptedPlayerId);
+            FromJsonUtilS(FromJsonField(input, keyAllowedPlayerIds), AllowedPlayerIds);
+            FromJsonUtilT(FromJsonField(input, keyCancelledAt), CancelledAt);
+            FromJsonUtilT(FromJsonField(input, keyFilledAt), FilledAt);
+            FromJsonUtilT(FromJsonField(input, keyInvalidatedAt), InvalidatedAt);
+            FromJsonUtilS(FromJsonField(input, keyOfferedCatalogItemIds), OfferedCatalogItemIds);
+            FromJsonUtilS(FromJsonField(input, keyOfferedInventoryInstanceIds), OfferedInventoryInstanceIds);
+            FromJsonUtilS(FromJsonField(input, keyOfferingPlayerId), OfferingPlayerId);
+            FromJsonUtilT(FromJsonField(input, keyOpenedAt), OpenedAt);
+            FromJsonUtilS(FromJsonField(input, keyRequestedCatalogItemIds), RequestedCatalogItemIds);
+            FromJsonUtilE(FromJsonField(input, keyStatus), Status);
+            FromJsonUtilS(FromJsonField(input, keyTradeId), TradeId);
+        }
+
+        Json::Value TradeInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AcceptedInventoryInstanceIds; ToJsonUtilS(AcceptedInventoryInstanceIds, each_AcceptedInventoryInstanceIds); ToJsonField(output, keyAcceptedInventoryInstanceIds) = each_AcceptedInventoryInstanceIds;
+            Json::Value each_AcceptedPlayerId; ToJsonUtilS(AcceptedPlayerId, each_AcceptedPlayerId); ToJsonField(output, keyAcceptedPlayerId) = each_AcceptedPlayerId;
+            Json::Value each_AllowedPlayerIds; ToJsonUtilS(AllowedPlayerIds, each_AllowedPlayerIds); ToJsonField(output, keyAllowedPlayerIds) = each_AllowedPlayerIds;
+            Json::Value each_CancelledAt; ToJsonUtilT(CancelledAt, each_CancelledAt); ToJsonField(output, keyCancelledAt) = each_CancelledAt;
+            Json::Value each_FilledAt; ToJsonUtilT(FilledAt, each_FilledAt); ToJsonField(output, keyFilledAt) = each_FilledAt;
+            Json::Value each_InvalidatedAt; ToJsonUtilT(InvalidatedAt, each_InvalidatedAt); ToJsonField(output, keyInvalidatedAt) = each_InvalidatedAt;
+            Json::Value each_OfferedCatalogItemIds; ToJsonUtilS(OfferedCatalogItemIds, each_OfferedCatalogItemIds); ToJsonField(output, keyOfferedCatalogItemIds) = each_OfferedCatalogItemIds;
+            Json::Value each_OfferedInventoryInstanceIds; ToJsonUtilS(OfferedInventoryInstanceIds, each_OfferedInventoryInstanceIds); ToJsonField(output, keyOfferedInventoryInstanceIds) = each_OfferedInventoryInstanceIds;
+            Json::Value each_OfferingPlayerId; ToJsonUtilS(OfferingPlayerId, each_OfferingPlayerId); ToJsonField(output, keyOfferingPlayerId) = each_OfferingPlayerId;
+            Json::Value each_OpenedAt; ToJsonUtilT(OpenedAt, each_OpenedAt); ToJsonField(output, keyOpenedAt) = each_OpenedAt;
+            Json::Value each_RequestedCatalogItemIds; ToJsonUtilS(RequestedCatalogItemIds, each_RequestedCatalogItemIds); ToJsonField(output, keyRequestedCatalogItemIds) = each_RequestedCatalogItemIds;
+            Json::Value each_Status; ToJsonUtilE(Status, each_Status); ToJsonField(output, keyStatus) = each_Status;
+            Json::Value each_TradeId; ToJsonUtilS(TradeId, each_TradeId); ToJsonField(output, keyTradeId) = each_TradeId;
+            return output;
+        }
+
+        void AcceptTradeResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyTrade), Trade);
+        }
+
+        Json::Value AcceptTradeResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Trade; ToJsonUtilO(Trade, each_Trade); ToJsonField(output, keyTrade) = each_Trade;
+            return output;
+        }
+
+        void AdCampaignAttributionModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilT(FromJsonField(input, keyAttributedAt), AttributedAt);
+            FromJsonUtilS(FromJsonField(input, keyCampaignId), CampaignId);
+            FromJsonUtilS(FromJsonField(input, keyPlatform), Platform);
+        }
+
+        Json::Value AdCampaignAttributionModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AttributedAt; ToJsonUtilT(AttributedAt, each_AttributedAt); ToJsonField(output, keyAttributedAt) = each_AttributedAt;
+            Json::Value each_CampaignId; ToJsonUtilS(CampaignId, each_CampaignId); ToJsonField(output, keyCampaignId) = each_CampaignId;
+            Json::Value each_Platform; ToJsonUtilS(Platform, each_Platform); ToJsonField(output, keyPlatform) = each_Platform;
+            return output;
+        }
+
+        void AddFriendRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyFriendEmail), FriendEmail);
+            FromJsonUtilS(FromJsonField(input, keyFriendPlayFabId), FriendPlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyFriendTitleDisplayName), FriendTitleDisplayName);
+            FromJsonUtilS(FromJsonField(input, keyFriendUsername), FriendUsername);
+        }
+
+        Json::Value AddFriendRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_FriendEmail; ToJsonUtilS(FriendEmail, each_FriendEmail); ToJsonField(output, keyFriendEmail) = each_FriendEmail;
+            Json::Value each_FriendPlayFabId; ToJsonUtilS(FriendPlayFabId, each_FriendPlayFabId); ToJsonField(output, keyFriendPlayFabId) = each_FriendPlayFabId;
+            Json::Value each_FriendTitleDisplayName; ToJsonUtilS(FriendTitleDisplayName, each_FriendTitleDisplayName); ToJsonField(output, keyFriendTitleDisplayName) = each_FriendTitleDisplayName;
+            Json::Value each_FriendUsername; ToJsonUtilS(FriendUsername, each_FriendUsername); ToJsonField(output, keyFriendUsername) = each_FriendUsername;
+            return output;
+        }
+
+        void AddFriendResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyCreated), Created);
+        }
+
+        Json::Value AddFriendResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Created; ToJsonUtilP(Created, each_Created); ToJsonField(output, keyCreated) = each_Created;
+            return output;
+        }
+
+        void GenericServiceId::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyServiceName), ServiceName);
+            FromJsonUtilS(FromJsonField(input, keyUserId), UserId);
+        }
+
+        Json::Value GenericServiceId::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ServiceName; ToJsonUtilS(ServiceName, each_ServiceName); ToJsonField(output, keyServiceName) = each_ServiceName;
+            Json::Value each_UserId; ToJsonUtilS(UserId, each_UserId); ToJsonField(output, keyUserId) = each_UserId;
+            return output;
+        }
+
+        void AddGenericIDRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyGenericId), GenericId);
+        }
+
+        Json::Value AddGenericIDRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GenericId; ToJsonUtilO(GenericId, each_GenericId); ToJsonField(output, keyGenericId) = each_GenericId;
+            return output;
+        }
+
+        void AddGenericIDResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value AddGenericIDResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void AddOrUpdateContactEmailRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyEmailAddress), EmailAddress);
+        }
+
+        Json::Value AddOrUpdateContactEmailRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_EmailAddress; ToJsonUtilS(EmailAddress, each_EmailAddress); ToJsonField(output, keyEmailAddress) = each_EmailAddress;
+            return output;
+        }
+
+        void AddOrUpdateContactEmailResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value AddOrUpdateContactEmailResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void AddSharedGroupMembersRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlayFabIds), PlayFabIds);
+            FromJsonUtilS(FromJsonField(input, keySharedGroupId), SharedGroupId);
+        }
+
+        Json::Value AddSharedGroupMembersRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayFabIds; ToJsonUtilS(PlayFabIds, each_PlayFabIds); ToJsonField(output, keyPlayFabIds) = each_PlayFabIds;
+            Json::Value each_SharedGroupId; ToJsonUtilS(SharedGroupId, each_SharedGroupId); ToJsonField(output, keySharedGroupId) = each_SharedGroupId;
+            return output;
+        }
+
+        void AddSharedGroupMembersResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value AddSharedGroupMembersResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void AddUsernamePasswordRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyEmail), Email);
+            FromJsonUtilS(FromJsonField(input, keyPassword), Password);
+            FromJsonUtilS(FromJsonField(input, keyUsername), Username);
+        }
+
+        Json::Value AddUsernamePasswordRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Email; ToJsonUtilS(Email, each_Email); ToJsonField(output, keyEmail) = each_Email;
+            Json::Value each_Password; ToJsonUtilS(Password, each_Password); ToJsonField(output, keyPassword) = each_Password;
+            Json::Value each_Username; ToJsonUtilS(Username, each_Username); ToJsonField(output, keyUsername) = each_Username;
+            return output;
+        }
+
+        void AddUsernamePasswordResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyUsername), Username);
+        }
+
+        Json::Value AddUsernamePasswordResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Username; ToJsonUtilS(Username, each_Username); ToJsonField(output, keyUsername) = each_Username;
+            return output;
+        }
+
+        void AddUserVirtualCurrencyRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyAmount), Amount);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyVirtualCurrency), VirtualCurrency);
+        }
+
+        Json::Value AddUserVirtualCurrencyRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Amount; ToJsonUtilP(Amount, each_Amount); ToJsonField(output, keyAmount) = each_Amount;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_VirtualCurrency; ToJsonUtilS(VirtualCurrency, each_VirtualCurrency); ToJsonField(output, keyVirtualCurrency) = each_VirtualCurrency;
+            return output;
+        }
+
+        void AdPlacementDetails::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlacementId), PlacementId);
+            FromJsonUtilS(FromJsonField(input, keyPlacementName), PlacementName);
+            FromJsonUtilP(FromJsonField(input, keyPlacementViewsRemaining), PlacementViewsRemaining);
+            FromJsonUtilP(FromJsonField(input, keyPlacementViewsResetMinutes), PlacementViewsResetMinutes);
+            FromJsonUtilS(FromJsonField(input, keyRewardAssetUrl), RewardAssetUrl);
+            FromJsonUtilS(FromJsonField(input, keyRewardDescription), RewardDescription);
+            FromJsonUtilS(FromJsonField(input, keyRewardId), RewardId);
+            FromJsonUtilS(FromJsonField(input, keyRewardName), RewardName);
+        }
+
+        Json::Value AdPlacementDetails::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlacementId; ToJsonUtilS(PlacementId, each_PlacementId); ToJsonField(output, keyPlacementId) = each_PlacementId;
+            Json::Value each_PlacementName; ToJsonUtilS(PlacementName, each_PlacementName); ToJsonField(output, keyPlacementName) = each_PlacementName;
+            Json::Value each_PlacementViewsRemaining; ToJsonUtilP(PlacementViewsRemaining, each_PlacementViewsRemaining); ToJsonField(output, keyPlacementViewsRemaining) = each_PlacementViewsRemaining;
+            Json::Value each_PlacementViewsResetMinutes; ToJsonUtilP(PlacementViewsResetMinutes, each_PlacementViewsResetMinutes); ToJsonField(output, keyPlacementViewsResetMinutes) = each_PlacementViewsResetMinutes;
+            Json::Value each_RewardAssetUrl; ToJsonUtilS(RewardAssetUrl, each_RewardAssetUrl); ToJsonField(output, keyRewardAssetUrl) = each_RewardAssetUrl;
+            Json::Value each_RewardDescription; ToJsonUtilS(RewardDescription, each_RewardDescription); ToJsonField(output, keyRewardDescription) = each_RewardDescription;
+            Json::Value each_RewardId; ToJsonUtilS(RewardId, each_RewardId); ToJsonField(output, keyRewardId) = each_RewardId;
+            Json::Value each_RewardName; ToJsonUtilS(RewardName, each_RewardName); ToJsonField(output, keyRewardName) = each_RewardName;
+            return output;
+        }
+
+        void AdRewardItemGranted::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogId), CatalogId);
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+            FromJsonUtilS(FromJsonField(input, keyInstanceId), InstanceId);
+            FromJsonUtilS(FromJsonField(input, keyItemId), ItemId);
+        }
+
+        Json::Value AdRewardItemGranted::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogId; ToJsonUtilS(CatalogId, each_CatalogId); ToJsonField(output, keyCatalogId) = each_CatalogId;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            Json::Value each_InstanceId; ToJsonUtilS(InstanceId, each_InstanceId); ToJsonField(output, keyInstanceId) = each_InstanceId;
+            Json::Value each_ItemId; ToJsonUtilS(ItemId, each_ItemId); ToJsonField(output, keyItemId) = each_ItemId;
+            return output;
+        }
+
+        void AdRewardResults::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyGrantedItems), GrantedItems);
+            FromJsonUtilP(FromJsonField(input, keyGrantedVirtualCurrencies), GrantedVirtualCurrencies);
+            FromJsonUtilP(FromJsonField(input, keyIncrementedStatistics), IncrementedStatistics);
+        }
+
+        Json::Value AdRewardResults::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GrantedItems; ToJsonUtilO(GrantedItems, each_GrantedItems); ToJsonField(output, keyGrantedItems) = each_GrantedItems;
+            Json::Value each_GrantedVirtualCurrencies; ToJsonUtilP(GrantedVirtualCurrencies, each_GrantedVirtualCurrencies); ToJsonField(output, keyGrantedVirtualCurrencies) = each_GrantedVirtualCurrencies;
+            Json::Value each_IncrementedStatistics; ToJsonUtilP(IncrementedStatistics, each_IncrementedStatistics); ToJsonField(output, keyIncrementedStatistics) = each_IncrementedStatistics;
+            return output;
+        }
+
+        void AndroidDevicePushNotificationRegistrationRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyConfirmationMessage), ConfirmationMessage);
+            FromJsonUtilS(FromJsonField(input, keyDeviceToken), DeviceToken);
+            FromJsonUtilP(FromJsonField(input, keySendPushNotificationConfirmation), SendPushNotificationConfirmation);
+        }
+
+        Json::Value AndroidDevicePushNotificationRegistrationRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ConfirmationMessage; ToJsonUtilS(ConfirmationMessage, each_ConfirmationMessage); ToJsonField(output, keyConfirmationMessage) = each_ConfirmationMessage;
+            Json::Value each_DeviceToken; ToJsonUtilS(DeviceToken, each_DeviceToken); ToJsonField(output, keyDeviceToken) = each_DeviceToken;
+            Json::Value each_SendPushNotificationConfirmation; ToJsonUtilP(SendPushNotificationConfirmation, each_SendPushNotificationConfirmation); ToJsonField(output, keySendPushNotificationConfirmation) = each_SendPushNotificationConfirmation;
+            return output;
+        }
+
+        void AndroidDevicePushNotificationRegistrationResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value AndroidDevicePushNotificationRegistrationResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void AttributeInstallRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAdid), Adid);
+            FromJsonUtilS(FromJsonField(input, keyIdfa), Idfa);
+        }
+
+        Json::Value AttributeInstallRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Adid; ToJsonUtilS(Adid, each_Adid); ToJsonField(output, keyAdid) = each_Adid;
+            Json::Value each_Idfa; ToJsonUtilS(Idfa, each_Idfa); ToJsonField(output, keyIdfa) = each_Idfa;
+            return output;
+        }
+
+        void AttributeInstallResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value AttributeInstallResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void CancelTradeRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyTradeId), TradeId);
+        }
+
+        Json::Value CancelTradeRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_TradeId; ToJsonUtilS(TradeId, each_TradeId); ToJsonField(output, keyTradeId) = each_TradeId;
+            return output;
+        }
+
+        void CancelTradeResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyTrade), Trade);
+        }
+
+        Json::Value CancelTradeResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Trade; ToJsonUtilO(Trade, each_Trade); ToJsonField(output, keyTrade) = each_Trade;
+            return output;
+        }
+
+        void CartItem::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyDescription), Description);
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+            FromJsonUtilS(FromJsonField(input, keyItemClass), ItemClass);
+            FromJsonUtilS(FromJsonField(input, keyItemId), ItemId);
+            FromJsonUtilS(FromJsonField(input, keyItemInstanceId), ItemInstanceId);
+            FromJsonUtilP(FromJsonField(input, keyRealCurrencyPrices), RealCurrencyPrices);
+            FromJsonUtilP(FromJsonField(input, keyVCAmount), VCAmount);
+            FromJsonUtilP(FromJsonField(input, keyVirtualCurrencyPrices), VirtualCurrencyPrices);
+        }
+
+        Json::Value CartItem::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Description; ToJsonUtilS(Description, each_Description); ToJsonField(output, keyDescription) = each_Description;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            Json::Value each_ItemClass; ToJsonUtilS(ItemClass, each_ItemClass); ToJsonField(output, keyItemClass) = each_ItemClass;
+            Json::Value each_ItemId; ToJsonUtilS(ItemId, each_ItemId); ToJsonField(output, keyItemId) = each_ItemId;
+            Json::Value each_ItemInstanceId; ToJsonUtilS(ItemInstanceId, each_ItemInstanceId); ToJsonField(output, keyItemInstanceId) = each_ItemInstanceId;
+            Json::Value each_RealCurrencyPrices; ToJsonUtilP(RealCurrencyPrices, each_RealCurrencyPrices); ToJsonField(output, keyRealCurrencyPrices) = each_RealCurrencyPrices;
+            Json::Value each_VCAmount; ToJsonUtilP(VCAmount, each_VCAmount); ToJsonField(output, keyVCAmount) = each_VCAmount;
+            Json::Value each_VirtualCurrencyPrices; ToJsonUtilP(VirtualCurrencyPrices, each_VirtualCurrencyPrices); ToJsonField(output, keyVirtualCurrencyPrices) = each_VirtualCurrencyPrices;
+            return output;
+        }
+
+        void CatalogItemBundleInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBundledItems), BundledItems);
+            FromJsonUtilS(FromJsonField(input, keyBundledResultTables), BundledResultTables);
+            FromJsonUtilP(FromJsonField(input, keyBundledVirtualCurrencies), BundledVirtualCurrencies);
+        }
+
+        Json::Value CatalogItemBundleInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BundledItems; ToJsonUtilS(BundledItems, each_BundledItems); ToJsonField(output, keyBundledItems) = each_BundledItems;
+            Json::Value each_BundledResultTables; ToJsonUtilS(BundledResultTables, each_BundledResultTables); ToJsonField(output, keyBundledResultTables) = each_BundledResultTables;
+            Json::Value each_BundledVirtualCurrencies; ToJsonUtilP(BundledVirtualCurrencies, each_BundledVirtualCurrencies); ToJsonField(output, keyBundledVirtualCurrencies) = each_BundledVirtualCurrencies;
+            return output;
+        }
+
+        void CatalogItemConsumableInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyUsageCount), UsageCount);
+            FromJsonUtilP(FromJsonField(input, keyUsagePeriod), UsagePeriod);
+            FromJsonUtilS(FromJsonField(input, keyUsagePeriodGroup), UsagePeriodGroup);
+        }
+
+        Json::Value CatalogItemConsumableInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_UsageCount; ToJsonUtilP(UsageCount, each_UsageCount); ToJsonField(output, keyUsageCount) = each_UsageCount;
+            Json::Value each_UsagePeriod; ToJsonUtilP(UsagePeriod, each_UsagePeriod); ToJsonField(output, keyUsagePeriod) = each_UsagePeriod;
+            Json::Value each_UsagePeriodGroup; ToJsonUtilS(UsagePeriodGroup, each_UsagePeriodGroup); ToJsonField(output, keyUsagePeriodGroup) = each_UsagePeriodGroup;
+            return output;
+        }
+
+        void CatalogItemContainerInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyItemContents), ItemContents);
+            FromJsonUtilS(FromJsonField(input, keyKeyItemId), KeyItemId);
+            FromJsonUtilS(FromJsonField(input, keyResultTableContents), ResultTableContents);
+            FromJsonUtilP(FromJsonField(input, keyVirtualCurrencyContents), VirtualCurrencyContents);
+        }
+
+        Json::Value CatalogItemContainerInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ItemContents; ToJsonUtilS(ItemContents, each_ItemContents); ToJsonField(output, keyItemContents) = each_ItemContents;
+            Json::Value each_KeyItemId; ToJsonUtilS(KeyItemId, each_KeyItemId); ToJsonField(output, keyKeyItemId) = each_KeyItemId;
+            Json::Value each_ResultTableContents; ToJsonUtilS(ResultTableContents, each_ResultTableContents); ToJsonField(output, keyResultTableContents) = each_ResultTableContents;
+            Json::Value each_VirtualCurrencyContents; ToJsonUtilP(VirtualCurrencyContents, each_VirtualCurrencyContents); ToJsonField(output, keyVirtualCurrencyContents) = each_VirtualCurrencyContents;
+            return output;
+        }
+
+        void CatalogItem::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyBundle), Bundle);
+            FromJsonUtilP(FromJsonField(input, keyCanBecomeCharacter), CanBecomeCharacter);
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilO(FromJsonField(input, keyConsumable), Consumable);
+            FromJsonUtilO(FromJsonField(input, keyContainer), Container);
+            FromJsonUtilS(FromJsonField(input, keyCustomData), CustomData);
+            FromJsonUtilS(FromJsonField(input, keyDescription), Description);
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+            FromJsonUtilP(FromJsonField(input, keyInitialLimitedEditionCount), InitialLimitedEditionCount);
+            FromJsonUtilP(FromJsonField(input, keyIsLimitedEdition), IsLimitedEdition);
+            FromJsonUtilP(FromJsonField(input, keyIsStackable), IsStackable);
+            FromJsonUtilP(FromJsonField(input, keyIsTradable), IsTradable);
+            FromJsonUtilS(FromJsonField(input, keyItemClass), ItemClass);
+            FromJsonUtilS(FromJsonField(input, keyItemId), ItemId);
+            FromJsonUtilS(FromJsonField(input, keyItemImageUrl), ItemImageUrl);
+            FromJsonUtilP(FromJsonField(input, keyRealCurrencyPrices), RealCurrencyPrices);
+            FromJsonUtilS(FromJsonField(input, keyTags), Tags);
+            FromJsonUtilP(FromJsonField(input, keyVirtualCurrencyPrices), VirtualCurrencyPrices);
+        }
+
+        Json::Value CatalogItem::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Bundle; ToJsonUtilO(Bundle, each_Bundle); ToJsonField(output, keyBundle) = each_Bundle;
+            Json::Value each_CanBecomeCharacter; ToJsonUtilP(CanBecomeCharacter, each_CanBecomeCharacter); ToJsonField(output, keyCanBecomeCharacter) = each_CanBecomeCharacter;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_Consumable; ToJsonUtilO(Consumable, each_Consumable); ToJsonField(output, keyConsumable) = each_Consumable;
+            Json::Value each_Container; ToJsonUtilO(Container, each_Container); ToJsonField(output, keyContainer) = each_Container;
+            Json::Value each_CustomData; ToJsonUtilS(CustomData, each_CustomData); ToJsonField(output, keyCustomData) = each_CustomData;
+            Json::Value each_Description; ToJsonUtilS(Description, each_Description); ToJsonField(output, keyDescription) = each_Description;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            Json::Value each_InitialLimitedEditionCount; ToJsonUtilP(InitialLimitedEditionCount, each_InitialLimitedEditionCount); ToJsonField(output, keyInitialLimitedEditionCount) = each_InitialLimitedEditionCount;
+            Json::Value each_IsLimitedEdition; ToJsonUtilP(IsLimitedEdition, each_IsLimitedEdition); ToJsonField(output, keyIsLimitedEdition) = each_IsLimitedEdition;
+            Json::Value each_IsStackable; ToJsonUtilP(IsStackable, each_IsStackable); ToJsonField(output, keyIsStackable) = each_IsStackable;
+            Json::Value each_IsTradable; ToJsonUtilP(IsTradable, each_IsTradable); ToJsonField(output, keyIsTradable) = each_IsTradable;
+            Json::Value each_ItemClass; ToJsonUtilS(ItemClass, each_ItemClass); ToJsonField(output, keyItemClass) = each_ItemClass;
+            Json::Value each_ItemId; ToJsonUtilS(ItemId, each_ItemId); ToJsonField(output, keyItemId) = each_ItemId;
+            Json::Value each_ItemImageUrl; ToJsonUtilS(ItemImageUrl, each_ItemImageUrl); ToJsonField(output, keyItemImageUrl) = each_ItemImageUrl;
+            Json::Value each_RealCurrencyPrices; ToJsonUtilP(RealCurrencyPrices, each_RealCurrencyPrices); ToJsonField(output, keyRealCurrencyPrices) = each_RealCurrencyPrices;
+            Json::Value each_Tags; ToJsonUtilS(Tags, each_Tags); ToJsonField(output, keyTags) = each_Tags;
+            Json::Value each_VirtualCurrencyPrices; ToJsonUtilP(VirtualCurrencyPrices, each_VirtualCurrencyPrices); ToJsonField(output, keyVirtualCurrencyPrices) = each_VirtualCurrencyPrices;
+            return output;
+        }
+
+        void ItemInstance::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAnnotation), Annotation);
+            FromJsonUtilS(FromJsonField(input, keyBundleContents), BundleContents);
+            FromJsonUtilS(FromJsonField(input, keyBundleParent), BundleParent);
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCustomData), CustomData);
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+            FromJsonUtilT(FromJsonField(input, keyExpiration), Expiration);
+            FromJsonUtilS(FromJsonField(input, keyItemClass), ItemClass);
+            FromJsonUtilS(FromJsonField(input, keyItemId), ItemId);
+            FromJsonUtilS(FromJsonField(input, keyItemInstanceId), ItemInstanceId);
+            FromJsonUtilT(FromJsonField(input, keyPurchaseDate), PurchaseDate);
+            FromJsonUtilP(FromJsonField(input, keyRemainingUses), RemainingUses);
+            FromJsonUtilS(FromJsonField(input, keyUnitCurrency), UnitCurrency);
+            FromJsonUtilP(FromJsonField(input, keyUnitPrice), UnitPrice);
+            FromJsonUtilP(FromJsonField(input, keyUsesIncrementedBy), UsesIncrementedBy);
+        }
+
+        Json::Value ItemInstance::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Annotation; ToJsonUtilS(Annotation, each_Annotation); ToJsonField(output, keyAnnotation) = each_Annotation;
+            Json::Value each_BundleContents; ToJsonUtilS(BundleContents, each_BundleContents); ToJsonField(output, keyBundleContents) = each_BundleContents;
+            Json::Value each_BundleParent; ToJsonUtilS(BundleParent, each_BundleParent); ToJsonField(output, keyBundleParent) = each_BundleParent;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CustomData; ToJsonUtilS(CustomData, each_CustomData); ToJsonField(output, keyCustomData) = each_CustomData;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            Json::Value each_Expiration; ToJsonUtilT(Expiration, each_Expiration); ToJsonField(output, keyExpiration) = each_Expiration;
+            Json::Value each_ItemClass; ToJsonUtilS(ItemClass, each_ItemClass); ToJsonField(output, keyItemClass) = each_ItemClass;
+            Json::Value each_ItemId; ToJsonUtilS(ItemId, each_ItemId); ToJsonField(output, keyItemId) = each_ItemId;
+            Json::Value each_ItemInstanceId; ToJsonUtilS(ItemInstanceId, each_ItemInstanceId); ToJsonField(output, keyItemInstanceId) = each_ItemInstanceId;
+            Json::Value each_PurchaseDate; ToJsonUtilT(PurchaseDate, each_PurchaseDate); ToJsonField(output, keyPurchaseDate) = each_PurchaseDate;
+            Json::Value each_RemainingUses; ToJsonUtilP(RemainingUses, each_RemainingUses); ToJsonField(output, keyRemainingUses) = each_RemainingUses;
+            Json::Value each_UnitCurrency; ToJsonUtilS(UnitCurrency, each_UnitCurrency); ToJsonField(output, keyUnitCurrency) = each_UnitCurrency;
+            Json::Value each_UnitPrice; ToJsonUtilP(UnitPrice, each_UnitPrice); ToJsonField(output, keyUnitPrice) = each_UnitPrice;
+            Json::Value each_UsesIncrementedBy; ToJsonUtilP(UsesIncrementedBy, each_UsesIncrementedBy); ToJsonField(output, keyUsesIncrementedBy) = each_UsesIncrementedBy;
+            return output;
+        }
+
+        void CharacterInventory::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilO(FromJsonField(input, keyInventory), Inventory);
+        }
+
+        Json::Value CharacterInventory::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_Inventory; ToJsonUtilO(Inventory, each_Inventory); ToJsonField(output, keyInventory) = each_Inventory;
+            return output;
+        }
+
+        void CharacterLeaderboardEntry::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyCharacterName), CharacterName);
+            FromJsonUtilS(FromJsonField(input, keyCharacterType), CharacterType);
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilP(FromJsonField(input, keyPosition), Position);
+            FromJsonUtilP(FromJsonField(input, keyStatValue), StatValue);
+        }
+
+        Json::Value CharacterLeaderboardEntry::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_CharacterName; ToJsonUtilS(CharacterName, each_CharacterName); ToJsonField(output, keyCharacterName) = each_CharacterName;
+            Json::Value each_CharacterType; ToJsonUtilS(CharacterType, each_CharacterType); ToJsonField(output, keyCharacterType) = each_CharacterType;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_Position; ToJsonUtilP(Position, each_Position); ToJsonField(output, keyPosition) = each_Position;
+            Json::Value each_StatValue; ToJsonUtilP(StatValue, each_StatValue); ToJsonField(output, keyStatValue) = each_StatValue;
+            return output;
+        }
+
+        void CharacterResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyCharacterName), CharacterName);
+            FromJsonUtilS(FromJsonField(input, keyCharacterType), CharacterType);
+        }
+
+        Json::Value CharacterResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_CharacterName; ToJsonUtilS(CharacterName, each_CharacterName); ToJsonField(output, keyCharacterName) = each_CharacterName;
+            Json::Value each_CharacterType; ToJsonUtilS(CharacterType, each_CharacterType); ToJsonField(output, keyCharacterType) = each_CharacterType;
+            return output;
+        }
+
+        void Container_Dictionary_String_String::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyData), Data);
+        }
+
+        Json::Value Container_Dictionary_String_String::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Data; ToJsonUtilS(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            return output;
+        }
+
+        void CollectionFilter::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyExcludes), Excludes);
+            FromJsonUtilO(FromJsonField(input, keyIncludes), Includes);
+        }
+
+        Json::Value CollectionFilter::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Excludes; ToJsonUtilO(Excludes, each_Excludes); ToJsonField(output, keyExcludes) = each_Excludes;
+            Json::Value each_Includes; ToJsonUtilO(Includes, each_Includes); ToJsonField(output, keyIncludes) = each_Includes;
+            return output;
+        }
+
+        void ConfirmPurchaseRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyOrderId), OrderId);
+        }
+
+        Json::Value ConfirmPurchaseRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_OrderId; ToJsonUtilS(OrderId, each_OrderId); ToJsonField(output, keyOrderId) = each_OrderId;
+            return output;
+        }
+
+        void ConfirmPurchaseResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyItems), Items);
+            FromJsonUtilS(FromJsonField(input, keyOrderId), OrderId);
+            FromJsonUtilT(FromJsonField(input, keyPurchaseDate), PurchaseDate);
+        }
+
+        Json::Value ConfirmPurchaseResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Items; ToJsonUtilO(Items, each_Items); ToJsonField(output, keyItems) = each_Items;
+            Json::Value each_OrderId; ToJsonUtilS(OrderId, each_OrderId); ToJsonField(output, keyOrderId) = each_OrderId;
+            Json::Value each_PurchaseDate; ToJsonUtilT(PurchaseDate, each_PurchaseDate); ToJsonField(output, keyPurchaseDate) = each_PurchaseDate;
+            return output;
+        }
+
+        void ConsumeItemRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilP(FromJsonField(input, keyConsumeCount), ConsumeCount);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyItemInstanceId), ItemInstanceId);
+        }
+
+        Json::Value ConsumeItemRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_ConsumeCount; ToJsonUtilP(ConsumeCount, each_ConsumeCount); ToJsonField(output, keyConsumeCount) = each_ConsumeCount;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ItemInstanceId; ToJsonUtilS(ItemInstanceId, each_ItemInstanceId); ToJsonField(output, keyItemInstanceId) = each_ItemInstanceId;
+            return output;
+        }
+
+        void ConsumeItemResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyItemInstanceId), ItemInstanceId);
+            FromJsonUtilP(FromJsonField(input, keyRemainingUses), RemainingUses);
+        }
+
+        Json::Value ConsumeItemResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ItemInstanceId; ToJsonUtilS(ItemInstanceId, each_ItemInstanceId); ToJsonField(output, keyItemInstanceId) = each_ItemInstanceId;
+            Json::Value each_RemainingUses; ToJsonUtilP(RemainingUses, each_RemainingUses); ToJsonField(output, keyRemainingUses) = each_RemainingUses;
+            return output;
+        }
+
+        void MicrosoftStorePayload::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCollectionsMsIdKey), CollectionsMsIdKey);
+            FromJsonUtilS(FromJsonField(input, keyUserId), UserId);
+            FromJsonUtilS(FromJsonField(input, keyXboxToken), XboxToken);
+        }
+
+        Json::Value MicrosoftStorePayload::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CollectionsMsIdKey; ToJsonUtilS(CollectionsMsIdKey, each_CollectionsMsIdKey); ToJsonField(output, keyCollectionsMsIdKey) = each_CollectionsMsIdKey;
+            Json::Value each_UserId; ToJsonUtilS(UserId, each_UserId); ToJsonField(output, keyUserId) = each_UserId;
+            Json::Value each_XboxToken; ToJsonUtilS(XboxToken, each_XboxToken); ToJsonField(output, keyXboxToken) = each_XboxToken;
+            return output;
+        }
+
+        void ConsumeMicrosoftStoreEntitlementsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyMarketplaceSpecificData), MarketplaceSpecificData);
+        }
+
+        Json::Value ConsumeMicrosoftStoreEntitlementsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_MarketplaceSpecificData; ToJsonUtilO(MarketplaceSpecificData, each_MarketplaceSpecificData); ToJsonField(output, keyMarketplaceSpecificData) = each_MarketplaceSpecificData;
+            return output;
+        }
+
+        void ConsumeMicrosoftStoreEntitlementsResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyItems), Items);
+        }
+
+        Json::Value ConsumeMicrosoftStoreEntitlementsResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Items; ToJsonUtilO(Items, each_Items); ToJsonField(output, keyItems) = each_Items;
+            return output;
+        }
+
+        void PlayStation5Payload::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyIds), Ids);
+            FromJsonUtilS(FromJsonField(input, keyServiceLabel), ServiceLabel);
+        }
+
+        Json::Value PlayStation5Payload::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Ids; ToJsonUtilS(Ids, each_Ids); ToJsonField(output, keyIds) = each_Ids;
+            Json::Value each_ServiceLabel; ToJsonUtilS(ServiceLabel, each_ServiceLabel); ToJsonField(output, keyServiceLabel) = each_ServiceLabel;
+            return output;
+        }
+
+        void ConsumePS5EntitlementsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyMarketplaceSpecificData), MarketplaceSpecificData);
+        }
+
+        Json::Value ConsumePS5EntitlementsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_MarketplaceSpecificData; ToJsonUtilO(MarketplaceSpecificData, each_MarketplaceSpecificData); ToJsonField(output, keyMarketplaceSpecificData) = each_MarketplaceSpecificData;
+            return output;
+        }
+
+        void ConsumePS5EntitlementsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyItems), Items);
+        }
+
+        Json::Value ConsumePS5EntitlementsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Items; ToJsonUtilO(Items, each_Items); ToJsonField(output, keyItems) = each_Items;
+            return output;
+        }
+
+        void ConsumePSNEntitlementsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyServiceLabel), ServiceLabel);
+        }
+
+        Json::Value ConsumePSNEntitlementsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ServiceLabel; ToJsonUtilP(ServiceLabel, each_ServiceLabel); ToJsonField(output, keyServiceLabel) = each_ServiceLabel;
+            return output;
+        }
+
+        void ConsumePSNEntitlementsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyItemsGranted), ItemsGranted);
+        }
+
+        Json::Value ConsumePSNEntitlementsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ItemsGranted; ToJsonUtilO(ItemsGranted, each_ItemsGranted); ToJsonField(output, keyItemsGranted) = each_ItemsGranted;
+            return output;
+        }
+
+        void ConsumeXboxEntitlementsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyXboxToken), XboxToken);
+        }
+
+        Json::Value ConsumeXboxEntitlementsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_XboxToken; ToJsonUtilS(XboxToken, each_XboxToken); ToJsonField(output, keyXboxToken) = each_XboxToken;
+            return output;
+        }
+
+        void ConsumeXboxEntitlementsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyItems), Items);
+        }
+
+        Json::Value ConsumeXboxEntitlementsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Items; ToJsonUtilO(Items, each_Items); ToJsonField(output, keyItems) = each_Items;
+            return output;
+        }
+
+        void ContactEmailInfoModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyEmailAddress), EmailAddress);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilE(FromJsonField(input, keyVerificationStatus), VerificationStatus);
+        }
+
+        Json::Value ContactEmailInfoModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_EmailAddress; ToJsonUtilS(EmailAddress, each_EmailAddress); ToJsonField(output, keyEmailAddress) = each_EmailAddress;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_VerificationStatus; ToJsonUtilE(VerificationStatus, each_VerificationStatus); ToJsonField(output, keyVerificationStatus) = each_VerificationStatus;
+            return output;
+        }
+
+        void CreateSharedGroupRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keySharedGroupId), SharedGroupId);
+        }
+
+        Json::Value CreateSharedGroupRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_SharedGroupId; ToJsonUtilS(SharedGroupId, each_SharedGroupId); ToJsonField(output, keySharedGroupId) = each_SharedGroupId;
+            return output;
+        }
+
+        void CreateSharedGroupResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keySharedGroupId), SharedGroupId);
+        }
+
+        Json::Value CreateSharedGroupResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_SharedGroupId; ToJsonUtilS(SharedGroupId, each_SharedGroupId); ToJsonField(output, keySharedGroupId) = each_SharedGroupId;
+            return output;
+        }
+
+        void CurrentGamesRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBuildVersion), BuildVersion);
+            FromJsonUtilS(FromJsonField(input, keyGameMode), GameMode);
+            FromJsonUtilE(FromJsonField(input, keyRegion), pfRegion);
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+            FromJsonUtilO(FromJsonField(input, keyTagFilter), TagFilter);
+        }
+
+        Json::Value CurrentGamesRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BuildVersion; ToJsonUtilS(BuildVersion, each_BuildVersion); ToJsonField(output, keyBuildVersion) = each_BuildVersion;
+            Json::Value each_GameMode; ToJsonUtilS(GameMode, each_GameMode); ToJsonField(output, keyGameMode) = each_GameMode;
+            Json::Value each_pfRegion; ToJsonUtilE(pfRegion, each_pfRegion); ToJsonField(output, keyRegion) = each_pfRegion;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            Json::Value each_TagFilter; ToJsonUtilO(TagFilter, each_TagFilter); ToJsonField(output, keyTagFilter) = each_TagFilter;
+            return output;
+        }
+
+        void GameInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBuildVersion), BuildVersion);
+            FromJsonUtilS(FromJsonField(input, keyGameMode), GameMode);
+            FromJsonUtilS(FromJsonField(input, keyGameServerData), GameServerData);
+            FromJsonUtilE(FromJsonField(input, keyGameServerStateEnum), GameServerStateEnum);
+            FromJsonUtilT(FromJsonField(input, keyLastHeartbeat), LastHeartbeat);
+            FromJsonUtilS(FromJsonField(input, keyLobbyID), LobbyID);
+            FromJsonUtilP(FromJsonField(input, keyMaxPlayers), MaxPlayers);
+            FromJsonUtilS(FromJsonField(input, keyPlayerUserIds), PlayerUserIds);
+            FromJsonUtilE(FromJsonField(input, keyRegion), pfRegion);
+            FromJsonUtilP(FromJsonField(input, keyRunTime), RunTime);
+            FromJsonUtilS(FromJsonField(input, keyServerIPV4Address), ServerIPV4Address);
+            FromJsonUtilS(FromJsonField(input, keyServerIPV6Address), ServerIPV6Address);
+            FromJsonUtilP(FromJsonField(input, keyServerPort), ServerPort);
+            FromJsonUtilS(FromJsonField(input, keyServerPublicDNSName), ServerPublicDNSName);
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+            FromJsonUtilS(FromJsonField(input, keyTags), Tags);
+        }
+
+        Json::Value GameInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BuildVersion; ToJsonUtilS(BuildVersion, each_BuildVersion); ToJsonField(output, keyBuildVersion) = each_BuildVersion;
+            Json::Value each_GameMode; ToJsonUtilS(GameMode, each_GameMode); ToJsonField(output, keyGameMode) = each_GameMode;
+            Json::Value each_GameServerData; ToJsonUtilS(GameServerData, each_GameServerData); ToJsonField(output, keyGameServerData) = each_GameServerData;
+            Json::Value each_GameServerStateEnum; ToJsonUtilE(GameServerStateEnum, each_GameServerStateEnum); ToJsonField(output, keyGameServerStateEnum) = each_GameServerStateEnum;
+            Json::Value each_LastHeartbeat; ToJsonUtilT(LastHeartbeat, each_LastHeartbeat); ToJsonField(output, keyLastHeartbeat) = each_LastHeartbeat;
+            Json::Value each_LobbyID; ToJsonUtilS(LobbyID, each_LobbyID); ToJsonField(output, keyLobbyID) = each_LobbyID;
+            Json::Value each_MaxPlayers; ToJsonUtilP(MaxPlayers, each_MaxPlayers); ToJsonField(output, keyMaxPlayers) = each_MaxPlayers;
+            Json::Value each_PlayerUserIds; ToJsonUtilS(PlayerUserIds, each_PlayerUserIds); ToJsonField(output, keyPlayerUserIds) = each_PlayerUserIds;
+            Json::Value each_pfRegion; ToJsonUtilE(pfRegion, each_pfRegion); ToJsonField(output, keyRegion) = each_pfRegion;
+            Json::Value each_RunTime; ToJsonUtilP(RunTime, each_RunTime); ToJsonField(output, keyRunTime) = each_RunTime;
+            Json::Value each_ServerIPV4Address; ToJsonUtilS(ServerIPV4Address, each_ServerIPV4Address); ToJsonField(output, keyServerIPV4Address) = each_ServerIPV4Address;
+            Json::Value each_ServerIPV6Address; ToJsonUtilS(ServerIPV6Address, each_ServerIPV6Address); ToJsonField(output, keyServerIPV6Address) = each_ServerIPV6Address;
+            Json::Value each_ServerPort; ToJsonUtilP(ServerPort, each_ServerPort); ToJsonField(output, keyServerPort) = each_ServerPort;
+            Json::Value each_ServerPublicDNSName; ToJsonUtilS(ServerPublicDNSName, each_ServerPublicDNSName); ToJsonField(output, keyServerPublicDNSName) = each_ServerPublicDNSName;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            Json::Value each_Tags; ToJsonUtilS(Tags, each_Tags); ToJsonField(output, keyTags) = each_Tags;
+            return output;
+        }
+
+        void CurrentGamesResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyGameCount), GameCount);
+            FromJsonUtilO(FromJsonField(input, keyGames), Games);
+            FromJsonUtilP(FromJsonField(input, keyPlayerCount), PlayerCount);
+        }
+
+        Json::Value CurrentGamesResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GameCount; ToJsonUtilP(GameCount, each_GameCount); ToJsonField(output, keyGameCount) = each_GameCount;
+            Json::Value each_Games; ToJsonUtilO(Games, each_Games); ToJsonField(output, keyGames) = each_Games;
+            Json::Value each_PlayerCount; ToJsonUtilP(PlayerCount, each_PlayerCount); ToJsonField(output, keyPlayerCount) = each_PlayerCount;
+            return output;
+        }
+
+        void DeviceInfoRequest::FromJson(const Json::Value& input)
+        {
+            Info = FromJsonField(input, keyInfo);
+        }
+
+        Json::Value DeviceInfoRequest::ToJson() const
+        {
+            Json::Value output;
+            ToJsonField(output, keyInfo) = Info;
+            return output;
+        }
+
+        void EmptyResponse::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value EmptyResponse::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void EmptyResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value EmptyResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void EntityKey::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyId), Id);
+            FromJsonUtilS(FromJsonField(input, keyType), Type);
+        }
+
+        Json::Value EntityKey::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Id; ToJsonUtilS(Id, each_Id); ToJsonField(output, keyId) = each_Id;
+            Json::Value each_Type; ToJsonUtilS(Type, each_Type); ToJsonField(output, keyType) = each_Type;
+            return output;
+        }
+
+        void EntityTokenResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilS(FromJsonField(input, keyEntityToken), EntityToken);
+            FromJsonUtilT(FromJsonField(input, keyTokenExpiration), TokenExpiration);
+        }
+
+        Json::Value EntityTokenResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_EntityToken; ToJsonUtilS(EntityToken, each_EntityToken); ToJsonField(output, keyEntityToken) = each_EntityToken;
+            Json::Value each_TokenExpiration; ToJsonUtilT(TokenExpiration, each_TokenExpiration); ToJsonField(output, keyTokenExpiration) = each_TokenExpiration;
+            return output;
+        }
+
+        void ExecuteCloudScriptRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyFunctionName), FunctionName);
+            FunctionParameter = FromJsonField(input, keyFunctionParameter);
+            FromJsonUtilP(FromJsonField(input, keyGeneratePlayStreamEvent), GeneratePlayStreamEvent);
+            FromJsonUtilE(FromJsonField(input, keyRevisionSelection), RevisionSelection);
+            FromJsonUtilP(FromJsonField(input, keySpecificRevision), SpecificRevision);
+        }
+
+        Json::Value ExecuteCloudScriptRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_FunctionName; ToJsonUtilS(FunctionName, each_FunctionName); ToJsonField(output, keyFunctionName) = each_FunctionName;
+            ToJsonField(output, keyFunctionParameter) = FunctionParameter;
+            Json::Value each_GeneratePlayStreamEvent; ToJsonUtilP(GeneratePlayStreamEvent, each_GeneratePlayStreamEvent); ToJsonField(output, keyGeneratePlayStreamEvent) = each_GeneratePlayStreamEvent;
+            Json::Value each_RevisionSelection; ToJsonUtilE(RevisionSelection, each_RevisionSelection); ToJsonField(output, keyRevisionSelection) = each_RevisionSelection;
+            Json::Value each_SpecificRevision; ToJsonUtilP(SpecificRevision, each_SpecificRevision); ToJsonField(output, keySpecificRevision) = each_SpecificRevision;
+            return output;
+        }
+
+        void ScriptExecutionError::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyError), Error);
+            FromJsonUtilS(FromJsonField(input, keyMessage), Message);
+            FromJsonUtilS(FromJsonField(input, keyStackTrace), StackTrace);
+        }
+
+        Json::Value ScriptExecutionError::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Error; ToJsonUtilS(Error, each_Error); ToJsonField(output, keyError) = each_Error;
+            Json::Value each_Message; ToJsonUtilS(Message, each_Message); ToJsonField(output, keyMessage) = each_Message;
+            Json::Value each_StackTrace; ToJsonUtilS(StackTrace, each_StackTrace); ToJsonField(output, keyStackTrace) = each_StackTrace;
+            return output;
+        }
+
+        void LogStatement::FromJson(const Json::Value& input)
+        {
+            Data = FromJsonField(input, keyData);
+            FromJsonUtilS(FromJsonField(input, keyLevel), Level);
+            FromJsonUtilS(FromJsonField(input, keyMessage), Message);
+        }
+
+        Json::Value LogStatement::ToJson() const
+        {
+            Json::Value output;
+            ToJsonField(output, keyData) = Data;
+            Json::Value each_Level; ToJsonUtilS(Level, each_Level); ToJsonField(output, keyLevel) = each_Level;
+            Json::Value each_Message; ToJsonUtilS(Message, each_Message); ToJsonField(output, keyMessage) = each_Message;
+            return output;
+        }
+
+        void ExecuteCloudScriptResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyAPIRequestsIssued), APIRequestsIssued);
+            FromJsonUtilO(FromJsonField(input, keyError), Error);
+            FromJsonUtilP(FromJsonField(input, keyExecutionTimeSeconds), ExecutionTimeSeconds);
+            FromJsonUtilS(FromJsonField(input, keyFunctionName), FunctionName);
+            FunctionResult = FromJsonField(input, keyFunctionResult);
+            FromJsonUtilP(FromJsonField(input, keyFunctionResultTooLarge), FunctionResultTooLarge);
+            FromJsonUtilP(FromJsonField(input, keyHttpRequestsIssued), HttpRequestsIssued);
+            FromJsonUtilO(FromJsonField(input, keyLogs), Logs);
+            FromJsonUtilP(FromJsonField(input, keyLogsTooLarge), LogsTooLarge);
+            FromJsonUtilP(FromJsonField(input, keyMemoryConsumedBytes), MemoryConsumedBytes);
+            FromJsonUtilP(FromJsonField(input, keyProcessorTimeSeconds), ProcessorTimeSeconds);
+            FromJsonUtilP(FromJsonField(input, keyRevision), Revision);
+        }
+
+        Json::Value ExecuteCloudScriptResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_APIRequestsIssued; ToJsonUtilP(APIRequestsIssued, each_APIRequestsIssued); ToJsonField(output, keyAPIRequestsIssued) = each_APIRequestsIssued;
+            Json::Value each_Error; ToJsonUtilO(Error, each_Error); ToJsonField(output, keyError) = each_Error;
+            Json::Value each_ExecutionTimeSeconds; ToJsonUtilP(ExecutionTimeSeconds, each_ExecutionTimeSeconds); ToJsonField(output, keyExecutionTimeSeconds) = each_ExecutionTimeSeconds;
+            Json::Value each_FunctionName; ToJsonUtilS(FunctionName, each_FunctionName); ToJsonField(output, keyFunctionName) = each_FunctionName;
+            ToJsonField(output, keyFunctionResult) = FunctionResult;
+            Json::Value each_FunctionResultTooLarge; ToJsonUtilP(FunctionResultTooLarge, each_FunctionResultTooLarge); ToJsonField(output, keyFunctionResultTooLarge) = each_FunctionResultTooLarge;
+            Json::Value each_HttpRequestsIssued; ToJsonUtilP(HttpRequestsIssued, each_HttpRequestsIssued); ToJsonField(output, keyHttpRequestsIssued) = each_HttpRequestsIssued;
+            Json::Value each_Logs; ToJsonUtilO(Logs, each_Logs); ToJsonField(output, keyLogs) = each_Logs;
+            Json::Value each_LogsTooLarge; ToJsonUtilP(LogsTooLarge, each_LogsTooLarge); ToJsonField(output, keyLogsTooLarge) = each_LogsTooLarge;
+            Json::Value each_MemoryConsumedBytes; ToJsonUtilP(MemoryConsumedBytes, each_MemoryConsumedBytes); ToJsonField(output, keyMemoryConsumedBytes) = each_MemoryConsumedBytes;
+            Json::Value each_ProcessorTimeSeconds; ToJsonUtilP(ProcessorTimeSeconds, each_ProcessorTimeSeconds); ToJsonField(output, keyProcessorTimeSeconds) = each_ProcessorTimeSeconds;
+            Json::Value each_Revision; ToJsonUtilP(Revision, each_Revision); ToJsonField(output, keyRevision) = each_Revision;
+            return output;
+        }
+
+        void FacebookInstantGamesPlayFabIdPair::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyFacebookInstantGamesId), FacebookInstantGamesId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value FacebookInstantGamesPlayFabIdPair::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_FacebookInstantGamesId; ToJsonUtilS(FacebookInstantGamesId, each_FacebookInstantGamesId); ToJsonField(output, keyFacebookInstantGamesId) = each_FacebookInstantGamesId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void FacebookPlayFabIdPair::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyFacebookId), FacebookId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value FacebookPlayFabIdPair::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_FacebookId; ToJsonUtilS(FacebookId, each_FacebookId); ToJsonField(output, keyFacebookId) = each_FacebookId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void UserFacebookInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyFacebookId), FacebookId);
+            FromJsonUtilS(FromJsonField(input, keyFullName), FullName);
+        }
+
+        Json::Value UserFacebookInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_FacebookId; ToJsonUtilS(FacebookId, each_FacebookId); ToJsonField(output, keyFacebookId) = each_FacebookId;
+            Json::Value each_FullName; ToJsonUtilS(FullName, each_FullName); ToJsonField(output, keyFullName) = each_FullName;
+            return output;
+        }
+
+        void UserGameCenterInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyGameCenterId), GameCenterId);
+        }
+
+        Json::Value UserGameCenterInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GameCenterId; ToJsonUtilS(GameCenterId, each_GameCenterId); ToJsonField(output, keyGameCenterId) = each_GameCenterId;
+            return output;
+        }
+
+        void LinkedPlatformAccountModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyEmail), Email);
+            FromJsonUtilE(FromJsonField(input, keyPlatform), Platform);
+            FromJsonUtilS(FromJsonField(input, keyPlatformUserId), PlatformUserId);
+            FromJsonUtilS(FromJsonField(input, keyUsername), Username);
+        }
+
+        Json::Value LinkedPlatformAccountModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Email; ToJsonUtilS(Email, each_Email); ToJsonField(output, keyEmail) = each_Email;
+            Json::Value each_Platform; ToJsonUtilE(Platform, each_Platform); ToJsonField(output, keyPlatform) = each_Platform;
+            Json::Value each_PlatformUserId; ToJsonUtilS(PlatformUserId, each_PlatformUserId); ToJsonField(output, keyPlatformUserId) = each_PlatformUserId;
+            Json::Value each_Username; ToJsonUtilS(Username, each_Username); ToJsonField(output, keyUsername) = each_Username;
+            return output;
+        }
+
+        void LocationModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCity), City);
+            FromJsonUtilE(FromJsonField(input, keyContinentCode), pfContinentCode);
+            FromJsonUtilE(FromJsonField(input, keyCountryCode), pfCountryCode);
+            FromJsonUtilP(FromJsonField(input, keyLatitude), Latitude);
+            FromJsonUtilP(FromJsonField(input, keyLongitude), Longitude);
+        }
+
+        Json::Value LocationModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_City; ToJsonUtilS(City, each_City); ToJsonField(output, keyCity) = each_City;
+            Json::Value each_pfContinentCode; ToJsonUtilE(pfContinentCode, each_pfContinentCode); ToJsonField(output, keyContinentCode) = each_pfContinentCode;
+            Json::Value each_pfCountryCode; ToJsonUtilE(pfCountryCode, each_pfCountryCode); ToJsonField(output, keyCountryCode) = each_pfCountryCode;
+            Json::Value each_Latitude; ToJsonUtilP(Latitude, each_Latitude); ToJsonField(output, keyLatitude) = each_Latitude;
+            Json::Value each_Longitude; ToJsonUtilP(Longitude, each_Longitude); ToJsonField(output, keyLongitude) = each_Longitude;
+            return output;
+        }
+
+        void SubscriptionModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilT(FromJsonField(input, keyExpiration), Expiration);
+            FromJsonUtilT(FromJsonField(input, keyInitialSubscriptionTime), InitialSubscriptionTime);
+            FromJsonUtilP(FromJsonField(input, keyIsActive), IsActive);
+            FromJsonUtilE(FromJsonField(input, keyStatus), Status);
+            FromJsonUtilS(FromJsonField(input, keySubscriptionId), SubscriptionId);
+            FromJsonUtilS(FromJsonField(input, keySubscriptionItemId), SubscriptionItemId);
+            FromJsonUtilS(FromJsonField(input, keySubscriptionProvider), SubscriptionProvider);
+        }
+
+        Json::Value SubscriptionModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Expiration; ToJsonUtilT(Expiration, each_Expiration); ToJsonField(output, keyExpiration) = each_Expiration;
+            Json::Value each_InitialSubscriptionTime; ToJsonUtilT(InitialSubscriptionTime, each_InitialSubscriptionTime); ToJsonField(output, keyInitialSubscriptionTime) = each_InitialSubscriptionTime;
+            Json::Value each_IsActive; ToJsonUtilP(IsActive, each_IsActive); ToJsonField(output, keyIsActive) = each_IsActive;
+            Json::Value each_Status; ToJsonUtilE(Status, each_Status); ToJsonField(output, keyStatus) = each_Status;
+            Json::Value each_SubscriptionId; ToJsonUtilS(SubscriptionId, each_SubscriptionId); ToJsonField(output, keySubscriptionId) = each_SubscriptionId;
+            Json::Value each_SubscriptionItemId; ToJsonUtilS(SubscriptionItemId, each_SubscriptionItemId); ToJsonField(output, keySubscriptionItemId) = each_SubscriptionItemId;
+            Json::Value each_SubscriptionProvider; ToJsonUtilS(SubscriptionProvider, each_SubscriptionProvider); ToJsonField(output, keySubscriptionProvider) = each_SubscriptionProvider;
+            return output;
+        }
+
+        void MembershipModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyIsActive), IsActive);
+            FromJsonUtilT(FromJsonField(input, keyMembershipExpiration), MembershipExpiration);
+            FromJsonUtilS(FromJsonField(input, keyMembershipId), MembershipId);
+            FromJsonUtilT(FromJsonField(input, keyOverrideExpiration), OverrideExpiration);
+            FromJsonUtilO(FromJsonField(input, keySubscriptions), Subscriptions);
+        }
+
+        Json::Value MembershipModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_IsActive; ToJsonUtilP(IsActive, each_IsActive); ToJsonField(output, keyIsActive) = each_IsActive;
+            Json::Value each_MembershipExpiration; ToJsonUtilT(MembershipExpiration, each_MembershipExpiration); ToJsonField(output, keyMembershipExpiration) = each_MembershipExpiration;
+            Json::Value each_MembershipId; ToJsonUtilS(MembershipId, each_MembershipId); ToJsonField(output, keyMembershipId) = each_MembershipId;
+            Json::Value each_OverrideExpiration; ToJsonUtilT(OverrideExpiration, each_OverrideExpiration); ToJsonField(output, keyOverrideExpiration) = each_OverrideExpiration;
+            Json::Value each_Subscriptions; ToJsonUtilO(Subscriptions, each_Subscriptions); ToJsonField(output, keySubscriptions) = each_Subscriptions;
+            return output;
+        }
+
+        void PushNotificationRegistrationModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyNotificationEndpointARN), NotificationEndpointARN);
+            FromJsonUtilE(FromJsonField(input, keyPlatform), Platform);
+        }
+
+        Json::Value PushNotificationRegistrationModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_NotificationEndpointARN; ToJsonUtilS(NotificationEndpointARN, each_NotificationEndpointARN); ToJsonField(output, keyNotificationEndpointARN) = each_NotificationEndpointARN;
+            Json::Value each_Platform; ToJsonUtilE(Platform, each_Platform); ToJsonField(output, keyPlatform) = each_Platform;
+            return output;
+        }
+
+        void StatisticModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilP(FromJsonField(input, keyValue), Value);
+            FromJsonUtilP(FromJsonField(input, keyVersion), Version);
+        }
+
+        Json::Value StatisticModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_Value; ToJsonUtilP(Value, each_Value); ToJsonField(output, keyValue) = each_Value;
+            Json::Value each_Version; ToJsonUtilP(Version, each_Version); ToJsonField(output, keyVersion) = each_Version;
+            return output;
+        }
+
+        void TagModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyTagValue), TagValue);
+        }
+
+        Json::Value TagModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_TagValue; ToJsonUtilS(TagValue, each_TagValue); ToJsonField(output, keyTagValue) = each_TagValue;
+            return output;
+        }
+
+        void ValueToDateModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCurrency), Currency);
+            FromJsonUtilP(FromJsonField(input, keyTotalValue), TotalValue);
+            FromJsonUtilS(FromJsonField(input, keyTotalValueAsDecimal), TotalValueAsDecimal);
+        }
+
+        Json::Value ValueToDateModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Currency; ToJsonUtilS(Currency, each_Currency); ToJsonField(output, keyCurrency) = each_Currency;
+            Json::Value each_TotalValue; ToJsonUtilP(TotalValue, each_TotalValue); ToJsonField(output, keyTotalValue) = each_TotalValue;
+            Json::Value each_TotalValueAsDecimal; ToJsonUtilS(TotalValueAsDecimal, each_TotalValueAsDecimal); ToJsonField(output, keyTotalValueAsDecimal) = each_TotalValueAsDecimal;
+            return output;
+        }
+
+        void PlayerProfileModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyAdCampaignAttributions), AdCampaignAttributions);
+            FromJsonUtilS(FromJsonField(input, keyAvatarUrl), AvatarUrl);
+            FromJsonUtilT(FromJsonField(input, keyBannedUntil), BannedUntil);
+            FromJsonUtilO(FromJsonField(input, keyContactEmailAddresses), ContactEmailAddresses);
+            FromJsonUtilT(FromJsonField(input, keyCreated), Created);
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+            FromJsonUtilS(FromJsonField(input, keyExperimentVariants), ExperimentVariants);
+            FromJsonUtilT(FromJsonField(input, keyLastLogin), LastLogin);
+            FromJsonUtilO(FromJsonField(input, keyLinkedAccounts), LinkedAccounts);
+            FromJsonUtilO(FromJsonField(input, keyLocations), Locations);
+            FromJsonUtilO(FromJsonField(input, keyMemberships), Memberships);
+            FromJsonUtilE(FromJsonField(input, keyOrigination), Origination);
+            FromJsonUtilS(FromJsonField(input, keyPlayerId), PlayerId);
+            FromJsonUtilS(FromJsonField(input, keyPublisherId), PublisherId);
+            FromJsonUtilO(FromJsonField(input, keyPushNotificationRegistrations), PushNotificationRegistrations);
+            FromJsonUtilO(FromJsonField(input, keyStatistics), Statistics);
+            FromJsonUtilO(FromJsonField(input, keyTags), Tags);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+            FromJsonUtilP(FromJsonField(input, keyTotalValueToDateInUSD), TotalValueToDateInUSD);
+            FromJsonUtilO(FromJsonField(input, keyValuesToDate), ValuesToDate);
+        }
+
+        Json::Value PlayerProfileModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AdCampaignAttributions; ToJsonUtilO(AdCampaignAttributions, each_AdCampaignAttributions); ToJsonField(output, keyAdCampaignAttributions) = each_AdCampaignAttributions;
+            Json::Value each_AvatarUrl; ToJsonUtilS(AvatarUrl, each_AvatarUrl); ToJsonField(output, keyAvatarUrl) = each_AvatarUrl;
+            Json::Value each_BannedUntil; ToJsonUtilT(BannedUntil, each_BannedUntil); ToJsonField(output, keyBannedUntil) = each_BannedUntil;
+            Json::Value each_ContactEmailAddresses; ToJsonUtilO(ContactEmailAddresses, each_ContactEmailAddresses); ToJsonField(output, keyContactEmailAddresses) = each_ContactEmailAddresses;
+            Json::Value each_Created; ToJsonUtilT(Created, each_Created); ToJsonField(output, keyCreated) = each_Created;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            Json::Value each_ExperimentVariants; ToJsonUtilS(ExperimentVariants, each_ExperimentVariants); ToJsonField(output, keyExperimentVariants) = each_ExperimentVariants;
+            Json::Value each_LastLogin; ToJsonUtilT(LastLogin, each_LastLogin); ToJsonField(output, keyLastLogin) = each_LastLogin;
+            Json::Value each_LinkedAccounts; ToJsonUtilO(LinkedAccounts, each_LinkedAccounts); ToJsonField(output, keyLinkedAccounts) = each_LinkedAccounts;
+            Json::Value each_Locations; ToJsonUtilO(Locations, each_Locations); ToJsonField(output, keyLocations) = each_Locations;
+            Json::Value each_Memberships; ToJsonUtilO(Memberships, each_Memberships); ToJsonField(output, keyMemberships) = each_Memberships;
+            Json::Value each_Origination; ToJsonUtilE(Origination, each_Origination); ToJsonField(output, keyOrigination) = each_Origination;
+            Json::Value each_PlayerId; ToJsonUtilS(PlayerId, each_PlayerId); ToJsonField(output, keyPlayerId) = each_PlayerId;
+            Json::Value each_PublisherId; ToJsonUtilS(PublisherId, each_PublisherId); ToJsonField(output, keyPublisherId) = each_PublisherId;
+            Json::Value each_PushNotificationRegistrations; ToJsonUtilO(PushNotificationRegistrations, each_PushNotificationRegistrations); ToJsonField(output, keyPushNotificationRegistrations) = each_PushNotificationRegistrations;
+            Json::Value each_Statistics; ToJsonUtilO(Statistics, each_Statistics); ToJsonField(output, keyStatistics) = each_Statistics;
+            Json::Value each_Tags; ToJsonUtilO(Tags, each_Tags); ToJsonField(output, keyTags) = each_Tags;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            Json::Value each_TotalValueToDateInUSD; ToJsonUtilP(TotalValueToDateInUSD, each_TotalValueToDateInUSD); ToJsonField(output, keyTotalValueToDateInUSD) = each_TotalValueToDateInUSD;
+            Json::Value each_ValuesToDate; ToJsonUtilO(ValuesToDate, each_ValuesToDate); ToJsonField(output, keyValuesToDate) = each_ValuesToDate;
+            return output;
+        }
+
+        void UserPsnInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPsnAccountId), PsnAccountId);
+            FromJsonUtilS(FromJsonField(input, keyPsnOnlineId), PsnOnlineId);
+        }
+
+        Json::Value UserPsnInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PsnAccountId; ToJsonUtilS(PsnAccountId, each_PsnAccountId); ToJsonField(output, keyPsnAccountId) = each_PsnAccountId;
+            Json::Value each_PsnOnlineId; ToJsonUtilS(PsnOnlineId, each_PsnOnlineId); ToJsonField(output, keyPsnOnlineId) = each_PsnOnlineId;
+            return output;
+        }
+
+        void UserSteamInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilE(FromJsonField(input, keySteamActivationStatus), SteamActivationStatus);
+            FromJsonUtilS(FromJsonField(input, keySteamCountry), SteamCountry);
+            FromJsonUtilE(FromJsonField(input, keySteamCurrency), SteamCurrency);
+            FromJsonUtilS(FromJsonField(input, keySteamId), SteamId);
+            FromJsonUtilS(FromJsonField(input, keySteamName), SteamName);
+        }
+
+        Json::Value UserSteamInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_SteamActivationStatus; ToJsonUtilE(SteamActivationStatus, each_SteamActivationStatus); ToJsonField(output, keySteamActivationStatus) = each_SteamActivationStatus;
+            Json::Value each_SteamCountry; ToJsonUtilS(SteamCountry, each_SteamCountry); ToJsonField(output, keySteamCountry) = each_SteamCountry;
+            Json::Value each_SteamCurrency; ToJsonUtilE(SteamCurrency, each_SteamCurrency); ToJsonField(output, keySteamCurrency) = each_SteamCurrency;
+            Json::Value each_SteamId; ToJsonUtilS(SteamId, each_SteamId); ToJsonField(output, keySteamId) = each_SteamId;
+            Json::Value each_SteamName; ToJsonUtilS(SteamName, each_SteamName); ToJsonField(output, keySteamName) = each_SteamName;
+            return output;
+        }
+
+        void UserXboxInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyXboxUserId), XboxUserId);
+        }
+
+        Json::Value UserXboxInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_XboxUserId; ToJsonUtilS(XboxUserId, each_XboxUserId); ToJsonField(output, keyXboxUserId) = each_XboxUserId;
+            return output;
+        }
+
+        void FriendInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyFacebookInfo), FacebookInfo);
+            FromJsonUtilS(FromJsonField(input, keyFriendPlayFabId), FriendPlayFabId);
+            FromJsonUtilO(FromJsonField(input, keyGameCenterInfo), GameCenterInfo);
+            FromJsonUtilO(FromJsonField(input, keyProfile), Profile);
+            FromJsonUtilO(FromJsonField(input, keyPSNInfo), PSNInfo);
+            FromJsonUtilO(FromJsonField(input, keySteamInfo), SteamInfo);
+            FromJsonUtilS(FromJsonField(input, keyTags), Tags);
+            FromJsonUtilS(FromJsonField(input, keyTitleDisplayName), TitleDisplayName);
+            FromJsonUtilS(FromJsonField(input, keyUsername), Username);
+            FromJsonUtilO(FromJsonField(input, keyXboxInfo), XboxInfo);
+        }
+
+        Json::Value FriendInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_FacebookInfo; ToJsonUtilO(FacebookInfo, each_FacebookInfo); ToJsonField(output, keyFacebookInfo) = each_FacebookInfo;
+            Json::Value each_FriendPlayFabId; ToJsonUtilS(FriendPlayFabId, each_FriendPlayFabId); ToJsonField(output, keyFriendPlayFabId) = each_FriendPlayFabId;
+            Json::Value each_GameCenterInfo; ToJsonUtilO(GameCenterInfo, each_GameCenterInfo); ToJsonField(output, keyGameCenterInfo) = each_GameCenterInfo;
+            Json::Value each_Profile; ToJsonUtilO(Profile, each_Profile); ToJsonField(output, keyProfile) = each_Profile;
+            Json::Value each_PSNInfo; ToJsonUtilO(PSNInfo, each_PSNInfo); ToJsonField(output, keyPSNInfo) = each_PSNInfo;
+            Json::Value each_SteamInfo; ToJsonUtilO(SteamInfo, each_SteamInfo); ToJsonField(output, keySteamInfo) = each_SteamInfo;
+            Json::Value each_Tags; ToJsonUtilS(Tags, each_Tags); ToJsonField(output, keyTags) = each_Tags;
+            Json::Value each_TitleDisplayName; ToJsonUtilS(TitleDisplayName, each_TitleDisplayName); ToJsonField(output, keyTitleDisplayName) = each_TitleDisplayName;
+            Json::Value each_Username; ToJsonUtilS(Username, each_Username); ToJsonField(output, keyUsername) = each_Username;
+            Json::Value each_XboxInfo; ToJsonUtilO(XboxInfo, each_XboxInfo); ToJsonField(output, keyXboxInfo) = each_XboxInfo;
+            return output;
+        }
+
+        void GameCenterPlayFabIdPair::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyGameCenterId), GameCenterId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GameCenterPlayFabIdPair::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GameCenterId; ToJsonUtilS(GameCenterId, each_GameCenterId); ToJsonField(output, keyGameCenterId) = each_GameCenterId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void GameServerRegionsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBuildVersion), BuildVersion);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+        }
+
+        Json::Value GameServerRegionsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BuildVersion; ToJsonUtilS(BuildVersion, each_BuildVersion); ToJsonField(output, keyBuildVersion) = each_BuildVersion;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            return output;
+        }
+
+        void RegionInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyAvailable), Available);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilS(FromJsonField(input, keyPingUrl), PingUrl);
+            FromJsonUtilE(FromJsonField(input, keyRegion), pfRegion);
+        }
+
+        Json::Value RegionInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Available; ToJsonUtilP(Available, each_Available); ToJsonField(output, keyAvailable) = each_Available;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_PingUrl; ToJsonUtilS(PingUrl, each_PingUrl); ToJsonField(output, keyPingUrl) = each_PingUrl;
+            Json::Value each_pfRegion; ToJsonUtilE(pfRegion, each_pfRegion); ToJsonField(output, keyRegion) = each_pfRegion;
+            return output;
+        }
+
+        void GameServerRegionsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyRegions), Regions);
+        }
+
+        Json::Value GameServerRegionsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Regions; ToJsonUtilO(Regions, each_Regions); ToJsonField(output, keyRegions) = each_Regions;
+            return output;
+        }
+
+        void GenericPlayFabIdPair::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyGenericId), GenericId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GenericPlayFabIdPair::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GenericId; ToJsonUtilO(GenericId, each_GenericId); ToJsonField(output, keyGenericId) = each_GenericId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void GetAccountInfoRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyEmail), Email);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyTitleDisplayName), TitleDisplayName);
+            FromJsonUtilS(FromJsonField(input, keyUsername), Username);
+        }
+
+        Json::Value GetAccountInfoRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Email; ToJsonUtilS(Email, each_Email); ToJsonField(output, keyEmail) = each_Email;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_TitleDisplayName; ToJsonUtilS(TitleDisplayName, each_TitleDisplayName); ToJsonField(output, keyTitleDisplayName) = each_TitleDisplayName;
+            Json::Value each_Username; ToJsonUtilS(Username, each_Username); ToJsonField(output, keyUsername) = each_Username;
+            return output;
+        }
+
+        void UserAndroidDeviceInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAndroidDeviceId), AndroidDeviceId);
+        }
+
+        Json::Value UserAndroidDeviceInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AndroidDeviceId; ToJsonUtilS(AndroidDeviceId, each_AndroidDeviceId); ToJsonField(output, keyAndroidDeviceId) = each_AndroidDeviceId;
+            return output;
+        }
+
+        void UserAppleIdInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAppleSubjectId), AppleSubjectId);
+        }
+
+        Json::Value UserAppleIdInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AppleSubjectId; ToJsonUtilS(AppleSubjectId, each_AppleSubjectId); ToJsonField(output, keyAppleSubjectId) = each_AppleSubjectId;
+            return output;
+        }
+
+        void UserCustomIdInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomId), CustomId);
+        }
+
+        Json::Value UserCustomIdInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomId; ToJsonUtilS(CustomId, each_CustomId); ToJsonField(output, keyCustomId) = each_CustomId;
+            return output;
+        }
+
+        void UserFacebookInstantGamesIdInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyFacebookInstantGamesId), FacebookInstantGamesId);
+        }
+
+        Json::Value UserFacebookInstantGamesIdInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_FacebookInstantGamesId; ToJsonUtilS(FacebookInstantGamesId, each_FacebookInstantGamesId); ToJsonField(output, keyFacebookInstantGamesId) = each_FacebookInstantGamesId;
+            return output;
+        }
+
+        void UserGoogleInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyGoogleEmail), GoogleEmail);
+            FromJsonUtilS(FromJsonField(input, keyGoogleGender), GoogleGender);
+            FromJsonUtilS(FromJsonField(input, keyGoogleId), GoogleId);
+            FromJsonUtilS(FromJsonField(input, keyGoogleLocale), GoogleLocale);
+            FromJsonUtilS(FromJsonField(input, keyGoogleName), GoogleName);
+        }
+
+        Json::Value UserGoogleInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GoogleEmail; ToJsonUtilS(GoogleEmail, each_GoogleEmail); ToJsonField(output, keyGoogleEmail) = each_GoogleEmail;
+            Json::Value each_GoogleGender; ToJsonUtilS(GoogleGender, each_GoogleGender); ToJsonField(output, keyGoogleGender) = each_GoogleGender;
+            Json::Value each_GoogleId; ToJsonUtilS(GoogleId, each_GoogleId); ToJsonField(output, keyGoogleId) = each_GoogleId;
+            Json::Value each_GoogleLocale; ToJsonUtilS(GoogleLocale, each_GoogleLocale); ToJsonField(output, keyGoogleLocale) = each_GoogleLocale;
+            Json::Value each_GoogleName; ToJsonUtilS(GoogleName, each_GoogleName); ToJsonField(output, keyGoogleName) = each_GoogleName;
+            return output;
+        }
+
+        void UserIosDeviceInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyIosDeviceId), IosDeviceId);
+        }
+
+        Json::Value UserIosDeviceInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_IosDeviceId; ToJsonUtilS(IosDeviceId, each_IosDeviceId); ToJsonField(output, keyIosDeviceId) = each_IosDeviceId;
+            return output;
+        }
+
+        void UserKongregateInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyKongregateId), KongregateId);
+            FromJsonUtilS(FromJsonField(input, keyKongregateName), KongregateName);
+        }
+
+        Json::Value UserKongregateInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_KongregateId; ToJsonUtilS(KongregateId, each_KongregateId); ToJsonField(output, keyKongregateId) = each_KongregateId;
+            Json::Value each_KongregateName; ToJsonUtilS(KongregateName, each_KongregateName); ToJsonField(output, keyKongregateName) = each_KongregateName;
+            return output;
+        }
+
+        void UserNintendoSwitchAccountIdInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyNintendoSwitchAccountSubjectId), NintendoSwitchAccountSubjectId);
+        }
+
+        Json::Value UserNintendoSwitchAccountIdInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_NintendoSwitchAccountSubjectId; ToJsonUtilS(NintendoSwitchAccountSubjectId, each_NintendoSwitchAccountSubjectId); ToJsonField(output, keyNintendoSwitchAccountSubjectId) = each_NintendoSwitchAccountSubjectId;
+            return output;
+        }
+
+        void UserNintendoSwitchDeviceIdInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyNintendoSwitchDeviceId), NintendoSwitchDeviceId);
+        }
+
+        Json::Value UserNintendoSwitchDeviceIdInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_NintendoSwitchDeviceId; ToJsonUtilS(NintendoSwitchDeviceId, each_NintendoSwitchDeviceId); ToJsonField(output, keyNintendoSwitchDeviceId) = each_NintendoSwitchDeviceId;
+            return output;
+        }
+
+        void UserOpenIdInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyConnectionId), ConnectionId);
+            FromJsonUtilS(FromJsonField(input, keyIssuer), Issuer);
+            FromJsonUtilS(FromJsonField(input, keySubject), Subject);
+        }
+
+        Json::Value UserOpenIdInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ConnectionId; ToJsonUtilS(ConnectionId, each_ConnectionId); ToJsonField(output, keyConnectionId) = each_ConnectionId;
+            Json::Value each_Issuer; ToJsonUtilS(Issuer, each_Issuer); ToJsonField(output, keyIssuer) = each_Issuer;
+            Json::Value each_Subject; ToJsonUtilS(Subject, each_Subject); ToJsonField(output, keySubject) = each_Subject;
+            return output;
+        }
+
+        void UserPrivateAccountInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyEmail), Email);
+        }
+
+        Json::Value UserPrivateAccountInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Email; ToJsonUtilS(Email, each_Email); ToJsonField(output, keyEmail) = each_Email;
+            return output;
+        }
+
+        void UserTitleInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAvatarUrl), AvatarUrl);
+            FromJsonUtilT(FromJsonField(input, keyCreated), Created);
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+            FromJsonUtilT(FromJsonField(input, keyFirstLogin), FirstLogin);
+            FromJsonUtilP(FromJsonField(input, keyisBanned), isBanned);
+            FromJsonUtilT(FromJsonField(input, keyLastLogin), LastLogin);
+            FromJsonUtilE(FromJsonField(input, keyOrigination), Origination);
+            FromJsonUtilO(FromJsonField(input, keyTitlePlayerAccount), TitlePlayerAccount);
+        }
+
+        Json::Value UserTitleInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AvatarUrl; ToJsonUtilS(AvatarUrl, each_AvatarUrl); ToJsonField(output, keyAvatarUrl) = each_AvatarUrl;
+            Json::Value each_Created; ToJsonUtilT(Created, each_Created); ToJsonField(output, keyCreated) = each_Created;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            Json::Value each_FirstLogin; ToJsonUtilT(FirstLogin, each_FirstLogin); ToJsonField(output, keyFirstLogin) = each_FirstLogin;
+            Json::Value each_isBanned; ToJsonUtilP(isBanned, each_isBanned); ToJsonField(output, keyisBanned) = each_isBanned;
+            Json::Value each_LastLogin; ToJsonUtilT(LastLogin, each_LastLogin); ToJsonField(output, keyLastLogin) = each_LastLogin;
+            Json::Value each_Origination; ToJsonUtilE(Origination, each_Origination); ToJsonField(output, keyOrigination) = each_Origination;
+            Json::Value each_TitlePlayerAccount; ToJsonUtilO(TitlePlayerAccount, each_TitlePlayerAccount); ToJsonField(output, keyTitlePlayerAccount) = each_TitlePlayerAccount;
+            return output;
+        }
+
+        void UserTwitchInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyTwitchId), TwitchId);
+            FromJsonUtilS(FromJsonField(input, keyTwitchUserName), TwitchUserName);
+        }
+
+        Json::Value UserTwitchInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_TwitchId; ToJsonUtilS(TwitchId, each_TwitchId); ToJsonField(output, keyTwitchId) = each_TwitchId;
+            Json::Value each_TwitchUserName; ToJsonUtilS(TwitchUserName, each_TwitchUserName); ToJsonField(output, keyTwitchUserName) = each_TwitchUserName;
+            return output;
+        }
+
+        void UserWindowsHelloInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyWindowsHelloDeviceName), WindowsHelloDeviceName);
+            FromJsonUtilS(FromJsonField(input, keyWindowsHelloPublicKeyHash), WindowsHelloPublicKeyHash);
+        }
+
+        Json::Value UserWindowsHelloInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_WindowsHelloDeviceName; ToJsonUtilS(WindowsHelloDeviceName, each_WindowsHelloDeviceName); ToJsonField(output, keyWindowsHelloDeviceName) = each_WindowsHelloDeviceName;
+            Json::Value each_WindowsHelloPublicKeyHash; ToJsonUtilS(WindowsHelloPublicKeyHash, each_WindowsHelloPublicKeyHash); ToJsonField(output, keyWindowsHelloPublicKeyHash) = each_WindowsHelloPublicKeyHash;
+            return output;
+        }
+
+        void UserAccountInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyAndroidDeviceInfo), AndroidDeviceInfo);
+            FromJsonUtilO(FromJsonField(input, keyAppleAccountInfo), AppleAccountInfo);
+            FromJsonUtilT(FromJsonField(input, keyCreated), Created);
+            FromJsonUtilO(FromJsonField(input, keyCustomIdInfo), CustomIdInfo);
+            FromJsonUtilO(FromJsonField(input, keyFacebookInfo), FacebookInfo);
+            FromJsonUtilO(FromJsonField(input, keyFacebookInstantGamesIdInfo), FacebookInstantGamesIdInfo);
+            FromJsonUtilO(FromJsonField(input, keyGameCenterInfo), GameCenterInfo);
+            FromJsonUtilO(FromJsonField(input, keyGoogleInfo), GoogleInfo);
+            FromJsonUtilO(FromJsonField(input, keyIosDeviceInfo), IosDeviceInfo);
+            FromJsonUtilO(FromJsonField(input, keyKongregateInfo), KongregateInfo);
+            FromJsonUtilO(FromJsonField(input, keyNintendoSwitchAccountInfo), NintendoSwitchAccountInfo);
+            FromJsonUtilO(FromJsonField(input, keyNintendoSwitchDeviceIdInfo), NintendoSwitchDeviceIdInfo);
+            FromJsonUtilO(FromJsonField(input, keyOpenIdInfo), OpenIdInfo);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilO(FromJsonField(input, keyPrivateInfo), PrivateInfo);
+            FromJsonUtilO(FromJsonField(input, keyPsnInfo), PsnInfo);
+            FromJsonUtilO(FromJsonField(input, keySteamInfo), SteamInfo);
+            FromJsonUtilO(FromJsonField(input, keyTitleInfo), TitleInfo);
+            FromJsonUtilO(FromJsonField(input, keyTwitchInfo), TwitchInfo);
+            FromJsonUtilS(FromJsonField(input, keyUsername), Username);
+            FromJsonUtilO(FromJsonField(input, keyWindowsHelloInfo), WindowsHelloInfo);
+            FromJsonUtilO(FromJsonField(input, keyXboxInfo), XboxInfo);
+        }
+
+        Json::Value UserAccountInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AndroidDeviceInfo; ToJsonUtilO(AndroidDeviceInfo, each_AndroidDeviceInfo); ToJsonField(output, keyAndroidDeviceInfo) = each_AndroidDeviceInfo;
+            Json::Value each_AppleAccountInfo; ToJsonUtilO(AppleAccountInfo, each_AppleAccountInfo); ToJsonField(output, keyAppleAccountInfo) = each_AppleAccountInfo;
+            Json::Value each_Created; ToJsonUtilT(Created, each_Created); ToJsonField(output, keyCreated) = each_Created;
+            Json::Value each_CustomIdInfo; ToJsonUtilO(CustomIdInfo, each_CustomIdInfo); ToJsonField(output, keyCustomIdInfo) = each_CustomIdInfo;
+            Json::Value each_FacebookInfo; ToJsonUtilO(FacebookInfo, each_FacebookInfo); ToJsonField(output, keyFacebookInfo) = each_FacebookInfo;
+            Json::Value each_FacebookInstantGamesIdInfo; ToJsonUtilO(FacebookInstantGamesIdInfo, each_FacebookInstantGamesIdInfo); ToJsonField(output, keyFacebookInstantGamesIdInfo) = each_FacebookInstantGamesIdInfo;
+            Json::Value each_GameCenterInfo; ToJsonUtilO(GameCenterInfo, each_GameCenterInfo); ToJsonField(output, keyGameCenterInfo) = each_GameCenterInfo;
+            Json::Value each_GoogleInfo; ToJsonUtilO(GoogleInfo, each_GoogleInfo); ToJsonField(output, keyGoogleInfo) = each_GoogleInfo;
+            Json::Value each_IosDeviceInfo; ToJsonUtilO(IosDeviceInfo, each_IosDeviceInfo); ToJsonField(output, keyIosDeviceInfo) = each_IosDeviceInfo;
+            Json::Value each_KongregateInfo; ToJsonUtilO(KongregateInfo, each_KongregateInfo); ToJsonField(output, keyKongregateInfo) = each_KongregateInfo;
+            Json::Value each_NintendoSwitchAccountInfo; ToJsonUtilO(NintendoSwitchAccountInfo, each_NintendoSwitchAccountInfo); ToJsonField(output, keyNintendoSwitchAccountInfo) = each_NintendoSwitchAccountInfo;
+            Json::Value each_NintendoSwitchDeviceIdInfo; ToJsonUtilO(NintendoSwitchDeviceIdInfo, each_NintendoSwitchDeviceIdInfo); ToJsonField(output, keyNintendoSwitchDeviceIdInfo) = each_NintendoSwitchDeviceIdInfo;
+            Json::Value each_OpenIdInfo; ToJsonUtilO(OpenIdInfo, each_OpenIdInfo); ToJsonField(output, keyOpenIdInfo) = each_OpenIdInfo;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_PrivateInfo; ToJsonUtilO(PrivateInfo, each_PrivateInfo); ToJsonField(output, keyPrivateInfo) = each_PrivateInfo;
+            Json::Value each_PsnInfo; ToJsonUtilO(PsnInfo, each_PsnInfo); ToJsonField(output, keyPsnInfo) = each_PsnInfo;
+            Json::Value each_SteamInfo; ToJsonUtilO(SteamInfo, each_SteamInfo); ToJsonField(output, keySteamInfo) = each_SteamInfo;
+            Json::Value each_TitleInfo; ToJsonUtilO(TitleInfo, each_TitleInfo); ToJsonField(output, keyTitleInfo) = each_TitleInfo;
+            Json::Value each_TwitchInfo; ToJsonUtilO(TwitchInfo, each_TwitchInfo); ToJsonField(output, keyTwitchInfo) = each_TwitchInfo;
+            Json::Value each_Username; ToJsonUtilS(Username, each_Username); ToJsonField(output, keyUsername) = each_Username;
+            Json::Value each_WindowsHelloInfo; ToJsonUtilO(WindowsHelloInfo, each_WindowsHelloInfo); ToJsonField(output, keyWindowsHelloInfo) = each_WindowsHelloInfo;
+            Json::Value each_XboxInfo; ToJsonUtilO(XboxInfo, each_XboxInfo); ToJsonField(output, keyXboxInfo) = each_XboxInfo;
+            return output;
+        }
+
+        void GetAccountInfoResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyAccountInfo), AccountInfo);
+        }
+
+        Json::Value GetAccountInfoResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AccountInfo; ToJsonUtilO(AccountInfo, each_AccountInfo); ToJsonField(output, keyAccountInfo) = each_AccountInfo;
+            return output;
+        }
+
+        void NameIdentifier::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyId), Id);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+        }
+
+        Json::Value NameIdentifier::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Id; ToJsonUtilS(Id, each_Id); ToJsonField(output, keyId) = each_Id;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            return output;
+        }
+
+        void GetAdPlacementsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAppId), AppId);
+            FromJsonUtilO(FromJsonField(input, keyIdentifier), Identifier);
+        }
+
+        Json::Value GetAdPlacementsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AppId; ToJsonUtilS(AppId, each_AppId); ToJsonField(output, keyAppId) = each_AppId;
+            Json::Value each_Identifier; ToJsonUtilO(Identifier, each_Identifier); ToJsonField(output, keyIdentifier) = each_Identifier;
+            return output;
+        }
+
+        void GetAdPlacementsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyAdPlacements), AdPlacements);
+        }
+
+        Json::Value GetAdPlacementsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AdPlacements; ToJsonUtilO(AdPlacements, each_AdPlacements); ToJsonField(output, keyAdPlacements) = each_AdPlacements;
+            return output;
+        }
+
+        void GetCatalogItemsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+        }
+
+        Json::Value GetCatalogItemsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            return output;
+        }
+
+        void GetCatalogItemsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyCatalog), Catalog);
+        }
+
+        Json::Value GetCatalogItemsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Catalog; ToJsonUtilO(Catalog, each_Catalog); ToJsonField(output, keyCatalog) = each_Catalog;
+            return output;
+        }
+
+        void GetCharacterDataRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilP(FromJsonField(input, keyIfChangedFromDataVersion), IfChangedFromDataVersion);
+            FromJsonUtilS(FromJsonField(input, keyKeys), Keys);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GetCharacterDataRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_IfChangedFromDataVersion; ToJsonUtilP(IfChangedFromDataVersion, each_IfChangedFromDataVersion); ToJsonField(output, keyIfChangedFromDataVersion) = each_IfChangedFromDataVersion;
+            Json::Value each_Keys; ToJsonUtilS(Keys, each_Keys); ToJsonField(output, keyKeys) = each_Keys;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void UserDataRecord::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilT(FromJsonField(input, keyLastUpdated), LastUpdated);
+            FromJsonUtilE(FromJsonField(input, keyPermission), Permission);
+            FromJsonUtilS(FromJsonField(input, keyValue), Value);
+        }
+
+        Json::Value UserDataRecord::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_LastUpdated; ToJsonUtilT(LastUpdated, each_LastUpdated); ToJsonField(output, keyLastUpdated) = each_LastUpdated;
+            Json::Value each_Permission; ToJsonUtilE(Permission, each_Permission); ToJsonField(output, keyPermission) = each_Permission;
+            Json::Value each_Value; ToJsonUtilS(Value, each_Value); ToJsonField(output, keyValue) = each_Value;
+            return output;
+        }
+
+        void GetCharacterDataResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilO(FromJsonField(input, keyData), Data);
+            FromJsonUtilP(FromJsonField(input, keyDataVersion), DataVersion);
+        }
+
+        Json::Value GetCharacterDataResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_Data; ToJsonUtilO(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            Json::Value each_DataVersion; ToJsonUtilP(DataVersion, each_DataVersion); ToJsonField(output, keyDataVersion) = each_DataVersion;
+            return output;
+        }
+
+        void GetCharacterInventoryRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value GetCharacterInventoryRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void VirtualCurrencyRechargeTime::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyRechargeMax), RechargeMax);
+            FromJsonUtilT(FromJsonField(input, keyRechargeTime), RechargeTime);
+            FromJsonUtilP(FromJsonField(input, keySecondsToRecharge), SecondsToRecharge);
+        }
+
+        Json::Value VirtualCurrencyRechargeTime::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_RechargeMax; ToJsonUtilP(RechargeMax, each_RechargeMax); ToJsonField(output, keyRechargeMax) = each_RechargeMax;
+            Json::Value each_RechargeTime; ToJsonUtilT(RechargeTime, each_RechargeTime); ToJsonField(output, keyRechargeTime) = each_RechargeTime;
+            Json::Value each_SecondsToRecharge; ToJsonUtilP(SecondsToRecharge, each_SecondsToRecharge); ToJsonField(output, keySecondsToRecharge) = each_SecondsToRecharge;
+            return output;
+        }
+
+        void GetCharacterInventoryResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilO(FromJsonField(input, keyInventory), Inventory);
+            FromJsonUtilP(FromJsonField(input, keyVirtualCurrency), VirtualCurrency);
+            FromJsonUtilO(FromJsonField(input, keyVirtualCurrencyRechargeTimes), VirtualCurrencyRechargeTimes);
+        }
+
+        Json::Value GetCharacterInventoryResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_Inventory; ToJsonUtilO(Inventory, each_Inventory); ToJsonField(output, keyInventory) = each_Inventory;
+            Json::Value each_VirtualCurrency; ToJsonUtilP(VirtualCurrency, each_VirtualCurrency); ToJsonField(output, keyVirtualCurrency) = each_VirtualCurrency;
+            Json::Value each_VirtualCurrencyRechargeTimes; ToJsonUtilO(VirtualCurrencyRechargeTimes, each_VirtualCurrencyRechargeTimes); ToJsonField(output, keyVirtualCurrencyRechargeTimes) = each_VirtualCurrencyRechargeTimes;
+            return output;
+        }
+
+        void GetCharacterLeaderboardRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterType), CharacterType);
+            FromJsonUtilP(FromJsonField(input, keyMaxResultsCount), MaxResultsCount);
+            FromJsonUtilP(FromJsonField(input, keyStartPosition), StartPosition);
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+        }
+
+        Json::Value GetCharacterLeaderboardRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterType; ToJsonUtilS(CharacterType, each_CharacterType); ToJsonField(output, keyCharacterType) = each_CharacterType;
+            Json::Value each_MaxResultsCount; ToJsonUtilP(MaxResultsCount, each_MaxResultsCount); ToJsonField(output, keyMaxResultsCount) = each_MaxResultsCount;
+            Json::Value each_StartPosition; ToJsonUtilP(StartPosition, each_StartPosition); ToJsonField(output, keyStartPosition) = each_StartPosition;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            return output;
+        }
+
+        void GetCharacterLeaderboardResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyLeaderboard), Leaderboard);
+        }
+
+        Json::Value GetCharacterLeaderboardResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Leaderboard; ToJsonUtilO(Leaderboard, each_Leaderboard); ToJsonField(output, keyLeaderboard) = each_Leaderboard;
+            return output;
+        }
+
+        void GetCharacterStatisticsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+        }
+
+        Json::Value GetCharacterStatisticsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            return output;
+        }
+
+        void GetCharacterStatisticsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyCharacterStatistics), CharacterStatistics);
+        }
+
+        Json::Value GetCharacterStatisticsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterStatistics; ToJsonUtilP(CharacterStatistics, each_CharacterStatistics); ToJsonField(output, keyCharacterStatistics) = each_CharacterStatistics;
+            return output;
+        }
+
+        void GetContentDownloadUrlRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyHttpMethod), HttpMethod);
+            FromJsonUtilS(FromJsonField(input, keyKey), Key);
+            FromJsonUtilP(FromJsonField(input, keyThruCDN), ThruCDN);
+        }
+
+        Json::Value GetContentDownloadUrlRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_HttpMethod; ToJsonUtilS(HttpMethod, each_HttpMethod); ToJsonField(output, keyHttpMethod) = each_HttpMethod;
+            Json::Value each_Key; ToJsonUtilS(Key, each_Key); ToJsonField(output, keyKey) = each_Key;
+            Json::Value each_ThruCDN; ToJsonUtilP(ThruCDN, each_ThruCDN); ToJsonField(output, keyThruCDN) = each_ThruCDN;
+            return output;
+        }
+
+        void GetContentDownloadUrlResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyURL), URL);
+        }
+
+        Json::Value GetContentDownloadUrlResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_URL; ToJsonUtilS(URL, each_URL); ToJsonField(output, keyURL) = each_URL;
+            return output;
+        }
+
+        void PlayerProfileViewConstraints::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyShowAvatarUrl), ShowAvatarUrl);
+            FromJsonUtilP(FromJsonField(input, keyShowBannedUntil), ShowBannedUntil);
+            FromJsonUtilP(FromJsonField(input, keyShowCampaignAttributions), ShowCampaignAttributions);
+            FromJsonUtilP(FromJsonField(input, keyShowContactEmailAddresses), ShowContactEmailAddresses);
+            FromJsonUtilP(FromJsonField(input, keyShowCreated), ShowCreated);
+            FromJsonUtilP(FromJsonField(input, keyShowDisplayName), ShowDisplayName);
+            FromJsonUtilP(FromJsonField(input, keyShowExperimentVariants), ShowExperimentVariants);
+            FromJsonUtilP(FromJsonField(input, keyShowLastLogin), ShowLastLogin);
+            FromJsonUtilP(FromJsonField(input, keyShowLinkedAccounts), ShowLinkedAccounts);
+            FromJsonUtilP(FromJsonField(input, keyShowLocations), ShowLocations);
+            FromJsonUtilP(FromJsonField(input, keyShowMemberships), ShowMemberships);
+            FromJsonUtilP(FromJsonField(input, keyShowOrigination), ShowOrigination);
+            FromJsonUtilP(FromJsonField(input, keyShowPushNotificationRegistrations), ShowPushNotificationRegistrations);
+            FromJsonUtilP(FromJsonField(input, keyShowStatistics), ShowStatistics);
+            FromJsonUtilP(FromJsonField(input, keyShowTags), ShowTags);
+            FromJsonUtilP(FromJsonField(input, keyShowTotalValueToDateInUsd), ShowTotalValueToDateInUsd);
+            FromJsonUtilP(FromJsonField(input, keyShowValuesToDate), ShowValuesToDate);
+        }
+
+        Json::Value PlayerProfileViewConstraints::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ShowAvatarUrl; ToJsonUtilP(ShowAvatarUrl, each_ShowAvatarUrl); ToJsonField(output, keyShowAvatarUrl) = each_ShowAvatarUrl;
+            Json::Value each_ShowBannedUntil; ToJsonUtilP(ShowBannedUntil, each_ShowBannedUntil); ToJsonField(output, keyShowBannedUntil) = each_ShowBannedUntil;
+            Json::Value each_ShowCampaignAttributions; ToJsonUtilP(ShowCampaignAttributions, each_ShowCampaignAttributions); ToJsonField(output, keyShowCampaignAttributions) = each_ShowCampaignAttributions;
+            Json::Value each_ShowContactEmailAddresses; ToJsonUtilP(ShowContactEmailAddresses, each_ShowContactEmailAddresses); ToJsonField(output, keyShowContactEmailAddresses) = each_ShowContactEmailAddresses;
+            Json::Value each_ShowCreated; ToJsonUtilP(ShowCreated, each_ShowCreated); ToJsonField(output, keyShowCreated) = each_ShowCreated;
+            Json::Value each_ShowDisplayName; ToJsonUtilP(ShowDisplayName, each_ShowDisplayName); ToJsonField(output, keyShowDisplayName) = each_ShowDisplayName;
+            Json::Value each_ShowExperimentVariants; ToJsonUtilP(ShowExperimentVariants, each_ShowExperimentVariants); ToJsonField(output, keyShowExperimentVariants) = each_ShowExperimentVariants;
+            Json::Value each_ShowLastLogin; ToJsonUtilP(ShowLastLogin, each_ShowLastLogin); ToJsonField(output, keyShowLastLogin) = each_ShowLastLogin;
+            Json::Value each_ShowLinkedAccounts; ToJsonUtilP(ShowLinkedAccounts, each_ShowLinkedAccounts); ToJsonField(output, keyShowLinkedAccounts) = each_ShowLinkedAccounts;
+            Json::Value each_ShowLocations; ToJsonUtilP(ShowLocations, each_ShowLocations); ToJsonField(output, keyShowLocations) = each_ShowLocations;
+            Json::Value each_ShowMemberships; ToJsonUtilP(ShowMemberships, each_ShowMemberships); ToJsonField(output, keyShowMemberships) = each_ShowMemberships;
+            Json::Value each_ShowOrigination; ToJsonUtilP(ShowOrigination, each_ShowOrigination); ToJsonField(output, keyShowOrigination) = each_ShowOrigination;
+            Json::Value each_ShowPushNotificationRegistrations; ToJsonUtilP(ShowPushNotificationRegistrations, each_ShowPushNotificationRegistrations); ToJsonField(output, keyShowPushNotificationRegistrations) = each_ShowPushNotificationRegistrations;
+            Json::Value each_ShowStatistics; ToJsonUtilP(ShowStatistics, each_ShowStatistics); ToJsonField(output, keyShowStatistics) = each_ShowStatistics;
+            Json::Value each_ShowTags; ToJsonUtilP(ShowTags, each_ShowTags); ToJsonField(output, keyShowTags) = each_ShowTags;
+            Json::Value each_ShowTotalValueToDateInUsd; ToJsonUtilP(ShowTotalValueToDateInUsd, each_ShowTotalValueToDateInUsd); ToJsonField(output, keyShowTotalValueToDateInUsd) = each_ShowTotalValueToDateInUsd;
+            Json::Value each_ShowValuesToDate; ToJsonUtilP(ShowValuesToDate, each_ShowValuesToDate); ToJsonField(output, keyShowValuesToDate) = each_ShowValuesToDate;
+            return output;
+        }
+
+        void GetFriendLeaderboardAroundPlayerRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyIncludeFacebookFriends), IncludeFacebookFriends);
+            FromJsonUtilP(FromJsonField(input, keyIncludeSteamFriends), IncludeSteamFriends);
+            FromJsonUtilP(FromJsonField(input, keyMaxResultsCount), MaxResultsCount);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilO(FromJsonField(input, keyProfileConstraints), ProfileConstraints);
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+            FromJsonUtilP(FromJsonField(input, keyVersion), Version);
+            FromJsonUtilS(FromJsonField(input, keyXboxToken), XboxToken);
+        }
+
+        Json::Value GetFriendLeaderboardAroundPlayerRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_IncludeFacebookFriends; ToJsonUtilP(IncludeFacebookFriends, each_IncludeFacebookFriends); ToJsonField(output, keyIncludeFacebookFriends) = each_IncludeFacebookFriends;
+            Json::Value each_IncludeSteamFriends; ToJsonUtilP(IncludeSteamFriends, each_IncludeSteamFriends); ToJsonField(output, keyIncludeSteamFriends) = each_IncludeSteamFriends;
+            Json::Value each_MaxResultsCount; ToJsonUtilP(MaxResultsCount, each_MaxResultsCount); ToJsonField(output, keyMaxResultsCount) = each_MaxResultsCount;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_ProfileConstraints; ToJsonUtilO(ProfileConstraints, each_ProfileConstraints); ToJsonField(output, keyProfileConstraints) = each_ProfileConstraints;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            Json::Value each_Version; ToJsonUtilP(Version, each_Version); ToJsonField(output, keyVersion) = each_Version;
+            Json::Value each_XboxToken; ToJsonUtilS(XboxToken, each_XboxToken); ToJsonField(output, keyXboxToken) = each_XboxToken;
+            return output;
+        }
+
+        void PlayerLeaderboardEntry::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilP(FromJsonField(input, keyPosition), Position);
+            FromJsonUtilO(FromJsonField(input, keyProfile), Profile);
+            FromJsonUtilP(FromJsonField(input, keyStatValue), StatValue);
+        }
+
+        Json::Value PlayerLeaderboardEntry::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_Position; ToJsonUtilP(Position, each_Position); ToJsonField(output, keyPosition) = each_Position;
+            Json::Value each_Profile; ToJsonUtilO(Profile, each_Profile); ToJsonField(output, keyProfile) = each_Profile;
+            Json::Value each_StatValue; ToJsonUtilP(StatValue, each_StatValue); ToJsonField(output, keyStatValue) = each_StatValue;
+            return output;
+        }
+
+        void GetFriendLeaderboardAroundPlayerResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyLeaderboard), Leaderboard);
+            FromJsonUtilT(FromJsonField(input, keyNextReset), NextReset);
+            FromJsonUtilP(FromJsonField(input, keyVersion), Version);
+        }
+
+        Json::Value GetFriendLeaderboardAroundPlayerResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Leaderboard; ToJsonUtilO(Leaderboard, each_Leaderboard); ToJsonField(output, keyLeaderboard) = each_Leaderboard;
+            Json::Value each_NextReset; ToJsonUtilT(NextReset, each_NextReset); ToJsonField(output, keyNextReset) = each_NextReset;
+            Json::Value each_Version; ToJsonUtilP(Version, each_Version); ToJsonField(output, keyVersion) = each_Version;
+            return output;
+        }
+
+        void GetFriendLeaderboardRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyIncludeFacebookFriends), IncludeFacebookFriends);
+            FromJsonUtilP(FromJsonField(input, keyIncludeSteamFriends), IncludeSteamFriends);
+            FromJsonUtilP(FromJsonField(input, keyMaxResultsCount), MaxResultsCount);
+            FromJsonUtilO(FromJsonField(input, keyProfileConstraints), ProfileConstraints);
+            FromJsonUtilP(FromJsonField(input, keyStartPosition), StartPosition);
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+            FromJsonUtilP(FromJsonField(input, keyVersion), Version);
+            FromJsonUtilS(FromJsonField(input, keyXboxToken), XboxToken);
+        }
+
+        Json::Value GetFriendLeaderboardRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_IncludeFacebookFriends; ToJsonUtilP(IncludeFacebookFriends, each_IncludeFacebookFriends); ToJsonField(output, keyIncludeFacebookFriends) = each_IncludeFacebookFriends;
+            Json::Value each_IncludeSteamFriends; ToJsonUtilP(IncludeSteamFriends, each_IncludeSteamFriends); ToJsonField(output, keyIncludeSteamFriends) = each_IncludeSteamFriends;
+            Json::Value each_MaxResultsCount; ToJsonUtilP(MaxResultsCount, each_MaxResultsCount); ToJsonField(output, keyMaxResultsCount) = each_MaxResultsCount;
+            Json::Value each_ProfileConstraints; ToJsonUtilO(ProfileConstraints, each_ProfileConstraints); ToJsonField(output, keyProfileConstraints) = each_ProfileConstraints;
+            Json::Value each_StartPosition; ToJsonUtilP(StartPosition, each_StartPosition); ToJsonField(output, keyStartPosition) = each_StartPosition;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            Json::Value each_Version; ToJsonUtilP(Version, each_Version); ToJsonField(output, keyVersion) = each_Version;
+            Json::Value each_XboxToken; ToJsonUtilS(XboxToken, each_XboxToken); ToJsonField(output, keyXboxToken) = each_XboxToken;
+            return output;
+        }
+
+        void GetFriendsListRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyIncludeFacebookFriends), IncludeFacebookFriends);
+            FromJsonUtilP(FromJsonField(input, keyIncludeSteamFriends), IncludeSteamFriends);
+            FromJsonUtilO(FromJsonField(input, keyProfileConstraints), ProfileConstraints);
+            FromJsonUtilS(FromJsonField(input, keyXboxToken), XboxToken);
+        }
+
+        Json::Value GetFriendsListRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_IncludeFacebookFriends; ToJsonUtilP(IncludeFacebookFriends, each_IncludeFacebookFriends); ToJsonField(output, keyIncludeFacebookFriends) = each_IncludeFacebookFriends;
+            Json::Value each_IncludeSteamFriends; ToJsonUtilP(IncludeSteamFriends, each_IncludeSteamFriends); ToJsonField(output, keyIncludeSteamFriends) = each_IncludeSteamFriends;
+            Json::Value each_ProfileConstraints; ToJsonUtilO(ProfileConstraints, each_ProfileConstraints); ToJsonField(output, keyProfileConstraints) = each_ProfileConstraints;
+            Json::Value each_XboxToken; ToJsonUtilS(XboxToken, each_XboxToken); ToJsonField(output, keyXboxToken) = each_XboxToken;
+            return output;
+        }
+
+        void GetFriendsListResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyFriends), Friends);
+        }
+
+        Json::Value GetFriendsListResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Friends; ToJsonUtilO(Friends, each_Friends); ToJsonField(output, keyFriends) = each_Friends;
+            return output;
+        }
+
+        void GetLeaderboardAroundCharacterRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyCharacterType), CharacterType);
+            FromJsonUtilP(FromJsonField(input, keyMaxResultsCount), MaxResultsCount);
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+        }
+
+        Json::Value GetLeaderboardAroundCharacterRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_CharacterType; ToJsonUtilS(CharacterType, each_CharacterType); ToJsonField(output, keyCharacterType) = each_CharacterType;
+            Json::Value each_MaxResultsCount; ToJsonUtilP(MaxResultsCount, each_MaxResultsCount); ToJsonField(output, keyMaxResultsCount) = each_MaxResultsCount;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            return output;
+        }
+
+        void GetLeaderboardAroundCharacterResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyLeaderboard), Leaderboard);
+        }
+
+        Json::Value GetLeaderboardAroundCharacterResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Leaderboard; ToJsonUtilO(Leaderboard, each_Leaderboard); ToJsonField(output, keyLeaderboard) = each_Leaderboard;
+            return output;
+        }
+
+        void GetLeaderboardAroundPlayerRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyMaxResultsCount), MaxResultsCount);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilO(FromJsonField(input, keyProfileConstraints), ProfileConstraints);
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+            FromJsonUtilP(FromJsonField(input, keyVersion), Version);
+        }
+
+        Json::Value GetLeaderboardAroundPlayerRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_MaxResultsCount; ToJsonUtilP(MaxResultsCount, each_MaxResultsCount); ToJsonField(output, keyMaxResultsCount) = each_MaxResultsCount;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_ProfileConstraints; ToJsonUtilO(ProfileConstraints, each_ProfileConstraints); ToJsonField(output, keyProfileConstraints) = each_ProfileConstraints;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            Json::Value each_Version; ToJsonUtilP(Version, each_Version); ToJsonField(output, keyVersion) = each_Version;
+            return output;
+        }
+
+        void GetLeaderboardAroundPlayerResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyLeaderboard), Leaderboard);
+            FromJsonUtilT(FromJsonField(input, keyNextReset), NextReset);
+            FromJsonUtilP(FromJsonField(input, keyVersion), Version);
+        }
+
+        Json::Value GetLeaderboardAroundPlayerResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Leaderboard; ToJsonUtilO(Leaderboard, each_Leaderboard); ToJsonField(output, keyLeaderboard) = each_Leaderboard;
+            Json::Value each_NextReset; ToJsonUtilT(NextReset, each_NextReset); ToJsonField(output, keyNextReset) = each_NextReset;
+            Json::Value each_Version; ToJsonUtilP(Version, each_Version); ToJsonField(output, keyVersion) = each_Version;
+            return output;
+        }
+
+        void GetLeaderboardForUsersCharactersRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyMaxResultsCount), MaxResultsCount);
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+        }
+
+        Json::Value GetLeaderboardForUsersCharactersRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_MaxResultsCount; ToJsonUtilP(MaxResultsCount, each_MaxResultsCount); ToJsonField(output, keyMaxResultsCount) = each_MaxResultsCount;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            return output;
+        }
+
+        void GetLeaderboardForUsersCharactersResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyLeaderboard), Leaderboard);
+        }
+
+        Json::Value GetLeaderboardForUsersCharactersResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Leaderboard; ToJsonUtilO(Leaderboard, each_Leaderboard); ToJsonField(output, keyLeaderboard) = each_Leaderboard;
+            return output;
+        }
+
+        void GetLeaderboardRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyMaxResultsCount), MaxResultsCount);
+            FromJsonUtilO(FromJsonField(input, keyProfileConstraints), ProfileConstraints);
+            FromJsonUtilP(FromJsonField(input, keyStartPosition), StartPosition);
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+            FromJsonUtilP(FromJsonField(input, keyVersion), Version);
+        }
+
+        Json::Value GetLeaderboardRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_MaxResultsCount; ToJsonUtilP(MaxResultsCount, each_MaxResultsCount); ToJsonField(output, keyMaxResultsCount) = each_MaxResultsCount;
+            Json::Value each_ProfileConstraints; ToJsonUtilO(ProfileConstraints, each_ProfileConstraints); ToJsonField(output, keyProfileConstraints) = each_ProfileConstraints;
+            Json::Value each_StartPosition; ToJsonUtilP(StartPosition, each_StartPosition); ToJsonField(output, keyStartPosition) = each_StartPosition;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            Json::Value each_Version; ToJsonUtilP(Version, each_Version); ToJsonField(output, keyVersion) = each_Version;
+            return output;
+        }
+
+        void GetLeaderboardResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyLeaderboard), Leaderboard);
+            FromJsonUtilT(FromJsonField(input, keyNextReset), NextReset);
+            FromJsonUtilP(FromJsonField(input, keyVersion), Version);
+        }
+
+        Json::Value GetLeaderboardResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Leaderboard; ToJsonUtilO(Leaderboard, each_Leaderboard); ToJsonField(output, keyLeaderboard) = each_Leaderboard;
+            Json::Value each_NextReset; ToJsonUtilT(NextReset, each_NextReset); ToJsonField(output, keyNextReset) = each_NextReset;
+            Json::Value each_Version; ToJsonUtilP(Version, each_Version); ToJsonField(output, keyVersion) = each_Version;
+            return output;
+        }
+
+        void GetPaymentTokenRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyTokenProvider), TokenProvider);
+        }
+
+        Json::Value GetPaymentTokenRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_TokenProvider; ToJsonUtilS(TokenProvider, each_TokenProvider); ToJsonField(output, keyTokenProvider) = each_TokenProvider;
+            return output;
+        }
+
+        void GetPaymentTokenResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyOrderId), OrderId);
+            FromJsonUtilS(FromJsonField(input, keyProviderToken), ProviderToken);
+        }
+
+        Json::Value GetPaymentTokenResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_OrderId; ToJsonUtilS(OrderId, each_OrderId); ToJsonField(output, keyOrderId) = each_OrderId;
+            Json::Value each_ProviderToken; ToJsonUtilS(ProviderToken, each_ProviderToken); ToJsonField(output, keyProviderToken) = each_ProviderToken;
+            return output;
+        }
+
+        void GetPhotonAuthenticationTokenRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPhotonApplicationId), PhotonApplicationId);
+        }
+
+        Json::Value GetPhotonAuthenticationTokenRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PhotonApplicationId; ToJsonUtilS(PhotonApplicationId, each_PhotonApplicationId); ToJsonField(output, keyPhotonApplicationId) = each_PhotonApplicationId;
+            return output;
+        }
+
+        void GetPhotonAuthenticationTokenResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPhotonCustomAuthenticationToken), PhotonCustomAuthenticationToken);
+        }
+
+        Json::Value GetPhotonAuthenticationTokenResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PhotonCustomAuthenticationToken; ToJsonUtilS(PhotonCustomAuthenticationToken, each_PhotonCustomAuthenticationToken); ToJsonField(output, keyPhotonCustomAuthenticationToken) = each_PhotonCustomAuthenticationToken;
+            return output;
+        }
+
+        void GetPlayerCombinedInfoRequestParams::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyGetCharacterInventories), GetCharacterInventories);
+            FromJsonUtilP(FromJsonField(input, keyGetCharacterList), GetCharacterList);
+            FromJsonUtilP(FromJsonField(input, keyGetPlayerProfile), GetPlayerProfile);
+            FromJsonUtilP(FromJsonField(input, keyGetPlayerStatistics), GetPlayerStatistics);
+            FromJsonUtilP(FromJsonField(input, keyGetTitleData), GetTitleData);
+            FromJsonUtilP(FromJsonField(input, keyGetUserAccountInfo), GetUserAccountInfo);
+            FromJsonUtilP(FromJsonField(input, keyGetUserData), GetUserData);
+            FromJsonUtilP(FromJsonField(input, keyGetUserInventory), GetUserInventory);
+            FromJsonUtilP(FromJsonField(input, keyGetUserReadOnlyData), GetUserReadOnlyData);
+            FromJsonUtilP(FromJsonField(input, keyGetUserVirtualCurrency), GetUserVirtualCurrency);
+            FromJsonUtilS(FromJsonField(input, keyPlayerStatisticNames), PlayerStatisticNames);
+            FromJsonUtilO(FromJsonField(input, keyProfileConstraints), ProfileConstraints);
+            FromJsonUtilS(FromJsonField(input, keyTitleDataKeys), TitleDataKeys);
+            FromJsonUtilS(FromJsonField(input, keyUserDataKeys), UserDataKeys);
+            FromJsonUtilS(FromJsonField(input, keyUserReadOnlyDataKeys), UserReadOnlyDataKeys);
+        }
+
+        Json::Value GetPlayerCombinedInfoRequestParams::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GetCharacterInventories; ToJsonUtilP(GetCharacterInventories, each_GetCharacterInventories); ToJsonField(output, keyGetCharacterInventories) = each_GetCharacterInventories;
+            Json::Value each_GetCharacterList; ToJsonUtilP(GetCharacterList, each_GetCharacterList); ToJsonField(output, keyGetCharacterList) = each_GetCharacterList;
+            Json::Value each_GetPlayerProfile; ToJsonUtilP(GetPlayerProfile, each_GetPlayerProfile); ToJsonField(output, keyGetPlayerProfile) = each_GetPlayerProfile;
+            Json::Value each_GetPlayerStatistics; ToJsonUtilP(GetPlayerStatistics, each_GetPlayerStatistics); ToJsonField(output, keyGetPlayerStatistics) = each_GetPlayerStatistics;
+            Json::Value each_GetTitleData; ToJsonUtilP(GetTitleData, each_GetTitleData); ToJsonField(output, keyGetTitleData) = each_GetTitleData;
+            Json::Value each_GetUserAccountInfo; ToJsonUtilP(GetUserAccountInfo, each_GetUserAccountInfo); ToJsonField(output, keyGetUserAccountInfo) = each_GetUserAccountInfo;
+            Json::Value each_GetUserData; ToJsonUtilP(GetUserData, each_GetUserData); ToJsonField(output, keyGetUserData) = each_GetUserData;
+            Json::Value each_GetUserInventory; ToJsonUtilP(GetUserInventory, each_GetUserInventory); ToJsonField(output, keyGetUserInventory) = each_GetUserInventory;
+            Json::Value each_GetUserReadOnlyData; ToJsonUtilP(GetUserReadOnlyData, each_GetUserReadOnlyData); ToJsonField(output, keyGetUserReadOnlyData) = each_GetUserReadOnlyData;
+            Json::Value each_GetUserVirtualCurrency; ToJsonUtilP(GetUserVirtualCurrency, each_GetUserVirtualCurrency); ToJsonField(output, keyGetUserVirtualCurrency) = each_GetUserVirtualCurrency;
+            Json::Value each_PlayerStatisticNames; ToJsonUtilS(PlayerStatisticNames, each_PlayerStatisticNames); ToJsonField(output, keyPlayerStatisticNames) = each_PlayerStatisticNames;
+            Json::Value each_ProfileConstraints; ToJsonUtilO(ProfileConstraints, each_ProfileConstraints); ToJsonField(output, keyProfileConstraints) = each_ProfileConstraints;
+            Json::Value each_TitleDataKeys; ToJsonUtilS(TitleDataKeys, each_TitleDataKeys); ToJsonField(output, keyTitleDataKeys) = each_TitleDataKeys;
+            Json::Value each_UserDataKeys; ToJsonUtilS(UserDataKeys, each_UserDataKeys); ToJsonField(output, keyUserDataKeys) = each_UserDataKeys;
+            Json::Value each_UserReadOnlyDataKeys; ToJsonUtilS(UserReadOnlyDataKeys, each_UserReadOnlyDataKeys); ToJsonField(output, keyUserReadOnlyDataKeys) = each_UserReadOnlyDataKeys;
+            return output;
+        }
+
+        void GetPlayerCombinedInfoRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyInfoRequestParameters), InfoRequestParameters);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GetPlayerCombinedInfoRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); ToJsonField(output, keyInfoRequestParameters) = each_InfoRequestParameters;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void StatisticValue::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+            FromJsonUtilP(FromJsonField(input, keyValue), Value);
+            FromJsonUtilP(FromJsonField(input, keyVersion), Version);
+        }
+
+        Json::Value StatisticValue::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            Json::Value each_Value; ToJsonUtilP(Value, each_Value); ToJsonField(output, keyValue) = each_Value;
+            Json::Value each_Version; ToJsonUtilP(Version, each_Version); ToJsonField(output, keyVersion) = each_Version;
+            return output;
+        }
+
+        void GetPlayerCombinedInfoResultPayload::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyAccountInfo), AccountInfo);
+            FromJsonUtilO(FromJsonField(input, keyCharacterInventories), CharacterInventories);
+            FromJsonUtilO(FromJsonField(input, keyCharacterList), CharacterList);
+            FromJsonUtilO(FromJsonField(input, keyPlayerProfile), PlayerProfile);
+            FromJsonUtilO(FromJsonField(input, keyPlayerStatistics), PlayerStatistics);
+            FromJsonUtilS(FromJsonField(input, keyTitleData), TitleData);
+            FromJsonUtilO(FromJsonField(input, keyUserData), UserData);
+            FromJsonUtilP(FromJsonField(input, keyUserDataVersion), UserDataVersion);
+            FromJsonUtilO(FromJsonField(input, keyUserInventory), UserInventory);
+            FromJsonUtilO(FromJsonField(input, keyUserReadOnlyData), UserReadOnlyData);
+            FromJsonUtilP(FromJsonField(input, keyUserReadOnlyDataVersion), UserReadOnlyDataVersion);
+            FromJsonUtilP(FromJsonField(input, keyUserVirtualCurrency), UserVirtualCurrency);
+            FromJsonUtilO(FromJsonField(input, keyUserVirtualCurrencyRechargeTimes), UserVirtualCurrencyRechargeTimes);
+        }
+
+        Json::Value GetPlayerCombinedInfoResultPayload::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AccountInfo; ToJsonUtilO(AccountInfo, each_AccountInfo); ToJsonField(output, keyAccountInfo) = each_AccountInfo;
+            Json::Value each_CharacterInventories; ToJsonUtilO(CharacterInventories, each_CharacterInventories); ToJsonField(output, keyCharacterInventories) = each_CharacterInventories;
+            Json::Value each_CharacterList; ToJsonUtilO(CharacterList, each_CharacterList); ToJsonField(output, keyCharacterList) = each_CharacterList;
+            Json::Value each_PlayerProfile; ToJsonUtilO(PlayerProfile, each_PlayerProfile); ToJsonField(output, keyPlayerProfile) = each_PlayerProfile;
+            Json::Value each_PlayerStatistics; ToJsonUtilO(PlayerStatistics, each_PlayerStatistics); ToJsonField(output, keyPlayerStatistics) = each_PlayerStatistics;
+            Json::Value each_TitleData; ToJsonUtilS(TitleData, each_TitleData); ToJsonField(output, keyTitleData) = each_TitleData;
+            Json::Value each_UserData; ToJsonUtilO(UserData, each_UserData); ToJsonField(output, keyUserData) = each_UserData;
+            Json::Value each_UserDataVersion; ToJsonUtilP(UserDataVersion, each_UserDataVersion); ToJsonField(output, keyUserDataVersion) = each_UserDataVersion;
+            Json::Value each_UserInventory; ToJsonUtilO(UserInventory, each_UserInventory); ToJsonField(output, keyUserInventory) = each_UserInventory;
+            Json::Value each_UserReadOnlyData; ToJsonUtilO(UserReadOnlyData, each_UserReadOnlyData); ToJsonField(output, keyUserReadOnlyData) = each_UserReadOnlyData;
+            Json::Value each_UserReadOnlyDataVersion; ToJsonUtilP(UserReadOnlyDataVersion, each_UserReadOnlyDataVersion); ToJsonField(output, keyUserReadOnlyDataVersion) = each_UserReadOnlyDataVersion;
+            Json::Value each_UserVirtualCurrency; ToJsonUtilP(UserVirtualCurrency, each_UserVirtualCurrency); ToJsonField(output, keyUserVirtualCurrency) = each_UserVirtualCurrency;
+            Json::Value each_UserVirtualCurrencyRechargeTimes; ToJsonUtilO(UserVirtualCurrencyRechargeTimes, each_UserVirtualCurrencyRechargeTimes); ToJsonField(output, keyUserVirtualCurrencyRechargeTimes) = each_UserVirtualCurrencyRechargeTimes;
+            return output;
+        }
+
+        void GetPlayerCombinedInfoResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyInfoResultPayload), InfoResultPayload);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GetPlayerCombinedInfoResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_InfoResultPayload; ToJsonUtilO(InfoResultPayload, each_InfoResultPayload); ToJsonField(output, keyInfoResultPayload) = each_InfoResultPayload;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void GetPlayerProfileRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilO(FromJsonField(input, keyProfileConstraints), ProfileConstraints);
+        }
+
+        Json::Value GetPlayerProfileRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_ProfileConstraints; ToJsonUtilO(ProfileConstraints, each_ProfileConstraints); ToJsonField(output, keyProfileConstraints) = each_ProfileConstraints;
+            return output;
+        }
+
+        void GetPlayerProfileResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyPlayerProfile), PlayerProfile);
+        }
+
+        Json::Value GetPlayerProfileResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayerProfile; ToJsonUtilO(PlayerProfile, each_PlayerProfile); ToJsonField(output, keyPlayerProfile) = each_PlayerProfile;
+            return output;
+        }
+
+        void GetPlayerSegmentsRequest::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value GetPlayerSegmentsRequest::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void GetSegmentResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyABTestParent), ABTestParent);
+            FromJsonUtilS(FromJsonField(input, keyId), Id);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+        }
+
+        Json::Value GetSegmentResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ABTestParent; ToJsonUtilS(ABTestParent, each_ABTestParent); ToJsonField(output, keyABTestParent) = each_ABTestParent;
+            Json::Value each_Id; ToJsonUtilS(Id, each_Id); ToJsonField(output, keyId) = each_Id;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            return output;
+        }
+
+        void GetPlayerSegmentsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keySegments), Segments);
+        }
+
+        Json::Value GetPlayerSegmentsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Segments; ToJsonUtilO(Segments, each_Segments); ToJsonField(output, keySegments) = each_Segments;
+            return output;
+        }
+
+        void StatisticNameVersion::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+            FromJsonUtilP(FromJsonField(input, keyVersion), Version);
+        }
+
+        Json::Value StatisticNameVersion::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            Json::Value each_Version; ToJsonUtilP(Version, each_Version); ToJsonField(output, keyVersion) = each_Version;
+            return output;
+        }
+
+        void GetPlayerStatisticsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyStatisticNames), StatisticNames);
+            FromJsonUtilO(FromJsonField(input, keyStatisticNameVersions), StatisticNameVersions);
+        }
+
+        Json::Value GetPlayerStatisticsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_StatisticNames; ToJsonUtilS(StatisticNames, each_StatisticNames); ToJsonField(output, keyStatisticNames) = each_StatisticNames;
+            Json::Value each_StatisticNameVersions; ToJsonUtilO(StatisticNameVersions, each_StatisticNameVersions); ToJsonField(output, keyStatisticNameVersions) = each_StatisticNameVersions;
+            return output;
+        }
+
+        void GetPlayerStatisticsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyStatistics), Statistics);
+        }
+
+        Json::Value GetPlayerStatisticsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Statistics; ToJsonUtilO(Statistics, each_Statistics); ToJsonField(output, keyStatistics) = each_Statistics;
+            return output;
+        }
+
+        void GetPlayerStatisticVersionsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+        }
+
+        Json::Value GetPlayerStatisticVersionsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            return output;
+        }
+
+        void PlayerStatisticVersion::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilT(FromJsonField(input, keyActivationTime), ActivationTime);
+            FromJsonUtilT(FromJsonField(input, keyDeactivationTime), DeactivationTime);
+            FromJsonUtilT(FromJsonField(input, keyScheduledActivationTime), ScheduledActivationTime);
+            FromJsonUtilT(FromJsonField(input, keyScheduledDeactivationTime), ScheduledDeactivationTime);
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+            FromJsonUtilP(FromJsonField(input, keyVersion), Version);
+        }
+
+        Json::Value PlayerStatisticVersion::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ActivationTime; ToJsonUtilT(ActivationTime, each_ActivationTime); ToJsonField(output, keyActivationTime) = each_ActivationTime;
+            Json::Value each_DeactivationTime; ToJsonUtilT(DeactivationTime, each_DeactivationTime); ToJsonField(output, keyDeactivationTime) = each_DeactivationTime;
+            Json::Value each_ScheduledActivationTime; ToJsonUtilT(ScheduledActivationTime, each_ScheduledActivationTime); ToJsonField(output, keyScheduledActivationTime) = each_ScheduledActivationTime;
+            Json::Value each_ScheduledDeactivationTime; ToJsonUtilT(ScheduledDeactivationTime, each_ScheduledDeactivationTime); ToJsonField(output, keyScheduledDeactivationTime) = each_ScheduledDeactivationTime;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            Json::Value each_Version; ToJsonUtilP(Version, each_Version); ToJsonField(output, keyVersion) = each_Version;
+            return output;
+        }
+
+        void GetPlayerStatisticVersionsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyStatisticVersions), StatisticVersions);
+        }
+
+        Json::Value GetPlayerStatisticVersionsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_StatisticVersions; ToJsonUtilO(StatisticVersions, each_StatisticVersions); ToJsonField(output, keyStatisticVersions) = each_StatisticVersions;
+            return output;
+        }
+
+        void GetPlayerTagsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyNamespace), Namespace);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GetPlayerTagsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Namespace; ToJsonUtilS(Namespace, each_Namespace); ToJsonField(output, keyNamespace) = each_Namespace;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void GetPlayerTagsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyTags), Tags);
+        }
+
+        Json::Value GetPlayerTagsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_Tags; ToJsonUtilS(Tags, each_Tags); ToJsonField(output, keyTags) = each_Tags;
+            return output;
+        }
+
+        void GetPlayerTradesRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilE(FromJsonField(input, keyStatusFilter), StatusFilter);
+        }
+
+        Json::Value GetPlayerTradesRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_StatusFilter; ToJsonUtilE(StatusFilter, each_StatusFilter); ToJsonField(output, keyStatusFilter) = each_StatusFilter;
+            return output;
+        }
+
+        void GetPlayerTradesResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyAcceptedTrades), AcceptedTrades);
+            FromJsonUtilO(FromJsonField(input, keyOpenedTrades), OpenedTrades);
+        }
+
+        Json::Value GetPlayerTradesResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AcceptedTrades; ToJsonUtilO(AcceptedTrades, each_AcceptedTrades); ToJsonField(output, keyAcceptedTrades) = each_AcceptedTrades;
+            Json::Value each_OpenedTrades; ToJsonUtilO(OpenedTrades, each_OpenedTrades); ToJsonField(output, keyOpenedTrades) = each_OpenedTrades;
+            return output;
+        }
+
+        void GetPlayFabIDsFromFacebookIDsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyFacebookIDs), FacebookIDs);
+        }
+
+        Json::Value GetPlayFabIDsFromFacebookIDsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_FacebookIDs; ToJsonUtilS(FacebookIDs, each_FacebookIDs); ToJsonField(output, keyFacebookIDs) = each_FacebookIDs;
+            return output;
+        }
+
+        void GetPlayFabIDsFromFacebookIDsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyData), Data);
+        }
+
+        Json::Value GetPlayFabIDsFromFacebookIDsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Data; ToJsonUtilO(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            return output;
+        }
+
+        void GetPlayFabIDsFromFacebookInstantGamesIdsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyFacebookInstantGamesIds), FacebookInstantGamesIds);
+        }
+
+        Json::Value GetPlayFabIDsFromFacebookInstantGamesIdsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_FacebookInstantGamesIds; ToJsonUtilS(FacebookInstantGamesIds, each_FacebookInstantGamesIds); ToJsonField(output, keyFacebookInstantGamesIds) = each_FacebookInstantGamesIds;
+            return output;
+        }
+
+        void GetPlayFabIDsFromFacebookInstantGamesIdsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyData), Data);
+        }
+
+        Json::Value GetPlayFabIDsFromFacebookInstantGamesIdsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Data; ToJsonUtilO(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            return output;
+        }
+
+        void GetPlayFabIDsFromGameCenterIDsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyGameCenterIDs), GameCenterIDs);
+        }
+
+        Json::Value GetPlayFabIDsFromGameCenterIDsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GameCenterIDs; ToJsonUtilS(GameCenterIDs, each_GameCenterIDs); ToJsonField(output, keyGameCenterIDs) = each_GameCenterIDs;
+            return output;
+        }
+
+        void GetPlayFabIDsFromGameCenterIDsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyData), Data);
+        }
+
+        Json::Value GetPlayFabIDsFromGameCenterIDsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Data; ToJsonUtilO(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            return output;
+        }
+
+        void GetPlayFabIDsFromGenericIDsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyGenericIDs), GenericIDs);
+        }
+
+        Json::Value GetPlayFabIDsFromGenericIDsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GenericIDs; ToJsonUtilO(GenericIDs, each_GenericIDs); ToJsonField(output, keyGenericIDs) = each_GenericIDs;
+            return output;
+        }
+
+        void GetPlayFabIDsFromGenericIDsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyData), Data);
+        }
+
+        Json::Value GetPlayFabIDsFromGenericIDsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Data; ToJsonUtilO(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            return output;
+        }
+
+        void GetPlayFabIDsFromGoogleIDsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyGoogleIDs), GoogleIDs);
+        }
+
+        Json::Value GetPlayFabIDsFromGoogleIDsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GoogleIDs; ToJsonUtilS(GoogleIDs, each_GoogleIDs); ToJsonField(output, keyGoogleIDs) = each_GoogleIDs;
+            return output;
+        }
+
+        void GooglePlayFabIdPair::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyGoogleId), GoogleId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GooglePlayFabIdPair::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GoogleId; ToJsonUtilS(GoogleId, each_GoogleId); ToJsonField(output, keyGoogleId) = each_GoogleId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void GetPlayFabIDsFromGoogleIDsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyData), Data);
+        }
+
+        Json::Value GetPlayFabIDsFromGoogleIDsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Data; ToJsonUtilO(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            return output;
+        }
+
+        void GetPlayFabIDsFromKongregateIDsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyKongregateIDs), KongregateIDs);
+        }
+
+        Json::Value GetPlayFabIDsFromKongregateIDsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_KongregateIDs; ToJsonUtilS(KongregateIDs, each_KongregateIDs); ToJsonField(output, keyKongregateIDs) = each_KongregateIDs;
+            return output;
+        }
+
+        void KongregatePlayFabIdPair::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyKongregateId), KongregateId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value KongregatePlayFabIdPair::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_KongregateId; ToJsonUtilS(KongregateId, each_KongregateId); ToJsonField(output, keyKongregateId) = each_KongregateId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void GetPlayFabIDsFromKongregateIDsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyData), Data);
+        }
+
+        Json::Value GetPlayFabIDsFromKongregateIDsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Data; ToJsonUtilO(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            return output;
+        }
+
+        void GetPlayFabIDsFromNintendoSwitchDeviceIdsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyNintendoSwitchDeviceIds), NintendoSwitchDeviceIds);
+        }
+
+        Json::Value GetPlayFabIDsFromNintendoSwitchDeviceIdsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_NintendoSwitchDeviceIds; ToJsonUtilS(NintendoSwitchDeviceIds, each_NintendoSwitchDeviceIds); ToJsonField(output, keyNintendoSwitchDeviceIds) = each_NintendoSwitchDeviceIds;
+            return output;
+        }
+
+        void NintendoSwitchPlayFabIdPair::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyNintendoSwitchDeviceId), NintendoSwitchDeviceId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value NintendoSwitchPlayFabIdPair::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_NintendoSwitchDeviceId; ToJsonUtilS(NintendoSwitchDeviceId, each_NintendoSwitchDeviceId); ToJsonField(output, keyNintendoSwitchDeviceId) = each_NintendoSwitchDeviceId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void GetPlayFabIDsFromNintendoSwitchDeviceIdsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyData), Data);
+        }
+
+        Json::Value GetPlayFabIDsFromNintendoSwitchDeviceIdsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Data; ToJsonUtilO(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            return output;
+        }
+
+        void GetPlayFabIDsFromPSNAccountIDsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyIssuerId), IssuerId);
+            FromJsonUtilS(FromJsonField(input, keyPSNAccountIDs), PSNAccountIDs);
+        }
+
+        Json::Value GetPlayFabIDsFromPSNAccountIDsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_IssuerId; ToJsonUtilP(IssuerId, each_IssuerId); ToJsonField(output, keyIssuerId) = each_IssuerId;
+            Json::Value each_PSNAccountIDs; ToJsonUtilS(PSNAccountIDs, each_PSNAccountIDs); ToJsonField(output, keyPSNAccountIDs) = each_PSNAccountIDs;
+            return output;
+        }
+
+        void PSNAccountPlayFabIdPair::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyPSNAccountId), PSNAccountId);
+        }
+
+        Json::Value PSNAccountPlayFabIdPair::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_PSNAccountId; ToJsonUtilS(PSNAccountId, each_PSNAccountId); ToJsonField(output, keyPSNAccountId) = each_PSNAccountId;
+            return output;
+        }
+
+        void GetPlayFabIDsFromPSNAccountIDsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyData), Data);
+        }
+
+        Json::Value GetPlayFabIDsFromPSNAccountIDsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Data; ToJsonUtilO(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            return output;
+        }
+
+        void GetPlayFabIDsFromSteamIDsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keySteamStringIDs), SteamStringIDs);
+        }
+
+        Json::Value GetPlayFabIDsFromSteamIDsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_SteamStringIDs; ToJsonUtilS(SteamStringIDs, each_SteamStringIDs); ToJsonField(output, keySteamStringIDs) = each_SteamStringIDs;
+            return output;
+        }
+
+        void SteamPlayFabIdPair::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keySteamStringId), SteamStringId);
+        }
+
+        Json::Value SteamPlayFabIdPair::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_SteamStringId; ToJsonUtilS(SteamStringId, each_SteamStringId); ToJsonField(output, keySteamStringId) = each_SteamStringId;
+            return output;
+        }
+
+        void GetPlayFabIDsFromSteamIDsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyData), Data);
+        }
+
+        Json::Value GetPlayFabIDsFromSteamIDsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Data; ToJsonUtilO(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            return output;
+        }
+
+        void GetPlayFabIDsFromTwitchIDsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyTwitchIds), TwitchIds);
+        }
+
+        Json::Value GetPlayFabIDsFromTwitchIDsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_TwitchIds; ToJsonUtilS(TwitchIds, each_TwitchIds); ToJsonField(output, keyTwitchIds) = each_TwitchIds;
+            return output;
+        }
+
+        void TwitchPlayFabIdPair::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyTwitchId), TwitchId);
+        }
+
+        Json::Value TwitchPlayFabIdPair::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_TwitchId; ToJsonUtilS(TwitchId, each_TwitchId); ToJsonField(output, keyTwitchId) = each_TwitchId;
+            return output;
+        }
+
+        void GetPlayFabIDsFromTwitchIDsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyData), Data);
+        }
+
+        Json::Value GetPlayFabIDsFromTwitchIDsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Data; ToJsonUtilO(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            return output;
+        }
+
+        void GetPlayFabIDsFromXboxLiveIDsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keySandbox), Sandbox);
+            FromJsonUtilS(FromJsonField(input, keyXboxLiveAccountIDs), XboxLiveAccountIDs);
+        }
+
+        Json::Value GetPlayFabIDsFromXboxLiveIDsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Sandbox; ToJsonUtilS(Sandbox, each_Sandbox); ToJsonField(output, keySandbox) = each_Sandbox;
+            Json::Value each_XboxLiveAccountIDs; ToJsonUtilS(XboxLiveAccountIDs, each_XboxLiveAccountIDs); ToJsonField(output, keyXboxLiveAccountIDs) = each_XboxLiveAccountIDs;
+            return output;
+        }
+
+        void XboxLiveAccountPlayFabIdPair::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyXboxLiveAccountId), XboxLiveAccountId);
+        }
+
+        Json::Value XboxLiveAccountPlayFabIdPair::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_XboxLiveAccountId; ToJsonUtilS(XboxLiveAccountId, each_XboxLiveAccountId); ToJsonField(output, keyXboxLiveAccountId) = each_XboxLiveAccountId;
+            return output;
+        }
+
+        void GetPlayFabIDsFromXboxLiveIDsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyData), Data);
+        }
+
+        Json::Value GetPlayFabIDsFromXboxLiveIDsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Data; ToJsonUtilO(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            return output;
+        }
+
+        void GetPublisherDataRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyKeys), Keys);
+        }
+
+        Json::Value GetPublisherDataRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Keys; ToJsonUtilS(Keys, each_Keys); ToJsonField(output, keyKeys) = each_Keys;
+            return output;
+        }
+
+        void GetPublisherDataResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyData), Data);
+        }
+
+        Json::Value GetPublisherDataResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Data; ToJsonUtilS(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            return output;
+        }
+
+        void GetPurchaseRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyOrderId), OrderId);
+        }
+
+        Json::Value GetPurchaseRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_OrderId; ToJsonUtilS(OrderId, each_OrderId); ToJsonField(output, keyOrderId) = each_OrderId;
+            return output;
+        }
+
+        void GetPurchaseResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyOrderId), OrderId);
+            FromJsonUtilS(FromJsonField(input, keyPaymentProvider), PaymentProvider);
+            FromJsonUtilT(FromJsonField(input, keyPurchaseDate), PurchaseDate);
+            FromJsonUtilS(FromJsonField(input, keyTransactionId), TransactionId);
+            FromJsonUtilS(FromJsonField(input, keyTransactionStatus), TransactionStatus);
+        }
+
+        Json::Value GetPurchaseResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_OrderId; ToJsonUtilS(OrderId, each_OrderId); ToJsonField(output, keyOrderId) = each_OrderId;
+            Json::Value each_PaymentProvider; ToJsonUtilS(PaymentProvider, each_PaymentProvider); ToJsonField(output, keyPaymentProvider) = each_PaymentProvider;
+            Json::Value each_PurchaseDate; ToJsonUtilT(PurchaseDate, each_PurchaseDate); ToJsonField(output, keyPurchaseDate) = each_PurchaseDate;
+            Json::Value each_TransactionId; ToJsonUtilS(TransactionId, each_TransactionId); ToJsonField(output, keyTransactionId) = each_TransactionId;
+            Json::Value each_TransactionStatus; ToJsonUtilS(TransactionStatus, each_TransactionStatus); ToJsonField(output, keyTransactionStatus) = each_TransactionStatus;
+            return output;
+        }
+
+        void GetSharedGroupDataRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyGetMembers), GetMembers);
+            FromJsonUtilS(FromJsonField(input, keyKeys), Keys);
+            FromJsonUtilS(FromJsonField(input, keySharedGroupId), SharedGroupId);
+        }
+
+        Json::Value GetSharedGroupDataRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GetMembers; ToJsonUtilP(GetMembers, each_GetMembers); ToJsonField(output, keyGetMembers) = each_GetMembers;
+            Json::Value each_Keys; ToJsonUtilS(Keys, each_Keys); ToJsonField(output, keyKeys) = each_Keys;
+            Json::Value each_SharedGroupId; ToJsonUtilS(SharedGroupId, each_SharedGroupId); ToJsonField(output, keySharedGroupId) = each_SharedGroupId;
+            return output;
+        }
+
+        void SharedGroupDataRecord::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilT(FromJsonField(input, keyLastUpdated), LastUpdated);
+            FromJsonUtilS(FromJsonField(input, keyLastUpdatedBy), LastUpdatedBy);
+            FromJsonUtilE(FromJsonField(input, keyPermission), Permission);
+            FromJsonUtilS(FromJsonField(input, keyValue), Value);
+        }
+
+        Json::Value SharedGroupDataRecord::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_LastUpdated; ToJsonUtilT(LastUpdated, each_LastUpdated); ToJsonField(output, keyLastUpdated) = each_LastUpdated;
+            Json::Value each_LastUpdatedBy; ToJsonUtilS(LastUpdatedBy, each_LastUpdatedBy); ToJsonField(output, keyLastUpdatedBy) = each_LastUpdatedBy;
+            Json::Value each_Permission; ToJsonUtilE(Permission, each_Permission); ToJsonField(output, keyPermission) = each_Permission;
+            Json::Value each_Value; ToJsonUtilS(Value, each_Value); ToJsonField(output, keyValue) = each_Value;
+            return output;
+        }
+
+        void GetSharedGroupDataResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyData), Data);
+            FromJsonUtilS(FromJsonField(input, keyMembers), Members);
+        }
+
+        Json::Value GetSharedGroupDataResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Data; ToJsonUtilO(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            Json::Value each_Members; ToJsonUtilS(Members, each_Members); ToJsonField(output, keyMembers) = each_Members;
+            return output;
+        }
+
+        void GetStoreItemsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyStoreId), StoreId);
+        }
+
+        Json::Value GetStoreItemsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_StoreId; ToJsonUtilS(StoreId, each_StoreId); ToJsonField(output, keyStoreId) = each_StoreId;
+            return output;
+        }
+
+        void StoreMarketingModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyDescription), Description);
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+            Metadata = FromJsonField(input, keyMetadata);
+        }
+
+        Json::Value StoreMarketingModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Description; ToJsonUtilS(Description, each_Description); ToJsonField(output, keyDescription) = each_Description;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            ToJsonField(output, keyMetadata) = Metadata;
+            return output;
+        }
+
+        void StoreItem::FromJson(const Json::Value& input)
+        {
+            CustomData = FromJsonField(input, keyCustomData);
+            FromJsonUtilP(FromJsonField(input, keyDisplayPosition), DisplayPosition);
+            FromJsonUtilS(FromJsonField(input, keyItemId), ItemId);
+            FromJsonUtilP(FromJsonField(input, keyRealCurrencyPrices), RealCurrencyPrices);
+            FromJsonUtilP(FromJsonField(input, keyVirtualCurrencyPrices), VirtualCurrencyPrices);
+        }
+
+        Json::Value StoreItem::ToJson() const
+        {
+            Json::Value output;
+            ToJsonField(output, keyCustomData) = CustomData;
+            Json::Value each_DisplayPosition; ToJsonUtilP(DisplayPosition, each_DisplayPosition); ToJsonField(output, keyDisplayPosition) = each_DisplayPosition;
+            Json::Value each_ItemId; ToJsonUtilS(ItemId, each_ItemId); ToJsonField(output, keyItemId) = each_ItemId;
+            Json::Value each_RealCurrencyPrices; ToJsonUtilP(RealCurrencyPrices, each_RealCurrencyPrices); ToJsonField(output, keyRealCurrencyPrices) = each_RealCurrencyPrices;
+            Json::Value each_VirtualCurrencyPrices; ToJsonUtilP(VirtualCurrencyPrices, each_VirtualCurrencyPrices); ToJsonField(output, keyVirtualCurrencyPrices) = each_VirtualCurrencyPrices;
+            return output;
+        }
+
+        void GetStoreItemsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilO(FromJsonField(input, keyMarketingData), MarketingData);
+            FromJsonUtilE(FromJsonField(input, keySource), Source);
+            FromJsonUtilO(FromJsonField(input, keyStore), Store);
+            FromJsonUtilS(FromJsonField(input, keyStoreId), StoreId);
+        }
+
+        Json::Value GetStoreItemsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_MarketingData; ToJsonUtilO(MarketingData, each_MarketingData); ToJsonField(output, keyMarketingData) = each_MarketingData;
+            Json::Value each_Source; ToJsonUtilE(Source, each_Source); ToJsonField(output, keySource) = each_Source;
+            Json::Value each_Store; ToJsonUtilO(Store, each_Store); ToJsonField(output, keyStore) = each_Store;
+            Json::Value each_StoreId; ToJsonUtilS(StoreId, each_StoreId); ToJsonField(output, keyStoreId) = each_StoreId;
+            return output;
+        }
+
+        void GetTimeRequest::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value GetTimeRequest::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void GetTimeResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilT(FromJsonField(input, keyTime), Time);
+        }
+
+        Json::Value GetTimeResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Time; ToJsonUtilT(Time, each_Time); ToJsonField(output, keyTime) = each_Time;
+            return output;
+        }
+
+        void GetTitleDataRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyKeys), Keys);
+            FromJsonUtilS(FromJsonField(input, keyOverrideLabel), OverrideLabel);
+        }
+
+        Json::Value GetTitleDataRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Keys; ToJsonUtilS(Keys, each_Keys); ToJsonField(output, keyKeys) = each_Keys;
+            Json::Value each_OverrideLabel; ToJsonUtilS(OverrideLabel, each_OverrideLabel); ToJsonField(output, keyOverrideLabel) = each_OverrideLabel;
+            return output;
+        }
+
+        void GetTitleDataResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyData), Data);
+        }
+
+        Json::Value GetTitleDataResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Data; ToJsonUtilS(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            return output;
+        }
+
+        void GetTitleNewsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyCount), Count);
+        }
+
+        Json::Value GetTitleNewsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Count; ToJsonUtilP(Count, each_Count); ToJsonField(output, keyCount) = each_Count;
+            return output;
+        }
+
+        void TitleNewsItem::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBody), Body);
+            FromJsonUtilS(FromJsonField(input, keyNewsId), NewsId);
+            FromJsonUtilT(FromJsonField(input, keyTimestamp), Timestamp);
+            FromJsonUtilS(FromJsonField(input, keyTitle), Title);
+        }
+
+        Json::Value TitleNewsItem::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Body; ToJsonUtilS(Body, each_Body); ToJsonField(output, keyBody) = each_Body;
+            Json::Value each_NewsId; ToJsonUtilS(NewsId, each_NewsId); ToJsonField(output, keyNewsId) = each_NewsId;
+            Json::Value each_Timestamp; ToJsonUtilT(Timestamp, each_Timestamp); ToJsonField(output, keyTimestamp) = each_Timestamp;
+            Json::Value each_Title; ToJsonUtilS(Title, each_Title); ToJsonField(output, keyTitle) = each_Title;
+            return output;
+        }
+
+        void GetTitleNewsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyNews), News);
+        }
+
+        Json::Value GetTitleNewsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_News; ToJsonUtilO(News, each_News); ToJsonField(output, keyNews) = each_News;
+            return output;
+        }
+
+        void GetTitlePublicKeyRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+            FromJsonUtilS(FromJsonField(input, keyTitleSharedSecret), TitleSharedSecret);
+        }
+
+        Json::Value GetTitlePublicKeyRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            Json::Value each_TitleSharedSecret; ToJsonUtilS(TitleSharedSecret, each_TitleSharedSecret); ToJsonField(output, keyTitleSharedSecret) = each_TitleSharedSecret;
+            return output;
+        }
+
+        void GetTitlePublicKeyResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyRSAPublicKey), RSAPublicKey);
+        }
+
+        Json::Value GetTitlePublicKeyResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_RSAPublicKey; ToJsonUtilS(RSAPublicKey, each_RSAPublicKey); ToJsonField(output, keyRSAPublicKey) = each_RSAPublicKey;
+            return output;
+        }
+
+        void GetTradeStatusRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyOfferingPlayerId), OfferingPlayerId);
+            FromJsonUtilS(FromJsonField(input, keyTradeId), TradeId);
+        }
+
+        Json::Value GetTradeStatusRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_OfferingPlayerId; ToJsonUtilS(OfferingPlayerId, each_OfferingPlayerId); ToJsonField(output, keyOfferingPlayerId) = each_OfferingPlayerId;
+            Json::Value each_TradeId; ToJsonUtilS(TradeId, each_TradeId); ToJsonField(output, keyTradeId) = each_TradeId;
+            return output;
+        }
+
+        void GetTradeStatusResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyTrade), Trade);
+        }
+
+        Json::Value GetTradeStatusResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Trade; ToJsonUtilO(Trade, each_Trade); ToJsonField(output, keyTrade) = each_Trade;
+            return output;
+        }
+
+        void GetUserDataRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyIfChangedFromDataVersion), IfChangedFromDataVersion);
+            FromJsonUtilS(FromJsonField(input, keyKeys), Keys);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GetUserDataRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_IfChangedFromDataVersion; ToJsonUtilP(IfChangedFromDataVersion, each_IfChangedFromDataVersion); ToJsonField(output, keyIfChangedFromDataVersion) = each_IfChangedFromDataVersion;
+            Json::Value each_Keys; ToJsonUtilS(Keys, each_Keys); ToJsonField(output, keyKeys) = each_Keys;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void GetUserDataResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyData), Data);
+            FromJsonUtilP(FromJsonField(input, keyDataVersion), DataVersion);
+        }
+
+        Json::Value GetUserDataResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Data; ToJsonUtilO(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            Json::Value each_DataVersion; ToJsonUtilP(DataVersion, each_DataVersion); ToJsonField(output, keyDataVersion) = each_DataVersion;
+            return output;
+        }
+
+        void GetUserInventoryRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value GetUserInventoryRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void GetUserInventoryResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyInventory), Inventory);
+            FromJsonUtilP(FromJsonField(input, keyVirtualCurrency), VirtualCurrency);
+            FromJsonUtilO(FromJsonField(input, keyVirtualCurrencyRechargeTimes), VirtualCurrencyRechargeTimes);
+        }
+
+        Json::Value GetUserInventoryResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Inventory; ToJsonUtilO(Inventory, each_Inventory); ToJsonField(output, keyInventory) = each_Inventory;
+            Json::Value each_VirtualCurrency; ToJsonUtilP(VirtualCurrency, each_VirtualCurrency); ToJsonField(output, keyVirtualCurrency) = each_VirtualCurrency;
+            Json::Value each_VirtualCurrencyRechargeTimes; ToJsonUtilO(VirtualCurrencyRechargeTimes, each_VirtualCurrencyRechargeTimes); ToJsonField(output, keyVirtualCurrencyRechargeTimes) = each_VirtualCurrencyRechargeTimes;
+            return output;
+        }
+
+        void GetWindowsHelloChallengeRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPublicKeyHint), PublicKeyHint);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+        }
+
+        Json::Value GetWindowsHelloChallengeRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PublicKeyHint; ToJsonUtilS(PublicKeyHint, each_PublicKeyHint); ToJsonField(output, keyPublicKeyHint) = each_PublicKeyHint;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            return output;
+        }
+
+        void GetWindowsHelloChallengeResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyChallenge), Challenge);
+        }
+
+        Json::Value GetWindowsHelloChallengeResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Challenge; ToJsonUtilS(Challenge, each_Challenge); ToJsonField(output, keyChallenge) = each_Challenge;
+            return output;
+        }
+
+        void GrantCharacterToUserRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCharacterName), CharacterName);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyItemId), ItemId);
+        }
+
+        Json::Value GrantCharacterToUserRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CharacterName; ToJsonUtilS(CharacterName, each_CharacterName); ToJsonField(output, keyCharacterName) = each_CharacterName;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ItemId; ToJsonUtilS(ItemId, each_ItemId); ToJsonField(output, keyItemId) = each_ItemId;
+            return output;
+        }
+
+        void GrantCharacterToUserResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyCharacterType), CharacterType);
+            FromJsonUtilP(FromJsonField(input, keyResult), Result);
+        }
+
+        Json::Value GrantCharacterToUserResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_CharacterType; ToJsonUtilS(CharacterType, each_CharacterType); ToJsonField(output, keyCharacterType) = each_CharacterType;
+            Json::Value each_Result; ToJsonUtilP(Result, each_Result); ToJsonField(output, keyResult) = each_Result;
+            return output;
+        }
+
+        void ItemPurchaseRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAnnotation), Annotation);
+            FromJsonUtilS(FromJsonField(input, keyItemId), ItemId);
+            FromJsonUtilP(FromJsonField(input, keyQuantity), Quantity);
+            FromJsonUtilS(FromJsonField(input, keyUpgradeFromItems), UpgradeFromItems);
+        }
+
+        Json::Value ItemPurchaseRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Annotation; ToJsonUtilS(Annotation, each_Annotation); ToJsonField(output, keyAnnotation) = each_Annotation;
+            Json::Value each_ItemId; ToJsonUtilS(ItemId, each_ItemId); ToJsonField(output, keyItemId) = each_ItemId;
+            Json::Value each_Quantity; ToJsonUtilP(Quantity, each_Quantity); ToJsonField(output, keyQuantity) = each_Quantity;
+            Json::Value each_UpgradeFromItems; ToJsonUtilS(UpgradeFromItems, each_UpgradeFromItems); ToJsonField(output, keyUpgradeFromItems) = each_UpgradeFromItems;
+            return output;
+        }
+
+        void LinkAndroidDeviceIDRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAndroidDevice), AndroidDevice);
+            FromJsonUtilS(FromJsonField(input, keyAndroidDeviceId), AndroidDeviceId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyForceLink), ForceLink);
+            FromJsonUtilS(FromJsonField(input, keyOS), OS);
+        }
+
+        Json::Value LinkAndroidDeviceIDRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AndroidDevice; ToJsonUtilS(AndroidDevice, each_AndroidDevice); ToJsonField(output, keyAndroidDevice) = each_AndroidDevice;
+            Json::Value each_AndroidDeviceId; ToJsonUtilS(AndroidDeviceId, each_AndroidDeviceId); ToJsonField(output, keyAndroidDeviceId) = each_AndroidDeviceId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); ToJsonField(output, keyForceLink) = each_ForceLink;
+            Json::Value each_OS; ToJsonUtilS(OS, each_OS); ToJsonField(output, keyOS) = each_OS;
+            return output;
+        }
+
+        void LinkAndroidDeviceIDResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value LinkAndroidDeviceIDResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void LinkAppleRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyForceLink), ForceLink);
+            FromJsonUtilS(FromJsonField(input, keyIdentityToken), IdentityToken);
+        }
+
+        Json::Value LinkAppleRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); ToJsonField(output, keyForceLink) = each_ForceLink;
+            Json::Value each_IdentityToken; ToJsonUtilS(IdentityToken, each_IdentityToken); ToJsonField(output, keyIdentityToken) = each_IdentityToken;
+            return output;
+        }
+
+        void LinkCustomIDRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomId), CustomId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyForceLink), ForceLink);
+        }
+
+        Json::Value LinkCustomIDRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomId; ToJsonUtilS(CustomId, each_CustomId); ToJsonField(output, keyCustomId) = each_CustomId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); ToJsonField(output, keyForceLink) = each_ForceLink;
+            return output;
+        }
+
+        void LinkCustomIDResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value LinkCustomIDResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void LinkFacebookAccountRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAccessToken), AccessToken);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyForceLink), ForceLink);
+        }
+
+        Json::Value LinkFacebookAccountRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AccessToken; ToJsonUtilS(AccessToken, each_AccessToken); ToJsonField(output, keyAccessToken) = each_AccessToken;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); ToJsonField(output, keyForceLink) = each_ForceLink;
+            return output;
+        }
+
+        void LinkFacebookAccountResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value LinkFacebookAccountResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void LinkFacebookInstantGamesIdRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyFacebookInstantGamesSignature), FacebookInstantGamesSignature);
+            FromJsonUtilP(FromJsonField(input, keyForceLink), ForceLink);
+        }
+
+        Json::Value LinkFacebookInstantGamesIdRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_FacebookInstantGamesSignature; ToJsonUtilS(FacebookInstantGamesSignature, each_FacebookInstantGamesSignature); ToJsonField(output, keyFacebookInstantGamesSignature) = each_FacebookInstantGamesSignature;
+            Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); ToJsonField(output, keyForceLink) = each_ForceLink;
+            return output;
+        }
+
+        void LinkFacebookInstantGamesIdResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value LinkFacebookInstantGamesIdResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void LinkGameCenterAccountRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyForceLink), ForceLink);
+            FromJsonUtilS(FromJsonField(input, keyGameCenterId), GameCenterId);
+            FromJsonUtilS(FromJsonField(input, keyPublicKeyUrl), PublicKeyUrl);
+            FromJsonUtilS(FromJsonField(input, keySalt), Salt);
+            FromJsonUtilS(FromJsonField(input, keySignature), Signature);
+            FromJsonUtilS(FromJsonField(input, keyTimestamp), Timestamp);
+        }
+
+        Json::Value LinkGameCenterAccountRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); ToJsonField(output, keyForceLink) = each_ForceLink;
+            Json::Value each_GameCenterId; ToJsonUtilS(GameCenterId, each_GameCenterId); ToJsonField(output, keyGameCenterId) = each_GameCenterId;
+            Json::Value each_PublicKeyUrl; ToJsonUtilS(PublicKeyUrl, each_PublicKeyUrl); ToJsonField(output, keyPublicKeyUrl) = each_PublicKeyUrl;
+            Json::Value each_Salt; ToJsonUtilS(Salt, each_Salt); ToJsonField(output, keySalt) = each_Salt;
+            Json::Value each_Signature; ToJsonUtilS(Signature, each_Signature); ToJsonField(output, keySignature) = each_Signature;
+            Json::Value each_Timestamp; ToJsonUtilS(Timestamp, each_Timestamp); ToJsonField(output, keyTimestamp) = each_Timestamp;
+            return output;
+        }
+
+        void LinkGameCenterAccountResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value LinkGameCenterAccountResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void LinkGoogleAccountRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyForceLink), ForceLink);
+            FromJsonUtilS(FromJsonField(input, keyServerAuthCode), ServerAuthCode);
+        }
+
+        Json::Value LinkGoogleAccountRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); ToJsonField(output, keyForceLink) = each_ForceLink;
+            Json::Value each_ServerAuthCode; ToJsonUtilS(ServerAuthCode, each_ServerAuthCode); ToJsonField(output, keyServerAuthCode) = each_ServerAuthCode;
+            return output;
+        }
+
+        void LinkGoogleAccountResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value LinkGoogleAccountResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void LinkIOSDeviceIDRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyDeviceId), DeviceId);
+            FromJsonUtilS(FromJsonField(input, keyDeviceModel), DeviceModel);
+            FromJsonUtilP(FromJsonField(input, keyForceLink), ForceLink);
+            FromJsonUtilS(FromJsonField(input, keyOS), OS);
+        }
+
+        Json::Value LinkIOSDeviceIDRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_DeviceId; ToJsonUtilS(DeviceId, each_DeviceId); ToJsonField(output, keyDeviceId) = each_DeviceId;
+            Json::Value each_DeviceModel; ToJsonUtilS(DeviceModel, each_DeviceModel); ToJsonField(output, keyDeviceModel) = each_DeviceModel;
+            Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); ToJsonField(output, keyForceLink) = each_ForceLink;
+            Json::Value each_OS; ToJsonUtilS(OS, each_OS); ToJsonField(output, keyOS) = each_OS;
+            return output;
+        }
+
+        void LinkIOSDeviceIDResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value LinkIOSDeviceIDResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void LinkKongregateAccountRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAuthTicket), AuthTicket);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyForceLink), ForceLink);
+            FromJsonUtilS(FromJsonField(input, keyKongregateId), KongregateId);
+        }
+
+        Json::Value LinkKongregateAccountRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AuthTicket; ToJsonUtilS(AuthTicket, each_AuthTicket); ToJsonField(output, keyAuthTicket) = each_AuthTicket;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); ToJsonField(output, keyForceLink) = each_ForceLink;
+            Json::Value each_KongregateId; ToJsonUtilS(KongregateId, each_KongregateId); ToJsonField(output, keyKongregateId) = each_KongregateId;
+            return output;
+        }
+
+        void LinkKongregateAccountResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value LinkKongregateAccountResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void LinkNintendoServiceAccountRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyForceLink), ForceLink);
+            FromJsonUtilS(FromJsonField(input, keyIdentityToken), IdentityToken);
+        }
+
+        Json::Value LinkNintendoServiceAccountRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); ToJsonField(output, keyForceLink) = each_ForceLink;
+            Json::Value each_IdentityToken; ToJsonUtilS(IdentityToken, each_IdentityToken); ToJsonField(output, keyIdentityToken) = each_IdentityToken;
+            return output;
+        }
+
+        void LinkNintendoSwitchDeviceIdRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyForceLink), ForceLink);
+            FromJsonUtilS(FromJsonField(input, keyNintendoSwitchDeviceId), NintendoSwitchDeviceId);
+        }
+
+        Json::Value LinkNintendoSwitchDeviceIdRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); ToJsonField(output, keyForceLink) = each_ForceLink;
+            Json::Value each_NintendoSwitchDeviceId; ToJsonUtilS(NintendoSwitchDeviceId, each_NintendoSwitchDeviceId); ToJsonField(output, keyNintendoSwitchDeviceId) = each_NintendoSwitchDeviceId;
+            return output;
+        }
+
+        void LinkNintendoSwitchDeviceIdResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value LinkNintendoSwitchDeviceIdResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void LinkOpenIdConnectRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyConnectionId), ConnectionId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyForceLink), ForceLink);
+            FromJsonUtilS(FromJsonField(input, keyIdToken), IdToken);
+        }
+
+        Json::Value LinkOpenIdConnectRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ConnectionId; ToJsonUtilS(ConnectionId, each_ConnectionId); ToJsonField(output, keyConnectionId) = each_ConnectionId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); ToJsonField(output, keyForceLink) = each_ForceLink;
+            Json::Value each_IdToken; ToJsonUtilS(IdToken, each_IdToken); ToJsonField(output, keyIdToken) = each_IdToken;
+            return output;
+        }
+
+        void LinkPSNAccountRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAuthCode), AuthCode);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyForceLink), ForceLink);
+            FromJsonUtilP(FromJsonField(input, keyIssuerId), IssuerId);
+            FromJsonUtilS(FromJsonField(input, keyRedirectUri), RedirectUri);
+        }
+
+        Json::Value LinkPSNAccountRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AuthCode; ToJsonUtilS(AuthCode, each_AuthCode); ToJsonField(output, keyAuthCode) = each_AuthCode;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); ToJsonField(output, keyForceLink) = each_ForceLink;
+            Json::Value each_IssuerId; ToJsonUtilP(IssuerId, each_IssuerId); ToJsonField(output, keyIssuerId) = each_IssuerId;
+            Json::Value each_RedirectUri; ToJsonUtilS(RedirectUri, each_RedirectUri); ToJsonField(output, keyRedirectUri) = each_RedirectUri;
+            return output;
+        }
+
+        void LinkPSNAccountResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value LinkPSNAccountResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void LinkSteamAccountRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyForceLink), ForceLink);
+            FromJsonUtilS(FromJsonField(input, keySteamTicket), SteamTicket);
+        }
+
+        Json::Value LinkSteamAccountRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); ToJsonField(output, keyForceLink) = each_ForceLink;
+            Json::Value each_SteamTicket; ToJsonUtilS(SteamTicket, each_SteamTicket); ToJsonField(output, keySteamTicket) = each_SteamTicket;
+            return output;
+        }
+
+        void LinkSteamAccountResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value LinkSteamAccountResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void LinkTwitchAccountRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAccessToken), AccessToken);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyForceLink), ForceLink);
+        }
+
+        Json::Value LinkTwitchAccountRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AccessToken; ToJsonUtilS(AccessToken, each_AccessToken); ToJsonField(output, keyAccessToken) = each_AccessToken;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); ToJsonField(output, keyForceLink) = each_ForceLink;
+            return output;
+        }
+
+        void LinkTwitchAccountResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value LinkTwitchAccountResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void LinkWindowsHelloAccountRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyDeviceName), DeviceName);
+            FromJsonUtilP(FromJsonField(input, keyForceLink), ForceLink);
+            FromJsonUtilS(FromJsonField(input, keyPublicKey), PublicKey);
+            FromJsonUtilS(FromJsonField(input, keyUserName), UserName);
+        }
+
+        Json::Value LinkWindowsHelloAccountRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_DeviceName; ToJsonUtilS(DeviceName, each_DeviceName); ToJsonField(output, keyDeviceName) = each_DeviceName;
+            Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); ToJsonField(output, keyForceLink) = each_ForceLink;
+            Json::Value each_PublicKey; ToJsonUtilS(PublicKey, each_PublicKey); ToJsonField(output, keyPublicKey) = each_PublicKey;
+            Json::Value each_UserName; ToJsonUtilS(UserName, each_UserName); ToJsonField(output, keyUserName) = each_UserName;
+            return output;
+        }
+
+        void LinkWindowsHelloAccountResponse::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value LinkWindowsHelloAccountResponse::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void LinkXboxAccountRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyForceLink), ForceLink);
+            FromJsonUtilS(FromJsonField(input, keyXboxToken), XboxToken);
+        }
+
+        Json::Value LinkXboxAccountRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); ToJsonField(output, keyForceLink) = each_ForceLink;
+            Json::Value each_XboxToken; ToJsonUtilS(XboxToken, each_XboxToken); ToJsonField(output, keyXboxToken) = each_XboxToken;
+            return output;
+        }
+
+        void LinkXboxAccountResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value LinkXboxAccountResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void ListUsersCharactersRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value ListUsersCharactersRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void ListUsersCharactersResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyCharacters), Characters);
+        }
+
+        Json::Value ListUsersCharactersResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Characters; ToJsonUtilO(Characters, each_Characters); ToJsonField(output, keyCharacters) = each_Characters;
+            return output;
+        }
+
+        void UserSettings::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyGatherDeviceInfo), GatherDeviceInfo);
+            FromJsonUtilP(FromJsonField(input, keyGatherFocusInfo), GatherFocusInfo);
+            FromJsonUtilP(FromJsonField(input, keyNeedsAttribution), NeedsAttribution);
+        }
+
+        Json::Value UserSettings::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GatherDeviceInfo; ToJsonUtilP(GatherDeviceInfo, each_GatherDeviceInfo); ToJsonField(output, keyGatherDeviceInfo) = each_GatherDeviceInfo;
+            Json::Value each_GatherFocusInfo; ToJsonUtilP(GatherFocusInfo, each_GatherFocusInfo); ToJsonField(output, keyGatherFocusInfo) = each_GatherFocusInfo;
+            Json::Value each_NeedsAttribution; ToJsonUtilP(NeedsAttribution, each_NeedsAttribution); ToJsonField(output, keyNeedsAttribution) = each_NeedsAttribution;
+            return output;
+        }
+
+        void Variable::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilS(FromJsonField(input, keyValue), Value);
+        }
+
+        Json::Value Variable::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_Value; ToJsonUtilS(Value, each_Value); ToJsonField(output, keyValue) = each_Value;
+            return output;
+        }
+
+        void TreatmentAssignment::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyVariables), Variables);
+            FromJsonUtilS(FromJsonField(input, keyVariants), Variants);
+        }
+
+        Json::Value TreatmentAssignment::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Variables; ToJsonUtilO(Variables, each_Variables); ToJsonField(output, keyVariables) = each_Variables;
+            Json::Value each_Variants; ToJsonUtilS(Variants, each_Variants); ToJsonField(output, keyVariants) = each_Variants;
+            return output;
+        }
+
+        void LoginResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyEntityToken), EntityToken);
+            FromJsonUtilO(FromJsonField(input, keyInfoResultPayload), InfoResultPayload);
+            FromJsonUtilT(FromJsonField(input, keyLastLoginTime), LastLoginTime);
+            FromJsonUtilP(FromJsonField(input, keyNewlyCreated), NewlyCreated);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keySessionTicket), SessionTicket);
+            FromJsonUtilO(FromJsonField(input, keySettingsForUser), SettingsForUser);
+            FromJsonUtilO(FromJsonField(input, keyTreatmentAssignment), pfTreatmentAssignment);
+        }
+
+        Json::Value LoginResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_EntityToken; ToJsonUtilO(EntityToken, each_EntityToken); ToJsonField(output, keyEntityToken) = each_EntityToken;
+            Json::Value each_InfoResultPayload; ToJsonUtilO(InfoResultPayload, each_InfoResultPayload); ToJsonField(output, keyInfoResultPayload) = each_InfoResultPayload;
+            Json::Value each_LastLoginTime; ToJsonUtilT(LastLoginTime, each_LastLoginTime); ToJsonField(output, keyLastLoginTime) = each_LastLoginTime;
+            Json::Value each_NewlyCreated; ToJsonUtilP(NewlyCreated, each_NewlyCreated); ToJsonField(output, keyNewlyCreated) = each_NewlyCreated;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_SessionTicket; ToJsonUtilS(SessionTicket, each_SessionTicket); ToJsonField(output, keySessionTicket) = each_SessionTicket;
+            Json::Value each_SettingsForUser; ToJsonUtilO(SettingsForUser, each_SettingsForUser); ToJsonField(output, keySettingsForUser) = each_SettingsForUser;
+            Json::Value each_pfTreatmentAssignment; ToJsonUtilO(pfTreatmentAssignment, each_pfTreatmentAssignment); ToJsonField(output, keyTreatmentAssignment) = each_pfTreatmentAssignment;
+            return output;
+        }
+
+        void LoginWithAndroidDeviceIDRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAndroidDevice), AndroidDevice);
+            FromJsonUtilS(FromJsonField(input, keyAndroidDeviceId), AndroidDeviceId);
+            FromJsonUtilP(FromJsonField(input, keyCreateAccount), CreateAccount);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyEncryptedRequest), EncryptedRequest);
+            FromJsonUtilO(FromJsonField(input, keyInfoRequestParameters), InfoRequestParameters);
+            FromJsonUtilS(FromJsonField(input, keyOS), OS);
+            FromJsonUtilS(FromJsonField(input, keyPlayerSecret), PlayerSecret);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+        }
+
+        Json::Value LoginWithAndroidDeviceIDRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AndroidDevice; ToJsonUtilS(AndroidDevice, each_AndroidDevice); ToJsonField(output, keyAndroidDevice) = each_AndroidDevice;
+            Json::Value each_AndroidDeviceId; ToJsonUtilS(AndroidDeviceId, each_AndroidDeviceId); ToJsonField(output, keyAndroidDeviceId) = each_AndroidDeviceId;
+            Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); ToJsonField(output, keyCreateAccount) = each_CreateAccount;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); ToJsonField(output, keyEncryptedRequest) = each_EncryptedRequest;
+            Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); ToJsonField(output, keyInfoRequestParameters) = each_InfoRequestParameters;
+            Json::Value each_OS; ToJsonUtilS(OS, each_OS); ToJsonField(output, keyOS) = each_OS;
+            Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); ToJsonField(output, keyPlayerSecret) = each_PlayerSecret;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            return output;
+        }
+
+        void LoginWithAppleRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyCreateAccount), CreateAccount);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyEncryptedRequest), EncryptedRequest);
+            FromJsonUtilS(FromJsonField(input, keyIdentityToken), IdentityToken);
+            FromJsonUtilO(FromJsonField(input, keyInfoRequestParameters), InfoRequestParameters);
+            FromJsonUtilS(FromJsonField(input, keyPlayerSecret), PlayerSecret);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+        }
+
+        Json::Value LoginWithAppleRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); ToJsonField(output, keyCreateAccount) = each_CreateAccount;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); ToJsonField(output, keyEncryptedRequest) = each_EncryptedRequest;
+            Json::Value each_IdentityToken; ToJsonUtilS(IdentityToken, each_IdentityToken); ToJsonField(output, keyIdentityToken) = each_IdentityToken;
+            Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); ToJsonField(output, keyInfoRequestParameters) = each_InfoRequestParameters;
+            Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); ToJsonField(output, keyPlayerSecret) = each_PlayerSecret;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            return output;
+        }
+
+        void LoginWithCustomIDRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyCreateAccount), CreateAccount);
+            FromJsonUtilS(FromJsonField(input, keyCustomId), CustomId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyEncryptedRequest), EncryptedRequest);
+            FromJsonUtilO(FromJsonField(input, keyInfoRequestParameters), InfoRequestParameters);
+            FromJsonUtilS(FromJsonField(input, keyPlayerSecret), PlayerSecret);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+        }
+
+        Json::Value LoginWithCustomIDRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); ToJsonField(output, keyCreateAccount) = each_CreateAccount;
+            Json::Value each_CustomId; ToJsonUtilS(CustomId, each_CustomId); ToJsonField(output, keyCustomId) = each_CustomId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); ToJsonField(output, keyEncryptedRequest) = each_EncryptedRequest;
+            Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); ToJsonField(output, keyInfoRequestParameters) = each_InfoRequestParameters;
+            Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); ToJsonField(output, keyPlayerSecret) = each_PlayerSecret;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            return output;
+        }
+
+        void LoginWithEmailAddressRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyEmail), Email);
+            FromJsonUtilO(FromJsonField(input, keyInfoRequestParameters), InfoRequestParameters);
+            FromJsonUtilS(FromJsonField(input, keyPassword), Password);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+        }
+
+        Json::Value LoginWithEmailAddressRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Email; ToJsonUtilS(Email, each_Email); ToJsonField(output, keyEmail) = each_Email;
+            Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); ToJsonField(output, keyInfoRequestParameters) = each_InfoRequestParameters;
+            Json::Value each_Password; ToJsonUtilS(Password, each_Password); ToJsonField(output, keyPassword) = each_Password;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            return output;
+        }
+
+        void LoginWithFacebookInstantGamesIdRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyCreateAccount), CreateAccount);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyEncryptedRequest), EncryptedRequest);
+            FromJsonUtilS(FromJsonField(input, keyFacebookInstantGamesSignature), FacebookInstantGamesSignature);
+            FromJsonUtilO(FromJsonField(input, keyInfoRequestParameters), InfoRequestParameters);
+            FromJsonUtilS(FromJsonField(input, keyPlayerSecret), PlayerSecret);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+        }
+
+        Json::Value LoginWithFacebookInstantGamesIdRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); ToJsonField(output, keyCreateAccount) = each_CreateAccount;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); ToJsonField(output, keyEncryptedRequest) = each_EncryptedRequest;
+            Json::Value each_FacebookInstantGamesSignature; ToJsonUtilS(FacebookInstantGamesSignature, each_FacebookInstantGamesSignature); ToJsonField(output, keyFacebookInstantGamesSignature) = each_FacebookInstantGamesSignature;
+            Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); ToJsonField(output, keyInfoRequestParameters) = each_InfoRequestParameters;
+            Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); ToJsonField(output, keyPlayerSecret) = each_PlayerSecret;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            return output;
+        }
+
+        void LoginWithFacebookRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAccessToken), AccessToken);
+            FromJsonUtilP(FromJsonField(input, keyCreateAccount), CreateAccount);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyEncryptedRequest), EncryptedRequest);
+            FromJsonUtilO(FromJsonField(input, keyInfoRequestParameters), InfoRequestParameters);
+            FromJsonUtilS(FromJsonField(input, keyPlayerSecret), PlayerSecret);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+        }
+
+        Json::Value LoginWithFacebookRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AccessToken; ToJsonUtilS(AccessToken, each_AccessToken); ToJsonField(output, keyAccessToken) = each_AccessToken;
+            Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); ToJsonField(output, keyCreateAccount) = each_CreateAccount;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); ToJsonField(output, keyEncryptedRequest) = each_EncryptedRequest;
+            Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); ToJsonField(output, keyInfoRequestParameters) = each_InfoRequestParameters;
+            Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); ToJsonField(output, keyPlayerSecret) = each_PlayerSecret;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            return output;
+        }
+
+        void LoginWithGameCenterRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyCreateAccount), CreateAccount);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyEncryptedRequest), EncryptedRequest);
+            FromJsonUtilO(FromJsonField(input, keyInfoRequestParameters), InfoRequestParameters);
+            FromJsonUtilS(FromJsonField(input, keyPlayerId), PlayerId);
+            FromJsonUtilS(FromJsonField(input, keyPlayerSecret), PlayerSecret);
+            FromJsonUtilS(FromJsonField(input, keyPublicKeyUrl), PublicKeyUrl);
+            FromJsonUtilS(FromJsonField(input, keySalt), Salt);
+            FromJsonUtilS(FromJsonField(input, keySignature), Signature);
+            FromJsonUtilS(FromJsonField(input, keyTimestamp), Timestamp);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+        }
+
+        Json::Value LoginWithGameCenterRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); ToJsonField(output, keyCreateAccount) = each_CreateAccount;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); ToJsonField(output, keyEncryptedRequest) = each_EncryptedRequest;
+            Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); ToJsonField(output, keyInfoRequestParameters) = each_InfoRequestParameters;
+            Json::Value each_PlayerId; ToJsonUtilS(PlayerId, each_PlayerId); ToJsonField(output, keyPlayerId) = each_PlayerId;
+            Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); ToJsonField(output, keyPlayerSecret) = each_PlayerSecret;
+            Json::Value each_PublicKeyUrl; ToJsonUtilS(PublicKeyUrl, each_PublicKeyUrl); ToJsonField(output, keyPublicKeyUrl) = each_PublicKeyUrl;
+            Json::Value each_Salt; ToJsonUtilS(Salt, each_Salt); ToJsonField(output, keySalt) = each_Salt;
+            Json::Value each_Signature; ToJsonUtilS(Signature, each_Signature); ToJsonField(output, keySignature) = each_Signature;
+            Json::Value each_Timestamp; ToJsonUtilS(Timestamp, each_Timestamp); ToJsonField(output, keyTimestamp) = each_Timestamp;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            return output;
+        }
+
+        void LoginWithGoogleAccountRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyCreateAccount), CreateAccount);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyEncryptedRequest), EncryptedRequest);
+            FromJsonUtilO(FromJsonField(input, keyInfoRequestParameters), InfoRequestParameters);
+            FromJsonUtilS(FromJsonField(input, keyPlayerSecret), PlayerSecret);
+            FromJsonUtilS(FromJsonField(input, keyServerAuthCode), ServerAuthCode);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+        }
+
+        Json::Value LoginWithGoogleAccountRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); ToJsonField(output, keyCreateAccount) = each_CreateAccount;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); ToJsonField(output, keyEncryptedRequest) = each_EncryptedRequest;
+            Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); ToJsonField(output, keyInfoRequestParameters) = each_InfoRequestParameters;
+            Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); ToJsonField(output, keyPlayerSecret) = each_PlayerSecret;
+            Json::Value each_ServerAuthCode; ToJsonUtilS(ServerAuthCode, each_ServerAuthCode); ToJsonField(output, keyServerAuthCode) = each_ServerAuthCode;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            return output;
+        }
+
+        void LoginWithIOSDeviceIDRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyCreateAccount), CreateAccount);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyDeviceId), DeviceId);
+            FromJsonUtilS(FromJsonField(input, keyDeviceModel), DeviceModel);
+            FromJsonUtilS(FromJsonField(input, keyEncryptedRequest), EncryptedRequest);
+            FromJsonUtilO(FromJsonField(input, keyInfoRequestParameters), InfoRequestParameters);
+            FromJsonUtilS(FromJsonField(input, keyOS), OS);
+            FromJsonUtilS(FromJsonField(input, keyPlayerSecret), PlayerSecret);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+        }
+
+        Json::Value LoginWithIOSDeviceIDRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); ToJsonField(output, keyCreateAccount) = each_CreateAccount;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_DeviceId; ToJsonUtilS(DeviceId, each_DeviceId); ToJsonField(output, keyDeviceId) = each_DeviceId;
+            Json::Value each_DeviceModel; ToJsonUtilS(DeviceModel, each_DeviceModel); ToJsonField(output, keyDeviceModel) = each_DeviceModel;
+            Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); ToJsonField(output, keyEncryptedRequest) = each_EncryptedRequest;
+            Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); ToJsonField(output, keyInfoRequestParameters) = each_InfoRequestParameters;
+            Json::Value each_OS; ToJsonUtilS(OS, each_OS); ToJsonField(output, keyOS) = each_OS;
+            Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); ToJsonField(output, keyPlayerSecret) = each_PlayerSecret;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            return output;
+        }
+
+        void LoginWithKongregateRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAuthTicket), AuthTicket);
+            FromJsonUtilP(FromJsonField(input, keyCreateAccount), CreateAccount);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyEncryptedRequest), EncryptedRequest);
+            FromJsonUtilO(FromJsonField(input, keyInfoRequestParameters), InfoRequestParameters);
+            FromJsonUtilS(FromJsonField(input, keyKongregateId), KongregateId);
+            FromJsonUtilS(FromJsonField(input, keyPlayerSecret), PlayerSecret);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+        }
+
+        Json::Value LoginWithKongregateRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AuthTicket; ToJsonUtilS(AuthTicket, each_AuthTicket); ToJsonField(output, keyAuthTicket) = each_AuthTicket;
+            Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); ToJsonField(output, keyCreateAccount) = each_CreateAccount;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); ToJsonField(output, keyEncryptedRequest) = each_EncryptedRequest;
+            Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); ToJsonField(output, keyInfoRequestParameters) = each_InfoRequestParameters;
+            Json::Value each_KongregateId; ToJsonUtilS(KongregateId, each_KongregateId); ToJsonField(output, keyKongregateId) = each_KongregateId;
+            Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); ToJsonField(output, keyPlayerSecret) = each_PlayerSecret;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            return output;
+        }
+
+        void LoginWithNintendoServiceAccountRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyCreateAccount), CreateAccount);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyEncryptedRequest), EncryptedRequest);
+            FromJsonUtilS(FromJsonField(input, keyIdentityToken), IdentityToken);
+            FromJsonUtilO(FromJsonField(input, keyInfoRequestParameters), InfoRequestParameters);
+            FromJsonUtilS(FromJsonField(input, keyPlayerSecret), PlayerSecret);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+        }
+
+        Json::Value LoginWithNintendoServiceAccountRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); ToJsonField(output, keyCreateAccount) = each_CreateAccount;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); ToJsonField(output, keyEncryptedRequest) = each_EncryptedRequest;
+            Json::Value each_IdentityToken; ToJsonUtilS(IdentityToken, each_IdentityToken); ToJsonField(output, keyIdentityToken) = each_IdentityToken;
+            Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); ToJsonField(output, keyInfoRequestParameters) = each_InfoRequestParameters;
+            Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); ToJsonField(output, keyPlayerSecret) = each_PlayerSecret;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            return output;
+        }
+
+        void LoginWithNintendoSwitchDeviceIdRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyCreateAccount), CreateAccount);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyEncryptedRequest), EncryptedRequest);
+            FromJsonUtilO(FromJsonField(input, keyInfoRequestParameters), InfoRequestParameters);
+            FromJsonUtilS(FromJsonField(input, keyNintendoSwitchDeviceId), NintendoSwitchDeviceId);
+            FromJsonUtilS(FromJsonField(input, keyPlayerSecret), PlayerSecret);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+        }
+
+        Json::Value LoginWithNintendoSwitchDeviceIdRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); ToJsonField(output, keyCreateAccount) = each_CreateAccount;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); ToJsonField(output, keyEncryptedRequest) = each_EncryptedRequest;
+            Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); ToJsonField(output, keyInfoRequestParameters) = each_InfoRequestParameters;
+            Json::Value each_NintendoSwitchDeviceId; ToJsonUtilS(NintendoSwitchDeviceId, each_NintendoSwitchDeviceId); ToJsonField(output, keyNintendoSwitchDeviceId) = each_NintendoSwitchDeviceId;
+            Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); ToJsonField(output, keyPlayerSecret) = each_PlayerSecret;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            return output;
+        }
+
+        void LoginWithOpenIdConnectRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyConnectionId), ConnectionId);
+            FromJsonUtilP(FromJsonField(input, keyCreateAccount), CreateAccount);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyEncryptedRequest), EncryptedRequest);
+            FromJsonUtilS(FromJsonField(input, keyIdToken), IdToken);
+            FromJsonUtilO(FromJsonField(input, keyInfoRequestParameters), InfoRequestParameters);
+            FromJsonUtilS(FromJsonField(input, keyPlayerSecret), PlayerSecret);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+        }
+
+        Json::Value LoginWithOpenIdConnectRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ConnectionId; ToJsonUtilS(ConnectionId, each_ConnectionId); ToJsonField(output, keyConnectionId) = each_ConnectionId;
+            Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); ToJsonField(output, keyCreateAccount) = each_CreateAccount;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); ToJsonField(output, keyEncryptedRequest) = each_EncryptedRequest;
+            Json::Value each_IdToken; ToJsonUtilS(IdToken, each_IdToken); ToJsonField(output, keyIdToken) = each_IdToken;
+            Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); ToJsonField(output, keyInfoRequestParameters) = each_InfoRequestParameters;
+            Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); ToJsonField(output, keyPlayerSecret) = each_PlayerSecret;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            return output;
+        }
+
+        void LoginWithPlayFabRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyInfoRequestParameters), InfoRequestParameters);
+            FromJsonUtilS(FromJsonField(input, keyPassword), Password);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+            FromJsonUtilS(FromJsonField(input, keyUsername), Username);
+        }
+
+        Json::Value LoginWithPlayFabRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); ToJsonField(output, keyInfoRequestParameters) = each_InfoRequestParameters;
+            Json::Value each_Password; ToJsonUtilS(Password, each_Password); ToJsonField(output, keyPassword) = each_Password;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            Json::Value each_Username; ToJsonUtilS(Username, each_Username); ToJsonField(output, keyUsername) = each_Username;
+            return output;
+        }
+
+        void LoginWithPSNRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAuthCode), AuthCode);
+            FromJsonUtilP(FromJsonField(input, keyCreateAccount), CreateAccount);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyEncryptedRequest), EncryptedRequest);
+            FromJsonUtilO(FromJsonField(input, keyInfoRequestParameters), InfoRequestParameters);
+            FromJsonUtilP(FromJsonField(input, keyIssuerId), IssuerId);
+            FromJsonUtilS(FromJsonField(input, keyPlayerSecret), PlayerSecret);
+            FromJsonUtilS(FromJsonField(input, keyRedirectUri), RedirectUri);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+        }
+
+        Json::Value LoginWithPSNRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AuthCode; ToJsonUtilS(AuthCode, each_AuthCode); ToJsonField(output, keyAuthCode) = each_AuthCode;
+            Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); ToJsonField(output, keyCreateAccount) = each_CreateAccount;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); ToJsonField(output, keyEncryptedRequest) = each_EncryptedRequest;
+            Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); ToJsonField(output, keyInfoRequestParameters) = each_InfoRequestParameters;
+            Json::Value each_IssuerId; ToJsonUtilP(IssuerId, each_IssuerId); ToJsonField(output, keyIssuerId) = each_IssuerId;
+            Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); ToJsonField(output, keyPlayerSecret) = each_PlayerSecret;
+            Json::Value each_RedirectUri; ToJsonUtilS(RedirectUri, each_RedirectUri); ToJsonField(output, keyRedirectUri) = each_RedirectUri;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            return output;
+        }
+
+        void LoginWithSteamRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyCreateAccount), CreateAccount);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyEncryptedRequest), EncryptedRequest);
+            FromJsonUtilO(FromJsonField(input, keyInfoRequestParameters), InfoRequestParameters);
+            FromJsonUtilS(FromJsonField(input, keyPlayerSecret), PlayerSecret);
+            FromJsonUtilS(FromJsonField(input, keySteamTicket), SteamTicket);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+        }
+
+        Json::Value LoginWithSteamRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); ToJsonField(output, keyCreateAccount) = each_CreateAccount;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); ToJsonField(output, keyEncryptedRequest) = each_EncryptedRequest;
+            Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); ToJsonField(output, keyInfoRequestParameters) = each_InfoRequestParameters;
+            Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); ToJsonField(output, keyPlayerSecret) = each_PlayerSecret;
+            Json::Value each_SteamTicket; ToJsonUtilS(SteamTicket, each_SteamTicket); ToJsonField(output, keySteamTicket) = each_SteamTicket;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            return output;
+        }
+
+        void LoginWithTwitchRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAccessToken), AccessToken);
+            FromJsonUtilP(FromJsonField(input, keyCreateAccount), CreateAccount);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyEncryptedRequest), EncryptedRequest);
+            FromJsonUtilO(FromJsonField(input, keyInfoRequestParameters), InfoRequestParameters);
+            FromJsonUtilS(FromJsonField(input, keyPlayerSecret), PlayerSecret);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+        }
+
+        Json::Value LoginWithTwitchRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AccessToken; ToJsonUtilS(AccessToken, each_AccessToken); ToJsonField(output, keyAccessToken) = each_AccessToken;
+            Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); ToJsonField(output, keyCreateAccount) = each_CreateAccount;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); ToJsonField(output, keyEncryptedRequest) = each_EncryptedRequest;
+            Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); ToJsonField(output, keyInfoRequestParameters) = each_InfoRequestParameters;
+            Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); ToJsonField(output, keyPlayerSecret) = each_PlayerSecret;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            return output;
+        }
+
+        void LoginWithWindowsHelloRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyChallengeSignature), ChallengeSignature);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyInfoRequestParameters), InfoRequestParameters);
+            FromJsonUtilS(FromJsonField(input, keyPublicKeyHint), PublicKeyHint);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+        }
+
+        Json::Value LoginWithWindowsHelloRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ChallengeSignature; ToJsonUtilS(ChallengeSignature, each_ChallengeSignature); ToJsonField(output, keyChallengeSignature) = each_ChallengeSignature;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); ToJsonField(output, keyInfoRequestParameters) = each_InfoRequestParameters;
+            Json::Value each_PublicKeyHint; ToJsonUtilS(PublicKeyHint, each_PublicKeyHint); ToJsonField(output, keyPublicKeyHint) = each_PublicKeyHint;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            return output;
+        }
+
+        void LoginWithXboxRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyCreateAccount), CreateAccount);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyEncryptedRequest), EncryptedRequest);
+            FromJsonUtilO(FromJsonField(input, keyInfoRequestParameters), InfoRequestParameters);
+            FromJsonUtilS(FromJsonField(input, keyPlayerSecret), PlayerSecret);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+            FromJsonUtilS(FromJsonField(input, keyXboxToken), XboxToken);
+        }
+
+        Json::Value LoginWithXboxRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); ToJsonField(output, keyCreateAccount) = each_CreateAccount;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); ToJsonField(output, keyEncryptedRequest) = each_EncryptedRequest;
+            Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); ToJsonField(output, keyInfoRequestParameters) = each_InfoRequestParameters;
+            Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); ToJsonField(output, keyPlayerSecret) = each_PlayerSecret;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            Json::Value each_XboxToken; ToJsonUtilS(XboxToken, each_XboxToken); ToJsonField(output, keyXboxToken) = each_XboxToken;
+            return output;
+        }
+
+        void MatchmakeRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBuildVersion), BuildVersion);
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyGameMode), GameMode);
+            FromJsonUtilS(FromJsonField(input, keyLobbyId), LobbyId);
+            FromJsonUtilE(FromJsonField(input, keyRegion), pfRegion);
+            FromJsonUtilP(FromJsonField(input, keyStartNewIfNoneFound), StartNewIfNoneFound);
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+            FromJsonUtilO(FromJsonField(input, keyTagFilter), TagFilter);
+        }
+
+        Json::Value MatchmakeRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BuildVersion; ToJsonUtilS(BuildVersion, each_BuildVersion); ToJsonField(output, keyBuildVersion) = each_BuildVersion;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_GameMode; ToJsonUtilS(GameMode, each_GameMode); ToJsonField(output, keyGameMode) = each_GameMode;
+            Json::Value each_LobbyId; ToJsonUtilS(LobbyId, each_LobbyId); ToJsonField(output, keyLobbyId) = each_LobbyId;
+            Json::Value each_pfRegion; ToJsonUtilE(pfRegion, each_pfRegion); ToJsonField(output, keyRegion) = each_pfRegion;
+            Json::Value each_StartNewIfNoneFound; ToJsonUtilP(StartNewIfNoneFound, each_StartNewIfNoneFound); ToJsonField(output, keyStartNewIfNoneFound) = each_StartNewIfNoneFound;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            Json::Value each_TagFilter; ToJsonUtilO(TagFilter, each_TagFilter); ToJsonField(output, keyTagFilter) = each_TagFilter;
+            return output;
+        }
+
+        void MatchmakeResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyExpires), Expires);
+            FromJsonUtilS(FromJsonField(input, keyLobbyID), LobbyID);
+            FromJsonUtilP(FromJsonField(input, keyPollWaitTimeMS), PollWaitTimeMS);
+            FromJsonUtilS(FromJsonField(input, keyServerIPV4Address), ServerIPV4Address);
+            FromJsonUtilS(FromJsonField(input, keyServerIPV6Address), ServerIPV6Address);
+            FromJsonUtilP(FromJsonField(input, keyServerPort), ServerPort);
+            FromJsonUtilS(FromJsonField(input, keyServerPublicDNSName), ServerPublicDNSName);
+            FromJsonUtilE(FromJsonField(input, keyStatus), Status);
+            FromJsonUtilS(FromJsonField(input, keyTicket), Ticket);
+        }
+
+        Json::Value MatchmakeResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Expires; ToJsonUtilS(Expires, each_Expires); ToJsonField(output, keyExpires) = each_Expires;
+            Json::Value each_LobbyID; ToJsonUtilS(LobbyID, each_LobbyID); ToJsonField(output, keyLobbyID) = each_LobbyID;
+            Json::Value each_PollWaitTimeMS; ToJsonUtilP(PollWaitTimeMS, each_PollWaitTimeMS); ToJsonField(output, keyPollWaitTimeMS) = each_PollWaitTimeMS;
+            Json::Value each_ServerIPV4Address; ToJsonUtilS(ServerIPV4Address, each_ServerIPV4Address); ToJsonField(output, keyServerIPV4Address) = each_ServerIPV4Address;
+            Json::Value each_ServerIPV6Address; ToJsonUtilS(ServerIPV6Address, each_ServerIPV6Address); ToJsonField(output, keyServerIPV6Address) = each_ServerIPV6Address;
+            Json::Value each_ServerPort; ToJsonUtilP(ServerPort, each_ServerPort); ToJsonField(output, keyServerPort) = each_ServerPort;
+            Json::Value each_ServerPublicDNSName; ToJsonUtilS(ServerPublicDNSName, each_ServerPublicDNSName); ToJsonField(output, keyServerPublicDNSName) = each_ServerPublicDNSName;
+            Json::Value each_Status; ToJsonUtilE(Status, each_Status); ToJsonField(output, keyStatus) = each_Status;
+            Json::Value each_Ticket; ToJsonUtilS(Ticket, each_Ticket); ToJsonField(output, keyTicket) = each_Ticket;
+            return output;
+        }
+
+        void ModifyUserVirtualCurrencyResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyBalance), Balance);
+            FromJsonUtilP(FromJsonField(input, keyBalanceChange), BalanceChange);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyVirtualCurrency), VirtualCurrency);
+        }
+
+        Json::Value ModifyUserVirtualCurrencyResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Balance; ToJsonUtilP(Balance, each_Balance); ToJsonField(output, keyBalance) = each_Balance;
+            Json::Value each_BalanceChange; ToJsonUtilP(BalanceChange, each_BalanceChange); ToJsonField(output, keyBalanceChange) = each_BalanceChange;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_VirtualCurrency; ToJsonUtilS(VirtualCurrency, each_VirtualCurrency); ToJsonField(output, keyVirtualCurrency) = each_VirtualCurrency;
+            return output;
+        }
+
+        void OpenTradeRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAllowedPlayerIds), AllowedPlayerIds);
+            FromJsonUtilS(FromJsonField(input, keyOfferedInventoryInstanceIds), OfferedInventoryInstanceIds);
+            FromJsonUtilS(FromJsonField(input, keyRequestedCatalogItemIds), RequestedCatalogItemIds);
+        }
+
+        Json::Value OpenTradeRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AllowedPlayerIds; ToJsonUtilS(AllowedPlayerIds, each_AllowedPlayerIds); ToJsonField(output, keyAllowedPlayerIds) = each_AllowedPlayerIds;
+            Json::Value each_OfferedInventoryInstanceIds; ToJsonUtilS(OfferedInventoryInstanceIds, each_OfferedInventoryInstanceIds); ToJsonField(output, keyOfferedInventoryInstanceIds) = each_OfferedInventoryInstanceIds;
+            Json::Value each_RequestedCatalogItemIds; ToJsonUtilS(RequestedCatalogItemIds, each_RequestedCatalogItemIds); ToJsonField(output, keyRequestedCatalogItemIds) = each_RequestedCatalogItemIds;
+            return output;
+        }
+
+        void OpenTradeResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyTrade), Trade);
+        }
+
+        Json::Value OpenTradeResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Trade; ToJsonUtilO(Trade, each_Trade); ToJsonField(output, keyTrade) = each_Trade;
+            return output;
+        }
+
+        void PayForPurchaseRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCurrency), Currency);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyOrderId), OrderId);
+            FromJsonUtilS(FromJsonField(input, keyProviderName), ProviderName);
+            FromJsonUtilS(FromJsonField(input, keyProviderTransactionId), ProviderTransactionId);
+        }
+
+        Json::Value PayForPurchaseRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Currency; ToJsonUtilS(Currency, each_Currency); ToJsonField(output, keyCurrency) = each_Currency;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_OrderId; ToJsonUtilS(OrderId, each_OrderId); ToJsonField(output, keyOrderId) = each_OrderId;
+            Json::Value each_ProviderName; ToJsonUtilS(ProviderName, each_ProviderName); ToJsonField(output, keyProviderName) = each_ProviderName;
+            Json::Value each_ProviderTransactionId; ToJsonUtilS(ProviderTransactionId, each_ProviderTransactionId); ToJsonField(output, keyProviderTransactionId) = each_ProviderTransactionId;
+            return output;
+        }
+
+        void PayForPurchaseResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyCreditApplied), CreditApplied);
+            FromJsonUtilS(FromJsonField(input, keyOrderId), OrderId);
+            FromJsonUtilS(FromJsonField(input, keyProviderData), ProviderData);
+            FromJsonUtilS(FromJsonField(input, keyProviderToken), ProviderToken);
+            FromJsonUtilS(FromJsonField(input, keyPurchaseConfirmationPageURL), PurchaseConfirmationPageURL);
+            FromJsonUtilS(FromJsonField(input, keyPurchaseCurrency), PurchaseCurrency);
+            FromJsonUtilP(FromJsonField(input, keyPurchasePrice), PurchasePrice);
+            FromJsonUtilE(FromJsonField(input, keyStatus), Status);
+            FromJsonUtilP(FromJsonField(input, keyVCAmount), VCAmount);
+            FromJsonUtilP(FromJsonField(input, keyVirtualCurrency), VirtualCurrency);
+        }
+
+        Json::Value PayForPurchaseResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CreditApplied; ToJsonUtilP(CreditApplied, each_CreditApplied); ToJsonField(output, keyCreditApplied) = each_CreditApplied;
+            Json::Value each_OrderId; ToJsonUtilS(OrderId, each_OrderId); ToJsonField(output, keyOrderId) = each_OrderId;
+            Json::Value each_ProviderData; ToJsonUtilS(ProviderData, each_ProviderData); ToJsonField(output, keyProviderData) = each_ProviderData;
+            Json::Value each_ProviderToken; ToJsonUtilS(ProviderToken, each_ProviderToken); ToJsonField(output, keyProviderToken) = each_ProviderToken;
+            Json::Value each_PurchaseConfirmationPageURL; ToJsonUtilS(PurchaseConfirmationPageURL, each_PurchaseConfirmationPageURL); ToJsonField(output, keyPurchaseConfirmationPageURL) = each_PurchaseConfirmationPageURL;
+            Json::Value each_PurchaseCurrency; ToJsonUtilS(PurchaseCurrency, each_PurchaseCurrency); ToJsonField(output, keyPurchaseCurrency) = each_PurchaseCurrency;
+            Json::Value each_PurchasePrice; ToJsonUtilP(PurchasePrice, each_PurchasePrice); ToJsonField(output, keyPurchasePrice) = each_PurchasePrice;
+            Json::Value each_Status; ToJsonUtilE(Status, each_Status); ToJsonField(output, keyStatus) = each_Status;
+            Json::Value each_VCAmount; ToJsonUtilP(VCAmount, each_VCAmount); ToJsonField(output, keyVCAmount) = each_VCAmount;
+            Json::Value each_VirtualCurrency; ToJsonUtilP(VirtualCurrency, each_VirtualCurrency); ToJsonField(output, keyVirtualCurrency) = each_VirtualCurrency;
+            return output;
+        }
+
+        void PaymentOption::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCurrency), Currency);
+            FromJsonUtilP(FromJsonField(input, keyPrice), Price);
+            FromJsonUtilS(FromJsonField(input, keyProviderName), ProviderName);
+            FromJsonUtilP(FromJsonField(input, keyStoreCredit), StoreCredit);
+        }
+
+        Json::Value PaymentOption::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Currency; ToJsonUtilS(Currency, each_Currency); ToJsonField(output, keyCurrency) = each_Currency;
+            Json::Value each_Price; ToJsonUtilP(Price, each_Price); ToJsonField(output, keyPrice) = each_Price;
+            Json::Value each_ProviderName; ToJsonUtilS(ProviderName, each_ProviderName); ToJsonField(output, keyProviderName) = each_ProviderName;
+            Json::Value each_StoreCredit; ToJsonUtilP(StoreCredit, each_StoreCredit); ToJsonField(output, keyStoreCredit) = each_StoreCredit;
+            return output;
+        }
+
+        void PurchaseItemRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyItemId), ItemId);
+            FromJsonUtilP(FromJsonField(input, keyPrice), Price);
+            FromJsonUtilS(FromJsonField(input, keyStoreId), StoreId);
+            FromJsonUtilS(FromJsonField(input, keyVirtualCurrency), VirtualCurrency);
+        }
+
+        Json::Value PurchaseItemRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ItemId; ToJsonUtilS(ItemId, each_ItemId); ToJsonField(output, keyItemId) = each_ItemId;
+            Json::Value each_Price; ToJsonUtilP(Price, each_Price); ToJsonField(output, keyPrice) = each_Price;
+            Json::Value each_StoreId; ToJsonUtilS(StoreId, each_StoreId); ToJsonField(output, keyStoreId) = each_StoreId;
+            Json::Value each_VirtualCurrency; ToJsonUtilS(VirtualCurrency, each_VirtualCurrency); ToJsonField(output, keyVirtualCurrency) = each_VirtualCurrency;
+            return output;
+        }
+
+        void PurchaseItemResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyItems), Items);
+        }
+
+        Json::Value PurchaseItemResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Items; ToJsonUtilO(Items, each_Items); ToJsonField(output, keyItems) = each_Items;
+            return output;
+        }
+
+        void PurchaseReceiptFulfillment::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyFulfilledItems), FulfilledItems);
+            FromJsonUtilS(FromJsonField(input, keyRecordedPriceSource), RecordedPriceSource);
+            FromJsonUtilS(FromJsonField(input, keyRecordedTransactionCurrency), RecordedTransactionCurrency);
+            FromJsonUtilP(FromJsonField(input, keyRecordedTransactionTotal), RecordedTransactionTotal);
+        }
+
+        Json::Value PurchaseReceiptFulfillment::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_FulfilledItems; ToJsonUtilO(FulfilledItems, each_FulfilledItems); ToJsonField(output, keyFulfilledItems) = each_FulfilledItems;
+            Json::Value each_RecordedPriceSource; ToJsonUtilS(RecordedPriceSource, each_RecordedPriceSource); ToJsonField(output, keyRecordedPriceSource) = each_RecordedPriceSource;
+            Json::Value each_RecordedTransactionCurrency; ToJsonUtilS(RecordedTransactionCurrency, each_RecordedTransactionCurrency); ToJsonField(output, keyRecordedTransactionCurrency) = each_RecordedTransactionCurrency;
+            Json::Value each_RecordedTransactionTotal; ToJsonUtilP(RecordedTransactionTotal, each_RecordedTransactionTotal); ToJsonField(output, keyRecordedTransactionTotal) = each_RecordedTransactionTotal;
+            return output;
+        }
+
+        void RedeemCouponRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyCouponCode), CouponCode);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value RedeemCouponRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_CouponCode; ToJsonUtilS(CouponCode, each_CouponCode); ToJsonField(output, keyCouponCode) = each_CouponCode;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void RedeemCouponResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyGrantedItems), GrantedItems);
+        }
+
+        Json::Value RedeemCouponResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GrantedItems; ToJsonUtilO(GrantedItems, each_GrantedItems); ToJsonField(output, keyGrantedItems) = each_GrantedItems;
+            return output;
+        }
+
+        void RefreshPSNAuthTokenRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAuthCode), AuthCode);
+            FromJsonUtilP(FromJsonField(input, keyIssuerId), IssuerId);
+            FromJsonUtilS(FromJsonField(input, keyRedirectUri), RedirectUri);
+        }
+
+        Json::Value RefreshPSNAuthTokenRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AuthCode; ToJsonUtilS(AuthCode, each_AuthCode); ToJsonField(output, keyAuthCode) = each_AuthCode;
+            Json::Value each_IssuerId; ToJsonUtilP(IssuerId, each_IssuerId); ToJsonField(output, keyIssuerId) = each_IssuerId;
+            Json::Value each_RedirectUri; ToJsonUtilS(RedirectUri, each_RedirectUri); ToJsonField(output, keyRedirectUri) = each_RedirectUri;
+            return output;
+        }
+
+        void RegisterForIOSPushNotificationRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyConfirmationMessage), ConfirmationMessage);
+            FromJsonUtilS(FromJsonField(input, keyDeviceToken), DeviceToken);
+            FromJsonUtilP(FromJsonField(input, keySendPushNotificationConfirmation), SendPushNotificationConfirmation);
+        }
+
+        Json::Value RegisterForIOSPushNotificationRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ConfirmationMessage; ToJsonUtilS(ConfirmationMessage, each_ConfirmationMessage); ToJsonField(output, keyConfirmationMessage) = each_ConfirmationMessage;
+            Json::Value each_DeviceToken; ToJsonUtilS(DeviceToken, each_DeviceToken); ToJsonField(output, keyDeviceToken) = each_DeviceToken;
+            Json::Value each_SendPushNotificationConfirmation; ToJsonUtilP(SendPushNotificationConfirmation, each_SendPushNotificationConfirmation); ToJsonField(output, keySendPushNotificationConfirmation) = each_SendPushNotificationConfirmation;
+            return output;
+        }
+
+        void RegisterForIOSPushNotificationResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value RegisterForIOSPushNotificationResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void RegisterPlayFabUserRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+            FromJsonUtilS(FromJsonField(input, keyEmail), Email);
+            FromJsonUtilS(FromJsonField(input, keyEncryptedRequest), EncryptedRequest);
+            FromJsonUtilO(FromJsonField(input, keyInfoRequestParameters), InfoRequestParameters);
+            FromJsonUtilS(FromJsonField(input, keyPassword), Password);
+            FromJsonUtilS(FromJsonField(input, keyPlayerSecret), PlayerSecret);
+            FromJsonUtilP(FromJsonField(input, keyRequireBothUsernameAndEmail), RequireBothUsernameAndEmail);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+            FromJsonUtilS(FromJsonField(input, keyUsername), Username);
+        }
+
+        Json::Value RegisterPlayFabUserRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            Json::Value each_Email; ToJsonUtilS(Email, each_Email); ToJsonField(output, keyEmail) = each_Email;
+            Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); ToJsonField(output, keyEncryptedRequest) = each_EncryptedRequest;
+            Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); ToJsonField(output, keyInfoRequestParameters) = each_InfoRequestParameters;
+            Json::Value each_Password; ToJsonUtilS(Password, each_Password); ToJsonField(output, keyPassword) = each_Password;
+            Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); ToJsonField(output, keyPlayerSecret) = each_PlayerSecret;
+            Json::Value each_RequireBothUsernameAndEmail; ToJsonUtilP(RequireBothUsernameAndEmail, each_RequireBothUsernameAndEmail); ToJsonField(output, keyRequireBothUsernameAndEmail) = each_RequireBothUsernameAndEmail;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            Json::Value each_Username; ToJsonUtilS(Username, each_Username); ToJsonField(output, keyUsername) = each_Username;
+            return output;
+        }
+
+        void RegisterPlayFabUserResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyEntityToken), EntityToken);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keySessionTicket), SessionTicket);
+            FromJsonUtilO(FromJsonField(input, keySettingsForUser), SettingsForUser);
+            FromJsonUtilS(FromJsonField(input, keyUsername), Username);
+        }
+
+        Json::Value RegisterPlayFabUserResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_EntityToken; ToJsonUtilO(EntityToken, each_EntityToken); ToJsonField(output, keyEntityToken) = each_EntityToken;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_SessionTicket; ToJsonUtilS(SessionTicket, each_SessionTicket); ToJsonField(output, keySessionTicket) = each_SessionTicket;
+            Json::Value each_SettingsForUser; ToJsonUtilO(SettingsForUser, each_SettingsForUser); ToJsonField(output, keySettingsForUser) = each_SettingsForUser;
+            Json::Value each_Username; ToJsonUtilS(Username, each_Username); ToJsonField(output, keyUsername) = each_Username;
+            return output;
+        }
+
+        void RegisterWithWindowsHelloRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyDeviceName), DeviceName);
+            FromJsonUtilS(FromJsonField(input, keyEncryptedRequest), EncryptedRequest);
+            FromJsonUtilO(FromJsonField(input, keyInfoRequestParameters), InfoRequestParameters);
+            FromJsonUtilS(FromJsonField(input, keyPlayerSecret), PlayerSecret);
+            FromJsonUtilS(FromJsonField(input, keyPublicKey), PublicKey);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+            FromJsonUtilS(FromJsonField(input, keyUserName), UserName);
+        }
+
+        Json::Value RegisterWithWindowsHelloRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_DeviceName; ToJsonUtilS(DeviceName, each_DeviceName); ToJsonField(output, keyDeviceName) = each_DeviceName;
+            Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); ToJsonField(output, keyEncryptedRequest) = each_EncryptedRequest;
+            Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); ToJsonField(output, keyInfoRequestParameters) = each_InfoRequestParameters;
+            Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); ToJsonField(output, keyPlayerSecret) = each_PlayerSecret;
+            Json::Value each_PublicKey; ToJsonUtilS(PublicKey, each_PublicKey); ToJsonField(output, keyPublicKey) = each_PublicKey;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            Json::Value each_UserName; ToJsonUtilS(UserName, each_UserName); ToJsonField(output, keyUserName) = each_UserName;
+            return output;
+        }
+
+        void RemoveContactEmailRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value RemoveContactEmailRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void RemoveContactEmailResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value RemoveContactEmailResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void RemoveFriendRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyFriendPlayFabId), FriendPlayFabId);
+        }
+
+        Json::Value RemoveFriendRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_FriendPlayFabId; ToJsonUtilS(FriendPlayFabId, each_FriendPlayFabId); ToJsonField(output, keyFriendPlayFabId) = each_FriendPlayFabId;
+            return output;
+        }
+
+        void RemoveFriendResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value RemoveFriendResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void RemoveGenericIDRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyGenericId), GenericId);
+        }
+
+        Json::Value RemoveGenericIDRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GenericId; ToJsonUtilO(GenericId, each_GenericId); ToJsonField(output, keyGenericId) = each_GenericId;
+            return output;
+        }
+
+        void RemoveGenericIDResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value RemoveGenericIDResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void RemoveSharedGroupMembersRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlayFabIds), PlayFabIds);
+            FromJsonUtilS(FromJsonField(input, keySharedGroupId), SharedGroupId);
+        }
+
+        Json::Value RemoveSharedGroupMembersRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayFabIds; ToJsonUtilS(PlayFabIds, each_PlayFabIds); ToJsonField(output, keyPlayFabIds) = each_PlayFabIds;
+            Json::Value each_SharedGroupId; ToJsonUtilS(SharedGroupId, each_SharedGroupId); ToJsonField(output, keySharedGroupId) = each_SharedGroupId;
+            return output;
+        }
+
+        void RemoveSharedGroupMembersResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value RemoveSharedGroupMembersResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void ReportAdActivityRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonEnum(FromJsonField(input, keyActivity), Activity);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPlacementId), PlacementId);
+            FromJsonUtilS(FromJsonField(input, keyRewardId), RewardId);
+        }
+
+        Json::Value ReportAdActivityRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Activity; ToJsonEnum(Activity, each_Activity); ToJsonField(output, keyActivity) = each_Activity;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PlacementId; ToJsonUtilS(PlacementId, each_PlacementId); ToJsonField(output, keyPlacementId) = each_PlacementId;
+            Json::Value each_RewardId; ToJsonUtilS(RewardId, each_RewardId); ToJsonField(output, keyRewardId) = each_RewardId;
+            return output;
+        }
+
+        void ReportAdActivityResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value ReportAdActivityResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void ReportPlayerClientRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyComment), Comment);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyReporteeId), ReporteeId);
+        }
+
+        Json::Value ReportPlayerClientRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Comment; ToJsonUtilS(Comment, each_Comment); ToJsonField(output, keyComment) = each_Comment;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ReporteeId; ToJsonUtilS(ReporteeId, each_ReporteeId); ToJsonField(output, keyReporteeId) = each_ReporteeId;
+            return output;
+        }
+
+        void ReportPlayerClientResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keySubmissionsRemaining), SubmissionsRemaining);
+        }
+
+        Json::Value ReportPlayerClientResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_SubmissionsRemaining; ToJsonUtilP(SubmissionsRemaining, each_SubmissionsRemaining); ToJsonField(output, keySubmissionsRemaining) = each_SubmissionsRemaining;
+            return output;
+        }
+
+        void RestoreIOSPurchasesRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyReceiptData), ReceiptData);
+        }
+
+        Json::Value RestoreIOSPurchasesRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ReceiptData; ToJsonUtilS(ReceiptData, each_ReceiptData); ToJsonField(output, keyReceiptData) = each_ReceiptData;
+            return output;
+        }
+
+        void RestoreIOSPurchasesResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyFulfillments), Fulfillments);
+        }
+
+        Json::Value RestoreIOSPurchasesResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Fulfillments; ToJsonUtilO(Fulfillments, each_Fulfillments); ToJsonField(output, keyFulfillments) = each_Fulfillments;
+            return output;
+        }
+
+        void RewardAdActivityRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPlacementId), PlacementId);
+            FromJsonUtilS(FromJsonField(input, keyRewardId), RewardId);
+        }
+
+        Json::Value RewardAdActivityRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PlacementId; ToJsonUtilS(PlacementId, each_PlacementId); ToJsonField(output, keyPlacementId) = each_PlacementId;
+            Json::Value each_RewardId; ToJsonUtilS(RewardId, each_RewardId); ToJsonField(output, keyRewardId) = each_RewardId;
+            return output;
+        }
+
+        void RewardAdActivityResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAdActivityEventId), AdActivityEventId);
+            FromJsonUtilS(FromJsonField(input, keyDebugResults), DebugResults);
+            FromJsonUtilS(FromJsonField(input, keyPlacementId), PlacementId);
+            FromJsonUtilS(FromJsonField(input, keyPlacementName), PlacementName);
+            FromJsonUtilP(FromJsonField(input, keyPlacementViewsRemaining), PlacementViewsRemaining);
+            FromJsonUtilP(FromJsonField(input, keyPlacementViewsResetMinutes), PlacementViewsResetMinutes);
+            FromJsonUtilO(FromJsonField(input, keyRewardResults), RewardResults);
+        }
+
+        Json::Value RewardAdActivityResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AdActivityEventId; ToJsonUtilS(AdActivityEventId, each_AdActivityEventId); ToJsonField(output, keyAdActivityEventId) = each_AdActivityEventId;
+            Json::Value each_DebugResults; ToJsonUtilS(DebugResults, each_DebugResults); ToJsonField(output, keyDebugResults) = each_DebugResults;
+            Json::Value each_PlacementId; ToJsonUtilS(PlacementId, each_PlacementId); ToJsonField(output, keyPlacementId) = each_PlacementId;
+            Json::Value each_PlacementName; ToJsonUtilS(PlacementName, each_PlacementName); ToJsonField(output, keyPlacementName) = each_PlacementName;
+            Json::Value each_PlacementViewsRemaining; ToJsonUtilP(PlacementViewsRemaining, each_PlacementViewsRemaining); ToJsonField(output, keyPlacementViewsRemaining) = each_PlacementViewsRemaining;
+            Json::Value each_PlacementViewsResetMinutes; ToJsonUtilP(PlacementViewsResetMinutes, each_PlacementViewsResetMinutes); ToJsonField(output, keyPlacementViewsResetMinutes) = each_PlacementViewsResetMinutes;
+            Json::Value each_RewardResults; ToJsonUtilO(RewardResults, each_RewardResults); ToJsonField(output, keyRewardResults) = each_RewardResults;
+            return output;
+        }
+
+        void SendAccountRecoveryEmailRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyEmail), Email);
+            FromJsonUtilS(FromJsonField(input, keyEmailTemplateId), EmailTemplateId);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+        }
+
+        Json::Value SendAccountRecoveryEmailRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Email; ToJsonUtilS(Email, each_Email); ToJsonField(output, keyEmail) = each_Email;
+            Json::Value each_EmailTemplateId; ToJsonUtilS(EmailTemplateId, each_EmailTemplateId); ToJsonField(output, keyEmailTemplateId) = each_EmailTemplateId;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            return output;
+        }
+
+        void SendAccountRecoveryEmailResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value SendAccountRecoveryEmailResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void SetFriendTagsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyFriendPlayFabId), FriendPlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyTags), Tags);
+        }
+
+        Json::Value SetFriendTagsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_FriendPlayFabId; ToJsonUtilS(FriendPlayFabId, each_FriendPlayFabId); ToJsonField(output, keyFriendPlayFabId) = each_FriendPlayFabId;
+            Json::Value each_Tags; ToJsonUtilS(Tags, each_Tags); ToJsonField(output, keyTags) = each_Tags;
+            return output;
+        }
+
+        void SetFriendTagsResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value SetFriendTagsResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void SetPlayerSecretRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyEncryptedRequest), EncryptedRequest);
+            FromJsonUtilS(FromJsonField(input, keyPlayerSecret), PlayerSecret);
+        }
+
+        Json::Value SetPlayerSecretRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_EncryptedRequest; ToJsonUtilS(EncryptedRequest, each_EncryptedRequest); ToJsonField(output, keyEncryptedRequest) = each_EncryptedRequest;
+            Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); ToJsonField(output, keyPlayerSecret) = each_PlayerSecret;
+            return output;
+        }
+
+        void SetPlayerSecretResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value SetPlayerSecretResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void StartGameRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBuildVersion), BuildVersion);
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyCustomCommandLineData), CustomCommandLineData);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyGameMode), GameMode);
+            FromJsonEnum(FromJsonField(input, keyRegion), pfRegion);
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+        }
+
+        Json::Value StartGameRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BuildVersion; ToJsonUtilS(BuildVersion, each_BuildVersion); ToJsonField(output, keyBuildVersion) = each_BuildVersion;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_CustomCommandLineData; ToJsonUtilS(CustomCommandLineData, each_CustomCommandLineData); ToJsonField(output, keyCustomCommandLineData) = each_CustomCommandLineData;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_GameMode; ToJsonUtilS(GameMode, each_GameMode); ToJsonField(output, keyGameMode) = each_GameMode;
+            Json::Value each_pfRegion; ToJsonEnum(pfRegion, each_pfRegion); ToJsonField(output, keyRegion) = each_pfRegion;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            return output;
+        }
+
+        void StartGameResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyExpires), Expires);
+            FromJsonUtilS(FromJsonField(input, keyLobbyID), LobbyID);
+            FromJsonUtilS(FromJsonField(input, keyPassword), Password);
+            FromJsonUtilS(FromJsonField(input, keyServerIPV4Address), ServerIPV4Address);
+            FromJsonUtilS(FromJsonField(input, keyServerIPV6Address), ServerIPV6Address);
+            FromJsonUtilP(FromJsonField(input, keyServerPort), ServerPort);
+            FromJsonUtilS(FromJsonField(input, keyServerPublicDNSName), ServerPublicDNSName);
+            FromJsonUtilS(FromJsonField(input, keyTicket), Ticket);
+        }
+
+        Json::Value StartGameResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Expires; ToJsonUtilS(Expires, each_Expires); ToJsonField(output, keyExpires) = each_Expires;
+            Json::Value each_LobbyID; ToJsonUtilS(LobbyID, each_LobbyID); ToJsonField(output, keyLobbyID) = each_LobbyID;
+            Json::Value each_Password; ToJsonUtilS(Password, each_Password); ToJsonField(output, keyPassword) = each_Password;
+            Json::Value each_ServerIPV4Address; ToJsonUtilS(ServerIPV4Address, each_ServerIPV4Address); ToJsonField(output, keyServerIPV4Address) = each_ServerIPV4Address;
+            Json::Value each_ServerIPV6Address; ToJsonUtilS(ServerIPV6Address, each_ServerIPV6Address); ToJsonField(output, keyServerIPV6Address) = each_ServerIPV6Address;
+            Json::Value each_ServerPort; ToJsonUtilP(ServerPort, each_ServerPort); ToJsonField(output, keyServerPort) = each_ServerPort;
+            Json::Value each_ServerPublicDNSName; ToJsonUtilS(ServerPublicDNSName, each_ServerPublicDNSName); ToJsonField(output, keyServerPublicDNSName) = each_ServerPublicDNSName;
+            Json::Value each_Ticket; ToJsonUtilS(Ticket, each_Ticket); ToJsonField(output, keyTicket) = each_Ticket;
+            return output;
+        }
+
+        void StartPurchaseRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyItems), Items);
+            FromJsonUtilS(FromJsonField(input, keyStoreId), StoreId);
+        }
+
+        Json::Value StartPurchaseRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Items; ToJsonUtilO(Items, each_Items); ToJsonField(output, keyItems) = each_Items;
+            Json::Value each_StoreId; ToJsonUtilS(StoreId, each_StoreId); ToJsonField(output, keyStoreId) = each_StoreId;
+            return output;
+        }
+
+        void StartPurchaseResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyContents), Contents);
+            FromJsonUtilS(FromJsonField(input, keyOrderId), OrderId);
+            FromJsonUtilO(FromJsonField(input, keyPaymentOptions), PaymentOptions);
+            FromJsonUtilP(FromJsonField(input, keyVirtualCurrencyBalances), VirtualCurrencyBalances);
+        }
+
+        Json::Value StartPurchaseResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Contents; ToJsonUtilO(Contents, each_Contents); ToJsonField(output, keyContents) = each_Contents;
+            Json::Value each_OrderId; ToJsonUtilS(OrderId, each_OrderId); ToJsonField(output, keyOrderId) = each_OrderId;
+            Json::Value each_PaymentOptions; ToJsonUtilO(PaymentOptions, each_PaymentOptions); ToJsonField(output, keyPaymentOptions) = each_PaymentOptions;
+            Json::Value each_VirtualCurrencyBalances; ToJsonUtilP(VirtualCurrencyBalances, each_VirtualCurrencyBalances); ToJsonField(output, keyVirtualCurrencyBalances) = each_VirtualCurrencyBalances;
+            return output;
+        }
+
+        void StatisticUpdate::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+            FromJsonUtilP(FromJsonField(input, keyValue), Value);
+            FromJsonUtilP(FromJsonField(input, keyVersion), Version);
+        }
+
+        Json::Value StatisticUpdate::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            Json::Value each_Value; ToJsonUtilP(Value, each_Value); ToJsonField(output, keyValue) = each_Value;
+            Json::Value each_Version; ToJsonUtilP(Version, each_Version); ToJsonField(output, keyVersion) = each_Version;
+            return output;
+        }
+
+        void SubtractUserVirtualCurrencyRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyAmount), Amount);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyVirtualCurrency), VirtualCurrency);
+        }
+
+        Json::Value SubtractUserVirtualCurrencyRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Amount; ToJsonUtilP(Amount, each_Amount); ToJsonField(output, keyAmount) = each_Amount;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_VirtualCurrency; ToJsonUtilS(VirtualCurrency, each_VirtualCurrency); ToJsonField(output, keyVirtualCurrency) = each_VirtualCurrency;
+            return output;
+        }
+
+        void UnlinkAndroidDeviceIDRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAndroidDeviceId), AndroidDeviceId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value UnlinkAndroidDeviceIDRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AndroidDeviceId; ToJsonUtilS(AndroidDeviceId, each_AndroidDeviceId); ToJsonField(output, keyAndroidDeviceId) = each_AndroidDeviceId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void UnlinkAndroidDeviceIDResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value UnlinkAndroidDeviceIDResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void UnlinkAppleRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value UnlinkAppleRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void UnlinkCustomIDRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomId), CustomId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value UnlinkCustomIDRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomId; ToJsonUtilS(CustomId, each_CustomId); ToJsonField(output, keyCustomId) = each_CustomId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void UnlinkCustomIDResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value UnlinkCustomIDResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void UnlinkFacebookAccountRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value UnlinkFacebookAccountRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void UnlinkFacebookAccountResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value UnlinkFacebookAccountResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void UnlinkFacebookInstantGamesIdRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyFacebookInstantGamesId), FacebookInstantGamesId);
+        }
+
+        Json::Value UnlinkFacebookInstantGamesIdRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_FacebookInstantGamesId; ToJsonUtilS(FacebookInstantGamesId, each_FacebookInstantGamesId); ToJsonField(output, keyFacebookInstantGamesId) = each_FacebookInstantGamesId;
+            return output;
+        }
+
+        void UnlinkFacebookInstantGamesIdResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value UnlinkFacebookInstantGamesIdResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void UnlinkGameCenterAccountRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value UnlinkGameCenterAccountRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void UnlinkGameCenterAccountResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value UnlinkGameCenterAccountResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void UnlinkGoogleAccountRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value UnlinkGoogleAccountRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void UnlinkGoogleAccountResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value UnlinkGoogleAccountResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void UnlinkIOSDeviceIDRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyDeviceId), DeviceId);
+        }
+
+        Json::Value UnlinkIOSDeviceIDRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_DeviceId; ToJsonUtilS(DeviceId, each_DeviceId); ToJsonField(output, keyDeviceId) = each_DeviceId;
+            return output;
+        }
+
+        void UnlinkIOSDeviceIDResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value UnlinkIOSDeviceIDResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void UnlinkKongregateAccountRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value UnlinkKongregateAccountRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void UnlinkKongregateAccountResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value UnlinkKongregateAccountResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void UnlinkNintendoServiceAccountRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value UnlinkNintendoServiceAccountRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void UnlinkNintendoSwitchDeviceIdRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyNintendoSwitchDeviceId), NintendoSwitchDeviceId);
+        }
+
+        Json::Value UnlinkNintendoSwitchDeviceIdRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_NintendoSwitchDeviceId; ToJsonUtilS(NintendoSwitchDeviceId, each_NintendoSwitchDeviceId); ToJsonField(output, keyNintendoSwitchDeviceId) = each_NintendoSwitchDeviceId;
+            return output;
+        }
+
+        void UnlinkNintendoSwitchDeviceIdResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value UnlinkNintendoSwitchDeviceIdResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void UnlinkOpenIdConnectRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyConnectionId), ConnectionId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value UnlinkOpenIdConnectRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ConnectionId; ToJsonUtilS(ConnectionId, each_ConnectionId); ToJsonField(output, keyConnectionId) = each_ConnectionId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void UnlinkPSNAccountRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value UnlinkPSNAccountRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void UnlinkPSNAccountResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value UnlinkPSNAccountResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void UnlinkSteamAccountRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value UnlinkSteamAccountRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void UnlinkSteamAccountResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value UnlinkSteamAccountResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void UnlinkTwitchAccountRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAccessToken), AccessToken);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value UnlinkTwitchAccountRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AccessToken; ToJsonUtilS(AccessToken, each_AccessToken); ToJsonField(output, keyAccessToken) = each_AccessToken;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void UnlinkTwitchAccountResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value UnlinkTwitchAccountResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void UnlinkWindowsHelloAccountRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPublicKeyHint), PublicKeyHint);
+        }
+
+        Json::Value UnlinkWindowsHelloAccountRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PublicKeyHint; ToJsonUtilS(PublicKeyHint, each_PublicKeyHint); ToJsonField(output, keyPublicKeyHint) = each_PublicKeyHint;
+            return output;
+        }
+
+        void UnlinkWindowsHelloAccountResponse::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value UnlinkWindowsHelloAccountResponse::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void UnlinkXboxAccountRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value UnlinkXboxAccountRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void UnlinkXboxAccountResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value UnlinkXboxAccountResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void UnlockContainerInstanceRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyContainerItemInstanceId), ContainerItemInstanceId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyKeyItemInstanceId), KeyItemInstanceId);
+        }
+
+        Json::Value UnlockContainerInstanceRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_ContainerItemInstanceId; ToJsonUtilS(ContainerItemInstanceId, each_ContainerItemInstanceId); ToJsonField(output, keyContainerItemInstanceId) = each_ContainerItemInstanceId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_KeyItemInstanceId; ToJsonUtilS(KeyItemInstanceId, each_KeyItemInstanceId); ToJsonField(output, keyKeyItemInstanceId) = each_KeyItemInstanceId;
+            return output;
+        }
+
+        void UnlockContainerItemRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyContainerItemId), ContainerItemId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value UnlockContainerItemRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_ContainerItemId; ToJsonUtilS(ContainerItemId, each_ContainerItemId); ToJsonField(output, keyContainerItemId) = each_ContainerItemId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void UnlockContainerItemResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyGrantedItems), GrantedItems);
+            FromJsonUtilS(FromJsonField(input, keyUnlockedItemInstanceId), UnlockedItemInstanceId);
+            FromJsonUtilS(FromJsonField(input, keyUnlockedWithItemInstanceId), UnlockedWithItemInstanceId);
+            FromJsonUtilP(FromJsonField(input, keyVirtualCurrency), VirtualCurrency);
+        }
+
+        Json::Value UnlockContainerItemResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GrantedItems; ToJsonUtilO(GrantedItems, each_GrantedItems); ToJsonField(output, keyGrantedItems) = each_GrantedItems;
+            Json::Value each_UnlockedItemInstanceId; ToJsonUtilS(UnlockedItemInstanceId, each_UnlockedItemInstanceId); ToJsonField(output, keyUnlockedItemInstanceId) = each_UnlockedItemInstanceId;
+            Json::Value each_UnlockedWithItemInstanceId; ToJsonUtilS(UnlockedWithItemInstanceId, each_UnlockedWithItemInstanceId); ToJsonField(output, keyUnlockedWithItemInstanceId) = each_UnlockedWithItemInstanceId;
+            Json::Value each_VirtualCurrency; ToJsonUtilP(VirtualCurrency, each_VirtualCurrency); ToJsonField(output, keyVirtualCurrency) = each_VirtualCurrency;
+            return output;
+        }
+
+        void UpdateAvatarUrlRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyImageUrl), ImageUrl);
+        }
+
+        Json::Value UpdateAvatarUrlRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ImageUrl; ToJsonUtilS(ImageUrl, each_ImageUrl); ToJsonField(output, keyImageUrl) = each_ImageUrl;
+            return output;
+        }
+
+        void UpdateCharacterDataRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyData), Data);
+            FromJsonUtilS(FromJsonField(input, keyKeysToRemove), KeysToRemove);
+            FromJsonUtilE(FromJsonField(input, keyPermission), Permission);
+        }
+
+        Json::Value UpdateCharacterDataRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Data; ToJsonUtilS(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            Json::Value each_KeysToRemove; ToJsonUtilS(KeysToRemove, each_KeysToRemove); ToJsonField(output, keyKeysToRemove) = each_KeysToRemove;
+            Json::Value each_Permission; ToJsonUtilE(Permission, each_Permission); ToJsonField(output, keyPermission) = each_Permission;
+            return output;
+        }
+
+        void UpdateCharacterDataResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyDataVersion), DataVersion);
+        }
+
+        Json::Value UpdateCharacterDataResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_DataVersion; ToJsonUtilP(DataVersion, each_DataVersion); ToJsonField(output, keyDataVersion) = each_DataVersion;
+            return output;
+        }
+
+        void UpdateCharacterStatisticsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilP(FromJsonField(input, keyCharacterStatistics), CharacterStatistics);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value UpdateCharacterStatisticsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_CharacterStatistics; ToJsonUtilP(CharacterStatistics, each_CharacterStatistics); ToJsonField(output, keyCharacterStatistics) = each_CharacterStatistics;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void UpdateCharacterStatisticsResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value UpdateCharacterStatisticsResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void UpdatePlayerStatisticsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyStatistics), Statistics);
+        }
+
+        Json::Value UpdatePlayerStatisticsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Statistics; ToJsonUtilO(Statistics, each_Statistics); ToJsonField(output, keyStatistics) = each_Statistics;
+            return output;
+        }
+
+        void UpdatePlayerStatisticsResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value UpdatePlayerStatisticsResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void UpdateSharedGroupDataRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyData), Data);
+            FromJsonUtilS(FromJsonField(input, keyKeysToRemove), KeysToRemove);
+            FromJsonUtilE(FromJsonField(input, keyPermission), Permission);
+            FromJsonUtilS(FromJsonField(input, keySharedGroupId), SharedGroupId);
+        }
+
+        Json::Value UpdateSharedGroupDataRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Data; ToJsonUtilS(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            Json::Value each_KeysToRemove; ToJsonUtilS(KeysToRemove, each_KeysToRemove); ToJsonField(output, keyKeysToRemove) = each_KeysToRemove;
+            Json::Value each_Permission; ToJsonUtilE(Permission, each_Permission); ToJsonField(output, keyPermission) = each_Permission;
+            Json::Value each_SharedGroupId; ToJsonUtilS(SharedGroupId, each_SharedGroupId); ToJsonField(output, keySharedGroupId) = each_SharedGroupId;
+            return output;
+        }
+
+        void UpdateSharedGroupDataResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value UpdateSharedGroupDataResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void UpdateUserDataRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyData), Data);
+            FromJsonUtilS(FromJsonField(input, keyKeysToRemove), KeysToRemove);
+            FromJsonUtilE(FromJsonField(input, keyPermission), Permission);
+        }
+
+        Json::Value UpdateUserDataRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Data; ToJsonUtilS(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            Json::Value each_KeysToRemove; ToJsonUtilS(KeysToRemove, each_KeysToRemove); ToJsonField(output, keyKeysToRemove) = each_KeysToRemove;
+            Json::Value each_Permission; ToJsonUtilE(Permission, each_Permission); ToJsonField(output, keyPermission) = each_Permission;
+            return output;
+        }
+
+        void UpdateUserDataResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyDataVersion), DataVersion);
+        }
+
+        Json::Value UpdateUserDataResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_DataVersion; ToJsonUtilP(DataVersion, each_DataVersion); ToJsonField(output, keyDataVersion) = each_DataVersion;
+            return output;
+        }
+
+        void UpdateUserTitleDisplayNameRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+        }
+
+        Json::Value UpdateUserTitleDisplayNameRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            return output;
+        }
+
+        void UpdateUserTitleDisplayNameResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+        }
+
+        Json::Value UpdateUserTitleDisplayNameResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            return output;
+        }
+
+        void ValidateAmazonReceiptRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCurrencyCode), CurrencyCode);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyPurchasePrice), PurchasePrice);
+            FromJsonUtilS(FromJsonField(input, keyReceiptId), ReceiptId);
+            FromJsonUtilS(FromJsonField(input, keyUserId), UserId);
+        }
+
+        Json::Value ValidateAmazonReceiptRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CurrencyCode; ToJsonUtilS(CurrencyCode, each_CurrencyCode); ToJsonField(output, keyCurrencyCode) = each_CurrencyCode;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PurchasePrice; ToJsonUtilP(PurchasePrice, each_PurchasePrice); ToJsonField(output, keyPurchasePrice) = each_PurchasePrice;
+            Json::Value each_ReceiptId; ToJsonUtilS(ReceiptId, each_ReceiptId); ToJsonField(output, keyReceiptId) = each_ReceiptId;
+            Json::Value each_UserId; ToJsonUtilS(UserId, each_UserId); ToJsonField(output, keyUserId) = each_UserId;
+            return output;
+        }
+
+        void ValidateAmazonReceiptResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyFulfillments), Fulfillments);
+        }
+
+        Json::Value ValidateAmazonReceiptResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Fulfillments; ToJsonUtilO(Fulfillments, each_Fulfillments); ToJsonField(output, keyFulfillments) = each_Fulfillments;
+            return output;
+        }
+
+        void ValidateGooglePlayPurchaseRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCurrencyCode), CurrencyCode);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyPurchasePrice), PurchasePrice);
+            FromJsonUtilS(FromJsonField(input, keyReceiptJson), ReceiptJson);
+            FromJsonUtilS(FromJsonField(input, keySignature), Signature);
+        }
+
+        Json::Value ValidateGooglePlayPurchaseRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CurrencyCode; ToJsonUtilS(CurrencyCode, each_CurrencyCode); ToJsonField(output, keyCurrencyCode) = each_CurrencyCode;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PurchasePrice; ToJsonUtilP(PurchasePrice, each_PurchasePrice); ToJsonField(output, keyPurchasePrice) = each_PurchasePrice;
+            Json::Value each_ReceiptJson; ToJsonUtilS(ReceiptJson, each_ReceiptJson); ToJsonField(output, keyReceiptJson) = each_ReceiptJson;
+            Json::Value each_Signature; ToJsonUtilS(Signature, each_Signature); ToJsonField(output, keySignature) = each_Signature;
+            return output;
+        }
+
+        void ValidateGooglePlayPurchaseResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyFulfillments), Fulfillments);
+        }
+
+        Json::Value ValidateGooglePlayPurchaseResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Fulfillments; ToJsonUtilO(Fulfillments, each_Fulfillments); ToJsonField(output, keyFulfillments) = each_Fulfillments;
+            return output;
+        }
+
+        void ValidateIOSReceiptRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCurrencyCode), CurrencyCode);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyPurchasePrice), PurchasePrice);
+            FromJsonUtilS(FromJsonField(input, keyReceiptData), ReceiptData);
+        }
+
+        Json::Value ValidateIOSReceiptRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CurrencyCode; ToJsonUtilS(CurrencyCode, each_CurrencyCode); ToJsonField(output, keyCurrencyCode) = each_CurrencyCode;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PurchasePrice; ToJsonUtilP(PurchasePrice, each_PurchasePrice); ToJsonField(output, keyPurchasePrice) = each_PurchasePrice;
+            Json::Value each_ReceiptData; ToJsonUtilS(ReceiptData, each_ReceiptData); ToJsonField(output, keyReceiptData) = each_ReceiptData;
+            return output;
+        }
+
+        void ValidateIOSReceiptResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyFulfillments), Fulfillments);
+        }
+
+        Json::Value ValidateIOSReceiptResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Fulfillments; ToJsonUtilO(Fulfillments, each_Fulfillments); ToJsonField(output, keyFulfillments) = each_Fulfillments;
+            return output;
+        }
+
+        void ValidateWindowsReceiptRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCurrencyCode), CurrencyCode);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyPurchasePrice), PurchasePrice);
+            FromJsonUtilS(FromJsonField(input, keyReceipt), Receipt);
+        }
+
+        Json::Value ValidateWindowsReceiptRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CurrencyCode; ToJsonUtilS(CurrencyCode, each_CurrencyCode); ToJsonField(output, keyCurrencyCode) = each_CurrencyCode;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PurchasePrice; ToJsonUtilP(PurchasePrice, each_PurchasePrice); ToJsonField(output, keyPurchasePrice) = each_PurchasePrice;
+            Json::Value each_Receipt; ToJsonUtilS(Receipt, each_Receipt); ToJsonField(output, keyReceipt) = each_Receipt;
+            return output;
+        }
+
+        void ValidateWindowsReceiptResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyFulfillments), Fulfillments);
+        }
+
+        Json::Value ValidateWindowsReceiptResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Fulfillments; ToJsonUtilO(Fulfillments, each_Fulfillments); ToJsonField(output, keyFulfillments) = each_Fulfillments;
+            return output;
+        }
+
+        void WriteClientCharacterEventRequest::FromJson(const Json::Value& input)
+        {
+            Body = FromJsonField(input, keyBody);
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyEventName), EventName);
+            FromJsonUtilT(FromJsonField(input, keyTimestamp), Timestamp);
+        }
+
+        Json::Value WriteClientCharacterEventRequest::ToJson() const
+        {
+            Json::Value output;
+            ToJsonField(output, keyBody) = Body;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_EventName; ToJsonUtilS(EventName, each_EventName); ToJsonField(output, keyEventName) = each_EventName;
+            Json::Value each_Timestamp; ToJsonUtilT(Timestamp, each_Timestamp); ToJsonField(output, keyTimestamp) = each_Timestamp;
+            return output;
+        }
+
+        void WriteClientPlayerEventRequest::FromJson(const Json::Value& input)
+        {
+            Body = FromJsonField(input, keyBody);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyEventName), EventName);
+            FromJsonUtilT(FromJsonField(input, keyTimestamp), Timestamp);
+        }
+
+        Json::Value WriteClientPlayerEventRequest::ToJson() const
+        {
+            Json::Value output;
+            ToJsonField(output, keyBody) = Body;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_EventName; ToJsonUtilS(EventName, each_EventName); ToJsonField(output, keyEventName) = each_EventName;
+            Json::Value each_Timestamp; ToJsonUtilT(Timestamp, each_Timestamp); ToJsonField(output, keyTimestamp) = each_Timestamp;
+            return output;
+        }
+
+        void WriteEventResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyEventId), EventId);
+        }
+
+        Json::Value WriteEventResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_EventId; ToJsonUtilS(EventId, each_EventId); ToJsonField(output, keyEventId) = each_EventId;
+            return output;
+        }
+
+        void WriteTitleEventRequest::FromJson(const Json::Value& input)
+        {
+            Body = FromJsonField(input, keyBody);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyEventName), EventName);
+            FromJsonUtilT(FromJsonField(input, keyTimestamp), Timestamp);
+        }
+
+        Json::Value WriteTitleEventRequest::ToJson() const
+        {
+            Json::Value output;
+            ToJsonField(output, keyBody) = Body;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_EventName; ToJsonUtilS(EventName, each_EventName); ToJsonField(output, keyEventName) = each_EventName;
+            Json::Value each_Timestamp; ToJsonUtilT(Timestamp, each_Timestamp); ToJsonField(output, keyTimestamp) = each_Timestamp;
+            return output;
+        }
+    }
+}
+
+#endif
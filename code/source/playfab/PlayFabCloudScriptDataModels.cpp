@@ -0,0 +1,3804 @@
+#include <stdafx.h>
+
+#if !defined(DISABLE_PLAYFABENTITY_API)
+
+#include <playfab/PlayFabCloudScriptDataModels.h>
+
+namespace PlayFab
+{
+    namespace CloudScriptModels
+    {
+        namespace
+        {
+            // The json field names of the models below
+            constexpr PlayFabJsonKey keyAPIRequestsIssued("APIRequestsIssued");
+            constexpr PlayFabJsonKey keyAdCampaignAttributions("AdCampaignAttributions");
+            constexpr PlayFabJsonKey keyAttributedAt("AttributedAt");
+            constexpr PlayFabJsonKey keyAvatarUrl("AvatarUrl");
+            constexpr PlayFabJsonKey keyBannedUntil("BannedUntil");
+            constexpr PlayFabJsonKey keyCampaignId("CampaignId");
+            constexpr PlayFabJsonKey keyCity("City");
+            constexpr PlayFabJsonKey keyConnectionString("ConnectionString");
+            constexpr PlayFabJsonKey keyContactEmailAddresses("ContactEmailAddresses");
+            constexpr PlayFabJsonKey keyContinentCode("ContinentCode");
+            constexpr PlayFabJsonKey keyCountryCode("CountryCode");
+            constexpr PlayFabJsonKey keyCreated("Created");
+            constexpr PlayFabJsonKey keyCurrency("Currency");
+            constexpr PlayFabJsonKey keyCustomTags("CustomTags");
+            constexpr PlayFabJsonKey keyData("Data");
+            constexpr PlayFabJsonKey keyDisplayName("DisplayName");
+            constexpr PlayFabJsonKey keyEmail("Email");
+            constexpr PlayFabJsonKey keyEmailAddress("EmailAddress");
+            constexpr PlayFabJsonKey keyEntity("Entity");
+            constexpr PlayFabJsonKey keyEntityId("EntityId");
+            constexpr PlayFabJsonKey keyEntityType("EntityType");
+            constexpr PlayFabJsonKey keyError("Error");
+            constexpr PlayFabJsonKey keyEventData("EventData");
+            constexpr PlayFabJsonKey keyEventName("EventName");
+            constexpr PlayFabJsonKey keyEventNamespace("EventNamespace");
+            constexpr PlayFabJsonKey keyEventSettings("EventSettings");
+            constexpr PlayFabJsonKey keyExecutionTimeMilliseconds("ExecutionTimeMilliseconds");
+            constexpr PlayFabJsonKey keyExecutionTimeSeconds("ExecutionTimeSeconds");
+            constexpr PlayFabJsonKey keyExperimentVariants("ExperimentVariants");
+            constexpr PlayFabJsonKey keyExpiration("Expiration");
+            constexpr PlayFabJsonKey keyFunctionAddress("FunctionAddress");
+            constexpr PlayFabJsonKey keyFunctionName("FunctionName");
+            constexpr PlayFabJsonKey keyFunctionParameter("FunctionParameter");
+            constexpr PlayFabJsonKey keyFunctionResult("FunctionResult");
+            constexpr PlayFabJsonKey keyFunctionResultTooLarge("FunctionResultTooLarge");
+            constexpr PlayFabJsonKey keyFunctionUrl("FunctionUrl");
+            constexpr PlayFabJsonKey keyFunctions("Functions");
+            constexpr PlayFabJsonKey keyGeneratePlayStreamEvent("GeneratePlayStreamEvent");
+            constexpr PlayFabJsonKey keyHttpRequestsIssued("HttpRequestsIssued");
+            constexpr PlayFabJsonKey keyId("Id");
+            constexpr PlayFabJsonKey keyInitialSubscriptionTime("InitialSubscriptionTime");
+            constexpr PlayFabJsonKey keyIsActive("IsActive");
+            constexpr PlayFabJsonKey keyLastLogin("LastLogin");
+            constexpr PlayFabJsonKey keyLatitude("Latitude");
+            constexpr PlayFabJsonKey keyLevel("Level");
+            constexpr PlayFabJsonKey keyLinkedAccounts("LinkedAccounts");
+            constexpr PlayFabJsonKey keyLocations("Locations");
+            constexpr PlayFabJsonKey keyLogs("Logs");
+            constexpr PlayFabJsonKey keyLogsTooLarge("LogsTooLarge");
+            constexpr PlayFabJsonKey keyLongitude("Longitude");
+            constexpr PlayFabJsonKey keyMembershipExpiration("MembershipExpiration");
+            constexpr PlayFabJsonKey keyMembershipId("MembershipId");
+            constexpr PlayFabJsonKey keyMemberships("Memberships");
+            constexpr PlayFabJsonKey keyMemoryConsumedBytes("MemoryConsumedBytes");
+            constexpr PlayFabJsonKey keyMessage("Message");
+            constexpr PlayFabJsonKey keyName("Name");
+            constexpr PlayFabJsonKey keyNotificationEndpointARN("NotificationEndpointARN");
+            constexpr PlayFabJsonKey keyOrigination("Origination");
+            constexpr PlayFabJsonKey keyOverrideExpiration("OverrideExpiration");
+            constexpr PlayFabJsonKey keyPlatform("Platform");
+            constexpr PlayFabJsonKey keyPlatformUserId("PlatformUserId");
+            constexpr PlayFabJsonKey keyPlayStreamEventEnvelope("PlayStreamEventEnvelope");
+            constexpr PlayFabJsonKey keyPlayerId("PlayerId");
+            constexpr PlayFabJsonKey keyPlayerProfile("PlayerProfile");
+            constexpr PlayFabJsonKey keyProcessorTimeSeconds("ProcessorTimeSeconds");
+            constexpr PlayFabJsonKey keyPublisherId("PublisherId");
+            constexpr PlayFabJsonKey keyPushNotificationRegistrations("PushNotificationRegistrations");
+            constexpr PlayFabJsonKey keyQueueName("QueueName");
+            constexpr PlayFabJsonKey keyRevision("Revision");
+            constexpr PlayFabJsonKey keyRevisionSelection("RevisionSelection");
+            constexpr PlayFabJsonKey keyScheduledTaskId("ScheduledTaskId");
+            constexpr PlayFabJsonKey keySpecificRevision("SpecificRevision");
+            constexpr PlayFabJsonKey keyStackTrace("StackTrace");
+            constexpr PlayFabJsonKey keyStatistics("Statistics");
+            constexpr PlayFabJsonKey keyStatus("Status");
+            constexpr PlayFabJsonKey keySubscriptionId("SubscriptionId");
+            constexpr PlayFabJsonKey keySubscriptionItemId("SubscriptionItemId");
+            constexpr PlayFabJsonKey keySubscriptionProvider("SubscriptionProvider");
+            constexpr PlayFabJsonKey keySubscriptions("Subscriptions");
+            constexpr PlayFabJsonKey keyTagValue("TagValue");
+            constexpr PlayFabJsonKey keyTags("Tags");
+            constexpr PlayFabJsonKey keyTitleId("TitleId");
+            constexpr PlayFabJsonKey keyTotalValue("TotalValue");
+            constexpr PlayFabJsonKey keyTotalValueAsDecimal("TotalValueAsDecimal");
+            constexpr PlayFabJsonKey keyTotalValueToDateInUSD("TotalValueToDateInUSD");
+            constexpr PlayFabJsonKey keyTriggerType("TriggerType");
+            constexpr PlayFabJsonKey keyType("Type");
+            constexpr PlayFabJsonKey keyUsername("Username");
+            constexpr PlayFabJsonKey keyValue("Value");
+            constexpr PlayFabJsonKey keyValuesToDate("ValuesToDate");
+            constexpr PlayFabJsonKey keyVerificationStatus("VerificationStatus");
+            constexpr PlayFabJsonKey keyVersion("Version");
+        }
+
+        void ToJsonEnum(const CloudScriptRevisionOption input, Json::Value& output)
+        {
+            if (input == CloudScriptRevisionOption::CloudScriptRevisionOptionLive)
+            {
+                output = Json::Value(Json::StaticString("Live"));
+                return;
+            }
+            if (input == CloudScriptRevisionOption::CloudScriptRevisionOptionLatest)
+            {
+                output = Json::Value(Json::StaticString("Latest"));
+                return;
+            }
+            if (input == CloudScriptRevisionOption::CloudScriptRevisionOptionSpecific)
+            {
+                output = Json::Value(Json::StaticString("Specific"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, CloudScriptRevisionOption& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Live")
+            {
+                output = CloudScriptRevisionOption::CloudScriptRevisionOptionLive;
+                return;
+            }
+            if (inputStr == "Latest")
+            {
+                output = CloudScriptRevisionOption::CloudScriptRevisionOptionLatest;
+                return;
+            }
+            if (inputStr == "Specific")
+            {
+                output = CloudScriptRevisionOption::CloudScriptRevisionOptionSpecific;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const ContinentCode input, Json::Value& output)
+        {
+            if (input == ContinentCode::ContinentCodeAF)
+            {
+                output = Json::Value(Json::StaticString("AF"));
+                return;
+            }
+            if (input == ContinentCode::ContinentCodeAN)
+            {
+                output = Json::Value(Json::StaticString("AN"));
+                return;
+            }
+            if (input == ContinentCode::ContinentCodeAS)
+            {
+                output = Json::Value(Json::StaticString("AS"));
+                return;
+            }
+            if (input == ContinentCode::ContinentCodeEU)
+            {
+                output = Json::Value(Json::StaticString("EU"));
+                return;
+            }
+            if (input == ContinentCode::ContinentCodeNA)
+            {
+                output = Json::Value(Json::StaticString("NA"));
+                return;
+            }
+            if (input == ContinentCode::ContinentCodeOC)
+            {
+                output = Json::Value(Json::StaticString("OC"));
+                return;
+            }
+            if (input == ContinentCode::ContinentCodeSA)
+            {
+                output = Json::Value(Json::StaticString("SA"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, ContinentCode& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "AF")
+            {
+                output = ContinentCode::ContinentCodeAF;
+                return;
+            }
+            if (inputStr == "AN")
+            {
+                output = ContinentCode::ContinentCodeAN;
+                return;
+            }
+            if (inputStr == "AS")
+            {
+                output = ContinentCode::ContinentCodeAS;
+                return;
+            }
+            if (inputStr == "EU")
+            {
+                output = ContinentCode::ContinentCodeEU;
+                return;
+            }
+            if (inputStr == "NA")
+            {
+                output = ContinentCode::ContinentCodeNA;
+                return;
+            }
+            if (inputStr == "OC")
+            {
+                output = ContinentCode::ContinentCodeOC;
+                return;
+            }
+            if (inputStr == "SA")
+            {
+                output = ContinentCode::ContinentCodeSA;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const CountryCode input, Json::Value& output)
+        {
+            if (input == CountryCode::CountryCodeAF)
+            {
+                output = Json::Value(Json::StaticString("AF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAX)
+            {
+                output = Json::Value(Json::StaticString("AX"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAL)
+            {
+                output = Json::Value(Json::StaticString("AL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeDZ)
+            {
+                output = Json::Value(Json::StaticString("DZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAS)
+            {
+                output = Json::Value(Json::StaticString("AS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAD)
+            {
+                output = Json::Value(Json::StaticString("AD"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAO)
+            {
+                output = Json::Value(Json::StaticString("AO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAI)
+            {
+                output = Json::Value(Json::StaticString("AI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAQ)
+            {
+                output = Json::Value(Json::StaticString("AQ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAG)
+            {
+                output = Json::Value(Json::StaticString("AG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAR)
+            {
+                output = Json::Value(Json::StaticString("AR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAM)
+            {
+                output = Json::Value(Json::StaticString("AM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAW)
+            {
+                output = Json::Value(Json::StaticString("AW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAU)
+            {
+                output = Json::Value(Json::StaticString("AU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAT)
+            {
+                output = Json::Value(Json::StaticString("AT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAZ)
+            {
+                output = Json::Value(Json::StaticString("AZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBS)
+            {
+                output = Json::Value(Json::StaticString("BS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBH)
+            {
+                output = Json::Value(Json::StaticString("BH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBD)
+            {
+                output = Json::Value(Json::StaticString("BD"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBB)
+            {
+                output = Json::Value(Json::StaticString("BB"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBY)
+            {
+                output = Json::Value(Json::StaticString("BY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBE)
+            {
+                output = Json::Value(Json::StaticString("BE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBZ)
+            {
+                output = Json::Value(Json::StaticString("BZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBJ)
+            {
+                output = Json::Value(Json::StaticString("BJ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBM)
+            {
+                output = Json::Value(Json::StaticString("BM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBT)
+            {
+                output = Json::Value(Json::StaticString("BT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBO)
+            {
+                output = Json::Value(Json::StaticString("BO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBQ)
+            {
+                output = Json::Value(Json::StaticString("BQ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBA)
+            {
+                output = Json::Value(Json::StaticString("BA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBW)
+            {
+                output = Json::Value(Json::StaticString("BW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBV)
+            {
+                output = Json::Value(Json::StaticString("BV"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBR)
+            {
+                output = Json::Value(Json::StaticString("BR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIO)
+            {
+                output = Json::Value(Json::StaticString("IO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBN)
+            {
+                output = Json::Value(Json::StaticString("BN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBG)
+            {
+                output = Json::Value(Json::StaticString("BG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBF)
+            {
+                output = Json::Value(Json::StaticString("BF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBI)
+            {
+                output = Json::Value(Json::StaticString("BI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKH)
+            {
+                output = Json::Value(Json::StaticString("KH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCM)
+            {
+                output = Json::Value(Json::StaticString("CM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCA)
+            {
+                output = Json::Value(Json::StaticString("CA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCV)
+            {
+                output = Json::Value(Json::StaticString("CV"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKY)
+            {
+                output = Json::Value(Json::StaticString("KY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCF)
+            {
+                output = Json::Value(Json::StaticString("CF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTD)
+            {
+                output = Json::Value(Json::StaticString("TD"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCL)
+            {
+                output = Json::Value(Json::StaticString("CL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCN)
+            {
+                output = Json::Value(Json::StaticString("CN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCX)
+            {
+                output = Json::Value(Json::StaticString("CX"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCC)
+            {
+                output = Json::Value(Json::StaticString("CC"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCO)
+            {
+                output = Json::Value(Json::StaticString("CO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKM)
+            {
+                output = Json::Value(Json::StaticString("KM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCG)
+            {
+                output = Json::Value(Json::StaticString("CG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCD)
+            {
+                output = Json::Value(Json::StaticString("CD"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCK)
+            {
+                output = Json::Value(Json::StaticString("CK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCR)
+            {
+                output = Json::Value(Json::StaticString("CR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCI)
+            {
+                output = Json::Value(Json::StaticString("CI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeHR)
+            {
+                output = Json::Value(Json::StaticString("HR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCU)
+            {
+                output = Json::Value(Json::StaticString("CU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCW)
+            {
+                output = Json::Value(Json::StaticString("CW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCY)
+            {
+                output = Json::Value(Json::StaticString("CY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCZ)
+            {
+                output = Json::Value(Json::StaticString("CZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeDK)
+            {
+                output = Json::Value(Json::StaticString("DK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeDJ)
+            {
+                output = Json::Value(Json::StaticString("DJ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeDM)
+            {
+                output = Json::Value(Json::StaticString("DM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeDO)
+            {
+                output = Json::Value(Json::StaticString("DO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeEC)
+            {
+                output = Json::Value(Json::StaticString("EC"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeEG)
+            {
+                output = Json::Value(Json::StaticString("EG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSV)
+            {
+                output = Json::Value(Json::StaticString("SV"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGQ)
+            {
+                output = Json::Value(Json::StaticString("GQ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeER)
+            {
+                output = Json::Value(Json::StaticString("ER"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeEE)
+            {
+                output = Json::Value(Json::StaticString("EE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeET)
+            {
+                output = Json::Value(Json::StaticString("ET"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeFK)
+            {
+                output = Json::Value(Json::StaticString("FK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeFO)
+            {
+                output = Json::Value(Json::StaticString("FO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeFJ)
+            {
+                output = Json::Value(Json::StaticString("FJ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeFI)
+            {
+                output = Json::Value(Json::StaticString("FI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeFR)
+            {
+                output = Json::Value(Json::StaticString("FR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGF)
+            {
+                output = Json::Value(Json::StaticString("GF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePF)
+            {
+                output = Json::Value(Json::StaticString("PF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTF)
+            {
+                output = Json::Value(Json::StaticString("TF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGA)
+            {
+                output = Json::Value(Json::StaticString("GA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGM)
+            {
+                output = Json::Value(Json::StaticString("GM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGE)
+            {
+                output = Json::Value(Json::StaticString("GE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeDE)
+            {
+                output = Json::Value(Json::StaticString("DE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGH)
+            {
+                output = Json::Value(Json::StaticString("GH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGI)
+            {
+                output = Json::Value(Json::StaticString("GI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGR)
+            {
+                output = Json::Value(Json::StaticString("GR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGL)
+            {
+                output = Json::Value(Json::StaticString("GL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGD)
+            {
+                output = Json::Value(Json::StaticString("GD"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGP)
+            {
+                output = Json::Value(Json::StaticString("GP"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGU)
+            {
+                output = Json::Value(Json::StaticString("GU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGT)
+            {
+                output = Json::Value(Json::StaticString("GT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGG)
+            {
+                output = Json::Value(Json::StaticString("GG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGN)
+            {
+                output = Json::Value(Json::StaticString("GN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGW)
+            {
+                output = Json::Value(Json::StaticString("GW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGY)
+            {
+                output = Json::Value(Json::StaticString("GY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeHT)
+            {
+                output = Json::Value(Json::StaticString("HT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeHM)
+            {
+                output = Json::Value(Json::StaticString("HM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeVA)
+            {
+                output = Json::Value(Json::StaticString("VA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeHN)
+            {
+                output = Json::Value(Json::StaticString("HN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeHK)
+            {
+                output = Json::Value(Json::StaticString("HK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeHU)
+            {
+                output = Json::Value(Json::StaticString("HU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIS)
+            {
+                output = Json::Value(Json::StaticString("IS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIN)
+            {
+                output = Json::Value(Json::StaticString("IN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeID)
+            {
+                output = Json::Value(Json::StaticString("ID"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIR)
+            {
+                output = Json::Value(Json::StaticString("IR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIQ)
+            {
+                output = Json::Value(Json::StaticString("IQ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIE)
+            {
+                output = Json::Value(Json::StaticString("IE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIM)
+            {
+                output = Json::Value(Json::StaticString("IM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIL)
+            {
+                output = Json::Value(Json::StaticString("IL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIT)
+            {
+                output = Json::Value(Json::StaticString("IT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeJM)
+            {
+                output = Json::Value(Json::StaticString("JM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeJP)
+            {
+                output = Json::Value(Json::StaticString("JP"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeJE)
+            {
+                output = Json::Value(Json::StaticString("JE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeJO)
+            {
+                output = Json::Value(Json::StaticString("JO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKZ)
+            {
+                output = Json::Value(Json::StaticString("KZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKE)
+            {
+                output = Json::Value(Json::StaticString("KE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKI)
+            {
+                output = Json::Value(Json::StaticString("KI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKP)
+            {
+                output = Json::Value(Json::StaticString("KP"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKR)
+            {
+                output = Json::Value(Json::StaticString("KR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKW)
+            {
+                output = Json::Value(Json::StaticString("KW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKG)
+            {
+                output = Json::Value(Json::StaticString("KG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLA)
+            {
+                output = Json::Value(Json::StaticString("LA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLV)
+            {
+                output = Json::Value(Json::StaticString("LV"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLB)
+            {
+                output = Json::Value(Json::StaticString("LB"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLS)
+            {
+                output = Json::Value(Json::StaticString("LS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLR)
+            {
+                output = Json::Value(Json::StaticString("LR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLY)
+            {
+                output = Json::Value(Json::StaticString("LY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLI)
+            {
+                output = Json::Value(Json::StaticString("LI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLT)
+            {
+                output = Json::Value(Json::StaticString("LT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLU)
+            {
+                output = Json::Value(Json::StaticString("LU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMO)
+            {
+                output = Json::Value(Json::StaticString("MO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMK)
+            {
+                output = Json::Value(Json::StaticString("MK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMG)
+            {
+                output = Json::Value(Json::StaticString("MG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMW)
+            {
+                output = Json::Value(Json::StaticString("MW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMY)
+            {
+                output = Json::Value(Json::StaticString("MY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMV)
+            {
+                output = Json::Value(Json::StaticString("MV"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeML)
+            {
+                output = Json::Value(Json::StaticString("ML"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMT)
+            {
+                output = Json::Value(Json::StaticString("MT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMH)
+            {
+                output = Json::Value(Json::StaticString("MH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMQ)
+            {
+                output = Json::Value(Json::StaticString("MQ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMR)
+            {
+                output = Json::Value(Json::StaticString("MR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMU)
+            {
+                output = Json::Value(Json::StaticString("MU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeYT)
+            {
+                output = Json::Value(Json::StaticString("YT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMX)
+            {
+                output = Json::Value(Json::StaticString("MX"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeFM)
+            {
+                output = Json::Value(Json::StaticString("FM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMD)
+            {
+                output = Json::Value(Json::StaticString("MD"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMC)
+            {
+                output = Json::Value(Json::StaticString("MC"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMN)
+            {
+                output = Json::Value(Json::StaticString("MN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeME)
+            {
+                output = Json::Value(Json::StaticString("ME"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMS)
+            {
+                output = Json::Value(Json::StaticString("MS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMA)
+            {
+                output = Json::Value(Json::StaticString("MA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMZ)
+            {
+                output = Json::Value(Json::StaticString("MZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMM)
+            {
+                output = Json::Value(Json::StaticString("MM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNA)
+            {
+                output = Json::Value(Json::StaticString("NA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNR)
+            {
+                output = Json::Value(Json::StaticString("NR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNP)
+            {
+                output = Json::Value(Json::StaticString("NP"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNL)
+            {
+                output = Json::Value(Json::StaticString("NL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNC)
+            {
+                output = Json::Value(Json::StaticString("NC"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNZ)
+            {
+                output = Json::Value(Json::StaticString("NZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNI)
+            {
+                output = Json::Value(Json::StaticString("NI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNE)
+            {
+                output = Json::Value(Json::StaticString("NE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNG)
+            {
+                output = Json::Value(Json::StaticString("NG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNU)
+            {
+                output = Json::Value(Json::StaticString("NU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNF)
+            {
+                output = Json::Value(Json::StaticString("NF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMP)
+            {
+                output = Json::Value(Json::StaticString("MP"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNO)
+            {
+                output = Json::Value(Json::StaticString("NO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeOM)
+            {
+                output = Json::Value(Json::StaticString("OM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePK)
+            {
+                output = Json::Value(Json::StaticString("PK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePW)
+            {
+                output = Json::Value(Json::StaticString("PW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePS)
+            {
+                output = Json::Value(Json::StaticString("PS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePA)
+            {
+                output = Json::Value(Json::StaticString("PA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePG)
+            {
+                output = Json::Value(Json::StaticString("PG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePY)
+            {
+                output = Json::Value(Json::StaticString("PY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePE)
+            {
+                output = Json::Value(Json::StaticString("PE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePH)
+            {
+                output = Json::Value(Json::StaticString("PH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePN)
+            {
+                output = Json::Value(Json::StaticString("PN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePL)
+            {
+                output = Json::Value(Json::StaticString("PL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePT)
+            {
+                output = Json::Value(Json::StaticString("PT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePR)
+            {
+                output = Json::Value(Json::StaticString("PR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeQA)
+            {
+                output = Json::Value(Json::StaticString("QA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeRE)
+            {
+                output = Json::Value(Json::StaticString("RE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeRO)
+            {
+                output = Json::Value(Json::StaticString("RO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeRU)
+            {
+                output = Json::Value(Json::StaticString("RU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeRW)
+            {
+                output = Json::Value(Json::StaticString("RW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBL)
+            {
+                output = Json::Value(Json::StaticString("BL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSH)
+            {
+                output = Json::Value(Json::StaticString("SH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKN)
+            {
+                output = Json::Value(Json::StaticString("KN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLC)
+            {
+                output = Json::Value(Json::StaticString("LC"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMF)
+            {
+                output = Json::Value(Json::StaticString("MF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePM)
+            {
+                output = Json::Value(Json::StaticString("PM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeVC)
+            {
+                output = Json::Value(Json::StaticString("VC"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeWS)
+            {
+                output = Json::Value(Json::StaticString("WS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSM)
+            {
+                output = Json::Value(Json::StaticString("SM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeST)
+            {
+                output = Json::Value(Json::StaticString("ST"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSA)
+            {
+                output = Json::Value(Json::StaticString("SA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSN)
+            {
+                output = Json::Value(Json::StaticString("SN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeRS)
+            {
+                output = Json::Value(Json::StaticString("RS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSC)
+            {
+                output = Json::Value(Json::StaticString("SC"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSL)
+            {
+                output = Json::Value(Json::StaticString("SL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSG)
+            {
+                output = Json::Value(Json::StaticString("SG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSX)
+            {
+                output = Json::Value(Json::StaticString("SX"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSK)
+            {
+                output = Json::Value(Json::StaticString("SK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSI)
+            {
+                output = Json::Value(Json::StaticString("SI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSB)
+            {
+                output = Json::Value(Json::StaticString("SB"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSO)
+            {
+                output = Json::Value(Json::StaticString("SO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeZA)
+            {
+                output = Json::Value(Json::StaticString("ZA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGS)
+            {
+                output = Json::Value(Json::StaticString("GS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSS)
+            {
+                output = Json::Value(Json::StaticString("SS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeES)
+            {
+                output = Json::Value(Json::StaticString("ES"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLK)
+            {
+                output = Json::Value(Json::StaticString("LK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSD)
+            {
+                output = Json::Value(Json::StaticString("SD"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSR)
+            {
+                output = Json::Value(Json::StaticString("SR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSJ)
+            {
+                output = Json::Value(Json::StaticString("SJ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSZ)
+            {
+                output = Json::Value(Json::StaticString("SZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSE)
+            {
+                output = Json::Value(Json::StaticString("SE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCH)
+            {
+                output = Json::Value(Json::StaticString("CH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSY)
+            {
+                output = Json::Value(Json::StaticString("SY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTW)
+            {
+                output = Json::Value(Json::StaticString("TW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTJ)
+            {
+                output = Json::Value(Json::StaticString("TJ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTZ)
+            {
+                output = Json::Value(Json::StaticString("TZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTH)
+            {
+                output = Json::Value(Json::StaticString("TH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTL)
+            {
+                output = Json::Value(Json::StaticString("TL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTG)
+            {
+                output = Json::Value(Json::StaticString("TG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTK)
+            {
+                output = Json::Value(Json::StaticString("TK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTO)
+            {
+                output = Json::Value(Json::StaticString("TO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTT)
+            {
+                output = Json::Value(Json::StaticString("TT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTN)
+            {
+                output = Json::Value(Json::StaticString("TN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTR)
+            {
+                output = Json::Value(Json::StaticString("TR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTM)
+            {
+                output = Json::Value(Json::StaticString("TM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTC)
+            {
+                output = Json::Value(Json::StaticString("TC"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTV)
+            {
+                output = Json::Value(Json::StaticString("TV"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeUG)
+            {
+                output = Json::Value(Json::StaticString("UG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeUA)
+            {
+                output = Json::Value(Json::StaticString("UA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAE)
+            {
+                output = Json::Value(Json::StaticString("AE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGB)
+            {
+                output = Json::Value(Json::StaticString("GB"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeUS)
+            {
+                output = Json::Value(Json::StaticString("US"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeUM)
+            {
+                output = Json::Value(Json::StaticString("UM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeUY)
+            {
+                output = Json::Value(Json::StaticString("UY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeUZ)
+            {
+                output = Json::Value(Json::StaticString("UZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeVU)
+            {
+                output = Json::Value(Json::StaticString("VU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeVE)
+            {
+                output = Json::Value(Json::StaticString("VE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeVN)
+            {
+                output = Json::Value(Json::StaticString("VN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeVG)
+            {
+                output = Json::Value(Json::StaticString("VG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeVI)
+            {
+                output = Json::Value(Json::StaticString("VI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeWF)
+            {
+                output = Json::Value(Json::StaticString("WF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeEH)
+            {
+                output = Json::Value(Json::StaticString("EH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeYE)
+            {
+                output = Json::Value(Json::StaticString("YE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeZM)
+            {
+                output = Json::Value(Json::StaticString("ZM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeZW)
+            {
+                output = Json::Value(Json::StaticString("ZW"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, CountryCode& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "AF")
+            {
+                output = CountryCode::CountryCodeAF;
+                return;
+            }
+            if (inputStr == "AX")
+            {
+                output = CountryCode::CountryCodeAX;
+                return;
+            }
+            if (inputStr == "AL")
+            {
+                output = CountryCode::CountryCodeAL;
+                return;
+            }
+            if (inputStr == "DZ")
+            {
+                output = CountryCode::CountryCodeDZ;
+                return;
+            }
+            if (inputStr == "AS")
+            {
+                output = CountryCode::CountryCodeAS;
+                return;
+            }
+            if (inputStr == "AD")
+            {
+                output = CountryCode::CountryCodeAD;
+                return;
+            }
+            if (inputStr == "AO")
+            {
+                output = CountryCode::CountryCodeAO;
+                return;
+            }
+            if (inputStr == "AI")
+            {
+                output = CountryCode::CountryCodeAI;
+                return;
+            }
+            if (inputStr == "AQ")
+            {
+                output = CountryCode::CountryCodeAQ;
+                return;
+            }
+            if (inputStr == "AG")
+            {
+                output = CountryCode::CountryCodeAG;
+                return;
+            }
+            if (inputStr == "AR")
+            {
+                output = CountryCode::CountryCodeAR;
+                return;
+            }
+            if (inputStr == "AM")
+            {
+                output = CountryCode::CountryCodeAM;
+                return;
+            }
+            if (inputStr == "AW")
+            {
+                output = CountryCode::CountryCodeAW;
+                return;
+            }
+            if (inputStr == "AU")
+            {
+                output = CountryCode::CountryCodeAU;
+                return;
+            }
+            if (inputStr == "AT")
+            {
+                output = CountryCode::CountryCodeAT;
+                return;
+            }
+            if (inputStr == "AZ")
+            {
+                output = CountryCode::CountryCodeAZ;
+                return;
+            }
+            if (inputStr == "BS")
+            {
+                output = CountryCode::CountryCodeBS;
+                return;
+            }
+            if (inputStr == "BH")
+            {
+                output = CountryCode::CountryCodeBH;
+                return;
+            }
+            if (inputStr == "BD")
+            {
+                output = CountryCode::CountryCodeBD;
+                return;
+            }
+            if (inputStr == "BB")
+            {
+                output = CountryCode::CountryCodeBB;
+                return;
+            }
+            if (inputStr == "BY")
+            {
+                output = CountryCode::CountryCodeBY;
+                return;
+            }
+            if (inputStr == "BE")
+            {
+                output = CountryCode::CountryCodeBE;
+                return;
+            }
+            if (inputStr == "BZ")
+            {
+                output = CountryCode::CountryCodeBZ;
+                return;
+            }
+            if (inputStr == "BJ")
+            {
+                output = CountryCode::CountryCodeBJ;
+                return;
+            }
+            if (inputStr == "BM")
+            {
+                output = CountryCode::CountryCodeBM;
+                return;
+            }
+            if (inputStr == "BT")
+            {
+                output = CountryCode::CountryCodeBT;
+                return;
+            }
+            if (inputStr == "BO")
+            {
+                output = CountryCode::CountryCodeBO;
+                return;
+            }
+            if (inputStr == "BQ")
+            {
+                output = CountryCode::CountryCodeBQ;
+                return;
+            }
+            if (inputStr == "BA")
+            {
+                output = CountryCode::CountryCodeBA;
+                return;
+            }
+            if (inputStr == "BW")
+            {
+                output = CountryCode::CountryCodeBW;
+                return;
+            }
+            if (inputStr == "BV")
+            {
+                output = CountryCode::CountryCodeBV;
+                return;
+            }
+            if (inputStr == "BR")
+            {
+                output = CountryCode::CountryCodeBR;
+                return;
+            }
+            if (inputStr == "IO")
+            {
+                output = CountryCode::CountryCodeIO;
+                return;
+            }
+            if (inputStr == "BN")
+            {
+                output = CountryCode::CountryCodeBN;
+                return;
+            }
+            if (inputStr == "BG")
+            {
+                output = CountryCode::CountryCodeBG;
+                return;
+            }
+            if (inputStr == "BF")
+            {
+                output = CountryCode::CountryCodeBF;
+                return;
+            }
+            if (inputStr == "BI")
+            {
+                output = CountryCode::CountryCodeBI;
+                return;
+            }
+            if (inputStr == "KH")
+            {
+                output = CountryCode::CountryCodeKH;
+                return;
+            }
+            if (inputStr == "CM")
+            {
+                output = CountryCode::CountryCodeCM;
+                return;
+            }
+            if (inputStr == "CA")
+            {
+                output = CountryCode::CountryCodeCA;
+                return;
+            }
+            if (inputStr == "CV")
+            {
+                output = CountryCode::CountryCodeCV;
+                return;
+            }
+            if (inputStr == "KY")
+            {
+                output = CountryCode::CountryCodeKY;
+                return;
+            }
+            if (inputStr == "CF")
+            {
+                output = CountryCode::CountryCodeCF;
+                return;
+            }
+            if (inputStr == "TD")
+            {
+                output = CountryCode::CountryCodeTD;
+                return;
+            }
+            if (inputStr == "CL")
+            {
+                output = CountryCode::CountryCodeCL;
+                return;
+            }
+            if (inputStr == "CN")
+            {
+                output = CountryCode::CountryCodeCN;
+                return;
+            }
+            if (inputStr == "CX")
+            {
+                output = CountryCode::CountryCodeCX;
+                return;
+            }
+            if (inputStr == "CC")
+            {
+                output = CountryCode::CountryCodeCC;
+                return;
+            }
+            if (inputStr == "CO")
+            {
+                output = CountryCode::CountryCodeCO;
+                return;
+            }
+            if (inputStr == "KM")
+            {
+                output = CountryCode::CountryCodeKM;
+                return;
+            }
+            if (inputStr == "CG")
+            {
+                output = CountryCode::CountryCodeCG;
+                return;
+            }
+            if (inputStr == "CD")
+            {
+                output = CountryCode::CountryCodeCD;
+                return;
+            }
+            if (inputStr == "CK")
+            {
+                output = CountryCode::CountryCodeCK;
+                return;
+            }
+            if (inputStr == "CR")
+            {
+                output = CountryCode::CountryCodeCR;
+                return;
+            }
+            if (inputStr == "CI")
+            {
+                output = CountryCode::CountryCodeCI;
+                return;
+            }
+            if (inputStr == "HR")
+            {
+                output = CountryCode::CountryCodeHR;
+                return;
+            }
+            if (inputStr == "CU")
+            {
+                output = CountryCode::CountryCodeCU;
+                return;
+            }
+            if (inputStr == "CW")
+            {
+                output = CountryCode::CountryCodeCW;
+                return;
+            }
+            if (inputStr == "CY")
+            {
+                output = CountryCode::CountryCodeCY;
+                return;
+            }
+            if (inputStr == "CZ")
+            {
+                output = CountryCode::CountryCodeCZ;
+                return;
+            }
+            if (inputStr == "DK")
+            {
+                output = CountryCode::CountryCodeDK;
+                return;
+            }
+            if (inputStr == "DJ")
+            {
+                output = CountryCode::CountryCodeDJ;
+                return;
+            }
+            if (inputStr == "DM")
+            {
+                output = CountryCode::CountryCodeDM;
+                return;
+            }
+            if (inputStr == "DO")
+            {
+                output = CountryCode::CountryCodeDO;
+                return;
+            }
+            if (inputStr == "EC")
+            {
+                output = CountryCode::CountryCodeEC;
+                return;
+            }
+            if (inputStr == "EG")
+            {
+                output = CountryCode::CountryCodeEG;
+                return;
+            }
+            if (inputStr == "SV")
+            {
+                output = CountryCode::CountryCodeSV;
+                return;
+            }
+            if (inputStr == "GQ")
+            {
+                output = CountryCode::CountryCodeGQ;
+                return;
+            }
+            if (inputStr == "ER")
+            {
+                output = CountryCode::CountryCodeER;
+                return;
+            }
+            if (inputStr == "EE")
+            {
+                output = CountryCode::CountryCodeEE;
+                return;
+            }
+            if (inputStr == "ET")
+            {
+                output = CountryCode::CountryCodeET;
+                return;
+            }
+            if (inputStr == "FK")
+            {
+                output = CountryCode::CountryCodeFK;
+                return;
+            }
+            if (inputStr == "FO")
+            {
+                output = CountryCode::CountryCodeFO;
+                return;
+            }
+            if (inputStr == "FJ")
+            {
+                output = CountryCode::CountryCodeFJ;
+                return;
+            }
+            if (inputStr == "FI")
+            {
+                output = CountryCode::CountryCodeFI;
+                return;
+            }
+            if (inputStr == "FR")
+            {
+                output = CountryCode::CountryCodeFR;
+                return;
+            }
+            if (inputStr == "GF")
+            {
+                output = CountryCode::CountryCodeGF;
+                return;
+            }
+            if (inputStr == "PF")
+            {
+                output = CountryCode::CountryCodePF;
+                return;
+            }
+            if (inputStr == "TF")
+            {
+                output = CountryCode::CountryCodeTF;
+                return;
+            }
+            if (inputStr == "GA")
+            {
+                output = CountryCode::CountryCodeGA;
+                return;
+            }
+            if (inputStr == "GM")
+            {
+                output = CountryCode::CountryCodeGM;
+                return;
+            }
+            if (inputStr == "GE")
+            {
+                output = CountryCode::CountryCodeGE;
+                return;
+            }
+            if (inputStr == "DE")
+            {
+                output = CountryCode::CountryCodeDE;
+                return;
+            }
+            if (inputStr == "GH")
+            {
+                output = CountryCode::CountryCodeGH;
+                return;
+            }
+            if (inputStr == "GI")
+            {
+                output = CountryCode::CountryCodeGI;
+                return;
+            }
+            if (inputStr == "GR")
+            {
+                output = CountryCode::CountryCodeGR;
+                return;
+            }
+            if (inputStr == "GL")
+            {
+                output = CountryCode::CountryCodeGL;
+                return;
+            }
+            if (inputStr == "GD")
+            {
+                output = CountryCode::CountryCodeGD;
+                return;
+            }
+            if (inputStr == "GP")
+            {
+                output = CountryCode::CountryCodeGP;
+                return;
+            }
+            if (inputStr == "GU")
+            {
+                output = CountryCode::CountryCodeGU;
+                return;
+            }
+            if (inputStr == "GT")
+            {
+                output = CountryCode::CountryCodeGT;
+                return;
+            }
+            if (inputStr == "GG")
+            {
+                output = CountryCode::CountryCodeGG;
+                return;
+            }
+            if (inputStr == "GN")
+            {
+                output = CountryCode::CountryCodeGN;
+                return;
+            }
+            if (inputStr == "GW")
+            {
+                output = CountryCode::CountryCodeGW;
+                return;
+            }
+            if (inputStr == "GY")
+            {
+                output = CountryCode::CountryCodeGY;
+                return;
+            }
+            if (inputStr == "HT")
+            {
+                output = CountryCode::CountryCodeHT;
+                return;
+            }
+            if (inputStr == "HM")
+            {
+                output = CountryCode::CountryCodeHM;
+                return;
+            }
+            if (inputStr == "VA")
+            {
+                output = CountryCode::CountryCodeVA;
+                return;
+            }
+            if (inputStr == "HN")
+            {
+                output = CountryCode::CountryCodeHN;
+                return;
+            }
+            if (inputStr == "HK")
+            {
+                output = CountryCode::CountryCodeHK;
+                return;
+            }
+            if (inputStr == "HU")
+            {
+                output = CountryCode::CountryCodeHU;
+                return;
+            }
+            if (inputStr == "IS")
+            {
+                output = CountryCode::CountryCodeIS;
+                return;
+            }
+            if (inputStr == "IN")
+            {
+                output = CountryCode::CountryCodeIN;
+                return;
+            }
+            if (inputStr == "ID")
+            {
+                output = CountryCode::CountryCodeID;
+                return;
+            }
+            if (inputStr == "IR")
+            {
+                output = CountryCode::CountryCodeIR;
+                return;
+            }
+            if (inputStr == "IQ")
+            {
+                output = CountryCode::CountryCodeIQ;
+                return;
+            }
+            if (inputStr == "IE")
+            {
+                output = CountryCode::CountryCodeIE;
+                return;
+            }
+            if (inputStr == "IM")
+            {
+                output = CountryCode::CountryCodeIM;
+                return;
+            }
+            if (inputStr == "IL")
+            {
+                output = CountryCode::CountryCodeIL;
+                return;
+            }
+            if (inputStr == "IT")
+            {
+                output = CountryCode::CountryCodeIT;
+                return;
+            }
+            if (inputStr == "JM")
+            {
+                output = CountryCode::CountryCodeJM;
+                return;
+            }
+            if (inputStr == "JP")
+            {
+                output = CountryCode::CountryCodeJP;
+                return;
+            }
+            if (inputStr == "JE")
+            {
+                output = CountryCode::CountryCodeJE;
+                return;
+            }
+            if (inputStr == "JO")
+            {
+                output = CountryCode::CountryCodeJO;
+                return;
+            }
+            if (inputStr == "KZ")
+            {
+                output = CountryCode::CountryCodeKZ;
+                return;
+            }
+            if (inputStr == "KE")
+            {
+                output = CountryCode::CountryCodeKE;
+                return;
+            }
+            if (inputStr == "KI")
+            {
+                output = CountryCode::CountryCodeKI;
+                return;
+            }
+            if (inputStr == "KP")
+            {
+                output = CountryCode::CountryCodeKP;
+                return;
+            }
+            if (inputStr == "KR")
+            {
+                output = CountryCode::CountryCodeKR;
+                return;
+            }
+            if (inputStr == "KW")
+            {
+                output = CountryCode::CountryCodeKW;
+                return;
+            }
+            if (inputStr == "KG")
+            {
+                output = CountryCode::CountryCodeKG;
+                return;
+            }
+            if (inputStr == "LA")
+            {
+                output = CountryCode::CountryCodeLA;
+                return;
+            }
+            if (inputStr == "LV")
+            {
+                output = CountryCode::CountryCodeLV;
+                return;
+            }
+            if (inputStr == "LB")
+            {
+                output = CountryCode::CountryCodeLB;
+                return;
+            }
+            if (inputStr == "LS")
+            {
+                output = CountryCode::CountryCodeLS;
+                return;
+            }
+            if (inputStr == "LR")
+            {
+                output = CountryCode::CountryCodeLR;
+                return;
+            }
+            if (inputStr == "LY")
+            {
+                output = CountryCode::CountryCodeLY;
+                return;
+            }
+            if (inputStr == "LI")
+            {
+                output = CountryCode::CountryCodeLI;
+                return;
+            }
+            if (inputStr == "LT")
+            {
+                output = CountryCode::CountryCodeLT;
+                return;
+            }
+            if (inputStr == "LU")
+            {
+                output = CountryCode::CountryCodeLU;
+                return;
+            }
+            if (inputStr == "MO")
+            {
+                output = CountryCode::CountryCodeMO;
+                return;
+            }
+            if (inputStr == "MK")
+            {
+                output = CountryCode::CountryCodeMK;
+                return;
+            }
+            if (inputStr == "MG")
+            {
+                output = CountryCode::CountryCodeMG;
+                return;
+            }
+            if (inputStr == "MW")
+            {
+                output = CountryCode::CountryCodeMW;
+                return;
+            }
+            if (inputStr == "MY")
+            {
+                output = CountryCode::CountryCodeMY;
+                return;
+            }
+            if (inputStr == "MV")
+            {
+                output = CountryCode::CountryCodeMV;
+                return;
+            }
+            if (inputStr == "ML")
+            {
+                output = CountryCode::CountryCodeML;
+                return;
+            }
+            if (inputStr == "MT")
+            {
+                output = CountryCode::CountryCodeMT;
+                return;
+            }
+            if (inputStr == "MH")
+            {
+                output = CountryCode::CountryCodeMH;
+                return;
+            }
+            if (inputStr == "MQ")
+            {
+                output = CountryCode::CountryCodeMQ;
+                return;
+            }
+            if (inputStr == "MR")
+            {
+                output = CountryCode::CountryCodeMR;
+                return;
+            }
+            if (inputStr == "MU")
+            {
+                output = CountryCode::CountryCodeMU;
+                return;
+            }
+            if (inputStr == "YT")
+            {
+                output = CountryCode::CountryCodeYT;
+                return;
+            }
+            if (inputStr == "MX")
+            {
+                output = CountryCode::CountryCodeMX;
+                return;
+            }
+            if (inputStr == "FM")
+            {
+                output = CountryCode::CountryCodeFM;
+                return;
+            }
+            if (inputStr == "MD")
+            {
+                output = CountryCode::CountryCodeMD;
+                return;
+            }
+            if (inputStr == "MC")
+            {
+                output = CountryCode::CountryCodeMC;
+                return;
+            }
+            if (inputStr == "MN")
+            {
+                output = CountryCode::CountryCodeMN;
+                return;
+            }
+            if (inputStr == "ME")
+            {
+                output = CountryCode::CountryCodeME;
+                return;
+            }
+            if (inputStr == "MS")
+            {
+                output = CountryCode::CountryCodeMS;
+                return;
+            }
+            if (inputStr == "MA")
+            {
+                output = CountryCode::CountryCodeMA;
+                return;
+            }
+            if (inputStr == "MZ")
+            {
+                output = CountryCode::CountryCodeMZ;
+                return;
+            }
+            if (inputStr == "MM")
+            {
+                output = CountryCode::CountryCodeMM;
+                return;
+            }
+            if (inputStr == "NA")
+            {
+                output = CountryCode::CountryCodeNA;
+                return;
+            }
+            if (inputStr == "NR")
+            {
+                output = CountryCode::CountryCodeNR;
+                return;
+            }
+            if (inputStr == "NP")
+            {
+                output = CountryCode::CountryCodeNP;
+                return;
+            }
+            if (inputStr == "NL")
+            {
+                output = CountryCode::CountryCodeNL;
+                return;
+            }
+            if (inputStr == "NC")
+            {
+                output = CountryCode::CountryCodeNC;
+                return;
+            }
+            if (inputStr == "NZ")
+            {
+                output = CountryCode::CountryCodeNZ;
+                return;
+            }
+            if (inputStr == "NI")
+            {
+                output = CountryCode::CountryCodeNI;
+                return;
+            }
+            if (inputStr == "NE")
+            {
+                output = CountryCode::CountryCodeNE;
+                return;
+            }
+            if (inputStr == "NG")
+            {
+                output = CountryCode::CountryCodeNG;
+                return;
+            }
+            if (inputStr == "NU")
+            {
+                output = CountryCode::CountryCodeNU;
+                return;
+            }
+            if (inputStr == "NF")
+            {
+                output = CountryCode::CountryCodeNF;
+                return;
+            }
+            if (inputStr == "MP")
+            {
+                output = CountryCode::CountryCodeMP;
+                return;
+            }
+            if (inputStr == "NO")
+            {
+                output = CountryCode::CountryCodeNO;
+                return;
+            }
+            if (inputStr == "OM")
+            {
+                output = CountryCode::CountryCodeOM;
+                return;
+            }
+            if (inputStr == "PK")
+            {
+                output = CountryCode::CountryCodePK;
+                return;
+            }
+            if (inputStr == "PW")
+            {
+                output = CountryCode::CountryCodePW;
+                return;
+            }
+            if (inputStr == "PS")
+            {
+                output = CountryCode::CountryCodePS;
+                return;
+            }
+            if (inputStr == "PA")
+            {
+                output = CountryCode::CountryCodePA;
+                return;
+            }
+            if (inputStr == "PG")
+            {
+                output = CountryCode::CountryCodePG;
+                return;
+            }
+            if (inputStr == "PY")
+            {
+                output = CountryCode::CountryCodePY;
+                return;
+            }
+            if (inputStr == "PE")
+            {
+                output = CountryCode::CountryCodePE;
+                return;
+            }
+            if (inputStr == "PH")
+            {
+                output = CountryCode::CountryCodePH;
+                return;
+            }
+            if (inputStr == "PN")
+            {
+                output = CountryCode::CountryCodePN;
+                return;
+            }
+            if (inputStr == "PL")
+            {
+                output = CountryCode::CountryCodePL;
+                return;
+            }
+            if (inputStr == "PT")
+            {
+                output = CountryCode::CountryCodePT;
+                return;
+            }
+            if (inputStr == "PR")
+            {
+                output = CountryCode::CountryCodePR;
+                return;
+            }
+            if (inputStr == "QA")
+            {
+                output = CountryCode::CountryCodeQA;
+                return;
+            }
+            if (inputStr == "RE")
+            {
+                output = CountryCode::CountryCodeRE;
+                return;
+            }
+            if (inputStr == "RO")
+            {
+                output = CountryCode::CountryCodeRO;
+                return;
+            }
+            if (inputStr == "RU")
+            {
+                output = CountryCode::CountryCodeRU;
+                return;
+            }
+            if (inputStr == "RW")
+            {
+                output = CountryCode::CountryCodeRW;
+                return;
+            }
+            if (inputStr == "BL")
+            {
+                output = CountryCode::CountryCodeBL;
+                return;
+            }
+            if (inputStr == "SH")
+            {
+                output = CountryCode::CountryCodeSH;
+                return;
+            }
+            if (inputStr == "KN")
+            {
+                output = CountryCode::CountryCodeKN;
+                return;
+            }
+            if (inputStr == "LC")
+            {
+                output = CountryCode::CountryCodeLC;
+                return;
+            }
+            if (inputStr == "MF")
+            {
+                output = CountryCode::CountryCodeMF;
+                return;
+            }
+            if (inputStr == "PM")
+            {
+                output = CountryCode::CountryCodePM;
+                return;
+            }
+            if (inputStr == "VC")
+            {
+                output = CountryCode::CountryCodeVC;
+                return;
+            }
+            if (inputStr == "WS")
+            {
+                output = CountryCode::CountryCodeWS;
+                return;
+            }
+            if (inputStr == "SM")
+            {
+                output = CountryCode::CountryCodeSM;
+                return;
+            }
+            if (inputStr == "ST")
+            {
+                output = CountryCode::CountryCodeST;
+                return;
+            }
+            if (inputStr == "SA")
+            {
+                output = CountryCode::CountryCodeSA;
+                return;
+            }
+            if (inputStr == "SN")
+            {
+                output = CountryCode::CountryCodeSN;
+                return;
+            }
+            if (inputStr == "RS")
+            {
+                output = CountryCode::CountryCodeRS;
+                return;
+            }
+            if (inputStr == "SC")
+            {
+                output = CountryCode::CountryCodeSC;
+                return;
+            }
+            if (inputStr == "SL")
+            {
+                output = CountryCode::CountryCodeSL;
+                return;
+            }
+            if (inputStr == "SG")
+            {
+                output = CountryCode::CountryCodeSG;
+                return;
+            }
+            if (inputStr == "SX")
+            {
+                output = CountryCode::CountryCodeSX;
+                return;
+            }
+            if (inputStr == "SK")
+            {
+                output = CountryCode::CountryCodeSK;
+                return;
+            }
+            if (inputStr == "SI")
+            {
+                output = CountryCode::CountryCodeSI;
+                return;
+            }
+            if (inputStr == "SB")
+            {
+                output = CountryCode::CountryCodeSB;
+                return;
+            }
+            if (inputStr == "SO")
+            {
+                output = CountryCode::CountryCodeSO;
+                return;
+            }
+            if (inputStr == "ZA")
+            {
+                output = CountryCode::CountryCodeZA;
+                return;
+            }
+            if (inputStr == "GS")
+            {
+                output = CountryCode::CountryCodeGS;
+                return;
+            }
+            if (inputStr == "SS")
+            {
+                output = CountryCode::CountryCodeSS;
+                return;
+            }
+            if (inputStr == "ES")
+            {
+                output = CountryCode::CountryCodeES;
+                return;
+            }
+            if (inputStr == "LK")
+            {
+                output = CountryCode::CountryCodeLK;
+                return;
+            }
+            if (inputStr == "SD")
+            {
+                output = CountryCode::CountryCodeSD;
+                return;
+            }
+            if (inputStr == "SR")
+            {
+                output = CountryCode::CountryCodeSR;
+                return;
+            }
+            if (inputStr == "SJ")
+            {
+                output = CountryCode::CountryCodeSJ;
+                return;
+            }
+            if (inputStr == "SZ")
+            {
+                output = CountryCode::CountryCodeSZ;
+                return;
+            }
+            if (inputStr == "SE")
+            {
+                output = CountryCode::CountryCodeSE;
+                return;
+            }
+            if (inputStr == "CH")
+            {
+                output = CountryCode::CountryCodeCH;
+                return;
+            }
+            if (inputStr == "SY")
+            {
+                output = CountryCode::CountryCodeSY;
+                return;
+            }
+            if (inputStr == "TW")
+            {
+                output = CountryCode::CountryCodeTW;
+                return;
+            }
+            if (inputStr == "TJ")
+            {
+                output = CountryCode::CountryCodeTJ;
+                return;
+            }
+            if (inputStr == "TZ")
+            {
+                output = CountryCode::CountryCodeTZ;
+                return;
+            }
+            if (inputStr == "TH")
+            {
+                output = CountryCode::CountryCodeTH;
+                return;
+            }
+            if (inputStr == "TL")
+            {
+                output = CountryCode::CountryCodeTL;
+                return;
+            }
+            if (inputStr == "TG")
+            {
+                output = CountryCode::CountryCodeTG;
+                return;
+            }
+            if (inputStr == "TK")
+            {
+                output = CountryCode::CountryCodeTK;
+                return;
+            }
+            if (inputStr == "TO")
+            {
+                output = CountryCode::CountryCodeTO;
+                return;
+            }
+            if (inputStr == "TT")
+            {
+                output = CountryCode::CountryCodeTT;
+                return;
+            }
+            if (inputStr == "TN")
+            {
+                output = CountryCode::CountryCodeTN;
+                return;
+            }
+            if (inputStr == "TR")
+            {
+                output = CountryCode::CountryCodeTR;
+                return;
+            }
+            if (inputStr == "TM")
+            {
+                output = CountryCode::CountryCodeTM;
+                return;
+            }
+            if (inputStr == "TC")
+            {
+                output = CountryCode::CountryCodeTC;
+                return;
+            }
+            if (inputStr == "TV")
+            {
+                output = CountryCode::CountryCodeTV;
+                return;
+            }
+            if (inputStr == "UG")
+            {
+                output = CountryCode::CountryCodeUG;
+                return;
+            }
+            if (inputStr == "UA")
+            {
+                output = CountryCode::CountryCodeUA;
+                return;
+            }
+            if (inputStr == "AE")
+            {
+                output = CountryCode::CountryCodeAE;
+                return;
+            }
+            if (inputStr == "GB")
+            {
+                output = CountryCode::CountryCodeGB;
+                return;
+            }
+            if (inputStr == "US")
+            {
+                output = CountryCode::CountryCodeUS;
+                return;
+            }
+            if (inputStr == "UM")
+            {
+                output = CountryCode::CountryCodeUM;
+                return;
+            }
+            if (inputStr == "UY")
+            {
+                output = CountryCode::CountryCodeUY;
+                return;
+            }
+            if (inputStr == "UZ")
+            {
+                output = CountryCode::CountryCodeUZ;
+                return;
+            }
+            if (inputStr == "VU")
+            {
+                output = CountryCode::CountryCodeVU;
+                return;
+            }
+            if (inputStr == "VE")
+            {
+                output = CountryCode::CountryCodeVE;
+                return;
+            }
+            if (inputStr == "VN")
+            {
+                output = CountryCode::CountryCodeVN;
+                return;
+            }
+            if (inputStr == "VG")
+            {
+                output = CountryCode::CountryCodeVG;
+                return;
+            }
+            if (inputStr == "VI")
+            {
+                output = CountryCode::CountryCodeVI;
+                return;
+            }
+            if (inputStr == "WF")
+            {
+                output = CountryCode::CountryCodeWF;
+                return;
+            }
+            if (inputStr == "EH")
+            {
+                output = CountryCode::CountryCodeEH;
+                return;
+            }
+            if (inputStr == "YE")
+            {
+                output = CountryCode::CountryCodeYE;
+                return;
+            }
+            if (inputStr == "ZM")
+            {
+                output = CountryCode::CountryCodeZM;
+                return;
+            }
+            if (inputStr == "ZW")
+            {
+                output = CountryCode::CountryCodeZW;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const EmailVerificationStatus input, Json::Value& output)
+        {
+            if (input == EmailVerificationStatus::EmailVerificationStatusUnverified)
+            {
+                output = Json::Value(Json::StaticString("Unverified"));
+                return;
+            }
+            if (input == EmailVerificationStatus::EmailVerificationStatusPending)
+            {
+                output = Json::Value(Json::StaticString("Pending"));
+                return;
+            }
+            if (input == EmailVerificationStatus::EmailVerificationStatusConfirmed)
+            {
+                output = Json::Value(Json::StaticString("Confirmed"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, EmailVerificationStatus& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Unverified")
+            {
+                output = EmailVerificationStatus::EmailVerificationStatusUnverified;
+                return;
+            }
+            if (inputStr == "Pending")
+            {
+                output = EmailVerificationStatus::EmailVerificationStatusPending;
+                return;
+            }
+            if (inputStr == "Confirmed")
+            {
+                output = EmailVerificationStatus::EmailVerificationStatusConfirmed;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const LoginIdentityProvider input, Json::Value& output)
+        {
+            if (input == LoginIdentityProvider::LoginIdentityProviderUnknown)
+            {
+                output = Json::Value(Json::StaticString("Unknown"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderPlayFab)
+            {
+                output = Json::Value(Json::StaticString("PlayFab"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderCustom)
+            {
+                output = Json::Value(Json::StaticString("Custom"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderGameCenter)
+            {
+                output = Json::Value(Json::StaticString("GameCenter"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderGooglePlay)
+            {
+                output = Json::Value(Json::StaticString("GooglePlay"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderSteam)
+            {
+                output = Json::Value(Json::StaticString("Steam"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderXBoxLive)
+            {
+                output = Json::Value(Json::StaticString("XBoxLive"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderPSN)
+            {
+                output = Json::Value(Json::StaticString("PSN"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderKongregate)
+            {
+                output = Json::Value(Json::StaticString("Kongregate"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderFacebook)
+            {
+                output = Json::Value(Json::StaticString("Facebook"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderIOSDevice)
+            {
+                output = Json::Value(Json::StaticString("IOSDevice"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderAndroidDevice)
+            {
+                output = Json::Value(Json::StaticString("AndroidDevice"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderTwitch)
+            {
+                output = Json::Value(Json::StaticString("Twitch"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderWindowsHello)
+            {
+                output = Json::Value(Json::StaticString("WindowsHello"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderGameServer)
+            {
+                output = Json::Value(Json::StaticString("GameServer"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderCustomServer)
+            {
+                output = Json::Value(Json::StaticString("CustomServer"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderNintendoSwitch)
+            {
+                output = Json::Value(Json::StaticString("NintendoSwitch"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderFacebookInstantGames)
+            {
+                output = Json::Value(Json::StaticString("FacebookInstantGames"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderOpenIdConnect)
+            {
+                output = Json::Value(Json::StaticString("OpenIdConnect"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderApple)
+            {
+                output = Json::Value(Json::StaticString("Apple"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderNintendoSwitchAccount)
+            {
+                output = Json::Value(Json::StaticString("NintendoSwitchAccount"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, LoginIdentityProvider& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Unknown")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderUnknown;
+                return;
+            }
+            if (inputStr == "PlayFab")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderPlayFab;
+                return;
+            }
+            if (inputStr == "Custom")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderCustom;
+                return;
+            }
+            if (inputStr == "GameCenter")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderGameCenter;
+                return;
+            }
+            if (inputStr == "GooglePlay")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderGooglePlay;
+                return;
+            }
+            if (inputStr == "Steam")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderSteam;
+                return;
+            }
+            if (inputStr == "XBoxLive")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderXBoxLive;
+                return;
+            }
+            if (inputStr == "PSN")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderPSN;
+                return;
+            }
+            if (inputStr == "Kongregate")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderKongregate;
+                return;
+            }
+            if (inputStr == "Facebook")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderFacebook;
+                return;
+            }
+            if (inputStr == "IOSDevice")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderIOSDevice;
+                return;
+            }
+            if (inputStr == "AndroidDevice")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderAndroidDevice;
+                return;
+            }
+            if (inputStr == "Twitch")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderTwitch;
+                return;
+            }
+            if (inputStr == "WindowsHello")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderWindowsHello;
+                return;
+            }
+            if (inputStr == "GameServer")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderGameServer;
+                return;
+            }
+            if (inputStr == "CustomServer")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderCustomServer;
+                return;
+            }
+            if (inputStr == "NintendoSwitch")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderNintendoSwitch;
+                return;
+            }
+            if (inputStr == "FacebookInstantGames")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderFacebookInstantGames;
+                return;
+            }
+            if (inputStr == "OpenIdConnect")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderOpenIdConnect;
+                return;
+            }
+            if (inputStr == "Apple")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderApple;
+                return;
+            }
+            if (inputStr == "NintendoSwitchAccount")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderNintendoSwitchAccount;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const PushNotificationPlatform input, Json::Value& output)
+        {
+            if (input == PushNotificationPlatform::PushNotificationPlatformApplePushNotificationService)
+            {
+                output = Json::Value(Json::StaticString("ApplePushNotificationService"));
+                return;
+            }
+            if (input == PushNotificationPlatform::PushNotificationPlatformGoogleCloudMessaging)
+            {
+                output = Json::Value(Json::StaticString("GoogleCloudMessaging"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, PushNotificationPlatform& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "ApplePushNotificationService")
+            {
+                output = PushNotificationPlatform::PushNotificationPlatformApplePushNotificationService;
+                return;
+            }
+            if (inputStr == "GoogleCloudMessaging")
+            {
+                output = PushNotificationPlatform::PushNotificationPlatformGoogleCloudMessaging;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const SubscriptionProviderStatus input, Json::Value& output)
+        {
+            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusNoError)
+            {
+                output = Json::Value(Json::StaticString("NoError"));
+                return;
+            }
+            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusCancelled)
+            {
+                output = Json::Value(Json::StaticString("Cancelled"));
+                return;
+            }
+            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusUnknownError)
+            {
+                output = Json::Value(Json::StaticString("UnknownError"));
+                return;
+            }
+            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusBillingError)
+            {
+                output = Json::Value(Json::StaticString("BillingError"));
+                return;
+            }
+            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusProductUnavailable)
+            {
+                output = Json::Value(Json::StaticString("ProductUnavailable"));
+                return;
+            }
+            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusCustomerDidNotAcceptPriceChange)
+            {
+                output = Json::Value(Json::StaticString("CustomerDidNotAcceptPriceChange"));
+                return;
+            }
+            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusFreeTrial)
+            {
+                output = Json::Value(Json::StaticString("FreeTrial"));
+                return;
+            }
+            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusPaymentPending)
+            {
+                output = Json::Value(Json::StaticString("PaymentPending"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, SubscriptionProviderStatus& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "NoError")
+            {
+                output = SubscriptionProviderStatus::SubscriptionProviderStatusNoError;
+                return;
+            }
+            if (inputStr == "Cancelled")
+            {
+                output = SubscriptionProviderStatus::SubscriptionProviderStatusCancelled;
+                return;
+            }
+            if (inputStr == "UnknownError")
+            {
+                output = SubscriptionProviderStatus::SubscriptionProviderStatusUnknownError;
+                return;
+            }
+            if (inputStr == "BillingError")
+            {
+                output = SubscriptionProviderStatus::SubscriptionProviderStatusBillingError;
+                return;
+            }
+            if (inputStr == "ProductUnavailable")
+            {
+                output = SubscriptionProviderStatus::SubscriptionProviderStatusProductUnavailable;
+                return;
+            }
+            if (inputStr == "CustomerDidNotAcceptPriceChange")
+            {
+                output = SubscriptionProviderStatus::SubscriptionProviderStatusCustomerDidNotAcceptPriceChange;
+                return;
+            }
+            if (inputStr == "FreeTrial")
+            {
+                output = SubscriptionProviderStatus::SubscriptionProviderStatusFreeTrial;
+                return;
+            }
+            if (inputStr == "PaymentPending")
+            {
+                output = SubscriptionProviderStatus::SubscriptionProviderStatusPaymentPending;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const TriggerType input, Json::Value& output)
+        {
+            if (input == TriggerType::TriggerTypeHTTP)
+            {
+                output = Json::Value(Json::StaticString("HTTP"));
+                return;
+            }
+            if (input == TriggerType::TriggerTypeQueue)
+            {
+                output = Json::Value(Json::StaticString("Queue"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, TriggerType& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "HTTP")
+            {
+                output = TriggerType::TriggerTypeHTTP;
+                return;
+            }
+            if (inputStr == "Queue")
+            {
+                output = TriggerType::TriggerTypeQueue;
+                return;
+            }
+        }
+
+        void AdCampaignAttributionModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilT(FromJsonField(input, keyAttributedAt), AttributedAt);
+            FromJsonUtilS(FromJsonField(input, keyCampaignId), CampaignId);
+            FromJsonUtilS(FromJsonField(input, keyPlatform), Platform);
+        }
+
+        Json::Value AdCampaignAttributionModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AttributedAt; ToJsonUtilT(AttributedAt, each_AttributedAt); ToJsonField(output, keyAttributedAt) = each_AttributedAt;
+            Json::Value each_CampaignId; ToJsonUtilS(CampaignId, each_CampaignId); ToJsonField(output, keyCampaignId) = each_CampaignId;
+            Json::Value each_Platform; ToJsonUtilS(Platform, each_Platform); ToJsonField(output, keyPlatform) = each_Platform;
+            return output;
+        }
+
+        void ContactEmailInfoModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyEmailAddress), EmailAddress);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilE(FromJsonField(input, keyVerificationStatus), VerificationStatus);
+        }
+
+        Json::Value ContactEmailInfoModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_EmailAddress; ToJsonUtilS(EmailAddress, each_EmailAddress); ToJsonField(output, keyEmailAddress) = each_EmailAddress;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_VerificationStatus; ToJsonUtilE(VerificationStatus, each_VerificationStatus); ToJsonField(output, keyVerificationStatus) = each_VerificationStatus;
+            return output;
+        }
+
+        void EmptyResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value EmptyResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void EntityKey::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyId), Id);
+            FromJsonUtilS(FromJsonField(input, keyType), Type);
+        }
+
+        Json::Value EntityKey::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Id; ToJsonUtilS(Id, each_Id); ToJsonField(output, keyId) = each_Id;
+            Json::Value each_Type; ToJsonUtilS(Type, each_Type); ToJsonField(output, keyType) = each_Type;
+            return output;
+        }
+
+        void ScriptExecutionError::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyError), Error);
+            FromJsonUtilS(FromJsonField(input, keyMessage), Message);
+            FromJsonUtilS(FromJsonField(input, keyStackTrace), StackTrace);
+        }
+
+        Json::Value ScriptExecutionError::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Error; ToJsonUtilS(Error, each_Error); ToJsonField(output, keyError) = each_Error;
+            Json::Value each_Message; ToJsonUtilS(Message, each_Message); ToJsonField(output, keyMessage) = each_Message;
+            Json::Value each_StackTrace; ToJsonUtilS(StackTrace, each_StackTrace); ToJsonField(output, keyStackTrace) = each_StackTrace;
+            return output;
+        }
+
+        void LogStatement::FromJson(const Json::Value& input)
+        {
+            Data = FromJsonField(input, keyData);
+            FromJsonUtilS(FromJsonField(input, keyLevel), Level);
+            FromJsonUtilS(FromJsonField(input, keyMessage), Message);
+        }
+
+        Json::Value LogStatement::ToJson() const
+        {
+            Json::Value output;
+            ToJsonField(output, keyData) = Data;
+            Json::Value each_Level; ToJsonUtilS(Level, each_Level); ToJsonField(output, keyLevel) = each_Level;
+            Json::Value each_Message; ToJsonUtilS(Message, each_Message); ToJsonField(output, keyMessage) = each_Message;
+            return output;
+        }
+
+        void ExecuteCloudScriptResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyAPIRequestsIssued), APIRequestsIssued);
+            FromJsonUtilO(FromJsonField(input, keyError), Error);
+            FromJsonUtilP(FromJsonField(input, keyExecutionTimeSeconds), ExecutionTimeSeconds);
+            FromJsonUtilS(FromJsonField(input, keyFunctionName), FunctionName);
+            FunctionResult = FromJsonField(input, keyFunctionResult);
+            FromJsonUtilP(FromJsonField(input, keyFunctionResultTooLarge), FunctionResultTooLarge);
+            FromJsonUtilP(FromJsonField(input, keyHttpRequestsIssued), HttpRequestsIssued);
+            FromJsonUtilO(FromJsonField(input, keyLogs), Logs);
+            FromJsonUtilP(FromJsonField(input, keyLogsTooLarge), LogsTooLarge);
+            FromJsonUtilP(FromJsonField(input, keyMemoryConsumedBytes), MemoryConsumedBytes);
+            FromJsonUtilP(FromJsonField(input, keyProcessorTimeSeconds), ProcessorTimeSeconds);
+            FromJsonUtilP(FromJsonField(input, keyRevision), Revision);
+        }
+
+        Json::Value ExecuteCloudScriptResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_APIRequestsIssued; ToJsonUtilP(APIRequestsIssued, each_APIRequestsIssued); ToJsonField(output, keyAPIRequestsIssued) = each_APIRequestsIssued;
+            Json::Value each_Error; ToJsonUtilO(Error, each_Error); ToJsonField(output, keyError) = each_Error;
+            Json::Value each_ExecutionTimeSeconds; ToJsonUtilP(ExecutionTimeSeconds, each_ExecutionTimeSeconds); ToJsonField(output, keyExecutionTimeSeconds) = each_ExecutionTimeSeconds;
+            Json::Value each_FunctionName; ToJsonUtilS(FunctionName, each_FunctionName); ToJsonField(output, keyFunctionName) = each_FunctionName;
+            ToJsonField(output, keyFunctionResult) = FunctionResult;
+            Json::Value each_FunctionResultTooLarge; ToJsonUtilP(FunctionResultTooLarge, each_FunctionResultTooLarge); ToJsonField(output, keyFunctionResultTooLarge) = each_FunctionResultTooLarge;
+            Json::Value each_HttpRequestsIssued; ToJsonUtilP(HttpRequestsIssued, each_HttpRequestsIssued); ToJsonField(output, keyHttpRequestsIssued) = each_HttpRequestsIssued;
+            Json::Value each_Logs; ToJsonUtilO(Logs, each_Logs); ToJsonField(output, keyLogs) = each_Logs;
+            Json::Value each_LogsTooLarge; ToJsonUtilP(LogsTooLarge, each_LogsTooLarge); ToJsonField(output, keyLogsTooLarge) = each_LogsTooLarge;
+            Json::Value each_MemoryConsumedBytes; ToJsonUtilP(MemoryConsumedBytes, each_MemoryConsumedBytes); ToJsonField(output, keyMemoryConsumedBytes) = each_MemoryConsumedBytes;
+            Json::Value each_ProcessorTimeSeconds; ToJsonUtilP(ProcessorTimeSeconds, each_ProcessorTimeSeconds); ToJsonField(output, keyProcessorTimeSeconds) = each_ProcessorTimeSeconds;
+            Json::Value each_Revision; ToJsonUtilP(Revision, each_Revision); ToJsonField(output, keyRevision) = each_Revision;
+            return output;
+        }
+
+        void ExecuteEntityCloudScriptRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilS(FromJsonField(input, keyFunctionName), FunctionName);
+            FunctionParameter = FromJsonField(input, keyFunctionParameter);
+            FromJsonUtilP(FromJsonField(input, keyGeneratePlayStreamEvent), GeneratePlayStreamEvent);
+            FromJsonUtilE(FromJsonField(input, keyRevisionSelection), RevisionSelection);
+            FromJsonUtilP(FromJsonField(input, keySpecificRevision), SpecificRevision);
+        }
+
+        Json::Value ExecuteEntityCloudScriptRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_FunctionName; ToJsonUtilS(FunctionName, each_FunctionName); ToJsonField(output, keyFunctionName) = each_FunctionName;
+            ToJsonField(output, keyFunctionParameter) = FunctionParameter;
+            Json::Value each_GeneratePlayStreamEvent; ToJsonUtilP(GeneratePlayStreamEvent, each_GeneratePlayStreamEvent); ToJsonField(output, keyGeneratePlayStreamEvent) = each_GeneratePlayStreamEvent;
+            Json::Value each_RevisionSelection; ToJsonUtilE(RevisionSelection, each_RevisionSelection); ToJsonField(output, keyRevisionSelection) = each_RevisionSelection;
+            Json::Value each_SpecificRevision; ToJsonUtilP(SpecificRevision, each_SpecificRevision); ToJsonField(output, keySpecificRevision) = each_SpecificRevision;
+            return output;
+        }
+
+        void ExecuteFunctionRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilS(FromJsonField(input, keyFunctionName), FunctionName);
+            FunctionParameter = FromJsonField(input, keyFunctionParameter);
+            FromJsonUtilP(FromJsonField(input, keyGeneratePlayStreamEvent), GeneratePlayStreamEvent);
+        }
+
+        Json::Value ExecuteFunctionRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_FunctionName; ToJsonUtilS(FunctionName, each_FunctionName); ToJsonField(output, keyFunctionName) = each_FunctionName;
+            ToJsonField(output, keyFunctionParameter) = FunctionParameter;
+            Json::Value each_GeneratePlayStreamEvent; ToJsonUtilP(GeneratePlayStreamEvent, each_GeneratePlayStreamEvent); ToJsonField(output, keyGeneratePlayStreamEvent) = each_GeneratePlayStreamEvent;
+            return output;
+        }
+
+        void FunctionExecutionError::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyError), Error);
+            FromJsonUtilS(FromJsonField(input, keyMessage), Message);
+            FromJsonUtilS(FromJsonField(input, keyStackTrace), StackTrace);
+        }
+
+        Json::Value FunctionExecutionError::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Error; ToJsonUtilS(Error, each_Error); ToJsonField(output, keyError) = each_Error;
+            Json::Value each_Message; ToJsonUtilS(Message, each_Message); ToJsonField(output, keyMessage) = each_Message;
+            Json::Value each_StackTrace; ToJsonUtilS(StackTrace, each_StackTrace); ToJsonField(output, keyStackTrace) = each_StackTrace;
+            return output;
+        }
+
+        void ExecuteFunctionResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyError), Error);
+            FromJsonUtilP(FromJsonField(input, keyExecutionTimeMilliseconds), ExecutionTimeMilliseconds);
+            FromJsonUtilS(FromJsonField(input, keyFunctionName), FunctionName);
+            FunctionResult = FromJsonField(input, keyFunctionResult);
+            FromJsonUtilP(FromJsonField(input, keyFunctionResultTooLarge), FunctionResultTooLarge);
+        }
+
+        Json::Value ExecuteFunctionResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Error; ToJsonUtilO(Error, each_Error); ToJsonField(output, keyError) = each_Error;
+            Json::Value each_ExecutionTimeMilliseconds; ToJsonUtilP(ExecutionTimeMilliseconds, each_ExecutionTimeMilliseconds); ToJsonField(output, keyExecutionTimeMilliseconds) = each_ExecutionTimeMilliseconds;
+            Json::Value each_FunctionName; ToJsonUtilS(FunctionName, each_FunctionName); ToJsonField(output, keyFunctionName) = each_FunctionName;
+            ToJsonField(output, keyFunctionResult) = FunctionResult;
+            Json::Value each_FunctionResultTooLarge; ToJsonUtilP(FunctionResultTooLarge, each_FunctionResultTooLarge); ToJsonField(output, keyFunctionResultTooLarge) = each_FunctionResultTooLarge;
+            return output;
+        }
+
+        void FunctionModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyFunctionAddress), FunctionAddress);
+            FromJsonUtilS(FromJsonField(input, keyFunctionName), FunctionName);
+            FromJsonUtilS(FromJsonField(input, keyTriggerType), TriggerType);
+        }
+
+        Json::Value FunctionModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_FunctionAddress; ToJsonUtilS(FunctionAddress, each_FunctionAddress); ToJsonField(output, keyFunctionAddress) = each_FunctionAddress;
+            Json::Value each_FunctionName; ToJsonUtilS(FunctionName, each_FunctionName); ToJsonField(output, keyFunctionName) = each_FunctionName;
+            Json::Value each_TriggerType; ToJsonUtilS(TriggerType, each_TriggerType); ToJsonField(output, keyTriggerType) = each_TriggerType;
+            return output;
+        }
+
+        void HttpFunctionModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyFunctionName), FunctionName);
+            FromJsonUtilS(FromJsonField(input, keyFunctionUrl), FunctionUrl);
+        }
+
+        Json::Value HttpFunctionModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_FunctionName; ToJsonUtilS(FunctionName, each_FunctionName); ToJsonField(output, keyFunctionName) = each_FunctionName;
+            Json::Value each_FunctionUrl; ToJsonUtilS(FunctionUrl, each_FunctionUrl); ToJsonField(output, keyFunctionUrl) = each_FunctionUrl;
+            return output;
+        }
+
+        void LinkedPlatformAccountModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyEmail), Email);
+            FromJsonUtilE(FromJsonField(input, keyPlatform), Platform);
+            FromJsonUtilS(FromJsonField(input, keyPlatformUserId), PlatformUserId);
+            FromJsonUtilS(FromJsonField(input, keyUsername), Username);
+        }
+
+        Json::Value LinkedPlatformAccountModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Email; ToJsonUtilS(Email, each_Email); ToJsonField(output, keyEmail) = each_Email;
+            Json::Value each_Platform; ToJsonUtilE(Platform, each_Platform); ToJsonField(output, keyPlatform) = each_Platform;
+            Json::Value each_PlatformUserId; ToJsonUtilS(PlatformUserId, each_PlatformUserId); ToJsonField(output, keyPlatformUserId) = each_PlatformUserId;
+            Json::Value each_Username; ToJsonUtilS(Username, each_Username); ToJsonField(output, keyUsername) = each_Username;
+            return output;
+        }
+
+        void ListFunctionsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value ListFunctionsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void ListFunctionsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyFunctions), Functions);
+        }
+
+        Json::Value ListFunctionsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Functions; ToJsonUtilO(Functions, each_Functions); ToJsonField(output, keyFunctions) = each_Functions;
+            return output;
+        }
+
+        void ListHttpFunctionsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyFunctions), Functions);
+        }
+
+        Json::Value ListHttpFunctionsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Functions; ToJsonUtilO(Functions, each_Functions); ToJsonField(output, keyFunctions) = each_Functions;
+            return output;
+        }
+
+        void QueuedFunctionModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyConnectionString), ConnectionString);
+            FromJsonUtilS(FromJsonField(input, keyFunctionName), FunctionName);
+            FromJsonUtilS(FromJsonField(input, keyQueueName), QueueName);
+        }
+
+        Json::Value QueuedFunctionModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ConnectionString; ToJsonUtilS(ConnectionString, each_ConnectionString); ToJsonField(output, keyConnectionString) = each_ConnectionString;
+            Json::Value each_FunctionName; ToJsonUtilS(FunctionName, each_FunctionName); ToJsonField(output, keyFunctionName) = each_FunctionName;
+            Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); ToJsonField(output, keyQueueName) = each_QueueName;
+            return output;
+        }
+
+        void ListQueuedFunctionsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyFunctions), Functions);
+        }
+
+        Json::Value ListQueuedFunctionsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Functions; ToJsonUtilO(Functions, each_Functions); ToJsonField(output, keyFunctions) = each_Functions;
+            return output;
+        }
+
+        void LocationModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCity), City);
+            FromJsonUtilE(FromJsonField(input, keyContinentCode), pfContinentCode);
+            FromJsonUtilE(FromJsonField(input, keyCountryCode), pfCountryCode);
+            FromJsonUtilP(FromJsonField(input, keyLatitude), Latitude);
+            FromJsonUtilP(FromJsonField(input, keyLongitude), Longitude);
+        }
+
+        Json::Value LocationModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_City; ToJsonUtilS(City, each_City); ToJsonField(output, keyCity) = each_City;
+            Json::Value each_pfContinentCode; ToJsonUtilE(pfContinentCode, each_pfContinentCode); ToJsonField(output, keyContinentCode) = each_pfContinentCode;
+            Json::Value each_pfCountryCode; ToJsonUtilE(pfCountryCode, each_pfCountryCode); ToJsonField(output, keyCountryCode) = each_pfCountryCode;
+            Json::Value each_Latitude; ToJsonUtilP(Latitude, each_Latitude); ToJsonField(output, keyLatitude) = each_Latitude;
+            Json::Value each_Longitude; ToJsonUtilP(Longitude, each_Longitude); ToJsonField(output, keyLongitude) = each_Longitude;
+            return output;
+        }
+
+        void SubscriptionModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilT(FromJsonField(input, keyExpiration), Expiration);
+            FromJsonUtilT(FromJsonField(input, keyInitialSubscriptionTime), InitialSubscriptionTime);
+            FromJsonUtilP(FromJsonField(input, keyIsActive), IsActive);
+            FromJsonUtilE(FromJsonField(input, keyStatus), Status);
+            FromJsonUtilS(FromJsonField(input, keySubscriptionId), SubscriptionId);
+            FromJsonUtilS(FromJsonField(input, keySubscriptionItemId), SubscriptionItemId);
+            FromJsonUtilS(FromJsonField(input, keySubscriptionProvider), SubscriptionProvider);
+        }
+
+        Json::Value SubscriptionModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Expiration; ToJsonUtilT(Expiration, each_Expiration); ToJsonField(output, keyExpiration) = each_Expiration;
+            Json::Value each_InitialSubscriptionTime; ToJsonUtilT(InitialSubscriptionTime, each_InitialSubscriptionTime); ToJsonField(output, keyInitialSubscriptionTime) = each_InitialSubscriptionTime;
+            Json::Value each_IsActive; ToJsonUtilP(IsActive, each_IsActive); ToJsonField(output, keyIsActive) = each_IsActive;
+            Json::Value each_Status; ToJsonUtilE(Status, each_Status); ToJsonField(output, keyStatus) = each_Status;
+            Json::Value each_SubscriptionId; ToJsonUtilS(SubscriptionId, each_SubscriptionId); ToJsonField(output, keySubscriptionId) = each_SubscriptionId;
+            Json::Value each_SubscriptionItemId; ToJsonUtilS(SubscriptionItemId, each_SubscriptionItemId); ToJsonField(output, keySubscriptionItemId) = each_SubscriptionItemId;
+            Json::Value each_SubscriptionProvider; ToJsonUtilS(SubscriptionProvider, each_SubscriptionProvider); ToJsonField(output, keySubscriptionProvider) = each_SubscriptionProvider;
+            return output;
+        }
+
+        void MembershipModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyIsActive), IsActive);
+            FromJsonUtilT(FromJsonField(input, keyMembershipExpiration), MembershipExpiration);
+            FromJsonUtilS(FromJsonField(input, keyMembershipId), MembershipId);
+            FromJsonUtilT(FromJsonField(input, keyOverrideExpiration), OverrideExpiration);
+            FromJsonUtilO(FromJsonField(input, keySubscriptions), Subscriptions);
+        }
+
+        Json::Value MembershipModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_IsActive; ToJsonUtilP(IsActive, each_IsActive); ToJsonField(output, keyIsActive) = each_IsActive;
+            Json::Value each_MembershipExpiration; ToJsonUtilT(MembershipExpiration, each_MembershipExpiration); ToJsonField(output, keyMembershipExpiration) = each_MembershipExpiration;
+            Json::Value each_MembershipId; ToJsonUtilS(MembershipId, each_MembershipId); ToJsonField(output, keyMembershipId) = each_MembershipId;
+            Json::Value each_OverrideExpiration; ToJsonUtilT(OverrideExpiration, each_OverrideExpiration); ToJsonField(output, keyOverrideExpiration) = each_OverrideExpiration;
+            Json::Value each_Subscriptions; ToJsonUtilO(Subscriptions, each_Subscriptions); ToJsonField(output, keySubscriptions) = each_Subscriptions;
+            return output;
+        }
+
+        void NameIdentifier::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyId), Id);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+        }
+
+        Json::Value NameIdentifier::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Id; ToJsonUtilS(Id, each_Id); ToJsonField(output, keyId) = each_Id;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            return output;
+        }
+
+        void PushNotificationRegistrationModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyNotificationEndpointARN), NotificationEndpointARN);
+            FromJsonUtilE(FromJsonField(input, keyPlatform), Platform);
+        }
+
+        Json::Value PushNotificationRegistrationModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_NotificationEndpointARN; ToJsonUtilS(NotificationEndpointARN, each_NotificationEndpointARN); ToJsonField(output, keyNotificationEndpointARN) = each_NotificationEndpointARN;
+            Json::Value each_Platform; ToJsonUtilE(Platform, each_Platform); ToJsonField(output, keyPlatform) = each_Platform;
+            return output;
+        }
+
+        void StatisticModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilP(FromJsonField(input, keyValue), Value);
+            FromJsonUtilP(FromJsonField(input, keyVersion), Version);
+        }
+
+        Json::Value StatisticModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_Value; ToJsonUtilP(Value, each_Value); ToJsonField(output, keyValue) = each_Value;
+            Json::Value each_Version; ToJsonUtilP(Version, each_Version); ToJsonField(output, keyVersion) = each_Version;
+            return output;
+        }
+
+        void TagModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyTagValue), TagValue);
+        }
+
+        Json::Value TagModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_TagValue; ToJsonUtilS(TagValue, each_TagValue); ToJsonField(output, keyTagValue) = each_TagValue;
+            return output;
+        }
+
+        void ValueToDateModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCurrency), Currency);
+            FromJsonUtilP(FromJsonField(input, keyTotalValue), TotalValue);
+            FromJsonUtilS(FromJsonField(input, keyTotalValueAsDecimal), TotalValueAsDecimal);
+        }
+
+        Json::Value ValueToDateModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Currency; ToJsonUtilS(Currency, each_Currency); ToJsonField(output, keyCurrency) = each_Currency;
+            Json::Value each_TotalValue; ToJsonUtilP(TotalValue, each_TotalValue); ToJsonField(output, keyTotalValue) = each_TotalValue;
+            Json::Value each_TotalValueAsDecimal; ToJsonUtilS(TotalValueAsDecimal, each_TotalValueAsDecimal); ToJsonField(output, keyTotalValueAsDecimal) = each_TotalValueAsDecimal;
+            return output;
+        }
+
+        void PlayerProfileModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyAdCampaignAttributions), AdCampaignAttributions);
+            FromJsonUtilS(FromJsonField(input, keyAvatarUrl), AvatarUrl);
+            FromJsonUtilT(FromJsonField(input, keyBannedUntil), BannedUntil);
+            FromJsonUtilO(FromJsonField(input, keyContactEmailAddresses), ContactEmailAddresses);
+            FromJsonUtilT(FromJsonField(input, keyCreated), Created);
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+            FromJsonUtilS(FromJsonField(input, keyExperimentVariants), ExperimentVariants);
+            FromJsonUtilT(FromJsonField(input, keyLastLogin), LastLogin);
+            FromJsonUtilO(FromJsonField(input, keyLinkedAccounts), LinkedAccounts);
+            FromJsonUtilO(FromJsonField(input, keyLocations), Locations);
+            FromJsonUtilO(FromJsonField(input, keyMemberships), Memberships);
+            FromJsonUtilE(FromJsonField(input, keyOrigination), Origination);
+            FromJsonUtilS(FromJsonField(input, keyPlayerId), PlayerId);
+            FromJsonUtilS(FromJsonField(input, keyPublisherId), PublisherId);
+            FromJsonUtilO(FromJsonField(input, keyPushNotificationRegistrations), PushNotificationRegistrations);
+            FromJsonUtilO(FromJsonField(input, keyStatistics), Statistics);
+            FromJsonUtilO(FromJsonField(input, keyTags), Tags);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+            FromJsonUtilP(FromJsonField(input, keyTotalValueToDateInUSD), TotalValueToDateInUSD);
+            FromJsonUtilO(FromJsonField(input, keyValuesToDate), ValuesToDate);
+        }
+
+        Json::Value PlayerProfileModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AdCampaignAttributions; ToJsonUtilO(AdCampaignAttributions, each_AdCampaignAttributions); ToJsonField(output, keyAdCampaignAttributions) = each_AdCampaignAttributions;
+            Json::Value each_AvatarUrl; ToJsonUtilS(AvatarUrl, each_AvatarUrl); ToJsonField(output, keyAvatarUrl) = each_AvatarUrl;
+            Json::Value each_BannedUntil; ToJsonUtilT(BannedUntil, each_BannedUntil); ToJsonField(output, keyBannedUntil) = each_BannedUntil;
+            Json::Value each_ContactEmailAddresses; ToJsonUtilO(ContactEmailAddresses, each_ContactEmailAddresses); ToJsonField(output, keyContactEmailAddresses) = each_ContactEmailAddresses;
+            Json::Value each_Created; ToJsonUtilT(Created, each_Created); ToJsonField(output, keyCreated) = each_Created;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            Json::Value each_ExperimentVariants; ToJsonUtilS(ExperimentVariants, each_ExperimentVariants); ToJsonField(output, keyExperimentVariants) = each_ExperimentVariants;
+            Json::Value each_LastLogin; ToJsonUtilT(LastLogin, each_LastLogin); ToJsonField(output, keyLastLogin) = each_LastLogin;
+            Json::Value each_LinkedAccounts; ToJsonUtilO(LinkedAccounts, each_LinkedAccounts); ToJsonField(output, keyLinkedAccounts) = each_LinkedAccounts;
+            Json::Value each_Locations; ToJsonUtilO(Locations, each_Locations); ToJsonField(output, keyLocations) = each_Locations;
+            Json::Value each_Memberships; ToJsonUtilO(Memberships, each_Memberships); ToJsonField(output, keyMemberships) = each_Memberships;
+            Json::Value each_Origination; ToJsonUtilE(Origination, each_Origination); ToJsonField(output, keyOrigination) = each_Origination;
+            Json::Value each_PlayerId; ToJsonUtilS(PlayerId, each_PlayerId); ToJsonField(output, keyPlayerId) = each_PlayerId;
+            Json::Value each_PublisherId; ToJsonUtilS(PublisherId, each_PublisherId); ToJsonField(output, keyPublisherId) = each_PublisherId;
+            Json::Value each_PushNotificationRegistrations; ToJsonUtilO(PushNotificationRegistrations, each_PushNotificationRegistrations); ToJsonField(output, keyPushNotificationRegistrations) = each_PushNotificationRegistrations;
+            Json::Value each_Statistics; ToJsonUtilO(Statistics, each_Statistics); ToJsonField(output, keyStatistics) = each_Statistics;
+            Json::Value each_Tags; ToJsonUtilO(Tags, each_Tags); ToJsonField(output, keyTags) = each_Tags;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            Json::Value each_TotalValueToDateInUSD; ToJsonUtilP(TotalValueToDateInUSD, each_TotalValueToDateInUSD); ToJsonField(output, keyTotalValueToDateInUSD) = each_TotalValueToDateInUSD;
+            Json::Value each_ValuesToDate; ToJsonUtilO(ValuesToDate, each_ValuesToDate); ToJsonField(output, keyValuesToDate) = each_ValuesToDate;
+            return output;
+        }
+
+        void PlayStreamEventEnvelopeModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyEntityId), EntityId);
+            FromJsonUtilS(FromJsonField(input, keyEntityType), EntityType);
+            FromJsonUtilS(FromJsonField(input, keyEventData), EventData);
+            FromJsonUtilS(FromJsonField(input, keyEventName), EventName);
+            FromJsonUtilS(FromJsonField(input, keyEventNamespace), EventNamespace);
+            FromJsonUtilS(FromJsonField(input, keyEventSettings), EventSettings);
+        }
+
+        Json::Value PlayStreamEventEnvelopeModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_EntityId; ToJsonUtilS(EntityId, each_EntityId); ToJsonField(output, keyEntityId) = each_EntityId;
+            Json::Value each_EntityType; ToJsonUtilS(EntityType, each_EntityType); ToJsonField(output, keyEntityType) = each_EntityType;
+            Json::Value each_EventData; ToJsonUtilS(EventData, each_EventData); ToJsonField(output, keyEventData) = each_EventData;
+            Json::Value each_EventName; ToJsonUtilS(EventName, each_EventName); ToJsonField(output, keyEventName) = each_EventName;
+            Json::Value each_EventNamespace; ToJsonUtilS(EventNamespace, each_EventNamespace); ToJsonField(output, keyEventNamespace) = each_EventNamespace;
+            Json::Value each_EventSettings; ToJsonUtilS(EventSettings, each_EventSettings); ToJsonField(output, keyEventSettings) = each_EventSettings;
+            return output;
+        }
+
+        void PostFunctionResultForEntityTriggeredActionRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilO(FromJsonField(input, keyFunctionResult), FunctionResult);
+        }
+
+        Json::Value PostFunctionResultForEntityTriggeredActionRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_FunctionResult; ToJsonUtilO(FunctionResult, each_FunctionResult); ToJsonField(output, keyFunctionResult) = each_FunctionResult;
+            return output;
+        }
+
+        void PostFunctionResultForFunctionExecutionRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilO(FromJsonField(input, keyFunctionResult), FunctionResult);
+        }
+
+        Json::Value PostFunctionResultForFunctionExecutionRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_FunctionResult; ToJsonUtilO(FunctionResult, each_FunctionResult); ToJsonField(output, keyFunctionResult) = each_FunctionResult;
+            return output;
+        }
+
+        void PostFunctionResultForPlayerTriggeredActionRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilO(FromJsonField(input, keyFunctionResult), FunctionResult);
+            FromJsonUtilO(FromJsonField(input, keyPlayerProfile), PlayerProfile);
+            FromJsonUtilO(FromJsonField(input, keyPlayStreamEventEnvelope), PlayStreamEventEnvelope);
+        }
+
+        Json::Value PostFunctionResultForPlayerTriggeredActionRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_FunctionResult; ToJsonUtilO(FunctionResult, each_FunctionResult); ToJsonField(output, keyFunctionResult) = each_FunctionResult;
+            Json::Value each_PlayerProfile; ToJsonUtilO(PlayerProfile, each_PlayerProfile); ToJsonField(output, keyPlayerProfile) = each_PlayerProfile;
+            Json::Value each_PlayStreamEventEnvelope; ToJsonUtilO(PlayStreamEventEnvelope, each_PlayStreamEventEnvelope); ToJsonField(output, keyPlayStreamEventEnvelope) = each_PlayStreamEventEnvelope;
+            return output;
+        }
+
+        void PostFunctionResultForScheduledTaskRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilO(FromJsonField(input, keyFunctionResult), FunctionResult);
+            FromJsonUtilO(FromJsonField(input, keyScheduledTaskId), ScheduledTaskId);
+        }
+
+        Json::Value PostFunctionResultForScheduledTaskRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_FunctionResult; ToJsonUtilO(FunctionResult, each_FunctionResult); ToJsonField(output, keyFunctionResult) = each_FunctionResult;
+            Json::Value each_ScheduledTaskId; ToJsonUtilO(ScheduledTaskId, each_ScheduledTaskId); ToJsonField(output, keyScheduledTaskId) = each_ScheduledTaskId;
+            return output;
+        }
+
+        void RegisterHttpFunctionRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyFunctionName), FunctionName);
+            FromJsonUtilS(FromJsonField(input, keyFunctionUrl), FunctionUrl);
+        }
+
+        Json::Value RegisterHttpFunctionRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_FunctionName; ToJsonUtilS(FunctionName, each_FunctionName); ToJsonField(output, keyFunctionName) = each_FunctionName;
+            Json::Value each_FunctionUrl; ToJsonUtilS(FunctionUrl, each_FunctionUrl); ToJsonField(output, keyFunctionUrl) = each_FunctionUrl;
+            return output;
+        }
+
+        void RegisterQueuedFunctionRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyConnectionString), ConnectionString);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyFunctionName), FunctionName);
+            FromJsonUtilS(FromJsonField(input, keyQueueName), QueueName);
+        }
+
+        Json::Value RegisterQueuedFunctionRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ConnectionString; ToJsonUtilS(ConnectionString, each_ConnectionString); ToJsonField(output, keyConnectionString) = each_ConnectionString;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_FunctionName; ToJsonUtilS(FunctionName, each_FunctionName); ToJsonField(output, keyFunctionName) = each_FunctionName;
+            Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); ToJsonField(output, keyQueueName) = each_QueueName;
+            return output;
+        }
+
+        void UnregisterFunctionRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyFunctionName), FunctionName);
+        }
+
+        Json::Value UnregisterFunctionRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_FunctionName; ToJsonUtilS(FunctionName, each_FunctionName); ToJsonField(output, keyFunctionName) = each_FunctionName;
+            return output;
+        }
+    }
+}
+
+#endif
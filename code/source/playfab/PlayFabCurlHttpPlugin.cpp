@@ -2,6 +2,7 @@
 
 #include <playfab/PlayFabCurlHttpPlugin.h>
 #include <playfab/PlayFabSettings.h>
+#include <playfab/PlayFabJsonUtils.h>
 
 #include <stdexcept>
 
@@ -172,30 +173,21 @@ namespace PlayFab
             return;
         }
 
-        const std::unordered_map<std::string, std::string> headers = reqContainer.GetRequestHeaders();
-
-        if (headers.size() > 0)
+        for (const PlayFabRequestHeaders::Header& header : reqContainer.GetRequestHeaders())
         {
-            for (auto const& obj : headers)
+            // The header is already formatted as a "Name: value" line
+            curlHttpHeaders = TryCurlAddHeader(reqContainer, curlHttpHeaders, header.GetLine().c_str());
+            if (curlHttpHeaders == NULL)
             {
-                if (obj.first.length() != 0 && obj.second.length() != 0) // no empty keys or values in headers
-                {
-                    std::string header = obj.first + ": " + obj.second;
-
-                    curlHttpHeaders = TryCurlAddHeader(reqContainer, curlHttpHeaders, header.c_str());
-                    if (curlHttpHeaders == NULL)
-                    {
-                        HandleCallback(std::move(requestContainer));
-                        return;
-                    }
-                }
+                HandleCallback(std::move(requestContainer));
+                return;
             }
         }
 
         curl_easy_setopt(curlHandle, CURLOPT_HTTPHEADER, curlHttpHeaders);
 
         // Set up post & payload
-        std::string payload = reqContainer.GetRequestBody();
+        const std::string& payload = reqContainer.GetRequestBody();
         curl_easy_setopt(curlHandle, CURLOPT_POST, nullptr);
         curl_easy_setopt(curlHandle, CURLOPT_POSTFIELDS, payload.c_str());
 
@@ -226,20 +218,12 @@ namespace PlayFab
         }
         else
         {
-            Json::CharReaderBuilder jsonReaderFactory;
-            std::unique_ptr<Json::CharReader> jsonReader(jsonReaderFactory.newCharReader());
-            JSONCPP_STRING jsonParseErrors;
-            const bool parsedSuccessfully = jsonReader->parse(reqContainer.responseString.c_str(), reqContainer.responseString.c_str() + reqContainer.responseString.length(), &reqContainer.responseJson, &jsonParseErrors);
+            std::string jsonParseErrors;
+            const bool parsedSuccessfully = PlayFabJsonUtils::ParseFromString(reqContainer.responseString, reqContainer.responseJson, jsonParseErrors);
 
             if (parsedSuccessfully)
             {
-                reqContainer.errorWrapper.HttpCode = reqContainer.responseJson.get("code", Json::Value::null).asInt();
-                reqContainer.errorWrapper.HttpStatus = reqContainer.responseJson.get("status", Json::Value::null).asString();
-                reqContainer.errorWrapper.Data = reqContainer.responseJson.get("data", Json::Value::null);
-                reqContainer.errorWrapper.ErrorName = reqContainer.responseJson.get("error", Json::Value::null).asString();
-                reqContainer.errorWrapper.ErrorCode = static_cast<PlayFabErrorCode>(reqContainer.responseJson.get("errorCode", Json::Value::null).asInt());
-                reqContainer.errorWrapper.ErrorMessage = reqContainer.responseJson.get("errorMessage", Json::Value::null).asString();
-                reqContainer.errorWrapper.ErrorDetails = reqContainer.responseJson.get("errorDetails", Json::Value::null);
+                reqContainer.ProcessResponseJson();
             }
             else
             {
@@ -0,0 +1,419 @@
+#include <stdafx.h>
+
+#if !defined(DISABLE_PLAYFABENTITY_API)
+
+#include <playfab/PlayFabDataDataModels.h>
+
+namespace PlayFab
+{
+    namespace DataModels
+    {
+        namespace
+        {
+            // The json field names of the models below
+            constexpr PlayFabJsonKey keyChecksum("Checksum");
+            constexpr PlayFabJsonKey keyCustomTags("CustomTags");
+            constexpr PlayFabJsonKey keyDataObject("DataObject");
+            constexpr PlayFabJsonKey keyDeleteObject("DeleteObject");
+            constexpr PlayFabJsonKey keyDownloadUrl("DownloadUrl");
+            constexpr PlayFabJsonKey keyEntity("Entity");
+            constexpr PlayFabJsonKey keyEscapeObject("EscapeObject");
+            constexpr PlayFabJsonKey keyEscapedDataObject("EscapedDataObject");
+            constexpr PlayFabJsonKey keyExpectedProfileVersion("ExpectedProfileVersion");
+            constexpr PlayFabJsonKey keyFileName("FileName");
+            constexpr PlayFabJsonKey keyFileNames("FileNames");
+            constexpr PlayFabJsonKey keyId("Id");
+            constexpr PlayFabJsonKey keyLastModified("LastModified");
+            constexpr PlayFabJsonKey keyMetadata("Metadata");
+            constexpr PlayFabJsonKey keyObjectName("ObjectName");
+            constexpr PlayFabJsonKey keyObjects("Objects");
+            constexpr PlayFabJsonKey keyOperationReason("OperationReason");
+            constexpr PlayFabJsonKey keyProfileVersion("ProfileVersion");
+            constexpr PlayFabJsonKey keySetResult("SetResult");
+            constexpr PlayFabJsonKey keySetResults("SetResults");
+            constexpr PlayFabJsonKey keySize("Size");
+            constexpr PlayFabJsonKey keyType("Type");
+            constexpr PlayFabJsonKey keyUploadDetails("UploadDetails");
+            constexpr PlayFabJsonKey keyUploadUrl("UploadUrl");
+        }
+
+        void ToJsonEnum(const OperationTypes input, Json::Value& output)
+        {
+            if (input == OperationTypes::OperationTypesCreated)
+            {
+                output = Json::Value(Json::StaticString("Created"));
+                return;
+            }
+            if (input == OperationTypes::OperationTypesUpdated)
+            {
+                output = Json::Value(Json::StaticString("Updated"));
+                return;
+            }
+            if (input == OperationTypes::OperationTypesDeleted)
+            {
+                output = Json::Value(Json::StaticString("Deleted"));
+                return;
+            }
+            if (input == OperationTypes::OperationTypesNone)
+            {
+                output = Json::Value(Json::StaticString("None"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, OperationTypes& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Created")
+            {
+                output = OperationTypes::OperationTypesCreated;
+                return;
+            }
+            if (inputStr == "Updated")
+            {
+                output = OperationTypes::OperationTypesUpdated;
+                return;
+            }
+            if (inputStr == "Deleted")
+            {
+                output = OperationTypes::OperationTypesDeleted;
+                return;
+            }
+            if (inputStr == "None")
+            {
+                output = OperationTypes::OperationTypesNone;
+                return;
+            }
+        }
+
+        void EntityKey::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyId), Id);
+            FromJsonUtilS(FromJsonField(input, keyType), Type);
+        }
+
+        Json::Value EntityKey::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Id; ToJsonUtilS(Id, each_Id); ToJsonField(output, keyId) = each_Id;
+            Json::Value each_Type; ToJsonUtilS(Type, each_Type); ToJsonField(output, keyType) = each_Type;
+            return output;
+        }
+
+        void AbortFileUploadsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilS(FromJsonField(input, keyFileNames), FileNames);
+            FromJsonUtilP(FromJsonField(input, keyProfileVersion), ProfileVersion);
+        }
+
+        Json::Value AbortFileUploadsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_FileNames; ToJsonUtilS(FileNames, each_FileNames); ToJsonField(output, keyFileNames) = each_FileNames;
+            Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); ToJsonField(output, keyProfileVersion) = each_ProfileVersion;
+            return output;
+        }
+
+        void AbortFileUploadsResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilP(FromJsonField(input, keyProfileVersion), ProfileVersion);
+        }
+
+        Json::Value AbortFileUploadsResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); ToJsonField(output, keyProfileVersion) = each_ProfileVersion;
+            return output;
+        }
+
+        void DeleteFilesRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilS(FromJsonField(input, keyFileNames), FileNames);
+            FromJsonUtilP(FromJsonField(input, keyProfileVersion), ProfileVersion);
+        }
+
+        Json::Value DeleteFilesRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_FileNames; ToJsonUtilS(FileNames, each_FileNames); ToJsonField(output, keyFileNames) = each_FileNames;
+            Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); ToJsonField(output, keyProfileVersion) = each_ProfileVersion;
+            return output;
+        }
+
+        void DeleteFilesResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilP(FromJsonField(input, keyProfileVersion), ProfileVersion);
+        }
+
+        Json::Value DeleteFilesResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); ToJsonField(output, keyProfileVersion) = each_ProfileVersion;
+            return output;
+        }
+
+        void FinalizeFileUploadsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilS(FromJsonField(input, keyFileNames), FileNames);
+            FromJsonUtilP(FromJsonField(input, keyProfileVersion), ProfileVersion);
+        }
+
+        Json::Value FinalizeFileUploadsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_FileNames; ToJsonUtilS(FileNames, each_FileNames); ToJsonField(output, keyFileNames) = each_FileNames;
+            Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); ToJsonField(output, keyProfileVersion) = each_ProfileVersion;
+            return output;
+        }
+
+        void GetFileMetadata::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyChecksum), Checksum);
+            FromJsonUtilS(FromJsonField(input, keyDownloadUrl), DownloadUrl);
+            FromJsonUtilS(FromJsonField(input, keyFileName), FileName);
+            FromJsonUtilT(FromJsonField(input, keyLastModified), LastModified);
+            FromJsonUtilP(FromJsonField(input, keySize), Size);
+        }
+
+        Json::Value GetFileMetadata::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Checksum; ToJsonUtilS(Checksum, each_Checksum); ToJsonField(output, keyChecksum) = each_Checksum;
+            Json::Value each_DownloadUrl; ToJsonUtilS(DownloadUrl, each_DownloadUrl); ToJsonField(output, keyDownloadUrl) = each_DownloadUrl;
+            Json::Value each_FileName; ToJsonUtilS(FileName, each_FileName); ToJsonField(output, keyFileName) = each_FileName;
+            Json::Value each_LastModified; ToJsonUtilT(LastModified, each_LastModified); ToJsonField(output, keyLastModified) = each_LastModified;
+            Json::Value each_Size; ToJsonUtilP(Size, each_Size); ToJsonField(output, keySize) = each_Size;
+            return output;
+        }
+
+        void FinalizeFileUploadsResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilO(FromJsonField(input, keyMetadata), Metadata);
+            FromJsonUtilP(FromJsonField(input, keyProfileVersion), ProfileVersion);
+        }
+
+        Json::Value FinalizeFileUploadsResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_Metadata; ToJsonUtilO(Metadata, each_Metadata); ToJsonField(output, keyMetadata) = each_Metadata;
+            Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); ToJsonField(output, keyProfileVersion) = each_ProfileVersion;
+            return output;
+        }
+
+        void GetFilesRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+        }
+
+        Json::Value GetFilesRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            return output;
+        }
+
+        void GetFilesResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilO(FromJsonField(input, keyMetadata), Metadata);
+            FromJsonUtilP(FromJsonField(input, keyProfileVersion), ProfileVersion);
+        }
+
+        Json::Value GetFilesResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_Metadata; ToJsonUtilO(Metadata, each_Metadata); ToJsonField(output, keyMetadata) = each_Metadata;
+            Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); ToJsonField(output, keyProfileVersion) = each_ProfileVersion;
+            return output;
+        }
+
+        void GetObjectsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilP(FromJsonField(input, keyEscapeObject), EscapeObject);
+        }
+
+        Json::Value GetObjectsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_EscapeObject; ToJsonUtilP(EscapeObject, each_EscapeObject); ToJsonField(output, keyEscapeObject) = each_EscapeObject;
+            return output;
+        }
+
+        void ObjectResult::FromJson(const Json::Value& input)
+        {
+            DataObject = FromJsonField(input, keyDataObject);
+            FromJsonUtilS(FromJsonField(input, keyEscapedDataObject), EscapedDataObject);
+            FromJsonUtilS(FromJsonField(input, keyObjectName), ObjectName);
+        }
+
+        Json::Value ObjectResult::ToJson() const
+        {
+            Json::Value output;
+            ToJsonField(output, keyDataObject) = DataObject;
+            Json::Value each_EscapedDataObject; ToJsonUtilS(EscapedDataObject, each_EscapedDataObject); ToJsonField(output, keyEscapedDataObject) = each_EscapedDataObject;
+            Json::Value each_ObjectName; ToJsonUtilS(ObjectName, each_ObjectName); ToJsonField(output, keyObjectName) = each_ObjectName;
+            return output;
+        }
+
+        void GetObjectsResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilO(FromJsonField(input, keyObjects), Objects);
+            FromJsonUtilP(FromJsonField(input, keyProfileVersion), ProfileVersion);
+        }
+
+        Json::Value GetObjectsResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_Objects; ToJsonUtilO(Objects, each_Objects); ToJsonField(output, keyObjects) = each_Objects;
+            Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); ToJsonField(output, keyProfileVersion) = each_ProfileVersion;
+            return output;
+        }
+
+        void InitiateFileUploadMetadata::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyFileName), FileName);
+            FromJsonUtilS(FromJsonField(input, keyUploadUrl), UploadUrl);
+        }
+
+        Json::Value InitiateFileUploadMetadata::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_FileName; ToJsonUtilS(FileName, each_FileName); ToJsonField(output, keyFileName) = each_FileName;
+            Json::Value each_UploadUrl; ToJsonUtilS(UploadUrl, each_UploadUrl); ToJsonField(output, keyUploadUrl) = each_UploadUrl;
+            return output;
+        }
+
+        void InitiateFileUploadsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilS(FromJsonField(input, keyFileNames), FileNames);
+            FromJsonUtilP(FromJsonField(input, keyProfileVersion), ProfileVersion);
+        }
+
+        Json::Value InitiateFileUploadsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_FileNames; ToJsonUtilS(FileNames, each_FileNames); ToJsonField(output, keyFileNames) = each_FileNames;
+            Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); ToJsonField(output, keyProfileVersion) = each_ProfileVersion;
+            return output;
+        }
+
+        void InitiateFileUploadsResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilP(FromJsonField(input, keyProfileVersion), ProfileVersion);
+            FromJsonUtilO(FromJsonField(input, keyUploadDetails), UploadDetails);
+        }
+
+        Json::Value InitiateFileUploadsResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); ToJsonField(output, keyProfileVersion) = each_ProfileVersion;
+            Json::Value each_UploadDetails; ToJsonUtilO(UploadDetails, each_UploadDetails); ToJsonField(output, keyUploadDetails) = each_UploadDetails;
+            return output;
+        }
+
+        void SetObject::FromJson(const Json::Value& input)
+        {
+            DataObject = FromJsonField(input, keyDataObject);
+            FromJsonUtilP(FromJsonField(input, keyDeleteObject), DeleteObject);
+            FromJsonUtilS(FromJsonField(input, keyEscapedDataObject), EscapedDataObject);
+            FromJsonUtilS(FromJsonField(input, keyObjectName), ObjectName);
+        }
+
+        Json::Value SetObject::ToJson() const
+        {
+            Json::Value output;
+            ToJsonField(output, keyDataObject) = DataObject;
+            Json::Value each_DeleteObject; ToJsonUtilP(DeleteObject, each_DeleteObject); ToJsonField(output, keyDeleteObject) = each_DeleteObject;
+            Json::Value each_EscapedDataObject; ToJsonUtilS(EscapedDataObject, each_EscapedDataObject); ToJsonField(output, keyEscapedDataObject) = each_EscapedDataObject;
+            Json::Value each_ObjectName; ToJsonUtilS(ObjectName, each_ObjectName); ToJsonField(output, keyObjectName) = each_ObjectName;
+            return output;
+        }
+
+        void SetObjectInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyObjectName), ObjectName);
+            FromJsonUtilS(FromJsonField(input, keyOperationReason), OperationReason);
+            FromJsonUtilE(FromJsonField(input, keySetResult), SetResult);
+        }
+
+        Json::Value SetObjectInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ObjectName; ToJsonUtilS(ObjectName, each_ObjectName); ToJsonField(output, keyObjectName) = each_ObjectName;
+            Json::Value each_OperationReason; ToJsonUtilS(OperationReason, each_OperationReason); ToJsonField(output, keyOperationReason) = each_OperationReason;
+            Json::Value each_SetResult; ToJsonUtilE(SetResult, each_SetResult); ToJsonField(output, keySetResult) = each_SetResult;
+            return output;
+        }
+
+        void SetObjectsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilP(FromJsonField(input, keyExpectedProfileVersion), ExpectedProfileVersion);
+            FromJsonUtilO(FromJsonField(input, keyObjects), Objects);
+        }
+
+        Json::Value SetObjectsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_ExpectedProfileVersion; ToJsonUtilP(ExpectedProfileVersion, each_ExpectedProfileVersion); ToJsonField(output, keyExpectedProfileVersion) = each_ExpectedProfileVersion;
+            Json::Value each_Objects; ToJsonUtilO(Objects, each_Objects); ToJsonField(output, keyObjects) = each_Objects;
+            return output;
+        }
+
+        void SetObjectsResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyProfileVersion), ProfileVersion);
+            FromJsonUtilO(FromJsonField(input, keySetResults), SetResults);
+        }
+
+        Json::Value SetObjectsResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); ToJsonField(output, keyProfileVersion) = each_ProfileVersion;
+            Json::Value each_SetResults; ToJsonUtilO(SetResults, each_SetResults); ToJsonField(output, keySetResults) = each_SetResults;
+            return output;
+        }
+    }
+}
+
+#endif
@@ -3,6 +3,7 @@
 #ifndef DISABLE_PLAYFABENTITY_API
 
 #include <playfab/PlayFabEvent.h>
+#include <playfab/PlayFabJsonUtils.h>
 #include <playfab/PlayFabPlatformTypes.h>
 
 namespace PlayFab
@@ -102,6 +103,36 @@ namespace PlayFab
     {
         this->eventContents.Payload[name] = value;
     }
+
+    size_t PlayFabEvent::GetEstimatedSize() const
+    {
+        // The json of EventContents with every optional member null: member names, quotes and separators
+        constexpr size_t contentsOverhead = 130;
+        constexpr size_t customTagOverhead = 6; // quotes, colon and separator
+        constexpr size_t entityOverhead = 20; // {"Id":"","Type":""}
+        constexpr size_t timestampLength = 26; // "2020-01-01T00:00:00.000Z"
+
+        size_t size = contentsOverhead + this->eventContents.EventNamespace.length() + this->eventContents.Name.length() +
+            this->eventContents.OriginalId.length() + this->eventContents.PayloadJSON.length();
+        for (const auto& customTag : this->eventContents.CustomTags)
+        {
+            size += customTag.first.length() + customTag.second.length() + customTagOverhead;
+        }
+        if (this->eventContents.Entity.notNull())
+        {
+            size += entityOverhead + this->eventContents.Entity->Id.length() + this->eventContents.Entity->Type.length();
+        }
+        if (this->eventContents.OriginalTimestamp.notNull())
+        {
+            size += timestampLength;
+        }
+        return size + PlayFabJsonUtils::GetSerializedSize(this->eventContents.Payload);
+    }
+
+    std::string PlayFabEvent::Serialize() const
+    {
+        return PlayFabJsonUtils::WriteToString(this->eventContents.ToJson());
+    }
 }
 
 #endif
\ No newline at end of file
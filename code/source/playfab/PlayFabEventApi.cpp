@@ -6,8 +6,9 @@
 
 namespace PlayFab
 {
-    PlayFabEventAPI::PlayFabEventAPI(bool threadedEventPipeline) : 
-        eventRouter(std::make_shared<PlayFabEventRouter>(threadedEventPipeline))
+    PlayFabEventAPI::PlayFabEventAPI(bool threadedEventPipeline, bool preSerializeEvents) : 
+        eventRouter(std::make_shared<PlayFabEventRouter>(threadedEventPipeline)),
+        preSerializeEvents(preSerializeEvents)
     {
     }
 
@@ -21,6 +22,7 @@ namespace PlayFab
         auto eventRequest = std::shared_ptr<PlayFabEmitEventRequest>(new PlayFabEmitEventRequest());
         std::shared_ptr<const IPlayFabEvent> sharedGenericEvent = std::move(event);
         eventRequest->event = std::dynamic_pointer_cast<const PlayFabEvent>(sharedGenericEvent);
+        this->EncodeEvent(*eventRequest);
         eventRequest->callback = callback;
 
         this->eventRouter->RouteEvent(eventRequest);
@@ -31,11 +33,31 @@ namespace PlayFab
         auto eventRequest = std::shared_ptr<PlayFabEmitEventRequest>(new PlayFabEmitEventRequest());
         std::shared_ptr<const IPlayFabEvent> sharedGenericEvent = std::move(event);
         eventRequest->event = std::dynamic_pointer_cast<const PlayFabEvent>(sharedGenericEvent);
+        this->EncodeEvent(*eventRequest);
         eventRequest->stdCallback = callback;
 
         this->eventRouter->RouteEvent(eventRequest);
     }
     
+    void PlayFabEventAPI::EncodeEvent(PlayFabEmitEventRequest& eventRequest) const
+    {
+        if (eventRequest.event == nullptr)
+        {
+            return;
+        }
+
+        if (this->preSerializeEvents)
+        {
+            // encode the event on the emitting thread, so the pipeline thread only has to splice it into a batch
+            eventRequest.serializedEvent = eventRequest.event->Serialize();
+            eventRequest.estimatedSize = eventRequest.serializedEvent.length() + 1; // and a separator
+        }
+        else
+        {
+            eventRequest.estimatedSize = eventRequest.event->GetEstimatedSize();
+        }
+    }
+
     void PlayFabEventAPI::Update()
     {
         this->eventRouter->Update();
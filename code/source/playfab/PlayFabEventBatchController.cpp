@@ -0,0 +1,159 @@
+#include <stdafx.h>
+
+#ifndef DISABLE_PLAYFABENTITY_API
+
+#include <playfab/PlayFabEventBatchController.h>
+#include <playfab/PlayFabEventPipeline.h>
+
+namespace PlayFab
+{
+    namespace
+    {
+        // Load thresholds, as shares of the maximal number of batches in flight and of the buffer capacity
+        constexpr double congestedLoad = 0.5;
+        constexpr double lightLoad = 0.25;
+
+        // The send latency shows congestion when it exceeds twice the lowest latency seen plus this margin
+        constexpr std::chrono::milliseconds latencyMargin(20);
+
+        // The number of additive steps from the maximal number of events per batch of the settings down to the minimal one,
+        // which is the maximal one divided by this
+        constexpr int64_t decreaseStepCount = 16;
+
+        // Weight of a new sample in the smoothed send latency, as a divisor (like TCP's smoothed round-trip time)
+        constexpr int64_t latencySmoothing = 8;
+
+        size_t GetMaximalItemLimit(const PlayFabEventPipelineSettings& settings)
+        {
+            return std::max<size_t>(1, settings.maximalNumberOfItemsInBatch);
+        }
+
+        size_t GetMinimalItemLimit(const PlayFabEventPipelineSettings& settings)
+        {
+            return std::max<size_t>(1, GetMaximalItemLimit(settings) / decreaseStepCount);
+        }
+    }
+
+    PlayFabEventBatchController::PlayFabEventBatchController() :
+        isStarted(false),
+        batchItemLimit(0),
+        batchWaitTime(0),
+        smoothedLatency(0),
+        minimalLatency(0),
+        hasLatency(false),
+        eventsOverflowed(0)
+    {
+    }
+
+    void PlayFabEventBatchController::OnBatchStarted(const PlayFabEventPipelineSettings& settings, size_t batchesInFlight, double bufferFillRatio)
+    {
+        std::unique_lock<std::mutex> lock(statsMutex);
+        stats.batchesInFlight = batchesInFlight;
+        stats.bufferFillRatio = bufferFillRatio;
+
+        if (settings.useAdaptiveBatching)
+        {
+            const size_t maximalItemLimit = GetMaximalItemLimit(settings);
+            const size_t minimalItemLimit = GetMinimalItemLimit(settings);
+            const std::chrono::milliseconds maximalWaitTime = settings.GetMaximalBatchWaitTime();
+            const std::chrono::milliseconds minimalWaitTime = std::min(settings.minimalBatchWaitTime, maximalWaitTime);
+
+            if (!isStarted)
+            {
+                // start out with small batches that are not held back for long
+                isStarted = true;
+                batchItemLimit = minimalItemLimit;
+                batchWaitTime = minimalWaitTime;
+            }
+
+            const double inFlightRatio = static_cast<double>(batchesInFlight) / std::max<size_t>(1, settings.maximalNumberOfBatchesInFlight);
+            const bool isLatencyInflated = hasLatency && smoothedLatency > 2 * minimalLatency + latencyMargin;
+
+            // an inflated latency only counts while batches pile up, as it is not measured again until a batch completes
+            if (inFlightRatio >= congestedLoad || bufferFillRatio >= congestedLoad || (isLatencyInflated && inFlightRatio > lightLoad))
+            {
+                // multiplicative increase of both limits: fewer, fuller requests
+                batchItemLimit *= 2;
+                batchWaitTime *= 2;
+            }
+            else if (inFlightRatio <= lightLoad && bufferFillRatio < lightLoad)
+            {
+                // decrease of both limits: deliver sooner while there is spare capacity. The wait time is halved, as a long one
+                // leaves few batches to lower it with.
+                batchItemLimit -= std::min(batchItemLimit, std::max<size_t>(1, (maximalItemLimit - minimalItemLimit) / decreaseStepCount));
+                batchWaitTime /= 2;
+            }
+
+            if (bufferFillRatio >= lightLoad)
+            {
+                // events are backing up in the buffer; small batches would take up the batches in flight and the transport with requests
+                batchItemLimit = maximalItemLimit;
+            }
+
+            // the settings may have changed since the last batch
+            batchItemLimit = std::min(std::max(minimalItemLimit, batchItemLimit), maximalItemLimit);
+            batchWaitTime = std::min(std::max(minimalWaitTime, batchWaitTime), maximalWaitTime);
+        }
+
+        stats.batchItemLimit = GetBatchItemLimit(settings);
+        stats.batchWaitTime = GetBatchWaitTime(settings);
+    }
+
+    size_t PlayFabEventBatchController::GetBatchItemLimit(const PlayFabEventPipelineSettings& settings) const
+    {
+        return (settings.useAdaptiveBatching && isStarted) ? batchItemLimit : GetMaximalItemLimit(settings);
+    }
+
+    std::chrono::milliseconds PlayFabEventBatchController::GetBatchWaitTime(const PlayFabEventPipelineSettings& settings) const
+    {
+        return (settings.useAdaptiveBatching && isStarted) ? batchWaitTime : settings.GetMaximalBatchWaitTime();
+    }
+
+    void PlayFabEventBatchController::OnBatchSent(size_t eventCount)
+    {
+        std::unique_lock<std::mutex> lock(statsMutex);
+        ++stats.batchesSent;
+        stats.eventsSent += eventCount;
+    }
+
+    void PlayFabEventBatchController::OnBatchCompleted(std::chrono::microseconds latency)
+    {
+        std::unique_lock<std::mutex> lock(statsMutex);
+        if (!hasLatency)
+        {
+            hasLatency = true;
+            minimalLatency = latency;
+            smoothedLatency = latency;
+        }
+        else
+        {
+            minimalLatency = std::min(minimalLatency, latency);
+            smoothedLatency += (latency - smoothedLatency) / latencySmoothing;
+        }
+        stats.sendLatency = std::chrono::duration_cast<std::chrono::milliseconds>(smoothedLatency);
+    }
+
+    void PlayFabEventBatchController::OnEventOverflowed()
+    {
+        eventsOverflowed.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    PlayFabEventPipelineStats PlayFabEventBatchController::GetStats(const PlayFabEventPipelineSettings& settings) const
+    {
+        PlayFabEventPipelineStats result;
+        {
+            std::unique_lock<std::mutex> lock(statsMutex);
+            result = stats;
+        }
+        if (result.batchItemLimit == 0)
+        {
+            // no batch was started yet
+            result.batchItemLimit = settings.maximalNumberOfItemsInBatch;
+            result.batchWaitTime = settings.GetMaximalBatchWaitTime();
+        }
+        result.eventsOverflowed = eventsOverflowed.load(std::memory_order_relaxed);
+        return result;
+    }
+}
+
+#endif
@@ -6,6 +6,97 @@ namespace PlayFab
 {
     const size_t minimalBufferSize = 4096; // The default minimal buffer size in bytes. For performance optimization reasons this ideally should be equal to the memory page size which is 4096 on most popular platforms.
 
+    static_assert(sizeof(PlayFabEventPacket) <= PlayFabEventBufferCacheLineSize, "An event packet must fit in one slot of the buffer");
+
+    /// <summary>
+    /// The ring of one producer thread in a PlayFabEventBuffer with producer staging. It is attached to one thread at a time,
+    /// and reattached to another thread once its thread exits, so there are at most as many rings as concurrent producers.
+    /// </summary>
+    class PlayFabEventStagingRing final
+    {
+    public:
+        PlayFabEventStagingRing(const size_t capacity, const std::shared_ptr<std::atomic<int64_t>>& bufferCapacity) :
+            tail(0),
+            head(0),
+            credit(0),
+            attached(true),
+            next(nullptr),
+            mask(capacity - 1),
+            slots(new std::shared_ptr<const IPlayFabEmitEventRequest>[capacity]),
+            bufferCapacity(bufferCapacity)
+        {
+        }
+
+        // Returns the capacity this ring holds to the buffer and lets another producer thread attach it
+        void Detach()
+        {
+            bufferCapacity->fetch_add(credit, std::memory_order_relaxed);
+            credit = 0;
+            attached.store(false, std::memory_order_release);
+        }
+
+        std::atomic<uint64_t> tail; // The position of the next event to put. Only the attached producer writes it.
+        uint8_t tailPadding[PlayFabEventBufferCacheLineSize];
+
+        uint64_t head; // The position of the next event to take. Only the consumer touches it.
+        uint8_t headPadding[PlayFabEventBufferCacheLineSize];
+
+        int64_t credit; // The capacity drawn from the buffer and not used yet. Only the attached producer touches it.
+        std::atomic<bool> attached; // Whether a producer thread is attached
+        PlayFabEventStagingRing* next; // The next (older) ring of the buffer, set before this ring is published
+
+        // The ring can hold as many events as the whole buffer, so drawn capacity always guarantees a free slot
+        const uint64_t mask;
+        std::unique_ptr<std::shared_ptr<const IPlayFabEmitEventRequest>[]> slots;
+        const std::shared_ptr<std::atomic<int64_t>> bufferCapacity;
+    };
+
+    namespace
+    {
+        std::atomic<uint64_t> nextStagingId(1);
+
+        // A per-thread cache of the staging rings this thread is attached to, by the id of their buffer.
+        // It holds the rings strongly, so a ring is detached when its thread exits even if the buffer is gone.
+        struct StagingRingCache
+        {
+            struct Entry
+            {
+                uint64_t stagingId = 0;
+                std::shared_ptr<PlayFabEventStagingRing> ring;
+            };
+
+            ~StagingRingCache()
+            {
+                for (Entry& entry : entries)
+                {
+                    Detach(entry);
+                }
+            }
+
+            static void Detach(Entry& entry)
+            {
+                if (entry.ring != nullptr)
+                {
+                    entry.ring->Detach();
+                    entry.ring.reset();
+                }
+                entry.stagingId = 0;
+            }
+
+            // A thread which puts events in more buffers than this at once changes rings as they are evicted,
+            // and its events in the previous ring of a buffer may then be taken after the ones in the new ring
+            static constexpr size_t entryCount = 4;
+            Entry entries[entryCount];
+            size_t nextEviction = 0;
+        };
+
+        StagingRingCache& GetStagingRingCache()
+        {
+            static thread_local StagingRingCache cache;
+            return cache;
+        }
+    }
+
     // Finds and returns a minimal power of 2 that covers the specified bufferSize.
     // For example, if bufferSize is 4000 then it will return 4096.
     static size_t AdjustBufferSize(const size_t bufferSize)
@@ -20,87 +111,128 @@ namespace PlayFab
         return  result;
     }
 
+    // Returns the number of slots for a buffer of the specified size: a power of 2 that holds at least as many events
+    // as fit in the adjusted size packed back to back. Each slot takes a whole cache line, so the slots may take more memory than that.
+    static size_t GetSlotCount(const size_t bufferSize)
+    {
+        const size_t eventCount = AdjustBufferSize(bufferSize) / sizeof(PlayFabEventPacket);
+        size_t result = 1;
+        while (result < eventCount)
+        {
+            result *= 2;
+        }
+
+        return result;
+    }
+
+    const size_t stagingRunLength = 16; // The number of events the consumer takes from one staging ring before it moves to the next one
+
+    // Returns the first cache line boundary in the buffer
+    static uint8_t* AlignToCacheLine(uint8_t* buffer)
+    {
+        const uintptr_t address = reinterpret_cast<uintptr_t>(buffer);
+        return buffer + ((PlayFabEventBufferCacheLineSize - address % PlayFabEventBufferCacheLineSize) % PlayFabEventBufferCacheLineSize);
+    }
+
     PlayFabEventBuffer::PlayFabEventBuffer(
-        const size_t bufferSize)
+        const size_t bufferSize,
+        const bool useProducerStaging)
         :
         disabled(false),
-        buffMask(AdjustBufferSize(bufferSize) - 1),
-        bufferArray(std::unique_ptr<uint8_t[]>(new uint8_t[buffMask + 1])),
-        buffStart((uint64_t)(bufferArray.get())),
-        buffEnd(buffStart + buffMask + 1),
-        eventIndex(std::make_shared<std::atomic<uint64_t>>(0))
-    {
-        uint8_t *buffer = (uint8_t*)buffStart;
-        memset(buffer, 0, buffMask + 1);
-
-        // First event is just a stub which is used only to maintain the initial consistency of m_head/m_tail.
-        // It is immediately considered already consumed.
-        uint64_t index = eventIndex->load(std::memory_order_relaxed);
-        PlayFabEventPacket* firstEvent = CreateEventPacket(buffer, index, nullptr);
-
-        tail = firstEvent;
-        head.store(firstEvent, std::memory_order_release);
+        useProducerStaging(useProducerStaging),
+        buffMask(GetSlotCount(bufferSize) - 1),
+        bufferArray(useProducerStaging ? nullptr : std::unique_ptr<uint8_t[]>(new uint8_t[(buffMask + 1) * PlayFabEventBufferCacheLineSize + PlayFabEventBufferCacheLineSize])),
+        buffStart(AlignToCacheLine(bufferArray.get())),
+        head(0),
+        tail(0),
+        stagingId(nextStagingId.fetch_add(1, std::memory_order_relaxed)),
+        stagingChunk(std::max<int64_t>(1, std::min<int64_t>(16, static_cast<int64_t>(buffMask + 1) / 16))),
+        stagingCapacity(useProducerStaging ? std::make_shared<std::atomic<int64_t>>(static_cast<int64_t>(buffMask + 1)) : nullptr),
+        stagingRings(nullptr),
+        nextStagingRing(nullptr),
+        takenFromStagingRing(0),
+        takenSinceReturn(0)
+    {
+        if (useProducerStaging)
+        {
+            return;
+        }
+
+        // Every slot starts out free for the producer of its first position
+        for (uint64_t position = 0; position <= buffMask; ++position)
+        {
+            new(buffStart + position * PlayFabEventBufferCacheLineSize)PlayFabEventPacket(position);
+        }
     }
 
     PlayFabEventBuffer::~PlayFabEventBuffer()
     {
-        SpinLock lock(atomicSpin);
+        if (useProducerStaging)
+        {
+            // release the events which were never consumed; the rings themselves may live on in the caches of their threads
+            for (const auto& ring : ownedStagingRings)
+            {
+                for (uint64_t position = ring->head; position != ring->tail.load(std::memory_order_acquire); ++position)
+                {
+                    ring->slots[position & ring->mask].reset();
+                }
+            }
+            return;
+        }
 
-        // delete all remaining events (including the last consumed one)
-        PlayFabEventPacket* event = head.load(std::memory_order_acquire);
-        PlayFabEventPacket* nextPacket;
-        while (event != nullptr)
+        // delete all event packets, releasing the events which were never consumed
+        for (uint64_t position = 0; position <= buffMask; ++position)
         {
-            nextPacket = event->next.load(std::memory_order_acquire);
-            DeleteEventPacket(event);
-            event = nextPacket;
+            GetEventPacket(position)->~PlayFabEventPacket();
         }
     }
 
     PlayFabEventBuffer::EventProducingResult PlayFabEventBuffer::TryPut(std::shared_ptr<const IPlayFabEmitEventRequest> request) // This must be thread-safe
     {
-        SpinLock lock(atomicSpin);
-
         if (disabled.load(std::memory_order_consume))
         {
             return EventProducingResult::Disabled;
         }
 
-        const uint32_t size = sizeof(PlayFabEventPacket);
-
-        PlayFabEventPacket* headPtr = head.load(std::memory_order_acquire);
-        PlayFabEventPacket* tailPtr = tail;
-
-        // verify if there is enough space
-        const uint64_t headVal = reinterpret_cast<uint64_t>(headPtr);
-        uint64_t eventStart = reinterpret_cast<uint64_t>((uint8_t*)tailPtr + size);
-
-        // align event start by platform-safe boundary
-        if (eventStart % 8 != 0)
+        if (useProducerStaging)
         {
-            eventStart += 8 - (eventStart % 8);
+            return TryPutStaged(std::move(request));
         }
 
-        const bool wrapping = eventStart + size > buffEnd;
-        const uint64_t sizeNeeded = !wrapping ? size : size + (buffEnd - eventStart);
-        const uint64_t sizeLeft = (headVal - eventStart) & buffMask;
-
-        if (sizeNeeded > sizeLeft)
+        // reserve the slot at the tail
+        PlayFabEventPacket* event;
+        uint64_t position = tail.load(std::memory_order_relaxed);
+        for (;;)
         {
-            return EventProducingResult::Overflow;
-        }
+            event = GetEventPacket(position);
+            const uint64_t sequence = event->sequence.load(std::memory_order_acquire);
+            const int64_t difference = static_cast<int64_t>(sequence - position);
 
-        if (wrapping)
-        {
-            eventStart = buffStart;
+            if (difference == 0)
+            {
+                // the slot is free; try to move the tail past it
+                if (tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                // the slot still holds the event taken a full lap ago, which the consumer has not taken yet
+                return EventProducingResult::Overflow;
+            }
+            else
+            {
+                // another producer reserved the slot first
+                position = tail.load(std::memory_order_relaxed);
+            }
         }
 
-        // create an event packet, set it to the tail->next and move the tail
-
-        uint64_t currentEventIndex = eventIndex->fetch_add(1, std::memory_order_relaxed);
-        PlayFabEventPacket* event = CreateEventPacket(reinterpret_cast<uint8_t*>(eventStart), currentEventIndex, std::move(request));
-        tailPtr->next.store(event, std::memory_order_release);
-        tail = event;
+        // fill the reserved slot and publish it to the consumer
+        event->eventIndex = position;
+        event->timestamp = std::time(nullptr);
+        event->eventRequest = std::move(request);
+        event->sequence.store(position + 1, std::memory_order_release);
 
         return EventProducingResult::Success;
     }
@@ -112,36 +244,186 @@ namespace PlayFab
             return EventConsumingResult::Disabled;
         }
 
-        PlayFabEventPacket* headPtr = head.load(std::memory_order_acquire);
-        PlayFabEventPacket* event = headPtr->next.load(std::memory_order_acquire);
+        if (useProducerStaging)
+        {
+            return TryTakeStaged(request);
+        }
 
-        if (event == nullptr)
+        PlayFabEventPacket* event = GetEventPacket(head);
+        if (event->sequence.load(std::memory_order_acquire) != head + 1)
         {
-            // there are no events available for consumption
+            // there are no events available for consumption (or the producer of the next one has not published it yet)
             return EventConsumingResult::Empty;
         }
 
         // event is available; return its values
         request = std::move(event->eventRequest);
 
-        // set new head (new last consumed event)
-        head.store(event, std::memory_order_release);
-
-        // delete old last consumed event from buffer
-        DeleteEventPacket(headPtr);
+        // free the slot for the producer of the next lap and move the head
+        event->sequence.store(head + buffMask + 1, std::memory_order_release);
+        ++head;
 
         return EventConsumingResult::Success;
     }
 
-    PlayFabEventPacket* PlayFabEventBuffer::CreateEventPacket(uint8_t *location, const uint64_t index, std::shared_ptr<const IPlayFabEmitEventRequest> request)
+    bool PlayFabEventBuffer::IsEmpty() const
+    {
+        if (useProducerStaging)
+        {
+            for (const PlayFabEventStagingRing* ring = stagingRings.load(std::memory_order_acquire); ring != nullptr; ring = ring->next)
+            {
+                if (ring->head != ring->tail.load(std::memory_order_acquire))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        return GetEventPacket(head)->sequence.load(std::memory_order_acquire) != head + 1;
+    }
+
+    size_t PlayFabEventBuffer::GetEventCount() const
+    {
+        if (useProducerStaging)
+        {
+            uint64_t count = 0;
+            for (const PlayFabEventStagingRing* ring = stagingRings.load(std::memory_order_acquire); ring != nullptr; ring = ring->next)
+            {
+                count += ring->tail.load(std::memory_order_acquire) - ring->head;
+            }
+            return static_cast<size_t>(count);
+        }
+
+        return static_cast<size_t>(tail.load(std::memory_order_relaxed) - head);
+    }
+
+    size_t PlayFabEventBuffer::GetCapacity() const
+    {
+        return buffMask + 1;
+    }
+
+    PlayFabEventPacket* PlayFabEventBuffer::GetEventPacket(const uint64_t position) const
+    {
+        return reinterpret_cast<PlayFabEventPacket*>(buffStart + (position & buffMask) * PlayFabEventBufferCacheLineSize);
+    }
+
+    PlayFabEventBuffer::EventProducingResult PlayFabEventBuffer::TryPutStaged(std::shared_ptr<const IPlayFabEmitEventRequest>&& request)
     {
-        // Use placement new to allocate an event packet in the buffer
-        return new(location)PlayFabEventPacket(index, request);
+        PlayFabEventStagingRing* ring = GetStagingRing();
+
+        if (ring->credit == 0)
+        {
+            // draw the next chunk of capacity from the buffer; when it is used up the buffer is full
+            int64_t available = stagingCapacity->load(std::memory_order_relaxed);
+            int64_t drawn;
+            do
+            {
+                if (available <= 0)
+                {
+                    return EventProducingResult::Overflow;
+                }
+                drawn = std::min(available, stagingChunk);
+            } while (!stagingCapacity->compare_exchange_weak(available, available - drawn, std::memory_order_relaxed));
+            ring->credit = drawn;
+        }
+
+        // put the event at the tail of this thread's ring and publish it to the consumer
+        --ring->credit;
+        const uint64_t position = ring->tail.load(std::memory_order_relaxed);
+        ring->slots[position & ring->mask] = std::move(request);
+        ring->tail.store(position + 1, std::memory_order_release);
+
+        return EventProducingResult::Success;
     }
 
-    void PlayFabEventBuffer::DeleteEventPacket(PlayFabEventPacket* event)
+    PlayFabEventBuffer::EventConsumingResult PlayFabEventBuffer::TryTakeStaged(std::shared_ptr<const IPlayFabEmitEventRequest>& request)
     {
-        // Destroy the event packet object explicitly
-        event->~PlayFabEventPacket();
+        // visit every ring once, starting with the ring the consumer is taking a run of events from
+        PlayFabEventStagingRing* const firstRing = (nextStagingRing != nullptr) ? nextStagingRing : stagingRings.load(std::memory_order_acquire);
+        PlayFabEventStagingRing* ring = firstRing;
+        while (ring != nullptr)
+        {
+            if (ring->head != ring->tail.load(std::memory_order_acquire))
+            {
+                request = std::move(ring->slots[ring->head & ring->mask]);
+                ++ring->head;
+
+                // keep taking from the same ring for a short run, then move on so that no producer is starved
+                if (ring != nextStagingRing)
+                {
+                    nextStagingRing = ring;
+                    takenFromStagingRing = 0;
+                }
+                if (++takenFromStagingRing >= stagingRunLength)
+                {
+                    nextStagingRing = ring->next;
+                }
+
+                // return the freed capacity to the buffer in chunks
+                if (++takenSinceReturn >= stagingChunk)
+                {
+                    stagingCapacity->fetch_add(takenSinceReturn, std::memory_order_relaxed);
+                    takenSinceReturn = 0;
+                }
+                return EventConsumingResult::Success;
+            }
+
+            // the list ends with the oldest ring; continue from the newest
+            ring = (ring->next != nullptr) ? ring->next : stagingRings.load(std::memory_order_acquire);
+            if (ring == firstRing)
+            {
+                break;
+            }
+        }
+
+        // there are no events available for consumption; make all freed capacity available while idle
+        if (takenSinceReturn > 0)
+        {
+            stagingCapacity->fetch_add(takenSinceReturn, std::memory_order_relaxed);
+            takenSinceReturn = 0;
+        }
+        return EventConsumingResult::Empty;
+    }
+
+    PlayFabEventStagingRing* PlayFabEventBuffer::GetStagingRing()
+    {
+        StagingRingCache& cache = GetStagingRingCache();
+        for (const StagingRingCache::Entry& entry : cache.entries)
+        {
+            if (entry.stagingId == stagingId)
+            {
+                return entry.ring.get();
+            }
+        }
+
+        // First event of this thread: attach a ring whose thread has exited, or add a new one
+        std::shared_ptr<PlayFabEventStagingRing> ring;
+        { // LOCK stagingRingsMutex
+            std::unique_lock<std::mutex> lock(stagingRingsMutex);
+            for (const auto& ownedRing : ownedStagingRings)
+            {
+                bool attached = false;
+                if (ownedRing->attached.compare_exchange_strong(attached, true, std::memory_order_acquire))
+                {
+                    ring = ownedRing;
+                    break;
+                }
+            }
+
+            if (ring == nullptr)
+            {
+                ring = std::make_shared<PlayFabEventStagingRing>(buffMask + 1, stagingCapacity);
+                ring->next = stagingRings.load(std::memory_order_relaxed);
+                ownedStagingRings.push_back(ring);
+                stagingRings.store(ring.get(), std::memory_order_release);
+            }
+        } // UNLOCK stagingRingsMutex
+
+        StagingRingCache::Entry& entry = cache.entries[cache.nextEviction++ % StagingRingCache::entryCount];
+        StagingRingCache::Detach(entry);
+        entry.stagingId = stagingId;
+        entry.ring = std::move(ring);
+        return entry.ring.get();
     }
 }
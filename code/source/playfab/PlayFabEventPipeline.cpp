@@ -3,7 +3,8 @@
 #ifndef DISABLE_PLAYFABENTITY_API
 
 #include <playfab/PlayFabEventPipeline.h>
-#include <playfab/PlayFabEventsInstanceApi.h>
+#include <playfab/PlayFabApiDispatch.h>
+#include <playfab/PlayFabJsonUtils.h>
 #include <playfab/PlayFabSettings.h>
 
 #include <chrono>
@@ -11,44 +12,142 @@
 namespace PlayFab
 {
     static const int defaultBufferSize = 256;
-    static const int defaultMaxItemsInBatch = 5;
+    static const int defaultMaxBatchSizeInBytes = 64 * 1024;
+    static const int defaultMaxItemsInBatch = 200; // The Events API accepts up to 200 events per request
     static const int defaultMaxBatchWaitTimeInSeconds = 3;
+    static const std::chrono::milliseconds defaultMinBatchWaitTime = std::chrono::milliseconds(100);
+    static const int defaultMaxRetries = 3;
+    static const std::chrono::milliseconds defaultRetryWaitTime = std::chrono::seconds(1);
     static const int defaultMaxBatchesInFlight = 16;
     static const int defaultReadBufferWaitTimeInMs = 10;
+    static const size_t defaultSpoolSegmentSize = 1024 * 1024;
+    static const size_t defaultMaxSpoolSize = 16 * 1024 * 1024;
+
+    namespace
+    {
+        // The retry wait time doubles up to this many times
+        constexpr size_t maximalRetryBackoffShift = 6;
+
+        // A WriteEvents request body is the serialized events, separated by commas, between these
+        constexpr char batchBodyBegin[] = "{\"Events\":[";
+        constexpr char batchBodyEnd[] = "]}";
+
+        // Whether an error may go away when the batch is sent again: no response (e.g. no connection), throttling, or the service being unavailable
+        bool IsTransientError(const PlayFabError& error)
+        {
+            switch (error.ErrorCode)
+            {
+            case PlayFabErrorCode::PlayFabErrorHostnameNotFound:
+            case PlayFabErrorCode::PlayFabErrorConnectionTimeout:
+            case PlayFabErrorCode::PlayFabErrorConnectionRefused:
+            case PlayFabErrorCode::PlayFabErrorSocketError:
+            case PlayFabErrorCode::PlayFabErrorServiceUnavailable:
+            case PlayFabErrorCode::PlayFabErrorDownstreamServiceUnavailable:
+            case PlayFabErrorCode::PlayFabErrorAPIClientRequestRateLimitExceeded:
+            case PlayFabErrorCode::PlayFabErrorPerEntityEventRateLimitExceeded:
+                return true;
+            default:
+                return error.HttpCode == 0 || error.HttpCode == 408 || error.HttpCode == 429 || error.HttpCode >= 500;
+            }
+        }
+
+        // The error of every delivered batch, which their responses share
+        const std::shared_ptr<const PlayFabError>& GetSuccessError()
+        {
+            static const std::shared_ptr<const PlayFabError> successError = []()
+            {
+                auto error = std::make_shared<PlayFabError>();
+                error->HttpCode = 200;
+                error->ErrorCode = PlayFabErrorCode::PlayFabErrorSuccess;
+                return error;
+            }();
+            return successError;
+        }
+    }
 
     PlayFabEventPipelineSettings::PlayFabEventPipelineSettings() :
         bufferSize(defaultBufferSize),
+        maximalBatchSizeInBytes(defaultMaxBatchSizeInBytes),
         maximalNumberOfItemsInBatch(defaultMaxItemsInBatch),
         maximalBatchWaitTime(defaultMaxBatchWaitTimeInSeconds),
+        maximalBatchWaitTimeMs(0),
+        minimalBatchWaitTime(defaultMinBatchWaitTime),
+        maximalNumberOfRetries(defaultMaxRetries),
+        retryWaitTime(defaultRetryWaitTime),
         maximalNumberOfBatchesInFlight(defaultMaxBatchesInFlight),
         readBufferWaitTime(defaultReadBufferWaitTimeInMs),
         authenticationContext(nullptr),
         emitType(PlayFabEventPipelineType::PlayFabPlayStream),
-        useBackgroundThread(true)
+        useBackgroundThread(true),
+        useProducerStaging(false),
+        useAdaptiveBatching(false),
+        spoolSegmentSize(defaultSpoolSegmentSize),
+        maximalSpoolSizeInBytes(defaultMaxSpoolSize),
+        spoolSyncPolicy(PlayFabEventSpoolSyncPolicy::SegmentFull),
+        emitBatchCallback(nullptr)
     {
     }
 
     PlayFabEventPipelineSettings::PlayFabEventPipelineSettings(PlayFabEventPipelineType type, bool useBackgroundThread) :
         bufferSize(defaultBufferSize),
+        maximalBatchSizeInBytes(defaultMaxBatchSizeInBytes),
         maximalNumberOfItemsInBatch(defaultMaxItemsInBatch),
         maximalBatchWaitTime(defaultMaxBatchWaitTimeInSeconds),
+        maximalBatchWaitTimeMs(0),
+        minimalBatchWaitTime(defaultMinBatchWaitTime),
+        maximalNumberOfRetries(defaultMaxRetries),
+        retryWaitTime(defaultRetryWaitTime),
         maximalNumberOfBatchesInFlight(defaultMaxBatchesInFlight),
         readBufferWaitTime(defaultReadBufferWaitTimeInMs),
         authenticationContext(nullptr),
         emitType(type),
-        useBackgroundThread(useBackgroundThread)
+        useBackgroundThread(useBackgroundThread),
+        useProducerStaging(false),
+        useAdaptiveBatching(false),
+        spoolSegmentSize(defaultSpoolSegmentSize),
+        maximalSpoolSizeInBytes(defaultMaxSpoolSize),
+        spoolSyncPolicy(PlayFabEventSpoolSyncPolicy::SegmentFull),
+        emitBatchCallback(nullptr)
+    {
+    }
+
+    std::chrono::milliseconds PlayFabEventPipelineSettings::GetMaximalBatchWaitTime() const
     {
+        return maximalBatchWaitTimeMs.count() > 0 ? maximalBatchWaitTimeMs : std::chrono::milliseconds(std::chrono::seconds(maximalBatchWaitTime));
     }
 
     PlayFabEventPipeline::PlayFabEventPipeline(const std::shared_ptr<PlayFabEventPipelineSettings>& settings) :
         batchCounter(0),
-        buffer(settings->bufferSize),
-        isWorkerThreadRunning(false)
+        batchSizeInBytes(0),
+        resentBatchesInFlight(0),
+        retryJitter(static_cast<std::minstd_rand::result_type>(std::chrono::steady_clock::now().time_since_epoch().count())),
+        buffer(settings->bufferSize, settings->useProducerStaging),
+        isWorkerThreadRunning(false),
+        workerThreadWait(WorkerThreadWait::Events),
+        isWorkerThreadWakeUpRequested(false),
+        isWorkerThreadWaitingForEvents(false)
     {
-        eventsApi = std::make_shared<PlayFabEventsInstanceAPI>(PlayFabSettings::staticPlayer);
-
         this->settings = settings;
         this->batchesInFlight.reserve(this->settings->maximalNumberOfBatchesInFlight);
+        this->batchesInFlightDetails.reserve(this->settings->maximalNumberOfBatchesInFlight);
+
+        if (!this->settings->spoolDirectory.empty())
+        {
+            // events earlier runs did not deliver are sent from the spool first
+            this->spool = std::unique_ptr<PlayFabEventSpool>(new PlayFabEventSpool(this->settings->spoolDirectory,
+                this->settings->spoolSegmentSize, this->settings->maximalSpoolSizeInBytes, this->settings->spoolSyncPolicy));
+            PlayFabEventSpoolRange backlog;
+            if (!this->spool->Open(backlog))
+            {
+                LOG_PIPELINE("The event spool could not be opened, events are kept in memory only");
+                this->spool.reset();
+            }
+            else if (backlog.count > 0)
+            {
+                this->spoolBacklog.push_back(backlog);
+            }
+        }
+
         if (this->settings->useBackgroundThread)
         {
             this->Start();
@@ -58,6 +157,18 @@ namespace PlayFab
     PlayFabEventPipeline::~PlayFabEventPipeline()
     {
         Stop();
+
+        // the batches waiting for a retry won't get it
+        std::multimap<std::chrono::steady_clock::time_point, RetryBatch> pendingRetries;
+        { // LOCK batchesInFlight mutex
+            std::unique_lock<std::mutex> lock(inFlightMutex);
+            pendingRetries.swap(this->retryQueue);
+        } // UNLOCK batchesInFlight
+
+        for (auto& retry : pendingRetries)
+        {
+            CallbackFailedBatch(std::move(retry.second.events), retry.second.error, retry.second.retryCount, nullptr);
+        }
     }
 
     void PlayFabEventPipeline::Start()
@@ -104,6 +215,7 @@ namespace PlayFab
 
         // stop worker thread
         this->isWorkerThreadRunning = false;
+        WakeUpWorkerThread();
         if (this->workerThread.joinable())
         {
             this->workerThread.join();
@@ -143,10 +255,20 @@ namespace PlayFab
             switch (this->buffer.TryPut(request))
             {
             case Result::Success:
+            {
+                // wake the worker thread up if it sleeps until events arrive. The fence orders putting the event before
+                // reading the flag, as the worker thread orders setting the flag before checking the buffer for events.
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (this->isWorkerThreadWaitingForEvents.load(std::memory_order_relaxed))
+                {
+                    WakeUpWorkerThread();
+                }
                 return;
+            }
 
             case Result::Overflow:
             {
+                this->batchController.OnEventOverflowed();
                 emitResult = EmitEventResult::Overflow;
                 LOG_PIPELINE("Buffer overflow");
             }
@@ -167,7 +289,6 @@ namespace PlayFab
             }
 
             // pipeline failed to intake the event, create a response
-            std::shared_ptr<const PlayFabEmitEventRequest> playFabEmitRequest = std::dynamic_pointer_cast<const PlayFabEmitEventRequest>(request);
             auto playFabEmitEventResponse = std::make_shared<PlayFabEmitEventResponse>();
             playFabEmitEventResponse->emitEventResult = emitResult;
 
@@ -195,7 +316,7 @@ namespace PlayFab
             playFabEmitEventResponse->playFabError = emitEventError;
 
             // call an emit event callback
-            CallbackRequest(playFabEmitRequest, std::move(playFabEmitEventResponse));
+            CallbackRequest(*request, playFabEmitEventResponse);
         }
         catch (...)
         {
@@ -211,6 +332,11 @@ namespace PlayFab
         } // UNLOCK userCallbackMutex
     }
 
+    PlayFabEventPipelineStats PlayFabEventPipeline::GetStats() const
+    {
+        return this->batchController.GetStats(*this->settings);
+    }
+
     void PlayFabEventPipeline::WorkerThread()
     {
         using clock = std::chrono::steady_clock;
@@ -218,12 +344,72 @@ namespace PlayFab
         while (this->isWorkerThreadRunning)
         {
             bool hasMoreWorkToProcess = DoWork();
+            if (hasMoreWorkToProcess)
+            {
+                continue;
+            }
+
+            // sleep until there is work to process again
+            std::unique_lock<std::mutex> lock(workerThreadMutex);
+            bool hasDeadline = false;
+            clock::time_point deadline;
+            switch (this->workerThreadWait)
+            {
+            case WorkerThreadWait::Events:
+            {
+                if (this->batch.size() > 0)
+                {
+                    // the incomplete batch must be sent out by its deadline
+                    hasDeadline = true;
+                    deadline = this->momentBatchStarted + this->batchController.GetBatchWaitTime(*this->settings);
+                }
+
+                clock::time_point resendTime;
+                if (this->GetResendTime(resendTime))
+                {
+                    // a retry, or the spool backlog, is due then
+                    deadline = hasDeadline ? std::min(deadline, resendTime) : resendTime;
+                    hasDeadline = true;
+                }
+
+                // check the buffer once more after setting the flag, so an event put right before it is not missed
+                this->isWorkerThreadWaitingForEvents.store(true, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (!this->buffer.IsEmpty())
+                {
+                    this->isWorkerThreadWaitingForEvents.store(false, std::memory_order_relaxed);
+                    continue;
+                }
+            }
+            break;
+
+            case WorkerThreadWait::BatchOutOfFlight:
+            {
+                // woken up by the callbacks of batches in flight, or when a retry is due
+                hasDeadline = this->GetResendTime(deadline);
+            }
+            break;
 
-            if (!hasMoreWorkToProcess)
+            case WorkerThreadWait::EntityToken:
+            default:
             {
-                // give some time for batches in flight to deflate
-                std::this_thread::sleep_for(std::chrono::milliseconds(this->settings->readBufferWaitTime));
+                hasDeadline = true;
+                deadline = clock::now() + std::chrono::milliseconds(this->settings->readBufferWaitTime);
             }
+            break;
+            }
+
+            auto isWakeUpRequested = [this]() { return this->isWorkerThreadWakeUpRequested || !this->isWorkerThreadRunning; };
+            if (hasDeadline)
+            {
+                this->workerThreadWakeup.wait_until(lock, deadline, isWakeUpRequested);
+            }
+            else
+            {
+                this->workerThreadWakeup.wait(lock, isWakeUpRequested);
+            }
+            this->isWorkerThreadWakeUpRequested = false;
+            this->isWorkerThreadWaitingForEvents.store(false, std::memory_order_relaxed);
         }
         if( this->batch.size() > 0)
         {
@@ -232,6 +418,16 @@ namespace PlayFab
         }
     }
 
+    void PlayFabEventPipeline::WakeUpWorkerThread()
+    {
+        { // LOCK workerThreadMutex
+            std::unique_lock<std::mutex> lock(workerThreadMutex);
+            this->isWorkerThreadWaitingForEvents.store(false, std::memory_order_relaxed);
+            this->isWorkerThreadWakeUpRequested = true;
+        } // UNLOCK workerThreadMutex
+        this->workerThreadWakeup.notify_one();
+    }
+
     bool PlayFabEventPipeline::DoWork()
     {
         using clock = std::chrono::steady_clock;
@@ -246,9 +442,24 @@ namespace PlayFab
             {
                 size_t sizeOfBatchesInFlight = 0;
 
+                // Don't try taking a request until we get an entity token. We'd rather not lose events
+                // that were generated before an entity token was created (i.e. before a user was created).
+                if (PlayFabSettings::staticPlayer->entityToken.empty() &&
+                    (settings->authenticationContext == nullptr || settings->authenticationContext->entityToken.empty()))
+                {
+                    this->workerThreadWait = WorkerThreadWait::EntityToken;
+                    return false;
+                }
+
+                if (this->SendRetryBatch() || (this->spool != nullptr && this->SendSpoolBatch()))
+                {
+                    // a retry, or a batch of the spool backlog, was sent within the batches in flight of its own
+                    return true;
+                }
+
                 { // LOCK batchesInFlight mutex
                     std::unique_lock<std::mutex> lock(inFlightMutex);
-                    sizeOfBatchesInFlight = this->batchesInFlight.size();
+                    sizeOfBatchesInFlight = this->batchesInFlight.size() - this->resentBatchesInFlight;
                 } // UNLOCK batchesInFlight
 
                 // Process events in the loop
@@ -256,33 +467,58 @@ namespace PlayFab
                 {
                     // do not take new events from buffer if batches currently in flight are at the maximum allowed number
                     // and are not sent out (or received an error) yet
+                    this->workerThreadWait = WorkerThreadWait::BatchOutOfFlight;
                     return false;
                 }
 
-                // Don't try taking a request until we get an entity token. We'd rather not lose events
-                // that were generated before an entity token was created (i.e. before a user was created).
-                if (PlayFabSettings::staticPlayer->entityToken.empty() &&
-                    (settings->authenticationContext == nullptr || settings->authenticationContext->entityToken.empty()))
+                if (this->IsBatchFull())
                 {
-                    return false;
+                    // the batch was filled up by an event that did not fit in the previous batch
+                    this->SendBatch(this->batch);
+                    return true;
                 }
-                
+
                 switch (this->buffer.TryTake(request))
                 {
                 case Result::Success:
                 {
+                    const PlayFabEmitEventRequest* playFabEmitRequest = dynamic_cast<const PlayFabEmitEventRequest*>(request.get());
+                    size_t eventSize = (playFabEmitRequest != nullptr) ? playFabEmitRequest->estimatedSize : 0;
+                    if (eventSize == 0 && playFabEmitRequest != nullptr && playFabEmitRequest->event != nullptr)
+                    {
+                        // the event was not emitted through PlayFabEventAPI
+                        eventSize = playFabEmitRequest->event->GetEstimatedSize();
+                    }
+
+                    bool batchSent = false;
+                    if (this->batch.size() > 0 && this->batchSizeInBytes + eventSize > this->settings->maximalBatchSizeInBytes)
+                    {
+                        // the event does not fit in batch; send the batch out and start the next one with the event
+                        this->SendBatch(this->batch);
+                        batchSent = true;
+                    }
+
                     // add an event to batch
                     this->batch.push_back(std::move(request));
 
                     if (this->batch.size() == 1)
                     {
-                        // if it is the first event in an incomplete batch then set the batch creation moment
+                        // if it is the first event in an incomplete batch then set the batch creation moment, and the limits of the batch
                         this->momentBatchStarted = clock::now();
+                        this->batchSizeInBytes = 0;
+                        this->batchController.OnBatchStarted(*this->settings, sizeOfBatchesInFlight,
+                            static_cast<double>(this->buffer.GetEventCount() + 1) / this->buffer.GetCapacity());
+                    }
+                    this->batchSizeInBytes += eventSize;
+
+                    if (this->spool != nullptr && playFabEmitRequest != nullptr && playFabEmitRequest->event != nullptr)
+                    {
+                        this->SpoolEvent(*playFabEmitRequest);
                     }
-                    
-                    if (this->batch.size() >= this->settings->maximalNumberOfItemsInBatch)
+
+                    if (!batchSent && this->IsBatchFull())
                     {
-                        // if batch is full
+                        // if batch is full (otherwise it is sent on the next call, after batches in flight are checked again)
                         this->SendBatch(this->batch);
                     }
                     return true;
@@ -298,14 +534,14 @@ namespace PlayFab
                 if (this->batch.size() > 0)
                 {
                     // check if the batch wait time expired
-                    std::chrono::seconds batchAge = std::chrono::duration_cast<std::chrono::seconds>(clock::now() - this->momentBatchStarted);
-                    if (batchAge.count() >= (int32_t)this->settings->maximalBatchWaitTime)
+                    if (clock::now() - this->momentBatchStarted >= this->batchController.GetBatchWaitTime(*this->settings))
                     {
                         // batch wait time expired, send incomplete batch
                         this->SendBatch(this->batch);
                         return true;
                     }
                 }
+                this->workerThreadWait = WorkerThreadWait::Events;
                 return false;
             }
         }
@@ -329,49 +565,242 @@ namespace PlayFab
         return false;
     }
 
-    void PlayFabEventPipeline::SendBatch(std::vector<std::shared_ptr<const IPlayFabEmitEventRequest>>& localbatch)
+    bool PlayFabEventPipeline::IsBatchFull() const
     {
-        // create a WriteEvents API request to send the batch
-        EventsModels::WriteEventsRequest batchReq;
-        if (this->settings->authenticationContext != nullptr)
-        {
-            batchReq.authenticationContext = this->settings->authenticationContext;
-        }
+        return this->batch.size() > 0 &&
+            (this->batch.size() >= this->batchController.GetBatchItemLimit(*this->settings) || this->batchSizeInBytes >= this->settings->maximalBatchSizeInBytes);
+    }
 
-        for (const auto& eventEmitRequest : localbatch)
-        {
-            const auto& playFabEmitRequest = std::dynamic_pointer_cast<const PlayFabEmitEventRequest>(eventEmitRequest);
-            batchReq.Events.push_back(playFabEmitRequest->event->eventContents);
-        }
+    void PlayFabEventPipeline::SendBatch(std::vector<std::shared_ptr<const IPlayFabEmitEventRequest>>& localbatch)
+    {
+        // create a WriteEvents API request body to send the batch
+        SpliceBatchBody(localbatch);
         uintptr_t batchId = this->batchCounter.fetch_add(1);
         // add batch to flight tracking map
         void* customData = reinterpret_cast<void*>(batchId); // used to track batches across asynchronous Events API
 
+        this->batchController.OnBatchSent(localbatch.size());
+        if (this->spool != nullptr && this->settings->spoolSyncPolicy == PlayFabEventSpoolSyncPolicy::EveryBatch)
+        {
+            this->spool->Sync();
+        }
+
+        BatchInFlight details;
+        details.sendTime = std::chrono::steady_clock::now();
+        details.spoolRange = this->batchSpoolRange;
         { // LOCK batchesInFlight mutex
             std::unique_lock<std::mutex> lock(inFlightMutex);
             this->batchesInFlight[customData] = std::move(localbatch);
+            this->batchesInFlightDetails[customData] = details;
         } // UNLOCK batchesInFlight
 
+        this->batchSpoolRange = PlayFabEventSpoolRange();
         localbatch.clear(); // batch vector will be reused
         localbatch.reserve(this->settings->maximalNumberOfItemsInBatch);
-        if (this->settings->emitType == PlayFabEventPipelineType::PlayFabPlayStream)
+        WriteBatch(customData);
+    }
+
+    void PlayFabEventPipeline::SpoolEvent(const PlayFabEmitEventRequest& request)
+    {
+        // the events of a batch get consecutive positions, as only the worker thread appends to the spool
+        uint64_t position;
+        if (this->spool->Append(request.serializedEvent.empty() ? request.event->Serialize() : request.serializedEvent, position))
         {
-            // call Events API to send the batch
-            eventsApi->WriteEvents(
-                batchReq,
-                std::bind(&PlayFabEventPipeline::WriteEventsApiCallback, this, std::placeholders::_1, std::placeholders::_2),
-                std::bind(&PlayFabEventPipeline::WriteEventsApiErrorCallback, this, std::placeholders::_1, std::placeholders::_2),
-                customData);
+            if (this->batchSpoolRange.count == 0)
+            {
+                this->batchSpoolRange.first = position;
+            }
+            ++this->batchSpoolRange.count;
         }
-        else
+    }
+
+    bool PlayFabEventPipeline::SendRetryBatch()
+    {
+        RetryBatch retry;
+        { // LOCK batchesInFlight mutex
+            std::unique_lock<std::mutex> lock(inFlightMutex);
+            if (this->retryQueue.empty() || this->retryQueue.begin()->first > std::chrono::steady_clock::now() ||
+                this->resentBatchesInFlight >= GetResentBatchLimit())
+            {
+                return false;
+            }
+            retry = std::move(this->retryQueue.begin()->second);
+            this->retryQueue.erase(this->retryQueue.begin());
+        } // UNLOCK batchesInFlight
+
+        SpliceBatchBody(retry.events);
+        uintptr_t batchId = this->batchCounter.fetch_add(1);
+        void* customData = reinterpret_cast<void*>(batchId);
+
+        BatchInFlight details;
+        details.sendTime = std::chrono::steady_clock::now();
+        details.spoolRange = retry.spoolRange;
+        details.retryCount = retry.retryCount + 1;
+        { // LOCK batchesInFlight mutex
+            std::unique_lock<std::mutex> lock(inFlightMutex);
+            this->batchesInFlight[customData] = std::move(retry.events);
+            this->batchesInFlightDetails[customData] = details;
+            ++this->resentBatchesInFlight;
+        } // UNLOCK batchesInFlight
+
+        WriteBatch(customData);
+        return true;
+    }
+
+    bool PlayFabEventPipeline::SendSpoolBatch()
+    {
+        PlayFabEventSpoolRange backlog;
+        { // LOCK batchesInFlight mutex
+            std::unique_lock<std::mutex> lock(inFlightMutex);
+            if (this->spoolBacklog.empty() || std::chrono::steady_clock::now() < this->spoolDrainResumeTime ||
+                this->resentBatchesInFlight >= GetResentBatchLimit())
+            {
+                return false;
+            }
+            backlog = this->spoolBacklog.front();
+        } // UNLOCK batchesInFlight
+
+        // read events back from the spool, within the limits of a batch, and splice them as they are
+        const size_t itemLimit = this->batchController.GetBatchItemLimit(*this->settings);
+        size_t eventCount = 0;
+        size_t batchSize = 0;
+        PlayFabEventSpoolRange range;
+        range.first = backlog.first;
+        std::string record;
+        this->batchBody.assign(batchBodyBegin);
+        while (range.count < backlog.count && eventCount < itemLimit)
+        {
+            // records which can't be read were lost, and are released along with the batch
+            if (this->spool->Read(range.first + range.count, record))
+            {
+                if (eventCount > 0 && batchSize + record.length() > this->settings->maximalBatchSizeInBytes)
+                {
+                    break;
+                }
+                batchSize += record.length();
+
+                if (eventCount > 0)
+                {
+                    this->batchBody += ',';
+                }
+                this->batchBody += record;
+                ++eventCount;
+            }
+            ++range.count;
+        }
+        this->batchBody += batchBodyEnd;
+
+        { // LOCK batchesInFlight mutex
+            std::unique_lock<std::mutex> lock(inFlightMutex);
+            // only the worker thread takes from the backlog, while callbacks of failed batches append to it
+            PlayFabEventSpoolRange& front = this->spoolBacklog.front();
+            front.first += range.count;
+            front.count -= range.count;
+            if (front.count == 0)
+            {
+                this->spoolBacklog.pop_front();
+            }
+        } // UNLOCK batchesInFlight
+
+        if (eventCount == 0)
+        {
+            this->spool->Release(range);
+            return true;
+        }
+
+        uintptr_t batchId = this->batchCounter.fetch_add(1);
+        void* customData = reinterpret_cast<void*>(batchId);
+
+        this->batchController.OnBatchSent(eventCount);
+        BatchInFlight details;
+        details.sendTime = std::chrono::steady_clock::now();
+        details.spoolRange = range;
+        details.isFromSpool = true;
+        { // LOCK batchesInFlight mutex
+            std::unique_lock<std::mutex> lock(inFlightMutex);
+            this->batchesInFlight[customData].clear(); // no emit event callbacks to call, as the events were emitted by an earlier run or already called back
+            this->batchesInFlightDetails[customData] = details;
+            ++this->resentBatchesInFlight;
+        } // UNLOCK batchesInFlight
+
+        WriteBatch(customData);
+        return true;
+    }
+
+    bool PlayFabEventPipeline::GetResendTime(std::chrono::steady_clock::time_point& resendTime)
+    {
+        // LOCK batchesInFlight mutex
+        std::unique_lock<std::mutex> lock(inFlightMutex);
+        const auto now = std::chrono::steady_clock::now();
+        bool hasResendTime = false;
+        if (!this->retryQueue.empty() && this->retryQueue.begin()->first > now)
+        {
+            resendTime = this->retryQueue.begin()->first;
+            hasResendTime = true;
+        }
+        if (!this->spoolBacklog.empty() && this->spoolDrainResumeTime > now && (!hasResendTime || this->spoolDrainResumeTime < resendTime))
+        {
+            resendTime = this->spoolDrainResumeTime;
+            hasResendTime = true;
+        }
+        return hasResendTime;
+        // UNLOCK batchesInFlight
+    }
+
+    size_t PlayFabEventPipeline::GetResentBatchLimit() const
+    {
+        // retries and batches read back from the spool may have half as many batches in flight as fresh events
+        return std::max<size_t>(1, this->settings->maximalNumberOfBatchesInFlight / 2);
+    }
+
+    void PlayFabEventPipeline::SpliceBatchBody(const std::vector<std::shared_ptr<const IPlayFabEmitEventRequest>>& localbatch)
+    {
+        this->batchBody.assign(batchBodyBegin);
+        bool isFirstEvent = true;
+        for (const auto& eventEmitRequest : localbatch)
         {
-            // call Events API to send the batch, bypassing Playstream
-            eventsApi->WriteTelemetryEvents(
-                batchReq,
-                std::bind(&PlayFabEventPipeline::WriteEventsApiCallback, this, std::placeholders::_1, std::placeholders::_2),
-                std::bind(&PlayFabEventPipeline::WriteEventsApiErrorCallback, this, std::placeholders::_1, std::placeholders::_2),
-                customData);
+            const PlayFabEmitEventRequest* playFabEmitRequest = dynamic_cast<const PlayFabEmitEventRequest*>(eventEmitRequest.get());
+            if (playFabEmitRequest == nullptr || (playFabEmitRequest->serializedEvent.empty() && playFabEmitRequest->event == nullptr))
+            {
+                // not a PlayFab event (another IPlayFabEmitEventRequest implementation), which has nothing to serialize
+                continue;
+            }
+
+            if (!isFirstEvent)
+            {
+                this->batchBody += ',';
+            }
+            isFirstEvent = false;
+
+            if (!playFabEmitRequest->serializedEvent.empty())
+            {
+                // the event was encoded when it was emitted
+                this->batchBody += playFabEmitRequest->serializedEvent;
+            }
+            else
+            {
+                this->batchBody += playFabEmitRequest->event->Serialize();
+            }
         }
+        this->batchBody += batchBodyEnd;
+    }
+
+    void PlayFabEventPipeline::WriteBatch(void* customData)
+    {
+        std::shared_ptr<PlayFabAuthenticationContext> context = (this->settings->authenticationContext != nullptr) ? this->settings->authenticationContext : PlayFabSettings::staticPlayer;
+        PlayFabRequestHeaders headers;
+        headers.Set(PlayFabRequestHeaderKey::EntityToken, context->entityToken);
+
+        // call Events API to send the batch (WriteTelemetryEvents bypasses PlayStream). The request takes a copy of the body, so that batchBody keeps its capacity.
+        PlayFabApiDispatch::MakeApiCall<EventsModels::WriteEventsResponse>(
+            (this->settings->emitType == PlayFabEventPipelineType::PlayFabPlayStream) ? "/Event/WriteEvents" : "/Event/WriteTelemetryEvents",
+            std::string(this->batchBody),
+            std::move(headers),
+            [this](const EventsModels::WriteEventsResponse& result, void* customData) { WriteEventsApiCallback(result, customData); },
+            [this](const PlayFabError& error, void* customData) { WriteEventsApiErrorCallback(error, customData); },
+            std::shared_ptr<PlayFabApiSettings>(PlayFabSettings::staticSettings),
+            std::move(context),
+            customData);
     }
 
     void PlayFabEventPipeline::WriteEventsApiCallback(const EventsModels::WriteEventsResponse& result, void* customData)
@@ -379,26 +808,33 @@ namespace PlayFab
         try
         {
             std::vector<std::shared_ptr<const IPlayFabEmitEventRequest>> batchWritten;
-            if(TryGetBatchOutOfFlight(customData, &batchWritten))
+            BatchInFlight details;
+            if(TryGetBatchOutOfFlight(customData, &batchWritten, &details))
             {
-                auto requestBatchPtr = std::make_shared<std::vector<std::shared_ptr<const IPlayFabEmitEventRequest>>>(std::move(batchWritten));
-                // call individual emit event callbacks
-                for (const auto& eventEmitRequest : *requestBatchPtr)
+                { // LOCK batchesInFlight mutex
+                    std::unique_lock<std::mutex> lock(inFlightMutex);
+                    // a delivered batch shows the connection is back
+                    this->spoolDrainResumeTime = std::chrono::steady_clock::time_point();
+                } // UNLOCK batchesInFlight
+
+                if (details.spoolRange.count > 0)
+                {
+                    this->spool->Release(details.spoolRange);
+                }
+
+                if (batchWritten.empty())
                 {
-                    std::shared_ptr<const PlayFabEmitEventRequest> playFabEmitRequest = std::dynamic_pointer_cast<const PlayFabEmitEventRequest>(eventEmitRequest);
-                    auto playFabEmitEventResponse = std::shared_ptr<PlayFabEmitEventResponse>(new PlayFabEmitEventResponse());
-                    playFabEmitEventResponse->emitEventResult = EmitEventResult::Success;
-                    auto playFabError = std::make_shared<PlayFabError>();
-                    playFabError->HttpCode = 200;
-                    playFabError->ErrorCode = PlayFabErrorCode::PlayFabErrorSuccess;
-                    playFabEmitEventResponse->playFabError = playFabError;
-                    playFabEmitEventResponse->writeEventsResponse = std::shared_ptr<EventsModels::WriteEventsResponse>(new EventsModels::WriteEventsResponse(result));
-                    playFabEmitEventResponse->batch = requestBatchPtr;
-                    playFabEmitEventResponse->batchNumber = static_cast<size_t>(reinterpret_cast<uintptr_t>(customData));
-
-                    // call an emit event callback
-                    CallbackRequest(playFabEmitRequest, std::move(playFabEmitEventResponse));
+                    // a batch read back from the spool has no callbacks to call
+                    return;
                 }
+
+                auto playFabEmitEventResponse = std::make_shared<PlayFabEmitEventResponse>();
+                playFabEmitEventResponse->emitEventResult = EmitEventResult::Success;
+                playFabEmitEventResponse->playFabError = GetSuccessError();
+                playFabEmitEventResponse->writeEventsResponse = std::make_shared<EventsModels::WriteEventsResponse>(result);
+                playFabEmitEventResponse->batchNumber = static_cast<size_t>(reinterpret_cast<uintptr_t>(customData));
+                playFabEmitEventResponse->retryCount = details.retryCount;
+                CallbackBatch(std::move(batchWritten), playFabEmitEventResponse);
             }
             else
             {
@@ -417,22 +853,55 @@ namespace PlayFab
         try
         {
             std::vector<std::shared_ptr<const IPlayFabEmitEventRequest>> batchWritten;
-            if(TryGetBatchOutOfFlight(customData, &batchWritten))
+            BatchInFlight details;
+            if(TryGetBatchOutOfFlight(customData, &batchWritten, &details))
             {
-                auto requestBatchPtr = std::make_shared<std::vector<std::shared_ptr<const IPlayFabEmitEventRequest>>>(std::move(batchWritten));
-                // call individual emit event callbacks
-                for (const auto& eventEmitRequest : *requestBatchPtr)
+                const bool isTransient = IsTransientError(error);
+                bool isRetried = false;
+                { // LOCK batchesInFlight mutex
+                    std::unique_lock<std::mutex> lock(inFlightMutex);
+                    if (isTransient && !details.isFromSpool && details.retryCount < this->settings->maximalNumberOfRetries)
+                    {
+                        // retry after an exponential backoff, with jitter so that clients which failed together don't retry together
+                        const size_t backoffShift = std::min(details.retryCount, maximalRetryBackoffShift);
+                        const auto backoff = this->settings->retryWaitTime * (static_cast<int64_t>(1) << backoffShift);
+                        const auto jitter = std::chrono::milliseconds(static_cast<int64_t>(this->retryJitter() % (backoff.count() / 2 + 1)));
+
+                        RetryBatch retry;
+                        retry.events = std::move(batchWritten);
+                        retry.spoolRange = details.spoolRange;
+                        retry.retryCount = details.retryCount;
+                        retry.error = std::make_shared<PlayFabError>(error);
+                        this->retryQueue.emplace(std::chrono::steady_clock::now() + backoff - jitter, std::move(retry));
+                        isRetried = true;
+                    }
+                    else if (isTransient && details.spoolRange.count > 0)
+                    {
+                        // the spool keeps the events for later, even across runs
+                        this->spoolBacklog.push_back(details.spoolRange);
+                    }
+
+                    if (isTransient && this->spool != nullptr)
+                    {
+                        // hold the spool backlog back for a while
+                        this->spoolDrainResumeTime = std::chrono::steady_clock::now() + this->settings->GetMaximalBatchWaitTime();
+                    }
+                } // UNLOCK batchesInFlight
+
+                if (isRetried)
+                {
+                    // the worker thread sends the retry when it is due
+                    WakeUpWorkerThread();
+                    return;
+                }
+
+                if (!isTransient && details.spoolRange.count > 0)
                 {
-                    std::shared_ptr<const PlayFabEmitEventRequest> playFabEmitRequest = std::dynamic_pointer_cast<const PlayFabEmitEventRequest>(eventEmitRequest);
-                    auto playFabEmitEventResponse = std::shared_ptr<PlayFabEmitEventResponse>(new PlayFabEmitEventResponse());
-                    playFabEmitEventResponse->emitEventResult = EmitEventResult::Success;
-                    playFabEmitEventResponse->playFabError = std::shared_ptr<PlayFabError>(new PlayFabError(error));
-                    playFabEmitEventResponse->batch = requestBatchPtr;
-                    playFabEmitEventResponse->batchNumber = static_cast<size_t>(reinterpret_cast<uintptr_t>(customData));
-
-                    // call an emit event callback
-                    CallbackRequest(playFabEmitRequest, std::move(playFabEmitEventResponse));
+                    // the events would never be accepted
+                    this->spool->Release(details.spoolRange);
                 }
+
+                CallbackFailedBatch(std::move(batchWritten), std::make_shared<PlayFabError>(error), details.retryCount, customData);
             }
             else
             {
@@ -445,9 +914,48 @@ namespace PlayFab
         }
     }
 
-    void PlayFabEventPipeline::CallbackRequest(std::shared_ptr<const IPlayFabEmitEventRequest> request, std::shared_ptr<const IPlayFabEmitEventResponse> response)
+    void PlayFabEventPipeline::CallbackFailedBatch(std::vector<std::shared_ptr<const IPlayFabEmitEventRequest>>&& failedBatch, const std::shared_ptr<const PlayFabError>& error,
+        size_t retryCount, void* customData)
+    {
+        if (failedBatch.empty())
+        {
+            return;
+        }
+
+        auto playFabEmitEventResponse = std::make_shared<PlayFabEmitEventResponse>();
+        playFabEmitEventResponse->emitEventResult = EmitEventResult::Failed;
+        playFabEmitEventResponse->playFabError = error;
+        playFabEmitEventResponse->batchNumber = static_cast<size_t>(reinterpret_cast<uintptr_t>(customData));
+        playFabEmitEventResponse->retryCount = retryCount;
+        CallbackBatch(std::move(failedBatch), playFabEmitEventResponse);
+    }
+
+    void PlayFabEventPipeline::CallbackBatch(std::vector<std::shared_ptr<const IPlayFabEmitEventRequest>>&& completedBatch, const std::shared_ptr<PlayFabEmitEventResponse>& response)
+    {
+        // all events of the batch share its response
+        auto requestBatchPtr = std::make_shared<std::vector<std::shared_ptr<const IPlayFabEmitEventRequest>>>(std::move(completedBatch));
+        response->batch = requestBatchPtr;
+        const std::shared_ptr<const IPlayFabEmitEventResponse> sharedResponse = response;
+
+        if (this->settings->emitBatchCallback != nullptr)
+        {
+            this->settings->emitBatchCallback(*requestBatchPtr, response);
+        }
+
+        // call individual emit event callbacks
+        for (const auto& eventEmitRequest : *requestBatchPtr)
+        {
+            CallbackRequest(*eventEmitRequest, sharedResponse);
+        }
+    }
+
+    void PlayFabEventPipeline::CallbackRequest(const IPlayFabEmitEventRequest& request, const std::shared_ptr<const IPlayFabEmitEventResponse>& response)
     {
-        const auto& playFabEmitRequest = std::dynamic_pointer_cast<const PlayFabEmitEventRequest>(request);
+        const PlayFabEmitEventRequest* playFabEmitRequest = dynamic_cast<const PlayFabEmitEventRequest*>(&request);
+        if (playFabEmitRequest == nullptr)
+        {
+            return;
+        }
 
         if (playFabEmitRequest->callback != nullptr)
         {
@@ -460,7 +968,7 @@ namespace PlayFab
         }
     }
 
-    bool PlayFabEventPipeline::TryGetBatchOutOfFlight(void* customData, std::vector<std::shared_ptr<const IPlayFabEmitEventRequest>>* batchReturn)
+    bool PlayFabEventPipeline::TryGetBatchOutOfFlight(void* customData, std::vector<std::shared_ptr<const IPlayFabEmitEventRequest>>* batchReturn, BatchInFlight* detailsReturn)
     {
         // LOCK batchesInFlight mutex
         std::unique_lock<std::mutex> lock(inFlightMutex);
@@ -475,8 +983,28 @@ namespace PlayFab
 
         *batchReturn = std::move(iter->second);
         this->batchesInFlight.erase(iter);
-        return true;
+
+        auto details = this->batchesInFlightDetails.find(customData);
+        if (details != this->batchesInFlightDetails.end())
+        {
+            if (details->second.IsResent())
+            {
+                --this->resentBatchesInFlight;
+            }
+            else
+            {
+                // only the batches sent for the first time measure the send latency of the current load
+                this->batchController.OnBatchCompleted(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - details->second.sendTime));
+            }
+            *detailsReturn = details->second;
+            this->batchesInFlightDetails.erase(details);
+        }
+        lock.unlock();
         // UNLOCK batchesInFlight
+
+        // the worker thread may be waiting for a batch to leave flight
+        WakeUpWorkerThread();
+        return true;
     }
 }
 
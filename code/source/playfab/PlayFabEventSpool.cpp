@@ -0,0 +1,588 @@
+#include <stdafx.h>
+
+#ifndef DISABLE_PLAYFABENTITY_API
+
+#include <playfab/PlayFabEventSpool.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <vector>
+
+#if defined(PLAYFAB_PLATFORM_WINDOWS)
+#include <windows.h>
+#define PLAYFAB_EVENT_SPOOL_WIN32
+#elif defined(PLAYFAB_PLATFORM_LINUX) || defined(PLAYFAB_PLATFORM_ANDROID) || defined(PLAYFAB_PLATFORM_IOS)
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define PLAYFAB_EVENT_SPOOL_POSIX
+#endif
+
+namespace PlayFab
+{
+    namespace
+    {
+        // Segment file layout: a header (magic, version, the position of the first record and the released position as of the last
+        // release), then records of a length, a CRC-32 of the payload and the payload, aligned to 4 bytes. A length of 0 marks the end,
+        // as segment files are created zero-filled at their full size.
+        constexpr char segmentMagic[8] = { 'P', 'F', 'S', 'P', 'O', 'O', 'L', '1' };
+        constexpr uint32_t segmentVersion = 1;
+        constexpr size_t segmentVersionOffset = 8;
+        constexpr size_t segmentFirstPositionOffset = 16;
+        constexpr size_t segmentReleasedPositionOffset = 24;
+        constexpr size_t segmentHeaderSize = 64;
+        constexpr size_t recordHeaderSize = 8;
+        constexpr size_t recordAlignment = 4;
+        constexpr size_t minimalSegmentSize = 4096;
+
+        constexpr char segmentFilePrefix[] = "pfevents-";
+        constexpr char segmentFileSuffix[] = ".spool";
+        constexpr size_t segmentFileNameLength = sizeof(segmentFilePrefix) - 1 + 16 + sizeof(segmentFileSuffix) - 1; // the first position in 16 hex digits
+
+        size_t AlignRecord(size_t size)
+        {
+            return (size + recordAlignment - 1) & ~(recordAlignment - 1);
+        }
+
+        uint32_t ComputeCrc32(const char* data, size_t length)
+        {
+            static const std::vector<uint32_t> table = []()
+            {
+                std::vector<uint32_t> values(256);
+                for (uint32_t i = 0; i < 256; ++i)
+                {
+                    uint32_t value = i;
+                    for (int bit = 0; bit < 8; ++bit)
+                    {
+                        value = (value & 1) ? (0xEDB88320u ^ (value >> 1)) : (value >> 1);
+                    }
+                    values[i] = value;
+                }
+                return values;
+            }();
+
+            uint32_t crc = 0xFFFFFFFFu;
+            for (size_t i = 0; i < length; ++i)
+            {
+                crc = table[(crc ^ static_cast<uint8_t>(data[i])) & 0xFF] ^ (crc >> 8);
+            }
+            return crc ^ 0xFFFFFFFFu;
+        }
+
+        template<typename T> T ReadField(const char* data, size_t offset)
+        {
+            T value;
+            memcpy(&value, data + offset, sizeof(T));
+            return value;
+        }
+
+        template<typename T> void WriteField(char* data, size_t offset, T value)
+        {
+            memcpy(data + offset, &value, sizeof(T));
+        }
+
+        std::string GetSegmentFileName(uint64_t firstPosition)
+        {
+            char digits[17];
+            snprintf(digits, sizeof(digits), "%016llx", static_cast<unsigned long long>(firstPosition));
+            return std::string(segmentFilePrefix) + digits + segmentFileSuffix;
+        }
+
+        bool IsSegmentFileName(const std::string& name)
+        {
+            return name.length() == segmentFileNameLength &&
+                name.compare(0, sizeof(segmentFilePrefix) - 1, segmentFilePrefix) == 0 &&
+                name.compare(name.length() - (sizeof(segmentFileSuffix) - 1), std::string::npos, segmentFileSuffix) == 0;
+        }
+
+        // A memory-mapped segment file
+        struct MappedFile
+        {
+            char* data = nullptr;
+            size_t size = 0;
+#if defined(PLAYFAB_EVENT_SPOOL_WIN32)
+            HANDLE file = INVALID_HANDLE_VALUE;
+            HANDLE mapping = nullptr;
+#elif defined(PLAYFAB_EVENT_SPOOL_POSIX)
+            int descriptor = -1;
+#endif
+        };
+
+        void UnmapFile(MappedFile& mapped)
+        {
+#if defined(PLAYFAB_EVENT_SPOOL_WIN32)
+            if (mapped.data != nullptr)
+            {
+                UnmapViewOfFile(mapped.data);
+            }
+            if (mapped.mapping != nullptr)
+            {
+                CloseHandle(mapped.mapping);
+            }
+            if (mapped.file != INVALID_HANDLE_VALUE)
+            {
+                CloseHandle(mapped.file);
+            }
+#elif defined(PLAYFAB_EVENT_SPOOL_POSIX)
+            if (mapped.data != nullptr)
+            {
+                munmap(mapped.data, mapped.size);
+            }
+            if (mapped.descriptor != -1)
+            {
+                close(mapped.descriptor);
+            }
+#endif
+            mapped = MappedFile();
+        }
+
+        // Maps an existing file (createSize of 0), or creates a new zero-filled file of createSize bytes and maps it
+        bool MapFile(const std::string& path, size_t createSize, MappedFile& mapped)
+        {
+#if defined(PLAYFAB_EVENT_SPOOL_WIN32)
+            mapped.file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr,
+                createSize > 0 ? CREATE_NEW : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (mapped.file == INVALID_HANDLE_VALUE)
+            {
+                return false;
+            }
+
+            LARGE_INTEGER size;
+            if (createSize > 0)
+            {
+                size.QuadPart = static_cast<LONGLONG>(createSize);
+                if (!SetFilePointerEx(mapped.file, size, nullptr, FILE_BEGIN) || !SetEndOfFile(mapped.file))
+                {
+                    UnmapFile(mapped);
+                    return false;
+                }
+            }
+            else if (!GetFileSizeEx(mapped.file, &size) || size.QuadPart == 0)
+            {
+                UnmapFile(mapped);
+                return false;
+            }
+            mapped.size = static_cast<size_t>(size.QuadPart);
+
+            mapped.mapping = CreateFileMappingA(mapped.file, nullptr, PAGE_READWRITE, 0, 0, nullptr);
+            mapped.data = (mapped.mapping != nullptr) ? static_cast<char*>(MapViewOfFile(mapped.mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0)) : nullptr;
+            if (mapped.data == nullptr)
+            {
+                UnmapFile(mapped);
+                return false;
+            }
+            return true;
+#elif defined(PLAYFAB_EVENT_SPOOL_POSIX)
+            mapped.descriptor = open(path.c_str(), createSize > 0 ? (O_RDWR | O_CREAT | O_EXCL) : O_RDWR, 0600);
+            if (mapped.descriptor == -1)
+            {
+                return false;
+            }
+
+            if (createSize > 0)
+            {
+                if (ftruncate(mapped.descriptor, static_cast<off_t>(createSize)) != 0)
+                {
+                    UnmapFile(mapped);
+                    return false;
+                }
+                mapped.size = createSize;
+            }
+            else
+            {
+                struct stat status;
+                if (fstat(mapped.descriptor, &status) != 0 || status.st_size <= 0)
+                {
+                    UnmapFile(mapped);
+                    return false;
+                }
+                mapped.size = static_cast<size_t>(status.st_size);
+            }
+
+            void* data = mmap(nullptr, mapped.size, PROT_READ | PROT_WRITE, MAP_SHARED, mapped.descriptor, 0);
+            if (data == MAP_FAILED)
+            {
+                UnmapFile(mapped);
+                return false;
+            }
+            mapped.data = static_cast<char*>(data);
+            return true;
+#else
+            UNREFERENCED_PARAMETER(path);
+            UNREFERENCED_PARAMETER(createSize);
+            UNREFERENCED_PARAMETER(mapped);
+            return false;
+#endif
+        }
+
+        void FlushFile(const MappedFile& mapped, size_t offset, size_t length)
+        {
+#if defined(PLAYFAB_EVENT_SPOOL_WIN32)
+            FlushViewOfFile(mapped.data + offset, length);
+            FlushFileBuffers(mapped.file);
+#elif defined(PLAYFAB_EVENT_SPOOL_POSIX)
+            // msync needs a page-aligned start
+            const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+            const size_t alignedOffset = offset - offset % pageSize;
+            msync(mapped.data + alignedOffset, length + (offset - alignedOffset), MS_SYNC);
+#else
+            UNREFERENCED_PARAMETER(mapped);
+            UNREFERENCED_PARAMETER(offset);
+            UNREFERENCED_PARAMETER(length);
+#endif
+        }
+
+        bool MakeDirectory(const std::string& path)
+        {
+#if defined(PLAYFAB_EVENT_SPOOL_WIN32)
+            return CreateDirectoryA(path.c_str(), nullptr) || GetLastError() == ERROR_ALREADY_EXISTS;
+#elif defined(PLAYFAB_EVENT_SPOOL_POSIX)
+            return mkdir(path.c_str(), 0700) == 0 || errno == EEXIST;
+#else
+            UNREFERENCED_PARAMETER(path);
+            return false;
+#endif
+        }
+
+        // Lists the names of the segment files in a directory, in the order of their positions
+        std::vector<std::string> ListSegmentFiles(const std::string& path)
+        {
+            std::vector<std::string> names;
+#if defined(PLAYFAB_EVENT_SPOOL_WIN32)
+            WIN32_FIND_DATAA findData;
+            HANDLE find = FindFirstFileA((path + "/*").c_str(), &findData);
+            if (find != INVALID_HANDLE_VALUE)
+            {
+                do
+                {
+                    if (IsSegmentFileName(findData.cFileName))
+                    {
+                        names.push_back(findData.cFileName);
+                    }
+                } while (FindNextFileA(find, &findData));
+                FindClose(find);
+            }
+#elif defined(PLAYFAB_EVENT_SPOOL_POSIX)
+            DIR* directory = opendir(path.c_str());
+            if (directory != nullptr)
+            {
+                while (const dirent* entry = readdir(directory))
+                {
+                    if (IsSegmentFileName(entry->d_name))
+                    {
+                        names.push_back(entry->d_name);
+                    }
+                }
+                closedir(directory);
+            }
+#else
+            UNREFERENCED_PARAMETER(path);
+#endif
+            std::sort(names.begin(), names.end()); // fixed-width hex positions sort like the positions
+            return names;
+        }
+    }
+
+    struct PlayFabEventSpool::Segment
+    {
+        std::string path;
+        MappedFile file;
+        uint64_t firstPosition = 0;
+        std::vector<uint32_t> recordOffsets; // The offset of each record in the file
+        size_t writeOffset = segmentHeaderSize; // The offset the next record is written at
+        size_t syncedOffset = segmentHeaderSize; // The offset up to which the records were flushed
+        bool isSealed = false; // Whether records can no longer be appended
+
+        uint64_t GetEndPosition() const { return firstPosition + recordOffsets.size(); }
+    };
+
+    PlayFabEventSpool::PlayFabEventSpool(const std::string& directory, size_t segmentSize, size_t maximalSize, PlayFabEventSpoolSyncPolicy syncPolicy) :
+        directory(directory),
+        segmentSize(segmentSize < minimalSegmentSize ? minimalSegmentSize : segmentSize),
+        maximalSize(maximalSize),
+        syncPolicy(syncPolicy),
+        isOpen(false),
+        appendPosition(0),
+        releasedPosition(0),
+        sizeInBytes(0)
+    {
+    }
+
+    PlayFabEventSpool::~PlayFabEventSpool()
+    {
+        std::unique_lock<std::mutex> lock(spoolMutex);
+        const bool isAllReleased = releasedPosition >= appendPosition;
+        if (!isAllReleased)
+        {
+            WriteReleasedPosition();
+        }
+
+        for (auto& segment : segments)
+        {
+            if (syncPolicy != PlayFabEventSpoolSyncPolicy::None && !isAllReleased)
+            {
+                FlushFile(segment->file, 0, segment->writeOffset);
+            }
+            UnmapFile(segment->file);
+            if (isAllReleased)
+            {
+                std::remove(segment->path.c_str());
+            }
+        }
+    }
+
+    bool PlayFabEventSpool::Open(PlayFabEventSpoolRange& backlog)
+    {
+        std::unique_lock<std::mutex> lock(spoolMutex);
+        backlog = PlayFabEventSpoolRange();
+        if (isOpen || !MakeDirectory(directory))
+        {
+            return isOpen;
+        }
+
+        // recover the segments of earlier runs, up to their first torn or corrupted record
+        for (const std::string& name : ListSegmentFiles(directory))
+        {
+            std::unique_ptr<Segment> segment(new Segment());
+            segment->path = directory + "/" + name;
+            if (!MapFile(segment->path, 0, segment->file))
+            {
+                continue;
+            }
+
+            const char* data = segment->file.data;
+            const size_t size = segment->file.size;
+            if (size < segmentHeaderSize || memcmp(data, segmentMagic, sizeof(segmentMagic)) != 0 ||
+                ReadField<uint32_t>(data, segmentVersionOffset) != segmentVersion)
+            {
+                UnmapFile(segment->file);
+                continue;
+            }
+
+            segment->firstPosition = ReadField<uint64_t>(data, segmentFirstPositionOffset);
+            size_t offset = segmentHeaderSize;
+            while (offset + recordHeaderSize <= size)
+            {
+                const uint32_t length = ReadField<uint32_t>(data, offset);
+                if (length == 0 || length > size - offset - recordHeaderSize ||
+                    ReadField<uint32_t>(data, offset + 4) != ComputeCrc32(data + offset + recordHeaderSize, length))
+                {
+                    break;
+                }
+                segment->recordOffsets.push_back(static_cast<uint32_t>(offset));
+                offset = AlignRecord(offset + recordHeaderSize + length);
+            }
+            segment->writeOffset = offset;
+            segment->syncedOffset = offset;
+            segment->isSealed = true; // records are appended to new segments only
+
+            const uint64_t segmentReleasedPosition = ReadField<uint64_t>(data, segmentReleasedPositionOffset);
+            releasedPosition = (segmentReleasedPosition > releasedPosition) ? segmentReleasedPosition : releasedPosition;
+            if (segment->recordOffsets.empty() || (!segments.empty() && segment->firstPosition < segments.back()->GetEndPosition()))
+            {
+                // nothing to recover, or overlapping with the previous segment
+                UnmapFile(segment->file);
+                std::remove(segment->path.c_str());
+                continue;
+            }
+
+            appendPosition = segment->GetEndPosition();
+            sizeInBytes += size;
+            segments.push_back(std::move(segment));
+        }
+
+        if (!segments.empty() && releasedPosition < segments.front()->firstPosition)
+        {
+            releasedPosition = segments.front()->firstPosition;
+        }
+        if (releasedPosition > appendPosition)
+        {
+            releasedPosition = appendPosition;
+        }
+        DeleteReleasedSegments();
+
+        backlog.first = releasedPosition;
+        backlog.count = appendPosition - releasedPosition;
+        isOpen = true;
+        return true;
+    }
+
+    bool PlayFabEventSpool::Append(const std::string& record, uint64_t& position)
+    {
+        const size_t recordSize = AlignRecord(recordHeaderSize + record.length());
+
+        std::unique_lock<std::mutex> lock(spoolMutex);
+        if (!isOpen || record.empty() || segmentHeaderSize + recordSize > segmentSize)
+        {
+            return false;
+        }
+
+        Segment* segment = segments.empty() ? nullptr : segments.back().get();
+        if (segment == nullptr || segment->isSealed || segment->writeOffset + recordSize > segment->file.size)
+        {
+            if (segment != nullptr && !segment->isSealed)
+            {
+                SealSegment(*segment);
+            }
+            if (!StartSegment())
+            {
+                return false;
+            }
+            segment = segments.back().get();
+        }
+
+        // the length goes in last, as it marks the record as present
+        char* data = segment->file.data + segment->writeOffset;
+        memcpy(data + recordHeaderSize, record.data(), record.length());
+        WriteField<uint32_t>(data, 4, ComputeCrc32(record.data(), record.length()));
+        WriteField<uint32_t>(data, 0, static_cast<uint32_t>(record.length()));
+
+        segment->recordOffsets.push_back(static_cast<uint32_t>(segment->writeOffset));
+        segment->writeOffset += recordSize;
+        position = appendPosition++;
+        return true;
+    }
+
+    bool PlayFabEventSpool::Read(uint64_t position, std::string& record) const
+    {
+        std::unique_lock<std::mutex> lock(spoolMutex);
+        if (position < releasedPosition || position >= appendPosition)
+        {
+            return false;
+        }
+
+        auto released = releasedRanges.upper_bound(position);
+        if (released != releasedRanges.begin() && position < (--released)->second)
+        {
+            return false;
+        }
+
+        const Segment* segment = FindSegment(position);
+        if (segment == nullptr)
+        {
+            return false;
+        }
+
+        const size_t offset = segment->recordOffsets[static_cast<size_t>(position - segment->firstPosition)];
+        record.assign(segment->file.data + offset + recordHeaderSize, ReadField<uint32_t>(segment->file.data, offset));
+        return true;
+    }
+
+    void PlayFabEventSpool::Release(const PlayFabEventSpoolRange& range)
+    {
+        std::unique_lock<std::mutex> lock(spoolMutex);
+        const uint64_t first = (range.first > releasedPosition) ? range.first : releasedPosition;
+        const uint64_t end = range.first + range.count;
+        if (end <= first)
+        {
+            return;
+        }
+
+        uint64_t& releasedEnd = releasedRanges[first];
+        releasedEnd = (end > releasedEnd) ? end : releasedEnd;
+
+        // advance the released prefix over the ranges which now join it
+        while (!releasedRanges.empty() && releasedRanges.begin()->first <= releasedPosition)
+        {
+            releasedPosition = (releasedRanges.begin()->second > releasedPosition) ? releasedRanges.begin()->second : releasedPosition;
+            releasedRanges.erase(releasedRanges.begin());
+        }
+
+        DeleteReleasedSegments();
+        WriteReleasedPosition();
+    }
+
+    void PlayFabEventSpool::Sync()
+    {
+        std::unique_lock<std::mutex> lock(spoolMutex);
+        for (auto& segment : segments)
+        {
+            if (segment->syncedOffset < segment->writeOffset)
+            {
+                FlushFile(segment->file, segment->syncedOffset, segment->writeOffset - segment->syncedOffset);
+                segment->syncedOffset = segment->writeOffset;
+            }
+        }
+    }
+
+    uint64_t PlayFabEventSpool::GetSizeInBytes() const
+    {
+        std::unique_lock<std::mutex> lock(spoolMutex);
+        return sizeInBytes;
+    }
+
+    bool PlayFabEventSpool::StartSegment()
+    {
+        if (sizeInBytes + segmentSize > maximalSize)
+        {
+            return false;
+        }
+
+        std::unique_ptr<Segment> segment(new Segment());
+        segment->path = directory + "/" + GetSegmentFileName(appendPosition);
+        segment->firstPosition = appendPosition;
+        if (!MapFile(segment->path, segmentSize, segment->file))
+        {
+            return false;
+        }
+
+        char* data = segment->file.data;
+        memcpy(data, segmentMagic, sizeof(segmentMagic));
+        WriteField<uint32_t>(data, segmentVersionOffset, segmentVersion);
+        WriteField<uint64_t>(data, segmentFirstPositionOffset, segment->firstPosition);
+        WriteField<uint64_t>(data, segmentReleasedPositionOffset, releasedPosition);
+
+        sizeInBytes += segment->file.size;
+        segments.push_back(std::move(segment));
+        return true;
+    }
+
+    void PlayFabEventSpool::SealSegment(Segment& segment)
+    {
+        segment.isSealed = true;
+        if (syncPolicy != PlayFabEventSpoolSyncPolicy::None && segment.syncedOffset < segment.writeOffset)
+        {
+            FlushFile(segment.file, 0, segment.writeOffset);
+            segment.syncedOffset = segment.writeOffset;
+        }
+        DeleteReleasedSegments();
+    }
+
+    void PlayFabEventSpool::DeleteReleasedSegments()
+    {
+        while (!segments.empty() && segments.front()->isSealed && segments.front()->GetEndPosition() <= releasedPosition)
+        {
+            Segment& segment = *segments.front();
+            sizeInBytes -= segment.file.size;
+            UnmapFile(segment.file);
+            std::remove(segment.path.c_str());
+            segments.pop_front();
+        }
+    }
+
+    void PlayFabEventSpool::WriteReleasedPosition()
+    {
+        // the oldest segment keeps the released prefix for the next run
+        if (!segments.empty())
+        {
+            WriteField<uint64_t>(segments.front()->file.data, segmentReleasedPositionOffset, releasedPosition);
+        }
+    }
+
+    const PlayFabEventSpool::Segment* PlayFabEventSpool::FindSegment(uint64_t position) const
+    {
+        auto next = std::upper_bound(segments.begin(), segments.end(), position,
+            [](uint64_t value, const std::unique_ptr<Segment>& segment) { return value < segment->firstPosition; });
+        if (next == segments.begin())
+        {
+            return nullptr;
+        }
+
+        const Segment* segment = (--next)->get();
+        return (position < segment->GetEndPosition()) ? segment : nullptr;
+    }
+}
+
+#endif
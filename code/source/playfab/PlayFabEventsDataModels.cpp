@@ -0,0 +1,96 @@
+#include <stdafx.h>
+
+#if !defined(DISABLE_PLAYFABENTITY_API)
+
+#include <playfab/PlayFabEventsDataModels.h>
+
+namespace PlayFab
+{
+    namespace EventsModels
+    {
+        namespace
+        {
+            // The json field names of the models below
+            constexpr PlayFabJsonKey keyAssignedEventIds("AssignedEventIds");
+            constexpr PlayFabJsonKey keyCustomTags("CustomTags");
+            constexpr PlayFabJsonKey keyEntity("Entity");
+            constexpr PlayFabJsonKey keyEventNamespace("EventNamespace");
+            constexpr PlayFabJsonKey keyEvents("Events");
+            constexpr PlayFabJsonKey keyId("Id");
+            constexpr PlayFabJsonKey keyName("Name");
+            constexpr PlayFabJsonKey keyOriginalId("OriginalId");
+            constexpr PlayFabJsonKey keyOriginalTimestamp("OriginalTimestamp");
+            constexpr PlayFabJsonKey keyPayload("Payload");
+            constexpr PlayFabJsonKey keyPayloadJSON("PayloadJSON");
+            constexpr PlayFabJsonKey keyType("Type");
+        }
+
+        void EntityKey::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyId), Id);
+            FromJsonUtilS(FromJsonField(input, keyType), Type);
+        }
+
+        Json::Value EntityKey::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Id; ToJsonUtilS(Id, each_Id); ToJsonField(output, keyId) = each_Id;
+            Json::Value each_Type; ToJsonUtilS(Type, each_Type); ToJsonField(output, keyType) = each_Type;
+            return output;
+        }
+
+        void EventContents::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilS(FromJsonField(input, keyEventNamespace), EventNamespace);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilS(FromJsonField(input, keyOriginalId), OriginalId);
+            FromJsonUtilT(FromJsonField(input, keyOriginalTimestamp), OriginalTimestamp);
+            Payload = FromJsonField(input, keyPayload);
+            FromJsonUtilS(FromJsonField(input, keyPayloadJSON), PayloadJSON);
+        }
+
+        Json::Value EventContents::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_EventNamespace; ToJsonUtilS(EventNamespace, each_EventNamespace); ToJsonField(output, keyEventNamespace) = each_EventNamespace;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_OriginalId; ToJsonUtilS(OriginalId, each_OriginalId); ToJsonField(output, keyOriginalId) = each_OriginalId;
+            Json::Value each_OriginalTimestamp; ToJsonUtilT(OriginalTimestamp, each_OriginalTimestamp); ToJsonField(output, keyOriginalTimestamp) = each_OriginalTimestamp;
+            ToJsonField(output, keyPayload) = Payload;
+            Json::Value each_PayloadJSON; ToJsonUtilS(PayloadJSON, each_PayloadJSON); ToJsonField(output, keyPayloadJSON) = each_PayloadJSON;
+            return output;
+        }
+
+        void WriteEventsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEvents), Events);
+        }
+
+        Json::Value WriteEventsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Events; ToJsonUtilO(Events, each_Events); ToJsonField(output, keyEvents) = each_Events;
+            return output;
+        }
+
+        void WriteEventsResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAssignedEventIds), AssignedEventIds);
+        }
+
+        Json::Value WriteEventsResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AssignedEventIds; ToJsonUtilS(AssignedEventIds, each_AssignedEventIds); ToJsonField(output, keyAssignedEventIds) = each_AssignedEventIds;
+            return output;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,767 @@
+#include <stdafx.h>
+
+#if !defined(DISABLE_PLAYFABENTITY_API)
+
+#include <playfab/PlayFabExperimentationDataModels.h>
+
+namespace PlayFab
+{
+    namespace ExperimentationModels
+    {
+        namespace
+        {
+            // The json field names of the models below
+            constexpr PlayFabJsonKey keyConfidenceIntervalEnd("ConfidenceIntervalEnd");
+            constexpr PlayFabJsonKey keyConfidenceIntervalStart("ConfidenceIntervalStart");
+            constexpr PlayFabJsonKey keyCustomTags("CustomTags");
+            constexpr PlayFabJsonKey keyDateGenerated("DateGenerated");
+            constexpr PlayFabJsonKey keyDeltaAbsoluteChange("DeltaAbsoluteChange");
+            constexpr PlayFabJsonKey keyDeltaRelativeChange("DeltaRelativeChange");
+            constexpr PlayFabJsonKey keyDescription("Description");
+            constexpr PlayFabJsonKey keyDuration("Duration");
+            constexpr PlayFabJsonKey keyEndDate("EndDate");
+            constexpr PlayFabJsonKey keyEntity("Entity");
+            constexpr PlayFabJsonKey keyEventsProcessed("EventsProcessed");
+            constexpr PlayFabJsonKey keyExclusionGroupId("ExclusionGroupId");
+            constexpr PlayFabJsonKey keyExclusionGroupTrafficAllocation("ExclusionGroupTrafficAllocation");
+            constexpr PlayFabJsonKey keyExclusionGroups("ExclusionGroups");
+            constexpr PlayFabJsonKey keyExperimentId("ExperimentId");
+            constexpr PlayFabJsonKey keyExperimentName("ExperimentName");
+            constexpr PlayFabJsonKey keyExperimentType("ExperimentType");
+            constexpr PlayFabJsonKey keyExperiments("Experiments");
+            constexpr PlayFabJsonKey keyId("Id");
+            constexpr PlayFabJsonKey keyInternalName("InternalName");
+            constexpr PlayFabJsonKey keyIsControl("IsControl");
+            constexpr PlayFabJsonKey keyLatestJobStatus("LatestJobStatus");
+            constexpr PlayFabJsonKey keyMetricDataRows("MetricDataRows");
+            constexpr PlayFabJsonKey keyMovement("Movement");
+            constexpr PlayFabJsonKey keyName("Name");
+            constexpr PlayFabJsonKey keyPMove("PMove");
+            constexpr PlayFabJsonKey keyPValue("PValue");
+            constexpr PlayFabJsonKey keyPValueThreshold("PValueThreshold");
+            constexpr PlayFabJsonKey keyPlayerCount("PlayerCount");
+            constexpr PlayFabJsonKey keySampleRatioMismatch("SampleRatioMismatch");
+            constexpr PlayFabJsonKey keyScorecard("Scorecard");
+            constexpr PlayFabJsonKey keyScorecardDataRows("ScorecardDataRows");
+            constexpr PlayFabJsonKey keySegmentId("SegmentId");
+            constexpr PlayFabJsonKey keyStartDate("StartDate");
+            constexpr PlayFabJsonKey keyStatSigLevel("StatSigLevel");
+            constexpr PlayFabJsonKey keyState("State");
+            constexpr PlayFabJsonKey keyStdDev("StdDev");
+            constexpr PlayFabJsonKey keyTitleDataOverrideLabel("TitleDataOverrideLabel");
+            constexpr PlayFabJsonKey keyTitlePlayerAccountTestIds("TitlePlayerAccountTestIds");
+            constexpr PlayFabJsonKey keyTrafficAllocation("TrafficAllocation");
+            constexpr PlayFabJsonKey keyTrafficAllocations("TrafficAllocations");
+            constexpr PlayFabJsonKey keyTrafficPercentage("TrafficPercentage");
+            constexpr PlayFabJsonKey keyTreatmentAssignment("TreatmentAssignment");
+            constexpr PlayFabJsonKey keyType("Type");
+            constexpr PlayFabJsonKey keyValue("Value");
+            constexpr PlayFabJsonKey keyVariables("Variables");
+            constexpr PlayFabJsonKey keyVariantName("VariantName");
+            constexpr PlayFabJsonKey keyVariants("Variants");
+        }
+
+        void ToJsonEnum(const AnalysisTaskState input, Json::Value& output)
+        {
+            if (input == AnalysisTaskState::AnalysisTaskStateWaiting)
+            {
+                output = Json::Value(Json::StaticString("Waiting"));
+                return;
+            }
+            if (input == AnalysisTaskState::AnalysisTaskStateReadyForSubmission)
+            {
+                output = Json::Value(Json::StaticString("ReadyForSubmission"));
+                return;
+            }
+            if (input == AnalysisTaskState::AnalysisTaskStateSubmittingToPipeline)
+            {
+                output = Json::Value(Json::StaticString("SubmittingToPipeline"));
+                return;
+            }
+            if (input == AnalysisTaskState::AnalysisTaskStateRunning)
+            {
+                output = Json::Value(Json::StaticString("Running"));
+                return;
+            }
+            if (input == AnalysisTaskState::AnalysisTaskStateCompleted)
+            {
+                output = Json::Value(Json::StaticString("Completed"));
+                return;
+            }
+            if (input == AnalysisTaskState::AnalysisTaskStateFailed)
+            {
+                output = Json::Value(Json::StaticString("Failed"));
+                return;
+            }
+            if (input == AnalysisTaskState::AnalysisTaskStateCanceled)
+            {
+                output = Json::Value(Json::StaticString("Canceled"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, AnalysisTaskState& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Waiting")
+            {
+                output = AnalysisTaskState::AnalysisTaskStateWaiting;
+                return;
+            }
+            if (inputStr == "ReadyForSubmission")
+            {
+                output = AnalysisTaskState::AnalysisTaskStateReadyForSubmission;
+                return;
+            }
+            if (inputStr == "SubmittingToPipeline")
+            {
+                output = AnalysisTaskState::AnalysisTaskStateSubmittingToPipeline;
+                return;
+            }
+            if (inputStr == "Running")
+            {
+                output = AnalysisTaskState::AnalysisTaskStateRunning;
+                return;
+            }
+            if (inputStr == "Completed")
+            {
+                output = AnalysisTaskState::AnalysisTaskStateCompleted;
+                return;
+            }
+            if (inputStr == "Failed")
+            {
+                output = AnalysisTaskState::AnalysisTaskStateFailed;
+                return;
+            }
+            if (inputStr == "Canceled")
+            {
+                output = AnalysisTaskState::AnalysisTaskStateCanceled;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const ExperimentState input, Json::Value& output)
+        {
+            if (input == ExperimentState::ExperimentStateNew)
+            {
+                output = Json::Value(Json::StaticString("New"));
+                return;
+            }
+            if (input == ExperimentState::ExperimentStateStarted)
+            {
+                output = Json::Value(Json::StaticString("Started"));
+                return;
+            }
+            if (input == ExperimentState::ExperimentStateStopped)
+            {
+                output = Json::Value(Json::StaticString("Stopped"));
+                return;
+            }
+            if (input == ExperimentState::ExperimentStateDeleted)
+            {
+                output = Json::Value(Json::StaticString("Deleted"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, ExperimentState& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "New")
+            {
+                output = ExperimentState::ExperimentStateNew;
+                return;
+            }
+            if (inputStr == "Started")
+            {
+                output = ExperimentState::ExperimentStateStarted;
+                return;
+            }
+            if (inputStr == "Stopped")
+            {
+                output = ExperimentState::ExperimentStateStopped;
+                return;
+            }
+            if (inputStr == "Deleted")
+            {
+                output = ExperimentState::ExperimentStateDeleted;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const ExperimentType input, Json::Value& output)
+        {
+            if (input == ExperimentType::ExperimentTypeActive)
+            {
+                output = Json::Value(Json::StaticString("Active"));
+                return;
+            }
+            if (input == ExperimentType::ExperimentTypeSnapshot)
+            {
+                output = Json::Value(Json::StaticString("Snapshot"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, ExperimentType& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Active")
+            {
+                output = ExperimentType::ExperimentTypeActive;
+                return;
+            }
+            if (inputStr == "Snapshot")
+            {
+                output = ExperimentType::ExperimentTypeSnapshot;
+                return;
+            }
+        }
+
+        void CreateExclusionGroupRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyDescription), Description);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+        }
+
+        Json::Value CreateExclusionGroupRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Description; ToJsonUtilS(Description, each_Description); ToJsonField(output, keyDescription) = each_Description;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            return output;
+        }
+
+        void CreateExclusionGroupResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyExclusionGroupId), ExclusionGroupId);
+        }
+
+        Json::Value CreateExclusionGroupResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ExclusionGroupId; ToJsonUtilS(ExclusionGroupId, each_ExclusionGroupId); ToJsonField(output, keyExclusionGroupId) = each_ExclusionGroupId;
+            return output;
+        }
+
+        void Variable::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilS(FromJsonField(input, keyValue), Value);
+        }
+
+        Json::Value Variable::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_Value; ToJsonUtilS(Value, each_Value); ToJsonField(output, keyValue) = each_Value;
+            return output;
+        }
+
+        void Variant::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyDescription), Description);
+            FromJsonUtilS(FromJsonField(input, keyId), Id);
+            FromJsonUtilP(FromJsonField(input, keyIsControl), IsControl);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilS(FromJsonField(input, keyTitleDataOverrideLabel), TitleDataOverrideLabel);
+            FromJsonUtilP(FromJsonField(input, keyTrafficPercentage), TrafficPercentage);
+            FromJsonUtilO(FromJsonField(input, keyVariables), Variables);
+        }
+
+        Json::Value Variant::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Description; ToJsonUtilS(Description, each_Description); ToJsonField(output, keyDescription) = each_Description;
+            Json::Value each_Id; ToJsonUtilS(Id, each_Id); ToJsonField(output, keyId) = each_Id;
+            Json::Value each_IsControl; ToJsonUtilP(IsControl, each_IsControl); ToJsonField(output, keyIsControl) = each_IsControl;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_TitleDataOverrideLabel; ToJsonUtilS(TitleDataOverrideLabel, each_TitleDataOverrideLabel); ToJsonField(output, keyTitleDataOverrideLabel) = each_TitleDataOverrideLabel;
+            Json::Value each_TrafficPercentage; ToJsonUtilP(TrafficPercentage, each_TrafficPercentage); ToJsonField(output, keyTrafficPercentage) = each_TrafficPercentage;
+            Json::Value each_Variables; ToJsonUtilO(Variables, each_Variables); ToJsonField(output, keyVariables) = each_Variables;
+            return output;
+        }
+
+        void CreateExperimentRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyDescription), Description);
+            FromJsonUtilP(FromJsonField(input, keyDuration), Duration);
+            FromJsonUtilT(FromJsonField(input, keyEndDate), EndDate);
+            FromJsonUtilS(FromJsonField(input, keyExclusionGroupId), ExclusionGroupId);
+            FromJsonUtilP(FromJsonField(input, keyExclusionGroupTrafficAllocation), ExclusionGroupTrafficAllocation);
+            FromJsonUtilE(FromJsonField(input, keyExperimentType), pfExperimentType);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilS(FromJsonField(input, keySegmentId), SegmentId);
+            FromJsonUtilT(FromJsonField(input, keyStartDate), StartDate);
+            FromJsonUtilS(FromJsonField(input, keyTitlePlayerAccountTestIds), TitlePlayerAccountTestIds);
+            FromJsonUtilO(FromJsonField(input, keyVariants), Variants);
+        }
+
+        Json::Value CreateExperimentRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Description; ToJsonUtilS(Description, each_Description); ToJsonField(output, keyDescription) = each_Description;
+            Json::Value each_Duration; ToJsonUtilP(Duration, each_Duration); ToJsonField(output, keyDuration) = each_Duration;
+            Json::Value each_EndDate; ToJsonUtilT(EndDate, each_EndDate); ToJsonField(output, keyEndDate) = each_EndDate;
+            Json::Value each_ExclusionGroupId; ToJsonUtilS(ExclusionGroupId, each_ExclusionGroupId); ToJsonField(output, keyExclusionGroupId) = each_ExclusionGroupId;
+            Json::Value each_ExclusionGroupTrafficAllocation; ToJsonUtilP(ExclusionGroupTrafficAllocation, each_ExclusionGroupTrafficAllocation); ToJsonField(output, keyExclusionGroupTrafficAllocation) = each_ExclusionGroupTrafficAllocation;
+            Json::Value each_pfExperimentType; ToJsonUtilE(pfExperimentType, each_pfExperimentType); ToJsonField(output, keyExperimentType) = each_pfExperimentType;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_SegmentId; ToJsonUtilS(SegmentId, each_SegmentId); ToJsonField(output, keySegmentId) = each_SegmentId;
+            Json::Value each_StartDate; ToJsonUtilT(StartDate, each_StartDate); ToJsonField(output, keyStartDate) = each_StartDate;
+            Json::Value each_TitlePlayerAccountTestIds; ToJsonUtilS(TitlePlayerAccountTestIds, each_TitlePlayerAccountTestIds); ToJsonField(output, keyTitlePlayerAccountTestIds) = each_TitlePlayerAccountTestIds;
+            Json::Value each_Variants; ToJsonUtilO(Variants, each_Variants); ToJsonField(output, keyVariants) = each_Variants;
+            return output;
+        }
+
+        void CreateExperimentResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyExperimentId), ExperimentId);
+        }
+
+        Json::Value CreateExperimentResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ExperimentId; ToJsonUtilS(ExperimentId, each_ExperimentId); ToJsonField(output, keyExperimentId) = each_ExperimentId;
+            return output;
+        }
+
+        void DeleteExclusionGroupRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyExclusionGroupId), ExclusionGroupId);
+        }
+
+        Json::Value DeleteExclusionGroupRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ExclusionGroupId; ToJsonUtilS(ExclusionGroupId, each_ExclusionGroupId); ToJsonField(output, keyExclusionGroupId) = each_ExclusionGroupId;
+            return output;
+        }
+
+        void DeleteExperimentRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyExperimentId), ExperimentId);
+        }
+
+        Json::Value DeleteExperimentRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ExperimentId; ToJsonUtilS(ExperimentId, each_ExperimentId); ToJsonField(output, keyExperimentId) = each_ExperimentId;
+            return output;
+        }
+
+        void EmptyResponse::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value EmptyResponse::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void EntityKey::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyId), Id);
+            FromJsonUtilS(FromJsonField(input, keyType), Type);
+        }
+
+        Json::Value EntityKey::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Id; ToJsonUtilS(Id, each_Id); ToJsonField(output, keyId) = each_Id;
+            Json::Value each_Type; ToJsonUtilS(Type, each_Type); ToJsonField(output, keyType) = each_Type;
+            return output;
+        }
+
+        void ExclusionGroupTrafficAllocation::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyExperimentId), ExperimentId);
+            FromJsonUtilP(FromJsonField(input, keyTrafficAllocation), TrafficAllocation);
+        }
+
+        Json::Value ExclusionGroupTrafficAllocation::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ExperimentId; ToJsonUtilS(ExperimentId, each_ExperimentId); ToJsonField(output, keyExperimentId) = each_ExperimentId;
+            Json::Value each_TrafficAllocation; ToJsonUtilP(TrafficAllocation, each_TrafficAllocation); ToJsonField(output, keyTrafficAllocation) = each_TrafficAllocation;
+            return output;
+        }
+
+        void Experiment::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyDescription), Description);
+            FromJsonUtilP(FromJsonField(input, keyDuration), Duration);
+            FromJsonUtilT(FromJsonField(input, keyEndDate), EndDate);
+            FromJsonUtilS(FromJsonField(input, keyExclusionGroupId), ExclusionGroupId);
+            FromJsonUtilP(FromJsonField(input, keyExclusionGroupTrafficAllocation), ExclusionGroupTrafficAllocation);
+            FromJsonUtilE(FromJsonField(input, keyExperimentType), pfExperimentType);
+            FromJsonUtilS(FromJsonField(input, keyId), Id);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilS(FromJsonField(input, keySegmentId), SegmentId);
+            FromJsonUtilT(FromJsonField(input, keyStartDate), StartDate);
+            FromJsonUtilE(FromJsonField(input, keyState), State);
+            FromJsonUtilS(FromJsonField(input, keyTitlePlayerAccountTestIds), TitlePlayerAccountTestIds);
+            FromJsonUtilO(FromJsonField(input, keyVariants), Variants);
+        }
+
+        Json::Value Experiment::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Description; ToJsonUtilS(Description, each_Description); ToJsonField(output, keyDescription) = each_Description;
+            Json::Value each_Duration; ToJsonUtilP(Duration, each_Duration); ToJsonField(output, keyDuration) = each_Duration;
+            Json::Value each_EndDate; ToJsonUtilT(EndDate, each_EndDate); ToJsonField(output, keyEndDate) = each_EndDate;
+            Json::Value each_ExclusionGroupId; ToJsonUtilS(ExclusionGroupId, each_ExclusionGroupId); ToJsonField(output, keyExclusionGroupId) = each_ExclusionGroupId;
+            Json::Value each_ExclusionGroupTrafficAllocation; ToJsonUtilP(ExclusionGroupTrafficAllocation, each_ExclusionGroupTrafficAllocation); ToJsonField(output, keyExclusionGroupTrafficAllocation) = each_ExclusionGroupTrafficAllocation;
+            Json::Value each_pfExperimentType; ToJsonUtilE(pfExperimentType, each_pfExperimentType); ToJsonField(output, keyExperimentType) = each_pfExperimentType;
+            Json::Value each_Id; ToJsonUtilS(Id, each_Id); ToJsonField(output, keyId) = each_Id;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_SegmentId; ToJsonUtilS(SegmentId, each_SegmentId); ToJsonField(output, keySegmentId) = each_SegmentId;
+            Json::Value each_StartDate; ToJsonUtilT(StartDate, each_StartDate); ToJsonField(output, keyStartDate) = each_StartDate;
+            Json::Value each_State; ToJsonUtilE(State, each_State); ToJsonField(output, keyState) = each_State;
+            Json::Value each_TitlePlayerAccountTestIds; ToJsonUtilS(TitlePlayerAccountTestIds, each_TitlePlayerAccountTestIds); ToJsonField(output, keyTitlePlayerAccountTestIds) = each_TitlePlayerAccountTestIds;
+            Json::Value each_Variants; ToJsonUtilO(Variants, each_Variants); ToJsonField(output, keyVariants) = each_Variants;
+            return output;
+        }
+
+        void ExperimentExclusionGroup::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyDescription), Description);
+            FromJsonUtilS(FromJsonField(input, keyExclusionGroupId), ExclusionGroupId);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+        }
+
+        Json::Value ExperimentExclusionGroup::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Description; ToJsonUtilS(Description, each_Description); ToJsonField(output, keyDescription) = each_Description;
+            Json::Value each_ExclusionGroupId; ToJsonUtilS(ExclusionGroupId, each_ExclusionGroupId); ToJsonField(output, keyExclusionGroupId) = each_ExclusionGroupId;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            return output;
+        }
+
+        void GetExclusionGroupsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value GetExclusionGroupsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void GetExclusionGroupsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyExclusionGroups), ExclusionGroups);
+        }
+
+        Json::Value GetExclusionGroupsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ExclusionGroups; ToJsonUtilO(ExclusionGroups, each_ExclusionGroups); ToJsonField(output, keyExclusionGroups) = each_ExclusionGroups;
+            return output;
+        }
+
+        void GetExclusionGroupTrafficRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyExclusionGroupId), ExclusionGroupId);
+        }
+
+        Json::Value GetExclusionGroupTrafficRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ExclusionGroupId; ToJsonUtilS(ExclusionGroupId, each_ExclusionGroupId); ToJsonField(output, keyExclusionGroupId) = each_ExclusionGroupId;
+            return output;
+        }
+
+        void GetExclusionGroupTrafficResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyTrafficAllocations), TrafficAllocations);
+        }
+
+        Json::Value GetExclusionGroupTrafficResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_TrafficAllocations; ToJsonUtilO(TrafficAllocations, each_TrafficAllocations); ToJsonField(output, keyTrafficAllocations) = each_TrafficAllocations;
+            return output;
+        }
+
+        void GetExperimentsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value GetExperimentsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void GetExperimentsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyExperiments), Experiments);
+        }
+
+        Json::Value GetExperimentsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Experiments; ToJsonUtilO(Experiments, each_Experiments); ToJsonField(output, keyExperiments) = each_Experiments;
+            return output;
+        }
+
+        void GetLatestScorecardRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyExperimentId), ExperimentId);
+        }
+
+        Json::Value GetLatestScorecardRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ExperimentId; ToJsonUtilS(ExperimentId, each_ExperimentId); ToJsonField(output, keyExperimentId) = each_ExperimentId;
+            return output;
+        }
+
+        void MetricData::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyConfidenceIntervalEnd), ConfidenceIntervalEnd);
+            FromJsonUtilP(FromJsonField(input, keyConfidenceIntervalStart), ConfidenceIntervalStart);
+            FromJsonUtilP(FromJsonField(input, keyDeltaAbsoluteChange), DeltaAbsoluteChange);
+            FromJsonUtilP(FromJsonField(input, keyDeltaRelativeChange), DeltaRelativeChange);
+            FromJsonUtilS(FromJsonField(input, keyInternalName), InternalName);
+            FromJsonUtilS(FromJsonField(input, keyMovement), Movement);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilP(FromJsonField(input, keyPMove), PMove);
+            FromJsonUtilP(FromJsonField(input, keyPValue), PValue);
+            FromJsonUtilP(FromJsonField(input, keyPValueThreshold), PValueThreshold);
+            FromJsonUtilS(FromJsonField(input, keyStatSigLevel), StatSigLevel);
+            FromJsonUtilP(FromJsonField(input, keyStdDev), StdDev);
+            FromJsonUtilP(FromJsonField(input, keyValue), Value);
+        }
+
+        Json::Value MetricData::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ConfidenceIntervalEnd; ToJsonUtilP(ConfidenceIntervalEnd, each_ConfidenceIntervalEnd); ToJsonField(output, keyConfidenceIntervalEnd) = each_ConfidenceIntervalEnd;
+            Json::Value each_ConfidenceIntervalStart; ToJsonUtilP(ConfidenceIntervalStart, each_ConfidenceIntervalStart); ToJsonField(output, keyConfidenceIntervalStart) = each_ConfidenceIntervalStart;
+            Json::Value each_DeltaAbsoluteChange; ToJsonUtilP(DeltaAbsoluteChange, each_DeltaAbsoluteChange); ToJsonField(output, keyDeltaAbsoluteChange) = each_DeltaAbsoluteChange;
+            Json::Value each_DeltaRelativeChange; ToJsonUtilP(DeltaRelativeChange, each_DeltaRelativeChange); ToJsonField(output, keyDeltaRelativeChange) = each_DeltaRelativeChange;
+            Json::Value each_InternalName; ToJsonUtilS(InternalName, each_InternalName); ToJsonField(output, keyInternalName) = each_InternalName;
+            Json::Value each_Movement; ToJsonUtilS(Movement, each_Movement); ToJsonField(output, keyMovement) = each_Movement;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_PMove; ToJsonUtilP(PMove, each_PMove); ToJsonField(output, keyPMove) = each_PMove;
+            Json::Value each_PValue; ToJsonUtilP(PValue, each_PValue); ToJsonField(output, keyPValue) = each_PValue;
+            Json::Value each_PValueThreshold; ToJsonUtilP(PValueThreshold, each_PValueThreshold); ToJsonField(output, keyPValueThreshold) = each_PValueThreshold;
+            Json::Value each_StatSigLevel; ToJsonUtilS(StatSigLevel, each_StatSigLevel); ToJsonField(output, keyStatSigLevel) = each_StatSigLevel;
+            Json::Value each_StdDev; ToJsonUtilP(StdDev, each_StdDev); ToJsonField(output, keyStdDev) = each_StdDev;
+            Json::Value each_Value; ToJsonUtilP(Value, each_Value); ToJsonField(output, keyValue) = each_Value;
+            return output;
+        }
+
+        void ScorecardDataRow::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyIsControl), IsControl);
+            FromJsonUtilO(FromJsonField(input, keyMetricDataRows), MetricDataRows);
+            FromJsonUtilP(FromJsonField(input, keyPlayerCount), PlayerCount);
+            FromJsonUtilS(FromJsonField(input, keyVariantName), VariantName);
+        }
+
+        Json::Value ScorecardDataRow::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_IsControl; ToJsonUtilP(IsControl, each_IsControl); ToJsonField(output, keyIsControl) = each_IsControl;
+            Json::Value each_MetricDataRows; ToJsonUtilO(MetricDataRows, each_MetricDataRows); ToJsonField(output, keyMetricDataRows) = each_MetricDataRows;
+            Json::Value each_PlayerCount; ToJsonUtilP(PlayerCount, each_PlayerCount); ToJsonField(output, keyPlayerCount) = each_PlayerCount;
+            Json::Value each_VariantName; ToJsonUtilS(VariantName, each_VariantName); ToJsonField(output, keyVariantName) = each_VariantName;
+            return output;
+        }
+
+        void Scorecard::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyDateGenerated), DateGenerated);
+            FromJsonUtilS(FromJsonField(input, keyDuration), Duration);
+            FromJsonUtilP(FromJsonField(input, keyEventsProcessed), EventsProcessed);
+            FromJsonUtilS(FromJsonField(input, keyExperimentId), ExperimentId);
+            FromJsonUtilS(FromJsonField(input, keyExperimentName), ExperimentName);
+            FromJsonUtilE(FromJsonField(input, keyLatestJobStatus), LatestJobStatus);
+            FromJsonUtilP(FromJsonField(input, keySampleRatioMismatch), SampleRatioMismatch);
+            FromJsonUtilO(FromJsonField(input, keyScorecardDataRows), ScorecardDataRows);
+        }
+
+        Json::Value Scorecard::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_DateGenerated; ToJsonUtilS(DateGenerated, each_DateGenerated); ToJsonField(output, keyDateGenerated) = each_DateGenerated;
+            Json::Value each_Duration; ToJsonUtilS(Duration, each_Duration); ToJsonField(output, keyDuration) = each_Duration;
+            Json::Value each_EventsProcessed; ToJsonUtilP(EventsProcessed, each_EventsProcessed); ToJsonField(output, keyEventsProcessed) = each_EventsProcessed;
+            Json::Value each_ExperimentId; ToJsonUtilS(ExperimentId, each_ExperimentId); ToJsonField(output, keyExperimentId) = each_ExperimentId;
+            Json::Value each_ExperimentName; ToJsonUtilS(ExperimentName, each_ExperimentName); ToJsonField(output, keyExperimentName) = each_ExperimentName;
+            Json::Value each_LatestJobStatus; ToJsonUtilE(LatestJobStatus, each_LatestJobStatus); ToJsonField(output, keyLatestJobStatus) = each_LatestJobStatus;
+            Json::Value each_SampleRatioMismatch; ToJsonUtilP(SampleRatioMismatch, each_SampleRatioMismatch); ToJsonField(output, keySampleRatioMismatch) = each_SampleRatioMismatch;
+            Json::Value each_ScorecardDataRows; ToJsonUtilO(ScorecardDataRows, each_ScorecardDataRows); ToJsonField(output, keyScorecardDataRows) = each_ScorecardDataRows;
+            return output;
+        }
+
+        void GetLatestScorecardResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyScorecard), pfScorecard);
+        }
+
+        Json::Value GetLatestScorecardResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_pfScorecard; ToJsonUtilO(pfScorecard, each_pfScorecard); ToJsonField(output, keyScorecard) = each_pfScorecard;
+            return output;
+        }
+
+        void GetTreatmentAssignmentRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+        }
+
+        Json::Value GetTreatmentAssignmentRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            return output;
+        }
+
+        void TreatmentAssignment::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyVariables), Variables);
+            FromJsonUtilS(FromJsonField(input, keyVariants), Variants);
+        }
+
+        Json::Value TreatmentAssignment::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Variables; ToJsonUtilO(Variables, each_Variables); ToJsonField(output, keyVariables) = each_Variables;
+            Json::Value each_Variants; ToJsonUtilS(Variants, each_Variants); ToJsonField(output, keyVariants) = each_Variants;
+            return output;
+        }
+
+        void GetTreatmentAssignmentResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyTreatmentAssignment), pfTreatmentAssignment);
+        }
+
+        Json::Value GetTreatmentAssignmentResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_pfTreatmentAssignment; ToJsonUtilO(pfTreatmentAssignment, each_pfTreatmentAssignment); ToJsonField(output, keyTreatmentAssignment) = each_pfTreatmentAssignment;
+            return output;
+        }
+
+        void StartExperimentRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyExperimentId), ExperimentId);
+        }
+
+        Json::Value StartExperimentRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ExperimentId; ToJsonUtilS(ExperimentId, each_ExperimentId); ToJsonField(output, keyExperimentId) = each_ExperimentId;
+            return output;
+        }
+
+        void StopExperimentRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyExperimentId), ExperimentId);
+        }
+
+        Json::Value StopExperimentRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ExperimentId; ToJsonUtilS(ExperimentId, each_ExperimentId); ToJsonField(output, keyExperimentId) = each_ExperimentId;
+            return output;
+        }
+
+        void UpdateExclusionGroupRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyDescription), Description);
+            FromJsonUtilS(FromJsonField(input, keyExclusionGroupId), ExclusionGroupId);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+        }
+
+        Json::Value UpdateExclusionGroupRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Description; ToJsonUtilS(Description, each_Description); ToJsonField(output, keyDescription) = each_Description;
+            Json::Value each_ExclusionGroupId; ToJsonUtilS(ExclusionGroupId, each_ExclusionGroupId); ToJsonField(output, keyExclusionGroupId) = each_ExclusionGroupId;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            return output;
+        }
+
+        void UpdateExperimentRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyDescription), Description);
+            FromJsonUtilP(FromJsonField(input, keyDuration), Duration);
+            FromJsonUtilT(FromJsonField(input, keyEndDate), EndDate);
+            FromJsonUtilS(FromJsonField(input, keyExclusionGroupId), ExclusionGroupId);
+            FromJsonUtilP(FromJsonField(input, keyExclusionGroupTrafficAllocation), ExclusionGroupTrafficAllocation);
+            FromJsonUtilE(FromJsonField(input, keyExperimentType), pfExperimentType);
+            FromJsonUtilS(FromJsonField(input, keyId), Id);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilS(FromJsonField(input, keySegmentId), SegmentId);
+            FromJsonUtilT(FromJsonField(input, keyStartDate), StartDate);
+            FromJsonUtilS(FromJsonField(input, keyTitlePlayerAccountTestIds), TitlePlayerAccountTestIds);
+            FromJsonUtilO(FromJsonField(input, keyVariants), Variants);
+        }
+
+        Json::Value UpdateExperimentRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Description; ToJsonUtilS(Description, each_Description); ToJsonField(output, keyDescription) = each_Description;
+            Json::Value each_Duration; ToJsonUtilP(Duration, each_Duration); ToJsonField(output, keyDuration) = each_Duration;
+            Json::Value each_EndDate; ToJsonUtilT(EndDate, each_EndDate); ToJsonField(output, keyEndDate) = each_EndDate;
+            Json::Value each_ExclusionGroupId; ToJsonUtilS(ExclusionGroupId, each_ExclusionGroupId); ToJsonField(output, keyExclusionGroupId) = each_ExclusionGroupId;
+            Json::Value each_ExclusionGroupTrafficAllocation; ToJsonUtilP(ExclusionGroupTrafficAllocation, each_ExclusionGroupTrafficAllocation); ToJsonField(output, keyExclusionGroupTrafficAllocation) = each_ExclusionGroupTrafficAllocation;
+            Json::Value each_pfExperimentType; ToJsonUtilE(pfExperimentType, each_pfExperimentType); ToJsonField(output, keyExperimentType) = each_pfExperimentType;
+            Json::Value each_Id; ToJsonUtilS(Id, each_Id); ToJsonField(output, keyId) = each_Id;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_SegmentId; ToJsonUtilS(SegmentId, each_SegmentId); ToJsonField(output, keySegmentId) = each_SegmentId;
+            Json::Value each_StartDate; ToJsonUtilT(StartDate, each_StartDate); ToJsonField(output, keyStartDate) = each_StartDate;
+            Json::Value each_TitlePlayerAccountTestIds; ToJsonUtilS(TitlePlayerAccountTestIds, each_TitlePlayerAccountTestIds); ToJsonField(output, keyTitlePlayerAccountTestIds) = each_TitlePlayerAccountTestIds;
+            Json::Value each_Variants; ToJsonUtilO(Variants, each_Variants); ToJsonField(output, keyVariants) = each_Variants;
+            return output;
+        }
+    }
+}
+
+#endif
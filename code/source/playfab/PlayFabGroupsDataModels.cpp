@@ -0,0 +1,870 @@
+#include <stdafx.h>
+
+#if !defined(DISABLE_PLAYFABENTITY_API)
+
+#include <playfab/PlayFabGroupsDataModels.h>
+
+namespace PlayFab
+{
+    namespace GroupsModels
+    {
+        namespace
+        {
+            // The json field names of the models below
+            constexpr PlayFabJsonKey keyAdminRoleId("AdminRoleId");
+            constexpr PlayFabJsonKey keyApplications("Applications");
+            constexpr PlayFabJsonKey keyAutoAcceptOutstandingApplication("AutoAcceptOutstandingApplication");
+            constexpr PlayFabJsonKey keyAutoAcceptOutstandingInvite("AutoAcceptOutstandingInvite");
+            constexpr PlayFabJsonKey keyBlockedEntities("BlockedEntities");
+            constexpr PlayFabJsonKey keyCreated("Created");
+            constexpr PlayFabJsonKey keyCustomTags("CustomTags");
+            constexpr PlayFabJsonKey keyDestinationRoleId("DestinationRoleId");
+            constexpr PlayFabJsonKey keyEntity("Entity");
+            constexpr PlayFabJsonKey keyExpectedProfileVersion("ExpectedProfileVersion");
+            constexpr PlayFabJsonKey keyExpires("Expires");
+            constexpr PlayFabJsonKey keyGroup("Group");
+            constexpr PlayFabJsonKey keyGroupName("GroupName");
+            constexpr PlayFabJsonKey keyGroups("Groups");
+            constexpr PlayFabJsonKey keyId("Id");
+            constexpr PlayFabJsonKey keyInvitations("Invitations");
+            constexpr PlayFabJsonKey keyInvitedByEntity("InvitedByEntity");
+            constexpr PlayFabJsonKey keyInvitedEntity("InvitedEntity");
+            constexpr PlayFabJsonKey keyIsMember("IsMember");
+            constexpr PlayFabJsonKey keyKey("Key");
+            constexpr PlayFabJsonKey keyLineage("Lineage");
+            constexpr PlayFabJsonKey keyMemberRoleId("MemberRoleId");
+            constexpr PlayFabJsonKey keyMembers("Members");
+            constexpr PlayFabJsonKey keyOperationReason("OperationReason");
+            constexpr PlayFabJsonKey keyOriginRoleId("OriginRoleId");
+            constexpr PlayFabJsonKey keyProfileVersion("ProfileVersion");
+            constexpr PlayFabJsonKey keyRoleId("RoleId");
+            constexpr PlayFabJsonKey keyRoleName("RoleName");
+            constexpr PlayFabJsonKey keyRoles("Roles");
+            constexpr PlayFabJsonKey keySetResult("SetResult");
+            constexpr PlayFabJsonKey keyType("Type");
+        }
+
+        void ToJsonEnum(const OperationTypes input, Json::Value& output)
+        {
+            if (input == OperationTypes::OperationTypesCreated)
+            {
+                output = Json::Value(Json::StaticString("Created"));
+                return;
+            }
+            if (input == OperationTypes::OperationTypesUpdated)
+            {
+                output = Json::Value(Json::StaticString("Updated"));
+                return;
+            }
+            if (input == OperationTypes::OperationTypesDeleted)
+            {
+                output = Json::Value(Json::StaticString("Deleted"));
+                return;
+            }
+            if (input == OperationTypes::OperationTypesNone)
+            {
+                output = Json::Value(Json::StaticString("None"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, OperationTypes& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Created")
+            {
+                output = OperationTypes::OperationTypesCreated;
+                return;
+            }
+            if (inputStr == "Updated")
+            {
+                output = OperationTypes::OperationTypesUpdated;
+                return;
+            }
+            if (inputStr == "Deleted")
+            {
+                output = OperationTypes::OperationTypesDeleted;
+                return;
+            }
+            if (inputStr == "None")
+            {
+                output = OperationTypes::OperationTypesNone;
+                return;
+            }
+        }
+
+        void EntityKey::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyId), Id);
+            FromJsonUtilS(FromJsonField(input, keyType), Type);
+        }
+
+        Json::Value EntityKey::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Id; ToJsonUtilS(Id, each_Id); ToJsonField(output, keyId) = each_Id;
+            Json::Value each_Type; ToJsonUtilS(Type, each_Type); ToJsonField(output, keyType) = each_Type;
+            return output;
+        }
+
+        void AcceptGroupApplicationRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilO(FromJsonField(input, keyGroup), Group);
+        }
+
+        Json::Value AcceptGroupApplicationRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_Group; ToJsonUtilO(Group, each_Group); ToJsonField(output, keyGroup) = each_Group;
+            return output;
+        }
+
+        void AcceptGroupInvitationRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilO(FromJsonField(input, keyGroup), Group);
+        }
+
+        Json::Value AcceptGroupInvitationRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_Group; ToJsonUtilO(Group, each_Group); ToJsonField(output, keyGroup) = each_Group;
+            return output;
+        }
+
+        void AddMembersRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyGroup), Group);
+            FromJsonUtilO(FromJsonField(input, keyMembers), Members);
+            FromJsonUtilS(FromJsonField(input, keyRoleId), RoleId);
+        }
+
+        Json::Value AddMembersRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Group; ToJsonUtilO(Group, each_Group); ToJsonField(output, keyGroup) = each_Group;
+            Json::Value each_Members; ToJsonUtilO(Members, each_Members); ToJsonField(output, keyMembers) = each_Members;
+            Json::Value each_RoleId; ToJsonUtilS(RoleId, each_RoleId); ToJsonField(output, keyRoleId) = each_RoleId;
+            return output;
+        }
+
+        void ApplyToGroupRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyAutoAcceptOutstandingInvite), AutoAcceptOutstandingInvite);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilO(FromJsonField(input, keyGroup), Group);
+        }
+
+        Json::Value ApplyToGroupRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AutoAcceptOutstandingInvite; ToJsonUtilP(AutoAcceptOutstandingInvite, each_AutoAcceptOutstandingInvite); ToJsonField(output, keyAutoAcceptOutstandingInvite) = each_AutoAcceptOutstandingInvite;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_Group; ToJsonUtilO(Group, each_Group); ToJsonField(output, keyGroup) = each_Group;
+            return output;
+        }
+
+        void EntityWithLineage::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyKey), Key);
+            FromJsonUtilO(FromJsonField(input, keyLineage), Lineage);
+        }
+
+        Json::Value EntityWithLineage::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Key; ToJsonUtilO(Key, each_Key); ToJsonField(output, keyKey) = each_Key;
+            Json::Value each_Lineage; ToJsonUtilO(Lineage, each_Lineage); ToJsonField(output, keyLineage) = each_Lineage;
+            return output;
+        }
+
+        void ApplyToGroupResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilT(FromJsonField(input, keyExpires), Expires);
+            FromJsonUtilO(FromJsonField(input, keyGroup), Group);
+        }
+
+        Json::Value ApplyToGroupResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_Expires; ToJsonUtilT(Expires, each_Expires); ToJsonField(output, keyExpires) = each_Expires;
+            Json::Value each_Group; ToJsonUtilO(Group, each_Group); ToJsonField(output, keyGroup) = each_Group;
+            return output;
+        }
+
+        void BlockEntityRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilO(FromJsonField(input, keyGroup), Group);
+        }
+
+        Json::Value BlockEntityRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_Group; ToJsonUtilO(Group, each_Group); ToJsonField(output, keyGroup) = each_Group;
+            return output;
+        }
+
+        void ChangeMemberRoleRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyDestinationRoleId), DestinationRoleId);
+            FromJsonUtilO(FromJsonField(input, keyGroup), Group);
+            FromJsonUtilO(FromJsonField(input, keyMembers), Members);
+            FromJsonUtilS(FromJsonField(input, keyOriginRoleId), OriginRoleId);
+        }
+
+        Json::Value ChangeMemberRoleRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_DestinationRoleId; ToJsonUtilS(DestinationRoleId, each_DestinationRoleId); ToJsonField(output, keyDestinationRoleId) = each_DestinationRoleId;
+            Json::Value each_Group; ToJsonUtilO(Group, each_Group); ToJsonField(output, keyGroup) = each_Group;
+            Json::Value each_Members; ToJsonUtilO(Members, each_Members); ToJsonField(output, keyMembers) = each_Members;
+            Json::Value each_OriginRoleId; ToJsonUtilS(OriginRoleId, each_OriginRoleId); ToJsonField(output, keyOriginRoleId) = each_OriginRoleId;
+            return output;
+        }
+
+        void CreateGroupRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilS(FromJsonField(input, keyGroupName), GroupName);
+        }
+
+        Json::Value CreateGroupRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_GroupName; ToJsonUtilS(GroupName, each_GroupName); ToJsonField(output, keyGroupName) = each_GroupName;
+            return output;
+        }
+
+        void CreateGroupResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAdminRoleId), AdminRoleId);
+            FromJsonUtilT(FromJsonField(input, keyCreated), Created);
+            FromJsonUtilO(FromJsonField(input, keyGroup), Group);
+            FromJsonUtilS(FromJsonField(input, keyGroupName), GroupName);
+            FromJsonUtilS(FromJsonField(input, keyMemberRoleId), MemberRoleId);
+            FromJsonUtilP(FromJsonField(input, keyProfileVersion), ProfileVersion);
+            FromJsonUtilS(FromJsonField(input, keyRoles), Roles);
+        }
+
+        Json::Value CreateGroupResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AdminRoleId; ToJsonUtilS(AdminRoleId, each_AdminRoleId); ToJsonField(output, keyAdminRoleId) = each_AdminRoleId;
+            Json::Value each_Created; ToJsonUtilT(Created, each_Created); ToJsonField(output, keyCreated) = each_Created;
+            Json::Value each_Group; ToJsonUtilO(Group, each_Group); ToJsonField(output, keyGroup) = each_Group;
+            Json::Value each_GroupName; ToJsonUtilS(GroupName, each_GroupName); ToJsonField(output, keyGroupName) = each_GroupName;
+            Json::Value each_MemberRoleId; ToJsonUtilS(MemberRoleId, each_MemberRoleId); ToJsonField(output, keyMemberRoleId) = each_MemberRoleId;
+            Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); ToJsonField(output, keyProfileVersion) = each_ProfileVersion;
+            Json::Value each_Roles; ToJsonUtilS(Roles, each_Roles); ToJsonField(output, keyRoles) = each_Roles;
+            return output;
+        }
+
+        void CreateGroupRoleRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyGroup), Group);
+            FromJsonUtilS(FromJsonField(input, keyRoleId), RoleId);
+            FromJsonUtilS(FromJsonField(input, keyRoleName), RoleName);
+        }
+
+        Json::Value CreateGroupRoleRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Group; ToJsonUtilO(Group, each_Group); ToJsonField(output, keyGroup) = each_Group;
+            Json::Value each_RoleId; ToJsonUtilS(RoleId, each_RoleId); ToJsonField(output, keyRoleId) = each_RoleId;
+            Json::Value each_RoleName; ToJsonUtilS(RoleName, each_RoleName); ToJsonField(output, keyRoleName) = each_RoleName;
+            return output;
+        }
+
+        void CreateGroupRoleResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyProfileVersion), ProfileVersion);
+            FromJsonUtilS(FromJsonField(input, keyRoleId), RoleId);
+            FromJsonUtilS(FromJsonField(input, keyRoleName), RoleName);
+        }
+
+        Json::Value CreateGroupRoleResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); ToJsonField(output, keyProfileVersion) = each_ProfileVersion;
+            Json::Value each_RoleId; ToJsonUtilS(RoleId, each_RoleId); ToJsonField(output, keyRoleId) = each_RoleId;
+            Json::Value each_RoleName; ToJsonUtilS(RoleName, each_RoleName); ToJsonField(output, keyRoleName) = each_RoleName;
+            return output;
+        }
+
+        void DeleteGroupRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyGroup), Group);
+        }
+
+        Json::Value DeleteGroupRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Group; ToJsonUtilO(Group, each_Group); ToJsonField(output, keyGroup) = each_Group;
+            return output;
+        }
+
+        void DeleteRoleRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyGroup), Group);
+            FromJsonUtilS(FromJsonField(input, keyRoleId), RoleId);
+        }
+
+        Json::Value DeleteRoleRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Group; ToJsonUtilO(Group, each_Group); ToJsonField(output, keyGroup) = each_Group;
+            Json::Value each_RoleId; ToJsonUtilS(RoleId, each_RoleId); ToJsonField(output, keyRoleId) = each_RoleId;
+            return output;
+        }
+
+        void EmptyResponse::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value EmptyResponse::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void EntityMemberRole::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyMembers), Members);
+            FromJsonUtilS(FromJsonField(input, keyRoleId), RoleId);
+            FromJsonUtilS(FromJsonField(input, keyRoleName), RoleName);
+        }
+
+        Json::Value EntityMemberRole::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Members; ToJsonUtilO(Members, each_Members); ToJsonField(output, keyMembers) = each_Members;
+            Json::Value each_RoleId; ToJsonUtilS(RoleId, each_RoleId); ToJsonField(output, keyRoleId) = each_RoleId;
+            Json::Value each_RoleName; ToJsonUtilS(RoleName, each_RoleName); ToJsonField(output, keyRoleName) = each_RoleName;
+            return output;
+        }
+
+        void GetGroupRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyGroup), Group);
+            FromJsonUtilS(FromJsonField(input, keyGroupName), GroupName);
+        }
+
+        Json::Value GetGroupRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Group; ToJsonUtilO(Group, each_Group); ToJsonField(output, keyGroup) = each_Group;
+            Json::Value each_GroupName; ToJsonUtilS(GroupName, each_GroupName); ToJsonField(output, keyGroupName) = each_GroupName;
+            return output;
+        }
+
+        void GetGroupResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAdminRoleId), AdminRoleId);
+            FromJsonUtilT(FromJsonField(input, keyCreated), Created);
+            FromJsonUtilO(FromJsonField(input, keyGroup), Group);
+            FromJsonUtilS(FromJsonField(input, keyGroupName), GroupName);
+            FromJsonUtilS(FromJsonField(input, keyMemberRoleId), MemberRoleId);
+            FromJsonUtilP(FromJsonField(input, keyProfileVersion), ProfileVersion);
+            FromJsonUtilS(FromJsonField(input, keyRoles), Roles);
+        }
+
+        Json::Value GetGroupResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AdminRoleId; ToJsonUtilS(AdminRoleId, each_AdminRoleId); ToJsonField(output, keyAdminRoleId) = each_AdminRoleId;
+            Json::Value each_Created; ToJsonUtilT(Created, each_Created); ToJsonField(output, keyCreated) = each_Created;
+            Json::Value each_Group; ToJsonUtilO(Group, each_Group); ToJsonField(output, keyGroup) = each_Group;
+            Json::Value each_GroupName; ToJsonUtilS(GroupName, each_GroupName); ToJsonField(output, keyGroupName) = each_GroupName;
+            Json::Value each_MemberRoleId; ToJsonUtilS(MemberRoleId, each_MemberRoleId); ToJsonField(output, keyMemberRoleId) = each_MemberRoleId;
+            Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); ToJsonField(output, keyProfileVersion) = each_ProfileVersion;
+            Json::Value each_Roles; ToJsonUtilS(Roles, each_Roles); ToJsonField(output, keyRoles) = each_Roles;
+            return output;
+        }
+
+        void GroupApplication::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilT(FromJsonField(input, keyExpires), Expires);
+            FromJsonUtilO(FromJsonField(input, keyGroup), Group);
+        }
+
+        Json::Value GroupApplication::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_Expires; ToJsonUtilT(Expires, each_Expires); ToJsonField(output, keyExpires) = each_Expires;
+            Json::Value each_Group; ToJsonUtilO(Group, each_Group); ToJsonField(output, keyGroup) = each_Group;
+            return output;
+        }
+
+        void GroupBlock::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilO(FromJsonField(input, keyGroup), Group);
+        }
+
+        Json::Value GroupBlock::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_Group; ToJsonUtilO(Group, each_Group); ToJsonField(output, keyGroup) = each_Group;
+            return output;
+        }
+
+        void GroupInvitation::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilT(FromJsonField(input, keyExpires), Expires);
+            FromJsonUtilO(FromJsonField(input, keyGroup), Group);
+            FromJsonUtilO(FromJsonField(input, keyInvitedByEntity), InvitedByEntity);
+            FromJsonUtilO(FromJsonField(input, keyInvitedEntity), InvitedEntity);
+            FromJsonUtilS(FromJsonField(input, keyRoleId), RoleId);
+        }
+
+        Json::Value GroupInvitation::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Expires; ToJsonUtilT(Expires, each_Expires); ToJsonField(output, keyExpires) = each_Expires;
+            Json::Value each_Group; ToJsonUtilO(Group, each_Group); ToJsonField(output, keyGroup) = each_Group;
+            Json::Value each_InvitedByEntity; ToJsonUtilO(InvitedByEntity, each_InvitedByEntity); ToJsonField(output, keyInvitedByEntity) = each_InvitedByEntity;
+            Json::Value each_InvitedEntity; ToJsonUtilO(InvitedEntity, each_InvitedEntity); ToJsonField(output, keyInvitedEntity) = each_InvitedEntity;
+            Json::Value each_RoleId; ToJsonUtilS(RoleId, each_RoleId); ToJsonField(output, keyRoleId) = each_RoleId;
+            return output;
+        }
+
+        void GroupRole::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyRoleId), RoleId);
+            FromJsonUtilS(FromJsonField(input, keyRoleName), RoleName);
+        }
+
+        Json::Value GroupRole::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_RoleId; ToJsonUtilS(RoleId, each_RoleId); ToJsonField(output, keyRoleId) = each_RoleId;
+            Json::Value each_RoleName; ToJsonUtilS(RoleName, each_RoleName); ToJsonField(output, keyRoleName) = each_RoleName;
+            return output;
+        }
+
+        void GroupWithRoles::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyGroup), Group);
+            FromJsonUtilS(FromJsonField(input, keyGroupName), GroupName);
+            FromJsonUtilP(FromJsonField(input, keyProfileVersion), ProfileVersion);
+            FromJsonUtilO(FromJsonField(input, keyRoles), Roles);
+        }
+
+        Json::Value GroupWithRoles::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Group; ToJsonUtilO(Group, each_Group); ToJsonField(output, keyGroup) = each_Group;
+            Json::Value each_GroupName; ToJsonUtilS(GroupName, each_GroupName); ToJsonField(output, keyGroupName) = each_GroupName;
+            Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); ToJsonField(output, keyProfileVersion) = each_ProfileVersion;
+            Json::Value each_Roles; ToJsonUtilO(Roles, each_Roles); ToJsonField(output, keyRoles) = each_Roles;
+            return output;
+        }
+
+        void InviteToGroupRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyAutoAcceptOutstandingApplication), AutoAcceptOutstandingApplication);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilO(FromJsonField(input, keyGroup), Group);
+            FromJsonUtilS(FromJsonField(input, keyRoleId), RoleId);
+        }
+
+        Json::Value InviteToGroupRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AutoAcceptOutstandingApplication; ToJsonUtilP(AutoAcceptOutstandingApplication, each_AutoAcceptOutstandingApplication); ToJsonField(output, keyAutoAcceptOutstandingApplication) = each_AutoAcceptOutstandingApplication;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_Group; ToJsonUtilO(Group, each_Group); ToJsonField(output, keyGroup) = each_Group;
+            Json::Value each_RoleId; ToJsonUtilS(RoleId, each_RoleId); ToJsonField(output, keyRoleId) = each_RoleId;
+            return output;
+        }
+
+        void InviteToGroupResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilT(FromJsonField(input, keyExpires), Expires);
+            FromJsonUtilO(FromJsonField(input, keyGroup), Group);
+            FromJsonUtilO(FromJsonField(input, keyInvitedByEntity), InvitedByEntity);
+            FromJsonUtilO(FromJsonField(input, keyInvitedEntity), InvitedEntity);
+            FromJsonUtilS(FromJsonField(input, keyRoleId), RoleId);
+        }
+
+        Json::Value InviteToGroupResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Expires; ToJsonUtilT(Expires, each_Expires); ToJsonField(output, keyExpires) = each_Expires;
+            Json::Value each_Group; ToJsonUtilO(Group, each_Group); ToJsonField(output, keyGroup) = each_Group;
+            Json::Value each_InvitedByEntity; ToJsonUtilO(InvitedByEntity, each_InvitedByEntity); ToJsonField(output, keyInvitedByEntity) = each_InvitedByEntity;
+            Json::Value each_InvitedEntity; ToJsonUtilO(InvitedEntity, each_InvitedEntity); ToJsonField(output, keyInvitedEntity) = each_InvitedEntity;
+            Json::Value each_RoleId; ToJsonUtilS(RoleId, each_RoleId); ToJsonField(output, keyRoleId) = each_RoleId;
+            return output;
+        }
+
+        void IsMemberRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilO(FromJsonField(input, keyGroup), Group);
+            FromJsonUtilS(FromJsonField(input, keyRoleId), RoleId);
+        }
+
+        Json::Value IsMemberRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_Group; ToJsonUtilO(Group, each_Group); ToJsonField(output, keyGroup) = each_Group;
+            Json::Value each_RoleId; ToJsonUtilS(RoleId, each_RoleId); ToJsonField(output, keyRoleId) = each_RoleId;
+            return output;
+        }
+
+        void IsMemberResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyIsMember), IsMember);
+        }
+
+        Json::Value IsMemberResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_IsMember; ToJsonUtilP(IsMember, each_IsMember); ToJsonField(output, keyIsMember) = each_IsMember;
+            return output;
+        }
+
+        void ListGroupApplicationsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyGroup), Group);
+        }
+
+        Json::Value ListGroupApplicationsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Group; ToJsonUtilO(Group, each_Group); ToJsonField(output, keyGroup) = each_Group;
+            return output;
+        }
+
+        void ListGroupApplicationsResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyApplications), Applications);
+        }
+
+        Json::Value ListGroupApplicationsResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Applications; ToJsonUtilO(Applications, each_Applications); ToJsonField(output, keyApplications) = each_Applications;
+            return output;
+        }
+
+        void ListGroupBlocksRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyGroup), Group);
+        }
+
+        Json::Value ListGroupBlocksRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Group; ToJsonUtilO(Group, each_Group); ToJsonField(output, keyGroup) = each_Group;
+            return output;
+        }
+
+        void ListGroupBlocksResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyBlockedEntities), BlockedEntities);
+        }
+
+        Json::Value ListGroupBlocksResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BlockedEntities; ToJsonUtilO(BlockedEntities, each_BlockedEntities); ToJsonField(output, keyBlockedEntities) = each_BlockedEntities;
+            return output;
+        }
+
+        void ListGroupInvitationsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyGroup), Group);
+        }
+
+        Json::Value ListGroupInvitationsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Group; ToJsonUtilO(Group, each_Group); ToJsonField(output, keyGroup) = each_Group;
+            return output;
+        }
+
+        void ListGroupInvitationsResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyInvitations), Invitations);
+        }
+
+        Json::Value ListGroupInvitationsResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Invitations; ToJsonUtilO(Invitations, each_Invitations); ToJsonField(output, keyInvitations) = each_Invitations;
+            return output;
+        }
+
+        void ListGroupMembersRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyGroup), Group);
+        }
+
+        Json::Value ListGroupMembersRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Group; ToJsonUtilO(Group, each_Group); ToJsonField(output, keyGroup) = each_Group;
+            return output;
+        }
+
+        void ListGroupMembersResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyMembers), Members);
+        }
+
+        Json::Value ListGroupMembersResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Members; ToJsonUtilO(Members, each_Members); ToJsonField(output, keyMembers) = each_Members;
+            return output;
+        }
+
+        void ListMembershipOpportunitiesRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+        }
+
+        Json::Value ListMembershipOpportunitiesRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            return output;
+        }
+
+        void ListMembershipOpportunitiesResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyApplications), Applications);
+            FromJsonUtilO(FromJsonField(input, keyInvitations), Invitations);
+        }
+
+        Json::Value ListMembershipOpportunitiesResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Applications; ToJsonUtilO(Applications, each_Applications); ToJsonField(output, keyApplications) = each_Applications;
+            Json::Value each_Invitations; ToJsonUtilO(Invitations, each_Invitations); ToJsonField(output, keyInvitations) = each_Invitations;
+            return output;
+        }
+
+        void ListMembershipRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+        }
+
+        Json::Value ListMembershipRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            return output;
+        }
+
+        void ListMembershipResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyGroups), Groups);
+        }
+
+        Json::Value ListMembershipResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Groups; ToJsonUtilO(Groups, each_Groups); ToJsonField(output, keyGroups) = each_Groups;
+            return output;
+        }
+
+        void RemoveGroupApplicationRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilO(FromJsonField(input, keyGroup), Group);
+        }
+
+        Json::Value RemoveGroupApplicationRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_Group; ToJsonUtilO(Group, each_Group); ToJsonField(output, keyGroup) = each_Group;
+            return output;
+        }
+
+        void RemoveGroupInvitationRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilO(FromJsonField(input, keyGroup), Group);
+        }
+
+        Json::Value RemoveGroupInvitationRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_Group; ToJsonUtilO(Group, each_Group); ToJsonField(output, keyGroup) = each_Group;
+            return output;
+        }
+
+        void RemoveMembersRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyGroup), Group);
+            FromJsonUtilO(FromJsonField(input, keyMembers), Members);
+            FromJsonUtilS(FromJsonField(input, keyRoleId), RoleId);
+        }
+
+        Json::Value RemoveMembersRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Group; ToJsonUtilO(Group, each_Group); ToJsonField(output, keyGroup) = each_Group;
+            Json::Value each_Members; ToJsonUtilO(Members, each_Members); ToJsonField(output, keyMembers) = each_Members;
+            Json::Value each_RoleId; ToJsonUtilS(RoleId, each_RoleId); ToJsonField(output, keyRoleId) = each_RoleId;
+            return output;
+        }
+
+        void UnblockEntityRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilO(FromJsonField(input, keyGroup), Group);
+        }
+
+        Json::Value UnblockEntityRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_Group; ToJsonUtilO(Group, each_Group); ToJsonField(output, keyGroup) = each_Group;
+            return output;
+        }
+
+        void UpdateGroupRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAdminRoleId), AdminRoleId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyExpectedProfileVersion), ExpectedProfileVersion);
+            FromJsonUtilO(FromJsonField(input, keyGroup), Group);
+            FromJsonUtilS(FromJsonField(input, keyGroupName), GroupName);
+            FromJsonUtilS(FromJsonField(input, keyMemberRoleId), MemberRoleId);
+        }
+
+        Json::Value UpdateGroupRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AdminRoleId; ToJsonUtilS(AdminRoleId, each_AdminRoleId); ToJsonField(output, keyAdminRoleId) = each_AdminRoleId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ExpectedProfileVersion; ToJsonUtilP(ExpectedProfileVersion, each_ExpectedProfileVersion); ToJsonField(output, keyExpectedProfileVersion) = each_ExpectedProfileVersion;
+            Json::Value each_Group; ToJsonUtilO(Group, each_Group); ToJsonField(output, keyGroup) = each_Group;
+            Json::Value each_GroupName; ToJsonUtilS(GroupName, each_GroupName); ToJsonField(output, keyGroupName) = each_GroupName;
+            Json::Value each_MemberRoleId; ToJsonUtilS(MemberRoleId, each_MemberRoleId); ToJsonField(output, keyMemberRoleId) = each_MemberRoleId;
+            return output;
+        }
+
+        void UpdateGroupResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyOperationReason), OperationReason);
+            FromJsonUtilP(FromJsonField(input, keyProfileVersion), ProfileVersion);
+            FromJsonUtilE(FromJsonField(input, keySetResult), SetResult);
+        }
+
+        Json::Value UpdateGroupResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_OperationReason; ToJsonUtilS(OperationReason, each_OperationReason); ToJsonField(output, keyOperationReason) = each_OperationReason;
+            Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); ToJsonField(output, keyProfileVersion) = each_ProfileVersion;
+            Json::Value each_SetResult; ToJsonUtilE(SetResult, each_SetResult); ToJsonField(output, keySetResult) = each_SetResult;
+            return output;
+        }
+
+        void UpdateGroupRoleRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyExpectedProfileVersion), ExpectedProfileVersion);
+            FromJsonUtilO(FromJsonField(input, keyGroup), Group);
+            FromJsonUtilS(FromJsonField(input, keyRoleId), RoleId);
+            FromJsonUtilS(FromJsonField(input, keyRoleName), RoleName);
+        }
+
+        Json::Value UpdateGroupRoleRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ExpectedProfileVersion; ToJsonUtilP(ExpectedProfileVersion, each_ExpectedProfileVersion); ToJsonField(output, keyExpectedProfileVersion) = each_ExpectedProfileVersion;
+            Json::Value each_Group; ToJsonUtilO(Group, each_Group); ToJsonField(output, keyGroup) = each_Group;
+            Json::Value each_RoleId; ToJsonUtilS(RoleId, each_RoleId); ToJsonField(output, keyRoleId) = each_RoleId;
+            Json::Value each_RoleName; ToJsonUtilS(RoleName, each_RoleName); ToJsonField(output, keyRoleName) = each_RoleName;
+            return output;
+        }
+
+        void UpdateGroupRoleResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyOperationReason), OperationReason);
+            FromJsonUtilP(FromJsonField(input, keyProfileVersion), ProfileVersion);
+            FromJsonUtilE(FromJsonField(input, keySetResult), SetResult);
+        }
+
+        Json::Value UpdateGroupRoleResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_OperationReason; ToJsonUtilS(OperationReason, each_OperationReason); ToJsonField(output, keyOperationReason) = each_OperationReason;
+            Json::Value each_ProfileVersion; ToJsonUtilP(ProfileVersion, each_ProfileVersion); ToJsonField(output, keyProfileVersion) = each_ProfileVersion;
+            Json::Value each_SetResult; ToJsonUtilE(SetResult, each_SetResult); ToJsonField(output, keySetResult) = each_SetResult;
+            return output;
+        }
+    }
+}
+
+#endif
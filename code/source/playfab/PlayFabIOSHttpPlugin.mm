@@ -3,6 +3,7 @@
 
 #include <playfab/PlayFabIOSHttpPlugin.h>
 #include <playfab/PlayFabSettings.h>
+#include <playfab/PlayFabJsonUtils.h>
 #include <stdexcept>
 #include <vector>
 
@@ -232,17 +233,9 @@ namespace PlayFab
         urlRequest.HTTPMethod = @"POST";
         SetPredefinedHeaders(requestTask, (__bridge void*)urlRequest);
 
-        const auto& headers = requestContainer.GetRequestHeaders();
-
-        if (headers.size() > 0)
+        for (const PlayFabRequestHeaders::Header& header : requestContainer.GetRequestHeaders())
         {
-            for (auto const &obj : headers)
-            {
-                if (obj.first.length() != 0 && obj.second.length() != 0) // no empty keys or values in headers
-                {
-                    [urlRequest setValue:[NSString stringWithUTF8String:obj.second.c_str()] forHTTPHeaderField:[NSString stringWithUTF8String:obj.first.c_str()]];
-                }
-            }
+            [urlRequest setValue:[NSString stringWithUTF8String:header.GetValue()] forHTTPHeaderField:[NSString stringWithUTF8String:header.GetName()]];
         }
 
         // Send a request
@@ -252,7 +245,7 @@ namespace PlayFab
         if (!GetBinaryPayload(requestTask, payload, payloadSize))
         {
             // set string payload if binary wasn't provided
-            std::string requestBody = requestContainer.GetRequestBody();
+            const std::string& requestBody = requestContainer.GetRequestBody();
             payloadSize = (size_t)requestBody.size();
             data = [NSData dataWithBytes:requestBody.c_str() length:payloadSize];
         }
@@ -307,23 +300,15 @@ namespace PlayFab
     void PlayFabIOSHttpPlugin::ProcessResponse(RequestTask& requestTask, const int httpCode)
     {
         CallRequestContainer& requestContainer = requestTask.RequestContainer();
-        Json::CharReaderBuilder jsonReaderFactory;
-        std::unique_ptr<Json::CharReader> jsonReader(jsonReaderFactory.newCharReader());
-        JSONCPP_STRING jsonParseErrors;
-        const bool parsedSuccessfully = jsonReader->parse(requestContainer.responseString.c_str(), requestContainer.responseString.c_str() + requestContainer.responseString.length(), &requestContainer.responseJson, &jsonParseErrors);
+        std::string jsonParseErrors;
+        const bool parsedSuccessfully = PlayFabJsonUtils::ParseFromString(requestContainer.responseString, requestContainer.responseJson, jsonParseErrors);
 
         requestContainer.errorWrapper.RequestId = requestContainer.GetRequestId();
 
         if (parsedSuccessfully)
         {
             // fully successful response
-            requestContainer.errorWrapper.HttpCode = requestContainer.responseJson.get("code", Json::Value::null).asInt();
-            requestContainer.errorWrapper.HttpStatus = requestContainer.responseJson.get("status", Json::Value::null).asString();
-            requestContainer.errorWrapper.Data = requestContainer.responseJson.get("data", Json::Value::null);
-            requestContainer.errorWrapper.ErrorName = requestContainer.responseJson.get("error", Json::Value::null).asString();
-            requestContainer.errorWrapper.ErrorCode = static_cast<PlayFabErrorCode>(requestContainer.responseJson.get("errorCode", Json::Value::null).asInt());
-            requestContainer.errorWrapper.ErrorMessage = requestContainer.responseJson.get("errorMessage", Json::Value::null).asString();
-            requestContainer.errorWrapper.ErrorDetails = requestContainer.responseJson.get("errorDetails", Json::Value::null);
+            requestContainer.ProcessResponseJson();
         }
         else
         {
@@ -3,7 +3,9 @@
 #if defined(PLAYFAB_PLATFORM_XBOX)
 #include <playfab/PlayFabIXHR2HttpPlugin.h>
 #include <playfab/PlayFabSettings.h>
+#include <playfab/PlayFabJsonUtils.h>
 
+#include <cstring>
 #include <stdexcept>
 
 namespace PlayFab
@@ -132,20 +134,14 @@ namespace PlayFab
         reportErrorAsSuccessHeader.wstrHeaderValue = L"true";
         headers.push_back(std::move(reportErrorAsSuccessHeader));
 
-        const std::unordered_map<std::string, std::string> reqHeaders = reqContainer.GetRequestHeaders();
-
-        if (reqHeaders.size() > 0)
+        for (const PlayFabRequestHeaders::Header& header : reqContainer.GetRequestHeaders())
         {
-            for (auto const &obj : reqHeaders)
-            {
-                if (obj.first.length() != 0 && obj.second.length() != 0) // no empty keys or values in headers
-                {
-                    HttpHeaderInfo hInfo;
-                    hInfo.wstrHeaderName = std::wstring(obj.first.begin(), obj.first.end());
-                    hInfo.wstrHeaderValue = std::wstring(obj.second.begin(), obj.second.end());
-                    headers.push_back(std::move(hInfo));
-                }
-            }
+            const char* name = header.GetName();
+            const char* value = header.GetValue();
+            HttpHeaderInfo hInfo;
+            hInfo.wstrHeaderName = std::wstring(name, name + strlen(name));
+            hInfo.wstrHeaderValue = std::wstring(value, value + strlen(value));
+            headers.push_back(std::move(hInfo));
         }
     }
 
@@ -165,7 +161,7 @@ namespace PlayFab
         std::wstring url(urlString.begin(), urlString.end());
         
         // Setup payload
-        std::string payload = reqContainer.GetRequestBody();
+        const std::string& payload = reqContainer.GetRequestBody();
 
         // Send post request
         postEventRequest.Open(
@@ -207,20 +203,12 @@ namespace PlayFab
         }
         else
         {
-            Json::CharReaderBuilder jsonReaderFactory;
-            std::unique_ptr<Json::CharReader> jsonReader(jsonReaderFactory.newCharReader());
-            JSONCPP_STRING jsonParseErrors;
-            const bool parsedSuccessfully = jsonReader->parse(reqContainer.responseString.c_str(), reqContainer.responseString.c_str() + reqContainer.responseString.length(), &reqContainer.responseJson, &jsonParseErrors);
+            std::string jsonParseErrors;
+            const bool parsedSuccessfully = PlayFabJsonUtils::ParseFromString(reqContainer.responseString, reqContainer.responseJson, jsonParseErrors);
 
             if (parsedSuccessfully)
             {
-                reqContainer.errorWrapper.HttpCode = reqContainer.responseJson.get("code", Json::Value::null).asInt();
-                reqContainer.errorWrapper.HttpStatus = reqContainer.responseJson.get("status", Json::Value::null).asString();
-                reqContainer.errorWrapper.Data = reqContainer.responseJson.get("data", Json::Value::null);
-                reqContainer.errorWrapper.ErrorName = reqContainer.responseJson.get("error", Json::Value::null).asString();
-                reqContainer.errorWrapper.ErrorCode = static_cast<PlayFabErrorCode>(reqContainer.responseJson.get("errorCode", Json::Value::null).asInt());
-                reqContainer.errorWrapper.ErrorMessage = reqContainer.responseJson.get("errorMessage", Json::Value::null).asString();
-                reqContainer.errorWrapper.ErrorDetails = reqContainer.responseJson.get("errorDetails", Json::Value::null);
+                reqContainer.ProcessResponseJson();
             }
             else
             {
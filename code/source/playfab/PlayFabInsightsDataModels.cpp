@@ -0,0 +1,236 @@
+#include <stdafx.h>
+
+#if !defined(DISABLE_PLAYFABENTITY_API)
+
+#include <playfab/PlayFabInsightsDataModels.h>
+
+namespace PlayFab
+{
+    namespace InsightsModels
+    {
+        namespace
+        {
+            // The json field names of the models below
+            constexpr PlayFabJsonKey keyActiveEventExports("ActiveEventExports");
+            constexpr PlayFabJsonKey keyCacheSizeMB("CacheSizeMB");
+            constexpr PlayFabJsonKey keyConcurrency("Concurrency");
+            constexpr PlayFabJsonKey keyCreditsPerMinute("CreditsPerMinute");
+            constexpr PlayFabJsonKey keyCustomTags("CustomTags");
+            constexpr PlayFabJsonKey keyDataUsageMb("DataUsageMb");
+            constexpr PlayFabJsonKey keyDefaultPerformanceLevel("DefaultPerformanceLevel");
+            constexpr PlayFabJsonKey keyDefaultStorageRetentionDays("DefaultStorageRetentionDays");
+            constexpr PlayFabJsonKey keyErrorMessage("ErrorMessage");
+            constexpr PlayFabJsonKey keyEventsPerSecond("EventsPerSecond");
+            constexpr PlayFabJsonKey keyLevel("Level");
+            constexpr PlayFabJsonKey keyLimits("Limits");
+            constexpr PlayFabJsonKey keyMaxMemoryPerQueryMB("MaxMemoryPerQueryMB");
+            constexpr PlayFabJsonKey keyMessage("Message");
+            constexpr PlayFabJsonKey keyOperationCompletedTime("OperationCompletedTime");
+            constexpr PlayFabJsonKey keyOperationId("OperationId");
+            constexpr PlayFabJsonKey keyOperationLastUpdated("OperationLastUpdated");
+            constexpr PlayFabJsonKey keyOperationStartedTime("OperationStartedTime");
+            constexpr PlayFabJsonKey keyOperationType("OperationType");
+            constexpr PlayFabJsonKey keyOperationValue("OperationValue");
+            constexpr PlayFabJsonKey keyPendingOperations("PendingOperations");
+            constexpr PlayFabJsonKey keyPerformanceLevel("PerformanceLevel");
+            constexpr PlayFabJsonKey keyRetentionDays("RetentionDays");
+            constexpr PlayFabJsonKey keyStatus("Status");
+            constexpr PlayFabJsonKey keyStorageMaxRetentionDays("StorageMaxRetentionDays");
+            constexpr PlayFabJsonKey keyStorageMinRetentionDays("StorageMinRetentionDays");
+            constexpr PlayFabJsonKey keySubMeters("SubMeters");
+            constexpr PlayFabJsonKey keyVirtualCpuCores("VirtualCpuCores");
+        }
+
+        void InsightsEmptyRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value InsightsEmptyRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void InsightsPerformanceLevel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyActiveEventExports), ActiveEventExports);
+            FromJsonUtilP(FromJsonField(input, keyCacheSizeMB), CacheSizeMB);
+            FromJsonUtilP(FromJsonField(input, keyConcurrency), Concurrency);
+            FromJsonUtilP(FromJsonField(input, keyCreditsPerMinute), CreditsPerMinute);
+            FromJsonUtilP(FromJsonField(input, keyEventsPerSecond), EventsPerSecond);
+            FromJsonUtilP(FromJsonField(input, keyLevel), Level);
+            FromJsonUtilP(FromJsonField(input, keyMaxMemoryPerQueryMB), MaxMemoryPerQueryMB);
+            FromJsonUtilP(FromJsonField(input, keyVirtualCpuCores), VirtualCpuCores);
+        }
+
+        Json::Value InsightsPerformanceLevel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ActiveEventExports; ToJsonUtilP(ActiveEventExports, each_ActiveEventExports); ToJsonField(output, keyActiveEventExports) = each_ActiveEventExports;
+            Json::Value each_CacheSizeMB; ToJsonUtilP(CacheSizeMB, each_CacheSizeMB); ToJsonField(output, keyCacheSizeMB) = each_CacheSizeMB;
+            Json::Value each_Concurrency; ToJsonUtilP(Concurrency, each_Concurrency); ToJsonField(output, keyConcurrency) = each_Concurrency;
+            Json::Value each_CreditsPerMinute; ToJsonUtilP(CreditsPerMinute, each_CreditsPerMinute); ToJsonField(output, keyCreditsPerMinute) = each_CreditsPerMinute;
+            Json::Value each_EventsPerSecond; ToJsonUtilP(EventsPerSecond, each_EventsPerSecond); ToJsonField(output, keyEventsPerSecond) = each_EventsPerSecond;
+            Json::Value each_Level; ToJsonUtilP(Level, each_Level); ToJsonField(output, keyLevel) = each_Level;
+            Json::Value each_MaxMemoryPerQueryMB; ToJsonUtilP(MaxMemoryPerQueryMB, each_MaxMemoryPerQueryMB); ToJsonField(output, keyMaxMemoryPerQueryMB) = each_MaxMemoryPerQueryMB;
+            Json::Value each_VirtualCpuCores; ToJsonUtilP(VirtualCpuCores, each_VirtualCpuCores); ToJsonField(output, keyVirtualCpuCores) = each_VirtualCpuCores;
+            return output;
+        }
+
+        void InsightsGetLimitsResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyDefaultPerformanceLevel), DefaultPerformanceLevel);
+            FromJsonUtilP(FromJsonField(input, keyDefaultStorageRetentionDays), DefaultStorageRetentionDays);
+            FromJsonUtilP(FromJsonField(input, keyStorageMaxRetentionDays), StorageMaxRetentionDays);
+            FromJsonUtilP(FromJsonField(input, keyStorageMinRetentionDays), StorageMinRetentionDays);
+            FromJsonUtilO(FromJsonField(input, keySubMeters), SubMeters);
+        }
+
+        Json::Value InsightsGetLimitsResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_DefaultPerformanceLevel; ToJsonUtilP(DefaultPerformanceLevel, each_DefaultPerformanceLevel); ToJsonField(output, keyDefaultPerformanceLevel) = each_DefaultPerformanceLevel;
+            Json::Value each_DefaultStorageRetentionDays; ToJsonUtilP(DefaultStorageRetentionDays, each_DefaultStorageRetentionDays); ToJsonField(output, keyDefaultStorageRetentionDays) = each_DefaultStorageRetentionDays;
+            Json::Value each_StorageMaxRetentionDays; ToJsonUtilP(StorageMaxRetentionDays, each_StorageMaxRetentionDays); ToJsonField(output, keyStorageMaxRetentionDays) = each_StorageMaxRetentionDays;
+            Json::Value each_StorageMinRetentionDays; ToJsonUtilP(StorageMinRetentionDays, each_StorageMinRetentionDays); ToJsonField(output, keyStorageMinRetentionDays) = each_StorageMinRetentionDays;
+            Json::Value each_SubMeters; ToJsonUtilO(SubMeters, each_SubMeters); ToJsonField(output, keySubMeters) = each_SubMeters;
+            return output;
+        }
+
+        void InsightsGetOperationStatusResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyMessage), Message);
+            FromJsonUtilT(FromJsonField(input, keyOperationCompletedTime), OperationCompletedTime);
+            FromJsonUtilS(FromJsonField(input, keyOperationId), OperationId);
+            FromJsonUtilT(FromJsonField(input, keyOperationLastUpdated), OperationLastUpdated);
+            FromJsonUtilT(FromJsonField(input, keyOperationStartedTime), OperationStartedTime);
+            FromJsonUtilS(FromJsonField(input, keyOperationType), OperationType);
+            FromJsonUtilP(FromJsonField(input, keyOperationValue), OperationValue);
+            FromJsonUtilS(FromJsonField(input, keyStatus), Status);
+        }
+
+        Json::Value InsightsGetOperationStatusResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Message; ToJsonUtilS(Message, each_Message); ToJsonField(output, keyMessage) = each_Message;
+            Json::Value each_OperationCompletedTime; ToJsonUtilT(OperationCompletedTime, each_OperationCompletedTime); ToJsonField(output, keyOperationCompletedTime) = each_OperationCompletedTime;
+            Json::Value each_OperationId; ToJsonUtilS(OperationId, each_OperationId); ToJsonField(output, keyOperationId) = each_OperationId;
+            Json::Value each_OperationLastUpdated; ToJsonUtilT(OperationLastUpdated, each_OperationLastUpdated); ToJsonField(output, keyOperationLastUpdated) = each_OperationLastUpdated;
+            Json::Value each_OperationStartedTime; ToJsonUtilT(OperationStartedTime, each_OperationStartedTime); ToJsonField(output, keyOperationStartedTime) = each_OperationStartedTime;
+            Json::Value each_OperationType; ToJsonUtilS(OperationType, each_OperationType); ToJsonField(output, keyOperationType) = each_OperationType;
+            Json::Value each_OperationValue; ToJsonUtilP(OperationValue, each_OperationValue); ToJsonField(output, keyOperationValue) = each_OperationValue;
+            Json::Value each_Status; ToJsonUtilS(Status, each_Status); ToJsonField(output, keyStatus) = each_Status;
+            return output;
+        }
+
+        void InsightsGetDetailsResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyDataUsageMb), DataUsageMb);
+            FromJsonUtilS(FromJsonField(input, keyErrorMessage), ErrorMessage);
+            FromJsonUtilO(FromJsonField(input, keyLimits), Limits);
+            FromJsonUtilO(FromJsonField(input, keyPendingOperations), PendingOperations);
+            FromJsonUtilP(FromJsonField(input, keyPerformanceLevel), PerformanceLevel);
+            FromJsonUtilP(FromJsonField(input, keyRetentionDays), RetentionDays);
+        }
+
+        Json::Value InsightsGetDetailsResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_DataUsageMb; ToJsonUtilP(DataUsageMb, each_DataUsageMb); ToJsonField(output, keyDataUsageMb) = each_DataUsageMb;
+            Json::Value each_ErrorMessage; ToJsonUtilS(ErrorMessage, each_ErrorMessage); ToJsonField(output, keyErrorMessage) = each_ErrorMessage;
+            Json::Value each_Limits; ToJsonUtilO(Limits, each_Limits); ToJsonField(output, keyLimits) = each_Limits;
+            Json::Value each_PendingOperations; ToJsonUtilO(PendingOperations, each_PendingOperations); ToJsonField(output, keyPendingOperations) = each_PendingOperations;
+            Json::Value each_PerformanceLevel; ToJsonUtilP(PerformanceLevel, each_PerformanceLevel); ToJsonField(output, keyPerformanceLevel) = each_PerformanceLevel;
+            Json::Value each_RetentionDays; ToJsonUtilP(RetentionDays, each_RetentionDays); ToJsonField(output, keyRetentionDays) = each_RetentionDays;
+            return output;
+        }
+
+        void InsightsGetOperationStatusRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyOperationId), OperationId);
+        }
+
+        Json::Value InsightsGetOperationStatusRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_OperationId; ToJsonUtilS(OperationId, each_OperationId); ToJsonField(output, keyOperationId) = each_OperationId;
+            return output;
+        }
+
+        void InsightsGetPendingOperationsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyOperationType), OperationType);
+        }
+
+        Json::Value InsightsGetPendingOperationsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_OperationType; ToJsonUtilS(OperationType, each_OperationType); ToJsonField(output, keyOperationType) = each_OperationType;
+            return output;
+        }
+
+        void InsightsGetPendingOperationsResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyPendingOperations), PendingOperations);
+        }
+
+        Json::Value InsightsGetPendingOperationsResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PendingOperations; ToJsonUtilO(PendingOperations, each_PendingOperations); ToJsonField(output, keyPendingOperations) = each_PendingOperations;
+            return output;
+        }
+
+        void InsightsOperationResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyMessage), Message);
+            FromJsonUtilS(FromJsonField(input, keyOperationId), OperationId);
+            FromJsonUtilS(FromJsonField(input, keyOperationType), OperationType);
+        }
+
+        Json::Value InsightsOperationResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Message; ToJsonUtilS(Message, each_Message); ToJsonField(output, keyMessage) = each_Message;
+            Json::Value each_OperationId; ToJsonUtilS(OperationId, each_OperationId); ToJsonField(output, keyOperationId) = each_OperationId;
+            Json::Value each_OperationType; ToJsonUtilS(OperationType, each_OperationType); ToJsonField(output, keyOperationType) = each_OperationType;
+            return output;
+        }
+
+        void InsightsSetPerformanceRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyPerformanceLevel), PerformanceLevel);
+        }
+
+        Json::Value InsightsSetPerformanceRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PerformanceLevel; ToJsonUtilP(PerformanceLevel, each_PerformanceLevel); ToJsonField(output, keyPerformanceLevel) = each_PerformanceLevel;
+            return output;
+        }
+
+        void InsightsSetStorageRetentionRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyRetentionDays), RetentionDays);
+        }
+
+        Json::Value InsightsSetStorageRetentionRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_RetentionDays; ToJsonUtilP(RetentionDays, each_RetentionDays); ToJsonField(output, keyRetentionDays) = each_RetentionDays;
+            return output;
+        }
+    }
+}
+
+#endif
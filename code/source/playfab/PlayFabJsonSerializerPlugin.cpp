@@ -0,0 +1,17 @@
+#include <stdafx.h>
+
+#include <playfab/PlayFabJsonSerializerPlugin.h>
+#include <playfab/PlayFabJsonUtils.h>
+
+namespace PlayFab
+{
+    void PlayFabJsonSerializerPlugin::Serialize(const Json::Value& input, std::string& output)
+    {
+        output += PlayFabJsonUtils::WriteToString(input);
+    }
+
+    bool PlayFabJsonSerializerPlugin::Deserialize(const char* data, size_t length, Json::Value& output, std::string& errors)
+    {
+        return PlayFabJsonUtils::ParseFromString(data, data + length, output, errors);
+    }
+}
@@ -0,0 +1,159 @@
+#include <stdafx.h>
+
+#include <playfab/PlayFabJsonUtils.h>
+
+namespace PlayFab
+{
+    namespace
+    {
+        // Per-thread json state. Json::CharReader and Json::StreamWriter are not thread-safe, but they are reusable,
+        // so each thread gets its own instances which live as long as the thread does.
+        struct ThreadJsonState
+        {
+            ThreadJsonState()
+            {
+                Json::CharReaderBuilder readerBuilder;
+                reader.reset(readerBuilder.newCharReader());
+
+                Json::StreamWriterBuilder writerBuilder;
+                writerBuilder["indentation"] = "";
+                writer.reset(writerBuilder.newStreamWriter());
+            }
+
+            std::unique_ptr<Json::CharReader> reader;
+            std::unique_ptr<Json::StreamWriter> writer;
+            std::ostringstream writeStream;
+        };
+
+        ThreadJsonState& GetThreadJsonState()
+        {
+            static thread_local ThreadJsonState state;
+            return state;
+        }
+
+        size_t GetDigitCount(Json::LargestUInt value)
+        {
+            size_t count = 1;
+            while (value >= 10)
+            {
+                value /= 10;
+                ++count;
+            }
+            return count;
+        }
+    }
+
+    std::string PlayFabJsonUtils::WriteToString(const Json::Value& input)
+    {
+        ThreadJsonState& state = GetThreadJsonState();
+        state.writeStream.str(std::string());
+        state.writeStream.clear();
+        state.writer->write(input, &state.writeStream);
+        return state.writeStream.str();
+    }
+
+    bool PlayFabJsonUtils::ParseFromString(const char* begin, const char* end, Json::Value& output, std::string& errors)
+    {
+        JSONCPP_STRING parseErrors;
+        const bool parsedSuccessfully = GetThreadJsonState().reader->parse(begin, end, &output, &parseErrors);
+        if (!parsedSuccessfully)
+        {
+            errors = parseErrors;
+        }
+        return parsedSuccessfully;
+    }
+
+    bool PlayFabJsonUtils::ParseFromString(const std::string& input, Json::Value& output, std::string& errors)
+    {
+        return ParseFromString(input.c_str(), input.c_str() + input.length(), output, errors);
+    }
+
+    size_t PlayFabJsonUtils::GetMemoryUsage(const Json::Value& input)
+    {
+        // Follows jsoncpp's storage: strings and member names are duplicated with a length prefix and a terminator, and
+        // arrays and objects are a std::map with one tree node (4 pointer-sized links) per element
+        constexpr size_t stringOverhead = sizeof(unsigned) + 1;
+        constexpr size_t mapNodeSize = 4 * sizeof(void*) + sizeof(Json::Value::ObjectValues::value_type);
+
+        size_t usage = 0;
+        switch (input.type())
+        {
+        case Json::stringValue:
+        {
+            const char* begin = nullptr;
+            const char* end = nullptr;
+            if (input.getString(&begin, &end))
+            {
+                usage += (end - begin) + stringOverhead;
+            }
+            break;
+        }
+        case Json::arrayValue:
+        case Json::objectValue:
+        {
+            usage += sizeof(Json::Value::ObjectValues);
+            for (Json::ValueConstIterator it = input.begin(); it != input.end(); ++it)
+            {
+                usage += mapNodeSize + GetMemoryUsage(*it);
+                const char* nameEnd = nullptr;
+                const char* name = it.memberName(&nameEnd);
+                if (name != nullptr)
+                {
+                    usage += (nameEnd - name) + stringOverhead;
+                }
+            }
+            break;
+        }
+        default:
+            break;
+        }
+        return usage;
+    }
+
+    size_t PlayFabJsonUtils::GetSerializedSize(const Json::Value& input)
+    {
+        constexpr size_t maximalRealLength = 24; // 17 significant digits, a sign, a decimal point and an exponent
+
+        switch (input.type())
+        {
+        case Json::nullValue:
+            return 4;
+        case Json::booleanValue:
+            return input.asBool() ? 4 : 5;
+        case Json::intValue:
+        {
+            const Json::LargestInt value = input.asLargestInt();
+            return (value < 0) ? 1 + GetDigitCount(0 - static_cast<Json::LargestUInt>(value)) : GetDigitCount(static_cast<Json::LargestUInt>(value));
+        }
+        case Json::uintValue:
+            return GetDigitCount(input.asLargestUInt());
+        case Json::realValue:
+            return maximalRealLength;
+        case Json::stringValue:
+        {
+            const char* begin = nullptr;
+            const char* end = nullptr;
+            return (input.getString(&begin, &end) ? (end - begin) : 0) + 2;
+        }
+        case Json::arrayValue:
+        case Json::objectValue:
+        {
+            // brackets, and a separator between elements
+            size_t size = 2 + (input.empty() ? 0 : input.size() - 1);
+            for (Json::ValueConstIterator it = input.begin(); it != input.end(); ++it)
+            {
+                size += GetSerializedSize(*it);
+                const char* nameEnd = nullptr;
+                const char* name = it.memberName(&nameEnd);
+                if (name != nullptr)
+                {
+                    size += (nameEnd - name) + 3; // quotes and colon
+                }
+            }
+            return size;
+        }
+        default:
+            return 0;
+        }
+    }
+}
@@ -0,0 +1,88 @@
+#include <stdafx.h>
+
+#include <playfab/PlayFabLazyResult.h>
+#include <playfab/PlayFabCallRequestContainer.h>
+#include <playfab/PlayFabSettings.h>
+
+#include <cstring>
+
+namespace PlayFab
+{
+    PlayFabLazyResultBase::PlayFabLazyResultBase(CallRequestContainer& container)
+    {
+        // The container is done with the response once the callback is invoked, so take its json instead of copying it
+        std::shared_ptr<Json::Value> responseData = std::make_shared<Json::Value>();
+        if (container.responseJson.isObject() && container.responseJson.isMember("data"))
+        {
+            responseData->swap(container.responseJson["data"]);
+        }
+        data = std::move(responseData);
+
+        std::shared_ptr<Json::Value> requestJson = std::make_shared<Json::Value>();
+        requestJson->swap(container.errorWrapper.Request);
+        request = std::move(requestJson);
+    }
+
+    const Json::Value& PlayFabLazyResultBase::Data() const
+    {
+        return *data;
+    }
+
+    const Json::Value& PlayFabLazyResultBase::Request() const
+    {
+        return *request;
+    }
+
+    bool PlayFabLazyResultBase::Has(const char* fieldName) const
+    {
+        return Find(fieldName) != nullptr;
+    }
+
+    const Json::Value& PlayFabLazyResultBase::GetJson(const char* fieldName) const
+    {
+        const Json::Value* field = Find(fieldName);
+        return (field == nullptr) ? Json::Value::null : *field;
+    }
+
+    bool PlayFabLazyResultBase::GetTime(const char* fieldName, time_t& output) const
+    {
+        const Json::Value* field = Find(fieldName);
+        if (field == nullptr)
+        {
+            return false;
+        }
+        FromJsonUtilT(*field, output);
+        return true;
+    }
+
+    const Json::Value* PlayFabLazyResultBase::Find(const char* fieldName) const
+    {
+        if (!data->isObject())
+        {
+            return nullptr;
+        }
+        return data->find(fieldName, fieldName + strlen(fieldName));
+    }
+
+    bool PlayFabLazyResultBase::ValidateResult(CallRequestContainer& container)
+    {
+        container.ReleaseRequestBody();
+        if (container.errorWrapper.HttpCode == 200)
+        {
+            return true;
+        }
+        else // Process the error case
+        {
+            if (PlayFabSettings::globalErrorHandler != nullptr)
+            {
+                PlayFabSettings::globalErrorHandler(container.errorWrapper, container.GetCustomData());
+            }
+
+            if (container.errorCallback != nullptr)
+            {
+                container.errorCallback(container.errorWrapper, container.GetCustomData());
+            }
+            return false;
+        }
+    }
+}
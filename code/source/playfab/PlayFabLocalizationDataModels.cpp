@@ -0,0 +1,44 @@
+#include <stdafx.h>
+
+#if !defined(DISABLE_PLAYFABENTITY_API)
+
+#include <playfab/PlayFabLocalizationDataModels.h>
+
+namespace PlayFab
+{
+    namespace LocalizationModels
+    {
+        namespace
+        {
+            // The json field names of the models below
+            constexpr PlayFabJsonKey keyCustomTags("CustomTags");
+            constexpr PlayFabJsonKey keyLanguageList("LanguageList");
+        }
+
+        void GetLanguageListRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value GetLanguageListRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void GetLanguageListResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyLanguageList), LanguageList);
+        }
+
+        Json::Value GetLanguageListResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_LanguageList; ToJsonUtilS(LanguageList, each_LanguageList); ToJsonField(output, keyLanguageList) = each_LanguageList;
+            return output;
+        }
+    }
+}
+
+#endif
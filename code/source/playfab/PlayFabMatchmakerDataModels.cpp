@@ -0,0 +1,360 @@
+#include <stdafx.h>
+
+#if defined(ENABLE_PLAYFABSERVER_API)
+
+#include <playfab/PlayFabMatchmakerDataModels.h>
+
+namespace PlayFab
+{
+    namespace MatchmakerModels
+    {
+        namespace
+        {
+            // The json field names of the models below
+            constexpr PlayFabJsonKey keyAnnotation("Annotation");
+            constexpr PlayFabJsonKey keyAuthorizationTicket("AuthorizationTicket");
+            constexpr PlayFabJsonKey keyAuthorized("Authorized");
+            constexpr PlayFabJsonKey keyBuild("Build");
+            constexpr PlayFabJsonKey keyBundleContents("BundleContents");
+            constexpr PlayFabJsonKey keyBundleParent("BundleParent");
+            constexpr PlayFabJsonKey keyCatalogVersion("CatalogVersion");
+            constexpr PlayFabJsonKey keyCustomCommandLineData("CustomCommandLineData");
+            constexpr PlayFabJsonKey keyCustomData("CustomData");
+            constexpr PlayFabJsonKey keyCustomTags("CustomTags");
+            constexpr PlayFabJsonKey keyDisplayName("DisplayName");
+            constexpr PlayFabJsonKey keyExpiration("Expiration");
+            constexpr PlayFabJsonKey keyExternalMatchmakerEventEndpoint("ExternalMatchmakerEventEndpoint");
+            constexpr PlayFabJsonKey keyGameID("GameID");
+            constexpr PlayFabJsonKey keyGameMode("GameMode");
+            constexpr PlayFabJsonKey keyInventory("Inventory");
+            constexpr PlayFabJsonKey keyIsDeveloper("IsDeveloper");
+            constexpr PlayFabJsonKey keyItemClass("ItemClass");
+            constexpr PlayFabJsonKey keyItemId("ItemId");
+            constexpr PlayFabJsonKey keyItemInstanceId("ItemInstanceId");
+            constexpr PlayFabJsonKey keyLobbyId("LobbyId");
+            constexpr PlayFabJsonKey keyMinCatalogVersion("MinCatalogVersion");
+            constexpr PlayFabJsonKey keyPlayFabId("PlayFabId");
+            constexpr PlayFabJsonKey keyPurchaseDate("PurchaseDate");
+            constexpr PlayFabJsonKey keyRechargeMax("RechargeMax");
+            constexpr PlayFabJsonKey keyRechargeTime("RechargeTime");
+            constexpr PlayFabJsonKey keyRegion("Region");
+            constexpr PlayFabJsonKey keyRemainingUses("RemainingUses");
+            constexpr PlayFabJsonKey keySecondsToRecharge("SecondsToRecharge");
+            constexpr PlayFabJsonKey keyServerIPV4Address("ServerIPV4Address");
+            constexpr PlayFabJsonKey keyServerIPV6Address("ServerIPV6Address");
+            constexpr PlayFabJsonKey keyServerPort("ServerPort");
+            constexpr PlayFabJsonKey keyServerPublicDNSName("ServerPublicDNSName");
+            constexpr PlayFabJsonKey keySteamId("SteamId");
+            constexpr PlayFabJsonKey keyTitleDisplayName("TitleDisplayName");
+            constexpr PlayFabJsonKey keyUnitCurrency("UnitCurrency");
+            constexpr PlayFabJsonKey keyUnitPrice("UnitPrice");
+            constexpr PlayFabJsonKey keyUsername("Username");
+            constexpr PlayFabJsonKey keyUsesIncrementedBy("UsesIncrementedBy");
+            constexpr PlayFabJsonKey keyVirtualCurrency("VirtualCurrency");
+            constexpr PlayFabJsonKey keyVirtualCurrencyRechargeTimes("VirtualCurrencyRechargeTimes");
+        }
+
+        void ToJsonEnum(const Region input, Json::Value& output)
+        {
+            if (input == Region::RegionUSCentral)
+            {
+                output = Json::Value(Json::StaticString("USCentral"));
+                return;
+            }
+            if (input == Region::RegionUSEast)
+            {
+                output = Json::Value(Json::StaticString("USEast"));
+                return;
+            }
+            if (input == Region::RegionEUWest)
+            {
+                output = Json::Value(Json::StaticString("EUWest"));
+                return;
+            }
+            if (input == Region::RegionSingapore)
+            {
+                output = Json::Value(Json::StaticString("Singapore"));
+                return;
+            }
+            if (input == Region::RegionJapan)
+            {
+                output = Json::Value(Json::StaticString("Japan"));
+                return;
+            }
+            if (input == Region::RegionBrazil)
+            {
+                output = Json::Value(Json::StaticString("Brazil"));
+                return;
+            }
+            if (input == Region::RegionAustralia)
+            {
+                output = Json::Value(Json::StaticString("Australia"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, Region& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "USCentral")
+            {
+                output = Region::RegionUSCentral;
+                return;
+            }
+            if (inputStr == "USEast")
+            {
+                output = Region::RegionUSEast;
+                return;
+            }
+            if (inputStr == "EUWest")
+            {
+                output = Region::RegionEUWest;
+                return;
+            }
+            if (inputStr == "Singapore")
+            {
+                output = Region::RegionSingapore;
+                return;
+            }
+            if (inputStr == "Japan")
+            {
+                output = Region::RegionJapan;
+                return;
+            }
+            if (inputStr == "Brazil")
+            {
+                output = Region::RegionBrazil;
+                return;
+            }
+            if (inputStr == "Australia")
+            {
+                output = Region::RegionAustralia;
+                return;
+            }
+        }
+
+        void AuthUserRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAuthorizationTicket), AuthorizationTicket);
+        }
+
+        Json::Value AuthUserRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AuthorizationTicket; ToJsonUtilS(AuthorizationTicket, each_AuthorizationTicket); ToJsonField(output, keyAuthorizationTicket) = each_AuthorizationTicket;
+            return output;
+        }
+
+        void AuthUserResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyAuthorized), Authorized);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value AuthUserResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Authorized; ToJsonUtilP(Authorized, each_Authorized); ToJsonField(output, keyAuthorized) = each_Authorized;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void ItemInstance::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAnnotation), Annotation);
+            FromJsonUtilS(FromJsonField(input, keyBundleContents), BundleContents);
+            FromJsonUtilS(FromJsonField(input, keyBundleParent), BundleParent);
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCustomData), CustomData);
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+            FromJsonUtilT(FromJsonField(input, keyExpiration), Expiration);
+            FromJsonUtilS(FromJsonField(input, keyItemClass), ItemClass);
+            FromJsonUtilS(FromJsonField(input, keyItemId), ItemId);
+            FromJsonUtilS(FromJsonField(input, keyItemInstanceId), ItemInstanceId);
+            FromJsonUtilT(FromJsonField(input, keyPurchaseDate), PurchaseDate);
+            FromJsonUtilP(FromJsonField(input, keyRemainingUses), RemainingUses);
+            FromJsonUtilS(FromJsonField(input, keyUnitCurrency), UnitCurrency);
+            FromJsonUtilP(FromJsonField(input, keyUnitPrice), UnitPrice);
+            FromJsonUtilP(FromJsonField(input, keyUsesIncrementedBy), UsesIncrementedBy);
+        }
+
+        Json::Value ItemInstance::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Annotation; ToJsonUtilS(Annotation, each_Annotation); ToJsonField(output, keyAnnotation) = each_Annotation;
+            Json::Value each_BundleContents; ToJsonUtilS(BundleContents, each_BundleContents); ToJsonField(output, keyBundleContents) = each_BundleContents;
+            Json::Value each_BundleParent; ToJsonUtilS(BundleParent, each_BundleParent); ToJsonField(output, keyBundleParent) = each_BundleParent;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CustomData; ToJsonUtilS(CustomData, each_CustomData); ToJsonField(output, keyCustomData) = each_CustomData;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            Json::Value each_Expiration; ToJsonUtilT(Expiration, each_Expiration); ToJsonField(output, keyExpiration) = each_Expiration;
+            Json::Value each_ItemClass; ToJsonUtilS(ItemClass, each_ItemClass); ToJsonField(output, keyItemClass) = each_ItemClass;
+            Json::Value each_ItemId; ToJsonUtilS(ItemId, each_ItemId); ToJsonField(output, keyItemId) = each_ItemId;
+            Json::Value each_ItemInstanceId; ToJsonUtilS(ItemInstanceId, each_ItemInstanceId); ToJsonField(output, keyItemInstanceId) = each_ItemInstanceId;
+            Json::Value each_PurchaseDate; ToJsonUtilT(PurchaseDate, each_PurchaseDate); ToJsonField(output, keyPurchaseDate) = each_PurchaseDate;
+            Json::Value each_RemainingUses; ToJsonUtilP(RemainingUses, each_RemainingUses); ToJsonField(output, keyRemainingUses) = each_RemainingUses;
+            Json::Value each_UnitCurrency; ToJsonUtilS(UnitCurrency, each_UnitCurrency); ToJsonField(output, keyUnitCurrency) = each_UnitCurrency;
+            Json::Value each_UnitPrice; ToJsonUtilP(UnitPrice, each_UnitPrice); ToJsonField(output, keyUnitPrice) = each_UnitPrice;
+            Json::Value each_UsesIncrementedBy; ToJsonUtilP(UsesIncrementedBy, each_UsesIncrementedBy); ToJsonField(output, keyUsesIncrementedBy) = each_UsesIncrementedBy;
+            return output;
+        }
+
+        void PlayerJoinedRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyLobbyId), LobbyId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value PlayerJoinedRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_LobbyId; ToJsonUtilS(LobbyId, each_LobbyId); ToJsonField(output, keyLobbyId) = each_LobbyId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void PlayerJoinedResponse::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value PlayerJoinedResponse::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void PlayerLeftRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyLobbyId), LobbyId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value PlayerLeftRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_LobbyId; ToJsonUtilS(LobbyId, each_LobbyId); ToJsonField(output, keyLobbyId) = each_LobbyId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void PlayerLeftResponse::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value PlayerLeftResponse::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void StartGameRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBuild), Build);
+            FromJsonUtilS(FromJsonField(input, keyCustomCommandLineData), CustomCommandLineData);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyExternalMatchmakerEventEndpoint), ExternalMatchmakerEventEndpoint);
+            FromJsonUtilS(FromJsonField(input, keyGameMode), GameMode);
+            FromJsonEnum(FromJsonField(input, keyRegion), pfRegion);
+        }
+
+        Json::Value StartGameRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Build; ToJsonUtilS(Build, each_Build); ToJsonField(output, keyBuild) = each_Build;
+            Json::Value each_CustomCommandLineData; ToJsonUtilS(CustomCommandLineData, each_CustomCommandLineData); ToJsonField(output, keyCustomCommandLineData) = each_CustomCommandLineData;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ExternalMatchmakerEventEndpoint; ToJsonUtilS(ExternalMatchmakerEventEndpoint, each_ExternalMatchmakerEventEndpoint); ToJsonField(output, keyExternalMatchmakerEventEndpoint) = each_ExternalMatchmakerEventEndpoint;
+            Json::Value each_GameMode; ToJsonUtilS(GameMode, each_GameMode); ToJsonField(output, keyGameMode) = each_GameMode;
+            Json::Value each_pfRegion; ToJsonEnum(pfRegion, each_pfRegion); ToJsonField(output, keyRegion) = each_pfRegion;
+            return output;
+        }
+
+        void StartGameResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyGameID), GameID);
+            FromJsonUtilS(FromJsonField(input, keyServerIPV4Address), ServerIPV4Address);
+            FromJsonUtilS(FromJsonField(input, keyServerIPV6Address), ServerIPV6Address);
+            FromJsonUtilP(FromJsonField(input, keyServerPort), ServerPort);
+            FromJsonUtilS(FromJsonField(input, keyServerPublicDNSName), ServerPublicDNSName);
+        }
+
+        Json::Value StartGameResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GameID; ToJsonUtilS(GameID, each_GameID); ToJsonField(output, keyGameID) = each_GameID;
+            Json::Value each_ServerIPV4Address; ToJsonUtilS(ServerIPV4Address, each_ServerIPV4Address); ToJsonField(output, keyServerIPV4Address) = each_ServerIPV4Address;
+            Json::Value each_ServerIPV6Address; ToJsonUtilS(ServerIPV6Address, each_ServerIPV6Address); ToJsonField(output, keyServerIPV6Address) = each_ServerIPV6Address;
+            Json::Value each_ServerPort; ToJsonUtilP(ServerPort, each_ServerPort); ToJsonField(output, keyServerPort) = each_ServerPort;
+            Json::Value each_ServerPublicDNSName; ToJsonUtilS(ServerPublicDNSName, each_ServerPublicDNSName); ToJsonField(output, keyServerPublicDNSName) = each_ServerPublicDNSName;
+            return output;
+        }
+
+        void UserInfoRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyMinCatalogVersion), MinCatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value UserInfoRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_MinCatalogVersion; ToJsonUtilP(MinCatalogVersion, each_MinCatalogVersion); ToJsonField(output, keyMinCatalogVersion) = each_MinCatalogVersion;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void VirtualCurrencyRechargeTime::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyRechargeMax), RechargeMax);
+            FromJsonUtilT(FromJsonField(input, keyRechargeTime), RechargeTime);
+            FromJsonUtilP(FromJsonField(input, keySecondsToRecharge), SecondsToRecharge);
+        }
+
+        Json::Value VirtualCurrencyRechargeTime::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_RechargeMax; ToJsonUtilP(RechargeMax, each_RechargeMax); ToJsonField(output, keyRechargeMax) = each_RechargeMax;
+            Json::Value each_RechargeTime; ToJsonUtilT(RechargeTime, each_RechargeTime); ToJsonField(output, keyRechargeTime) = each_RechargeTime;
+            Json::Value each_SecondsToRecharge; ToJsonUtilP(SecondsToRecharge, each_SecondsToRecharge); ToJsonField(output, keySecondsToRecharge) = each_SecondsToRecharge;
+            return output;
+        }
+
+        void UserInfoResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyInventory), Inventory);
+            FromJsonUtilP(FromJsonField(input, keyIsDeveloper), IsDeveloper);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keySteamId), SteamId);
+            FromJsonUtilS(FromJsonField(input, keyTitleDisplayName), TitleDisplayName);
+            FromJsonUtilS(FromJsonField(input, keyUsername), Username);
+            FromJsonUtilP(FromJsonField(input, keyVirtualCurrency), VirtualCurrency);
+            FromJsonUtilO(FromJsonField(input, keyVirtualCurrencyRechargeTimes), VirtualCurrencyRechargeTimes);
+        }
+
+        Json::Value UserInfoResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Inventory; ToJsonUtilO(Inventory, each_Inventory); ToJsonField(output, keyInventory) = each_Inventory;
+            Json::Value each_IsDeveloper; ToJsonUtilP(IsDeveloper, each_IsDeveloper); ToJsonField(output, keyIsDeveloper) = each_IsDeveloper;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_SteamId; ToJsonUtilS(SteamId, each_SteamId); ToJsonField(output, keySteamId) = each_SteamId;
+            Json::Value each_TitleDisplayName; ToJsonUtilS(TitleDisplayName, each_TitleDisplayName); ToJsonField(output, keyTitleDisplayName) = each_TitleDisplayName;
+            Json::Value each_Username; ToJsonUtilS(Username, each_Username); ToJsonField(output, keyUsername) = each_Username;
+            Json::Value each_VirtualCurrency; ToJsonUtilP(VirtualCurrency, each_VirtualCurrency); ToJsonField(output, keyVirtualCurrency) = each_VirtualCurrency;
+            Json::Value each_VirtualCurrencyRechargeTimes; ToJsonUtilO(VirtualCurrencyRechargeTimes, each_VirtualCurrencyRechargeTimes); ToJsonField(output, keyVirtualCurrencyRechargeTimes) = each_VirtualCurrencyRechargeTimes;
+            return output;
+        }
+    }
+}
+
+#endif
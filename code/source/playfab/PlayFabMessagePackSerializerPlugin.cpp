@@ -0,0 +1,508 @@
+#include <stdafx.h>
+
+#include <playfab/PlayFabMessagePackSerializerPlugin.h>
+
+#include <cstring>
+#include <limits>
+
+namespace PlayFab
+{
+    namespace
+    {
+        // MessagePack format markers (https://github.com/msgpack/msgpack/blob/master/spec.md)
+        enum MessagePackMarker : uint8_t
+        {
+            MsgPackPositiveFixIntMax = 0x7f,
+            MsgPackFixMap = 0x80,
+            MsgPackFixArray = 0x90,
+            MsgPackFixStr = 0xa0,
+            MsgPackNil = 0xc0,
+            MsgPackFalse = 0xc2,
+            MsgPackTrue = 0xc3,
+            MsgPackBin8 = 0xc4,
+            MsgPackBin16 = 0xc5,
+            MsgPackBin32 = 0xc6,
+            MsgPackFloat32 = 0xca,
+            MsgPackFloat64 = 0xcb,
+            MsgPackUInt8 = 0xcc,
+            MsgPackUInt16 = 0xcd,
+            MsgPackUInt32 = 0xce,
+            MsgPackUInt64 = 0xcf,
+            MsgPackInt8 = 0xd0,
+            MsgPackInt16 = 0xd1,
+            MsgPackInt32 = 0xd2,
+            MsgPackInt64 = 0xd3,
+            MsgPackStr8 = 0xd9,
+            MsgPackStr16 = 0xda,
+            MsgPackStr32 = 0xdb,
+            MsgPackArray16 = 0xdc,
+            MsgPackArray32 = 0xdd,
+            MsgPackMap16 = 0xde,
+            MsgPackMap32 = 0xdf,
+            MsgPackNegativeFixIntMin = 0xe0,
+        };
+
+        // Deeper data than this is rejected when reading, so malformed input can't exhaust the stack
+        constexpr size_t maxMessagePackDepth = 256;
+
+        void WriteMarker(std::string& output, uint8_t marker)
+        {
+            output.push_back(static_cast<char>(marker));
+        }
+
+        void WriteBigEndian(std::string& output, uint64_t value, size_t byteCount)
+        {
+            for (size_t i = byteCount; i > 0; --i)
+            {
+                output.push_back(static_cast<char>((value >> ((i - 1) * 8)) & 0xff));
+            }
+        }
+
+        void WriteUInt(std::string& output, uint64_t value)
+        {
+            if (value <= MsgPackPositiveFixIntMax)
+            {
+                WriteMarker(output, static_cast<uint8_t>(value));
+            }
+            else if (value <= std::numeric_limits<uint8_t>::max())
+            {
+                WriteMarker(output, MsgPackUInt8);
+                WriteBigEndian(output, value, 1);
+            }
+            else if (value <= std::numeric_limits<uint16_t>::max())
+            {
+                WriteMarker(output, MsgPackUInt16);
+                WriteBigEndian(output, value, 2);
+            }
+            else if (value <= std::numeric_limits<uint32_t>::max())
+            {
+                WriteMarker(output, MsgPackUInt32);
+                WriteBigEndian(output, value, 4);
+            }
+            else
+            {
+                WriteMarker(output, MsgPackUInt64);
+                WriteBigEndian(output, value, 8);
+            }
+        }
+
+        void WriteInt(std::string& output, int64_t value)
+        {
+            if (value >= 0)
+            {
+                WriteUInt(output, static_cast<uint64_t>(value));
+            }
+            else if (value >= -32)
+            {
+                WriteMarker(output, static_cast<uint8_t>(value));
+            }
+            else if (value >= std::numeric_limits<int8_t>::min())
+            {
+                WriteMarker(output, MsgPackInt8);
+                WriteBigEndian(output, static_cast<uint64_t>(value), 1);
+            }
+            else if (value >= std::numeric_limits<int16_t>::min())
+            {
+                WriteMarker(output, MsgPackInt16);
+                WriteBigEndian(output, static_cast<uint64_t>(value), 2);
+            }
+            else if (value >= std::numeric_limits<int32_t>::min())
+            {
+                WriteMarker(output, MsgPackInt32);
+                WriteBigEndian(output, static_cast<uint64_t>(value), 4);
+            }
+            else
+            {
+                WriteMarker(output, MsgPackInt64);
+                WriteBigEndian(output, static_cast<uint64_t>(value), 8);
+            }
+        }
+
+        void WriteDouble(std::string& output, double value)
+        {
+            uint64_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            WriteMarker(output, MsgPackFloat64);
+            WriteBigEndian(output, bits, 8);
+        }
+
+        // Writes the header of a str, array or map: the fix form when size fits, otherwise the 8 (str only), 16 or 32 bit form
+        void WriteHeader(std::string& output, size_t size, uint8_t fixMarker, size_t fixMax, uint8_t marker8, uint8_t marker16, uint8_t marker32)
+        {
+            if (size <= fixMax)
+            {
+                WriteMarker(output, static_cast<uint8_t>(fixMarker | size));
+            }
+            else if (marker8 != 0 && size <= std::numeric_limits<uint8_t>::max())
+            {
+                WriteMarker(output, marker8);
+                WriteBigEndian(output, size, 1);
+            }
+            else if (size <= std::numeric_limits<uint16_t>::max())
+            {
+                WriteMarker(output, marker16);
+                WriteBigEndian(output, size, 2);
+            }
+            else
+            {
+                WriteMarker(output, marker32);
+                WriteBigEndian(output, size, 4);
+            }
+        }
+
+        void WriteString(std::string& output, const char* begin, const char* end)
+        {
+            const size_t length = static_cast<size_t>(end - begin);
+            WriteHeader(output, length, MsgPackFixStr, 31, MsgPackStr8, MsgPackStr16, MsgPackStr32);
+            output.append(begin, length);
+        }
+
+        void WriteValue(std::string& output, const Json::Value& input)
+        {
+            switch (input.type())
+            {
+            case Json::nullValue:
+                WriteMarker(output, MsgPackNil);
+                break;
+            case Json::intValue:
+                WriteInt(output, input.asLargestInt());
+                break;
+            case Json::uintValue:
+                WriteUInt(output, input.asLargestUInt());
+                break;
+            case Json::realValue:
+                WriteDouble(output, input.asDouble());
+                break;
+            case Json::stringValue:
+            {
+                const char* begin = nullptr;
+                const char* end = nullptr;
+                input.getString(&begin, &end);
+                WriteString(output, begin, end);
+                break;
+            }
+            case Json::booleanValue:
+                WriteMarker(output, input.asBool() ? MsgPackTrue : MsgPackFalse);
+                break;
+            case Json::arrayValue:
+                WriteHeader(output, input.size(), MsgPackFixArray, 15, 0, MsgPackArray16, MsgPackArray32);
+                for (const Json::Value& element : input)
+                {
+                    WriteValue(output, element);
+                }
+                break;
+            case Json::objectValue:
+                WriteHeader(output, input.size(), MsgPackFixMap, 15, 0, MsgPackMap16, MsgPackMap32);
+                for (auto member = input.begin(); member != input.end(); ++member)
+                {
+                    const char* keyEnd = nullptr;
+                    const char* key = member.memberName(&keyEnd);
+                    WriteString(output, key, keyEnd);
+                    WriteValue(output, *member);
+                }
+                break;
+            }
+        }
+
+        /// <summary>
+        /// Reads one MessagePack value at a time from a byte range, reporting the first problem found in errors.
+        /// </summary>
+        class MessagePackReader
+        {
+        public:
+            MessagePackReader(const char* data, size_t length, std::string& errors) :
+                position(reinterpret_cast<const uint8_t*>(data)),
+                end(reinterpret_cast<const uint8_t*>(data) + length),
+                errors(errors)
+            {
+            }
+
+            bool ReadDocument(Json::Value& output)
+            {
+                if (!ReadValue(output, 0))
+                {
+                    return false;
+                }
+                if (position != end)
+                {
+                    return Fail("Unexpected data after the end of the MessagePack value");
+                }
+                return true;
+            }
+
+        private:
+            bool Fail(const char* message)
+            {
+                errors = message;
+                return false;
+            }
+
+            size_t Remaining() const
+            {
+                return static_cast<size_t>(end - position);
+            }
+
+            bool ReadBigEndian(size_t byteCount, uint64_t& value)
+            {
+                if (Remaining() < byteCount)
+                {
+                    return Fail("MessagePack data ended unexpectedly");
+                }
+                value = 0;
+                for (size_t i = 0; i < byteCount; ++i)
+                {
+                    value = (value << 8) | *position++;
+                }
+                return true;
+            }
+
+            // Follows jsoncpp's own parsing: integers that fit in a signed 64 bit value are stored signed
+            static Json::Value MakeUInt(uint64_t value)
+            {
+                if (value <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max()))
+                {
+                    return Json::Value(static_cast<Json::LargestInt>(value));
+                }
+                return Json::Value(static_cast<Json::LargestUInt>(value));
+            }
+
+            bool ReadSignedInt(size_t byteCount, Json::Value& output)
+            {
+                uint64_t bits;
+                if (!ReadBigEndian(byteCount, bits))
+                {
+                    return false;
+                }
+                // Sign-extend from byteCount bytes
+                const unsigned int unusedBits = static_cast<unsigned int>(64 - byteCount * 8);
+                const int64_t value = (unusedBits == 0) ? static_cast<int64_t>(bits) : static_cast<int64_t>(bits << unusedBits) >> unusedBits;
+                output = Json::Value(static_cast<Json::LargestInt>(value));
+                return true;
+            }
+
+            bool ReadString(size_t length, Json::Value& output)
+            {
+                if (Remaining() < length)
+                {
+                    return Fail("MessagePack string is longer than the remaining data");
+                }
+                const char* begin = reinterpret_cast<const char*>(position);
+                output = Json::Value(begin, begin + length);
+                position += length;
+                return true;
+            }
+
+            bool ReadArray(size_t count, Json::Value& output, size_t depth)
+            {
+                // Every element takes at least one byte, so a larger count can only come from malformed data
+                if (Remaining() < count)
+                {
+                    return Fail("MessagePack array has more elements than the remaining data");
+                }
+                output = Json::Value(Json::arrayValue);
+                if (count > 0)
+                {
+                    output.resize(static_cast<Json::ArrayIndex>(count));
+                }
+                for (size_t i = 0; i < count; ++i)
+                {
+                    if (!ReadValue(output[static_cast<Json::ArrayIndex>(i)], depth + 1))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            bool ReadMap(size_t count, Json::Value& output, size_t depth)
+            {
+                // Every entry takes at least two bytes (key and value)
+                if (Remaining() / 2 < count)
+                {
+                    return Fail("MessagePack map has more entries than the remaining data");
+                }
+                output = Json::Value(Json::objectValue);
+                std::string key;
+                for (size_t i = 0; i < count; ++i)
+                {
+                    if (!ReadKey(key))
+                    {
+                        return false;
+                    }
+                    if (!ReadValue(output[key], depth + 1))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            bool ReadKey(std::string& key)
+            {
+                uint64_t length;
+                if (Remaining() < 1)
+                {
+                    return Fail("MessagePack data ended unexpectedly");
+                }
+                const uint8_t marker = *position++;
+                if ((marker & 0xe0) == MsgPackFixStr)
+                {
+                    length = marker & 0x1f;
+                }
+                else if (marker == MsgPackStr8 || marker == MsgPackStr16 || marker == MsgPackStr32)
+                {
+                    if (!ReadBigEndian(static_cast<size_t>(1) << (marker - MsgPackStr8), length))
+                    {
+                        return false;
+                    }
+                }
+                else
+                {
+                    return Fail("MessagePack map keys must be strings");
+                }
+
+                if (Remaining() < length)
+                {
+                    return Fail("MessagePack string is longer than the remaining data");
+                }
+                key.assign(reinterpret_cast<const char*>(position), static_cast<size_t>(length));
+                position += length;
+                return true;
+            }
+
+            bool ReadValue(Json::Value& output, size_t depth)
+            {
+                if (depth > maxMessagePackDepth)
+                {
+                    return Fail("MessagePack data is nested too deeply");
+                }
+                if (Remaining() < 1)
+                {
+                    return Fail("MessagePack data ended unexpectedly");
+                }
+
+                const uint8_t marker = *position++;
+                if (marker <= MsgPackPositiveFixIntMax)
+                {
+                    output = Json::Value(static_cast<Json::LargestInt>(marker));
+                    return true;
+                }
+                if (marker >= MsgPackNegativeFixIntMin)
+                {
+                    output = Json::Value(static_cast<Json::LargestInt>(static_cast<int8_t>(marker)));
+                    return true;
+                }
+                if ((marker & 0xf0) == MsgPackFixMap)
+                {
+                    return ReadMap(marker & 0x0f, output, depth);
+                }
+                if ((marker & 0xf0) == MsgPackFixArray)
+                {
+                    return ReadArray(marker & 0x0f, output, depth);
+                }
+                if ((marker & 0xe0) == MsgPackFixStr)
+                {
+                    return ReadString(marker & 0x1f, output);
+                }
+
+                uint64_t value;
+                switch (marker)
+                {
+                case MsgPackNil:
+                    output = Json::Value(Json::nullValue);
+                    return true;
+                case MsgPackFalse:
+                    output = Json::Value(false);
+                    return true;
+                case MsgPackTrue:
+                    output = Json::Value(true);
+                    return true;
+                case MsgPackFloat32:
+                {
+                    if (!ReadBigEndian(4, value))
+                    {
+                        return false;
+                    }
+                    const uint32_t bits = static_cast<uint32_t>(value);
+                    float floatValue;
+                    std::memcpy(&floatValue, &bits, sizeof(floatValue));
+                    output = Json::Value(static_cast<double>(floatValue));
+                    return true;
+                }
+                case MsgPackFloat64:
+                {
+                    if (!ReadBigEndian(8, value))
+                    {
+                        return false;
+                    }
+                    double doubleValue;
+                    std::memcpy(&doubleValue, &value, sizeof(doubleValue));
+                    output = Json::Value(doubleValue);
+                    return true;
+                }
+                case MsgPackUInt8:
+                case MsgPackUInt16:
+                case MsgPackUInt32:
+                case MsgPackUInt64:
+                    if (!ReadBigEndian(static_cast<size_t>(1) << (marker - MsgPackUInt8), value))
+                    {
+                        return false;
+                    }
+                    output = MakeUInt(value);
+                    return true;
+                case MsgPackInt8:
+                case MsgPackInt16:
+                case MsgPackInt32:
+                case MsgPackInt64:
+                    return ReadSignedInt(static_cast<size_t>(1) << (marker - MsgPackInt8), output);
+                case MsgPackStr8:
+                case MsgPackStr16:
+                case MsgPackStr32:
+                    // Binary data has no json equivalent, so it is read as a string with the same bytes
+                case MsgPackBin8:
+                case MsgPackBin16:
+                case MsgPackBin32:
+                {
+                    const uint8_t firstMarker = (marker >= MsgPackStr8) ? MsgPackStr8 : MsgPackBin8;
+                    if (!ReadBigEndian(static_cast<size_t>(1) << (marker - firstMarker), value))
+                    {
+                        return false;
+                    }
+                    return ReadString(static_cast<size_t>(value), output);
+                }
+                case MsgPackArray16:
+                case MsgPackArray32:
+                    if (!ReadBigEndian((marker == MsgPackArray16) ? 2 : 4, value))
+                    {
+                        return false;
+                    }
+                    return ReadArray(static_cast<size_t>(value), output, depth);
+                case MsgPackMap16:
+                case MsgPackMap32:
+                    if (!ReadBigEndian((marker == MsgPackMap16) ? 2 : 4, value))
+                    {
+                        return false;
+                    }
+                    return ReadMap(static_cast<size_t>(value), output, depth);
+                default:
+                    return Fail("Unsupported MessagePack type (extension types are not supported)");
+                }
+            }
+
+            const uint8_t* position;
+            const uint8_t* const end;
+            std::string& errors;
+        };
+    }
+
+    void PlayFabMessagePackSerializerPlugin::Serialize(const Json::Value& input, std::string& output)
+    {
+        WriteValue(output, input);
+    }
+
+    bool PlayFabMessagePackSerializerPlugin::Deserialize(const char* data, size_t length, Json::Value& output, std::string& errors)
+    {
+        MessagePackReader reader(data, length, errors);
+        return reader.ReadDocument(output);
+    }
+}
@@ -0,0 +1,524 @@
+#include <stdafx.h>
+
+#ifndef DISABLE_PLAYFABENTITY_API
+
+#include <playfab/PlayFabMetricAggregator.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace PlayFab
+{
+    namespace
+    {
+        // The layout of histogram buckets: bucket 0 takes the samples below 2^minimalBucketExponent (and any which are not positive),
+        // the last bucket the samples from 2^maximalBucketExponent, and the buckets in between each cover a quarter of a power of 2
+        constexpr int bucketsPerPowerOf2 = 4;
+        constexpr int minimalBucketExponent = -10;
+        constexpr int maximalBucketExponent = 30;
+        constexpr size_t bucketCount = (maximalBucketExponent - minimalBucketExponent) * bucketsPerPowerOf2 + 2;
+
+        size_t GetBucketIndex(double value)
+        {
+            if (!(value >= std::ldexp(1.0, minimalBucketExponent)))
+            {
+                return 0;
+            }
+            if (value >= std::ldexp(1.0, maximalBucketExponent))
+            {
+                return bucketCount - 1;
+            }
+            const double offset = (std::log2(value) - minimalBucketExponent) * bucketsPerPowerOf2;
+            return std::min(bucketCount - 2, static_cast<size_t>(offset)) + 1;
+        }
+
+        // The lower bound of a bucket in between the first and the last one
+        double GetBucketLowerBound(size_t index)
+        {
+            return std::exp2(minimalBucketExponent + static_cast<double>(index - 1) / bucketsPerPowerOf2);
+        }
+
+        const char* GetMetricTypeName(PlayFabMetricType type)
+        {
+            switch (type)
+            {
+            case PlayFabMetricType::Gauge:
+                return "Gauge";
+            case PlayFabMetricType::Histogram:
+                return "Histogram";
+            case PlayFabMetricType::Counter:
+            default:
+                return "Counter";
+            }
+        }
+    }
+
+    /// <summary>
+    /// The updates of a metric folded together
+    /// </summary>
+    struct PlayFabMetricState
+    {
+        uint64_t count = 0; // The number of updates
+        double sum = 0;
+        double minimum = 0;
+        double maximum = 0;
+        double lastValue = 0; // The value a gauge was last set to
+        std::chrono::steady_clock::rep lastUpdateTime = 0; // When lastValue was set, to find the latest one across shards
+        std::vector<uint64_t> buckets; // The number of samples of a histogram in each bucket. Allocated on the first sample.
+
+        void Add(PlayFabMetricType type, double value)
+        {
+            minimum = (count == 0) ? value : std::min(minimum, value);
+            maximum = (count == 0) ? value : std::max(maximum, value);
+            ++count;
+            sum += value;
+
+            if (type == PlayFabMetricType::Gauge)
+            {
+                lastValue = value;
+                lastUpdateTime = std::chrono::steady_clock::now().time_since_epoch().count();
+            }
+            else if (type == PlayFabMetricType::Histogram)
+            {
+                if (buckets.empty())
+                {
+                    buckets.resize(bucketCount);
+                }
+                ++buckets[GetBucketIndex(value)];
+            }
+        }
+
+        void Fold(const PlayFabMetricState& other)
+        {
+            minimum = (count == 0) ? other.minimum : std::min(minimum, other.minimum);
+            maximum = (count == 0) ? other.maximum : std::max(maximum, other.maximum);
+            count += other.count;
+            sum += other.sum;
+
+            if (other.lastUpdateTime >= lastUpdateTime)
+            {
+                lastValue = other.lastValue;
+                lastUpdateTime = other.lastUpdateTime;
+            }
+
+            if (!other.buckets.empty())
+            {
+                buckets.resize(bucketCount);
+                for (size_t i = 0; i < bucketCount; ++i)
+                {
+                    buckets[i] += other.buckets[i];
+                }
+            }
+        }
+
+        // Clears the updates, keeping the buckets allocated
+        void Reset()
+        {
+            count = 0;
+            sum = 0;
+            lastUpdateTime = 0;
+            std::fill(buckets.begin(), buckets.end(), 0);
+        }
+
+        // Estimates a percentile of the samples of a histogram, as the geometric middle of the bucket it falls in
+        double GetPercentile(double percentile) const
+        {
+            if (buckets.empty())
+            {
+                // no samples were recorded as a histogram
+                return maximum;
+            }
+
+            const uint64_t rank = static_cast<uint64_t>(std::ceil(percentile / 100 * count));
+            uint64_t seen = 0;
+            for (size_t i = 0; i < bucketCount; ++i)
+            {
+                seen += buckets[i];
+                if (seen >= rank && buckets[i] > 0)
+                {
+                    if (i == 0)
+                    {
+                        return minimum;
+                    }
+                    if (i == bucketCount - 1)
+                    {
+                        return maximum;
+                    }
+                    const double middle = GetBucketLowerBound(i) * std::exp2(0.5 / bucketsPerPowerOf2);
+                    return std::max(minimum, std::min(maximum, middle));
+                }
+            }
+            return maximum;
+        }
+    };
+
+    /// <summary>
+    /// The metric states of one updating thread in a PlayFabMetricAggregator. It is attached to one thread at a time,
+    /// and reattached to another thread once its thread exits, so there are at most as many shards as concurrent updating threads.
+    /// </summary>
+    class PlayFabMetricShard final
+    {
+    public:
+        PlayFabMetricShard() :
+            activeSide(0),
+            updatingSide(-1),
+            attached(true)
+        {
+        }
+
+        std::atomic<int> activeSide; // The side updates are folded into. Only a flush switches it.
+        std::atomic<int> updatingSide; // The side the attached thread is folding an update into, or -1
+        std::atomic<bool> attached; // Whether a thread is attached
+        std::vector<PlayFabMetricType> metricTypes; // The types of the metrics by index, copied from the aggregator when the attached thread
+                                                    // first updates a metric past its end. Only touched by the attached thread.
+        std::vector<PlayFabMetricState> sides[2]; // The states of the metrics by index. A side is only touched by the attached thread while it is active,
+                                                  // and only by a flush after that.
+    };
+
+    namespace
+    {
+        std::atomic<uint64_t> nextAggregatorId(1);
+
+        // A per-thread cache of the shards this thread is attached to, by the id of their aggregator.
+        // It holds the shards strongly, so a shard is detached when its thread exits even if the aggregator is gone.
+        struct MetricShardCache
+        {
+            struct Entry
+            {
+                uint64_t aggregatorId = 0;
+                std::shared_ptr<PlayFabMetricShard> shard;
+            };
+
+            ~MetricShardCache()
+            {
+                for (Entry& entry : entries)
+                {
+                    Detach(entry);
+                }
+            }
+
+            static void Detach(Entry& entry)
+            {
+                if (entry.shard != nullptr)
+                {
+                    entry.shard->attached.store(false, std::memory_order_release);
+                    entry.shard.reset();
+                }
+                entry.aggregatorId = 0;
+            }
+
+            // A thread which updates the metrics of more aggregators than this at once changes shards as they are evicted
+            static constexpr size_t entryCount = 4;
+            Entry entries[entryCount];
+            size_t nextEviction = 0;
+        };
+
+        MetricShardCache& GetMetricShardCache()
+        {
+            static thread_local MetricShardCache cache;
+            return cache;
+        }
+    }
+
+    struct PlayFabMetricAggregator::Metric
+    {
+        PlayFabMetricType type;
+        std::string name;
+        PlayFabMetricDimensions dimensions;
+    };
+
+    PlayFabMetricAggregator::PlayFabMetricAggregator(const std::shared_ptr<IPlayFabEventPipeline>& pipeline, std::chrono::milliseconds interval, bool useBackgroundThread) :
+        pipeline(pipeline),
+        interval(interval),
+        aggregatorId(nextAggregatorId.fetch_add(1, std::memory_order_relaxed)),
+        metricCount(0),
+        intervalStarted(std::chrono::steady_clock::now()),
+        isWorkerThreadRunning(useBackgroundThread)
+    {
+        if (useBackgroundThread)
+        {
+            this->workerThread = std::thread(&PlayFabMetricAggregator::WorkerThread, this);
+        }
+    }
+
+    PlayFabMetricAggregator::~PlayFabMetricAggregator()
+    {
+        { // LOCK workerThreadMutex
+            std::unique_lock<std::mutex> lock(workerThreadMutex);
+            this->isWorkerThreadRunning = false;
+        } // UNLOCK workerThreadMutex
+        this->workerThreadWakeup.notify_one();
+        if (this->workerThread.joinable())
+        {
+            this->workerThread.join();
+        }
+
+        Flush();
+    }
+
+    PlayFabMetricId PlayFabMetricAggregator::GetMetricId(PlayFabMetricType type, const std::string& name, const PlayFabMetricDimensions& dimensions)
+    {
+        PlayFabMetricId metricId;
+        metricId.type = type;
+
+        // LOCK metricsMutex
+        std::unique_lock<std::mutex> lock(metricsMutex);
+        for (size_t i = 0; i < this->metrics.size(); ++i)
+        {
+            const Metric& metric = *this->metrics[i];
+            if (metric.type == type && metric.name == name && metric.dimensions == dimensions)
+            {
+                metricId.index = i;
+                return metricId;
+            }
+        }
+
+        metricId.index = this->metrics.size();
+        this->metrics.push_back(std::unique_ptr<Metric>(new Metric{ type, name, dimensions }));
+        this->metricCount.store(this->metrics.size(), std::memory_order_release);
+        return metricId;
+        // UNLOCK metricsMutex
+    }
+
+    void PlayFabMetricAggregator::Update(const PlayFabMetricId& metricId, double value)
+    {
+        if (metricId.index >= this->metricCount.load(std::memory_order_acquire))
+        {
+            // not registered, or registered with another aggregator which has more metrics; Flush has no metric to fold its updates into
+            return;
+        }
+
+        PlayFabMetricShard& shard = GetShard();
+        if (metricId.index >= shard.metricTypes.size())
+        {
+            // LOCK metricsMutex (before announcing a side, as a flush waits for the announced side with the lock held)
+            std::unique_lock<std::mutex> lock(metricsMutex);
+            for (size_t i = shard.metricTypes.size(); i < this->metrics.size(); ++i)
+            {
+                shard.metricTypes.push_back(this->metrics[i]->type);
+            }
+            // UNLOCK metricsMutex
+        }
+        if (shard.metricTypes[metricId.index] != metricId.type)
+        {
+            // registered with another aggregator as another type of metric; it would be folded into a state of the wrong layout
+            return;
+        }
+
+        // announce the side before folding into it, and check that a flush did not switch sides meanwhile.
+        // Either this thread then sees the switch, or the flush sees the side announced and waits for this update to finish.
+        int side = shard.activeSide.load(std::memory_order_seq_cst);
+        for (;;)
+        {
+            shard.updatingSide.store(side, std::memory_order_seq_cst);
+            const int activeSide = shard.activeSide.load(std::memory_order_seq_cst);
+            if (activeSide == side)
+            {
+                break;
+            }
+            side = activeSide;
+        }
+
+        std::vector<PlayFabMetricState>& states = shard.sides[side];
+        if (states.size() <= metricId.index)
+        {
+            states.resize(metricId.index + 1);
+        }
+        states[metricId.index].Add(metricId.type, value);
+
+        shard.updatingSide.store(-1, std::memory_order_release);
+    }
+
+    void PlayFabMetricAggregator::FlushIfDue()
+    {
+        bool isFlushDue;
+        { // LOCK metricsMutex
+            std::unique_lock<std::mutex> lock(metricsMutex);
+            isFlushDue = std::chrono::steady_clock::now() - this->intervalStarted >= this->interval;
+        } // UNLOCK metricsMutex
+
+        if (isFlushDue)
+        {
+            Flush();
+        }
+    }
+
+    void PlayFabMetricAggregator::Flush()
+    {
+        std::vector<PlayFabMetricState> totals;
+        std::vector<const Metric*> updatedMetrics;
+        std::chrono::milliseconds elapsed;
+        { // LOCK metricsMutex
+            std::unique_lock<std::mutex> lock(metricsMutex);
+            totals.resize(this->metrics.size());
+            for (const auto& shard : this->shards)
+            {
+                // switch the shard to its other side, and wait for an update of the previous side in progress
+                const int previousSide = shard->activeSide.load(std::memory_order_relaxed);
+                shard->activeSide.store(1 - previousSide, std::memory_order_seq_cst);
+                while (shard->updatingSide.load(std::memory_order_seq_cst) == previousSide)
+                {
+                    std::this_thread::yield();
+                }
+
+                std::vector<PlayFabMetricState>& states = shard->sides[previousSide];
+                const size_t stateCount = std::min(states.size(), totals.size());
+                for (size_t i = 0; i < stateCount; ++i)
+                {
+                    if (states[i].count > 0)
+                    {
+                        totals[i].Fold(states[i]);
+                        states[i].Reset();
+                    }
+                }
+            }
+
+            const auto now = std::chrono::steady_clock::now();
+            elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - this->intervalStarted);
+            this->intervalStarted = now;
+
+            // metrics are never removed, so they can be read once the lock is released
+            updatedMetrics.resize(totals.size());
+            for (size_t i = 0; i < totals.size(); ++i)
+            {
+                updatedMetrics[i] = this->metrics[i].get();
+            }
+        } // UNLOCK metricsMutex
+
+        for (size_t i = 0; i < totals.size(); ++i)
+        {
+            if (totals[i].count > 0)
+            {
+                EmitSummary(*updatedMetrics[i], totals[i], elapsed);
+            }
+        }
+    }
+
+    PlayFabMetricShard& PlayFabMetricAggregator::GetShard()
+    {
+        MetricShardCache& cache = GetMetricShardCache();
+        for (const MetricShardCache::Entry& entry : cache.entries)
+        {
+            if (entry.aggregatorId == this->aggregatorId)
+            {
+                return *entry.shard;
+            }
+        }
+
+        // the first update of this thread: attach a shard whose thread exited, or a new one
+        std::shared_ptr<PlayFabMetricShard> shard;
+        { // LOCK metricsMutex
+            std::unique_lock<std::mutex> lock(metricsMutex);
+            for (const auto& detachedShard : this->shards)
+            {
+                if (!detachedShard->attached.load(std::memory_order_acquire))
+                {
+                    detachedShard->attached.store(true, std::memory_order_relaxed);
+                    shard = detachedShard;
+                    break;
+                }
+            }
+
+            if (shard == nullptr)
+            {
+                shard = std::make_shared<PlayFabMetricShard>();
+                this->shards.push_back(shard);
+            }
+        } // UNLOCK metricsMutex
+
+        MetricShardCache::Entry& entry = cache.entries[cache.nextEviction];
+        cache.nextEviction = (cache.nextEviction + 1) % MetricShardCache::entryCount;
+        MetricShardCache::Detach(entry);
+        entry.aggregatorId = this->aggregatorId;
+        entry.shard = std::move(shard);
+        return *entry.shard;
+    }
+
+    void PlayFabMetricAggregator::EmitSummary(const Metric& metric, const PlayFabMetricState& state, std::chrono::milliseconds elapsed) const
+    {
+        auto event = std::make_shared<PlayFabEvent>();
+        event->eventType = PlayFabEventType::Lightweight;
+        event->SetName(metric.name);
+
+        Json::Value& payload = event->eventContents.Payload;
+        payload["MetricType"] = GetMetricTypeName(metric.type);
+        payload["IntervalInMs"] = static_cast<Json::Int64>(elapsed.count());
+        if (!metric.dimensions.empty())
+        {
+            Json::Value& dimensions = payload["Dimensions"];
+            for (const auto& dimension : metric.dimensions)
+            {
+                dimensions[dimension.first] = dimension.second;
+            }
+        }
+
+        payload["Count"] = static_cast<Json::UInt64>(state.count);
+        switch (metric.type)
+        {
+        case PlayFabMetricType::Gauge:
+        {
+            payload["Value"] = state.lastValue;
+            payload["Min"] = state.minimum;
+            payload["Max"] = state.maximum;
+        }
+        break;
+
+        case PlayFabMetricType::Histogram:
+        {
+            payload["Sum"] = state.sum;
+            payload["Min"] = state.minimum;
+            payload["Max"] = state.maximum;
+            payload["P50"] = state.GetPercentile(50);
+            payload["P90"] = state.GetPercentile(90);
+            payload["P99"] = state.GetPercentile(99);
+
+            // the non-empty buckets, as pairs of lower bound and count
+            Json::Value& buckets = payload["Buckets"];
+            buckets = Json::Value(Json::arrayValue);
+            for (size_t i = 0; i < state.buckets.size(); ++i)
+            {
+                if (state.buckets[i] > 0)
+                {
+                    Json::Value bucket(Json::arrayValue);
+                    bucket.append((i == 0) ? state.minimum : GetBucketLowerBound(i));
+                    bucket.append(static_cast<Json::UInt64>(state.buckets[i]));
+                    buckets.append(std::move(bucket));
+                }
+            }
+        }
+        break;
+
+        case PlayFabMetricType::Counter:
+        default:
+        {
+            payload["Sum"] = state.sum;
+        }
+        break;
+        }
+
+        // the summary is encoded here, off the pipeline thread
+        auto request = std::make_shared<PlayFabEmitEventRequest>();
+        request->serializedEvent = event->Serialize();
+        request->estimatedSize = request->serializedEvent.length() + 1;
+        request->event = std::move(event);
+        this->pipeline->IntakeEvent(request);
+    }
+
+    void PlayFabMetricAggregator::WorkerThread()
+    {
+        std::unique_lock<std::mutex> lock(workerThreadMutex);
+        while (this->isWorkerThreadRunning)
+        {
+            if (this->workerThreadWakeup.wait_for(lock, this->interval, [this]() { return !this->isWorkerThreadRunning; }))
+            {
+                break;
+            }
+
+            lock.unlock();
+            Flush();
+            lock.lock();
+        }
+    }
+}
+
+#endif
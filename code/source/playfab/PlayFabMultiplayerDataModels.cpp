@@ -0,0 +1,3690 @@
+#include <stdafx.h>
+
+#if !defined(DISABLE_PLAYFABENTITY_API)
+
+#include <playfab/PlayFabMultiplayerDataModels.h>
+
+namespace PlayFab
+{
+    namespace MultiplayerModels
+    {
+        namespace
+        {
+            // The json field names of the models below
+            constexpr PlayFabJsonKey keyActive("Active");
+            constexpr PlayFabJsonKey keyAliasId("AliasId");
+            constexpr PlayFabJsonKey keyAliasName("AliasName");
+            constexpr PlayFabJsonKey keyAreAssetsReadonly("AreAssetsReadonly");
+            constexpr PlayFabJsonKey keyAssetSummaries("AssetSummaries");
+            constexpr PlayFabJsonKey keyAssetUploadUrl("AssetUploadUrl");
+            constexpr PlayFabJsonKey keyAttributes("Attributes");
+            constexpr PlayFabJsonKey keyAvailable("Available");
+            constexpr PlayFabJsonKey keyAverage("Average");
+            constexpr PlayFabJsonKey keyBase64EncodedValue("Base64EncodedValue");
+            constexpr PlayFabJsonKey keyBuildAliasParams("BuildAliasParams");
+            constexpr PlayFabJsonKey keyBuildAliases("BuildAliases");
+            constexpr PlayFabJsonKey keyBuildId("BuildId");
+            constexpr PlayFabJsonKey keyBuildName("BuildName");
+            constexpr PlayFabJsonKey keyBuildRegion("BuildRegion");
+            constexpr PlayFabJsonKey keyBuildRegions("BuildRegions");
+            constexpr PlayFabJsonKey keyBuildSelectionCriteria("BuildSelectionCriteria");
+            constexpr PlayFabJsonKey keyBuildStatus("BuildStatus");
+            constexpr PlayFabJsonKey keyBuildSummaries("BuildSummaries");
+            constexpr PlayFabJsonKey keyBuildWeightDistribution("BuildWeightDistribution");
+            constexpr PlayFabJsonKey keyCancellationReasonString("CancellationReasonString");
+            constexpr PlayFabJsonKey keyCertificateSummaries("CertificateSummaries");
+            constexpr PlayFabJsonKey keyChange("Change");
+            constexpr PlayFabJsonKey keyChangeDescription("ChangeDescription");
+            constexpr PlayFabJsonKey keyChanges("Changes");
+            constexpr PlayFabJsonKey keyConnectedPlayers("ConnectedPlayers");
+            constexpr PlayFabJsonKey keyContactEmail("ContactEmail");
+            constexpr PlayFabJsonKey keyContainerFlavor("ContainerFlavor");
+            constexpr PlayFabJsonKey keyContainerImageReference("ContainerImageReference");
+            constexpr PlayFabJsonKey keyContainerRunCommand("ContainerRunCommand");
+            constexpr PlayFabJsonKey keyCoreCapacities("CoreCapacities");
+            constexpr PlayFabJsonKey keyCreated("Created");
+            constexpr PlayFabJsonKey keyCreationTime("CreationTime");
+            constexpr PlayFabJsonKey keyCreator("Creator");
+            constexpr PlayFabJsonKey keyCurrentServerStats("CurrentServerStats");
+            constexpr PlayFabJsonKey keyCustomGameContainerImage("CustomGameContainerImage");
+            constexpr PlayFabJsonKey keyCustomTags("CustomTags");
+            constexpr PlayFabJsonKey keyDataObject("DataObject");
+            constexpr PlayFabJsonKey keyDescription("Description");
+            constexpr PlayFabJsonKey keyDnsName("DnsName");
+            constexpr PlayFabJsonKey keyDynamicFloorMultiplierThresholds("DynamicFloorMultiplierThresholds");
+            constexpr PlayFabJsonKey keyDynamicStandbySettings("DynamicStandbySettings");
+            constexpr PlayFabJsonKey keyEndTime("EndTime");
+            constexpr PlayFabJsonKey keyEntity("Entity");
+            constexpr PlayFabJsonKey keyEscapeObject("EscapeObject");
+            constexpr PlayFabJsonKey keyEscapedDataObject("EscapedDataObject");
+            constexpr PlayFabJsonKey keyExpirationTime("ExpirationTime");
+            constexpr PlayFabJsonKey keyFQDN("FQDN");
+            constexpr PlayFabJsonKey keyFileName("FileName");
+            constexpr PlayFabJsonKey keyGameAssetReferences("GameAssetReferences");
+            constexpr PlayFabJsonKey keyGameCertificate("GameCertificate");
+            constexpr PlayFabJsonKey keyGameCertificateReferences("GameCertificateReferences");
+            constexpr PlayFabJsonKey keyGameWorkingDirectory("GameWorkingDirectory");
+            constexpr PlayFabJsonKey keyGiveUpAfterSeconds("GiveUpAfterSeconds");
+            constexpr PlayFabJsonKey keyGsdkAlias("GsdkAlias");
+            constexpr PlayFabJsonKey keyHealthStatus("HealthStatus");
+            constexpr PlayFabJsonKey keyIPV4Address("IPV4Address");
+            constexpr PlayFabJsonKey keyId("Id");
+            constexpr PlayFabJsonKey keyImageName("ImageName");
+            constexpr PlayFabJsonKey keyImages("Images");
+            constexpr PlayFabJsonKey keyIncludeAllRegions("IncludeAllRegions");
+            constexpr PlayFabJsonKey keyInitialPlayers("InitialPlayers");
+            constexpr PlayFabJsonKey keyInstrumentationConfiguration("InstrumentationConfiguration");
+            constexpr PlayFabJsonKey keyIsDisabled("IsDisabled");
+            constexpr PlayFabJsonKey keyIsEnabled("IsEnabled");
+            constexpr PlayFabJsonKey keyIsOSPreview("IsOSPreview");
+            constexpr PlayFabJsonKey keyIsPendingReview("IsPendingReview");
+            constexpr PlayFabJsonKey keyIsRecurringWeekly("IsRecurringWeekly");
+            constexpr PlayFabJsonKey keyLastStateTransitionTime("LastStateTransitionTime");
+            constexpr PlayFabJsonKey keyLinuxInstrumentationConfiguration("LinuxInstrumentationConfiguration");
+            constexpr PlayFabJsonKey keyLogDownloadUrl("LogDownloadUrl");
+            constexpr PlayFabJsonKey keyMatchId("MatchId");
+            constexpr PlayFabJsonKey keyMaxServers("MaxServers");
+            constexpr PlayFabJsonKey keyMember("Member");
+            constexpr PlayFabJsonKey keyMembers("Members");
+            constexpr PlayFabJsonKey keyMembersToMatchWith("MembersToMatchWith");
+            constexpr PlayFabJsonKey keyMetadata("Metadata");
+            constexpr PlayFabJsonKey keyMountPath("MountPath");
+            constexpr PlayFabJsonKey keyMultiplayerServerCountPerVm("MultiplayerServerCountPerVm");
+            constexpr PlayFabJsonKey keyMultiplayerServerSummaries("MultiplayerServerSummaries");
+            constexpr PlayFabJsonKey keyMultiplier("Multiplier");
+            constexpr PlayFabJsonKey keyName("Name");
+            constexpr PlayFabJsonKey keyNewCoreLimit("NewCoreLimit");
+            constexpr PlayFabJsonKey keyNotes("Notes");
+            constexpr PlayFabJsonKey keyNum("Num");
+            constexpr PlayFabJsonKey keyNumberOfPlayersMatching("NumberOfPlayersMatching");
+            constexpr PlayFabJsonKey keyOsPlatform("OsPlatform");
+            constexpr PlayFabJsonKey keyPageSize("PageSize");
+            constexpr PlayFabJsonKey keyPassword("Password");
+            constexpr PlayFabJsonKey keyPercentile50("Percentile50");
+            constexpr PlayFabJsonKey keyPercentile90("Percentile90");
+            constexpr PlayFabJsonKey keyPercentile99("Percentile99");
+            constexpr PlayFabJsonKey keyPlayerId("PlayerId");
+            constexpr PlayFabJsonKey keyPort("Port");
+            constexpr PlayFabJsonKey keyPorts("Ports");
+            constexpr PlayFabJsonKey keyPreferredRegions("PreferredRegions");
+            constexpr PlayFabJsonKey keyProcessesToMonitor("ProcessesToMonitor");
+            constexpr PlayFabJsonKey keyPropping("Propping");
+            constexpr PlayFabJsonKey keyProtocol("Protocol");
+            constexpr PlayFabJsonKey keyQosServers("QosServers");
+            constexpr PlayFabJsonKey keyQueueName("QueueName");
+            constexpr PlayFabJsonKey keyQuotas("Quotas");
+            constexpr PlayFabJsonKey keyRampDownSeconds("RampDownSeconds");
+            constexpr PlayFabJsonKey keyRegion("Region");
+            constexpr PlayFabJsonKey keyRegionConfigurations("RegionConfigurations");
+            constexpr PlayFabJsonKey keyRegionPreferences("RegionPreferences");
+            constexpr PlayFabJsonKey keyRequestId("RequestId");
+            constexpr PlayFabJsonKey keyReturnMemberAttributes("ReturnMemberAttributes");
+            constexpr PlayFabJsonKey keyReviewComments("ReviewComments");
+            constexpr PlayFabJsonKey keyScheduleList("ScheduleList");
+            constexpr PlayFabJsonKey keyScheduledStandbySettings("ScheduledStandbySettings");
+            constexpr PlayFabJsonKey keyServerDetails("ServerDetails");
+            constexpr PlayFabJsonKey keyServerId("ServerId");
+            constexpr PlayFabJsonKey keyServerType("ServerType");
+            constexpr PlayFabJsonKey keyServerUrl("ServerUrl");
+            constexpr PlayFabJsonKey keySessionCookie("SessionCookie");
+            constexpr PlayFabJsonKey keySessionId("SessionId");
+            constexpr PlayFabJsonKey keySkipToken("SkipToken");
+            constexpr PlayFabJsonKey keyStandbyServers("StandbyServers");
+            constexpr PlayFabJsonKey keyStandingBy("StandingBy");
+            constexpr PlayFabJsonKey keyStartDate("StartDate");
+            constexpr PlayFabJsonKey keyStartMultiplayerServerCommand("StartMultiplayerServerCommand");
+            constexpr PlayFabJsonKey keyStartTime("StartTime");
+            constexpr PlayFabJsonKey keyState("State");
+            constexpr PlayFabJsonKey keyStatus("Status");
+            constexpr PlayFabJsonKey keyTag("Tag");
+            constexpr PlayFabJsonKey keyTags("Tags");
+            constexpr PlayFabJsonKey keyTargetStandby("TargetStandby");
+            constexpr PlayFabJsonKey keyTeamId("TeamId");
+            constexpr PlayFabJsonKey keyThumbprint("Thumbprint");
+            constexpr PlayFabJsonKey keyTicketId("TicketId");
+            constexpr PlayFabJsonKey keyTicketIds("TicketIds");
+            constexpr PlayFabJsonKey keyTimeToMatchStatisticsInSeconds("TimeToMatchStatisticsInSeconds");
+            constexpr PlayFabJsonKey keyTotal("Total");
+            constexpr PlayFabJsonKey keyTriggerThresholdPercentage("TriggerThresholdPercentage");
+            constexpr PlayFabJsonKey keyType("Type");
+            constexpr PlayFabJsonKey keyUseStreamingForAssetDownloads("UseStreamingForAssetDownloads");
+            constexpr PlayFabJsonKey keyUsername("Username");
+            constexpr PlayFabJsonKey keyVirtualMachines("VirtualMachines");
+            constexpr PlayFabJsonKey keyVmFamily("VmFamily");
+            constexpr PlayFabJsonKey keyVmId("VmId");
+            constexpr PlayFabJsonKey keyVmSize("VmSize");
+            constexpr PlayFabJsonKey keyWasApproved("WasApproved");
+        }
+
+        void ToJsonEnum(const AzureRegion input, Json::Value& output)
+        {
+            if (input == AzureRegion::AzureRegionAustraliaEast)
+            {
+                output = Json::Value(Json::StaticString("AustraliaEast"));
+                return;
+            }
+            if (input == AzureRegion::AzureRegionAustraliaSoutheast)
+            {
+                output = Json::Value(Json::StaticString("AustraliaSoutheast"));
+                return;
+            }
+            if (input == AzureRegion::AzureRegionBrazilSouth)
+            {
+                output = Json::Value(Json::StaticString("BrazilSouth"));
+                return;
+            }
+            if (input == AzureRegion::AzureRegionCentralUs)
+            {
+                output = Json::Value(Json::StaticString("CentralUs"));
+                return;
+            }
+            if (input == AzureRegion::AzureRegionEastAsia)
+            {
+                output = Json::Value(Json::StaticString("EastAsia"));
+                return;
+            }
+            if (input == AzureRegion::AzureRegionEastUs)
+            {
+                output = Json::Value(Json::StaticString("EastUs"));
+                return;
+            }
+            if (input == AzureRegion::AzureRegionEastUs2)
+            {
+                output = Json::Value(Json::StaticString("EastUs2"));
+                return;
+            }
+            if (input == AzureRegion::AzureRegionJapanEast)
+            {
+                output = Json::Value(Json::StaticString("JapanEast"));
+                return;
+            }
+            if (input == AzureRegion::AzureRegionJapanWest)
+            {
+                output = Json::Value(Json::StaticString("JapanWest"));
+                return;
+            }
+            if (input == AzureRegion::AzureRegionNorthCentralUs)
+            {
+                output = Json::Value(Json::StaticString("NorthCentralUs"));
+                return;
+            }
+            if (input == AzureRegion::AzureRegionNorthEurope)
+            {
+                output = Json::Value(Json::StaticString("NorthEurope"));
+                return;
+            }
+            if (input == AzureRegion::AzureRegionSouthCentralUs)
+            {
+                output = Json::Value(Json::StaticString("SouthCentralUs"));
+                return;
+            }
+            if (input == AzureRegion::AzureRegionSoutheastAsia)
+            {
+                output = Json::Value(Json::StaticString("SoutheastAsia"));
+                return;
+            }
+            if (input == AzureRegion::AzureRegionWestEurope)
+            {
+                output = Json::Value(Json::StaticString("WestEurope"));
+                return;
+            }
+            if (input == AzureRegion::AzureRegionWestUs)
+            {
+                output = Json::Value(Json::StaticString("WestUs"));
+                return;
+            }
+            if (input == AzureRegion::AzureRegionChinaEast2)
+            {
+                output = Json::Value(Json::StaticString("ChinaEast2"));
+                return;
+            }
+            if (input == AzureRegion::AzureRegionChinaNorth2)
+            {
+                output = Json::Value(Json::StaticString("ChinaNorth2"));
+                return;
+            }
+            if (input == AzureRegion::AzureRegionSouthAfricaNorth)
+            {
+                output = Json::Value(Json::StaticString("SouthAfricaNorth"));
+                return;
+            }
+            if (input == AzureRegion::AzureRegionCentralUsEuap)
+            {
+                output = Json::Value(Json::StaticString("CentralUsEuap"));
+                return;
+            }
+            if (input == AzureRegion::AzureRegionWestCentralUs)
+            {
+                output = Json::Value(Json::StaticString("WestCentralUs"));
+                return;
+            }
+            if (input == AzureRegion::AzureRegionKoreaCentral)
+            {
+                output = Json::Value(Json::StaticString("KoreaCentral"));
+                return;
+            }
+            if (input == AzureRegion::AzureRegionFranceCentral)
+            {
+                output = Json::Value(Json::StaticString("FranceCentral"));
+                return;
+            }
+            if (input == AzureRegion::AzureRegionWestUs2)
+            {
+                output = Json::Value(Json::StaticString("WestUs2"));
+                return;
+            }
+            if (input == AzureRegion::AzureRegionCentralIndia)
+            {
+                output = Json::Value(Json::StaticString("CentralIndia"));
+                return;
+            }
+            if (input == AzureRegion::AzureRegionUaeNorth)
+            {
+                output = Json::Value(Json::StaticString("UaeNorth"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, AzureRegion& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "AustraliaEast")
+            {
+                output = AzureRegion::AzureRegionAustraliaEast;
+                return;
+            }
+            if (inputStr == "AustraliaSoutheast")
+            {
+                output = AzureRegion::AzureRegionAustraliaSoutheast;
+                return;
+            }
+            if (inputStr == "BrazilSouth")
+            {
+                output = AzureRegion::AzureRegionBrazilSouth;
+                return;
+            }
+            if (inputStr == "CentralUs")
+            {
+                output = AzureRegion::AzureRegionCentralUs;
+                return;
+            }
+            if (inputStr == "EastAsia")
+            {
+                output = AzureRegion::AzureRegionEastAsia;
+                return;
+            }
+            if (inputStr == "EastUs")
+            {
+                output = AzureRegion::AzureRegionEastUs;
+                return;
+            }
+            if (inputStr == "EastUs2")
+            {
+                output = AzureRegion::AzureRegionEastUs2;
+                return;
+            }
+            if (inputStr == "JapanEast")
+            {
+                output = AzureRegion::AzureRegionJapanEast;
+                return;
+            }
+            if (inputStr == "JapanWest")
+            {
+                output = AzureRegion::AzureRegionJapanWest;
+                return;
+            }
+            if (inputStr == "NorthCentralUs")
+            {
+                output = AzureRegion::AzureRegionNorthCentralUs;
+                return;
+            }
+            if (inputStr == "NorthEurope")
+            {
+                output = AzureRegion::AzureRegionNorthEurope;
+                return;
+            }
+            if (inputStr == "SouthCentralUs")
+            {
+                output = AzureRegion::AzureRegionSouthCentralUs;
+                return;
+            }
+            if (inputStr == "SoutheastAsia")
+            {
+                output = AzureRegion::AzureRegionSoutheastAsia;
+                return;
+            }
+            if (inputStr == "WestEurope")
+            {
+                output = AzureRegion::AzureRegionWestEurope;
+                return;
+            }
+            if (inputStr == "WestUs")
+            {
+                output = AzureRegion::AzureRegionWestUs;
+                return;
+            }
+            if (inputStr == "ChinaEast2")
+            {
+                output = AzureRegion::AzureRegionChinaEast2;
+                return;
+            }
+            if (inputStr == "ChinaNorth2")
+            {
+                output = AzureRegion::AzureRegionChinaNorth2;
+                return;
+            }
+            if (inputStr == "SouthAfricaNorth")
+            {
+                output = AzureRegion::AzureRegionSouthAfricaNorth;
+                return;
+            }
+            if (inputStr == "CentralUsEuap")
+            {
+                output = AzureRegion::AzureRegionCentralUsEuap;
+                return;
+            }
+            if (inputStr == "WestCentralUs")
+            {
+                output = AzureRegion::AzureRegionWestCentralUs;
+                return;
+            }
+            if (inputStr == "KoreaCentral")
+            {
+                output = AzureRegion::AzureRegionKoreaCentral;
+                return;
+            }
+            if (inputStr == "FranceCentral")
+            {
+                output = AzureRegion::AzureRegionFranceCentral;
+                return;
+            }
+            if (inputStr == "WestUs2")
+            {
+                output = AzureRegion::AzureRegionWestUs2;
+                return;
+            }
+            if (inputStr == "CentralIndia")
+            {
+                output = AzureRegion::AzureRegionCentralIndia;
+                return;
+            }
+            if (inputStr == "UaeNorth")
+            {
+                output = AzureRegion::AzureRegionUaeNorth;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const AzureVmFamily input, Json::Value& output)
+        {
+            if (input == AzureVmFamily::AzureVmFamilyA)
+            {
+                output = Json::Value(Json::StaticString("A"));
+                return;
+            }
+            if (input == AzureVmFamily::AzureVmFamilyAv2)
+            {
+                output = Json::Value(Json::StaticString("Av2"));
+                return;
+            }
+            if (input == AzureVmFamily::AzureVmFamilyDv2)
+            {
+                output = Json::Value(Json::StaticString("Dv2"));
+                return;
+            }
+            if (input == AzureVmFamily::AzureVmFamilyDv3)
+            {
+                output = Json::Value(Json::StaticString("Dv3"));
+                return;
+            }
+            if (input == AzureVmFamily::AzureVmFamilyF)
+            {
+                output = Json::Value(Json::StaticString("F"));
+                return;
+            }
+            if (input == AzureVmFamily::AzureVmFamilyFsv2)
+            {
+                output = Json::Value(Json::StaticString("Fsv2"));
+                return;
+            }
+            if (input == AzureVmFamily::AzureVmFamilyDasv4)
+            {
+                output = Json::Value(Json::StaticString("Dasv4"));
+                return;
+            }
+            if (input == AzureVmFamily::AzureVmFamilyDav4)
+            {
+                output = Json::Value(Json::StaticString("Dav4"));
+                return;
+            }
+            if (input == AzureVmFamily::AzureVmFamilyEav4)
+            {
+                output = Json::Value(Json::StaticString("Eav4"));
+                return;
+            }
+            if (input == AzureVmFamily::AzureVmFamilyEasv4)
+            {
+                output = Json::Value(Json::StaticString("Easv4"));
+                return;
+            }
+            if (input == AzureVmFamily::AzureVmFamilyEv4)
+            {
+                output = Json::Value(Json::StaticString("Ev4"));
+                return;
+            }
+            if (input == AzureVmFamily::AzureVmFamilyEsv4)
+            {
+                output = Json::Value(Json::StaticString("Esv4"));
+                return;
+            }
+            if (input == AzureVmFamily::AzureVmFamilyDsv3)
+            {
+                output = Json::Value(Json::StaticString("Dsv3"));
+                return;
+            }
+            if (input == AzureVmFamily::AzureVmFamilyDsv2)
+            {
+                output = Json::Value(Json::StaticString("Dsv2"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, AzureVmFamily& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "A")
+            {
+                output = AzureVmFamily::AzureVmFamilyA;
+                return;
+            }
+            if (inputStr == "Av2")
+            {
+                output = AzureVmFamily::AzureVmFamilyAv2;
+                return;
+            }
+            if (inputStr == "Dv2")
+            {
+                output = AzureVmFamily::AzureVmFamilyDv2;
+                return;
+            }
+            if (inputStr == "Dv3")
+            {
+                output = AzureVmFamily::AzureVmFamilyDv3;
+                return;
+            }
+            if (inputStr == "F")
+            {
+                output = AzureVmFamily::AzureVmFamilyF;
+                return;
+            }
+            if (inputStr == "Fsv2")
+            {
+                output = AzureVmFamily::AzureVmFamilyFsv2;
+                return;
+            }
+            if (inputStr == "Dasv4")
+            {
+                output = AzureVmFamily::AzureVmFamilyDasv4;
+                return;
+            }
+            if (inputStr == "Dav4")
+            {
+                output = AzureVmFamily::AzureVmFamilyDav4;
+                return;
+            }
+            if (inputStr == "Eav4")
+            {
+                output = AzureVmFamily::AzureVmFamilyEav4;
+                return;
+            }
+            if (inputStr == "Easv4")
+            {
+                output = AzureVmFamily::AzureVmFamilyEasv4;
+                return;
+            }
+            if (inputStr == "Ev4")
+            {
+                output = AzureVmFamily::AzureVmFamilyEv4;
+                return;
+            }
+            if (inputStr == "Esv4")
+            {
+                output = AzureVmFamily::AzureVmFamilyEsv4;
+                return;
+            }
+            if (inputStr == "Dsv3")
+            {
+                output = AzureVmFamily::AzureVmFamilyDsv3;
+                return;
+            }
+            if (inputStr == "Dsv2")
+            {
+                output = AzureVmFamily::AzureVmFamilyDsv2;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const AzureVmSize input, Json::Value& output)
+        {
+            if (input == AzureVmSize::AzureVmSizeStandard_A1)
+            {
+                output = Json::Value(Json::StaticString("Standard_A1"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_A2)
+            {
+                output = Json::Value(Json::StaticString("Standard_A2"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_A3)
+            {
+                output = Json::Value(Json::StaticString("Standard_A3"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_A4)
+            {
+                output = Json::Value(Json::StaticString("Standard_A4"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_A1_v2)
+            {
+                output = Json::Value(Json::StaticString("Standard_A1_v2"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_A2_v2)
+            {
+                output = Json::Value(Json::StaticString("Standard_A2_v2"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_A4_v2)
+            {
+                output = Json::Value(Json::StaticString("Standard_A4_v2"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_A8_v2)
+            {
+                output = Json::Value(Json::StaticString("Standard_A8_v2"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_D1_v2)
+            {
+                output = Json::Value(Json::StaticString("Standard_D1_v2"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_D2_v2)
+            {
+                output = Json::Value(Json::StaticString("Standard_D2_v2"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_D3_v2)
+            {
+                output = Json::Value(Json::StaticString("Standard_D3_v2"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_D4_v2)
+            {
+                output = Json::Value(Json::StaticString("Standard_D4_v2"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_D5_v2)
+            {
+                output = Json::Value(Json::StaticString("Standard_D5_v2"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_D2_v3)
+            {
+                output = Json::Value(Json::StaticString("Standard_D2_v3"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_D4_v3)
+            {
+                output = Json::Value(Json::StaticString("Standard_D4_v3"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_D8_v3)
+            {
+                output = Json::Value(Json::StaticString("Standard_D8_v3"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_D16_v3)
+            {
+                output = Json::Value(Json::StaticString("Standard_D16_v3"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_F1)
+            {
+                output = Json::Value(Json::StaticString("Standard_F1"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_F2)
+            {
+                output = Json::Value(Json::StaticString("Standard_F2"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_F4)
+            {
+                output = Json::Value(Json::StaticString("Standard_F4"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_F8)
+            {
+                output = Json::Value(Json::StaticString("Standard_F8"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_F16)
+            {
+                output = Json::Value(Json::StaticString("Standard_F16"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_F2s_v2)
+            {
+                output = Json::Value(Json::StaticString("Standard_F2s_v2"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_F4s_v2)
+            {
+                output = Json::Value(Json::StaticString("Standard_F4s_v2"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_F8s_v2)
+            {
+                output = Json::Value(Json::StaticString("Standard_F8s_v2"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_F16s_v2)
+            {
+                output = Json::Value(Json::StaticString("Standard_F16s_v2"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_D2as_v4)
+            {
+                output = Json::Value(Json::StaticString("Standard_D2as_v4"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_D4as_v4)
+            {
+                output = Json::Value(Json::StaticString("Standard_D4as_v4"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_D8as_v4)
+            {
+                output = Json::Value(Json::StaticString("Standard_D8as_v4"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_D16as_v4)
+            {
+                output = Json::Value(Json::StaticString("Standard_D16as_v4"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_D2a_v4)
+            {
+                output = Json::Value(Json::StaticString("Standard_D2a_v4"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_D4a_v4)
+            {
+                output = Json::Value(Json::StaticString("Standard_D4a_v4"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_D8a_v4)
+            {
+                output = Json::Value(Json::StaticString("Standard_D8a_v4"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_D16a_v4)
+            {
+                output = Json::Value(Json::StaticString("Standard_D16a_v4"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_E2a_v4)
+            {
+                output = Json::Value(Json::StaticString("Standard_E2a_v4"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_E4a_v4)
+            {
+                output = Json::Value(Json::StaticString("Standard_E4a_v4"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_E8a_v4)
+            {
+                output = Json::Value(Json::StaticString("Standard_E8a_v4"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_E16a_v4)
+            {
+                output = Json::Value(Json::StaticString("Standard_E16a_v4"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_E2as_v4)
+            {
+                output = Json::Value(Json::StaticString("Standard_E2as_v4"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_E4as_v4)
+            {
+                output = Json::Value(Json::StaticString("Standard_E4as_v4"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_E8as_v4)
+            {
+                output = Json::Value(Json::StaticString("Standard_E8as_v4"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_E16as_v4)
+            {
+                output = Json::Value(Json::StaticString("Standard_E16as_v4"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_D2s_v3)
+            {
+                output = Json::Value(Json::StaticString("Standard_D2s_v3"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_D4s_v3)
+            {
+                output = Json::Value(Json::StaticString("Standard_D4s_v3"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_D8s_v3)
+            {
+                output = Json::Value(Json::StaticString("Standard_D8s_v3"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_D16s_v3)
+            {
+                output = Json::Value(Json::StaticString("Standard_D16s_v3"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_DS1_v2)
+            {
+                output = Json::Value(Json::StaticString("Standard_DS1_v2"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_DS2_v2)
+            {
+                output = Json::Value(Json::StaticString("Standard_DS2_v2"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_DS3_v2)
+            {
+                output = Json::Value(Json::StaticString("Standard_DS3_v2"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_DS4_v2)
+            {
+                output = Json::Value(Json::StaticString("Standard_DS4_v2"));
+                return;
+            }
+            if (input == AzureVmSize::AzureVmSizeStandard_DS5_v2)
+            {
+                output = Json::Value(Json::StaticString("Standard_DS5_v2"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, AzureVmSize& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Standard_A1")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_A1;
+                return;
+            }
+            if (inputStr == "Standard_A2")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_A2;
+                return;
+            }
+            if (inputStr == "Standard_A3")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_A3;
+                return;
+            }
+            if (inputStr == "Standard_A4")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_A4;
+                return;
+            }
+            if (inputStr == "Standard_A1_v2")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_A1_v2;
+                return;
+            }
+            if (inputStr == "Standard_A2_v2")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_A2_v2;
+                return;
+            }
+            if (inputStr == "Standard_A4_v2")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_A4_v2;
+                return;
+            }
+            if (inputStr == "Standard_A8_v2")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_A8_v2;
+                return;
+            }
+            if (inputStr == "Standard_D1_v2")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_D1_v2;
+                return;
+            }
+            if (inputStr == "Standard_D2_v2")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_D2_v2;
+                return;
+            }
+            if (inputStr == "Standard_D3_v2")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_D3_v2;
+                return;
+            }
+            if (inputStr == "Standard_D4_v2")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_D4_v2;
+                return;
+            }
+            if (inputStr == "Standard_D5_v2")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_D5_v2;
+                return;
+            }
+            if (inputStr == "Standard_D2_v3")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_D2_v3;
+                return;
+            }
+            if (inputStr == "Standard_D4_v3")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_D4_v3;
+                return;
+            }
+            if (inputStr == "Standard_D8_v3")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_D8_v3;
+                return;
+            }
+            if (inputStr == "Standard_D16_v3")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_D16_v3;
+                return;
+            }
+            if (inputStr == "Standard_F1")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_F1;
+                return;
+            }
+            if (inputStr == "Standard_F2")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_F2;
+                return;
+            }
+            if (inputStr == "Standard_F4")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_F4;
+                return;
+            }
+            if (inputStr == "Standard_F8")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_F8;
+                return;
+            }
+            if (inputStr == "Standard_F16")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_F16;
+                return;
+            }
+            if (inputStr == "Standard_F2s_v2")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_F2s_v2;
+                return;
+            }
+            if (inputStr == "Standard_F4s_v2")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_F4s_v2;
+                return;
+            }
+            if (inputStr == "Standard_F8s_v2")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_F8s_v2;
+                return;
+            }
+            if (inputStr == "Standard_F16s_v2")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_F16s_v2;
+                return;
+            }
+            if (inputStr == "Standard_D2as_v4")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_D2as_v4;
+                return;
+            }
+            if (inputStr == "Standard_D4as_v4")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_D4as_v4;
+                return;
+            }
+            if (inputStr == "Standard_D8as_v4")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_D8as_v4;
+                return;
+            }
+            if (inputStr == "Standard_D16as_v4")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_D16as_v4;
+                return;
+            }
+            if (inputStr == "Standard_D2a_v4")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_D2a_v4;
+                return;
+            }
+            if (inputStr == "Standard_D4a_v4")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_D4a_v4;
+                return;
+            }
+            if (inputStr == "Standard_D8a_v4")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_D8a_v4;
+                return;
+            }
+            if (inputStr == "Standard_D16a_v4")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_D16a_v4;
+                return;
+            }
+            if (inputStr == "Standard_E2a_v4")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_E2a_v4;
+                return;
+            }
+            if (inputStr == "Standard_E4a_v4")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_E4a_v4;
+                return;
+            }
+            if (inputStr == "Standard_E8a_v4")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_E8a_v4;
+                return;
+            }
+            if (inputStr == "Standard_E16a_v4")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_E16a_v4;
+                return;
+            }
+            if (inputStr == "Standard_E2as_v4")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_E2as_v4;
+                return;
+            }
+            if (inputStr == "Standard_E4as_v4")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_E4as_v4;
+                return;
+            }
+            if (inputStr == "Standard_E8as_v4")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_E8as_v4;
+                return;
+            }
+            if (inputStr == "Standard_E16as_v4")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_E16as_v4;
+                return;
+            }
+            if (inputStr == "Standard_D2s_v3")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_D2s_v3;
+                return;
+            }
+            if (inputStr == "Standard_D4s_v3")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_D4s_v3;
+                return;
+            }
+            if (inputStr == "Standard_D8s_v3")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_D8s_v3;
+                return;
+            }
+            if (inputStr == "Standard_D16s_v3")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_D16s_v3;
+                return;
+            }
+            if (inputStr == "Standard_DS1_v2")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_DS1_v2;
+                return;
+            }
+            if (inputStr == "Standard_DS2_v2")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_DS2_v2;
+                return;
+            }
+            if (inputStr == "Standard_DS3_v2")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_DS3_v2;
+                return;
+            }
+            if (inputStr == "Standard_DS4_v2")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_DS4_v2;
+                return;
+            }
+            if (inputStr == "Standard_DS5_v2")
+            {
+                output = AzureVmSize::AzureVmSizeStandard_DS5_v2;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const CancellationReason input, Json::Value& output)
+        {
+            if (input == CancellationReason::CancellationReasonRequested)
+            {
+                output = Json::Value(Json::StaticString("Requested"));
+                return;
+            }
+            if (input == CancellationReason::CancellationReasonInternal)
+            {
+                output = Json::Value(Json::StaticString("Internal"));
+                return;
+            }
+            if (input == CancellationReason::CancellationReasonTimeout)
+            {
+                output = Json::Value(Json::StaticString("Timeout"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, CancellationReason& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Requested")
+            {
+                output = CancellationReason::CancellationReasonRequested;
+                return;
+            }
+            if (inputStr == "Internal")
+            {
+                output = CancellationReason::CancellationReasonInternal;
+                return;
+            }
+            if (inputStr == "Timeout")
+            {
+                output = CancellationReason::CancellationReasonTimeout;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const ContainerFlavor input, Json::Value& output)
+        {
+            if (input == ContainerFlavor::ContainerFlavorManagedWindowsServerCore)
+            {
+                output = Json::Value(Json::StaticString("ManagedWindowsServerCore"));
+                return;
+            }
+            if (input == ContainerFlavor::ContainerFlavorCustomLinux)
+            {
+                output = Json::Value(Json::StaticString("CustomLinux"));
+                return;
+            }
+            if (input == ContainerFlavor::ContainerFlavorManagedWindowsServerCorePreview)
+            {
+                output = Json::Value(Json::StaticString("ManagedWindowsServerCorePreview"));
+                return;
+            }
+            if (input == ContainerFlavor::ContainerFlavorInvalid)
+            {
+                output = Json::Value(Json::StaticString("Invalid"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, ContainerFlavor& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "ManagedWindowsServerCore")
+            {
+                output = ContainerFlavor::ContainerFlavorManagedWindowsServerCore;
+                return;
+            }
+            if (inputStr == "CustomLinux")
+            {
+                output = ContainerFlavor::ContainerFlavorCustomLinux;
+                return;
+            }
+            if (inputStr == "ManagedWindowsServerCorePreview")
+            {
+                output = ContainerFlavor::ContainerFlavorManagedWindowsServerCorePreview;
+                return;
+            }
+            if (inputStr == "Invalid")
+            {
+                output = ContainerFlavor::ContainerFlavorInvalid;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const OsPlatform input, Json::Value& output)
+        {
+            if (input == OsPlatform::OsPlatformWindows)
+            {
+                output = Json::Value(Json::StaticString("Windows"));
+                return;
+            }
+            if (input == OsPlatform::OsPlatformLinux)
+            {
+                output = Json::Value(Json::StaticString("Linux"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, OsPlatform& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Windows")
+            {
+                output = OsPlatform::OsPlatformWindows;
+                return;
+            }
+            if (inputStr == "Linux")
+            {
+                output = OsPlatform::OsPlatformLinux;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const ProtocolType input, Json::Value& output)
+        {
+            if (input == ProtocolType::ProtocolTypeTCP)
+            {
+                output = Json::Value(Json::StaticString("TCP"));
+                return;
+            }
+            if (input == ProtocolType::ProtocolTypeUDP)
+            {
+                output = Json::Value(Json::StaticString("UDP"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, ProtocolType& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "TCP")
+            {
+                output = ProtocolType::ProtocolTypeTCP;
+                return;
+            }
+            if (inputStr == "UDP")
+            {
+                output = ProtocolType::ProtocolTypeUDP;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const ServerType input, Json::Value& output)
+        {
+            if (input == ServerType::ServerTypeContainer)
+            {
+                output = Json::Value(Json::StaticString("Container"));
+                return;
+            }
+            if (input == ServerType::ServerTypeProcess)
+            {
+                output = Json::Value(Json::StaticString("Process"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, ServerType& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Container")
+            {
+                output = ServerType::ServerTypeContainer;
+                return;
+            }
+            if (inputStr == "Process")
+            {
+                output = ServerType::ServerTypeProcess;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const TitleMultiplayerServerEnabledStatus input, Json::Value& output)
+        {
+            if (input == TitleMultiplayerServerEnabledStatus::TitleMultiplayerServerEnabledStatusInitializing)
+            {
+                output = Json::Value(Json::StaticString("Initializing"));
+                return;
+            }
+            if (input == TitleMultiplayerServerEnabledStatus::TitleMultiplayerServerEnabledStatusEnabled)
+            {
+                output = Json::Value(Json::StaticString("Enabled"));
+                return;
+            }
+            if (input == TitleMultiplayerServerEnabledStatus::TitleMultiplayerServerEnabledStatusDisabled)
+            {
+                output = Json::Value(Json::StaticString("Disabled"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, TitleMultiplayerServerEnabledStatus& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Initializing")
+            {
+                output = TitleMultiplayerServerEnabledStatus::TitleMultiplayerServerEnabledStatusInitializing;
+                return;
+            }
+            if (inputStr == "Enabled")
+            {
+                output = TitleMultiplayerServerEnabledStatus::TitleMultiplayerServerEnabledStatusEnabled;
+                return;
+            }
+            if (inputStr == "Disabled")
+            {
+                output = TitleMultiplayerServerEnabledStatus::TitleMultiplayerServerEnabledStatusDisabled;
+                return;
+            }
+        }
+
+        void AssetReference::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyFileName), FileName);
+            FromJsonUtilS(FromJsonField(input, keyMountPath), MountPath);
+        }
+
+        Json::Value AssetReference::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_FileName; ToJsonUtilS(FileName, each_FileName); ToJsonField(output, keyFileName) = each_FileName;
+            Json::Value each_MountPath; ToJsonUtilS(MountPath, each_MountPath); ToJsonField(output, keyMountPath) = each_MountPath;
+            return output;
+        }
+
+        void AssetReferenceParams::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyFileName), FileName);
+            FromJsonUtilS(FromJsonField(input, keyMountPath), MountPath);
+        }
+
+        Json::Value AssetReferenceParams::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_FileName; ToJsonUtilS(FileName, each_FileName); ToJsonField(output, keyFileName) = each_FileName;
+            Json::Value each_MountPath; ToJsonUtilS(MountPath, each_MountPath); ToJsonField(output, keyMountPath) = each_MountPath;
+            return output;
+        }
+
+        void AssetSummary::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyFileName), FileName);
+            FromJsonUtilS(FromJsonField(input, keyMetadata), Metadata);
+        }
+
+        Json::Value AssetSummary::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_FileName; ToJsonUtilS(FileName, each_FileName); ToJsonField(output, keyFileName) = each_FileName;
+            Json::Value each_Metadata; ToJsonUtilS(Metadata, each_Metadata); ToJsonField(output, keyMetadata) = each_Metadata;
+            return output;
+        }
+
+        void BuildSelectionCriterion::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyBuildWeightDistribution), BuildWeightDistribution);
+        }
+
+        Json::Value BuildSelectionCriterion::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BuildWeightDistribution; ToJsonUtilP(BuildWeightDistribution, each_BuildWeightDistribution); ToJsonField(output, keyBuildWeightDistribution) = each_BuildWeightDistribution;
+            return output;
+        }
+
+        void BuildAliasDetailsResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAliasId), AliasId);
+            FromJsonUtilS(FromJsonField(input, keyAliasName), AliasName);
+            FromJsonUtilO(FromJsonField(input, keyBuildSelectionCriteria), BuildSelectionCriteria);
+            FromJsonUtilP(FromJsonField(input, keyPageSize), PageSize);
+            FromJsonUtilS(FromJsonField(input, keySkipToken), SkipToken);
+        }
+
+        Json::Value BuildAliasDetailsResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AliasId; ToJsonUtilS(AliasId, each_AliasId); ToJsonField(output, keyAliasId) = each_AliasId;
+            Json::Value each_AliasName; ToJsonUtilS(AliasName, each_AliasName); ToJsonField(output, keyAliasName) = each_AliasName;
+            Json::Value each_BuildSelectionCriteria; ToJsonUtilO(BuildSelectionCriteria, each_BuildSelectionCriteria); ToJsonField(output, keyBuildSelectionCriteria) = each_BuildSelectionCriteria;
+            Json::Value each_PageSize; ToJsonUtilP(PageSize, each_PageSize); ToJsonField(output, keyPageSize) = each_PageSize;
+            Json::Value each_SkipToken; ToJsonUtilS(SkipToken, each_SkipToken); ToJsonField(output, keySkipToken) = each_SkipToken;
+            return output;
+        }
+
+        void BuildAliasParams::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAliasId), AliasId);
+        }
+
+        Json::Value BuildAliasParams::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AliasId; ToJsonUtilS(AliasId, each_AliasId); ToJsonField(output, keyAliasId) = each_AliasId;
+            return output;
+        }
+
+        void CurrentServerStats::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyActive), Active);
+            FromJsonUtilP(FromJsonField(input, keyPropping), Propping);
+            FromJsonUtilP(FromJsonField(input, keyStandingBy), StandingBy);
+            FromJsonUtilP(FromJsonField(input, keyTotal), Total);
+        }
+
+        Json::Value CurrentServerStats::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Active; ToJsonUtilP(Active, each_Active); ToJsonField(output, keyActive) = each_Active;
+            Json::Value each_Propping; ToJsonUtilP(Propping, each_Propping); ToJsonField(output, keyPropping) = each_Propping;
+            Json::Value each_StandingBy; ToJsonUtilP(StandingBy, each_StandingBy); ToJsonField(output, keyStandingBy) = each_StandingBy;
+            Json::Value each_Total; ToJsonUtilP(Total, each_Total); ToJsonField(output, keyTotal) = each_Total;
+            return output;
+        }
+
+        void DynamicStandbyThreshold::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyMultiplier), Multiplier);
+            FromJsonUtilP(FromJsonField(input, keyTriggerThresholdPercentage), TriggerThresholdPercentage);
+        }
+
+        Json::Value DynamicStandbyThreshold::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Multiplier; ToJsonUtilP(Multiplier, each_Multiplier); ToJsonField(output, keyMultiplier) = each_Multiplier;
+            Json::Value each_TriggerThresholdPercentage; ToJsonUtilP(TriggerThresholdPercentage, each_TriggerThresholdPercentage); ToJsonField(output, keyTriggerThresholdPercentage) = each_TriggerThresholdPercentage;
+            return output;
+        }
+
+        void DynamicStandbySettings::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyDynamicFloorMultiplierThresholds), DynamicFloorMultiplierThresholds);
+            FromJsonUtilP(FromJsonField(input, keyIsEnabled), IsEnabled);
+            FromJsonUtilP(FromJsonField(input, keyRampDownSeconds), RampDownSeconds);
+        }
+
+        Json::Value DynamicStandbySettings::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_DynamicFloorMultiplierThresholds; ToJsonUtilO(DynamicFloorMultiplierThresholds, each_DynamicFloorMultiplierThresholds); ToJsonField(output, keyDynamicFloorMultiplierThresholds) = each_DynamicFloorMultiplierThresholds;
+            Json::Value each_IsEnabled; ToJsonUtilP(IsEnabled, each_IsEnabled); ToJsonField(output, keyIsEnabled) = each_IsEnabled;
+            Json::Value each_RampDownSeconds; ToJsonUtilP(RampDownSeconds, each_RampDownSeconds); ToJsonField(output, keyRampDownSeconds) = each_RampDownSeconds;
+            return output;
+        }
+
+        void Schedule::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyDescription), Description);
+            FromJsonUtilT(FromJsonField(input, keyEndTime), EndTime);
+            FromJsonUtilP(FromJsonField(input, keyIsDisabled), IsDisabled);
+            FromJsonUtilP(FromJsonField(input, keyIsRecurringWeekly), IsRecurringWeekly);
+            FromJsonUtilT(FromJsonField(input, keyStartTime), StartTime);
+            FromJsonUtilP(FromJsonField(input, keyTargetStandby), TargetStandby);
+        }
+
+        Json::Value Schedule::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Description; ToJsonUtilS(Description, each_Description); ToJsonField(output, keyDescription) = each_Description;
+            Json::Value each_EndTime; ToJsonUtilT(EndTime, each_EndTime); ToJsonField(output, keyEndTime) = each_EndTime;
+            Json::Value each_IsDisabled; ToJsonUtilP(IsDisabled, each_IsDisabled); ToJsonField(output, keyIsDisabled) = each_IsDisabled;
+            Json::Value each_IsRecurringWeekly; ToJsonUtilP(IsRecurringWeekly, each_IsRecurringWeekly); ToJsonField(output, keyIsRecurringWeekly) = each_IsRecurringWeekly;
+            Json::Value each_StartTime; ToJsonUtilT(StartTime, each_StartTime); ToJsonField(output, keyStartTime) = each_StartTime;
+            Json::Value each_TargetStandby; ToJsonUtilP(TargetStandby, each_TargetStandby); ToJsonField(output, keyTargetStandby) = each_TargetStandby;
+            return output;
+        }
+
+        void ScheduledStandbySettings::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyIsEnabled), IsEnabled);
+            FromJsonUtilO(FromJsonField(input, keyScheduleList), ScheduleList);
+        }
+
+        Json::Value ScheduledStandbySettings::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_IsEnabled; ToJsonUtilP(IsEnabled, each_IsEnabled); ToJsonField(output, keyIsEnabled) = each_IsEnabled;
+            Json::Value each_ScheduleList; ToJsonUtilO(ScheduleList, each_ScheduleList); ToJsonField(output, keyScheduleList) = each_ScheduleList;
+            return output;
+        }
+
+        void BuildRegion::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyCurrentServerStats), pfCurrentServerStats);
+            FromJsonUtilO(FromJsonField(input, keyDynamicStandbySettings), pfDynamicStandbySettings);
+            FromJsonUtilP(FromJsonField(input, keyMaxServers), MaxServers);
+            FromJsonUtilS(FromJsonField(input, keyRegion), Region);
+            FromJsonUtilO(FromJsonField(input, keyScheduledStandbySettings), pfScheduledStandbySettings);
+            FromJsonUtilP(FromJsonField(input, keyStandbyServers), StandbyServers);
+            FromJsonUtilS(FromJsonField(input, keyStatus), Status);
+        }
+
+        Json::Value BuildRegion::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_pfCurrentServerStats; ToJsonUtilO(pfCurrentServerStats, each_pfCurrentServerStats); ToJsonField(output, keyCurrentServerStats) = each_pfCurrentServerStats;
+            Json::Value each_pfDynamicStandbySettings; ToJsonUtilO(pfDynamicStandbySettings, each_pfDynamicStandbySettings); ToJsonField(output, keyDynamicStandbySettings) = each_pfDynamicStandbySettings;
+            Json::Value each_MaxServers; ToJsonUtilP(MaxServers, each_MaxServers); ToJsonField(output, keyMaxServers) = each_MaxServers;
+            Json::Value each_Region; ToJsonUtilS(Region, each_Region); ToJsonField(output, keyRegion) = each_Region;
+            Json::Value each_pfScheduledStandbySettings; ToJsonUtilO(pfScheduledStandbySettings, each_pfScheduledStandbySettings); ToJsonField(output, keyScheduledStandbySettings) = each_pfScheduledStandbySettings;
+            Json::Value each_StandbyServers; ToJsonUtilP(StandbyServers, each_StandbyServers); ToJsonField(output, keyStandbyServers) = each_StandbyServers;
+            Json::Value each_Status; ToJsonUtilS(Status, each_Status); ToJsonField(output, keyStatus) = each_Status;
+            return output;
+        }
+
+        void BuildRegionParams::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyDynamicStandbySettings), pfDynamicStandbySettings);
+            FromJsonUtilP(FromJsonField(input, keyMaxServers), MaxServers);
+            FromJsonUtilS(FromJsonField(input, keyRegion), Region);
+            FromJsonUtilO(FromJsonField(input, keyScheduledStandbySettings), pfScheduledStandbySettings);
+            FromJsonUtilP(FromJsonField(input, keyStandbyServers), StandbyServers);
+        }
+
+        Json::Value BuildRegionParams::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_pfDynamicStandbySettings; ToJsonUtilO(pfDynamicStandbySettings, each_pfDynamicStandbySettings); ToJsonField(output, keyDynamicStandbySettings) = each_pfDynamicStandbySettings;
+            Json::Value each_MaxServers; ToJsonUtilP(MaxServers, each_MaxServers); ToJsonField(output, keyMaxServers) = each_MaxServers;
+            Json::Value each_Region; ToJsonUtilS(Region, each_Region); ToJsonField(output, keyRegion) = each_Region;
+            Json::Value each_pfScheduledStandbySettings; ToJsonUtilO(pfScheduledStandbySettings, each_pfScheduledStandbySettings); ToJsonField(output, keyScheduledStandbySettings) = each_pfScheduledStandbySettings;
+            Json::Value each_StandbyServers; ToJsonUtilP(StandbyServers, each_StandbyServers); ToJsonField(output, keyStandbyServers) = each_StandbyServers;
+            return output;
+        }
+
+        void BuildSummary::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBuildId), BuildId);
+            FromJsonUtilS(FromJsonField(input, keyBuildName), BuildName);
+            FromJsonUtilT(FromJsonField(input, keyCreationTime), CreationTime);
+            FromJsonUtilS(FromJsonField(input, keyMetadata), Metadata);
+            FromJsonUtilO(FromJsonField(input, keyRegionConfigurations), RegionConfigurations);
+        }
+
+        Json::Value BuildSummary::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); ToJsonField(output, keyBuildId) = each_BuildId;
+            Json::Value each_BuildName; ToJsonUtilS(BuildName, each_BuildName); ToJsonField(output, keyBuildName) = each_BuildName;
+            Json::Value each_CreationTime; ToJsonUtilT(CreationTime, each_CreationTime); ToJsonField(output, keyCreationTime) = each_CreationTime;
+            Json::Value each_Metadata; ToJsonUtilS(Metadata, each_Metadata); ToJsonField(output, keyMetadata) = each_Metadata;
+            Json::Value each_RegionConfigurations; ToJsonUtilO(RegionConfigurations, each_RegionConfigurations); ToJsonField(output, keyRegionConfigurations) = each_RegionConfigurations;
+            return output;
+        }
+
+        void EntityKey::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyId), Id);
+            FromJsonUtilS(FromJsonField(input, keyType), Type);
+        }
+
+        Json::Value EntityKey::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Id; ToJsonUtilS(Id, each_Id); ToJsonField(output, keyId) = each_Id;
+            Json::Value each_Type; ToJsonUtilS(Type, each_Type); ToJsonField(output, keyType) = each_Type;
+            return output;
+        }
+
+        void CancelAllMatchmakingTicketsForPlayerRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilS(FromJsonField(input, keyQueueName), QueueName);
+        }
+
+        Json::Value CancelAllMatchmakingTicketsForPlayerRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); ToJsonField(output, keyQueueName) = each_QueueName;
+            return output;
+        }
+
+        void CancelAllMatchmakingTicketsForPlayerResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value CancelAllMatchmakingTicketsForPlayerResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void CancelAllServerBackfillTicketsForPlayerRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilS(FromJsonField(input, keyQueueName), QueueName);
+        }
+
+        Json::Value CancelAllServerBackfillTicketsForPlayerRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); ToJsonField(output, keyQueueName) = each_QueueName;
+            return output;
+        }
+
+        void CancelAllServerBackfillTicketsForPlayerResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value CancelAllServerBackfillTicketsForPlayerResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void CancelMatchmakingTicketRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyQueueName), QueueName);
+            FromJsonUtilS(FromJsonField(input, keyTicketId), TicketId);
+        }
+
+        Json::Value CancelMatchmakingTicketRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); ToJsonField(output, keyQueueName) = each_QueueName;
+            Json::Value each_TicketId; ToJsonUtilS(TicketId, each_TicketId); ToJsonField(output, keyTicketId) = each_TicketId;
+            return output;
+        }
+
+        void CancelMatchmakingTicketResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value CancelMatchmakingTicketResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void CancelServerBackfillTicketRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyQueueName), QueueName);
+            FromJsonUtilS(FromJsonField(input, keyTicketId), TicketId);
+        }
+
+        Json::Value CancelServerBackfillTicketRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); ToJsonField(output, keyQueueName) = each_QueueName;
+            Json::Value each_TicketId; ToJsonUtilS(TicketId, each_TicketId); ToJsonField(output, keyTicketId) = each_TicketId;
+            return output;
+        }
+
+        void CancelServerBackfillTicketResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value CancelServerBackfillTicketResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void Certificate::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBase64EncodedValue), Base64EncodedValue);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilS(FromJsonField(input, keyPassword), Password);
+        }
+
+        Json::Value Certificate::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Base64EncodedValue; ToJsonUtilS(Base64EncodedValue, each_Base64EncodedValue); ToJsonField(output, keyBase64EncodedValue) = each_Base64EncodedValue;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_Password; ToJsonUtilS(Password, each_Password); ToJsonField(output, keyPassword) = each_Password;
+            return output;
+        }
+
+        void CertificateSummary::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilS(FromJsonField(input, keyThumbprint), Thumbprint);
+        }
+
+        Json::Value CertificateSummary::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_Thumbprint; ToJsonUtilS(Thumbprint, each_Thumbprint); ToJsonField(output, keyThumbprint) = each_Thumbprint;
+            return output;
+        }
+
+        void ConnectedPlayer::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlayerId), PlayerId);
+        }
+
+        Json::Value ConnectedPlayer::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayerId; ToJsonUtilS(PlayerId, each_PlayerId); ToJsonField(output, keyPlayerId) = each_PlayerId;
+            return output;
+        }
+
+        void ContainerImageReference::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyImageName), ImageName);
+            FromJsonUtilS(FromJsonField(input, keyTag), Tag);
+        }
+
+        Json::Value ContainerImageReference::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ImageName; ToJsonUtilS(ImageName, each_ImageName); ToJsonField(output, keyImageName) = each_ImageName;
+            Json::Value each_Tag; ToJsonUtilS(Tag, each_Tag); ToJsonField(output, keyTag) = each_Tag;
+            return output;
+        }
+
+        void CoreCapacity::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyAvailable), Available);
+            FromJsonUtilS(FromJsonField(input, keyRegion), Region);
+            FromJsonUtilP(FromJsonField(input, keyTotal), Total);
+            FromJsonUtilE(FromJsonField(input, keyVmFamily), VmFamily);
+        }
+
+        Json::Value CoreCapacity::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Available; ToJsonUtilP(Available, each_Available); ToJsonField(output, keyAvailable) = each_Available;
+            Json::Value each_Region; ToJsonUtilS(Region, each_Region); ToJsonField(output, keyRegion) = each_Region;
+            Json::Value each_Total; ToJsonUtilP(Total, each_Total); ToJsonField(output, keyTotal) = each_Total;
+            Json::Value each_VmFamily; ToJsonUtilE(VmFamily, each_VmFamily); ToJsonField(output, keyVmFamily) = each_VmFamily;
+            return output;
+        }
+
+        void CoreCapacityChange::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyNewCoreLimit), NewCoreLimit);
+            FromJsonUtilS(FromJsonField(input, keyRegion), Region);
+            FromJsonEnum(FromJsonField(input, keyVmFamily), VmFamily);
+        }
+
+        Json::Value CoreCapacityChange::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_NewCoreLimit; ToJsonUtilP(NewCoreLimit, each_NewCoreLimit); ToJsonField(output, keyNewCoreLimit) = each_NewCoreLimit;
+            Json::Value each_Region; ToJsonUtilS(Region, each_Region); ToJsonField(output, keyRegion) = each_Region;
+            Json::Value each_VmFamily; ToJsonEnum(VmFamily, each_VmFamily); ToJsonField(output, keyVmFamily) = each_VmFamily;
+            return output;
+        }
+
+        void CreateBuildAliasRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAliasName), AliasName);
+            FromJsonUtilO(FromJsonField(input, keyBuildSelectionCriteria), BuildSelectionCriteria);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value CreateBuildAliasRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AliasName; ToJsonUtilS(AliasName, each_AliasName); ToJsonField(output, keyAliasName) = each_AliasName;
+            Json::Value each_BuildSelectionCriteria; ToJsonUtilO(BuildSelectionCriteria, each_BuildSelectionCriteria); ToJsonField(output, keyBuildSelectionCriteria) = each_BuildSelectionCriteria;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void GameCertificateReferenceParams::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyGsdkAlias), GsdkAlias);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+        }
+
+        Json::Value GameCertificateReferenceParams::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GsdkAlias; ToJsonUtilS(GsdkAlias, each_GsdkAlias); ToJsonField(output, keyGsdkAlias) = each_GsdkAlias;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            return output;
+        }
+
+        void LinuxInstrumentationConfiguration::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyIsEnabled), IsEnabled);
+        }
+
+        Json::Value LinuxInstrumentationConfiguration::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_IsEnabled; ToJsonUtilP(IsEnabled, each_IsEnabled); ToJsonField(output, keyIsEnabled) = each_IsEnabled;
+            return output;
+        }
+
+        void Port::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilP(FromJsonField(input, keyNum), Num);
+            FromJsonEnum(FromJsonField(input, keyProtocol), Protocol);
+        }
+
+        Json::Value Port::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_Num; ToJsonUtilP(Num, each_Num); ToJsonField(output, keyNum) = each_Num;
+            Json::Value each_Protocol; ToJsonEnum(Protocol, each_Protocol); ToJsonField(output, keyProtocol) = each_Protocol;
+            return output;
+        }
+
+        void CreateBuildWithCustomContainerRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyAreAssetsReadonly), AreAssetsReadonly);
+            FromJsonUtilS(FromJsonField(input, keyBuildName), BuildName);
+            FromJsonUtilE(FromJsonField(input, keyContainerFlavor), pfContainerFlavor);
+            FromJsonUtilO(FromJsonField(input, keyContainerImageReference), pfContainerImageReference);
+            FromJsonUtilS(FromJsonField(input, keyContainerRunCommand), ContainerRunCommand);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyGameAssetReferences), GameAssetReferences);
+            FromJsonUtilO(FromJsonField(input, keyGameCertificateReferences), GameCertificateReferences);
+            FromJsonUtilO(FromJsonField(input, keyLinuxInstrumentationConfiguration), pfLinuxInstrumentationConfiguration);
+            FromJsonUtilS(FromJsonField(input, keyMetadata), Metadata);
+            FromJsonUtilP(FromJsonField(input, keyMultiplayerServerCountPerVm), MultiplayerServerCountPerVm);
+            FromJsonUtilO(FromJsonField(input, keyPorts), Ports);
+            FromJsonUtilO(FromJsonField(input, keyRegionConfigurations), RegionConfigurations);
+            FromJsonUtilP(FromJsonField(input, keyUseStreamingForAssetDownloads), UseStreamingForAssetDownloads);
+            FromJsonUtilE(FromJsonField(input, keyVmSize), VmSize);
+        }
+
+        Json::Value CreateBuildWithCustomContainerRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AreAssetsReadonly; ToJsonUtilP(AreAssetsReadonly, each_AreAssetsReadonly); ToJsonField(output, keyAreAssetsReadonly) = each_AreAssetsReadonly;
+            Json::Value each_BuildName; ToJsonUtilS(BuildName, each_BuildName); ToJsonField(output, keyBuildName) = each_BuildName;
+            Json::Value each_pfContainerFlavor; ToJsonUtilE(pfContainerFlavor, each_pfContainerFlavor); ToJsonField(output, keyContainerFlavor) = each_pfContainerFlavor;
+            Json::Value each_pfContainerImageReference; ToJsonUtilO(pfContainerImageReference, each_pfContainerImageReference); ToJsonField(output, keyContainerImageReference) = each_pfContainerImageReference;
+            Json::Value each_ContainerRunCommand; ToJsonUtilS(ContainerRunCommand, each_ContainerRunCommand); ToJsonField(output, keyContainerRunCommand) = each_ContainerRunCommand;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_GameAssetReferences; ToJsonUtilO(GameAssetReferences, each_GameAssetReferences); ToJsonField(output, keyGameAssetReferences) = each_GameAssetReferences;
+            Json::Value each_GameCertificateReferences; ToJsonUtilO(GameCertificateReferences, each_GameCertificateReferences); ToJsonField(output, keyGameCertificateReferences) = each_GameCertificateReferences;
+            Json::Value each_pfLinuxInstrumentationConfiguration; ToJsonUtilO(pfLinuxInstrumentationConfiguration, each_pfLinuxInstrumentationConfiguration); ToJsonField(output, keyLinuxInstrumentationConfiguration) = each_pfLinuxInstrumentationConfiguration;
+            Json::Value each_Metadata; ToJsonUtilS(Metadata, each_Metadata); ToJsonField(output, keyMetadata) = each_Metadata;
+            Json::Value each_MultiplayerServerCountPerVm; ToJsonUtilP(MultiplayerServerCountPerVm, each_MultiplayerServerCountPerVm); ToJsonField(output, keyMultiplayerServerCountPerVm) = each_MultiplayerServerCountPerVm;
+            Json::Value each_Ports; ToJsonUtilO(Ports, each_Ports); ToJsonField(output, keyPorts) = each_Ports;
+            Json::Value each_RegionConfigurations; ToJsonUtilO(RegionConfigurations, each_RegionConfigurations); ToJsonField(output, keyRegionConfigurations) = each_RegionConfigurations;
+            Json::Value each_UseStreamingForAssetDownloads; ToJsonUtilP(UseStreamingForAssetDownloads, each_UseStreamingForAssetDownloads); ToJsonField(output, keyUseStreamingForAssetDownloads) = each_UseStreamingForAssetDownloads;
+            Json::Value each_VmSize; ToJsonUtilE(VmSize, each_VmSize); ToJsonField(output, keyVmSize) = each_VmSize;
+            return output;
+        }
+
+        void GameCertificateReference::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyGsdkAlias), GsdkAlias);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+        }
+
+        Json::Value GameCertificateReference::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GsdkAlias; ToJsonUtilS(GsdkAlias, each_GsdkAlias); ToJsonField(output, keyGsdkAlias) = each_GsdkAlias;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            return output;
+        }
+
+        void CreateBuildWithCustomContainerResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyAreAssetsReadonly), AreAssetsReadonly);
+            FromJsonUtilS(FromJsonField(input, keyBuildId), BuildId);
+            FromJsonUtilS(FromJsonField(input, keyBuildName), BuildName);
+            FromJsonUtilE(FromJsonField(input, keyContainerFlavor), pfContainerFlavor);
+            FromJsonUtilS(FromJsonField(input, keyContainerRunCommand), ContainerRunCommand);
+            FromJsonUtilT(FromJsonField(input, keyCreationTime), CreationTime);
+            FromJsonUtilO(FromJsonField(input, keyCustomGameContainerImage), CustomGameContainerImage);
+            FromJsonUtilO(FromJsonField(input, keyGameAssetReferences), GameAssetReferences);
+            FromJsonUtilO(FromJsonField(input, keyGameCertificateReferences), GameCertificateReferences);
+            FromJsonUtilO(FromJsonField(input, keyLinuxInstrumentationConfiguration), pfLinuxInstrumentationConfiguration);
+            FromJsonUtilS(FromJsonField(input, keyMetadata), Metadata);
+            FromJsonUtilP(FromJsonField(input, keyMultiplayerServerCountPerVm), MultiplayerServerCountPerVm);
+            FromJsonUtilS(FromJsonField(input, keyOsPlatform), OsPlatform);
+            FromJsonUtilO(FromJsonField(input, keyPorts), Ports);
+            FromJsonUtilO(FromJsonField(input, keyRegionConfigurations), RegionConfigurations);
+            FromJsonUtilS(FromJsonField(input, keyServerType), ServerType);
+            FromJsonUtilP(FromJsonField(input, keyUseStreamingForAssetDownloads), UseStreamingForAssetDownloads);
+            FromJsonUtilE(FromJsonField(input, keyVmSize), VmSize);
+        }
+
+        Json::Value CreateBuildWithCustomContainerResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AreAssetsReadonly; ToJsonUtilP(AreAssetsReadonly, each_AreAssetsReadonly); ToJsonField(output, keyAreAssetsReadonly) = each_AreAssetsReadonly;
+            Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); ToJsonField(output, keyBuildId) = each_BuildId;
+            Json::Value each_BuildName; ToJsonUtilS(BuildName, each_BuildName); ToJsonField(output, keyBuildName) = each_BuildName;
+            Json::Value each_pfContainerFlavor; ToJsonUtilE(pfContainerFlavor, each_pfContainerFlavor); ToJsonField(output, keyContainerFlavor) = each_pfContainerFlavor;
+            Json::Value each_ContainerRunCommand; ToJsonUtilS(ContainerRunCommand, each_ContainerRunCommand); ToJsonField(output, keyContainerRunCommand) = each_ContainerRunCommand;
+            Json::Value each_CreationTime; ToJsonUtilT(CreationTime, each_CreationTime); ToJsonField(output, keyCreationTime) = each_CreationTime;
+            Json::Value each_CustomGameContainerImage; ToJsonUtilO(CustomGameContainerImage, each_CustomGameContainerImage); ToJsonField(output, keyCustomGameContainerImage) = each_CustomGameContainerImage;
+            Json::Value each_GameAssetReferences; ToJsonUtilO(GameAssetReferences, each_GameAssetReferences); ToJsonField(output, keyGameAssetReferences) = each_GameAssetReferences;
+            Json::Value each_GameCertificateReferences; ToJsonUtilO(GameCertificateReferences, each_GameCertificateReferences); ToJsonField(output, keyGameCertificateReferences) = each_GameCertificateReferences;
+            Json::Value each_pfLinuxInstrumentationConfiguration; ToJsonUtilO(pfLinuxInstrumentationConfiguration, each_pfLinuxInstrumentationConfiguration); ToJsonField(output, keyLinuxInstrumentationConfiguration) = each_pfLinuxInstrumentationConfiguration;
+            Json::Value each_Metadata; ToJsonUtilS(Metadata, each_Metadata); ToJsonField(output, keyMetadata) = each_Metadata;
+            Json::Value each_MultiplayerServerCountPerVm; ToJsonUtilP(MultiplayerServerCountPerVm, each_MultiplayerServerCountPerVm); ToJsonField(output, keyMultiplayerServerCountPerVm) = each_MultiplayerServerCountPerVm;
+            Json::Value each_OsPlatform; ToJsonUtilS(OsPlatform, each_OsPlatform); ToJsonField(output, keyOsPlatform) = each_OsPlatform;
+            Json::Value each_Ports; ToJsonUtilO(Ports, each_Ports); ToJsonField(output, keyPorts) = each_Ports;
+            Json::Value each_RegionConfigurations; ToJsonUtilO(RegionConfigurations, each_RegionConfigurations); ToJsonField(output, keyRegionConfigurations) = each_RegionConfigurations;
+            Json::Value each_ServerType; ToJsonUtilS(ServerType, each_ServerType); ToJsonField(output, keyServerType) = each_ServerType;
+            Json::Value each_UseStreamingForAssetDownloads; ToJsonUtilP(UseStreamingForAssetDownloads, each_UseStreamingForAssetDownloads); ToJsonField(output, keyUseStreamingForAssetDownloads) = each_UseStreamingForAssetDownloads;
+            Json::Value each_VmSize; ToJsonUtilE(VmSize, each_VmSize); ToJsonField(output, keyVmSize) = each_VmSize;
+            return output;
+        }
+
+        void InstrumentationConfiguration::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyProcessesToMonitor), ProcessesToMonitor);
+        }
+
+        Json::Value InstrumentationConfiguration::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ProcessesToMonitor; ToJsonUtilS(ProcessesToMonitor, each_ProcessesToMonitor); ToJsonField(output, keyProcessesToMonitor) = each_ProcessesToMonitor;
+            return output;
+        }
+
+        void CreateBuildWithManagedContainerRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyAreAssetsReadonly), AreAssetsReadonly);
+            FromJsonUtilS(FromJsonField(input, keyBuildName), BuildName);
+            FromJsonUtilE(FromJsonField(input, keyContainerFlavor), pfContainerFlavor);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyGameAssetReferences), GameAssetReferences);
+            FromJsonUtilO(FromJsonField(input, keyGameCertificateReferences), GameCertificateReferences);
+            FromJsonUtilS(FromJsonField(input, keyGameWorkingDirectory), GameWorkingDirectory);
+            FromJsonUtilO(FromJsonField(input, keyInstrumentationConfiguration), pfInstrumentationConfiguration);
+            FromJsonUtilS(FromJsonField(input, keyMetadata), Metadata);
+            FromJsonUtilP(FromJsonField(input, keyMultiplayerServerCountPerVm), MultiplayerServerCountPerVm);
+            FromJsonUtilO(FromJsonField(input, keyPorts), Ports);
+            FromJsonUtilO(FromJsonField(input, keyRegionConfigurations), RegionConfigurations);
+            FromJsonUtilS(FromJsonField(input, keyStartMultiplayerServerCommand), StartMultiplayerServerCommand);
+            FromJsonUtilP(FromJsonField(input, keyUseStreamingForAssetDownloads), UseStreamingForAssetDownloads);
+            FromJsonUtilE(FromJsonField(input, keyVmSize), VmSize);
+        }
+
+        Json::Value CreateBuildWithManagedContainerRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AreAssetsReadonly; ToJsonUtilP(AreAssetsReadonly, each_AreAssetsReadonly); ToJsonField(output, keyAreAssetsReadonly) = each_AreAssetsReadonly;
+            Json::Value each_BuildName; ToJsonUtilS(BuildName, each_BuildName); ToJsonField(output, keyBuildName) = each_BuildName;
+            Json::Value each_pfContainerFlavor; ToJsonUtilE(pfContainerFlavor, each_pfContainerFlavor); ToJsonField(output, keyContainerFlavor) = each_pfContainerFlavor;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_GameAssetReferences; ToJsonUtilO(GameAssetReferences, each_GameAssetReferences); ToJsonField(output, keyGameAssetReferences) = each_GameAssetReferences;
+            Json::Value each_GameCertificateReferences; ToJsonUtilO(GameCertificateReferences, each_GameCertificateReferences); ToJsonField(output, keyGameCertificateReferences) = each_GameCertificateReferences;
+            Json::Value each_GameWorkingDirectory; ToJsonUtilS(GameWorkingDirectory, each_GameWorkingDirectory); ToJsonField(output, keyGameWorkingDirectory) = each_GameWorkingDirectory;
+            Json::Value each_pfInstrumentationConfiguration; ToJsonUtilO(pfInstrumentationConfiguration, each_pfInstrumentationConfiguration); ToJsonField(output, keyInstrumentationConfiguration) = each_pfInstrumentationConfiguration;
+            Json::Value each_Metadata; ToJsonUtilS(Metadata, each_Metadata); ToJsonField(output, keyMetadata) = each_Metadata;
+            Json::Value each_MultiplayerServerCountPerVm; ToJsonUtilP(MultiplayerServerCountPerVm, each_MultiplayerServerCountPerVm); ToJsonField(output, keyMultiplayerServerCountPerVm) = each_MultiplayerServerCountPerVm;
+            Json::Value each_Ports; ToJsonUtilO(Ports, each_Ports); ToJsonField(output, keyPorts) = each_Ports;
+            Json::Value each_RegionConfigurations; ToJsonUtilO(RegionConfigurations, each_RegionConfigurations); ToJsonField(output, keyRegionConfigurations) = each_RegionConfigurations;
+            Json::Value each_StartMultiplayerServerCommand; ToJsonUtilS(StartMultiplayerServerCommand, each_StartMultiplayerServerCommand); ToJsonField(output, keyStartMultiplayerServerCommand) = each_StartMultiplayerServerCommand;
+            Json::Value each_UseStreamingForAssetDownloads; ToJsonUtilP(UseStreamingForAssetDownloads, each_UseStreamingForAssetDownloads); ToJsonField(output, keyUseStreamingForAssetDownloads) = each_UseStreamingForAssetDownloads;
+            Json::Value each_VmSize; ToJsonUtilE(VmSize, each_VmSize); ToJsonField(output, keyVmSize) = each_VmSize;
+            return output;
+        }
+
+        void CreateBuildWithManagedContainerResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyAreAssetsReadonly), AreAssetsReadonly);
+            FromJsonUtilS(FromJsonField(input, keyBuildId), BuildId);
+            FromJsonUtilS(FromJsonField(input, keyBuildName), BuildName);
+            FromJsonUtilE(FromJsonField(input, keyContainerFlavor), pfContainerFlavor);
+            FromJsonUtilT(FromJsonField(input, keyCreationTime), CreationTime);
+            FromJsonUtilO(FromJsonField(input, keyGameAssetReferences), GameAssetReferences);
+            FromJsonUtilO(FromJsonField(input, keyGameCertificateReferences), GameCertificateReferences);
+            FromJsonUtilS(FromJsonField(input, keyGameWorkingDirectory), GameWorkingDirectory);
+            FromJsonUtilO(FromJsonField(input, keyInstrumentationConfiguration), pfInstrumentationConfiguration);
+            FromJsonUtilS(FromJsonField(input, keyMetadata), Metadata);
+            FromJsonUtilP(FromJsonField(input, keyMultiplayerServerCountPerVm), MultiplayerServerCountPerVm);
+            FromJsonUtilS(FromJsonField(input, keyOsPlatform), OsPlatform);
+            FromJsonUtilO(FromJsonField(input, keyPorts), Ports);
+            FromJsonUtilO(FromJsonField(input, keyRegionConfigurations), RegionConfigurations);
+            FromJsonUtilS(FromJsonField(input, keyServerType), ServerType);
+            FromJsonUtilS(FromJsonField(input, keyStartMultiplayerServerCommand), StartMultiplayerServerCommand);
+            FromJsonUtilP(FromJsonField(input, keyUseStreamingForAssetDownloads), UseStreamingForAssetDownloads);
+            FromJsonUtilE(FromJsonField(input, keyVmSize), VmSize);
+        }
+
+        Json::Value CreateBuildWithManagedContainerResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AreAssetsReadonly; ToJsonUtilP(AreAssetsReadonly, each_AreAssetsReadonly); ToJsonField(output, keyAreAssetsReadonly) = each_AreAssetsReadonly;
+            Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); ToJsonField(output, keyBuildId) = each_BuildId;
+            Json::Value each_BuildName; ToJsonUtilS(BuildName, each_BuildName); ToJsonField(output, keyBuildName) = each_BuildName;
+            Json::Value each_pfContainerFlavor; ToJsonUtilE(pfContainerFlavor, each_pfContainerFlavor); ToJsonField(output, keyContainerFlavor) = each_pfContainerFlavor;
+            Json::Value each_CreationTime; ToJsonUtilT(CreationTime, each_CreationTime); ToJsonField(output, keyCreationTime) = each_CreationTime;
+            Json::Value each_GameAssetReferences; ToJsonUtilO(GameAssetReferences, each_GameAssetReferences); ToJsonField(output, keyGameAssetReferences) = each_GameAssetReferences;
+            Json::Value each_GameCertificateReferences; ToJsonUtilO(GameCertificateReferences, each_GameCertificateReferences); ToJsonField(output, keyGameCertificateReferences) = each_GameCertificateReferences;
+            Json::Value each_GameWorkingDirectory; ToJsonUtilS(GameWorkingDirectory, each_GameWorkingDirectory); ToJsonField(output, keyGameWorkingDirectory) = each_GameWorkingDirectory;
+            Json::Value each_pfInstrumentationConfiguration; ToJsonUtilO(pfInstrumentationConfiguration, each_pfInstrumentationConfiguration); ToJsonField(output, keyInstrumentationConfiguration) = each_pfInstrumentationConfiguration;
+            Json::Value each_Metadata; ToJsonUtilS(Metadata, each_Metadata); ToJsonField(output, keyMetadata) = each_Metadata;
+            Json::Value each_MultiplayerServerCountPerVm; ToJsonUtilP(MultiplayerServerCountPerVm, each_MultiplayerServerCountPerVm); ToJsonField(output, keyMultiplayerServerCountPerVm) = each_MultiplayerServerCountPerVm;
+            Json::Value each_OsPlatform; ToJsonUtilS(OsPlatform, each_OsPlatform); ToJsonField(output, keyOsPlatform) = each_OsPlatform;
+            Json::Value each_Ports; ToJsonUtilO(Ports, each_Ports); ToJsonField(output, keyPorts) = each_Ports;
+            Json::Value each_RegionConfigurations; ToJsonUtilO(RegionConfigurations, each_RegionConfigurations); ToJsonField(output, keyRegionConfigurations) = each_RegionConfigurations;
+            Json::Value each_ServerType; ToJsonUtilS(ServerType, each_ServerType); ToJsonField(output, keyServerType) = each_ServerType;
+            Json::Value each_StartMultiplayerServerCommand; ToJsonUtilS(StartMultiplayerServerCommand, each_StartMultiplayerServerCommand); ToJsonField(output, keyStartMultiplayerServerCommand) = each_StartMultiplayerServerCommand;
+            Json::Value each_UseStreamingForAssetDownloads; ToJsonUtilP(UseStreamingForAssetDownloads, each_UseStreamingForAssetDownloads); ToJsonField(output, keyUseStreamingForAssetDownloads) = each_UseStreamingForAssetDownloads;
+            Json::Value each_VmSize; ToJsonUtilE(VmSize, each_VmSize); ToJsonField(output, keyVmSize) = each_VmSize;
+            return output;
+        }
+
+        void CreateBuildWithProcessBasedServerRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyAreAssetsReadonly), AreAssetsReadonly);
+            FromJsonUtilS(FromJsonField(input, keyBuildName), BuildName);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyGameAssetReferences), GameAssetReferences);
+            FromJsonUtilO(FromJsonField(input, keyGameCertificateReferences), GameCertificateReferences);
+            FromJsonUtilS(FromJsonField(input, keyGameWorkingDirectory), GameWorkingDirectory);
+            FromJsonUtilO(FromJsonField(input, keyInstrumentationConfiguration), pfInstrumentationConfiguration);
+            FromJsonUtilP(FromJsonField(input, keyIsOSPreview), IsOSPreview);
+            FromJsonUtilS(FromJsonField(input, keyMetadata), Metadata);
+            FromJsonUtilP(FromJsonField(input, keyMultiplayerServerCountPerVm), MultiplayerServerCountPerVm);
+            FromJsonUtilS(FromJsonField(input, keyOsPlatform), OsPlatform);
+            FromJsonUtilO(FromJsonField(input, keyPorts), Ports);
+            FromJsonUtilO(FromJsonField(input, keyRegionConfigurations), RegionConfigurations);
+            FromJsonUtilS(FromJsonField(input, keyStartMultiplayerServerCommand), StartMultiplayerServerCommand);
+            FromJsonUtilP(FromJsonField(input, keyUseStreamingForAssetDownloads), UseStreamingForAssetDownloads);
+            FromJsonUtilE(FromJsonField(input, keyVmSize), VmSize);
+        }
+
+        Json::Value CreateBuildWithProcessBasedServerRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AreAssetsReadonly; ToJsonUtilP(AreAssetsReadonly, each_AreAssetsReadonly); ToJsonField(output, keyAreAssetsReadonly) = each_AreAssetsReadonly;
+            Json::Value each_BuildName; ToJsonUtilS(BuildName, each_BuildName); ToJsonField(output, keyBuildName) = each_BuildName;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_GameAssetReferences; ToJsonUtilO(GameAssetReferences, each_GameAssetReferences); ToJsonField(output, keyGameAssetReferences) = each_GameAssetReferences;
+            Json::Value each_GameCertificateReferences; ToJsonUtilO(GameCertificateReferences, each_GameCertificateReferences); ToJsonField(output, keyGameCertificateReferences) = each_GameCertificateReferences;
+            Json::Value each_GameWorkingDirectory; ToJsonUtilS(GameWorkingDirectory, each_GameWorkingDirectory); ToJsonField(output, keyGameWorkingDirectory) = each_GameWorkingDirectory;
+            Json::Value each_pfInstrumentationConfiguration; ToJsonUtilO(pfInstrumentationConfiguration, each_pfInstrumentationConfiguration); ToJsonField(output, keyInstrumentationConfiguration) = each_pfInstrumentationConfiguration;
+            Json::Value each_IsOSPreview; ToJsonUtilP(IsOSPreview, each_IsOSPreview); ToJsonField(output, keyIsOSPreview) = each_IsOSPreview;
+            Json::Value each_Metadata; ToJsonUtilS(Metadata, each_Metadata); ToJsonField(output, keyMetadata) = each_Metadata;
+            Json::Value each_MultiplayerServerCountPerVm; ToJsonUtilP(MultiplayerServerCountPerVm, each_MultiplayerServerCountPerVm); ToJsonField(output, keyMultiplayerServerCountPerVm) = each_MultiplayerServerCountPerVm;
+            Json::Value each_OsPlatform; ToJsonUtilS(OsPlatform, each_OsPlatform); ToJsonField(output, keyOsPlatform) = each_OsPlatform;
+            Json::Value each_Ports; ToJsonUtilO(Ports, each_Ports); ToJsonField(output, keyPorts) = each_Ports;
+            Json::Value each_RegionConfigurations; ToJsonUtilO(RegionConfigurations, each_RegionConfigurations); ToJsonField(output, keyRegionConfigurations) = each_RegionConfigurations;
+            Json::Value each_StartMultiplayerServerCommand; ToJsonUtilS(StartMultiplayerServerCommand, each_StartMultiplayerServerCommand); ToJsonField(output, keyStartMultiplayerServerCommand) = each_StartMultiplayerServerCommand;
+            Json::Value each_UseStreamingForAssetDownloads; ToJsonUtilP(UseStreamingForAssetDownloads, each_UseStreamingForAssetDownloads); ToJsonField(output, keyUseStreamingForAssetDownloads) = each_UseStreamingForAssetDownloads;
+            Json::Value each_VmSize; ToJsonUtilE(VmSize, each_VmSize); ToJsonField(output, keyVmSize) = each_VmSize;
+            return output;
+        }
+
+        void CreateBuildWithProcessBasedServerResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyAreAssetsReadonly), AreAssetsReadonly);
+            FromJsonUtilS(FromJsonField(input, keyBuildId), BuildId);
+            FromJsonUtilS(FromJsonField(input, keyBuildName), BuildName);
+            FromJsonUtilE(FromJsonField(input, keyContainerFlavor), pfContainerFlavor);
+            FromJsonUtilT(FromJsonField(input, keyCreationTime), CreationTime);
+            FromJsonUtilO(FromJsonField(input, keyGameAssetReferences), GameAssetReferences);
+            FromJsonUtilO(FromJsonField(input, keyGameCertificateReferences), GameCertificateReferences);
+            FromJsonUtilS(FromJsonField(input, keyGameWorkingDirectory), GameWorkingDirectory);
+            FromJsonUtilO(FromJsonField(input, keyInstrumentationConfiguration), pfInstrumentationConfiguration);
+            FromJsonUtilP(FromJsonField(input, keyIsOSPreview), IsOSPreview);
+            FromJsonUtilS(FromJsonField(input, keyMetadata), Metadata);
+            FromJsonUtilP(FromJsonField(input, keyMultiplayerServerCountPerVm), MultiplayerServerCountPerVm);
+            FromJsonUtilS(FromJsonField(input, keyOsPlatform), OsPlatform);
+            FromJsonUtilO(FromJsonField(input, keyPorts), Ports);
+            FromJsonUtilO(FromJsonField(input, keyRegionConfigurations), RegionConfigurations);
+            FromJsonUtilS(FromJsonField(input, keyServerType), ServerType);
+            FromJsonUtilS(FromJsonField(input, keyStartMultiplayerServerCommand), StartMultiplayerServerCommand);
+            FromJsonUtilP(FromJsonField(input, keyUseStreamingForAssetDownloads), UseStreamingForAssetDownloads);
+            FromJsonUtilE(FromJsonField(input, keyVmSize), VmSize);
+        }
+
+        Json::Value CreateBuildWithProcessBasedServerResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AreAssetsReadonly; ToJsonUtilP(AreAssetsReadonly, each_AreAssetsReadonly); ToJsonField(output, keyAreAssetsReadonly) = each_AreAssetsReadonly;
+            Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); ToJsonField(output, keyBuildId) = each_BuildId;
+            Json::Value each_BuildName; ToJsonUtilS(BuildName, each_BuildName); ToJsonField(output, keyBuildName) = each_BuildName;
+            Json::Value each_pfContainerFlavor; ToJsonUtilE(pfContainerFlavor, each_pfContainerFlavor); ToJsonField(output, keyContainerFlavor) = each_pfContainerFlavor;
+            Json::Value each_CreationTime; ToJsonUtilT(CreationTime, each_CreationTime); ToJsonField(output, keyCreationTime) = each_CreationTime;
+            Json::Value each_GameAssetReferences; ToJsonUtilO(GameAssetReferences, each_GameAssetReferences); ToJsonField(output, keyGameAssetReferences) = each_GameAssetReferences;
+            Json::Value each_GameCertificateReferences; ToJsonUtilO(GameCertificateReferences, each_GameCertificateReferences); ToJsonField(output, keyGameCertificateReferences) = each_GameCertificateReferences;
+            Json::Value each_GameWorkingDirectory; ToJsonUtilS(GameWorkingDirectory, each_GameWorkingDirectory); ToJsonField(output, keyGameWorkingDirectory) = each_GameWorkingDirectory;
+            Json::Value each_pfInstrumentationConfiguration; ToJsonUtilO(pfInstrumentationConfiguration, each_pfInstrumentationConfiguration); ToJsonField(output, keyInstrumentationConfiguration) = each_pfInstrumentationConfiguration;
+            Json::Value each_IsOSPreview; ToJsonUtilP(IsOSPreview, each_IsOSPreview); ToJsonField(output, keyIsOSPreview) = each_IsOSPreview;
+            Json::Value each_Metadata; ToJsonUtilS(Metadata, each_Metadata); ToJsonField(output, keyMetadata) = each_Metadata;
+            Json::Value each_MultiplayerServerCountPerVm; ToJsonUtilP(MultiplayerServerCountPerVm, each_MultiplayerServerCountPerVm); ToJsonField(output, keyMultiplayerServerCountPerVm) = each_MultiplayerServerCountPerVm;
+            Json::Value each_OsPlatform; ToJsonUtilS(OsPlatform, each_OsPlatform); ToJsonField(output, keyOsPlatform) = each_OsPlatform;
+            Json::Value each_Ports; ToJsonUtilO(Ports, each_Ports); ToJsonField(output, keyPorts) = each_Ports;
+            Json::Value each_RegionConfigurations; ToJsonUtilO(RegionConfigurations, each_RegionConfigurations); ToJsonField(output, keyRegionConfigurations) = each_RegionConfigurations;
+            Json::Value each_ServerType; ToJsonUtilS(ServerType, each_ServerType); ToJsonField(output, keyServerType) = each_ServerType;
+            Json::Value each_StartMultiplayerServerCommand; ToJsonUtilS(StartMultiplayerServerCommand, each_StartMultiplayerServerCommand); ToJsonField(output, keyStartMultiplayerServerCommand) = each_StartMultiplayerServerCommand;
+            Json::Value each_UseStreamingForAssetDownloads; ToJsonUtilP(UseStreamingForAssetDownloads, each_UseStreamingForAssetDownloads); ToJsonField(output, keyUseStreamingForAssetDownloads) = each_UseStreamingForAssetDownloads;
+            Json::Value each_VmSize; ToJsonUtilE(VmSize, each_VmSize); ToJsonField(output, keyVmSize) = each_VmSize;
+            return output;
+        }
+
+        void MatchmakingPlayerAttributes::FromJson(const Json::Value& input)
+        {
+            DataObject = FromJsonField(input, keyDataObject);
+            FromJsonUtilS(FromJsonField(input, keyEscapedDataObject), EscapedDataObject);
+        }
+
+        Json::Value MatchmakingPlayerAttributes::ToJson() const
+        {
+            Json::Value output;
+            ToJsonField(output, keyDataObject) = DataObject;
+            Json::Value each_EscapedDataObject; ToJsonUtilS(EscapedDataObject, each_EscapedDataObject); ToJsonField(output, keyEscapedDataObject) = each_EscapedDataObject;
+            return output;
+        }
+
+        void MatchmakingPlayer::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyAttributes), Attributes);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+        }
+
+        Json::Value MatchmakingPlayer::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Attributes; ToJsonUtilO(Attributes, each_Attributes); ToJsonField(output, keyAttributes) = each_Attributes;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            return output;
+        }
+
+        void CreateMatchmakingTicketRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyCreator), Creator);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyGiveUpAfterSeconds), GiveUpAfterSeconds);
+            FromJsonUtilO(FromJsonField(input, keyMembersToMatchWith), MembersToMatchWith);
+            FromJsonUtilS(FromJsonField(input, keyQueueName), QueueName);
+        }
+
+        Json::Value CreateMatchmakingTicketRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Creator; ToJsonUtilO(Creator, each_Creator); ToJsonField(output, keyCreator) = each_Creator;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_GiveUpAfterSeconds; ToJsonUtilP(GiveUpAfterSeconds, each_GiveUpAfterSeconds); ToJsonField(output, keyGiveUpAfterSeconds) = each_GiveUpAfterSeconds;
+            Json::Value each_MembersToMatchWith; ToJsonUtilO(MembersToMatchWith, each_MembersToMatchWith); ToJsonField(output, keyMembersToMatchWith) = each_MembersToMatchWith;
+            Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); ToJsonField(output, keyQueueName) = each_QueueName;
+            return output;
+        }
+
+        void CreateMatchmakingTicketResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyTicketId), TicketId);
+        }
+
+        Json::Value CreateMatchmakingTicketResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_TicketId; ToJsonUtilS(TicketId, each_TicketId); ToJsonField(output, keyTicketId) = each_TicketId;
+            return output;
+        }
+
+        void CreateRemoteUserRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBuildId), BuildId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilT(FromJsonField(input, keyExpirationTime), ExpirationTime);
+            FromJsonUtilS(FromJsonField(input, keyRegion), Region);
+            FromJsonUtilS(FromJsonField(input, keyUsername), Username);
+            FromJsonUtilS(FromJsonField(input, keyVmId), VmId);
+        }
+
+        Json::Value CreateRemoteUserRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); ToJsonField(output, keyBuildId) = each_BuildId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ExpirationTime; ToJsonUtilT(ExpirationTime, each_ExpirationTime); ToJsonField(output, keyExpirationTime) = each_ExpirationTime;
+            Json::Value each_Region; ToJsonUtilS(Region, each_Region); ToJsonField(output, keyRegion) = each_Region;
+            Json::Value each_Username; ToJsonUtilS(Username, each_Username); ToJsonField(output, keyUsername) = each_Username;
+            Json::Value each_VmId; ToJsonUtilS(VmId, each_VmId); ToJsonField(output, keyVmId) = each_VmId;
+            return output;
+        }
+
+        void CreateRemoteUserResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilT(FromJsonField(input, keyExpirationTime), ExpirationTime);
+            FromJsonUtilS(FromJsonField(input, keyPassword), Password);
+            FromJsonUtilS(FromJsonField(input, keyUsername), Username);
+        }
+
+        Json::Value CreateRemoteUserResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ExpirationTime; ToJsonUtilT(ExpirationTime, each_ExpirationTime); ToJsonField(output, keyExpirationTime) = each_ExpirationTime;
+            Json::Value each_Password; ToJsonUtilS(Password, each_Password); ToJsonField(output, keyPassword) = each_Password;
+            Json::Value each_Username; ToJsonUtilS(Username, each_Username); ToJsonField(output, keyUsername) = each_Username;
+            return output;
+        }
+
+        void MatchmakingPlayerWithTeamAssignment::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyAttributes), Attributes);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilS(FromJsonField(input, keyTeamId), TeamId);
+        }
+
+        Json::Value MatchmakingPlayerWithTeamAssignment::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Attributes; ToJsonUtilO(Attributes, each_Attributes); ToJsonField(output, keyAttributes) = each_Attributes;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_TeamId; ToJsonUtilS(TeamId, each_TeamId); ToJsonField(output, keyTeamId) = each_TeamId;
+            return output;
+        }
+
+        void ServerDetails::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyIPV4Address), IPV4Address);
+            FromJsonUtilO(FromJsonField(input, keyPorts), Ports);
+            FromJsonUtilS(FromJsonField(input, keyRegion), Region);
+        }
+
+        Json::Value ServerDetails::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_IPV4Address; ToJsonUtilS(IPV4Address, each_IPV4Address); ToJsonField(output, keyIPV4Address) = each_IPV4Address;
+            Json::Value each_Ports; ToJsonUtilO(Ports, each_Ports); ToJsonField(output, keyPorts) = each_Ports;
+            Json::Value each_Region; ToJsonUtilS(Region, each_Region); ToJsonField(output, keyRegion) = each_Region;
+            return output;
+        }
+
+        void CreateServerBackfillTicketRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyGiveUpAfterSeconds), GiveUpAfterSeconds);
+            FromJsonUtilO(FromJsonField(input, keyMembers), Members);
+            FromJsonUtilS(FromJsonField(input, keyQueueName), QueueName);
+            FromJsonUtilO(FromJsonField(input, keyServerDetails), pfServerDetails);
+        }
+
+        Json::Value CreateServerBackfillTicketRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_GiveUpAfterSeconds; ToJsonUtilP(GiveUpAfterSeconds, each_GiveUpAfterSeconds); ToJsonField(output, keyGiveUpAfterSeconds) = each_GiveUpAfterSeconds;
+            Json::Value each_Members; ToJsonUtilO(Members, each_Members); ToJsonField(output, keyMembers) = each_Members;
+            Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); ToJsonField(output, keyQueueName) = each_QueueName;
+            Json::Value each_pfServerDetails; ToJsonUtilO(pfServerDetails, each_pfServerDetails); ToJsonField(output, keyServerDetails) = each_pfServerDetails;
+            return output;
+        }
+
+        void CreateServerBackfillTicketResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyTicketId), TicketId);
+        }
+
+        Json::Value CreateServerBackfillTicketResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_TicketId; ToJsonUtilS(TicketId, each_TicketId); ToJsonField(output, keyTicketId) = each_TicketId;
+            return output;
+        }
+
+        void CreateServerMatchmakingTicketRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyGiveUpAfterSeconds), GiveUpAfterSeconds);
+            FromJsonUtilO(FromJsonField(input, keyMembers), Members);
+            FromJsonUtilS(FromJsonField(input, keyQueueName), QueueName);
+        }
+
+        Json::Value CreateServerMatchmakingTicketRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_GiveUpAfterSeconds; ToJsonUtilP(GiveUpAfterSeconds, each_GiveUpAfterSeconds); ToJsonField(output, keyGiveUpAfterSeconds) = each_GiveUpAfterSeconds;
+            Json::Value each_Members; ToJsonUtilO(Members, each_Members); ToJsonField(output, keyMembers) = each_Members;
+            Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); ToJsonField(output, keyQueueName) = each_QueueName;
+            return output;
+        }
+
+        void CreateTitleMultiplayerServersQuotaChangeRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyChangeDescription), ChangeDescription);
+            FromJsonUtilO(FromJsonField(input, keyChanges), Changes);
+            FromJsonUtilS(FromJsonField(input, keyContactEmail), ContactEmail);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyNotes), Notes);
+            FromJsonUtilT(FromJsonField(input, keyStartDate), StartDate);
+        }
+
+        Json::Value CreateTitleMultiplayerServersQuotaChangeRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ChangeDescription; ToJsonUtilS(ChangeDescription, each_ChangeDescription); ToJsonField(output, keyChangeDescription) = each_ChangeDescription;
+            Json::Value each_Changes; ToJsonUtilO(Changes, each_Changes); ToJsonField(output, keyChanges) = each_Changes;
+            Json::Value each_ContactEmail; ToJsonUtilS(ContactEmail, each_ContactEmail); ToJsonField(output, keyContactEmail) = each_ContactEmail;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Notes; ToJsonUtilS(Notes, each_Notes); ToJsonField(output, keyNotes) = each_Notes;
+            Json::Value each_StartDate; ToJsonUtilT(StartDate, each_StartDate); ToJsonField(output, keyStartDate) = each_StartDate;
+            return output;
+        }
+
+        void CreateTitleMultiplayerServersQuotaChangeResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyRequestId), RequestId);
+            FromJsonUtilP(FromJsonField(input, keyWasApproved), WasApproved);
+        }
+
+        Json::Value CreateTitleMultiplayerServersQuotaChangeResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_RequestId; ToJsonUtilS(RequestId, each_RequestId); ToJsonField(output, keyRequestId) = each_RequestId;
+            Json::Value each_WasApproved; ToJsonUtilP(WasApproved, each_WasApproved); ToJsonField(output, keyWasApproved) = each_WasApproved;
+            return output;
+        }
+
+        void DeleteAssetRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyFileName), FileName);
+        }
+
+        Json::Value DeleteAssetRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_FileName; ToJsonUtilS(FileName, each_FileName); ToJsonField(output, keyFileName) = each_FileName;
+            return output;
+        }
+
+        void DeleteBuildAliasRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAliasId), AliasId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value DeleteBuildAliasRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AliasId; ToJsonUtilS(AliasId, each_AliasId); ToJsonField(output, keyAliasId) = each_AliasId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void DeleteBuildRegionRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBuildId), BuildId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyRegion), Region);
+        }
+
+        Json::Value DeleteBuildRegionRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); ToJsonField(output, keyBuildId) = each_BuildId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Region; ToJsonUtilS(Region, each_Region); ToJsonField(output, keyRegion) = each_Region;
+            return output;
+        }
+
+        void DeleteBuildRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBuildId), BuildId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value DeleteBuildRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); ToJsonField(output, keyBuildId) = each_BuildId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void DeleteCertificateRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+        }
+
+        Json::Value DeleteCertificateRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            return output;
+        }
+
+        void DeleteContainerImageRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyImageName), ImageName);
+        }
+
+        Json::Value DeleteContainerImageRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ImageName; ToJsonUtilS(ImageName, each_ImageName); ToJsonField(output, keyImageName) = each_ImageName;
+            return output;
+        }
+
+        void DeleteRemoteUserRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBuildId), BuildId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyRegion), Region);
+            FromJsonUtilS(FromJsonField(input, keyUsername), Username);
+            FromJsonUtilS(FromJsonField(input, keyVmId), VmId);
+        }
+
+        Json::Value DeleteRemoteUserRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); ToJsonField(output, keyBuildId) = each_BuildId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Region; ToJsonUtilS(Region, each_Region); ToJsonField(output, keyRegion) = each_Region;
+            Json::Value each_Username; ToJsonUtilS(Username, each_Username); ToJsonField(output, keyUsername) = each_Username;
+            Json::Value each_VmId; ToJsonUtilS(VmId, each_VmId); ToJsonField(output, keyVmId) = each_VmId;
+            return output;
+        }
+
+        void EmptyResponse::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value EmptyResponse::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void EnableMultiplayerServersForTitleRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value EnableMultiplayerServersForTitleRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void EnableMultiplayerServersForTitleResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilE(FromJsonField(input, keyStatus), Status);
+        }
+
+        Json::Value EnableMultiplayerServersForTitleResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Status; ToJsonUtilE(Status, each_Status); ToJsonField(output, keyStatus) = each_Status;
+            return output;
+        }
+
+        void GetAssetUploadUrlRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyFileName), FileName);
+        }
+
+        Json::Value GetAssetUploadUrlRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_FileName; ToJsonUtilS(FileName, each_FileName); ToJsonField(output, keyFileName) = each_FileName;
+            return output;
+        }
+
+        void GetAssetUploadUrlResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAssetUploadUrl), AssetUploadUrl);
+            FromJsonUtilS(FromJsonField(input, keyFileName), FileName);
+        }
+
+        Json::Value GetAssetUploadUrlResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AssetUploadUrl; ToJsonUtilS(AssetUploadUrl, each_AssetUploadUrl); ToJsonField(output, keyAssetUploadUrl) = each_AssetUploadUrl;
+            Json::Value each_FileName; ToJsonUtilS(FileName, each_FileName); ToJsonField(output, keyFileName) = each_FileName;
+            return output;
+        }
+
+        void GetBuildAliasRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAliasId), AliasId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value GetBuildAliasRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AliasId; ToJsonUtilS(AliasId, each_AliasId); ToJsonField(output, keyAliasId) = each_AliasId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void GetBuildRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBuildId), BuildId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value GetBuildRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); ToJsonField(output, keyBuildId) = each_BuildId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void GetBuildResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyAreAssetsReadonly), AreAssetsReadonly);
+            FromJsonUtilS(FromJsonField(input, keyBuildId), BuildId);
+            FromJsonUtilS(FromJsonField(input, keyBuildName), BuildName);
+            FromJsonUtilS(FromJsonField(input, keyBuildStatus), BuildStatus);
+            FromJsonUtilE(FromJsonField(input, keyContainerFlavor), pfContainerFlavor);
+            FromJsonUtilS(FromJsonField(input, keyContainerRunCommand), ContainerRunCommand);
+            FromJsonUtilT(FromJsonField(input, keyCreationTime), CreationTime);
+            FromJsonUtilO(FromJsonField(input, keyCustomGameContainerImage), CustomGameContainerImage);
+            FromJsonUtilO(FromJsonField(input, keyGameAssetReferences), GameAssetReferences);
+            FromJsonUtilO(FromJsonField(input, keyGameCertificateReferences), GameCertificateReferences);
+            FromJsonUtilO(FromJsonField(input, keyInstrumentationConfiguration), pfInstrumentationConfiguration);
+            FromJsonUtilS(FromJsonField(input, keyMetadata), Metadata);
+            FromJsonUtilP(FromJsonField(input, keyMultiplayerServerCountPerVm), MultiplayerServerCountPerVm);
+            FromJsonUtilS(FromJsonField(input, keyOsPlatform), OsPlatform);
+            FromJsonUtilO(FromJsonField(input, keyPorts), Ports);
+            FromJsonUtilO(FromJsonField(input, keyRegionConfigurations), RegionConfigurations);
+            FromJsonUtilS(FromJsonField(input, keyServerType), ServerType);
+            FromJsonUtilS(FromJsonField(input, keyStartMultiplayerServerCommand), StartMultiplayerServerCommand);
+            FromJsonUtilP(FromJsonField(input, keyUseStreamingForAssetDownloads), UseStreamingForAssetDownloads);
+            FromJsonUtilE(FromJsonField(input, keyVmSize), VmSize);
+        }
+
+        Json::Value GetBuildResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AreAssetsReadonly; ToJsonUtilP(AreAssetsReadonly, each_AreAssetsReadonly); ToJsonField(output, keyAreAssetsReadonly) = each_AreAssetsReadonly;
+            Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); ToJsonField(output, keyBuildId) = each_BuildId;
+            Json::Value each_BuildName; ToJsonUtilS(BuildName, each_BuildName); ToJsonField(output, keyBuildName) = each_BuildName;
+            Json::Value each_BuildStatus; ToJsonUtilS(BuildStatus, each_BuildStatus); ToJsonField(output, keyBuildStatus) = each_BuildStatus;
+            Json::Value each_pfContainerFlavor; ToJsonUtilE(pfContainerFlavor, each_pfContainerFlavor); ToJsonField(output, keyContainerFlavor) = each_pfContainerFlavor;
+            Json::Value each_ContainerRunCommand; ToJsonUtilS(ContainerRunCommand, each_ContainerRunCommand); ToJsonField(output, keyContainerRunCommand) = each_ContainerRunCommand;
+            Json::Value each_CreationTime; ToJsonUtilT(CreationTime, each_CreationTime); ToJsonField(output, keyCreationTime) = each_CreationTime;
+            Json::Value each_CustomGameContainerImage; ToJsonUtilO(CustomGameContainerImage, each_CustomGameContainerImage); ToJsonField(output, keyCustomGameContainerImage) = each_CustomGameContainerImage;
+            Json::Value each_GameAssetReferences; ToJsonUtilO(GameAssetReferences, each_GameAssetReferences); ToJsonField(output, keyGameAssetReferences) = each_GameAssetReferences;
+            Json::Value each_GameCertificateReferences; ToJsonUtilO(GameCertificateReferences, each_GameCertificateReferences); ToJsonField(output, keyGameCertificateReferences) = each_GameCertificateReferences;
+            Json::Value each_pfInstrumentationConfiguration; ToJsonUtilO(pfInstrumentationConfiguration, each_pfInstrumentationConfiguration); ToJsonField(output, keyInstrumentationConfiguration) = each_pfInstrumentationConfiguration;
+            Json::Value each_Metadata; ToJsonUtilS(Metadata, each_Metadata); ToJsonField(output, keyMetadata) = each_Metadata;
+            Json::Value each_MultiplayerServerCountPerVm; ToJsonUtilP(MultiplayerServerCountPerVm, each_MultiplayerServerCountPerVm); ToJsonField(output, keyMultiplayerServerCountPerVm) = each_MultiplayerServerCountPerVm;
+            Json::Value each_OsPlatform; ToJsonUtilS(OsPlatform, each_OsPlatform); ToJsonField(output, keyOsPlatform) = each_OsPlatform;
+            Json::Value each_Ports; ToJsonUtilO(Ports, each_Ports); ToJsonField(output, keyPorts) = each_Ports;
+            Json::Value each_RegionConfigurations; ToJsonUtilO(RegionConfigurations, each_RegionConfigurations); ToJsonField(output, keyRegionConfigurations) = each_RegionConfigurations;
+            Json::Value each_ServerType; ToJsonUtilS(ServerType, each_ServerType); ToJsonField(output, keyServerType) = each_ServerType;
+            Json::Value each_StartMultiplayerServerCommand; ToJsonUtilS(StartMultiplayerServerCommand, each_StartMultiplayerServerCommand); ToJsonField(output, keyStartMultiplayerServerCommand) = each_StartMultiplayerServerCommand;
+            Json::Value each_UseStreamingForAssetDownloads; ToJsonUtilP(UseStreamingForAssetDownloads, each_UseStreamingForAssetDownloads); ToJsonField(output, keyUseStreamingForAssetDownloads) = each_UseStreamingForAssetDownloads;
+            Json::Value each_VmSize; ToJsonUtilE(VmSize, each_VmSize); ToJsonField(output, keyVmSize) = each_VmSize;
+            return output;
+        }
+
+        void GetContainerRegistryCredentialsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value GetContainerRegistryCredentialsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void GetContainerRegistryCredentialsResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyDnsName), DnsName);
+            FromJsonUtilS(FromJsonField(input, keyPassword), Password);
+            FromJsonUtilS(FromJsonField(input, keyUsername), Username);
+        }
+
+        Json::Value GetContainerRegistryCredentialsResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_DnsName; ToJsonUtilS(DnsName, each_DnsName); ToJsonField(output, keyDnsName) = each_DnsName;
+            Json::Value each_Password; ToJsonUtilS(Password, each_Password); ToJsonField(output, keyPassword) = each_Password;
+            Json::Value each_Username; ToJsonUtilS(Username, each_Username); ToJsonField(output, keyUsername) = each_Username;
+            return output;
+        }
+
+        void GetMatchmakingTicketRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyEscapeObject), EscapeObject);
+            FromJsonUtilS(FromJsonField(input, keyQueueName), QueueName);
+            FromJsonUtilS(FromJsonField(input, keyTicketId), TicketId);
+        }
+
+        Json::Value GetMatchmakingTicketRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_EscapeObject; ToJsonUtilP(EscapeObject, each_EscapeObject); ToJsonField(output, keyEscapeObject) = each_EscapeObject;
+            Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); ToJsonField(output, keyQueueName) = each_QueueName;
+            Json::Value each_TicketId; ToJsonUtilS(TicketId, each_TicketId); ToJsonField(output, keyTicketId) = each_TicketId;
+            return output;
+        }
+
+        void GetMatchmakingTicketResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCancellationReasonString), CancellationReasonString);
+            FromJsonUtilT(FromJsonField(input, keyCreated), Created);
+            FromJsonUtilO(FromJsonField(input, keyCreator), Creator);
+            FromJsonUtilP(FromJsonField(input, keyGiveUpAfterSeconds), GiveUpAfterSeconds);
+            FromJsonUtilS(FromJsonField(input, keyMatchId), MatchId);
+            FromJsonUtilO(FromJsonField(input, keyMembers), Members);
+            FromJsonUtilO(FromJsonField(input, keyMembersToMatchWith), MembersToMatchWith);
+            FromJsonUtilS(FromJsonField(input, keyQueueName), QueueName);
+            FromJsonUtilS(FromJsonField(input, keyStatus), Status);
+            FromJsonUtilS(FromJsonField(input, keyTicketId), TicketId);
+        }
+
+        Json::Value GetMatchmakingTicketResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CancellationReasonString; ToJsonUtilS(CancellationReasonString, each_CancellationReasonString); ToJsonField(output, keyCancellationReasonString) = each_CancellationReasonString;
+            Json::Value each_Created; ToJsonUtilT(Created, each_Created); ToJsonField(output, keyCreated) = each_Created;
+            Json::Value each_Creator; ToJsonUtilO(Creator, each_Creator); ToJsonField(output, keyCreator) = each_Creator;
+            Json::Value each_GiveUpAfterSeconds; ToJsonUtilP(GiveUpAfterSeconds, each_GiveUpAfterSeconds); ToJsonField(output, keyGiveUpAfterSeconds) = each_GiveUpAfterSeconds;
+            Json::Value each_MatchId; ToJsonUtilS(MatchId, each_MatchId); ToJsonField(output, keyMatchId) = each_MatchId;
+            Json::Value each_Members; ToJsonUtilO(Members, each_Members); ToJsonField(output, keyMembers) = each_Members;
+            Json::Value each_MembersToMatchWith; ToJsonUtilO(MembersToMatchWith, each_MembersToMatchWith); ToJsonField(output, keyMembersToMatchWith) = each_MembersToMatchWith;
+            Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); ToJsonField(output, keyQueueName) = each_QueueName;
+            Json::Value each_Status; ToJsonUtilS(Status, each_Status); ToJsonField(output, keyStatus) = each_Status;
+            Json::Value each_TicketId; ToJsonUtilS(TicketId, each_TicketId); ToJsonField(output, keyTicketId) = each_TicketId;
+            return output;
+        }
+
+        void GetMatchRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyEscapeObject), EscapeObject);
+            FromJsonUtilS(FromJsonField(input, keyMatchId), MatchId);
+            FromJsonUtilS(FromJsonField(input, keyQueueName), QueueName);
+            FromJsonUtilP(FromJsonField(input, keyReturnMemberAttributes), ReturnMemberAttributes);
+        }
+
+        Json::Value GetMatchRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_EscapeObject; ToJsonUtilP(EscapeObject, each_EscapeObject); ToJsonField(output, keyEscapeObject) = each_EscapeObject;
+            Json::Value each_MatchId; ToJsonUtilS(MatchId, each_MatchId); ToJsonField(output, keyMatchId) = each_MatchId;
+            Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); ToJsonField(output, keyQueueName) = each_QueueName;
+            Json::Value each_ReturnMemberAttributes; ToJsonUtilP(ReturnMemberAttributes, each_ReturnMemberAttributes); ToJsonField(output, keyReturnMemberAttributes) = each_ReturnMemberAttributes;
+            return output;
+        }
+
+        void GetMatchResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyMatchId), MatchId);
+            FromJsonUtilO(FromJsonField(input, keyMembers), Members);
+            FromJsonUtilS(FromJsonField(input, keyRegionPreferences), RegionPreferences);
+            FromJsonUtilO(FromJsonField(input, keyServerDetails), pfServerDetails);
+        }
+
+        Json::Value GetMatchResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_MatchId; ToJsonUtilS(MatchId, each_MatchId); ToJsonField(output, keyMatchId) = each_MatchId;
+            Json::Value each_Members; ToJsonUtilO(Members, each_Members); ToJsonField(output, keyMembers) = each_Members;
+            Json::Value each_RegionPreferences; ToJsonUtilS(RegionPreferences, each_RegionPreferences); ToJsonField(output, keyRegionPreferences) = each_RegionPreferences;
+            Json::Value each_pfServerDetails; ToJsonUtilO(pfServerDetails, each_pfServerDetails); ToJsonField(output, keyServerDetails) = each_pfServerDetails;
+            return output;
+        }
+
+        void GetMultiplayerServerDetailsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBuildId), BuildId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyRegion), Region);
+            FromJsonUtilS(FromJsonField(input, keySessionId), SessionId);
+        }
+
+        Json::Value GetMultiplayerServerDetailsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); ToJsonField(output, keyBuildId) = each_BuildId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Region; ToJsonUtilS(Region, each_Region); ToJsonField(output, keyRegion) = each_Region;
+            Json::Value each_SessionId; ToJsonUtilS(SessionId, each_SessionId); ToJsonField(output, keySessionId) = each_SessionId;
+            return output;
+        }
+
+        void GetMultiplayerServerDetailsResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyConnectedPlayers), ConnectedPlayers);
+            FromJsonUtilS(FromJsonField(input, keyFQDN), FQDN);
+            FromJsonUtilS(FromJsonField(input, keyIPV4Address), IPV4Address);
+            FromJsonUtilT(FromJsonField(input, keyLastStateTransitionTime), LastStateTransitionTime);
+            FromJsonUtilO(FromJsonField(input, keyPorts), Ports);
+            FromJsonUtilS(FromJsonField(input, keyRegion), Region);
+            FromJsonUtilS(FromJsonField(input, keyServerId), ServerId);
+            FromJsonUtilS(FromJsonField(input, keySessionId), SessionId);
+            FromJsonUtilS(FromJsonField(input, keyState), State);
+            FromJsonUtilS(FromJsonField(input, keyVmId), VmId);
+        }
+
+        Json::Value GetMultiplayerServerDetailsResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ConnectedPlayers; ToJsonUtilO(ConnectedPlayers, each_ConnectedPlayers); ToJsonField(output, keyConnectedPlayers) = each_ConnectedPlayers;
+            Json::Value each_FQDN; ToJsonUtilS(FQDN, each_FQDN); ToJsonField(output, keyFQDN) = each_FQDN;
+            Json::Value each_IPV4Address; ToJsonUtilS(IPV4Address, each_IPV4Address); ToJsonField(output, keyIPV4Address) = each_IPV4Address;
+            Json::Value each_LastStateTransitionTime; ToJsonUtilT(LastStateTransitionTime, each_LastStateTransitionTime); ToJsonField(output, keyLastStateTransitionTime) = each_LastStateTransitionTime;
+            Json::Value each_Ports; ToJsonUtilO(Ports, each_Ports); ToJsonField(output, keyPorts) = each_Ports;
+            Json::Value each_Region; ToJsonUtilS(Region, each_Region); ToJsonField(output, keyRegion) = each_Region;
+            Json::Value each_ServerId; ToJsonUtilS(ServerId, each_ServerId); ToJsonField(output, keyServerId) = each_ServerId;
+            Json::Value each_SessionId; ToJsonUtilS(SessionId, each_SessionId); ToJsonField(output, keySessionId) = each_SessionId;
+            Json::Value each_State; ToJsonUtilS(State, each_State); ToJsonField(output, keyState) = each_State;
+            Json::Value each_VmId; ToJsonUtilS(VmId, each_VmId); ToJsonField(output, keyVmId) = each_VmId;
+            return output;
+        }
+
+        void GetMultiplayerServerLogsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyServerId), ServerId);
+        }
+
+        Json::Value GetMultiplayerServerLogsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ServerId; ToJsonUtilS(ServerId, each_ServerId); ToJsonField(output, keyServerId) = each_ServerId;
+            return output;
+        }
+
+        void GetMultiplayerServerLogsResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyLogDownloadUrl), LogDownloadUrl);
+        }
+
+        Json::Value GetMultiplayerServerLogsResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_LogDownloadUrl; ToJsonUtilS(LogDownloadUrl, each_LogDownloadUrl); ToJsonField(output, keyLogDownloadUrl) = each_LogDownloadUrl;
+            return output;
+        }
+
+        void GetMultiplayerSessionLogsBySessionIdRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keySessionId), SessionId);
+        }
+
+        Json::Value GetMultiplayerSessionLogsBySessionIdRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_SessionId; ToJsonUtilS(SessionId, each_SessionId); ToJsonField(output, keySessionId) = each_SessionId;
+            return output;
+        }
+
+        void GetQueueStatisticsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyQueueName), QueueName);
+        }
+
+        Json::Value GetQueueStatisticsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); ToJsonField(output, keyQueueName) = each_QueueName;
+            return output;
+        }
+
+        void Statistics::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyAverage), Average);
+            FromJsonUtilP(FromJsonField(input, keyPercentile50), Percentile50);
+            FromJsonUtilP(FromJsonField(input, keyPercentile90), Percentile90);
+            FromJsonUtilP(FromJsonField(input, keyPercentile99), Percentile99);
+        }
+
+        Json::Value Statistics::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Average; ToJsonUtilP(Average, each_Average); ToJsonField(output, keyAverage) = each_Average;
+            Json::Value each_Percentile50; ToJsonUtilP(Percentile50, each_Percentile50); ToJsonField(output, keyPercentile50) = each_Percentile50;
+            Json::Value each_Percentile90; ToJsonUtilP(Percentile90, each_Percentile90); ToJsonField(output, keyPercentile90) = each_Percentile90;
+            Json::Value each_Percentile99; ToJsonUtilP(Percentile99, each_Percentile99); ToJsonField(output, keyPercentile99) = each_Percentile99;
+            return output;
+        }
+
+        void GetQueueStatisticsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyNumberOfPlayersMatching), NumberOfPlayersMatching);
+            FromJsonUtilO(FromJsonField(input, keyTimeToMatchStatisticsInSeconds), TimeToMatchStatisticsInSeconds);
+        }
+
+        Json::Value GetQueueStatisticsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_NumberOfPlayersMatching; ToJsonUtilP(NumberOfPlayersMatching, each_NumberOfPlayersMatching); ToJsonField(output, keyNumberOfPlayersMatching) = each_NumberOfPlayersMatching;
+            Json::Value each_TimeToMatchStatisticsInSeconds; ToJsonUtilO(TimeToMatchStatisticsInSeconds, each_TimeToMatchStatisticsInSeconds); ToJsonField(output, keyTimeToMatchStatisticsInSeconds) = each_TimeToMatchStatisticsInSeconds;
+            return output;
+        }
+
+        void GetRemoteLoginEndpointRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBuildId), BuildId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyRegion), Region);
+            FromJsonUtilS(FromJsonField(input, keyVmId), VmId);
+        }
+
+        Json::Value GetRemoteLoginEndpointRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); ToJsonField(output, keyBuildId) = each_BuildId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Region; ToJsonUtilS(Region, each_Region); ToJsonField(output, keyRegion) = each_Region;
+            Json::Value each_VmId; ToJsonUtilS(VmId, each_VmId); ToJsonField(output, keyVmId) = each_VmId;
+            return output;
+        }
+
+        void GetRemoteLoginEndpointResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyIPV4Address), IPV4Address);
+            FromJsonUtilP(FromJsonField(input, keyPort), Port);
+        }
+
+        Json::Value GetRemoteLoginEndpointResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_IPV4Address; ToJsonUtilS(IPV4Address, each_IPV4Address); ToJsonField(output, keyIPV4Address) = each_IPV4Address;
+            Json::Value each_Port; ToJsonUtilP(Port, each_Port); ToJsonField(output, keyPort) = each_Port;
+            return output;
+        }
+
+        void GetServerBackfillTicketRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyEscapeObject), EscapeObject);
+            FromJsonUtilS(FromJsonField(input, keyQueueName), QueueName);
+            FromJsonUtilS(FromJsonField(input, keyTicketId), TicketId);
+        }
+
+        Json::Value GetServerBackfillTicketRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_EscapeObject; ToJsonUtilP(EscapeObject, each_EscapeObject); ToJsonField(output, keyEscapeObject) = each_EscapeObject;
+            Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); ToJsonField(output, keyQueueName) = each_QueueName;
+            Json::Value each_TicketId; ToJsonUtilS(TicketId, each_TicketId); ToJsonField(output, keyTicketId) = each_TicketId;
+            return output;
+        }
+
+        void GetServerBackfillTicketResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCancellationReasonString), CancellationReasonString);
+            FromJsonUtilT(FromJsonField(input, keyCreated), Created);
+            FromJsonUtilP(FromJsonField(input, keyGiveUpAfterSeconds), GiveUpAfterSeconds);
+            FromJsonUtilS(FromJsonField(input, keyMatchId), MatchId);
+            FromJsonUtilO(FromJsonField(input, keyMembers), Members);
+            FromJsonUtilS(FromJsonField(input, keyQueueName), QueueName);
+            FromJsonUtilO(FromJsonField(input, keyServerDetails), pfServerDetails);
+            FromJsonUtilS(FromJsonField(input, keyStatus), Status);
+            FromJsonUtilS(FromJsonField(input, keyTicketId), TicketId);
+        }
+
+        Json::Value GetServerBackfillTicketResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CancellationReasonString; ToJsonUtilS(CancellationReasonString, each_CancellationReasonString); ToJsonField(output, keyCancellationReasonString) = each_CancellationReasonString;
+            Json::Value each_Created; ToJsonUtilT(Created, each_Created); ToJsonField(output, keyCreated) = each_Created;
+            Json::Value each_GiveUpAfterSeconds; ToJsonUtilP(GiveUpAfterSeconds, each_GiveUpAfterSeconds); ToJsonField(output, keyGiveUpAfterSeconds) = each_GiveUpAfterSeconds;
+            Json::Value each_MatchId; ToJsonUtilS(MatchId, each_MatchId); ToJsonField(output, keyMatchId) = each_MatchId;
+            Json::Value each_Members; ToJsonUtilO(Members, each_Members); ToJsonField(output, keyMembers) = each_Members;
+            Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); ToJsonField(output, keyQueueName) = each_QueueName;
+            Json::Value each_pfServerDetails; ToJsonUtilO(pfServerDetails, each_pfServerDetails); ToJsonField(output, keyServerDetails) = each_pfServerDetails;
+            Json::Value each_Status; ToJsonUtilS(Status, each_Status); ToJsonField(output, keyStatus) = each_Status;
+            Json::Value each_TicketId; ToJsonUtilS(TicketId, each_TicketId); ToJsonField(output, keyTicketId) = each_TicketId;
+            return output;
+        }
+
+        void GetTitleEnabledForMultiplayerServersStatusRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value GetTitleEnabledForMultiplayerServersStatusRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void GetTitleEnabledForMultiplayerServersStatusResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilE(FromJsonField(input, keyStatus), Status);
+        }
+
+        Json::Value GetTitleEnabledForMultiplayerServersStatusResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Status; ToJsonUtilE(Status, each_Status); ToJsonField(output, keyStatus) = each_Status;
+            return output;
+        }
+
+        void GetTitleMultiplayerServersQuotaChangeRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyRequestId), RequestId);
+        }
+
+        Json::Value GetTitleMultiplayerServersQuotaChangeRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_RequestId; ToJsonUtilS(RequestId, each_RequestId); ToJsonField(output, keyRequestId) = each_RequestId;
+            return output;
+        }
+
+        void QuotaChange::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyChangeDescription), ChangeDescription);
+            FromJsonUtilO(FromJsonField(input, keyChanges), Changes);
+            FromJsonUtilP(FromJsonField(input, keyIsPendingReview), IsPendingReview);
+            FromJsonUtilS(FromJsonField(input, keyNotes), Notes);
+            FromJsonUtilS(FromJsonField(input, keyRequestId), RequestId);
+            FromJsonUtilS(FromJsonField(input, keyReviewComments), ReviewComments);
+            FromJsonUtilP(FromJsonField(input, keyWasApproved), WasApproved);
+        }
+
+        Json::Value QuotaChange::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ChangeDescription; ToJsonUtilS(ChangeDescription, each_ChangeDescription); ToJsonField(output, keyChangeDescription) = each_ChangeDescription;
+            Json::Value each_Changes; ToJsonUtilO(Changes, each_Changes); ToJsonField(output, keyChanges) = each_Changes;
+            Json::Value each_IsPendingReview; ToJsonUtilP(IsPendingReview, each_IsPendingReview); ToJsonField(output, keyIsPendingReview) = each_IsPendingReview;
+            Json::Value each_Notes; ToJsonUtilS(Notes, each_Notes); ToJsonField(output, keyNotes) = each_Notes;
+            Json::Value each_RequestId; ToJsonUtilS(RequestId, each_RequestId); ToJsonField(output, keyRequestId) = each_RequestId;
+            Json::Value each_ReviewComments; ToJsonUtilS(ReviewComments, each_ReviewComments); ToJsonField(output, keyReviewComments) = each_ReviewComments;
+            Json::Value each_WasApproved; ToJsonUtilP(WasApproved, each_WasApproved); ToJsonField(output, keyWasApproved) = each_WasApproved;
+            return output;
+        }
+
+        void GetTitleMultiplayerServersQuotaChangeResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyChange), Change);
+        }
+
+        Json::Value GetTitleMultiplayerServersQuotaChangeResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Change; ToJsonUtilO(Change, each_Change); ToJsonField(output, keyChange) = each_Change;
+            return output;
+        }
+
+        void GetTitleMultiplayerServersQuotasRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value GetTitleMultiplayerServersQuotasRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void TitleMultiplayerServersQuotas::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyCoreCapacities), CoreCapacities);
+        }
+
+        Json::Value TitleMultiplayerServersQuotas::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CoreCapacities; ToJsonUtilO(CoreCapacities, each_CoreCapacities); ToJsonField(output, keyCoreCapacities) = each_CoreCapacities;
+            return output;
+        }
+
+        void GetTitleMultiplayerServersQuotasResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyQuotas), Quotas);
+        }
+
+        Json::Value GetTitleMultiplayerServersQuotasResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Quotas; ToJsonUtilO(Quotas, each_Quotas); ToJsonField(output, keyQuotas) = each_Quotas;
+            return output;
+        }
+
+        void JoinMatchmakingTicketRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyMember), Member);
+            FromJsonUtilS(FromJsonField(input, keyQueueName), QueueName);
+            FromJsonUtilS(FromJsonField(input, keyTicketId), TicketId);
+        }
+
+        Json::Value JoinMatchmakingTicketRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Member; ToJsonUtilO(Member, each_Member); ToJsonField(output, keyMember) = each_Member;
+            Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); ToJsonField(output, keyQueueName) = each_QueueName;
+            Json::Value each_TicketId; ToJsonUtilS(TicketId, each_TicketId); ToJsonField(output, keyTicketId) = each_TicketId;
+            return output;
+        }
+
+        void JoinMatchmakingTicketResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value JoinMatchmakingTicketResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void ListAssetSummariesRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyPageSize), PageSize);
+            FromJsonUtilS(FromJsonField(input, keySkipToken), SkipToken);
+        }
+
+        Json::Value ListAssetSummariesRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PageSize; ToJsonUtilP(PageSize, each_PageSize); ToJsonField(output, keyPageSize) = each_PageSize;
+            Json::Value each_SkipToken; ToJsonUtilS(SkipToken, each_SkipToken); ToJsonField(output, keySkipToken) = each_SkipToken;
+            return output;
+        }
+
+        void ListAssetSummariesResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyAssetSummaries), AssetSummaries);
+            FromJsonUtilP(FromJsonField(input, keyPageSize), PageSize);
+            FromJsonUtilS(FromJsonField(input, keySkipToken), SkipToken);
+        }
+
+        Json::Value ListAssetSummariesResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AssetSummaries; ToJsonUtilO(AssetSummaries, each_AssetSummaries); ToJsonField(output, keyAssetSummaries) = each_AssetSummaries;
+            Json::Value each_PageSize; ToJsonUtilP(PageSize, each_PageSize); ToJsonField(output, keyPageSize) = each_PageSize;
+            Json::Value each_SkipToken; ToJsonUtilS(SkipToken, each_SkipToken); ToJsonField(output, keySkipToken) = each_SkipToken;
+            return output;
+        }
+
+        void ListBuildAliasesForTitleResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyBuildAliases), BuildAliases);
+        }
+
+        Json::Value ListBuildAliasesForTitleResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BuildAliases; ToJsonUtilO(BuildAliases, each_BuildAliases); ToJsonField(output, keyBuildAliases) = each_BuildAliases;
+            return output;
+        }
+
+        void ListBuildSummariesRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyPageSize), PageSize);
+            FromJsonUtilS(FromJsonField(input, keySkipToken), SkipToken);
+        }
+
+        Json::Value ListBuildSummariesRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PageSize; ToJsonUtilP(PageSize, each_PageSize); ToJsonField(output, keyPageSize) = each_PageSize;
+            Json::Value each_SkipToken; ToJsonUtilS(SkipToken, each_SkipToken); ToJsonField(output, keySkipToken) = each_SkipToken;
+            return output;
+        }
+
+        void ListBuildSummariesResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyBuildSummaries), BuildSummaries);
+            FromJsonUtilP(FromJsonField(input, keyPageSize), PageSize);
+            FromJsonUtilS(FromJsonField(input, keySkipToken), SkipToken);
+        }
+
+        Json::Value ListBuildSummariesResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BuildSummaries; ToJsonUtilO(BuildSummaries, each_BuildSummaries); ToJsonField(output, keyBuildSummaries) = each_BuildSummaries;
+            Json::Value each_PageSize; ToJsonUtilP(PageSize, each_PageSize); ToJsonField(output, keyPageSize) = each_PageSize;
+            Json::Value each_SkipToken; ToJsonUtilS(SkipToken, each_SkipToken); ToJsonField(output, keySkipToken) = each_SkipToken;
+            return output;
+        }
+
+        void ListCertificateSummariesRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyPageSize), PageSize);
+            FromJsonUtilS(FromJsonField(input, keySkipToken), SkipToken);
+        }
+
+        Json::Value ListCertificateSummariesRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PageSize; ToJsonUtilP(PageSize, each_PageSize); ToJsonField(output, keyPageSize) = each_PageSize;
+            Json::Value each_SkipToken; ToJsonUtilS(SkipToken, each_SkipToken); ToJsonField(output, keySkipToken) = each_SkipToken;
+            return output;
+        }
+
+        void ListCertificateSummariesResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyCertificateSummaries), CertificateSummaries);
+            FromJsonUtilP(FromJsonField(input, keyPageSize), PageSize);
+            FromJsonUtilS(FromJsonField(input, keySkipToken), SkipToken);
+        }
+
+        Json::Value ListCertificateSummariesResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CertificateSummaries; ToJsonUtilO(CertificateSummaries, each_CertificateSummaries); ToJsonField(output, keyCertificateSummaries) = each_CertificateSummaries;
+            Json::Value each_PageSize; ToJsonUtilP(PageSize, each_PageSize); ToJsonField(output, keyPageSize) = each_PageSize;
+            Json::Value each_SkipToken; ToJsonUtilS(SkipToken, each_SkipToken); ToJsonField(output, keySkipToken) = each_SkipToken;
+            return output;
+        }
+
+        void ListContainerImagesRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyPageSize), PageSize);
+            FromJsonUtilS(FromJsonField(input, keySkipToken), SkipToken);
+        }
+
+        Json::Value ListContainerImagesRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PageSize; ToJsonUtilP(PageSize, each_PageSize); ToJsonField(output, keyPageSize) = each_PageSize;
+            Json::Value each_SkipToken; ToJsonUtilS(SkipToken, each_SkipToken); ToJsonField(output, keySkipToken) = each_SkipToken;
+            return output;
+        }
+
+        void ListContainerImagesResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyImages), Images);
+            FromJsonUtilP(FromJsonField(input, keyPageSize), PageSize);
+            FromJsonUtilS(FromJsonField(input, keySkipToken), SkipToken);
+        }
+
+        Json::Value ListContainerImagesResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Images; ToJsonUtilS(Images, each_Images); ToJsonField(output, keyImages) = each_Images;
+            Json::Value each_PageSize; ToJsonUtilP(PageSize, each_PageSize); ToJsonField(output, keyPageSize) = each_PageSize;
+            Json::Value each_SkipToken; ToJsonUtilS(SkipToken, each_SkipToken); ToJsonField(output, keySkipToken) = each_SkipToken;
+            return output;
+        }
+
+        void ListContainerImageTagsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyImageName), ImageName);
+        }
+
+        Json::Value ListContainerImageTagsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ImageName; ToJsonUtilS(ImageName, each_ImageName); ToJsonField(output, keyImageName) = each_ImageName;
+            return output;
+        }
+
+        void ListContainerImageTagsResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyTags), Tags);
+        }
+
+        Json::Value ListContainerImageTagsResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Tags; ToJsonUtilS(Tags, each_Tags); ToJsonField(output, keyTags) = each_Tags;
+            return output;
+        }
+
+        void ListMatchmakingTicketsForPlayerRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilS(FromJsonField(input, keyQueueName), QueueName);
+        }
+
+        Json::Value ListMatchmakingTicketsForPlayerRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); ToJsonField(output, keyQueueName) = each_QueueName;
+            return output;
+        }
+
+        void ListMatchmakingTicketsForPlayerResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyTicketIds), TicketIds);
+        }
+
+        Json::Value ListMatchmakingTicketsForPlayerResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_TicketIds; ToJsonUtilS(TicketIds, each_TicketIds); ToJsonField(output, keyTicketIds) = each_TicketIds;
+            return output;
+        }
+
+        void ListMultiplayerServersRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBuildId), BuildId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyPageSize), PageSize);
+            FromJsonUtilS(FromJsonField(input, keyRegion), Region);
+            FromJsonUtilS(FromJsonField(input, keySkipToken), SkipToken);
+        }
+
+        Json::Value ListMultiplayerServersRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); ToJsonField(output, keyBuildId) = each_BuildId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PageSize; ToJsonUtilP(PageSize, each_PageSize); ToJsonField(output, keyPageSize) = each_PageSize;
+            Json::Value each_Region; ToJsonUtilS(Region, each_Region); ToJsonField(output, keyRegion) = each_Region;
+            Json::Value each_SkipToken; ToJsonUtilS(SkipToken, each_SkipToken); ToJsonField(output, keySkipToken) = each_SkipToken;
+            return output;
+        }
+
+        void MultiplayerServerSummary::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyConnectedPlayers), ConnectedPlayers);
+            FromJsonUtilT(FromJsonField(input, keyLastStateTransitionTime), LastStateTransitionTime);
+            FromJsonUtilS(FromJsonField(input, keyRegion), Region);
+            FromJsonUtilS(FromJsonField(input, keyServerId), ServerId);
+            FromJsonUtilS(FromJsonField(input, keySessionId), SessionId);
+            FromJsonUtilS(FromJsonField(input, keyState), State);
+            FromJsonUtilS(FromJsonField(input, keyVmId), VmId);
+        }
+
+        Json::Value MultiplayerServerSummary::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ConnectedPlayers; ToJsonUtilO(ConnectedPlayers, each_ConnectedPlayers); ToJsonField(output, keyConnectedPlayers) = each_ConnectedPlayers;
+            Json::Value each_LastStateTransitionTime; ToJsonUtilT(LastStateTransitionTime, each_LastStateTransitionTime); ToJsonField(output, keyLastStateTransitionTime) = each_LastStateTransitionTime;
+            Json::Value each_Region; ToJsonUtilS(Region, each_Region); ToJsonField(output, keyRegion) = each_Region;
+            Json::Value each_ServerId; ToJsonUtilS(ServerId, each_ServerId); ToJsonField(output, keyServerId) = each_ServerId;
+            Json::Value each_SessionId; ToJsonUtilS(SessionId, each_SessionId); ToJsonField(output, keySessionId) = each_SessionId;
+            Json::Value each_State; ToJsonUtilS(State, each_State); ToJsonField(output, keyState) = each_State;
+            Json::Value each_VmId; ToJsonUtilS(VmId, each_VmId); ToJsonField(output, keyVmId) = each_VmId;
+            return output;
+        }
+
+        void ListMultiplayerServersResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyMultiplayerServerSummaries), MultiplayerServerSummaries);
+            FromJsonUtilP(FromJsonField(input, keyPageSize), PageSize);
+            FromJsonUtilS(FromJsonField(input, keySkipToken), SkipToken);
+        }
+
+        Json::Value ListMultiplayerServersResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_MultiplayerServerSummaries; ToJsonUtilO(MultiplayerServerSummaries, each_MultiplayerServerSummaries); ToJsonField(output, keyMultiplayerServerSummaries) = each_MultiplayerServerSummaries;
+            Json::Value each_PageSize; ToJsonUtilP(PageSize, each_PageSize); ToJsonField(output, keyPageSize) = each_PageSize;
+            Json::Value each_SkipToken; ToJsonUtilS(SkipToken, each_SkipToken); ToJsonField(output, keySkipToken) = each_SkipToken;
+            return output;
+        }
+
+        void ListPartyQosServersRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value ListPartyQosServersRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void QosServer::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyRegion), Region);
+            FromJsonUtilS(FromJsonField(input, keyServerUrl), ServerUrl);
+        }
+
+        Json::Value QosServer::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Region; ToJsonUtilS(Region, each_Region); ToJsonField(output, keyRegion) = each_Region;
+            Json::Value each_ServerUrl; ToJsonUtilS(ServerUrl, each_ServerUrl); ToJsonField(output, keyServerUrl) = each_ServerUrl;
+            return output;
+        }
+
+        void ListPartyQosServersResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyPageSize), PageSize);
+            FromJsonUtilO(FromJsonField(input, keyQosServers), QosServers);
+            FromJsonUtilS(FromJsonField(input, keySkipToken), SkipToken);
+        }
+
+        Json::Value ListPartyQosServersResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PageSize; ToJsonUtilP(PageSize, each_PageSize); ToJsonField(output, keyPageSize) = each_PageSize;
+            Json::Value each_QosServers; ToJsonUtilO(QosServers, each_QosServers); ToJsonField(output, keyQosServers) = each_QosServers;
+            Json::Value each_SkipToken; ToJsonUtilS(SkipToken, each_SkipToken); ToJsonField(output, keySkipToken) = each_SkipToken;
+            return output;
+        }
+
+        void ListQosServersForTitleRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyIncludeAllRegions), IncludeAllRegions);
+        }
+
+        Json::Value ListQosServersForTitleRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_IncludeAllRegions; ToJsonUtilP(IncludeAllRegions, each_IncludeAllRegions); ToJsonField(output, keyIncludeAllRegions) = each_IncludeAllRegions;
+            return output;
+        }
+
+        void ListQosServersForTitleResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyPageSize), PageSize);
+            FromJsonUtilO(FromJsonField(input, keyQosServers), QosServers);
+            FromJsonUtilS(FromJsonField(input, keySkipToken), SkipToken);
+        }
+
+        Json::Value ListQosServersForTitleResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PageSize; ToJsonUtilP(PageSize, each_PageSize); ToJsonField(output, keyPageSize) = each_PageSize;
+            Json::Value each_QosServers; ToJsonUtilO(QosServers, each_QosServers); ToJsonField(output, keyQosServers) = each_QosServers;
+            Json::Value each_SkipToken; ToJsonUtilS(SkipToken, each_SkipToken); ToJsonField(output, keySkipToken) = each_SkipToken;
+            return output;
+        }
+
+        void ListServerBackfillTicketsForPlayerRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilS(FromJsonField(input, keyQueueName), QueueName);
+        }
+
+        Json::Value ListServerBackfillTicketsForPlayerRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_QueueName; ToJsonUtilS(QueueName, each_QueueName); ToJsonField(output, keyQueueName) = each_QueueName;
+            return output;
+        }
+
+        void ListServerBackfillTicketsForPlayerResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyTicketIds), TicketIds);
+        }
+
+        Json::Value ListServerBackfillTicketsForPlayerResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_TicketIds; ToJsonUtilS(TicketIds, each_TicketIds); ToJsonField(output, keyTicketIds) = each_TicketIds;
+            return output;
+        }
+
+        void ListTitleMultiplayerServersQuotaChangesRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value ListTitleMultiplayerServersQuotaChangesRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void ListTitleMultiplayerServersQuotaChangesResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyChanges), Changes);
+        }
+
+        Json::Value ListTitleMultiplayerServersQuotaChangesResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Changes; ToJsonUtilO(Changes, each_Changes); ToJsonField(output, keyChanges) = each_Changes;
+            return output;
+        }
+
+        void ListVirtualMachineSummariesRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBuildId), BuildId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyPageSize), PageSize);
+            FromJsonUtilS(FromJsonField(input, keyRegion), Region);
+            FromJsonUtilS(FromJsonField(input, keySkipToken), SkipToken);
+        }
+
+        Json::Value ListVirtualMachineSummariesRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); ToJsonField(output, keyBuildId) = each_BuildId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PageSize; ToJsonUtilP(PageSize, each_PageSize); ToJsonField(output, keyPageSize) = each_PageSize;
+            Json::Value each_Region; ToJsonUtilS(Region, each_Region); ToJsonField(output, keyRegion) = each_Region;
+            Json::Value each_SkipToken; ToJsonUtilS(SkipToken, each_SkipToken); ToJsonField(output, keySkipToken) = each_SkipToken;
+            return output;
+        }
+
+        void VirtualMachineSummary::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyHealthStatus), HealthStatus);
+            FromJsonUtilS(FromJsonField(input, keyState), State);
+            FromJsonUtilS(FromJsonField(input, keyVmId), VmId);
+        }
+
+        Json::Value VirtualMachineSummary::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_HealthStatus; ToJsonUtilS(HealthStatus, each_HealthStatus); ToJsonField(output, keyHealthStatus) = each_HealthStatus;
+            Json::Value each_State; ToJsonUtilS(State, each_State); ToJsonField(output, keyState) = each_State;
+            Json::Value each_VmId; ToJsonUtilS(VmId, each_VmId); ToJsonField(output, keyVmId) = each_VmId;
+            return output;
+        }
+
+        void ListVirtualMachineSummariesResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyPageSize), PageSize);
+            FromJsonUtilS(FromJsonField(input, keySkipToken), SkipToken);
+            FromJsonUtilO(FromJsonField(input, keyVirtualMachines), VirtualMachines);
+        }
+
+        Json::Value ListVirtualMachineSummariesResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PageSize; ToJsonUtilP(PageSize, each_PageSize); ToJsonField(output, keyPageSize) = each_PageSize;
+            Json::Value each_SkipToken; ToJsonUtilS(SkipToken, each_SkipToken); ToJsonField(output, keySkipToken) = each_SkipToken;
+            Json::Value each_VirtualMachines; ToJsonUtilO(VirtualMachines, each_VirtualMachines); ToJsonField(output, keyVirtualMachines) = each_VirtualMachines;
+            return output;
+        }
+
+        void MultiplayerEmptyRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value MultiplayerEmptyRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void RequestMultiplayerServerRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyBuildAliasParams), pfBuildAliasParams);
+            FromJsonUtilS(FromJsonField(input, keyBuildId), BuildId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyInitialPlayers), InitialPlayers);
+            FromJsonUtilS(FromJsonField(input, keyPreferredRegions), PreferredRegions);
+            FromJsonUtilS(FromJsonField(input, keySessionCookie), SessionCookie);
+            FromJsonUtilS(FromJsonField(input, keySessionId), SessionId);
+        }
+
+        Json::Value RequestMultiplayerServerRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_pfBuildAliasParams; ToJsonUtilO(pfBuildAliasParams, each_pfBuildAliasParams); ToJsonField(output, keyBuildAliasParams) = each_pfBuildAliasParams;
+            Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); ToJsonField(output, keyBuildId) = each_BuildId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_InitialPlayers; ToJsonUtilS(InitialPlayers, each_InitialPlayers); ToJsonField(output, keyInitialPlayers) = each_InitialPlayers;
+            Json::Value each_PreferredRegions; ToJsonUtilS(PreferredRegions, each_PreferredRegions); ToJsonField(output, keyPreferredRegions) = each_PreferredRegions;
+            Json::Value each_SessionCookie; ToJsonUtilS(SessionCookie, each_SessionCookie); ToJsonField(output, keySessionCookie) = each_SessionCookie;
+            Json::Value each_SessionId; ToJsonUtilS(SessionId, each_SessionId); ToJsonField(output, keySessionId) = each_SessionId;
+            return output;
+        }
+
+        void RequestMultiplayerServerResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyConnectedPlayers), ConnectedPlayers);
+            FromJsonUtilS(FromJsonField(input, keyFQDN), FQDN);
+            FromJsonUtilS(FromJsonField(input, keyIPV4Address), IPV4Address);
+            FromJsonUtilT(FromJsonField(input, keyLastStateTransitionTime), LastStateTransitionTime);
+            FromJsonUtilO(FromJsonField(input, keyPorts), Ports);
+            FromJsonUtilS(FromJsonField(input, keyRegion), Region);
+            FromJsonUtilS(FromJsonField(input, keyServerId), ServerId);
+            FromJsonUtilS(FromJsonField(input, keySessionId), SessionId);
+            FromJsonUtilS(FromJsonField(input, keyState), State);
+            FromJsonUtilS(FromJsonField(input, keyVmId), VmId);
+        }
+
+        Json::Value RequestMultiplayerServerResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ConnectedPlayers; ToJsonUtilO(ConnectedPlayers, each_ConnectedPlayers); ToJsonField(output, keyConnectedPlayers) = each_ConnectedPlayers;
+            Json::Value each_FQDN; ToJsonUtilS(FQDN, each_FQDN); ToJsonField(output, keyFQDN) = each_FQDN;
+            Json::Value each_IPV4Address; ToJsonUtilS(IPV4Address, each_IPV4Address); ToJsonField(output, keyIPV4Address) = each_IPV4Address;
+            Json::Value each_LastStateTransitionTime; ToJsonUtilT(LastStateTransitionTime, each_LastStateTransitionTime); ToJsonField(output, keyLastStateTransitionTime) = each_LastStateTransitionTime;
+            Json::Value each_Ports; ToJsonUtilO(Ports, each_Ports); ToJsonField(output, keyPorts) = each_Ports;
+            Json::Value each_Region; ToJsonUtilS(Region, each_Region); ToJsonField(output, keyRegion) = each_Region;
+            Json::Value each_ServerId; ToJsonUtilS(ServerId, each_ServerId); ToJsonField(output, keyServerId) = each_ServerId;
+            Json::Value each_SessionId; ToJsonUtilS(SessionId, each_SessionId); ToJsonField(output, keySessionId) = each_SessionId;
+            Json::Value each_State; ToJsonUtilS(State, each_State); ToJsonField(output, keyState) = each_State;
+            Json::Value each_VmId; ToJsonUtilS(VmId, each_VmId); ToJsonField(output, keyVmId) = each_VmId;
+            return output;
+        }
+
+        void RolloverContainerRegistryCredentialsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value RolloverContainerRegistryCredentialsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void RolloverContainerRegistryCredentialsResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyDnsName), DnsName);
+            FromJsonUtilS(FromJsonField(input, keyPassword), Password);
+            FromJsonUtilS(FromJsonField(input, keyUsername), Username);
+        }
+
+        Json::Value RolloverContainerRegistryCredentialsResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_DnsName; ToJsonUtilS(DnsName, each_DnsName); ToJsonField(output, keyDnsName) = each_DnsName;
+            Json::Value each_Password; ToJsonUtilS(Password, each_Password); ToJsonField(output, keyPassword) = each_Password;
+            Json::Value each_Username; ToJsonUtilS(Username, each_Username); ToJsonField(output, keyUsername) = each_Username;
+            return output;
+        }
+
+        void ShutdownMultiplayerServerRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBuildId), BuildId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyRegion), Region);
+            FromJsonUtilS(FromJsonField(input, keySessionId), SessionId);
+        }
+
+        Json::Value ShutdownMultiplayerServerRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); ToJsonField(output, keyBuildId) = each_BuildId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Region; ToJsonUtilS(Region, each_Region); ToJsonField(output, keyRegion) = each_Region;
+            Json::Value each_SessionId; ToJsonUtilS(SessionId, each_SessionId); ToJsonField(output, keySessionId) = each_SessionId;
+            return output;
+        }
+
+        void UntagContainerImageRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyImageName), ImageName);
+            FromJsonUtilS(FromJsonField(input, keyTag), Tag);
+        }
+
+        Json::Value UntagContainerImageRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ImageName; ToJsonUtilS(ImageName, each_ImageName); ToJsonField(output, keyImageName) = each_ImageName;
+            Json::Value each_Tag; ToJsonUtilS(Tag, each_Tag); ToJsonField(output, keyTag) = each_Tag;
+            return output;
+        }
+
+        void UpdateBuildAliasRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAliasId), AliasId);
+            FromJsonUtilS(FromJsonField(input, keyAliasName), AliasName);
+            FromJsonUtilO(FromJsonField(input, keyBuildSelectionCriteria), BuildSelectionCriteria);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value UpdateBuildAliasRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AliasId; ToJsonUtilS(AliasId, each_AliasId); ToJsonField(output, keyAliasId) = each_AliasId;
+            Json::Value each_AliasName; ToJsonUtilS(AliasName, each_AliasName); ToJsonField(output, keyAliasName) = each_AliasName;
+            Json::Value each_BuildSelectionCriteria; ToJsonUtilO(BuildSelectionCriteria, each_BuildSelectionCriteria); ToJsonField(output, keyBuildSelectionCriteria) = each_BuildSelectionCriteria;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void UpdateBuildNameRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBuildId), BuildId);
+            FromJsonUtilS(FromJsonField(input, keyBuildName), BuildName);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value UpdateBuildNameRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); ToJsonField(output, keyBuildId) = each_BuildId;
+            Json::Value each_BuildName; ToJsonUtilS(BuildName, each_BuildName); ToJsonField(output, keyBuildName) = each_BuildName;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void UpdateBuildRegionRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBuildId), BuildId);
+            FromJsonUtilO(FromJsonField(input, keyBuildRegion), BuildRegion);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value UpdateBuildRegionRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); ToJsonField(output, keyBuildId) = each_BuildId;
+            Json::Value each_BuildRegion; ToJsonUtilO(BuildRegion, each_BuildRegion); ToJsonField(output, keyBuildRegion) = each_BuildRegion;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void UpdateBuildRegionsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBuildId), BuildId);
+            FromJsonUtilO(FromJsonField(input, keyBuildRegions), BuildRegions);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value UpdateBuildRegionsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BuildId; ToJsonUtilS(BuildId, each_BuildId); ToJsonField(output, keyBuildId) = each_BuildId;
+            Json::Value each_BuildRegions; ToJsonUtilO(BuildRegions, each_BuildRegions); ToJsonField(output, keyBuildRegions) = each_BuildRegions;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void UploadCertificateRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyGameCertificate), GameCertificate);
+        }
+
+        Json::Value UploadCertificateRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_GameCertificate; ToJsonUtilO(GameCertificate, each_GameCertificate); ToJsonField(output, keyGameCertificate) = each_GameCertificate;
+            return output;
+        }
+    }
+}
+
+#endif
@@ -2,9 +2,38 @@
 
 #include <playfab/PlayFabPluginManager.h>
 #include <playfab/PlayFabTransportHeaders.h>
+#include <playfab/PlayFabJsonSerializerPlugin.h>
 
 namespace PlayFab
 {
+    namespace
+    {
+        std::atomic<uint64_t> nextPluginsGeneration(1);
+
+        uint64_t NewPluginsGeneration()
+        {
+            return nextPluginsGeneration.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // A per-thread cache of the last default-instance lookup for each contract.
+        // It holds the plugin weakly, so a replaced plugin isn't kept alive by threads that looked it up before.
+        struct CachedPluginLookup
+        {
+            const PlayFabPluginManager* manager = nullptr;
+            uint64_t generation = 0;
+            std::weak_ptr<IPlayFabPlugin> plugin;
+        };
+
+        constexpr size_t cachedPluginContractCount = static_cast<size_t>(PlayFabPluginContract::PlayFab_Transport) + 1;
+
+        CachedPluginLookup* GetCachedPluginLookup(PlayFabPluginContract contract)
+        {
+            static thread_local CachedPluginLookup cachedLookups[cachedPluginContractCount];
+            const size_t index = static_cast<size_t>(contract);
+            return (index < cachedPluginContractCount) ? &cachedLookups[index] : nullptr;
+        }
+    }
+
     const std::string PlayFabPluginManager::defaultInstanceName;
 
     PlayFabPluginManager& PlayFabPluginManager::GetInstance()
@@ -13,7 +42,8 @@ namespace PlayFab
         return instance;
     }
 
-    PlayFabPluginManager::PlayFabPluginManager()
+    PlayFabPluginManager::PlayFabPluginManager() :
+        pluginsGeneration(NewPluginsGeneration())
     {
     }
 
@@ -28,6 +58,33 @@ namespace PlayFab
     }
 
     std::shared_ptr<IPlayFabPlugin> PlayFabPluginManager::GetPluginInternal(const PlayFabPluginContract contract, const std::string& instanceName)
+    {
+        CachedPluginLookup* cachedLookup = instanceName.empty() ? GetCachedPluginLookup(contract) : nullptr;
+        if (cachedLookup == nullptr)
+        {
+            uint64_t generation;
+            return GetPluginLocked(contract, instanceName, generation);
+        }
+
+        // Fast path: nothing has been created or replaced since this thread last looked the plugin up
+        if (cachedLookup->manager == this && cachedLookup->generation == pluginsGeneration.load(std::memory_order_acquire))
+        {
+            std::shared_ptr<IPlayFabPlugin> plugin = cachedLookup->plugin.lock();
+            if (plugin != nullptr)
+            {
+                return plugin;
+            }
+        }
+
+        uint64_t generation;
+        std::shared_ptr<IPlayFabPlugin> plugin = GetPluginLocked(contract, instanceName, generation);
+        cachedLookup->manager = this;
+        cachedLookup->generation = generation;
+        cachedLookup->plugin = plugin;
+        return plugin;
+    }
+
+    std::shared_ptr<IPlayFabPlugin> PlayFabPluginManager::GetPluginLocked(const PlayFabPluginContract contract, const std::string& instanceName, uint64_t& generation)
     {
         { // LOCK pluginsMutex
             std::unique_lock<std::mutex> lock(pluginsMutex);
@@ -46,7 +103,9 @@ namespace PlayFab
                     throw PlayFabException(PlayFabExceptionCode::PluginAmbiguity, "This contract is not supported");
                     break;
                 }
+                pluginsGeneration.store(NewPluginsGeneration(), std::memory_order_release);
             }
+            generation = pluginsGeneration.load(std::memory_order_relaxed);
             return entry.plugin;
         } // UNLOCK pluginsMutex
     }
@@ -57,6 +116,7 @@ namespace PlayFab
             std::unique_lock<std::mutex> lock(pluginsMutex);
             PluginEntry& entry = FindOrCreatePluginEntry(contract, instanceName);
             entry.plugin = plugin;
+            pluginsGeneration.store(NewPluginsGeneration(), std::memory_order_release);
         } // UNLOCK pluginsMutex
     }
 
@@ -76,7 +136,7 @@ namespace PlayFab
 
     std::shared_ptr<IPlayFabPlugin> PlayFabPluginManager::CreatePlayFabSerializerPlugin()
     {
-        return std::make_shared<IPlayFabSerializerPlugin>();
+        return std::make_shared<PlayFabJsonSerializerPlugin>();
     }
 
     std::shared_ptr<IPlayFabPlugin> PlayFabPluginManager::CreatePlayFabTransportPlugin()
@@ -0,0 +1,515 @@
+#include <stdafx.h>
+
+#if !defined(DISABLE_PLAYFABENTITY_API)
+
+#include <playfab/PlayFabProfilesDataModels.h>
+
+namespace PlayFab
+{
+    namespace ProfilesModels
+    {
+        namespace
+        {
+            // The json field names of the models below
+            constexpr PlayFabJsonKey keyAction("Action");
+            constexpr PlayFabJsonKey keyAvatarUrl("AvatarUrl");
+            constexpr PlayFabJsonKey keyCharacterId("CharacterId");
+            constexpr PlayFabJsonKey keyChecksum("Checksum");
+            constexpr PlayFabJsonKey keyChildName("ChildName");
+            constexpr PlayFabJsonKey keyChildStatistics("ChildStatistics");
+            constexpr PlayFabJsonKey keyComment("Comment");
+            constexpr PlayFabJsonKey keyCondition("Condition");
+            constexpr PlayFabJsonKey keyCreated("Created");
+            constexpr PlayFabJsonKey keyCustomTags("CustomTags");
+            constexpr PlayFabJsonKey keyDataAsObject("DataAsObject");
+            constexpr PlayFabJsonKey keyDataObject("DataObject");
+            constexpr PlayFabJsonKey keyDisplayName("DisplayName");
+            constexpr PlayFabJsonKey keyEffect("Effect");
+            constexpr PlayFabJsonKey keyEntities("Entities");
+            constexpr PlayFabJsonKey keyEntity("Entity");
+            constexpr PlayFabJsonKey keyEntityChain("EntityChain");
+            constexpr PlayFabJsonKey keyEscapedDataObject("EscapedDataObject");
+            constexpr PlayFabJsonKey keyExpectedVersion("ExpectedVersion");
+            constexpr PlayFabJsonKey keyExperimentVariants("ExperimentVariants");
+            constexpr PlayFabJsonKey keyFileName("FileName");
+            constexpr PlayFabJsonKey keyFiles("Files");
+            constexpr PlayFabJsonKey keyGroupId("GroupId");
+            constexpr PlayFabJsonKey keyId("Id");
+            constexpr PlayFabJsonKey keyLanguage("Language");
+            constexpr PlayFabJsonKey keyLastModified("LastModified");
+            constexpr PlayFabJsonKey keyLeaderboardMetadata("LeaderboardMetadata");
+            constexpr PlayFabJsonKey keyLineage("Lineage");
+            constexpr PlayFabJsonKey keyMasterPlayerAccountId("MasterPlayerAccountId");
+            constexpr PlayFabJsonKey keyMasterPlayerAccountIds("MasterPlayerAccountIds");
+            constexpr PlayFabJsonKey keyMetadata("Metadata");
+            constexpr PlayFabJsonKey keyName("Name");
+            constexpr PlayFabJsonKey keyNamespaceId("NamespaceId");
+            constexpr PlayFabJsonKey keyObjectName("ObjectName");
+            constexpr PlayFabJsonKey keyObjects("Objects");
+            constexpr PlayFabJsonKey keyOperationResult("OperationResult");
+            constexpr PlayFabJsonKey keyPermissions("Permissions");
+            constexpr PlayFabJsonKey keyPrincipal("Principal");
+            constexpr PlayFabJsonKey keyProfile("Profile");
+            constexpr PlayFabJsonKey keyProfiles("Profiles");
+            constexpr PlayFabJsonKey keyResource("Resource");
+            constexpr PlayFabJsonKey keySize("Size");
+            constexpr PlayFabJsonKey keyStatements("Statements");
+            constexpr PlayFabJsonKey keyStatistics("Statistics");
+            constexpr PlayFabJsonKey keyTitleId("TitleId");
+            constexpr PlayFabJsonKey keyTitlePlayerAccountId("TitlePlayerAccountId");
+            constexpr PlayFabJsonKey keyTitlePlayerAccounts("TitlePlayerAccounts");
+            constexpr PlayFabJsonKey keyType("Type");
+            constexpr PlayFabJsonKey keyValue("Value");
+            constexpr PlayFabJsonKey keyVersion("Version");
+            constexpr PlayFabJsonKey keyVersionNumber("VersionNumber");
+        }
+
+        void ToJsonEnum(const EffectType input, Json::Value& output)
+        {
+            if (input == EffectType::EffectTypeAllow)
+            {
+                output = Json::Value(Json::StaticString("Allow"));
+                return;
+            }
+            if (input == EffectType::EffectTypeDeny)
+            {
+                output = Json::Value(Json::StaticString("Deny"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, EffectType& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Allow")
+            {
+                output = EffectType::EffectTypeAllow;
+                return;
+            }
+            if (inputStr == "Deny")
+            {
+                output = EffectType::EffectTypeDeny;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const OperationTypes input, Json::Value& output)
+        {
+            if (input == OperationTypes::OperationTypesCreated)
+            {
+                output = Json::Value(Json::StaticString("Created"));
+                return;
+            }
+            if (input == OperationTypes::OperationTypesUpdated)
+            {
+                output = Json::Value(Json::StaticString("Updated"));
+                return;
+            }
+            if (input == OperationTypes::OperationTypesDeleted)
+            {
+                output = Json::Value(Json::StaticString("Deleted"));
+                return;
+            }
+            if (input == OperationTypes::OperationTypesNone)
+            {
+                output = Json::Value(Json::StaticString("None"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, OperationTypes& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Created")
+            {
+                output = OperationTypes::OperationTypesCreated;
+                return;
+            }
+            if (inputStr == "Updated")
+            {
+                output = OperationTypes::OperationTypesUpdated;
+                return;
+            }
+            if (inputStr == "Deleted")
+            {
+                output = OperationTypes::OperationTypesDeleted;
+                return;
+            }
+            if (inputStr == "None")
+            {
+                output = OperationTypes::OperationTypesNone;
+                return;
+            }
+        }
+
+        void EntityDataObject::FromJson(const Json::Value& input)
+        {
+            DataObject = FromJsonField(input, keyDataObject);
+            FromJsonUtilS(FromJsonField(input, keyEscapedDataObject), EscapedDataObject);
+            FromJsonUtilS(FromJsonField(input, keyObjectName), ObjectName);
+        }
+
+        Json::Value EntityDataObject::ToJson() const
+        {
+            Json::Value output;
+            ToJsonField(output, keyDataObject) = DataObject;
+            Json::Value each_EscapedDataObject; ToJsonUtilS(EscapedDataObject, each_EscapedDataObject); ToJsonField(output, keyEscapedDataObject) = each_EscapedDataObject;
+            Json::Value each_ObjectName; ToJsonUtilS(ObjectName, each_ObjectName); ToJsonField(output, keyObjectName) = each_ObjectName;
+            return output;
+        }
+
+        void EntityKey::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyId), Id);
+            FromJsonUtilS(FromJsonField(input, keyType), Type);
+        }
+
+        Json::Value EntityKey::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Id; ToJsonUtilS(Id, each_Id); ToJsonField(output, keyId) = each_Id;
+            Json::Value each_Type; ToJsonUtilS(Type, each_Type); ToJsonField(output, keyType) = each_Type;
+            return output;
+        }
+
+        void EntityLineage::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyGroupId), GroupId);
+            FromJsonUtilS(FromJsonField(input, keyMasterPlayerAccountId), MasterPlayerAccountId);
+            FromJsonUtilS(FromJsonField(input, keyNamespaceId), NamespaceId);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+            FromJsonUtilS(FromJsonField(input, keyTitlePlayerAccountId), TitlePlayerAccountId);
+        }
+
+        Json::Value EntityLineage::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_GroupId; ToJsonUtilS(GroupId, each_GroupId); ToJsonField(output, keyGroupId) = each_GroupId;
+            Json::Value each_MasterPlayerAccountId; ToJsonUtilS(MasterPlayerAccountId, each_MasterPlayerAccountId); ToJsonField(output, keyMasterPlayerAccountId) = each_MasterPlayerAccountId;
+            Json::Value each_NamespaceId; ToJsonUtilS(NamespaceId, each_NamespaceId); ToJsonField(output, keyNamespaceId) = each_NamespaceId;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            Json::Value each_TitlePlayerAccountId; ToJsonUtilS(TitlePlayerAccountId, each_TitlePlayerAccountId); ToJsonField(output, keyTitlePlayerAccountId) = each_TitlePlayerAccountId;
+            return output;
+        }
+
+        void EntityPermissionStatement::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAction), Action);
+            FromJsonUtilS(FromJsonField(input, keyComment), Comment);
+            Condition = FromJsonField(input, keyCondition);
+            FromJsonEnum(FromJsonField(input, keyEffect), Effect);
+            Principal = FromJsonField(input, keyPrincipal);
+            FromJsonUtilS(FromJsonField(input, keyResource), Resource);
+        }
+
+        Json::Value EntityPermissionStatement::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Action; ToJsonUtilS(Action, each_Action); ToJsonField(output, keyAction) = each_Action;
+            Json::Value each_Comment; ToJsonUtilS(Comment, each_Comment); ToJsonField(output, keyComment) = each_Comment;
+            ToJsonField(output, keyCondition) = Condition;
+            Json::Value each_Effect; ToJsonEnum(Effect, each_Effect); ToJsonField(output, keyEffect) = each_Effect;
+            ToJsonField(output, keyPrincipal) = Principal;
+            Json::Value each_Resource; ToJsonUtilS(Resource, each_Resource); ToJsonField(output, keyResource) = each_Resource;
+            return output;
+        }
+
+        void EntityProfileFileMetadata::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyChecksum), Checksum);
+            FromJsonUtilS(FromJsonField(input, keyFileName), FileName);
+            FromJsonUtilT(FromJsonField(input, keyLastModified), LastModified);
+            FromJsonUtilP(FromJsonField(input, keySize), Size);
+        }
+
+        Json::Value EntityProfileFileMetadata::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Checksum; ToJsonUtilS(Checksum, each_Checksum); ToJsonField(output, keyChecksum) = each_Checksum;
+            Json::Value each_FileName; ToJsonUtilS(FileName, each_FileName); ToJsonField(output, keyFileName) = each_FileName;
+            Json::Value each_LastModified; ToJsonUtilT(LastModified, each_LastModified); ToJsonField(output, keyLastModified) = each_LastModified;
+            Json::Value each_Size; ToJsonUtilP(Size, each_Size); ToJsonField(output, keySize) = each_Size;
+            return output;
+        }
+
+        void EntityStatisticChildValue::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyChildName), ChildName);
+            FromJsonUtilS(FromJsonField(input, keyMetadata), Metadata);
+            FromJsonUtilP(FromJsonField(input, keyValue), Value);
+        }
+
+        Json::Value EntityStatisticChildValue::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ChildName; ToJsonUtilS(ChildName, each_ChildName); ToJsonField(output, keyChildName) = each_ChildName;
+            Json::Value each_Metadata; ToJsonUtilS(Metadata, each_Metadata); ToJsonField(output, keyMetadata) = each_Metadata;
+            Json::Value each_Value; ToJsonUtilP(Value, each_Value); ToJsonField(output, keyValue) = each_Value;
+            return output;
+        }
+
+        void EntityStatisticValue::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyChildStatistics), ChildStatistics);
+            FromJsonUtilS(FromJsonField(input, keyMetadata), Metadata);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilP(FromJsonField(input, keyValue), Value);
+            FromJsonUtilP(FromJsonField(input, keyVersion), Version);
+        }
+
+        Json::Value EntityStatisticValue::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ChildStatistics; ToJsonUtilO(ChildStatistics, each_ChildStatistics); ToJsonField(output, keyChildStatistics) = each_ChildStatistics;
+            Json::Value each_Metadata; ToJsonUtilS(Metadata, each_Metadata); ToJsonField(output, keyMetadata) = each_Metadata;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_Value; ToJsonUtilP(Value, each_Value); ToJsonField(output, keyValue) = each_Value;
+            Json::Value each_Version; ToJsonUtilP(Version, each_Version); ToJsonField(output, keyVersion) = each_Version;
+            return output;
+        }
+
+        void EntityProfileBody::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAvatarUrl), AvatarUrl);
+            FromJsonUtilT(FromJsonField(input, keyCreated), Created);
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilS(FromJsonField(input, keyEntityChain), EntityChain);
+            FromJsonUtilS(FromJsonField(input, keyExperimentVariants), ExperimentVariants);
+            FromJsonUtilO(FromJsonField(input, keyFiles), Files);
+            FromJsonUtilS(FromJsonField(input, keyLanguage), Language);
+            FromJsonUtilS(FromJsonField(input, keyLeaderboardMetadata), LeaderboardMetadata);
+            FromJsonUtilO(FromJsonField(input, keyLineage), Lineage);
+            FromJsonUtilO(FromJsonField(input, keyObjects), Objects);
+            FromJsonUtilO(FromJsonField(input, keyPermissions), Permissions);
+            FromJsonUtilO(FromJsonField(input, keyStatistics), Statistics);
+            FromJsonUtilP(FromJsonField(input, keyVersionNumber), VersionNumber);
+        }
+
+        Json::Value EntityProfileBody::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AvatarUrl; ToJsonUtilS(AvatarUrl, each_AvatarUrl); ToJsonField(output, keyAvatarUrl) = each_AvatarUrl;
+            Json::Value each_Created; ToJsonUtilT(Created, each_Created); ToJsonField(output, keyCreated) = each_Created;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_EntityChain; ToJsonUtilS(EntityChain, each_EntityChain); ToJsonField(output, keyEntityChain) = each_EntityChain;
+            Json::Value each_ExperimentVariants; ToJsonUtilS(ExperimentVariants, each_ExperimentVariants); ToJsonField(output, keyExperimentVariants) = each_ExperimentVariants;
+            Json::Value each_Files; ToJsonUtilO(Files, each_Files); ToJsonField(output, keyFiles) = each_Files;
+            Json::Value each_Language; ToJsonUtilS(Language, each_Language); ToJsonField(output, keyLanguage) = each_Language;
+            Json::Value each_LeaderboardMetadata; ToJsonUtilS(LeaderboardMetadata, each_LeaderboardMetadata); ToJsonField(output, keyLeaderboardMetadata) = each_LeaderboardMetadata;
+            Json::Value each_Lineage; ToJsonUtilO(Lineage, each_Lineage); ToJsonField(output, keyLineage) = each_Lineage;
+            Json::Value each_Objects; ToJsonUtilO(Objects, each_Objects); ToJsonField(output, keyObjects) = each_Objects;
+            Json::Value each_Permissions; ToJsonUtilO(Permissions, each_Permissions); ToJsonField(output, keyPermissions) = each_Permissions;
+            Json::Value each_Statistics; ToJsonUtilO(Statistics, each_Statistics); ToJsonField(output, keyStatistics) = each_Statistics;
+            Json::Value each_VersionNumber; ToJsonUtilP(VersionNumber, each_VersionNumber); ToJsonField(output, keyVersionNumber) = each_VersionNumber;
+            return output;
+        }
+
+        void GetEntityProfileRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyDataAsObject), DataAsObject);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+        }
+
+        Json::Value GetEntityProfileRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_DataAsObject; ToJsonUtilP(DataAsObject, each_DataAsObject); ToJsonField(output, keyDataAsObject) = each_DataAsObject;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            return output;
+        }
+
+        void GetEntityProfileResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyProfile), Profile);
+        }
+
+        Json::Value GetEntityProfileResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Profile; ToJsonUtilO(Profile, each_Profile); ToJsonField(output, keyProfile) = each_Profile;
+            return output;
+        }
+
+        void GetEntityProfilesRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyDataAsObject), DataAsObject);
+            FromJsonUtilO(FromJsonField(input, keyEntities), Entities);
+        }
+
+        Json::Value GetEntityProfilesRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_DataAsObject; ToJsonUtilP(DataAsObject, each_DataAsObject); ToJsonField(output, keyDataAsObject) = each_DataAsObject;
+            Json::Value each_Entities; ToJsonUtilO(Entities, each_Entities); ToJsonField(output, keyEntities) = each_Entities;
+            return output;
+        }
+
+        void GetEntityProfilesResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyProfiles), Profiles);
+        }
+
+        Json::Value GetEntityProfilesResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Profiles; ToJsonUtilO(Profiles, each_Profiles); ToJsonField(output, keyProfiles) = each_Profiles;
+            return output;
+        }
+
+        void GetGlobalPolicyRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value GetGlobalPolicyRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void GetGlobalPolicyResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyPermissions), Permissions);
+        }
+
+        Json::Value GetGlobalPolicyResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Permissions; ToJsonUtilO(Permissions, each_Permissions); ToJsonField(output, keyPermissions) = each_Permissions;
+            return output;
+        }
+
+        void GetTitlePlayersFromMasterPlayerAccountIdsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyMasterPlayerAccountIds), MasterPlayerAccountIds);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+        }
+
+        Json::Value GetTitlePlayersFromMasterPlayerAccountIdsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_MasterPlayerAccountIds; ToJsonUtilS(MasterPlayerAccountIds, each_MasterPlayerAccountIds); ToJsonField(output, keyMasterPlayerAccountIds) = each_MasterPlayerAccountIds;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            return output;
+        }
+
+        void GetTitlePlayersFromMasterPlayerAccountIdsResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+            FromJsonUtilO(FromJsonField(input, keyTitlePlayerAccounts), TitlePlayerAccounts);
+        }
+
+        Json::Value GetTitlePlayersFromMasterPlayerAccountIdsResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            Json::Value each_TitlePlayerAccounts; ToJsonUtilO(TitlePlayerAccounts, each_TitlePlayerAccounts); ToJsonField(output, keyTitlePlayerAccounts) = each_TitlePlayerAccounts;
+            return output;
+        }
+
+        void SetEntityProfilePolicyRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilO(FromJsonField(input, keyStatements), Statements);
+        }
+
+        Json::Value SetEntityProfilePolicyRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_Statements; ToJsonUtilO(Statements, each_Statements); ToJsonField(output, keyStatements) = each_Statements;
+            return output;
+        }
+
+        void SetEntityProfilePolicyResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyPermissions), Permissions);
+        }
+
+        Json::Value SetEntityProfilePolicyResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Permissions; ToJsonUtilO(Permissions, each_Permissions); ToJsonField(output, keyPermissions) = each_Permissions;
+            return output;
+        }
+
+        void SetGlobalPolicyRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyPermissions), Permissions);
+        }
+
+        Json::Value SetGlobalPolicyRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Permissions; ToJsonUtilO(Permissions, each_Permissions); ToJsonField(output, keyPermissions) = each_Permissions;
+            return output;
+        }
+
+        void SetGlobalPolicyResponse::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value SetGlobalPolicyResponse::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void SetProfileLanguageRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilP(FromJsonField(input, keyExpectedVersion), ExpectedVersion);
+            FromJsonUtilS(FromJsonField(input, keyLanguage), Language);
+        }
+
+        Json::Value SetProfileLanguageRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_ExpectedVersion; ToJsonUtilP(ExpectedVersion, each_ExpectedVersion); ToJsonField(output, keyExpectedVersion) = each_ExpectedVersion;
+            Json::Value each_Language; ToJsonUtilS(Language, each_Language); ToJsonField(output, keyLanguage) = each_Language;
+            return output;
+        }
+
+        void SetProfileLanguageResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilE(FromJsonField(input, keyOperationResult), OperationResult);
+            FromJsonUtilP(FromJsonField(input, keyVersionNumber), VersionNumber);
+        }
+
+        Json::Value SetProfileLanguageResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_OperationResult; ToJsonUtilE(OperationResult, each_OperationResult); ToJsonField(output, keyOperationResult) = each_OperationResult;
+            Json::Value each_VersionNumber; ToJsonUtilP(VersionNumber, each_VersionNumber); ToJsonField(output, keyVersionNumber) = each_VersionNumber;
+            return output;
+        }
+    }
+}
+
+#endif
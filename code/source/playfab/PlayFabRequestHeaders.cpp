@@ -0,0 +1,75 @@
+#include <stdafx.h>
+
+#include <playfab/PlayFabRequestHeaders.h>
+
+#include <cstring>
+
+namespace PlayFab
+{
+    namespace
+    {
+        // Indexed by PlayFabRequestHeaderKey
+        const char* const headerNames[] = { "X-Authorization", "X-EntityToken", "X-SecretKey" };
+        constexpr char headerSeparator[] = ": ";
+        constexpr size_t headerSeparatorLength = sizeof(headerSeparator) - 1;
+    }
+
+    const char* PlayFabRequestHeaders::Header::GetName() const
+    {
+        return PlayFabRequestHeaders::GetName(key);
+    }
+
+    const char* PlayFabRequestHeaders::Header::GetValue() const
+    {
+        return line.c_str() + strlen(GetName()) + headerSeparatorLength;
+    }
+
+    void PlayFabRequestHeaders::Set(PlayFabRequestHeaderKey key, const std::string& value)
+    {
+        Header* header = const_cast<Header*>(Find(key));
+        if (value.empty())
+        {
+            if (header != nullptr)
+            {
+                // empty values are never sent, so remove the header, keeping the order of the others
+                for (Header* next = header + 1; next != headers + count; ++header, ++next)
+                {
+                    header->key = next->key;
+                    header->line.swap(next->line);
+                }
+                header->line.clear();
+                --count;
+            }
+            return;
+        }
+
+        if (header == nullptr)
+        {
+            header = &headers[count++];
+            header->key = key;
+        }
+
+        const char* name = GetName(key);
+        const size_t nameLength = strlen(name);
+        header->line.clear();
+        header->line.reserve(nameLength + headerSeparatorLength + value.length());
+        header->line.append(name, nameLength).append(headerSeparator, headerSeparatorLength).append(value);
+    }
+
+    const PlayFabRequestHeaders::Header* PlayFabRequestHeaders::Find(PlayFabRequestHeaderKey key) const
+    {
+        for (const Header& header : *this)
+        {
+            if (header.key == key)
+            {
+                return &header;
+            }
+        }
+        return nullptr;
+    }
+
+    const char* PlayFabRequestHeaders::GetName(PlayFabRequestHeaderKey key)
+    {
+        return headerNames[static_cast<size_t>(key)];
+    }
+}
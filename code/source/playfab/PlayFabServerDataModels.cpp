@@ -0,0 +1,16894 @@
+#include <stdafx.h>
+
+#if defined(ENABLE_PLAYFABSERVER_API)
+
+#include <playfab/PlayFabServerDataModels.h>
+
+namespace PlayFab
+{
+    namespace ServerModels
+    {
+        namespace
+        {
+            // The json field names of the models below
+            constexpr PlayFabJsonKey keyABTestParent("ABTestParent");
+            constexpr PlayFabJsonKey keyAPIRequestsIssued("APIRequestsIssued");
+            constexpr PlayFabJsonKey keyAccountInfo("AccountInfo");
+            constexpr PlayFabJsonKey keyAchievementName("AchievementName");
+            constexpr PlayFabJsonKey keyAchievementResults("AchievementResults");
+            constexpr PlayFabJsonKey keyAchievements("Achievements");
+            constexpr PlayFabJsonKey keyActivationTime("ActivationTime");
+            constexpr PlayFabJsonKey keyActive("Active");
+            constexpr PlayFabJsonKey keyAdCampaignAttributions("AdCampaignAttributions");
+            constexpr PlayFabJsonKey keyAdvancedPlatformDelivery("AdvancedPlatformDelivery");
+            constexpr PlayFabJsonKey keyAmount("Amount");
+            constexpr PlayFabJsonKey keyAndroidDeviceId("AndroidDeviceId");
+            constexpr PlayFabJsonKey keyAndroidDeviceInfo("AndroidDeviceInfo");
+            constexpr PlayFabJsonKey keyAndroidPayload("AndroidPayload");
+            constexpr PlayFabJsonKey keyAnnotation("Annotation");
+            constexpr PlayFabJsonKey keyAppleAccountInfo("AppleAccountInfo");
+            constexpr PlayFabJsonKey keyAppleSubjectId("AppleSubjectId");
+            constexpr PlayFabJsonKey keyAttributedAt("AttributedAt");
+            constexpr PlayFabJsonKey keyAuthCode("AuthCode");
+            constexpr PlayFabJsonKey keyAvatarUrl("AvatarUrl");
+            constexpr PlayFabJsonKey keyBadge("Badge");
+            constexpr PlayFabJsonKey keyBalance("Balance");
+            constexpr PlayFabJsonKey keyBalanceChange("BalanceChange");
+            constexpr PlayFabJsonKey keyBanData("BanData");
+            constexpr PlayFabJsonKey keyBanId("BanId");
+            constexpr PlayFabJsonKey keyBanIds("BanIds");
+            constexpr PlayFabJsonKey keyBannedUntil("BannedUntil");
+            constexpr PlayFabJsonKey keyBans("Bans");
+            constexpr PlayFabJsonKey keyBody("Body");
+            constexpr PlayFabJsonKey keyBuild("Build");
+            constexpr PlayFabJsonKey keyBundle("Bundle");
+            constexpr PlayFabJsonKey keyBundleContents("BundleContents");
+            constexpr PlayFabJsonKey keyBundleParent("BundleParent");
+            constexpr PlayFabJsonKey keyBundledItems("BundledItems");
+            constexpr PlayFabJsonKey keyBundledResultTables("BundledResultTables");
+            constexpr PlayFabJsonKey keyBundledVirtualCurrencies("BundledVirtualCurrencies");
+            constexpr PlayFabJsonKey keyCampaignId("CampaignId");
+            constexpr PlayFabJsonKey keyCanBecomeCharacter("CanBecomeCharacter");
+            constexpr PlayFabJsonKey keyCatalog("Catalog");
+            constexpr PlayFabJsonKey keyCatalogVersion("CatalogVersion");
+            constexpr PlayFabJsonKey keyCharacterId("CharacterId");
+            constexpr PlayFabJsonKey keyCharacterInventories("CharacterInventories");
+            constexpr PlayFabJsonKey keyCharacterList("CharacterList");
+            constexpr PlayFabJsonKey keyCharacterName("CharacterName");
+            constexpr PlayFabJsonKey keyCharacterStatistics("CharacterStatistics");
+            constexpr PlayFabJsonKey keyCharacterType("CharacterType");
+            constexpr PlayFabJsonKey keyCharacters("Characters");
+            constexpr PlayFabJsonKey keyCity("City");
+            constexpr PlayFabJsonKey keyComment("Comment");
+            constexpr PlayFabJsonKey keyConnectionId("ConnectionId");
+            constexpr PlayFabJsonKey keyConsumable("Consumable");
+            constexpr PlayFabJsonKey keyConsumeCount("ConsumeCount");
+            constexpr PlayFabJsonKey keyContactEmailAddresses("ContactEmailAddresses");
+            constexpr PlayFabJsonKey keyContainer("Container");
+            constexpr PlayFabJsonKey keyContainerItemId("ContainerItemId");
+            constexpr PlayFabJsonKey keyContainerItemInstanceId("ContainerItemInstanceId");
+            constexpr PlayFabJsonKey keyContinentCode("ContinentCode");
+            constexpr PlayFabJsonKey keyContinuationToken("ContinuationToken");
+            constexpr PlayFabJsonKey keyCount("Count");
+            constexpr PlayFabJsonKey keyCountryCode("CountryCode");
+            constexpr PlayFabJsonKey keyCouponCode("CouponCode");
+            constexpr PlayFabJsonKey keyCreateAccount("CreateAccount");
+            constexpr PlayFabJsonKey keyCreated("Created");
+            constexpr PlayFabJsonKey keyCurrency("Currency");
+            constexpr PlayFabJsonKey keyCustomData("CustomData");
+            constexpr PlayFabJsonKey keyCustomId("CustomId");
+            constexpr PlayFabJsonKey keyCustomIdInfo("CustomIdInfo");
+            constexpr PlayFabJsonKey keyCustomTags("CustomTags");
+            constexpr PlayFabJsonKey keyData("Data");
+            constexpr PlayFabJsonKey keyDataVersion("DataVersion");
+            constexpr PlayFabJsonKey keyDeactivationTime("DeactivationTime");
+            constexpr PlayFabJsonKey keyDescription("Description");
+            constexpr PlayFabJsonKey keyDisplayName("DisplayName");
+            constexpr PlayFabJsonKey keyDisplayPosition("DisplayPosition");
+            constexpr PlayFabJsonKey keyDurationInHours("DurationInHours");
+            constexpr PlayFabJsonKey keyEmail("Email");
+            constexpr PlayFabJsonKey keyEmailAddress("EmailAddress");
+            constexpr PlayFabJsonKey keyEmailTemplateId("EmailTemplateId");
+            constexpr PlayFabJsonKey keyEntity("Entity");
+            constexpr PlayFabJsonKey keyEntityToken("EntityToken");
+            constexpr PlayFabJsonKey keyError("Error");
+            constexpr PlayFabJsonKey keyErrors("Errors");
+            constexpr PlayFabJsonKey keyEventId("EventId");
+            constexpr PlayFabJsonKey keyEventName("EventName");
+            constexpr PlayFabJsonKey keyExecutionTimeSeconds("ExecutionTimeSeconds");
+            constexpr PlayFabJsonKey keyExperimentVariants("ExperimentVariants");
+            constexpr PlayFabJsonKey keyExpiration("Expiration");
+            constexpr PlayFabJsonKey keyExpires("Expires");
+            constexpr PlayFabJsonKey keyFacebookIDs("FacebookIDs");
+            constexpr PlayFabJsonKey keyFacebookId("FacebookId");
+            constexpr PlayFabJsonKey keyFacebookInfo("FacebookInfo");
+            constexpr PlayFabJsonKey keyFacebookInstantGamesId("FacebookInstantGamesId");
+            constexpr PlayFabJsonKey keyFacebookInstantGamesIdInfo("FacebookInstantGamesIdInfo");
+            constexpr PlayFabJsonKey keyFacebookInstantGamesIds("FacebookInstantGamesIds");
+            constexpr PlayFabJsonKey keyFirstLogin("FirstLogin");
+            constexpr PlayFabJsonKey keyForceLink("ForceLink");
+            constexpr PlayFabJsonKey keyForceUpdate("ForceUpdate");
+            constexpr PlayFabJsonKey keyFriendEmail("FriendEmail");
+            constexpr PlayFabJsonKey keyFriendPlayFabId("FriendPlayFabId");
+            constexpr PlayFabJsonKey keyFriendTitleDisplayName("FriendTitleDisplayName");
+            constexpr PlayFabJsonKey keyFriendUsername("FriendUsername");
+            constexpr PlayFabJsonKey keyFriends("Friends");
+            constexpr PlayFabJsonKey keyFullName("FullName");
+            constexpr PlayFabJsonKey keyFunctionName("FunctionName");
+            constexpr PlayFabJsonKey keyFunctionParameter("FunctionParameter");
+            constexpr PlayFabJsonKey keyFunctionResult("FunctionResult");
+            constexpr PlayFabJsonKey keyFunctionResultTooLarge("FunctionResultTooLarge");
+            constexpr PlayFabJsonKey keyGCMDataOnly("GCMDataOnly");
+            constexpr PlayFabJsonKey keyGameCenterId("GameCenterId");
+            constexpr PlayFabJsonKey keyGameCenterInfo("GameCenterInfo");
+            constexpr PlayFabJsonKey keyGameMode("GameMode");
+            constexpr PlayFabJsonKey keyGameServerData("GameServerData");
+            constexpr PlayFabJsonKey keyGatherDeviceInfo("GatherDeviceInfo");
+            constexpr PlayFabJsonKey keyGatherFocusInfo("GatherFocusInfo");
+            constexpr PlayFabJsonKey keyGeneratePlayStreamEvent("GeneratePlayStreamEvent");
+            constexpr PlayFabJsonKey keyGenericIDs("GenericIDs");
+            constexpr PlayFabJsonKey keyGenericId("GenericId");
+            constexpr PlayFabJsonKey keyGetCharacterInventories("GetCharacterInventories");
+            constexpr PlayFabJsonKey keyGetCharacterList("GetCharacterList");
+            constexpr PlayFabJsonKey keyGetMembers("GetMembers");
+            constexpr PlayFabJsonKey keyGetPlayerProfile("GetPlayerProfile");
+            constexpr PlayFabJsonKey keyGetPlayerStatistics("GetPlayerStatistics");
+            constexpr PlayFabJsonKey keyGetTitleData("GetTitleData");
+            constexpr PlayFabJsonKey keyGetUserAccountInfo("GetUserAccountInfo");
+            constexpr PlayFabJsonKey keyGetUserData("GetUserData");
+            constexpr PlayFabJsonKey keyGetUserInventory("GetUserInventory");
+            constexpr PlayFabJsonKey keyGetUserReadOnlyData("GetUserReadOnlyData");
+            constexpr PlayFabJsonKey keyGetUserVirtualCurrency("GetUserVirtualCurrency");
+            constexpr PlayFabJsonKey keyGivingCharacterId("GivingCharacterId");
+            constexpr PlayFabJsonKey keyGoogleEmail("GoogleEmail");
+            constexpr PlayFabJsonKey keyGoogleGender("GoogleGender");
+            constexpr PlayFabJsonKey keyGoogleId("GoogleId");
+            constexpr PlayFabJsonKey keyGoogleInfo("GoogleInfo");
+            constexpr PlayFabJsonKey keyGoogleLocale("GoogleLocale");
+            constexpr PlayFabJsonKey keyGoogleName("GoogleName");
+            constexpr PlayFabJsonKey keyGrantedItems("GrantedItems");
+            constexpr PlayFabJsonKey keyHttpMethod("HttpMethod");
+            constexpr PlayFabJsonKey keyHttpRequestsIssued("HttpRequestsIssued");
+            constexpr PlayFabJsonKey keyIOSPayload("IOSPayload");
+            constexpr PlayFabJsonKey keyIPAddress("IPAddress");
+            constexpr PlayFabJsonKey keyIcon("Icon");
+            constexpr PlayFabJsonKey keyId("Id");
+            constexpr PlayFabJsonKey keyIfChangedFromDataVersion("IfChangedFromDataVersion");
+            constexpr PlayFabJsonKey keyImageUrl("ImageUrl");
+            constexpr PlayFabJsonKey keyIncludeFacebookFriends("IncludeFacebookFriends");
+            constexpr PlayFabJsonKey keyIncludeSteamFriends("IncludeSteamFriends");
+            constexpr PlayFabJsonKey keyInfoRequestParameters("InfoRequestParameters");
+            constexpr PlayFabJsonKey keyInfoResultPayload("InfoResultPayload");
+            constexpr PlayFabJsonKey keyInitialLimitedEditionCount("InitialLimitedEditionCount");
+            constexpr PlayFabJsonKey keyInitialSubscriptionTime("InitialSubscriptionTime");
+            constexpr PlayFabJsonKey keyInventory("Inventory");
+            constexpr PlayFabJsonKey keyIosDeviceId("IosDeviceId");
+            constexpr PlayFabJsonKey keyIosDeviceInfo("IosDeviceInfo");
+            constexpr PlayFabJsonKey keyIsActive("IsActive");
+            constexpr PlayFabJsonKey keyIsLimitedEdition("IsLimitedEdition");
+            constexpr PlayFabJsonKey keyIsSessionTicketExpired("IsSessionTicketExpired");
+            constexpr PlayFabJsonKey keyIsStackable("IsStackable");
+            constexpr PlayFabJsonKey keyIsTradable("IsTradable");
+            constexpr PlayFabJsonKey keyIssuer("Issuer");
+            constexpr PlayFabJsonKey keyIssuerId("IssuerId");
+            constexpr PlayFabJsonKey keyItem("Item");
+            constexpr PlayFabJsonKey keyItemClass("ItemClass");
+            constexpr PlayFabJsonKey keyItemContents("ItemContents");
+            constexpr PlayFabJsonKey keyItemGrantResults("ItemGrantResults");
+            constexpr PlayFabJsonKey keyItemGrants("ItemGrants");
+            constexpr PlayFabJsonKey keyItemId("ItemId");
+            constexpr PlayFabJsonKey keyItemIds("ItemIds");
+            constexpr PlayFabJsonKey keyItemImageUrl("ItemImageUrl");
+            constexpr PlayFabJsonKey keyItemInstanceId("ItemInstanceId");
+            constexpr PlayFabJsonKey keyItems("Items");
+            constexpr PlayFabJsonKey keyJson("Json");
+            constexpr PlayFabJsonKey keyKey("Key");
+            constexpr PlayFabJsonKey keyKeyItemId("KeyItemId");
+            constexpr PlayFabJsonKey keyKeyItemInstanceId("KeyItemInstanceId");
+            constexpr PlayFabJsonKey keyKeys("Keys");
+            constexpr PlayFabJsonKey keyKeysToRemove("KeysToRemove");
+            constexpr PlayFabJsonKey keyKongregateId("KongregateId");
+            constexpr PlayFabJsonKey keyKongregateInfo("KongregateInfo");
+            constexpr PlayFabJsonKey keyKongregateName("KongregateName");
+            constexpr PlayFabJsonKey keyLastLogin("LastLogin");
+            constexpr PlayFabJsonKey keyLastLoginTime("LastLoginTime");
+            constexpr PlayFabJsonKey keyLastUpdated("LastUpdated");
+            constexpr PlayFabJsonKey keyLastUpdatedBy("LastUpdatedBy");
+            constexpr PlayFabJsonKey keyLatitude("Latitude");
+            constexpr PlayFabJsonKey keyLeaderboard("Leaderboard");
+            constexpr PlayFabJsonKey keyLevel("Level");
+            constexpr PlayFabJsonKey keyLinkedAccounts("LinkedAccounts");
+            constexpr PlayFabJsonKey keyLobbyId("LobbyId");
+            constexpr PlayFabJsonKey keyLocalizedPushNotificationTemplates("LocalizedPushNotificationTemplates");
+            constexpr PlayFabJsonKey keyLocations("Locations");
+            constexpr PlayFabJsonKey keyLogs("Logs");
+            constexpr PlayFabJsonKey keyLogsTooLarge("LogsTooLarge");
+            constexpr PlayFabJsonKey keyLongitude("Longitude");
+            constexpr PlayFabJsonKey keyMACAddress("MACAddress");
+            constexpr PlayFabJsonKey keyMarketingData("MarketingData");
+            constexpr PlayFabJsonKey keyMaxBatchSize("MaxBatchSize");
+            constexpr PlayFabJsonKey keyMaxResultsCount("MaxResultsCount");
+            constexpr PlayFabJsonKey keyMembers("Members");
+            constexpr PlayFabJsonKey keyMembershipExpiration("MembershipExpiration");
+            constexpr PlayFabJsonKey keyMembershipId("MembershipId");
+            constexpr PlayFabJsonKey keyMemberships("Memberships");
+            constexpr PlayFabJsonKey keyMemoryConsumedBytes("MemoryConsumedBytes");
+            constexpr PlayFabJsonKey keyMessage("Message");
+            constexpr PlayFabJsonKey keyMetadata("Metadata");
+            constexpr PlayFabJsonKey keyName("Name");
+            constexpr PlayFabJsonKey keyNamespace("Namespace");
+            constexpr PlayFabJsonKey keyNeedsAttribution("NeedsAttribution");
+            constexpr PlayFabJsonKey keyNewlyCreated("NewlyCreated");
+            constexpr PlayFabJsonKey keyNews("News");
+            constexpr PlayFabJsonKey keyNewsId("NewsId");
+            constexpr PlayFabJsonKey keyNextReset("NextReset");
+            constexpr PlayFabJsonKey keyNintendoSwitchAccountInfo("NintendoSwitchAccountInfo");
+            constexpr PlayFabJsonKey keyNintendoSwitchAccountSubjectId("NintendoSwitchAccountSubjectId");
+            constexpr PlayFabJsonKey keyNintendoSwitchDeviceId("NintendoSwitchDeviceId");
+            constexpr PlayFabJsonKey keyNintendoSwitchDeviceIdInfo("NintendoSwitchDeviceIdInfo");
+            constexpr PlayFabJsonKey keyNintendoSwitchDeviceIds("NintendoSwitchDeviceIds");
+            constexpr PlayFabJsonKey keyNodes("Nodes");
+            constexpr PlayFabJsonKey keyNotificationEndpointARN("NotificationEndpointARN");
+            constexpr PlayFabJsonKey keyOpenIdInfo("OpenIdInfo");
+            constexpr PlayFabJsonKey keyOrigination("Origination");
+            constexpr PlayFabJsonKey keyOverrideExpiration("OverrideExpiration");
+            constexpr PlayFabJsonKey keyOverrideLabel("OverrideLabel");
+            constexpr PlayFabJsonKey keyPSNAccountIDs("PSNAccountIDs");
+            constexpr PlayFabJsonKey keyPSNAccountId("PSNAccountId");
+            constexpr PlayFabJsonKey keyPSNInfo("PSNInfo");
+            constexpr PlayFabJsonKey keyPackage("Package");
+            constexpr PlayFabJsonKey keyPermanent("Permanent");
+            constexpr PlayFabJsonKey keyPermission("Permission");
+            constexpr PlayFabJsonKey keyPlatform("Platform");
+            constexpr PlayFabJsonKey keyPlatformUserId("PlatformUserId");
+            constexpr PlayFabJsonKey keyPlayFabIDs("PlayFabIDs");
+            constexpr PlayFabJsonKey keyPlayFabId("PlayFabId");
+            constexpr PlayFabJsonKey keyPlayFabIds("PlayFabIds");
+            constexpr PlayFabJsonKey keyPlayerExperimentVariants("PlayerExperimentVariants");
+            constexpr PlayFabJsonKey keyPlayerId("PlayerId");
+            constexpr PlayFabJsonKey keyPlayerProfile("PlayerProfile");
+            constexpr PlayFabJsonKey keyPlayerProfiles("PlayerProfiles");
+            constexpr PlayFabJsonKey keyPlayerSecret("PlayerSecret");
+            constexpr PlayFabJsonKey keyPlayerState("PlayerState");
+            constexpr PlayFabJsonKey keyPlayerStatisticNames("PlayerStatisticNames");
+            constexpr PlayFabJsonKey keyPlayerStatistics("PlayerStatistics");
+            constexpr PlayFabJsonKey keyPosition("Position");
+            constexpr PlayFabJsonKey keyPrivateInfo("PrivateInfo");
+            constexpr PlayFabJsonKey keyProcessorTimeSeconds("ProcessorTimeSeconds");
+            constexpr PlayFabJsonKey keyProfile("Profile");
+            constexpr PlayFabJsonKey keyProfileConstraints("ProfileConstraints");
+            constexpr PlayFabJsonKey keyProfilesInSegment("ProfilesInSegment");
+            constexpr PlayFabJsonKey keyPsnAccountId("PsnAccountId");
+            constexpr PlayFabJsonKey keyPsnInfo("PsnInfo");
+            constexpr PlayFabJsonKey keyPsnOnlineId("PsnOnlineId");
+            constexpr PlayFabJsonKey keyPublisherId("PublisherId");
+            constexpr PlayFabJsonKey keyPurchaseDate("PurchaseDate");
+            constexpr PlayFabJsonKey keyPushNotificationRegistrations("PushNotificationRegistrations");
+            constexpr PlayFabJsonKey keyPushNotificationTemplateId("PushNotificationTemplateId");
+            constexpr PlayFabJsonKey keyRealCurrencyPrices("RealCurrencyPrices");
+            constexpr PlayFabJsonKey keyReason("Reason");
+            constexpr PlayFabJsonKey keyReceivingCharacterId("ReceivingCharacterId");
+            constexpr PlayFabJsonKey keyRechargeMax("RechargeMax");
+            constexpr PlayFabJsonKey keyRechargeTime("RechargeTime");
+            constexpr PlayFabJsonKey keyRecipient("Recipient");
+            constexpr PlayFabJsonKey keyRedirectUri("RedirectUri");
+            constexpr PlayFabJsonKey keyRegion("Region");
+            constexpr PlayFabJsonKey keyRemainingUses("RemainingUses");
+            constexpr PlayFabJsonKey keyReporteeId("ReporteeId");
+            constexpr PlayFabJsonKey keyReporterId("ReporterId");
+            constexpr PlayFabJsonKey keyResult("Result");
+            constexpr PlayFabJsonKey keyResultItem("ResultItem");
+            constexpr PlayFabJsonKey keyResultItemId("ResultItemId");
+            constexpr PlayFabJsonKey keyResultItemType("ResultItemType");
+            constexpr PlayFabJsonKey keyResultTableContents("ResultTableContents");
+            constexpr PlayFabJsonKey keyRevision("Revision");
+            constexpr PlayFabJsonKey keyRevisionSelection("RevisionSelection");
+            constexpr PlayFabJsonKey keySandbox("Sandbox");
+            constexpr PlayFabJsonKey keySaveCharacterInventory("SaveCharacterInventory");
+            constexpr PlayFabJsonKey keyScheduledActivationTime("ScheduledActivationTime");
+            constexpr PlayFabJsonKey keyScheduledDeactivationTime("ScheduledDeactivationTime");
+            constexpr PlayFabJsonKey keySecondsToLive("SecondsToLive");
+            constexpr PlayFabJsonKey keySecondsToRecharge("SecondsToRecharge");
+            constexpr PlayFabJsonKey keySegmentId("SegmentId");
+            constexpr PlayFabJsonKey keySegments("Segments");
+            constexpr PlayFabJsonKey keyServerCustomId("ServerCustomId");
+            constexpr PlayFabJsonKey keyServerIPV4Address("ServerIPV4Address");
+            constexpr PlayFabJsonKey keyServerIPV6Address("ServerIPV6Address");
+            constexpr PlayFabJsonKey keyServerPort("ServerPort");
+            constexpr PlayFabJsonKey keyServerPublicDNSName("ServerPublicDNSName");
+            constexpr PlayFabJsonKey keyServiceName("ServiceName");
+            constexpr PlayFabJsonKey keySessionTicket("SessionTicket");
+            constexpr PlayFabJsonKey keySettingsForUser("SettingsForUser");
+            constexpr PlayFabJsonKey keySharedGroupId("SharedGroupId");
+            constexpr PlayFabJsonKey keyShowAvatarUrl("ShowAvatarUrl");
+            constexpr PlayFabJsonKey keyShowBannedUntil("ShowBannedUntil");
+            constexpr PlayFabJsonKey keyShowCampaignAttributions("ShowCampaignAttributions");
+            constexpr PlayFabJsonKey keyShowContactEmailAddresses("ShowContactEmailAddresses");
+            constexpr PlayFabJsonKey keyShowCreated("ShowCreated");
+            constexpr PlayFabJsonKey keyShowDisplayName("ShowDisplayName");
+            constexpr PlayFabJsonKey keyShowExperimentVariants("ShowExperimentVariants");
+            constexpr PlayFabJsonKey keyShowLastLogin("ShowLastLogin");
+            constexpr PlayFabJsonKey keyShowLinkedAccounts("ShowLinkedAccounts");
+            constexpr PlayFabJsonKey keyShowLocations("ShowLocations");
+            constexpr PlayFabJsonKey keyShowMemberships("ShowMemberships");
+            constexpr PlayFabJsonKey keyShowOrigination("ShowOrigination");
+            constexpr PlayFabJsonKey keyShowPushNotificationRegistrations("ShowPushNotificationRegistrations");
+            constexpr PlayFabJsonKey keyShowStatistics("ShowStatistics");
+            constexpr PlayFabJsonKey keyShowTags("ShowTags");
+            constexpr PlayFabJsonKey keyShowTotalValueToDateInUsd("ShowTotalValueToDateInUsd");
+            constexpr PlayFabJsonKey keyShowValuesToDate("ShowValuesToDate");
+            constexpr PlayFabJsonKey keySound("Sound");
+            constexpr PlayFabJsonKey keySource("Source");
+            constexpr PlayFabJsonKey keySpecificRevision("SpecificRevision");
+            constexpr PlayFabJsonKey keyStackTrace("StackTrace");
+            constexpr PlayFabJsonKey keyStartPosition("StartPosition");
+            constexpr PlayFabJsonKey keyStatValue("StatValue");
+            constexpr PlayFabJsonKey keyState("State");
+            constexpr PlayFabJsonKey keyStatisticName("StatisticName");
+            constexpr PlayFabJsonKey keyStatisticNameVersions("StatisticNameVersions");
+            constexpr PlayFabJsonKey keyStatisticNames("StatisticNames");
+            constexpr PlayFabJsonKey keyStatisticValue("StatisticValue");
+            constexpr PlayFabJsonKey keyStatisticVersion("StatisticVersion");
+            constexpr PlayFabJsonKey keyStatisticVersions("StatisticVersions");
+            constexpr PlayFabJsonKey keyStatistics("Statistics");
+            constexpr PlayFabJsonKey keyStatus("Status");
+            constexpr PlayFabJsonKey keySteamActivationStatus("SteamActivationStatus");
+            constexpr PlayFabJsonKey keySteamCountry("SteamCountry");
+            constexpr PlayFabJsonKey keySteamCurrency("SteamCurrency");
+            constexpr PlayFabJsonKey keySteamId("SteamId");
+            constexpr PlayFabJsonKey keySteamInfo("SteamInfo");
+            constexpr PlayFabJsonKey keySteamName("SteamName");
+            constexpr PlayFabJsonKey keySteamStringIDs("SteamStringIDs");
+            constexpr PlayFabJsonKey keySteamStringId("SteamStringId");
+            constexpr PlayFabJsonKey keyStore("Store");
+            constexpr PlayFabJsonKey keyStoreId("StoreId");
+            constexpr PlayFabJsonKey keySubject("Subject");
+            constexpr PlayFabJsonKey keySubmissionsRemaining("SubmissionsRemaining");
+            constexpr PlayFabJsonKey keySubscriptionId("SubscriptionId");
+            constexpr PlayFabJsonKey keySubscriptionItemId("SubscriptionItemId");
+            constexpr PlayFabJsonKey keySubscriptionProvider("SubscriptionProvider");
+            constexpr PlayFabJsonKey keySubscriptions("Subscriptions");
+            constexpr PlayFabJsonKey keyTableIDs("TableIDs");
+            constexpr PlayFabJsonKey keyTableId("TableId");
+            constexpr PlayFabJsonKey keyTables("Tables");
+            constexpr PlayFabJsonKey keyTagName("TagName");
+            constexpr PlayFabJsonKey keyTagValue("TagValue");
+            constexpr PlayFabJsonKey keyTags("Tags");
+            constexpr PlayFabJsonKey keyTargetPlatforms("TargetPlatforms");
+            constexpr PlayFabJsonKey keyThruCDN("ThruCDN");
+            constexpr PlayFabJsonKey keyTicket("Ticket");
+            constexpr PlayFabJsonKey keyTicketIsValid("TicketIsValid");
+            constexpr PlayFabJsonKey keyTime("Time");
+            constexpr PlayFabJsonKey keyTimestamp("Timestamp");
+            constexpr PlayFabJsonKey keyTitle("Title");
+            constexpr PlayFabJsonKey keyTitleData("TitleData");
+            constexpr PlayFabJsonKey keyTitleDataKeys("TitleDataKeys");
+            constexpr PlayFabJsonKey keyTitleDisplayName("TitleDisplayName");
+            constexpr PlayFabJsonKey keyTitleId("TitleId");
+            constexpr PlayFabJsonKey keyTitleInfo("TitleInfo");
+            constexpr PlayFabJsonKey keyTitlePlayerAccount("TitlePlayerAccount");
+            constexpr PlayFabJsonKey keyTokenExpiration("TokenExpiration");
+            constexpr PlayFabJsonKey keyTotalValue("TotalValue");
+            constexpr PlayFabJsonKey keyTotalValueAsDecimal("TotalValueAsDecimal");
+            constexpr PlayFabJsonKey keyTotalValueToDateInUSD("TotalValueToDateInUSD");
+            constexpr PlayFabJsonKey keyTreatmentAssignment("TreatmentAssignment");
+            constexpr PlayFabJsonKey keyTwitchId("TwitchId");
+            constexpr PlayFabJsonKey keyTwitchInfo("TwitchInfo");
+            constexpr PlayFabJsonKey keyTwitchUserName("TwitchUserName");
+            constexpr PlayFabJsonKey keyType("Type");
+            constexpr PlayFabJsonKey keyURL("URL");
+            constexpr PlayFabJsonKey keyUnitCurrency("UnitCurrency");
+            constexpr PlayFabJsonKey keyUnitPrice("UnitPrice");
+            constexpr PlayFabJsonKey keyUnlockedItemInstanceId("UnlockedItemInstanceId");
+            constexpr PlayFabJsonKey keyUnlockedWithItemInstanceId("UnlockedWithItemInstanceId");
+            constexpr PlayFabJsonKey keyUsageCount("UsageCount");
+            constexpr PlayFabJsonKey keyUsagePeriod("UsagePeriod");
+            constexpr PlayFabJsonKey keyUsagePeriodGroup("UsagePeriodGroup");
+            constexpr PlayFabJsonKey keyUserData("UserData");
+            constexpr PlayFabJsonKey keyUserDataKeys("UserDataKeys");
+            constexpr PlayFabJsonKey keyUserDataVersion("UserDataVersion");
+            constexpr PlayFabJsonKey keyUserId("UserId");
+            constexpr PlayFabJsonKey keyUserInfo("UserInfo");
+            constexpr PlayFabJsonKey keyUserInventory("UserInventory");
+            constexpr PlayFabJsonKey keyUserReadOnlyData("UserReadOnlyData");
+            constexpr PlayFabJsonKey keyUserReadOnlyDataKeys("UserReadOnlyDataKeys");
+            constexpr PlayFabJsonKey keyUserReadOnlyDataVersion("UserReadOnlyDataVersion");
+            constexpr PlayFabJsonKey keyUserVirtualCurrency("UserVirtualCurrency");
+            constexpr PlayFabJsonKey keyUserVirtualCurrencyRechargeTimes("UserVirtualCurrencyRechargeTimes");
+            constexpr PlayFabJsonKey keyUsername("Username");
+            constexpr PlayFabJsonKey keyUsesIncrementedBy("UsesIncrementedBy");
+            constexpr PlayFabJsonKey keyUsesToAdd("UsesToAdd");
+            constexpr PlayFabJsonKey keyValue("Value");
+            constexpr PlayFabJsonKey keyValuesToDate("ValuesToDate");
+            constexpr PlayFabJsonKey keyVariables("Variables");
+            constexpr PlayFabJsonKey keyVariants("Variants");
+            constexpr PlayFabJsonKey keyVerificationStatus("VerificationStatus");
+            constexpr PlayFabJsonKey keyVersion("Version");
+            constexpr PlayFabJsonKey keyVirtualCurrency("VirtualCurrency");
+            constexpr PlayFabJsonKey keyVirtualCurrencyBalances("VirtualCurrencyBalances");
+            constexpr PlayFabJsonKey keyVirtualCurrencyContents("VirtualCurrencyContents");
+            constexpr PlayFabJsonKey keyVirtualCurrencyPrices("VirtualCurrencyPrices");
+            constexpr PlayFabJsonKey keyVirtualCurrencyRechargeTimes("VirtualCurrencyRechargeTimes");
+            constexpr PlayFabJsonKey keyWeight("Weight");
+            constexpr PlayFabJsonKey keyWindowsHelloDeviceName("WindowsHelloDeviceName");
+            constexpr PlayFabJsonKey keyWindowsHelloInfo("WindowsHelloInfo");
+            constexpr PlayFabJsonKey keyWindowsHelloPublicKeyHash("WindowsHelloPublicKeyHash");
+            constexpr PlayFabJsonKey keyXboxId("XboxId");
+            constexpr PlayFabJsonKey keyXboxInfo("XboxInfo");
+            constexpr PlayFabJsonKey keyXboxLiveAccountIDs("XboxLiveAccountIDs");
+            constexpr PlayFabJsonKey keyXboxLiveAccountId("XboxLiveAccountId");
+            constexpr PlayFabJsonKey keyXboxToken("XboxToken");
+            constexpr PlayFabJsonKey keyXboxUserId("XboxUserId");
+            constexpr PlayFabJsonKey keyisBanned("isBanned");
+        }
+
+        void ToJsonEnum(const CloudScriptRevisionOption input, Json::Value& output)
+        {
+            if (input == CloudScriptRevisionOption::CloudScriptRevisionOptionLive)
+            {
+                output = Json::Value(Json::StaticString("Live"));
+                return;
+            }
+            if (input == CloudScriptRevisionOption::CloudScriptRevisionOptionLatest)
+            {
+                output = Json::Value(Json::StaticString("Latest"));
+                return;
+            }
+            if (input == CloudScriptRevisionOption::CloudScriptRevisionOptionSpecific)
+            {
+                output = Json::Value(Json::StaticString("Specific"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, CloudScriptRevisionOption& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Live")
+            {
+                output = CloudScriptRevisionOption::CloudScriptRevisionOptionLive;
+                return;
+            }
+            if (inputStr == "Latest")
+            {
+                output = CloudScriptRevisionOption::CloudScriptRevisionOptionLatest;
+                return;
+            }
+            if (inputStr == "Specific")
+            {
+                output = CloudScriptRevisionOption::CloudScriptRevisionOptionSpecific;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const ContinentCode input, Json::Value& output)
+        {
+            if (input == ContinentCode::ContinentCodeAF)
+            {
+                output = Json::Value(Json::StaticString("AF"));
+                return;
+            }
+            if (input == ContinentCode::ContinentCodeAN)
+            {
+                output = Json::Value(Json::StaticString("AN"));
+                return;
+            }
+            if (input == ContinentCode::ContinentCodeAS)
+            {
+                output = Json::Value(Json::StaticString("AS"));
+                return;
+            }
+            if (input == ContinentCode::ContinentCodeEU)
+            {
+                output = Json::Value(Json::StaticString("EU"));
+                return;
+            }
+            if (input == ContinentCode::ContinentCodeNA)
+            {
+                output = Json::Value(Json::StaticString("NA"));
+                return;
+            }
+            if (input == ContinentCode::ContinentCodeOC)
+            {
+                output = Json::Value(Json::StaticString("OC"));
+                return;
+            }
+            if (input == ContinentCode::ContinentCodeSA)
+            {
+                output = Json::Value(Json::StaticString("SA"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, ContinentCode& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "AF")
+            {
+                output = ContinentCode::ContinentCodeAF;
+                return;
+            }
+            if (inputStr == "AN")
+            {
+                output = ContinentCode::ContinentCodeAN;
+                return;
+            }
+            if (inputStr == "AS")
+            {
+                output = ContinentCode::ContinentCodeAS;
+                return;
+            }
+            if (inputStr == "EU")
+            {
+                output = ContinentCode::ContinentCodeEU;
+                return;
+            }
+            if (inputStr == "NA")
+            {
+                output = ContinentCode::ContinentCodeNA;
+                return;
+            }
+            if (inputStr == "OC")
+            {
+                output = ContinentCode::ContinentCodeOC;
+                return;
+            }
+            if (inputStr == "SA")
+            {
+                output = ContinentCode::ContinentCodeSA;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const CountryCode input, Json::Value& output)
+        {
+            if (input == CountryCode::CountryCodeAF)
+            {
+                output = Json::Value(Json::StaticString("AF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAX)
+            {
+                output = Json::Value(Json::StaticString("AX"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAL)
+            {
+                output = Json::Value(Json::StaticString("AL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeDZ)
+            {
+                output = Json::Value(Json::StaticString("DZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAS)
+            {
+                output = Json::Value(Json::StaticString("AS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAD)
+            {
+                output = Json::Value(Json::StaticString("AD"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAO)
+            {
+                output = Json::Value(Json::StaticString("AO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAI)
+            {
+                output = Json::Value(Json::StaticString("AI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAQ)
+            {
+                output = Json::Value(Json::StaticString("AQ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAG)
+            {
+                output = Json::Value(Json::StaticString("AG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAR)
+            {
+                output = Json::Value(Json::StaticString("AR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAM)
+            {
+                output = Json::Value(Json::StaticString("AM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAW)
+            {
+                output = Json::Value(Json::StaticString("AW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAU)
+            {
+                output = Json::Value(Json::StaticString("AU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAT)
+            {
+                output = Json::Value(Json::StaticString("AT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAZ)
+            {
+                output = Json::Value(Json::StaticString("AZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBS)
+            {
+                output = Json::Value(Json::StaticString("BS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBH)
+            {
+                output = Json::Value(Json::StaticString("BH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBD)
+            {
+                output = Json::Value(Json::StaticString("BD"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBB)
+            {
+                output = Json::Value(Json::StaticString("BB"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBY)
+            {
+                output = Json::Value(Json::StaticString("BY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBE)
+            {
+                output = Json::Value(Json::StaticString("BE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBZ)
+            {
+                output = Json::Value(Json::StaticString("BZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBJ)
+            {
+                output = Json::Value(Json::StaticString("BJ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBM)
+            {
+                output = Json::Value(Json::StaticString("BM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBT)
+            {
+                output = Json::Value(Json::StaticString("BT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBO)
+            {
+                output = Json::Value(Json::StaticString("BO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBQ)
+            {
+                output = Json::Value(Json::StaticString("BQ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBA)
+            {
+                output = Json::Value(Json::StaticString("BA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBW)
+            {
+                output = Json::Value(Json::StaticString("BW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBV)
+            {
+                output = Json::Value(Json::StaticString("BV"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBR)
+            {
+                output = Json::Value(Json::StaticString("BR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIO)
+            {
+                output = Json::Value(Json::StaticString("IO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBN)
+            {
+                output = Json::Value(Json::StaticString("BN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBG)
+            {
+                output = Json::Value(Json::StaticString("BG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBF)
+            {
+                output = Json::Value(Json::StaticString("BF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBI)
+            {
+                output = Json::Value(Json::StaticString("BI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKH)
+            {
+                output = Json::Value(Json::StaticString("KH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCM)
+            {
+                output = Json::Value(Json::StaticString("CM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCA)
+            {
+                output = Json::Value(Json::StaticString("CA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCV)
+            {
+                output = Json::Value(Json::StaticString("CV"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKY)
+            {
+                output = Json::Value(Json::StaticString("KY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCF)
+            {
+                output = Json::Value(Json::StaticString("CF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTD)
+            {
+                output = Json::Value(Json::StaticString("TD"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCL)
+            {
+                output = Json::Value(Json::StaticString("CL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCN)
+            {
+                output = Json::Value(Json::StaticString("CN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCX)
+            {
+                output = Json::Value(Json::StaticString("CX"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCC)
+            {
+                output = Json::Value(Json::StaticString("CC"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCO)
+            {
+                output = Json::Value(Json::StaticString("CO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKM)
+            {
+                output = Json::Value(Json::StaticString("KM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCG)
+            {
+                output = Json::Value(Json::StaticString("CG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCD)
+            {
+                output = Json::Value(Json::StaticString("CD"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCK)
+            {
+                output = Json::Value(Json::StaticString("CK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCR)
+            {
+                output = Json::Value(Json::StaticString("CR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCI)
+            {
+                output = Json::Value(Json::StaticString("CI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeHR)
+            {
+                output = Json::Value(Json::StaticString("HR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCU)
+            {
+                output = Json::Value(Json::StaticString("CU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCW)
+            {
+                output = Json::Value(Json::StaticString("CW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCY)
+            {
+                output = Json::Value(Json::StaticString("CY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCZ)
+            {
+                output = Json::Value(Json::StaticString("CZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeDK)
+            {
+                output = Json::Value(Json::StaticString("DK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeDJ)
+            {
+                output = Json::Value(Json::StaticString("DJ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeDM)
+            {
+                output = Json::Value(Json::StaticString("DM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeDO)
+            {
+                output = Json::Value(Json::StaticString("DO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeEC)
+            {
+                output = Json::Value(Json::StaticString("EC"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeEG)
+            {
+                output = Json::Value(Json::StaticString("EG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSV)
+            {
+                output = Json::Value(Json::StaticString("SV"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGQ)
+            {
+                output = Json::Value(Json::StaticString("GQ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeER)
+            {
+                output = Json::Value(Json::StaticString("ER"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeEE)
+            {
+                output = Json::Value(Json::StaticString("EE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeET)
+            {
+                output = Json::Value(Json::StaticString("ET"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeFK)
+            {
+                output = Json::Value(Json::StaticString("FK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeFO)
+            {
+                output = Json::Value(Json::StaticString("FO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeFJ)
+            {
+                output = Json::Value(Json::StaticString("FJ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeFI)
+            {
+                output = Json::Value(Json::StaticString("FI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeFR)
+            {
+                output = Json::Value(Json::StaticString("FR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGF)
+            {
+                output = Json::Value(Json::StaticString("GF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePF)
+            {
+                output = Json::Value(Json::StaticString("PF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTF)
+            {
+                output = Json::Value(Json::StaticString("TF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGA)
+            {
+                output = Json::Value(Json::StaticString("GA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGM)
+            {
+                output = Json::Value(Json::StaticString("GM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGE)
+            {
+                output = Json::Value(Json::StaticString("GE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeDE)
+            {
+                output = Json::Value(Json::StaticString("DE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGH)
+            {
+                output = Json::Value(Json::StaticString("GH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGI)
+            {
+                output = Json::Value(Json::StaticString("GI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGR)
+            {
+                output = Json::Value(Json::StaticString("GR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGL)
+            {
+                output = Json::Value(Json::StaticString("GL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGD)
+            {
+                output = Json::Value(Json::StaticString("GD"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGP)
+            {
+                output = Json::Value(Json::StaticString("GP"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGU)
+            {
+                output = Json::Value(Json::StaticString("GU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGT)
+            {
+                output = Json::Value(Json::StaticString("GT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGG)
+            {
+                output = Json::Value(Json::StaticString("GG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGN)
+            {
+                output = Json::Value(Json::StaticString("GN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGW)
+            {
+                output = Json::Value(Json::StaticString("GW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGY)
+            {
+                output = Json::Value(Json::StaticString("GY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeHT)
+            {
+                output = Json::Value(Json::StaticString("HT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeHM)
+            {
+                output = Json::Value(Json::StaticString("HM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeVA)
+            {
+                output = Json::Value(Json::StaticString("VA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeHN)
+            {
+                output = Json::Value(Json::StaticString("HN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeHK)
+            {
+                output = Json::Value(Json::StaticString("HK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeHU)
+            {
+                output = Json::Value(Json::StaticString("HU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIS)
+            {
+                output = Json::Value(Json::StaticString("IS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIN)
+            {
+                output = Json::Value(Json::StaticString("IN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeID)
+            {
+                output = Json::Value(Json::StaticString("ID"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIR)
+            {
+                output = Json::Value(Json::StaticString("IR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIQ)
+            {
+                output = Json::Value(Json::StaticString("IQ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIE)
+            {
+                output = Json::Value(Json::StaticString("IE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIM)
+            {
+                output = Json::Value(Json::StaticString("IM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIL)
+            {
+                output = Json::Value(Json::StaticString("IL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeIT)
+            {
+                output = Json::Value(Json::StaticString("IT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeJM)
+            {
+                output = Json::Value(Json::StaticString("JM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeJP)
+            {
+                output = Json::Value(Json::StaticString("JP"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeJE)
+            {
+                output = Json::Value(Json::StaticString("JE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeJO)
+            {
+                output = Json::Value(Json::StaticString("JO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKZ)
+            {
+                output = Json::Value(Json::StaticString("KZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKE)
+            {
+                output = Json::Value(Json::StaticString("KE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKI)
+            {
+                output = Json::Value(Json::StaticString("KI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKP)
+            {
+                output = Json::Value(Json::StaticString("KP"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKR)
+            {
+                output = Json::Value(Json::StaticString("KR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKW)
+            {
+                output = Json::Value(Json::StaticString("KW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKG)
+            {
+                output = Json::Value(Json::StaticString("KG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLA)
+            {
+                output = Json::Value(Json::StaticString("LA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLV)
+            {
+                output = Json::Value(Json::StaticString("LV"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLB)
+            {
+                output = Json::Value(Json::StaticString("LB"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLS)
+            {
+                output = Json::Value(Json::StaticString("LS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLR)
+            {
+                output = Json::Value(Json::StaticString("LR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLY)
+            {
+                output = Json::Value(Json::StaticString("LY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLI)
+            {
+                output = Json::Value(Json::StaticString("LI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLT)
+            {
+                output = Json::Value(Json::StaticString("LT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLU)
+            {
+                output = Json::Value(Json::StaticString("LU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMO)
+            {
+                output = Json::Value(Json::StaticString("MO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMK)
+            {
+                output = Json::Value(Json::StaticString("MK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMG)
+            {
+                output = Json::Value(Json::StaticString("MG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMW)
+            {
+                output = Json::Value(Json::StaticString("MW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMY)
+            {
+                output = Json::Value(Json::StaticString("MY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMV)
+            {
+                output = Json::Value(Json::StaticString("MV"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeML)
+            {
+                output = Json::Value(Json::StaticString("ML"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMT)
+            {
+                output = Json::Value(Json::StaticString("MT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMH)
+            {
+                output = Json::Value(Json::StaticString("MH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMQ)
+            {
+                output = Json::Value(Json::StaticString("MQ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMR)
+            {
+                output = Json::Value(Json::StaticString("MR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMU)
+            {
+                output = Json::Value(Json::StaticString("MU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeYT)
+            {
+                output = Json::Value(Json::StaticString("YT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMX)
+            {
+                output = Json::Value(Json::StaticString("MX"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeFM)
+            {
+                output = Json::Value(Json::StaticString("FM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMD)
+            {
+                output = Json::Value(Json::StaticString("MD"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMC)
+            {
+                output = Json::Value(Json::StaticString("MC"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMN)
+            {
+                output = Json::Value(Json::StaticString("MN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeME)
+            {
+                output = Json::Value(Json::StaticString("ME"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMS)
+            {
+                output = Json::Value(Json::StaticString("MS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMA)
+            {
+                output = Json::Value(Json::StaticString("MA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMZ)
+            {
+                output = Json::Value(Json::StaticString("MZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMM)
+            {
+                output = Json::Value(Json::StaticString("MM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNA)
+            {
+                output = Json::Value(Json::StaticString("NA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNR)
+            {
+                output = Json::Value(Json::StaticString("NR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNP)
+            {
+                output = Json::Value(Json::StaticString("NP"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNL)
+            {
+                output = Json::Value(Json::StaticString("NL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNC)
+            {
+                output = Json::Value(Json::StaticString("NC"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNZ)
+            {
+                output = Json::Value(Json::StaticString("NZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNI)
+            {
+                output = Json::Value(Json::StaticString("NI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNE)
+            {
+                output = Json::Value(Json::StaticString("NE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNG)
+            {
+                output = Json::Value(Json::StaticString("NG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNU)
+            {
+                output = Json::Value(Json::StaticString("NU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNF)
+            {
+                output = Json::Value(Json::StaticString("NF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMP)
+            {
+                output = Json::Value(Json::StaticString("MP"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeNO)
+            {
+                output = Json::Value(Json::StaticString("NO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeOM)
+            {
+                output = Json::Value(Json::StaticString("OM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePK)
+            {
+                output = Json::Value(Json::StaticString("PK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePW)
+            {
+                output = Json::Value(Json::StaticString("PW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePS)
+            {
+                output = Json::Value(Json::StaticString("PS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePA)
+            {
+                output = Json::Value(Json::StaticString("PA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePG)
+            {
+                output = Json::Value(Json::StaticString("PG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePY)
+            {
+                output = Json::Value(Json::StaticString("PY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePE)
+            {
+                output = Json::Value(Json::StaticString("PE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePH)
+            {
+                output = Json::Value(Json::StaticString("PH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePN)
+            {
+                output = Json::Value(Json::StaticString("PN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePL)
+            {
+                output = Json::Value(Json::StaticString("PL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePT)
+            {
+                output = Json::Value(Json::StaticString("PT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePR)
+            {
+                output = Json::Value(Json::StaticString("PR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeQA)
+            {
+                output = Json::Value(Json::StaticString("QA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeRE)
+            {
+                output = Json::Value(Json::StaticString("RE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeRO)
+            {
+                output = Json::Value(Json::StaticString("RO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeRU)
+            {
+                output = Json::Value(Json::StaticString("RU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeRW)
+            {
+                output = Json::Value(Json::StaticString("RW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeBL)
+            {
+                output = Json::Value(Json::StaticString("BL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSH)
+            {
+                output = Json::Value(Json::StaticString("SH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeKN)
+            {
+                output = Json::Value(Json::StaticString("KN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLC)
+            {
+                output = Json::Value(Json::StaticString("LC"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeMF)
+            {
+                output = Json::Value(Json::StaticString("MF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodePM)
+            {
+                output = Json::Value(Json::StaticString("PM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeVC)
+            {
+                output = Json::Value(Json::StaticString("VC"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeWS)
+            {
+                output = Json::Value(Json::StaticString("WS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSM)
+            {
+                output = Json::Value(Json::StaticString("SM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeST)
+            {
+                output = Json::Value(Json::StaticString("ST"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSA)
+            {
+                output = Json::Value(Json::StaticString("SA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSN)
+            {
+                output = Json::Value(Json::StaticString("SN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeRS)
+            {
+                output = Json::Value(Json::StaticString("RS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSC)
+            {
+                output = Json::Value(Json::StaticString("SC"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSL)
+            {
+                output = Json::Value(Json::StaticString("SL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSG)
+            {
+                output = Json::Value(Json::StaticString("SG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSX)
+            {
+                output = Json::Value(Json::StaticString("SX"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSK)
+            {
+                output = Json::Value(Json::StaticString("SK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSI)
+            {
+                output = Json::Value(Json::StaticString("SI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSB)
+            {
+                output = Json::Value(Json::StaticString("SB"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSO)
+            {
+                output = Json::Value(Json::StaticString("SO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeZA)
+            {
+                output = Json::Value(Json::StaticString("ZA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGS)
+            {
+                output = Json::Value(Json::StaticString("GS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSS)
+            {
+                output = Json::Value(Json::StaticString("SS"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeES)
+            {
+                output = Json::Value(Json::StaticString("ES"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeLK)
+            {
+                output = Json::Value(Json::StaticString("LK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSD)
+            {
+                output = Json::Value(Json::StaticString("SD"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSR)
+            {
+                output = Json::Value(Json::StaticString("SR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSJ)
+            {
+                output = Json::Value(Json::StaticString("SJ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSZ)
+            {
+                output = Json::Value(Json::StaticString("SZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSE)
+            {
+                output = Json::Value(Json::StaticString("SE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeCH)
+            {
+                output = Json::Value(Json::StaticString("CH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeSY)
+            {
+                output = Json::Value(Json::StaticString("SY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTW)
+            {
+                output = Json::Value(Json::StaticString("TW"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTJ)
+            {
+                output = Json::Value(Json::StaticString("TJ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTZ)
+            {
+                output = Json::Value(Json::StaticString("TZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTH)
+            {
+                output = Json::Value(Json::StaticString("TH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTL)
+            {
+                output = Json::Value(Json::StaticString("TL"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTG)
+            {
+                output = Json::Value(Json::StaticString("TG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTK)
+            {
+                output = Json::Value(Json::StaticString("TK"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTO)
+            {
+                output = Json::Value(Json::StaticString("TO"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTT)
+            {
+                output = Json::Value(Json::StaticString("TT"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTN)
+            {
+                output = Json::Value(Json::StaticString("TN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTR)
+            {
+                output = Json::Value(Json::StaticString("TR"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTM)
+            {
+                output = Json::Value(Json::StaticString("TM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTC)
+            {
+                output = Json::Value(Json::StaticString("TC"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeTV)
+            {
+                output = Json::Value(Json::StaticString("TV"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeUG)
+            {
+                output = Json::Value(Json::StaticString("UG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeUA)
+            {
+                output = Json::Value(Json::StaticString("UA"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeAE)
+            {
+                output = Json::Value(Json::StaticString("AE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeGB)
+            {
+                output = Json::Value(Json::StaticString("GB"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeUS)
+            {
+                output = Json::Value(Json::StaticString("US"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeUM)
+            {
+                output = Json::Value(Json::StaticString("UM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeUY)
+            {
+                output = Json::Value(Json::StaticString("UY"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeUZ)
+            {
+                output = Json::Value(Json::StaticString("UZ"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeVU)
+            {
+                output = Json::Value(Json::StaticString("VU"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeVE)
+            {
+                output = Json::Value(Json::StaticString("VE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeVN)
+            {
+                output = Json::Value(Json::StaticString("VN"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeVG)
+            {
+                output = Json::Value(Json::StaticString("VG"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeVI)
+            {
+                output = Json::Value(Json::StaticString("VI"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeWF)
+            {
+                output = Json::Value(Json::StaticString("WF"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeEH)
+            {
+                output = Json::Value(Json::StaticString("EH"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeYE)
+            {
+                output = Json::Value(Json::StaticString("YE"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeZM)
+            {
+                output = Json::Value(Json::StaticString("ZM"));
+                return;
+            }
+            if (input == CountryCode::CountryCodeZW)
+            {
+                output = Json::Value(Json::StaticString("ZW"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, CountryCode& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "AF")
+            {
+                output = CountryCode::CountryCodeAF;
+                return;
+            }
+            if (inputStr == "AX")
+            {
+                output = CountryCode::CountryCodeAX;
+                return;
+            }
+            if (inputStr == "AL")
+            {
+                output = CountryCode::CountryCodeAL;
+                return;
+            }
+            if (inputStr == "DZ")
+            {
+                output = CountryCode::CountryCodeDZ;
+                return;
+            }
+            if (inputStr == "AS")
+            {
+                output = CountryCode::CountryCodeAS;
+                return;
+            }
+            if (inputStr == "AD")
+            {
+                output = CountryCode::CountryCodeAD;
+                return;
+            }
+            if (inputStr == "AO")
+            {
+                output = CountryCode::CountryCodeAO;
+                return;
+            }
+            if (inputStr == "AI")
+            {
+                output = CountryCode::CountryCodeAI;
+                return;
+            }
+            if (inputStr == "AQ")
+            {
+                output = CountryCode::CountryCodeAQ;
+                return;
+            }
+            if (inputStr == "AG")
+            {
+                output = CountryCode::CountryCodeAG;
+                return;
+            }
+            if (inputStr == "AR")
+            {
+                output = CountryCode::CountryCodeAR;
+                return;
+            }
+            if (inputStr == "AM")
+            {
+                output = CountryCode::CountryCodeAM;
+                return;
+            }
+            if (inputStr == "AW")
+            {
+                output = CountryCode::CountryCodeAW;
+                return;
+            }
+            if (inputStr == "AU")
+            {
+                output = CountryCode::CountryCodeAU;
+                return;
+            }
+            if (inputStr == "AT")
+            {
+                output = CountryCode::CountryCodeAT;
+                return;
+            }
+            if (inputStr == "AZ")
+            {
+                output = CountryCode::CountryCodeAZ;
+                return;
+            }
+            if (inputStr == "BS")
+            {
+                output = CountryCode::CountryCodeBS;
+                return;
+            }
+            if (inputStr == "BH")
+            {
+                output = CountryCode::CountryCodeBH;
+                return;
+            }
+            if (inputStr == "BD")
+            {
+                output = CountryCode::CountryCodeBD;
+                return;
+            }
+            if (inputStr == "BB")
+            {
+                output = CountryCode::CountryCodeBB;
+                return;
+            }
+            if (inputStr == "BY")
+            {
+                output = CountryCode::CountryCodeBY;
+                return;
+            }
+            if (inputStr == "BE")
+            {
+                output = CountryCode::CountryCodeBE;
+                return;
+            }
+            if (inputStr == "BZ")
+            {
+                output = CountryCode::CountryCodeBZ;
+                return;
+            }
+            if (inputStr == "BJ")
+            {
+                output = CountryCode::CountryCodeBJ;
+                return;
+            }
+            if (inputStr == "BM")
+            {
+                output = CountryCode::CountryCodeBM;
+                return;
+            }
+            if (inputStr == "BT")
+            {
+                output = CountryCode::CountryCodeBT;
+                return;
+            }
+            if (inputStr == "BO")
+            {
+                output = CountryCode::CountryCodeBO;
+                return;
+            }
+            if (inputStr == "BQ")
+            {
+                output = CountryCode::CountryCodeBQ;
+                return;
+            }
+            if (inputStr == "BA")
+            {
+                output = CountryCode::CountryCodeBA;
+                return;
+            }
+            if (inputStr == "BW")
+            {
+                output = CountryCode::CountryCodeBW;
+                return;
+            }
+            if (inputStr == "BV")
+            {
+                output = CountryCode::CountryCodeBV;
+                return;
+            }
+            if (inputStr == "BR")
+            {
+                output = CountryCode::CountryCodeBR;
+                return;
+            }
+            if (inputStr == "IO")
+            {
+                output = CountryCode::CountryCodeIO;
+                return;
+            }
+            if (inputStr == "BN")
+            {
+                output = CountryCode::CountryCodeBN;
+                return;
+            }
+            if (inputStr == "BG")
+            {
+                output = CountryCode::CountryCodeBG;
+                return;
+            }
+            if (inputStr == "BF")
+            {
+                output = CountryCode::CountryCodeBF;
+                return;
+            }
+            if (inputStr == "BI")
+            {
+                output = CountryCode::CountryCodeBI;
+                return;
+            }
+            if (inputStr == "KH")
+            {
+                output = CountryCode::CountryCodeKH;
+                return;
+            }
+            if (inputStr == "CM")
+            {
+                output = CountryCode::CountryCodeCM;
+                return;
+            }
+            if (inputStr == "CA")
+            {
+                output = CountryCode::CountryCodeCA;
+                return;
+            }
+            if (inputStr == "CV")
+            {
+                output = CountryCode::CountryCodeCV;
+                return;
+            }
+            if (inputStr == "KY")
+            {
+                output = CountryCode::CountryCodeKY;
+                return;
+            }
+            if (inputStr == "CF")
+            {
+                output = CountryCode::CountryCodeCF;
+                return;
+            }
+            if (inputStr == "TD")
+            {
+                output = CountryCode::CountryCodeTD;
+                return;
+            }
+            if (inputStr == "CL")
+            {
+                output = CountryCode::CountryCodeCL;
+                return;
+            }
+            if (inputStr == "CN")
+            {
+                output = CountryCode::CountryCodeCN;
+                return;
+            }
+            if (inputStr == "CX")
+            {
+                output = CountryCode::CountryCodeCX;
+                return;
+            }
+            if (inputStr == "CC")
+            {
+                output = CountryCode::CountryCodeCC;
+                return;
+            }
+            if (inputStr == "CO")
+            {
+                output = CountryCode::CountryCodeCO;
+                return;
+            }
+            if (inputStr == "KM")
+            {
+                output = CountryCode::CountryCodeKM;
+                return;
+            }
+            if (inputStr == "CG")
+            {
+                output = CountryCode::CountryCodeCG;
+                return;
+            }
+            if (inputStr == "CD")
+            {
+                output = CountryCode::CountryCodeCD;
+                return;
+            }
+            if (inputStr == "CK")
+            {
+                output = CountryCode::CountryCodeCK;
+                return;
+            }
+            if (inputStr == "CR")
+            {
+                output = CountryCode::CountryCodeCR;
+                return;
+            }
+            if (inputStr == "CI")
+            {
+                output = CountryCode::CountryCodeCI;
+                return;
+            }
+            if (inputStr == "HR")
+            {
+                output = CountryCode::CountryCodeHR;
+                return;
+            }
+            if (inputStr == "CU")
+            {
+                output = CountryCode::CountryCodeCU;
+                return;
+            }
+            if (inputStr == "CW")
+            {
+                output = CountryCode::CountryCodeCW;
+                return;
+            }
+            if (inputStr == "CY")
+            {
+                output = CountryCode::CountryCodeCY;
+                return;
+            }
+            if (inputStr == "CZ")
+            {
+                output = CountryCode::CountryCodeCZ;
+                return;
+            }
+            if (inputStr == "DK")
+            {
+                output = CountryCode::CountryCodeDK;
+                return;
+            }
+            if (inputStr == "DJ")
+            {
+                output = CountryCode::CountryCodeDJ;
+                return;
+            }
+            if (inputStr == "DM")
+            {
+                output = CountryCode::CountryCodeDM;
+                return;
+            }
+            if (inputStr == "DO")
+            {
+                output = CountryCode::CountryCodeDO;
+                return;
+            }
+            if (inputStr == "EC")
+            {
+                output = CountryCode::CountryCodeEC;
+                return;
+            }
+            if (inputStr == "EG")
+            {
+                output = CountryCode::CountryCodeEG;
+                return;
+            }
+            if (inputStr == "SV")
+            {
+                output = CountryCode::CountryCodeSV;
+                return;
+            }
+            if (inputStr == "GQ")
+            {
+                output = CountryCode::CountryCodeGQ;
+                return;
+            }
+            if (inputStr == "ER")
+            {
+                output = CountryCode::CountryCodeER;
+                return;
+            }
+            if (inputStr == "EE")
+            {
+                output = CountryCode::CountryCodeEE;
+                return;
+            }
+            if (inputStr == "ET")
+            {
+                output = CountryCode::CountryCodeET;
+                return;
+            }
+            if (inputStr == "FK")
+            {
+                output = CountryCode::CountryCodeFK;
+                return;
+            }
+            if (inputStr == "FO")
+            {
+                output = CountryCode::CountryCodeFO;
+                return;
+            }
+            if (inputStr == "FJ")
+            {
+                output = CountryCode::CountryCodeFJ;
+                return;
+            }
+            if (inputStr == "FI")
+            {
+                output = CountryCode::CountryCodeFI;
+                return;
+            }
+            if (inputStr == "FR")
+            {
+                output = CountryCode::CountryCodeFR;
+                return;
+            }
+            if (inputStr == "GF")
+            {
+                output = CountryCode::CountryCodeGF;
+                return;
+            }
+            if (inputStr == "PF")
+            {
+                output = CountryCode::CountryCodePF;
+                return;
+            }
+            if (inputStr == "TF")
+            {
+                output = CountryCode::CountryCodeTF;
+                return;
+            }
+            if (inputStr == "GA")
+            {
+                output = CountryCode::CountryCodeGA;
+                return;
+            }
+            if (inputStr == "GM")
+            {
+                output = CountryCode::CountryCodeGM;
+                return;
+            }
+            if (inputStr == "GE")
+            {
+                output = CountryCode::CountryCodeGE;
+                return;
+            }
+            if (inputStr == "DE")
+            {
+                output = CountryCode::CountryCodeDE;
+                return;
+            }
+            if (inputStr == "GH")
+            {
+                output = CountryCode::CountryCodeGH;
+                return;
+            }
+            if (inputStr == "GI")
+            {
+                output = CountryCode::CountryCodeGI;
+                return;
+            }
+            if (inputStr == "GR")
+            {
+                output = CountryCode::CountryCodeGR;
+                return;
+            }
+            if (inputStr == "GL")
+            {
+                output = CountryCode::CountryCodeGL;
+                return;
+            }
+            if (inputStr == "GD")
+            {
+                output = CountryCode::CountryCodeGD;
+                return;
+            }
+            if (inputStr == "GP")
+            {
+                output = CountryCode::CountryCodeGP;
+                return;
+            }
+            if (inputStr == "GU")
+            {
+                output = CountryCode::CountryCodeGU;
+                return;
+            }
+            if (inputStr == "GT")
+            {
+                output = CountryCode::CountryCodeGT;
+                return;
+            }
+            if (inputStr == "GG")
+            {
+                output = CountryCode::CountryCodeGG;
+                return;
+            }
+            if (inputStr == "GN")
+            {
+                output = CountryCode::CountryCodeGN;
+                return;
+            }
+            if (inputStr == "GW")
+            {
+                output = CountryCode::CountryCodeGW;
+                return;
+            }
+            if (inputStr == "GY")
+            {
+                output = CountryCode::CountryCodeGY;
+                return;
+            }
+            if (inputStr == "HT")
+            {
+                output = CountryCode::CountryCodeHT;
+                return;
+            }
+            if (inputStr == "HM")
+            {
+                output = CountryCode::CountryCodeHM;
+                return;
+            }
+            if (inputStr == "VA")
+            {
+                output = CountryCode::CountryCodeVA;
+                return;
+            }
+            if (inputStr == "HN")
+            {
+                output = CountryCode::CountryCodeHN;
+                return;
+            }
+            if (inputStr == "HK")
+            {
+                output = CountryCode::CountryCodeHK;
+                return;
+            }
+            if (inputStr == "HU")
+            {
+                output = CountryCode::CountryCodeHU;
+                return;
+            }
+            if (inputStr == "IS")
+            {
+                output = CountryCode::CountryCodeIS;
+                return;
+            }
+            if (inputStr == "IN")
+            {
+                output = CountryCode::CountryCodeIN;
+                return;
+            }
+            if (inputStr == "ID")
+            {
+                output = CountryCode::CountryCodeID;
+                return;
+            }
+            if (inputStr == "IR")
+            {
+                output = CountryCode::CountryCodeIR;
+                return;
+            }
+            if (inputStr == "IQ")
+            {
+                output = CountryCode::CountryCodeIQ;
+                return;
+            }
+            if (inputStr == "IE")
+            {
+                output = CountryCode::CountryCodeIE;
+                return;
+            }
+            if (inputStr == "IM")
+            {
+                output = CountryCode::CountryCodeIM;
+                return;
+            }
+            if (inputStr == "IL")
+            {
+                output = CountryCode::CountryCodeIL;
+                return;
+            }
+            if (inputStr == "IT")
+            {
+                output = CountryCode::CountryCodeIT;
+                return;
+            }
+            if (inputStr == "JM")
+            {
+                output = CountryCode::CountryCodeJM;
+                return;
+            }
+            if (inputStr == "JP")
+            {
+                output = CountryCode::CountryCodeJP;
+                return;
+            }
+            if (inputStr == "JE")
+            {
+                output = CountryCode::CountryCodeJE;
+                return;
+            }
+            if (inputStr == "JO")
+            {
+                output = CountryCode::CountryCodeJO;
+                return;
+            }
+            if (inputStr == "KZ")
+            {
+                output = CountryCode::CountryCodeKZ;
+                return;
+            }
+            if (inputStr == "KE")
+            {
+                output = CountryCode::CountryCodeKE;
+                return;
+            }
+            if (inputStr == "KI")
+            {
+                output = CountryCode::CountryCodeKI;
+                return;
+            }
+            if (inputStr == "KP")
+            {
+                output = CountryCode::CountryCodeKP;
+                return;
+            }
+            if (inputStr == "KR")
+            {
+                output = CountryCode::CountryCodeKR;
+                return;
+            }
+            if (inputStr == "KW")
+            {
+                output = CountryCode::CountryCodeKW;
+                return;
+            }
+            if (inputStr == "KG")
+            {
+                output = CountryCode::CountryCodeKG;
+                return;
+            }
+            if (inputStr == "LA")
+            {
+                output = CountryCode::CountryCodeLA;
+                return;
+            }
+            if (inputStr == "LV")
+            {
+                output = CountryCode::CountryCodeLV;
+                return;
+            }
+            if (inputStr == "LB")
+            {
+                output = CountryCode::CountryCodeLB;
+                return;
+            }
+            if (inputStr == "LS")
+            {
+                output = CountryCode::CountryCodeLS;
+                return;
+            }
+            if (inputStr == "LR")
+            {
+                output = CountryCode::CountryCodeLR;
+                return;
+            }
+            if (inputStr == "LY")
+            {
+                output = CountryCode::CountryCodeLY;
+                return;
+            }
+            if (inputStr == "LI")
+            {
+                output = CountryCode::CountryCodeLI;
+                return;
+            }
+            if (inputStr == "LT")
+            {
+                output = CountryCode::CountryCodeLT;
+                return;
+            }
+            if (inputStr == "LU")
+            {
+                output = CountryCode::CountryCodeLU;
+                return;
+            }
+            if (inputStr == "MO")
+            {
+                output = CountryCode::CountryCodeMO;
+                return;
+            }
+            if (inputStr == "MK")
+            {
+                output = CountryCode::CountryCodeMK;
+                return;
+            }
+            if (inputStr == "MG")
+            {
+                output = CountryCode::CountryCodeMG;
+                return;
+            }
+            if (inputStr == "MW")
+            {
+                output = CountryCode::CountryCodeMW;
+                return;
+            }
+            if (inputStr == "MY")
+            {
+                output = CountryCode::CountryCodeMY;
+                return;
+            }
+            if (inputStr == "MV")
+            {
+                output = CountryCode::CountryCodeMV;
+                return;
+            }
+            if (inputStr == "ML")
+            {
+                output = CountryCode::CountryCodeML;
+                return;
+            }
+            if (inputStr == "MT")
+            {
+                output = CountryCode::CountryCodeMT;
+                return;
+            }
+            if (inputStr == "MH")
+            {
+                output = CountryCode::CountryCodeMH;
+                return;
+            }
+            if (inputStr == "MQ")
+            {
+                output = CountryCode::CountryCodeMQ;
+                return;
+            }
+            if (inputStr == "MR")
+            {
+                output = CountryCode::CountryCodeMR;
+                return;
+            }
+            if (inputStr == "MU")
+            {
+                output = CountryCode::CountryCodeMU;
+                return;
+            }
+            if (inputStr == "YT")
+            {
+                output = CountryCode::CountryCodeYT;
+                return;
+            }
+            if (inputStr == "MX")
+            {
+                output = CountryCode::CountryCodeMX;
+                return;
+            }
+            if (inputStr == "FM")
+            {
+                output = CountryCode::CountryCodeFM;
+                return;
+            }
+            if (inputStr == "MD")
+            {
+                output = CountryCode::CountryCodeMD;
+                return;
+            }
+            if (inputStr == "MC")
+            {
+                output = CountryCode::CountryCodeMC;
+                return;
+            }
+            if (inputStr == "MN")
+            {
+                output = CountryCode::CountryCodeMN;
+                return;
+            }
+            if (inputStr == "ME")
+            {
+                output = CountryCode::CountryCodeME;
+                return;
+            }
+            if (inputStr == "MS")
+            {
+                output = CountryCode::CountryCodeMS;
+                return;
+            }
+            if (inputStr == "MA")
+            {
+                output = CountryCode::CountryCodeMA;
+                return;
+            }
+            if (inputStr == "MZ")
+            {
+                output = CountryCode::CountryCodeMZ;
+                return;
+            }
+            if (inputStr == "MM")
+            {
+                output = CountryCode::CountryCodeMM;
+                return;
+            }
+            if (inputStr == "NA")
+            {
+                output = CountryCode::CountryCodeNA;
+                return;
+            }
+            if (inputStr == "NR")
+            {
+                output = CountryCode::CountryCodeNR;
+                return;
+            }
+            if (inputStr == "NP")
+            {
+                output = CountryCode::CountryCodeNP;
+                return;
+            }
+            if (inputStr == "NL")
+            {
+                output = CountryCode::CountryCodeNL;
+                return;
+            }
+            if (inputStr == "NC")
+            {
+                output = CountryCode::CountryCodeNC;
+                return;
+            }
+            if (inputStr == "NZ")
+            {
+                output = CountryCode::CountryCodeNZ;
+                return;
+            }
+            if (inputStr == "NI")
+            {
+                output = CountryCode::CountryCodeNI;
+                return;
+            }
+            if (inputStr == "NE")
+            {
+                output = CountryCode::CountryCodeNE;
+                return;
+            }
+            if (inputStr == "NG")
+            {
+                output = CountryCode::CountryCodeNG;
+                return;
+            }
+            if (inputStr == "NU")
+            {
+                output = CountryCode::CountryCodeNU;
+                return;
+            }
+            if (inputStr == "NF")
+            {
+                output = CountryCode::CountryCodeNF;
+                return;
+            }
+            if (inputStr == "MP")
+            {
+                output = CountryCode::CountryCodeMP;
+                return;
+            }
+            if (inputStr == "NO")
+            {
+                output = CountryCode::CountryCodeNO;
+                return;
+            }
+            if (inputStr == "OM")
+            {
+                output = CountryCode::CountryCodeOM;
+                return;
+            }
+            if (inputStr == "PK")
+            {
+                output = CountryCode::CountryCodePK;
+                return;
+            }
+            if (inputStr == "PW")
+            {
+                output = CountryCode::CountryCodePW;
+                return;
+            }
+            if (inputStr == "PS")
+            {
+                output = CountryCode::CountryCodePS;
+                return;
+            }
+            if (inputStr == "PA")
+            {
+                output = CountryCode::CountryCodePA;
+                return;
+            }
+            if (inputStr == "PG")
+            {
+                output = CountryCode::CountryCodePG;
+                return;
+            }
+            if (inputStr == "PY")
+            {
+                output = CountryCode::CountryCodePY;
+                return;
+            }
+            if (inputStr == "PE")
+            {
+                output = CountryCode::CountryCodePE;
+                return;
+            }
+            if (inputStr == "PH")
+            {
+                output = CountryCode::CountryCodePH;
+                return;
+            }
+            if (inputStr == "PN")
+            {
+                output = CountryCode::CountryCodePN;
+                return;
+            }
+            if (inputStr == "PL")
+            {
+                output = CountryCode::CountryCodePL;
+                return;
+            }
+            if (inputStr == "PT")
+            {
+                output = CountryCode::CountryCodePT;
+                return;
+            }
+            if (inputStr == "PR")
+            {
+                output = CountryCode::CountryCodePR;
+                return;
+            }
+            if (inputStr == "QA")
+            {
+                output = CountryCode::CountryCodeQA;
+                return;
+            }
+            if (inputStr == "RE")
+            {
+                output = CountryCode::CountryCodeRE;
+                return;
+            }
+            if (inputStr == "RO")
+            {
+                output = CountryCode::CountryCodeRO;
+                return;
+            }
+            if (inputStr == "RU")
+            {
+                output = CountryCode::CountryCodeRU;
+                return;
+            }
+            if (inputStr == "RW")
+            {
+                output = CountryCode::CountryCodeRW;
+                return;
+            }
+            if (inputStr == "BL")
+            {
+                output = CountryCode::CountryCodeBL;
+                return;
+            }
+            if (inputStr == "SH")
+            {
+                output = CountryCode::CountryCodeSH;
+                return;
+            }
+            if (inputStr == "KN")
+            {
+                output = CountryCode::CountryCodeKN;
+                return;
+            }
+            if (inputStr == "LC")
+            {
+                output = CountryCode::CountryCodeLC;
+                return;
+            }
+            if (inputStr == "MF")
+            {
+                output = CountryCode::CountryCodeMF;
+                return;
+            }
+            if (inputStr == "PM")
+            {
+                output = CountryCode::CountryCodePM;
+                return;
+            }
+            if (inputStr == "VC")
+            {
+                output = CountryCode::CountryCodeVC;
+                return;
+            }
+            if (inputStr == "WS")
+            {
+                output = CountryCode::CountryCodeWS;
+                return;
+            }
+            if (inputStr == "SM")
+            {
+                output = CountryCode::CountryCodeSM;
+                return;
+            }
+            if (inputStr == "ST")
+            {
+                output = CountryCode::CountryCodeST;
+                return;
+            }
+            if (inputStr == "SA")
+            {
+                output = CountryCode::CountryCodeSA;
+                return;
+            }
+            if (inputStr == "SN")
+            {
+                output = CountryCode::CountryCodeSN;
+                return;
+            }
+            if (inputStr == "RS")
+            {
+                output = CountryCode::CountryCodeRS;
+                return;
+            }
+            if (inputStr == "SC")
+            {
+                output = CountryCode::CountryCodeSC;
+                return;
+            }
+            if (inputStr == "SL")
+            {
+                output = CountryCode::CountryCodeSL;
+                return;
+            }
+            if (inputStr == "SG")
+            {
+                output = CountryCode::CountryCodeSG;
+                return;
+            }
+            if (inputStr == "SX")
+            {
+                output = CountryCode::CountryCodeSX;
+                return;
+            }
+            if (inputStr == "SK")
+            {
+                output = CountryCode::CountryCodeSK;
+                return;
+            }
+            if (inputStr == "SI")
+            {
+                output = CountryCode::CountryCodeSI;
+                return;
+            }
+            if (inputStr == "SB")
+            {
+                output = CountryCode::CountryCodeSB;
+                return;
+            }
+            if (inputStr == "SO")
+            {
+                output = CountryCode::CountryCodeSO;
+                return;
+            }
+            if (inputStr == "ZA")
+            {
+                output = CountryCode::CountryCodeZA;
+                return;
+            }
+            if (inputStr == "GS")
+            {
+                output = CountryCode::CountryCodeGS;
+                return;
+            }
+            if (inputStr == "SS")
+            {
+                output = CountryCode::CountryCodeSS;
+                return;
+            }
+            if (inputStr == "ES")
+            {
+                output = CountryCode::CountryCodeES;
+                return;
+            }
+            if (inputStr == "LK")
+            {
+                output = CountryCode::CountryCodeLK;
+                return;
+            }
+            if (inputStr == "SD")
+            {
+                output = CountryCode::CountryCodeSD;
+                return;
+            }
+            if (inputStr == "SR")
+            {
+                output = CountryCode::CountryCodeSR;
+                return;
+            }
+            if (inputStr == "SJ")
+            {
+                output = CountryCode::CountryCodeSJ;
+                return;
+            }
+            if (inputStr == "SZ")
+            {
+                output = CountryCode::CountryCodeSZ;
+                return;
+            }
+            if (inputStr == "SE")
+            {
+                output = CountryCode::CountryCodeSE;
+                return;
+            }
+            if (inputStr == "CH")
+            {
+                output = CountryCode::CountryCodeCH;
+                return;
+            }
+            if (inputStr == "SY")
+            {
+                output = CountryCode::CountryCodeSY;
+                return;
+            }
+            if (inputStr == "TW")
+            {
+                output = CountryCode::CountryCodeTW;
+                return;
+            }
+            if (inputStr == "TJ")
+            {
+                output = CountryCode::CountryCodeTJ;
+                return;
+            }
+            if (inputStr == "TZ")
+            {
+                output = CountryCode::CountryCodeTZ;
+                return;
+            }
+            if (inputStr == "TH")
+            {
+                output = CountryCode::CountryCodeTH;
+                return;
+            }
+            if (inputStr == "TL")
+            {
+                output = CountryCode::CountryCodeTL;
+                return;
+            }
+            if (inputStr == "TG")
+            {
+                output = CountryCode::CountryCodeTG;
+                return;
+            }
+            if (inputStr == "TK")
+            {
+                output = CountryCode::CountryCodeTK;
+                return;
+            }
+            if (inputStr == "TO")
+            {
+                output = CountryCode::CountryCodeTO;
+                return;
+            }
+            if (inputStr == "TT")
+            {
+                output = CountryCode::CountryCodeTT;
+                return;
+            }
+            if (inputStr == "TN")
+            {
+                output = CountryCode::CountryCodeTN;
+                return;
+            }
+            if (inputStr == "TR")
+            {
+                output = CountryCode::CountryCodeTR;
+                return;
+            }
+            if (inputStr == "TM")
+            {
+                output = CountryCode::CountryCodeTM;
+                return;
+            }
+            if (inputStr == "TC")
+            {
+                output = CountryCode::CountryCodeTC;
+                return;
+            }
+            if (inputStr == "TV")
+            {
+                output = CountryCode::CountryCodeTV;
+                return;
+            }
+            if (inputStr == "UG")
+            {
+                output = CountryCode::CountryCodeUG;
+                return;
+            }
+            if (inputStr == "UA")
+            {
+                output = CountryCode::CountryCodeUA;
+                return;
+            }
+            if (inputStr == "AE")
+            {
+                output = CountryCode::CountryCodeAE;
+                return;
+            }
+            if (inputStr == "GB")
+            {
+                output = CountryCode::CountryCodeGB;
+                return;
+            }
+            if (inputStr == "US")
+            {
+                output = CountryCode::CountryCodeUS;
+                return;
+            }
+            if (inputStr == "UM")
+            {
+                output = CountryCode::CountryCodeUM;
+                return;
+            }
+            if (inputStr == "UY")
+            {
+                output = CountryCode::CountryCodeUY;
+                return;
+            }
+            if (inputStr == "UZ")
+            {
+                output = CountryCode::CountryCodeUZ;
+                return;
+            }
+            if (inputStr == "VU")
+            {
+                output = CountryCode::CountryCodeVU;
+                return;
+            }
+            if (inputStr == "VE")
+            {
+                output = CountryCode::CountryCodeVE;
+                return;
+            }
+            if (inputStr == "VN")
+            {
+                output = CountryCode::CountryCodeVN;
+                return;
+            }
+            if (inputStr == "VG")
+            {
+                output = CountryCode::CountryCodeVG;
+                return;
+            }
+            if (inputStr == "VI")
+            {
+                output = CountryCode::CountryCodeVI;
+                return;
+            }
+            if (inputStr == "WF")
+            {
+                output = CountryCode::CountryCodeWF;
+                return;
+            }
+            if (inputStr == "EH")
+            {
+                output = CountryCode::CountryCodeEH;
+                return;
+            }
+            if (inputStr == "YE")
+            {
+                output = CountryCode::CountryCodeYE;
+                return;
+            }
+            if (inputStr == "ZM")
+            {
+                output = CountryCode::CountryCodeZM;
+                return;
+            }
+            if (inputStr == "ZW")
+            {
+                output = CountryCode::CountryCodeZW;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const Currency input, Json::Value& output)
+        {
+            if (input == Currency::CurrencyAED)
+            {
+                output = Json::Value(Json::StaticString("AED"));
+                return;
+            }
+            if (input == Currency::CurrencyAFN)
+            {
+                output = Json::Value(Json::StaticString("AFN"));
+                return;
+            }
+            if (input == Currency::CurrencyALL)
+            {
+                output = Json::Value(Json::StaticString("ALL"));
+                return;
+            }
+            if (input == Currency::CurrencyAMD)
+            {
+                output = Json::Value(Json::StaticString("AMD"));
+                return;
+            }
+            if (input == Currency::CurrencyANG)
+            {
+                output = Json::Value(Json::StaticString("ANG"));
+                return;
+            }
+            if (input == Currency::CurrencyAOA)
+            {
+                output = Json::Value(Json::StaticString("AOA"));
+                return;
+            }
+            if (input == Currency::CurrencyARS)
+            {
+                output = Json::Value(Json::StaticString("ARS"));
+                return;
+            }
+            if (input == Currency::CurrencyAUD)
+            {
+                output = Json::Value(Json::StaticString("AUD"));
+                return;
+            }
+            if (input == Currency::CurrencyAWG)
+            {
+                output = Json::Value(Json::StaticString("AWG"));
+                return;
+            }
+            if (input == Currency::CurrencyAZN)
+            {
+                output = Json::Value(Json::StaticString("AZN"));
+                return;
+            }
+            if (input == Currency::CurrencyBAM)
+            {
+                output = Json::Value(Json::StaticString("BAM"));
+                return;
+            }
+            if (input == Currency::CurrencyBBD)
+            {
+                output = Json::Value(Json::StaticString("BBD"));
+                return;
+            }
+            if (input == Currency::CurrencyBDT)
+            {
+                output = Json::Value(Json::StaticString("BDT"));
+                return;
+            }
+            if (input == Currency::CurrencyBGN)
+            {
+                output = Json::Value(Json::StaticString("BGN"));
+                return;
+            }
+            if (input == Currency::CurrencyBHD)
+            {
+                output = Json::Value(Json::StaticString("BHD"));
+                return;
+            }
+            if (input == Currency::CurrencyBIF)
+            {
+                output = Json::Value(Json::StaticString("BIF"));
+                return;
+            }
+            if (input == Currency::CurrencyBMD)
+            {
+                output = Json::Value(Json::StaticString("BMD"));
+                return;
+            }
+            if (input == Currency::CurrencyBND)
+            {
+                output = Json::Value(Json::StaticString("BND"));
+                return;
+            }
+            if (input == Currency::CurrencyBOB)
+            {
+                output = Json::Value(Json::StaticString("BOB"));
+                return;
+            }
+            if (input == Currency::CurrencyBRL)
+            {
+                output = Json::Value(Json::StaticString("BRL"));
+                return;
+            }
+            if (input == Currency::CurrencyBSD)
+            {
+                output = Json::Value(Json::StaticString("BSD"));
+                return;
+            }
+            if (input == Currency::CurrencyBTN)
+            {
+                output = Json::Value(Json::StaticString("BTN"));
+                return;
+            }
+            if (input == Currency::CurrencyBWP)
+            {
+                output = Json::Value(Json::StaticString("BWP"));
+                return;
+            }
+            if (input == Currency::CurrencyBYR)
+            {
+                output = Json::Value(Json::StaticString("BYR"));
+                return;
+            }
+            if (input == Currency::CurrencyBZD)
+            {
+                output = Json::Value(Json::StaticString("BZD"));
+                return;
+            }
+            if (input == Currency::CurrencyCAD)
+            {
+                output = Json::Value(Json::StaticString("CAD"));
+                return;
+            }
+            if (input == Currency::CurrencyCDF)
+            {
+                output = Json::Value(Json::StaticString("CDF"));
+                return;
+            }
+            if (input == Currency::CurrencyCHF)
+            {
+                output = Json::Value(Json::StaticString("CHF"));
+                return;
+            }
+            if (input == Currency::CurrencyCLP)
+            {
+                output = Json::Value(Json::StaticString("CLP"));
+                return;
+            }
+            if (input == Currency::CurrencyCNY)
+            {
+                output = Json::Value(Json::StaticString("CNY"));
+                return;
+            }
+            if (input == Currency::CurrencyCOP)
+            {
+                output = Json::Value(Json::StaticString("COP"));
+                return;
+            }
+            if (input == Currency::CurrencyCRC)
+            {
+                output = Json::Value(Json::StaticString("CRC"));
+                return;
+            }
+            if (input == Currency::CurrencyCUC)
+            {
+                output = Json::Value(Json::StaticString("CUC"));
+                return;
+            }
+            if (input == Currency::CurrencyCUP)
+            {
+                output = Json::Value(Json::StaticString("CUP"));
+                return;
+            }
+            if (input == Currency::CurrencyCVE)
+            {
+                output = Json::Value(Json::StaticString("CVE"));
+                return;
+            }
+            if (input == Currency::CurrencyCZK)
+            {
+                output = Json::Value(Json::StaticString("CZK"));
+                return;
+            }
+            if (input == Currency::CurrencyDJF)
+            {
+                output = Json::Value(Json::StaticString("DJF"));
+                return;
+            }
+            if (input == Currency::CurrencyDKK)
+            {
+                output = Json::Value(Json::StaticString("DKK"));
+                return;
+            }
+            if (input == Currency::CurrencyDOP)
+            {
+                output = Json::Value(Json::StaticString("DOP"));
+                return;
+            }
+            if (input == Currency::CurrencyDZD)
+            {
+                output = Json::Value(Json::StaticString("DZD"));
+                return;
+            }
+            if (input == Currency::CurrencyEGP)
+            {
+                output = Json::Value(Json::StaticString("EGP"));
+                return;
+            }
+            if (input == Currency::CurrencyERN)
+            {
+                output = Json::Value(Json::StaticString("ERN"));
+                return;
+            }
+            if (input == Currency::CurrencyETB)
+            {
+                output = Json::Value(Json::StaticString("ETB"));
+                return;
+            }
+            if (input == Currency::CurrencyEUR)
+            {
+                output = Json::Value(Json::StaticString("EUR"));
+                return;
+            }
+            if (input == Currency::CurrencyFJD)
+            {
+                output = Json::Value(Json::StaticString("FJD"));
+                return;
+            }
+            if (input == Currency::CurrencyFKP)
+            {
+                output = Json::Value(Json::StaticString("FKP"));
+                return;
+            }
+            if (input == Currency::CurrencyGBP)
+            {
+                output = Json::Value(Json::StaticString("GBP"));
+                return;
+            }
+            if (input == Currency::CurrencyGEL)
+            {
+                output = Json::Value(Json::StaticString("GEL"));
+                return;
+            }
+            if (input == Currency::CurrencyGGP)
+            {
+                output = Json::Value(Json::StaticString("GGP"));
+                return;
+            }
+            if (input == Currency::CurrencyGHS)
+            {
+                output = Json::Value(Json::StaticString("GHS"));
+                return;
+            }
+            if (input == Currency::CurrencyGIP)
+            {
+                output = Json::Value(Json::StaticString("GIP"));
+                return;
+            }
+            if (input == Currency::CurrencyGMD)
+            {
+                output = Json::Value(Json::StaticString("GMD"));
+                return;
+            }
+            if (input == Currency::CurrencyGNF)
+            {
+                output = Json::Value(Json::StaticString("GNF"));
+                return;
+            }
+            if (input == Currency::CurrencyGTQ)
+            {
+                output = Json::Value(Json::StaticString("GTQ"));
+                return;
+            }
+            if (input == Currency::CurrencyGYD)
+            {
+                output = Json::Value(Json::StaticString("GYD"));
+                return;
+            }
+            if (input == Currency::CurrencyHKD)
+            {
+                output = Json::Value(Json::StaticString("HKD"));
+                return;
+            }
+            if (input == Currency::CurrencyHNL)
+            {
+                output = Json::Value(Json::StaticString("HNL"));
+                return;
+            }
+            if (input == Currency::CurrencyHRK)
+            {
+                output = Json::Value(Json::StaticString("HRK"));
+                return;
+            }
+            if (input == Currency::CurrencyHTG)
+            {
+                output = Json::Value(Json::StaticString("HTG"));
+                return;
+            }
+            if (input == Currency::CurrencyHUF)
+            {
+                output = Json::Value(Json::StaticString("HUF"));
+                return;
+            }
+            if (input == Currency::CurrencyIDR)
+            {
+                output = Json::Value(Json::StaticString("IDR"));
+                return;
+            }
+            if (input == Currency::CurrencyILS)
+            {
+                output = Json::Value(Json::StaticString("ILS"));
+                return;
+            }
+            if (input == Currency::CurrencyIMP)
+            {
+                output = Json::Value(Json::StaticString("IMP"));
+                return;
+            }
+            if (input == Currency::CurrencyINR)
+            {
+                output = Json::Value(Json::StaticString("INR"));
+                return;
+            }
+            if (input == Currency::CurrencyIQD)
+            {
+                output = Json::Value(Json::StaticString("IQD"));
+                return;
+            }
+            if (input == Currency::CurrencyIRR)
+            {
+                output = Json::Value(Json::StaticString("IRR"));
+                return;
+            }
+            if (input == Currency::CurrencyISK)
+            {
+                output = Json::Value(Json::StaticString("ISK"));
+                return;
+            }
+            if (input == Currency::CurrencyJEP)
+            {
+                output = Json::Value(Json::StaticString("JEP"));
+                return;
+            }
+            if (input == Currency::CurrencyJMD)
+            {
+                output = Json::Value(Json::StaticString("JMD"));
+                return;
+            }
+            if (input == Currency::CurrencyJOD)
+            {
+                output = Json::Value(Json::StaticString("JOD"));
+                return;
+            }
+            if (input == Currency::CurrencyJPY)
+            {
+                output = Json::Value(Json::StaticString("JPY"));
+                return;
+            }
+            if (input == Currency::CurrencyKES)
+            {
+                output = Json::Value(Json::StaticString("KES"));
+                return;
+            }
+            if (input == Currency::CurrencyKGS)
+            {
+                output = Json::Value(Json::StaticString("KGS"));
+                return;
+            }
+            if (input == Currency::CurrencyKHR)
+            {
+                output = Json::Value(Json::StaticString("KHR"));
+                return;
+            }
+            if (input == Currency::CurrencyKMF)
+            {
+                output = Json::Value(Json::StaticString("KMF"));
+                return;
+            }
+            if (input == Currency::CurrencyKPW)
+            {
+                output = Json::Value(Json::StaticString("KPW"));
+                return;
+            }
+            if (input == Currency::CurrencyKRW)
+            {
+                output = Json::Value(Json::StaticString("KRW"));
+                return;
+            }
+            if (input == Currency::CurrencyKWD)
+            {
+                output = Json::Value(Json::StaticString("KWD"));
+                return;
+            }
+            if (input == Currency::CurrencyKYD)
+            {
+                output = Json::Value(Json::StaticString("KYD"));
+                return;
+            }
+            if (input == Currency::CurrencyKZT)
+            {
+                output = Json::Value(Json::StaticString("KZT"));
+                return;
+            }
+            if (input == Currency::CurrencyLAK)
+            {
+                output = Json::Value(Json::StaticString("LAK"));
+                return;
+            }
+            if (input == Currency::CurrencyLBP)
+            {
+                output = Json::Value(Json::StaticString("LBP"));
+                return;
+            }
+            if (input == Currency::CurrencyLKR)
+            {
+                output = Json::Value(Json::StaticString("LKR"));
+                return;
+            }
+            if (input == Currency::CurrencyLRD)
+            {
+                output = Json::Value(Json::StaticString("LRD"));
+                return;
+            }
+            if (input == Currency::CurrencyLSL)
+            {
+                output = Json::Value(Json::StaticString("LSL"));
+                return;
+            }
+            if (input == Currency::CurrencyLYD)
+            {
+                output = Json::Value(Json::StaticString("LYD"));
+                return;
+            }
+            if (input == Currency::CurrencyMAD)
+            {
+                output = Json::Value(Json::StaticString("MAD"));
+                return;
+            }
+            if (input == Currency::CurrencyMDL)
+            {
+                output = Json::Value(Json::StaticString("MDL"));
+                return;
+            }
+            if (input == Currency::CurrencyMGA)
+            {
+                output = Json::Value(Json::StaticString("MGA"));
+                return;
+            }
+            if (input == Currency::CurrencyMKD)
+            {
+                output = Json::Value(Json::StaticString("MKD"));
+                return;
+            }
+            if (input == Currency::CurrencyMMK)
+            {
+                output = Json::Value(Json::StaticString("MMK"));
+                return;
+            }
+            if (input == Currency::CurrencyMNT)
+            {
+                output = Json::Value(Json::StaticString("MNT"));
+                return;
+            }
+            if (input == Currency::CurrencyMOP)
+            {
+                output = Json::Value(Json::StaticString("MOP"));
+                return;
+            }
+            if (input == Currency::CurrencyMRO)
+            {
+                output = Json::Value(Json::StaticString("MRO"));
+                return;
+            }
+            if (input == Currency::CurrencyMUR)
+            {
+                output = Json::Value(Json::StaticString("MUR"));
+                return;
+            }
+            if (input == Currency::CurrencyMVR)
+            {
+                output = Json::Value(Json::StaticString("MVR"));
+                return;
+            }
+            if (input == Currency::CurrencyMWK)
+            {
+                output = Json::Value(Json::StaticString("MWK"));
+                return;
+            }
+            if (input == Currency::CurrencyMXN)
+            {
+                output = Json::Value(Json::StaticString("MXN"));
+                return;
+            }
+            if (input == Currency::CurrencyMYR)
+            {
+                output = Json::Value(Json::StaticString("MYR"));
+                return;
+            }
+            if (input == Currency::CurrencyMZN)
+            {
+                output = Json::Value(Json::StaticString("MZN"));
+                return;
+            }
+            if (input == Currency::CurrencyNAD)
+            {
+                output = Json::Value(Json::StaticString("NAD"));
+                return;
+            }
+            if (input == Currency::CurrencyNGN)
+            {
+                output = Json::Value(Json::StaticString("NGN"));
+                return;
+            }
+            if (input == Currency::CurrencyNIO)
+            {
+                output = Json::Value(Json::StaticString("NIO"));
+                return;
+            }
+            if (input == Currency::CurrencyNOK)
+            {
+                output = Json::Value(Json::StaticString("NOK"));
+                return;
+            }
+            if (input == Currency::CurrencyNPR)
+            {
+                output = Json::Value(Json::StaticString("NPR"));
+                return;
+            }
+            if (input == Currency::CurrencyNZD)
+            {
+                output = Json::Value(Json::StaticString("NZD"));
+                return;
+            }
+            if (input == Currency::CurrencyOMR)
+            {
+                output = Json::Value(Json::StaticString("OMR"));
+                return;
+            }
+            if (input == Currency::CurrencyPAB)
+            {
+                output = Json::Value(Json::StaticString("PAB"));
+                return;
+            }
+            if (input == Currency::CurrencyPEN)
+            {
+                output = Json::Value(Json::StaticString("PEN"));
+                return;
+            }
+            if (input == Currency::CurrencyPGK)
+            {
+                output = Json::Value(Json::StaticString("PGK"));
+                return;
+            }
+            if (input == Currency::CurrencyPHP)
+            {
+                output = Json::Value(Json::StaticString("PHP"));
+                return;
+            }
+            if (input == Currency::CurrencyPKR)
+            {
+                output = Json::Value(Json::StaticString("PKR"));
+                return;
+            }
+            if (input == Currency::CurrencyPLN)
+            {
+                output = Json::Value(Json::StaticString("PLN"));
+                return;
+            }
+            if (input == Currency::CurrencyPYG)
+            {
+                output = Json::Value(Json::StaticString("PYG"));
+                return;
+            }
+            if (input == Currency::CurrencyQAR)
+            {
+                output = Json::Value(Json::StaticString("QAR"));
+                return;
+            }
+            if (input == Currency::CurrencyRON)
+            {
+                output = Json::Value(Json::StaticString("RON"));
+                return;
+            }
+            if (input == Currency::CurrencyRSD)
+            {
+                output = Json::Value(Json::StaticString("RSD"));
+                return;
+            }
+            if (input == Currency::CurrencyRUB)
+            {
+                output = Json::Value(Json::StaticString("RUB"));
+                return;
+            }
+            if (input == Currency::CurrencyRWF)
+            {
+                output = Json::Value(Json::StaticString("RWF"));
+                return;
+            }
+            if (input == Currency::CurrencySAR)
+            {
+                output = Json::Value(Json::StaticString("SAR"));
+                return;
+            }
+            if (input == Currency::CurrencySBD)
+            {
+                output = Json::Value(Json::StaticString("SBD"));
+                return;
+            }
+            if (input == Currency::CurrencySCR)
+            {
+                output = Json::Value(Json::StaticString("SCR"));
+                return;
+            }
+            if (input == Currency::CurrencySDG)
+            {
+                output = Json::Value(Json::StaticString("SDG"));
+                return;
+            }
+            if (input == Currency::CurrencySEK)
+            {
+                output = Json::Value(Json::StaticString("SEK"));
+                return;
+            }
+            if (input == Currency::CurrencySGD)
+            {
+                output = Json::Value(Json::StaticString("SGD"));
+                return;
+            }
+            if (input == Currency::CurrencySHP)
+            {
+                output = Json::Value(Json::StaticString("SHP"));
+                return;
+            }
+            if (input == Currency::CurrencySLL)
+            {
+                output = Json::Value(Json::StaticString("SLL"));
+                return;
+            }
+            if (input == Currency::CurrencySOS)
+            {
+                output = Json::Value(Json::StaticString("SOS"));
+                return;
+            }
+            if (input == Currency::CurrencySPL)
+            {
+                output = Json::Value(Json::StaticString("SPL"));
+                return;
+            }
+            if (input == Currency::CurrencySRD)
+            {
+                output = Json::Value(Json::StaticString("SRD"));
+                return;
+            }
+            if (input == Currency::CurrencySTD)
+            {
+                output = Json::Value(Json::StaticString("STD"));
+                return;
+            }
+            if (input == Currency::CurrencySVC)
+            {
+                output = Json::Value(Json::StaticString("SVC"));
+                return;
+            }
+            if (input == Currency::CurrencySYP)
+            {
+                output = Json::Value(Json::StaticString("SYP"));
+                return;
+            }
+            if (input == Currency::CurrencySZL)
+            {
+                output = Json::Value(Json::StaticString("SZL"));
+                return;
+            }
+            if (input == Currency::CurrencyTHB)
+            {
+                output = Json::Value(Json::StaticString("THB"));
+                return;
+            }
+            if (input == Currency::CurrencyTJS)
+            {
+                output = Json::Value(Json::StaticString("TJS"));
+                return;
+            }
+            if (input == Currency::CurrencyTMT)
+            {
+                output = Json::Value(Json::StaticString("TMT"));
+                return;
+            }
+            if (input == Currency::CurrencyTND)
+            {
+                output = Json::Value(Json::StaticString("TND"));
+                return;
+            }
+            if (input == Currency::CurrencyTOP)
+            {
+                output = Json::Value(Json::StaticString("TOP"));
+                return;
+            }
+            if (input == Currency::CurrencyTRY)
+            {
+                output = Json::Value(Json::StaticString("TRY"));
+                return;
+            }
+            if (input == Currency::CurrencyTTD)
+            {
+                output = Json::Value(Json::StaticString("TTD"));
+                return;
+            }
+            if (input == Currency::CurrencyTVD)
+            {
+                output = Json::Value(Json::StaticString("TVD"));
+                return;
+            }
+            if (input == Currency::CurrencyTWD)
+            {
+                output = Json::Value(Json::StaticString("TWD"));
+                return;
+            }
+            if (input == Currency::CurrencyTZS)
+            {
+                output = Json::Value(Json::StaticString("TZS"));
+                return;
+            }
+            if (input == Currency::CurrencyUAH)
+            {
+                output = Json::Value(Json::StaticString("UAH"));
+                return;
+            }
+            if (input == Currency::CurrencyUGX)
+            {
+                output = Json::Value(Json::StaticString("UGX"));
+                return;
+            }
+            if (input == Currency::CurrencyUSD)
+            {
+                output = Json::Value(Json::StaticString("USD"));
+                return;
+            }
+            if (input == Currency::CurrencyUYU)
+            {
+                output = Json::Value(Json::StaticString("UYU"));
+                return;
+            }
+            if (input == Currency::CurrencyUZS)
+            {
+                output = Json::Value(Json::StaticString("UZS"));
+                return;
+            }
+            if (input == Currency::CurrencyVEF)
+            {
+                output = Json::Value(Json::StaticString("VEF"));
+                return;
+            }
+            if (input == Currency::CurrencyVND)
+            {
+                output = Json::Value(Json::StaticString("VND"));
+                return;
+            }
+            if (input == Currency::CurrencyVUV)
+            {
+                output = Json::Value(Json::StaticString("VUV"));
+                return;
+            }
+            if (input == Currency::CurrencyWST)
+            {
+                output = Json::Value(Json::StaticString("WST"));
+                return;
+            }
+            if (input == Currency::CurrencyXAF)
+            {
+                output = Json::Value(Json::StaticString("XAF"));
+                return;
+            }
+            if (input == Currency::CurrencyXCD)
+            {
+                output = Json::Value(Json::StaticString("XCD"));
+                return;
+            }
+            if (input == Currency::CurrencyXDR)
+            {
+                output = Json::Value(Json::StaticString("XDR"));
+                return;
+            }
+            if (input == Currency::CurrencyXOF)
+            {
+                output = Json::Value(Json::StaticString("XOF"));
+                return;
+            }
+            if (input == Currency::CurrencyXPF)
+            {
+                output = Json::Value(Json::StaticString("XPF"));
+                return;
+            }
+            if (input == Currency::CurrencyYER)
+            {
+                output = Json::Value(Json::StaticString("YER"));
+                return;
+            }
+            if (input == Currency::CurrencyZAR)
+            {
+                output = Json::Value(Json::StaticString("ZAR"));
+                return;
+            }
+            if (input == Currency::CurrencyZMW)
+            {
+                output = Json::Value(Json::StaticString("ZMW"));
+                return;
+            }
+            if (input == Currency::CurrencyZWD)
+            {
+                output = Json::Value(Json::StaticString("ZWD"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, Currency& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "AED")
+            {
+                output = Currency::CurrencyAED;
+                return;
+            }
+            if (inputStr == "AFN")
+            {
+                output = Currency::CurrencyAFN;
+                return;
+            }
+            if (inputStr == "ALL")
+            {
+                output = Currency::CurrencyALL;
+                return;
+            }
+            if (inputStr == "AMD")
+            {
+                output = Currency::CurrencyAMD;
+                return;
+            }
+            if (inputStr == "ANG")
+            {
+                output = Currency::CurrencyANG;
+                return;
+            }
+            if (inputStr == "AOA")
+            {
+                output = Currency::CurrencyAOA;
+                return;
+            }
+            if (inputStr == "ARS")
+            {
+                output = Currency::CurrencyARS;
+                return;
+            }
+            if (inputStr == "AUD")
+            {
+                output = Currency::CurrencyAUD;
+                return;
+            }
+            if (inputStr == "AWG")
+            {
+                output = Currency::CurrencyAWG;
+                return;
+            }
+            if (inputStr == "AZN")
+            {
+                output = Currency::CurrencyAZN;
+                return;
+            }
+            if (inputStr == "BAM")
+            {
+                output = Currency::CurrencyBAM;
+                return;
+            }
+            if (inputStr == "BBD")
+            {
+                output = Currency::CurrencyBBD;
+                return;
+            }
+            if (inputStr == "BDT")
+            {
+                output = Currency::CurrencyBDT;
+                return;
+            }
+            if (inputStr == "BGN")
+            {
+                output = Currency::CurrencyBGN;
+                return;
+            }
+            if (inputStr == "BHD")
+            {
+                output = Currency::CurrencyBHD;
+                return;
+            }
+            if (inputStr == "BIF")
+            {
+                output = Currency::CurrencyBIF;
+                return;
+            }
+            if (inputStr == "BMD")
+            {
+                output = Currency::CurrencyBMD;
+                return;
+            }
+            if (inputStr == "BND")
+            {
+                output = Currency::CurrencyBND;
+                return;
+            }
+            if (inputStr == "BOB")
+            {
+                output = Currency::CurrencyBOB;
+                return;
+            }
+            if (inputStr == "BRL")
+            {
+                output = Currency::CurrencyBRL;
+                return;
+            }
+            if (inputStr == "BSD")
+            {
+                output = Currency::CurrencyBSD;
+                return;
+            }
+            if (inputStr == "BTN")
+            {
+                output = Currency::CurrencyBTN;
+                return;
+            }
+            if (inputStr == "BWP")
+            {
+                output = Currency::CurrencyBWP;
+                return;
+            }
+            if (inputStr == "BYR")
+            {
+                output = Currency::CurrencyBYR;
+                return;
+            }
+            if (inputStr == "BZD")
+            {
+                output = Currency::CurrencyBZD;
+                return;
+            }
+            if (inputStr == "CAD")
+            {
+                output = Currency::CurrencyCAD;
+                return;
+            }
+            if (inputStr == "CDF")
+            {
+                output = Currency::CurrencyCDF;
+                return;
+            }
+            if (inputStr == "CHF")
+            {
+                output = Currency::CurrencyCHF;
+                return;
+            }
+            if (inputStr == "CLP")
+            {
+                output = Currency::CurrencyCLP;
+                return;
+            }
+            if (inputStr == "CNY")
+            {
+                output = Currency::CurrencyCNY;
+                return;
+            }
+            if (inputStr == "COP")
+            {
+                output = Currency::CurrencyCOP;
+                return;
+            }
+            if (inputStr == "CRC")
+            {
+                output = Currency::CurrencyCRC;
+                return;
+            }
+            if (inputStr == "CUC")
+            {
+                output = Currency::CurrencyCUC;
+                return;
+            }
+            if (inputStr == "CUP")
+            {
+                output = Currency::CurrencyCUP;
+                return;
+            }
+            if (inputStr == "CVE")
+            {
+                output = Currency::CurrencyCVE;
+                return;
+            }
+            if (inputStr == "CZK")
+            {
+                output = Currency::CurrencyCZK;
+                return;
+            }
+            if (inputStr == "DJF")
+            {
+                output = Currency::CurrencyDJF;
+                return;
+            }
+            if (inputStr == "DKK")
+            {
+                output = Currency::CurrencyDKK;
+                return;
+            }
+            if (inputStr == "DOP")
+            {
+                output = Currency::CurrencyDOP;
+                return;
+            }
+            if (inputStr == "DZD")
+            {
+                output = Currency::CurrencyDZD;
+                return;
+            }
+            if (inputStr == "EGP")
+            {
+                output = Currency::CurrencyEGP;
+                return;
+            }
+            if (inputStr == "ERN")
+            {
+                output = Currency::CurrencyERN;
+                return;
+            }
+            if (inputStr == "ETB")
+            {
+                output = Currency::CurrencyETB;
+                return;
+            }
+            if (inputStr == "EUR")
+            {
+                output = Currency::CurrencyEUR;
+                return;
+            }
+            if (inputStr == "FJD")
+            {
+                output = Currency::CurrencyFJD;
+                return;
+            }
+            if (inputStr == "FKP")
+            {
+                output = Currency::CurrencyFKP;
+                return;
+            }
+            if (inputStr == "GBP")
+            {
+                output = Currency::CurrencyGBP;
+                return;
+            }
+            if (inputStr == "GEL")
+            {
+                output = Currency::CurrencyGEL;
+                return;
+            }
+            if (inputStr == "GGP")
+            {
+                output = Currency::CurrencyGGP;
+                return;
+            }
+            if (inputStr == "GHS")
+            {
+                output = Currency::CurrencyGHS;
+                return;
+            }
+            if (inputStr == "GIP")
+            {
+                output = Currency::CurrencyGIP;
+                return;
+            }
+            if (inputStr == "GMD")
+            {
+                output = Currency::CurrencyGMD;
+                return;
+            }
+            if (inputStr == "GNF")
+            {
+                output = Currency::CurrencyGNF;
+                return;
+            }
+            if (inputStr == "GTQ")
+            {
+                output = Currency::CurrencyGTQ;
+                return;
+            }
+            if (inputStr == "GYD")
+            {
+                output = Currency::CurrencyGYD;
+                return;
+            }
+            if (inputStr == "HKD")
+            {
+                output = Currency::CurrencyHKD;
+                return;
+            }
+            if (inputStr == "HNL")
+            {
+                output = Currency::CurrencyHNL;
+                return;
+            }
+            if (inputStr == "HRK")
+            {
+                output = Currency::CurrencyHRK;
+                return;
+            }
+            if (inputStr == "HTG")
+            {
+                output = Currency::CurrencyHTG;
+                return;
+            }
+            if (inputStr == "HUF")
+            {
+                output = Currency::CurrencyHUF;
+                return;
+            }
+            if (inputStr == "IDR")
+            {
+                output = Currency::CurrencyIDR;
+                return;
+            }
+            if (inputStr == "ILS")
+            {
+                output = Currency::CurrencyILS;
+                return;
+            }
+            if (inputStr == "IMP")
+            {
+                output = Currency::CurrencyIMP;
+                return;
+            }
+            if (inputStr == "INR")
+            {
+                output = Currency::CurrencyINR;
+                return;
+            }
+            if (inputStr == "IQD")
+            {
+                output = Currency::CurrencyIQD;
+                return;
+            }
+            if (inputStr == "IRR")
+            {
+                output = Currency::CurrencyIRR;
+                return;
+            }
+            if (inputStr == "ISK")
+            {
+                output = Currency::CurrencyISK;
+                return;
+            }
+            if (inputStr == "JEP")
+            {
+                output = Currency::CurrencyJEP;
+                return;
+            }
+            if (inputStr == "JMD")
+            {
+                output = Currency::CurrencyJMD;
+                return;
+            }
+            if (inputStr == "JOD")
+            {
+                output = Currency::CurrencyJOD;
+                return;
+            }
+            if (inputStr == "JPY")
+            {
+                output = Currency::CurrencyJPY;
+                return;
+            }
+            if (inputStr == "KES")
+            {
+                output = Currency::CurrencyKES;
+                return;
+            }
+            if (inputStr == "KGS")
+            {
+                output = Currency::CurrencyKGS;
+                return;
+            }
+            if (inputStr == "KHR")
+            {
+                output = Currency::CurrencyKHR;
+                return;
+            }
+            if (inputStr == "KMF")
+            {
+                output = Currency::CurrencyKMF;
+                return;
+            }
+            if (inputStr == "KPW")
+            {
+                output = Currency::CurrencyKPW;
+                return;
+            }
+            if (inputStr == "KRW")
+            {
+                output = Currency::CurrencyKRW;
+                return;
+            }
+            if (inputStr == "KWD")
+            {
+                output = Currency::CurrencyKWD;
+                return;
+            }
+            if (inputStr == "KYD")
+            {
+                output = Currency::CurrencyKYD;
+                return;
+            }
+            if (inputStr == "KZT")
+            {
+                output = Currency::CurrencyKZT;
+                return;
+            }
+            if (inputStr == "LAK")
+            {
+                output = Currency::CurrencyLAK;
+                return;
+            }
+            if (inputStr == "LBP")
+            {
+                output = Currency::CurrencyLBP;
+                return;
+            }
+            if (inputStr == "LKR")
+            {
+                output = Currency::CurrencyLKR;
+                return;
+            }
+            if (inputStr == "LRD")
+            {
+                output = Currency::CurrencyLRD;
+                return;
+            }
+            if (inputStr == "LSL")
+            {
+                output = Currency::CurrencyLSL;
+                return;
+            }
+            if (inputStr == "LYD")
+            {
+                output = Currency::CurrencyLYD;
+                return;
+            }
+            if (inputStr == "MAD")
+            {
+                output = Currency::CurrencyMAD;
+                return;
+            }
+            if (inputStr == "MDL")
+            {
+                output = Currency::CurrencyMDL;
+                return;
+            }
+            if (inputStr == "MGA")
+            {
+                output = Currency::CurrencyMGA;
+                return;
+            }
+            if (inputStr == "MKD")
+            {
+                output = Currency::CurrencyMKD;
+                return;
+            }
+            if (inputStr == "MMK")
+            {
+                output = Currency::CurrencyMMK;
+                return;
+            }
+            if (inputStr == "MNT")
+            {
+                output = Currency::CurrencyMNT;
+                return;
+            }
+            if (inputStr == "MOP")
+            {
+                output = Currency::CurrencyMOP;
+                return;
+            }
+            if (inputStr == "MRO")
+            {
+                output = Currency::CurrencyMRO;
+                return;
+            }
+            if (inputStr == "MUR")
+            {
+                output = Currency::CurrencyMUR;
+                return;
+            }
+            if (inputStr == "MVR")
+            {
+                output = Currency::CurrencyMVR;
+                return;
+            }
+            if (inputStr == "MWK")
+            {
+                output = Currency::CurrencyMWK;
+                return;
+            }
+            if (inputStr == "MXN")
+            {
+                output = Currency::CurrencyMXN;
+                return;
+            }
+            if (inputStr == "MYR")
+            {
+                output = Currency::CurrencyMYR;
+                return;
+            }
+            if (inputStr == "MZN")
+            {
+                output = Currency::CurrencyMZN;
+                return;
+            }
+            if (inputStr == "NAD")
+            {
+                output = Currency::CurrencyNAD;
+                return;
+            }
+            if (inputStr == "NGN")
+            {
+                output = Currency::CurrencyNGN;
+                return;
+            }
+            if (inputStr == "NIO")
+            {
+                output = Currency::CurrencyNIO;
+                return;
+            }
+            if (inputStr == "NOK")
+            {
+                output = Currency::CurrencyNOK;
+                return;
+            }
+            if (inputStr == "NPR")
+            {
+                output = Currency::CurrencyNPR;
+                return;
+            }
+            if (inputStr == "NZD")
+            {
+                output = Currency::CurrencyNZD;
+                return;
+            }
+            if (inputStr == "OMR")
+            {
+                output = Currency::CurrencyOMR;
+                return;
+            }
+            if (inputStr == "PAB")
+            {
+                output = Currency::CurrencyPAB;
+                return;
+            }
+            if (inputStr == "PEN")
+            {
+                output = Currency::CurrencyPEN;
+                return;
+            }
+            if (inputStr == "PGK")
+            {
+                output = Currency::CurrencyPGK;
+                return;
+            }
+            if (inputStr == "PHP")
+            {
+                output = Currency::CurrencyPHP;
+                return;
+            }
+            if (inputStr == "PKR")
+            {
+                output = Currency::CurrencyPKR;
+                return;
+            }
+            if (inputStr == "PLN")
+            {
+                output = Currency::CurrencyPLN;
+                return;
+            }
+            if (inputStr == "PYG")
+            {
+                output = Currency::CurrencyPYG;
+                return;
+            }
+            if (inputStr == "QAR")
+            {
+                output = Currency::CurrencyQAR;
+                return;
+            }
+            if (inputStr == "RON")
+            {
+                output = Currency::CurrencyRON;
+                return;
+            }
+            if (inputStr == "RSD")
+            {
+                output = Currency::CurrencyRSD;
+                return;
+            }
+            if (inputStr == "RUB")
+            {
+                output = Currency::CurrencyRUB;
+                return;
+            }
+            if (inputStr == "RWF")
+            {
+                output = Currency::CurrencyRWF;
+                return;
+            }
+            if (inputStr == "SAR")
+            {
+                output = Currency::CurrencySAR;
+                return;
+            }
+            if (inputStr == "SBD")
+            {
+                output = Currency::CurrencySBD;
+                return;
+            }
+            if (inputStr == "SCR")
+            {
+                output = Currency::CurrencySCR;
+                return;
+            }
+            if (inputStr == "SDG")
+            {
+                output = Currency::CurrencySDG;
+                return;
+            }
+            if (inputStr == "SEK")
+            {
+                output = Currency::CurrencySEK;
+                return;
+            }
+            if (inputStr == "SGD")
+            {
+                output = Currency::CurrencySGD;
+                return;
+            }
+            if (inputStr == "SHP")
+            {
+                output = Currency::CurrencySHP;
+                return;
+            }
+            if (inputStr == "SLL")
+            {
+                output = Currency::CurrencySLL;
+                return;
+            }
+            if (inputStr == "SOS")
+            {
+                output = Currency::CurrencySOS;
+                return;
+            }
+            if (inputStr == "SPL")
+            {
+                output = Currency::CurrencySPL;
+                return;
+            }
+            if (inputStr == "SRD")
+            {
+                output = Currency::CurrencySRD;
+                return;
+            }
+            if (inputStr == "STD")
+            {
+                output = Currency::CurrencySTD;
+                return;
+            }
+            if (inputStr == "SVC")
+            {
+                output = Currency::CurrencySVC;
+                return;
+            }
+            if (inputStr == "SYP")
+            {
+                output = Currency::CurrencySYP;
+                return;
+            }
+            if (inputStr == "SZL")
+            {
+                output = Currency::CurrencySZL;
+                return;
+            }
+            if (inputStr == "THB")
+            {
+                output = Currency::CurrencyTHB;
+                return;
+            }
+            if (inputStr == "TJS")
+            {
+                output = Currency::CurrencyTJS;
+                return;
+            }
+            if (inputStr == "TMT")
+            {
+                output = Currency::CurrencyTMT;
+                return;
+            }
+            if (inputStr == "TND")
+            {
+                output = Currency::CurrencyTND;
+                return;
+            }
+            if (inputStr == "TOP")
+            {
+                output = Currency::CurrencyTOP;
+                return;
+            }
+            if (inputStr == "TRY")
+            {
+                output = Currency::CurrencyTRY;
+                return;
+            }
+            if (inputStr == "TTD")
+            {
+                output = Currency::CurrencyTTD;
+                return;
+            }
+            if (inputStr == "TVD")
+            {
+                output = Currency::CurrencyTVD;
+                return;
+            }
+            if (inputStr == "TWD")
+            {
+                output = Currency::CurrencyTWD;
+                return;
+            }
+            if (inputStr == "TZS")
+            {
+                output = Currency::CurrencyTZS;
+                return;
+            }
+            if (inputStr == "UAH")
+            {
+                output = Currency::CurrencyUAH;
+                return;
+            }
+            if (inputStr == "UGX")
+            {
+                output = Currency::CurrencyUGX;
+                return;
+            }
+            if (inputStr == "USD")
+            {
+                output = Currency::CurrencyUSD;
+                return;
+            }
+            if (inputStr == "UYU")
+            {
+                output = Currency::CurrencyUYU;
+                return;
+            }
+            if (inputStr == "UZS")
+            {
+                output = Currency::CurrencyUZS;
+                return;
+            }
+            if (inputStr == "VEF")
+            {
+                output = Currency::CurrencyVEF;
+                return;
+            }
+            if (inputStr == "VND")
+            {
+                output = Currency::CurrencyVND;
+                return;
+            }
+            if (inputStr == "VUV")
+            {
+                output = Currency::CurrencyVUV;
+                return;
+            }
+            if (inputStr == "WST")
+            {
+                output = Currency::CurrencyWST;
+                return;
+            }
+            if (inputStr == "XAF")
+            {
+                output = Currency::CurrencyXAF;
+                return;
+            }
+            if (inputStr == "XCD")
+            {
+                output = Currency::CurrencyXCD;
+                return;
+            }
+            if (inputStr == "XDR")
+            {
+                output = Currency::CurrencyXDR;
+                return;
+            }
+            if (inputStr == "XOF")
+            {
+                output = Currency::CurrencyXOF;
+                return;
+            }
+            if (inputStr == "XPF")
+            {
+                output = Currency::CurrencyXPF;
+                return;
+            }
+            if (inputStr == "YER")
+            {
+                output = Currency::CurrencyYER;
+                return;
+            }
+            if (inputStr == "ZAR")
+            {
+                output = Currency::CurrencyZAR;
+                return;
+            }
+            if (inputStr == "ZMW")
+            {
+                output = Currency::CurrencyZMW;
+                return;
+            }
+            if (inputStr == "ZWD")
+            {
+                output = Currency::CurrencyZWD;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const EmailVerificationStatus input, Json::Value& output)
+        {
+            if (input == EmailVerificationStatus::EmailVerificationStatusUnverified)
+            {
+                output = Json::Value(Json::StaticString("Unverified"));
+                return;
+            }
+            if (input == EmailVerificationStatus::EmailVerificationStatusPending)
+            {
+                output = Json::Value(Json::StaticString("Pending"));
+                return;
+            }
+            if (input == EmailVerificationStatus::EmailVerificationStatusConfirmed)
+            {
+                output = Json::Value(Json::StaticString("Confirmed"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, EmailVerificationStatus& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Unverified")
+            {
+                output = EmailVerificationStatus::EmailVerificationStatusUnverified;
+                return;
+            }
+            if (inputStr == "Pending")
+            {
+                output = EmailVerificationStatus::EmailVerificationStatusPending;
+                return;
+            }
+            if (inputStr == "Confirmed")
+            {
+                output = EmailVerificationStatus::EmailVerificationStatusConfirmed;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const GameInstanceState input, Json::Value& output)
+        {
+            if (input == GameInstanceState::GameInstanceStateOpen)
+            {
+                output = Json::Value(Json::StaticString("Open"));
+                return;
+            }
+            if (input == GameInstanceState::GameInstanceStateClosed)
+            {
+                output = Json::Value(Json::StaticString("Closed"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, GameInstanceState& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Open")
+            {
+                output = GameInstanceState::GameInstanceStateOpen;
+                return;
+            }
+            if (inputStr == "Closed")
+            {
+                output = GameInstanceState::GameInstanceStateClosed;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const GenericErrorCodes input, Json::Value& output)
+        {
+            if (input == GenericErrorCodes::GenericErrorCodesSuccess)
+            {
+                output = Json::Value(Json::StaticString("Success"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesUnkownError)
+            {
+                output = Json::Value(Json::StaticString("UnkownError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidParams)
+            {
+                output = Json::Value(Json::StaticString("InvalidParams"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAccountNotFound)
+            {
+                output = Json::Value(Json::StaticString("AccountNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAccountBanned)
+            {
+                output = Json::Value(Json::StaticString("AccountBanned"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidUsernameOrPassword)
+            {
+                output = Json::Value(Json::StaticString("InvalidUsernameOrPassword"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidTitleId)
+            {
+                output = Json::Value(Json::StaticString("InvalidTitleId"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidEmailAddress)
+            {
+                output = Json::Value(Json::StaticString("InvalidEmailAddress"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEmailAddressNotAvailable)
+            {
+                output = Json::Value(Json::StaticString("EmailAddressNotAvailable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidUsername)
+            {
+                output = Json::Value(Json::StaticString("InvalidUsername"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidPassword)
+            {
+                output = Json::Value(Json::StaticString("InvalidPassword"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesUsernameNotAvailable)
+            {
+                output = Json::Value(Json::StaticString("UsernameNotAvailable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidSteamTicket)
+            {
+                output = Json::Value(Json::StaticString("InvalidSteamTicket"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAccountAlreadyLinked)
+            {
+                output = Json::Value(Json::StaticString("AccountAlreadyLinked"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesLinkedAccountAlreadyClaimed)
+            {
+                output = Json::Value(Json::StaticString("LinkedAccountAlreadyClaimed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidFacebookToken)
+            {
+                output = Json::Value(Json::StaticString("InvalidFacebookToken"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAccountNotLinked)
+            {
+                output = Json::Value(Json::StaticString("AccountNotLinked"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesFailedByPaymentProvider)
+            {
+                output = Json::Value(Json::StaticString("FailedByPaymentProvider"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCouponCodeNotFound)
+            {
+                output = Json::Value(Json::StaticString("CouponCodeNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidContainerItem)
+            {
+                output = Json::Value(Json::StaticString("InvalidContainerItem"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesContainerNotOwned)
+            {
+                output = Json::Value(Json::StaticString("ContainerNotOwned"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesKeyNotOwned)
+            {
+                output = Json::Value(Json::StaticString("KeyNotOwned"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidItemIdInTable)
+            {
+                output = Json::Value(Json::StaticString("InvalidItemIdInTable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidReceipt)
+            {
+                output = Json::Value(Json::StaticString("InvalidReceipt"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesReceiptAlreadyUsed)
+            {
+                output = Json::Value(Json::StaticString("ReceiptAlreadyUsed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesReceiptCancelled)
+            {
+                output = Json::Value(Json::StaticString("ReceiptCancelled"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGameNotFound)
+            {
+                output = Json::Value(Json::StaticString("GameNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGameModeNotFound)
+            {
+                output = Json::Value(Json::StaticString("GameModeNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidGoogleToken)
+            {
+                output = Json::Value(Json::StaticString("InvalidGoogleToken"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesUserIsNotPartOfDeveloper)
+            {
+                output = Json::Value(Json::StaticString("UserIsNotPartOfDeveloper"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidTitleForDeveloper)
+            {
+                output = Json::Value(Json::StaticString("InvalidTitleForDeveloper"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleNameConflicts)
+            {
+                output = Json::Value(Json::StaticString("TitleNameConflicts"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesUserisNotValid)
+            {
+                output = Json::Value(Json::StaticString("UserisNotValid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesValueAlreadyExists)
+            {
+                output = Json::Value(Json::StaticString("ValueAlreadyExists"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesBuildNotFound)
+            {
+                output = Json::Value(Json::StaticString("BuildNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPlayerNotInGame)
+            {
+                output = Json::Value(Json::StaticString("PlayerNotInGame"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidTicket)
+            {
+                output = Json::Value(Json::StaticString("InvalidTicket"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidDeveloper)
+            {
+                output = Json::Value(Json::StaticString("InvalidDeveloper"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidOrderInfo)
+            {
+                output = Json::Value(Json::StaticString("InvalidOrderInfo"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesRegistrationIncomplete)
+            {
+                output = Json::Value(Json::StaticString("RegistrationIncomplete"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidPlatform)
+            {
+                output = Json::Value(Json::StaticString("InvalidPlatform"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesUnknownError)
+            {
+                output = Json::Value(Json::StaticString("UnknownError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSteamApplicationNotOwned)
+            {
+                output = Json::Value(Json::StaticString("SteamApplicationNotOwned"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesWrongSteamAccount)
+            {
+                output = Json::Value(Json::StaticString("WrongSteamAccount"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleNotActivated)
+            {
+                output = Json::Value(Json::StaticString("TitleNotActivated"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesRegistrationSessionNotFound)
+            {
+                output = Json::Value(Json::StaticString("RegistrationSessionNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNoSuchMod)
+            {
+                output = Json::Value(Json::StaticString("NoSuchMod"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesFileNotFound)
+            {
+                output = Json::Value(Json::StaticString("FileNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDuplicateEmail)
+            {
+                output = Json::Value(Json::StaticString("DuplicateEmail"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesItemNotFound)
+            {
+                output = Json::Value(Json::StaticString("ItemNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesItemNotOwned)
+            {
+                output = Json::Value(Json::StaticString("ItemNotOwned"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesItemNotRecycleable)
+            {
+                output = Json::Value(Json::StaticString("ItemNotRecycleable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesItemNotAffordable)
+            {
+                output = Json::Value(Json::StaticString("ItemNotAffordable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidVirtualCurrency)
+            {
+                output = Json::Value(Json::StaticString("InvalidVirtualCurrency"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesWrongVirtualCurrency)
+            {
+                output = Json::Value(Json::StaticString("WrongVirtualCurrency"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesWrongPrice)
+            {
+                output = Json::Value(Json::StaticString("WrongPrice"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNonPositiveValue)
+            {
+                output = Json::Value(Json::StaticString("NonPositiveValue"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidRegion)
+            {
+                output = Json::Value(Json::StaticString("InvalidRegion"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesRegionAtCapacity)
+            {
+                output = Json::Value(Json::StaticString("RegionAtCapacity"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesServerFailedToStart)
+            {
+                output = Json::Value(Json::StaticString("ServerFailedToStart"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNameNotAvailable)
+            {
+                output = Json::Value(Json::StaticString("NameNotAvailable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInsufficientFunds)
+            {
+                output = Json::Value(Json::StaticString("InsufficientFunds"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidDeviceID)
+            {
+                output = Json::Value(Json::StaticString("InvalidDeviceID"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidPushNotificationToken)
+            {
+                output = Json::Value(Json::StaticString("InvalidPushNotificationToken"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNoRemainingUses)
+            {
+                output = Json::Value(Json::StaticString("NoRemainingUses"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidPaymentProvider)
+            {
+                output = Json::Value(Json::StaticString("InvalidPaymentProvider"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPurchaseInitializationFailure)
+            {
+                output = Json::Value(Json::StaticString("PurchaseInitializationFailure"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDuplicateUsername)
+            {
+                output = Json::Value(Json::StaticString("DuplicateUsername"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidBuyerInfo)
+            {
+                output = Json::Value(Json::StaticString("InvalidBuyerInfo"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNoGameModeParamsSet)
+            {
+                output = Json::Value(Json::StaticString("NoGameModeParamsSet"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesBodyTooLarge)
+            {
+                output = Json::Value(Json::StaticString("BodyTooLarge"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesReservedWordInBody)
+            {
+                output = Json::Value(Json::StaticString("ReservedWordInBody"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidTypeInBody)
+            {
+                output = Json::Value(Json::StaticString("InvalidTypeInBody"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidRequest)
+            {
+                output = Json::Value(Json::StaticString("InvalidRequest"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesReservedEventName)
+            {
+                output = Json::Value(Json::StaticString("ReservedEventName"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidUserStatistics)
+            {
+                output = Json::Value(Json::StaticString("InvalidUserStatistics"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNotAuthenticated)
+            {
+                output = Json::Value(Json::StaticString("NotAuthenticated"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStreamAlreadyExists)
+            {
+                output = Json::Value(Json::StaticString("StreamAlreadyExists"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesErrorCreatingStream)
+            {
+                output = Json::Value(Json::StaticString("ErrorCreatingStream"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStreamNotFound)
+            {
+                output = Json::Value(Json::StaticString("StreamNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidAccount)
+            {
+                output = Json::Value(Json::StaticString("InvalidAccount"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPurchaseDoesNotExist)
+            {
+                output = Json::Value(Json::StaticString("PurchaseDoesNotExist"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidPurchaseTransactionStatus)
+            {
+                output = Json::Value(Json::StaticString("InvalidPurchaseTransactionStatus"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAPINotEnabledForGameClientAccess)
+            {
+                output = Json::Value(Json::StaticString("APINotEnabledForGameClientAccess"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNoPushNotificationARNForTitle)
+            {
+                output = Json::Value(Json::StaticString("NoPushNotificationARNForTitle"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesBuildAlreadyExists)
+            {
+                output = Json::Value(Json::StaticString("BuildAlreadyExists"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesBuildPackageDoesNotExist)
+            {
+                output = Json::Value(Json::StaticString("BuildPackageDoesNotExist"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCustomAnalyticsEventsNotEnabledForTitle)
+            {
+                output = Json::Value(Json::StaticString("CustomAnalyticsEventsNotEnabledForTitle"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidSharedGroupId)
+            {
+                output = Json::Value(Json::StaticString("InvalidSharedGroupId"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNotAuthorized)
+            {
+                output = Json::Value(Json::StaticString("NotAuthorized"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMissingTitleGoogleProperties)
+            {
+                output = Json::Value(Json::StaticString("MissingTitleGoogleProperties"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidItemProperties)
+            {
+                output = Json::Value(Json::StaticString("InvalidItemProperties"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidPSNAuthCode)
+            {
+                output = Json::Value(Json::StaticString("InvalidPSNAuthCode"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidItemId)
+            {
+                output = Json::Value(Json::StaticString("InvalidItemId"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPushNotEnabledForAccount)
+            {
+                output = Json::Value(Json::StaticString("PushNotEnabledForAccount"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPushServiceError)
+            {
+                output = Json::Value(Json::StaticString("PushServiceError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesReceiptDoesNotContainInAppItems)
+            {
+                output = Json::Value(Json::StaticString("ReceiptDoesNotContainInAppItems"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesReceiptContainsMultipleInAppItems)
+            {
+                output = Json::Value(Json::StaticString("ReceiptContainsMultipleInAppItems"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidBundleID)
+            {
+                output = Json::Value(Json::StaticString("InvalidBundleID"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesJavascriptException)
+            {
+                output = Json::Value(Json::StaticString("JavascriptException"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidSessionTicket)
+            {
+                output = Json::Value(Json::StaticString("InvalidSessionTicket"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesUnableToConnectToDatabase)
+            {
+                output = Json::Value(Json::StaticString("UnableToConnectToDatabase"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInternalServerError)
+            {
+                output = Json::Value(Json::StaticString("InternalServerError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidReportDate)
+            {
+                output = Json::Value(Json::StaticString("InvalidReportDate"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesReportNotAvailable)
+            {
+                output = Json::Value(Json::StaticString("ReportNotAvailable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDatabaseThroughputExceeded)
+            {
+                output = Json::Value(Json::StaticString("DatabaseThroughputExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidGameTicket)
+            {
+                output = Json::Value(Json::StaticString("InvalidGameTicket"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExpiredGameTicket)
+            {
+                output = Json::Value(Json::StaticString("ExpiredGameTicket"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGameTicketDoesNotMatchLobby)
+            {
+                output = Json::Value(Json::StaticString("GameTicketDoesNotMatchLobby"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesLinkedDeviceAlreadyClaimed)
+            {
+                output = Json::Value(Json::StaticString("LinkedDeviceAlreadyClaimed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDeviceAlreadyLinked)
+            {
+                output = Json::Value(Json::StaticString("DeviceAlreadyLinked"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDeviceNotLinked)
+            {
+                output = Json::Value(Json::StaticString("DeviceNotLinked"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPartialFailure)
+            {
+                output = Json::Value(Json::StaticString("PartialFailure"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPublisherNotSet)
+            {
+                output = Json::Value(Json::StaticString("PublisherNotSet"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesServiceUnavailable)
+            {
+                output = Json::Value(Json::StaticString("ServiceUnavailable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesVersionNotFound)
+            {
+                output = Json::Value(Json::StaticString("VersionNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesRevisionNotFound)
+            {
+                output = Json::Value(Json::StaticString("RevisionNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidPublisherId)
+            {
+                output = Json::Value(Json::StaticString("InvalidPublisherId"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDownstreamServiceUnavailable)
+            {
+                output = Json::Value(Json::StaticString("DownstreamServiceUnavailable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAPINotIncludedInTitleUsageTier)
+            {
+                output = Json::Value(Json::StaticString("APINotIncludedInTitleUsageTier"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDAULimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("DAULimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAPIRequestLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("APIRequestLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidAPIEndpoint)
+            {
+                output = Json::Value(Json::StaticString("InvalidAPIEndpoint"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesBuildNotAvailable)
+            {
+                output = Json::Value(Json::StaticString("BuildNotAvailable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesConcurrentEditError)
+            {
+                output = Json::Value(Json::StaticString("ConcurrentEditError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesContentNotFound)
+            {
+                output = Json::Value(Json::StaticString("ContentNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCharacterNotFound)
+            {
+                output = Json::Value(Json::StaticString("CharacterNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCloudScriptNotFound)
+            {
+                output = Json::Value(Json::StaticString("CloudScriptNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesContentQuotaExceeded)
+            {
+                output = Json::Value(Json::StaticString("ContentQuotaExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidCharacterStatistics)
+            {
+                output = Json::Value(Json::StaticString("InvalidCharacterStatistics"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPhotonNotEnabledForTitle)
+            {
+                output = Json::Value(Json::StaticString("PhotonNotEnabledForTitle"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPhotonApplicationNotFound)
+            {
+                output = Json::Value(Json::StaticString("PhotonApplicationNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPhotonApplicationNotAssociatedWithTitle)
+            {
+                output = Json::Value(Json::StaticString("PhotonApplicationNotAssociatedWithTitle"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidEmailOrPassword)
+            {
+                output = Json::Value(Json::StaticString("InvalidEmailOrPassword"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesFacebookAPIError)
+            {
+                output = Json::Value(Json::StaticString("FacebookAPIError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidContentType)
+            {
+                output = Json::Value(Json::StaticString("InvalidContentType"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesKeyLengthExceeded)
+            {
+                output = Json::Value(Json::StaticString("KeyLengthExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDataLengthExceeded)
+            {
+                output = Json::Value(Json::StaticString("DataLengthExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTooManyKeys)
+            {
+                output = Json::Value(Json::StaticString("TooManyKeys"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesFreeTierCannotHaveVirtualCurrency)
+            {
+                output = Json::Value(Json::StaticString("FreeTierCannotHaveVirtualCurrency"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMissingAmazonSharedKey)
+            {
+                output = Json::Value(Json::StaticString("MissingAmazonSharedKey"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAmazonValidationError)
+            {
+                output = Json::Value(Json::StaticString("AmazonValidationError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidPSNIssuerId)
+            {
+                output = Json::Value(Json::StaticString("InvalidPSNIssuerId"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPSNInaccessible)
+            {
+                output = Json::Value(Json::StaticString("PSNInaccessible"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExpiredAuthToken)
+            {
+                output = Json::Value(Json::StaticString("ExpiredAuthToken"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesFailedToGetEntitlements)
+            {
+                output = Json::Value(Json::StaticString("FailedToGetEntitlements"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesFailedToConsumeEntitlement)
+            {
+                output = Json::Value(Json::StaticString("FailedToConsumeEntitlement"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeAcceptingUserNotAllowed)
+            {
+                output = Json::Value(Json::StaticString("TradeAcceptingUserNotAllowed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeInventoryItemIsAssignedToCharacter)
+            {
+                output = Json::Value(Json::StaticString("TradeInventoryItemIsAssignedToCharacter"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeInventoryItemIsBundle)
+            {
+                output = Json::Value(Json::StaticString("TradeInventoryItemIsBundle"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeStatusNotValidForCancelling)
+            {
+                output = Json::Value(Json::StaticString("TradeStatusNotValidForCancelling"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeStatusNotValidForAccepting)
+            {
+                output = Json::Value(Json::StaticString("TradeStatusNotValidForAccepting"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeDoesNotExist)
+            {
+                output = Json::Value(Json::StaticString("TradeDoesNotExist"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeCancelled)
+            {
+                output = Json::Value(Json::StaticString("TradeCancelled"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeAlreadyFilled)
+            {
+                output = Json::Value(Json::StaticString("TradeAlreadyFilled"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeWaitForStatusTimeout)
+            {
+                output = Json::Value(Json::StaticString("TradeWaitForStatusTimeout"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeInventoryItemExpired)
+            {
+                output = Json::Value(Json::StaticString("TradeInventoryItemExpired"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeMissingOfferedAndAcceptedItems)
+            {
+                output = Json::Value(Json::StaticString("TradeMissingOfferedAndAcceptedItems"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeAcceptedItemIsBundle)
+            {
+                output = Json::Value(Json::StaticString("TradeAcceptedItemIsBundle"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeAcceptedItemIsStackable)
+            {
+                output = Json::Value(Json::StaticString("TradeAcceptedItemIsStackable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeInventoryItemInvalidStatus)
+            {
+                output = Json::Value(Json::StaticString("TradeInventoryItemInvalidStatus"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeAcceptedCatalogItemInvalid)
+            {
+                output = Json::Value(Json::StaticString("TradeAcceptedCatalogItemInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeAllowedUsersInvalid)
+            {
+                output = Json::Value(Json::StaticString("TradeAllowedUsersInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeInventoryItemDoesNotExist)
+            {
+                output = Json::Value(Json::StaticString("TradeInventoryItemDoesNotExist"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeInventoryItemIsConsumed)
+            {
+                output = Json::Value(Json::StaticString("TradeInventoryItemIsConsumed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeInventoryItemIsStackable)
+            {
+                output = Json::Value(Json::StaticString("TradeInventoryItemIsStackable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeAcceptedItemsMismatch)
+            {
+                output = Json::Value(Json::StaticString("TradeAcceptedItemsMismatch"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidKongregateToken)
+            {
+                output = Json::Value(Json::StaticString("InvalidKongregateToken"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesFeatureNotConfiguredForTitle)
+            {
+                output = Json::Value(Json::StaticString("FeatureNotConfiguredForTitle"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNoMatchingCatalogItemForReceipt)
+            {
+                output = Json::Value(Json::StaticString("NoMatchingCatalogItemForReceipt"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidCurrencyCode)
+            {
+                output = Json::Value(Json::StaticString("InvalidCurrencyCode"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNoRealMoneyPriceForCatalogItem)
+            {
+                output = Json::Value(Json::StaticString("NoRealMoneyPriceForCatalogItem"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeInventoryItemIsNotTradable)
+            {
+                output = Json::Value(Json::StaticString("TradeInventoryItemIsNotTradable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTradeAcceptedCatalogItemIsNotTradable)
+            {
+                output = Json::Value(Json::StaticString("TradeAcceptedCatalogItemIsNotTradable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesUsersAlreadyFriends)
+            {
+                output = Json::Value(Json::StaticString("UsersAlreadyFriends"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesLinkedIdentifierAlreadyClaimed)
+            {
+                output = Json::Value(Json::StaticString("LinkedIdentifierAlreadyClaimed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCustomIdNotLinked)
+            {
+                output = Json::Value(Json::StaticString("CustomIdNotLinked"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTotalDataSizeExceeded)
+            {
+                output = Json::Value(Json::StaticString("TotalDataSizeExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDeleteKeyConflict)
+            {
+                output = Json::Value(Json::StaticString("DeleteKeyConflict"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidXboxLiveToken)
+            {
+                output = Json::Value(Json::StaticString("InvalidXboxLiveToken"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExpiredXboxLiveToken)
+            {
+                output = Json::Value(Json::StaticString("ExpiredXboxLiveToken"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesResettableStatisticVersionRequired)
+            {
+                output = Json::Value(Json::StaticString("ResettableStatisticVersionRequired"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNotAuthorizedByTitle)
+            {
+                output = Json::Value(Json::StaticString("NotAuthorizedByTitle"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNoPartnerEnabled)
+            {
+                output = Json::Value(Json::StaticString("NoPartnerEnabled"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidPartnerResponse)
+            {
+                output = Json::Value(Json::StaticString("InvalidPartnerResponse"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAPINotEnabledForGameServerAccess)
+            {
+                output = Json::Value(Json::StaticString("APINotEnabledForGameServerAccess"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStatisticNotFound)
+            {
+                output = Json::Value(Json::StaticString("StatisticNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStatisticNameConflict)
+            {
+                output = Json::Value(Json::StaticString("StatisticNameConflict"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStatisticVersionClosedForWrites)
+            {
+                output = Json::Value(Json::StaticString("StatisticVersionClosedForWrites"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStatisticVersionInvalid)
+            {
+                output = Json::Value(Json::StaticString("StatisticVersionInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAPIClientRequestRateLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("APIClientRequestRateLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidJSONContent)
+            {
+                output = Json::Value(Json::StaticString("InvalidJSONContent"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidDropTable)
+            {
+                output = Json::Value(Json::StaticString("InvalidDropTable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStatisticVersionAlreadyIncrementedForScheduledInterval)
+            {
+                output = Json::Value(Json::StaticString("StatisticVersionAlreadyIncrementedForScheduledInterval"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStatisticCountLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("StatisticCountLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStatisticVersionIncrementRateExceeded)
+            {
+                output = Json::Value(Json::StaticString("StatisticVersionIncrementRateExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesContainerKeyInvalid)
+            {
+                output = Json::Value(Json::StaticString("ContainerKeyInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCloudScriptExecutionTimeLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("CloudScriptExecutionTimeLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNoWritePermissionsForEvent)
+            {
+                output = Json::Value(Json::StaticString("NoWritePermissionsForEvent"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCloudScriptFunctionArgumentSizeExceeded)
+            {
+                output = Json::Value(Json::StaticString("CloudScriptFunctionArgumentSizeExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCloudScriptAPIRequestCountExceeded)
+            {
+                output = Json::Value(Json::StaticString("CloudScriptAPIRequestCountExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCloudScriptAPIRequestError)
+            {
+                output = Json::Value(Json::StaticString("CloudScriptAPIRequestError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCloudScriptHTTPRequestError)
+            {
+                output = Json::Value(Json::StaticString("CloudScriptHTTPRequestError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInsufficientGuildRole)
+            {
+                output = Json::Value(Json::StaticString("InsufficientGuildRole"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGuildNotFound)
+            {
+                output = Json::Value(Json::StaticString("GuildNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesOverLimit)
+            {
+                output = Json::Value(Json::StaticString("OverLimit"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEventNotFound)
+            {
+                output = Json::Value(Json::StaticString("EventNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidEventField)
+            {
+                output = Json::Value(Json::StaticString("InvalidEventField"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidEventName)
+            {
+                output = Json::Value(Json::StaticString("InvalidEventName"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCatalogNotConfigured)
+            {
+                output = Json::Value(Json::StaticString("CatalogNotConfigured"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesOperationNotSupportedForPlatform)
+            {
+                output = Json::Value(Json::StaticString("OperationNotSupportedForPlatform"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSegmentNotFound)
+            {
+                output = Json::Value(Json::StaticString("SegmentNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStoreNotFound)
+            {
+                output = Json::Value(Json::StaticString("StoreNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidStatisticName)
+            {
+                output = Json::Value(Json::StaticString("InvalidStatisticName"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleNotQualifiedForLimit)
+            {
+                output = Json::Value(Json::StaticString("TitleNotQualifiedForLimit"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidServiceLimitLevel)
+            {
+                output = Json::Value(Json::StaticString("InvalidServiceLimitLevel"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesServiceLimitLevelInTransition)
+            {
+                output = Json::Value(Json::StaticString("ServiceLimitLevelInTransition"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCouponAlreadyRedeemed)
+            {
+                output = Json::Value(Json::StaticString("CouponAlreadyRedeemed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGameServerBuildSizeLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("GameServerBuildSizeLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGameServerBuildCountLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("GameServerBuildCountLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesVirtualCurrencyCountLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("VirtualCurrencyCountLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesVirtualCurrencyCodeExists)
+            {
+                output = Json::Value(Json::StaticString("VirtualCurrencyCodeExists"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleNewsItemCountLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("TitleNewsItemCountLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidTwitchToken)
+            {
+                output = Json::Value(Json::StaticString("InvalidTwitchToken"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTwitchResponseError)
+            {
+                output = Json::Value(Json::StaticString("TwitchResponseError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesProfaneDisplayName)
+            {
+                output = Json::Value(Json::StaticString("ProfaneDisplayName"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesUserAlreadyAdded)
+            {
+                output = Json::Value(Json::StaticString("UserAlreadyAdded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidVirtualCurrencyCode)
+            {
+                output = Json::Value(Json::StaticString("InvalidVirtualCurrencyCode"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesVirtualCurrencyCannotBeDeleted)
+            {
+                output = Json::Value(Json::StaticString("VirtualCurrencyCannotBeDeleted"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesIdentifierAlreadyClaimed)
+            {
+                output = Json::Value(Json::StaticString("IdentifierAlreadyClaimed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesIdentifierNotLinked)
+            {
+                output = Json::Value(Json::StaticString("IdentifierNotLinked"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidContinuationToken)
+            {
+                output = Json::Value(Json::StaticString("InvalidContinuationToken"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExpiredContinuationToken)
+            {
+                output = Json::Value(Json::StaticString("ExpiredContinuationToken"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidSegment)
+            {
+                output = Json::Value(Json::StaticString("InvalidSegment"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidSessionId)
+            {
+                output = Json::Value(Json::StaticString("InvalidSessionId"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSessionLogNotFound)
+            {
+                output = Json::Value(Json::StaticString("SessionLogNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidSearchTerm)
+            {
+                output = Json::Value(Json::StaticString("InvalidSearchTerm"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTwoFactorAuthenticationTokenRequired)
+            {
+                output = Json::Value(Json::StaticString("TwoFactorAuthenticationTokenRequired"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGameServerHostCountLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("GameServerHostCountLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPlayerTagCountLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("PlayerTagCountLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesRequestAlreadyRunning)
+            {
+                output = Json::Value(Json::StaticString("RequestAlreadyRunning"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesActionGroupNotFound)
+            {
+                output = Json::Value(Json::StaticString("ActionGroupNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMaximumSegmentBulkActionJobsRunning)
+            {
+                output = Json::Value(Json::StaticString("MaximumSegmentBulkActionJobsRunning"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNoActionsOnPlayersInSegmentJob)
+            {
+                output = Json::Value(Json::StaticString("NoActionsOnPlayersInSegmentJob"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDuplicateStatisticName)
+            {
+                output = Json::Value(Json::StaticString("DuplicateStatisticName"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesScheduledTaskNameConflict)
+            {
+                output = Json::Value(Json::StaticString("ScheduledTaskNameConflict"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesScheduledTaskCreateConflict)
+            {
+                output = Json::Value(Json::StaticString("ScheduledTaskCreateConflict"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidScheduledTaskName)
+            {
+                output = Json::Value(Json::StaticString("InvalidScheduledTaskName"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidTaskSchedule)
+            {
+                output = Json::Value(Json::StaticString("InvalidTaskSchedule"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSteamNotEnabledForTitle)
+            {
+                output = Json::Value(Json::StaticString("SteamNotEnabledForTitle"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesLimitNotAnUpgradeOption)
+            {
+                output = Json::Value(Json::StaticString("LimitNotAnUpgradeOption"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNoSecretKeyEnabledForCloudScript)
+            {
+                output = Json::Value(Json::StaticString("NoSecretKeyEnabledForCloudScript"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTaskNotFound)
+            {
+                output = Json::Value(Json::StaticString("TaskNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTaskInstanceNotFound)
+            {
+                output = Json::Value(Json::StaticString("TaskInstanceNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidIdentityProviderId)
+            {
+                output = Json::Value(Json::StaticString("InvalidIdentityProviderId"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMisconfiguredIdentityProvider)
+            {
+                output = Json::Value(Json::StaticString("MisconfiguredIdentityProvider"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidScheduledTaskType)
+            {
+                output = Json::Value(Json::StaticString("InvalidScheduledTaskType"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesBillingInformationRequired)
+            {
+                output = Json::Value(Json::StaticString("BillingInformationRequired"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesLimitedEditionItemUnavailable)
+            {
+                output = Json::Value(Json::StaticString("LimitedEditionItemUnavailable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidAdPlacementAndReward)
+            {
+                output = Json::Value(Json::StaticString("InvalidAdPlacementAndReward"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAllAdPlacementViewsAlreadyConsumed)
+            {
+                output = Json::Value(Json::StaticString("AllAdPlacementViewsAlreadyConsumed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGoogleOAuthNotConfiguredForTitle)
+            {
+                output = Json::Value(Json::StaticString("GoogleOAuthNotConfiguredForTitle"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGoogleOAuthError)
+            {
+                output = Json::Value(Json::StaticString("GoogleOAuthError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesUserNotFriend)
+            {
+                output = Json::Value(Json::StaticString("UserNotFriend"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidSignature)
+            {
+                output = Json::Value(Json::StaticString("InvalidSignature"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidPublicKey)
+            {
+                output = Json::Value(Json::StaticString("InvalidPublicKey"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGoogleOAuthNoIdTokenIncludedInResponse)
+            {
+                output = Json::Value(Json::StaticString("GoogleOAuthNoIdTokenIncludedInResponse"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStatisticUpdateInProgress)
+            {
+                output = Json::Value(Json::StaticString("StatisticUpdateInProgress"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesLeaderboardVersionNotAvailable)
+            {
+                output = Json::Value(Json::StaticString("LeaderboardVersionNotAvailable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStatisticAlreadyHasPrizeTable)
+            {
+                output = Json::Value(Json::StaticString("StatisticAlreadyHasPrizeTable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPrizeTableHasOverlappingRanks)
+            {
+                output = Json::Value(Json::StaticString("PrizeTableHasOverlappingRanks"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPrizeTableHasMissingRanks)
+            {
+                output = Json::Value(Json::StaticString("PrizeTableHasMissingRanks"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPrizeTableRankStartsAtZero)
+            {
+                output = Json::Value(Json::StaticString("PrizeTableRankStartsAtZero"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidStatistic)
+            {
+                output = Json::Value(Json::StaticString("InvalidStatistic"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExpressionParseFailure)
+            {
+                output = Json::Value(Json::StaticString("ExpressionParseFailure"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExpressionInvokeFailure)
+            {
+                output = Json::Value(Json::StaticString("ExpressionInvokeFailure"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExpressionTooLong)
+            {
+                output = Json::Value(Json::StaticString("ExpressionTooLong"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDataUpdateRateExceeded)
+            {
+                output = Json::Value(Json::StaticString("DataUpdateRateExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesRestrictedEmailDomain)
+            {
+                output = Json::Value(Json::StaticString("RestrictedEmailDomain"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEncryptionKeyDisabled)
+            {
+                output = Json::Value(Json::StaticString("EncryptionKeyDisabled"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEncryptionKeyMissing)
+            {
+                output = Json::Value(Json::StaticString("EncryptionKeyMissing"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEncryptionKeyBroken)
+            {
+                output = Json::Value(Json::StaticString("EncryptionKeyBroken"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNoSharedSecretKeyConfigured)
+            {
+                output = Json::Value(Json::StaticString("NoSharedSecretKeyConfigured"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSecretKeyNotFound)
+            {
+                output = Json::Value(Json::StaticString("SecretKeyNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPlayerSecretAlreadyConfigured)
+            {
+                output = Json::Value(Json::StaticString("PlayerSecretAlreadyConfigured"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAPIRequestsDisabledForTitle)
+            {
+                output = Json::Value(Json::StaticString("APIRequestsDisabledForTitle"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidSharedSecretKey)
+            {
+                output = Json::Value(Json::StaticString("InvalidSharedSecretKey"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPrizeTableHasNoRanks)
+            {
+                output = Json::Value(Json::StaticString("PrizeTableHasNoRanks"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesProfileDoesNotExist)
+            {
+                output = Json::Value(Json::StaticString("ProfileDoesNotExist"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesContentS3OriginBucketNotConfigured)
+            {
+                output = Json::Value(Json::StaticString("ContentS3OriginBucketNotConfigured"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidEnvironmentForReceipt)
+            {
+                output = Json::Value(Json::StaticString("InvalidEnvironmentForReceipt"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEncryptedRequestNotAllowed)
+            {
+                output = Json::Value(Json::StaticString("EncryptedRequestNotAllowed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSignedRequestNotAllowed)
+            {
+                output = Json::Value(Json::StaticString("SignedRequestNotAllowed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesRequestViewConstraintParamsNotAllowed)
+            {
+                output = Json::Value(Json::StaticString("RequestViewConstraintParamsNotAllowed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesBadPartnerConfiguration)
+            {
+                output = Json::Value(Json::StaticString("BadPartnerConfiguration"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesXboxBPCertificateFailure)
+            {
+                output = Json::Value(Json::StaticString("XboxBPCertificateFailure"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesXboxXASSExchangeFailure)
+            {
+                output = Json::Value(Json::StaticString("XboxXASSExchangeFailure"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidEntityId)
+            {
+                output = Json::Value(Json::StaticString("InvalidEntityId"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStatisticValueAggregationOverflow)
+            {
+                output = Json::Value(Json::StaticString("StatisticValueAggregationOverflow"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEmailMessageFromAddressIsMissing)
+            {
+                output = Json::Value(Json::StaticString("EmailMessageFromAddressIsMissing"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEmailMessageToAddressIsMissing)
+            {
+                output = Json::Value(Json::StaticString("EmailMessageToAddressIsMissing"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSmtpServerAuthenticationError)
+            {
+                output = Json::Value(Json::StaticString("SmtpServerAuthenticationError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSmtpServerLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("SmtpServerLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSmtpServerInsufficientStorage)
+            {
+                output = Json::Value(Json::StaticString("SmtpServerInsufficientStorage"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSmtpServerCommunicationError)
+            {
+                output = Json::Value(Json::StaticString("SmtpServerCommunicationError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSmtpServerGeneralFailure)
+            {
+                output = Json::Value(Json::StaticString("SmtpServerGeneralFailure"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEmailClientTimeout)
+            {
+                output = Json::Value(Json::StaticString("EmailClientTimeout"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEmailClientCanceledTask)
+            {
+                output = Json::Value(Json::StaticString("EmailClientCanceledTask"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEmailTemplateMissing)
+            {
+                output = Json::Value(Json::StaticString("EmailTemplateMissing"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidHostForTitleId)
+            {
+                output = Json::Value(Json::StaticString("InvalidHostForTitleId"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEmailConfirmationTokenDoesNotExist)
+            {
+                output = Json::Value(Json::StaticString("EmailConfirmationTokenDoesNotExist"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEmailConfirmationTokenExpired)
+            {
+                output = Json::Value(Json::StaticString("EmailConfirmationTokenExpired"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAccountDeleted)
+            {
+                output = Json::Value(Json::StaticString("AccountDeleted"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPlayerSecretNotConfigured)
+            {
+                output = Json::Value(Json::StaticString("PlayerSecretNotConfigured"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidSignatureTime)
+            {
+                output = Json::Value(Json::StaticString("InvalidSignatureTime"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNoContactEmailAddressFound)
+            {
+                output = Json::Value(Json::StaticString("NoContactEmailAddressFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidAuthToken)
+            {
+                output = Json::Value(Json::StaticString("InvalidAuthToken"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAuthTokenDoesNotExist)
+            {
+                output = Json::Value(Json::StaticString("AuthTokenDoesNotExist"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAuthTokenExpired)
+            {
+                output = Json::Value(Json::StaticString("AuthTokenExpired"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAuthTokenAlreadyUsedToResetPassword)
+            {
+                output = Json::Value(Json::StaticString("AuthTokenAlreadyUsedToResetPassword"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMembershipNameTooLong)
+            {
+                output = Json::Value(Json::StaticString("MembershipNameTooLong"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMembershipNotFound)
+            {
+                output = Json::Value(Json::StaticString("MembershipNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGoogleServiceAccountInvalid)
+            {
+                output = Json::Value(Json::StaticString("GoogleServiceAccountInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGoogleServiceAccountParseFailure)
+            {
+                output = Json::Value(Json::StaticString("GoogleServiceAccountParseFailure"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEntityTokenMissing)
+            {
+                output = Json::Value(Json::StaticString("EntityTokenMissing"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEntityTokenInvalid)
+            {
+                output = Json::Value(Json::StaticString("EntityTokenInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEntityTokenExpired)
+            {
+                output = Json::Value(Json::StaticString("EntityTokenExpired"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEntityTokenRevoked)
+            {
+                output = Json::Value(Json::StaticString("EntityTokenRevoked"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidProductForSubscription)
+            {
+                output = Json::Value(Json::StaticString("InvalidProductForSubscription"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesXboxInaccessible)
+            {
+                output = Json::Value(Json::StaticString("XboxInaccessible"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSubscriptionAlreadyTaken)
+            {
+                output = Json::Value(Json::StaticString("SubscriptionAlreadyTaken"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSmtpAddonNotEnabled)
+            {
+                output = Json::Value(Json::StaticString("SmtpAddonNotEnabled"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAPIConcurrentRequestLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("APIConcurrentRequestLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesXboxRejectedXSTSExchangeRequest)
+            {
+                output = Json::Value(Json::StaticString("XboxRejectedXSTSExchangeRequest"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesVariableNotDefined)
+            {
+                output = Json::Value(Json::StaticString("VariableNotDefined"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTemplateVersionNotDefined)
+            {
+                output = Json::Value(Json::StaticString("TemplateVersionNotDefined"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesFileTooLarge)
+            {
+                output = Json::Value(Json::StaticString("FileTooLarge"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleDeleted)
+            {
+                output = Json::Value(Json::StaticString("TitleDeleted"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleContainsUserAccounts)
+            {
+                output = Json::Value(Json::StaticString("TitleContainsUserAccounts"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleDeletionPlayerCleanupFailure)
+            {
+                output = Json::Value(Json::StaticString("TitleDeletionPlayerCleanupFailure"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEntityFileOperationPending)
+            {
+                output = Json::Value(Json::StaticString("EntityFileOperationPending"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNoEntityFileOperationPending)
+            {
+                output = Json::Value(Json::StaticString("NoEntityFileOperationPending"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEntityProfileVersionMismatch)
+            {
+                output = Json::Value(Json::StaticString("EntityProfileVersionMismatch"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTemplateVersionTooOld)
+            {
+                output = Json::Value(Json::StaticString("TemplateVersionTooOld"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMembershipDefinitionInUse)
+            {
+                output = Json::Value(Json::StaticString("MembershipDefinitionInUse"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPaymentPageNotConfigured)
+            {
+                output = Json::Value(Json::StaticString("PaymentPageNotConfigured"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesFailedLoginAttemptRateLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("FailedLoginAttemptRateLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEntityBlockedByGroup)
+            {
+                output = Json::Value(Json::StaticString("EntityBlockedByGroup"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesRoleDoesNotExist)
+            {
+                output = Json::Value(Json::StaticString("RoleDoesNotExist"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEntityIsAlreadyMember)
+            {
+                output = Json::Value(Json::StaticString("EntityIsAlreadyMember"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDuplicateRoleId)
+            {
+                output = Json::Value(Json::StaticString("DuplicateRoleId"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGroupInvitationNotFound)
+            {
+                output = Json::Value(Json::StaticString("GroupInvitationNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGroupApplicationNotFound)
+            {
+                output = Json::Value(Json::StaticString("GroupApplicationNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesOutstandingInvitationAcceptedInstead)
+            {
+                output = Json::Value(Json::StaticString("OutstandingInvitationAcceptedInstead"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesOutstandingApplicationAcceptedInstead)
+            {
+                output = Json::Value(Json::StaticString("OutstandingApplicationAcceptedInstead"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesRoleIsGroupDefaultMember)
+            {
+                output = Json::Value(Json::StaticString("RoleIsGroupDefaultMember"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesRoleIsGroupAdmin)
+            {
+                output = Json::Value(Json::StaticString("RoleIsGroupAdmin"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesRoleNameNotAvailable)
+            {
+                output = Json::Value(Json::StaticString("RoleNameNotAvailable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGroupNameNotAvailable)
+            {
+                output = Json::Value(Json::StaticString("GroupNameNotAvailable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEmailReportAlreadySent)
+            {
+                output = Json::Value(Json::StaticString("EmailReportAlreadySent"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEmailReportRecipientBlacklisted)
+            {
+                output = Json::Value(Json::StaticString("EmailReportRecipientBlacklisted"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEventNamespaceNotAllowed)
+            {
+                output = Json::Value(Json::StaticString("EventNamespaceNotAllowed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEventEntityNotAllowed)
+            {
+                output = Json::Value(Json::StaticString("EventEntityNotAllowed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidEntityType)
+            {
+                output = Json::Value(Json::StaticString("InvalidEntityType"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNullTokenResultFromAad)
+            {
+                output = Json::Value(Json::StaticString("NullTokenResultFromAad"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidTokenResultFromAad)
+            {
+                output = Json::Value(Json::StaticString("InvalidTokenResultFromAad"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNoValidCertificateForAad)
+            {
+                output = Json::Value(Json::StaticString("NoValidCertificateForAad"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidCertificateForAad)
+            {
+                output = Json::Value(Json::StaticString("InvalidCertificateForAad"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDuplicateDropTableId)
+            {
+                output = Json::Value(Json::StaticString("DuplicateDropTableId"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMultiplayerServerError)
+            {
+                output = Json::Value(Json::StaticString("MultiplayerServerError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMultiplayerServerTooManyRequests)
+            {
+                output = Json::Value(Json::StaticString("MultiplayerServerTooManyRequests"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMultiplayerServerNoContent)
+            {
+                output = Json::Value(Json::StaticString("MultiplayerServerNoContent"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMultiplayerServerBadRequest)
+            {
+                output = Json::Value(Json::StaticString("MultiplayerServerBadRequest"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMultiplayerServerUnauthorized)
+            {
+                output = Json::Value(Json::StaticString("MultiplayerServerUnauthorized"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMultiplayerServerForbidden)
+            {
+                output = Json::Value(Json::StaticString("MultiplayerServerForbidden"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMultiplayerServerNotFound)
+            {
+                output = Json::Value(Json::StaticString("MultiplayerServerNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMultiplayerServerConflict)
+            {
+                output = Json::Value(Json::StaticString("MultiplayerServerConflict"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMultiplayerServerInternalServerError)
+            {
+                output = Json::Value(Json::StaticString("MultiplayerServerInternalServerError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMultiplayerServerUnavailable)
+            {
+                output = Json::Value(Json::StaticString("MultiplayerServerUnavailable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExplicitContentDetected)
+            {
+                output = Json::Value(Json::StaticString("ExplicitContentDetected"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPIIContentDetected)
+            {
+                output = Json::Value(Json::StaticString("PIIContentDetected"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidScheduledTaskParameter)
+            {
+                output = Json::Value(Json::StaticString("InvalidScheduledTaskParameter"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPerEntityEventRateLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("PerEntityEventRateLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleDefaultLanguageNotSet)
+            {
+                output = Json::Value(Json::StaticString("TitleDefaultLanguageNotSet"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEmailTemplateMissingDefaultVersion)
+            {
+                output = Json::Value(Json::StaticString("EmailTemplateMissingDefaultVersion"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesFacebookInstantGamesIdNotLinked)
+            {
+                output = Json::Value(Json::StaticString("FacebookInstantGamesIdNotLinked"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidFacebookInstantGamesSignature)
+            {
+                output = Json::Value(Json::StaticString("InvalidFacebookInstantGamesSignature"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesFacebookInstantGamesAuthNotConfiguredForTitle)
+            {
+                output = Json::Value(Json::StaticString("FacebookInstantGamesAuthNotConfiguredForTitle"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEntityProfileConstraintValidationFailed)
+            {
+                output = Json::Value(Json::StaticString("EntityProfileConstraintValidationFailed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTelemetryIngestionKeyPending)
+            {
+                output = Json::Value(Json::StaticString("TelemetryIngestionKeyPending"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTelemetryIngestionKeyNotFound)
+            {
+                output = Json::Value(Json::StaticString("TelemetryIngestionKeyNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStatisticChildNameInvalid)
+            {
+                output = Json::Value(Json::StaticString("StatisticChildNameInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDataIntegrityError)
+            {
+                output = Json::Value(Json::StaticString("DataIntegrityError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesVirtualCurrencyCannotBeSetToOlderVersion)
+            {
+                output = Json::Value(Json::StaticString("VirtualCurrencyCannotBeSetToOlderVersion"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesVirtualCurrencyMustBeWithinIntegerRange)
+            {
+                output = Json::Value(Json::StaticString("VirtualCurrencyMustBeWithinIntegerRange"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEmailTemplateInvalidSyntax)
+            {
+                output = Json::Value(Json::StaticString("EmailTemplateInvalidSyntax"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEmailTemplateMissingCallback)
+            {
+                output = Json::Value(Json::StaticString("EmailTemplateMissingCallback"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPushNotificationTemplateInvalidPayload)
+            {
+                output = Json::Value(Json::StaticString("PushNotificationTemplateInvalidPayload"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidLocalizedPushNotificationLanguage)
+            {
+                output = Json::Value(Json::StaticString("InvalidLocalizedPushNotificationLanguage"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMissingLocalizedPushNotificationMessage)
+            {
+                output = Json::Value(Json::StaticString("MissingLocalizedPushNotificationMessage"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPushNotificationTemplateMissingPlatformPayload)
+            {
+                output = Json::Value(Json::StaticString("PushNotificationTemplateMissingPlatformPayload"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPushNotificationTemplatePayloadContainsInvalidJson)
+            {
+                output = Json::Value(Json::StaticString("PushNotificationTemplatePayloadContainsInvalidJson"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPushNotificationTemplateContainsInvalidIosPayload)
+            {
+                output = Json::Value(Json::StaticString("PushNotificationTemplateContainsInvalidIosPayload"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPushNotificationTemplateContainsInvalidAndroidPayload)
+            {
+                output = Json::Value(Json::StaticString("PushNotificationTemplateContainsInvalidAndroidPayload"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPushNotificationTemplateIosPayloadMissingNotificationBody)
+            {
+                output = Json::Value(Json::StaticString("PushNotificationTemplateIosPayloadMissingNotificationBody"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPushNotificationTemplateAndroidPayloadMissingNotificationBody)
+            {
+                output = Json::Value(Json::StaticString("PushNotificationTemplateAndroidPayloadMissingNotificationBody"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPushNotificationTemplateNotFound)
+            {
+                output = Json::Value(Json::StaticString("PushNotificationTemplateNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPushNotificationTemplateMissingDefaultVersion)
+            {
+                output = Json::Value(Json::StaticString("PushNotificationTemplateMissingDefaultVersion"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPushNotificationTemplateInvalidSyntax)
+            {
+                output = Json::Value(Json::StaticString("PushNotificationTemplateInvalidSyntax"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPushNotificationTemplateNoCustomPayloadForV1)
+            {
+                output = Json::Value(Json::StaticString("PushNotificationTemplateNoCustomPayloadForV1"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNoLeaderboardForStatistic)
+            {
+                output = Json::Value(Json::StaticString("NoLeaderboardForStatistic"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleNewsMissingDefaultLanguage)
+            {
+                output = Json::Value(Json::StaticString("TitleNewsMissingDefaultLanguage"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleNewsNotFound)
+            {
+                output = Json::Value(Json::StaticString("TitleNewsNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleNewsDuplicateLanguage)
+            {
+                output = Json::Value(Json::StaticString("TitleNewsDuplicateLanguage"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleNewsMissingTitleOrBody)
+            {
+                output = Json::Value(Json::StaticString("TitleNewsMissingTitleOrBody"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleNewsInvalidLanguage)
+            {
+                output = Json::Value(Json::StaticString("TitleNewsInvalidLanguage"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEmailRecipientBlacklisted)
+            {
+                output = Json::Value(Json::StaticString("EmailRecipientBlacklisted"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInvalidGameCenterAuthRequest)
+            {
+                output = Json::Value(Json::StaticString("InvalidGameCenterAuthRequest"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGameCenterAuthenticationFailed)
+            {
+                output = Json::Value(Json::StaticString("GameCenterAuthenticationFailed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCannotEnablePartiesForTitle)
+            {
+                output = Json::Value(Json::StaticString("CannotEnablePartiesForTitle"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPartyError)
+            {
+                output = Json::Value(Json::StaticString("PartyError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPartyRequests)
+            {
+                output = Json::Value(Json::StaticString("PartyRequests"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPartyNoContent)
+            {
+                output = Json::Value(Json::StaticString("PartyNoContent"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPartyBadRequest)
+            {
+                output = Json::Value(Json::StaticString("PartyBadRequest"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPartyUnauthorized)
+            {
+                output = Json::Value(Json::StaticString("PartyUnauthorized"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPartyForbidden)
+            {
+                output = Json::Value(Json::StaticString("PartyForbidden"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPartyNotFound)
+            {
+                output = Json::Value(Json::StaticString("PartyNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPartyConflict)
+            {
+                output = Json::Value(Json::StaticString("PartyConflict"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPartyInternalServerError)
+            {
+                output = Json::Value(Json::StaticString("PartyInternalServerError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPartyUnavailable)
+            {
+                output = Json::Value(Json::StaticString("PartyUnavailable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPartyTooManyRequests)
+            {
+                output = Json::Value(Json::StaticString("PartyTooManyRequests"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPushNotificationTemplateMissingName)
+            {
+                output = Json::Value(Json::StaticString("PushNotificationTemplateMissingName"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCannotEnableMultiplayerServersForTitle)
+            {
+                output = Json::Value(Json::StaticString("CannotEnableMultiplayerServersForTitle"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesWriteAttemptedDuringExport)
+            {
+                output = Json::Value(Json::StaticString("WriteAttemptedDuringExport"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMultiplayerServerTitleQuotaCoresExceeded)
+            {
+                output = Json::Value(Json::StaticString("MultiplayerServerTitleQuotaCoresExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAutomationRuleNotFound)
+            {
+                output = Json::Value(Json::StaticString("AutomationRuleNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEntityAPIKeyLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("EntityAPIKeyLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEntityAPIKeyNotFound)
+            {
+                output = Json::Value(Json::StaticString("EntityAPIKeyNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEntityAPIKeyOrSecretInvalid)
+            {
+                output = Json::Value(Json::StaticString("EntityAPIKeyOrSecretInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEconomyServiceUnavailable)
+            {
+                output = Json::Value(Json::StaticString("EconomyServiceUnavailable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEconomyServiceInternalError)
+            {
+                output = Json::Value(Json::StaticString("EconomyServiceInternalError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesQueryRateLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("QueryRateLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEntityAPIKeyCreationDisabledForEntity)
+            {
+                output = Json::Value(Json::StaticString("EntityAPIKeyCreationDisabledForEntity"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesForbiddenByEntityPolicy)
+            {
+                output = Json::Value(Json::StaticString("ForbiddenByEntityPolicy"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesUpdateInventoryRateLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("UpdateInventoryRateLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStudioCreationRateLimited)
+            {
+                output = Json::Value(Json::StaticString("StudioCreationRateLimited"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStudioCreationInProgress)
+            {
+                output = Json::Value(Json::StaticString("StudioCreationInProgress"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDuplicateStudioName)
+            {
+                output = Json::Value(Json::StaticString("DuplicateStudioName"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStudioNotFound)
+            {
+                output = Json::Value(Json::StaticString("StudioNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStudioDeleted)
+            {
+                output = Json::Value(Json::StaticString("StudioDeleted"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStudioDeactivated)
+            {
+                output = Json::Value(Json::StaticString("StudioDeactivated"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesStudioActivated)
+            {
+                output = Json::Value(Json::StaticString("StudioActivated"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleCreationRateLimited)
+            {
+                output = Json::Value(Json::StaticString("TitleCreationRateLimited"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleCreationInProgress)
+            {
+                output = Json::Value(Json::StaticString("TitleCreationInProgress"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDuplicateTitleName)
+            {
+                output = Json::Value(Json::StaticString("DuplicateTitleName"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleActivationRateLimited)
+            {
+                output = Json::Value(Json::StaticString("TitleActivationRateLimited"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleActivationInProgress)
+            {
+                output = Json::Value(Json::StaticString("TitleActivationInProgress"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleDeactivated)
+            {
+                output = Json::Value(Json::StaticString("TitleDeactivated"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleActivated)
+            {
+                output = Json::Value(Json::StaticString("TitleActivated"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCloudScriptAzureFunctionsExecutionTimeLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("CloudScriptAzureFunctionsExecutionTimeLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCloudScriptAzureFunctionsArgumentSizeExceeded)
+            {
+                output = Json::Value(Json::StaticString("CloudScriptAzureFunctionsArgumentSizeExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCloudScriptAzureFunctionsReturnSizeExceeded)
+            {
+                output = Json::Value(Json::StaticString("CloudScriptAzureFunctionsReturnSizeExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCloudScriptAzureFunctionsHTTPRequestError)
+            {
+                output = Json::Value(Json::StaticString("CloudScriptAzureFunctionsHTTPRequestError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesVirtualCurrencyBetaGetError)
+            {
+                output = Json::Value(Json::StaticString("VirtualCurrencyBetaGetError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesVirtualCurrencyBetaCreateError)
+            {
+                output = Json::Value(Json::StaticString("VirtualCurrencyBetaCreateError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesVirtualCurrencyBetaInitialDepositSaveError)
+            {
+                output = Json::Value(Json::StaticString("VirtualCurrencyBetaInitialDepositSaveError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesVirtualCurrencyBetaSaveError)
+            {
+                output = Json::Value(Json::StaticString("VirtualCurrencyBetaSaveError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesVirtualCurrencyBetaDeleteError)
+            {
+                output = Json::Value(Json::StaticString("VirtualCurrencyBetaDeleteError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesVirtualCurrencyBetaRestoreError)
+            {
+                output = Json::Value(Json::StaticString("VirtualCurrencyBetaRestoreError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesVirtualCurrencyBetaSaveConflict)
+            {
+                output = Json::Value(Json::StaticString("VirtualCurrencyBetaSaveConflict"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesVirtualCurrencyBetaUpdateError)
+            {
+                output = Json::Value(Json::StaticString("VirtualCurrencyBetaUpdateError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInsightsManagementDatabaseNotFound)
+            {
+                output = Json::Value(Json::StaticString("InsightsManagementDatabaseNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInsightsManagementOperationNotFound)
+            {
+                output = Json::Value(Json::StaticString("InsightsManagementOperationNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInsightsManagementErrorPendingOperationExists)
+            {
+                output = Json::Value(Json::StaticString("InsightsManagementErrorPendingOperationExists"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInsightsManagementSetPerformanceLevelInvalidParameter)
+            {
+                output = Json::Value(Json::StaticString("InsightsManagementSetPerformanceLevelInvalidParameter"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInsightsManagementSetStorageRetentionInvalidParameter)
+            {
+                output = Json::Value(Json::StaticString("InsightsManagementSetStorageRetentionInvalidParameter"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInsightsManagementGetStorageUsageInvalidParameter)
+            {
+                output = Json::Value(Json::StaticString("InsightsManagementGetStorageUsageInvalidParameter"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInsightsManagementGetOperationStatusInvalidParameter)
+            {
+                output = Json::Value(Json::StaticString("InsightsManagementGetOperationStatusInvalidParameter"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDuplicatePurchaseTransactionId)
+            {
+                output = Json::Value(Json::StaticString("DuplicatePurchaseTransactionId"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEvaluationModePlayerCountExceeded)
+            {
+                output = Json::Value(Json::StaticString("EvaluationModePlayerCountExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGetPlayersInSegmentRateLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("GetPlayersInSegmentRateLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCloudScriptFunctionNameSizeExceeded)
+            {
+                output = Json::Value(Json::StaticString("CloudScriptFunctionNameSizeExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInsightsManagementTitleInEvaluationMode)
+            {
+                output = Json::Value(Json::StaticString("InsightsManagementTitleInEvaluationMode"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCloudScriptAzureFunctionsQueueRequestError)
+            {
+                output = Json::Value(Json::StaticString("CloudScriptAzureFunctionsQueueRequestError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesEvaluationModeTitleCountExceeded)
+            {
+                output = Json::Value(Json::StaticString("EvaluationModeTitleCountExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInsightsManagementTitleNotInFlight)
+            {
+                output = Json::Value(Json::StaticString("InsightsManagementTitleNotInFlight"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesLimitNotFound)
+            {
+                output = Json::Value(Json::StaticString("LimitNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesLimitNotAvailableViaAPI)
+            {
+                output = Json::Value(Json::StaticString("LimitNotAvailableViaAPI"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInsightsManagementSetStorageRetentionBelowMinimum)
+            {
+                output = Json::Value(Json::StaticString("InsightsManagementSetStorageRetentionBelowMinimum"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInsightsManagementSetStorageRetentionAboveMaximum)
+            {
+                output = Json::Value(Json::StaticString("InsightsManagementSetStorageRetentionAboveMaximum"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesAppleNotEnabledForTitle)
+            {
+                output = Json::Value(Json::StaticString("AppleNotEnabledForTitle"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInsightsManagementNewActiveEventExportLimitInvalid)
+            {
+                output = Json::Value(Json::StaticString("InsightsManagementNewActiveEventExportLimitInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInsightsManagementSetPerformanceRateLimited)
+            {
+                output = Json::Value(Json::StaticString("InsightsManagementSetPerformanceRateLimited"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPartyRequestsThrottledFromRateLimiter)
+            {
+                output = Json::Value(Json::StaticString("PartyRequestsThrottledFromRateLimiter"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesXboxServiceTooManyRequests)
+            {
+                output = Json::Value(Json::StaticString("XboxServiceTooManyRequests"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNintendoSwitchNotEnabledForTitle)
+            {
+                output = Json::Value(Json::StaticString("NintendoSwitchNotEnabledForTitle"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesRequestMultiplayerServersThrottledFromRateLimiter)
+            {
+                output = Json::Value(Json::StaticString("RequestMultiplayerServersThrottledFromRateLimiter"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleDataOverrideNotFound)
+            {
+                output = Json::Value(Json::StaticString("TitleDataOverrideNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDuplicateKeys)
+            {
+                output = Json::Value(Json::StaticString("DuplicateKeys"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesWasNotCreatedWithCloudRoot)
+            {
+                output = Json::Value(Json::StaticString("WasNotCreatedWithCloudRoot"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesLegacyMultiplayerServersDeprecated)
+            {
+                output = Json::Value(Json::StaticString("LegacyMultiplayerServersDeprecated"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesVirtualCurrencyCurrentlyUnavailable)
+            {
+                output = Json::Value(Json::StaticString("VirtualCurrencyCurrentlyUnavailable"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSteamUserNotFound)
+            {
+                output = Json::Value(Json::StaticString("SteamUserNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesElasticSearchOperationFailed)
+            {
+                output = Json::Value(Json::StaticString("ElasticSearchOperationFailed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingEntityInvalid)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingEntityInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingPlayerAttributesInvalid)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingPlayerAttributesInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingQueueNotFound)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingQueueNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingMatchNotFound)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingMatchNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingTicketNotFound)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingTicketNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingAlreadyJoinedTicket)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingAlreadyJoinedTicket"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingTicketAlreadyCompleted)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingTicketAlreadyCompleted"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingQueueConfigInvalid)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingQueueConfigInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingMemberProfileInvalid)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingMemberProfileInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesNintendoSwitchDeviceIdNotLinked)
+            {
+                output = Json::Value(Json::StaticString("NintendoSwitchDeviceIdNotLinked"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingNotEnabled)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingNotEnabled"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingPlayerAttributesTooLarge)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingPlayerAttributesTooLarge"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingNumberOfPlayersInTicketTooLarge)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingNumberOfPlayersInTicketTooLarge"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingAttributeInvalid)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingAttributeInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingPlayerHasNotJoinedTicket)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingPlayerHasNotJoinedTicket"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingRateLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingRateLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingTicketMembershipLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingTicketMembershipLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingUnauthorized)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingUnauthorized"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingQueueLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingQueueLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingRequestTypeMismatch)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingRequestTypeMismatch"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMatchmakingBadRequest)
+            {
+                output = Json::Value(Json::StaticString("MatchmakingBadRequest"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleConfigNotFound)
+            {
+                output = Json::Value(Json::StaticString("TitleConfigNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleConfigUpdateConflict)
+            {
+                output = Json::Value(Json::StaticString("TitleConfigUpdateConflict"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleConfigSerializationError)
+            {
+                output = Json::Value(Json::StaticString("TitleConfigSerializationError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCatalogApiNotImplemented)
+            {
+                output = Json::Value(Json::StaticString("CatalogApiNotImplemented"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCatalogEntityInvalid)
+            {
+                output = Json::Value(Json::StaticString("CatalogEntityInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCatalogTitleIdMissing)
+            {
+                output = Json::Value(Json::StaticString("CatalogTitleIdMissing"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCatalogPlayerIdMissing)
+            {
+                output = Json::Value(Json::StaticString("CatalogPlayerIdMissing"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCatalogClientIdentityInvalid)
+            {
+                output = Json::Value(Json::StaticString("CatalogClientIdentityInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCatalogOneOrMoreFilesInvalid)
+            {
+                output = Json::Value(Json::StaticString("CatalogOneOrMoreFilesInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCatalogItemMetadataInvalid)
+            {
+                output = Json::Value(Json::StaticString("CatalogItemMetadataInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCatalogItemIdInvalid)
+            {
+                output = Json::Value(Json::StaticString("CatalogItemIdInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCatalogSearchParameterInvalid)
+            {
+                output = Json::Value(Json::StaticString("CatalogSearchParameterInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCatalogFeatureDisabled)
+            {
+                output = Json::Value(Json::StaticString("CatalogFeatureDisabled"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCatalogConfigInvalid)
+            {
+                output = Json::Value(Json::StaticString("CatalogConfigInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCatalogItemTypeInvalid)
+            {
+                output = Json::Value(Json::StaticString("CatalogItemTypeInvalid"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCatalogBadRequest)
+            {
+                output = Json::Value(Json::StaticString("CatalogBadRequest"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCatalogTooManyRequests)
+            {
+                output = Json::Value(Json::StaticString("CatalogTooManyRequests"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportInvalidStatusUpdate)
+            {
+                output = Json::Value(Json::StaticString("ExportInvalidStatusUpdate"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportInvalidPrefix)
+            {
+                output = Json::Value(Json::StaticString("ExportInvalidPrefix"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportBlobContainerDoesNotExist)
+            {
+                output = Json::Value(Json::StaticString("ExportBlobContainerDoesNotExist"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportNotFound)
+            {
+                output = Json::Value(Json::StaticString("ExportNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportCouldNotUpdate)
+            {
+                output = Json::Value(Json::StaticString("ExportCouldNotUpdate"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportInvalidStorageType)
+            {
+                output = Json::Value(Json::StaticString("ExportInvalidStorageType"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportAmazonBucketDoesNotExist)
+            {
+                output = Json::Value(Json::StaticString("ExportAmazonBucketDoesNotExist"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportInvalidBlobStorage)
+            {
+                output = Json::Value(Json::StaticString("ExportInvalidBlobStorage"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportKustoException)
+            {
+                output = Json::Value(Json::StaticString("ExportKustoException"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportKustoConnectionFailed)
+            {
+                output = Json::Value(Json::StaticString("ExportKustoConnectionFailed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportUnknownError)
+            {
+                output = Json::Value(Json::StaticString("ExportUnknownError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportCantEditPendingExport)
+            {
+                output = Json::Value(Json::StaticString("ExportCantEditPendingExport"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportLimitExports)
+            {
+                output = Json::Value(Json::StaticString("ExportLimitExports"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportLimitEvents)
+            {
+                output = Json::Value(Json::StaticString("ExportLimitEvents"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportInvalidPartitionStatusModification)
+            {
+                output = Json::Value(Json::StaticString("ExportInvalidPartitionStatusModification"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportCouldNotCreate)
+            {
+                output = Json::Value(Json::StaticString("ExportCouldNotCreate"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportNoBackingDatabaseFound)
+            {
+                output = Json::Value(Json::StaticString("ExportNoBackingDatabaseFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportCouldNotDelete)
+            {
+                output = Json::Value(Json::StaticString("ExportCouldNotDelete"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportCannotDetermineEventQuery)
+            {
+                output = Json::Value(Json::StaticString("ExportCannotDetermineEventQuery"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportInvalidQuerySchemaModification)
+            {
+                output = Json::Value(Json::StaticString("ExportInvalidQuerySchemaModification"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportQuerySchemaMissingRequiredColumns)
+            {
+                output = Json::Value(Json::StaticString("ExportQuerySchemaMissingRequiredColumns"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportCannotParseQuery)
+            {
+                output = Json::Value(Json::StaticString("ExportCannotParseQuery"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportControlCommandsNotAllowed)
+            {
+                output = Json::Value(Json::StaticString("ExportControlCommandsNotAllowed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExportQueryMissingTableReference)
+            {
+                output = Json::Value(Json::StaticString("ExportQueryMissingTableReference"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExplorerBasicInvalidQueryName)
+            {
+                output = Json::Value(Json::StaticString("ExplorerBasicInvalidQueryName"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExplorerBasicInvalidQueryDescription)
+            {
+                output = Json::Value(Json::StaticString("ExplorerBasicInvalidQueryDescription"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExplorerBasicInvalidQueryConditions)
+            {
+                output = Json::Value(Json::StaticString("ExplorerBasicInvalidQueryConditions"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExplorerBasicInvalidQueryStartDate)
+            {
+                output = Json::Value(Json::StaticString("ExplorerBasicInvalidQueryStartDate"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExplorerBasicInvalidQueryEndDate)
+            {
+                output = Json::Value(Json::StaticString("ExplorerBasicInvalidQueryEndDate"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExplorerBasicInvalidQueryGroupBy)
+            {
+                output = Json::Value(Json::StaticString("ExplorerBasicInvalidQueryGroupBy"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExplorerBasicInvalidQueryAggregateType)
+            {
+                output = Json::Value(Json::StaticString("ExplorerBasicInvalidQueryAggregateType"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExplorerBasicInvalidQueryAggregateProperty)
+            {
+                output = Json::Value(Json::StaticString("ExplorerBasicInvalidQueryAggregateProperty"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExplorerBasicLoadQueriesError)
+            {
+                output = Json::Value(Json::StaticString("ExplorerBasicLoadQueriesError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExplorerBasicLoadQueryError)
+            {
+                output = Json::Value(Json::StaticString("ExplorerBasicLoadQueryError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExplorerBasicCreateQueryError)
+            {
+                output = Json::Value(Json::StaticString("ExplorerBasicCreateQueryError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExplorerBasicDeleteQueryError)
+            {
+                output = Json::Value(Json::StaticString("ExplorerBasicDeleteQueryError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExplorerBasicUpdateQueryError)
+            {
+                output = Json::Value(Json::StaticString("ExplorerBasicUpdateQueryError"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExplorerBasicSavedQueriesLimit)
+            {
+                output = Json::Value(Json::StaticString("ExplorerBasicSavedQueriesLimit"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExplorerBasicSavedQueryNotFound)
+            {
+                output = Json::Value(Json::StaticString("ExplorerBasicSavedQueryNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleNotEnabledForParty)
+            {
+                output = Json::Value(Json::StaticString("TitleNotEnabledForParty"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesPartyVersionNotFound)
+            {
+                output = Json::Value(Json::StaticString("PartyVersionNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMultiplayerServerBuildReferencedByMatchmakingQueue)
+            {
+                output = Json::Value(Json::StaticString("MultiplayerServerBuildReferencedByMatchmakingQueue"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationExperimentStopped)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationExperimentStopped"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationExperimentRunning)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationExperimentRunning"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationExperimentNotFound)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationExperimentNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationExperimentNeverStarted)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationExperimentNeverStarted"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationExperimentDeleted)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationExperimentDeleted"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationClientTimeout)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationClientTimeout"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationInvalidVariantConfiguration)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationInvalidVariantConfiguration"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationInvalidVariableConfiguration)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationInvalidVariableConfiguration"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentInvalidId)
+            {
+                output = Json::Value(Json::StaticString("ExperimentInvalidId"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationNoScorecard)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationNoScorecard"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationTreatmentAssignmentFailed)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationTreatmentAssignmentFailed"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationTreatmentAssignmentDisabled)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationTreatmentAssignmentDisabled"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationInvalidDuration)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationInvalidDuration"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationMaxExperimentsReached)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationMaxExperimentsReached"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationExperimentSchedulingInProgress)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationExperimentSchedulingInProgress"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationInvalidEndDate)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationInvalidEndDate"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationInvalidStartDate)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationInvalidStartDate"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationMaxDurationExceeded)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationMaxDurationExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationExclusionGroupNotFound)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationExclusionGroupNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationExclusionGroupInsufficientCapacity)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationExclusionGroupInsufficientCapacity"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationExclusionGroupCannotDelete)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationExclusionGroupCannotDelete"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationExclusionGroupInvalidTrafficAllocation)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationExclusionGroupInvalidTrafficAllocation"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesExperimentationExclusionGroupInvalidName)
+            {
+                output = Json::Value(Json::StaticString("ExperimentationExclusionGroupInvalidName"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesMaxActionDepthExceeded)
+            {
+                output = Json::Value(Json::StaticString("MaxActionDepthExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesTitleNotOnUpdatedPricingPlan)
+            {
+                output = Json::Value(Json::StaticString("TitleNotOnUpdatedPricingPlan"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSegmentManagementTitleNotInFlight)
+            {
+                output = Json::Value(Json::StaticString("SegmentManagementTitleNotInFlight"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSegmentManagementNoExpressionTree)
+            {
+                output = Json::Value(Json::StaticString("SegmentManagementNoExpressionTree"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSegmentManagementTriggerActionCountOverLimit)
+            {
+                output = Json::Value(Json::StaticString("SegmentManagementTriggerActionCountOverLimit"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSegmentManagementSegmentCountOverLimit)
+            {
+                output = Json::Value(Json::StaticString("SegmentManagementSegmentCountOverLimit"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSegmentManagementInvalidSegmentId)
+            {
+                output = Json::Value(Json::StaticString("SegmentManagementInvalidSegmentId"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSegmentManagementInvalidInput)
+            {
+                output = Json::Value(Json::StaticString("SegmentManagementInvalidInput"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSegmentManagementInvalidSegmentName)
+            {
+                output = Json::Value(Json::StaticString("SegmentManagementInvalidSegmentName"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesDeleteSegmentRateLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("DeleteSegmentRateLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesCreateSegmentRateLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("CreateSegmentRateLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesUpdateSegmentRateLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("UpdateSegmentRateLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesGetSegmentsRateLimitExceeded)
+            {
+                output = Json::Value(Json::StaticString("GetSegmentsRateLimitExceeded"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesSnapshotNotFound)
+            {
+                output = Json::Value(Json::StaticString("SnapshotNotFound"));
+                return;
+            }
+            if (input == GenericErrorCodes::GenericErrorCodesInventoryApiNotImplemented)
+            {
+                output = Json::Value(Json::StaticString("InventoryApiNotImplemented"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, GenericErrorCodes& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Success")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSuccess;
+                return;
+            }
+            if (inputStr == "UnkownError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesUnkownError;
+                return;
+            }
+            if (inputStr == "InvalidParams")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidParams;
+                return;
+            }
+            if (inputStr == "AccountNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAccountNotFound;
+                return;
+            }
+            if (inputStr == "AccountBanned")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAccountBanned;
+                return;
+            }
+            if (inputStr == "InvalidUsernameOrPassword")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidUsernameOrPassword;
+                return;
+            }
+            if (inputStr == "InvalidTitleId")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidTitleId;
+                return;
+            }
+            if (inputStr == "InvalidEmailAddress")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidEmailAddress;
+                return;
+            }
+            if (inputStr == "EmailAddressNotAvailable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEmailAddressNotAvailable;
+                return;
+            }
+            if (inputStr == "InvalidUsername")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidUsername;
+                return;
+            }
+            if (inputStr == "InvalidPassword")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidPassword;
+                return;
+            }
+            if (inputStr == "UsernameNotAvailable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesUsernameNotAvailable;
+                return;
+            }
+            if (inputStr == "InvalidSteamTicket")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidSteamTicket;
+                return;
+            }
+            if (inputStr == "AccountAlreadyLinked")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAccountAlreadyLinked;
+                return;
+            }
+            if (inputStr == "LinkedAccountAlreadyClaimed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesLinkedAccountAlreadyClaimed;
+                return;
+            }
+            if (inputStr == "InvalidFacebookToken")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidFacebookToken;
+                return;
+            }
+            if (inputStr == "AccountNotLinked")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAccountNotLinked;
+                return;
+            }
+            if (inputStr == "FailedByPaymentProvider")
+            {
+                output = GenericErrorCodes::GenericErrorCodesFailedByPaymentProvider;
+                return;
+            }
+            if (inputStr == "CouponCodeNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCouponCodeNotFound;
+                return;
+            }
+            if (inputStr == "InvalidContainerItem")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidContainerItem;
+                return;
+            }
+            if (inputStr == "ContainerNotOwned")
+            {
+                output = GenericErrorCodes::GenericErrorCodesContainerNotOwned;
+                return;
+            }
+            if (inputStr == "KeyNotOwned")
+            {
+                output = GenericErrorCodes::GenericErrorCodesKeyNotOwned;
+                return;
+            }
+            if (inputStr == "InvalidItemIdInTable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidItemIdInTable;
+                return;
+            }
+            if (inputStr == "InvalidReceipt")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidReceipt;
+                return;
+            }
+            if (inputStr == "ReceiptAlreadyUsed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesReceiptAlreadyUsed;
+                return;
+            }
+            if (inputStr == "ReceiptCancelled")
+            {
+                output = GenericErrorCodes::GenericErrorCodesReceiptCancelled;
+                return;
+            }
+            if (inputStr == "GameNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGameNotFound;
+                return;
+            }
+            if (inputStr == "GameModeNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGameModeNotFound;
+                return;
+            }
+            if (inputStr == "InvalidGoogleToken")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidGoogleToken;
+                return;
+            }
+            if (inputStr == "UserIsNotPartOfDeveloper")
+            {
+                output = GenericErrorCodes::GenericErrorCodesUserIsNotPartOfDeveloper;
+                return;
+            }
+            if (inputStr == "InvalidTitleForDeveloper")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidTitleForDeveloper;
+                return;
+            }
+            if (inputStr == "TitleNameConflicts")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleNameConflicts;
+                return;
+            }
+            if (inputStr == "UserisNotValid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesUserisNotValid;
+                return;
+            }
+            if (inputStr == "ValueAlreadyExists")
+            {
+                output = GenericErrorCodes::GenericErrorCodesValueAlreadyExists;
+                return;
+            }
+            if (inputStr == "BuildNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesBuildNotFound;
+                return;
+            }
+            if (inputStr == "PlayerNotInGame")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPlayerNotInGame;
+                return;
+            }
+            if (inputStr == "InvalidTicket")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidTicket;
+                return;
+            }
+            if (inputStr == "InvalidDeveloper")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidDeveloper;
+                return;
+            }
+            if (inputStr == "InvalidOrderInfo")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidOrderInfo;
+                return;
+            }
+            if (inputStr == "RegistrationIncomplete")
+            {
+                output = GenericErrorCodes::GenericErrorCodesRegistrationIncomplete;
+                return;
+            }
+            if (inputStr == "InvalidPlatform")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidPlatform;
+                return;
+            }
+            if (inputStr == "UnknownError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesUnknownError;
+                return;
+            }
+            if (inputStr == "SteamApplicationNotOwned")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSteamApplicationNotOwned;
+                return;
+            }
+            if (inputStr == "WrongSteamAccount")
+            {
+                output = GenericErrorCodes::GenericErrorCodesWrongSteamAccount;
+                return;
+            }
+            if (inputStr == "TitleNotActivated")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleNotActivated;
+                return;
+            }
+            if (inputStr == "RegistrationSessionNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesRegistrationSessionNotFound;
+                return;
+            }
+            if (inputStr == "NoSuchMod")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNoSuchMod;
+                return;
+            }
+            if (inputStr == "FileNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesFileNotFound;
+                return;
+            }
+            if (inputStr == "DuplicateEmail")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDuplicateEmail;
+                return;
+            }
+            if (inputStr == "ItemNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesItemNotFound;
+                return;
+            }
+            if (inputStr == "ItemNotOwned")
+            {
+                output = GenericErrorCodes::GenericErrorCodesItemNotOwned;
+                return;
+            }
+            if (inputStr == "ItemNotRecycleable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesItemNotRecycleable;
+                return;
+            }
+            if (inputStr == "ItemNotAffordable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesItemNotAffordable;
+                return;
+            }
+            if (inputStr == "InvalidVirtualCurrency")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidVirtualCurrency;
+                return;
+            }
+            if (inputStr == "WrongVirtualCurrency")
+            {
+                output = GenericErrorCodes::GenericErrorCodesWrongVirtualCurrency;
+                return;
+            }
+            if (inputStr == "WrongPrice")
+            {
+                output = GenericErrorCodes::GenericErrorCodesWrongPrice;
+                return;
+            }
+            if (inputStr == "NonPositiveValue")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNonPositiveValue;
+                return;
+            }
+            if (inputStr == "InvalidRegion")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidRegion;
+                return;
+            }
+            if (inputStr == "RegionAtCapacity")
+            {
+                output = GenericErrorCodes::GenericErrorCodesRegionAtCapacity;
+                return;
+            }
+            if (inputStr == "ServerFailedToStart")
+            {
+                output = GenericErrorCodes::GenericErrorCodesServerFailedToStart;
+                return;
+            }
+            if (inputStr == "NameNotAvailable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNameNotAvailable;
+                return;
+            }
+            if (inputStr == "InsufficientFunds")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInsufficientFunds;
+                return;
+            }
+            if (inputStr == "InvalidDeviceID")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidDeviceID;
+                return;
+            }
+            if (inputStr == "InvalidPushNotificationToken")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidPushNotificationToken;
+                return;
+            }
+            if (inputStr == "NoRemainingUses")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNoRemainingUses;
+                return;
+            }
+            if (inputStr == "InvalidPaymentProvider")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidPaymentProvider;
+                return;
+            }
+            if (inputStr == "PurchaseInitializationFailure")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPurchaseInitializationFailure;
+                return;
+            }
+            if (inputStr == "DuplicateUsername")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDuplicateUsername;
+                return;
+            }
+            if (inputStr == "InvalidBuyerInfo")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidBuyerInfo;
+                return;
+            }
+            if (inputStr == "NoGameModeParamsSet")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNoGameModeParamsSet;
+                return;
+            }
+            if (inputStr == "BodyTooLarge")
+            {
+                output = GenericErrorCodes::GenericErrorCodesBodyTooLarge;
+                return;
+            }
+            if (inputStr == "ReservedWordInBody")
+            {
+                output = GenericErrorCodes::GenericErrorCodesReservedWordInBody;
+                return;
+            }
+            if (inputStr == "InvalidTypeInBody")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidTypeInBody;
+                return;
+            }
+            if (inputStr == "InvalidRequest")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidRequest;
+                return;
+            }
+            if (inputStr == "ReservedEventName")
+            {
+                output = GenericErrorCodes::GenericErrorCodesReservedEventName;
+                return;
+            }
+            if (inputStr == "InvalidUserStatistics")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidUserStatistics;
+                return;
+            }
+            if (inputStr == "NotAuthenticated")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNotAuthenticated;
+                return;
+            }
+            if (inputStr == "StreamAlreadyExists")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStreamAlreadyExists;
+                return;
+            }
+            if (inputStr == "ErrorCreatingStream")
+            {
+                output = GenericErrorCodes::GenericErrorCodesErrorCreatingStream;
+                return;
+            }
+            if (inputStr == "StreamNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStreamNotFound;
+                return;
+            }
+            if (inputStr == "InvalidAccount")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidAccount;
+                return;
+            }
+            if (inputStr == "PurchaseDoesNotExist")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPurchaseDoesNotExist;
+                return;
+            }
+            if (inputStr == "InvalidPurchaseTransactionStatus")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidPurchaseTransactionStatus;
+                return;
+            }
+            if (inputStr == "APINotEnabledForGameClientAccess")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAPINotEnabledForGameClientAccess;
+                return;
+            }
+            if (inputStr == "NoPushNotificationARNForTitle")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNoPushNotificationARNForTitle;
+                return;
+            }
+            if (inputStr == "BuildAlreadyExists")
+            {
+                output = GenericErrorCodes::GenericErrorCodesBuildAlreadyExists;
+                return;
+            }
+            if (inputStr == "BuildPackageDoesNotExist")
+            {
+                output = GenericErrorCodes::GenericErrorCodesBuildPackageDoesNotExist;
+                return;
+            }
+            if (inputStr == "CustomAnalyticsEventsNotEnabledForTitle")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCustomAnalyticsEventsNotEnabledForTitle;
+                return;
+            }
+            if (inputStr == "InvalidSharedGroupId")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidSharedGroupId;
+                return;
+            }
+            if (inputStr == "NotAuthorized")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNotAuthorized;
+                return;
+            }
+            if (inputStr == "MissingTitleGoogleProperties")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMissingTitleGoogleProperties;
+                return;
+            }
+            if (inputStr == "InvalidItemProperties")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidItemProperties;
+                return;
+            }
+            if (inputStr == "InvalidPSNAuthCode")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidPSNAuthCode;
+                return;
+            }
+            if (inputStr == "InvalidItemId")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidItemId;
+                return;
+            }
+            if (inputStr == "PushNotEnabledForAccount")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPushNotEnabledForAccount;
+                return;
+            }
+            if (inputStr == "PushServiceError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPushServiceError;
+                return;
+            }
+            if (inputStr == "ReceiptDoesNotContainInAppItems")
+            {
+                output = GenericErrorCodes::GenericErrorCodesReceiptDoesNotContainInAppItems;
+                return;
+            }
+            if (inputStr == "ReceiptContainsMultipleInAppItems")
+            {
+                output = GenericErrorCodes::GenericErrorCodesReceiptContainsMultipleInAppItems;
+                return;
+            }
+            if (inputStr == "InvalidBundleID")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidBundleID;
+                return;
+            }
+            if (inputStr == "JavascriptException")
+            {
+                output = GenericErrorCodes::GenericErrorCodesJavascriptException;
+                return;
+            }
+            if (inputStr == "InvalidSessionTicket")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidSessionTicket;
+                return;
+            }
+            if (inputStr == "UnableToConnectToDatabase")
+            {
+                output = GenericErrorCodes::GenericErrorCodesUnableToConnectToDatabase;
+                return;
+            }
+            if (inputStr == "InternalServerError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInternalServerError;
+                return;
+            }
+            if (inputStr == "InvalidReportDate")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidReportDate;
+                return;
+            }
+            if (inputStr == "ReportNotAvailable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesReportNotAvailable;
+                return;
+            }
+            if (inputStr == "DatabaseThroughputExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDatabaseThroughputExceeded;
+                return;
+            }
+            if (inputStr == "InvalidGameTicket")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidGameTicket;
+                return;
+            }
+            if (inputStr == "ExpiredGameTicket")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExpiredGameTicket;
+                return;
+            }
+            if (inputStr == "GameTicketDoesNotMatchLobby")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGameTicketDoesNotMatchLobby;
+                return;
+            }
+            if (inputStr == "LinkedDeviceAlreadyClaimed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesLinkedDeviceAlreadyClaimed;
+                return;
+            }
+            if (inputStr == "DeviceAlreadyLinked")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDeviceAlreadyLinked;
+                return;
+            }
+            if (inputStr == "DeviceNotLinked")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDeviceNotLinked;
+                return;
+            }
+            if (inputStr == "PartialFailure")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPartialFailure;
+                return;
+            }
+            if (inputStr == "PublisherNotSet")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPublisherNotSet;
+                return;
+            }
+            if (inputStr == "ServiceUnavailable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesServiceUnavailable;
+                return;
+            }
+            if (inputStr == "VersionNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesVersionNotFound;
+                return;
+            }
+            if (inputStr == "RevisionNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesRevisionNotFound;
+                return;
+            }
+            if (inputStr == "InvalidPublisherId")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidPublisherId;
+                return;
+            }
+            if (inputStr == "DownstreamServiceUnavailable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDownstreamServiceUnavailable;
+                return;
+            }
+            if (inputStr == "APINotIncludedInTitleUsageTier")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAPINotIncludedInTitleUsageTier;
+                return;
+            }
+            if (inputStr == "DAULimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDAULimitExceeded;
+                return;
+            }
+            if (inputStr == "APIRequestLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAPIRequestLimitExceeded;
+                return;
+            }
+            if (inputStr == "InvalidAPIEndpoint")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidAPIEndpoint;
+                return;
+            }
+            if (inputStr == "BuildNotAvailable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesBuildNotAvailable;
+                return;
+            }
+            if (inputStr == "ConcurrentEditError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesConcurrentEditError;
+                return;
+            }
+            if (inputStr == "ContentNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesContentNotFound;
+                return;
+            }
+            if (inputStr == "CharacterNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCharacterNotFound;
+                return;
+            }
+            if (inputStr == "CloudScriptNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCloudScriptNotFound;
+                return;
+            }
+            if (inputStr == "ContentQuotaExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesContentQuotaExceeded;
+                return;
+            }
+            if (inputStr == "InvalidCharacterStatistics")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidCharacterStatistics;
+                return;
+            }
+            if (inputStr == "PhotonNotEnabledForTitle")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPhotonNotEnabledForTitle;
+                return;
+            }
+            if (inputStr == "PhotonApplicationNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPhotonApplicationNotFound;
+                return;
+            }
+            if (inputStr == "PhotonApplicationNotAssociatedWithTitle")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPhotonApplicationNotAssociatedWithTitle;
+                return;
+            }
+            if (inputStr == "InvalidEmailOrPassword")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidEmailOrPassword;
+                return;
+            }
+            if (inputStr == "FacebookAPIError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesFacebookAPIError;
+                return;
+            }
+            if (inputStr == "InvalidContentType")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidContentType;
+                return;
+            }
+            if (inputStr == "KeyLengthExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesKeyLengthExceeded;
+                return;
+            }
+            if (inputStr == "DataLengthExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDataLengthExceeded;
+                return;
+            }
+            if (inputStr == "TooManyKeys")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTooManyKeys;
+                return;
+            }
+            if (inputStr == "FreeTierCannotHaveVirtualCurrency")
+            {
+                output = GenericErrorCodes::GenericErrorCodesFreeTierCannotHaveVirtualCurrency;
+                return;
+            }
+            if (inputStr == "MissingAmazonSharedKey")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMissingAmazonSharedKey;
+                return;
+            }
+            if (inputStr == "AmazonValidationError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAmazonValidationError;
+                return;
+            }
+            if (inputStr == "InvalidPSNIssuerId")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidPSNIssuerId;
+                return;
+            }
+            if (inputStr == "PSNInaccessible")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPSNInaccessible;
+                return;
+            }
+            if (inputStr == "ExpiredAuthToken")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExpiredAuthToken;
+                return;
+            }
+            if (inputStr == "FailedToGetEntitlements")
+            {
+                output = GenericErrorCodes::GenericErrorCodesFailedToGetEntitlements;
+                return;
+            }
+            if (inputStr == "FailedToConsumeEntitlement")
+            {
+                output = GenericErrorCodes::GenericErrorCodesFailedToConsumeEntitlement;
+                return;
+            }
+            if (inputStr == "TradeAcceptingUserNotAllowed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeAcceptingUserNotAllowed;
+                return;
+            }
+            if (inputStr == "TradeInventoryItemIsAssignedToCharacter")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeInventoryItemIsAssignedToCharacter;
+                return;
+            }
+            if (inputStr == "TradeInventoryItemIsBundle")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeInventoryItemIsBundle;
+                return;
+            }
+            if (inputStr == "TradeStatusNotValidForCancelling")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeStatusNotValidForCancelling;
+                return;
+            }
+            if (inputStr == "TradeStatusNotValidForAccepting")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeStatusNotValidForAccepting;
+                return;
+            }
+            if (inputStr == "TradeDoesNotExist")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeDoesNotExist;
+                return;
+            }
+            if (inputStr == "TradeCancelled")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeCancelled;
+                return;
+            }
+            if (inputStr == "TradeAlreadyFilled")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeAlreadyFilled;
+                return;
+            }
+            if (inputStr == "TradeWaitForStatusTimeout")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeWaitForStatusTimeout;
+                return;
+            }
+            if (inputStr == "TradeInventoryItemExpired")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeInventoryItemExpired;
+                return;
+            }
+            if (inputStr == "TradeMissingOfferedAndAcceptedItems")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeMissingOfferedAndAcceptedItems;
+                return;
+            }
+            if (inputStr == "TradeAcceptedItemIsBundle")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeAcceptedItemIsBundle;
+                return;
+            }
+            if (inputStr == "TradeAcceptedItemIsStackable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeAcceptedItemIsStackable;
+                return;
+            }
+            if (inputStr == "TradeInventoryItemInvalidStatus")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeInventoryItemInvalidStatus;
+                return;
+            }
+            if (inputStr == "TradeAcceptedCatalogItemInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeAcceptedCatalogItemInvalid;
+                return;
+            }
+            if (inputStr == "TradeAllowedUsersInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeAllowedUsersInvalid;
+                return;
+            }
+            if (inputStr == "TradeInventoryItemDoesNotExist")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeInventoryItemDoesNotExist;
+                return;
+            }
+            if (inputStr == "TradeInventoryItemIsConsumed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeInventoryItemIsConsumed;
+                return;
+            }
+            if (inputStr == "TradeInventoryItemIsStackable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeInventoryItemIsStackable;
+                return;
+            }
+            if (inputStr == "TradeAcceptedItemsMismatch")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeAcceptedItemsMismatch;
+                return;
+            }
+            if (inputStr == "InvalidKongregateToken")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidKongregateToken;
+                return;
+            }
+            if (inputStr == "FeatureNotConfiguredForTitle")
+            {
+                output = GenericErrorCodes::GenericErrorCodesFeatureNotConfiguredForTitle;
+                return;
+            }
+            if (inputStr == "NoMatchingCatalogItemForReceipt")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNoMatchingCatalogItemForReceipt;
+                return;
+            }
+            if (inputStr == "InvalidCurrencyCode")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidCurrencyCode;
+                return;
+            }
+            if (inputStr == "NoRealMoneyPriceForCatalogItem")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNoRealMoneyPriceForCatalogItem;
+                return;
+            }
+            if (inputStr == "TradeInventoryItemIsNotTradable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeInventoryItemIsNotTradable;
+                return;
+            }
+            if (inputStr == "TradeAcceptedCatalogItemIsNotTradable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTradeAcceptedCatalogItemIsNotTradable;
+                return;
+            }
+            if (inputStr == "UsersAlreadyFriends")
+            {
+                output = GenericErrorCodes::GenericErrorCodesUsersAlreadyFriends;
+                return;
+            }
+            if (inputStr == "LinkedIdentifierAlreadyClaimed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesLinkedIdentifierAlreadyClaimed;
+                return;
+            }
+            if (inputStr == "CustomIdNotLinked")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCustomIdNotLinked;
+                return;
+            }
+            if (inputStr == "TotalDataSizeExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTotalDataSizeExceeded;
+                return;
+            }
+            if (inputStr == "DeleteKeyConflict")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDeleteKeyConflict;
+                return;
+            }
+            if (inputStr == "InvalidXboxLiveToken")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidXboxLiveToken;
+                return;
+            }
+            if (inputStr == "ExpiredXboxLiveToken")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExpiredXboxLiveToken;
+                return;
+            }
+            if (inputStr == "ResettableStatisticVersionRequired")
+            {
+                output = GenericErrorCodes::GenericErrorCodesResettableStatisticVersionRequired;
+                return;
+            }
+            if (inputStr == "NotAuthorizedByTitle")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNotAuthorizedByTitle;
+                return;
+            }
+            if (inputStr == "NoPartnerEnabled")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNoPartnerEnabled;
+                return;
+            }
+            if (inputStr == "InvalidPartnerResponse")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidPartnerResponse;
+                return;
+            }
+            if (inputStr == "APINotEnabledForGameServerAccess")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAPINotEnabledForGameServerAccess;
+                return;
+            }
+            if (inputStr == "StatisticNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStatisticNotFound;
+                return;
+            }
+            if (inputStr == "StatisticNameConflict")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStatisticNameConflict;
+                return;
+            }
+            if (inputStr == "StatisticVersionClosedForWrites")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStatisticVersionClosedForWrites;
+                return;
+            }
+            if (inputStr == "StatisticVersionInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStatisticVersionInvalid;
+                return;
+            }
+            if (inputStr == "APIClientRequestRateLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAPIClientRequestRateLimitExceeded;
+                return;
+            }
+            if (inputStr == "InvalidJSONContent")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidJSONContent;
+                return;
+            }
+            if (inputStr == "InvalidDropTable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidDropTable;
+                return;
+            }
+            if (inputStr == "StatisticVersionAlreadyIncrementedForScheduledInterval")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStatisticVersionAlreadyIncrementedForScheduledInterval;
+                return;
+            }
+            if (inputStr == "StatisticCountLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStatisticCountLimitExceeded;
+                return;
+            }
+            if (inputStr == "StatisticVersionIncrementRateExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStatisticVersionIncrementRateExceeded;
+                return;
+            }
+            if (inputStr == "ContainerKeyInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesContainerKeyInvalid;
+                return;
+            }
+            if (inputStr == "CloudScriptExecutionTimeLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCloudScriptExecutionTimeLimitExceeded;
+                return;
+            }
+            if (inputStr == "NoWritePermissionsForEvent")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNoWritePermissionsForEvent;
+                return;
+            }
+            if (inputStr == "CloudScriptFunctionArgumentSizeExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCloudScriptFunctionArgumentSizeExceeded;
+                return;
+            }
+            if (inputStr == "CloudScriptAPIRequestCountExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCloudScriptAPIRequestCountExceeded;
+                return;
+            }
+            if (inputStr == "CloudScriptAPIRequestError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCloudScriptAPIRequestError;
+                return;
+            }
+            if (inputStr == "CloudScriptHTTPRequestError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCloudScriptHTTPRequestError;
+                return;
+            }
+            if (inputStr == "InsufficientGuildRole")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInsufficientGuildRole;
+                return;
+            }
+            if (inputStr == "GuildNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGuildNotFound;
+                return;
+            }
+            if (inputStr == "OverLimit")
+            {
+                output = GenericErrorCodes::GenericErrorCodesOverLimit;
+                return;
+            }
+            if (inputStr == "EventNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEventNotFound;
+                return;
+            }
+            if (inputStr == "InvalidEventField")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidEventField;
+                return;
+            }
+            if (inputStr == "InvalidEventName")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidEventName;
+                return;
+            }
+            if (inputStr == "CatalogNotConfigured")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCatalogNotConfigured;
+                return;
+            }
+            if (inputStr == "OperationNotSupportedForPlatform")
+            {
+                output = GenericErrorCodes::GenericErrorCodesOperationNotSupportedForPlatform;
+                return;
+            }
+            if (inputStr == "SegmentNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSegmentNotFound;
+                return;
+            }
+            if (inputStr == "StoreNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStoreNotFound;
+                return;
+            }
+            if (inputStr == "InvalidStatisticName")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidStatisticName;
+                return;
+            }
+            if (inputStr == "TitleNotQualifiedForLimit")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleNotQualifiedForLimit;
+                return;
+            }
+            if (inputStr == "InvalidServiceLimitLevel")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidServiceLimitLevel;
+                return;
+            }
+            if (inputStr == "ServiceLimitLevelInTransition")
+            {
+                output = GenericErrorCodes::GenericErrorCodesServiceLimitLevelInTransition;
+                return;
+            }
+            if (inputStr == "CouponAlreadyRedeemed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCouponAlreadyRedeemed;
+                return;
+            }
+            if (inputStr == "GameServerBuildSizeLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGameServerBuildSizeLimitExceeded;
+                return;
+            }
+            if (inputStr == "GameServerBuildCountLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGameServerBuildCountLimitExceeded;
+                return;
+            }
+            if (inputStr == "VirtualCurrencyCountLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesVirtualCurrencyCountLimitExceeded;
+                return;
+            }
+            if (inputStr == "VirtualCurrencyCodeExists")
+            {
+                output = GenericErrorCodes::GenericErrorCodesVirtualCurrencyCodeExists;
+                return;
+            }
+            if (inputStr == "TitleNewsItemCountLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleNewsItemCountLimitExceeded;
+                return;
+            }
+            if (inputStr == "InvalidTwitchToken")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidTwitchToken;
+                return;
+            }
+            if (inputStr == "TwitchResponseError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTwitchResponseError;
+                return;
+            }
+            if (inputStr == "ProfaneDisplayName")
+            {
+                output = GenericErrorCodes::GenericErrorCodesProfaneDisplayName;
+                return;
+            }
+            if (inputStr == "UserAlreadyAdded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesUserAlreadyAdded;
+                return;
+            }
+            if (inputStr == "InvalidVirtualCurrencyCode")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidVirtualCurrencyCode;
+                return;
+            }
+            if (inputStr == "VirtualCurrencyCannotBeDeleted")
+            {
+                output = GenericErrorCodes::GenericErrorCodesVirtualCurrencyCannotBeDeleted;
+                return;
+            }
+            if (inputStr == "IdentifierAlreadyClaimed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesIdentifierAlreadyClaimed;
+                return;
+            }
+            if (inputStr == "IdentifierNotLinked")
+            {
+                output = GenericErrorCodes::GenericErrorCodesIdentifierNotLinked;
+                return;
+            }
+            if (inputStr == "InvalidContinuationToken")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidContinuationToken;
+                return;
+            }
+            if (inputStr == "ExpiredContinuationToken")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExpiredContinuationToken;
+                return;
+            }
+            if (inputStr == "InvalidSegment")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidSegment;
+                return;
+            }
+            if (inputStr == "InvalidSessionId")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidSessionId;
+                return;
+            }
+            if (inputStr == "SessionLogNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSessionLogNotFound;
+                return;
+            }
+            if (inputStr == "InvalidSearchTerm")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidSearchTerm;
+                return;
+            }
+            if (inputStr == "TwoFactorAuthenticationTokenRequired")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTwoFactorAuthenticationTokenRequired;
+                return;
+            }
+            if (inputStr == "GameServerHostCountLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGameServerHostCountLimitExceeded;
+                return;
+            }
+            if (inputStr == "PlayerTagCountLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPlayerTagCountLimitExceeded;
+                return;
+            }
+            if (inputStr == "RequestAlreadyRunning")
+            {
+                output = GenericErrorCodes::GenericErrorCodesRequestAlreadyRunning;
+                return;
+            }
+            if (inputStr == "ActionGroupNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesActionGroupNotFound;
+                return;
+            }
+            if (inputStr == "MaximumSegmentBulkActionJobsRunning")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMaximumSegmentBulkActionJobsRunning;
+                return;
+            }
+            if (inputStr == "NoActionsOnPlayersInSegmentJob")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNoActionsOnPlayersInSegmentJob;
+                return;
+            }
+            if (inputStr == "DuplicateStatisticName")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDuplicateStatisticName;
+                return;
+            }
+            if (inputStr == "ScheduledTaskNameConflict")
+            {
+                output = GenericErrorCodes::GenericErrorCodesScheduledTaskNameConflict;
+                return;
+            }
+            if (inputStr == "ScheduledTaskCreateConflict")
+            {
+                output = GenericErrorCodes::GenericErrorCodesScheduledTaskCreateConflict;
+                return;
+            }
+            if (inputStr == "InvalidScheduledTaskName")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidScheduledTaskName;
+                return;
+            }
+            if (inputStr == "InvalidTaskSchedule")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidTaskSchedule;
+                return;
+            }
+            if (inputStr == "SteamNotEnabledForTitle")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSteamNotEnabledForTitle;
+                return;
+            }
+            if (inputStr == "LimitNotAnUpgradeOption")
+            {
+                output = GenericErrorCodes::GenericErrorCodesLimitNotAnUpgradeOption;
+                return;
+            }
+            if (inputStr == "NoSecretKeyEnabledForCloudScript")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNoSecretKeyEnabledForCloudScript;
+                return;
+            }
+            if (inputStr == "TaskNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTaskNotFound;
+                return;
+            }
+            if (inputStr == "TaskInstanceNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTaskInstanceNotFound;
+                return;
+            }
+            if (inputStr == "InvalidIdentityProviderId")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidIdentityProviderId;
+                return;
+            }
+            if (inputStr == "MisconfiguredIdentityProvider")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMisconfiguredIdentityProvider;
+                return;
+            }
+            if (inputStr == "InvalidScheduledTaskType")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidScheduledTaskType;
+                return;
+            }
+            if (inputStr == "BillingInformationRequired")
+            {
+                output = GenericErrorCodes::GenericErrorCodesBillingInformationRequired;
+                return;
+            }
+            if (inputStr == "LimitedEditionItemUnavailable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesLimitedEditionItemUnavailable;
+                return;
+            }
+            if (inputStr == "InvalidAdPlacementAndReward")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidAdPlacementAndReward;
+                return;
+            }
+            if (inputStr == "AllAdPlacementViewsAlreadyConsumed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAllAdPlacementViewsAlreadyConsumed;
+                return;
+            }
+            if (inputStr == "GoogleOAuthNotConfiguredForTitle")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGoogleOAuthNotConfiguredForTitle;
+                return;
+            }
+            if (inputStr == "GoogleOAuthError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGoogleOAuthError;
+                return;
+            }
+            if (inputStr == "UserNotFriend")
+            {
+                output = GenericErrorCodes::GenericErrorCodesUserNotFriend;
+                return;
+            }
+            if (inputStr == "InvalidSignature")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidSignature;
+                return;
+            }
+            if (inputStr == "InvalidPublicKey")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidPublicKey;
+                return;
+            }
+            if (inputStr == "GoogleOAuthNoIdTokenIncludedInResponse")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGoogleOAuthNoIdTokenIncludedInResponse;
+                return;
+            }
+            if (inputStr == "StatisticUpdateInProgress")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStatisticUpdateInProgress;
+                return;
+            }
+            if (inputStr == "LeaderboardVersionNotAvailable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesLeaderboardVersionNotAvailable;
+                return;
+            }
+            if (inputStr == "StatisticAlreadyHasPrizeTable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStatisticAlreadyHasPrizeTable;
+                return;
+            }
+            if (inputStr == "PrizeTableHasOverlappingRanks")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPrizeTableHasOverlappingRanks;
+                return;
+            }
+            if (inputStr == "PrizeTableHasMissingRanks")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPrizeTableHasMissingRanks;
+                return;
+            }
+            if (inputStr == "PrizeTableRankStartsAtZero")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPrizeTableRankStartsAtZero;
+                return;
+            }
+            if (inputStr == "InvalidStatistic")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidStatistic;
+                return;
+            }
+            if (inputStr == "ExpressionParseFailure")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExpressionParseFailure;
+                return;
+            }
+            if (inputStr == "ExpressionInvokeFailure")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExpressionInvokeFailure;
+                return;
+            }
+            if (inputStr == "ExpressionTooLong")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExpressionTooLong;
+                return;
+            }
+            if (inputStr == "DataUpdateRateExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDataUpdateRateExceeded;
+                return;
+            }
+            if (inputStr == "RestrictedEmailDomain")
+            {
+                output = GenericErrorCodes::GenericErrorCodesRestrictedEmailDomain;
+                return;
+            }
+            if (inputStr == "EncryptionKeyDisabled")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEncryptionKeyDisabled;
+                return;
+            }
+            if (inputStr == "EncryptionKeyMissing")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEncryptionKeyMissing;
+                return;
+            }
+            if (inputStr == "EncryptionKeyBroken")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEncryptionKeyBroken;
+                return;
+            }
+            if (inputStr == "NoSharedSecretKeyConfigured")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNoSharedSecretKeyConfigured;
+                return;
+            }
+            if (inputStr == "SecretKeyNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSecretKeyNotFound;
+                return;
+            }
+            if (inputStr == "PlayerSecretAlreadyConfigured")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPlayerSecretAlreadyConfigured;
+                return;
+            }
+            if (inputStr == "APIRequestsDisabledForTitle")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAPIRequestsDisabledForTitle;
+                return;
+            }
+            if (inputStr == "InvalidSharedSecretKey")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidSharedSecretKey;
+                return;
+            }
+            if (inputStr == "PrizeTableHasNoRanks")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPrizeTableHasNoRanks;
+                return;
+            }
+            if (inputStr == "ProfileDoesNotExist")
+            {
+                output = GenericErrorCodes::GenericErrorCodesProfileDoesNotExist;
+                return;
+            }
+            if (inputStr == "ContentS3OriginBucketNotConfigured")
+            {
+                output = GenericErrorCodes::GenericErrorCodesContentS3OriginBucketNotConfigured;
+                return;
+            }
+            if (inputStr == "InvalidEnvironmentForReceipt")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidEnvironmentForReceipt;
+                return;
+            }
+            if (inputStr == "EncryptedRequestNotAllowed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEncryptedRequestNotAllowed;
+                return;
+            }
+            if (inputStr == "SignedRequestNotAllowed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSignedRequestNotAllowed;
+                return;
+            }
+            if (inputStr == "RequestViewConstraintParamsNotAllowed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesRequestViewConstraintParamsNotAllowed;
+                return;
+            }
+            if (inputStr == "BadPartnerConfiguration")
+            {
+                output = GenericErrorCodes::GenericErrorCodesBadPartnerConfiguration;
+                return;
+            }
+            if (inputStr == "XboxBPCertificateFailure")
+            {
+                output = GenericErrorCodes::GenericErrorCodesXboxBPCertificateFailure;
+                return;
+            }
+            if (inputStr == "XboxXASSExchangeFailure")
+            {
+                output = GenericErrorCodes::GenericErrorCodesXboxXASSExchangeFailure;
+                return;
+            }
+            if (inputStr == "InvalidEntityId")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidEntityId;
+                return;
+            }
+            if (inputStr == "StatisticValueAggregationOverflow")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStatisticValueAggregationOverflow;
+                return;
+            }
+            if (inputStr == "EmailMessageFromAddressIsMissing")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEmailMessageFromAddressIsMissing;
+                return;
+            }
+            if (inputStr == "EmailMessageToAddressIsMissing")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEmailMessageToAddressIsMissing;
+                return;
+            }
+            if (inputStr == "SmtpServerAuthenticationError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSmtpServerAuthenticationError;
+                return;
+            }
+            if (inputStr == "SmtpServerLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSmtpServerLimitExceeded;
+                return;
+            }
+            if (inputStr == "SmtpServerInsufficientStorage")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSmtpServerInsufficientStorage;
+                return;
+            }
+            if (inputStr == "SmtpServerCommunicationError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSmtpServerCommunicationError;
+                return;
+            }
+            if (inputStr == "SmtpServerGeneralFailure")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSmtpServerGeneralFailure;
+                return;
+            }
+            if (inputStr == "EmailClientTimeout")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEmailClientTimeout;
+                return;
+            }
+            if (inputStr == "EmailClientCanceledTask")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEmailClientCanceledTask;
+                return;
+            }
+            if (inputStr == "EmailTemplateMissing")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEmailTemplateMissing;
+                return;
+            }
+            if (inputStr == "InvalidHostForTitleId")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidHostForTitleId;
+                return;
+            }
+            if (inputStr == "EmailConfirmationTokenDoesNotExist")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEmailConfirmationTokenDoesNotExist;
+                return;
+            }
+            if (inputStr == "EmailConfirmationTokenExpired")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEmailConfirmationTokenExpired;
+                return;
+            }
+            if (inputStr == "AccountDeleted")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAccountDeleted;
+                return;
+            }
+            if (inputStr == "PlayerSecretNotConfigured")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPlayerSecretNotConfigured;
+                return;
+            }
+            if (inputStr == "InvalidSignatureTime")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidSignatureTime;
+                return;
+            }
+            if (inputStr == "NoContactEmailAddressFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNoContactEmailAddressFound;
+                return;
+            }
+            if (inputStr == "InvalidAuthToken")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidAuthToken;
+                return;
+            }
+            if (inputStr == "AuthTokenDoesNotExist")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAuthTokenDoesNotExist;
+                return;
+            }
+            if (inputStr == "AuthTokenExpired")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAuthTokenExpired;
+                return;
+            }
+            if (inputStr == "AuthTokenAlreadyUsedToResetPassword")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAuthTokenAlreadyUsedToResetPassword;
+                return;
+            }
+            if (inputStr == "MembershipNameTooLong")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMembershipNameTooLong;
+                return;
+            }
+            if (inputStr == "MembershipNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMembershipNotFound;
+                return;
+            }
+            if (inputStr == "GoogleServiceAccountInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGoogleServiceAccountInvalid;
+                return;
+            }
+            if (inputStr == "GoogleServiceAccountParseFailure")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGoogleServiceAccountParseFailure;
+                return;
+            }
+            if (inputStr == "EntityTokenMissing")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEntityTokenMissing;
+                return;
+            }
+            if (inputStr == "EntityTokenInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEntityTokenInvalid;
+                return;
+            }
+            if (inputStr == "EntityTokenExpired")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEntityTokenExpired;
+                return;
+            }
+            if (inputStr == "EntityTokenRevoked")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEntityTokenRevoked;
+                return;
+            }
+            if (inputStr == "InvalidProductForSubscription")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidProductForSubscription;
+                return;
+            }
+            if (inputStr == "XboxInaccessible")
+            {
+                output = GenericErrorCodes::GenericErrorCodesXboxInaccessible;
+                return;
+            }
+            if (inputStr == "SubscriptionAlreadyTaken")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSubscriptionAlreadyTaken;
+                return;
+            }
+            if (inputStr == "SmtpAddonNotEnabled")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSmtpAddonNotEnabled;
+                return;
+            }
+            if (inputStr == "APIConcurrentRequestLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAPIConcurrentRequestLimitExceeded;
+                return;
+            }
+            if (inputStr == "XboxRejectedXSTSExchangeRequest")
+            {
+                output = GenericErrorCodes::GenericErrorCodesXboxRejectedXSTSExchangeRequest;
+                return;
+            }
+            if (inputStr == "VariableNotDefined")
+            {
+                output = GenericErrorCodes::GenericErrorCodesVariableNotDefined;
+                return;
+            }
+            if (inputStr == "TemplateVersionNotDefined")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTemplateVersionNotDefined;
+                return;
+            }
+            if (inputStr == "FileTooLarge")
+            {
+                output = GenericErrorCodes::GenericErrorCodesFileTooLarge;
+                return;
+            }
+            if (inputStr == "TitleDeleted")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleDeleted;
+                return;
+            }
+            if (inputStr == "TitleContainsUserAccounts")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleContainsUserAccounts;
+                return;
+            }
+            if (inputStr == "TitleDeletionPlayerCleanupFailure")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleDeletionPlayerCleanupFailure;
+                return;
+            }
+            if (inputStr == "EntityFileOperationPending")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEntityFileOperationPending;
+                return;
+            }
+            if (inputStr == "NoEntityFileOperationPending")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNoEntityFileOperationPending;
+                return;
+            }
+            if (inputStr == "EntityProfileVersionMismatch")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEntityProfileVersionMismatch;
+                return;
+            }
+            if (inputStr == "TemplateVersionTooOld")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTemplateVersionTooOld;
+                return;
+            }
+            if (inputStr == "MembershipDefinitionInUse")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMembershipDefinitionInUse;
+                return;
+            }
+            if (inputStr == "PaymentPageNotConfigured")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPaymentPageNotConfigured;
+                return;
+            }
+            if (inputStr == "FailedLoginAttemptRateLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesFailedLoginAttemptRateLimitExceeded;
+                return;
+            }
+            if (inputStr == "EntityBlockedByGroup")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEntityBlockedByGroup;
+                return;
+            }
+            if (inputStr == "RoleDoesNotExist")
+            {
+                output = GenericErrorCodes::GenericErrorCodesRoleDoesNotExist;
+                return;
+            }
+            if (inputStr == "EntityIsAlreadyMember")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEntityIsAlreadyMember;
+                return;
+            }
+            if (inputStr == "DuplicateRoleId")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDuplicateRoleId;
+                return;
+            }
+            if (inputStr == "GroupInvitationNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGroupInvitationNotFound;
+                return;
+            }
+            if (inputStr == "GroupApplicationNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGroupApplicationNotFound;
+                return;
+            }
+            if (inputStr == "OutstandingInvitationAcceptedInstead")
+            {
+                output = GenericErrorCodes::GenericErrorCodesOutstandingInvitationAcceptedInstead;
+                return;
+            }
+            if (inputStr == "OutstandingApplicationAcceptedInstead")
+            {
+                output = GenericErrorCodes::GenericErrorCodesOutstandingApplicationAcceptedInstead;
+                return;
+            }
+            if (inputStr == "RoleIsGroupDefaultMember")
+            {
+                output = GenericErrorCodes::GenericErrorCodesRoleIsGroupDefaultMember;
+                return;
+            }
+            if (inputStr == "RoleIsGroupAdmin")
+            {
+                output = GenericErrorCodes::GenericErrorCodesRoleIsGroupAdmin;
+                return;
+            }
+            if (inputStr == "RoleNameNotAvailable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesRoleNameNotAvailable;
+                return;
+            }
+            if (inputStr == "GroupNameNotAvailable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGroupNameNotAvailable;
+                return;
+            }
+            if (inputStr == "EmailReportAlreadySent")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEmailReportAlreadySent;
+                return;
+            }
+            if (inputStr == "EmailReportRecipientBlacklisted")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEmailReportRecipientBlacklisted;
+                return;
+            }
+            if (inputStr == "EventNamespaceNotAllowed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEventNamespaceNotAllowed;
+                return;
+            }
+            if (inputStr == "EventEntityNotAllowed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEventEntityNotAllowed;
+                return;
+            }
+            if (inputStr == "InvalidEntityType")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidEntityType;
+                return;
+            }
+            if (inputStr == "NullTokenResultFromAad")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNullTokenResultFromAad;
+                return;
+            }
+            if (inputStr == "InvalidTokenResultFromAad")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidTokenResultFromAad;
+                return;
+            }
+            if (inputStr == "NoValidCertificateForAad")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNoValidCertificateForAad;
+                return;
+            }
+            if (inputStr == "InvalidCertificateForAad")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidCertificateForAad;
+                return;
+            }
+            if (inputStr == "DuplicateDropTableId")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDuplicateDropTableId;
+                return;
+            }
+            if (inputStr == "MultiplayerServerError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMultiplayerServerError;
+                return;
+            }
+            if (inputStr == "MultiplayerServerTooManyRequests")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMultiplayerServerTooManyRequests;
+                return;
+            }
+            if (inputStr == "MultiplayerServerNoContent")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMultiplayerServerNoContent;
+                return;
+            }
+            if (inputStr == "MultiplayerServerBadRequest")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMultiplayerServerBadRequest;
+                return;
+            }
+            if (inputStr == "MultiplayerServerUnauthorized")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMultiplayerServerUnauthorized;
+                return;
+            }
+            if (inputStr == "MultiplayerServerForbidden")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMultiplayerServerForbidden;
+                return;
+            }
+            if (inputStr == "MultiplayerServerNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMultiplayerServerNotFound;
+                return;
+            }
+            if (inputStr == "MultiplayerServerConflict")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMultiplayerServerConflict;
+                return;
+            }
+            if (inputStr == "MultiplayerServerInternalServerError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMultiplayerServerInternalServerError;
+                return;
+            }
+            if (inputStr == "MultiplayerServerUnavailable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMultiplayerServerUnavailable;
+                return;
+            }
+            if (inputStr == "ExplicitContentDetected")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExplicitContentDetected;
+                return;
+            }
+            if (inputStr == "PIIContentDetected")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPIIContentDetected;
+                return;
+            }
+            if (inputStr == "InvalidScheduledTaskParameter")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidScheduledTaskParameter;
+                return;
+            }
+            if (inputStr == "PerEntityEventRateLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPerEntityEventRateLimitExceeded;
+                return;
+            }
+            if (inputStr == "TitleDefaultLanguageNotSet")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleDefaultLanguageNotSet;
+                return;
+            }
+            if (inputStr == "EmailTemplateMissingDefaultVersion")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEmailTemplateMissingDefaultVersion;
+                return;
+            }
+            if (inputStr == "FacebookInstantGamesIdNotLinked")
+            {
+                output = GenericErrorCodes::GenericErrorCodesFacebookInstantGamesIdNotLinked;
+                return;
+            }
+            if (inputStr == "InvalidFacebookInstantGamesSignature")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidFacebookInstantGamesSignature;
+                return;
+            }
+            if (inputStr == "FacebookInstantGamesAuthNotConfiguredForTitle")
+            {
+                output = GenericErrorCodes::GenericErrorCodesFacebookInstantGamesAuthNotConfiguredForTitle;
+                return;
+            }
+            if (inputStr == "EntityProfileConstraintValidationFailed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEntityProfileConstraintValidationFailed;
+                return;
+            }
+            if (inputStr == "TelemetryIngestionKeyPending")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTelemetryIngestionKeyPending;
+                return;
+            }
+            if (inputStr == "TelemetryIngestionKeyNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTelemetryIngestionKeyNotFound;
+                return;
+            }
+            if (inputStr == "StatisticChildNameInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStatisticChildNameInvalid;
+                return;
+            }
+            if (inputStr == "DataIntegrityError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDataIntegrityError;
+                return;
+            }
+            if (inputStr == "VirtualCurrencyCannotBeSetToOlderVersion")
+            {
+                output = GenericErrorCodes::GenericErrorCodesVirtualCurrencyCannotBeSetToOlderVersion;
+                return;
+            }
+            if (inputStr == "VirtualCurrencyMustBeWithinIntegerRange")
+            {
+                output = GenericErrorCodes::GenericErrorCodesVirtualCurrencyMustBeWithinIntegerRange;
+                return;
+            }
+            if (inputStr == "EmailTemplateInvalidSyntax")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEmailTemplateInvalidSyntax;
+                return;
+            }
+            if (inputStr == "EmailTemplateMissingCallback")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEmailTemplateMissingCallback;
+                return;
+            }
+            if (inputStr == "PushNotificationTemplateInvalidPayload")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPushNotificationTemplateInvalidPayload;
+                return;
+            }
+            if (inputStr == "InvalidLocalizedPushNotificationLanguage")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidLocalizedPushNotificationLanguage;
+                return;
+            }
+            if (inputStr == "MissingLocalizedPushNotificationMessage")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMissingLocalizedPushNotificationMessage;
+                return;
+            }
+            if (inputStr == "PushNotificationTemplateMissingPlatformPayload")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPushNotificationTemplateMissingPlatformPayload;
+                return;
+            }
+            if (inputStr == "PushNotificationTemplatePayloadContainsInvalidJson")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPushNotificationTemplatePayloadContainsInvalidJson;
+                return;
+            }
+            if (inputStr == "PushNotificationTemplateContainsInvalidIosPayload")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPushNotificationTemplateContainsInvalidIosPayload;
+                return;
+            }
+            if (inputStr == "PushNotificationTemplateContainsInvalidAndroidPayload")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPushNotificationTemplateContainsInvalidAndroidPayload;
+                return;
+            }
+            if (inputStr == "PushNotificationTemplateIosPayloadMissingNotificationBody")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPushNotificationTemplateIosPayloadMissingNotificationBody;
+                return;
+            }
+            if (inputStr == "PushNotificationTemplateAndroidPayloadMissingNotificationBody")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPushNotificationTemplateAndroidPayloadMissingNotificationBody;
+                return;
+            }
+            if (inputStr == "PushNotificationTemplateNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPushNotificationTemplateNotFound;
+                return;
+            }
+            if (inputStr == "PushNotificationTemplateMissingDefaultVersion")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPushNotificationTemplateMissingDefaultVersion;
+                return;
+            }
+            if (inputStr == "PushNotificationTemplateInvalidSyntax")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPushNotificationTemplateInvalidSyntax;
+                return;
+            }
+            if (inputStr == "PushNotificationTemplateNoCustomPayloadForV1")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPushNotificationTemplateNoCustomPayloadForV1;
+                return;
+            }
+            if (inputStr == "NoLeaderboardForStatistic")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNoLeaderboardForStatistic;
+                return;
+            }
+            if (inputStr == "TitleNewsMissingDefaultLanguage")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleNewsMissingDefaultLanguage;
+                return;
+            }
+            if (inputStr == "TitleNewsNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleNewsNotFound;
+                return;
+            }
+            if (inputStr == "TitleNewsDuplicateLanguage")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleNewsDuplicateLanguage;
+                return;
+            }
+            if (inputStr == "TitleNewsMissingTitleOrBody")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleNewsMissingTitleOrBody;
+                return;
+            }
+            if (inputStr == "TitleNewsInvalidLanguage")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleNewsInvalidLanguage;
+                return;
+            }
+            if (inputStr == "EmailRecipientBlacklisted")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEmailRecipientBlacklisted;
+                return;
+            }
+            if (inputStr == "InvalidGameCenterAuthRequest")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInvalidGameCenterAuthRequest;
+                return;
+            }
+            if (inputStr == "GameCenterAuthenticationFailed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGameCenterAuthenticationFailed;
+                return;
+            }
+            if (inputStr == "CannotEnablePartiesForTitle")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCannotEnablePartiesForTitle;
+                return;
+            }
+            if (inputStr == "PartyError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPartyError;
+                return;
+            }
+            if (inputStr == "PartyRequests")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPartyRequests;
+                return;
+            }
+            if (inputStr == "PartyNoContent")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPartyNoContent;
+                return;
+            }
+            if (inputStr == "PartyBadRequest")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPartyBadRequest;
+                return;
+            }
+            if (inputStr == "PartyUnauthorized")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPartyUnauthorized;
+                return;
+            }
+            if (inputStr == "PartyForbidden")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPartyForbidden;
+                return;
+            }
+            if (inputStr == "PartyNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPartyNotFound;
+                return;
+            }
+            if (inputStr == "PartyConflict")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPartyConflict;
+                return;
+            }
+            if (inputStr == "PartyInternalServerError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPartyInternalServerError;
+                return;
+            }
+            if (inputStr == "PartyUnavailable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPartyUnavailable;
+                return;
+            }
+            if (inputStr == "PartyTooManyRequests")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPartyTooManyRequests;
+                return;
+            }
+            if (inputStr == "PushNotificationTemplateMissingName")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPushNotificationTemplateMissingName;
+                return;
+            }
+            if (inputStr == "CannotEnableMultiplayerServersForTitle")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCannotEnableMultiplayerServersForTitle;
+                return;
+            }
+            if (inputStr == "WriteAttemptedDuringExport")
+            {
+                output = GenericErrorCodes::GenericErrorCodesWriteAttemptedDuringExport;
+                return;
+            }
+            if (inputStr == "MultiplayerServerTitleQuotaCoresExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMultiplayerServerTitleQuotaCoresExceeded;
+                return;
+            }
+            if (inputStr == "AutomationRuleNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAutomationRuleNotFound;
+                return;
+            }
+            if (inputStr == "EntityAPIKeyLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEntityAPIKeyLimitExceeded;
+                return;
+            }
+            if (inputStr == "EntityAPIKeyNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEntityAPIKeyNotFound;
+                return;
+            }
+            if (inputStr == "EntityAPIKeyOrSecretInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEntityAPIKeyOrSecretInvalid;
+                return;
+            }
+            if (inputStr == "EconomyServiceUnavailable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEconomyServiceUnavailable;
+                return;
+            }
+            if (inputStr == "EconomyServiceInternalError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEconomyServiceInternalError;
+                return;
+            }
+            if (inputStr == "QueryRateLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesQueryRateLimitExceeded;
+                return;
+            }
+            if (inputStr == "EntityAPIKeyCreationDisabledForEntity")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEntityAPIKeyCreationDisabledForEntity;
+                return;
+            }
+            if (inputStr == "ForbiddenByEntityPolicy")
+            {
+                output = GenericErrorCodes::GenericErrorCodesForbiddenByEntityPolicy;
+                return;
+            }
+            if (inputStr == "UpdateInventoryRateLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesUpdateInventoryRateLimitExceeded;
+                return;
+            }
+            if (inputStr == "StudioCreationRateLimited")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStudioCreationRateLimited;
+                return;
+            }
+            if (inputStr == "StudioCreationInProgress")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStudioCreationInProgress;
+                return;
+            }
+            if (inputStr == "DuplicateStudioName")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDuplicateStudioName;
+                return;
+            }
+            if (inputStr == "StudioNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStudioNotFound;
+                return;
+            }
+            if (inputStr == "StudioDeleted")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStudioDeleted;
+                return;
+            }
+            if (inputStr == "StudioDeactivated")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStudioDeactivated;
+                return;
+            }
+            if (inputStr == "StudioActivated")
+            {
+                output = GenericErrorCodes::GenericErrorCodesStudioActivated;
+                return;
+            }
+            if (inputStr == "TitleCreationRateLimited")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleCreationRateLimited;
+                return;
+            }
+            if (inputStr == "TitleCreationInProgress")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleCreationInProgress;
+                return;
+            }
+            if (inputStr == "DuplicateTitleName")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDuplicateTitleName;
+                return;
+            }
+            if (inputStr == "TitleActivationRateLimited")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleActivationRateLimited;
+                return;
+            }
+            if (inputStr == "TitleActivationInProgress")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleActivationInProgress;
+                return;
+            }
+            if (inputStr == "TitleDeactivated")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleDeactivated;
+                return;
+            }
+            if (inputStr == "TitleActivated")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleActivated;
+                return;
+            }
+            if (inputStr == "CloudScriptAzureFunctionsExecutionTimeLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCloudScriptAzureFunctionsExecutionTimeLimitExceeded;
+                return;
+            }
+            if (inputStr == "CloudScriptAzureFunctionsArgumentSizeExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCloudScriptAzureFunctionsArgumentSizeExceeded;
+                return;
+            }
+            if (inputStr == "CloudScriptAzureFunctionsReturnSizeExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCloudScriptAzureFunctionsReturnSizeExceeded;
+                return;
+            }
+            if (inputStr == "CloudScriptAzureFunctionsHTTPRequestError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCloudScriptAzureFunctionsHTTPRequestError;
+                return;
+            }
+            if (inputStr == "VirtualCurrencyBetaGetError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesVirtualCurrencyBetaGetError;
+                return;
+            }
+            if (inputStr == "VirtualCurrencyBetaCreateError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesVirtualCurrencyBetaCreateError;
+                return;
+            }
+            if (inputStr == "VirtualCurrencyBetaInitialDepositSaveError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesVirtualCurrencyBetaInitialDepositSaveError;
+                return;
+            }
+            if (inputStr == "VirtualCurrencyBetaSaveError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesVirtualCurrencyBetaSaveError;
+                return;
+            }
+            if (inputStr == "VirtualCurrencyBetaDeleteError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesVirtualCurrencyBetaDeleteError;
+                return;
+            }
+            if (inputStr == "VirtualCurrencyBetaRestoreError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesVirtualCurrencyBetaRestoreError;
+                return;
+            }
+            if (inputStr == "VirtualCurrencyBetaSaveConflict")
+            {
+                output = GenericErrorCodes::GenericErrorCodesVirtualCurrencyBetaSaveConflict;
+                return;
+            }
+            if (inputStr == "VirtualCurrencyBetaUpdateError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesVirtualCurrencyBetaUpdateError;
+                return;
+            }
+            if (inputStr == "InsightsManagementDatabaseNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInsightsManagementDatabaseNotFound;
+                return;
+            }
+            if (inputStr == "InsightsManagementOperationNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInsightsManagementOperationNotFound;
+                return;
+            }
+            if (inputStr == "InsightsManagementErrorPendingOperationExists")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInsightsManagementErrorPendingOperationExists;
+                return;
+            }
+            if (inputStr == "InsightsManagementSetPerformanceLevelInvalidParameter")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInsightsManagementSetPerformanceLevelInvalidParameter;
+                return;
+            }
+            if (inputStr == "InsightsManagementSetStorageRetentionInvalidParameter")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInsightsManagementSetStorageRetentionInvalidParameter;
+                return;
+            }
+            if (inputStr == "InsightsManagementGetStorageUsageInvalidParameter")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInsightsManagementGetStorageUsageInvalidParameter;
+                return;
+            }
+            if (inputStr == "InsightsManagementGetOperationStatusInvalidParameter")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInsightsManagementGetOperationStatusInvalidParameter;
+                return;
+            }
+            if (inputStr == "DuplicatePurchaseTransactionId")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDuplicatePurchaseTransactionId;
+                return;
+            }
+            if (inputStr == "EvaluationModePlayerCountExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEvaluationModePlayerCountExceeded;
+                return;
+            }
+            if (inputStr == "GetPlayersInSegmentRateLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGetPlayersInSegmentRateLimitExceeded;
+                return;
+            }
+            if (inputStr == "CloudScriptFunctionNameSizeExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCloudScriptFunctionNameSizeExceeded;
+                return;
+            }
+            if (inputStr == "InsightsManagementTitleInEvaluationMode")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInsightsManagementTitleInEvaluationMode;
+                return;
+            }
+            if (inputStr == "CloudScriptAzureFunctionsQueueRequestError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCloudScriptAzureFunctionsQueueRequestError;
+                return;
+            }
+            if (inputStr == "EvaluationModeTitleCountExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesEvaluationModeTitleCountExceeded;
+                return;
+            }
+            if (inputStr == "InsightsManagementTitleNotInFlight")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInsightsManagementTitleNotInFlight;
+                return;
+            }
+            if (inputStr == "LimitNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesLimitNotFound;
+                return;
+            }
+            if (inputStr == "LimitNotAvailableViaAPI")
+            {
+                output = GenericErrorCodes::GenericErrorCodesLimitNotAvailableViaAPI;
+                return;
+            }
+            if (inputStr == "InsightsManagementSetStorageRetentionBelowMinimum")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInsightsManagementSetStorageRetentionBelowMinimum;
+                return;
+            }
+            if (inputStr == "InsightsManagementSetStorageRetentionAboveMaximum")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInsightsManagementSetStorageRetentionAboveMaximum;
+                return;
+            }
+            if (inputStr == "AppleNotEnabledForTitle")
+            {
+                output = GenericErrorCodes::GenericErrorCodesAppleNotEnabledForTitle;
+                return;
+            }
+            if (inputStr == "InsightsManagementNewActiveEventExportLimitInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInsightsManagementNewActiveEventExportLimitInvalid;
+                return;
+            }
+            if (inputStr == "InsightsManagementSetPerformanceRateLimited")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInsightsManagementSetPerformanceRateLimited;
+                return;
+            }
+            if (inputStr == "PartyRequestsThrottledFromRateLimiter")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPartyRequestsThrottledFromRateLimiter;
+                return;
+            }
+            if (inputStr == "XboxServiceTooManyRequests")
+            {
+                output = GenericErrorCodes::GenericErrorCodesXboxServiceTooManyRequests;
+                return;
+            }
+            if (inputStr == "NintendoSwitchNotEnabledForTitle")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNintendoSwitchNotEnabledForTitle;
+                return;
+            }
+            if (inputStr == "RequestMultiplayerServersThrottledFromRateLimiter")
+            {
+                output = GenericErrorCodes::GenericErrorCodesRequestMultiplayerServersThrottledFromRateLimiter;
+                return;
+            }
+            if (inputStr == "TitleDataOverrideNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleDataOverrideNotFound;
+                return;
+            }
+            if (inputStr == "DuplicateKeys")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDuplicateKeys;
+                return;
+            }
+            if (inputStr == "WasNotCreatedWithCloudRoot")
+            {
+                output = GenericErrorCodes::GenericErrorCodesWasNotCreatedWithCloudRoot;
+                return;
+            }
+            if (inputStr == "LegacyMultiplayerServersDeprecated")
+            {
+                output = GenericErrorCodes::GenericErrorCodesLegacyMultiplayerServersDeprecated;
+                return;
+            }
+            if (inputStr == "VirtualCurrencyCurrentlyUnavailable")
+            {
+                output = GenericErrorCodes::GenericErrorCodesVirtualCurrencyCurrentlyUnavailable;
+                return;
+            }
+            if (inputStr == "SteamUserNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSteamUserNotFound;
+                return;
+            }
+            if (inputStr == "ElasticSearchOperationFailed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesElasticSearchOperationFailed;
+                return;
+            }
+            if (inputStr == "MatchmakingEntityInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingEntityInvalid;
+                return;
+            }
+            if (inputStr == "MatchmakingPlayerAttributesInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingPlayerAttributesInvalid;
+                return;
+            }
+            if (inputStr == "MatchmakingQueueNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingQueueNotFound;
+                return;
+            }
+            if (inputStr == "MatchmakingMatchNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingMatchNotFound;
+                return;
+            }
+            if (inputStr == "MatchmakingTicketNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingTicketNotFound;
+                return;
+            }
+            if (inputStr == "MatchmakingAlreadyJoinedTicket")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingAlreadyJoinedTicket;
+                return;
+            }
+            if (inputStr == "MatchmakingTicketAlreadyCompleted")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingTicketAlreadyCompleted;
+                return;
+            }
+            if (inputStr == "MatchmakingQueueConfigInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingQueueConfigInvalid;
+                return;
+            }
+            if (inputStr == "MatchmakingMemberProfileInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingMemberProfileInvalid;
+                return;
+            }
+            if (inputStr == "NintendoSwitchDeviceIdNotLinked")
+            {
+                output = GenericErrorCodes::GenericErrorCodesNintendoSwitchDeviceIdNotLinked;
+                return;
+            }
+            if (inputStr == "MatchmakingNotEnabled")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingNotEnabled;
+                return;
+            }
+            if (inputStr == "MatchmakingPlayerAttributesTooLarge")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingPlayerAttributesTooLarge;
+                return;
+            }
+            if (inputStr == "MatchmakingNumberOfPlayersInTicketTooLarge")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingNumberOfPlayersInTicketTooLarge;
+                return;
+            }
+            if (inputStr == "MatchmakingAttributeInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingAttributeInvalid;
+                return;
+            }
+            if (inputStr == "MatchmakingPlayerHasNotJoinedTicket")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingPlayerHasNotJoinedTicket;
+                return;
+            }
+            if (inputStr == "MatchmakingRateLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingRateLimitExceeded;
+                return;
+            }
+            if (inputStr == "MatchmakingTicketMembershipLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingTicketMembershipLimitExceeded;
+                return;
+            }
+            if (inputStr == "MatchmakingUnauthorized")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingUnauthorized;
+                return;
+            }
+            if (inputStr == "MatchmakingQueueLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingQueueLimitExceeded;
+                return;
+            }
+            if (inputStr == "MatchmakingRequestTypeMismatch")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingRequestTypeMismatch;
+                return;
+            }
+            if (inputStr == "MatchmakingBadRequest")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMatchmakingBadRequest;
+                return;
+            }
+            if (inputStr == "TitleConfigNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleConfigNotFound;
+                return;
+            }
+            if (inputStr == "TitleConfigUpdateConflict")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleConfigUpdateConflict;
+                return;
+            }
+            if (inputStr == "TitleConfigSerializationError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleConfigSerializationError;
+                return;
+            }
+            if (inputStr == "CatalogApiNotImplemented")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCatalogApiNotImplemented;
+                return;
+            }
+            if (inputStr == "CatalogEntityInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCatalogEntityInvalid;
+                return;
+            }
+            if (inputStr == "CatalogTitleIdMissing")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCatalogTitleIdMissing;
+                return;
+            }
+            if (inputStr == "CatalogPlayerIdMissing")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCatalogPlayerIdMissing;
+                return;
+            }
+            if (inputStr == "CatalogClientIdentityInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCatalogClientIdentityInvalid;
+                return;
+            }
+            if (inputStr == "CatalogOneOrMoreFilesInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCatalogOneOrMoreFilesInvalid;
+                return;
+            }
+            if (inputStr == "CatalogItemMetadataInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCatalogItemMetadataInvalid;
+                return;
+            }
+            if (inputStr == "CatalogItemIdInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCatalogItemIdInvalid;
+                return;
+            }
+            if (inputStr == "CatalogSearchParameterInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCatalogSearchParameterInvalid;
+                return;
+            }
+            if (inputStr == "CatalogFeatureDisabled")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCatalogFeatureDisabled;
+                return;
+            }
+            if (inputStr == "CatalogConfigInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCatalogConfigInvalid;
+                return;
+            }
+            if (inputStr == "CatalogItemTypeInvalid")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCatalogItemTypeInvalid;
+                return;
+            }
+            if (inputStr == "CatalogBadRequest")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCatalogBadRequest;
+                return;
+            }
+            if (inputStr == "CatalogTooManyRequests")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCatalogTooManyRequests;
+                return;
+            }
+            if (inputStr == "ExportInvalidStatusUpdate")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportInvalidStatusUpdate;
+                return;
+            }
+            if (inputStr == "ExportInvalidPrefix")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportInvalidPrefix;
+                return;
+            }
+            if (inputStr == "ExportBlobContainerDoesNotExist")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportBlobContainerDoesNotExist;
+                return;
+            }
+            if (inputStr == "ExportNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportNotFound;
+                return;
+            }
+            if (inputStr == "ExportCouldNotUpdate")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportCouldNotUpdate;
+                return;
+            }
+            if (inputStr == "ExportInvalidStorageType")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportInvalidStorageType;
+                return;
+            }
+            if (inputStr == "ExportAmazonBucketDoesNotExist")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportAmazonBucketDoesNotExist;
+                return;
+            }
+            if (inputStr == "ExportInvalidBlobStorage")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportInvalidBlobStorage;
+                return;
+            }
+            if (inputStr == "ExportKustoException")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportKustoException;
+                return;
+            }
+            if (inputStr == "ExportKustoConnectionFailed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportKustoConnectionFailed;
+                return;
+            }
+            if (inputStr == "ExportUnknownError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportUnknownError;
+                return;
+            }
+            if (inputStr == "ExportCantEditPendingExport")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportCantEditPendingExport;
+                return;
+            }
+            if (inputStr == "ExportLimitExports")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportLimitExports;
+                return;
+            }
+            if (inputStr == "ExportLimitEvents")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportLimitEvents;
+                return;
+            }
+            if (inputStr == "ExportInvalidPartitionStatusModification")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportInvalidPartitionStatusModification;
+                return;
+            }
+            if (inputStr == "ExportCouldNotCreate")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportCouldNotCreate;
+                return;
+            }
+            if (inputStr == "ExportNoBackingDatabaseFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportNoBackingDatabaseFound;
+                return;
+            }
+            if (inputStr == "ExportCouldNotDelete")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportCouldNotDelete;
+                return;
+            }
+            if (inputStr == "ExportCannotDetermineEventQuery")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportCannotDetermineEventQuery;
+                return;
+            }
+            if (inputStr == "ExportInvalidQuerySchemaModification")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportInvalidQuerySchemaModification;
+                return;
+            }
+            if (inputStr == "ExportQuerySchemaMissingRequiredColumns")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportQuerySchemaMissingRequiredColumns;
+                return;
+            }
+            if (inputStr == "ExportCannotParseQuery")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportCannotParseQuery;
+                return;
+            }
+            if (inputStr == "ExportControlCommandsNotAllowed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportControlCommandsNotAllowed;
+                return;
+            }
+            if (inputStr == "ExportQueryMissingTableReference")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExportQueryMissingTableReference;
+                return;
+            }
+            if (inputStr == "ExplorerBasicInvalidQueryName")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExplorerBasicInvalidQueryName;
+                return;
+            }
+            if (inputStr == "ExplorerBasicInvalidQueryDescription")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExplorerBasicInvalidQueryDescription;
+                return;
+            }
+            if (inputStr == "ExplorerBasicInvalidQueryConditions")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExplorerBasicInvalidQueryConditions;
+                return;
+            }
+            if (inputStr == "ExplorerBasicInvalidQueryStartDate")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExplorerBasicInvalidQueryStartDate;
+                return;
+            }
+            if (inputStr == "ExplorerBasicInvalidQueryEndDate")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExplorerBasicInvalidQueryEndDate;
+                return;
+            }
+            if (inputStr == "ExplorerBasicInvalidQueryGroupBy")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExplorerBasicInvalidQueryGroupBy;
+                return;
+            }
+            if (inputStr == "ExplorerBasicInvalidQueryAggregateType")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExplorerBasicInvalidQueryAggregateType;
+                return;
+            }
+            if (inputStr == "ExplorerBasicInvalidQueryAggregateProperty")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExplorerBasicInvalidQueryAggregateProperty;
+                return;
+            }
+            if (inputStr == "ExplorerBasicLoadQueriesError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExplorerBasicLoadQueriesError;
+                return;
+            }
+            if (inputStr == "ExplorerBasicLoadQueryError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExplorerBasicLoadQueryError;
+                return;
+            }
+            if (inputStr == "ExplorerBasicCreateQueryError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExplorerBasicCreateQueryError;
+                return;
+            }
+            if (inputStr == "ExplorerBasicDeleteQueryError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExplorerBasicDeleteQueryError;
+                return;
+            }
+            if (inputStr == "ExplorerBasicUpdateQueryError")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExplorerBasicUpdateQueryError;
+                return;
+            }
+            if (inputStr == "ExplorerBasicSavedQueriesLimit")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExplorerBasicSavedQueriesLimit;
+                return;
+            }
+            if (inputStr == "ExplorerBasicSavedQueryNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExplorerBasicSavedQueryNotFound;
+                return;
+            }
+            if (inputStr == "TitleNotEnabledForParty")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleNotEnabledForParty;
+                return;
+            }
+            if (inputStr == "PartyVersionNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesPartyVersionNotFound;
+                return;
+            }
+            if (inputStr == "MultiplayerServerBuildReferencedByMatchmakingQueue")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMultiplayerServerBuildReferencedByMatchmakingQueue;
+                return;
+            }
+            if (inputStr == "ExperimentationExperimentStopped")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationExperimentStopped;
+                return;
+            }
+            if (inputStr == "ExperimentationExperimentRunning")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationExperimentRunning;
+                return;
+            }
+            if (inputStr == "ExperimentationExperimentNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationExperimentNotFound;
+                return;
+            }
+            if (inputStr == "ExperimentationExperimentNeverStarted")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationExperimentNeverStarted;
+                return;
+            }
+            if (inputStr == "ExperimentationExperimentDeleted")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationExperimentDeleted;
+                return;
+            }
+            if (inputStr == "ExperimentationClientTimeout")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationClientTimeout;
+                return;
+            }
+            if (inputStr == "ExperimentationInvalidVariantConfiguration")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationInvalidVariantConfiguration;
+                return;
+            }
+            if (inputStr == "ExperimentationInvalidVariableConfiguration")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationInvalidVariableConfiguration;
+                return;
+            }
+            if (inputStr == "ExperimentInvalidId")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentInvalidId;
+                return;
+            }
+            if (inputStr == "ExperimentationNoScorecard")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationNoScorecard;
+                return;
+            }
+            if (inputStr == "ExperimentationTreatmentAssignmentFailed")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationTreatmentAssignmentFailed;
+                return;
+            }
+            if (inputStr == "ExperimentationTreatmentAssignmentDisabled")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationTreatmentAssignmentDisabled;
+                return;
+            }
+            if (inputStr == "ExperimentationInvalidDuration")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationInvalidDuration;
+                return;
+            }
+            if (inputStr == "ExperimentationMaxExperimentsReached")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationMaxExperimentsReached;
+                return;
+            }
+            if (inputStr == "ExperimentationExperimentSchedulingInProgress")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationExperimentSchedulingInProgress;
+                return;
+            }
+            if (inputStr == "ExperimentationInvalidEndDate")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationInvalidEndDate;
+                return;
+            }
+            if (inputStr == "ExperimentationInvalidStartDate")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationInvalidStartDate;
+                return;
+            }
+            if (inputStr == "ExperimentationMaxDurationExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationMaxDurationExceeded;
+                return;
+            }
+            if (inputStr == "ExperimentationExclusionGroupNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationExclusionGroupNotFound;
+                return;
+            }
+            if (inputStr == "ExperimentationExclusionGroupInsufficientCapacity")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationExclusionGroupInsufficientCapacity;
+                return;
+            }
+            if (inputStr == "ExperimentationExclusionGroupCannotDelete")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationExclusionGroupCannotDelete;
+                return;
+            }
+            if (inputStr == "ExperimentationExclusionGroupInvalidTrafficAllocation")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationExclusionGroupInvalidTrafficAllocation;
+                return;
+            }
+            if (inputStr == "ExperimentationExclusionGroupInvalidName")
+            {
+                output = GenericErrorCodes::GenericErrorCodesExperimentationExclusionGroupInvalidName;
+                return;
+            }
+            if (inputStr == "MaxActionDepthExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesMaxActionDepthExceeded;
+                return;
+            }
+            if (inputStr == "TitleNotOnUpdatedPricingPlan")
+            {
+                output = GenericErrorCodes::GenericErrorCodesTitleNotOnUpdatedPricingPlan;
+                return;
+            }
+            if (inputStr == "SegmentManagementTitleNotInFlight")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSegmentManagementTitleNotInFlight;
+                return;
+            }
+            if (inputStr == "SegmentManagementNoExpressionTree")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSegmentManagementNoExpressionTree;
+                return;
+            }
+            if (inputStr == "SegmentManagementTriggerActionCountOverLimit")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSegmentManagementTriggerActionCountOverLimit;
+                return;
+            }
+            if (inputStr == "SegmentManagementSegmentCountOverLimit")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSegmentManagementSegmentCountOverLimit;
+                return;
+            }
+            if (inputStr == "SegmentManagementInvalidSegmentId")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSegmentManagementInvalidSegmentId;
+                return;
+            }
+            if (inputStr == "SegmentManagementInvalidInput")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSegmentManagementInvalidInput;
+                return;
+            }
+            if (inputStr == "SegmentManagementInvalidSegmentName")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSegmentManagementInvalidSegmentName;
+                return;
+            }
+            if (inputStr == "DeleteSegmentRateLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesDeleteSegmentRateLimitExceeded;
+                return;
+            }
+            if (inputStr == "CreateSegmentRateLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesCreateSegmentRateLimitExceeded;
+                return;
+            }
+            if (inputStr == "UpdateSegmentRateLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesUpdateSegmentRateLimitExceeded;
+                return;
+            }
+            if (inputStr == "GetSegmentsRateLimitExceeded")
+            {
+                output = GenericErrorCodes::GenericErrorCodesGetSegmentsRateLimitExceeded;
+                return;
+            }
+            if (inputStr == "SnapshotNotFound")
+            {
+                output = GenericErrorCodes::GenericErrorCodesSnapshotNotFound;
+                return;
+            }
+            if (inputStr == "InventoryApiNotImplemented")
+            {
+                output = GenericErrorCodes::GenericErrorCodesInventoryApiNotImplemented;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const LoginIdentityProvider input, Json::Value& output)
+        {
+            if (input == LoginIdentityProvider::LoginIdentityProviderUnknown)
+            {
+                output = Json::Value(Json::StaticString("Unknown"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderPlayFab)
+            {
+                output = Json::Value(Json::StaticString("PlayFab"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderCustom)
+            {
+                output = Json::Value(Json::StaticString("Custom"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderGameCenter)
+            {
+                output = Json::Value(Json::StaticString("GameCenter"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderGooglePlay)
+            {
+                output = Json::Value(Json::StaticString("GooglePlay"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderSteam)
+            {
+                output = Json::Value(Json::StaticString("Steam"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderXBoxLive)
+            {
+                output = Json::Value(Json::StaticString("XBoxLive"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderPSN)
+            {
+                output = Json::Value(Json::StaticString("PSN"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderKongregate)
+            {
+                output = Json::Value(Json::StaticString("Kongregate"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderFacebook)
+            {
+                output = Json::Value(Json::StaticString("Facebook"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderIOSDevice)
+            {
+                output = Json::Value(Json::StaticString("IOSDevice"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderAndroidDevice)
+            {
+                output = Json::Value(Json::StaticString("AndroidDevice"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderTwitch)
+            {
+                output = Json::Value(Json::StaticString("Twitch"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderWindowsHello)
+            {
+                output = Json::Value(Json::StaticString("WindowsHello"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderGameServer)
+            {
+                output = Json::Value(Json::StaticString("GameServer"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderCustomServer)
+            {
+                output = Json::Value(Json::StaticString("CustomServer"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderNintendoSwitch)
+            {
+                output = Json::Value(Json::StaticString("NintendoSwitch"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderFacebookInstantGames)
+            {
+                output = Json::Value(Json::StaticString("FacebookInstantGames"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderOpenIdConnect)
+            {
+                output = Json::Value(Json::StaticString("OpenIdConnect"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderApple)
+            {
+                output = Json::Value(Json::StaticString("Apple"));
+                return;
+            }
+            if (input == LoginIdentityProvider::LoginIdentityProviderNintendoSwitchAccount)
+            {
+                output = Json::Value(Json::StaticString("NintendoSwitchAccount"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, LoginIdentityProvider& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Unknown")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderUnknown;
+                return;
+            }
+            if (inputStr == "PlayFab")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderPlayFab;
+                return;
+            }
+            if (inputStr == "Custom")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderCustom;
+                return;
+            }
+            if (inputStr == "GameCenter")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderGameCenter;
+                return;
+            }
+            if (inputStr == "GooglePlay")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderGooglePlay;
+                return;
+            }
+            if (inputStr == "Steam")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderSteam;
+                return;
+            }
+            if (inputStr == "XBoxLive")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderXBoxLive;
+                return;
+            }
+            if (inputStr == "PSN")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderPSN;
+                return;
+            }
+            if (inputStr == "Kongregate")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderKongregate;
+                return;
+            }
+            if (inputStr == "Facebook")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderFacebook;
+                return;
+            }
+            if (inputStr == "IOSDevice")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderIOSDevice;
+                return;
+            }
+            if (inputStr == "AndroidDevice")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderAndroidDevice;
+                return;
+            }
+            if (inputStr == "Twitch")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderTwitch;
+                return;
+            }
+            if (inputStr == "WindowsHello")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderWindowsHello;
+                return;
+            }
+            if (inputStr == "GameServer")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderGameServer;
+                return;
+            }
+            if (inputStr == "CustomServer")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderCustomServer;
+                return;
+            }
+            if (inputStr == "NintendoSwitch")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderNintendoSwitch;
+                return;
+            }
+            if (inputStr == "FacebookInstantGames")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderFacebookInstantGames;
+                return;
+            }
+            if (inputStr == "OpenIdConnect")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderOpenIdConnect;
+                return;
+            }
+            if (inputStr == "Apple")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderApple;
+                return;
+            }
+            if (inputStr == "NintendoSwitchAccount")
+            {
+                output = LoginIdentityProvider::LoginIdentityProviderNintendoSwitchAccount;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const PlayerConnectionState input, Json::Value& output)
+        {
+            if (input == PlayerConnectionState::PlayerConnectionStateUnassigned)
+            {
+                output = Json::Value(Json::StaticString("Unassigned"));
+                return;
+            }
+            if (input == PlayerConnectionState::PlayerConnectionStateConnecting)
+            {
+                output = Json::Value(Json::StaticString("Connecting"));
+                return;
+            }
+            if (input == PlayerConnectionState::PlayerConnectionStateParticipating)
+            {
+                output = Json::Value(Json::StaticString("Participating"));
+                return;
+            }
+            if (input == PlayerConnectionState::PlayerConnectionStateParticipated)
+            {
+                output = Json::Value(Json::StaticString("Participated"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, PlayerConnectionState& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Unassigned")
+            {
+                output = PlayerConnectionState::PlayerConnectionStateUnassigned;
+                return;
+            }
+            if (inputStr == "Connecting")
+            {
+                output = PlayerConnectionState::PlayerConnectionStateConnecting;
+                return;
+            }
+            if (inputStr == "Participating")
+            {
+                output = PlayerConnectionState::PlayerConnectionStateParticipating;
+                return;
+            }
+            if (inputStr == "Participated")
+            {
+                output = PlayerConnectionState::PlayerConnectionStateParticipated;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const PushNotificationPlatform input, Json::Value& output)
+        {
+            if (input == PushNotificationPlatform::PushNotificationPlatformApplePushNotificationService)
+            {
+                output = Json::Value(Json::StaticString("ApplePushNotificationService"));
+                return;
+            }
+            if (input == PushNotificationPlatform::PushNotificationPlatformGoogleCloudMessaging)
+            {
+                output = Json::Value(Json::StaticString("GoogleCloudMessaging"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, PushNotificationPlatform& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "ApplePushNotificationService")
+            {
+                output = PushNotificationPlatform::PushNotificationPlatformApplePushNotificationService;
+                return;
+            }
+            if (inputStr == "GoogleCloudMessaging")
+            {
+                output = PushNotificationPlatform::PushNotificationPlatformGoogleCloudMessaging;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const Region input, Json::Value& output)
+        {
+            if (input == Region::RegionUSCentral)
+            {
+                output = Json::Value(Json::StaticString("USCentral"));
+                return;
+            }
+            if (input == Region::RegionUSEast)
+            {
+                output = Json::Value(Json::StaticString("USEast"));
+                return;
+            }
+            if (input == Region::RegionEUWest)
+            {
+                output = Json::Value(Json::StaticString("EUWest"));
+                return;
+            }
+            if (input == Region::RegionSingapore)
+            {
+                output = Json::Value(Json::StaticString("Singapore"));
+                return;
+            }
+            if (input == Region::RegionJapan)
+            {
+                output = Json::Value(Json::StaticString("Japan"));
+                return;
+            }
+            if (input == Region::RegionBrazil)
+            {
+                output = Json::Value(Json::StaticString("Brazil"));
+                return;
+            }
+            if (input == Region::RegionAustralia)
+            {
+                output = Json::Value(Json::StaticString("Australia"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, Region& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "USCentral")
+            {
+                output = Region::RegionUSCentral;
+                return;
+            }
+            if (inputStr == "USEast")
+            {
+                output = Region::RegionUSEast;
+                return;
+            }
+            if (inputStr == "EUWest")
+            {
+                output = Region::RegionEUWest;
+                return;
+            }
+            if (inputStr == "Singapore")
+            {
+                output = Region::RegionSingapore;
+                return;
+            }
+            if (inputStr == "Japan")
+            {
+                output = Region::RegionJapan;
+                return;
+            }
+            if (inputStr == "Brazil")
+            {
+                output = Region::RegionBrazil;
+                return;
+            }
+            if (inputStr == "Australia")
+            {
+                output = Region::RegionAustralia;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const ResultTableNodeType input, Json::Value& output)
+        {
+            if (input == ResultTableNodeType::ResultTableNodeTypeItemId)
+            {
+                output = Json::Value(Json::StaticString("ItemId"));
+                return;
+            }
+            if (input == ResultTableNodeType::ResultTableNodeTypeTableId)
+            {
+                output = Json::Value(Json::StaticString("TableId"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, ResultTableNodeType& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "ItemId")
+            {
+                output = ResultTableNodeType::ResultTableNodeTypeItemId;
+                return;
+            }
+            if (inputStr == "TableId")
+            {
+                output = ResultTableNodeType::ResultTableNodeTypeTableId;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const SourceType input, Json::Value& output)
+        {
+            if (input == SourceType::SourceTypeAdmin)
+            {
+                output = Json::Value(Json::StaticString("Admin"));
+                return;
+            }
+            if (input == SourceType::SourceTypeBackEnd)
+            {
+                output = Json::Value(Json::StaticString("BackEnd"));
+                return;
+            }
+            if (input == SourceType::SourceTypeGameClient)
+            {
+                output = Json::Value(Json::StaticString("GameClient"));
+                return;
+            }
+            if (input == SourceType::SourceTypeGameServer)
+            {
+                output = Json::Value(Json::StaticString("GameServer"));
+                return;
+            }
+            if (input == SourceType::SourceTypePartner)
+            {
+                output = Json::Value(Json::StaticString("Partner"));
+                return;
+            }
+            if (input == SourceType::SourceTypeCustom)
+            {
+                output = Json::Value(Json::StaticString("Custom"));
+                return;
+            }
+            if (input == SourceType::SourceTypeAPI)
+            {
+                output = Json::Value(Json::StaticString("API"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, SourceType& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Admin")
+            {
+                output = SourceType::SourceTypeAdmin;
+                return;
+            }
+            if (inputStr == "BackEnd")
+            {
+                output = SourceType::SourceTypeBackEnd;
+                return;
+            }
+            if (inputStr == "GameClient")
+            {
+                output = SourceType::SourceTypeGameClient;
+                return;
+            }
+            if (inputStr == "GameServer")
+            {
+                output = SourceType::SourceTypeGameServer;
+                return;
+            }
+            if (inputStr == "Partner")
+            {
+                output = SourceType::SourceTypePartner;
+                return;
+            }
+            if (inputStr == "Custom")
+            {
+                output = SourceType::SourceTypeCustom;
+                return;
+            }
+            if (inputStr == "API")
+            {
+                output = SourceType::SourceTypeAPI;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const SubscriptionProviderStatus input, Json::Value& output)
+        {
+            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusNoError)
+            {
+                output = Json::Value(Json::StaticString("NoError"));
+                return;
+            }
+            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusCancelled)
+            {
+                output = Json::Value(Json::StaticString("Cancelled"));
+                return;
+            }
+            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusUnknownError)
+            {
+                output = Json::Value(Json::StaticString("UnknownError"));
+                return;
+            }
+            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusBillingError)
+            {
+                output = Json::Value(Json::StaticString("BillingError"));
+                return;
+            }
+            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusProductUnavailable)
+            {
+                output = Json::Value(Json::StaticString("ProductUnavailable"));
+                return;
+            }
+            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusCustomerDidNotAcceptPriceChange)
+            {
+                output = Json::Value(Json::StaticString("CustomerDidNotAcceptPriceChange"));
+                return;
+            }
+            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusFreeTrial)
+            {
+                output = Json::Value(Json::StaticString("FreeTrial"));
+                return;
+            }
+            if (input == SubscriptionProviderStatus::SubscriptionProviderStatusPaymentPending)
+            {
+                output = Json::Value(Json::StaticString("PaymentPending"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, SubscriptionProviderStatus& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "NoError")
+            {
+                output = SubscriptionProviderStatus::SubscriptionProviderStatusNoError;
+                return;
+            }
+            if (inputStr == "Cancelled")
+            {
+                output = SubscriptionProviderStatus::SubscriptionProviderStatusCancelled;
+                return;
+            }
+            if (inputStr == "UnknownError")
+            {
+                output = SubscriptionProviderStatus::SubscriptionProviderStatusUnknownError;
+                return;
+            }
+            if (inputStr == "BillingError")
+            {
+                output = SubscriptionProviderStatus::SubscriptionProviderStatusBillingError;
+                return;
+            }
+            if (inputStr == "ProductUnavailable")
+            {
+                output = SubscriptionProviderStatus::SubscriptionProviderStatusProductUnavailable;
+                return;
+            }
+            if (inputStr == "CustomerDidNotAcceptPriceChange")
+            {
+                output = SubscriptionProviderStatus::SubscriptionProviderStatusCustomerDidNotAcceptPriceChange;
+                return;
+            }
+            if (inputStr == "FreeTrial")
+            {
+                output = SubscriptionProviderStatus::SubscriptionProviderStatusFreeTrial;
+                return;
+            }
+            if (inputStr == "PaymentPending")
+            {
+                output = SubscriptionProviderStatus::SubscriptionProviderStatusPaymentPending;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const TitleActivationStatus input, Json::Value& output)
+        {
+            if (input == TitleActivationStatus::TitleActivationStatusNone)
+            {
+                output = Json::Value(Json::StaticString("None"));
+                return;
+            }
+            if (input == TitleActivationStatus::TitleActivationStatusActivatedTitleKey)
+            {
+                output = Json::Value(Json::StaticString("ActivatedTitleKey"));
+                return;
+            }
+            if (input == TitleActivationStatus::TitleActivationStatusPendingSteam)
+            {
+                output = Json::Value(Json::StaticString("PendingSteam"));
+                return;
+            }
+            if (input == TitleActivationStatus::TitleActivationStatusActivatedSteam)
+            {
+                output = Json::Value(Json::StaticString("ActivatedSteam"));
+                return;
+            }
+            if (input == TitleActivationStatus::TitleActivationStatusRevokedSteam)
+            {
+                output = Json::Value(Json::StaticString("RevokedSteam"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, TitleActivationStatus& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "None")
+            {
+                output = TitleActivationStatus::TitleActivationStatusNone;
+                return;
+            }
+            if (inputStr == "ActivatedTitleKey")
+            {
+                output = TitleActivationStatus::TitleActivationStatusActivatedTitleKey;
+                return;
+            }
+            if (inputStr == "PendingSteam")
+            {
+                output = TitleActivationStatus::TitleActivationStatusPendingSteam;
+                return;
+            }
+            if (inputStr == "ActivatedSteam")
+            {
+                output = TitleActivationStatus::TitleActivationStatusActivatedSteam;
+                return;
+            }
+            if (inputStr == "RevokedSteam")
+            {
+                output = TitleActivationStatus::TitleActivationStatusRevokedSteam;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const UserDataPermission input, Json::Value& output)
+        {
+            if (input == UserDataPermission::UserDataPermissionPrivate)
+            {
+                output = Json::Value(Json::StaticString("Private"));
+                return;
+            }
+            if (input == UserDataPermission::UserDataPermissionPublic)
+            {
+                output = Json::Value(Json::StaticString("Public"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, UserDataPermission& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Private")
+            {
+                output = UserDataPermission::UserDataPermissionPrivate;
+                return;
+            }
+            if (inputStr == "Public")
+            {
+                output = UserDataPermission::UserDataPermissionPublic;
+                return;
+            }
+        }
+
+        void ToJsonEnum(const UserOrigination input, Json::Value& output)
+        {
+            if (input == UserOrigination::UserOriginationOrganic)
+            {
+                output = Json::Value(Json::StaticString("Organic"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationSteam)
+            {
+                output = Json::Value(Json::StaticString("Steam"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationGoogle)
+            {
+                output = Json::Value(Json::StaticString("Google"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationAmazon)
+            {
+                output = Json::Value(Json::StaticString("Amazon"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationFacebook)
+            {
+                output = Json::Value(Json::StaticString("Facebook"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationKongregate)
+            {
+                output = Json::Value(Json::StaticString("Kongregate"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationGamersFirst)
+            {
+                output = Json::Value(Json::StaticString("GamersFirst"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationUnknown)
+            {
+                output = Json::Value(Json::StaticString("Unknown"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationIOS)
+            {
+                output = Json::Value(Json::StaticString("IOS"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationLoadTest)
+            {
+                output = Json::Value(Json::StaticString("LoadTest"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationAndroid)
+            {
+                output = Json::Value(Json::StaticString("Android"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationPSN)
+            {
+                output = Json::Value(Json::StaticString("PSN"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationGameCenter)
+            {
+                output = Json::Value(Json::StaticString("GameCenter"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationCustomId)
+            {
+                output = Json::Value(Json::StaticString("CustomId"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationXboxLive)
+            {
+                output = Json::Value(Json::StaticString("XboxLive"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationParse)
+            {
+                output = Json::Value(Json::StaticString("Parse"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationTwitch)
+            {
+                output = Json::Value(Json::StaticString("Twitch"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationWindowsHello)
+            {
+                output = Json::Value(Json::StaticString("WindowsHello"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationServerCustomId)
+            {
+                output = Json::Value(Json::StaticString("ServerCustomId"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationNintendoSwitchDeviceId)
+            {
+                output = Json::Value(Json::StaticString("NintendoSwitchDeviceId"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationFacebookInstantGamesId)
+            {
+                output = Json::Value(Json::StaticString("FacebookInstantGamesId"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationOpenIdConnect)
+            {
+                output = Json::Value(Json::StaticString("OpenIdConnect"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationApple)
+            {
+                output = Json::Value(Json::StaticString("Apple"));
+                return;
+            }
+            if (input == UserOrigination::UserOriginationNintendoSwitchAccount)
+            {
+                output = Json::Value(Json::StaticString("NintendoSwitchAccount"));
+                return;
+            }
+        }
+
+        void FromJsonEnum(const Json::Value& input, UserOrigination& output)
+        {
+            if (!input.isString())
+            {
+                return;
+            }
+            const std::string& inputStr = input.asString();
+            if (inputStr == "Organic")
+            {
+                output = UserOrigination::UserOriginationOrganic;
+                return;
+            }
+            if (inputStr == "Steam")
+            {
+                output = UserOrigination::UserOriginationSteam;
+                return;
+            }
+            if (inputStr == "Google")
+            {
+                output = UserOrigination::UserOriginationGoogle;
+                return;
+            }
+            if (inputStr == "Amazon")
+            {
+                output = UserOrigination::UserOriginationAmazon;
+                return;
+            }
+            if (inputStr == "Facebook")
+            {
+                output = UserOrigination::UserOriginationFacebook;
+                return;
+            }
+            if (inputStr == "Kongregate")
+            {
+                output = UserOrigination::UserOriginationKongregate;
+                return;
+            }
+            if (inputStr == "GamersFirst")
+            {
+                output = UserOrigination::UserOriginationGamersFirst;
+                return;
+            }
+            if (inputStr == "Unknown")
+            {
+                output = UserOrigination::UserOriginationUnknown;
+                return;
+            }
+            if (inputStr == "IOS")
+            {
+                output = UserOrigination::UserOriginationIOS;
+                return;
+            }
+            if (inputStr == "LoadTest")
+            {
+                output = UserOrigination::UserOriginationLoadTest;
+                return;
+            }
+            if (inputStr == "Android")
+            {
+                output = UserOrigination::UserOriginationAndroid;
+                return;
+            }
+            if (inputStr == "PSN")
+            {
+                output = UserOrigination::UserOriginationPSN;
+                return;
+            }
+            if (inputStr == "GameCenter")
+            {
+                output = UserOrigination::UserOriginationGameCenter;
+                return;
+            }
+            if (inputStr == "CustomId")
+            {
+                output = UserOrigination::UserOriginationCustomId;
+                return;
+            }
+            if (inputStr == "XboxLive")
+            {
+                output = UserOrigination::UserOriginationXboxLive;
+                return;
+            }
+            if (inputStr == "Parse")
+            {
+                output = UserOrigination::UserOriginationParse;
+                return;
+            }
+            if (inputStr == "Twitch")
+            {
+                output = UserOrigination::UserOriginationTwitch;
+                return;
+            }
+            if (inputStr == "WindowsHello")
+            {
+                output = UserOrigination::UserOriginationWindowsHello;
+                return;
+            }
+            if (inputStr == "ServerCustomId")
+            {
+                output = UserOrigination::UserOriginationServerCustomId;
+                return;
+            }
+            if (inputStr == "NintendoSwitchDeviceId")
+            {
+                output = UserOrigination::UserOriginationNintendoSwitchDeviceId;
+                return;
+            }
+            if (inputStr == "FacebookInstantGamesId")
+            {
+                output = UserOrigination::UserOriginationFacebookInstantGamesId;
+                return;
+            }
+            if (inputStr == "OpenIdConnect")
+            {
+                output = UserOrigination::UserOriginationOpenIdConnect;
+                return;
+            }
+            if (inputStr == "Apple")
+            {
+                output = UserOrigination::UserOriginationApple;
+                return;
+            }
+            if (inputStr == "NintendoSwitchAccount")
+            {
+                output = UserOrigination::UserOriginationNintendoSwitchAccount;
+                return;
+            }
+        }
+
+        void AdCampaignAttribution::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilT(FromJsonField(input, keyAttributedAt), AttributedAt);
+            FromJsonUtilS(FromJsonField(input, keyCampaignId), CampaignId);
+            FromJsonUtilS(FromJsonField(input, keyPlatform), Platform);
+        }
+
+        Json::Value AdCampaignAttribution::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AttributedAt; ToJsonUtilT(AttributedAt, each_AttributedAt); ToJsonField(output, keyAttributedAt) = each_AttributedAt;
+            Json::Value each_CampaignId; ToJsonUtilS(CampaignId, each_CampaignId); ToJsonField(output, keyCampaignId) = each_CampaignId;
+            Json::Value each_Platform; ToJsonUtilS(Platform, each_Platform); ToJsonField(output, keyPlatform) = each_Platform;
+            return output;
+        }
+
+        void AdCampaignAttributionModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilT(FromJsonField(input, keyAttributedAt), AttributedAt);
+            FromJsonUtilS(FromJsonField(input, keyCampaignId), CampaignId);
+            FromJsonUtilS(FromJsonField(input, keyPlatform), Platform);
+        }
+
+        Json::Value AdCampaignAttributionModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AttributedAt; ToJsonUtilT(AttributedAt, each_AttributedAt); ToJsonField(output, keyAttributedAt) = each_AttributedAt;
+            Json::Value each_CampaignId; ToJsonUtilS(CampaignId, each_CampaignId); ToJsonField(output, keyCampaignId) = each_CampaignId;
+            Json::Value each_Platform; ToJsonUtilS(Platform, each_Platform); ToJsonField(output, keyPlatform) = each_Platform;
+            return output;
+        }
+
+        void AddCharacterVirtualCurrencyRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyAmount), Amount);
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyVirtualCurrency), VirtualCurrency);
+        }
+
+        Json::Value AddCharacterVirtualCurrencyRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Amount; ToJsonUtilP(Amount, each_Amount); ToJsonField(output, keyAmount) = each_Amount;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_VirtualCurrency; ToJsonUtilS(VirtualCurrency, each_VirtualCurrency); ToJsonField(output, keyVirtualCurrency) = each_VirtualCurrency;
+            return output;
+        }
+
+        void AddFriendRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyFriendEmail), FriendEmail);
+            FromJsonUtilS(FromJsonField(input, keyFriendPlayFabId), FriendPlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyFriendTitleDisplayName), FriendTitleDisplayName);
+            FromJsonUtilS(FromJsonField(input, keyFriendUsername), FriendUsername);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value AddFriendRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_FriendEmail; ToJsonUtilS(FriendEmail, each_FriendEmail); ToJsonField(output, keyFriendEmail) = each_FriendEmail;
+            Json::Value each_FriendPlayFabId; ToJsonUtilS(FriendPlayFabId, each_FriendPlayFabId); ToJsonField(output, keyFriendPlayFabId) = each_FriendPlayFabId;
+            Json::Value each_FriendTitleDisplayName; ToJsonUtilS(FriendTitleDisplayName, each_FriendTitleDisplayName); ToJsonField(output, keyFriendTitleDisplayName) = each_FriendTitleDisplayName;
+            Json::Value each_FriendUsername; ToJsonUtilS(FriendUsername, each_FriendUsername); ToJsonField(output, keyFriendUsername) = each_FriendUsername;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void GenericServiceId::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyServiceName), ServiceName);
+            FromJsonUtilS(FromJsonField(input, keyUserId), UserId);
+        }
+
+        Json::Value GenericServiceId::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ServiceName; ToJsonUtilS(ServiceName, each_ServiceName); ToJsonField(output, keyServiceName) = each_ServiceName;
+            Json::Value each_UserId; ToJsonUtilS(UserId, each_UserId); ToJsonField(output, keyUserId) = each_UserId;
+            return output;
+        }
+
+        void AddGenericIDRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyGenericId), GenericId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value AddGenericIDRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GenericId; ToJsonUtilO(GenericId, each_GenericId); ToJsonField(output, keyGenericId) = each_GenericId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void AddPlayerTagRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyTagName), TagName);
+        }
+
+        Json::Value AddPlayerTagRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_TagName; ToJsonUtilS(TagName, each_TagName); ToJsonField(output, keyTagName) = each_TagName;
+            return output;
+        }
+
+        void AddPlayerTagResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value AddPlayerTagResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void AddSharedGroupMembersRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlayFabIds), PlayFabIds);
+            FromJsonUtilS(FromJsonField(input, keySharedGroupId), SharedGroupId);
+        }
+
+        Json::Value AddSharedGroupMembersRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayFabIds; ToJsonUtilS(PlayFabIds, each_PlayFabIds); ToJsonField(output, keyPlayFabIds) = each_PlayFabIds;
+            Json::Value each_SharedGroupId; ToJsonUtilS(SharedGroupId, each_SharedGroupId); ToJsonField(output, keySharedGroupId) = each_SharedGroupId;
+            return output;
+        }
+
+        void AddSharedGroupMembersResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value AddSharedGroupMembersResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void AddUserVirtualCurrencyRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyAmount), Amount);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyVirtualCurrency), VirtualCurrency);
+        }
+
+        Json::Value AddUserVirtualCurrencyRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Amount; ToJsonUtilP(Amount, each_Amount); ToJsonField(output, keyAmount) = each_Amount;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_VirtualCurrency; ToJsonUtilS(VirtualCurrency, each_VirtualCurrency); ToJsonField(output, keyVirtualCurrency) = each_VirtualCurrency;
+            return output;
+        }
+
+        void AdvancedPushPlatformMsg::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyGCMDataOnly), GCMDataOnly);
+            FromJsonUtilS(FromJsonField(input, keyJson), Json);
+            FromJsonEnum(FromJsonField(input, keyPlatform), Platform);
+        }
+
+        Json::Value AdvancedPushPlatformMsg::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GCMDataOnly; ToJsonUtilP(GCMDataOnly, each_GCMDataOnly); ToJsonField(output, keyGCMDataOnly) = each_GCMDataOnly;
+            Json::Value each_Json; ToJsonUtilS(Json, each_Json); ToJsonField(output, keyJson) = each_Json;
+            Json::Value each_Platform; ToJsonEnum(Platform, each_Platform); ToJsonField(output, keyPlatform) = each_Platform;
+            return output;
+        }
+
+        void AuthenticateSessionTicketRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keySessionTicket), SessionTicket);
+        }
+
+        Json::Value AuthenticateSessionTicketRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_SessionTicket; ToJsonUtilS(SessionTicket, each_SessionTicket); ToJsonField(output, keySessionTicket) = each_SessionTicket;
+            return output;
+        }
+
+        void UserAndroidDeviceInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAndroidDeviceId), AndroidDeviceId);
+        }
+
+        Json::Value UserAndroidDeviceInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AndroidDeviceId; ToJsonUtilS(AndroidDeviceId, each_AndroidDeviceId); ToJsonField(output, keyAndroidDeviceId) = each_AndroidDeviceId;
+            return output;
+        }
+
+        void UserAppleIdInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAppleSubjectId), AppleSubjectId);
+        }
+
+        Json::Value UserAppleIdInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AppleSubjectId; ToJsonUtilS(AppleSubjectId, each_AppleSubjectId); ToJsonField(output, keyAppleSubjectId) = each_AppleSubjectId;
+            return output;
+        }
+
+        void UserCustomIdInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomId), CustomId);
+        }
+
+        Json::Value UserCustomIdInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomId; ToJsonUtilS(CustomId, each_CustomId); ToJsonField(output, keyCustomId) = each_CustomId;
+            return output;
+        }
+
+        void UserFacebookInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyFacebookId), FacebookId);
+            FromJsonUtilS(FromJsonField(input, keyFullName), FullName);
+        }
+
+        Json::Value UserFacebookInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_FacebookId; ToJsonUtilS(FacebookId, each_FacebookId); ToJsonField(output, keyFacebookId) = each_FacebookId;
+            Json::Value each_FullName; ToJsonUtilS(FullName, each_FullName); ToJsonField(output, keyFullName) = each_FullName;
+            return output;
+        }
+
+        void UserFacebookInstantGamesIdInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyFacebookInstantGamesId), FacebookInstantGamesId);
+        }
+
+        Json::Value UserFacebookInstantGamesIdInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_FacebookInstantGamesId; ToJsonUtilS(FacebookInstantGamesId, each_FacebookInstantGamesId); ToJsonField(output, keyFacebookInstantGamesId) = each_FacebookInstantGamesId;
+            return output;
+        }
+
+        void UserGameCenterInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyGameCenterId), GameCenterId);
+        }
+
+        Json::Value UserGameCenterInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GameCenterId; ToJsonUtilS(GameCenterId, each_GameCenterId); ToJsonField(output, keyGameCenterId) = each_GameCenterId;
+            return output;
+        }
+
+        void UserGoogleInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyGoogleEmail), GoogleEmail);
+            FromJsonUtilS(FromJsonField(input, keyGoogleGender), GoogleGender);
+            FromJsonUtilS(FromJsonField(input, keyGoogleId), GoogleId);
+            FromJsonUtilS(FromJsonField(input, keyGoogleLocale), GoogleLocale);
+            FromJsonUtilS(FromJsonField(input, keyGoogleName), GoogleName);
+        }
+
+        Json::Value UserGoogleInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GoogleEmail; ToJsonUtilS(GoogleEmail, each_GoogleEmail); ToJsonField(output, keyGoogleEmail) = each_GoogleEmail;
+            Json::Value each_GoogleGender; ToJsonUtilS(GoogleGender, each_GoogleGender); ToJsonField(output, keyGoogleGender) = each_GoogleGender;
+            Json::Value each_GoogleId; ToJsonUtilS(GoogleId, each_GoogleId); ToJsonField(output, keyGoogleId) = each_GoogleId;
+            Json::Value each_GoogleLocale; ToJsonUtilS(GoogleLocale, each_GoogleLocale); ToJsonField(output, keyGoogleLocale) = each_GoogleLocale;
+            Json::Value each_GoogleName; ToJsonUtilS(GoogleName, each_GoogleName); ToJsonField(output, keyGoogleName) = each_GoogleName;
+            return output;
+        }
+
+        void UserIosDeviceInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyIosDeviceId), IosDeviceId);
+        }
+
+        Json::Value UserIosDeviceInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_IosDeviceId; ToJsonUtilS(IosDeviceId, each_IosDeviceId); ToJsonField(output, keyIosDeviceId) = each_IosDeviceId;
+            return output;
+        }
+
+        void UserKongregateInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyKongregateId), KongregateId);
+            FromJsonUtilS(FromJsonField(input, keyKongregateName), KongregateName);
+        }
+
+        Json::Value UserKongregateInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_KongregateId; ToJsonUtilS(KongregateId, each_KongregateId); ToJsonField(output, keyKongregateId) = each_KongregateId;
+            Json::Value each_KongregateName; ToJsonUtilS(KongregateName, each_KongregateName); ToJsonField(output, keyKongregateName) = each_KongregateName;
+            return output;
+        }
+
+        void UserNintendoSwitchAccountIdInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyNintendoSwitchAccountSubjectId), NintendoSwitchAccountSubjectId);
+        }
+
+        Json::Value UserNintendoSwitchAccountIdInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_NintendoSwitchAccountSubjectId; ToJsonUtilS(NintendoSwitchAccountSubjectId, each_NintendoSwitchAccountSubjectId); ToJsonField(output, keyNintendoSwitchAccountSubjectId) = each_NintendoSwitchAccountSubjectId;
+            return output;
+        }
+
+        void UserNintendoSwitchDeviceIdInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyNintendoSwitchDeviceId), NintendoSwitchDeviceId);
+        }
+
+        Json::Value UserNintendoSwitchDeviceIdInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_NintendoSwitchDeviceId; ToJsonUtilS(NintendoSwitchDeviceId, each_NintendoSwitchDeviceId); ToJsonField(output, keyNintendoSwitchDeviceId) = each_NintendoSwitchDeviceId;
+            return output;
+        }
+
+        void UserOpenIdInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyConnectionId), ConnectionId);
+            FromJsonUtilS(FromJsonField(input, keyIssuer), Issuer);
+            FromJsonUtilS(FromJsonField(input, keySubject), Subject);
+        }
+
+        Json::Value UserOpenIdInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ConnectionId; ToJsonUtilS(ConnectionId, each_ConnectionId); ToJsonField(output, keyConnectionId) = each_ConnectionId;
+            Json::Value each_Issuer; ToJsonUtilS(Issuer, each_Issuer); ToJsonField(output, keyIssuer) = each_Issuer;
+            Json::Value each_Subject; ToJsonUtilS(Subject, each_Subject); ToJsonField(output, keySubject) = each_Subject;
+            return output;
+        }
+
+        void UserPrivateAccountInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyEmail), Email);
+        }
+
+        Json::Value UserPrivateAccountInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Email; ToJsonUtilS(Email, each_Email); ToJsonField(output, keyEmail) = each_Email;
+            return output;
+        }
+
+        void UserPsnInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPsnAccountId), PsnAccountId);
+            FromJsonUtilS(FromJsonField(input, keyPsnOnlineId), PsnOnlineId);
+        }
+
+        Json::Value UserPsnInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PsnAccountId; ToJsonUtilS(PsnAccountId, each_PsnAccountId); ToJsonField(output, keyPsnAccountId) = each_PsnAccountId;
+            Json::Value each_PsnOnlineId; ToJsonUtilS(PsnOnlineId, each_PsnOnlineId); ToJsonField(output, keyPsnOnlineId) = each_PsnOnlineId;
+            return output;
+        }
+
+        void UserSteamInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilE(FromJsonField(input, keySteamActivationStatus), SteamActivationStatus);
+            FromJsonUtilS(FromJsonField(input, keySteamCountry), SteamCountry);
+            FromJsonUtilE(FromJsonField(input, keySteamCurrency), SteamCurrency);
+            FromJsonUtilS(FromJsonField(input, keySteamId), SteamId);
+            FromJsonUtilS(FromJsonField(input, keySteamName), SteamName);
+        }
+
+        Json::Value UserSteamInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_SteamActivationStatus; ToJsonUtilE(SteamActivationStatus, each_SteamActivationStatus); ToJsonField(output, keySteamActivationStatus) = each_SteamActivationStatus;
+            Json::Value each_SteamCountry; ToJsonUtilS(SteamCountry, each_SteamCountry); ToJsonField(output, keySteamCountry) = each_SteamCountry;
+            Json::Value each_SteamCurrency; ToJsonUtilE(SteamCurrency, each_SteamCurrency); ToJsonField(output, keySteamCurrency) = each_SteamCurrency;
+            Json::Value each_SteamId; ToJsonUtilS(SteamId, each_SteamId); ToJsonField(output, keySteamId) = each_SteamId;
+            Json::Value each_SteamName; ToJsonUtilS(SteamName, each_SteamName); ToJsonField(output, keySteamName) = each_SteamName;
+            return output;
+        }
+
+        void EntityKey::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyId), Id);
+            FromJsonUtilS(FromJsonField(input, keyType), Type);
+        }
+
+        Json::Value EntityKey::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Id; ToJsonUtilS(Id, each_Id); ToJsonField(output, keyId) = each_Id;
+            Json::Value each_Type; ToJsonUtilS(Type, each_Type); ToJsonField(output, keyType) = each_Type;
+            return output;
+        }
+
+        void UserTitleInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAvatarUrl), AvatarUrl);
+            FromJsonUtilT(FromJsonField(input, keyCreated), Created);
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+            FromJsonUtilT(FromJsonField(input, keyFirstLogin), FirstLogin);
+            FromJsonUtilP(FromJsonField(input, keyisBanned), isBanned);
+            FromJsonUtilT(FromJsonField(input, keyLastLogin), LastLogin);
+            FromJsonUtilE(FromJsonField(input, keyOrigination), Origination);
+            FromJsonUtilO(FromJsonField(input, keyTitlePlayerAccount), TitlePlayerAccount);
+        }
+
+        Json::Value UserTitleInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AvatarUrl; ToJsonUtilS(AvatarUrl, each_AvatarUrl); ToJsonField(output, keyAvatarUrl) = each_AvatarUrl;
+            Json::Value each_Created; ToJsonUtilT(Created, each_Created); ToJsonField(output, keyCreated) = each_Created;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            Json::Value each_FirstLogin; ToJsonUtilT(FirstLogin, each_FirstLogin); ToJsonField(output, keyFirstLogin) = each_FirstLogin;
+            Json::Value each_isBanned; ToJsonUtilP(isBanned, each_isBanned); ToJsonField(output, keyisBanned) = each_isBanned;
+            Json::Value each_LastLogin; ToJsonUtilT(LastLogin, each_LastLogin); ToJsonField(output, keyLastLogin) = each_LastLogin;
+            Json::Value each_Origination; ToJsonUtilE(Origination, each_Origination); ToJsonField(output, keyOrigination) = each_Origination;
+            Json::Value each_TitlePlayerAccount; ToJsonUtilO(TitlePlayerAccount, each_TitlePlayerAccount); ToJsonField(output, keyTitlePlayerAccount) = each_TitlePlayerAccount;
+            return output;
+        }
+
+        void UserTwitchInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyTwitchId), TwitchId);
+            FromJsonUtilS(FromJsonField(input, keyTwitchUserName), TwitchUserName);
+        }
+
+        Json::Value UserTwitchInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_TwitchId; ToJsonUtilS(TwitchId, each_TwitchId); ToJsonField(output, keyTwitchId) = each_TwitchId;
+            Json::Value each_TwitchUserName; ToJsonUtilS(TwitchUserName, each_TwitchUserName); ToJsonField(output, keyTwitchUserName) = each_TwitchUserName;
+            return output;
+        }
+
+        void UserWindowsHelloInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyWindowsHelloDeviceName), WindowsHelloDeviceName);
+            FromJsonUtilS(FromJsonField(input, keyWindowsHelloPublicKeyHash), WindowsHelloPublicKeyHash);
+        }
+
+        Json::Value UserWindowsHelloInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_WindowsHelloDeviceName; ToJsonUtilS(WindowsHelloDeviceName, each_WindowsHelloDeviceName); ToJsonField(output, keyWindowsHelloDeviceName) = each_WindowsHelloDeviceName;
+            Json::Value each_WindowsHelloPublicKeyHash; ToJsonUtilS(WindowsHelloPublicKeyHash, each_WindowsHelloPublicKeyHash); ToJsonField(output, keyWindowsHelloPublicKeyHash) = each_WindowsHelloPublicKeyHash;
+            return output;
+        }
+
+        void UserXboxInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyXboxUserId), XboxUserId);
+        }
+
+        Json::Value UserXboxInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_XboxUserId; ToJsonUtilS(XboxUserId, each_XboxUserId); ToJsonField(output, keyXboxUserId) = each_XboxUserId;
+            return output;
+        }
+
+        void UserAccountInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyAndroidDeviceInfo), AndroidDeviceInfo);
+            FromJsonUtilO(FromJsonField(input, keyAppleAccountInfo), AppleAccountInfo);
+            FromJsonUtilT(FromJsonField(input, keyCreated), Created);
+            FromJsonUtilO(FromJsonField(input, keyCustomIdInfo), CustomIdInfo);
+            FromJsonUtilO(FromJsonField(input, keyFacebookInfo), FacebookInfo);
+            FromJsonUtilO(FromJsonField(input, keyFacebookInstantGamesIdInfo), FacebookInstantGamesIdInfo);
+            FromJsonUtilO(FromJsonField(input, keyGameCenterInfo), GameCenterInfo);
+            FromJsonUtilO(FromJsonField(input, keyGoogleInfo), GoogleInfo);
+            FromJsonUtilO(FromJsonField(input, keyIosDeviceInfo), IosDeviceInfo);
+            FromJsonUtilO(FromJsonField(input, keyKongregateInfo), KongregateInfo);
+            FromJsonUtilO(FromJsonField(input, keyNintendoSwitchAccountInfo), NintendoSwitchAccountInfo);
+            FromJsonUtilO(FromJsonField(input, keyNintendoSwitchDeviceIdInfo), NintendoSwitchDeviceIdInfo);
+            FromJsonUtilO(FromJsonField(input, keyOpenIdInfo), OpenIdInfo);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilO(FromJsonField(input, keyPrivateInfo), PrivateInfo);
+            FromJsonUtilO(FromJsonField(input, keyPsnInfo), PsnInfo);
+            FromJsonUtilO(FromJsonField(input, keySteamInfo), SteamInfo);
+            FromJsonUtilO(FromJsonField(input, keyTitleInfo), TitleInfo);
+            FromJsonUtilO(FromJsonField(input, keyTwitchInfo), TwitchInfo);
+            FromJsonUtilS(FromJsonField(input, keyUsername), Username);
+            FromJsonUtilO(FromJsonField(input, keyWindowsHelloInfo), WindowsHelloInfo);
+            FromJsonUtilO(FromJsonField(input, keyXboxInfo), XboxInfo);
+        }
+
+        Json::Value UserAccountInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AndroidDeviceInfo; ToJsonUtilO(AndroidDeviceInfo, each_AndroidDeviceInfo); ToJsonField(output, keyAndroidDeviceInfo) = each_AndroidDeviceInfo;
+            Json::Value each_AppleAccountInfo; ToJsonUtilO(AppleAccountInfo, each_AppleAccountInfo); ToJsonField(output, keyAppleAccountInfo) = each_AppleAccountInfo;
+            Json::Value each_Created; ToJsonUtilT(Created, each_Created); ToJsonField(output, keyCreated) = each_Created;
+            Json::Value each_CustomIdInfo; ToJsonUtilO(CustomIdInfo, each_CustomIdInfo); ToJsonField(output, keyCustomIdInfo) = each_CustomIdInfo;
+            Json::Value each_FacebookInfo; ToJsonUtilO(FacebookInfo, each_FacebookInfo); ToJsonField(output, keyFacebookInfo) = each_FacebookInfo;
+            Json::Value each_FacebookInstantGamesIdInfo; ToJsonUtilO(FacebookInstantGamesIdInfo, each_FacebookInstantGamesIdInfo); ToJsonField(output, keyFacebookInstantGamesIdInfo) = each_FacebookInstantGamesIdInfo;
+            Json::Value each_GameCenterInfo; ToJsonUtilO(GameCenterInfo, each_GameCenterInfo); ToJsonField(output, keyGameCenterInfo) = each_GameCenterInfo;
+            Json::Value each_GoogleInfo; ToJsonUtilO(GoogleInfo, each_GoogleInfo); ToJsonField(output, keyGoogleInfo) = each_GoogleInfo;
+            Json::Value each_IosDeviceInfo; ToJsonUtilO(IosDeviceInfo, each_IosDeviceInfo); ToJsonField(output, keyIosDeviceInfo) = each_IosDeviceInfo;
+            Json::Value each_KongregateInfo; ToJsonUtilO(KongregateInfo, each_KongregateInfo); ToJsonField(output, keyKongregateInfo) = each_KongregateInfo;
+            Json::Value each_NintendoSwitchAccountInfo; ToJsonUtilO(NintendoSwitchAccountInfo, each_NintendoSwitchAccountInfo); ToJsonField(output, keyNintendoSwitchAccountInfo) = each_NintendoSwitchAccountInfo;
+            Json::Value each_NintendoSwitchDeviceIdInfo; ToJsonUtilO(NintendoSwitchDeviceIdInfo, each_NintendoSwitchDeviceIdInfo); ToJsonField(output, keyNintendoSwitchDeviceIdInfo) = each_NintendoSwitchDeviceIdInfo;
+            Json::Value each_OpenIdInfo; ToJsonUtilO(OpenIdInfo, each_OpenIdInfo); ToJsonField(output, keyOpenIdInfo) = each_OpenIdInfo;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_PrivateInfo; ToJsonUtilO(PrivateInfo, each_PrivateInfo); ToJsonField(output, keyPrivateInfo) = each_PrivateInfo;
+            Json::Value each_PsnInfo; ToJsonUtilO(PsnInfo, each_PsnInfo); ToJsonField(output, keyPsnInfo) = each_PsnInfo;
+            Json::Value each_SteamInfo; ToJsonUtilO(SteamInfo, each_SteamInfo); ToJsonField(output, keySteamInfo) = each_SteamInfo;
+            Json::Value each_TitleInfo; ToJsonUtilO(TitleInfo, each_TitleInfo); ToJsonField(output, keyTitleInfo) = each_TitleInfo;
+            Json::Value each_TwitchInfo; ToJsonUtilO(TwitchInfo, each_TwitchInfo); ToJsonField(output, keyTwitchInfo) = each_TwitchInfo;
+            Json::Value each_Username; ToJsonUtilS(Username, each_Username); ToJsonField(output, keyUsername) = each_Username;
+            Json::Value each_WindowsHelloInfo; ToJsonUtilO(WindowsHelloInfo, each_WindowsHelloInfo); ToJsonField(output, keyWindowsHelloInfo) = each_WindowsHelloInfo;
+            Json::Value each_XboxInfo; ToJsonUtilO(XboxInfo, each_XboxInfo); ToJsonField(output, keyXboxInfo) = each_XboxInfo;
+            return output;
+        }
+
+        void AuthenticateSessionTicketResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyIsSessionTicketExpired), IsSessionTicketExpired);
+            FromJsonUtilO(FromJsonField(input, keyUserInfo), UserInfo);
+        }
+
+        Json::Value AuthenticateSessionTicketResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_IsSessionTicketExpired; ToJsonUtilP(IsSessionTicketExpired, each_IsSessionTicketExpired); ToJsonField(output, keyIsSessionTicketExpired) = each_IsSessionTicketExpired;
+            Json::Value each_UserInfo; ToJsonUtilO(UserInfo, each_UserInfo); ToJsonField(output, keyUserInfo) = each_UserInfo;
+            return output;
+        }
+
+        void AwardSteamAchievementItem::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAchievementName), AchievementName);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilP(FromJsonField(input, keyResult), Result);
+        }
+
+        Json::Value AwardSteamAchievementItem::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AchievementName; ToJsonUtilS(AchievementName, each_AchievementName); ToJsonField(output, keyAchievementName) = each_AchievementName;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_Result; ToJsonUtilP(Result, each_Result); ToJsonField(output, keyResult) = each_Result;
+            return output;
+        }
+
+        void AwardSteamAchievementRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyAchievements), Achievements);
+        }
+
+        Json::Value AwardSteamAchievementRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Achievements; ToJsonUtilO(Achievements, each_Achievements); ToJsonField(output, keyAchievements) = each_Achievements;
+            return output;
+        }
+
+        void AwardSteamAchievementResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyAchievementResults), AchievementResults);
+        }
+
+        Json::Value AwardSteamAchievementResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AchievementResults; ToJsonUtilO(AchievementResults, each_AchievementResults); ToJsonField(output, keyAchievementResults) = each_AchievementResults;
+            return output;
+        }
+
+        void BanInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyActive), Active);
+            FromJsonUtilS(FromJsonField(input, keyBanId), BanId);
+            FromJsonUtilT(FromJsonField(input, keyCreated), Created);
+            FromJsonUtilT(FromJsonField(input, keyExpires), Expires);
+            FromJsonUtilS(FromJsonField(input, keyIPAddress), IPAddress);
+            FromJsonUtilS(FromJsonField(input, keyMACAddress), MACAddress);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyReason), Reason);
+        }
+
+        Json::Value BanInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Active; ToJsonUtilP(Active, each_Active); ToJsonField(output, keyActive) = each_Active;
+            Json::Value each_BanId; ToJsonUtilS(BanId, each_BanId); ToJsonField(output, keyBanId) = each_BanId;
+            Json::Value each_Created; ToJsonUtilT(Created, each_Created); ToJsonField(output, keyCreated) = each_Created;
+            Json::Value each_Expires; ToJsonUtilT(Expires, each_Expires); ToJsonField(output, keyExpires) = each_Expires;
+            Json::Value each_IPAddress; ToJsonUtilS(IPAddress, each_IPAddress); ToJsonField(output, keyIPAddress) = each_IPAddress;
+            Json::Value each_MACAddress; ToJsonUtilS(MACAddress, each_MACAddress); ToJsonField(output, keyMACAddress) = each_MACAddress;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_Reason; ToJsonUtilS(Reason, each_Reason); ToJsonField(output, keyReason) = each_Reason;
+            return output;
+        }
+
+        void BanRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyDurationInHours), DurationInHours);
+            FromJsonUtilS(FromJsonField(input, keyIPAddress), IPAddress);
+            FromJsonUtilS(FromJsonField(input, keyMACAddress), MACAddress);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyReason), Reason);
+        }
+
+        Json::Value BanRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_DurationInHours; ToJsonUtilP(DurationInHours, each_DurationInHours); ToJsonField(output, keyDurationInHours) = each_DurationInHours;
+            Json::Value each_IPAddress; ToJsonUtilS(IPAddress, each_IPAddress); ToJsonField(output, keyIPAddress) = each_IPAddress;
+            Json::Value each_MACAddress; ToJsonUtilS(MACAddress, each_MACAddress); ToJsonField(output, keyMACAddress) = each_MACAddress;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_Reason; ToJsonUtilS(Reason, each_Reason); ToJsonField(output, keyReason) = each_Reason;
+            return output;
+        }
+
+        void BanUsersRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyBans), Bans);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+        }
+
+        Json::Value BanUsersRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Bans; ToJsonUtilO(Bans, each_Bans); ToJsonField(output, keyBans) = each_Bans;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            return output;
+        }
+
+        void BanUsersResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyBanData), BanData);
+        }
+
+        Json::Value BanUsersResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BanData; ToJsonUtilO(BanData, each_BanData); ToJsonField(output, keyBanData) = each_BanData;
+            return output;
+        }
+
+        void CatalogItemBundleInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBundledItems), BundledItems);
+            FromJsonUtilS(FromJsonField(input, keyBundledResultTables), BundledResultTables);
+            FromJsonUtilP(FromJsonField(input, keyBundledVirtualCurrencies), BundledVirtualCurrencies);
+        }
+
+        Json::Value CatalogItemBundleInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BundledItems; ToJsonUtilS(BundledItems, each_BundledItems); ToJsonField(output, keyBundledItems) = each_BundledItems;
+            Json::Value each_BundledResultTables; ToJsonUtilS(BundledResultTables, each_BundledResultTables); ToJsonField(output, keyBundledResultTables) = each_BundledResultTables;
+            Json::Value each_BundledVirtualCurrencies; ToJsonUtilP(BundledVirtualCurrencies, each_BundledVirtualCurrencies); ToJsonField(output, keyBundledVirtualCurrencies) = each_BundledVirtualCurrencies;
+            return output;
+        }
+
+        void CatalogItemConsumableInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyUsageCount), UsageCount);
+            FromJsonUtilP(FromJsonField(input, keyUsagePeriod), UsagePeriod);
+            FromJsonUtilS(FromJsonField(input, keyUsagePeriodGroup), UsagePeriodGroup);
+        }
+
+        Json::Value CatalogItemConsumableInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_UsageCount; ToJsonUtilP(UsageCount, each_UsageCount); ToJsonField(output, keyUsageCount) = each_UsageCount;
+            Json::Value each_UsagePeriod; ToJsonUtilP(UsagePeriod, each_UsagePeriod); ToJsonField(output, keyUsagePeriod) = each_UsagePeriod;
+            Json::Value each_UsagePeriodGroup; ToJsonUtilS(UsagePeriodGroup, each_UsagePeriodGroup); ToJsonField(output, keyUsagePeriodGroup) = each_UsagePeriodGroup;
+            return output;
+        }
+
+        void CatalogItemContainerInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyItemContents), ItemContents);
+            FromJsonUtilS(FromJsonField(input, keyKeyItemId), KeyItemId);
+            FromJsonUtilS(FromJsonField(input, keyResultTableContents), ResultTableContents);
+            FromJsonUtilP(FromJsonField(input, keyVirtualCurrencyContents), VirtualCurrencyContents);
+        }
+
+        Json::Value CatalogItemContainerInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ItemContents; ToJsonUtilS(ItemContents, each_ItemContents); ToJsonField(output, keyItemContents) = each_ItemContents;
+            Json::Value each_KeyItemId; ToJsonUtilS(KeyItemId, each_KeyItemId); ToJsonField(output, keyKeyItemId) = each_KeyItemId;
+            Json::Value each_ResultTableContents; ToJsonUtilS(ResultTableContents, each_ResultTableContents); ToJsonField(output, keyResultTableContents) = each_ResultTableContents;
+            Json::Value each_VirtualCurrencyContents; ToJsonUtilP(VirtualCurrencyContents, each_VirtualCurrencyContents); ToJsonField(output, keyVirtualCurrencyContents) = each_VirtualCurrencyContents;
+            return output;
+        }
+
+        void CatalogItem::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyBundle), Bundle);
+            FromJsonUtilP(FromJsonField(input, keyCanBecomeCharacter), CanBecomeCharacter);
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilO(FromJsonField(input, keyConsumable), Consumable);
+            FromJsonUtilO(FromJsonField(input, keyContainer), Container);
+            FromJsonUtilS(FromJsonField(input, keyCustomData), CustomData);
+            FromJsonUtilS(FromJsonField(input, keyDescription), Description);
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+            FromJsonUtilP(FromJsonField(input, keyInitialLimitedEditionCount), InitialLimitedEditionCount);
+            FromJsonUtilP(FromJsonField(input, keyIsLimitedEdition), IsLimitedEdition);
+            FromJsonUtilP(FromJsonField(input, keyIsStackable), IsStackable);
+            FromJsonUtilP(FromJsonField(input, keyIsTradable), IsTradable);
+            FromJsonUtilS(FromJsonField(input, keyItemClass), ItemClass);
+            FromJsonUtilS(FromJsonField(input, keyItemId), ItemId);
+            FromJsonUtilS(FromJsonField(input, keyItemImageUrl), ItemImageUrl);
+            FromJsonUtilP(FromJsonField(input, keyRealCurrencyPrices), RealCurrencyPrices);
+            FromJsonUtilS(FromJsonField(input, keyTags), Tags);
+            FromJsonUtilP(FromJsonField(input, keyVirtualCurrencyPrices), VirtualCurrencyPrices);
+        }
+
+        Json::Value CatalogItem::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Bundle; ToJsonUtilO(Bundle, each_Bundle); ToJsonField(output, keyBundle) = each_Bundle;
+            Json::Value each_CanBecomeCharacter; ToJsonUtilP(CanBecomeCharacter, each_CanBecomeCharacter); ToJsonField(output, keyCanBecomeCharacter) = each_CanBecomeCharacter;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_Consumable; ToJsonUtilO(Consumable, each_Consumable); ToJsonField(output, keyConsumable) = each_Consumable;
+            Json::Value each_Container; ToJsonUtilO(Container, each_Container); ToJsonField(output, keyContainer) = each_Container;
+            Json::Value each_CustomData; ToJsonUtilS(CustomData, each_CustomData); ToJsonField(output, keyCustomData) = each_CustomData;
+            Json::Value each_Description; ToJsonUtilS(Description, each_Description); ToJsonField(output, keyDescription) = each_Description;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            Json::Value each_InitialLimitedEditionCount; ToJsonUtilP(InitialLimitedEditionCount, each_InitialLimitedEditionCount); ToJsonField(output, keyInitialLimitedEditionCount) = each_InitialLimitedEditionCount;
+            Json::Value each_IsLimitedEdition; ToJsonUtilP(IsLimitedEdition, each_IsLimitedEdition); ToJsonField(output, keyIsLimitedEdition) = each_IsLimitedEdition;
+            Json::Value each_IsStackable; ToJsonUtilP(IsStackable, each_IsStackable); ToJsonField(output, keyIsStackable) = each_IsStackable;
+            Json::Value each_IsTradable; ToJsonUtilP(IsTradable, each_IsTradable); ToJsonField(output, keyIsTradable) = each_IsTradable;
+            Json::Value each_ItemClass; ToJsonUtilS(ItemClass, each_ItemClass); ToJsonField(output, keyItemClass) = each_ItemClass;
+            Json::Value each_ItemId; ToJsonUtilS(ItemId, each_ItemId); ToJsonField(output, keyItemId) = each_ItemId;
+            Json::Value each_ItemImageUrl; ToJsonUtilS(ItemImageUrl, each_ItemImageUrl); ToJsonField(output, keyItemImageUrl) = each_ItemImageUrl;
+            Json::Value each_RealCurrencyPrices; ToJsonUtilP(RealCurrencyPrices, each_RealCurrencyPrices); ToJsonField(output, keyRealCurrencyPrices) = each_RealCurrencyPrices;
+            Json::Value each_Tags; ToJsonUtilS(Tags, each_Tags); ToJsonField(output, keyTags) = each_Tags;
+            Json::Value each_VirtualCurrencyPrices; ToJsonUtilP(VirtualCurrencyPrices, each_VirtualCurrencyPrices); ToJsonField(output, keyVirtualCurrencyPrices) = each_VirtualCurrencyPrices;
+            return output;
+        }
+
+        void ItemInstance::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAnnotation), Annotation);
+            FromJsonUtilS(FromJsonField(input, keyBundleContents), BundleContents);
+            FromJsonUtilS(FromJsonField(input, keyBundleParent), BundleParent);
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCustomData), CustomData);
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+            FromJsonUtilT(FromJsonField(input, keyExpiration), Expiration);
+            FromJsonUtilS(FromJsonField(input, keyItemClass), ItemClass);
+            FromJsonUtilS(FromJsonField(input, keyItemId), ItemId);
+            FromJsonUtilS(FromJsonField(input, keyItemInstanceId), ItemInstanceId);
+            FromJsonUtilT(FromJsonField(input, keyPurchaseDate), PurchaseDate);
+            FromJsonUtilP(FromJsonField(input, keyRemainingUses), RemainingUses);
+            FromJsonUtilS(FromJsonField(input, keyUnitCurrency), UnitCurrency);
+            FromJsonUtilP(FromJsonField(input, keyUnitPrice), UnitPrice);
+            FromJsonUtilP(FromJsonField(input, keyUsesIncrementedBy), UsesIncrementedBy);
+        }
+
+        Json::Value ItemInstance::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Annotation; ToJsonUtilS(Annotation, each_Annotation); ToJsonField(output, keyAnnotation) = each_Annotation;
+            Json::Value each_BundleContents; ToJsonUtilS(BundleContents, each_BundleContents); ToJsonField(output, keyBundleContents) = each_BundleContents;
+            Json::Value each_BundleParent; ToJsonUtilS(BundleParent, each_BundleParent); ToJsonField(output, keyBundleParent) = each_BundleParent;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CustomData; ToJsonUtilS(CustomData, each_CustomData); ToJsonField(output, keyCustomData) = each_CustomData;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            Json::Value each_Expiration; ToJsonUtilT(Expiration, each_Expiration); ToJsonField(output, keyExpiration) = each_Expiration;
+            Json::Value each_ItemClass; ToJsonUtilS(ItemClass, each_ItemClass); ToJsonField(output, keyItemClass) = each_ItemClass;
+            Json::Value each_ItemId; ToJsonUtilS(ItemId, each_ItemId); ToJsonField(output, keyItemId) = each_ItemId;
+            Json::Value each_ItemInstanceId; ToJsonUtilS(ItemInstanceId, each_ItemInstanceId); ToJsonField(output, keyItemInstanceId) = each_ItemInstanceId;
+            Json::Value each_PurchaseDate; ToJsonUtilT(PurchaseDate, each_PurchaseDate); ToJsonField(output, keyPurchaseDate) = each_PurchaseDate;
+            Json::Value each_RemainingUses; ToJsonUtilP(RemainingUses, each_RemainingUses); ToJsonField(output, keyRemainingUses) = each_RemainingUses;
+            Json::Value each_UnitCurrency; ToJsonUtilS(UnitCurrency, each_UnitCurrency); ToJsonField(output, keyUnitCurrency) = each_UnitCurrency;
+            Json::Value each_UnitPrice; ToJsonUtilP(UnitPrice, each_UnitPrice); ToJsonField(output, keyUnitPrice) = each_UnitPrice;
+            Json::Value each_UsesIncrementedBy; ToJsonUtilP(UsesIncrementedBy, each_UsesIncrementedBy); ToJsonField(output, keyUsesIncrementedBy) = each_UsesIncrementedBy;
+            return output;
+        }
+
+        void CharacterInventory::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilO(FromJsonField(input, keyInventory), Inventory);
+        }
+
+        Json::Value CharacterInventory::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_Inventory; ToJsonUtilO(Inventory, each_Inventory); ToJsonField(output, keyInventory) = each_Inventory;
+            return output;
+        }
+
+        void CharacterLeaderboardEntry::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyCharacterName), CharacterName);
+            FromJsonUtilS(FromJsonField(input, keyCharacterType), CharacterType);
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilP(FromJsonField(input, keyPosition), Position);
+            FromJsonUtilP(FromJsonField(input, keyStatValue), StatValue);
+        }
+
+        Json::Value CharacterLeaderboardEntry::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_CharacterName; ToJsonUtilS(CharacterName, each_CharacterName); ToJsonField(output, keyCharacterName) = each_CharacterName;
+            Json::Value each_CharacterType; ToJsonUtilS(CharacterType, each_CharacterType); ToJsonField(output, keyCharacterType) = each_CharacterType;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_Position; ToJsonUtilP(Position, each_Position); ToJsonField(output, keyPosition) = each_Position;
+            Json::Value each_StatValue; ToJsonUtilP(StatValue, each_StatValue); ToJsonField(output, keyStatValue) = each_StatValue;
+            return output;
+        }
+
+        void CharacterResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyCharacterName), CharacterName);
+            FromJsonUtilS(FromJsonField(input, keyCharacterType), CharacterType);
+        }
+
+        Json::Value CharacterResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_CharacterName; ToJsonUtilS(CharacterName, each_CharacterName); ToJsonField(output, keyCharacterName) = each_CharacterName;
+            Json::Value each_CharacterType; ToJsonUtilS(CharacterType, each_CharacterType); ToJsonField(output, keyCharacterType) = each_CharacterType;
+            return output;
+        }
+
+        void ConsumeItemRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilP(FromJsonField(input, keyConsumeCount), ConsumeCount);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyItemInstanceId), ItemInstanceId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value ConsumeItemRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_ConsumeCount; ToJsonUtilP(ConsumeCount, each_ConsumeCount); ToJsonField(output, keyConsumeCount) = each_ConsumeCount;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ItemInstanceId; ToJsonUtilS(ItemInstanceId, each_ItemInstanceId); ToJsonField(output, keyItemInstanceId) = each_ItemInstanceId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void ConsumeItemResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyItemInstanceId), ItemInstanceId);
+            FromJsonUtilP(FromJsonField(input, keyRemainingUses), RemainingUses);
+        }
+
+        Json::Value ConsumeItemResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ItemInstanceId; ToJsonUtilS(ItemInstanceId, each_ItemInstanceId); ToJsonField(output, keyItemInstanceId) = each_ItemInstanceId;
+            Json::Value each_RemainingUses; ToJsonUtilP(RemainingUses, each_RemainingUses); ToJsonField(output, keyRemainingUses) = each_RemainingUses;
+            return output;
+        }
+
+        void ContactEmailInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyEmailAddress), EmailAddress);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilE(FromJsonField(input, keyVerificationStatus), VerificationStatus);
+        }
+
+        Json::Value ContactEmailInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_EmailAddress; ToJsonUtilS(EmailAddress, each_EmailAddress); ToJsonField(output, keyEmailAddress) = each_EmailAddress;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_VerificationStatus; ToJsonUtilE(VerificationStatus, each_VerificationStatus); ToJsonField(output, keyVerificationStatus) = each_VerificationStatus;
+            return output;
+        }
+
+        void ContactEmailInfoModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyEmailAddress), EmailAddress);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilE(FromJsonField(input, keyVerificationStatus), VerificationStatus);
+        }
+
+        Json::Value ContactEmailInfoModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_EmailAddress; ToJsonUtilS(EmailAddress, each_EmailAddress); ToJsonField(output, keyEmailAddress) = each_EmailAddress;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_VerificationStatus; ToJsonUtilE(VerificationStatus, each_VerificationStatus); ToJsonField(output, keyVerificationStatus) = each_VerificationStatus;
+            return output;
+        }
+
+        void CreateSharedGroupRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keySharedGroupId), SharedGroupId);
+        }
+
+        Json::Value CreateSharedGroupRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_SharedGroupId; ToJsonUtilS(SharedGroupId, each_SharedGroupId); ToJsonField(output, keySharedGroupId) = each_SharedGroupId;
+            return output;
+        }
+
+        void CreateSharedGroupResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keySharedGroupId), SharedGroupId);
+        }
+
+        Json::Value CreateSharedGroupResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_SharedGroupId; ToJsonUtilS(SharedGroupId, each_SharedGroupId); ToJsonField(output, keySharedGroupId) = each_SharedGroupId;
+            return output;
+        }
+
+        void DeleteCharacterFromUserRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilP(FromJsonField(input, keySaveCharacterInventory), SaveCharacterInventory);
+        }
+
+        Json::Value DeleteCharacterFromUserRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_SaveCharacterInventory; ToJsonUtilP(SaveCharacterInventory, each_SaveCharacterInventory); ToJsonField(output, keySaveCharacterInventory) = each_SaveCharacterInventory;
+            return output;
+        }
+
+        void DeleteCharacterFromUserResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value DeleteCharacterFromUserResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void DeletePlayerRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value DeletePlayerRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void DeletePlayerResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value DeletePlayerResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void DeletePushNotificationTemplateRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPushNotificationTemplateId), PushNotificationTemplateId);
+        }
+
+        Json::Value DeletePushNotificationTemplateRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PushNotificationTemplateId; ToJsonUtilS(PushNotificationTemplateId, each_PushNotificationTemplateId); ToJsonField(output, keyPushNotificationTemplateId) = each_PushNotificationTemplateId;
+            return output;
+        }
+
+        void DeletePushNotificationTemplateResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value DeletePushNotificationTemplateResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void DeleteSharedGroupRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keySharedGroupId), SharedGroupId);
+        }
+
+        Json::Value DeleteSharedGroupRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_SharedGroupId; ToJsonUtilS(SharedGroupId, each_SharedGroupId); ToJsonField(output, keySharedGroupId) = each_SharedGroupId;
+            return output;
+        }
+
+        void DeregisterGameRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyLobbyId), LobbyId);
+        }
+
+        Json::Value DeregisterGameRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_LobbyId; ToJsonUtilS(LobbyId, each_LobbyId); ToJsonField(output, keyLobbyId) = each_LobbyId;
+            return output;
+        }
+
+        void DeregisterGameResponse::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value DeregisterGameResponse::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void EmptyResponse::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value EmptyResponse::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void EmptyResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value EmptyResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void EntityTokenResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyEntity), Entity);
+            FromJsonUtilS(FromJsonField(input, keyEntityToken), EntityToken);
+            FromJsonUtilT(FromJsonField(input, keyTokenExpiration), TokenExpiration);
+        }
+
+        Json::Value EntityTokenResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Entity; ToJsonUtilO(Entity, each_Entity); ToJsonField(output, keyEntity) = each_Entity;
+            Json::Value each_EntityToken; ToJsonUtilS(EntityToken, each_EntityToken); ToJsonField(output, keyEntityToken) = each_EntityToken;
+            Json::Value each_TokenExpiration; ToJsonUtilT(TokenExpiration, each_TokenExpiration); ToJsonField(output, keyTokenExpiration) = each_TokenExpiration;
+            return output;
+        }
+
+        void EvaluateRandomResultTableRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyTableId), TableId);
+        }
+
+        Json::Value EvaluateRandomResultTableRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_TableId; ToJsonUtilS(TableId, each_TableId); ToJsonField(output, keyTableId) = each_TableId;
+            return output;
+        }
+
+        void EvaluateRandomResultTableResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyResultItemId), ResultItemId);
+        }
+
+        Json::Value EvaluateRandomResultTableResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ResultItemId; ToJsonUtilS(ResultItemId, each_ResultItemId); ToJsonField(output, keyResultItemId) = each_ResultItemId;
+            return output;
+        }
+
+        void ScriptExecutionError::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyError), Error);
+            FromJsonUtilS(FromJsonField(input, keyMessage), Message);
+            FromJsonUtilS(FromJsonField(input, keyStackTrace), StackTrace);
+        }
+
+        Json::Value ScriptExecutionError::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Error; ToJsonUtilS(Error, each_Error); ToJsonField(output, keyError) = each_Error;
+            Json::Value each_Message; ToJsonUtilS(Message, each_Message); ToJsonField(output, keyMessage) = each_Message;
+            Json::Value each_StackTrace; ToJsonUtilS(StackTrace, each_StackTrace); ToJsonField(output, keyStackTrace) = each_StackTrace;
+            return output;
+        }
+
+        void LogStatement::FromJson(const Json::Value& input)
+        {
+            Data = FromJsonField(input, keyData);
+            FromJsonUtilS(FromJsonField(input, keyLevel), Level);
+            FromJsonUtilS(FromJsonField(input, keyMessage), Message);
+        }
+
+        Json::Value LogStatement::ToJson() const
+        {
+            Json::Value output;
+            ToJsonField(output, keyData) = Data;
+            Json::Value each_Level; ToJsonUtilS(Level, each_Level); ToJsonField(output, keyLevel) = each_Level;
+            Json::Value each_Message; ToJsonUtilS(Message, each_Message); ToJsonField(output, keyMessage) = each_Message;
+            return output;
+        }
+
+        void ExecuteCloudScriptResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyAPIRequestsIssued), APIRequestsIssued);
+            FromJsonUtilO(FromJsonField(input, keyError), Error);
+            FromJsonUtilP(FromJsonField(input, keyExecutionTimeSeconds), ExecutionTimeSeconds);
+            FromJsonUtilS(FromJsonField(input, keyFunctionName), FunctionName);
+            FunctionResult = FromJsonField(input, keyFunctionResult);
+            FromJsonUtilP(FromJsonField(input, keyFunctionResultTooLarge), FunctionResultTooLarge);
+            FromJsonUtilP(FromJsonField(input, keyHttpRequestsIssued), HttpRequestsIssued);
+            FromJsonUtilO(FromJsonField(input, keyLogs), Logs);
+            FromJsonUtilP(FromJsonField(input, keyLogsTooLarge), LogsTooLarge);
+            FromJsonUtilP(FromJsonField(input, keyMemoryConsumedBytes), MemoryConsumedBytes);
+            FromJsonUtilP(FromJsonField(input, keyProcessorTimeSeconds), ProcessorTimeSeconds);
+            FromJsonUtilP(FromJsonField(input, keyRevision), Revision);
+        }
+
+        Json::Value ExecuteCloudScriptResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_APIRequestsIssued; ToJsonUtilP(APIRequestsIssued, each_APIRequestsIssued); ToJsonField(output, keyAPIRequestsIssued) = each_APIRequestsIssued;
+            Json::Value each_Error; ToJsonUtilO(Error, each_Error); ToJsonField(output, keyError) = each_Error;
+            Json::Value each_ExecutionTimeSeconds; ToJsonUtilP(ExecutionTimeSeconds, each_ExecutionTimeSeconds); ToJsonField(output, keyExecutionTimeSeconds) = each_ExecutionTimeSeconds;
+            Json::Value each_FunctionName; ToJsonUtilS(FunctionName, each_FunctionName); ToJsonField(output, keyFunctionName) = each_FunctionName;
+            ToJsonField(output, keyFunctionResult) = FunctionResult;
+            Json::Value each_FunctionResultTooLarge; ToJsonUtilP(FunctionResultTooLarge, each_FunctionResultTooLarge); ToJsonField(output, keyFunctionResultTooLarge) = each_FunctionResultTooLarge;
+            Json::Value each_HttpRequestsIssued; ToJsonUtilP(HttpRequestsIssued, each_HttpRequestsIssued); ToJsonField(output, keyHttpRequestsIssued) = each_HttpRequestsIssued;
+            Json::Value each_Logs; ToJsonUtilO(Logs, each_Logs); ToJsonField(output, keyLogs) = each_Logs;
+            Json::Value each_LogsTooLarge; ToJsonUtilP(LogsTooLarge, each_LogsTooLarge); ToJsonField(output, keyLogsTooLarge) = each_LogsTooLarge;
+            Json::Value each_MemoryConsumedBytes; ToJsonUtilP(MemoryConsumedBytes, each_MemoryConsumedBytes); ToJsonField(output, keyMemoryConsumedBytes) = each_MemoryConsumedBytes;
+            Json::Value each_ProcessorTimeSeconds; ToJsonUtilP(ProcessorTimeSeconds, each_ProcessorTimeSeconds); ToJsonField(output, keyProcessorTimeSeconds) = each_ProcessorTimeSeconds;
+            Json::Value each_Revision; ToJsonUtilP(Revision, each_Revision); ToJsonField(output, keyRevision) = each_Revision;
+            return output;
+        }
+
+        void ExecuteCloudScriptServerRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyFunctionName), FunctionName);
+            FunctionParameter = FromJsonField(input, keyFunctionParameter);
+            FromJsonUtilP(FromJsonField(input, keyGeneratePlayStreamEvent), GeneratePlayStreamEvent);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilE(FromJsonField(input, keyRevisionSelection), RevisionSelection);
+            FromJsonUtilP(FromJsonField(input, keySpecificRevision), SpecificRevision);
+        }
+
+        Json::Value ExecuteCloudScriptServerRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_FunctionName; ToJsonUtilS(FunctionName, each_FunctionName); ToJsonField(output, keyFunctionName) = each_FunctionName;
+            ToJsonField(output, keyFunctionParameter) = FunctionParameter;
+            Json::Value each_GeneratePlayStreamEvent; ToJsonUtilP(GeneratePlayStreamEvent, each_GeneratePlayStreamEvent); ToJsonField(output, keyGeneratePlayStreamEvent) = each_GeneratePlayStreamEvent;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_RevisionSelection; ToJsonUtilE(RevisionSelection, each_RevisionSelection); ToJsonField(output, keyRevisionSelection) = each_RevisionSelection;
+            Json::Value each_SpecificRevision; ToJsonUtilP(SpecificRevision, each_SpecificRevision); ToJsonField(output, keySpecificRevision) = each_SpecificRevision;
+            return output;
+        }
+
+        void FacebookInstantGamesPlayFabIdPair::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyFacebookInstantGamesId), FacebookInstantGamesId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value FacebookInstantGamesPlayFabIdPair::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_FacebookInstantGamesId; ToJsonUtilS(FacebookInstantGamesId, each_FacebookInstantGamesId); ToJsonField(output, keyFacebookInstantGamesId) = each_FacebookInstantGamesId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void FacebookPlayFabIdPair::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyFacebookId), FacebookId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value FacebookPlayFabIdPair::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_FacebookId; ToJsonUtilS(FacebookId, each_FacebookId); ToJsonField(output, keyFacebookId) = each_FacebookId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void LinkedPlatformAccountModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyEmail), Email);
+            FromJsonUtilE(FromJsonField(input, keyPlatform), Platform);
+            FromJsonUtilS(FromJsonField(input, keyPlatformUserId), PlatformUserId);
+            FromJsonUtilS(FromJsonField(input, keyUsername), Username);
+        }
+
+        Json::Value LinkedPlatformAccountModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Email; ToJsonUtilS(Email, each_Email); ToJsonField(output, keyEmail) = each_Email;
+            Json::Value each_Platform; ToJsonUtilE(Platform, each_Platform); ToJsonField(output, keyPlatform) = each_Platform;
+            Json::Value each_PlatformUserId; ToJsonUtilS(PlatformUserId, each_PlatformUserId); ToJsonField(output, keyPlatformUserId) = each_PlatformUserId;
+            Json::Value each_Username; ToJsonUtilS(Username, each_Username); ToJsonField(output, keyUsername) = each_Username;
+            return output;
+        }
+
+        void LocationModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCity), City);
+            FromJsonUtilE(FromJsonField(input, keyContinentCode), pfContinentCode);
+            FromJsonUtilE(FromJsonField(input, keyCountryCode), pfCountryCode);
+            FromJsonUtilP(FromJsonField(input, keyLatitude), Latitude);
+            FromJsonUtilP(FromJsonField(input, keyLongitude), Longitude);
+        }
+
+        Json::Value LocationModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_City; ToJsonUtilS(City, each_City); ToJsonField(output, keyCity) = each_City;
+            Json::Value each_pfContinentCode; ToJsonUtilE(pfContinentCode, each_pfContinentCode); ToJsonField(output, keyContinentCode) = each_pfContinentCode;
+            Json::Value each_pfCountryCode; ToJsonUtilE(pfCountryCode, each_pfCountryCode); ToJsonField(output, keyCountryCode) = each_pfCountryCode;
+            Json::Value each_Latitude; ToJsonUtilP(Latitude, each_Latitude); ToJsonField(output, keyLatitude) = each_Latitude;
+            Json::Value each_Longitude; ToJsonUtilP(Longitude, each_Longitude); ToJsonField(output, keyLongitude) = each_Longitude;
+            return output;
+        }
+
+        void SubscriptionModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilT(FromJsonField(input, keyExpiration), Expiration);
+            FromJsonUtilT(FromJsonField(input, keyInitialSubscriptionTime), InitialSubscriptionTime);
+            FromJsonUtilP(FromJsonField(input, keyIsActive), IsActive);
+            FromJsonUtilE(FromJsonField(input, keyStatus), Status);
+            FromJsonUtilS(FromJsonField(input, keySubscriptionId), SubscriptionId);
+            FromJsonUtilS(FromJsonField(input, keySubscriptionItemId), SubscriptionItemId);
+            FromJsonUtilS(FromJsonField(input, keySubscriptionProvider), SubscriptionProvider);
+        }
+
+        Json::Value SubscriptionModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Expiration; ToJsonUtilT(Expiration, each_Expiration); ToJsonField(output, keyExpiration) = each_Expiration;
+            Json::Value each_InitialSubscriptionTime; ToJsonUtilT(InitialSubscriptionTime, each_InitialSubscriptionTime); ToJsonField(output, keyInitialSubscriptionTime) = each_InitialSubscriptionTime;
+            Json::Value each_IsActive; ToJsonUtilP(IsActive, each_IsActive); ToJsonField(output, keyIsActive) = each_IsActive;
+            Json::Value each_Status; ToJsonUtilE(Status, each_Status); ToJsonField(output, keyStatus) = each_Status;
+            Json::Value each_SubscriptionId; ToJsonUtilS(SubscriptionId, each_SubscriptionId); ToJsonField(output, keySubscriptionId) = each_SubscriptionId;
+            Json::Value each_SubscriptionItemId; ToJsonUtilS(SubscriptionItemId, each_SubscriptionItemId); ToJsonField(output, keySubscriptionItemId) = each_SubscriptionItemId;
+            Json::Value each_SubscriptionProvider; ToJsonUtilS(SubscriptionProvider, each_SubscriptionProvider); ToJsonField(output, keySubscriptionProvider) = each_SubscriptionProvider;
+            return output;
+        }
+
+        void MembershipModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyIsActive), IsActive);
+            FromJsonUtilT(FromJsonField(input, keyMembershipExpiration), MembershipExpiration);
+            FromJsonUtilS(FromJsonField(input, keyMembershipId), MembershipId);
+            FromJsonUtilT(FromJsonField(input, keyOverrideExpiration), OverrideExpiration);
+            FromJsonUtilO(FromJsonField(input, keySubscriptions), Subscriptions);
+        }
+
+        Json::Value MembershipModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_IsActive; ToJsonUtilP(IsActive, each_IsActive); ToJsonField(output, keyIsActive) = each_IsActive;
+            Json::Value each_MembershipExpiration; ToJsonUtilT(MembershipExpiration, each_MembershipExpiration); ToJsonField(output, keyMembershipExpiration) = each_MembershipExpiration;
+            Json::Value each_MembershipId; ToJsonUtilS(MembershipId, each_MembershipId); ToJsonField(output, keyMembershipId) = each_MembershipId;
+            Json::Value each_OverrideExpiration; ToJsonUtilT(OverrideExpiration, each_OverrideExpiration); ToJsonField(output, keyOverrideExpiration) = each_OverrideExpiration;
+            Json::Value each_Subscriptions; ToJsonUtilO(Subscriptions, each_Subscriptions); ToJsonField(output, keySubscriptions) = each_Subscriptions;
+            return output;
+        }
+
+        void PushNotificationRegistrationModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyNotificationEndpointARN), NotificationEndpointARN);
+            FromJsonUtilE(FromJsonField(input, keyPlatform), Platform);
+        }
+
+        Json::Value PushNotificationRegistrationModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_NotificationEndpointARN; ToJsonUtilS(NotificationEndpointARN, each_NotificationEndpointARN); ToJsonField(output, keyNotificationEndpointARN) = each_NotificationEndpointARN;
+            Json::Value each_Platform; ToJsonUtilE(Platform, each_Platform); ToJsonField(output, keyPlatform) = each_Platform;
+            return output;
+        }
+
+        void StatisticModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilP(FromJsonField(input, keyValue), Value);
+            FromJsonUtilP(FromJsonField(input, keyVersion), Version);
+        }
+
+        Json::Value StatisticModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_Value; ToJsonUtilP(Value, each_Value); ToJsonField(output, keyValue) = each_Value;
+            Json::Value each_Version; ToJsonUtilP(Version, each_Version); ToJsonField(output, keyVersion) = each_Version;
+            return output;
+        }
+
+        void TagModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyTagValue), TagValue);
+        }
+
+        Json::Value TagModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_TagValue; ToJsonUtilS(TagValue, each_TagValue); ToJsonField(output, keyTagValue) = each_TagValue;
+            return output;
+        }
+
+        void ValueToDateModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCurrency), Currency);
+            FromJsonUtilP(FromJsonField(input, keyTotalValue), TotalValue);
+            FromJsonUtilS(FromJsonField(input, keyTotalValueAsDecimal), TotalValueAsDecimal);
+        }
+
+        Json::Value ValueToDateModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Currency; ToJsonUtilS(Currency, each_Currency); ToJsonField(output, keyCurrency) = each_Currency;
+            Json::Value each_TotalValue; ToJsonUtilP(TotalValue, each_TotalValue); ToJsonField(output, keyTotalValue) = each_TotalValue;
+            Json::Value each_TotalValueAsDecimal; ToJsonUtilS(TotalValueAsDecimal, each_TotalValueAsDecimal); ToJsonField(output, keyTotalValueAsDecimal) = each_TotalValueAsDecimal;
+            return output;
+        }
+
+        void PlayerProfileModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyAdCampaignAttributions), AdCampaignAttributions);
+            FromJsonUtilS(FromJsonField(input, keyAvatarUrl), AvatarUrl);
+            FromJsonUtilT(FromJsonField(input, keyBannedUntil), BannedUntil);
+            FromJsonUtilO(FromJsonField(input, keyContactEmailAddresses), ContactEmailAddresses);
+            FromJsonUtilT(FromJsonField(input, keyCreated), Created);
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+            FromJsonUtilS(FromJsonField(input, keyExperimentVariants), ExperimentVariants);
+            FromJsonUtilT(FromJsonField(input, keyLastLogin), LastLogin);
+            FromJsonUtilO(FromJsonField(input, keyLinkedAccounts), LinkedAccounts);
+            FromJsonUtilO(FromJsonField(input, keyLocations), Locations);
+            FromJsonUtilO(FromJsonField(input, keyMemberships), Memberships);
+            FromJsonUtilE(FromJsonField(input, keyOrigination), Origination);
+            FromJsonUtilS(FromJsonField(input, keyPlayerId), PlayerId);
+            FromJsonUtilS(FromJsonField(input, keyPublisherId), PublisherId);
+            FromJsonUtilO(FromJsonField(input, keyPushNotificationRegistrations), PushNotificationRegistrations);
+            FromJsonUtilO(FromJsonField(input, keyStatistics), Statistics);
+            FromJsonUtilO(FromJsonField(input, keyTags), Tags);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+            FromJsonUtilP(FromJsonField(input, keyTotalValueToDateInUSD), TotalValueToDateInUSD);
+            FromJsonUtilO(FromJsonField(input, keyValuesToDate), ValuesToDate);
+        }
+
+        Json::Value PlayerProfileModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AdCampaignAttributions; ToJsonUtilO(AdCampaignAttributions, each_AdCampaignAttributions); ToJsonField(output, keyAdCampaignAttributions) = each_AdCampaignAttributions;
+            Json::Value each_AvatarUrl; ToJsonUtilS(AvatarUrl, each_AvatarUrl); ToJsonField(output, keyAvatarUrl) = each_AvatarUrl;
+            Json::Value each_BannedUntil; ToJsonUtilT(BannedUntil, each_BannedUntil); ToJsonField(output, keyBannedUntil) = each_BannedUntil;
+            Json::Value each_ContactEmailAddresses; ToJsonUtilO(ContactEmailAddresses, each_ContactEmailAddresses); ToJsonField(output, keyContactEmailAddresses) = each_ContactEmailAddresses;
+            Json::Value each_Created; ToJsonUtilT(Created, each_Created); ToJsonField(output, keyCreated) = each_Created;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            Json::Value each_ExperimentVariants; ToJsonUtilS(ExperimentVariants, each_ExperimentVariants); ToJsonField(output, keyExperimentVariants) = each_ExperimentVariants;
+            Json::Value each_LastLogin; ToJsonUtilT(LastLogin, each_LastLogin); ToJsonField(output, keyLastLogin) = each_LastLogin;
+            Json::Value each_LinkedAccounts; ToJsonUtilO(LinkedAccounts, each_LinkedAccounts); ToJsonField(output, keyLinkedAccounts) = each_LinkedAccounts;
+            Json::Value each_Locations; ToJsonUtilO(Locations, each_Locations); ToJsonField(output, keyLocations) = each_Locations;
+            Json::Value each_Memberships; ToJsonUtilO(Memberships, each_Memberships); ToJsonField(output, keyMemberships) = each_Memberships;
+            Json::Value each_Origination; ToJsonUtilE(Origination, each_Origination); ToJsonField(output, keyOrigination) = each_Origination;
+            Json::Value each_PlayerId; ToJsonUtilS(PlayerId, each_PlayerId); ToJsonField(output, keyPlayerId) = each_PlayerId;
+            Json::Value each_PublisherId; ToJsonUtilS(PublisherId, each_PublisherId); ToJsonField(output, keyPublisherId) = each_PublisherId;
+            Json::Value each_PushNotificationRegistrations; ToJsonUtilO(PushNotificationRegistrations, each_PushNotificationRegistrations); ToJsonField(output, keyPushNotificationRegistrations) = each_PushNotificationRegistrations;
+            Json::Value each_Statistics; ToJsonUtilO(Statistics, each_Statistics); ToJsonField(output, keyStatistics) = each_Statistics;
+            Json::Value each_Tags; ToJsonUtilO(Tags, each_Tags); ToJsonField(output, keyTags) = each_Tags;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            Json::Value each_TotalValueToDateInUSD; ToJsonUtilP(TotalValueToDateInUSD, each_TotalValueToDateInUSD); ToJsonField(output, keyTotalValueToDateInUSD) = each_TotalValueToDateInUSD;
+            Json::Value each_ValuesToDate; ToJsonUtilO(ValuesToDate, each_ValuesToDate); ToJsonField(output, keyValuesToDate) = each_ValuesToDate;
+            return output;
+        }
+
+        void FriendInfo::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyFacebookInfo), FacebookInfo);
+            FromJsonUtilS(FromJsonField(input, keyFriendPlayFabId), FriendPlayFabId);
+            FromJsonUtilO(FromJsonField(input, keyGameCenterInfo), GameCenterInfo);
+            FromJsonUtilO(FromJsonField(input, keyProfile), Profile);
+            FromJsonUtilO(FromJsonField(input, keyPSNInfo), PSNInfo);
+            FromJsonUtilO(FromJsonField(input, keySteamInfo), SteamInfo);
+            FromJsonUtilS(FromJsonField(input, keyTags), Tags);
+            FromJsonUtilS(FromJsonField(input, keyTitleDisplayName), TitleDisplayName);
+            FromJsonUtilS(FromJsonField(input, keyUsername), Username);
+            FromJsonUtilO(FromJsonField(input, keyXboxInfo), XboxInfo);
+        }
+
+        Json::Value FriendInfo::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_FacebookInfo; ToJsonUtilO(FacebookInfo, each_FacebookInfo); ToJsonField(output, keyFacebookInfo) = each_FacebookInfo;
+            Json::Value each_FriendPlayFabId; ToJsonUtilS(FriendPlayFabId, each_FriendPlayFabId); ToJsonField(output, keyFriendPlayFabId) = each_FriendPlayFabId;
+            Json::Value each_GameCenterInfo; ToJsonUtilO(GameCenterInfo, each_GameCenterInfo); ToJsonField(output, keyGameCenterInfo) = each_GameCenterInfo;
+            Json::Value each_Profile; ToJsonUtilO(Profile, each_Profile); ToJsonField(output, keyProfile) = each_Profile;
+            Json::Value each_PSNInfo; ToJsonUtilO(PSNInfo, each_PSNInfo); ToJsonField(output, keyPSNInfo) = each_PSNInfo;
+            Json::Value each_SteamInfo; ToJsonUtilO(SteamInfo, each_SteamInfo); ToJsonField(output, keySteamInfo) = each_SteamInfo;
+            Json::Value each_Tags; ToJsonUtilS(Tags, each_Tags); ToJsonField(output, keyTags) = each_Tags;
+            Json::Value each_TitleDisplayName; ToJsonUtilS(TitleDisplayName, each_TitleDisplayName); ToJsonField(output, keyTitleDisplayName) = each_TitleDisplayName;
+            Json::Value each_Username; ToJsonUtilS(Username, each_Username); ToJsonField(output, keyUsername) = each_Username;
+            Json::Value each_XboxInfo; ToJsonUtilO(XboxInfo, each_XboxInfo); ToJsonField(output, keyXboxInfo) = each_XboxInfo;
+            return output;
+        }
+
+        void GenericPlayFabIdPair::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyGenericId), GenericId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GenericPlayFabIdPair::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GenericId; ToJsonUtilO(GenericId, each_GenericId); ToJsonField(output, keyGenericId) = each_GenericId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void GetAllSegmentsRequest::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value GetAllSegmentsRequest::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void GetSegmentResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyABTestParent), ABTestParent);
+            FromJsonUtilS(FromJsonField(input, keyId), Id);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+        }
+
+        Json::Value GetSegmentResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ABTestParent; ToJsonUtilS(ABTestParent, each_ABTestParent); ToJsonField(output, keyABTestParent) = each_ABTestParent;
+            Json::Value each_Id; ToJsonUtilS(Id, each_Id); ToJsonField(output, keyId) = each_Id;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            return output;
+        }
+
+        void GetAllSegmentsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keySegments), Segments);
+        }
+
+        Json::Value GetAllSegmentsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Segments; ToJsonUtilO(Segments, each_Segments); ToJsonField(output, keySegments) = each_Segments;
+            return output;
+        }
+
+        void GetCatalogItemsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+        }
+
+        Json::Value GetCatalogItemsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            return output;
+        }
+
+        void GetCatalogItemsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyCatalog), Catalog);
+        }
+
+        Json::Value GetCatalogItemsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Catalog; ToJsonUtilO(Catalog, each_Catalog); ToJsonField(output, keyCatalog) = each_Catalog;
+            return output;
+        }
+
+        void GetCharacterDataRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilP(FromJsonField(input, keyIfChangedFromDataVersion), IfChangedFromDataVersion);
+            FromJsonUtilS(FromJsonField(input, keyKeys), Keys);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GetCharacterDataRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_IfChangedFromDataVersion; ToJsonUtilP(IfChangedFromDataVersion, each_IfChangedFromDataVersion); ToJsonField(output, keyIfChangedFromDataVersion) = each_IfChangedFromDataVersion;
+            Json::Value each_Keys; ToJsonUtilS(Keys, each_Keys); ToJsonField(output, keyKeys) = each_Keys;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void UserDataRecord::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilT(FromJsonField(input, keyLastUpdated), LastUpdated);
+            FromJsonUtilE(FromJsonField(input, keyPermission), Permission);
+            FromJsonUtilS(FromJsonField(input, keyValue), Value);
+        }
+
+        Json::Value UserDataRecord::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_LastUpdated; ToJsonUtilT(LastUpdated, each_LastUpdated); ToJsonField(output, keyLastUpdated) = each_LastUpdated;
+            Json::Value each_Permission; ToJsonUtilE(Permission, each_Permission); ToJsonField(output, keyPermission) = each_Permission;
+            Json::Value each_Value; ToJsonUtilS(Value, each_Value); ToJsonField(output, keyValue) = each_Value;
+            return output;
+        }
+
+        void GetCharacterDataResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilO(FromJsonField(input, keyData), Data);
+            FromJsonUtilP(FromJsonField(input, keyDataVersion), DataVersion);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GetCharacterDataResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_Data; ToJsonUtilO(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            Json::Value each_DataVersion; ToJsonUtilP(DataVersion, each_DataVersion); ToJsonField(output, keyDataVersion) = each_DataVersion;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void GetCharacterInventoryRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GetCharacterInventoryRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void VirtualCurrencyRechargeTime::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyRechargeMax), RechargeMax);
+            FromJsonUtilT(FromJsonField(input, keyRechargeTime), RechargeTime);
+            FromJsonUtilP(FromJsonField(input, keySecondsToRecharge), SecondsToRecharge);
+        }
+
+        Json::Value VirtualCurrencyRechargeTime::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_RechargeMax; ToJsonUtilP(RechargeMax, each_RechargeMax); ToJsonField(output, keyRechargeMax) = each_RechargeMax;
+            Json::Value each_RechargeTime; ToJsonUtilT(RechargeTime, each_RechargeTime); ToJsonField(output, keyRechargeTime) = each_RechargeTime;
+            Json::Value each_SecondsToRecharge; ToJsonUtilP(SecondsToRecharge, each_SecondsToRecharge); ToJsonField(output, keySecondsToRecharge) = each_SecondsToRecharge;
+            return output;
+        }
+
+        void GetCharacterInventoryResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilO(FromJsonField(input, keyInventory), Inventory);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilP(FromJsonField(input, keyVirtualCurrency), VirtualCurrency);
+            FromJsonUtilO(FromJsonField(input, keyVirtualCurrencyRechargeTimes), VirtualCurrencyRechargeTimes);
+        }
+
+        Json::Value GetCharacterInventoryResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_Inventory; ToJsonUtilO(Inventory, each_Inventory); ToJsonField(output, keyInventory) = each_Inventory;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_VirtualCurrency; ToJsonUtilP(VirtualCurrency, each_VirtualCurrency); ToJsonField(output, keyVirtualCurrency) = each_VirtualCurrency;
+            Json::Value each_VirtualCurrencyRechargeTimes; ToJsonUtilO(VirtualCurrencyRechargeTimes, each_VirtualCurrencyRechargeTimes); ToJsonField(output, keyVirtualCurrencyRechargeTimes) = each_VirtualCurrencyRechargeTimes;
+            return output;
+        }
+
+        void GetCharacterLeaderboardRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterType), CharacterType);
+            FromJsonUtilP(FromJsonField(input, keyMaxResultsCount), MaxResultsCount);
+            FromJsonUtilP(FromJsonField(input, keyStartPosition), StartPosition);
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+        }
+
+        Json::Value GetCharacterLeaderboardRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterType; ToJsonUtilS(CharacterType, each_CharacterType); ToJsonField(output, keyCharacterType) = each_CharacterType;
+            Json::Value each_MaxResultsCount; ToJsonUtilP(MaxResultsCount, each_MaxResultsCount); ToJsonField(output, keyMaxResultsCount) = each_MaxResultsCount;
+            Json::Value each_StartPosition; ToJsonUtilP(StartPosition, each_StartPosition); ToJsonField(output, keyStartPosition) = each_StartPosition;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            return output;
+        }
+
+        void GetCharacterLeaderboardResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyLeaderboard), Leaderboard);
+        }
+
+        Json::Value GetCharacterLeaderboardResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Leaderboard; ToJsonUtilO(Leaderboard, each_Leaderboard); ToJsonField(output, keyLeaderboard) = each_Leaderboard;
+            return output;
+        }
+
+        void GetCharacterStatisticsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GetCharacterStatisticsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void GetCharacterStatisticsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilP(FromJsonField(input, keyCharacterStatistics), CharacterStatistics);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GetCharacterStatisticsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_CharacterStatistics; ToJsonUtilP(CharacterStatistics, each_CharacterStatistics); ToJsonField(output, keyCharacterStatistics) = each_CharacterStatistics;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void GetContentDownloadUrlRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyHttpMethod), HttpMethod);
+            FromJsonUtilS(FromJsonField(input, keyKey), Key);
+            FromJsonUtilP(FromJsonField(input, keyThruCDN), ThruCDN);
+        }
+
+        Json::Value GetContentDownloadUrlRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_HttpMethod; ToJsonUtilS(HttpMethod, each_HttpMethod); ToJsonField(output, keyHttpMethod) = each_HttpMethod;
+            Json::Value each_Key; ToJsonUtilS(Key, each_Key); ToJsonField(output, keyKey) = each_Key;
+            Json::Value each_ThruCDN; ToJsonUtilP(ThruCDN, each_ThruCDN); ToJsonField(output, keyThruCDN) = each_ThruCDN;
+            return output;
+        }
+
+        void GetContentDownloadUrlResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyURL), URL);
+        }
+
+        Json::Value GetContentDownloadUrlResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_URL; ToJsonUtilS(URL, each_URL); ToJsonField(output, keyURL) = each_URL;
+            return output;
+        }
+
+        void PlayerProfileViewConstraints::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyShowAvatarUrl), ShowAvatarUrl);
+            FromJsonUtilP(FromJsonField(input, keyShowBannedUntil), ShowBannedUntil);
+            FromJsonUtilP(FromJsonField(input, keyShowCampaignAttributions), ShowCampaignAttributions);
+            FromJsonUtilP(FromJsonField(input, keyShowContactEmailAddresses), ShowContactEmailAddresses);
+            FromJsonUtilP(FromJsonField(input, keyShowCreated), ShowCreated);
+            FromJsonUtilP(FromJsonField(input, keyShowDisplayName), ShowDisplayName);
+            FromJsonUtilP(FromJsonField(input, keyShowExperimentVariants), ShowExperimentVariants);
+            FromJsonUtilP(FromJsonField(input, keyShowLastLogin), ShowLastLogin);
+            FromJsonUtilP(FromJsonField(input, keyShowLinkedAccounts), ShowLinkedAccounts);
+            FromJsonUtilP(FromJsonField(input, keyShowLocations), ShowLocations);
+            FromJsonUtilP(FromJsonField(input, keyShowMemberships), ShowMemberships);
+            FromJsonUtilP(FromJsonField(input, keyShowOrigination), ShowOrigination);
+            FromJsonUtilP(FromJsonField(input, keyShowPushNotificationRegistrations), ShowPushNotificationRegistrations);
+            FromJsonUtilP(FromJsonField(input, keyShowStatistics), ShowStatistics);
+            FromJsonUtilP(FromJsonField(input, keyShowTags), ShowTags);
+            FromJsonUtilP(FromJsonField(input, keyShowTotalValueToDateInUsd), ShowTotalValueToDateInUsd);
+            FromJsonUtilP(FromJsonField(input, keyShowValuesToDate), ShowValuesToDate);
+        }
+
+        Json::Value PlayerProfileViewConstraints::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ShowAvatarUrl; ToJsonUtilP(ShowAvatarUrl, each_ShowAvatarUrl); ToJsonField(output, keyShowAvatarUrl) = each_ShowAvatarUrl;
+            Json::Value each_ShowBannedUntil; ToJsonUtilP(ShowBannedUntil, each_ShowBannedUntil); ToJsonField(output, keyShowBannedUntil) = each_ShowBannedUntil;
+            Json::Value each_ShowCampaignAttributions; ToJsonUtilP(ShowCampaignAttributions, each_ShowCampaignAttributions); ToJsonField(output, keyShowCampaignAttributions) = each_ShowCampaignAttributions;
+            Json::Value each_ShowContactEmailAddresses; ToJsonUtilP(ShowContactEmailAddresses, each_ShowContactEmailAddresses); ToJsonField(output, keyShowContactEmailAddresses) = each_ShowContactEmailAddresses;
+            Json::Value each_ShowCreated; ToJsonUtilP(ShowCreated, each_ShowCreated); ToJsonField(output, keyShowCreated) = each_ShowCreated;
+            Json::Value each_ShowDisplayName; ToJsonUtilP(ShowDisplayName, each_ShowDisplayName); ToJsonField(output, keyShowDisplayName) = each_ShowDisplayName;
+            Json::Value each_ShowExperimentVariants; ToJsonUtilP(ShowExperimentVariants, each_ShowExperimentVariants); ToJsonField(output, keyShowExperimentVariants) = each_ShowExperimentVariants;
+            Json::Value each_ShowLastLogin; ToJsonUtilP(ShowLastLogin, each_ShowLastLogin); ToJsonField(output, keyShowLastLogin) = each_ShowLastLogin;
+            Json::Value each_ShowLinkedAccounts; ToJsonUtilP(ShowLinkedAccounts, each_ShowLinkedAccounts); ToJsonField(output, keyShowLinkedAccounts) = each_ShowLinkedAccounts;
+            Json::Value each_ShowLocations; ToJsonUtilP(ShowLocations, each_ShowLocations); ToJsonField(output, keyShowLocations) = each_ShowLocations;
+            Json::Value each_ShowMemberships; ToJsonUtilP(ShowMemberships, each_ShowMemberships); ToJsonField(output, keyShowMemberships) = each_ShowMemberships;
+            Json::Value each_ShowOrigination; ToJsonUtilP(ShowOrigination, each_ShowOrigination); ToJsonField(output, keyShowOrigination) = each_ShowOrigination;
+            Json::Value each_ShowPushNotificationRegistrations; ToJsonUtilP(ShowPushNotificationRegistrations, each_ShowPushNotificationRegistrations); ToJsonField(output, keyShowPushNotificationRegistrations) = each_ShowPushNotificationRegistrations;
+            Json::Value each_ShowStatistics; ToJsonUtilP(ShowStatistics, each_ShowStatistics); ToJsonField(output, keyShowStatistics) = each_ShowStatistics;
+            Json::Value each_ShowTags; ToJsonUtilP(ShowTags, each_ShowTags); ToJsonField(output, keyShowTags) = each_ShowTags;
+            Json::Value each_ShowTotalValueToDateInUsd; ToJsonUtilP(ShowTotalValueToDateInUsd, each_ShowTotalValueToDateInUsd); ToJsonField(output, keyShowTotalValueToDateInUsd) = each_ShowTotalValueToDateInUsd;
+            Json::Value each_ShowValuesToDate; ToJsonUtilP(ShowValuesToDate, each_ShowValuesToDate); ToJsonField(output, keyShowValuesToDate) = each_ShowValuesToDate;
+            return output;
+        }
+
+        void GetFriendLeaderboardRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyIncludeFacebookFriends), IncludeFacebookFriends);
+            FromJsonUtilP(FromJsonField(input, keyIncludeSteamFriends), IncludeSteamFriends);
+            FromJsonUtilP(FromJsonField(input, keyMaxResultsCount), MaxResultsCount);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilO(FromJsonField(input, keyProfileConstraints), ProfileConstraints);
+            FromJsonUtilP(FromJsonField(input, keyStartPosition), StartPosition);
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+            FromJsonUtilP(FromJsonField(input, keyVersion), Version);
+            FromJsonUtilS(FromJsonField(input, keyXboxToken), XboxToken);
+        }
+
+        Json::Value GetFriendLeaderboardRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_IncludeFacebookFriends; ToJsonUtilP(IncludeFacebookFriends, each_IncludeFacebookFriends); ToJsonField(output, keyIncludeFacebookFriends) = each_IncludeFacebookFriends;
+            Json::Value each_IncludeSteamFriends; ToJsonUtilP(IncludeSteamFriends, each_IncludeSteamFriends); ToJsonField(output, keyIncludeSteamFriends) = each_IncludeSteamFriends;
+            Json::Value each_MaxResultsCount; ToJsonUtilP(MaxResultsCount, each_MaxResultsCount); ToJsonField(output, keyMaxResultsCount) = each_MaxResultsCount;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_ProfileConstraints; ToJsonUtilO(ProfileConstraints, each_ProfileConstraints); ToJsonField(output, keyProfileConstraints) = each_ProfileConstraints;
+            Json::Value each_StartPosition; ToJsonUtilP(StartPosition, each_StartPosition); ToJsonField(output, keyStartPosition) = each_StartPosition;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            Json::Value each_Version; ToJsonUtilP(Version, each_Version); ToJsonField(output, keyVersion) = each_Version;
+            Json::Value each_XboxToken; ToJsonUtilS(XboxToken, each_XboxToken); ToJsonField(output, keyXboxToken) = each_XboxToken;
+            return output;
+        }
+
+        void GetFriendsListRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyIncludeFacebookFriends), IncludeFacebookFriends);
+            FromJsonUtilP(FromJsonField(input, keyIncludeSteamFriends), IncludeSteamFriends);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilO(FromJsonField(input, keyProfileConstraints), ProfileConstraints);
+            FromJsonUtilS(FromJsonField(input, keyXboxToken), XboxToken);
+        }
+
+        Json::Value GetFriendsListRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_IncludeFacebookFriends; ToJsonUtilP(IncludeFacebookFriends, each_IncludeFacebookFriends); ToJsonField(output, keyIncludeFacebookFriends) = each_IncludeFacebookFriends;
+            Json::Value each_IncludeSteamFriends; ToJsonUtilP(IncludeSteamFriends, each_IncludeSteamFriends); ToJsonField(output, keyIncludeSteamFriends) = each_IncludeSteamFriends;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_ProfileConstraints; ToJsonUtilO(ProfileConstraints, each_ProfileConstraints); ToJsonField(output, keyProfileConstraints) = each_ProfileConstraints;
+            Json::Value each_XboxToken; ToJsonUtilS(XboxToken, each_XboxToken); ToJsonField(output, keyXboxToken) = each_XboxToken;
+            return output;
+        }
+
+        void GetFriendsListResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyFriends), Friends);
+        }
+
+        Json::Value GetFriendsListResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Friends; ToJsonUtilO(Friends, each_Friends); ToJsonField(output, keyFriends) = each_Friends;
+            return output;
+        }
+
+        void GetLeaderboardAroundCharacterRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyCharacterType), CharacterType);
+            FromJsonUtilP(FromJsonField(input, keyMaxResultsCount), MaxResultsCount);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+        }
+
+        Json::Value GetLeaderboardAroundCharacterRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_CharacterType; ToJsonUtilS(CharacterType, each_CharacterType); ToJsonField(output, keyCharacterType) = each_CharacterType;
+            Json::Value each_MaxResultsCount; ToJsonUtilP(MaxResultsCount, each_MaxResultsCount); ToJsonField(output, keyMaxResultsCount) = each_MaxResultsCount;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            return output;
+        }
+
+        void GetLeaderboardAroundCharacterResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyLeaderboard), Leaderboard);
+        }
+
+        Json::Value GetLeaderboardAroundCharacterResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Leaderboard; ToJsonUtilO(Leaderboard, each_Leaderboard); ToJsonField(output, keyLeaderboard) = each_Leaderboard;
+            return output;
+        }
+
+        void GetLeaderboardAroundUserRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyMaxResultsCount), MaxResultsCount);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilO(FromJsonField(input, keyProfileConstraints), ProfileConstraints);
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+            FromJsonUtilP(FromJsonField(input, keyVersion), Version);
+        }
+
+        Json::Value GetLeaderboardAroundUserRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_MaxResultsCount; ToJsonUtilP(MaxResultsCount, each_MaxResultsCount); ToJsonField(output, keyMaxResultsCount) = each_MaxResultsCount;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_ProfileConstraints; ToJsonUtilO(ProfileConstraints, each_ProfileConstraints); ToJsonField(output, keyProfileConstraints) = each_ProfileConstraints;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            Json::Value each_Version; ToJsonUtilP(Version, each_Version); ToJsonField(output, keyVersion) = each_Version;
+            return output;
+        }
+
+        void PlayerLeaderboardEntry::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilP(FromJsonField(input, keyPosition), Position);
+            FromJsonUtilO(FromJsonField(input, keyProfile), Profile);
+            FromJsonUtilP(FromJsonField(input, keyStatValue), StatValue);
+        }
+
+        Json::Value PlayerLeaderboardEntry::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_Position; ToJsonUtilP(Position, each_Position); ToJsonField(output, keyPosition) = each_Position;
+            Json::Value each_Profile; ToJsonUtilO(Profile, each_Profile); ToJsonField(output, keyProfile) = each_Profile;
+            Json::Value each_StatValue; ToJsonUtilP(StatValue, each_StatValue); ToJsonField(output, keyStatValue) = each_StatValue;
+            return output;
+        }
+
+        void GetLeaderboardAroundUserResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyLeaderboard), Leaderboard);
+            FromJsonUtilT(FromJsonField(input, keyNextReset), NextReset);
+            FromJsonUtilP(FromJsonField(input, keyVersion), Version);
+        }
+
+        Json::Value GetLeaderboardAroundUserResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Leaderboard; ToJsonUtilO(Leaderboard, each_Leaderboard); ToJsonField(output, keyLeaderboard) = each_Leaderboard;
+            Json::Value each_NextReset; ToJsonUtilT(NextReset, each_NextReset); ToJsonField(output, keyNextReset) = each_NextReset;
+            Json::Value each_Version; ToJsonUtilP(Version, each_Version); ToJsonField(output, keyVersion) = each_Version;
+            return output;
+        }
+
+        void GetLeaderboardForUsersCharactersRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyMaxResultsCount), MaxResultsCount);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+        }
+
+        Json::Value GetLeaderboardForUsersCharactersRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_MaxResultsCount; ToJsonUtilP(MaxResultsCount, each_MaxResultsCount); ToJsonField(output, keyMaxResultsCount) = each_MaxResultsCount;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            return output;
+        }
+
+        void GetLeaderboardForUsersCharactersResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyLeaderboard), Leaderboard);
+        }
+
+        Json::Value GetLeaderboardForUsersCharactersResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Leaderboard; ToJsonUtilO(Leaderboard, each_Leaderboard); ToJsonField(output, keyLeaderboard) = each_Leaderboard;
+            return output;
+        }
+
+        void GetLeaderboardRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyMaxResultsCount), MaxResultsCount);
+            FromJsonUtilO(FromJsonField(input, keyProfileConstraints), ProfileConstraints);
+            FromJsonUtilP(FromJsonField(input, keyStartPosition), StartPosition);
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+            FromJsonUtilP(FromJsonField(input, keyVersion), Version);
+        }
+
+        Json::Value GetLeaderboardRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_MaxResultsCount; ToJsonUtilP(MaxResultsCount, each_MaxResultsCount); ToJsonField(output, keyMaxResultsCount) = each_MaxResultsCount;
+            Json::Value each_ProfileConstraints; ToJsonUtilO(ProfileConstraints, each_ProfileConstraints); ToJsonField(output, keyProfileConstraints) = each_ProfileConstraints;
+            Json::Value each_StartPosition; ToJsonUtilP(StartPosition, each_StartPosition); ToJsonField(output, keyStartPosition) = each_StartPosition;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            Json::Value each_Version; ToJsonUtilP(Version, each_Version); ToJsonField(output, keyVersion) = each_Version;
+            return output;
+        }
+
+        void GetLeaderboardResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyLeaderboard), Leaderboard);
+            FromJsonUtilT(FromJsonField(input, keyNextReset), NextReset);
+            FromJsonUtilP(FromJsonField(input, keyVersion), Version);
+        }
+
+        Json::Value GetLeaderboardResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Leaderboard; ToJsonUtilO(Leaderboard, each_Leaderboard); ToJsonField(output, keyLeaderboard) = each_Leaderboard;
+            Json::Value each_NextReset; ToJsonUtilT(NextReset, each_NextReset); ToJsonField(output, keyNextReset) = each_NextReset;
+            Json::Value each_Version; ToJsonUtilP(Version, each_Version); ToJsonField(output, keyVersion) = each_Version;
+            return output;
+        }
+
+        void GetPlayerCombinedInfoRequestParams::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyGetCharacterInventories), GetCharacterInventories);
+            FromJsonUtilP(FromJsonField(input, keyGetCharacterList), GetCharacterList);
+            FromJsonUtilP(FromJsonField(input, keyGetPlayerProfile), GetPlayerProfile);
+            FromJsonUtilP(FromJsonField(input, keyGetPlayerStatistics), GetPlayerStatistics);
+            FromJsonUtilP(FromJsonField(input, keyGetTitleData), GetTitleData);
+            FromJsonUtilP(FromJsonField(input, keyGetUserAccountInfo), GetUserAccountInfo);
+            FromJsonUtilP(FromJsonField(input, keyGetUserData), GetUserData);
+            FromJsonUtilP(FromJsonField(input, keyGetUserInventory), GetUserInventory);
+            FromJsonUtilP(FromJsonField(input, keyGetUserReadOnlyData), GetUserReadOnlyData);
+            FromJsonUtilP(FromJsonField(input, keyGetUserVirtualCurrency), GetUserVirtualCurrency);
+            FromJsonUtilS(FromJsonField(input, keyPlayerStatisticNames), PlayerStatisticNames);
+            FromJsonUtilO(FromJsonField(input, keyProfileConstraints), ProfileConstraints);
+            FromJsonUtilS(FromJsonField(input, keyTitleDataKeys), TitleDataKeys);
+            FromJsonUtilS(FromJsonField(input, keyUserDataKeys), UserDataKeys);
+            FromJsonUtilS(FromJsonField(input, keyUserReadOnlyDataKeys), UserReadOnlyDataKeys);
+        }
+
+        Json::Value GetPlayerCombinedInfoRequestParams::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GetCharacterInventories; ToJsonUtilP(GetCharacterInventories, each_GetCharacterInventories); ToJsonField(output, keyGetCharacterInventories) = each_GetCharacterInventories;
+            Json::Value each_GetCharacterList; ToJsonUtilP(GetCharacterList, each_GetCharacterList); ToJsonField(output, keyGetCharacterList) = each_GetCharacterList;
+            Json::Value each_GetPlayerProfile; ToJsonUtilP(GetPlayerProfile, each_GetPlayerProfile); ToJsonField(output, keyGetPlayerProfile) = each_GetPlayerProfile;
+            Json::Value each_GetPlayerStatistics; ToJsonUtilP(GetPlayerStatistics, each_GetPlayerStatistics); ToJsonField(output, keyGetPlayerStatistics) = each_GetPlayerStatistics;
+            Json::Value each_GetTitleData; ToJsonUtilP(GetTitleData, each_GetTitleData); ToJsonField(output, keyGetTitleData) = each_GetTitleData;
+            Json::Value each_GetUserAccountInfo; ToJsonUtilP(GetUserAccountInfo, each_GetUserAccountInfo); ToJsonField(output, keyGetUserAccountInfo) = each_GetUserAccountInfo;
+            Json::Value each_GetUserData; ToJsonUtilP(GetUserData, each_GetUserData); ToJsonField(output, keyGetUserData) = each_GetUserData;
+            Json::Value each_GetUserInventory; ToJsonUtilP(GetUserInventory, each_GetUserInventory); ToJsonField(output, keyGetUserInventory) = each_GetUserInventory;
+            Json::Value each_GetUserReadOnlyData; ToJsonUtilP(GetUserReadOnlyData, each_GetUserReadOnlyData); ToJsonField(output, keyGetUserReadOnlyData) = each_GetUserReadOnlyData;
+            Json::Value each_GetUserVirtualCurrency; ToJsonUtilP(GetUserVirtualCurrency, each_GetUserVirtualCurrency); ToJsonField(output, keyGetUserVirtualCurrency) = each_GetUserVirtualCurrency;
+            Json::Value each_PlayerStatisticNames; ToJsonUtilS(PlayerStatisticNames, each_PlayerStatisticNames); ToJsonField(output, keyPlayerStatisticNames) = each_PlayerStatisticNames;
+            Json::Value each_ProfileConstraints; ToJsonUtilO(ProfileConstraints, each_ProfileConstraints); ToJsonField(output, keyProfileConstraints) = each_ProfileConstraints;
+            Json::Value each_TitleDataKeys; ToJsonUtilS(TitleDataKeys, each_TitleDataKeys); ToJsonField(output, keyTitleDataKeys) = each_TitleDataKeys;
+            Json::Value each_UserDataKeys; ToJsonUtilS(UserDataKeys, each_UserDataKeys); ToJsonField(output, keyUserDataKeys) = each_UserDataKeys;
+            Json::Value each_UserReadOnlyDataKeys; ToJsonUtilS(UserReadOnlyDataKeys, each_UserReadOnlyDataKeys); ToJsonField(output, keyUserReadOnlyDataKeys) = each_UserReadOnlyDataKeys;
+            return output;
+        }
+
+        void GetPlayerCombinedInfoRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyInfoRequestParameters), InfoRequestParameters);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GetPlayerCombinedInfoRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); ToJsonField(output, keyInfoRequestParameters) = each_InfoRequestParameters;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void StatisticValue::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+            FromJsonUtilP(FromJsonField(input, keyValue), Value);
+            FromJsonUtilP(FromJsonField(input, keyVersion), Version);
+        }
+
+        Json::Value StatisticValue::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            Json::Value each_Value; ToJsonUtilP(Value, each_Value); ToJsonField(output, keyValue) = each_Value;
+            Json::Value each_Version; ToJsonUtilP(Version, each_Version); ToJsonField(output, keyVersion) = each_Version;
+            return output;
+        }
+
+        void GetPlayerCombinedInfoResultPayload::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyAccountInfo), AccountInfo);
+            FromJsonUtilO(FromJsonField(input, keyCharacterInventories), CharacterInventories);
+            FromJsonUtilO(FromJsonField(input, keyCharacterList), CharacterList);
+            FromJsonUtilO(FromJsonField(input, keyPlayerProfile), PlayerProfile);
+            FromJsonUtilO(FromJsonField(input, keyPlayerStatistics), PlayerStatistics);
+            FromJsonUtilS(FromJsonField(input, keyTitleData), TitleData);
+            FromJsonUtilO(FromJsonField(input, keyUserData), UserData);
+            FromJsonUtilP(FromJsonField(input, keyUserDataVersion), UserDataVersion);
+            FromJsonUtilO(FromJsonField(input, keyUserInventory), UserInventory);
+            FromJsonUtilO(FromJsonField(input, keyUserReadOnlyData), UserReadOnlyData);
+            FromJsonUtilP(FromJsonField(input, keyUserReadOnlyDataVersion), UserReadOnlyDataVersion);
+            FromJsonUtilP(FromJsonField(input, keyUserVirtualCurrency), UserVirtualCurrency);
+            FromJsonUtilO(FromJsonField(input, keyUserVirtualCurrencyRechargeTimes), UserVirtualCurrencyRechargeTimes);
+        }
+
+        Json::Value GetPlayerCombinedInfoResultPayload::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AccountInfo; ToJsonUtilO(AccountInfo, each_AccountInfo); ToJsonField(output, keyAccountInfo) = each_AccountInfo;
+            Json::Value each_CharacterInventories; ToJsonUtilO(CharacterInventories, each_CharacterInventories); ToJsonField(output, keyCharacterInventories) = each_CharacterInventories;
+            Json::Value each_CharacterList; ToJsonUtilO(CharacterList, each_CharacterList); ToJsonField(output, keyCharacterList) = each_CharacterList;
+            Json::Value each_PlayerProfile; ToJsonUtilO(PlayerProfile, each_PlayerProfile); ToJsonField(output, keyPlayerProfile) = each_PlayerProfile;
+            Json::Value each_PlayerStatistics; ToJsonUtilO(PlayerStatistics, each_PlayerStatistics); ToJsonField(output, keyPlayerStatistics) = each_PlayerStatistics;
+            Json::Value each_TitleData; ToJsonUtilS(TitleData, each_TitleData); ToJsonField(output, keyTitleData) = each_TitleData;
+            Json::Value each_UserData; ToJsonUtilO(UserData, each_UserData); ToJsonField(output, keyUserData) = each_UserData;
+            Json::Value each_UserDataVersion; ToJsonUtilP(UserDataVersion, each_UserDataVersion); ToJsonField(output, keyUserDataVersion) = each_UserDataVersion;
+            Json::Value each_UserInventory; ToJsonUtilO(UserInventory, each_UserInventory); ToJsonField(output, keyUserInventory) = each_UserInventory;
+            Json::Value each_UserReadOnlyData; ToJsonUtilO(UserReadOnlyData, each_UserReadOnlyData); ToJsonField(output, keyUserReadOnlyData) = each_UserReadOnlyData;
+            Json::Value each_UserReadOnlyDataVersion; ToJsonUtilP(UserReadOnlyDataVersion, each_UserReadOnlyDataVersion); ToJsonField(output, keyUserReadOnlyDataVersion) = each_UserReadOnlyDataVersion;
+            Json::Value each_UserVirtualCurrency; ToJsonUtilP(UserVirtualCurrency, each_UserVirtualCurrency); ToJsonField(output, keyUserVirtualCurrency) = each_UserVirtualCurrency;
+            Json::Value each_UserVirtualCurrencyRechargeTimes; ToJsonUtilO(UserVirtualCurrencyRechargeTimes, each_UserVirtualCurrencyRechargeTimes); ToJsonField(output, keyUserVirtualCurrencyRechargeTimes) = each_UserVirtualCurrencyRechargeTimes;
+            return output;
+        }
+
+        void GetPlayerCombinedInfoResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyInfoResultPayload), InfoResultPayload);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GetPlayerCombinedInfoResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_InfoResultPayload; ToJsonUtilO(InfoResultPayload, each_InfoResultPayload); ToJsonField(output, keyInfoResultPayload) = each_InfoResultPayload;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void GetPlayerProfileRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilO(FromJsonField(input, keyProfileConstraints), ProfileConstraints);
+        }
+
+        Json::Value GetPlayerProfileRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_ProfileConstraints; ToJsonUtilO(ProfileConstraints, each_ProfileConstraints); ToJsonField(output, keyProfileConstraints) = each_ProfileConstraints;
+            return output;
+        }
+
+        void GetPlayerProfileResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyPlayerProfile), PlayerProfile);
+        }
+
+        Json::Value GetPlayerProfileResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayerProfile; ToJsonUtilO(PlayerProfile, each_PlayerProfile); ToJsonField(output, keyPlayerProfile) = each_PlayerProfile;
+            return output;
+        }
+
+        void GetPlayerSegmentsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keySegments), Segments);
+        }
+
+        Json::Value GetPlayerSegmentsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Segments; ToJsonUtilO(Segments, each_Segments); ToJsonField(output, keySegments) = each_Segments;
+            return output;
+        }
+
+        void GetPlayersInSegmentRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyContinuationToken), ContinuationToken);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyMaxBatchSize), MaxBatchSize);
+            FromJsonUtilP(FromJsonField(input, keySecondsToLive), SecondsToLive);
+            FromJsonUtilS(FromJsonField(input, keySegmentId), SegmentId);
+        }
+
+        Json::Value GetPlayersInSegmentRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ContinuationToken; ToJsonUtilS(ContinuationToken, each_ContinuationToken); ToJsonField(output, keyContinuationToken) = each_ContinuationToken;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_MaxBatchSize; ToJsonUtilP(MaxBatchSize, each_MaxBatchSize); ToJsonField(output, keyMaxBatchSize) = each_MaxBatchSize;
+            Json::Value each_SecondsToLive; ToJsonUtilP(SecondsToLive, each_SecondsToLive); ToJsonField(output, keySecondsToLive) = each_SecondsToLive;
+            Json::Value each_SegmentId; ToJsonUtilS(SegmentId, each_SegmentId); ToJsonField(output, keySegmentId) = each_SegmentId;
+            return output;
+        }
+
+        void PlayerLinkedAccount::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyEmail), Email);
+            FromJsonUtilE(FromJsonField(input, keyPlatform), Platform);
+            FromJsonUtilS(FromJsonField(input, keyPlatformUserId), PlatformUserId);
+            FromJsonUtilS(FromJsonField(input, keyUsername), Username);
+        }
+
+        Json::Value PlayerLinkedAccount::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Email; ToJsonUtilS(Email, each_Email); ToJsonField(output, keyEmail) = each_Email;
+            Json::Value each_Platform; ToJsonUtilE(Platform, each_Platform); ToJsonField(output, keyPlatform) = each_Platform;
+            Json::Value each_PlatformUserId; ToJsonUtilS(PlatformUserId, each_PlatformUserId); ToJsonField(output, keyPlatformUserId) = each_PlatformUserId;
+            Json::Value each_Username; ToJsonUtilS(Username, each_Username); ToJsonField(output, keyUsername) = each_Username;
+            return output;
+        }
+
+        void PlayerLocation::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCity), City);
+            FromJsonEnum(FromJsonField(input, keyContinentCode), pfContinentCode);
+            FromJsonEnum(FromJsonField(input, keyCountryCode), pfCountryCode);
+            FromJsonUtilP(FromJsonField(input, keyLatitude), Latitude);
+            FromJsonUtilP(FromJsonField(input, keyLongitude), Longitude);
+        }
+
+        Json::Value PlayerLocation::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_City; ToJsonUtilS(City, each_City); ToJsonField(output, keyCity) = each_City;
+            Json::Value each_pfContinentCode; ToJsonEnum(pfContinentCode, each_pfContinentCode); ToJsonField(output, keyContinentCode) = each_pfContinentCode;
+            Json::Value each_pfCountryCode; ToJsonEnum(pfCountryCode, each_pfCountryCode); ToJsonField(output, keyCountryCode) = each_pfCountryCode;
+            Json::Value each_Latitude; ToJsonUtilP(Latitude, each_Latitude); ToJsonField(output, keyLatitude) = each_Latitude;
+            Json::Value each_Longitude; ToJsonUtilP(Longitude, each_Longitude); ToJsonField(output, keyLongitude) = each_Longitude;
+            return output;
+        }
+
+        void PlayerStatistic::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyId), Id);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilP(FromJsonField(input, keyStatisticValue), StatisticValue);
+            FromJsonUtilP(FromJsonField(input, keyStatisticVersion), StatisticVersion);
+        }
+
+        Json::Value PlayerStatistic::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Id; ToJsonUtilS(Id, each_Id); ToJsonField(output, keyId) = each_Id;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_StatisticValue; ToJsonUtilP(StatisticValue, each_StatisticValue); ToJsonField(output, keyStatisticValue) = each_StatisticValue;
+            Json::Value each_StatisticVersion; ToJsonUtilP(StatisticVersion, each_StatisticVersion); ToJsonField(output, keyStatisticVersion) = each_StatisticVersion;
+            return output;
+        }
+
+        void PushNotificationRegistration::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyNotificationEndpointARN), NotificationEndpointARN);
+            FromJsonUtilE(FromJsonField(input, keyPlatform), Platform);
+        }
+
+        Json::Value PushNotificationRegistration::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_NotificationEndpointARN; ToJsonUtilS(NotificationEndpointARN, each_NotificationEndpointARN); ToJsonField(output, keyNotificationEndpointARN) = each_NotificationEndpointARN;
+            Json::Value each_Platform; ToJsonUtilE(Platform, each_Platform); ToJsonField(output, keyPlatform) = each_Platform;
+            return output;
+        }
+
+        void PlayerProfile::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyAdCampaignAttributions), AdCampaignAttributions);
+            FromJsonUtilS(FromJsonField(input, keyAvatarUrl), AvatarUrl);
+            FromJsonUtilT(FromJsonField(input, keyBannedUntil), BannedUntil);
+            FromJsonUtilO(FromJsonField(input, keyContactEmailAddresses), ContactEmailAddresses);
+            FromJsonUtilT(FromJsonField(input, keyCreated), Created);
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+            FromJsonUtilT(FromJsonField(input, keyLastLogin), LastLogin);
+            FromJsonUtilO(FromJsonField(input, keyLinkedAccounts), LinkedAccounts);
+            FromJsonUtilO(FromJsonField(input, keyLocations), Locations);
+            FromJsonUtilE(FromJsonField(input, keyOrigination), Origination);
+            FromJsonUtilS(FromJsonField(input, keyPlayerExperimentVariants), PlayerExperimentVariants);
+            FromJsonUtilS(FromJsonField(input, keyPlayerId), PlayerId);
+            FromJsonUtilO(FromJsonField(input, keyPlayerStatistics), PlayerStatistics);
+            FromJsonUtilS(FromJsonField(input, keyPublisherId), PublisherId);
+            FromJsonUtilO(FromJsonField(input, keyPushNotificationRegistrations), PushNotificationRegistrations);
+            FromJsonUtilP(FromJsonField(input, keyStatistics), Statistics);
+            FromJsonUtilS(FromJsonField(input, keyTags), Tags);
+            FromJsonUtilS(FromJsonField(input, keyTitleId), TitleId);
+            FromJsonUtilP(FromJsonField(input, keyTotalValueToDateInUSD), TotalValueToDateInUSD);
+            FromJsonUtilP(FromJsonField(input, keyValuesToDate), ValuesToDate);
+            FromJsonUtilP(FromJsonField(input, keyVirtualCurrencyBalances), VirtualCurrencyBalances);
+        }
+
+        Json::Value PlayerProfile::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AdCampaignAttributions; ToJsonUtilO(AdCampaignAttributions, each_AdCampaignAttributions); ToJsonField(output, keyAdCampaignAttributions) = each_AdCampaignAttributions;
+            Json::Value each_AvatarUrl; ToJsonUtilS(AvatarUrl, each_AvatarUrl); ToJsonField(output, keyAvatarUrl) = each_AvatarUrl;
+            Json::Value each_BannedUntil; ToJsonUtilT(BannedUntil, each_BannedUntil); ToJsonField(output, keyBannedUntil) = each_BannedUntil;
+            Json::Value each_ContactEmailAddresses; ToJsonUtilO(ContactEmailAddresses, each_ContactEmailAddresses); ToJsonField(output, keyContactEmailAddresses) = each_ContactEmailAddresses;
+            Json::Value each_Created; ToJsonUtilT(Created, each_Created); ToJsonField(output, keyCreated) = each_Created;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            Json::Value each_LastLogin; ToJsonUtilT(LastLogin, each_LastLogin); ToJsonField(output, keyLastLogin) = each_LastLogin;
+            Json::Value each_LinkedAccounts; ToJsonUtilO(LinkedAccounts, each_LinkedAccounts); ToJsonField(output, keyLinkedAccounts) = each_LinkedAccounts;
+            Json::Value each_Locations; ToJsonUtilO(Locations, each_Locations); ToJsonField(output, keyLocations) = each_Locations;
+            Json::Value each_Origination; ToJsonUtilE(Origination, each_Origination); ToJsonField(output, keyOrigination) = each_Origination;
+            Json::Value each_PlayerExperimentVariants; ToJsonUtilS(PlayerExperimentVariants, each_PlayerExperimentVariants); ToJsonField(output, keyPlayerExperimentVariants) = each_PlayerExperimentVariants;
+            Json::Value each_PlayerId; ToJsonUtilS(PlayerId, each_PlayerId); ToJsonField(output, keyPlayerId) = each_PlayerId;
+            Json::Value each_PlayerStatistics; ToJsonUtilO(PlayerStatistics, each_PlayerStatistics); ToJsonField(output, keyPlayerStatistics) = each_PlayerStatistics;
+            Json::Value each_PublisherId; ToJsonUtilS(PublisherId, each_PublisherId); ToJsonField(output, keyPublisherId) = each_PublisherId;
+            Json::Value each_PushNotificationRegistrations; ToJsonUtilO(PushNotificationRegistrations, each_PushNotificationRegistrations); ToJsonField(output, keyPushNotificationRegistrations) = each_PushNotificationRegistrations;
+            Json::Value each_Statistics; ToJsonUtilP(Statistics, each_Statistics); ToJsonField(output, keyStatistics) = each_Statistics;
+            Json::Value each_Tags; ToJsonUtilS(Tags, each_Tags); ToJsonField(output, keyTags) = each_Tags;
+            Json::Value each_TitleId; ToJsonUtilS(TitleId, each_TitleId); ToJsonField(output, keyTitleId) = each_TitleId;
+            Json::Value each_TotalValueToDateInUSD; ToJsonUtilP(TotalValueToDateInUSD, each_TotalValueToDateInUSD); ToJsonField(output, keyTotalValueToDateInUSD) = each_TotalValueToDateInUSD;
+            Json::Value each_ValuesToDate; ToJsonUtilP(ValuesToDate, each_ValuesToDate); ToJsonField(output, keyValuesToDate) = each_ValuesToDate;
+            Json::Value each_VirtualCurrencyBalances; ToJsonUtilP(VirtualCurrencyBalances, each_VirtualCurrencyBalances); ToJsonField(output, keyVirtualCurrencyBalances) = each_VirtualCurrencyBalances;
+            return output;
+        }
+
+        void GetPlayersInSegmentResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyContinuationToken), ContinuationToken);
+            FromJsonUtilO(FromJsonField(input, keyPlayerProfiles), PlayerProfiles);
+            FromJsonUtilP(FromJsonField(input, keyProfilesInSegment), ProfilesInSegment);
+        }
+
+        Json::Value GetPlayersInSegmentResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ContinuationToken; ToJsonUtilS(ContinuationToken, each_ContinuationToken); ToJsonField(output, keyContinuationToken) = each_ContinuationToken;
+            Json::Value each_PlayerProfiles; ToJsonUtilO(PlayerProfiles, each_PlayerProfiles); ToJsonField(output, keyPlayerProfiles) = each_PlayerProfiles;
+            Json::Value each_ProfilesInSegment; ToJsonUtilP(ProfilesInSegment, each_ProfilesInSegment); ToJsonField(output, keyProfilesInSegment) = each_ProfilesInSegment;
+            return output;
+        }
+
+        void GetPlayersSegmentsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GetPlayersSegmentsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void StatisticNameVersion::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+            FromJsonUtilP(FromJsonField(input, keyVersion), Version);
+        }
+
+        Json::Value StatisticNameVersion::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            Json::Value each_Version; ToJsonUtilP(Version, each_Version); ToJsonField(output, keyVersion) = each_Version;
+            return output;
+        }
+
+        void GetPlayerStatisticsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyStatisticNames), StatisticNames);
+            FromJsonUtilO(FromJsonField(input, keyStatisticNameVersions), StatisticNameVersions);
+        }
+
+        Json::Value GetPlayerStatisticsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_StatisticNames; ToJsonUtilS(StatisticNames, each_StatisticNames); ToJsonField(output, keyStatisticNames) = each_StatisticNames;
+            Json::Value each_StatisticNameVersions; ToJsonUtilO(StatisticNameVersions, each_StatisticNameVersions); ToJsonField(output, keyStatisticNameVersions) = each_StatisticNameVersions;
+            return output;
+        }
+
+        void GetPlayerStatisticsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilO(FromJsonField(input, keyStatistics), Statistics);
+        }
+
+        Json::Value GetPlayerStatisticsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_Statistics; ToJsonUtilO(Statistics, each_Statistics); ToJsonField(output, keyStatistics) = each_Statistics;
+            return output;
+        }
+
+        void GetPlayerStatisticVersionsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+        }
+
+        Json::Value GetPlayerStatisticVersionsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            return output;
+        }
+
+        void PlayerStatisticVersion::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilT(FromJsonField(input, keyActivationTime), ActivationTime);
+            FromJsonUtilT(FromJsonField(input, keyDeactivationTime), DeactivationTime);
+            FromJsonUtilT(FromJsonField(input, keyScheduledActivationTime), ScheduledActivationTime);
+            FromJsonUtilT(FromJsonField(input, keyScheduledDeactivationTime), ScheduledDeactivationTime);
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+            FromJsonUtilP(FromJsonField(input, keyVersion), Version);
+        }
+
+        Json::Value PlayerStatisticVersion::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ActivationTime; ToJsonUtilT(ActivationTime, each_ActivationTime); ToJsonField(output, keyActivationTime) = each_ActivationTime;
+            Json::Value each_DeactivationTime; ToJsonUtilT(DeactivationTime, each_DeactivationTime); ToJsonField(output, keyDeactivationTime) = each_DeactivationTime;
+            Json::Value each_ScheduledActivationTime; ToJsonUtilT(ScheduledActivationTime, each_ScheduledActivationTime); ToJsonField(output, keyScheduledActivationTime) = each_ScheduledActivationTime;
+            Json::Value each_ScheduledDeactivationTime; ToJsonUtilT(ScheduledDeactivationTime, each_ScheduledDeactivationTime); ToJsonField(output, keyScheduledDeactivationTime) = each_ScheduledDeactivationTime;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            Json::Value each_Version; ToJsonUtilP(Version, each_Version); ToJsonField(output, keyVersion) = each_Version;
+            return output;
+        }
+
+        void GetPlayerStatisticVersionsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyStatisticVersions), StatisticVersions);
+        }
+
+        Json::Value GetPlayerStatisticVersionsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_StatisticVersions; ToJsonUtilO(StatisticVersions, each_StatisticVersions); ToJsonField(output, keyStatisticVersions) = each_StatisticVersions;
+            return output;
+        }
+
+        void GetPlayerTagsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyNamespace), Namespace);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GetPlayerTagsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Namespace; ToJsonUtilS(Namespace, each_Namespace); ToJsonField(output, keyNamespace) = each_Namespace;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void GetPlayerTagsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyTags), Tags);
+        }
+
+        Json::Value GetPlayerTagsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_Tags; ToJsonUtilS(Tags, each_Tags); ToJsonField(output, keyTags) = each_Tags;
+            return output;
+        }
+
+        void GetPlayFabIDsFromFacebookIDsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyFacebookIDs), FacebookIDs);
+        }
+
+        Json::Value GetPlayFabIDsFromFacebookIDsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_FacebookIDs; ToJsonUtilS(FacebookIDs, each_FacebookIDs); ToJsonField(output, keyFacebookIDs) = each_FacebookIDs;
+            return output;
+        }
+
+        void GetPlayFabIDsFromFacebookIDsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyData), Data);
+        }
+
+        Json::Value GetPlayFabIDsFromFacebookIDsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Data; ToJsonUtilO(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            return output;
+        }
+
+        void GetPlayFabIDsFromFacebookInstantGamesIdsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyFacebookInstantGamesIds), FacebookInstantGamesIds);
+        }
+
+        Json::Value GetPlayFabIDsFromFacebookInstantGamesIdsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_FacebookInstantGamesIds; ToJsonUtilS(FacebookInstantGamesIds, each_FacebookInstantGamesIds); ToJsonField(output, keyFacebookInstantGamesIds) = each_FacebookInstantGamesIds;
+            return output;
+        }
+
+        void GetPlayFabIDsFromFacebookInstantGamesIdsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyData), Data);
+        }
+
+        Json::Value GetPlayFabIDsFromFacebookInstantGamesIdsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Data; ToJsonUtilO(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            return output;
+        }
+
+        void GetPlayFabIDsFromGenericIDsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyGenericIDs), GenericIDs);
+        }
+
+        Json::Value GetPlayFabIDsFromGenericIDsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GenericIDs; ToJsonUtilO(GenericIDs, each_GenericIDs); ToJsonField(output, keyGenericIDs) = each_GenericIDs;
+            return output;
+        }
+
+        void GetPlayFabIDsFromGenericIDsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyData), Data);
+        }
+
+        Json::Value GetPlayFabIDsFromGenericIDsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Data; ToJsonUtilO(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            return output;
+        }
+
+        void GetPlayFabIDsFromNintendoSwitchDeviceIdsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyNintendoSwitchDeviceIds), NintendoSwitchDeviceIds);
+        }
+
+        Json::Value GetPlayFabIDsFromNintendoSwitchDeviceIdsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_NintendoSwitchDeviceIds; ToJsonUtilS(NintendoSwitchDeviceIds, each_NintendoSwitchDeviceIds); ToJsonField(output, keyNintendoSwitchDeviceIds) = each_NintendoSwitchDeviceIds;
+            return output;
+        }
+
+        void NintendoSwitchPlayFabIdPair::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyNintendoSwitchDeviceId), NintendoSwitchDeviceId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value NintendoSwitchPlayFabIdPair::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_NintendoSwitchDeviceId; ToJsonUtilS(NintendoSwitchDeviceId, each_NintendoSwitchDeviceId); ToJsonField(output, keyNintendoSwitchDeviceId) = each_NintendoSwitchDeviceId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void GetPlayFabIDsFromNintendoSwitchDeviceIdsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyData), Data);
+        }
+
+        Json::Value GetPlayFabIDsFromNintendoSwitchDeviceIdsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Data; ToJsonUtilO(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            return output;
+        }
+
+        void GetPlayFabIDsFromPSNAccountIDsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyIssuerId), IssuerId);
+            FromJsonUtilS(FromJsonField(input, keyPSNAccountIDs), PSNAccountIDs);
+        }
+
+        Json::Value GetPlayFabIDsFromPSNAccountIDsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_IssuerId; ToJsonUtilP(IssuerId, each_IssuerId); ToJsonField(output, keyIssuerId) = each_IssuerId;
+            Json::Value each_PSNAccountIDs; ToJsonUtilS(PSNAccountIDs, each_PSNAccountIDs); ToJsonField(output, keyPSNAccountIDs) = each_PSNAccountIDs;
+            return output;
+        }
+
+        void PSNAccountPlayFabIdPair::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyPSNAccountId), PSNAccountId);
+        }
+
+        Json::Value PSNAccountPlayFabIdPair::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_PSNAccountId; ToJsonUtilS(PSNAccountId, each_PSNAccountId); ToJsonField(output, keyPSNAccountId) = each_PSNAccountId;
+            return output;
+        }
+
+        void GetPlayFabIDsFromPSNAccountIDsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyData), Data);
+        }
+
+        Json::Value GetPlayFabIDsFromPSNAccountIDsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Data; ToJsonUtilO(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            return output;
+        }
+
+        void GetPlayFabIDsFromSteamIDsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keySteamStringIDs), SteamStringIDs);
+        }
+
+        Json::Value GetPlayFabIDsFromSteamIDsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_SteamStringIDs; ToJsonUtilS(SteamStringIDs, each_SteamStringIDs); ToJsonField(output, keySteamStringIDs) = each_SteamStringIDs;
+            return output;
+        }
+
+        void SteamPlayFabIdPair::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keySteamStringId), SteamStringId);
+        }
+
+        Json::Value SteamPlayFabIdPair::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_SteamStringId; ToJsonUtilS(SteamStringId, each_SteamStringId); ToJsonField(output, keySteamStringId) = each_SteamStringId;
+            return output;
+        }
+
+        void GetPlayFabIDsFromSteamIDsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyData), Data);
+        }
+
+        Json::Value GetPlayFabIDsFromSteamIDsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Data; ToJsonUtilO(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            return output;
+        }
+
+        void GetPlayFabIDsFromXboxLiveIDsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keySandbox), Sandbox);
+            FromJsonUtilS(FromJsonField(input, keyXboxLiveAccountIDs), XboxLiveAccountIDs);
+        }
+
+        Json::Value GetPlayFabIDsFromXboxLiveIDsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Sandbox; ToJsonUtilS(Sandbox, each_Sandbox); ToJsonField(output, keySandbox) = each_Sandbox;
+            Json::Value each_XboxLiveAccountIDs; ToJsonUtilS(XboxLiveAccountIDs, each_XboxLiveAccountIDs); ToJsonField(output, keyXboxLiveAccountIDs) = each_XboxLiveAccountIDs;
+            return output;
+        }
+
+        void XboxLiveAccountPlayFabIdPair::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyXboxLiveAccountId), XboxLiveAccountId);
+        }
+
+        Json::Value XboxLiveAccountPlayFabIdPair::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_XboxLiveAccountId; ToJsonUtilS(XboxLiveAccountId, each_XboxLiveAccountId); ToJsonField(output, keyXboxLiveAccountId) = each_XboxLiveAccountId;
+            return output;
+        }
+
+        void GetPlayFabIDsFromXboxLiveIDsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyData), Data);
+        }
+
+        Json::Value GetPlayFabIDsFromXboxLiveIDsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Data; ToJsonUtilO(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            return output;
+        }
+
+        void GetPublisherDataRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyKeys), Keys);
+        }
+
+        Json::Value GetPublisherDataRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Keys; ToJsonUtilS(Keys, each_Keys); ToJsonField(output, keyKeys) = each_Keys;
+            return output;
+        }
+
+        void GetPublisherDataResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyData), Data);
+        }
+
+        Json::Value GetPublisherDataResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Data; ToJsonUtilS(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            return output;
+        }
+
+        void GetRandomResultTablesRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyTableIDs), TableIDs);
+        }
+
+        Json::Value GetRandomResultTablesRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_TableIDs; ToJsonUtilS(TableIDs, each_TableIDs); ToJsonField(output, keyTableIDs) = each_TableIDs;
+            return output;
+        }
+
+        void ResultTableNode::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyResultItem), ResultItem);
+            FromJsonEnum(FromJsonField(input, keyResultItemType), ResultItemType);
+            FromJsonUtilP(FromJsonField(input, keyWeight), Weight);
+        }
+
+        Json::Value ResultTableNode::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ResultItem; ToJsonUtilS(ResultItem, each_ResultItem); ToJsonField(output, keyResultItem) = each_ResultItem;
+            Json::Value each_ResultItemType; ToJsonEnum(ResultItemType, each_ResultItemType); ToJsonField(output, keyResultItemType) = each_ResultItemType;
+            Json::Value each_Weight; ToJsonUtilP(Weight, each_Weight); ToJsonField(output, keyWeight) = each_Weight;
+            return output;
+        }
+
+        void RandomResultTableListing::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilO(FromJsonField(input, keyNodes), Nodes);
+            FromJsonUtilS(FromJsonField(input, keyTableId), TableId);
+        }
+
+        Json::Value RandomResultTableListing::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_Nodes; ToJsonUtilO(Nodes, each_Nodes); ToJsonField(output, keyNodes) = each_Nodes;
+            Json::Value each_TableId; ToJsonUtilS(TableId, each_TableId); ToJsonField(output, keyTableId) = each_TableId;
+            return output;
+        }
+
+        void GetRandomResultTablesResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyTables), Tables);
+        }
+
+        Json::Value GetRandomResultTablesResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Tables; ToJsonUtilO(Tables, each_Tables); ToJsonField(output, keyTables) = each_Tables;
+            return output;
+        }
+
+        void GetServerCustomIDsFromPlayFabIDsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlayFabIDs), PlayFabIDs);
+        }
+
+        Json::Value GetServerCustomIDsFromPlayFabIDsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayFabIDs; ToJsonUtilS(PlayFabIDs, each_PlayFabIDs); ToJsonField(output, keyPlayFabIDs) = each_PlayFabIDs;
+            return output;
+        }
+
+        void ServerCustomIDPlayFabIDPair::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyServerCustomId), ServerCustomId);
+        }
+
+        Json::Value ServerCustomIDPlayFabIDPair::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_ServerCustomId; ToJsonUtilS(ServerCustomId, each_ServerCustomId); ToJsonField(output, keyServerCustomId) = each_ServerCustomId;
+            return output;
+        }
+
+        void GetServerCustomIDsFromPlayFabIDsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyData), Data);
+        }
+
+        Json::Value GetServerCustomIDsFromPlayFabIDsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Data; ToJsonUtilO(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            return output;
+        }
+
+        void GetSharedGroupDataRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyGetMembers), GetMembers);
+            FromJsonUtilS(FromJsonField(input, keyKeys), Keys);
+            FromJsonUtilS(FromJsonField(input, keySharedGroupId), SharedGroupId);
+        }
+
+        Json::Value GetSharedGroupDataRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GetMembers; ToJsonUtilP(GetMembers, each_GetMembers); ToJsonField(output, keyGetMembers) = each_GetMembers;
+            Json::Value each_Keys; ToJsonUtilS(Keys, each_Keys); ToJsonField(output, keyKeys) = each_Keys;
+            Json::Value each_SharedGroupId; ToJsonUtilS(SharedGroupId, each_SharedGroupId); ToJsonField(output, keySharedGroupId) = each_SharedGroupId;
+            return output;
+        }
+
+        void SharedGroupDataRecord::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilT(FromJsonField(input, keyLastUpdated), LastUpdated);
+            FromJsonUtilS(FromJsonField(input, keyLastUpdatedBy), LastUpdatedBy);
+            FromJsonUtilE(FromJsonField(input, keyPermission), Permission);
+            FromJsonUtilS(FromJsonField(input, keyValue), Value);
+        }
+
+        Json::Value SharedGroupDataRecord::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_LastUpdated; ToJsonUtilT(LastUpdated, each_LastUpdated); ToJsonField(output, keyLastUpdated) = each_LastUpdated;
+            Json::Value each_LastUpdatedBy; ToJsonUtilS(LastUpdatedBy, each_LastUpdatedBy); ToJsonField(output, keyLastUpdatedBy) = each_LastUpdatedBy;
+            Json::Value each_Permission; ToJsonUtilE(Permission, each_Permission); ToJsonField(output, keyPermission) = each_Permission;
+            Json::Value each_Value; ToJsonUtilS(Value, each_Value); ToJsonField(output, keyValue) = each_Value;
+            return output;
+        }
+
+        void GetSharedGroupDataResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyData), Data);
+            FromJsonUtilS(FromJsonField(input, keyMembers), Members);
+        }
+
+        Json::Value GetSharedGroupDataResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Data; ToJsonUtilO(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            Json::Value each_Members; ToJsonUtilS(Members, each_Members); ToJsonField(output, keyMembers) = each_Members;
+            return output;
+        }
+
+        void StoreMarketingModel::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyDescription), Description);
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+            Metadata = FromJsonField(input, keyMetadata);
+        }
+
+        Json::Value StoreMarketingModel::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Description; ToJsonUtilS(Description, each_Description); ToJsonField(output, keyDescription) = each_Description;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            ToJsonField(output, keyMetadata) = Metadata;
+            return output;
+        }
+
+        void StoreItem::FromJson(const Json::Value& input)
+        {
+            CustomData = FromJsonField(input, keyCustomData);
+            FromJsonUtilP(FromJsonField(input, keyDisplayPosition), DisplayPosition);
+            FromJsonUtilS(FromJsonField(input, keyItemId), ItemId);
+            FromJsonUtilP(FromJsonField(input, keyRealCurrencyPrices), RealCurrencyPrices);
+            FromJsonUtilP(FromJsonField(input, keyVirtualCurrencyPrices), VirtualCurrencyPrices);
+        }
+
+        Json::Value StoreItem::ToJson() const
+        {
+            Json::Value output;
+            ToJsonField(output, keyCustomData) = CustomData;
+            Json::Value each_DisplayPosition; ToJsonUtilP(DisplayPosition, each_DisplayPosition); ToJsonField(output, keyDisplayPosition) = each_DisplayPosition;
+            Json::Value each_ItemId; ToJsonUtilS(ItemId, each_ItemId); ToJsonField(output, keyItemId) = each_ItemId;
+            Json::Value each_RealCurrencyPrices; ToJsonUtilP(RealCurrencyPrices, each_RealCurrencyPrices); ToJsonField(output, keyRealCurrencyPrices) = each_RealCurrencyPrices;
+            Json::Value each_VirtualCurrencyPrices; ToJsonUtilP(VirtualCurrencyPrices, each_VirtualCurrencyPrices); ToJsonField(output, keyVirtualCurrencyPrices) = each_VirtualCurrencyPrices;
+            return output;
+        }
+
+        void GetStoreItemsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilO(FromJsonField(input, keyMarketingData), MarketingData);
+            FromJsonUtilE(FromJsonField(input, keySource), Source);
+            FromJsonUtilO(FromJsonField(input, keyStore), Store);
+            FromJsonUtilS(FromJsonField(input, keyStoreId), StoreId);
+        }
+
+        Json::Value GetStoreItemsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_MarketingData; ToJsonUtilO(MarketingData, each_MarketingData); ToJsonField(output, keyMarketingData) = each_MarketingData;
+            Json::Value each_Source; ToJsonUtilE(Source, each_Source); ToJsonField(output, keySource) = each_Source;
+            Json::Value each_Store; ToJsonUtilO(Store, each_Store); ToJsonField(output, keyStore) = each_Store;
+            Json::Value each_StoreId; ToJsonUtilS(StoreId, each_StoreId); ToJsonField(output, keyStoreId) = each_StoreId;
+            return output;
+        }
+
+        void GetStoreItemsServerRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyStoreId), StoreId);
+        }
+
+        Json::Value GetStoreItemsServerRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_StoreId; ToJsonUtilS(StoreId, each_StoreId); ToJsonField(output, keyStoreId) = each_StoreId;
+            return output;
+        }
+
+        void GetTimeRequest::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value GetTimeRequest::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void GetTimeResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilT(FromJsonField(input, keyTime), Time);
+        }
+
+        Json::Value GetTimeResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Time; ToJsonUtilT(Time, each_Time); ToJsonField(output, keyTime) = each_Time;
+            return output;
+        }
+
+        void GetTitleDataRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyKeys), Keys);
+            FromJsonUtilS(FromJsonField(input, keyOverrideLabel), OverrideLabel);
+        }
+
+        Json::Value GetTitleDataRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Keys; ToJsonUtilS(Keys, each_Keys); ToJsonField(output, keyKeys) = each_Keys;
+            Json::Value each_OverrideLabel; ToJsonUtilS(OverrideLabel, each_OverrideLabel); ToJsonField(output, keyOverrideLabel) = each_OverrideLabel;
+            return output;
+        }
+
+        void GetTitleDataResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyData), Data);
+        }
+
+        Json::Value GetTitleDataResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Data; ToJsonUtilS(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            return output;
+        }
+
+        void GetTitleNewsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyCount), Count);
+        }
+
+        Json::Value GetTitleNewsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Count; ToJsonUtilP(Count, each_Count); ToJsonField(output, keyCount) = each_Count;
+            return output;
+        }
+
+        void TitleNewsItem::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBody), Body);
+            FromJsonUtilS(FromJsonField(input, keyNewsId), NewsId);
+            FromJsonUtilT(FromJsonField(input, keyTimestamp), Timestamp);
+            FromJsonUtilS(FromJsonField(input, keyTitle), Title);
+        }
+
+        Json::Value TitleNewsItem::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Body; ToJsonUtilS(Body, each_Body); ToJsonField(output, keyBody) = each_Body;
+            Json::Value each_NewsId; ToJsonUtilS(NewsId, each_NewsId); ToJsonField(output, keyNewsId) = each_NewsId;
+            Json::Value each_Timestamp; ToJsonUtilT(Timestamp, each_Timestamp); ToJsonField(output, keyTimestamp) = each_Timestamp;
+            Json::Value each_Title; ToJsonUtilS(Title, each_Title); ToJsonField(output, keyTitle) = each_Title;
+            return output;
+        }
+
+        void GetTitleNewsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyNews), News);
+        }
+
+        Json::Value GetTitleNewsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_News; ToJsonUtilO(News, each_News); ToJsonField(output, keyNews) = each_News;
+            return output;
+        }
+
+        void GetUserAccountInfoRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GetUserAccountInfoRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void GetUserAccountInfoResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyUserInfo), UserInfo);
+        }
+
+        Json::Value GetUserAccountInfoResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_UserInfo; ToJsonUtilO(UserInfo, each_UserInfo); ToJsonField(output, keyUserInfo) = each_UserInfo;
+            return output;
+        }
+
+        void GetUserBansRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GetUserBansRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void GetUserBansResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyBanData), BanData);
+        }
+
+        Json::Value GetUserBansResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BanData; ToJsonUtilO(BanData, each_BanData); ToJsonField(output, keyBanData) = each_BanData;
+            return output;
+        }
+
+        void GetUserDataRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyIfChangedFromDataVersion), IfChangedFromDataVersion);
+            FromJsonUtilS(FromJsonField(input, keyKeys), Keys);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GetUserDataRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_IfChangedFromDataVersion; ToJsonUtilP(IfChangedFromDataVersion, each_IfChangedFromDataVersion); ToJsonField(output, keyIfChangedFromDataVersion) = each_IfChangedFromDataVersion;
+            Json::Value each_Keys; ToJsonUtilS(Keys, each_Keys); ToJsonField(output, keyKeys) = each_Keys;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void GetUserDataResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyData), Data);
+            FromJsonUtilP(FromJsonField(input, keyDataVersion), DataVersion);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GetUserDataResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Data; ToJsonUtilO(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            Json::Value each_DataVersion; ToJsonUtilP(DataVersion, each_DataVersion); ToJsonField(output, keyDataVersion) = each_DataVersion;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void GetUserInventoryRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GetUserInventoryRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void GetUserInventoryResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyInventory), Inventory);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilP(FromJsonField(input, keyVirtualCurrency), VirtualCurrency);
+            FromJsonUtilO(FromJsonField(input, keyVirtualCurrencyRechargeTimes), VirtualCurrencyRechargeTimes);
+        }
+
+        Json::Value GetUserInventoryResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Inventory; ToJsonUtilO(Inventory, each_Inventory); ToJsonField(output, keyInventory) = each_Inventory;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_VirtualCurrency; ToJsonUtilP(VirtualCurrency, each_VirtualCurrency); ToJsonField(output, keyVirtualCurrency) = each_VirtualCurrency;
+            Json::Value each_VirtualCurrencyRechargeTimes; ToJsonUtilO(VirtualCurrencyRechargeTimes, each_VirtualCurrencyRechargeTimes); ToJsonField(output, keyVirtualCurrencyRechargeTimes) = each_VirtualCurrencyRechargeTimes;
+            return output;
+        }
+
+        void GrantCharacterToUserRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterName), CharacterName);
+            FromJsonUtilS(FromJsonField(input, keyCharacterType), CharacterType);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GrantCharacterToUserRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterName; ToJsonUtilS(CharacterName, each_CharacterName); ToJsonField(output, keyCharacterName) = each_CharacterName;
+            Json::Value each_CharacterType; ToJsonUtilS(CharacterType, each_CharacterType); ToJsonField(output, keyCharacterType) = each_CharacterType;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void GrantCharacterToUserResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+        }
+
+        Json::Value GrantCharacterToUserResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            return output;
+        }
+
+        void GrantedItemInstance::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAnnotation), Annotation);
+            FromJsonUtilS(FromJsonField(input, keyBundleContents), BundleContents);
+            FromJsonUtilS(FromJsonField(input, keyBundleParent), BundleParent);
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyCustomData), CustomData);
+            FromJsonUtilS(FromJsonField(input, keyDisplayName), DisplayName);
+            FromJsonUtilT(FromJsonField(input, keyExpiration), Expiration);
+            FromJsonUtilS(FromJsonField(input, keyItemClass), ItemClass);
+            FromJsonUtilS(FromJsonField(input, keyItemId), ItemId);
+            FromJsonUtilS(FromJsonField(input, keyItemInstanceId), ItemInstanceId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilT(FromJsonField(input, keyPurchaseDate), PurchaseDate);
+            FromJsonUtilP(FromJsonField(input, keyRemainingUses), RemainingUses);
+            FromJsonUtilP(FromJsonField(input, keyResult), Result);
+            FromJsonUtilS(FromJsonField(input, keyUnitCurrency), UnitCurrency);
+            FromJsonUtilP(FromJsonField(input, keyUnitPrice), UnitPrice);
+            FromJsonUtilP(FromJsonField(input, keyUsesIncrementedBy), UsesIncrementedBy);
+        }
+
+        Json::Value GrantedItemInstance::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Annotation; ToJsonUtilS(Annotation, each_Annotation); ToJsonField(output, keyAnnotation) = each_Annotation;
+            Json::Value each_BundleContents; ToJsonUtilS(BundleContents, each_BundleContents); ToJsonField(output, keyBundleContents) = each_BundleContents;
+            Json::Value each_BundleParent; ToJsonUtilS(BundleParent, each_BundleParent); ToJsonField(output, keyBundleParent) = each_BundleParent;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_CustomData; ToJsonUtilS(CustomData, each_CustomData); ToJsonField(output, keyCustomData) = each_CustomData;
+            Json::Value each_DisplayName; ToJsonUtilS(DisplayName, each_DisplayName); ToJsonField(output, keyDisplayName) = each_DisplayName;
+            Json::Value each_Expiration; ToJsonUtilT(Expiration, each_Expiration); ToJsonField(output, keyExpiration) = each_Expiration;
+            Json::Value each_ItemClass; ToJsonUtilS(ItemClass, each_ItemClass); ToJsonField(output, keyItemClass) = each_ItemClass;
+            Json::Value each_ItemId; ToJsonUtilS(ItemId, each_ItemId); ToJsonField(output, keyItemId) = each_ItemId;
+            Json::Value each_ItemInstanceId; ToJsonUtilS(ItemInstanceId, each_ItemInstanceId); ToJsonField(output, keyItemInstanceId) = each_ItemInstanceId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_PurchaseDate; ToJsonUtilT(PurchaseDate, each_PurchaseDate); ToJsonField(output, keyPurchaseDate) = each_PurchaseDate;
+            Json::Value each_RemainingUses; ToJsonUtilP(RemainingUses, each_RemainingUses); ToJsonField(output, keyRemainingUses) = each_RemainingUses;
+            Json::Value each_Result; ToJsonUtilP(Result, each_Result); ToJsonField(output, keyResult) = each_Result;
+            Json::Value each_UnitCurrency; ToJsonUtilS(UnitCurrency, each_UnitCurrency); ToJsonField(output, keyUnitCurrency) = each_UnitCurrency;
+            Json::Value each_UnitPrice; ToJsonUtilP(UnitPrice, each_UnitPrice); ToJsonField(output, keyUnitPrice) = each_UnitPrice;
+            Json::Value each_UsesIncrementedBy; ToJsonUtilP(UsesIncrementedBy, each_UsesIncrementedBy); ToJsonField(output, keyUsesIncrementedBy) = each_UsesIncrementedBy;
+            return output;
+        }
+
+        void GrantItemsToCharacterRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAnnotation), Annotation);
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyItemIds), ItemIds);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GrantItemsToCharacterRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Annotation; ToJsonUtilS(Annotation, each_Annotation); ToJsonField(output, keyAnnotation) = each_Annotation;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ItemIds; ToJsonUtilS(ItemIds, each_ItemIds); ToJsonField(output, keyItemIds) = each_ItemIds;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void GrantItemsToCharacterResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyItemGrantResults), ItemGrantResults);
+        }
+
+        Json::Value GrantItemsToCharacterResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ItemGrantResults; ToJsonUtilO(ItemGrantResults, each_ItemGrantResults); ToJsonField(output, keyItemGrantResults) = each_ItemGrantResults;
+            return output;
+        }
+
+        void GrantItemsToUserRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAnnotation), Annotation);
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyItemIds), ItemIds);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value GrantItemsToUserRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Annotation; ToJsonUtilS(Annotation, each_Annotation); ToJsonField(output, keyAnnotation) = each_Annotation;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ItemIds; ToJsonUtilS(ItemIds, each_ItemIds); ToJsonField(output, keyItemIds) = each_ItemIds;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void GrantItemsToUserResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyItemGrantResults), ItemGrantResults);
+        }
+
+        Json::Value GrantItemsToUserResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ItemGrantResults; ToJsonUtilO(ItemGrantResults, each_ItemGrantResults); ToJsonField(output, keyItemGrantResults) = each_ItemGrantResults;
+            return output;
+        }
+
+        void ItemGrant::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAnnotation), Annotation);
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyData), Data);
+            FromJsonUtilS(FromJsonField(input, keyItemId), ItemId);
+            FromJsonUtilS(FromJsonField(input, keyKeysToRemove), KeysToRemove);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value ItemGrant::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Annotation; ToJsonUtilS(Annotation, each_Annotation); ToJsonField(output, keyAnnotation) = each_Annotation;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_Data; ToJsonUtilS(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            Json::Value each_ItemId; ToJsonUtilS(ItemId, each_ItemId); ToJsonField(output, keyItemId) = each_ItemId;
+            Json::Value each_KeysToRemove; ToJsonUtilS(KeysToRemove, each_KeysToRemove); ToJsonField(output, keyKeysToRemove) = each_KeysToRemove;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void GrantItemsToUsersRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyItemGrants), ItemGrants);
+        }
+
+        Json::Value GrantItemsToUsersRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ItemGrants; ToJsonUtilO(ItemGrants, each_ItemGrants); ToJsonField(output, keyItemGrants) = each_ItemGrants;
+            return output;
+        }
+
+        void GrantItemsToUsersResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyItemGrantResults), ItemGrantResults);
+        }
+
+        Json::Value GrantItemsToUsersResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ItemGrantResults; ToJsonUtilO(ItemGrantResults, each_ItemGrantResults); ToJsonField(output, keyItemGrantResults) = each_ItemGrantResults;
+            return output;
+        }
+
+        void LinkPSNAccountRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAuthCode), AuthCode);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyForceLink), ForceLink);
+            FromJsonUtilP(FromJsonField(input, keyIssuerId), IssuerId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyRedirectUri), RedirectUri);
+        }
+
+        Json::Value LinkPSNAccountRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AuthCode; ToJsonUtilS(AuthCode, each_AuthCode); ToJsonField(output, keyAuthCode) = each_AuthCode;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); ToJsonField(output, keyForceLink) = each_ForceLink;
+            Json::Value each_IssuerId; ToJsonUtilP(IssuerId, each_IssuerId); ToJsonField(output, keyIssuerId) = each_IssuerId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_RedirectUri; ToJsonUtilS(RedirectUri, each_RedirectUri); ToJsonField(output, keyRedirectUri) = each_RedirectUri;
+            return output;
+        }
+
+        void LinkPSNAccountResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value LinkPSNAccountResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void LinkServerCustomIdRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyForceLink), ForceLink);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyServerCustomId), ServerCustomId);
+        }
+
+        Json::Value LinkServerCustomIdRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); ToJsonField(output, keyForceLink) = each_ForceLink;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_ServerCustomId; ToJsonUtilS(ServerCustomId, each_ServerCustomId); ToJsonField(output, keyServerCustomId) = each_ServerCustomId;
+            return output;
+        }
+
+        void LinkServerCustomIdResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value LinkServerCustomIdResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void LinkXboxAccountRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyForceLink), ForceLink);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyXboxToken), XboxToken);
+        }
+
+        Json::Value LinkXboxAccountRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ForceLink; ToJsonUtilP(ForceLink, each_ForceLink); ToJsonField(output, keyForceLink) = each_ForceLink;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_XboxToken; ToJsonUtilS(XboxToken, each_XboxToken); ToJsonField(output, keyXboxToken) = each_XboxToken;
+            return output;
+        }
+
+        void LinkXboxAccountResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value LinkXboxAccountResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void ListUsersCharactersRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value ListUsersCharactersRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void ListUsersCharactersResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyCharacters), Characters);
+        }
+
+        Json::Value ListUsersCharactersResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Characters; ToJsonUtilO(Characters, each_Characters); ToJsonField(output, keyCharacters) = each_Characters;
+            return output;
+        }
+
+        void LocalizedPushNotificationProperties::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyMessage), Message);
+            FromJsonUtilS(FromJsonField(input, keySubject), Subject);
+        }
+
+        Json::Value LocalizedPushNotificationProperties::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Message; ToJsonUtilS(Message, each_Message); ToJsonField(output, keyMessage) = each_Message;
+            Json::Value each_Subject; ToJsonUtilS(Subject, each_Subject); ToJsonField(output, keySubject) = each_Subject;
+            return output;
+        }
+
+        void LoginWithServerCustomIdRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyCreateAccount), CreateAccount);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyInfoRequestParameters), InfoRequestParameters);
+            FromJsonUtilS(FromJsonField(input, keyPlayerSecret), PlayerSecret);
+            FromJsonUtilS(FromJsonField(input, keyServerCustomId), ServerCustomId);
+        }
+
+        Json::Value LoginWithServerCustomIdRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); ToJsonField(output, keyCreateAccount) = each_CreateAccount;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); ToJsonField(output, keyInfoRequestParameters) = each_InfoRequestParameters;
+            Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); ToJsonField(output, keyPlayerSecret) = each_PlayerSecret;
+            Json::Value each_ServerCustomId; ToJsonUtilS(ServerCustomId, each_ServerCustomId); ToJsonField(output, keyServerCustomId) = each_ServerCustomId;
+            return output;
+        }
+
+        void LoginWithSteamIdRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyCreateAccount), CreateAccount);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyInfoRequestParameters), InfoRequestParameters);
+            FromJsonUtilS(FromJsonField(input, keySteamId), SteamId);
+        }
+
+        Json::Value LoginWithSteamIdRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); ToJsonField(output, keyCreateAccount) = each_CreateAccount;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); ToJsonField(output, keyInfoRequestParameters) = each_InfoRequestParameters;
+            Json::Value each_SteamId; ToJsonUtilS(SteamId, each_SteamId); ToJsonField(output, keySteamId) = each_SteamId;
+            return output;
+        }
+
+        void LoginWithXboxIdRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyCreateAccount), CreateAccount);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyInfoRequestParameters), InfoRequestParameters);
+            FromJsonUtilS(FromJsonField(input, keySandbox), Sandbox);
+            FromJsonUtilS(FromJsonField(input, keyXboxId), XboxId);
+        }
+
+        Json::Value LoginWithXboxIdRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); ToJsonField(output, keyCreateAccount) = each_CreateAccount;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); ToJsonField(output, keyInfoRequestParameters) = each_InfoRequestParameters;
+            Json::Value each_Sandbox; ToJsonUtilS(Sandbox, each_Sandbox); ToJsonField(output, keySandbox) = each_Sandbox;
+            Json::Value each_XboxId; ToJsonUtilS(XboxId, each_XboxId); ToJsonField(output, keyXboxId) = each_XboxId;
+            return output;
+        }
+
+        void LoginWithXboxRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyCreateAccount), CreateAccount);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilO(FromJsonField(input, keyInfoRequestParameters), InfoRequestParameters);
+            FromJsonUtilS(FromJsonField(input, keyXboxToken), XboxToken);
+        }
+
+        Json::Value LoginWithXboxRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CreateAccount; ToJsonUtilP(CreateAccount, each_CreateAccount); ToJsonField(output, keyCreateAccount) = each_CreateAccount;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_InfoRequestParameters; ToJsonUtilO(InfoRequestParameters, each_InfoRequestParameters); ToJsonField(output, keyInfoRequestParameters) = each_InfoRequestParameters;
+            Json::Value each_XboxToken; ToJsonUtilS(XboxToken, each_XboxToken); ToJsonField(output, keyXboxToken) = each_XboxToken;
+            return output;
+        }
+
+        void ModifyCharacterVirtualCurrencyResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyBalance), Balance);
+            FromJsonUtilS(FromJsonField(input, keyVirtualCurrency), VirtualCurrency);
+        }
+
+        Json::Value ModifyCharacterVirtualCurrencyResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Balance; ToJsonUtilP(Balance, each_Balance); ToJsonField(output, keyBalance) = each_Balance;
+            Json::Value each_VirtualCurrency; ToJsonUtilS(VirtualCurrency, each_VirtualCurrency); ToJsonField(output, keyVirtualCurrency) = each_VirtualCurrency;
+            return output;
+        }
+
+        void ModifyItemUsesRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyItemInstanceId), ItemInstanceId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilP(FromJsonField(input, keyUsesToAdd), UsesToAdd);
+        }
+
+        Json::Value ModifyItemUsesRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ItemInstanceId; ToJsonUtilS(ItemInstanceId, each_ItemInstanceId); ToJsonField(output, keyItemInstanceId) = each_ItemInstanceId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_UsesToAdd; ToJsonUtilP(UsesToAdd, each_UsesToAdd); ToJsonField(output, keyUsesToAdd) = each_UsesToAdd;
+            return output;
+        }
+
+        void ModifyItemUsesResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyItemInstanceId), ItemInstanceId);
+            FromJsonUtilP(FromJsonField(input, keyRemainingUses), RemainingUses);
+        }
+
+        Json::Value ModifyItemUsesResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ItemInstanceId; ToJsonUtilS(ItemInstanceId, each_ItemInstanceId); ToJsonField(output, keyItemInstanceId) = each_ItemInstanceId;
+            Json::Value each_RemainingUses; ToJsonUtilP(RemainingUses, each_RemainingUses); ToJsonField(output, keyRemainingUses) = each_RemainingUses;
+            return output;
+        }
+
+        void ModifyUserVirtualCurrencyResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyBalance), Balance);
+            FromJsonUtilP(FromJsonField(input, keyBalanceChange), BalanceChange);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyVirtualCurrency), VirtualCurrency);
+        }
+
+        Json::Value ModifyUserVirtualCurrencyResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Balance; ToJsonUtilP(Balance, each_Balance); ToJsonField(output, keyBalance) = each_Balance;
+            Json::Value each_BalanceChange; ToJsonUtilP(BalanceChange, each_BalanceChange); ToJsonField(output, keyBalanceChange) = each_BalanceChange;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_VirtualCurrency; ToJsonUtilS(VirtualCurrency, each_VirtualCurrency); ToJsonField(output, keyVirtualCurrency) = each_VirtualCurrency;
+            return output;
+        }
+
+        void MoveItemToCharacterFromCharacterRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyGivingCharacterId), GivingCharacterId);
+            FromJsonUtilS(FromJsonField(input, keyItemInstanceId), ItemInstanceId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyReceivingCharacterId), ReceivingCharacterId);
+        }
+
+        Json::Value MoveItemToCharacterFromCharacterRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GivingCharacterId; ToJsonUtilS(GivingCharacterId, each_GivingCharacterId); ToJsonField(output, keyGivingCharacterId) = each_GivingCharacterId;
+            Json::Value each_ItemInstanceId; ToJsonUtilS(ItemInstanceId, each_ItemInstanceId); ToJsonField(output, keyItemInstanceId) = each_ItemInstanceId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_ReceivingCharacterId; ToJsonUtilS(ReceivingCharacterId, each_ReceivingCharacterId); ToJsonField(output, keyReceivingCharacterId) = each_ReceivingCharacterId;
+            return output;
+        }
+
+        void MoveItemToCharacterFromCharacterResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value MoveItemToCharacterFromCharacterResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void MoveItemToCharacterFromUserRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyItemInstanceId), ItemInstanceId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value MoveItemToCharacterFromUserRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_ItemInstanceId; ToJsonUtilS(ItemInstanceId, each_ItemInstanceId); ToJsonField(output, keyItemInstanceId) = each_ItemInstanceId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void MoveItemToCharacterFromUserResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value MoveItemToCharacterFromUserResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void MoveItemToUserFromCharacterRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyItemInstanceId), ItemInstanceId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value MoveItemToUserFromCharacterRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_ItemInstanceId; ToJsonUtilS(ItemInstanceId, each_ItemInstanceId); ToJsonField(output, keyItemInstanceId) = each_ItemInstanceId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void MoveItemToUserFromCharacterResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value MoveItemToUserFromCharacterResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void NotifyMatchmakerPlayerLeftRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyLobbyId), LobbyId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value NotifyMatchmakerPlayerLeftRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_LobbyId; ToJsonUtilS(LobbyId, each_LobbyId); ToJsonField(output, keyLobbyId) = each_LobbyId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void NotifyMatchmakerPlayerLeftResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilE(FromJsonField(input, keyPlayerState), PlayerState);
+        }
+
+        Json::Value NotifyMatchmakerPlayerLeftResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayerState; ToJsonUtilE(PlayerState, each_PlayerState); ToJsonField(output, keyPlayerState) = each_PlayerState;
+            return output;
+        }
+
+        void PushNotificationPackage::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyBadge), Badge);
+            FromJsonUtilS(FromJsonField(input, keyCustomData), CustomData);
+            FromJsonUtilS(FromJsonField(input, keyIcon), Icon);
+            FromJsonUtilS(FromJsonField(input, keyMessage), Message);
+            FromJsonUtilS(FromJsonField(input, keySound), Sound);
+            FromJsonUtilS(FromJsonField(input, keyTitle), Title);
+        }
+
+        Json::Value PushNotificationPackage::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Badge; ToJsonUtilP(Badge, each_Badge); ToJsonField(output, keyBadge) = each_Badge;
+            Json::Value each_CustomData; ToJsonUtilS(CustomData, each_CustomData); ToJsonField(output, keyCustomData) = each_CustomData;
+            Json::Value each_Icon; ToJsonUtilS(Icon, each_Icon); ToJsonField(output, keyIcon) = each_Icon;
+            Json::Value each_Message; ToJsonUtilS(Message, each_Message); ToJsonField(output, keyMessage) = each_Message;
+            Json::Value each_Sound; ToJsonUtilS(Sound, each_Sound); ToJsonField(output, keySound) = each_Sound;
+            Json::Value each_Title; ToJsonUtilS(Title, each_Title); ToJsonField(output, keyTitle) = each_Title;
+            return output;
+        }
+
+        void RedeemCouponRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyCouponCode), CouponCode);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value RedeemCouponRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_CouponCode; ToJsonUtilS(CouponCode, each_CouponCode); ToJsonField(output, keyCouponCode) = each_CouponCode;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void RedeemCouponResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyGrantedItems), GrantedItems);
+        }
+
+        Json::Value RedeemCouponResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GrantedItems; ToJsonUtilO(GrantedItems, each_GrantedItems); ToJsonField(output, keyGrantedItems) = each_GrantedItems;
+            return output;
+        }
+
+        void RedeemMatchmakerTicketRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyLobbyId), LobbyId);
+            FromJsonUtilS(FromJsonField(input, keyTicket), Ticket);
+        }
+
+        Json::Value RedeemMatchmakerTicketRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_LobbyId; ToJsonUtilS(LobbyId, each_LobbyId); ToJsonField(output, keyLobbyId) = each_LobbyId;
+            Json::Value each_Ticket; ToJsonUtilS(Ticket, each_Ticket); ToJsonField(output, keyTicket) = each_Ticket;
+            return output;
+        }
+
+        void RedeemMatchmakerTicketResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyError), Error);
+            FromJsonUtilP(FromJsonField(input, keyTicketIsValid), TicketIsValid);
+            FromJsonUtilO(FromJsonField(input, keyUserInfo), UserInfo);
+        }
+
+        Json::Value RedeemMatchmakerTicketResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Error; ToJsonUtilS(Error, each_Error); ToJsonField(output, keyError) = each_Error;
+            Json::Value each_TicketIsValid; ToJsonUtilP(TicketIsValid, each_TicketIsValid); ToJsonField(output, keyTicketIsValid) = each_TicketIsValid;
+            Json::Value each_UserInfo; ToJsonUtilO(UserInfo, each_UserInfo); ToJsonField(output, keyUserInfo) = each_UserInfo;
+            return output;
+        }
+
+        void RefreshGameServerInstanceHeartbeatRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyLobbyId), LobbyId);
+        }
+
+        Json::Value RefreshGameServerInstanceHeartbeatRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_LobbyId; ToJsonUtilS(LobbyId, each_LobbyId); ToJsonField(output, keyLobbyId) = each_LobbyId;
+            return output;
+        }
+
+        void RefreshGameServerInstanceHeartbeatResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value RefreshGameServerInstanceHeartbeatResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void RegisterGameRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBuild), Build);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyGameMode), GameMode);
+            FromJsonUtilS(FromJsonField(input, keyLobbyId), LobbyId);
+            FromJsonEnum(FromJsonField(input, keyRegion), pfRegion);
+            FromJsonUtilS(FromJsonField(input, keyServerIPV4Address), ServerIPV4Address);
+            FromJsonUtilS(FromJsonField(input, keyServerIPV6Address), ServerIPV6Address);
+            FromJsonUtilS(FromJsonField(input, keyServerPort), ServerPort);
+            FromJsonUtilS(FromJsonField(input, keyServerPublicDNSName), ServerPublicDNSName);
+            FromJsonUtilS(FromJsonField(input, keyTags), Tags);
+        }
+
+        Json::Value RegisterGameRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Build; ToJsonUtilS(Build, each_Build); ToJsonField(output, keyBuild) = each_Build;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_GameMode; ToJsonUtilS(GameMode, each_GameMode); ToJsonField(output, keyGameMode) = each_GameMode;
+            Json::Value each_LobbyId; ToJsonUtilS(LobbyId, each_LobbyId); ToJsonField(output, keyLobbyId) = each_LobbyId;
+            Json::Value each_pfRegion; ToJsonEnum(pfRegion, each_pfRegion); ToJsonField(output, keyRegion) = each_pfRegion;
+            Json::Value each_ServerIPV4Address; ToJsonUtilS(ServerIPV4Address, each_ServerIPV4Address); ToJsonField(output, keyServerIPV4Address) = each_ServerIPV4Address;
+            Json::Value each_ServerIPV6Address; ToJsonUtilS(ServerIPV6Address, each_ServerIPV6Address); ToJsonField(output, keyServerIPV6Address) = each_ServerIPV6Address;
+            Json::Value each_ServerPort; ToJsonUtilS(ServerPort, each_ServerPort); ToJsonField(output, keyServerPort) = each_ServerPort;
+            Json::Value each_ServerPublicDNSName; ToJsonUtilS(ServerPublicDNSName, each_ServerPublicDNSName); ToJsonField(output, keyServerPublicDNSName) = each_ServerPublicDNSName;
+            Json::Value each_Tags; ToJsonUtilS(Tags, each_Tags); ToJsonField(output, keyTags) = each_Tags;
+            return output;
+        }
+
+        void RegisterGameResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyLobbyId), LobbyId);
+        }
+
+        Json::Value RegisterGameResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_LobbyId; ToJsonUtilS(LobbyId, each_LobbyId); ToJsonField(output, keyLobbyId) = each_LobbyId;
+            return output;
+        }
+
+        void RemoveFriendRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyFriendPlayFabId), FriendPlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value RemoveFriendRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_FriendPlayFabId; ToJsonUtilS(FriendPlayFabId, each_FriendPlayFabId); ToJsonField(output, keyFriendPlayFabId) = each_FriendPlayFabId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void RemoveGenericIDRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyGenericId), GenericId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value RemoveGenericIDRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GenericId; ToJsonUtilO(GenericId, each_GenericId); ToJsonField(output, keyGenericId) = each_GenericId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void RemovePlayerTagRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyTagName), TagName);
+        }
+
+        Json::Value RemovePlayerTagRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_TagName; ToJsonUtilS(TagName, each_TagName); ToJsonField(output, keyTagName) = each_TagName;
+            return output;
+        }
+
+        void RemovePlayerTagResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value RemovePlayerTagResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void RemoveSharedGroupMembersRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlayFabIds), PlayFabIds);
+            FromJsonUtilS(FromJsonField(input, keySharedGroupId), SharedGroupId);
+        }
+
+        Json::Value RemoveSharedGroupMembersRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayFabIds; ToJsonUtilS(PlayFabIds, each_PlayFabIds); ToJsonField(output, keyPlayFabIds) = each_PlayFabIds;
+            Json::Value each_SharedGroupId; ToJsonUtilS(SharedGroupId, each_SharedGroupId); ToJsonField(output, keySharedGroupId) = each_SharedGroupId;
+            return output;
+        }
+
+        void RemoveSharedGroupMembersResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value RemoveSharedGroupMembersResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void ReportPlayerServerRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyComment), Comment);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyReporteeId), ReporteeId);
+            FromJsonUtilS(FromJsonField(input, keyReporterId), ReporterId);
+        }
+
+        Json::Value ReportPlayerServerRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Comment; ToJsonUtilS(Comment, each_Comment); ToJsonField(output, keyComment) = each_Comment;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ReporteeId; ToJsonUtilS(ReporteeId, each_ReporteeId); ToJsonField(output, keyReporteeId) = each_ReporteeId;
+            Json::Value each_ReporterId; ToJsonUtilS(ReporterId, each_ReporterId); ToJsonField(output, keyReporterId) = each_ReporterId;
+            return output;
+        }
+
+        void ReportPlayerServerResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keySubmissionsRemaining), SubmissionsRemaining);
+        }
+
+        Json::Value ReportPlayerServerResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_SubmissionsRemaining; ToJsonUtilP(SubmissionsRemaining, each_SubmissionsRemaining); ToJsonField(output, keySubmissionsRemaining) = each_SubmissionsRemaining;
+            return output;
+        }
+
+        void RevokeAllBansForUserRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value RevokeAllBansForUserRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void RevokeAllBansForUserResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyBanData), BanData);
+        }
+
+        Json::Value RevokeAllBansForUserResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BanData; ToJsonUtilO(BanData, each_BanData); ToJsonField(output, keyBanData) = each_BanData;
+            return output;
+        }
+
+        void RevokeBansRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyBanIds), BanIds);
+        }
+
+        Json::Value RevokeBansRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BanIds; ToJsonUtilS(BanIds, each_BanIds); ToJsonField(output, keyBanIds) = each_BanIds;
+            return output;
+        }
+
+        void RevokeBansResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyBanData), BanData);
+        }
+
+        Json::Value RevokeBansResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BanData; ToJsonUtilO(BanData, each_BanData); ToJsonField(output, keyBanData) = each_BanData;
+            return output;
+        }
+
+        void RevokeInventoryItem::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyItemInstanceId), ItemInstanceId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value RevokeInventoryItem::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_ItemInstanceId; ToJsonUtilS(ItemInstanceId, each_ItemInstanceId); ToJsonField(output, keyItemInstanceId) = each_ItemInstanceId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void RevokeInventoryItemRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyItemInstanceId), ItemInstanceId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value RevokeInventoryItemRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_ItemInstanceId; ToJsonUtilS(ItemInstanceId, each_ItemInstanceId); ToJsonField(output, keyItemInstanceId) = each_ItemInstanceId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void RevokeInventoryItemsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyItems), Items);
+        }
+
+        Json::Value RevokeInventoryItemsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Items; ToJsonUtilO(Items, each_Items); ToJsonField(output, keyItems) = each_Items;
+            return output;
+        }
+
+        void RevokeItemError::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilE(FromJsonField(input, keyError), Error);
+            FromJsonUtilO(FromJsonField(input, keyItem), Item);
+        }
+
+        Json::Value RevokeItemError::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Error; ToJsonUtilE(Error, each_Error); ToJsonField(output, keyError) = each_Error;
+            Json::Value each_Item; ToJsonUtilO(Item, each_Item); ToJsonField(output, keyItem) = each_Item;
+            return output;
+        }
+
+        void RevokeInventoryItemsResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyErrors), Errors);
+        }
+
+        Json::Value RevokeInventoryItemsResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Errors; ToJsonUtilO(Errors, each_Errors); ToJsonField(output, keyErrors) = each_Errors;
+            return output;
+        }
+
+        void RevokeInventoryResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value RevokeInventoryResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void SavePushNotificationTemplateRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyAndroidPayload), AndroidPayload);
+            FromJsonUtilS(FromJsonField(input, keyId), Id);
+            FromJsonUtilS(FromJsonField(input, keyIOSPayload), IOSPayload);
+            FromJsonUtilO(FromJsonField(input, keyLocalizedPushNotificationTemplates), LocalizedPushNotificationTemplates);
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+        }
+
+        Json::Value SavePushNotificationTemplateRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AndroidPayload; ToJsonUtilS(AndroidPayload, each_AndroidPayload); ToJsonField(output, keyAndroidPayload) = each_AndroidPayload;
+            Json::Value each_Id; ToJsonUtilS(Id, each_Id); ToJsonField(output, keyId) = each_Id;
+            Json::Value each_IOSPayload; ToJsonUtilS(IOSPayload, each_IOSPayload); ToJsonField(output, keyIOSPayload) = each_IOSPayload;
+            Json::Value each_LocalizedPushNotificationTemplates; ToJsonUtilO(LocalizedPushNotificationTemplates, each_LocalizedPushNotificationTemplates); ToJsonField(output, keyLocalizedPushNotificationTemplates) = each_LocalizedPushNotificationTemplates;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            return output;
+        }
+
+        void SavePushNotificationTemplateResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPushNotificationTemplateId), PushNotificationTemplateId);
+        }
+
+        Json::Value SavePushNotificationTemplateResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PushNotificationTemplateId; ToJsonUtilS(PushNotificationTemplateId, each_PushNotificationTemplateId); ToJsonField(output, keyPushNotificationTemplateId) = each_PushNotificationTemplateId;
+            return output;
+        }
+
+        void SendCustomAccountRecoveryEmailRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyEmail), Email);
+            FromJsonUtilS(FromJsonField(input, keyEmailTemplateId), EmailTemplateId);
+            FromJsonUtilS(FromJsonField(input, keyUsername), Username);
+        }
+
+        Json::Value SendCustomAccountRecoveryEmailRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Email; ToJsonUtilS(Email, each_Email); ToJsonField(output, keyEmail) = each_Email;
+            Json::Value each_EmailTemplateId; ToJsonUtilS(EmailTemplateId, each_EmailTemplateId); ToJsonField(output, keyEmailTemplateId) = each_EmailTemplateId;
+            Json::Value each_Username; ToJsonUtilS(Username, each_Username); ToJsonField(output, keyUsername) = each_Username;
+            return output;
+        }
+
+        void SendCustomAccountRecoveryEmailResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value SendCustomAccountRecoveryEmailResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void SendEmailFromTemplateRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyEmailTemplateId), EmailTemplateId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value SendEmailFromTemplateRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_EmailTemplateId; ToJsonUtilS(EmailTemplateId, each_EmailTemplateId); ToJsonField(output, keyEmailTemplateId) = each_EmailTemplateId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void SendEmailFromTemplateResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value SendEmailFromTemplateResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void SendPushNotificationFromTemplateRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPushNotificationTemplateId), PushNotificationTemplateId);
+            FromJsonUtilS(FromJsonField(input, keyRecipient), Recipient);
+        }
+
+        Json::Value SendPushNotificationFromTemplateRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PushNotificationTemplateId; ToJsonUtilS(PushNotificationTemplateId, each_PushNotificationTemplateId); ToJsonField(output, keyPushNotificationTemplateId) = each_PushNotificationTemplateId;
+            Json::Value each_Recipient; ToJsonUtilS(Recipient, each_Recipient); ToJsonField(output, keyRecipient) = each_Recipient;
+            return output;
+        }
+
+        void SendPushNotificationRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyAdvancedPlatformDelivery), AdvancedPlatformDelivery);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyMessage), Message);
+            FromJsonUtilO(FromJsonField(input, keyPackage), Package);
+            FromJsonUtilS(FromJsonField(input, keyRecipient), Recipient);
+            FromJsonUtilS(FromJsonField(input, keySubject), Subject);
+            FromJsonUtilE(FromJsonField(input, keyTargetPlatforms), TargetPlatforms);
+        }
+
+        Json::Value SendPushNotificationRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_AdvancedPlatformDelivery; ToJsonUtilO(AdvancedPlatformDelivery, each_AdvancedPlatformDelivery); ToJsonField(output, keyAdvancedPlatformDelivery) = each_AdvancedPlatformDelivery;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Message; ToJsonUtilS(Message, each_Message); ToJsonField(output, keyMessage) = each_Message;
+            Json::Value each_Package; ToJsonUtilO(Package, each_Package); ToJsonField(output, keyPackage) = each_Package;
+            Json::Value each_Recipient; ToJsonUtilS(Recipient, each_Recipient); ToJsonField(output, keyRecipient) = each_Recipient;
+            Json::Value each_Subject; ToJsonUtilS(Subject, each_Subject); ToJsonField(output, keySubject) = each_Subject;
+            Json::Value each_TargetPlatforms; ToJsonUtilE(TargetPlatforms, each_TargetPlatforms); ToJsonField(output, keyTargetPlatforms) = each_TargetPlatforms;
+            return output;
+        }
+
+        void SendPushNotificationResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value SendPushNotificationResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void UserSettings::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyGatherDeviceInfo), GatherDeviceInfo);
+            FromJsonUtilP(FromJsonField(input, keyGatherFocusInfo), GatherFocusInfo);
+            FromJsonUtilP(FromJsonField(input, keyNeedsAttribution), NeedsAttribution);
+        }
+
+        Json::Value UserSettings::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GatherDeviceInfo; ToJsonUtilP(GatherDeviceInfo, each_GatherDeviceInfo); ToJsonField(output, keyGatherDeviceInfo) = each_GatherDeviceInfo;
+            Json::Value each_GatherFocusInfo; ToJsonUtilP(GatherFocusInfo, each_GatherFocusInfo); ToJsonField(output, keyGatherFocusInfo) = each_GatherFocusInfo;
+            Json::Value each_NeedsAttribution; ToJsonUtilP(NeedsAttribution, each_NeedsAttribution); ToJsonField(output, keyNeedsAttribution) = each_NeedsAttribution;
+            return output;
+        }
+
+        void Variable::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyName), Name);
+            FromJsonUtilS(FromJsonField(input, keyValue), Value);
+        }
+
+        Json::Value Variable::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Name; ToJsonUtilS(Name, each_Name); ToJsonField(output, keyName) = each_Name;
+            Json::Value each_Value; ToJsonUtilS(Value, each_Value); ToJsonField(output, keyValue) = each_Value;
+            return output;
+        }
+
+        void TreatmentAssignment::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyVariables), Variables);
+            FromJsonUtilS(FromJsonField(input, keyVariants), Variants);
+        }
+
+        Json::Value TreatmentAssignment::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Variables; ToJsonUtilO(Variables, each_Variables); ToJsonField(output, keyVariables) = each_Variables;
+            Json::Value each_Variants; ToJsonUtilS(Variants, each_Variants); ToJsonField(output, keyVariants) = each_Variants;
+            return output;
+        }
+
+        void ServerLoginResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyEntityToken), EntityToken);
+            FromJsonUtilO(FromJsonField(input, keyInfoResultPayload), InfoResultPayload);
+            FromJsonUtilT(FromJsonField(input, keyLastLoginTime), LastLoginTime);
+            FromJsonUtilP(FromJsonField(input, keyNewlyCreated), NewlyCreated);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keySessionTicket), SessionTicket);
+            FromJsonUtilO(FromJsonField(input, keySettingsForUser), SettingsForUser);
+            FromJsonUtilO(FromJsonField(input, keyTreatmentAssignment), pfTreatmentAssignment);
+        }
+
+        Json::Value ServerLoginResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_EntityToken; ToJsonUtilO(EntityToken, each_EntityToken); ToJsonField(output, keyEntityToken) = each_EntityToken;
+            Json::Value each_InfoResultPayload; ToJsonUtilO(InfoResultPayload, each_InfoResultPayload); ToJsonField(output, keyInfoResultPayload) = each_InfoResultPayload;
+            Json::Value each_LastLoginTime; ToJsonUtilT(LastLoginTime, each_LastLoginTime); ToJsonField(output, keyLastLoginTime) = each_LastLoginTime;
+            Json::Value each_NewlyCreated; ToJsonUtilP(NewlyCreated, each_NewlyCreated); ToJsonField(output, keyNewlyCreated) = each_NewlyCreated;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_SessionTicket; ToJsonUtilS(SessionTicket, each_SessionTicket); ToJsonField(output, keySessionTicket) = each_SessionTicket;
+            Json::Value each_SettingsForUser; ToJsonUtilO(SettingsForUser, each_SettingsForUser); ToJsonField(output, keySettingsForUser) = each_SettingsForUser;
+            Json::Value each_pfTreatmentAssignment; ToJsonUtilO(pfTreatmentAssignment, each_pfTreatmentAssignment); ToJsonField(output, keyTreatmentAssignment) = each_pfTreatmentAssignment;
+            return output;
+        }
+
+        void SetFriendTagsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyFriendPlayFabId), FriendPlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyTags), Tags);
+        }
+
+        Json::Value SetFriendTagsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_FriendPlayFabId; ToJsonUtilS(FriendPlayFabId, each_FriendPlayFabId); ToJsonField(output, keyFriendPlayFabId) = each_FriendPlayFabId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_Tags; ToJsonUtilS(Tags, each_Tags); ToJsonField(output, keyTags) = each_Tags;
+            return output;
+        }
+
+        void SetGameServerInstanceDataRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyGameServerData), GameServerData);
+            FromJsonUtilS(FromJsonField(input, keyLobbyId), LobbyId);
+        }
+
+        Json::Value SetGameServerInstanceDataRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GameServerData; ToJsonUtilS(GameServerData, each_GameServerData); ToJsonField(output, keyGameServerData) = each_GameServerData;
+            Json::Value each_LobbyId; ToJsonUtilS(LobbyId, each_LobbyId); ToJsonField(output, keyLobbyId) = each_LobbyId;
+            return output;
+        }
+
+        void SetGameServerInstanceDataResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value SetGameServerInstanceDataResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void SetGameServerInstanceStateRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyLobbyId), LobbyId);
+            FromJsonEnum(FromJsonField(input, keyState), State);
+        }
+
+        Json::Value SetGameServerInstanceStateRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_LobbyId; ToJsonUtilS(LobbyId, each_LobbyId); ToJsonField(output, keyLobbyId) = each_LobbyId;
+            Json::Value each_State; ToJsonEnum(State, each_State); ToJsonField(output, keyState) = each_State;
+            return output;
+        }
+
+        void SetGameServerInstanceStateResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value SetGameServerInstanceStateResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void SetGameServerInstanceTagsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyLobbyId), LobbyId);
+            FromJsonUtilS(FromJsonField(input, keyTags), Tags);
+        }
+
+        Json::Value SetGameServerInstanceTagsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_LobbyId; ToJsonUtilS(LobbyId, each_LobbyId); ToJsonField(output, keyLobbyId) = each_LobbyId;
+            Json::Value each_Tags; ToJsonUtilS(Tags, each_Tags); ToJsonField(output, keyTags) = each_Tags;
+            return output;
+        }
+
+        void SetGameServerInstanceTagsResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value SetGameServerInstanceTagsResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void SetPlayerSecretRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyPlayerSecret), PlayerSecret);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value SetPlayerSecretRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_PlayerSecret; ToJsonUtilS(PlayerSecret, each_PlayerSecret); ToJsonField(output, keyPlayerSecret) = each_PlayerSecret;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void SetPlayerSecretResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value SetPlayerSecretResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void SetPublisherDataRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyKey), Key);
+            FromJsonUtilS(FromJsonField(input, keyValue), Value);
+        }
+
+        Json::Value SetPublisherDataRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Key; ToJsonUtilS(Key, each_Key); ToJsonField(output, keyKey) = each_Key;
+            Json::Value each_Value; ToJsonUtilS(Value, each_Value); ToJsonField(output, keyValue) = each_Value;
+            return output;
+        }
+
+        void SetPublisherDataResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value SetPublisherDataResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void SetTitleDataRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyKey), Key);
+            FromJsonUtilS(FromJsonField(input, keyValue), Value);
+        }
+
+        Json::Value SetTitleDataRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Key; ToJsonUtilS(Key, each_Key); ToJsonField(output, keyKey) = each_Key;
+            Json::Value each_Value; ToJsonUtilS(Value, each_Value); ToJsonField(output, keyValue) = each_Value;
+            return output;
+        }
+
+        void SetTitleDataResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value SetTitleDataResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void StatisticUpdate::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyStatisticName), StatisticName);
+            FromJsonUtilP(FromJsonField(input, keyValue), Value);
+            FromJsonUtilP(FromJsonField(input, keyVersion), Version);
+        }
+
+        Json::Value StatisticUpdate::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_StatisticName; ToJsonUtilS(StatisticName, each_StatisticName); ToJsonField(output, keyStatisticName) = each_StatisticName;
+            Json::Value each_Value; ToJsonUtilP(Value, each_Value); ToJsonField(output, keyValue) = each_Value;
+            Json::Value each_Version; ToJsonUtilP(Version, each_Version); ToJsonField(output, keyVersion) = each_Version;
+            return output;
+        }
+
+        void SubtractCharacterVirtualCurrencyRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyAmount), Amount);
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyVirtualCurrency), VirtualCurrency);
+        }
+
+        Json::Value SubtractCharacterVirtualCurrencyRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Amount; ToJsonUtilP(Amount, each_Amount); ToJsonField(output, keyAmount) = each_Amount;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_VirtualCurrency; ToJsonUtilS(VirtualCurrency, each_VirtualCurrency); ToJsonField(output, keyVirtualCurrency) = each_VirtualCurrency;
+            return output;
+        }
+
+        void SubtractUserVirtualCurrencyRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyAmount), Amount);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyVirtualCurrency), VirtualCurrency);
+        }
+
+        Json::Value SubtractUserVirtualCurrencyRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Amount; ToJsonUtilP(Amount, each_Amount); ToJsonField(output, keyAmount) = each_Amount;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_VirtualCurrency; ToJsonUtilS(VirtualCurrency, each_VirtualCurrency); ToJsonField(output, keyVirtualCurrency) = each_VirtualCurrency;
+            return output;
+        }
+
+        void UnlinkPSNAccountRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value UnlinkPSNAccountRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void UnlinkPSNAccountResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value UnlinkPSNAccountResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void UnlinkServerCustomIdRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilS(FromJsonField(input, keyServerCustomId), ServerCustomId);
+        }
+
+        Json::Value UnlinkServerCustomIdRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_ServerCustomId; ToJsonUtilS(ServerCustomId, each_ServerCustomId); ToJsonField(output, keyServerCustomId) = each_ServerCustomId;
+            return output;
+        }
+
+        void UnlinkServerCustomIdResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value UnlinkServerCustomIdResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void UnlinkXboxAccountRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value UnlinkXboxAccountRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void UnlinkXboxAccountResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value UnlinkXboxAccountResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void UnlockContainerInstanceRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyContainerItemInstanceId), ContainerItemInstanceId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyKeyItemInstanceId), KeyItemInstanceId);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value UnlockContainerInstanceRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_ContainerItemInstanceId; ToJsonUtilS(ContainerItemInstanceId, each_ContainerItemInstanceId); ToJsonField(output, keyContainerItemInstanceId) = each_ContainerItemInstanceId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_KeyItemInstanceId; ToJsonUtilS(KeyItemInstanceId, each_KeyItemInstanceId); ToJsonField(output, keyKeyItemInstanceId) = each_KeyItemInstanceId;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void UnlockContainerItemRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCatalogVersion), CatalogVersion);
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyContainerItemId), ContainerItemId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value UnlockContainerItemRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CatalogVersion; ToJsonUtilS(CatalogVersion, each_CatalogVersion); ToJsonField(output, keyCatalogVersion) = each_CatalogVersion;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_ContainerItemId; ToJsonUtilS(ContainerItemId, each_ContainerItemId); ToJsonField(output, keyContainerItemId) = each_ContainerItemId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void UnlockContainerItemResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyGrantedItems), GrantedItems);
+            FromJsonUtilS(FromJsonField(input, keyUnlockedItemInstanceId), UnlockedItemInstanceId);
+            FromJsonUtilS(FromJsonField(input, keyUnlockedWithItemInstanceId), UnlockedWithItemInstanceId);
+            FromJsonUtilP(FromJsonField(input, keyVirtualCurrency), VirtualCurrency);
+        }
+
+        Json::Value UnlockContainerItemResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_GrantedItems; ToJsonUtilO(GrantedItems, each_GrantedItems); ToJsonField(output, keyGrantedItems) = each_GrantedItems;
+            Json::Value each_UnlockedItemInstanceId; ToJsonUtilS(UnlockedItemInstanceId, each_UnlockedItemInstanceId); ToJsonField(output, keyUnlockedItemInstanceId) = each_UnlockedItemInstanceId;
+            Json::Value each_UnlockedWithItemInstanceId; ToJsonUtilS(UnlockedWithItemInstanceId, each_UnlockedWithItemInstanceId); ToJsonField(output, keyUnlockedWithItemInstanceId) = each_UnlockedWithItemInstanceId;
+            Json::Value each_VirtualCurrency; ToJsonUtilP(VirtualCurrency, each_VirtualCurrency); ToJsonField(output, keyVirtualCurrency) = each_VirtualCurrency;
+            return output;
+        }
+
+        void UpdateAvatarUrlRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyImageUrl), ImageUrl);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value UpdateAvatarUrlRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_ImageUrl; ToJsonUtilS(ImageUrl, each_ImageUrl); ToJsonField(output, keyImageUrl) = each_ImageUrl;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void UpdateBanRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyActive), Active);
+            FromJsonUtilS(FromJsonField(input, keyBanId), BanId);
+            FromJsonUtilT(FromJsonField(input, keyExpires), Expires);
+            FromJsonUtilS(FromJsonField(input, keyIPAddress), IPAddress);
+            FromJsonUtilS(FromJsonField(input, keyMACAddress), MACAddress);
+            FromJsonUtilP(FromJsonField(input, keyPermanent), Permanent);
+            FromJsonUtilS(FromJsonField(input, keyReason), Reason);
+        }
+
+        Json::Value UpdateBanRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Active; ToJsonUtilP(Active, each_Active); ToJsonField(output, keyActive) = each_Active;
+            Json::Value each_BanId; ToJsonUtilS(BanId, each_BanId); ToJsonField(output, keyBanId) = each_BanId;
+            Json::Value each_Expires; ToJsonUtilT(Expires, each_Expires); ToJsonField(output, keyExpires) = each_Expires;
+            Json::Value each_IPAddress; ToJsonUtilS(IPAddress, each_IPAddress); ToJsonField(output, keyIPAddress) = each_IPAddress;
+            Json::Value each_MACAddress; ToJsonUtilS(MACAddress, each_MACAddress); ToJsonField(output, keyMACAddress) = each_MACAddress;
+            Json::Value each_Permanent; ToJsonUtilP(Permanent, each_Permanent); ToJsonField(output, keyPermanent) = each_Permanent;
+            Json::Value each_Reason; ToJsonUtilS(Reason, each_Reason); ToJsonField(output, keyReason) = each_Reason;
+            return output;
+        }
+
+        void UpdateBansRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyBans), Bans);
+        }
+
+        Json::Value UpdateBansRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_Bans; ToJsonUtilO(Bans, each_Bans); ToJsonField(output, keyBans) = each_Bans;
+            return output;
+        }
+
+        void UpdateBansResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilO(FromJsonField(input, keyBanData), BanData);
+        }
+
+        Json::Value UpdateBansResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_BanData; ToJsonUtilO(BanData, each_BanData); ToJsonField(output, keyBanData) = each_BanData;
+            return output;
+        }
+
+        void UpdateCharacterDataRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyData), Data);
+            FromJsonUtilS(FromJsonField(input, keyKeysToRemove), KeysToRemove);
+            FromJsonUtilE(FromJsonField(input, keyPermission), Permission);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value UpdateCharacterDataRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Data; ToJsonUtilS(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            Json::Value each_KeysToRemove; ToJsonUtilS(KeysToRemove, each_KeysToRemove); ToJsonField(output, keyKeysToRemove) = each_KeysToRemove;
+            Json::Value each_Permission; ToJsonUtilE(Permission, each_Permission); ToJsonField(output, keyPermission) = each_Permission;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void UpdateCharacterDataResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyDataVersion), DataVersion);
+        }
+
+        Json::Value UpdateCharacterDataResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_DataVersion; ToJsonUtilP(DataVersion, each_DataVersion); ToJsonField(output, keyDataVersion) = each_DataVersion;
+            return output;
+        }
+
+        void UpdateCharacterStatisticsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilP(FromJsonField(input, keyCharacterStatistics), CharacterStatistics);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value UpdateCharacterStatisticsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_CharacterStatistics; ToJsonUtilP(CharacterStatistics, each_CharacterStatistics); ToJsonField(output, keyCharacterStatistics) = each_CharacterStatistics;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void UpdateCharacterStatisticsResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value UpdateCharacterStatisticsResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void UpdatePlayerStatisticsRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilP(FromJsonField(input, keyForceUpdate), ForceUpdate);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilO(FromJsonField(input, keyStatistics), Statistics);
+        }
+
+        Json::Value UpdatePlayerStatisticsRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_ForceUpdate; ToJsonUtilP(ForceUpdate, each_ForceUpdate); ToJsonField(output, keyForceUpdate) = each_ForceUpdate;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_Statistics; ToJsonUtilO(Statistics, each_Statistics); ToJsonField(output, keyStatistics) = each_Statistics;
+            return output;
+        }
+
+        void UpdatePlayerStatisticsResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value UpdatePlayerStatisticsResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void UpdateSharedGroupDataRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyData), Data);
+            FromJsonUtilS(FromJsonField(input, keyKeysToRemove), KeysToRemove);
+            FromJsonUtilE(FromJsonField(input, keyPermission), Permission);
+            FromJsonUtilS(FromJsonField(input, keySharedGroupId), SharedGroupId);
+        }
+
+        Json::Value UpdateSharedGroupDataRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Data; ToJsonUtilS(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            Json::Value each_KeysToRemove; ToJsonUtilS(KeysToRemove, each_KeysToRemove); ToJsonField(output, keyKeysToRemove) = each_KeysToRemove;
+            Json::Value each_Permission; ToJsonUtilE(Permission, each_Permission); ToJsonField(output, keyPermission) = each_Permission;
+            Json::Value each_SharedGroupId; ToJsonUtilS(SharedGroupId, each_SharedGroupId); ToJsonField(output, keySharedGroupId) = each_SharedGroupId;
+            return output;
+        }
+
+        void UpdateSharedGroupDataResult::FromJson(const Json::Value&)
+        {
+        }
+
+        Json::Value UpdateSharedGroupDataResult::ToJson() const
+        {
+            Json::Value output;
+            return output;
+        }
+
+        void UpdateUserDataRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyData), Data);
+            FromJsonUtilS(FromJsonField(input, keyKeysToRemove), KeysToRemove);
+            FromJsonUtilE(FromJsonField(input, keyPermission), Permission);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value UpdateUserDataRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Data; ToJsonUtilS(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            Json::Value each_KeysToRemove; ToJsonUtilS(KeysToRemove, each_KeysToRemove); ToJsonField(output, keyKeysToRemove) = each_KeysToRemove;
+            Json::Value each_Permission; ToJsonUtilE(Permission, each_Permission); ToJsonField(output, keyPermission) = each_Permission;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void UpdateUserDataResult::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilP(FromJsonField(input, keyDataVersion), DataVersion);
+        }
+
+        Json::Value UpdateUserDataResult::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_DataVersion; ToJsonUtilP(DataVersion, each_DataVersion); ToJsonField(output, keyDataVersion) = each_DataVersion;
+            return output;
+        }
+
+        void UpdateUserInternalDataRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyData), Data);
+            FromJsonUtilS(FromJsonField(input, keyKeysToRemove), KeysToRemove);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value UpdateUserInternalDataRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Data; ToJsonUtilS(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            Json::Value each_KeysToRemove; ToJsonUtilS(KeysToRemove, each_KeysToRemove); ToJsonField(output, keyKeysToRemove) = each_KeysToRemove;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void UpdateUserInventoryItemDataRequest::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyData), Data);
+            FromJsonUtilS(FromJsonField(input, keyItemInstanceId), ItemInstanceId);
+            FromJsonUtilS(FromJsonField(input, keyKeysToRemove), KeysToRemove);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+        }
+
+        Json::Value UpdateUserInventoryItemDataRequest::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_Data; ToJsonUtilS(Data, each_Data); ToJsonField(output, keyData) = each_Data;
+            Json::Value each_ItemInstanceId; ToJsonUtilS(ItemInstanceId, each_ItemInstanceId); ToJsonField(output, keyItemInstanceId) = each_ItemInstanceId;
+            Json::Value each_KeysToRemove; ToJsonUtilS(KeysToRemove, each_KeysToRemove); ToJsonField(output, keyKeysToRemove) = each_KeysToRemove;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            return output;
+        }
+
+        void WriteEventResponse::FromJson(const Json::Value& input)
+        {
+            FromJsonUtilS(FromJsonField(input, keyEventId), EventId);
+        }
+
+        Json::Value WriteEventResponse::ToJson() const
+        {
+            Json::Value output;
+            Json::Value each_EventId; ToJsonUtilS(EventId, each_EventId); ToJsonField(output, keyEventId) = each_EventId;
+            return output;
+        }
+
+        void WriteServerCharacterEventRequest::FromJson(const Json::Value& input)
+        {
+            Body = FromJsonField(input, keyBody);
+            FromJsonUtilS(FromJsonField(input, keyCharacterId), CharacterId);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyEventName), EventName);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilT(FromJsonField(input, keyTimestamp), Timestamp);
+        }
+
+        Json::Value WriteServerCharacterEventRequest::ToJson() const
+        {
+            Json::Value output;
+            ToJsonField(output, keyBody) = Body;
+            Json::Value each_CharacterId; ToJsonUtilS(CharacterId, each_CharacterId); ToJsonField(output, keyCharacterId) = each_CharacterId;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_EventName; ToJsonUtilS(EventName, each_EventName); ToJsonField(output, keyEventName) = each_EventName;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_Timestamp; ToJsonUtilT(Timestamp, each_Timestamp); ToJsonField(output, keyTimestamp) = each_Timestamp;
+            return output;
+        }
+
+        void WriteServerPlayerEventRequest::FromJson(const Json::Value& input)
+        {
+            Body = FromJsonField(input, keyBody);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyEventName), EventName);
+            FromJsonUtilS(FromJsonField(input, keyPlayFabId), PlayFabId);
+            FromJsonUtilT(FromJsonField(input, keyTimestamp), Timestamp);
+        }
+
+        Json::Value WriteServerPlayerEventRequest::ToJson() const
+        {
+            Json::Value output;
+            ToJsonField(output, keyBody) = Body;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_EventName; ToJsonUtilS(EventName, each_EventName); ToJsonField(output, keyEventName) = each_EventName;
+            Json::Value each_PlayFabId; ToJsonUtilS(PlayFabId, each_PlayFabId); ToJsonField(output, keyPlayFabId) = each_PlayFabId;
+            Json::Value each_Timestamp; ToJsonUtilT(Timestamp, each_Timestamp); ToJsonField(output, keyTimestamp) = each_Timestamp;
+            return output;
+        }
+
+        void WriteTitleEventRequest::FromJson(const Json::Value& input)
+        {
+            Body = FromJsonField(input, keyBody);
+            FromJsonUtilS(FromJsonField(input, keyCustomTags), CustomTags);
+            FromJsonUtilS(FromJsonField(input, keyEventName), EventName);
+            FromJsonUtilT(FromJsonField(input, keyTimestamp), Timestamp);
+        }
+
+        Json::Value WriteTitleEventRequest::ToJson() const
+        {
+            Json::Value output;
+            ToJsonField(output, keyBody) = Body;
+            Json::Value each_CustomTags; ToJsonUtilS(CustomTags, each_CustomTags); ToJsonField(output, keyCustomTags) = each_CustomTags;
+            Json::Value each_EventName; ToJsonUtilS(EventName, each_EventName); ToJsonField(output, keyEventName) = each_EventName;
+            Json::Value each_Timestamp; ToJsonUtilT(Timestamp, each_Timestamp); ToJsonField(output, keyTimestamp) = each_Timestamp;
+            return output;
+        }
+    }
+}
+
+#endif
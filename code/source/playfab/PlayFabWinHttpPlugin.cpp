@@ -4,6 +4,7 @@
 
 #include <playfab/PlayFabWinHttpPlugin.h>
 #include <playfab/PlayFabSettings.h>
+#include <playfab/PlayFabJsonUtils.h>
 #include <stdexcept>
 #include <vector>
 #include <windows.h>
@@ -204,33 +205,25 @@ namespace PlayFab
                             return;
                         }
 
-                        const std::unordered_map<std::string, std::string> headers = reqContainer.GetRequestHeaders();
-                        if (headers.size() > 0)
+                        for (const PlayFabRequestHeaders::Header& header : reqContainer.GetRequestHeaders())
                         {
-                            for (auto const& obj : headers)
+                            const std::string& headerLine = header.GetLine();
+                            hr = TryAddHeader(hRequest, std::wstring(headerLine.begin(), headerLine.end()).c_str());
+                            if(FAILED(hr))
                             {
-                                if (obj.first.length() != 0 && obj.second.length() != 0) // no empty keys or values in headers
-                                {
-                                    std::string header = obj.first + ": " + obj.second;
-                                    hr = TryAddHeader(hRequest, std::wstring(header.begin(), header.end()).c_str());
-                                    if(FAILED(hr))
-                                    {
-                                        SetErrorInfo(reqContainer, "Error in WinHttpAddRequestHeaders attempting to add parameters with HRESULT: " + std::to_string(hr));
-                                        CompleteRequest(std::move(requestContainer), hRequest, hConnect, hSession);
-                                        return;
-                                    }
-                                }
+                                SetErrorInfo(reqContainer, "Error in WinHttpAddRequestHeaders attempting to add parameters with HRESULT: " + std::to_string(hr));
+                                CompleteRequest(std::move(requestContainer), hRequest, hConnect, hSession);
+                                return;
                             }
                         }
 
                         // Send a request
                         DWORD payloadSize = 0;
                         LPVOID payload = NULL;
-                        std::string requestBody;
                         if (!GetBinaryPayload(reqContainer, payload, payloadSize))
                         {
                             // set string payload if binary wasn't provided
-                            requestBody = reqContainer.GetRequestBody();
+                            const std::string& requestBody = reqContainer.GetRequestBody();
                             payloadSize = (DWORD)requestBody.size();
                             payload = const_cast<char*>(requestBody.c_str());
                         }
@@ -416,21 +409,13 @@ namespace PlayFab
 
     void PlayFabWinHttpPlugin::ProcessResponse(CallRequestContainer& reqContainer, const int httpCode, std::string&& requestId)
     {
-        Json::CharReaderBuilder jsonReaderFactory;
-        std::unique_ptr<Json::CharReader> jsonReader(jsonReaderFactory.newCharReader());
-        JSONCPP_STRING jsonParseErrors;
-        const bool parsedSuccessfully = jsonReader->parse(reqContainer.responseString.c_str(), reqContainer.responseString.c_str() + reqContainer.responseString.length(), &reqContainer.responseJson, &jsonParseErrors);
+        std::string jsonParseErrors;
+        const bool parsedSuccessfully = PlayFabJsonUtils::ParseFromString(reqContainer.responseString, reqContainer.responseJson, jsonParseErrors);
 
         if (parsedSuccessfully)
         {
             // fully successful response
-            reqContainer.errorWrapper.HttpCode = reqContainer.responseJson.get("code", Json::Value::null).asInt();
-            reqContainer.errorWrapper.HttpStatus = reqContainer.responseJson.get("status", Json::Value::null).asString();
-            reqContainer.errorWrapper.Data = reqContainer.responseJson.get("data", Json::Value::null);
-            reqContainer.errorWrapper.ErrorName = reqContainer.responseJson.get("error", Json::Value::null).asString();
-            reqContainer.errorWrapper.ErrorCode = static_cast<PlayFabErrorCode>(reqContainer.responseJson.get("errorCode", Json::Value::null).asInt());
-            reqContainer.errorWrapper.ErrorMessage = reqContainer.responseJson.get("errorMessage", Json::Value::null).asString();
-            reqContainer.errorWrapper.ErrorDetails = reqContainer.responseJson.get("errorDetails", Json::Value::null);
+            reqContainer.ProcessResponseJson();
         }
         else
         {
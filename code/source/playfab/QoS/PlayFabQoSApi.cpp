@@ -29,12 +29,13 @@ namespace PlayFab
             multiplayerApi = std::make_shared<PlayFabMultiplayerInstanceAPI>(PlayFabSettings::staticPlayer);
         }
 
-        bool ValidateResult(PlayFabResultCommon& resultCommon, const CallRequestContainer& container)
+        bool ValidateResult(PlayFabResultCommon& resultCommon, CallRequestContainer& container)
         {
+            container.ReleaseRequestBody();
             if (container.errorWrapper.HttpCode == 200)
             {
-                resultCommon.FromJson(container.errorWrapper.Data);
-                resultCommon.Request = container.errorWrapper.Request;
+                resultCommon.FromJson(container.GetResultData());
+                resultCommon.Request.swap(container.errorWrapper.Request);
                 return true;
             }
             else // Process the error case
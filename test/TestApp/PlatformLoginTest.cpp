@@ -54,7 +54,7 @@ namespace PlayFabUnit
         // Make sure PlayFab state is clean.
         PlayFabSettings::ForgetAllCredentials();
 
-        PlayFabSettings::staticSettings->titleId = testTitleData.titleId;
+        PlayFabSettings::staticSettings->SetTitleId(testTitleData.titleId);
     }
 
     void PlatformLoginTest::Tick(TestContext& /*testContext*/)
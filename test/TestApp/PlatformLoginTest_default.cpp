@@ -50,7 +50,7 @@ namespace PlayFabUnit
         AddTest("TestPlatformSpecificLogin", &PlatformLoginTest::TestPlatformSpecificLogin);
         // Make sure PlayFab state is clean.
         PlayFabSettings::ForgetAllCredentials();
-        PlayFabSettings::staticSettings->titleId = testTitleData.titleId;
+        PlayFabSettings::staticSettings->SetTitleId(testTitleData.titleId);
     }
 
     void PlatformLoginTest::ClassSetUp()
@@ -763,11 +763,11 @@ namespace PlayFabUnit
         clientApi = std::make_shared<PlayFabClientInstanceAPI>(PlayFabSettings::staticPlayer);
         dataApi = std::make_shared<PlayFabDataInstanceAPI>(PlayFabSettings::staticPlayer);
 
-        PlayFabSettings::staticSettings->titleId = testTitleData.titleId;
+        PlayFabSettings::staticSettings->SetTitleId(testTitleData.titleId);
         USER_EMAIL = testTitleData.userEmail;
 
         // Verify all the inputs won't cause crashes in the tests
-        TITLE_INFO_SET = !PlayFabSettings::staticSettings->titleId.empty() && !USER_EMAIL.empty();
+        TITLE_INFO_SET = !PlayFabSettings::staticSettings->GetTitleId().empty() && !USER_EMAIL.empty();
 
         // Make sure PlayFab state is clean.
         PlayFabSettings::ForgetAllCredentials();
@@ -0,0 +1,340 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include "TestAppPch.h"
+
+#include <playfab/PlayFabCallRequestContainer.h>
+#include <playfab/PlayFabCloudScriptDataModels.h>
+#include <playfab/PlayFabEventsDataModels.h>
+#include <playfab/PlayFabEventsInstanceApi.h>
+#include <playfab/PlayFabJsonUtils.h>
+#include <playfab/PlayFabLazyResult.h>
+#include <playfab/PlayFabSettings.h>
+#include <cstring>
+#include "TestContext.h"
+#include "PlayFabCallRequestTest.h"
+
+namespace PlayFabUnit
+{
+    void PlayFabCallRequestTest::TestRequestContainerNoCopy(TestContext& testContext)
+    {
+        // A request body that's large enough to never fit in a small-string buffer, so a copy would always reallocate
+        std::string requestBody = "{\"Payload\":\"" + std::string(64 * 1024, 'x') + "\"}";
+        const char* requestBodyData = requestBody.data();
+
+        PlayFab::PlayFabRequestHeaders headers;
+        headers.Set(PlayFab::PlayFabRequestHeaderKey::Authorization, std::string(256, 'y'));
+        const char* headerLineData = headers.begin()->GetLine().data();
+
+        PlayFab::CallRequestContainer reqContainer(
+            "/Client/NoCopyTest",
+            std::move(headers),
+            std::move(requestBody),
+            nullptr,
+            PlayFab::PlayFabSettings::staticSettings,
+            nullptr,
+            nullptr);
+
+        if (reqContainer.GetRequestBody().data() != requestBodyData)
+        {
+            testContext.Fail("Request body was copied into the container instead of moved");
+            return;
+        }
+        if (reqContainer.GetRequestHeaders().begin()->GetLine().data() != headerLineData)
+        {
+            testContext.Fail("Request headers were copied into the container instead of moved");
+            return;
+        }
+        if (&reqContainer.GetRequestBody() != &reqContainer.GetRequestBody() || &reqContainer.GetUrl() != &reqContainer.GetUrl())
+        {
+            testContext.Fail("Request container accessors returned a copy");
+            return;
+        }
+
+        reqContainer.ReleaseRequestBody();
+        if (reqContainer.errorWrapper.Request["Payload"].asString().size() != 64 * 1024)
+        {
+            testContext.Fail("Request body was not parsed when it was released");
+            return;
+        }
+
+        testContext.Pass();
+    }
+
+    void PlayFabCallRequestTest::TestRequestHeaders(TestContext& testContext)
+    {
+        const std::string sessionTicket(256, 't');
+        const std::string entityToken(256, 'e');
+
+        PlayFab::PlayFabRequestHeaders headers;
+        headers.Set(PlayFab::PlayFabRequestHeaderKey::Authorization, sessionTicket);
+        headers.Set(PlayFab::PlayFabRequestHeaderKey::EntityToken, entityToken);
+        headers.Set(PlayFab::PlayFabRequestHeaderKey::SecretKey, "");
+        PlayFab::PlayFabRequestHeaders movedHeaders(std::move(headers));
+
+        if (movedHeaders.size() != 2 || movedHeaders.Find(PlayFab::PlayFabRequestHeaderKey::SecretKey) != nullptr)
+        {
+            testContext.Fail("An empty header value was stored");
+            return;
+        }
+
+        const PlayFab::PlayFabRequestHeaders::Header* header = movedHeaders.Find(PlayFab::PlayFabRequestHeaderKey::Authorization);
+        if (header == nullptr || header->GetLine() != "X-Authorization: " + sessionTicket ||
+            strcmp(header->GetName(), "X-Authorization") != 0 || header->GetValue() != sessionTicket)
+        {
+            testContext.Fail("The X-Authorization header was not stored as expected");
+            return;
+        }
+
+        // Setting a key again replaces its value
+        movedHeaders.Set(PlayFab::PlayFabRequestHeaderKey::EntityToken, "newToken");
+        header = movedHeaders.Find(PlayFab::PlayFabRequestHeaderKey::EntityToken);
+        if (movedHeaders.size() != 2 || header == nullptr || header->GetLine() != "X-EntityToken: newToken")
+        {
+            testContext.Fail("Setting the X-EntityToken header again did not replace it");
+            return;
+        }
+
+        // Setting a key to an empty value removes its header, so a stale value is never sent
+        movedHeaders.Set(PlayFab::PlayFabRequestHeaderKey::Authorization, "");
+        header = movedHeaders.Find(PlayFab::PlayFabRequestHeaderKey::EntityToken);
+        if (movedHeaders.size() != 1 || movedHeaders.Find(PlayFab::PlayFabRequestHeaderKey::Authorization) != nullptr ||
+            header == nullptr || header->GetLine() != "X-EntityToken: newToken")
+        {
+            testContext.Fail("Setting the X-Authorization header to an empty value did not remove it");
+            return;
+        }
+
+        testContext.Pass();
+    }
+
+    void PlayFabCallRequestTest::TestRequestContainerMemory(TestContext& testContext)
+    {
+        Json::Value request;
+        for (int i = 0; i < 100; ++i)
+        {
+            Json::Value& event = request["Events"][i];
+            event["EventNamespace"] = "custom.test";
+            event["Name"] = "event" + std::to_string(i);
+            event["Payload"]["Score"] = i;
+        }
+        std::string requestBody = PlayFab::PlayFabJsonUtils::WriteToString(request);
+        const size_t requestBodySize = requestBody.size();
+
+        PlayFab::CallRequestContainer reqContainer(
+            "/Event/WriteEvents",
+            PlayFab::PlayFabRequestHeaders(),
+            std::move(requestBody),
+            nullptr,
+            PlayFab::PlayFabSettings::staticSettings,
+            nullptr,
+            nullptr);
+
+        // While in flight, only the request body is held
+        const size_t inFlightUsage = reqContainer.GetMemoryUsage();
+        if (!reqContainer.errorWrapper.Request.isNull() || inFlightUsage > sizeof(reqContainer) + requestBodySize + 64)
+        {
+            testContext.Fail("The in-flight container holds more than its request body: " + std::to_string(inFlightUsage) + " bytes");
+            return;
+        }
+
+        // The raw response is released once it is parsed
+        reqContainer.responseString = "{\"code\":200,\"status\":\"OK\",\"data\":{\"AssignedEventIds\":[\"" + std::string(1024, 'a') + "\"]}}";
+        std::string errors;
+        if (!PlayFab::PlayFabJsonUtils::ParseFromString(reqContainer.responseString, reqContainer.responseJson, errors))
+        {
+            testContext.Fail("Failed to parse the test response: " + errors);
+            return;
+        }
+        const size_t parsedUsage = reqContainer.GetMemoryUsage();
+        reqContainer.ProcessResponseJson();
+        if (reqContainer.responseString.capacity() != std::string().capacity() || reqContainer.GetMemoryUsage() + 1024 > parsedUsage)
+        {
+            testContext.Fail("The raw response was not released after it was parsed");
+            return;
+        }
+
+        // The request body is only parsed, and then released, once the call completed
+        reqContainer.ReleaseRequestBody();
+        if (!reqContainer.GetRequestBody().empty() || reqContainer.errorWrapper.Request["Events"].size() != 100 ||
+            reqContainer.errorWrapper.UrlPath != "/Event/WriteEvents")
+        {
+            testContext.Fail("The request body was not parsed into the request json when it was released");
+            return;
+        }
+
+        testContext.Pass();
+    }
+
+    void PlayFabCallRequestTest::TestErrorResponseDecoding(TestContext& testContext)
+    {
+        // An error response populates the whole PlayFabError
+        PlayFab::CallRequestContainer errorContainer(
+            "/Test/ErrorPath",
+            PlayFab::PlayFabRequestHeaders(),
+            "{}",
+            nullptr,
+            PlayFab::PlayFabSettings::staticSettings,
+            nullptr,
+            nullptr);
+        std::string errors;
+        if (!PlayFab::PlayFabJsonUtils::ParseFromString(
+            "{\"code\":400,\"status\":\"BadRequest\",\"error\":\"InvalidParams\",\"errorCode\":1000,\"errorMessage\":\"Invalid input parameters\",\"errorDetails\":{\"Key\":[\"required\"]},\"data\":{\"Key\":1}}",
+            errorContainer.responseJson, errors))
+        {
+            testContext.Fail("Failed to parse the test error response: " + errors);
+            return;
+        }
+        errorContainer.ProcessResponseJson();
+        const PlayFab::PlayFabError& error = errorContainer.errorWrapper;
+        if (error.HttpCode != 400 || error.HttpStatus != "BadRequest" || error.ErrorName != "InvalidParams" ||
+            error.ErrorCode != PlayFab::PlayFabErrorCode::PlayFabErrorInvalidParams || error.ErrorMessage != "Invalid input parameters" ||
+            !error.ErrorDetails.isMember("Key") || error.Data["Key"].asInt() != 1)
+        {
+            testContext.Fail("The error response was not fully decoded into PlayFabError");
+            return;
+        }
+
+        testContext.Pass();
+    }
+
+    void PlayFabCallRequestTest::TestLazyResult(TestContext& testContext)
+    {
+#if !defined(DISABLE_PLAYFABENTITY_API)
+        PlayFab::CallRequestContainer reqContainer(
+            "/CloudScript/ExecuteFunction",
+            {},
+            "{\"FunctionName\":\"test\"}",
+            nullptr,
+            PlayFab::PlayFabSettings::staticSettings,
+            nullptr,
+            nullptr);
+        reqContainer.responseJson["code"] = 200;
+        reqContainer.responseJson["data"]["FunctionName"] = "test";
+        reqContainer.responseJson["data"]["ExecutionTimeMilliseconds"] = 42;
+        reqContainer.responseJson["data"]["Created"] = "2020-05-17T12:30:45.000Z";
+        reqContainer.responseJson["data"]["FunctionResult"]["Items"] = Json::Value(Json::arrayValue);
+        reqContainer.responseJson["data"]["FunctionResult"]["Items"].resize(1000);
+        const Json::Value* functionResultAddress = &reqContainer.responseJson["data"]["FunctionResult"];
+        reqContainer.ProcessResponseJson();
+
+        if (!PlayFab::PlayFabLazyResultBase::ValidateResult(reqContainer))
+        {
+            testContext.Fail("A successful response failed validation");
+            return;
+        }
+        PlayFab::PlayFabLazyResult<PlayFab::CloudScriptModels::ExecuteFunctionResult> lazyResult(reqContainer);
+
+        // The response json is taken over by the lazy result, not copied
+        if (&lazyResult.GetJson("FunctionResult") != functionResultAddress)
+        {
+            testContext.Fail("The lazy result copied the response data");
+            return;
+        }
+
+        std::string functionName;
+        Int32 executionTime = 0;
+        PlayFab::Boxed<bool> resultTooLarge;
+        if (!lazyResult.Get("FunctionName", functionName) || functionName != "test" ||
+            !lazyResult.Get("ExecutionTimeMilliseconds", executionTime) || executionTime != 42 ||
+            lazyResult.Get("FunctionResultTooLarge", resultTooLarge) || lazyResult.Has("FunctionResultTooLarge"))
+        {
+            testContext.Fail("Lazy result fields were not decoded as expected");
+            return;
+        }
+
+        // A time field decodes the same through Get as through GetTime
+        time_t created = 0;
+        time_t createdTime = 0;
+        PlayFab::Boxed<time_t> boxedCreated;
+        if (!lazyResult.Get("Created", created) || !lazyResult.GetTime("Created", createdTime) || created != createdTime ||
+            created != PlayFab::Iso8601StringToTimeT("2020-05-17T12:30:45.000Z") || !lazyResult.Get("Created", boxedCreated) || static_cast<time_t>(boxedCreated) != created)
+        {
+            testContext.Fail("A time field was not decoded as a time");
+            return;
+        }
+
+        PlayFab::CloudScriptModels::ExecuteFunctionResult materialized = lazyResult.Materialize();
+        if (materialized.FunctionName != "test" || materialized.FunctionResult["Items"].size() != 1000 || materialized.Request["FunctionName"] != "test")
+        {
+            testContext.Fail("The materialized result does not match the response");
+            return;
+        }
+#endif // !defined(DISABLE_PLAYFABENTITY_API)
+
+        testContext.Pass();
+    }
+
+    void PlayFabCallRequestTest::TestInstanceResultHandlers(TestContext& testContext)
+    {
+#if !defined(DISABLE_PLAYFABENTITY_API)
+        PlayFab::PlayFabEventsInstanceAPI eventsApi(std::make_shared<PlayFab::PlayFabAuthenticationContext>());
+
+        // A generated result handler decodes the result and invokes the success callback of the container
+        auto successContainer = std::make_shared<PlayFab::CallRequestContainer>(
+            "/Event/WriteEvents",
+            PlayFab::PlayFabRequestHeaders(),
+            "{}",
+            nullptr,
+            PlayFab::PlayFabSettings::staticSettings,
+            nullptr,
+            nullptr);
+        std::string assignedEventId;
+        successContainer->successCallback.Set<PlayFab::EventsModels::WriteEventsResponse>([&assignedEventId](const PlayFab::EventsModels::WriteEventsResponse& result, void*)
+        {
+            assignedEventId = result.AssignedEventIds.empty() ? "" : result.AssignedEventIds.front();
+        });
+        if (successContainer->successCallback.Get<PlayFab::EventsModels::WriteEventsResponse>() == nullptr ||
+            successContainer->successCallback.Get<PlayFab::PlayFabResultCommon>() != nullptr)
+        {
+            testContext.Fail("The success callback was not looked up by the result type it was set with");
+            return;
+        }
+        successContainer->responseJson["code"] = 200;
+        successContainer->responseJson["data"]["AssignedEventIds"].append("event1");
+        successContainer->ProcessResponseJson();
+        eventsApi.OnWriteEventsResult(200, "", successContainer);
+        if (assignedEventId != "event1")
+        {
+            testContext.Fail("OnWriteEventsResult did not deliver the decoded result");
+            return;
+        }
+
+        // ValidateResult reports a failed call to the error callback of the container
+        PlayFab::CallRequestContainer errorContainer(
+            "/Event/WriteEvents",
+            PlayFab::PlayFabRequestHeaders(),
+            "{}",
+            nullptr,
+            PlayFab::PlayFabSettings::staticSettings,
+            nullptr,
+            nullptr);
+        int errorCount = 0;
+        errorContainer.errorCallback = [&errorCount](const PlayFab::PlayFabError&, void*) { ++errorCount; };
+        errorContainer.responseJson["code"] = 400;
+        errorContainer.responseJson["status"] = "BadRequest";
+        errorContainer.ProcessResponseJson();
+        PlayFab::EventsModels::WriteEventsResponse errorResult;
+        if (eventsApi.ValidateResult(errorResult, errorContainer) || errorCount != 1)
+        {
+            testContext.Fail("ValidateResult did not report the failed call");
+            return;
+        }
+#endif // !defined(DISABLE_PLAYFABENTITY_API)
+
+        testContext.Pass();
+    }
+
+    void PlayFabCallRequestTest::AddTests()
+    {
+        AddTest("TestRequestContainerNoCopy", &PlayFabCallRequestTest::TestRequestContainerNoCopy);
+        AddTest("TestRequestHeaders", &PlayFabCallRequestTest::TestRequestHeaders);
+        AddTest("TestRequestContainerMemory", &PlayFabCallRequestTest::TestRequestContainerMemory);
+        AddTest("TestErrorResponseDecoding", &PlayFabCallRequestTest::TestErrorResponseDecoding);
+        AddTest("TestLazyResult", &PlayFabCallRequestTest::TestLazyResult);
+        AddTest("TestInstanceResultHandlers", &PlayFabCallRequestTest::TestInstanceResultHandlers);
+    }
+
+    void PlayFabCallRequestTest::Tick(TestContext& /*testContext*/)
+    {
+    }
+}
@@ -0,0 +1,25 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#pragma once
+
+#include "TestCase.h"
+
+namespace PlayFabUnit
+{
+    class PlayFabCallRequestTest : public TestCase
+    {
+    private:
+        void TestRequestContainerNoCopy(TestContext& testContext);
+        void TestRequestHeaders(TestContext& testContext);
+        void TestRequestContainerMemory(TestContext& testContext);
+        void TestErrorResponseDecoding(TestContext& testContext);
+        void TestLazyResult(TestContext& testContext);
+        void TestInstanceResultHandlers(TestContext& testContext);
+
+    protected:
+        void AddTests() override;
+
+    public:
+        void Tick(TestContext& testContext) override;
+    };
+}
@@ -0,0 +1,975 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include "TestAppPch.h"
+
+#include <playfab/PlayFabAuthenticationContext.h>
+#include <playfab/PlayFabEventBatchController.h>
+#include <playfab/PlayFabEventBuffer.h>
+#include <playfab/PlayFabEventPipeline.h>
+#include <playfab/PlayFabEventSpool.h>
+#include <playfab/PlayFabJsonUtils.h>
+#include <playfab/PlayFabPluginManager.h>
+#include "TestContext.h"
+#include "PlayFabEventPipelineTest.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <algorithm>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <set>
+#include <thread>
+
+namespace PlayFabUnit
+{
+#if !defined(DISABLE_PLAYFABENTITY_API)
+    // An event pipeline which records its batches instead of sending them
+    class RecordingEventPipeline : public PlayFab::PlayFabEventPipeline
+    {
+    public:
+        using PlayFab::PlayFabEventPipeline::PlayFabEventPipeline;
+
+        ~RecordingEventPipeline() override
+        {
+            Stop(); // before this class is destroyed, as the worker thread calls SendBatch
+        }
+
+        // Waits for the next batch and returns the time it was sent and its size, or a size of 0 on a timeout
+        std::pair<std::chrono::steady_clock::time_point, size_t> WaitForBatch(std::chrono::milliseconds timeout)
+        {
+            std::unique_lock<std::mutex> lock(batchesMutex);
+            if (!batchSent.wait_for(lock, timeout, [this]() { return !batches.empty(); }))
+            {
+                return { std::chrono::steady_clock::now(), 0 };
+            }
+            auto batch = batches.front();
+            batches.erase(batches.begin());
+            return batch;
+        }
+
+    protected:
+        void SendBatch(std::vector<std::shared_ptr<const PlayFab::IPlayFabEmitEventRequest>>& batch) override
+        {
+            {
+                std::unique_lock<std::mutex> lock(batchesMutex);
+                batches.emplace_back(std::chrono::steady_clock::now(), batch.size());
+            }
+            batch.clear();
+            batchSent.notify_one();
+        }
+
+    private:
+        std::mutex batchesMutex;
+        std::condition_variable batchSent;
+        std::vector<std::pair<std::chrono::steady_clock::time_point, size_t>> batches;
+    };
+
+    // Answers WriteTelemetryEvents calls with scripted HTTP codes (200 once the script runs out), and passes other calls on to the transport it replaces
+    class ScriptedEventsHttpPlugin : public PlayFab::IPlayFabHttpPlugin
+    {
+    public:
+        ScriptedEventsHttpPlugin(const std::shared_ptr<PlayFab::IPlayFabHttpPlugin>& transport, std::vector<int> httpCodes) :
+            transport(transport), httpCodes(std::move(httpCodes)), requestCount(0)
+        {
+        }
+
+        void MakePostRequest(std::unique_ptr<PlayFab::CallRequestContainerBase> requestContainer) override
+        {
+            if (requestContainer->GetUrl().find("WriteTelemetryEvents") == std::string::npos)
+            {
+                transport->MakePostRequest(std::move(requestContainer));
+                return;
+            }
+
+            int httpCode = 200;
+            {
+                std::unique_lock<std::mutex> lock(scriptMutex);
+                if (!httpCodes.empty())
+                {
+                    httpCode = httpCodes.front();
+                    httpCodes.erase(httpCodes.begin());
+                }
+                ++requestCount;
+                requestBodies.push_back(requestContainer->GetRequestBody());
+            }
+
+            auto& container = static_cast<PlayFab::CallRequestContainer&>(*requestContainer);
+            const int errorCode = (httpCode == 503) ? static_cast<int>(PlayFab::PlayFabErrorCode::PlayFabErrorServiceUnavailable) :
+                static_cast<int>(PlayFab::PlayFabErrorCode::PlayFabErrorInvalidParams);
+            container.responseString = (httpCode == 200) ? std::string("{\"code\":200,\"status\":\"OK\",\"data\":{\"AssignedEventIds\":[]}}") :
+                "{\"code\":" + std::to_string(httpCode) + ",\"status\":\"Error\",\"error\":\"Error\",\"errorCode\":" + std::to_string(errorCode) + ",\"errorMessage\":\"Scripted error\"}";
+            std::string errors;
+            PlayFab::PlayFabJsonUtils::ParseFromString(container.responseString, container.responseJson, errors);
+            const std::string responseString = container.responseString;
+            container.ProcessResponseJson();
+            auto callback = container.GetCallback();
+            callback(httpCode, responseString, std::move(requestContainer));
+        }
+
+        size_t Update() override
+        {
+            return 0;
+        }
+
+        size_t GetRequestCount()
+        {
+            std::unique_lock<std::mutex> lock(scriptMutex);
+            return requestCount;
+        }
+
+        std::vector<std::string> GetRequestBodies()
+        {
+            std::unique_lock<std::mutex> lock(scriptMutex);
+            return requestBodies;
+        }
+
+    private:
+        std::shared_ptr<PlayFab::IPlayFabHttpPlugin> transport;
+        std::mutex scriptMutex;
+        std::vector<int> httpCodes;
+        size_t requestCount;
+        std::vector<std::string> requestBodies;
+    };
+
+    struct BatchingSimulationResult
+    {
+        uint64_t eventsOverflowed = 0;
+        uint64_t batchesSent = 0;
+        double lightLoadLatencyMs = 0; // The mean time from emitting to delivering the events of the light load phase
+        double moderateLoadLatencyMs = 0; // The same for the moderate load phase
+        double recoveryLatencyMs = 0; // The same for the light load from 1 s after the spike
+    };
+
+    // A deterministic model of the worker thread of PlayFabEventPipeline and of a transport, in steps of 1 ms of simulated time,
+    // to compare batching decisions. The load is 50 events/s for 4 s, 1 event/ms for 4 s, spikeEventsPerMs for 1.5 s, and 50 events/s
+    // again for 5.5 s. The buffer holds 64 events, and the transport serves 4 requests at a time, taking 30 ms plus 0.5 ms per event for each.
+    BatchingSimulationResult SimulateBatching(const PlayFab::PlayFabEventPipelineSettings& settings, size_t spikeEventsPerMs)
+    {
+        using namespace PlayFab;
+        constexpr int64_t lightLoadEnd = 4000;
+        constexpr int64_t moderateLoadEnd = 8000;
+        constexpr int64_t spikeEnd = 9500;
+        constexpr int64_t recoveryStart = spikeEnd + 1000;
+        constexpr int64_t loadEnd = 15000;
+        constexpr int64_t simulationEnd = 20000;
+        constexpr size_t bufferCapacity = 64;
+
+        BatchingSimulationResult result;
+        PlayFabEventBatchController controller;
+        std::deque<int64_t> buffer; // The emit times of the buffered events
+        std::vector<int64_t> batch;
+        int64_t batchStarted = 0;
+        std::vector<int64_t> serverAvailable(4, 0);
+        std::multiset<std::pair<int64_t, int64_t>> batchesInFlight; // Their completion and send times
+        uint64_t lightLoadEvents = 0, moderateLoadEvents = 0, recoveryEvents = 0;
+
+        for (int64_t now = 0; now < simulationEnd; ++now)
+        {
+            while (!batchesInFlight.empty() && batchesInFlight.begin()->first <= now)
+            {
+                controller.OnBatchCompleted(std::chrono::milliseconds(now - batchesInFlight.begin()->second));
+                batchesInFlight.erase(batchesInFlight.begin());
+            }
+
+            size_t eventCount = 0;
+            if (now < lightLoadEnd || (now >= spikeEnd && now < loadEnd))
+            {
+                eventCount = (now % 20 == 0) ? 1 : 0;
+            }
+            else if (now < moderateLoadEnd)
+            {
+                eventCount = 1;
+            }
+            else if (now < spikeEnd)
+            {
+                eventCount = spikeEventsPerMs;
+            }
+            for (size_t i = 0; i < eventCount; ++i)
+            {
+                if (buffer.size() < bufferCapacity)
+                {
+                    buffer.push_back(now);
+                }
+                else
+                {
+                    ++result.eventsOverflowed;
+                }
+            }
+
+            auto sendBatch = [&]()
+            {
+                auto server = std::min_element(serverAvailable.begin(), serverAvailable.end());
+                *server = std::max(*server, now) + 30 + static_cast<int64_t>(batch.size()) / 2;
+                for (int64_t emitted : batch)
+                {
+                    const double latency = static_cast<double>(*server - emitted);
+                    if (emitted < lightLoadEnd)
+                    {
+                        result.lightLoadLatencyMs += latency;
+                        ++lightLoadEvents;
+                    }
+                    else if (emitted < moderateLoadEnd)
+                    {
+                        result.moderateLoadLatencyMs += latency;
+                        ++moderateLoadEvents;
+                    }
+                    else if (emitted >= recoveryStart)
+                    {
+                        result.recoveryLatencyMs += latency;
+                        ++recoveryEvents;
+                    }
+                }
+                batchesInFlight.emplace(*server, now);
+                controller.OnBatchSent(batch.size());
+                ++result.batchesSent;
+                batch.clear();
+            };
+
+            // like the worker thread, take events only while a batch may be sent out
+            while (!buffer.empty() && batchesInFlight.size() < settings.maximalNumberOfBatchesInFlight)
+            {
+                batch.push_back(buffer.front());
+                buffer.pop_front();
+                if (batch.size() == 1)
+                {
+                    batchStarted = now;
+                    controller.OnBatchStarted(settings, batchesInFlight.size(), static_cast<double>(buffer.size() + 1) / bufferCapacity);
+                }
+                if (batch.size() >= controller.GetBatchItemLimit(settings))
+                {
+                    sendBatch();
+                }
+            }
+            if (!batch.empty() && batchesInFlight.size() < settings.maximalNumberOfBatchesInFlight &&
+                now - batchStarted >= controller.GetBatchWaitTime(settings).count())
+            {
+                sendBatch();
+            }
+        }
+
+        result.lightLoadLatencyMs /= std::max<uint64_t>(1, lightLoadEvents);
+        result.moderateLoadLatencyMs /= std::max<uint64_t>(1, moderateLoadEvents);
+        result.recoveryLatencyMs /= std::max<uint64_t>(1, recoveryEvents);
+        return result;
+    }
+#endif // !defined(DISABLE_PLAYFABENTITY_API)
+
+    void PlayFabEventPipelineTest::TestEventBufferProducers(TestContext& testContext)
+    {
+#if !defined(DISABLE_PLAYFABENTITY_API)
+        using namespace PlayFab;
+        using Produced = PlayFabEventBuffer::EventProducingResult;
+        using Consumed = PlayFabEventBuffer::EventConsumingResult;
+
+        for (bool useProducerStaging : { false, true })
+        {
+            std::shared_ptr<const IPlayFabEmitEventRequest> taken;
+
+            // The minimal buffer holds at least as many events as fit in one page, in a slot each
+            PlayFabEventBuffer fullBuffer(0, useProducerStaging);
+            auto request = std::make_shared<PlayFabEmitEventRequest>();
+            size_t capacity = 0;
+            while (fullBuffer.TryPut(request) == Produced::Success)
+            {
+                ++capacity;
+            }
+            size_t drained = 0;
+            while (fullBuffer.TryTake(taken) == Consumed::Success && taken == request)
+            {
+                ++drained;
+            }
+            if (capacity != fullBuffer.GetCapacity() || capacity < 4096 / sizeof(PlayFabEventPacket) || drained != capacity || fullBuffer.TryPut(request) != Produced::Success)
+            {
+                testContext.Fail("The event buffer did not hold exactly one event per slot");
+                return;
+            }
+
+            // Every event of concurrent producers is taken exactly once, in the order of each producer
+            const size_t producerCount = 4;
+            const size_t eventsPerProducer = 2000;
+            std::vector<std::vector<std::shared_ptr<const IPlayFabEmitEventRequest>>> produced(producerCount);
+            for (auto& events : produced)
+            {
+                for (size_t i = 0; i < eventsPerProducer; ++i)
+                {
+                    events.push_back(std::make_shared<PlayFabEmitEventRequest>());
+                }
+            }
+
+            PlayFabEventBuffer buffer(0, useProducerStaging);
+            std::vector<std::thread> producers;
+            for (const auto& events : produced)
+            {
+                producers.emplace_back([&buffer, &events]()
+                {
+                    for (const auto& event : events)
+                    {
+                        while (buffer.TryPut(event) != Produced::Success)
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+            }
+
+            std::vector<size_t> nextEvent(producerCount, 0);
+            bool inOrder = true;
+            for (size_t takenCount = 0; takenCount < producerCount * eventsPerProducer && inOrder;)
+            {
+                if (buffer.TryTake(taken) != Consumed::Success)
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+                ++takenCount;
+
+                inOrder = false;
+                for (size_t producer = 0; producer < producerCount; ++producer)
+                {
+                    if (nextEvent[producer] < eventsPerProducer && produced[producer][nextEvent[producer]] == taken)
+                    {
+                        ++nextEvent[producer];
+                        inOrder = true;
+                        break;
+                    }
+                }
+            }
+
+            for (auto& producer : producers)
+            {
+                producer.join();
+            }
+            if (!inOrder || buffer.TryTake(taken) != Consumed::Empty)
+            {
+                testContext.Fail("The events of concurrent producers were not taken exactly once and in order");
+                return;
+            }
+        }
+#endif // !defined(DISABLE_PLAYFABENTITY_API)
+
+        testContext.Pass();
+    }
+
+    void PlayFabEventPipelineTest::TestEventPipelineFlushDeadline(TestContext& testContext)
+    {
+#if !defined(DISABLE_PLAYFABENTITY_API)
+        using namespace PlayFab;
+        using clock = std::chrono::steady_clock;
+
+        auto settings = std::make_shared<PlayFabEventPipelineSettings>(PlayFabEventPipelineType::PlayFabTelemetry, true);
+        settings->authenticationContext = std::make_shared<PlayFabAuthenticationContext>();
+        settings->authenticationContext->entityToken = "entityToken";
+        settings->maximalNumberOfItemsInBatch = 2;
+        settings->maximalBatchWaitTimeMs = std::chrono::milliseconds(200);
+        settings->readBufferWaitTime = 60000; // The worker thread must not depend on polling
+        RecordingEventPipeline pipeline(settings);
+
+        // A full batch is sent as soon as its events arrive
+        auto fullBatchStart = clock::now();
+        pipeline.IntakeEvent(std::make_shared<PlayFabEmitEventRequest>());
+        pipeline.IntakeEvent(std::make_shared<PlayFabEmitEventRequest>());
+        auto fullBatch = pipeline.WaitForBatch(std::chrono::seconds(5));
+        if (fullBatch.second != 2 || fullBatch.first - fullBatchStart >= settings->maximalBatchWaitTimeMs)
+        {
+            testContext.Fail("The worker thread was not woken up by the events of a full batch");
+            return;
+        }
+
+        // An incomplete batch is sent at its deadline, which has millisecond resolution
+        auto incompleteBatchStart = clock::now();
+        pipeline.IntakeEvent(std::make_shared<PlayFabEmitEventRequest>());
+        auto incompleteBatch = pipeline.WaitForBatch(std::chrono::seconds(5));
+        if (incompleteBatch.second != 1 || incompleteBatch.first - incompleteBatchStart < settings->maximalBatchWaitTimeMs ||
+            incompleteBatch.first - incompleteBatchStart >= std::chrono::seconds(1))
+        {
+            testContext.Fail("The incomplete batch was not sent at its deadline");
+            return;
+        }
+#endif // !defined(DISABLE_PLAYFABENTITY_API)
+
+        testContext.Pass();
+    }
+
+    void PlayFabEventPipelineTest::TestEventPipelineBatchSize(TestContext& testContext)
+    {
+#if !defined(DISABLE_PLAYFABENTITY_API)
+        using namespace PlayFab;
+
+        // The estimated size of an event is close to the size of its json in a WriteEvents request
+        PlayFabEvent event;
+        event.SetName("event_name");
+        event.SetProperty("count", 12345);
+        event.SetProperty("label", std::string("some label"));
+        EventsModels::EventContents contents;
+        contents.EventNamespace = "com.playfab.events.default";
+        contents.Name = "event_name";
+        contents.Payload["count"] = 12345;
+        contents.Payload["label"] = "some label";
+        const size_t serializedSize = PlayFabJsonUtils::WriteToString(contents.ToJson()).length();
+        if (event.GetEstimatedSize() * 10 < serializedSize * 9 || event.GetEstimatedSize() * 10 > serializedSize * 11)
+        {
+            testContext.Fail("The estimated size of an event is off by more than 10%");
+            return;
+        }
+
+        // Batches are cut by the estimated size of their events
+        auto settings = std::make_shared<PlayFabEventPipelineSettings>(PlayFabEventPipelineType::PlayFabTelemetry, true);
+        settings->authenticationContext = std::make_shared<PlayFabAuthenticationContext>();
+        settings->authenticationContext->entityToken = "entityToken";
+        settings->maximalBatchSizeInBytes = 250;
+        settings->maximalBatchWaitTime = 60;
+        RecordingEventPipeline pipeline(settings);
+
+        auto makeRequest = [](size_t estimatedSize)
+        {
+            auto request = std::make_shared<PlayFabEmitEventRequest>();
+            request->estimatedSize = estimatedSize;
+            return request;
+        };
+        for (size_t i = 0; i < 5; ++i)
+        {
+            pipeline.IntakeEvent(makeRequest(100));
+        }
+        pipeline.IntakeEvent(makeRequest(1000)); // larger than a batch on its own
+
+        const size_t expectedBatchSizes[] = { 2, 2, 1, 1 };
+        for (size_t expectedBatchSize : expectedBatchSizes)
+        {
+            if (pipeline.WaitForBatch(std::chrono::seconds(5)).second != expectedBatchSize)
+            {
+                testContext.Fail("The batches were not cut by the estimated size of their events");
+                return;
+            }
+        }
+#endif // !defined(DISABLE_PLAYFABENTITY_API)
+
+        testContext.Pass();
+    }
+
+    void PlayFabEventPipelineTest::TestEventBatchController(TestContext& testContext)
+    {
+#if !defined(DISABLE_PLAYFABENTITY_API)
+        using namespace PlayFab;
+
+        PlayFabEventPipelineSettings settings;
+        settings.maximalNumberOfItemsInBatch = 160;
+        settings.maximalBatchWaitTimeMs = std::chrono::milliseconds(1700);
+        settings.minimalBatchWaitTime = std::chrono::milliseconds(100);
+        settings.maximalNumberOfBatchesInFlight = 8;
+
+        // Static batching uses the limits of the settings whatever the load
+        PlayFabEventBatchController staticController;
+        staticController.OnBatchStarted(settings, 0, 0.0);
+        if (staticController.GetBatchItemLimit(settings) != 160 || staticController.GetBatchWaitTime(settings) != std::chrono::milliseconds(1700))
+        {
+            testContext.Fail("Static batching did not use the limits of the settings");
+            return;
+        }
+
+        // The wait time in seconds applies unless one in milliseconds is set
+        PlayFabEventPipelineSettings secondsSettings;
+        secondsSettings.maximalBatchWaitTime = 2;
+        if (staticController.GetBatchWaitTime(secondsSettings) != std::chrono::seconds(2))
+        {
+            testContext.Fail("Static batching did not use the wait time in seconds");
+            return;
+        }
+
+        // Adaptive batching starts with the minimal limits, which light load keeps
+        settings.useAdaptiveBatching = true;
+        PlayFabEventBatchController controller;
+        controller.OnBatchStarted(settings, 0, 0.0);
+        if (controller.GetBatchItemLimit(settings) != 10 || controller.GetBatchWaitTime(settings) != std::chrono::milliseconds(100))
+        {
+            testContext.Fail("Adaptive batching did not start with the minimal limits");
+            return;
+        }
+        for (int i = 0; i < 20; ++i)
+        {
+            controller.OnBatchStarted(settings, 1, 0.1);
+        }
+        if (controller.GetBatchItemLimit(settings) != 10 || controller.GetBatchWaitTime(settings) != std::chrono::milliseconds(100))
+        {
+            testContext.Fail("Light load changed the batch limits");
+            return;
+        }
+
+        // Moderate load keeps the limits, congestion doubles both up to the maximal ones
+        controller.OnBatchStarted(settings, 3, 0.1);
+        controller.OnBatchStarted(settings, 4, 0.0);
+        controller.OnBatchStarted(settings, 5, 0.0);
+        if (controller.GetBatchItemLimit(settings) != 40 || controller.GetBatchWaitTime(settings) != std::chrono::milliseconds(400))
+        {
+            testContext.Fail("Congestion did not double the batch limits");
+            return;
+        }
+        for (int i = 0; i < 10; ++i)
+        {
+            controller.OnBatchStarted(settings, 8, 1.0);
+        }
+        if (controller.GetBatchItemLimit(settings) != 160 || controller.GetBatchWaitTime(settings) != std::chrono::milliseconds(1700))
+        {
+            testContext.Fail("Congestion raised the batch limits beyond the settings");
+            return;
+        }
+
+        // Light load lowers the number of events per batch by one step and halves the wait time
+        controller.OnBatchStarted(settings, 0, 0.0);
+        if (controller.GetBatchItemLimit(settings) != 151 || controller.GetBatchWaitTime(settings) != std::chrono::milliseconds(850))
+        {
+            testContext.Fail("Light load did not lower the batch limits");
+            return;
+        }
+
+        // Events backing up in the buffer are taken in full batches
+        controller.OnBatchStarted(settings, 0, 0.0);
+        controller.OnBatchStarted(settings, 3, 0.3);
+        if (controller.GetBatchItemLimit(settings) != 160 || controller.GetBatchWaitTime(settings) != std::chrono::milliseconds(425))
+        {
+            testContext.Fail("Events backing up in the buffer did not raise the number of events per batch");
+            return;
+        }
+
+        // An inflated send latency counts as congestion while batches pile up, and not once they are out of flight
+        PlayFabEventBatchController latencyController;
+        latencyController.OnBatchCompleted(std::chrono::milliseconds(50));
+        latencyController.OnBatchStarted(settings, 0, 0.0);
+        for (int i = 0; i < 40; ++i)
+        {
+            latencyController.OnBatchCompleted(std::chrono::milliseconds(500));
+        }
+        latencyController.OnBatchStarted(settings, 3, 0.0);
+        latencyController.OnBatchSent(3);
+        latencyController.OnEventOverflowed();
+        PlayFabEventPipelineStats stats = latencyController.GetStats(settings);
+        if (stats.batchItemLimit != 20 || stats.batchWaitTime != std::chrono::milliseconds(200) || stats.sendLatency < std::chrono::milliseconds(400) ||
+            stats.batchesSent != 1 || stats.eventsSent != 3 || stats.eventsOverflowed != 1)
+        {
+            testContext.Fail("The stats did not report an inflated send latency and its decisions");
+            return;
+        }
+        latencyController.OnBatchStarted(settings, 0, 0.0);
+        if (latencyController.GetBatchWaitTime(settings) != std::chrono::milliseconds(100))
+        {
+            testContext.Fail("An inflated send latency held back light load");
+            return;
+        }
+
+        // The smoothed send latency follows small changes, which whole milliseconds would truncate away
+        PlayFabEventBatchController smoothingController;
+        smoothingController.OnBatchCompleted(std::chrono::milliseconds(50));
+        for (int i = 0; i < 40; ++i)
+        {
+            smoothingController.OnBatchCompleted(std::chrono::milliseconds(57));
+        }
+        if (smoothingController.GetStats(settings).sendLatency != std::chrono::milliseconds(56))
+        {
+            testContext.Fail("The smoothed send latency did not follow a small change");
+            return;
+        }
+#endif // !defined(DISABLE_PLAYFABENTITY_API)
+
+        testContext.Pass();
+    }
+
+    void PlayFabEventPipelineTest::TestEventBatchingSimulation(TestContext& testContext)
+    {
+        std::string summary;
+#if !defined(DISABLE_PLAYFABENTITY_API)
+        using namespace PlayFab;
+
+        // Adaptive batching must deliver light and moderate load sooner than the static defaults, also once a spike is over, without
+        // overflowing more events in the spike, whether the spike fits the capacity of the transport (5 events/ms) or exceeds it (20 events/ms)
+        for (size_t spikeEventsPerMs : { 5, 20 })
+        {
+            PlayFabEventPipelineSettings staticSettings;
+            PlayFabEventPipelineSettings adaptiveSettings;
+            adaptiveSettings.useAdaptiveBatching = true;
+            const BatchingSimulationResult staticResult = SimulateBatching(staticSettings, spikeEventsPerMs);
+            const BatchingSimulationResult adaptiveResult = SimulateBatching(adaptiveSettings, spikeEventsPerMs);
+
+            summary += std::string(summary.empty() ? "" : " ") + "Spike of " + std::to_string(spikeEventsPerMs) + "/ms: overflowed " + std::to_string(staticResult.eventsOverflowed) + " static, " +
+                std::to_string(adaptiveResult.eventsOverflowed) + " adaptive; latency static/adaptive " +
+                std::to_string(static_cast<int>(staticResult.lightLoadLatencyMs)) + "/" + std::to_string(static_cast<int>(adaptiveResult.lightLoadLatencyMs)) + " ms light, " +
+                std::to_string(static_cast<int>(staticResult.moderateLoadLatencyMs)) + "/" + std::to_string(static_cast<int>(adaptiveResult.moderateLoadLatencyMs)) + " ms moderate, " +
+                std::to_string(static_cast<int>(staticResult.recoveryLatencyMs)) + "/" + std::to_string(static_cast<int>(adaptiveResult.recoveryLatencyMs)) + " ms after the spike.";
+            if (adaptiveResult.eventsOverflowed > staticResult.eventsOverflowed || adaptiveResult.lightLoadLatencyMs * 4 > staticResult.lightLoadLatencyMs ||
+                adaptiveResult.moderateLoadLatencyMs * 4 > staticResult.moderateLoadLatencyMs || adaptiveResult.recoveryLatencyMs * 2 > staticResult.recoveryLatencyMs)
+            {
+                testContext.Fail("Adaptive batching did not beat the static defaults. " + summary);
+                return;
+            }
+        }
+
+#endif // !defined(DISABLE_PLAYFABENTITY_API)
+
+        testContext.Pass(summary);
+    }
+
+    void PlayFabEventPipelineTest::TestEventPipelineRetries(TestContext& testContext)
+    {
+#if !defined(DISABLE_PLAYFABENTITY_API)
+        using namespace PlayFab;
+
+        // Event 1 is delivered on its second retry, event 2 gets an error which is not transient, and event 3 runs out of retries
+        auto transport = PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
+        auto scriptedTransport = std::make_shared<ScriptedEventsHttpPlugin>(transport, std::vector<int>{ 503, 503, 200, 400, 503, 503, 503 });
+        PlayFabPluginManager::SetPlugin(scriptedTransport, PlayFabPluginContract::PlayFab_Transport);
+
+        std::mutex outcomesMutex;
+        std::condition_variable outcomeReported;
+        std::vector<std::shared_ptr<const PlayFabEmitEventResponse>> outcomes;
+        {
+            auto settings = std::make_shared<PlayFabEventPipelineSettings>(PlayFabEventPipelineType::PlayFabTelemetry, true);
+            settings->authenticationContext = std::make_shared<PlayFabAuthenticationContext>();
+            settings->authenticationContext->entityToken = "entityToken";
+            settings->maximalNumberOfItemsInBatch = 1;
+            settings->maximalNumberOfRetries = 2;
+            settings->retryWaitTime = std::chrono::milliseconds(10);
+            PlayFabEventPipeline pipeline(settings);
+
+            for (size_t i = 0; i < 3; ++i)
+            {
+                auto request = std::make_shared<PlayFabEmitEventRequest>();
+                auto event = std::make_shared<PlayFabEvent>();
+                event->SetName("retried_event");
+                request->event = event;
+                request->stdCallback = [&](std::shared_ptr<const IPlayFabEvent>, std::shared_ptr<const IPlayFabEmitEventResponse> response)
+                {
+                    std::unique_lock<std::mutex> lock(outcomesMutex);
+                    outcomes.push_back(std::static_pointer_cast<const PlayFabEmitEventResponse>(response));
+                    outcomeReported.notify_one();
+                };
+                pipeline.IntakeEvent(request);
+
+                std::unique_lock<std::mutex> lock(outcomesMutex);
+                outcomeReported.wait_for(lock, std::chrono::seconds(5), [&]() { return outcomes.size() > i; });
+            }
+        }
+        PlayFabPluginManager::SetPlugin(transport, PlayFabPluginContract::PlayFab_Transport);
+
+        if (outcomes.size() != 3 || scriptedTransport->GetRequestCount() != 7)
+        {
+            testContext.Fail("The batches were not retried as expected");
+            return;
+        }
+        if (outcomes[0]->emitEventResult != EmitEventResult::Success || outcomes[0]->retryCount != 2 ||
+            outcomes[1]->emitEventResult != EmitEventResult::Failed || outcomes[1]->retryCount != 0 || outcomes[1]->playFabError->HttpCode != 400 ||
+            outcomes[2]->emitEventResult != EmitEventResult::Failed || outcomes[2]->retryCount != 2 || outcomes[2]->playFabError->HttpCode != 503)
+        {
+            testContext.Fail("The outcomes of the events were not reported accurately");
+            return;
+        }
+#endif // !defined(DISABLE_PLAYFABENTITY_API)
+
+        testContext.Pass();
+    }
+
+    void PlayFabEventPipelineTest::TestEventPipelineBatchCallback(TestContext& testContext)
+    {
+#if !defined(DISABLE_PLAYFABENTITY_API)
+        using namespace PlayFab;
+
+        // The first batch is delivered and the second one gets an error which is not transient
+        auto transport = PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
+        auto scriptedTransport = std::make_shared<ScriptedEventsHttpPlugin>(transport, std::vector<int>{ 200, 400 });
+        PlayFabPluginManager::SetPlugin(scriptedTransport, PlayFabPluginContract::PlayFab_Transport);
+
+        std::mutex outcomesMutex;
+        std::condition_variable outcomeReported;
+        std::vector<std::pair<size_t, std::shared_ptr<const PlayFabEmitEventResponse>>> batchOutcomes;
+        std::vector<std::shared_ptr<const IPlayFabEmitEventResponse>> eventOutcomes;
+        {
+            auto settings = std::make_shared<PlayFabEventPipelineSettings>(PlayFabEventPipelineType::PlayFabTelemetry, true);
+            settings->authenticationContext = std::make_shared<PlayFabAuthenticationContext>();
+            settings->authenticationContext->entityToken = "entityToken";
+            settings->maximalNumberOfItemsInBatch = 2;
+            settings->emitBatchCallback = [&](const std::vector<std::shared_ptr<const IPlayFabEmitEventRequest>>& batch, std::shared_ptr<const PlayFabEmitEventResponse> response)
+            {
+                std::unique_lock<std::mutex> lock(outcomesMutex);
+                batchOutcomes.emplace_back(batch.size(), std::move(response));
+                outcomeReported.notify_one();
+            };
+            PlayFabEventPipeline pipeline(settings);
+
+            // Only the first event of each batch has an emit event callback
+            for (int i = 0; i < 4; ++i)
+            {
+                auto request = std::make_shared<PlayFabEmitEventRequest>();
+                auto event = std::make_shared<PlayFabEvent>();
+                event->SetName("batched_event");
+                request->event = event;
+                if (i % 2 == 0)
+                {
+                    request->stdCallback = [&](std::shared_ptr<const IPlayFabEvent>, std::shared_ptr<const IPlayFabEmitEventResponse> response)
+                    {
+                        std::unique_lock<std::mutex> lock(outcomesMutex);
+                        eventOutcomes.push_back(std::move(response));
+                    };
+                }
+                pipeline.IntakeEvent(request);
+
+                if (i % 2 == 1)
+                {
+                    std::unique_lock<std::mutex> lock(outcomesMutex);
+                    outcomeReported.wait_for(lock, std::chrono::seconds(5), [&]() { return batchOutcomes.size() > static_cast<size_t>(i / 2); });
+                }
+            }
+        }
+        PlayFabPluginManager::SetPlugin(transport, PlayFabPluginContract::PlayFab_Transport);
+
+        if (batchOutcomes.size() != 2 || eventOutcomes.size() != 2 || batchOutcomes[0].first != 2 || batchOutcomes[1].first != 2)
+        {
+            testContext.Fail("The batches were not called back once each");
+            return;
+        }
+        if (batchOutcomes[0].second->emitEventResult != EmitEventResult::Success || batchOutcomes[0].second->writeEventsResponse == nullptr ||
+            batchOutcomes[1].second->emitEventResult != EmitEventResult::Failed || batchOutcomes[1].second->playFabError->HttpCode != 400)
+        {
+            testContext.Fail("The outcomes of the batches were not reported accurately");
+            return;
+        }
+        if (eventOutcomes[0] != batchOutcomes[0].second || eventOutcomes[1] != batchOutcomes[1].second)
+        {
+            testContext.Fail("The events did not share the response to their batch");
+            return;
+        }
+#endif // !defined(DISABLE_PLAYFABENTITY_API)
+
+        testContext.Pass();
+    }
+
+    void PlayFabEventPipelineTest::TestEventPipelinePreSerializedEvents(TestContext& testContext)
+    {
+#if !defined(DISABLE_PLAYFABENTITY_API)
+        using namespace PlayFab;
+
+        auto transport = PlayFabPluginManager::GetPlugin<IPlayFabHttpPlugin>(PlayFabPluginContract::PlayFab_Transport);
+        auto scriptedTransport = std::make_shared<ScriptedEventsHttpPlugin>(transport, std::vector<int>{});
+        PlayFabPluginManager::SetPlugin(scriptedTransport, PlayFabPluginContract::PlayFab_Transport);
+
+        // Events encoded when emitted are spliced into the batch as they are, next to events the pipeline encodes itself
+        std::vector<std::shared_ptr<PlayFabEvent>> events;
+        std::mutex outcomesMutex;
+        std::condition_variable outcomeReported;
+        size_t deliveredCount = 0;
+        {
+            auto settings = std::make_shared<PlayFabEventPipelineSettings>(PlayFabEventPipelineType::PlayFabTelemetry, true);
+            settings->authenticationContext = std::make_shared<PlayFabAuthenticationContext>();
+            settings->authenticationContext->entityToken = "entityToken";
+            settings->maximalNumberOfItemsInBatch = 4;
+            PlayFabEventPipeline pipeline(settings);
+
+            // a request of another IPlayFabEmitEventRequest implementation has nothing to serialize and is left out of the batch body
+            struct ForeignEmitEventRequest : public IPlayFabEmitEventRequest
+            {
+            };
+            pipeline.IntakeEvent(std::make_shared<ForeignEmitEventRequest>());
+
+            for (int i = 0; i < 3; ++i)
+            {
+                auto event = std::make_shared<PlayFabEvent>();
+                event->SetName("spliced_event");
+                event->SetProperty("index", i);
+                event->SetProperty("text", std::string("\"quoted\"\n"));
+                events.push_back(event);
+
+                auto request = std::make_shared<PlayFabEmitEventRequest>();
+                request->event = event;
+                if (i != 1)
+                {
+                    request->serializedEvent = event->Serialize();
+                }
+                request->stdCallback = [&](std::shared_ptr<const IPlayFabEvent>, std::shared_ptr<const IPlayFabEmitEventResponse> response)
+                {
+                    std::unique_lock<std::mutex> lock(outcomesMutex);
+                    if (std::static_pointer_cast<const PlayFabEmitEventResponse>(response)->emitEventResult == EmitEventResult::Success)
+                    {
+                        ++deliveredCount;
+                    }
+                    outcomeReported.notify_one();
+                };
+                pipeline.IntakeEvent(request);
+            }
+
+            std::unique_lock<std::mutex> lock(outcomesMutex);
+            outcomeReported.wait_for(lock, std::chrono::seconds(5), [&]() { return deliveredCount == 3; });
+        }
+        PlayFabPluginManager::SetPlugin(transport, PlayFabPluginContract::PlayFab_Transport);
+
+        const std::vector<std::string> requestBodies = scriptedTransport->GetRequestBodies();
+        Json::Value body;
+        std::string errors;
+        if (deliveredCount != 3 || requestBodies.size() != 1 || !PlayFabJsonUtils::ParseFromString(requestBodies[0], body, errors) ||
+            !body["Events"].isArray() || body["Events"].size() != 3)
+        {
+            testContext.Fail("The events were not sent in one batch");
+            return;
+        }
+
+        for (Json::ArrayIndex i = 0; i < 3; ++i)
+        {
+            Json::Value eventJson;
+            if (!PlayFabJsonUtils::ParseFromString(events[i]->Serialize(), eventJson, errors) || body["Events"][i] != eventJson)
+            {
+                testContext.Fail("The batch does not hold the events as they were serialized");
+                return;
+            }
+        }
+#endif // !defined(DISABLE_PLAYFABENTITY_API)
+
+        testContext.Pass();
+    }
+
+    void PlayFabEventPipelineTest::TestEventSpool(TestContext& testContext)
+    {
+#if !defined(DISABLE_PLAYFABENTITY_API)
+        using namespace PlayFab;
+        const std::string directory = "PlayFabEventSpoolTest";
+        constexpr size_t segmentSize = 4096;
+
+        // Release whatever an earlier test run left behind, which deletes the segment files
+        PlayFabEventSpoolRange backlog;
+        {
+            PlayFabEventSpool spool(directory, segmentSize, 3 * segmentSize, PlayFabEventSpoolSyncPolicy::None);
+            if (!spool.Open(backlog))
+            {
+                testContext.Skip("The event spool is not supported on this platform");
+                return;
+            }
+            spool.Release(backlog);
+        }
+
+        auto makeRecord = [](uint64_t position)
+        {
+            std::string record = "record " + std::to_string(position);
+            record.resize(100, '.');
+            return record;
+        };
+
+        {
+            PlayFabEventSpool spool(directory, segmentSize, 3 * segmentSize, PlayFabEventSpoolSyncPolicy::SegmentFull);
+            if (!spool.Open(backlog) || backlog.count != 0)
+            {
+                testContext.Fail("The event spool was not empty");
+                return;
+            }
+
+            // 37 records of 108 bytes fit in a segment after its 64-byte header, so the quota of 3 segments takes 111 records
+            uint64_t position = 0;
+            for (uint64_t i = 0; i < 111; ++i)
+            {
+                if (!spool.Append(makeRecord(i), position) || position != i)
+                {
+                    testContext.Fail("A record within the quota was not appended");
+                    return;
+                }
+            }
+            if (spool.Append(makeRecord(111), position))
+            {
+                testContext.Fail("A record beyond the quota was appended");
+                return;
+            }
+
+            // Releasing the records of the first segment deletes it, and frees quota
+            PlayFabEventSpoolRange released;
+            released.first = 0;
+            released.count = 40;
+            spool.Release(released);
+            if (spool.GetSizeInBytes() != 2 * segmentSize || !spool.Append(makeRecord(111), position) || position != 111)
+            {
+                testContext.Fail("Released records did not free quota");
+                return;
+            }
+
+            // Records released out of order can no longer be read
+            released.first = 50;
+            released.count = 10;
+            spool.Release(released);
+            std::string record;
+            if (spool.Read(39, record) || spool.Read(55, record) || !spool.Read(45, record) || record != makeRecord(45))
+            {
+                testContext.Fail("The records read back were not the ones expected");
+                return;
+            }
+        }
+
+        // A torn record is detected by its checksum when the spool is recovered
+        {
+            std::fstream segmentFile(directory + "/pfevents-000000000000006f.spool", std::ios::in | std::ios::out | std::ios::binary);
+            segmentFile.seekp(64 + 8 + 10);
+            segmentFile.put('#');
+        }
+
+        {
+            // The next run recovers what was not released before its released prefix, except for the torn record
+            PlayFabEventSpool spool(directory, segmentSize, 3 * segmentSize, PlayFabEventSpoolSyncPolicy::SegmentFull);
+            std::string record;
+            if (!spool.Open(backlog) || backlog.first != 40 || backlog.count != 71 ||
+                !spool.Read(55, record) || record != makeRecord(55) || spool.Read(111, record))
+            {
+                testContext.Fail("The event spool was not recovered as expected");
+                return;
+            }
+            spool.Release(backlog);
+        }
+
+        // The pipeline spools events as it batches them, so the events of undelivered batches are left for the next run
+        {
+            auto settings = std::make_shared<PlayFabEventPipelineSettings>(PlayFabEventPipelineType::PlayFabTelemetry, true);
+            settings->authenticationContext = std::make_shared<PlayFabAuthenticationContext>();
+            settings->authenticationContext->entityToken = "entityToken";
+            settings->maximalNumberOfItemsInBatch = 3;
+            settings->spoolDirectory = directory;
+            RecordingEventPipeline pipeline(settings);
+            for (int i = 0; i < 3; ++i)
+            {
+                auto event = std::make_shared<PlayFabEvent>();
+                event->SetName("spooled_event");
+                auto request = std::make_shared<PlayFabEmitEventRequest>();
+                request->event = event;
+                pipeline.IntakeEvent(request);
+            }
+            if (pipeline.WaitForBatch(std::chrono::seconds(5)).second != 3)
+            {
+                testContext.Fail("The batch of spooled events was not sent");
+                return;
+            }
+        }
+
+        {
+            PlayFabEventSpool spool(directory, segmentSize, 3 * segmentSize, PlayFabEventSpoolSyncPolicy::SegmentFull);
+            std::string record;
+            Json::Value eventJson;
+            std::string errors;
+            if (!spool.Open(backlog) || backlog.count != 3 || !spool.Read(backlog.first, record) ||
+                !PlayFabJsonUtils::ParseFromString(record, eventJson, errors) || eventJson["Name"].asString() != "spooled_event")
+            {
+                testContext.Fail("The events of an undelivered batch were not left in the spool");
+                return;
+            }
+            spool.Release(backlog);
+        }
+#endif // !defined(DISABLE_PLAYFABENTITY_API)
+
+        testContext.Pass();
+    }
+
+    void PlayFabEventPipelineTest::AddTests()
+    {
+        AddTest("TestEventBufferProducers", &PlayFabEventPipelineTest::TestEventBufferProducers);
+        AddTest("TestEventPipelineFlushDeadline", &PlayFabEventPipelineTest::TestEventPipelineFlushDeadline);
+        AddTest("TestEventPipelineBatchSize", &PlayFabEventPipelineTest::TestEventPipelineBatchSize);
+        AddTest("TestEventBatchController", &PlayFabEventPipelineTest::TestEventBatchController);
+        AddTest("TestEventBatchingSimulation", &PlayFabEventPipelineTest::TestEventBatchingSimulation);
+        AddTest("TestEventPipelineRetries", &PlayFabEventPipelineTest::TestEventPipelineRetries);
+        AddTest("TestEventPipelineBatchCallback", &PlayFabEventPipelineTest::TestEventPipelineBatchCallback);
+        AddTest("TestEventPipelinePreSerializedEvents", &PlayFabEventPipelineTest::TestEventPipelinePreSerializedEvents);
+        AddTest("TestEventSpool", &PlayFabEventPipelineTest::TestEventSpool);
+    }
+
+    void PlayFabEventPipelineTest::Tick(TestContext& /*testContext*/)
+    {
+    }
+}
@@ -0,0 +1,28 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#pragma once
+
+#include "TestCase.h"
+
+namespace PlayFabUnit
+{
+    class PlayFabEventPipelineTest : public TestCase
+    {
+    private:
+        void TestEventBufferProducers(TestContext& testContext);
+        void TestEventPipelineFlushDeadline(TestContext& testContext);
+        void TestEventPipelineBatchSize(TestContext& testContext);
+        void TestEventBatchController(TestContext& testContext);
+        void TestEventBatchingSimulation(TestContext& testContext);
+        void TestEventPipelineRetries(TestContext& testContext);
+        void TestEventPipelineBatchCallback(TestContext& testContext);
+        void TestEventPipelinePreSerializedEvents(TestContext& testContext);
+        void TestEventSpool(TestContext& testContext);
+
+    protected:
+        void AddTests() override;
+
+    public:
+        void Tick(TestContext& testContext) override;
+    };
+}
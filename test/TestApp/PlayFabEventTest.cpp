@@ -343,7 +343,7 @@ namespace PlayFabUnit
 
     void PlayFabEventTest::SetUp(TestContext& /*testContext*/)
     {
-        PlayFabSettings::staticSettings->titleId = testTitleData.titleId;
+        PlayFabSettings::staticSettings->SetTitleId(testTitleData.titleId);
         // Reset event test values.
         eventBatchMax = 0;
         eventPassCount = 0;
@@ -12,6 +12,7 @@
 namespace PlayFab
 {
     struct PlayFabError;
+    class PlayFabEventsInstanceAPI;
 
     namespace EventsModels
     {
@@ -0,0 +1,201 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include "TestAppPch.h"
+
+#include <playfab/PlayFabEventPipeline.h>
+#include <playfab/PlayFabJsonUtils.h>
+#include <playfab/PlayFabMetricAggregator.h>
+#include "TestContext.h"
+#include "PlayFabMetricAggregatorTest.h"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <mutex>
+#include <thread>
+
+namespace PlayFabUnit
+{
+#if !defined(DISABLE_PLAYFABENTITY_API)
+    // An event pipeline which collects the events it takes in
+    class CollectingEventPipeline : public PlayFab::IPlayFabEventPipeline
+    {
+    public:
+        void Stop() override {}
+        void Update() override {}
+
+        void IntakeEvent(std::shared_ptr<const PlayFab::IPlayFabEmitEventRequest> request) override
+        {
+            std::unique_lock<std::mutex> lock(eventsMutex);
+            events.push_back(std::static_pointer_cast<const PlayFab::PlayFabEmitEventRequest>(request));
+        }
+
+        // Returns the events taken in since the last call, as JSON
+        std::vector<Json::Value> TakeEvents()
+        {
+            std::vector<std::shared_ptr<const PlayFab::PlayFabEmitEventRequest>> taken;
+            {
+                std::unique_lock<std::mutex> lock(eventsMutex);
+                taken.swap(events);
+            }
+
+            std::vector<Json::Value> eventsJson(taken.size());
+            std::string errors;
+            for (size_t i = 0; i < taken.size(); ++i)
+            {
+                PlayFab::PlayFabJsonUtils::ParseFromString(taken[i]->event->Serialize(), eventsJson[i], errors);
+            }
+            return eventsJson;
+        }
+
+    private:
+        std::mutex eventsMutex;
+        std::vector<std::shared_ptr<const PlayFab::PlayFabEmitEventRequest>> events;
+    };
+#endif // !defined(DISABLE_PLAYFABENTITY_API)
+
+    void PlayFabMetricAggregatorTest::TestMetricAggregator(TestContext& testContext)
+    {
+#if !defined(DISABLE_PLAYFABENTITY_API)
+        using namespace PlayFab;
+
+        auto pipeline = std::make_shared<CollectingEventPipeline>();
+        PlayFabMetricAggregator aggregator(pipeline, std::chrono::hours(1), false);
+        const PlayFabMetricId damage = aggregator.GetMetricId(PlayFabMetricType::Counter, "damage_dealt", { { "weapon", "sword" } });
+        const PlayFabMetricId frameTime = aggregator.GetMetricId(PlayFabMetricType::Histogram, "frame_time");
+        const PlayFabMetricId players = aggregator.GetMetricId(PlayFabMetricType::Gauge, "players");
+        if (aggregator.GetMetricId(PlayFabMetricType::Counter, "damage_dealt", { { "weapon", "sword" } }).index != damage.index ||
+            aggregator.GetMetricId(PlayFabMetricType::Counter, "damage_dealt", { { "weapon", "bow" } }).index == damage.index)
+        {
+            testContext.Fail("Metrics were not keyed by their name and dimensions");
+            return;
+        }
+
+        // Four threads fold their updates in parallel, while the aggregator is flushed
+        std::atomic<bool> isFlushing(true);
+        std::thread flushingThread([&]()
+        {
+            while (isFlushing)
+            {
+                aggregator.Flush();
+                std::this_thread::yield();
+            }
+        });
+        std::vector<std::thread> updatingThreads;
+        for (int thread = 0; thread < 4; ++thread)
+        {
+            updatingThreads.emplace_back([&]()
+            {
+                for (int i = 1; i <= 1000; ++i)
+                {
+                    aggregator.Update(damage, 2);
+                    aggregator.Update(frameTime, i % 100 + 1);
+                    aggregator.Update(players, 8);
+                }
+            });
+        }
+        for (std::thread& thread : updatingThreads)
+        {
+            thread.join();
+        }
+        isFlushing = false;
+        flushingThread.join();
+        aggregator.Flush();
+
+        // Add the summaries of all flushes up
+        uint64_t damageCount = 0, frameTimeCount = 0, frameTimeBucketCount = 0, playersCount = 0;
+        double damageSum = 0, frameTimeMin = 1000, frameTimeMax = 0;
+        for (const Json::Value& event : pipeline->TakeEvents())
+        {
+            const Json::Value& payload = event["Payload"];
+            const std::string name = event["Name"].asString();
+            if (name == "damage_dealt" && payload["MetricType"].asString() == "Counter" && payload["Dimensions"]["weapon"].asString() == "sword")
+            {
+                damageCount += payload["Count"].asUInt64();
+                damageSum += payload["Sum"].asDouble();
+            }
+            else if (name == "frame_time" && payload["MetricType"].asString() == "Histogram")
+            {
+                frameTimeCount += payload["Count"].asUInt64();
+                frameTimeMin = std::min(frameTimeMin, payload["Min"].asDouble());
+                frameTimeMax = std::max(frameTimeMax, payload["Max"].asDouble());
+                for (const Json::Value& bucket : payload["Buckets"])
+                {
+                    frameTimeBucketCount += bucket[1].asUInt64();
+                }
+            }
+            else if (name == "players" && payload["MetricType"].asString() == "Gauge" && payload["Value"].asDouble() == 8)
+            {
+                playersCount += payload["Count"].asUInt64();
+            }
+        }
+        if (damageCount != 4000 || damageSum != 8000 || frameTimeCount != 4000 || frameTimeBucketCount != 4000 ||
+            frameTimeMin != 1 || frameTimeMax != 100 || playersCount != 4000)
+        {
+            testContext.Fail("Updates were lost or counted twice");
+            return;
+        }
+
+        // One summary per metric per interval, with percentiles estimated within a bucket
+        aggregator.Update(frameTime, 1);
+        aggregator.Update(frameTime, 10);
+        aggregator.Update(frameTime, 100);
+        aggregator.FlushIfDue();
+        if (!pipeline->TakeEvents().empty())
+        {
+            testContext.Fail("The aggregator was flushed before the end of its interval");
+            return;
+        }
+        aggregator.Flush();
+        const std::vector<Json::Value> summaries = pipeline->TakeEvents();
+        if (summaries.size() != 1 || summaries[0]["Payload"]["Count"].asUInt64() != 3 || summaries[0]["Payload"]["Buckets"].size() != 3 ||
+            std::abs(summaries[0]["Payload"]["P50"].asDouble() - 10) > 10 * 0.2)
+        {
+            testContext.Fail("The summary of the histogram is not accurate");
+            return;
+        }
+
+        // An id of another aggregator, with more metrics than this one, is ignored
+        PlayFabMetricAggregator otherAggregator(pipeline, std::chrono::hours(1), false);
+        otherAggregator.GetMetricId(PlayFabMetricType::Counter, "a");
+        otherAggregator.GetMetricId(PlayFabMetricType::Counter, "b");
+        otherAggregator.GetMetricId(PlayFabMetricType::Counter, "c");
+        otherAggregator.GetMetricId(PlayFabMetricType::Counter, "d");
+        const PlayFabMetricId foreignId = otherAggregator.GetMetricId(PlayFabMetricType::Counter, "e");
+        aggregator.Update(foreignId, 1);
+        aggregator.Update(PlayFabMetricId(), 1);
+        aggregator.Flush();
+        if (!pipeline->TakeEvents().empty())
+        {
+            testContext.Fail("An id which was not registered with the aggregator was summarized");
+            return;
+        }
+
+        // An id of another type than the metric at its index is ignored, as it would be folded into a state of another layout
+        PlayFabMetricId mismatchedId;
+        mismatchedId.index = frameTime.index;
+        mismatchedId.type = PlayFabMetricType::Counter;
+        aggregator.Update(mismatchedId, 5);
+        mismatchedId.index = damage.index;
+        mismatchedId.type = PlayFabMetricType::Histogram;
+        aggregator.Update(mismatchedId, 5);
+        aggregator.Flush();
+        if (!pipeline->TakeEvents().empty())
+        {
+            testContext.Fail("An id of another type of metric was summarized");
+            return;
+        }
+#endif // !defined(DISABLE_PLAYFABENTITY_API)
+
+        testContext.Pass();
+    }
+
+    void PlayFabMetricAggregatorTest::AddTests()
+    {
+        AddTest("TestMetricAggregator", &PlayFabMetricAggregatorTest::TestMetricAggregator);
+    }
+
+    void PlayFabMetricAggregatorTest::Tick(TestContext& /*testContext*/)
+    {
+    }
+}
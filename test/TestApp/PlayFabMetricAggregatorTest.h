@@ -0,0 +1,20 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#pragma once
+
+#include "TestCase.h"
+
+namespace PlayFabUnit
+{
+    class PlayFabMetricAggregatorTest : public TestCase
+    {
+    private:
+        void TestMetricAggregator(TestContext& testContext);
+
+    protected:
+        void AddTests() override;
+
+    public:
+        void Tick(TestContext& testContext) override;
+    };
+}
@@ -79,7 +79,7 @@ namespace PlayFabUnit
 
     void PlayFabQoSTest::SetUp(TestContext& /*testContext*/)
     {
-        PlayFabSettings::staticSettings->titleId = testTitleData.titleId;
+        PlayFabSettings::staticSettings->SetTitleId(testTitleData.titleId);
     }
 
     void PlayFabQoSTest::Tick(TestContext& /*testContext*/)
@@ -0,0 +1,206 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include "TestAppPch.h"
+
+#include <playfab/PlayFabAuthenticationDataModels.h>
+#include <playfab/PlayFabCloudScriptDataModels.h>
+#include <playfab/PlayFabJsonSerializerPlugin.h>
+#include <playfab/PlayFabMessagePackSerializerPlugin.h>
+#include <limits>
+#include "TestContext.h"
+#include "PlayFabSerializerTest.h"
+
+namespace PlayFabUnit
+{
+    void PlayFabSerializerTest::TestMessagePackRoundTrip(TestContext& testContext)
+    {
+        // Cover every size boundary of the MessagePack int, str, array and map encodings.
+        // Non-negative ints that fit int64 are stored as intValue, the same as jsoncpp's own parser does.
+        Json::Value input;
+        input["null"] = Json::Value::null;
+        input["true"] = true;
+        input["false"] = false;
+        input["real"] = 3.25;
+        input["largeReal"] = -1.5e300;
+        input["maxUInt64"] = std::numeric_limits<Json::LargestUInt>::max();
+        const Json::LargestInt ints[] = { 0, 127, 128, 255, 256, 65535, 65536, 4294967295LL, 4294967296LL, std::numeric_limits<Json::LargestInt>::max(),
+            -1, -32, -33, -128, -129, -32768, -32769, -2147483648LL, -2147483649LL, std::numeric_limits<Json::LargestInt>::min() };
+        for (Json::LargestInt value : ints)
+        {
+            input["ints"].append(Json::Value(value));
+        }
+        const size_t stringLengths[] = { 0, 31, 32, 255, 256, 65535, 65536 };
+        for (size_t length : stringLengths)
+        {
+            input["strings"].append(std::string(length, 's'));
+        }
+        for (int i = 0; i < 16; ++i)
+        {
+            input["array16"].append(i);
+            input["map16"]["key" + std::to_string(i)] = i;
+        }
+        for (int i = 0; i < 15; ++i)
+        {
+            input["fixArray"].append(i);
+            input["fixMap"]["key" + std::to_string(i)] = Json::Value(Json::arrayValue);
+        }
+
+        PlayFab::PlayFabMessagePackSerializerPlugin serializer;
+        std::string bytes;
+        serializer.Serialize(input, bytes);
+
+        Json::Value output;
+        std::string errors;
+        if (!serializer.Deserialize(bytes.data(), bytes.size(), output, errors))
+        {
+            testContext.Fail("Deserialize failed: " + errors);
+            return;
+        }
+        if (output != input)
+        {
+            testContext.Fail("Value changed after a MessagePack round trip: " + output.toStyledString());
+            return;
+        }
+
+        testContext.Pass();
+    }
+
+    void PlayFabSerializerTest::TestMessagePackMalformedData(TestContext& testContext)
+    {
+        PlayFab::PlayFabMessagePackSerializerPlugin serializer;
+        const std::string malformedInputs[] = {
+            std::string(), // empty
+            std::string("\xdb\xff\xff\xff\xff", 5), // str32 longer than the data
+            std::string("\xdd\xff\xff\xff\xff", 5), // array32 with more elements than the data
+            std::string("\x81\x01\x02", 3), // map with a non-string key
+            std::string("\xc1", 1), // never used marker
+            std::string("\xd4\x01\x02", 3), // fixext
+            std::string("\xc0\xc0", 2), // trailing data
+            std::string(300, '\x91'), // nested too deeply
+        };
+
+        for (const std::string& malformedInput : malformedInputs)
+        {
+            Json::Value output;
+            std::string errors;
+            if (serializer.Deserialize(malformedInput.data(), malformedInput.size(), output, errors) || errors.empty())
+            {
+                testContext.Fail("Malformed MessagePack data was not rejected");
+                return;
+            }
+        }
+
+        testContext.Pass();
+    }
+
+    void PlayFabSerializerTest::TestSerializerModelRoundTrip(TestContext& testContext)
+    {
+#if !defined(DISABLE_PLAYFABENTITY_API)
+        PlayFab::AuthenticationModels::GetEntityTokenResponse model;
+        model.EntityToken = "token";
+        model.TokenExpiration = static_cast<time_t>(1600000000);
+        PlayFab::AuthenticationModels::EntityKey entity;
+        entity.Id = "id";
+        entity.Type = "title_player_account";
+        model.Entity = entity;
+
+        PlayFab::PlayFabJsonSerializerPlugin jsonSerializer;
+        PlayFab::PlayFabMessagePackSerializerPlugin messagePackSerializer;
+        PlayFab::IPlayFabSerializerPlugin* serializers[] = { &jsonSerializer, &messagePackSerializer };
+        for (PlayFab::IPlayFabSerializerPlugin* serializer : serializers)
+        {
+            std::string bytes;
+            serializer->SerializeModel(model, bytes);
+
+            PlayFab::AuthenticationModels::GetEntityTokenResponse output;
+            std::string errors;
+            if (!serializer->DeserializeModel(bytes.data(), bytes.size(), output, errors))
+            {
+                testContext.Fail("DeserializeModel failed: " + errors);
+                return;
+            }
+            if (output.ToJson() != model.ToJson())
+            {
+                testContext.Fail("Model changed after a serializer round trip");
+                return;
+            }
+        }
+#endif // !defined(DISABLE_PLAYFABENTITY_API)
+
+        testContext.Pass();
+    }
+
+    void PlayFabSerializerTest::TestBoxedNullValues(TestContext& testContext)
+    {
+#if defined(PLAYFAB_BOXED_NULL_VALUES)
+        // Boxed types with a null value don't need a separate isSet flag
+        static_assert(sizeof(PlayFab::Boxed<double>) == sizeof(double), "Boxed<double> is stored with a flag");
+        static_assert(std::is_same<time_t, Int64>::value || sizeof(PlayFab::Boxed<time_t>) == sizeof(time_t), "Boxed<time_t> is stored with a flag");
+#else
+        // Without the opt-in every value is a real value, even the ones which could serve as a null value
+        PlayFab::Boxed<double> notANumber = std::numeric_limits<double>::quiet_NaN();
+        PlayFab::Boxed<time_t> minimalTime = (std::numeric_limits<time_t>::min)();
+        PlayFab::Boxed<Int64> minimalInt64 = (std::numeric_limits<Int64>::min)();
+        if (notANumber.isNull() || minimalTime.isNull() || minimalInt64.isNull())
+        {
+            testContext.Fail("A Boxed field set to a value is null");
+            return;
+        }
+#endif // defined(PLAYFAB_BOXED_NULL_VALUES)
+        static_assert(sizeof(PlayFab::Boxed<Int64>) > sizeof(Int64), "Boxed<Int64> is stored without a flag");
+
+#if !defined(DISABLE_PLAYFABENTITY_API)
+        using namespace PlayFab::CloudScriptModels;
+#if defined(PLAYFAB_BOXED_NULL_VALUES)
+        static_assert(sizeof(PlayFab::Boxed<LoginIdentityProvider>) == sizeof(LoginIdentityProvider), "Boxed enums are stored with a flag");
+#endif // defined(PLAYFAB_BOXED_NULL_VALUES)
+
+        PlayerProfileModel profile;
+        LocationModel location;
+        if (profile.Created.notNull() || profile.Origination.notNull() || location.Latitude.notNull())
+        {
+            testContext.Fail("A default constructed Boxed field is not null");
+            return;
+        }
+
+        // Zero is a real value, not null
+        profile.Created = 0;
+        profile.Origination = static_cast<LoginIdentityProvider>(0);
+        location.Latitude = 0.0;
+        if (profile.Created.isNull() || profile.Origination.isNull() || location.Latitude.isNull())
+        {
+            testContext.Fail("A Boxed field set to zero is null");
+            return;
+        }
+
+        profile.LastLogin = 1500000000;
+        profile.Created.setNull();
+        location.Longitude = -122.5;
+        PlayerProfileModel decodedProfile;
+        decodedProfile.FromJson(profile.ToJson());
+        LocationModel decodedLocation;
+        decodedLocation.FromJson(location.ToJson());
+        if (decodedProfile.Created.notNull() || decodedProfile.LastLogin.isNull() || static_cast<time_t>(decodedProfile.LastLogin) != 1500000000 ||
+            decodedProfile.Origination.isNull() || decodedProfile.BannedUntil.notNull() ||
+            decodedLocation.Latitude.isNull() || static_cast<double>(decodedLocation.Longitude) != -122.5 || decodedLocation.pfCountryCode.notNull())
+        {
+            testContext.Fail("Boxed fields did not round trip through json");
+            return;
+        }
+#endif // !defined(DISABLE_PLAYFABENTITY_API)
+
+        testContext.Pass();
+    }
+
+    void PlayFabSerializerTest::AddTests()
+    {
+        AddTest("TestMessagePackRoundTrip", &PlayFabSerializerTest::TestMessagePackRoundTrip);
+        AddTest("TestMessagePackMalformedData", &PlayFabSerializerTest::TestMessagePackMalformedData);
+        AddTest("TestSerializerModelRoundTrip", &PlayFabSerializerTest::TestSerializerModelRoundTrip);
+        AddTest("TestBoxedNullValues", &PlayFabSerializerTest::TestBoxedNullValues);
+    }
+
+    void PlayFabSerializerTest::Tick(TestContext& /*testContext*/)
+    {
+    }
+}
@@ -0,0 +1,23 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#pragma once
+
+#include "TestCase.h"
+
+namespace PlayFabUnit
+{
+    class PlayFabSerializerTest : public TestCase
+    {
+    private:
+        void TestMessagePackRoundTrip(TestContext& testContext);
+        void TestMessagePackMalformedData(TestContext& testContext);
+        void TestSerializerModelRoundTrip(TestContext& testContext);
+        void TestBoxedNullValues(TestContext& testContext);
+
+    protected:
+        void AddTests() override;
+
+    public:
+        void Tick(TestContext& testContext) override;
+    };
+}
@@ -0,0 +1,118 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#include "TestAppPch.h"
+
+#include <playfab/PlayFabApiSettings.h>
+#include <playfab/PlayFabJsonSerializerPlugin.h>
+#include <playfab/PlayFabPluginManager.h>
+#include <playfab/PlayFabSettings.h>
+#include <atomic>
+#include <thread>
+#include "TestContext.h"
+#include "PlayFabSettingsTest.h"
+
+namespace PlayFabUnit
+{
+    void PlayFabSettingsTest::TestApiSettingsUrlCache(TestContext& testContext)
+    {
+        PlayFab::PlayFabApiSettings settings;
+        settings.SetTitleId("ABCD");
+        settings.SetBaseServiceHost(".example.com");
+        const std::string sdkParam = "?sdk=" + PlayFab::PlayFabSettings::versionString;
+
+        if (settings.GetUrl("/Client/GetTime") != "https://ABCD.example.com/Client/GetTime" + sdkParam)
+        {
+            testContext.Fail("Unexpected url: " + settings.GetUrl("/Client/GetTime"));
+            return;
+        }
+
+        // Every setter publishes the url for its new value
+        settings.SetTitleId("EFGH");
+        if (settings.GetUrl("/Client/GetTime") != "https://EFGH.example.com/Client/GetTime" + sdkParam || settings.GetTitleId() != "EFGH")
+        {
+            testContext.Fail("Url was not updated after titleId changed: " + settings.GetUrl("/Client/GetTime"));
+            return;
+        }
+
+        settings.SetBaseServiceHost(".example.net");
+        settings.SetRequestGetParam("extra", "1");
+        if (settings.GetUrl("/Server/GetTime") != "https://EFGH.example.net/Server/GetTime?extra=1&" + sdkParam.substr(1))
+        {
+            testContext.Fail("Url was not updated after baseServiceHost and requestGetParams changed: " + settings.GetUrl("/Server/GetTime"));
+            return;
+        }
+
+        settings.RemoveRequestGetParam("extra");
+        if (settings.GetUrl("/Server/GetTime") != "https://EFGH.example.net/Server/GetTime" + sdkParam || settings.GetRequestGetParams().size() != 1)
+        {
+            testContext.Fail("Url was not updated after a request param was removed: " + settings.GetUrl("/Server/GetTime"));
+            return;
+        }
+
+        // Urls read while the title changes are built from one title or the other, never from a part of each
+        std::atomic<bool> isSetting(true);
+        std::thread settingThread([&]()
+        {
+            for (int i = 0; i < 2000; ++i)
+            {
+                settings.SetTitleId((i % 2 == 0) ? "ABCD" : "EFGH");
+            }
+            isSetting = false;
+        });
+        bool isTorn = false;
+        while (isSetting)
+        {
+            const std::string url = settings.GetUrl("/Client/GetTime");
+            isTorn |= url != "https://ABCD.example.net/Client/GetTime" + sdkParam && url != "https://EFGH.example.net/Client/GetTime" + sdkParam;
+        }
+        settingThread.join();
+        if (isTorn || settings.GetUrl("/Client/GetTime") != "https://EFGH.example.net/Client/GetTime" + sdkParam)
+        {
+            testContext.Fail("A url was read from settings that were being set");
+            return;
+        }
+
+        testContext.Pass();
+    }
+
+    void PlayFabSettingsTest::TestPluginLookupCache(TestContext& testContext)
+    {
+        PlayFab::PlayFabPluginManager pluginManager;
+        std::shared_ptr<PlayFab::IPlayFabPlugin> firstPlugin = std::make_shared<PlayFab::PlayFabJsonSerializerPlugin>();
+        std::weak_ptr<PlayFab::IPlayFabPlugin> firstPluginWeak = firstPlugin;
+
+        pluginManager.SetPluginInstance(firstPlugin, PlayFab::PlayFabPluginContract::PlayFab_Serializer);
+        firstPlugin.reset();
+        if (pluginManager.GetPluginInstance<PlayFab::IPlayFabSerializerPlugin>(PlayFab::PlayFabPluginContract::PlayFab_Serializer) != firstPluginWeak.lock())
+        {
+            testContext.Fail("GetPluginInstance did not return the plugin that was set");
+            return;
+        }
+
+        // The second lookup is served from the per-thread cache, replacing the plugin must still be visible right away
+        std::shared_ptr<PlayFab::IPlayFabPlugin> secondPlugin = std::make_shared<PlayFab::PlayFabJsonSerializerPlugin>();
+        pluginManager.SetPluginInstance(secondPlugin, PlayFab::PlayFabPluginContract::PlayFab_Serializer);
+        if (pluginManager.GetPluginInstance<PlayFab::IPlayFabSerializerPlugin>(PlayFab::PlayFabPluginContract::PlayFab_Serializer) != secondPlugin)
+        {
+            testContext.Fail("GetPluginInstance returned a stale plugin after SetPluginInstance");
+            return;
+        }
+        if (!firstPluginWeak.expired())
+        {
+            testContext.Fail("A replaced plugin is still being kept alive by the lookup cache");
+            return;
+        }
+
+        testContext.Pass();
+    }
+
+    void PlayFabSettingsTest::AddTests()
+    {
+        AddTest("TestApiSettingsUrlCache", &PlayFabSettingsTest::TestApiSettingsUrlCache);
+        AddTest("TestPluginLookupCache", &PlayFabSettingsTest::TestPluginLookupCache);
+    }
+
+    void PlayFabSettingsTest::Tick(TestContext& /*testContext*/)
+    {
+    }
+}
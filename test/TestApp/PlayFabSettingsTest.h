@@ -0,0 +1,21 @@
+// Copyright (C) Microsoft Corporation. All rights reserved.
+
+#pragma once
+
+#include "TestCase.h"
+
+namespace PlayFabUnit
+{
+    class PlayFabSettingsTest : public TestCase
+    {
+    private:
+        void TestApiSettingsUrlCache(TestContext& testContext);
+        void TestPluginLookupCache(TestContext& testContext);
+
+    protected:
+        void AddTests() override;
+
+    public:
+        void Tick(TestContext& testContext) override;
+    };
+}
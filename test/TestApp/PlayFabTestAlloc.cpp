@@ -2,12 +2,53 @@
 
 #include "TestAppPch.h"
 
+#include <playfab/PlayFabApiDispatch.h>
 #include <playfab/PlayFabApiSettings.h>
 #include <playfab/PlayFabAuthenticationContext.h>
 #include <playfab/PlayFabAuthenticationInstanceApi.h>
+#include <playfab/PlayFabCallRequestContainer.h>
+#include <playfab/PlayFabJsonUtils.h>
+#include <playfab/PlayFabSettings.h>
 #include "TestContext.h"
 #include "PlayFabTestAlloc.h"
 
+#if defined(PLAYFAB_TEST_COUNT_ALLOCATIONS)
+#include <cstdlib>
+
+// The allocation counting tests replace the global operator new/delete of the whole executable, so they are opt-in.
+// Only define PLAYFAB_TEST_COUNT_ALLOCATIONS for a test build which is its own executable (the Linux makefile does).
+namespace PlayFabUnit
+{
+    // Counts the allocations made on the current thread while countAllocations is set
+    static thread_local bool countAllocations = false;
+    static thread_local size_t allocationCount = 0;
+}
+
+void* operator new(std::size_t size)
+{
+    if (PlayFabUnit::countAllocations)
+    {
+        ++PlayFabUnit::allocationCount;
+    }
+    void* memory = std::malloc(size != 0 ? size : 1);
+    if (memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+#endif // defined(PLAYFAB_TEST_COUNT_ALLOCATIONS)
+
 namespace PlayFabUnit
 {
     void PlayFabTestAlloc::TestApiSettingsAlloc(TestContext& testContext)
@@ -16,21 +57,21 @@ namespace PlayFabUnit
 
         // Settings
         PlayFab::PlayFabApiSettings* testPtrSettings = new PlayFab::PlayFabApiSettings();
-        testPtrSettings->titleId = "this should succeed";
+        testPtrSettings->SetTitleId("this should succeed");
 #if defined(ENABLE_PLAYFABSERVER_API) || defined(ENABLE_PLAYFABADMIN_API)
         testPtrSettings->developerSecretKey = "this is conditional";
 #endif
         delete testPtrSettings;
 
         std::shared_ptr<PlayFab::PlayFabApiSettings> testMSpSettings = std::make_shared<PlayFab::PlayFabApiSettings>();
-        testMSpSettings->titleId = "this should succeed";
+        testMSpSettings->SetTitleId("this should succeed");
 #if defined(ENABLE_PLAYFABSERVER_API) || defined(ENABLE_PLAYFABADMIN_API)
         testMSpSettings->developerSecretKey = "this is conditional";
 #endif
         testMSpSettings.reset();
 
         std::shared_ptr<PlayFab::PlayFabApiSettings> testNSpSettings = std::shared_ptr<PlayFab::PlayFabApiSettings>(new PlayFab::PlayFabApiSettings());
-        testNSpSettings->titleId = "this should succeed";
+        testNSpSettings->SetTitleId("this should succeed");
 #if defined(ENABLE_PLAYFABSERVER_API) || defined(ENABLE_PLAYFABADMIN_API)
         testNSpSettings->developerSecretKey = "this is conditional";
 #endif
@@ -85,11 +126,116 @@ namespace PlayFabUnit
         testContext.Pass();
     }
 
+    void PlayFabTestAlloc::TestSuccessPathNoAlloc(TestContext& testContext)
+    {
+        // Only checks which data node it is decoded from, so any allocation below is made by the shared success path
+        struct DataNodeResult : public PlayFab::PlayFabResultCommon
+        {
+            const Json::Value* data = nullptr;
+
+            void FromJson(const Json::Value& input) override { data = &input; }
+            Json::Value ToJson() const override { return Json::Value(); }
+        };
+
+        std::shared_ptr<PlayFab::CallRequestContainer> reqContainer = std::make_shared<PlayFab::CallRequestContainer>(
+            "/Test/SuccessPath",
+            PlayFab::PlayFabRequestHeaders(),
+            "{\"Key\":\"value\"}",
+            nullptr,
+            PlayFab::PlayFabSettings::staticSettings,
+            nullptr,
+            nullptr);
+
+        std::string response = "{\"code\":200,\"status\":\"OK\",\"data\":{\"Items\":[";
+        for (int i = 0; i < 1000; ++i)
+        {
+            response += (i == 0 ? "" : ",") + std::string("{\"ItemId\":\"item") + std::to_string(i) + "\"}";
+        }
+        response += "]}}";
+        std::string errors;
+        if (!PlayFab::PlayFabJsonUtils::ParseFromString(response, reqContainer->responseJson, errors))
+        {
+            testContext.Fail("Failed to parse the test response: " + errors);
+            return;
+        }
+
+        struct ResultState
+        {
+            const Json::Value* data = nullptr;
+            bool hasRequest = false;
+        } resultState;
+        reqContainer->successCallback.Set<DataNodeResult>([&resultState](const DataNodeResult& result, void*)
+        {
+            resultState.data = result.data;
+            resultState.hasRequest = result.Request.isMember("Key");
+        });
+
+        // The request json is parsed when the request body is released, which is not part of decoding the response
+        reqContainer->ReleaseRequestBody();
+
+#if defined(PLAYFAB_TEST_COUNT_ALLOCATIONS)
+        allocationCount = 0;
+        countAllocations = true;
+#endif
+        reqContainer->ProcessResponseJson();
+        PlayFab::PlayFabApiDispatch::OnApiResult<DataNodeResult>(200, response, reqContainer);
+#if defined(PLAYFAB_TEST_COUNT_ALLOCATIONS)
+        countAllocations = false;
+#endif
+
+        if (resultState.data != &reqContainer->responseJson["data"] || !resultState.hasRequest)
+        {
+            testContext.Fail("The result was not decoded from the response data node");
+            return;
+        }
+#if defined(PLAYFAB_TEST_COUNT_ALLOCATIONS)
+        if (allocationCount != 0)
+        {
+            testContext.Fail("The success path made " + std::to_string(allocationCount) + " allocations, expected none");
+            return;
+        }
+
+        testContext.Pass();
+#else
+        testContext.Skip("Allocations are only counted with PLAYFAB_TEST_COUNT_ALLOCATIONS");
+#endif
+    }
+
+    void PlayFabTestAlloc::TestRequestHeadersAlloc(TestContext& testContext)
+    {
+#if defined(PLAYFAB_TEST_COUNT_ALLOCATIONS)
+        const std::string sessionTicket(256, 't');
+        const std::string entityToken(256, 'e');
+
+        // Each header is a single allocation, for its "Name: value" line, which moves into the container without a copy
+        allocationCount = 0;
+        countAllocations = true;
+        PlayFab::PlayFabRequestHeaders headers;
+        headers.Set(PlayFab::PlayFabRequestHeaderKey::Authorization, sessionTicket);
+        headers.Set(PlayFab::PlayFabRequestHeaderKey::EntityToken, entityToken);
+        headers.Set(PlayFab::PlayFabRequestHeaderKey::SecretKey, "");
+        PlayFab::PlayFabRequestHeaders movedHeaders(std::move(headers));
+        countAllocations = false;
+
+        if (allocationCount != 2)
+        {
+            testContext.Fail("Setting two headers made " + std::to_string(allocationCount) + " allocations, expected 2");
+            return;
+        }
+
+        testContext.Pass();
+#else
+        testContext.Skip("Allocations are only counted with PLAYFAB_TEST_COUNT_ALLOCATIONS");
+#endif
+    }
+
     void PlayFabTestAlloc::AddTests()
     {
         AddTest("TestApiSettingsAlloc", &PlayFabTestAlloc::TestApiSettingsAlloc);
         AddTest("TestAuthContextAlloc", &PlayFabTestAlloc::TestAuthContextAlloc);
         AddTest("TestApiInstanceAlloc", &PlayFabTestAlloc::TestApiInstanceAlloc);
+        AddTest("TestSuccessPathNoAlloc", &PlayFabTestAlloc::TestSuccessPathNoAlloc);
+        AddTest("TestRequestHeadersAlloc", &PlayFabTestAlloc::TestRequestHeadersAlloc);
     }
 
     void PlayFabTestAlloc::Tick(TestContext& /*testContext*/)
@@ -12,6 +12,8 @@ namespace PlayFabUnit
         void TestApiSettingsAlloc(TestContext& testContext);
         void TestAuthContextAlloc(TestContext& testContext);
         void TestApiInstanceAlloc(TestContext& testContext);
+        void TestSuccessPathNoAlloc(TestContext& testContext);
+        void TestRequestHeadersAlloc(TestContext& testContext);
 
     protected:
         void AddTests() override;
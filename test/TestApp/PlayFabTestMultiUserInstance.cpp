@@ -94,7 +94,7 @@ namespace PlayFabUnit
     void PlayFabTestMultiUserInstance::ClassSetUp()
     {
         settings2 = std::make_shared<PlayFab::PlayFabApiSettings>();
-        settings2->titleId = testTitleData.titleId;
+        settings2->SetTitleId(testTitleData.titleId);
 
         // Create API handles for all users.
         multiUser1ClientApi = std::make_shared<PlayFabClientInstanceAPI>();
@@ -103,7 +103,7 @@ namespace PlayFabUnit
 
     void PlayFabTestMultiUserInstance::SetUp(TestContext& /*testContext*/)
     {
-        PlayFab::PlayFabSettings::staticSettings->titleId = testTitleData.titleId;
+        PlayFab::PlayFabSettings::staticSettings->SetTitleId(testTitleData.titleId);
 
         // Make sure PlayFab state is clean.
         PlayFabSettings::ForgetAllCredentials();
@@ -146,7 +146,7 @@ namespace PlayFabUnit
     void PlayFabTestMultiUserInstance::TearDown(TestContext& /*testContext*/)
     {
         // Clean up PlayFab state for next TestCase.
-        PlayFab::PlayFabSettings::staticSettings->titleId.clear();
+        PlayFab::PlayFabSettings::staticSettings->SetTitleId("");
         PlayFabSettings::ForgetAllCredentials();
         multiUser1ClientApi->ForgetAllCredentials();
         multiUser2ClientApi->ForgetAllCredentials();
@@ -103,7 +103,7 @@ namespace PlayFabUnit
 
     void PlayFabTestMultiUserStatic::SetUp(TestContext& /*testContext*/)
     {
-        PlayFab::PlayFabSettings::staticSettings->titleId = testTitleData.titleId;
+        PlayFab::PlayFabSettings::staticSettings->SetTitleId(testTitleData.titleId);
 
         // Make sure PlayFab state is clean.
         PlayFabSettings::ForgetAllCredentials();
@@ -146,7 +146,7 @@ namespace PlayFabUnit
     void PlayFabTestMultiUserStatic::TearDown(TestContext& /*testContext*/)
     {
         // Clean up PlayFab state for next TestCase.
-        PlayFab::PlayFabSettings::staticSettings->titleId.clear();
+        PlayFab::PlayFabSettings::staticSettings->SetTitleId("");
         PlayFabSettings::ForgetAllCredentials();
     }
 
@@ -26,6 +26,11 @@
 #include <playfab/PlayFabJsonHeaders.h>
 
 #include "PlayFabTestAlloc.h"
+#include "PlayFabCallRequestTest.h"
+#include "PlayFabSettingsTest.h"
+#include "PlayFabSerializerTest.h"
+#include "PlayFabEventPipelineTest.h"
+#include "PlayFabMetricAggregatorTest.h"
 
 namespace PlayFabUnit
 {
@@ -77,6 +82,21 @@ namespace PlayFabUnit
         PlayFabTestAlloc allocTest;
         testRunner.Add(allocTest);
 
+        PlayFabCallRequestTest callRequestTest;
+        testRunner.Add(callRequestTest);
+
+        PlayFabSettingsTest settingsTest;
+        testRunner.Add(settingsTest);
+
+        PlayFabSerializerTest serializerTest;
+        testRunner.Add(serializerTest);
+
+        PlayFabEventPipelineTest eventPipelineTest;
+        testRunner.Add(eventPipelineTest);
+
+        PlayFabMetricAggregatorTest metricAggregatorTest;
+        testRunner.Add(metricAggregatorTest);
+
 #if !defined(DISABLE_PLAYFABCLIENT_API)
         // Set this up for use when the tests finish
         this->clientApi = std::make_shared<PlayFab::PlayFabClientInstanceAPI>(PlayFab::PlayFabSettings::staticPlayer);
@@ -122,7 +142,7 @@ namespace PlayFabUnit
 
 #if !defined(DISABLE_PLAYFABCLIENT_API)
         // Publish the test report via cloud script (and wait for it to finish).
-        PlayFab::PlayFabSettings::staticSettings->titleId = testTitleData.titleId;
+        PlayFab::PlayFabSettings::staticSettings->SetTitleId(testTitleData.titleId);
 
         PlayFab::ClientModels::LoginWithCustomIDRequest request;
         request.CustomId = PlayFab::PlayFabSettings::buildIdentifier;